@@ -69,6 +69,12 @@
 
 /* BSP Common Includes (Other than bsp_common.h) */
 #include "../../src/bsp/mcu/all/bsp_delay.h"
+#include "../../src/bsp/mcu/all/bsp_latency.h"
+#include "../../src/bsp/mcu/all/bsp_boot.h"
+#include "../../src/bsp/mcu/all/bsp_heap.h"
+#include "../../src/bsp/mcu/all/bsp_monitor.h"
+#include "../../src/bsp/mcu/all/bsp_trace.h"
+#include "../../src/bsp/mcu/all/bsp_queue.h"
 #include "../../src/bsp/mcu/all/bsp_mcu_api.h"
 
 /** Common macro for FSP header files. There is also a corresponding FSP_FOOTER macro at the end of this file. */
@@ -29,8 +29,9 @@
  *
  * @section CRC_API_SUMMARY Summary
  * The CRC (Cyclic Redundancy Check) calculator generates CRC codes using five different polynomials including 8 bit,
- * 16 bit, and 32 bit variations. Calculation can be performed by sending data to the block using the CPU or by snooping
- * on read or write activity on one of 10 SCI channels.
+ * 16 bit, and 32 bit variations. Calculation can be performed by sending data to the block using the CPU or a DMA
+ * transfer, or by snooping on read or write activity on one of 10 SCI channels. A partial calculation can be saved and
+ * restored so several streams of data can share the calculator.
  *
  * Implemented by:
  * - @ref CRC
@@ -44,6 +45,7 @@
 
 /* Register definitions, common services and error codes. */
 #include "bsp_api.h"
+#include "r_transfer_api.h"
 
 /* Common macro for FSP header files. There is also a corresponding FSP_FOOTER macro at the end of this file. */
 FSP_HEADER
@@ -142,6 +144,13 @@ typedef struct st_crc_input_t
     void   * p_input_buffer;           // Pointer to input buffer
 } crc_input_t;
 
+/** Partial CRC calculation, used to suspend a stream of data and resume it later. */
+typedef struct st_crc_state
+{
+    uint32_t            value;         ///< Partial CRC value
+    crc_snoop_address_t snoop_address; ///< Snoop address if snooping was enabled, CRC_SNOOP_ADDRESS_NONE otherwise
+} crc_state_t;
+
 /** CRC control block.  Allocate an instance specific control block to pass into the CRC API calls.
  * @par Implemented as
  * - crc_instance_ctrl_t
@@ -154,7 +163,11 @@ typedef struct st_crc_cfg
     crc_polynomial_t    polynomial;    ///< CRC Generating Polynomial Switching (GPS)
     crc_bit_order_t     bit_order;     ///< CRC Calculation Switching (LMS)
     crc_snoop_address_t snoop_address; ///< Register Snoop Address (CRCSA)
-    void const        * p_extend;      ///< CRC Hardware Dependent Configuration
+
+    /** Software started DMAC transfer used by @ref crc_api_t::calculateStart. Set to NULL if unused. The transfer
+     *  callback, if any, is called when the calculation completes. */
+    transfer_instance_t const * p_transfer;
+    void const                * p_extend; ///< CRC Hardware Dependent Configuration
 } crc_cfg_t;
 
 /** CRC driver structure. General CRC functions implemented at the HAL layer will follow this API. */
@@ -214,6 +227,34 @@ typedef struct st_crc_api
      **/
     fsp_err_t (* calculate)(crc_ctrl_t * const p_ctrl, crc_input_t * const p_crc_input, uint32_t * p_crc_result);
 
+    /** Start a CRC calculation on a block of data using the DMA transfer. The result is read with
+     * @ref crc_api_t::crcResultGet once the transfer completes.
+     * @par Implemented as
+     * - @ref R_CRC_CalculateStart()
+     *
+     * @param[in]  p_ctrl         Pointer to crc device handle.
+     * @param[in]  p_crc_input    A pointer to structure for CRC inputs
+     **/
+    fsp_err_t (* calculateStart)(crc_ctrl_t * const p_ctrl, crc_input_t * const p_crc_input);
+
+    /** Save the partial calculation and release the calculator for another stream of data.
+     * @par Implemented as
+     * - @ref R_CRC_StateSave()
+     *
+     * @param[in]  p_ctrl         Pointer to crc device handle.
+     * @param[out] p_state        Saved partial calculation.
+     **/
+    fsp_err_t (* stateSave)(crc_ctrl_t * const p_ctrl, crc_state_t * const p_state);
+
+    /** Restore a partial calculation saved by @ref crc_api_t::stateSave.
+     * @par Implemented as
+     * - @ref R_CRC_StateRestore()
+     *
+     * @param[in]  p_ctrl         Pointer to crc device handle.
+     * @param[in]  p_state        Partial calculation to resume.
+     **/
+    fsp_err_t (* stateRestore)(crc_ctrl_t * const p_ctrl, crc_state_t const * const p_state);
+
     /** Get the driver version based on compile time macros.
      * @par Implemented as
      * - @ref R_CRC_VersionGet()
@@ -63,7 +63,8 @@ typedef enum e_ctsu_event
     CTSU_EVENT_SCAN_COMPLETE = 0x00,   ///< Normal end
     CTSU_EVENT_OVERFLOW      = 0x01,   ///< Sensor counter overflow (CTSUST.CTSUSOVF set)
     CTSU_EVENT_ICOMP         = 0x02,   ///< Abnormal TSCAP voltage (CTSUERRS.CTSUICOMP set)
-    CTSU_EVENT_ICOMP1        = 0x04    ///< Abnormal sensor current (CTSUSR.ICOMP1 set)
+    CTSU_EVENT_ICOMP1        = 0x04,   ///< Abnormal sensor current (CTSUSR.ICOMP1 set)
+    CTSU_EVENT_THRESHOLD     = 0x08    ///< Autonomous scan: an element reached its wake threshold
 } ctsu_event_t;
 
 /** CTSU Scan Start Trigger Select */
@@ -63,8 +63,17 @@ FSP_HEADER
 typedef struct e_doc_status
 {
     uint16_t result;
+    uint32_t batch_remaining;          ///< Samples of the current batch not yet written, 0 when no batch is running
+    uint32_t batch_matches;            ///< Events detected during the current or last batch
 } doc_status_t;
 
+/** Batch write behavior when the configured event is detected. */
+typedef enum e_doc_batch_mode
+{
+    DOC_BATCH_MODE_ALL         = 0,    ///< Write every sample and call the callback on each event
+    DOC_BATCH_MODE_FIRST_MATCH = 1,    ///< Stop the batch on the first event
+} doc_batch_mode_t;
+
 /** Event that can trigger a callback function. */
 typedef enum e_doc_event
 {
@@ -79,6 +88,11 @@ typedef struct st_doc_callback_args
 {
     void const * p_context;            ///< Placeholder for user data.
     ///< Set in @ref doc_api_t::open function in @ref doc_cfg_t.
+
+    /** Samples of the batch written when the event was detected, 0 outside a batch. The sample that caused the event
+     *  is at index - 1 or, if the transfer was ahead of the interrupt, shortly before it. */
+    uint32_t index;
+    uint16_t result;                   ///< DODSR value when the event was detected
 } doc_callback_args_t;
 
 /** DOC control block.  Allocate an instance specific control block to pass into the DOC API calls.
@@ -95,6 +109,11 @@ typedef struct st_doc_cfg
     uint8_t     ipl;                   ///< DOC interrupt priority
     IRQn_Type   irq;                   ///< NVIC interrupt number assigned to this instance
 
+    /** Transfer instance used by @ref doc_api_t::batchWrite, or NULL if unused. A DMAC with no activation source
+     *  streams the batch as fast as the bus allows; a transfer activated by a peripheral event writes one sample per
+     *  event. transfer_cfg_t::p_info is configured by the driver. */
+    transfer_instance_t const * p_transfer;
+
     /** Callback provided when a DOC ISR occurs. */
     void (* p_callback)(doc_callback_args_t * p_args);
 
@@ -138,6 +157,19 @@ typedef struct st_doc_api
      */
     fsp_err_t (* write)(doc_ctrl_t * const p_ctrl, uint16_t data);
 
+    /** Write a buffer of samples to the DODIR register with the transfer instance. The callback is called only when
+     *  the configured event is detected.
+     * @par Implemented as
+     * - @ref R_DOC_BatchWrite()
+     *
+     * @param[in]   p_ctrl      Control block set in @ref doc_api_t::open call.
+     * @param[in]   p_data      Samples to write. Must stay valid until the batch ends.
+     * @param[in]   count       Number of samples.
+     * @param[in]   mode        Whether to stop on the first event.
+     */
+    fsp_err_t (* batchWrite)(doc_ctrl_t * const p_ctrl, uint16_t const * const p_data, uint32_t count,
+                             doc_batch_mode_t mode);
+
     /** Get version and stores it in provided pointer p_version.
      * @par Implemented as
      * - @ref R_DOC_VersionGet()
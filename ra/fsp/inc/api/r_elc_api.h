@@ -23,7 +23,8 @@
  * @defgroup ELC_API ELC Interface
  * @brief Interface for the Event Link Controller.
  *
- *
+ * Links can be set one at a time, or grouped into a peripheral pipeline that is validated, enabled and removed as a
+ * whole. Each link of a pipeline can optionally be counted by a timer that counts the same event in hardware.
  *
  * @{
  **********************************************************************************************************************/
@@ -37,6 +38,7 @@
 
 /* Register definitions, common services and error codes. */
 #include "bsp_api.h"
+#include "r_timer_api.h"
 
 /* Common macro for FSP header files. There is also a corresponding FSP_FOOTER macro at the end of this file. */
 FSP_HEADER
@@ -92,6 +94,27 @@ typedef struct st_elc_cfg
     elc_event_t const link[ELC_PERIPHERAL_NUM]; ///< Event link register (ELSR) settings
 } elc_cfg_t;
 
+/** One link of a peripheral pipeline. */
+typedef struct st_elc_link
+{
+    elc_event_t      event;            ///< Event that starts the peripheral
+    elc_peripheral_t peripheral;       ///< Peripheral started by the event
+
+    /** Timer that counts the event, or NULL if the link is not counted. The timer must be opened by the application
+     *  and configured to count up on counter_input. */
+    timer_instance_t const * p_counter;
+
+    /** ELC input of the counting timer (ELC_PERIPHERAL_GPT_A to ELC_PERIPHERAL_GPT_H), used if p_counter is set. */
+    elc_peripheral_t counter_input;
+} elc_link_t;
+
+/** Peripheral pipeline, a chain of event links that is enabled and removed together. */
+typedef struct st_elc_pipeline
+{
+    elc_link_t const * p_links;        ///< Array of links in the pipeline
+    uint32_t           num_links;      ///< Number of links in p_links
+} elc_pipeline_t;
+
 /** Software event number */
 typedef enum e_elc_software_event
 {
@@ -163,6 +186,36 @@ typedef struct st_elc_api
      **/
     fsp_err_t (* disable)(elc_ctrl_t * const p_ctrl);
 
+    /** Validate a peripheral pipeline and set all of its links at once.
+     * @par Implemented as
+     * - @ref R_ELC_PipelineEnable()
+     *
+     * @param[in]   p_ctrl      Pointer to control structure.
+     * @param[in]   p_pipeline  Pipeline to enable.
+     **/
+    fsp_err_t (* pipelineEnable)(elc_ctrl_t * const p_ctrl, elc_pipeline_t const * const p_pipeline);
+
+    /** Break all links of a peripheral pipeline at once.
+     * @par Implemented as
+     * - @ref R_ELC_PipelineDisable()
+     *
+     * @param[in]   p_ctrl      Pointer to control structure.
+     * @param[in]   p_pipeline  Pipeline to disable.
+     **/
+    fsp_err_t (* pipelineDisable)(elc_ctrl_t * const p_ctrl, elc_pipeline_t const * const p_pipeline);
+
+    /** Get the number of events a counted link of a peripheral pipeline has fired.
+     * @par Implemented as
+     * - @ref R_ELC_PipelineCountGet()
+     *
+     * @param[in]   p_ctrl      Pointer to control structure.
+     * @param[in]   p_pipeline  Pipeline containing the link.
+     * @param[in]   link        Index of the link in the pipeline.
+     * @param[out]  p_count     Number of events since the pipeline was enabled.
+     **/
+    fsp_err_t (* pipelineCountGet)(elc_ctrl_t * const p_ctrl, elc_pipeline_t const * const p_pipeline,
+                                   uint32_t link, uint32_t * const p_count);
+
     /** Get the driver version based on compile time macros.
      * @par Implemented as
      * - @ref R_ELC_VersionGet()
@@ -31,7 +31,10 @@
  * - Magic packet detection mode support
  * - Auto negotiation support
  * - Flow control support
- * - Multicast filtering support
+ * - Multicast filtering support, including a software per-address multicast filter
+ * - Priority reception of time-critical frames ahead of bulk traffic
+ * - Scatter-gather (multi-descriptor) transmission
+ * - Receive and transmit completion timestamps from a free-running timer
  *
  * Implemented by:
  * - @ref ETHER
@@ -49,6 +52,7 @@
 /* Register definitions, common services and error codes. */
 #include "bsp_api.h"
 #include "r_ether_phy_api.h"
+#include "r_timer_api.h"
 
 /* Common macro for FSP header files. There is also a corresponding FSP_FOOTER macro at the end of this file. */
 FSP_HEADER
@@ -120,6 +124,27 @@ typedef struct st_ether_instance_descriptor
     struct st_ether_instance_descriptor * p_next;
 } ether_instance_descriptor_t;
 
+/** Buffer fragment used when transmitting a frame that is split across several buffers. */
+typedef struct st_ether_buffer_fragment
+{
+    void   * p_buffer;                 ///< Pointer to fragment data
+    uint32_t length;                   ///< Length of fragment data in bytes
+} ether_buffer_fragment_t;
+
+/** Transmit priority of a frame, used to select a software transmit queue. */
+typedef enum e_ether_tx_priority
+{
+    ETHER_TX_PRIORITY_NORMAL = 0,      ///< Bulk traffic
+    ETHER_TX_PRIORITY_HIGH   = 1,      ///< Latency sensitive traffic, e.g. real-time control or PTP
+} ether_tx_priority_t;
+
+/** Receive time of the frame held by a receive descriptor. */
+typedef struct st_ether_rx_timestamp
+{
+    volatile uint32_t timestamp;       ///< Timestamp timer counter value when the frame was received
+    volatile uint32_t valid;           ///< Non-zero when timestamp holds the receive time of the frame
+} ether_rx_timestamp_t;
+
 /** Event code of callback function */
 typedef enum
 {
@@ -136,6 +161,7 @@ typedef struct st_ether_callback_args
     ether_event_t event;               ///< Event code
     uint32_t      status_ecsr;         ///< ETHERC status register for interrupt handler
     uint32_t      status_eesr;         ///< ETHERC/EDMAC status register for interrupt handler
+    uint32_t      timestamp;           ///< Timestamp timer counter value at interrupt entry, 0 without a timer
 
     void const * p_context;            ///< Placeholder for user data.  Set in @ref ether_api_t::open function in @ref ether_cfg_t.
 } ether_callback_args_t;
@@ -163,6 +189,11 @@ typedef struct st_ether_cfg
     uint8_t num_tx_descriptors;                          ///< Number of transmission descriptor
     uint8_t num_rx_descriptors;                          ///< Number of receive descriptor
 
+    /** Number of frames per transmit complete interrupt. 0 raises the transmit complete interrupt after every frame.
+     *  Other values raise the write-back complete interrupt after every tx_complete_interval frames, and whenever the
+     *  transmit descriptors become full. */
+    uint8_t tx_complete_interval;
+
     uint8_t ** pp_ether_buffers;                         ///< Transmit and receive buffer
 
     uint32_t ether_buffer_size;                          ///< Size of transmit and receive buffer
@@ -174,6 +205,13 @@ typedef struct st_ether_cfg
 
     ether_phy_instance_t const * p_ether_phy_instance;   ///< Pointer to ETHER_PHY instance
 
+    /** Free-running timer used to timestamp frames, or NULL to disable timestamping. The timer must be started by
+     *  the application. */
+    timer_instance_t const * p_timestamp_timer;
+
+    /** Receive timestamps, one entry per receive descriptor, or NULL to disable receive timestamping. */
+    ether_rx_timestamp_t * p_rx_timestamps;
+
     /** Placeholder for user data.  Passed to the user callback in ether_callback_args_t. */
     void const * p_context;                              ///< Placeholder for user data.
     void const * p_extend;                               ///< Placeholder for user extension.
@@ -227,6 +265,80 @@ typedef struct st_ether_api
      */
     fsp_err_t (* write)(ether_ctrl_t * const p_api_ctrl, void * const p_buffer, uint32_t const frame_length);
 
+    /** Write a packet made up of several buffer fragments.
+     * @par Implemented as
+     * - @ref R_ETHER_WriteGather()
+     *
+     * @param[in]  p_api_ctrl       Pointer to control structure.
+     * @param[in]  p_fragments      Pointer to an array of buffer fragments, in frame order.
+     * @param[in]  num_fragments    Number of entries in p_fragments.
+     */
+    fsp_err_t (* writeGather)(ether_ctrl_t * const p_api_ctrl, ether_buffer_fragment_t const * const p_fragments,
+                              uint32_t const num_fragments);
+
+    /** Return the buffers of frames that have been transmitted in zero copy mode.
+     * @par Implemented as
+     * - @ref R_ETHER_TxBufferReclaim()
+     *
+     * @param[in]  p_api_ctrl       Pointer to control structure.
+     * @param[out] pp_buffers       Array to store the addresses of the transmitted buffers, in transmit order.
+     * @param[in]  max_buffers      Number of entries in pp_buffers.
+     * @param[out] p_num_buffers    Number of buffer addresses stored in pp_buffers.
+     */
+    fsp_err_t (* txBufferReclaim)(ether_ctrl_t * const p_api_ctrl, void ** const pp_buffers,
+                                  uint32_t const max_buffers, uint32_t * const p_num_buffers);
+
+    /** Queue a packet for transmission with a given priority.
+     * @par Implemented as
+     * - @ref R_ETHER_PriorityWrite()
+     *
+     * @param[in]  p_api_ctrl       Pointer to control structure.
+     * @param[in]  p_buffer         Pointer to data to write.
+     * @param[in]  frame_length     Send ethernet frame size (without 4 bytes of CRC data size).
+     * @param[in]  priority         Transmit queue of the packet.
+     */
+    fsp_err_t (* priorityWrite)(ether_ctrl_t * const p_api_ctrl, void * const p_buffer, uint32_t const frame_length,
+                                ether_tx_priority_t const priority);
+
+    /** Read the oldest received packet of a given EtherType, ahead of any other packets still pending.
+     * @par Implemented as
+     * - @ref R_ETHER_PriorityRead()
+     *
+     * @param[in]  p_api_ctrl       Pointer to control structure.
+     * @param[in]  p_buffer         Pointer to where to store read data.
+     * @param[in]  length_bytes     Number of bytes in buffer
+     * @param[in]  ether_type       EtherType of the frames to deliver first.
+     */
+    fsp_err_t (* priorityRead)(ether_ctrl_t * const p_api_ctrl, void * const p_buffer, uint32_t * const length_bytes,
+                               uint16_t const ether_type);
+
+    /** Get the receive time of the frame most recently returned by read or priorityRead.
+     * @par Implemented as
+     * - @ref R_ETHER_RxTimestampGet()
+     *
+     * @param[in]  p_api_ctrl       Pointer to control structure.
+     * @param[out] p_timestamp      Timestamp timer counter value when the frame was received.
+     */
+    fsp_err_t (* rxTimestampGet)(ether_ctrl_t * const p_api_ctrl, uint32_t * const p_timestamp);
+
+    /** Accept multicast frames addressed to a MAC address.
+     * @par Implemented as
+     * - @ref R_ETHER_MulticastAddressAdd()
+     *
+     * @param[in]  p_api_ctrl       Pointer to control structure.
+     * @param[in]  p_mac_address    Pointer to the multicast MAC address.
+     */
+    fsp_err_t (* multicastAddressAdd)(ether_ctrl_t * const p_api_ctrl, uint8_t const * const p_mac_address);
+
+    /** Stop accepting multicast frames addressed to a MAC address.
+     * @par Implemented as
+     * - @ref R_ETHER_MulticastAddressRemove()
+     *
+     * @param[in]  p_api_ctrl       Pointer to control structure.
+     * @param[in]  p_mac_address    Pointer to the multicast MAC address.
+     */
+    fsp_err_t (* multicastAddressRemove)(ether_ctrl_t * const p_api_ctrl, uint8_t const * const p_mac_address);
+
     /** Process link.
      * @par Implemented as
      * - @ref R_ETHER_LinkProcess()
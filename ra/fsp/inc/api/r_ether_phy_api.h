@@ -31,6 +31,7 @@
  * - Auto negotiation support
  * - Flow control support
  * - Link status check support
+ * - Batched register read support
  *
  * Implemented by:
  * - @ref ETHER_PHY
@@ -156,6 +157,26 @@ typedef struct st_ether_phy_api
      */
     fsp_err_t (* linkStatusGet)(ether_phy_ctrl_t * const p_api_ctrl);
 
+    /** Read several PHY-LSI registers in one sequence of management frames.
+     * @par Implemented as
+     * - @ref R_ETHER_PHY_RegistersRead()
+     *
+     * @param[in]  p_api_ctrl       Pointer to control structure.
+     * @param[in]  p_reg_addr       Pointer to the register addresses to read.
+     * @param[out] p_data           Pointer to the location to store the register values.
+     * @param[in]  num_registers    Number of registers to read.
+     */
+    fsp_err_t (* registersRead)(ether_phy_ctrl_t * const p_api_ctrl, uint32_t const * const p_reg_addr,
+                                uint32_t * const p_data, uint32_t num_registers);
+
+    /** Discard the link state kept since the last link change. Can be called from the PHY-LSI interrupt.
+     * @par Implemented as
+     * - @ref R_ETHER_PHY_LinkStateInvalidate()
+     *
+     * @param[in]  p_api_ctrl       Pointer to control structure.
+     */
+    fsp_err_t (* linkStateInvalidate)(ether_phy_ctrl_t * const p_api_ctrl);
+
     /** Return the version of the driver.
      * @par Implemented as
      * - @ref R_ETHER_PHY_VersionGet()
@@ -70,9 +70,10 @@ typedef enum e_flash_result
 /** Parameter for specifying the startup area swap being requested by startupAreaSelect() */
 typedef enum e_flash_startup_area_swap
 {
-    FLASH_STARTUP_AREA_BTFLG  = 0,     ///< Startup area will be set based on the value of the BTFLG
-    FLASH_STARTUP_AREA_BLOCK0 = 0x2,   ///< Startup area will be set to Block 0
-    FLASH_STARTUP_AREA_BLOCK1 = 0x3,   ///< Startup area will be set to Block 1
+    FLASH_STARTUP_AREA_BTFLG     = 0,   ///< Startup area will be set based on the value of the BTFLG
+    FLASH_STARTUP_AREA_BLOCK0    = 0x2, ///< Startup area will be set to Block 0
+    FLASH_STARTUP_AREA_BLOCK1    = 0x3, ///< Startup area will be set to Block 1
+    FLASH_STARTUP_AREA_BANK_SWAP = 0x4, ///< Dual bank mode only: startup bank will be swapped on next reset
 } flash_startup_area_swap_t;
 
 /** Event types returned by the ISR callback when used in Data Flash BGO mode */
@@ -325,6 +326,7 @@ typedef struct st_flash_api
      * | FLASH_STARTUP_AREA_BLOCK0 |  false  |     On next reset Startup area will be Block 0. |
      * | FLASH_STARTUP_AREA_BLOCK1 |  true   |     Startup area is immediately, but temporarily switched to Block 1. |
      * | FLASH_STARTUP_AREA_BTFLG  |  true   |     Startup area is immediately, but temporarily switched to the Block determined by the Configuration BTFLG. |
+     * | FLASH_STARTUP_AREA_BANK_SWAP | false |  On next reset the other code flash bank becomes the startup bank. |
      *
      */
     fsp_err_t (* startupAreaSelect)(flash_ctrl_t * const p_ctrl, flash_startup_area_swap_t swap_type,
@@ -44,6 +44,12 @@
 /** Configuration for this module */
 #include "r_jpeg_cfg.h"
 
+/* When set to 1 each encode callback also reports the compressed data produced since the previous one, so it can be
+ * sent while the rest of the image is encoded. See jpeg_callback_args_t::p_chunk. */
+#ifndef JPEG_CFG_ENCODE_STREAM_ENABLE
+ #define JPEG_CFG_ENCODE_STREAM_ENABLE    (0)
+#endif
+
 /* Common macro for FSP header files. There is also a corresponding FSP_FOOTER macro at the end of this file. */
 FSP_HEADER
 
@@ -135,6 +141,10 @@ typedef struct st_jpeg_callback_args
     jpeg_status_t status;              ///< JPEG status
     uint32_t      image_size;          ///< JPEG image size
     void const  * p_context;           ///< Pointer to user-provided context
+#if JPEG_CFG_ENCODE_ENABLE && JPEG_CFG_ENCODE_STREAM_ENABLE
+    uint8_t const * p_chunk;           ///< (Encode) Compressed data new since the previous callback
+    uint32_t        chunk_size;        ///< (Encode) Size of the new compressed data, a multiple of 8 until complete
+#endif
 } jpeg_callback_args_t;
 
 /** User configuration structure, used in open function. */
@@ -120,6 +120,19 @@ typedef struct st_keymatrix_api
      */
     fsp_err_t (* disable)(keymatrix_ctrl_t * const p_ctrl);
 
+    /** Specify callback function and optional context pointer and working memory pointer.
+     * @par Implemented as
+     * - @ref R_KINT_CallbackSet()
+     *
+     * @param[in]   p_ctrl                   Control block set in @ref keymatrix_api_t::open call.
+     * @param[in]   p_callback               Callback function to register
+     * @param[in]   p_context                Pointer to send to callback function
+     * @param[in]   p_callback_memory        Pointer to volatile memory where callback structure can be allocated.
+     *                                       Callback arguments allocated here are only valid during the callback.
+     */
+    fsp_err_t (* callbackSet)(keymatrix_ctrl_t * const p_ctrl, void (* p_callback)(keymatrix_callback_args_t *),
+                              void const * const p_context, keymatrix_callback_args_t * const p_callback_memory);
+
     /** Allow driver to be reconfigured. May reduce power consumption.
      * @par Implemented as
      * - @ref R_KINT_Close()
@@ -25,7 +25,8 @@
  *
  * @section PDC_API_SUMMARY Summary
  * The PDC interface provides the functionality for capturing an image from an image sensor/camera.
- * When a capture is complete a transfer complete interrupt is triggered.
+ * When a capture is complete a transfer complete interrupt is triggered. A capture can also be split across a chain
+ * of transfers, so each part of the frame is reported as soon as it has been written.
  *
  * Implemented by:
  * - @ref PDC
@@ -101,6 +102,7 @@ typedef enum e_pdc_event
     PDC_EVENT_ERR_UNDERRUN      = 0x10U, ///< Underrun interrupt
     PDC_EVENT_ERR_V_SET         = 0x20U, ///< Vertical line setting error interrupt
     PDC_EVENT_ERR_H_SET         = 0x40U, ///< Horizontal byte number setting error interrupt
+    PDC_EVENT_STRIPE_COMPLETE   = 0x80U, ///< One link of a chained capture transferred, the frame continues
 } pdc_event_t;
 
 /** Callback function parameter data */
@@ -170,6 +172,17 @@ typedef struct st_pdc_api
      */
     fsp_err_t (* captureStart)(pdc_ctrl_t * const p_ctrl, uint8_t * const p_buffer);
 
+    /** Start a capture split across a chain of transfers.
+     * @par Implemented as
+     * - @ref R_PDC_CaptureChainStart()
+     *
+     * @param[in]  p_ctrl       Pointer to control structure.
+     * @param[in]  p_links      Chain of transfers. p_dest and num_blocks of each link must be set by the caller.
+     * @param[in]  num_links    Number of links in p_links.
+     */
+    fsp_err_t (* captureChainStart)(pdc_ctrl_t * const p_ctrl, transfer_info_t * const p_links,
+                                    uint32_t const num_links);
+
     /** Return the version of the driver.
      * @par Implemented as
      * - @ref R_PDC_VersionGet()
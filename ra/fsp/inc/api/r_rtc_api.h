@@ -220,6 +220,15 @@ typedef struct st_rtc_api
      */
     fsp_err_t (* calendarTimeGet)(rtc_ctrl_t * const p_ctrl, rtc_time_t * const p_time);
 
+    /** Get the calendar time as microseconds since 1970-01-01 00:00:00, without a calendar register access.
+     * @par Implemented as
+     * - @ref R_RTC_TimestampGet()
+     *
+     * @param[in] p_ctrl        Pointer to RTC device handle
+     * @param[out] p_timestamp  Microseconds since 1970-01-01 00:00:00
+     */
+    fsp_err_t (* timestampGet)(rtc_ctrl_t * const p_ctrl, uint64_t * const p_timestamp);
+
     /** Set the calendar alarm time and enable the alarm interrupt.
      * @par Implemented as
      * - @ref R_RTC_CalendarAlarmSet()
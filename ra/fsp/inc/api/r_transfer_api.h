@@ -135,7 +135,8 @@ typedef enum e_transfer_repeat_area
 } transfer_repeat_area_t;
 
 /** Chain transfer mode options.
- *  @note Only applies for DTC. */
+ *  @note DTC chains in hardware. DMAC supports @ref TRANSFER_CHAIN_MODE_END only, and loads the next
+ *        @ref transfer_info_t from the transfer end interrupt. */
 typedef enum e_transfer_chain_mode
 {
     /** Chain mode not used. */
@@ -231,8 +232,8 @@ typedef struct st_transfer_info
  *  initialized. */
 typedef struct st_transfer_cfg
 {
-    /** Pointer to transfer configuration options. If using chain transfer (DTC only), this can be a pointer to
-     *  an array of chained transfers that will be completed in order. */
+    /** Pointer to transfer configuration options. If using chain transfer, this can be a pointer to an array of
+     *  chained transfers that will be completed in order. */
     transfer_info_t * p_info;
 
     void const * p_extend;             ///< Extension parameter for hardware specific settings.
@@ -0,0 +1,201 @@
+/***********************************************************************************************************************
+ * Copyright [2020] Renesas Electronics Corporation and/or its affiliates.  All Rights Reserved.
+ *
+ * This software and documentation are supplied by Renesas Electronics America Inc. and may only be used with products
+ * of Renesas Electronics Corp. and its affiliates ("Renesas").  No other uses are authorized.  Renesas products are
+ * sold pursuant to Renesas terms and conditions of sale.  Purchasers are solely responsible for the selection and use
+ * of Renesas products and Renesas assumes no liability.  No license, express or implied, to any intellectual property
+ * right is granted by Renesas. This software is protected under all applicable laws, including copyright laws. Renesas
+ * reserves the right to change or discontinue this software and/or this documentation. THE SOFTWARE AND DOCUMENTATION
+ * IS DELIVERED TO YOU "AS IS," AND RENESAS MAKES NO REPRESENTATIONS OR WARRANTIES, AND TO THE FULLEST EXTENT
+ * PERMISSIBLE UNDER APPLICABLE LAW, DISCLAIMS ALL WARRANTIES, WHETHER EXPLICITLY OR IMPLICITLY, INCLUDING WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, AND NONINFRINGEMENT, WITH RESPECT TO THE SOFTWARE OR
+ * DOCUMENTATION.  RENESAS SHALL HAVE NO LIABILITY ARISING OUT OF ANY SECURITY VULNERABILITY OR BREACH.  TO THE MAXIMUM
+ * EXTENT PERMITTED BY LAW, IN NO EVENT WILL RENESAS BE LIABLE TO YOU IN CONNECTION WITH THE SOFTWARE OR DOCUMENTATION
+ * (OR ANY PERSON OR ENTITY CLAIMING RIGHTS DERIVED FROM YOU) FOR ANY LOSS, DAMAGES, OR CLAIMS WHATSOEVER, INCLUDING,
+ * WITHOUT LIMITATION, ANY DIRECT, CONSEQUENTIAL, SPECIAL, INDIRECT, PUNITIVE, OR INCIDENTAL DAMAGES; ANY LOST PROFITS,
+ * OTHER ECONOMIC DAMAGE, PROPERTY DAMAGE, OR PERSONAL INJURY; AND EVEN IF RENESAS HAS BEEN ADVISED OF THE POSSIBILITY
+ * OF SUCH LOSS, DAMAGES, CLAIMS OR COSTS.
+ **********************************************************************************************************************/
+
+#ifndef RM_AIO_API_H
+#define RM_AIO_API_H
+
+/*******************************************************************************************************************//**
+ * @defgroup RM_AIO_API Asynchronous I/O Interface
+ * @ingroup RENESAS_INTERFACES
+ * @brief Interface for queued, asynchronous I/O requests with a completion queue
+ *
+ * @section RM_AIO_API_SUMMARY Summary
+ * The asynchronous I/O interface accepts request descriptors for read, write and erase operations and executes them in
+ * the background, one at a time, in submission order. Each request, or chain of requests, is posted to a completion
+ * queue when it finishes. The completion queue can be polled, waited on, or watched with the callback, so middleware
+ * can keep several requests in flight instead of blocking on each one.
+ *
+ * Requests linked through rm_aio_request_t::p_next form a chain. The next request of a chain starts when the previous
+ * one succeeds; the first failure completes the chain and the requests after it are not started. A chain is posted to
+ * the completion queue once, through its first request.
+ *
+ * Implemented by:
+ * - @ref RM_AIO_BLOCK_MEDIA
+ *
+ * @{
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Includes
+ **********************************************************************************************************************/
+
+/* Register definitions, common services and error codes. */
+#include "bsp_api.h"
+
+/* Common macro for FSP header files. There is also a corresponding FSP_FOOTER macro at the end of this file. */
+FSP_HEADER
+
+/**********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+#define RM_AIO_API_VERSION_MAJOR    (1U)
+#define RM_AIO_API_VERSION_MINOR    (0U)
+
+/**********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+
+/** Operation of a request */
+typedef enum e_rm_aio_op
+{
+    RM_AIO_OP_READ  = 0,               ///< Read length units at address into p_buffer
+    RM_AIO_OP_WRITE = 1,               ///< Write length units from p_buffer to address
+    RM_AIO_OP_ERASE = 2,               ///< Erase length units at address, p_buffer is not used
+} rm_aio_op_t;
+
+/** Request descriptor. The descriptor and its buffer must stay valid until the request is returned by the completion
+ * queue. The units of address and length are those of the implementation, e.g. blocks for block media. */
+typedef struct st_rm_aio_request
+{
+    rm_aio_op_t                op;           ///< Operation to perform
+    uint8_t                  * p_buffer;     ///< Data buffer of a read or write
+    uint32_t                   address;      ///< Device address of the first unit
+    uint32_t                   length;       ///< Number of units
+    uint32_t                   timeout;      ///< Time the request may run in implementation ticks, 0 for no timeout
+    struct st_rm_aio_request * p_next;       ///< Next request of the chain, or NULL
+    void const               * p_context;    ///< User defined context, not used by the implementation
+    volatile fsp_err_t         result;       ///< Result, FSP_ERR_IN_USE until the request completes
+    struct st_rm_aio_request * p_queue_next; ///< Used by the implementation, do not modify
+} rm_aio_request_t;
+
+/** Callback function parameter data */
+typedef struct st_rm_aio_callback_args
+{
+    rm_aio_request_t * p_request;      ///< Completed request, or first request of the completed chain
+    void const       * p_context;      ///< Placeholder for user data
+} rm_aio_callback_args_t;
+
+/** User configuration structure, used in open function */
+typedef struct st_rm_aio_cfg
+{
+    /** Optional function called from the completing context each time a request or chain is posted to the completion
+     * queue, e.g. to give a semaphore the consumer task waits on. May be NULL. */
+    void (* p_callback)(rm_aio_callback_args_t * p_args);
+    void const * p_context;            ///< User defined context passed into callback function
+    void const * p_extend;             ///< Extension parameter for hardware specific settings
+} rm_aio_cfg_t;
+
+/** Current status */
+typedef struct st_rm_aio_status
+{
+    uint32_t submitted;                ///< Chains submitted and not yet returned by the completion queue
+    bool     active;                   ///< True while a request is running on the device
+} rm_aio_status_t;
+
+/** Asynchronous I/O control block. Allocate an instance specific control block to pass into the API calls.
+ * @par Implemented as
+ * - @ref rm_aio_block_media_instance_ctrl_t
+ */
+typedef void rm_aio_ctrl_t;
+
+/** Asynchronous I/O interface API. */
+typedef struct st_rm_aio_api
+{
+    /** Opens the module.
+     * @par Implemented as
+     * - @ref RM_AIO_BLOCK_MEDIA_Open
+     *
+     * @param[in]   p_ctrl              Pointer to control block. Must be declared by user. Elements set here.
+     * @param[in]   p_cfg               Pointer to configuration structure. All elements of this structure must be set
+     *                                  by user.
+     */
+    fsp_err_t (* open)(rm_aio_ctrl_t * const p_ctrl, rm_aio_cfg_t const * const p_cfg);
+
+    /** Queues a request or a chain of requests. Returns without waiting for the requests to run.
+     * @par Implemented as
+     * - @ref RM_AIO_BLOCK_MEDIA_Submit
+     *
+     * @param[in]   p_ctrl              Control block set in @ref rm_aio_api_t::open call.
+     * @param[in]   p_request           First request of the chain.
+     */
+    fsp_err_t (* submit)(rm_aio_ctrl_t * const p_ctrl, rm_aio_request_t * const p_request);
+
+    /** Returns the oldest completed request or chain without waiting. Must only be called from one context.
+     * @par Implemented as
+     * - @ref RM_AIO_BLOCK_MEDIA_CompletionGet
+     *
+     * @param[in]   p_ctrl              Control block set in @ref rm_aio_api_t::open call.
+     * @param[out]  pp_request          First request of the completed chain.
+     */
+    fsp_err_t (* completionGet)(rm_aio_ctrl_t * const p_ctrl, rm_aio_request_t ** const pp_request);
+
+    /** Waits for a completed request or chain. Must only be called from one context.
+     * @par Implemented as
+     * - @ref RM_AIO_BLOCK_MEDIA_CompletionWait
+     *
+     * @param[in]   p_ctrl              Control block set in @ref rm_aio_api_t::open call.
+     * @param[out]  pp_request          First request of the completed chain.
+     * @param[in]   timeout_ms          Longest time to wait in milliseconds.
+     */
+    fsp_err_t (* completionWait)(rm_aio_ctrl_t * const p_ctrl, rm_aio_request_t ** const pp_request,
+                                 uint32_t const timeout_ms);
+
+    /** Gets the number of outstanding chains.
+     * @par Implemented as
+     * - @ref RM_AIO_BLOCK_MEDIA_StatusGet
+     *
+     * @param[in]   p_ctrl              Control block set in @ref rm_aio_api_t::open call.
+     * @param[out]  p_status            Pointer to store current status.
+     */
+    fsp_err_t (* statusGet)(rm_aio_ctrl_t * const p_ctrl, rm_aio_status_t * const p_status);
+
+    /** Closes the module.
+     * @par Implemented as
+     * - @ref RM_AIO_BLOCK_MEDIA_Close
+     *
+     * @param[in]   p_ctrl              Control block set in @ref rm_aio_api_t::open call.
+     */
+    fsp_err_t (* close)(rm_aio_ctrl_t * const p_ctrl);
+
+    /** Gets version and stores it in provided pointer p_version.
+     * @par Implemented as
+     * - @ref RM_AIO_BLOCK_MEDIA_VersionGet
+     *
+     * @param[out]  p_version           Code and API version used.
+     */
+    fsp_err_t (* versionGet)(fsp_version_t * const p_version);
+} rm_aio_api_t;
+
+/** This structure encompasses everything that is needed to use an instance of this interface. */
+typedef struct st_rm_aio_instance
+{
+    rm_aio_ctrl_t      * p_ctrl;       ///< Pointer to the control structure for this instance
+    rm_aio_cfg_t const * p_cfg;        ///< Pointer to the configuration structure for this instance
+    rm_aio_api_t const * p_api;        ///< Pointer to the API structure for this instance
+} rm_aio_instance_t;
+
+/* Common macro for FSP header files. There is also a corresponding FSP_HEADER macro at the top of this file. */
+FSP_FOOTER
+
+/*******************************************************************************************************************//**
+ * @} (end defgroup RM_AIO_API)
+ **********************************************************************************************************************/
+
+#endif                                 /* RM_AIO_API_H */
@@ -112,6 +112,12 @@ typedef struct st_rm_freertos_plus_fat_cfg
      * FF_ERR_IOMAN_DRIVER_FATAL_ERROR. */
     fsp_err_t (* p_busy_callback)(void const * p_busy_context);
     void const * p_busy_context;                                        ///< User defined context passed into busy callback function
+
+    /** Optional read-ahead buffer. When set, sequential reads keep the next sectors in flight on the block media
+     * while the previous data is consumed, and unaligned reads are staged through it. The size must be a multiple of
+     * the sector size. Set to NULL to issue every read synchronously. */
+    uint8_t    * p_read_ahead_buffer;
+    uint32_t     read_ahead_size_bytes;                                 ///< Size of the read-ahead buffer in bytes
     void const * p_extend;                                              ///< Extension parameter for hardware specific settings.
 } rm_freertos_plus_fat_cfg_t;
 
@@ -32,6 +32,8 @@
  *
  * Implemented by:
  * @ref RM_LITTLEFS_FLASH
+ * @ref RM_LITTLEFS_SPI_FLASH
+ * @ref RM_LITTLEFS_BLOCK_MEDIA
  *
  * @{
  **********************************************************************************************************************/
@@ -77,6 +79,8 @@ typedef struct st_rm_littlefs_api
     /** Initialize The lower level storage device.
      * @par Implemented as
      * - @ref RM_LITTLEFS_FLASH_Open
+     * - @ref RM_LITTLEFS_SPI_FLASH_Open
+     * - @ref RM_LITTLEFS_BLOCK_MEDIA_Open
      *
      * @param[in]   p_ctrl              Pointer to control block. Must be declared by user. Elements set here.
      * @param[in]   p_cfg               Pointer to configuration structure. All elements of this structure must be set by user.
@@ -86,6 +90,8 @@ typedef struct st_rm_littlefs_api
     /** Closes the module and lower level storage device.
      * @par Implemented as
      * - @ref RM_LITTLEFS_FLASH_Close
+     * - @ref RM_LITTLEFS_SPI_FLASH_Close
+     * - @ref RM_LITTLEFS_BLOCK_MEDIA_Close
      *
      * @param[in]   p_ctrl             Control block set in @ref rm_littlefs_api_t::open call.
      */
@@ -94,6 +100,8 @@ typedef struct st_rm_littlefs_api
     /** Gets version and stores it in provided pointer p_version.
      * @par Implemented as
      * - @ref RM_LITTLEFS_FLASH_VersionGet
+     * - @ref RM_LITTLEFS_SPI_FLASH_VersionGet
+     * - @ref RM_LITTLEFS_BLOCK_MEDIA_VersionGet
      *
      * @param[out]  p_version          Code and API version used.
      */
@@ -64,6 +64,13 @@
  *  defined on the Secure side. */
 #define FSP_SECURE_ARGUMENT    (NULL)
 
+/** Resolves an API function of a lower layer instance at compile time. Modules with a compile-time binding option use
+ * it in place of the p_api table of the instance, so the compiler (or LTO) can inline the call. The binding is the
+ * function name prefix including the trailing underscore, since prefixes such as R_CTSU are also register macros. For
+ * example, FSP_API_DIRECT(R_SDHI_, Read) is R_SDHI_Read. */
+#define FSP_API_DIRECT(binding, function)        FSP_PRV_API_DIRECT(binding, function)
+#define FSP_PRV_API_DIRECT(binding, function)    binding ## function
+
 /**********************************************************************************************************************
  * Typedef definitions
  **********************************************************************************************************************/
@@ -107,6 +114,7 @@ typedef enum e_fsp_err
     FSP_ERR_NOT_INITIALIZED       = 33,                     ///< Required initialization not complete
     FSP_ERR_NOT_FOUND             = 34,                     ///< The requested item could not be found
     FSP_ERR_NO_CALLBACK_MEMORY    = 35,                     ///< Non-secure callback memory not provided for non-secure callback
+    FSP_ERR_READ_FAILED           = 36,                     ///< Read operation failed
 
     /* Start of RTOS only error codes */
     FSP_ERR_INTERNAL     = 100,                             ///< Internal error
@@ -208,6 +208,56 @@ typedef struct st_adc_channel_cfg
 /* Sample and hold Channel mask. Sample and hold is only available for channel 0,1,2*/
 #define ADC_SAMPLE_HOLD_CHANNELS    (0x07U)
 
+/* Maximum number of result registers transferred per scan in streaming mode */
+#define ADC_STREAM_REGISTER_MAX     (16U)
+
+/* Maximum order of the streaming CIC decimation filter */
+#define ADC_STREAM_CIC_ORDER_MAX    (3U)
+
+/** Streaming callback events */
+typedef enum e_adc_stream_event
+{
+    ADC_STREAM_EVENT_HALF_COMPLETE = 0, ///< First half of the stream buffer is filled
+    ADC_STREAM_EVENT_COMPLETE      = 1, ///< Second half of the stream buffer is filled
+} adc_stream_event_t;
+
+/** Streaming callback arguments */
+typedef struct st_adc_stream_callback_args
+{
+    adc_stream_event_t event;          ///< Stream buffer half that is filled
+    uint16_t const   * p_data;         ///< Results of the half, num_scans x num_registers
+    int32_t const    * p_decimated;    ///< Decimated results of the half, NULL if decimation is off
+    uint32_t           num_scans;      ///< Number of scans in p_data
+    uint32_t           num_decimated;  ///< Number of decimated samples per register in p_decimated
+    uint32_t           num_registers;  ///< Number of result registers per scan (lowest to highest scanned channel)
+    void const       * p_context;      ///< Placeholder for user data
+} adc_stream_callback_args_t;
+
+/** State of the CIC decimation filter of one result register */
+typedef struct st_adc_stream_cic
+{
+    uint32_t integrator[ADC_STREAM_CIC_ORDER_MAX];
+    uint32_t comb[ADC_STREAM_CIC_ORDER_MAX];
+} adc_stream_cic_t;
+
+/** Streaming configuration. With on-hardware addition/averaging (adc_extended_cfg_t::add_average_count), each
+ * transferred result is the averaged value. */
+typedef struct st_adc_stream_cfg
+{
+    /** DMAC instance activated by the scan end event, with chain loop enabled and a callback that calls
+     * R_ADC_StreamTransferEnd. The sample rate is set by the scan trigger (GPT through ELC). */
+    transfer_instance_t const * p_transfer;
+    uint16_t                  * p_buffer;       ///< Stream buffer, 2 x num_half_scans x result registers
+    uint16_t                    num_half_scans; ///< Scans per buffer half
+    uint16_t                    decimation;     ///< CIC decimation ratio (1 = off), must divide num_half_scans
+    uint8_t                     cic_order;      ///< CIC filter order, 1 to ADC_STREAM_CIC_ORDER_MAX
+    adc_stream_cic_t          * p_cic;          ///< CIC state, one per result register (decimation only)
+    int32_t                   * p_decimated;    ///< Decimated results, num_half_scans / decimation x registers
+
+    void (* p_callback)(adc_stream_callback_args_t * p_args); ///< Called when a buffer half is filled
+    void const * p_context;                                    ///< Placeholder for user data
+} adc_stream_cfg_t;
+
 /***********************************************************************************************************************
  * Typedef definitions
  **********************************************************************************************************************/
@@ -226,6 +276,12 @@ typedef struct
 
     /* Pointer to context to be passed into callback function */
     void const * p_context;
+
+    /* Streaming acquisition */
+    adc_stream_cfg_t const * p_stream_cfg;    // Streaming configuration, NULL when not streaming
+    transfer_info_t          stream_info[2];  // Transfer of each buffer half (DMAC chain links)
+    uint32_t                 stream_registers; // Result registers transferred per scan
+    uint32_t                 stream_gain;      // DC gain of the CIC filter
 } adc_instance_ctrl_t;
 
 /**********************************************************************************************************************
@@ -254,11 +310,30 @@ fsp_err_t R_ADC_Close(adc_ctrl_t * p_ctrl);
 fsp_err_t R_ADC_OffsetSet(adc_ctrl_t * const p_ctrl, adc_channel_t const reg_id, int32_t offset);
 fsp_err_t R_ADC_Calibrate(adc_ctrl_t * const p_ctrl, void * const p_extend);
 fsp_err_t R_ADC_VersionGet(fsp_version_t * const p_version);
+fsp_err_t R_ADC_StreamStart(adc_ctrl_t * p_ctrl, adc_stream_cfg_t const * const p_stream_cfg);
+fsp_err_t R_ADC_StreamStop(adc_ctrl_t * p_ctrl);
+fsp_err_t R_ADC_StreamTransferEnd(adc_ctrl_t * p_ctrl, transfer_info_t const * const p_info);
 fsp_err_t R_ADC_CallbackSet(adc_ctrl_t * const          p_api_ctrl,
                             void (                    * p_callback)(adc_callback_args_t *),
                             void const * const          p_context,
                             adc_callback_args_t * const p_callback_memory);
 
+/*******************************************************************************************************************//**
+ * Reads a conversion result without parameter checking. Fast path variant of R_ADC_Read() for control loops and
+ * interrupt handlers that read the same, already validated channel every cycle.
+ *
+ * The caller must guarantee that the instance is open and that reg_id is valid for this unit. No error is returned.
+ *
+ * @param[in]  p_ctrl          Opened ADC instance control block.
+ * @param[in]  reg_id          Channel or sensor to read.
+ *
+ * @return     Contents of the conversion result register.
+ **********************************************************************************************************************/
+__STATIC_INLINE uint16_t R_ADC_ReadFast (adc_instance_ctrl_t * const p_ctrl, adc_channel_t const reg_id)
+{
+    return p_ctrl->p_reg->ADDR[reg_id];
+}
+
 /*******************************************************************************************************************//**
  * @} (end defgroup ADC)
  **********************************************************************************************************************/
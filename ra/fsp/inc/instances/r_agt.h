@@ -27,6 +27,7 @@
 #include "bsp_api.h"
 #include "r_agt_cfg.h"
 #include "r_timer_api.h"
+#include "r_transfer_api.h"
 
 /* Common macro for FSP header files. There is also a corresponding FSP_FOOTER macro at the end of this file. */
 FSP_HEADER
@@ -117,6 +118,27 @@ typedef enum e_agt_pin_cfg
     AGT_PIN_CFG_START_LEVEL_HIGH = 7,  ///< Pin level high
 } agt_pin_cfg_t;
 
+/** Measurement history settings. See @ref R_AGT_HistoryStart. */
+typedef struct st_agt_history_cfg
+{
+    /** Transfer instance on the DTC activated by the AGT interrupt (cycle_end_irq). It must be opened by the
+     *  application and is reconfigured by the driver while the history is running. */
+    transfer_instance_t const * p_transfer;
+    uint16_t                  * p_counts;    ///< Circular buffer receiving the counter read at each AGT interrupt
+    uint8_t                   * p_flags;     ///< Circular buffer receiving the AGTCR status flags at each AGT interrupt
+    uint32_t                    num_entries; ///< Number of entries in p_counts and p_flags (1 to 256)
+} agt_history_cfg_t;
+
+/** Statistics of the measurements taken from the history. See @ref R_AGT_HistoryStatisticsGet. */
+typedef struct st_agt_history_statistics
+{
+    uint32_t count;                    ///< Number of measurements evaluated
+    uint32_t min;                      ///< Shortest measurement in counts
+    uint32_t max;                      ///< Longest measurement in counts
+    uint32_t mean;                     ///< Mean measurement in counts, rounded down
+    uint32_t jitter;                   ///< Standard deviation of the measurements in counts
+} agt_history_statistics_t;
+
 /** Channel control block. DO NOT INITIALIZE.  Initialization occurs when @ref timer_api_t::open is called. */
 typedef struct st_agt_instance_ctrl
 {
@@ -125,6 +147,15 @@ typedef struct st_agt_instance_ctrl
     R_AGT0_Type       * p_reg;                    // Base register for this channel
     uint32_t            period;                   // Current timer period (counts)
 
+    /* Measurement history information. */
+    agt_history_cfg_t const * p_history;          // Measurement history in progress, NULL if none
+    uint32_t        history_tail;                 // Next unread entry in the history
+    uint32_t        history_extension;            // Counts of the underflows since the last unread measurement
+    transfer_info_t history_info[4];              // Run on each AGT interrupt: read counter, read flags, clear
+                                                  // flags, reset counter (pulse width measurement only)
+    uint8_t         history_agtcr;                // AGTCR setting that clears the status flags
+    uint16_t        history_reload;               // Counter reload value
+
     void (* p_callback)(timer_callback_args_t *); // Pointer to callback that is called when a timer_event_t occurs.
     timer_callback_args_t * p_callback_memory;    // Pointer to non-secure memory that can be used to pass arguments to a callback in non-secure memory.
     void const            * p_context;            // Pointer to context to be passed into callback function
@@ -181,6 +212,13 @@ fsp_err_t R_AGT_CallbackSet(timer_ctrl_t * const          p_api_ctrl,
                             void const * const            p_context,
                             timer_callback_args_t * const p_callback_memory);
 fsp_err_t R_AGT_VersionGet(fsp_version_t * const p_version);
+fsp_err_t R_AGT_HistoryStart(timer_ctrl_t * const p_ctrl, agt_history_cfg_t const * const p_history);
+fsp_err_t R_AGT_HistoryRead(timer_ctrl_t * const p_ctrl,
+                            uint32_t * const     p_dest,
+                            uint32_t const       max_measurements,
+                            uint32_t * const     p_count);
+fsp_err_t R_AGT_HistoryStatisticsGet(timer_ctrl_t * const p_ctrl, agt_history_statistics_t * const p_statistics);
+fsp_err_t R_AGT_HistoryStop(timer_ctrl_t * const p_ctrl);
 
 /*******************************************************************************************************************//**
  * @} (end defgroup AGT)
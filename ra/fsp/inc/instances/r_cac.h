@@ -27,6 +27,7 @@
 
 #include "r_cac_cfg.h"
 #include "r_cac_api.h"
+#include "r_cgc.h"
 
 /* Common macro for FSP header files. There is also a corresponding FSP_FOOTER macro at the end of this file. */
 FSP_HEADER
@@ -46,6 +47,54 @@ FSP_HEADER
  * Typedef definitions
  **********************************************************************************************************************/
 
+/** Continuous monitor settings passed to R_CAC_MonitorStart(). */
+typedef struct st_cac_monitor_cfg
+{
+    /** Measurement counter value expected when both clocks are exactly on frequency:
+     * f(measurement) / measurement divider * reference divider / f(reference). */
+    uint16_t expected_count;
+
+    /** Number of measurements averaged before each trim decision, 1 to 255. */
+    uint8_t average_samples;
+
+    /** Largest averaged error, in ppm, that is left untrimmed. Set it above the trim step to avoid hunting. */
+    uint32_t deadband_ppm;
+
+    /** Approximate frequency change of one trimming step in ppm, from the electrical characteristics in the hardware
+     * manual. Each trim decision moves by the error divided by this value, rounded, and at least one step. Set to 0
+     * to move one step per decision. */
+    uint32_t trim_step_ppm;
+
+    /** Oscillator to trim through R_CGC_ClockTrimSet(), CGC_CLOCK_HOCO or CGC_CLOCK_MOCO. It must be the clock
+     * selected as the measurement clock, or as the reference clock if trim_reference is true. */
+    cgc_clock_t trim_clock;
+
+    /** Set to true if the trimmed oscillator is the CAC reference clock rather than the measurement clock, in which
+     * case a high count means the oscillator is slow. */
+    bool trim_reference;
+
+    /** Trimming values are limited to trim_min..trim_max. */
+    int8_t trim_min;
+    int8_t trim_max;
+
+    /** Opened CGC instance used to trim, or NULL to only collect statistics. */
+    cgc_ctrl_t * p_cgc_ctrl;
+} cac_monitor_cfg_t;
+
+/** Drift statistics returned by R_CAC_MonitorStatusGet(). Errors are in ppm of the expected frequency and are
+ * positive when the trimmed (or measurement) clock is fast. */
+typedef struct st_cac_monitor_status
+{
+    uint32_t samples;                  ///< Measurements processed since R_CAC_MonitorStart()
+    uint32_t overflows;                ///< Measurements discarded because the counter overflowed
+    uint32_t trims;                    ///< Number of trimming value changes
+    int32_t  error_ppm;                ///< Error of the last measurement
+    int32_t  error_average_ppm;        ///< Error averaged over the last completed window of average_samples
+    int32_t  error_min_ppm;            ///< Lowest error of any measurement
+    int32_t  error_max_ppm;            ///< Highest error of any measurement
+    int8_t   trim;                     ///< Current trimming value
+} cac_monitor_status_t;
+
 /** CAC instance control block.  DO NOT INITIALIZE. */
 typedef struct st_cac_instance_ctrl
 {
@@ -58,6 +107,13 @@ typedef struct st_cac_instance_ctrl
 
     /* Pointer to context to be passed into callback function */
     void const * p_context;
+
+    /* Continuous monitor state */
+    cac_monitor_cfg_t const * p_monitor;          // Monitor settings, NULL when the monitor is stopped
+    cac_monitor_status_t      monitor_status;     // Drift statistics
+    int64_t                   monitor_error_sum;  // Sum of the errors in the current window
+    uint8_t                   monitor_window;     // Measurements in the current window
+    bool                      monitor_discard;    // Discard the next measurement
 } cac_instance_ctrl_t;
 
 /**********************************************************************************************************************
@@ -78,6 +134,9 @@ fsp_err_t R_CAC_StartMeasurement(cac_ctrl_t * const p_ctrl);
 fsp_err_t R_CAC_StopMeasurement(cac_ctrl_t * const p_ctrl);
 fsp_err_t R_CAC_Read(cac_ctrl_t * const p_ctrl, uint16_t * const p_counter);
 fsp_err_t R_CAC_Reset(cac_ctrl_t * const p_ctrl);
+fsp_err_t R_CAC_MonitorStart(cac_ctrl_t * const p_ctrl, cac_monitor_cfg_t const * const p_monitor_cfg);
+fsp_err_t R_CAC_MonitorStatusGet(cac_ctrl_t * const p_ctrl, cac_monitor_status_t * const p_status);
+fsp_err_t R_CAC_MonitorStop(cac_ctrl_t * const p_ctrl);
 fsp_err_t R_CAC_Close(cac_ctrl_t * const p_ctrl);
 fsp_err_t R_CAC_VersionGet(fsp_version_t * const p_version);
 fsp_err_t R_CAC_CallbackSet(cac_ctrl_t * const          p_ctrl,
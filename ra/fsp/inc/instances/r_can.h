@@ -46,6 +46,28 @@ FSP_HEADER
  * Typedef definitions
  **********************************************************************************************************************/
 
+/** Software receive FIFO filled by the receive ISR. Used with R_CAN_RxFifoEnable(). */
+typedef struct st_can_rx_fifo_cfg
+{
+    can_frame_t * p_buffer;            ///< Frame storage for the FIFO.
+    uint32_t      length;              ///< Number of frames in p_buffer. Must be a power of two.
+    uint32_t      batch_size;          ///< Number of received frames per callback. Must be 1 to length.
+} can_rx_fifo_cfg_t;
+
+/** Software transmit queue used with R_CAN_TxQueueEnable(). */
+typedef struct st_can_tx_queue_cfg
+{
+    can_frame_t * p_buffer;            ///< Frame storage for the queue.
+    uint32_t      length;              ///< Number of frames in p_buffer.
+} can_tx_queue_cfg_t;
+
+/** Acceptance filter entry used with R_CAN_FilterSet(). Set id_min equal to id_max for a single ID. */
+typedef struct st_can_filter
+{
+    uint32_t id_min;                   ///< Lowest ID to accept.
+    uint32_t id_max;                   ///< Highest ID to accept.
+} can_filter_t;
+
 /* CAN Instance Control Block   */
 typedef struct st_can_instance_ctrl
 {
@@ -64,6 +86,15 @@ typedef struct st_can_instance_ctrl
     void (* p_callback)(can_callback_args_t *); // Pointer to callback
     can_callback_args_t * p_callback_memory;    // Pointer to optional callback argument memory
     void const          * p_context;            // Pointer to context to be passed into callback function
+
+    can_rx_fifo_cfg_t const * p_rx_fifo;        // Software receive FIFO, NULL when frames are passed per callback
+    volatile uint32_t         rx_fifo_head;     // Frames written by the receive ISR (free running)
+    volatile uint32_t         rx_fifo_tail;     // Frames read by R_CAN_RxFifoRead (free running)
+    uint32_t                  rx_fifo_batch;    // Frames written since the last FIFO callback
+
+    can_tx_queue_cfg_t const * p_tx_queue;      // Software transmit queue, NULL when mailboxes are written directly
+    uint32_t                   tx_queue_count;  // Frames waiting in the transmit queue, sorted by ID
+    uint32_t                   tx_queue_mbox;   // Bit mask of the transmit mailboxes loaded from the queue
 } can_instance_ctrl_t;
 
 /* CAN clock configuration and mailbox mask to be pointed to by p_extend. */
@@ -98,6 +129,16 @@ fsp_err_t R_CAN_CallbackSet(can_ctrl_t * const          p_api_ctrl,
                             void const * const          p_context,
                             can_callback_args_t * const p_callback_memory);
 fsp_err_t R_CAN_VersionGet(fsp_version_t * const version);
+fsp_err_t R_CAN_RxFifoEnable(can_ctrl_t * const p_api_ctrl, can_rx_fifo_cfg_t const * const p_fifo_cfg);
+fsp_err_t R_CAN_RxFifoDisable(can_ctrl_t * const p_api_ctrl);
+fsp_err_t R_CAN_RxFifoRead(can_ctrl_t * const  p_api_ctrl,
+                           can_frame_t * const p_frames,
+                           uint32_t const      max_frames,
+                           uint32_t * const    p_count);
+fsp_err_t R_CAN_TxQueueEnable(can_ctrl_t * const p_api_ctrl, can_tx_queue_cfg_t const * const p_queue_cfg);
+fsp_err_t R_CAN_TxQueueDisable(can_ctrl_t * const p_api_ctrl);
+fsp_err_t R_CAN_TxQueueWrite(can_ctrl_t * const p_api_ctrl, can_frame_t const * const p_frame);
+fsp_err_t R_CAN_FilterSet(can_ctrl_t * const p_api_ctrl, can_filter_t const * const p_filters, uint32_t const count);
 
 /*******************************************************************************************************************//**
  * @} (end defgroup CAN)
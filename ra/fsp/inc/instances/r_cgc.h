@@ -46,11 +46,39 @@ FSP_HEADER
  * Typedef definitions
  **********************************************************************************************************************/
 
+/** Clock change notification events */
+typedef enum e_cgc_notify_event
+{
+    CGC_NOTIFY_EVENT_PRE_CHANGE  = 0,  ///< The system clock is about to change, pause operations that depend on it
+    CGC_NOTIFY_EVENT_POST_CHANGE = 1,  ///< The system clock changed, recompute dividers such as SCI baud rates
+} cgc_notify_event_t;
+
+/** Clock change notification parameter data */
+typedef struct st_cgc_notify_args
+{
+    cgc_notify_event_t event;          ///< Notification event
+    uint32_t           clock_hz;       ///< Frequency of cgc_notifier_t::clock after the change
+    void const       * p_context;      ///< Placeholder for user data
+} cgc_notify_args_t;
+
+/** Clock constraint and change notification registered with R_CGC_NotifierRegister(). The structure must stay valid
+ * until R_CGC_NotifierUnregister() is called. */
+typedef struct st_cgc_notifier
+{
+    fsp_priv_clock_t clock;                          ///< Internal clock the driver runs on, e.g. FSP_PRIV_CLOCK_PCLKB
+    uint32_t         min_hz;                         ///< Lowest frequency of clock the driver supports, 0 for any
+    void (* p_callback)(cgc_notify_args_t * p_args); ///< Called before and after system clock changes, may be NULL
+    void const             * p_context;              ///< Placeholder for user data passed to the callback
+    struct st_cgc_notifier * p_next;                 ///< Used by the CGC driver, do not modify
+} cgc_notifier_t;
+
 /** CGC private control block. DO NOT MODIFY. Initialization occurs when R_CGC_Open() is called. */
 typedef struct st_cgc_instance_ctrl
 {
     uint32_t open;
 
+    cgc_notifier_t * p_notifiers;                      // Registered clock constraints and change notifications.
+
     cgc_callback_args_t * p_callback_memory;           // Pointer to non-secure memory that can be used to pass arguments to a callback in non-secure memory.
     void (* p_callback)(cgc_callback_args_t * p_args); // Pointer to callback that is called when a cgc_event_t occurs.
 
@@ -89,6 +117,10 @@ fsp_err_t R_CGC_CallbackSet(cgc_ctrl_t * const          p_api_ctrl,
                             void (                    * p_callback)(cgc_callback_args_t *),
                             void const * const          p_context,
                             cgc_callback_args_t * const p_callback_memory);
+fsp_err_t R_CGC_NotifierRegister(cgc_ctrl_t * const p_ctrl, cgc_notifier_t * const p_notifier);
+fsp_err_t R_CGC_NotifierUnregister(cgc_ctrl_t * const p_ctrl, cgc_notifier_t * const p_notifier);
+fsp_err_t R_CGC_ClockTrimSet(cgc_ctrl_t * const p_ctrl, cgc_clock_t clock_source, int8_t trim);
+fsp_err_t R_CGC_ClockTrimGet(cgc_ctrl_t * const p_ctrl, cgc_clock_t clock_source, int8_t * const p_trim);
 fsp_err_t R_CGC_Close(cgc_ctrl_t * const p_ctrl);
 fsp_err_t R_CGC_VersionGet(fsp_version_t * version);
 
@@ -70,6 +70,9 @@ fsp_err_t R_CRC_Open(crc_ctrl_t * const p_ctrl, crc_cfg_t const * const p_cfg);
 fsp_err_t R_CRC_Close(crc_ctrl_t * const p_ctrl);
 fsp_err_t R_CRC_Calculate(crc_ctrl_t * const p_ctrl, crc_input_t * const p_crc_input, uint32_t * calculatedValue);
 fsp_err_t R_CRC_CalculatedValueGet(crc_ctrl_t * const p_ctrl, uint32_t * calculatedValue);
+fsp_err_t R_CRC_CalculateStart(crc_ctrl_t * const p_ctrl, crc_input_t * const p_crc_input);
+fsp_err_t R_CRC_StateSave(crc_ctrl_t * const p_ctrl, crc_state_t * const p_state);
+fsp_err_t R_CRC_StateRestore(crc_ctrl_t * const p_ctrl, crc_state_t const * const p_state);
 fsp_err_t R_CRC_SnoopEnable(crc_ctrl_t * const p_ctrl, uint32_t crc_seed);
 fsp_err_t R_CRC_SnoopDisable(crc_ctrl_t * const p_ctrl);
 fsp_err_t R_CRC_VersionGet(fsp_version_t * const p_version);
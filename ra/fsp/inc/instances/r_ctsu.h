@@ -172,6 +172,18 @@ typedef struct st_ctsu_corrcfc_info
 } ctsu_corrcfc_info_t;
 #endif
 
+/** Autonomous scan configuration used by R_CTSU_AutoScanStart(). */
+typedef struct st_ctsu_auto_scan_cfg
+{
+    /** Wake threshold for each element of the instance, compared with the raw count of the first measurement
+     * frequency: the sensor count in self mode, and the secondary count minus the primary count in mutual mode. */
+    uint16_t const * p_threshold;
+
+    /** Number of scans after which the application is notified even if no threshold is reached, so it can keep its
+     * baseline up to date. 0 notifies only on threshold or error events. */
+    uint16_t wake_interval;
+} ctsu_auto_scan_cfg_t;
+
 /** CTSU private control block. DO NOT MODIFY. Initialization occurs when R_CTSU_Open() is called. */
 typedef struct st_ctsu_instance_ctrl
 {
@@ -206,6 +218,8 @@ typedef struct st_ctsu_instance_ctrl
     void (* p_callback)(ctsu_callback_args_t *); ///< Callback provided when a CTSUFN occurs.
     ctsu_callback_args_t * p_callback_memory;    ///< Pointer to non-secure memory that can be used to pass arguments to a callback in non-secure memory.
     void const           * p_context;            ///< Placeholder for user data.
+    ctsu_auto_scan_cfg_t const * p_auto_scan_cfg; ///< Autonomous scan configuration, NULL when not running.
+    uint16_t                     auto_scan_count; ///< Scans completed since the last autonomous scan notification.
 } ctsu_instance_ctrl_t;
 
 /**********************************************************************************************************************
@@ -228,6 +242,8 @@ fsp_err_t R_CTSU_CallbackSet(ctsu_ctrl_t * const          p_api_ctrl,
                              void (                     * p_callback)(ctsu_callback_args_t *),
                              void const * const           p_context,
                              ctsu_callback_args_t * const p_callback_memory);
+fsp_err_t R_CTSU_AutoScanStart(ctsu_ctrl_t * const p_ctrl, ctsu_auto_scan_cfg_t const * const p_auto_scan_cfg);
+fsp_err_t R_CTSU_AutoScanStop(ctsu_ctrl_t * const p_ctrl);
 fsp_err_t R_CTSU_Close(ctsu_ctrl_t * const p_ctrl);
 fsp_err_t R_CTSU_VersionGet(fsp_version_t * const p_version);
 
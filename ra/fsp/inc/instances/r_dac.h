@@ -28,6 +28,7 @@
 #include "bsp_api.h"
 #include "r_dac_cfg.h"
 #include "r_dac_api.h"
+#include "r_transfer_api.h"
 
 /* Common macro for FSP header files. There is also a corresponding FSP_FOOTER macro at the end of this file. */
 FSP_HEADER
@@ -47,12 +48,46 @@ FSP_HEADER
  * Typedef definitions
  **********************************************************************************************************************/
 
+/** Waveform playback modes. */
+typedef enum e_dac_waveform_mode
+{
+    /** One table is replayed continuously without CPU interrupts. Requires a DTC (repeat mode). */
+    DAC_WAVEFORM_MODE_CIRCULAR = 0,
+
+    /** Two tables are played alternately. The table that has been played is reported to the callback so it can be
+     * refilled while the other one plays. Requires a DMAC with chain loop enabled. */
+    DAC_WAVEFORM_MODE_DOUBLE_BUFFER = 1,
+} dac_waveform_mode_t;
+
+/** Waveform playback callback arguments. */
+typedef struct st_dac_waveform_callback_args
+{
+    uint32_t     buffer;               ///< Index of the table that has been played and can be refilled
+    void const * p_context;            ///< Placeholder for user data
+} dac_waveform_callback_args_t;
+
+/** Waveform playback configuration, passed to R_DAC_WaveformStart. */
+typedef struct st_dac_waveform_cfg
+{
+    /** DTC or DMAC instance activated by the event that paces the samples (AGT underflow or GPT overflow). */
+    transfer_instance_t const * p_transfer;
+    dac_waveform_mode_t         mode;         ///< Playback mode
+    uint16_t const            * p_buffer[2];  ///< Sample tables, only p_buffer[0] is used in circular mode
+    uint16_t                    num_samples;  ///< Samples per table
+
+    void (* p_callback)(dac_waveform_callback_args_t * p_args); ///< Called when a table has been played
+    void const * p_context;                                      ///< Placeholder for user data
+} dac_waveform_cfg_t;
+
 /** DAC instance control block. */
 typedef struct st_dac_instance_ctrl
 {
     uint8_t  channel;                  // DAC channel number
     uint32_t channel_opened;           // DAC Driver ID
     bool     output_amplifier_enabled; // DAC Output amplifier (on selected MCUs) enabled/disabled.
+
+    dac_waveform_cfg_t const * p_waveform_cfg;   // Waveform playback configuration, NULL when not playing
+    transfer_info_t            waveform_info[2]; // Transfer of each sample table
 } dac_instance_ctrl_t;
 
 /** DAC extended configuration */
@@ -82,6 +117,14 @@ fsp_err_t R_DAC_Start(dac_ctrl_t * p_api_ctrl);
 fsp_err_t R_DAC_Stop(dac_ctrl_t * p_api_ctrl);
 fsp_err_t R_DAC_Close(dac_ctrl_t * p_api_ctrl);
 fsp_err_t R_DAC_VersionGet(fsp_version_t * p_version);
+fsp_err_t R_DAC_WaveformStart(dac_ctrl_t * p_api_ctrl, dac_waveform_cfg_t const * const p_waveform_cfg);
+fsp_err_t R_DAC_WaveformStop(dac_ctrl_t * p_api_ctrl);
+fsp_err_t R_DAC_WaveformTransferEnd(dac_ctrl_t * p_api_ctrl, transfer_info_t const * const p_info);
+fsp_err_t R_DAC_WaveformSineGenerate(dac_ctrl_t * p_api_ctrl,
+                                     uint16_t * const p_table,
+                                     uint16_t         num_samples,
+                                     uint16_t         amplitude,
+                                     uint16_t         offset);
 
 /*******************************************************************************************************************//**
  * @} (end defgroup DAC)
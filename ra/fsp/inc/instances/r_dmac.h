@@ -60,6 +60,18 @@ FSP_HEADER
  * Typedef definitions
  **********************************************************************************************************************/
 
+/** Chain loop options. */
+typedef enum e_dmac_chain_loop
+{
+    /** The chain stops after the last link (the first transfer_info_t with chain_mode set to
+     *  TRANSFER_CHAIN_MODE_DISABLED). */
+    DMAC_CHAIN_LOOP_DISABLED = 0,
+
+    /** The first link is reloaded after the last link, so the chain runs continuously. Use a two link chain for
+     *  double-buffered streams. */
+    DMAC_CHAIN_LOOP_ENABLED = 1,
+} dmac_chain_loop_t;
+
 /** Control block used by driver. DO NOT INITIALIZE - this structure will be initialized in @ref transfer_api_t::open. */
 typedef struct st_dmac_instance_ctrl
 {
@@ -69,12 +81,20 @@ typedef struct st_dmac_instance_ctrl
 
     /* Pointer to base register. */
     R_DMAC0_Type * p_reg;
+
+    /* Chained transfer state. */
+    transfer_info_t * p_chain_head;    // First link of the current chain
+    transfer_info_t * p_chain_current; // Link currently loaded in the channel
 } dmac_instance_ctrl_t;
 
 /** Callback function parameter data. */
 typedef struct st_dmac_callback_args_t
 {
     void const * p_context;            ///< Placeholder for user data.  Set in r_transfer_t::open function in ::transfer_cfg_t.
+
+    /** Link that just completed. Points to transfer_cfg_t::p_info (or the p_info passed to
+     *  transfer_api_t::reconfigure) when chaining is not used. */
+    transfer_info_t const * p_info;
 } dmac_callback_args_t;
 
 /** DMAC transfer configuration extension. This extension is required. */
@@ -95,6 +115,9 @@ typedef struct st_dmac_extended_cfg
 
     /** Placeholder for user data.  Passed to the user p_callback in ::dmac_callback_args_t. */
     void const * p_context;
+
+    /** Select whether a chained transfer restarts from the first link after the last link completes. */
+    dmac_chain_loop_t chain_loop;
 } dmac_extended_cfg_t;
 
 /**********************************************************************************************************************
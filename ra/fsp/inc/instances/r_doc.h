@@ -51,6 +51,12 @@ typedef struct st_doc_instance_ctrl
     void (* p_callback)(doc_callback_args_t *);
     doc_callback_args_t * p_callback_memory;
     void const          * p_context;   ///< User defined context passed into callback function
+
+    /* Batch write state */
+    uint32_t         batch_count;      // Samples in the current or last batch
+    uint32_t         batch_matches;    // Events detected during the current or last batch
+    doc_batch_mode_t batch_mode;       // Behavior on an event
+    bool             batch_active;     // Whether the transfer may still be writing samples
 } doc_instance_ctrl_t;
 
 /**********************************************************************************************************************
@@ -70,6 +76,10 @@ fsp_err_t R_DOC_Open(doc_ctrl_t * const p_api_ctrl, doc_cfg_t const * const p_cf
 fsp_err_t R_DOC_Close(doc_ctrl_t * const p_api_ctrl);
 fsp_err_t R_DOC_StatusGet(doc_ctrl_t * const p_api_ctrl, doc_status_t * p_status);
 fsp_err_t R_DOC_Write(doc_ctrl_t * const p_api_ctrl, uint16_t data);
+fsp_err_t R_DOC_BatchWrite(doc_ctrl_t * const     p_api_ctrl,
+                           uint16_t const * const p_data,
+                           uint32_t               count,
+                           doc_batch_mode_t       mode);
 fsp_err_t R_DOC_VersionGet(fsp_version_t * const p_version);
 fsp_err_t R_DOC_CallbackSet(doc_ctrl_t * const          p_api_ctrl,
                             void (                    * p_callback)(doc_callback_args_t *),
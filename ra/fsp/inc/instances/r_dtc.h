@@ -54,6 +54,15 @@ FSP_HEADER
 /** Max configurable number of blocks to transfer in BLOCK MODE */
 #define DTC_MAX_BLOCK_COUNT               (0x10000)
 
+/** Max number of transfer_info_t links in a chain built by R_DTC_ChainBuild */
+#define DTC_MAX_CHAIN_LENGTH              (0x100)
+
+/* DTC Control Register RRS Enable value. */
+#define DTC_PRV_RRS_ENABLE                (0x18)
+
+/* DTC Control Register RRS Disable value. */
+#define DTC_PRV_RRS_DISABLE               (0x08)
+
 /***********************************************************************************************************************
  * Typedef definitions
  **********************************************************************************************************************/
@@ -97,8 +106,73 @@ fsp_err_t R_DTC_Enable(transfer_ctrl_t * const p_api_ctrl);
 fsp_err_t R_DTC_Disable(transfer_ctrl_t * const p_api_ctrl);
 fsp_err_t R_DTC_InfoGet(transfer_ctrl_t * const p_api_ctrl, transfer_properties_t * const p_properties);
 fsp_err_t R_DTC_Close(transfer_ctrl_t * const p_api_ctrl);
+fsp_err_t R_DTC_ChainBuild(transfer_info_t * const     p_links,
+                           uint32_t const              num_links,
+                           transfer_chain_mode_t const chain_mode);
+fsp_err_t R_DTC_ChainSwap(transfer_ctrl_t * const p_api_ctrl,
+                          transfer_info_t * const p_chain,
+                          transfer_info_t ** const pp_previous);
 fsp_err_t R_DTC_VersionGet(fsp_version_t * const p_version);
 
+/*******************************************************************************************************************//**
+ * Resets the transfer source, destination and number of transfers without parameter checking. Fast path variant of
+ * R_DTC_Reset() for restarting a transfer from its transfer end interrupt.
+ *
+ * The caller must guarantee that:
+ * - The instance is open and p_info is the transfer_info_t it was opened with (the instance's vector table entry).
+ * - No transfer is in progress on the activation source, e.g. because DTC cleared the activation after the last
+ *   transfer of a normal or block mode transfer. Unlike R_DTC_Reset(), this function does not wait for the DTC to
+ *   become idle.
+ * - p_src and p_dest are non-NULL and aligned to the transfer size. They are not validated.
+ *
+ * Transfers on the activation source are enabled when this function returns.
+ *
+ * @param[in]  p_ctrl          Opened DTC instance control block.
+ * @param[in]  p_info          Transfer information the instance was opened with.
+ * @param[in]  p_src           New transfer source.
+ * @param[in]  p_dest          New transfer destination.
+ * @param[in]  num_transfers   Number of transfers (normal mode) or blocks (block mode). Ignored in repeat mode.
+ **********************************************************************************************************************/
+__STATIC_INLINE void R_DTC_ResetFast (dtc_instance_ctrl_t * const p_ctrl,
+                                      transfer_info_t * const     p_info,
+                                      void const * volatile       p_src,
+                                      void * volatile             p_dest,
+                                      uint16_t const              num_transfers)
+{
+    /* Disable read skip prior to modifying settings. */
+#if FSP_PRIV_TZ_USE_SECURE_REGS
+    R_DTC->DTCCR_SEC = DTC_PRV_RRS_DISABLE;
+#else
+    R_DTC->DTCCR = DTC_PRV_RRS_DISABLE;
+#endif
+
+    p_info->p_src  = p_src;
+    p_info->p_dest = p_dest;
+
+    if (TRANSFER_MODE_BLOCK == p_info->mode)
+    {
+        p_info->num_blocks = num_transfers;
+    }
+    else if (TRANSFER_MODE_NORMAL == p_info->mode)
+    {
+        p_info->length = num_transfers;
+    }
+    else
+    {
+        /* Do nothing. */
+    }
+
+    /* Enable read skip after all settings are written. */
+#if FSP_PRIV_TZ_USE_SECURE_REGS
+    R_DTC->DTCCR_SEC = DTC_PRV_RRS_ENABLE;
+#else
+    R_DTC->DTCCR = DTC_PRV_RRS_ENABLE;
+#endif
+
+    /* Enable transfers on this activation source. */
+    R_ICU->IELSR_b[p_ctrl->irq].DTCE = 1U;
+}
+
 /* Common macro for FSP header files. There is also a corresponding FSP_HEADER macro at the top of this file. */
 FSP_FOOTER
 
@@ -74,6 +74,12 @@ fsp_err_t R_ELC_LinkSet(elc_ctrl_t * const p_ctrl, elc_peripheral_t peripheral,
 fsp_err_t R_ELC_LinkBreak(elc_ctrl_t * const p_ctrl, elc_peripheral_t peripheral);
 fsp_err_t R_ELC_Enable(elc_ctrl_t * const p_ctrl);
 fsp_err_t R_ELC_Disable(elc_ctrl_t * const p_ctrl);
+fsp_err_t R_ELC_PipelineEnable(elc_ctrl_t * const p_ctrl, elc_pipeline_t const * const p_pipeline);
+fsp_err_t R_ELC_PipelineDisable(elc_ctrl_t * const p_ctrl, elc_pipeline_t const * const p_pipeline);
+fsp_err_t R_ELC_PipelineCountGet(elc_ctrl_t * const           p_ctrl,
+                                 elc_pipeline_t const * const p_pipeline,
+                                 uint32_t                     link,
+                                 uint32_t * const             p_count);
 fsp_err_t R_ELC_VersionGet(fsp_version_t * const p_version);
 
 /* Common macro for FSP header files. There is also a corresponding FSP_HEADER macro at the top of this file. */
@@ -43,6 +43,41 @@ FSP_HEADER
 #define ETHER_CODE_VERSION_MAJOR    (1U)
 #define ETHER_CODE_VERSION_MINOR    (1U)
 
+/** Number of buckets of the software multicast filter hash table. */
+#define ETHER_MULTICAST_HASH_TABLE_SIZE    (64U)
+
+/** Number of software transmit queues, one per @ref ether_tx_priority_t. */
+#define ETHER_TX_QUEUE_NUM                 (2U)
+
+/** Alignment of the EDMAC descriptors in bytes. */
+#define ETHER_DESCRIPTOR_ALIGNMENT           (16U)
+
+/** Alignment of the EDMAC buffers in bytes. */
+#define ETHER_BUFFER_ALIGNMENT               (32U)
+
+/** Size of one EDMAC buffer holding @p frame_size bytes, rounded up to the EDMAC buffer alignment. */
+#define ETHER_BUFFER_SIZE(frame_size)        ((((frame_size) + ETHER_BUFFER_ALIGNMENT - 1U) / \
+                                               ETHER_BUFFER_ALIGNMENT) * ETHER_BUFFER_ALIGNMENT)
+
+/* Memory placement of the EDMAC descriptors and buffers. The descriptor and buffer arrays referenced by ether_cfg_t
+ * are declared with ETHER_DESCRIPTOR_PLACE_IN_SECTION and ETHER_BUFFER_PLACE_IN_SECTION. Defining
+ * ETHER_CFG_DESCRIPTOR_SECTION_NAME (for example a section in SRAMHS) and ETHER_CFG_BUFFER_SECTION_NAME (a section in
+ * another SRAM bank) keeps EDMAC descriptor fetches and buffer transfers off the bank the CPU and other bus masters
+ * work in. The sections must be provided by the linker script. */
+#ifdef ETHER_CFG_DESCRIPTOR_SECTION_NAME
+ #define ETHER_DESCRIPTOR_PLACE_IN_SECTION    BSP_ALIGN_VARIABLE(ETHER_DESCRIPTOR_ALIGNMENT) \
+    BSP_PLACE_IN_SECTION(ETHER_CFG_DESCRIPTOR_SECTION_NAME)
+#else
+ #define ETHER_DESCRIPTOR_PLACE_IN_SECTION    BSP_ALIGN_VARIABLE(ETHER_DESCRIPTOR_ALIGNMENT)
+#endif
+
+#ifdef ETHER_CFG_BUFFER_SECTION_NAME
+ #define ETHER_BUFFER_PLACE_IN_SECTION        BSP_ALIGN_VARIABLE(ETHER_BUFFER_ALIGNMENT) \
+    BSP_PLACE_IN_SECTION(ETHER_CFG_BUFFER_SECTION_NAME)
+#else
+ #define ETHER_BUFFER_PLACE_IN_SECTION        BSP_ALIGN_VARIABLE(ETHER_BUFFER_ALIGNMENT)
+#endif
+
 /***********************************************************************************************************************
  * Typedef definitions
  **********************************************************************************************************************/
@@ -71,6 +106,37 @@ typedef enum e_ether_link_establish_status
     ETHER_LINK_ESTABLISH_STATUS_UP   = 1, ///< Link establish status is up
 } ether_link_establish_status_t;
 
+/** Order in which the software transmit queues are served. */
+typedef enum e_ether_tx_schedule
+{
+    ETHER_TX_SCHEDULE_STRICT   = 0,    ///< High priority frames are always sent first
+    ETHER_TX_SCHEDULE_WEIGHTED = 1,    ///< Up to tx_high_weight high priority frames are sent per normal frame
+} ether_tx_schedule_t;
+
+/** Software transmit queue. */
+typedef struct st_ether_tx_queue_cfg
+{
+    ether_buffer_fragment_t * p_frames; ///< Queue storage of num_frames entries
+    uint32_t                  num_frames;
+} ether_tx_queue_cfg_t;
+
+/** Extended configuration, referenced by ether_cfg_t::p_extend. With p_extend set to NULL frames are written straight
+ *  to the transmit descriptors.
+ *
+ *  In zero copy mode, frames can be queued in software in front of the transmit descriptors. The scheduler keeps at
+ *  most tx_descriptor_depth frames in the descriptors, so a high priority frame waits behind at most that many frames
+ *  instead of behind every frame the descriptors can hold. Frames are moved to the descriptors when they are written
+ *  and when transmitted buffers are reclaimed, so every queued frame requests the transmit complete interrupt.
+ */
+typedef struct st_ether_extended_cfg
+{
+    ether_tx_queue_cfg_t tx_queues[ETHER_TX_QUEUE_NUM]; ///< Queues, indexed by ether_tx_priority_t
+    ether_tx_schedule_t  tx_schedule;                   ///< Order in which the queues are served
+    uint8_t              tx_high_weight;                ///< High priority frames per normal frame, weighted schedule
+    uint8_t              tx_descriptor_depth;           ///< Maximum frames in the transmit descriptors
+    uint8_t              tx_pcp_threshold;              ///< Lowest VLAN PCP queued as high priority by write, 8 for none
+} ether_extended_cfg_t;
+
 /** ETHER control block. DO NOT INITIALIZE.  Initialization occurs when @ref ether_api_t::open is called. */
 typedef struct st_ether_instance_ctrl
 {
@@ -83,6 +149,20 @@ typedef struct st_ether_instance_ctrl
     ether_instance_descriptor_t * p_rx_descriptor;       ///< Pointer to the currently referenced transmit descriptor
     ether_instance_descriptor_t * p_tx_descriptor;       ///< Pointer to the currently referenced receive descriptor
 
+    /* Transmit completion. */
+    ether_instance_descriptor_t * p_tx_reclaim_descriptor; ///< Oldest transmit descriptor not yet reclaimed
+    volatile uint32_t tx_write_count;                      ///< Transmit descriptors queued in zero copy mode
+    volatile uint32_t tx_reclaim_count;                    ///< Transmit descriptors reclaimed in zero copy mode
+    uint32_t          tx_complete_count;                   ///< Frames queued since the last transmit complete request
+
+    /* Software transmit queues. */
+    uint32_t tx_queue_head[ETHER_TX_QUEUE_NUM];            ///< Index of the oldest frame of each queue
+    uint32_t tx_queue_count[ETHER_TX_QUEUE_NUM];           ///< Number of frames in each queue
+    uint32_t tx_high_credit;                               ///< High priority frames sent since the last normal frame
+
+    /* Receive timestamping. */
+    ether_rx_timestamp_t rx_timestamp;                     ///< Receive time of the frame last delivered by read
+
     /* Interface for PHY-LSI chip. */
     void * p_reg_etherc;                                 ///< Base register of ethernet controller for this channel
     void * p_reg_edmac;                                  ///< Base register of EDMA controller for this channel
@@ -92,6 +172,10 @@ typedef struct st_ether_instance_ctrl
     ether_link_change_t           link_change;           ///< status of link change
     ether_magic_packet_t          magic_packet;          ///< status of magic packet detection
     ether_link_establish_status_t link_establish_status; ///< Current Link status
+
+    /* Software multicast filter. */
+    uint8_t  multicast_hash_count[ETHER_MULTICAST_HASH_TABLE_SIZE]; ///< Registered addresses per hash bucket
+    uint32_t multicast_filter_count;                                ///< Number of registered multicast addresses
 } ether_instance_ctrl_t;
 
 /*
@@ -174,6 +258,31 @@ fsp_err_t R_ETHER_BufferRelease(ether_ctrl_t * const p_ctrl);
 
 fsp_err_t R_ETHER_Write(ether_ctrl_t * const p_ctrl, void * const p_buffer, uint32_t const frame_length);
 
+fsp_err_t R_ETHER_WriteGather(ether_ctrl_t * const                 p_ctrl,
+                              ether_buffer_fragment_t const * const p_fragments,
+                              uint32_t const                        num_fragments);
+
+fsp_err_t R_ETHER_TxBufferReclaim(ether_ctrl_t * const p_ctrl,
+                                  void ** const        pp_buffers,
+                                  uint32_t const       max_buffers,
+                                  uint32_t * const     p_num_buffers);
+
+fsp_err_t R_ETHER_PriorityWrite(ether_ctrl_t * const      p_ctrl,
+                                void * const              p_buffer,
+                                uint32_t const            frame_length,
+                                ether_tx_priority_t const priority);
+
+fsp_err_t R_ETHER_PriorityRead(ether_ctrl_t * const p_ctrl,
+                               void * const         p_buffer,
+                               uint32_t * const     length_bytes,
+                               uint16_t const       ether_type);
+
+fsp_err_t R_ETHER_RxTimestampGet(ether_ctrl_t * const p_ctrl, uint32_t * const p_timestamp);
+
+fsp_err_t R_ETHER_MulticastAddressAdd(ether_ctrl_t * const p_ctrl, uint8_t const * const p_mac_address);
+
+fsp_err_t R_ETHER_MulticastAddressRemove(ether_ctrl_t * const p_ctrl, uint8_t const * const p_mac_address);
+
 fsp_err_t R_ETHER_LinkProcess(ether_ctrl_t * const p_ctrl);
 
 fsp_err_t R_ETHER_WakeOnLANEnable(ether_ctrl_t * const p_ctrl);
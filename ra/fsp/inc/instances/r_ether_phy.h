@@ -47,6 +47,28 @@ FSP_HEADER
 #define ETHER_PHY_CFG_USE_PHY_KSZ8041       (2)
 #define ETHER_PHY_CFG_USE_PHY_DP83620       (3)
 
+/* When set to 1 the PHY-LSI INT pin is used to signal link changes. @ref ether_phy_api_t::linkStatusGet then also
+ * clears the latched interrupt status of the PHY-LSI so that the next link change asserts the INT pin again. The link
+ * state read is kept until the INT pin interrupt calls @ref ether_phy_api_t::linkStateInvalidate, so checking the link
+ * in between needs no MDIO access. */
+#ifndef ETHER_PHY_CFG_LINK_INTERRUPT_ENABLE
+ #define ETHER_PHY_CFG_LINK_INTERRUPT_ENABLE    (0)
+#endif
+
+/* MDC frequency of the MII management interface in Hz. When set to 0 each quarter of an MDC period lasts
+ * ether_phy_cfg_t::mii_bit_access_wait_time PIR writes. Otherwise the number of writes is derived from PCLKA when the
+ * PHY is opened. Each PIR write takes at least one PCLKA cycle, so MDC never runs faster than this frequency.
+ * IEEE 802.3 specifies up to 2.5 MHz, but many PHY-LSIs accept a faster MDC. */
+#ifndef ETHER_PHY_CFG_MDC_FREQUENCY_HZ
+ #define ETHER_PHY_CFG_MDC_FREQUENCY_HZ    (0)
+#endif
+
+/* When set to 1 and the PHY-LSI accepts management frames with suppressed preamble (basic status register bit 6),
+ * frames are sent with a single idle bit instead of the 32 bit preamble. */
+#ifndef ETHER_PHY_CFG_PREAMBLE_SUPPRESSION_ENABLE
+ #define ETHER_PHY_CFG_PREAMBLE_SUPPRESSION_ENABLE    (0)
+#endif
+
 /***********************************************************************************************************************
  * Typedef definitions
  **********************************************************************************************************************/
@@ -64,6 +86,18 @@ typedef struct st_ether_phy_instance_ctrl
 
     /* The capabilities of the local link as PHY data */
     uint32_t local_advertise;                ///< Capabilities bitmap for local advertising.
+
+    /* Timing of the MII management interface. */
+    uint32_t mdc_hold;                       ///< PIR writes per quarter MDC period.
+    uint32_t preamble_length;                ///< Preamble bits sent before each management frame.
+
+#if (ETHER_PHY_CFG_LINK_INTERRUPT_ENABLE)
+
+    /* PHY-LSI link state read after the last link change interrupt. */
+    volatile uint32_t link_state_valid;      ///< Set while link_status and link_partner are up to date.
+    uint32_t          link_status;           ///< Basic status register.
+    uint32_t          link_partner;          ///< Auto-negotiation link partner ability register.
+#endif
 } ether_phy_instance_ctrl_t;
 
 /**********************************************************************************************************************
@@ -96,6 +130,13 @@ fsp_err_t R_ETHER_PHY_LinkPartnerAbilityGet(ether_phy_ctrl_t * const p_ctrl,
 
 fsp_err_t R_ETHER_PHY_LinkStatusGet(ether_phy_ctrl_t * const p_ctrl);
 
+fsp_err_t R_ETHER_PHY_RegistersRead(ether_phy_ctrl_t * const p_ctrl,
+                                    uint32_t const * const   p_reg_addr,
+                                    uint32_t * const         p_data,
+                                    uint32_t                 num_registers);
+
+fsp_err_t R_ETHER_PHY_LinkStateInvalidate(ether_phy_ctrl_t * const p_ctrl);
+
 fsp_err_t R_ETHER_PHY_VersionGet(fsp_version_t * const p_version);
 
 /*******************************************************************************************************************//**
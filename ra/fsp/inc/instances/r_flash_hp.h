@@ -69,8 +69,44 @@ typedef enum e_flash_bgo_operation
     FLASH_OPERATION_DF_BGO_WRITE,
     FLASH_OPERATION_DF_BGO_ERASE,
     FLASH_OPERATION_DF_BGO_BLANKCHECK,
+    FLASH_OPERATION_CF_BGO_WRITE,      ///< Background write to the code flash bank not being executed from
+    FLASH_OPERATION_CF_BGO_ERASE,      ///< Background erase of the code flash bank not being executed from
 } flash_bgo_operation_t;
 
+/** Data flash operation requested with R_FLASH_HP_RequestSubmit() */
+typedef enum e_flash_hp_request_op
+{
+    FLASH_HP_REQUEST_OP_WRITE,         ///< Write num bytes from src_address to flash_address (DF or background bank)
+    FLASH_HP_REQUEST_OP_ERASE,         ///< Erase num blocks starting at flash_address (DF or background bank)
+    FLASH_HP_REQUEST_OP_BLANK_CHECK,   ///< Blank check num bytes starting at flash_address
+} flash_hp_request_op_t;
+
+/** Progress of a data flash request */
+typedef enum e_flash_hp_request_status
+{
+    FLASH_HP_REQUEST_STATUS_IDLE,      ///< Not submitted, or discarded by R_FLASH_HP_Reset() or R_FLASH_HP_Close()
+    FLASH_HP_REQUEST_STATUS_QUEUED,    ///< Waiting in the request queue
+    FLASH_HP_REQUEST_STATUS_ACTIVE,    ///< Operation in progress
+    FLASH_HP_REQUEST_STATUS_COMPLETE,  ///< Operation finished, result is in event
+} flash_hp_request_status_t;
+
+/** Data flash request. The memory is owned by the driver from R_FLASH_HP_RequestSubmit() until the request
+ * completes or is discarded. */
+typedef struct st_flash_hp_request
+{
+    flash_hp_request_op_t op;                        ///< Operation to perform
+    uint32_t              src_address;               ///< Source address of the data to write (writes only)
+    uint32_t              flash_address;             ///< Data flash address the operation starts at
+    uint32_t              num;                       ///< Number of bytes (write, blank check) or blocks (erase)
+    uint8_t               priority;                  ///< Higher values are dispatched first, FIFO within a priority
+    void (* p_callback)(flash_callback_args_t *);    ///< Optional completion callback, called from the FRDYI/FIFERR ISR
+    void const * p_context;                          ///< Passed to p_callback in flash_callback_args_t::p_context
+
+    volatile flash_hp_request_status_t status;       ///< Set by the driver
+    volatile flash_event_t             event;        ///< Completion event, valid once status is COMPLETE
+    struct st_flash_hp_request       * p_next;       ///< Used by the driver to link queued requests
+} flash_hp_request_t;
+
 /** Flash HP instance control block. DO NOT INITIALIZE. */
 typedef struct st_flash_hp_instance_ctrl
 {
@@ -88,10 +124,14 @@ typedef struct st_flash_hp_instance_ctrl
     uint32_t              dest_end_address;
     uint32_t              operations_remaining;
     flash_bgo_operation_t current_operation;      ///< Operation in progress, for example, FLASH_OPERATION_CF_ERASE
+    uint32_t              verify_start_address;   // First address of a background bank write, read back on completion
 
     void (* p_callback)(flash_callback_args_t *); // Pointer to callback
     flash_callback_args_t * p_callback_memory;    // Pointer to optional callback argument memory
     void const            * p_context;            // Pointer to context to be passed into callback function
+
+    flash_hp_request_t * p_request_head;          // Queued requests in dispatch order
+    flash_hp_request_t * p_request_active;        // Request currently being processed by the FCU
 } flash_hp_instance_ctrl_t;
 
 /**********************************************************************************************************************
@@ -144,6 +184,7 @@ fsp_err_t R_FLASH_HP_CallbackSet(flash_ctrl_t * const          p_api_ctrl,
                                  flash_callback_args_t * const p_callback_memory);
 fsp_err_t R_FLASH_HP_VersionGet(fsp_version_t * const p_version);
 fsp_err_t R_FLASH_HP_InfoGet(flash_ctrl_t * const p_api_ctrl, flash_info_t * const p_info);
+fsp_err_t R_FLASH_HP_RequestSubmit(flash_ctrl_t * const p_api_ctrl, flash_hp_request_t * const p_request);
 
 /*******************************************************************************************************************//**
  * @} (end defgroup FLASH_HP)
@@ -71,6 +71,25 @@ typedef enum e_flash_bgo_operation
     FLASH_OPERATION_DF_BGO_BLANKCHECK,
 } flash_bgo_operation_t;
 
+/** Streaming write state. Data appended with R_FLASH_LP_StreamWrite() is staged in a caller supplied ring buffer and
+ * programmed in whole programming units. */
+typedef struct st_flash_lp_stream
+{
+    uint8_t         * p_buffer;        // Staging ring buffer supplied to R_FLASH_LP_StreamOpen()
+    uint32_t          buffer_size;     // Size of the staging buffer in bytes
+    uint32_t          unit;            // Programming unit of the flash area being streamed to
+    uint32_t          flash_address;   // Flash address of the oldest staged byte
+    uint32_t          next_address;    // Flash address the next appended byte will be programmed to
+    uint32_t          end_address;     // End of the flash area the stream was opened in
+    uint32_t          head;            // Buffer index of the next byte to stage
+    uint32_t          tail;            // Buffer index of the oldest staged byte
+    volatile uint32_t count;           // Number of bytes staged and not yet programmed
+    volatile uint32_t in_flight;       // Number of staged bytes being programmed by a data flash BGO write
+    bool              bgo;             // Whether the staged data is programmed in the background
+    volatile bool     flush;           // Program the remaining bytes and close the stream
+    volatile bool     open;            // Whether a stream is open
+} flash_lp_stream_t;
+
 /** Flash instance control block. DO NOT INITIALIZE. Initialization occurs when R_FLASH_LP_Open() is called. */
 typedef struct st_flash_lp_instance_ctrl
 {
@@ -88,6 +107,7 @@ typedef struct st_flash_lp_instance_ctrl
     uint32_t              dest_end_address;         // Destination/End address of in progress operation
     uint32_t              operations_remaining;     // Number of operations remaining
     flash_bgo_operation_t current_operation;        // Type of BGO operation in progress.
+    flash_lp_stream_t     stream;                   // Streaming write state
 } flash_lp_instance_ctrl_t;
 
 /**********************************************************************************************************************
@@ -129,6 +149,14 @@ fsp_err_t R_FLASH_LP_CallbackSet(flash_ctrl_t * const          p_api_ctrl,
 fsp_err_t R_FLASH_LP_UpdateFlashClockFreq(flash_ctrl_t * const p_api_ctrl);
 fsp_err_t R_FLASH_LP_VersionGet(fsp_version_t * const p_version);
 fsp_err_t R_FLASH_LP_InfoGet(flash_ctrl_t * const p_api_ctrl, flash_info_t * const p_info);
+fsp_err_t R_FLASH_LP_StreamOpen(flash_ctrl_t * const p_api_ctrl,
+                                uint32_t const       flash_address,
+                                uint8_t * const      p_buffer,
+                                uint32_t const       buffer_size);
+fsp_err_t R_FLASH_LP_StreamWrite(flash_ctrl_t * const  p_api_ctrl,
+                                 uint8_t const * const p_src,
+                                 uint32_t const        num_bytes);
+fsp_err_t R_FLASH_LP_StreamFlush(flash_ctrl_t * const p_api_ctrl);
 
 /*******************************************************************************************************************//**
  * @} (end addtogroup FLASH_LP)
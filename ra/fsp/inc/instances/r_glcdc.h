@@ -225,6 +225,8 @@ fsp_err_t R_GLCDC_BufferChange(display_ctrl_t const * const p_api_ctrl,
 #if GLCDC_CFG_COLOR_CORRECTION_ENABLE
 fsp_err_t R_GLCDC_ColorCorrection(display_ctrl_t const * const       p_api_ctrl,
                                   display_correction_t const * const p_correction);
+fsp_err_t R_GLCDC_GammaCorrection(display_ctrl_t const * const             p_api_ctrl,
+                                  display_gamma_correction_t const * const p_gamma);
 
 #endif
 
@@ -31,6 +31,8 @@
  **********************************************************************************************************************/
 #include "bsp_api.h"
 #include "r_timer_api.h"
+#include "r_transfer_api.h"
+#include "r_gpt_cfg.h"
 
 /* Common macro for FSP header files. There is also a corresponding FSP_FOOTER macro at the end of this file. */
 FSP_HEADER
@@ -251,6 +253,48 @@ typedef enum e_gpt_interrupt_skip_adc
     GPT_INTERRUPT_SKIP_ADC_A_AND_B = 5U, ///< Skip ADC A and B events
 } gpt_interrupt_skip_adc_t;
 
+/** Capture stream configuration used by R_GPT_CaptureStreamStart(). Each transfer instance must be activated by the
+ * matching capture event (GPTn_CAPTURE_COMPARE_A or GPTn_CAPTURE_COMPARE_B). With a DMAC, set the capture interrupt to
+ * FSP_INVALID_VECTOR in @ref gpt_extended_cfg_t so the capture ISR does not run for every edge. */
+typedef struct st_gpt_capture_stream_cfg
+{
+    transfer_instance_t const * p_transfer_a; ///< Transfer activated by capture A
+    transfer_instance_t const * p_transfer_b; ///< Transfer activated by capture B, NULL to log GTCCRA only
+    uint32_t                  * p_buffer_a;   ///< Ring of ring_length GTCCRA captures
+    uint32_t                  * p_buffer_b;   ///< Ring of ring_length GTCCRB captures, unused without p_transfer_b
+    uint16_t ring_length;                     ///< Entries in each ring (at most 256 with DTC, 1024 with DMAC)
+} gpt_capture_stream_cfg_t;
+
+/** Batch measurement returned by R_GPT_CaptureStreamMeasure(). */
+typedef struct st_gpt_capture_measurement
+{
+    uint32_t edges;                    ///< Capture A edges consumed by this measurement
+    uint32_t period_counts;            ///< Mean period between capture A edges, 0 if no period was seen
+    uint32_t frequency_hz;             ///< Mean frequency of capture A edges, 0 if no period was seen
+    uint32_t duty_ppm;                 ///< Mean A to B time in parts per million of the period, 0 without capture B
+} gpt_capture_measurement_t;
+
+/** Sequence table mode. */
+typedef enum e_gpt_sequence_mode
+{
+    GPT_SEQUENCE_MODE_ONE_SHOT = 0,    ///< Run the table once, then start p_next or end the sequence
+    GPT_SEQUENCE_MODE_LOOP     = 1,    ///< Repeat the table until R_GPT_SequenceStop() is called
+} gpt_sequence_mode_t;
+
+/** Waveform sequence table used by R_GPT_SequenceStart(). Each counter overflow loads the next step into the buffer
+ * registers, and the step is output from the following cycle. Values are raw buffer register values: period_counts - 1
+ * for GTPBR and duty_cycle_counts - 1 for GTCCRC/GTCCRD in saw-wave PWM (see R_GPT_DutyCycleSetFast()). Tables must
+ * remain valid while they are in use. */
+typedef struct st_gpt_sequence
+{
+    uint32_t const * p_period;                ///< GTPBR value for each step, NULL to keep the period
+    uint32_t const * p_duty_a;                ///< GTCCRC (GTIOCA duty) value for each step, NULL to keep duty A
+    uint32_t const * p_duty_b;                ///< GTCCRD (GTIOCB duty) value for each step, NULL to keep duty B
+    uint16_t            steps;                ///< Steps in the table (at most 256 in loop mode)
+    gpt_sequence_mode_t mode;                 ///< Run once or loop
+    struct st_gpt_sequence const * p_next;    ///< One-shot only: table started after this one, NULL to end
+} gpt_sequence_t;
+
 /** Channel control block. DO NOT INITIALIZE.  Initialization occurs when @ref timer_api_t::open is called. */
 typedef struct st_gpt_instance_ctrl
 {
@@ -263,6 +307,18 @@ typedef struct st_gpt_instance_ctrl
     void (* p_callback)(timer_callback_args_t *); // Pointer to callback
     timer_callback_args_t * p_callback_memory;    // Pointer to optional callback argument memory
     void const            * p_context;            // Pointer to context to be passed into callback function
+
+    gpt_capture_stream_cfg_t const * p_stream_cfg;     // Capture stream configuration, NULL when not streaming
+    transfer_info_t                  stream_info[2];   // Transfer settings for capture A and capture B
+    volatile uint32_t                stream_overflows; // Counter overflows since the capture stream started
+    uint32_t stream_read[2];                           // Next ring entry to read for capture A and capture B
+    uint32_t stream_last[2];                           // Last capture read for capture A and capture B
+    uint64_t stream_time[2];                           // 64-bit time of the last capture read
+    uint64_t stream_edge;                              // 64-bit time of the last capture A used for measurement
+
+    gpt_sequence_t const      * p_sequence;       // Sequence table being transferred, NULL when not sequencing
+    transfer_instance_t const * p_seq_transfer;   // Transfer activated by the counter overflow for the sequence
+    transfer_info_t             sequence_info[3]; // Transfer links for GTPBR, GTCCRC and GTCCRD
 } gpt_instance_ctrl_t;
 
 /** GPT extension for advanced PWM features. */
@@ -343,6 +399,7 @@ fsp_err_t R_GPT_StatusGet(timer_ctrl_t * const p_ctrl, timer_status_t * const p_
 fsp_err_t R_GPT_CounterSet(timer_ctrl_t * const p_ctrl, uint32_t counter);
 fsp_err_t R_GPT_OutputEnable(timer_ctrl_t * const p_ctrl, gpt_io_pin_t pin);
 fsp_err_t R_GPT_OutputDisable(timer_ctrl_t * const p_ctrl, gpt_io_pin_t pin);
+fsp_err_t R_GPT_OutputLevelSet(timer_ctrl_t * const p_ctrl, gpt_io_pin_t pin, gpt_pin_level_t level);
 fsp_err_t R_GPT_AdcTriggerSet(timer_ctrl_t * const    p_ctrl,
                               gpt_adc_compare_match_t which_compare_match,
                               uint32_t                compare_match_value);
@@ -350,9 +407,48 @@ fsp_err_t R_GPT_CallbackSet(timer_ctrl_t * const          p_api_ctrl,
                             void (                      * p_callback)(timer_callback_args_t *),
                             void const * const            p_context,
                             timer_callback_args_t * const p_callback_memory);
+fsp_err_t R_GPT_CaptureStreamStart(timer_ctrl_t * const p_ctrl, gpt_capture_stream_cfg_t const * const p_stream_cfg);
+fsp_err_t R_GPT_CaptureStreamStop(timer_ctrl_t * const p_ctrl);
+fsp_err_t R_GPT_CaptureStreamRead(timer_ctrl_t * const p_ctrl,
+                                  gpt_io_pin_t const   pin,
+                                  uint64_t * const     p_timestamps,
+                                  uint32_t const       max_count,
+                                  uint32_t * const     p_count);
+fsp_err_t R_GPT_CaptureStreamMeasure(timer_ctrl_t * const p_ctrl, gpt_capture_measurement_t * const p_result);
+fsp_err_t R_GPT_SequenceStart(timer_ctrl_t * const              p_ctrl,
+                              transfer_instance_t const * const p_transfer,
+                              gpt_sequence_t const * const      p_sequence);
+fsp_err_t R_GPT_SequenceStop(timer_ctrl_t * const p_ctrl);
 fsp_err_t R_GPT_Close(timer_ctrl_t * const p_ctrl);
 fsp_err_t R_GPT_VersionGet(fsp_version_t * const p_version);
 
+#if GPT_CFG_OUTPUT_SUPPORT_ENABLE && !GPT_CFG_WRITE_PROTECT_ENABLE
+
+/*******************************************************************************************************************//**
+ * Writes a raw compare value to the duty cycle buffer register without parameter checking. Fast path variant of
+ * R_GPT_DutyCycleSet() for PWM updates made every carrier cycle.
+ *
+ * The caller must guarantee that:
+ * - The instance is open and the pin is valid.
+ * - compare_counts is the buffer register value, not the duty cycle: duty_cycle_counts - 1 in saw-wave PWM mode and
+ *   duty_cycle_counts in triangle-wave PWM modes, with duty_cycle_counts strictly between 0 and the period.
+ * - The output is not forced to 0% or 100% duty. Use R_GPT_DutyCycleSet() to enter or leave 0% and 100% duty.
+ *
+ * Only available when GPT_CFG_WRITE_PROTECT_ENABLE is 0.
+ *
+ * @param[in]  p_ctrl          Opened GPT instance control block.
+ * @param[in]  compare_counts  Value to write to the duty cycle buffer register.
+ * @param[in]  pin             Which pin to update.
+ **********************************************************************************************************************/
+__STATIC_INLINE void R_GPT_DutyCycleSetFast (gpt_instance_ctrl_t * const p_ctrl,
+                                             uint32_t const              compare_counts,
+                                             gpt_io_pin_t const          pin)
+{
+    p_ctrl->p_reg->GTCCR[(uint32_t) pin + 2U] = compare_counts;
+}
+
+#endif
+
 /*******************************************************************************************************************//**
  * @} (end defgroup GPT)
  **********************************************************************************************************************/
@@ -48,11 +48,13 @@ FSP_HEADER
 /** Channel control block. DO NOT INITIALIZE.  Initialization occurs when @ref three_phase_api_t::open is called. */
 typedef struct st_gpt_three_phase_instance_ctrl
 {
-    uint32_t                  open;         // Whether or not channel is open
-    R_GPT0_Type             * p_reg[3];     // Pointer to GPT channel registers
-    uint32_t                  channel_mask; // Bitmask of GPT channels used
-    three_phase_buffer_mode_t buffer_mode;  // Single- or double-buffer mode
-    three_phase_cfg_t const * p_cfg;        // Pointer to configuration struct
+    uint32_t                  open;           // Whether or not channel is open
+    R_GPT0_Type             * p_reg[3];       // Pointer to GPT channel registers
+    uint32_t                  channel_mask;   // Bitmask of GPT channels used
+    three_phase_buffer_mode_t buffer_mode;    // Single- or double-buffer mode
+    three_phase_cfg_t const * p_cfg;          // Pointer to configuration struct
+    uint32_t                  gtber[3];       // GTBER setting of each channel, cached in open
+    bool                      dead_time_auto; // Whether automatic dead time (GTDTCR.TDE) is enabled
 } gpt_three_phase_instance_ctrl_t;
 
 /**********************************************************************************************************************
@@ -74,11 +76,16 @@ fsp_err_t R_GPT_THREE_PHASE_Start(three_phase_ctrl_t * const p_ctrl);
 fsp_err_t R_GPT_THREE_PHASE_Reset(three_phase_ctrl_t * const p_ctrl);
 fsp_err_t R_GPT_THREE_PHASE_DutyCycleSet(three_phase_ctrl_t * const       p_ctrl,
                                          three_phase_duty_cycle_t * const p_duty_cycle);
+fsp_err_t R_GPT_THREE_PHASE_DutyCycleUpdate(three_phase_ctrl_t * const             p_ctrl,
+                                            three_phase_duty_cycle_t const * const p_duty_cycle,
+                                            uint32_t const                         dead_time_counts);
 fsp_err_t R_GPT_THREE_PHASE_CallbackSet(three_phase_ctrl_t * const    p_ctrl,
                                         void (                      * p_callback)(timer_callback_args_t *),
                                         void const * const            p_context,
                                         timer_callback_args_t * const p_callback_memory);
 fsp_err_t R_GPT_THREE_PHASE_Close(three_phase_ctrl_t * const p_ctrl);
+fsp_err_t R_GPT_THREE_PHASE_PhaseSet(three_phase_ctrl_t * const p_ctrl, uint32_t phase_counts);
+fsp_err_t R_GPT_THREE_PHASE_SyncStart(three_phase_ctrl_t * const p_ctrl, uint32_t sync_channel_mask);
 fsp_err_t R_GPT_THREE_PHASE_VersionGet(fsp_version_t * const p_version);
 
 /*******************************************************************************************************************//**
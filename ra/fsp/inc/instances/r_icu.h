@@ -30,6 +30,7 @@
  * Includes
  **********************************************************************************************************************/
 #include "bsp_api.h"
+#include "r_icu_cfg.h"
 #include "r_external_irq_api.h"
 
 /* Common macro for FSP header files. There is also a corresponding FSP_FOOTER macro at the end of this file. */
@@ -41,10 +42,59 @@ FSP_HEADER
 #define ICU_CODE_VERSION_MAJOR    (1U)
 #define ICU_CODE_VERSION_MINOR    (1U)
 
+/* When set to 1 a channel can queue each edge with a timestamp instead of calling the callback per edge, see
+ * icu_extended_cfg_t::p_event_queue. */
+#ifndef ICU_CFG_EVENT_QUEUE_ENABLE
+ #define ICU_CFG_EVENT_QUEUE_ENABLE    (0)
+#endif
+
 /*********************************************************************************************************************
  * Typedef definitions
  *********************************************************************************************************************/
 
+#if ICU_CFG_EVENT_QUEUE_ENABLE
+
+/** External interrupt event, read with @ref R_ICU_ExternalIrqEventsRead. */
+typedef struct st_icu_event
+{
+    uint32_t timestamp;                ///< Value of icu_extended_cfg_t::p_timestamp when the interrupt was serviced
+    uint32_t channel;                  ///< The physical hardware channel that caused the interrupt
+} icu_event_t;
+
+/** Event queue shared by one or more channels. Initialize queue with R_BSP_QueueInit for items of icu_event_t and
+ * with a sequence array, as channels of different priorities push to it. For example:
+ * BSP_QUEUE_STORAGE_DEFINE(g_pulses, icu_event_t, 1024U);
+ * R_BSP_QueueInit(&g_pulse_queue.queue, g_pulses_buffer, g_pulses_sequence, sizeof(icu_event_t), 1024U); */
+typedef struct st_icu_event_queue
+{
+    bsp_queue_t   queue;               ///< Queue of icu_event_t
+    volatile bool armed;               ///< Private, set when the consumer waits for the next event
+} icu_event_queue_t;
+
+/** Event statistics of a channel in event queue mode. Times are in counts of the timestamp source. */
+typedef struct st_icu_event_statistics
+{
+    uint32_t events;                   ///< Events serviced, including overruns
+    uint32_t overruns;                 ///< Events lost because the queue was full
+    uint32_t notifications;            ///< Callbacks called. events / notifications events were handled per batch.
+    uint32_t interval_min;             ///< Shortest time between two events, UINT32_MAX until two events occurred
+    uint32_t last_timestamp;           ///< Timestamp of the latest event
+} icu_event_statistics_t;
+
+/** ICU extended configuration, set external_irq_cfg_t::p_extend to this structure or to NULL. */
+typedef struct st_icu_extended_cfg
+{
+    /** Queue each edge instead of calling the callback per edge, or NULL. In this mode the callback is only called
+     * for the first event after the consumer drained the queue with @ref R_ICU_ExternalIrqEventsRead. */
+    icu_event_queue_t * p_event_queue;
+
+    /** Register read as event timestamp, or NULL for no timestamp. Use the GTCNT register of a free running GPT to
+     * timestamp the start of the ISR, or a GTCCRA/GTCCRB register that captures on the ELC event of this IRQ to
+     * timestamp the edge itself, free of interrupt latency. */
+    uint32_t const volatile * p_timestamp;
+} icu_extended_cfg_t;
+#endif
+
 /** ICU private control block. DO NOT MODIFY.  Initialization occurs when R_ICU_ExternalIrqOpen is called. */
 typedef struct st_icu_instance_ctrl
 {
@@ -59,6 +109,12 @@ typedef struct st_icu_instance_ctrl
 
     /** Placeholder for user data.  Passed to the user callback in ::external_irq_callback_args_t. */
     void const * p_context;
+
+#if ICU_CFG_EVENT_QUEUE_ENABLE
+    icu_event_queue_t       * p_event_queue; // Queue for the events of this channel, NULL to call the callback per edge
+    uint32_t const volatile * p_timestamp;   // Timestamp source, or NULL
+    icu_event_statistics_t    statistics;    // Event statistics
+#endif
 } icu_instance_ctrl_t;
 
 /**********************************************************************************************************************
@@ -89,6 +145,17 @@ fsp_err_t R_ICU_ExternalIrqCallbackSet(external_irq_ctrl_t * const          p_ap
 
 fsp_err_t R_ICU_ExternalIrqClose(external_irq_ctrl_t * const p_api_ctrl);
 
+#if ICU_CFG_EVENT_QUEUE_ENABLE
+fsp_err_t R_ICU_ExternalIrqEventsRead(external_irq_ctrl_t * const p_api_ctrl,
+                                      icu_event_t * const         p_events,
+                                      uint32_t                    max_events,
+                                      uint32_t * const            p_num_events);
+
+fsp_err_t R_ICU_ExternalIrqStatisticsGet(external_irq_ctrl_t * const    p_api_ctrl,
+                                         icu_event_statistics_t * const p_statistics);
+
+#endif
+
 /*******************************************************************************************************************//**
  * @} (end defgroup ICU)
  **********************************************************************************************************************/
@@ -58,6 +58,25 @@ typedef struct iic_master_clock_settings
     uint8_t brl_value;                 ///< Low-level period of SCL clock
 } iic_master_clock_settings_t;
 
+/** Direction of a batched transfer segment */
+typedef enum e_iic_master_batch_dir
+{
+    IIC_MASTER_BATCH_DIR_WRITE = 0,    ///< Write the sub-address followed by the payload
+    IIC_MASTER_BATCH_DIR_READ  = 1     ///< Write the sub-address, issue a restart and read the payload
+} iic_master_batch_dir_t;
+
+/** One register-map access in a batched transfer. See @ref R_IIC_MASTER_BatchStart. */
+typedef struct st_iic_master_batch_segment
+{
+    uint32_t               slave;          ///< Address of the slave device for this segment
+    i2c_master_addr_mode_t addr_mode;      ///< Indicates how the slave field should be interpreted
+    iic_master_batch_dir_t direction;      ///< Direction of the payload
+    uint8_t const        * p_subaddr;      ///< Register address bytes sent ahead of the payload
+    uint8_t                subaddr_bytes;  ///< Number of register address bytes. Set to 0 to send no sub-address.
+    uint8_t              * p_buffer;       ///< Payload source (write) or destination (read)
+    uint32_t               bytes;          ///< Number of payload bytes
+} iic_master_batch_segment_t;
+
 /** I2C control structure. DO NOT INITIALIZE. */
 typedef struct st_iic_master_instance_ctrl
 {
@@ -80,6 +99,15 @@ typedef struct st_iic_master_instance_ctrl
     uint8_t addr_remain;                            // Tracks the remaining address bytes to transfer
     uint8_t addr_loaded;                            // Tracks the number of address bytes written to the register
 
+    uint8_t const * p_subaddr;                      // Next sub-address byte to issue ahead of the data bytes
+    uint8_t         subaddr_remain;                 // Tracks the remaining sub-address bytes to transfer
+
+    /* Batched transfer information. */
+    iic_master_batch_segment_t const * p_batch;     // Segments of the batch in progress, NULL if none
+    uint32_t batch_length;                          // Number of segments in the batch
+    uint32_t batch_index;                           // Index of the next segment to start
+    bool     batch_data_phase;                      // Next phase is the data phase of a register read
+
     volatile bool             read;                 // Holds the direction of the data byte transfer
     volatile bool             restart;              // Holds whether or not the restart should be issued when done
     volatile bool             err;                  // Tracks whether or not an error occurred during processing
@@ -132,6 +160,9 @@ fsp_err_t R_IIC_MASTER_Abort(i2c_master_ctrl_t * const p_api_ctrl);
 fsp_err_t R_IIC_MASTER_SlaveAddressSet(i2c_master_ctrl_t * const    p_api_ctrl,
                                        uint32_t const               slave,
                                        i2c_master_addr_mode_t const addr_mode);
+fsp_err_t R_IIC_MASTER_BatchStart(i2c_master_ctrl_t * const                p_api_ctrl,
+                                  iic_master_batch_segment_t const * const p_segments,
+                                  uint32_t const                           num_segments);
 fsp_err_t R_IIC_MASTER_Close(i2c_master_ctrl_t * const p_api_ctrl);
 fsp_err_t R_IIC_MASTER_VersionGet(fsp_version_t * const p_version);
 fsp_err_t R_IIC_MASTER_CallbackSet(i2c_master_ctrl_t * const          p_api_ctrl,
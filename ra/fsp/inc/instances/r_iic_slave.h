@@ -56,6 +56,16 @@ typedef struct iic_slave_clock_settings
     uint8_t digital_filter_stages;     ///< Number of digital filter stages based on brl_value
 } iic_slave_clock_settings_t;
 
+/** Memory exposed to the master in register-file mode. See @ref R_IIC_SLAVE_RegisterFileSet. */
+typedef struct st_iic_slave_register_file
+{
+    uint8_t        * p_registers;      ///< Register memory read and written by the master
+    uint32_t         size;             ///< Number of registers (bytes) in p_registers
+    uint8_t          addr_bytes;       ///< Number of register address bytes preceding written data (1 or 2), MSB first
+    uint32_t const * p_write_mask;     ///< Bitmap of registers the master may write (bit n of word n/32), NULL for all
+    uint32_t const * p_notify_mask;    ///< Bitmap of registers whose write is notified by callback, NULL for none
+} iic_slave_register_file_t;
+
 /* I2C control structure. DO NOT INITIALIZE. */
 typedef struct st_iic_slave_instance_ctrl
 {
@@ -76,6 +86,15 @@ typedef struct st_iic_slave_instance_ctrl
     volatile bool start_interrupt_enabled;       // Tracks whether the start interrupt is enabled
     volatile bool transaction_completed;         // Tracks whether previous transaction restarted
 
+    /* Register-file mode information. */
+    iic_slave_register_file_t const * p_register_file; // Register file served from the ISRs, NULL if not in use
+    uint32_t      register_pointer;              // Register accessed by the next data byte
+    uint32_t      register_write_first;          // Register written by the first data byte of the current master write
+    uint32_t      register_write_start;          // Register written by the first data byte of the last notified write
+    uint32_t      register_write_bytes;          // Number of data bytes of the last notified write
+    uint8_t       register_addr_remain;          // Tracks the remaining register address bytes of a master write
+    volatile bool register_notify;               // Tracks whether a register selected for notification was written
+
     /* Pointer to callback and optional working memory */
     void (* p_callback)(i2c_slave_callback_args_t *);
     i2c_slave_callback_args_t * p_callback_memory;
@@ -107,6 +126,11 @@ extern i2c_slave_api_t const g_i2c_slave_on_iic;
 fsp_err_t R_IIC_SLAVE_Open(i2c_slave_ctrl_t * const p_api_ctrl, i2c_slave_cfg_t const * const p_cfg);
 fsp_err_t R_IIC_SLAVE_Read(i2c_slave_ctrl_t * const p_api_ctrl, uint8_t * const p_dest, uint32_t const bytes);
 fsp_err_t R_IIC_SLAVE_Write(i2c_slave_ctrl_t * const p_api_ctrl, uint8_t * const p_src, uint32_t const bytes);
+fsp_err_t R_IIC_SLAVE_RegisterFileSet(i2c_slave_ctrl_t * const                p_api_ctrl,
+                                      iic_slave_register_file_t const * const p_register_file);
+fsp_err_t R_IIC_SLAVE_RegisterFileWriteGet(i2c_slave_ctrl_t * const p_api_ctrl,
+                                           uint32_t * const         p_start,
+                                           uint32_t * const         p_bytes);
 fsp_err_t R_IIC_SLAVE_Close(i2c_slave_ctrl_t * const p_api_ctrl);
 fsp_err_t R_IIC_SLAVE_VersionGet(fsp_version_t * const p_version);
 fsp_err_t R_IIC_SLAVE_CallbackSet(i2c_slave_ctrl_t * const          p_api_ctrl,
@@ -36,6 +36,8 @@ FSP_HEADER
 
 #include "r_ioport_api.h"
 #include "r_ioport_cfg.h"
+#include "r_transfer_api.h"
+#include "r_timer_api.h"
 
 /***********************************************************************************************************************
  * Macro definitions
@@ -43,15 +45,46 @@ FSP_HEADER
 #define IOPORT_CODE_VERSION_MAJOR    (1U)
 #define IOPORT_CODE_VERSION_MINOR    (1U)
 
+/** PCNTR3 value that drives the pins set in mask to the levels in value and leaves the other pins of the port
+ *  unchanged. Use it to build the output words of @ref R_IOPORT_PortStreamStart. */
+#define IOPORT_PCNTR3_WORD(value, mask)                              \
+    ((((~(uint32_t) (value)) & (uint32_t) (mask) & 0xFFFFU) << 16U) | \
+     ((uint32_t) (value) & (uint32_t) (mask) & 0xFFFFU))
+
+/** Port control registers of the port of a bsp_io_port_t or bsp_io_port_pin_t value. */
+#define IOPORT_PORT_REGS(port)    (R_PORT0 + (((uint32_t) (port) >> 8U) & 0xFFU) * (uint32_t) (R_PORT1 - R_PORT0))
+
+/** Fast access macros for bit-banged buses. They compile to a single register access and do not check their
+ *  arguments. Writes use PCNTR3, so they are atomic with respect to other pins of the port. */
+#define R_IOPORT_PORT_WRITE_FAST(port, value, mask)    (IOPORT_PORT_REGS(port)->PCNTR3 = \
+                                                            IOPORT_PCNTR3_WORD(value, mask))
+#define R_IOPORT_PORT_READ_FAST(port)                  ((ioport_size_t) (IOPORT_PORT_REGS(port)->PCNTR2 & 0xFFFFU))
+#define R_IOPORT_PIN_SET_FAST(pin)                     (IOPORT_PORT_REGS(pin)->PCNTR3 = \
+                                                            1UL << ((uint32_t) (pin) & 0xFU))
+#define R_IOPORT_PIN_CLEAR_FAST(pin)                   (IOPORT_PORT_REGS(pin)->PCNTR3 = \
+                                                            1UL << (((uint32_t) (pin) & 0xFU) + 16U))
+
 /***********************************************************************************************************************
  * Typedef definitions
  **********************************************************************************************************************/
 
+/** Port output streaming configuration, passed to R_IOPORT_PortStreamStart. */
+typedef struct st_ioport_stream_cfg
+{
+    bsp_io_port_t port;                ///< Port the words are written to
+
+    /** DTC or DMAC instance activated by the pacing timer (for example by its overflow event). transfer_cfg_t::p_info
+     *  is overwritten each time a stream starts. The transfer callback, if any, is called when the stream ends. */
+    transfer_instance_t const * p_transfer;
+    timer_instance_t const    * p_timer; ///< Timer whose period sets the time between words
+} ioport_stream_cfg_t;
+
 /** IOPORT private control block. DO NOT MODIFY. Initialization occurs when R_IOPORT_Open() is called. */
 typedef struct st_ioport_instance_ctrl
 {
     uint32_t     open;
     void const * p_context;
+    ioport_stream_cfg_t const * p_stream_cfg; // Output stream in progress, NULL when not streaming
 } ioport_instance_ctrl_t;
 
 /* This typedef is here temporarily. See SWFLEX-144 for details. */
@@ -300,6 +333,30 @@ fsp_err_t R_IOPORT_EthernetModeCfg(ioport_ctrl_t * const     p_ctrl,
                                    ioport_ethernet_channel_t channel,
                                    ioport_ethernet_mode_t    mode);
 fsp_err_t R_IOPORT_VersionGet(fsp_version_t * p_data);
+fsp_err_t R_IOPORT_PortStreamStart(ioport_ctrl_t * const             p_ctrl,
+                                   ioport_stream_cfg_t const * const p_stream_cfg,
+                                   uint32_t const * const            p_words,
+                                   uint32_t                          count);
+fsp_err_t R_IOPORT_PortStreamStop(ioport_ctrl_t * const p_ctrl);
+
+/*******************************************************************************************************************//**
+ * Sets the output level of a pin without parameter checking. Fast path variant of R_IOPORT_PinWrite() for bit-banged
+ * protocols and interrupt handlers.
+ *
+ * The pin must already be configured as an output. Like R_IOPORT_PinWrite(), the level is written through the atomic
+ * PCNTR3 set/reset register, so other pins on the port are not affected.
+ *
+ * @param[in]  pin             The pin
+ * @param[in]  level           The level, BSP_IO_LEVEL_LOW or BSP_IO_LEVEL_HIGH
+ **********************************************************************************************************************/
+__STATIC_INLINE void R_IOPORT_PinWriteFast (bsp_io_port_pin_t pin, bsp_io_level_t level)
+{
+    R_PORT0_Type * p_ioport_regs = R_PORT0 + ((uint32_t) (R_PORT1 - R_PORT0) * ((uint32_t) pin >> 8U));
+    uint32_t       pin_mask      = 1U << ((uint32_t) pin & 0xFFU);
+
+    /* PCNTR3 register: lower word = set data, upper word = reset_data */
+    p_ioport_regs->PCNTR3 = (BSP_IO_LEVEL_LOW == level) ? (pin_mask << 16U) : pin_mask;
+}
 
 /*******************************************************************************************************************//**
  * @} (end defgroup IOPORT)
@@ -72,6 +72,9 @@ typedef struct st_jpeg_instance_ctrl
     uint16_t lines_to_encode;                     ///< Number of lines to encode
     uint16_t vertical_resolution;                 ///< vertical size
     uint16_t total_lines_encoded;                 ///< Number of lines encoded
+ #if JPEG_CFG_ENCODE_STREAM_ENABLE
+    uint32_t stream_offset;                       ///< Compressed data already reported to the encode callback
+ #endif
 #endif
 } jpeg_instance_ctrl_t;
 
@@ -39,7 +39,7 @@ FSP_HEADER
  * Macro definitions
  **********************************************************************************************************************/
 #define KINT_CODE_VERSION_MAJOR    (1U)
-#define KINT_CODE_VERSION_MINOR    (0U)
+#define KINT_CODE_VERSION_MINOR    (1U)
 
 /***********************************************************************************************************************
  * Typedef definitions
@@ -50,6 +50,10 @@ typedef struct st_kint_instance_ctrl
 {
     uint32_t                open;
     keymatrix_cfg_t const * p_cfg;
+
+    void (* p_callback)(keymatrix_callback_args_t *); // Pointer to callback
+    keymatrix_callback_args_t * p_callback_memory;    // Pointer to optional callback argument memory
+    void const                * p_context;            // Pointer to context to be passed into callback function
 } kint_instance_ctrl_t;
 
 /**********************************************************************************************************************
@@ -68,6 +72,10 @@ extern const keymatrix_api_t g_keymatrix_on_kint;
 fsp_err_t R_KINT_Open(keymatrix_ctrl_t * const p_api_ctrl, keymatrix_cfg_t const * const p_cfg);
 fsp_err_t R_KINT_Enable(keymatrix_ctrl_t * const p_api_ctrl);
 fsp_err_t R_KINT_Disable(keymatrix_ctrl_t * const p_api_ctrl);
+fsp_err_t R_KINT_CallbackSet(keymatrix_ctrl_t * const          p_api_ctrl,
+                             void (                         * p_callback)(keymatrix_callback_args_t *),
+                             void const * const               p_context,
+                             keymatrix_callback_args_t * const p_callback_memory);
 fsp_err_t R_KINT_Close(keymatrix_ctrl_t * const p_api_ctrl);
 fsp_err_t R_KINT_VersionGet(fsp_version_t * const p_version);
 
@@ -32,6 +32,7 @@
 #include "bsp_api.h"
 #include "r_lpm_cfg.h"
 #include "r_lpm_api.h"
+#include "r_timer_api.h"
 
 /***********************************************************************************************************************
  * Macro definitions
@@ -39,15 +40,90 @@
 #define LPM_CODE_VERSION_MAJOR    (1U)
 #define LPM_CODE_VERSION_MINOR    (1U)
 
+#ifndef LPM_CFG_PROFILE_ENABLE
+ #define LPM_CFG_PROFILE_ENABLE    (0)
+#endif
+
+#ifndef LPM_CFG_FAST_RESUME_ENABLE
+ #define LPM_CFG_FAST_RESUME_ENABLE    (0)
+#endif
+
+/** Number of low power modes profiled, one per lpm_mode_t. */
+#define LPM_PROFILE_MODE_COUNT     (4U)
+
+/** Use as lpm_profile_cfg_t::marker_pin when no marker pin is driven. */
+#define LPM_PROFILE_MARKER_NONE    ((bsp_io_port_pin_t) UINT16_MAX)
+
 /***********************************************************************************************************************
  * Typedef definitions
  **********************************************************************************************************************/
 
+/** Profiling statistics of one low power mode. Cycle counts are only measured on MCUs with BSP_FEATURE_DWT_CYCCNT. */
+typedef struct st_lpm_profile_mode
+{
+    uint32_t entries;                  ///< Number of times the mode was entered
+    uint64_t residency_counts;         ///< Time spent in the mode, in timebase counts
+    uint32_t entry_cycles_max;         ///< Longest time from R_LPM_LowPowerModeEnter() to WFI, in CPU cycles
+    uint32_t exit_cycles_max;          ///< Longest time from the wake-up to the end of the mode restore, in CPU cycles
+    uint32_t transition_cycles_max;    ///< Longest wait for an operating power mode transition (OPCMTSF, SOPCMTSF)
+} lpm_profile_mode_t;
+
+/** Profiling results, updated by R_LPM_LowPowerModeEnter() while profiling is started. */
+typedef struct st_lpm_profile
+{
+    uint32_t           timebase_hz;                        ///< Count frequency of the timebase
+    uint64_t           run_counts;                         ///< Time spent out of low power modes, in timebase counts
+    lpm_profile_mode_t mode[LPM_PROFILE_MODE_COUNT];       ///< Statistics of each lpm_mode_t
+    uint32_t           wake_irq[BSP_ICU_VECTOR_MAX_ENTRIES]; ///< Wake-ups per IRQ, the IELSR of the IRQ names the event
+    uint32_t           wake_other;                         ///< Wake-ups by an exception or an interrupt already cleared
+} lpm_profile_t;
+
+/** Profiling configuration, used in R_LPM_ProfileStart(). */
+typedef struct st_lpm_profile_cfg
+{
+    /** Opened and started periodic timer used as timebase. It must keep counting in Software Standby mode, e.g. an AGT
+     * counting LOCO or the sub-clock, and its period must be longer than the longest time spent in a low power mode. */
+    timer_instance_t const * p_timer;
+
+    /** Output pin driven high from just before WFI until the wake-up, to align the results with a current measurement,
+     * or LPM_PROFILE_MARKER_NONE. The pin must be configured as an output. */
+    bsp_io_port_pin_t marker_pin;
+} lpm_profile_cfg_t;
+
+/** Fast resume statistics, updated by R_LPM_LowPowerModeEnter() in Software Standby mode when
+ * LPM_CFG_FAST_RESUME_ENABLE is set. Cycle counts are only measured on MCUs with BSP_FEATURE_DWT_CYCCNT. */
+typedef struct st_lpm_fast_resume_stats
+{
+    uint32_t resumes;                  ///< Wake-ups resumed on HOCO or MOCO while the PLL restarted
+    uint32_t skipped;                  ///< Entries where the PLL was not the system clock or no HOCO/MOCO was running
+    uint32_t lock_cycles_last;         ///< CPU cycles from the wake-up to the switch back to the PLL, last resume
+    uint32_t lock_cycles_max;          ///< Longest time from the wake-up to the switch back to the PLL, in CPU cycles
+} lpm_fast_resume_stats_t;
+
 /** LPM private control block. DO NOT MODIFY. Initialization occurs when R_LPM_Open() is called. */
 typedef struct st_lpm_instance_ctrl
 {
     uint32_t          lpm_open;        // Indicates whether the open() API has been successfully called.
     lpm_cfg_t const * p_cfg;           // Pointer to initial configurations
+#if LPM_CFG_PROFILE_ENABLE
+    lpm_profile_cfg_t const * p_profile_cfg;    // Profiling configuration, NULL while profiling is stopped
+    lpm_profile_t           * p_profile;        // Profiling results
+    uint32_t                  profile_period;   // Timebase period in counts
+    uint32_t                  profile_count;    // Timebase count when time was last accounted
+    bool                      profile_count_up; // The timebase counts up
+    bool                      profile_entered;  // WFI was executed by the current R_LPM_LowPowerModeEnter() call
+    uint32_t                  profile_primask;  // PRIMASK of the caller, restored after the wake-up
+    uint32_t                  profile_cycles;   // Cycle count at the start of the current entry or exit
+#endif
+#if LPM_CFG_FAST_RESUME_ENABLE
+    lpm_fast_resume_stats_t fast_resume_stats;    // Fast resume statistics
+    bool                    fast_resume_active;   // The system clock was moved off the PLL for the current entry
+    bool                    fast_resume_mosc;     // The main oscillator was stopped for the current entry
+    uint8_t                 fast_resume_sckscr;   // System clock source cached before the entry
+    uint32_t                fast_resume_sckdivcr; // System clock dividers cached before the entry
+    uint32_t                fast_resume_primask;  // PRIMASK before WFI, restored once the PLL restart is requested
+    uint32_t                fast_resume_cycles;   // Cycle count at the wake-up
+#endif
 } lpm_instance_ctrl_t;
 
 /**********************************************************************************************************************
@@ -66,6 +142,12 @@ fsp_err_t R_LPM_LowPowerReconfigure(lpm_ctrl_t * const p_api_ctrl, lpm_cfg_t con
 fsp_err_t R_LPM_LowPowerModeEnter(lpm_ctrl_t * const p_api_ctrl);
 fsp_err_t R_LPM_VersionGet(fsp_version_t * const p_version);
 fsp_err_t R_LPM_IoKeepClear(lpm_ctrl_t * const p_api_ctrl);
+fsp_err_t R_LPM_ProfileStart(lpm_ctrl_t * const              p_api_ctrl,
+                             lpm_profile_cfg_t const * const p_profile_cfg,
+                             lpm_profile_t * const           p_profile);
+fsp_err_t R_LPM_ProfileGet(lpm_ctrl_t * const p_api_ctrl, lpm_profile_t * const p_snapshot);
+fsp_err_t R_LPM_ProfileStop(lpm_ctrl_t * const p_api_ctrl);
+fsp_err_t R_LPM_FastResumeStatsGet(lpm_ctrl_t * const p_api_ctrl, lpm_fast_resume_stats_t * const p_stats);
 
 #endif
 
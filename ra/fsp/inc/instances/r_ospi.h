@@ -33,6 +33,10 @@
 #include "r_ospi_cfg.h"
 #include "r_spi_flash_api.h"
 
+#ifndef OSPI_CFG_SFDP_SUPPORT_ENABLE
+ #define OSPI_CFG_SFDP_SUPPORT_ENABLE    (0)
+#endif
+
 /* Common macro for FSP header files. There is also a corresponding FSP_FOOTER macro at the end of this file. */
 FSP_HEADER
 
@@ -101,6 +105,16 @@ typedef struct st_ospi_timing_setting
     ospi_command_cs_pulldown_clocks_t cs_pulldown_lead;            ///< Duration to assert CS line before the first command
 } ospi_timing_setting_t;
 
+/** Settings R_OSPI_Open() reads from the Serial Flash Discoverable Parameters (JESD216) of the device. */
+typedef enum e_ospi_sfdp
+{
+    OSPI_SFDP_DISABLED,                ///< Use spi_flash_cfg_t and ospi_extended_cfg_t as configured
+
+    /** Read the memory size from SFDP. If the device has an xSPI Profile 1.0 table, also read the DOPI read command,
+     * its dummy cycles and the command extension used for the OPI commands. */
+    OSPI_SFDP_ENABLED,
+} ospi_sfdp_t;
+
 /* This command set is used only with OPI mode set under ospi_extended_cfg_t. spi_flash_cfg_t holds commands for SPI mode. */
 typedef struct st_ospi_opi_command_set
 {
@@ -126,6 +140,8 @@ typedef struct st_ospi_extended_cfg
     ospi_opi_command_set_t const * p_opi_commands;                          ///< If OPI commands are not used set this to NULL
     uint8_t                        opi_mem_read_dummy_cycles;               ///< Dummy cycles to be inserted for memory mapped reads
     uint8_t                      * p_autocalibration_preamble_pattern_addr; ///< OctaFlash memory address holding the preamble pattern
+    uint32_t                     * p_write_combine_buffer;                  ///< Page sized (256 byte) buffer for R_OSPI_WriteCombine(). Set to NULL if not used.
+    ospi_sfdp_t                    sfdp;                                    ///< Replace settings with the ones read from SFDP. Requires OSPI_CFG_SFDP_SUPPORT_ENABLE and SPI_FLASH_PROTOCOL_EXTENDED_SPI.
 } ospi_extended_cfg_t;
 
 /** Instance control block. DO NOT INITIALIZE.  Initialization occurs when @ref spi_flash_api_t::open is called */
@@ -135,6 +151,14 @@ typedef struct st_ospi_instance_ctrl
     ospi_device_number_t    channel;      // Device number to be used for memory device
     spi_flash_protocol_t    spi_protocol; // Current SPI protocol selected
     uint32_t                open;         // Whether or not driver is open
+    uint8_t               * p_wc_page;    // Device address of the page being combined, NULL if none
+    uint32_t                wc_start;     // Offset of the first byte combined into the page
+    uint32_t                wc_end;       // Offset after the last byte combined into the page
+#if OSPI_CFG_SFDP_SUPPORT_ENABLE
+    spi_flash_cfg_t         sfdp_cfg;          // Settings read from SFDP
+    ospi_extended_cfg_t     sfdp_cfg_extend;   // Extended settings read from SFDP
+    ospi_opi_command_set_t  sfdp_opi_commands; // OPI commands read from SFDP
+#endif
 } ospi_instance_ctrl_t;
 
 /**********************************************************************************************************************
@@ -168,6 +192,13 @@ fsp_err_t R_OSPI_Erase(spi_flash_ctrl_t * p_ctrl, uint8_t * const p_device_addre
 fsp_err_t R_OSPI_StatusGet(spi_flash_ctrl_t * p_ctrl, spi_flash_status_t * const p_status);
 fsp_err_t R_OSPI_BankSet(spi_flash_ctrl_t * p_ctrl, uint32_t bank);
 fsp_err_t R_OSPI_VersionGet(fsp_version_t * const p_version);
+fsp_err_t R_OSPI_WriteCombine(spi_flash_ctrl_t    * p_ctrl,
+                              uint8_t const * const p_src,
+                              uint8_t * const       p_dest,
+                              uint32_t              byte_count);
+fsp_err_t R_OSPI_WriteCombineFlush(spi_flash_ctrl_t * p_ctrl);
+fsp_err_t R_OSPI_AutoCalibrate(spi_flash_ctrl_t * p_ctrl);
+fsp_err_t R_OSPI_ConfigGet(spi_flash_ctrl_t * p_ctrl, spi_flash_cfg_t const ** const pp_cfg);
 
 /* Common macro for FSP header files. There is also a corresponding FSP_HEADER macro at the top of this file. */
 FSP_FOOTER
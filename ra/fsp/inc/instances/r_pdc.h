@@ -52,6 +52,9 @@ typedef struct st_pdc_instance_ctrl
     bool              transfer_in_progress;            // Indicates if a PDC transfer is already in progress
     void const      * p_context;                       // Placeholder for user data.  Passed to the user callback.
     void (* p_callback)(pdc_callback_args_t * p_args); // Callback provided when a PDC transfer ISR occurs.
+    transfer_info_t * p_links;                         // Chain of the current capture, NULL for a single transfer
+    uint32_t          num_links;                       // Number of links in p_links
+    uint32_t          links_done;                      // Links of the current capture already transferred
 } pdc_instance_ctrl_t;
 
 /**********************************************************************************************************************
@@ -73,6 +76,10 @@ fsp_err_t R_PDC_Close(pdc_ctrl_t * const p_api_ctrl);
 
 fsp_err_t R_PDC_CaptureStart(pdc_ctrl_t * const p_api_ctrl, uint8_t * const p_buffer);
 
+fsp_err_t R_PDC_CaptureChainStart(pdc_ctrl_t * const      p_api_ctrl,
+                                  transfer_info_t * const p_links,
+                                  uint32_t const          num_links);
+
 fsp_err_t R_PDC_VersionGet(fsp_version_t * const P_version);
 
 /* Common macro for FSP header files. There is also a corresponding FSP_HEADER macro at the top of this file. */
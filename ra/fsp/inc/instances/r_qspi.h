@@ -33,6 +33,14 @@
 #include <string.h>
 #include "r_qspi_cfg.h"
 #include "r_spi_flash_api.h"
+#include "r_transfer_api.h"
+#if QSPI_CFG_DMAC_SUPPORT_ENABLE
+ #include "r_dmac.h"
+#endif
+
+#ifndef QSPI_CFG_SFDP_SUPPORT_ENABLE
+ #define QSPI_CFG_SFDP_SUPPORT_ENABLE    (0)
+#endif
 
 /* Common macro for FSP header files. There is also a corresponding FSP_FOOTER macro at the end of this file. */
 FSP_HEADER
@@ -45,6 +53,9 @@ FSP_HEADER
 
 #define QSPI_DEVICE_START_ADDRESS    (0x60000000)
 
+/** Maximum number of erase commands read from SFDP: 4 erase types and chip erase. */
+#define QSPI_SFDP_ERASE_COMMANDS_MAX    (5U)
+
 /***********************************************************************************************************************
  * Typedef definitions
  **********************************************************************************************************************/
@@ -107,11 +118,49 @@ typedef enum e_qspi_qspclk_div
     QSPI_QSPCLK_DIV_48 = 0x1F,         ///< QSPCLK = PCLK / 48
 } qspi_qspclk_div_t;
 
+/** Settings R_QSPI_Open() reads from the Serial Flash Discoverable Parameters (JESD216) of the device. */
+typedef enum e_qspi_sfdp
+{
+    QSPI_SFDP_DISABLED,                ///< Use spi_flash_cfg_t as configured
+
+    /** Select the fastest read mode the device and the QSPI share, and read the address mode, page size and erase
+     * commands from SFDP. Quad modes are only selected if the Quad Enable bit is already set or not required. */
+    QSPI_SFDP_ENABLED,
+
+    /** Same as QSPI_SFDP_ENABLED, and set the Quad Enable bit in the non-volatile status register if required. */
+    QSPI_SFDP_ENABLED_QUAD_ENABLE,
+} qspi_sfdp_t;
+
+/** Events passed to the callback when a DMAC transfer completes. */
+typedef enum e_qspi_event
+{
+    QSPI_EVENT_READ_COMPLETE,          ///< R_QSPI_DmaRead() transfer complete
+    QSPI_EVENT_WRITE_COMPLETE,         ///< R_QSPI_DmaWrite() data sent, poll R_QSPI_StatusGet() for programming
+} qspi_event_t;
+
+/** Callback function parameter data. */
+typedef struct st_qspi_callback_args
+{
+    qspi_event_t event;                ///< Event code
+    void const * p_context;            ///< Context provided in qspi_extended_cfg_t
+} qspi_callback_args_t;
+
 /* Extended configuration. */
 typedef struct st_qspi_extended_cfg
 {
     qspi_qssl_min_high_level_t min_qssl_deselect_cycles; ///< Minimum QSSL deselect time
     qspi_qspclk_div_t          qspclk_div;               ///< QSPCLK divider
+
+    /** DMAC instance used by R_QSPI_DmaRead() and R_QSPI_DmaWrite(). Set to NULL if unused. The DMAC must use software
+     * activation (ELC_EVENT_NONE), and its callback must be qspi_dmac_callback() with the QSPI control block as
+     * context. */
+    transfer_instance_t const * p_transfer;
+    void (* p_callback)(qspi_callback_args_t * p_args);  ///< Called when a DMAC transfer completes
+    void const * p_context;                              ///< Placeholder for user data, passed to p_callback
+
+    /** Replace the settings in spi_flash_cfg_t with the ones read from SFDP. Requires QSPI_CFG_SFDP_SUPPORT_ENABLE
+     * and SPI_FLASH_PROTOCOL_EXTENDED_SPI. */
+    qspi_sfdp_t sfdp;
 } qspi_extended_cfg_t;
 
 /** Instance control block. DO NOT INITIALIZE.  Initialization occurs when @ref spi_flash_api_t::open is called */
@@ -121,6 +170,17 @@ typedef struct st_qspi_instance_ctrl
     spi_flash_data_lines_t  data_lines;       // Data lines
     uint32_t                total_size_bytes; // Total size of the flash in bytes
     uint32_t                open;             // Whether or not driver is open
+    volatile bool           dma_in_progress;  // Whether a DMAC read or page program is in progress
+    qspi_event_t            dma_event;        // Event reported when the DMAC operation completes
+    bool                    dma_restore_spi;  // Restore extended SPI mode when the DMAC page program completes
+    uint8_t const         * p_dma_src;        // Source of the next DMAC transfer
+    uint8_t               * p_dma_dest;       // Destination of the next DMAC transfer
+    uint32_t                dma_remaining;    // Bytes left for the next DMAC transfer
+    transfer_info_t         dma_info;         // Settings of the current DMAC transfer
+#if QSPI_CFG_SFDP_SUPPORT_ENABLE
+    spi_flash_cfg_t           sfdp_cfg;                                       // Settings read from SFDP
+    spi_flash_erase_command_t sfdp_erase_list[QSPI_SFDP_ERASE_COMMANDS_MAX]; // Erase commands read from SFDP
+#endif
 } qspi_instance_ctrl_t;
 
 /**********************************************************************************************************************
@@ -151,6 +211,19 @@ fsp_err_t R_QSPI_Erase(spi_flash_ctrl_t * p_ctrl, uint8_t * const p_device_addre
 fsp_err_t R_QSPI_StatusGet(spi_flash_ctrl_t * p_ctrl, spi_flash_status_t * const p_status);
 fsp_err_t R_QSPI_BankSet(spi_flash_ctrl_t * p_ctrl, uint32_t bank);
 fsp_err_t R_QSPI_VersionGet(fsp_version_t * const p_version);
+fsp_err_t R_QSPI_DmaRead(spi_flash_ctrl_t * p_ctrl, uint8_t * const p_dest, uint8_t const * const p_src,
+                         uint32_t byte_count);
+fsp_err_t R_QSPI_DmaWrite(spi_flash_ctrl_t    * p_ctrl,
+                          uint8_t const * const p_src,
+                          uint8_t * const       p_dest,
+                          uint32_t              byte_count);
+fsp_err_t R_QSPI_ConfigGet(spi_flash_ctrl_t * p_ctrl, spi_flash_cfg_t const ** const pp_cfg,
+                           uint32_t * const p_size_bytes);
+
+#if QSPI_CFG_DMAC_SUPPORT_ENABLE
+void qspi_dmac_callback(dmac_callback_args_t * p_args);
+
+#endif
 
 /* Common macro for FSP header files. There is also a corresponding FSP_HEADER macro at the top of this file. */
 FSP_FOOTER
@@ -32,6 +32,9 @@
 #include "bsp_api.h"
 #include "r_rtc_cfg.h"
 #include "r_rtc_api.h"
+#if RTC_CFG_TIMESTAMP_ENABLE
+ #include "r_timer_api.h"
+#endif
 
 /* Common macro for FSP header files. There is also a corresponding FSP_FOOTER macro at the end of this file. */
 FSP_HEADER
@@ -45,10 +48,36 @@ FSP_HEADER
 /* Counting mode */
 #define RTC_CALENDAR_MODE         (0)
 
+/* When set to 1 @ref R_RTC_TimestampGet returns the calendar time as microseconds since 1970-01-01 00:00:00 without
+ * reading the calendar registers. The calendar is sampled once per second by the carry interrupt, which is kept
+ * enabled while the driver is open. Sub-second resolution comes from the optional timer in rtc_extended_cfg_t. */
+#ifndef RTC_CFG_TIMESTAMP_ENABLE
+ #define RTC_CFG_TIMESTAMP_ENABLE    (0)
+#endif
+
 /***********************************************************************************************************************
  * Typedef definitions
  **********************************************************************************************************************/
 
+#if RTC_CFG_TIMESTAMP_ENABLE
+
+/** Extended configuration, set rtc_cfg_t::p_extend to this structure or to NULL. */
+typedef struct st_rtc_extended_cfg
+{
+    /** Open and started timer that provides the sub-second part of @ref R_RTC_TimestampGet, or NULL for a resolution
+     * of one second. The timer must run in periodic mode with a period longer than one second, e.g. a GPT channel
+     * counting PCLKD or an AGT channel counting the sub-clock. */
+    timer_instance_t const * p_timestamp_timer;
+} rtc_extended_cfg_t;
+
+/* Calendar sample taken at a carry interrupt. */
+typedef struct st_rtc_timestamp_sample
+{
+    uint32_t seconds;                  // Seconds since 1970-01-01 00:00:00
+    uint32_t counter;                  // Timer counter when the seconds were sampled
+} rtc_timestamp_sample_t;
+#endif
+
 /** Channel control block. DO NOT INITIALIZE.  Initialization occurs when @ref rtc_api_t::open is called */
 typedef struct st_rtc_ctrl
 {
@@ -60,6 +89,19 @@ typedef struct st_rtc_ctrl
     rtc_callback_args_t * p_callback_memory;    // Pointer to non-secure memory that can be used to pass arguments to a callback in non-secure memory.
 
     void const * p_context;                     // Pointer to context to be passed into callback function
+
+#if RTC_CFG_TIMESTAMP_ENABLE
+
+    /* The carry interrupt writes the sample not being read and then increments the sequence, so readers never wait. */
+    volatile uint32_t               timestamp_sequence; // Samples taken, bit 0 indexes the current one
+    rtc_timestamp_sample_t volatile timestamp_sample[2];
+    timer_instance_t const        * p_timer;            // Sub-second timer, NULL if not used
+    timer_direction_t               timer_direction;    // Count direction of the sub-second timer
+    uint32_t                        timer_period;       // Period of the sub-second timer in counts
+    uint32_t                        timer_frequency;    // Counts per second of the sub-second timer
+    uint32_t                        timer_scale;        // Microseconds per count, scaled by 2^timer_shift
+    uint32_t                        timer_shift;
+#endif
 } rtc_instance_ctrl_t;
 
 /**********************************************************************************************************************
@@ -79,6 +121,7 @@ fsp_err_t R_RTC_Open(rtc_ctrl_t * const p_ctrl, rtc_cfg_t const * const p_cfg);
 fsp_err_t R_RTC_Close(rtc_ctrl_t * const p_ctrl);
 fsp_err_t R_RTC_CalendarTimeSet(rtc_ctrl_t * const p_ctrl, rtc_time_t * const p_time);
 fsp_err_t R_RTC_CalendarTimeGet(rtc_ctrl_t * const p_ctrl, rtc_time_t * const p_time);
+fsp_err_t R_RTC_TimestampGet(rtc_ctrl_t * const p_ctrl, uint64_t * const p_timestamp);
 fsp_err_t R_RTC_CalendarAlarmSet(rtc_ctrl_t * const p_ctrl, rtc_alarm_time_t * const p_alarm);
 fsp_err_t R_RTC_CalendarAlarmGet(rtc_ctrl_t * const p_ctrl, rtc_alarm_time_t * const p_alarm);
 fsp_err_t R_RTC_PeriodicIrqRateSet(rtc_ctrl_t * const p_ctrl, rtc_periodic_irq_select_t const rate);
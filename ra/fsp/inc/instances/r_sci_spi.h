@@ -58,6 +58,26 @@ typedef struct st_sci_spi_extended_cfg
     sci_spi_div_setting_t clk_div;
 } sci_spi_extended_cfg_t;
 
+/** Periodic frame stream settings. See @ref R_SCI_SPI_FrameStreamStart. */
+typedef struct st_sci_spi_frame_stream_cfg
+{
+    /** Transfer instance activated by the period timer event, e.g. a GPT overflow interrupt. It must be opened by the
+     *  application and is reconfigured by the driver while the stream is running. */
+    transfer_instance_t const * p_transfer_trigger;
+    uint8_t const             * p_tx_frame;  ///< Bytes sent in each frame, NULL to send 0x00. Must persist while running.
+    uint32_t                    frame_bytes; ///< Number of bytes in each frame (2 or more)
+    uint8_t                   * p_ring;      ///< Circular buffer receiving the frames
+    uint32_t                    num_frames;  ///< Number of frames in p_ring
+} sci_spi_frame_stream_cfg_t;
+
+/** Status of the circular receive buffer used by the frame stream. */
+typedef struct st_sci_spi_frame_stream_info
+{
+    uint32_t head;                     ///< Offset where the next received byte will be written
+    uint32_t tail;                     ///< Offset of the first byte of the next unread frame
+    uint32_t frames_available;         ///< Number of complete frames that have not been consumed
+} sci_spi_frame_stream_info_t;
+
 /** SPI instance control block. DO NOT INITIALIZE. */
 typedef struct st_sci_spi_instance_ctrl
 {
@@ -70,6 +90,15 @@ typedef struct st_sci_spi_instance_ctrl
     uint32_t          rx_count;
     uint32_t          count;
 
+    /* Periodic frame stream information. */
+    sci_spi_frame_stream_cfg_t const * p_stream; // Frame stream in progress, NULL if none
+    uint32_t        stream_tail;                 // Offset of the next unread frame in the ring
+    transfer_info_t stream_trigger[2];           // Run on the trigger event: enable the TXI, send the first byte
+    transfer_info_t stream_tx[2];                // Run on TXI: send the rest of the frame, then disable the TXI
+    transfer_info_t stream_rx;                   // Run on RXI: store received bytes in the ring
+    uint8_t         stream_scr_run;              // SCR setting used while a frame is transmitted
+    uint8_t         stream_scr_idle;             // SCR setting used between frames
+
     /* Pointer to callback and optional working memory */
     void (* p_callback)(spi_callback_args_t *);
     spi_callback_args_t * p_callback_memory;
@@ -112,6 +141,10 @@ fsp_err_t R_SCI_SPI_CallbackSet(spi_ctrl_t * const          p_api_ctrl,
                                 void (                    * p_callback)(spi_callback_args_t *),
                                 void const * const          p_context,
                                 spi_callback_args_t * const p_callback_memory);
+fsp_err_t R_SCI_SPI_FrameStreamStart(spi_ctrl_t * const p_api_ctrl, sci_spi_frame_stream_cfg_t const * const p_stream);
+fsp_err_t R_SCI_SPI_FrameStreamInfoGet(spi_ctrl_t * const p_api_ctrl, sci_spi_frame_stream_info_t * const p_info);
+fsp_err_t R_SCI_SPI_FrameStreamConsume(spi_ctrl_t * const p_api_ctrl, uint32_t const frames);
+fsp_err_t R_SCI_SPI_FrameStreamStop(spi_ctrl_t * const p_api_ctrl);
 
 /* Common macro for FSP header files. There is also a corresponding FSP_HEADER macro at the top of this file. */
 FSP_FOOTER
@@ -31,6 +31,7 @@
  **********************************************************************************************************************/
 #include "bsp_api.h"
 #include "r_uart_api.h"
+#include "r_timer_api.h"
 #include "r_sci_uart_cfg.h"
 
 /* Common macro for FSP header files. There is also a corresponding FSP_FOOTER macro at the end of this file. */
@@ -71,6 +72,7 @@ typedef struct st_sci_uart_instance_ctrl
     uint8_t  rx_transfer_in_progress;  // Set to 1 if a receive transfer is in progress, 0 otherwise
     uint8_t  data_bytes         : 2;   // 1 byte for 7 or 8 bit data, 2 bytes for 9 bit data
     uint8_t  bitrate_modulation : 1;   // 1 if bit rate modulation is enabled, 0 otherwise
+    uint8_t  rx_transfer_restore : 1;  // 1 if the receive transfer must be reconfigured after ring buffer mode
     uint32_t open;                     // Used to determine if the channel is configured
 
     bsp_io_port_pin_t flow_pin;
@@ -87,6 +89,18 @@ typedef struct st_sci_uart_instance_ctrl
     /* Size of destination buffer pointer used for receiving data. */
     uint32_t rx_dest_bytes;
 
+    /* Circular buffer written by the receive transfer instance in ring buffer mode. */
+    uint8_t const * p_rx_ring;
+
+    /* Size of the circular receive buffer, 0 if ring buffer mode is not active. */
+    uint32_t rx_ring_bytes;
+
+    /* Offset of the next unread byte in the circular receive buffer. */
+    uint32_t rx_ring_tail;
+
+    /* Write offset reported by the previous call to R_SCI_UART_RingBufferInfoGet, used to detect an idle line. */
+    uint32_t rx_ring_head_last;
+
     /* Pointer to the configuration block. */
     uart_cfg_t const * p_cfg;
 
@@ -151,6 +165,25 @@ typedef struct st_baud_setting_t
     uint8_t mddr;                      ///< Modulation Duty Register setting
 } baud_setting_t;
 
+/** Status of the circular receive buffer used in ring buffer mode. */
+typedef struct st_sci_uart_ring_buffer_info
+{
+    uint32_t head;                     ///< Offset where the next received byte will be written
+    uint32_t tail;                     ///< Offset of the next unread byte
+    uint32_t bytes_available;          ///< Number of received bytes that have not been consumed
+    bool     idle;                     ///< True if no data was received since the previous status query
+} sci_uart_ring_buffer_info_t;
+
+/** RS-485 driver enable timing generated by a timer. Requires SCI_UART_CFG_RS485_DE_TIMER_SUPPORT. */
+typedef struct st_sci_uart_rs485_de_cfg
+{
+    /** GPT instance in one-shot mode whose GTIOCA pin is the driver enable signal. The stop level must be low and the
+     * start source must be the ELC event linked to the SCIn_TEI event of this channel. */
+    timer_instance_t const * p_timer;
+    uint32_t                 assertion_time_ns;   ///< Minimum time from driver enable assertion to the start bit
+    uint32_t                 deassertion_time_ns; ///< Time from the end of the last stop bit to driver enable release
+} sci_uart_rs485_de_cfg_t;
+
 /** UART on SCI device Configuration */
 typedef struct st_sci_uart_extended_cfg
 {
@@ -165,6 +198,10 @@ typedef struct st_sci_uart_extended_cfg
     uart_mode_t              uart_mode;          ///< UART communication mode selection
     bsp_io_port_pin_t        flow_control_pin;   ///< UART Driver Enable pin
     sci_uart_ctsrts_config_t ctsrts_en;          ///< CTS/RTS function of the SSn pin
+
+    /** Timer driven RS-485 driver enable, used instead of flow_control_pin in UART_MODE_RS485_HD. NULL to drive
+     * flow_control_pin from software. */
+    sci_uart_rs485_de_cfg_t const * p_rs485_de;
 } sci_uart_extended_cfg_t;
 
 /**********************************************************************************************************************
@@ -193,6 +230,10 @@ fsp_err_t R_SCI_UART_CallbackSet(uart_ctrl_t * const          p_api_ctrl,
                                  void (                     * p_callback)(uart_callback_args_t *),
                                  void const * const           p_context,
                                  uart_callback_args_t * const p_callback_memory);
+fsp_err_t R_SCI_UART_RingBufferStart(uart_ctrl_t * const p_api_ctrl, uint8_t * const p_buffer, uint32_t const bytes);
+fsp_err_t R_SCI_UART_RingBufferInfoGet(uart_ctrl_t * const p_api_ctrl, sci_uart_ring_buffer_info_t * const p_info);
+fsp_err_t R_SCI_UART_RingBufferConsume(uart_ctrl_t * const p_api_ctrl, uint32_t const bytes);
+fsp_err_t R_SCI_UART_RingBufferStop(uart_ctrl_t * const p_api_ctrl);
 
 /*******************************************************************************************************************//**
  * @} (end addtogroup SCI_UART)
@@ -45,6 +45,12 @@ FSP_HEADER
 
 #define SDADC_MAX_NUM_CHANNELS      (5U)
 
+/** Maximum number of FIR post-filter taps in buffer mode. */
+#define SDADC_FILTER_TAPS_MAX       (16U)
+
+/** Channel of a raw buffer mode result (sdadc_buffer_callback_args_t::p_raw). */
+#define SDADC_BUFFER_CHANNEL(raw)    ((adc_channel_t) ((((uint32_t) (raw)) >> 25) - 1U))
+
 /***********************************************************************************************************************
  * Typedef definitions
  **********************************************************************************************************************/
@@ -189,6 +195,57 @@ typedef struct st_sdadc_scan_cfg
     uint32_t scan_mask;                ///< Channels/bits: bit 0 is ch0; bit 15 is ch15.
 } sdadc_scan_cfg_t;
 
+/** Post-filter applied to each channel in buffer mode. */
+typedef enum e_sdadc_filter
+{
+    SDADC_FILTER_NONE = 0,             ///< No post-filter
+    SDADC_FILTER_FIR  = 1,             ///< FIR filter, Q15 coefficients
+    SDADC_FILTER_IIR  = 2,             ///< Biquad IIR filter (direct form I), Q14 coefficients b0, b1, b2, a1, a2
+} sdadc_filter_t;
+
+/** Post-filter configuration. */
+typedef struct st_sdadc_filter_cfg
+{
+    sdadc_filter_t  type;              ///< Filter type
+    uint8_t         num_taps;          ///< FIR taps, 1 to SDADC_FILTER_TAPS_MAX (FIR only)
+    int16_t const * p_coefficients;    ///< FIR: num_taps coefficients, IIR: b0, b1, b2, a1, a2 (a0 = 1)
+} sdadc_filter_cfg_t;
+
+/** Post-filter state of one channel. DO NOT INITIALIZE. */
+typedef struct st_sdadc_filter_state
+{
+    int32_t  history[SDADC_FILTER_TAPS_MAX]; // FIR delay line, or x1, x2, y1, y2 for the IIR filter
+    uint32_t index;                          // Position of the newest FIR input
+} sdadc_filter_state_t;
+
+/** Buffer mode callback arguments. */
+typedef struct st_sdadc_buffer_callback_args
+{
+    uint32_t const * p_raw;            ///< Raw results in conversion order, see SDADC_BUFFER_CHANNEL
+    int32_t const  * p_data;           ///< Sign-extended, scaled and filtered results, same order as p_raw
+    uint32_t         num_samples;      ///< Number of results
+    void const     * p_context;        ///< Placeholder for user data
+} sdadc_buffer_callback_args_t;
+
+/** Buffer mode configuration, passed to R_SDADC_BufferStart. Results are sign-extended for differential channels,
+ * then scaled as ((result - offset) * scale) >> 16, then filtered. */
+typedef struct st_sdadc_buffer_cfg
+{
+    /** DTC (or DMAC) instance activated by ELC_EVENT_SDADC0_ADI. With DTC the conversion end interrupt runs once per
+     * buffer half. With DMAC the transfer end callback must call R_SDADC_BufferTransferEnd. */
+    transfer_instance_t const * p_transfer;
+    uint32_t                  * p_buffer;       ///< Raw results, 2 x num_samples
+    int32_t                   * p_data;         ///< Processed results, num_samples
+    uint16_t                    num_samples;    ///< Results per buffer half
+    int32_t const             * p_offset;       ///< Per channel offset, NULL for none
+    int32_t const             * p_scale;        ///< Per channel Q16 scale, NULL for none
+    sdadc_filter_cfg_t const  * p_filter;       ///< Post-filter, NULL for none
+    sdadc_filter_state_t      * p_filter_state; ///< SDADC_MAX_NUM_CHANNELS filter states (filter only)
+
+    void (* p_callback)(sdadc_buffer_callback_args_t * p_args); ///< Called when a buffer half is processed
+    void const * p_context;                                      ///< Placeholder for user data
+} sdadc_buffer_cfg_t;
+
 /** SDADC configuration extension. This extension is required and must be provided in adc_cfg_t::p_extend. */
 typedef struct st_sdadc_on_adc_cfg
 {
@@ -215,6 +272,10 @@ typedef struct
         uint16_t results_16[SDADC_MAX_NUM_CHANNELS];
         uint32_t results_32[SDADC_MAX_NUM_CHANNELS];
     } results;
+    sdadc_buffer_cfg_t const * p_buffer_cfg; // Buffer mode configuration, NULL when not in buffer mode
+    transfer_info_t            buffer_info;  // Transfer of the conversion results
+    uint32_t                   buffer_half;  // Buffer half being filled
+    uint32_t                   signed_mask;  // Channels with differential (signed) results
 } sdadc_instance_ctrl_t;
 
 /**********************************************************************************************************************
@@ -242,6 +303,9 @@ fsp_err_t R_SDADC_OffsetSet(adc_ctrl_t * const p_ctrl, adc_channel_t const reg_i
 fsp_err_t R_SDADC_Calibrate(adc_ctrl_t * const p_ctrl, void * const p_extend);
 fsp_err_t R_SDADC_Close(adc_ctrl_t * p_ctrl);
 fsp_err_t R_SDADC_VersionGet(fsp_version_t * const p_version);
+fsp_err_t R_SDADC_BufferStart(adc_ctrl_t * p_ctrl, sdadc_buffer_cfg_t const * const p_buffer_cfg);
+fsp_err_t R_SDADC_BufferStop(adc_ctrl_t * p_ctrl);
+fsp_err_t R_SDADC_BufferTransferEnd(adc_ctrl_t * p_ctrl);
 
 /*******************************************************************************************************************//**
  * @} (end defgroup ADC)
@@ -28,6 +28,14 @@
 #include "r_sdhi_cfg.h"
 #include "r_sdmmc_api.h"
 
+#ifndef SDHI_CFG_EMMC_CACHE_ENABLE
+ #define SDHI_CFG_EMMC_CACHE_ENABLE    (0)
+#endif
+
+#ifndef SDHI_CFG_SDIO_INT_ACKNOWLEDGE_ENABLE
+ #define SDHI_CFG_SDIO_INT_ACKNOWLEDGE_ENABLE    (0)
+#endif
+
 /* Common macro for FSP header files. There is also a corresponding FSP_FOOTER macro at the end of this file. */
 FSP_HEADER
 
@@ -86,6 +94,49 @@ typedef union
     } bit;
 } sdhi_event_t;
 
+/** Operation requested with R_SDHI_RequestSubmit() */
+typedef enum e_sdhi_request_op
+{
+    SDHI_REQUEST_OP_READ,              ///< Read sectors into the segment buffers
+    SDHI_REQUEST_OP_WRITE,             ///< Write sectors from the segment buffers
+    SDHI_REQUEST_OP_IO_READ,           ///< Read SDIO blocks into the segment buffers with one block mode CMD53
+    SDHI_REQUEST_OP_IO_WRITE,          ///< Write SDIO blocks from the segment buffers with one block mode CMD53
+} sdhi_request_op_t;
+
+/** Progress of a queued request */
+typedef enum e_sdhi_request_status
+{
+    SDHI_REQUEST_STATUS_IDLE,          ///< Not submitted, or discarded by R_SDHI_Close()
+    SDHI_REQUEST_STATUS_QUEUED,        ///< Waiting in the request queue
+    SDHI_REQUEST_STATUS_ACTIVE,        ///< Transfer in progress
+    SDHI_REQUEST_STATUS_COMPLETE,      ///< Transfer finished, result is in event
+} sdhi_request_status_t;
+
+/** One buffer of a scatter list. Consecutive segments map to consecutive sectors of the same request. */
+typedef struct st_sdhi_segment
+{
+    void   * p_buffer;                 ///< Word aligned buffer
+    uint32_t sector_count;             ///< Number of sectors, or SDIO blocks, transferred to or from p_buffer
+} sdhi_segment_t;
+
+/** Multi-sector SD or eMMC request, or multi-block SDIO request. The memory is owned by the driver from
+ * R_SDHI_RequestSubmit() until the request completes or is discarded. */
+typedef struct st_sdhi_request
+{
+    sdhi_request_op_t       op;               ///< Read or write
+    uint32_t                start_sector;     ///< First sector of the transfer, or SDIO register address
+    sdhi_segment_t const  * p_segments;       ///< Scatter list, transferred in order with one multi-block command
+    uint32_t                num_segments;     ///< Number of entries in p_segments, must be 1 with DMAC
+    bool                    pre_erase;        ///< Send ACMD23 with the sector count before a write (SD cards only)
+    bool                    reliable_write;   ///< Set the reliable write flag of CMD23 for a write (eMMC only)
+    uint32_t                io_function;      ///< SDIO function number (SDIO requests only)
+    sdmmc_io_address_mode_t io_address_mode;  ///< Fixed (FIFO) or incrementing register address (SDIO requests only)
+
+    volatile sdhi_request_status_t status;    ///< Set by the driver
+    volatile sdmmc_event_t         event;     ///< Completion event, valid once status is COMPLETE
+    struct st_sdhi_request       * p_next;    ///< Used by the driver to link queued requests
+} sdhi_request_t;
+
 /** SDMMC instance control block.  This is private to the FSP and should not be used or modified by the application. */
 typedef struct st_sdmmc_instance_ctrl
 {
@@ -107,6 +158,16 @@ typedef struct st_sdmmc_instance_ctrl
     void (* p_callback)(sdmmc_callback_args_t *); // Pointer to callback
     sdmmc_callback_args_t * p_callback_memory;    // Pointer to optional callback argument memory
     void const            * p_context;            // Pointer to context to be passed into callback function
+
+    uint32_t         rca;                         // Relative card address, used for ACMD23
+    sdhi_request_t * p_request_head;              // Queued requests in submission order
+    sdhi_request_t * p_request_tail;              // Last queued request
+    sdhi_request_t * p_request_active;            // Request currently being transferred
+    uint32_t         request_segment;             // Index of the active segment in the active request
+    uint32_t         request_sector_count;        // Total sector count of the active request
+    uint32_t         request_pre_erase;           // Progress of the ACMD23 or CMD23 sequence for the active request
+    uint32_t         emmc_cache_size;             // eMMC cache size from EXT_CSD in kilobytes, 0 if no cache
+    bool             emmc_cache_enabled;          // eMMC cache was turned on by R_SDHI_MediaInit()
 } sdhi_instance_ctrl_t;
 
 /**********************************************************************************************************************
@@ -165,6 +226,9 @@ fsp_err_t R_SDHI_CallbackSet(sdmmc_ctrl_t * const          p_api_ctrl,
                              sdmmc_callback_args_t * const p_callback_memory);
 fsp_err_t R_SDHI_Close(sdmmc_ctrl_t * const p_api_ctrl);
 fsp_err_t R_SDHI_VersionGet(fsp_version_t * const p_version);
+fsp_err_t R_SDHI_RequestSubmit(sdmmc_ctrl_t * const p_api_ctrl, sdhi_request_t * const p_request);
+fsp_err_t R_SDHI_IoIntAcknowledge(sdmmc_ctrl_t * const p_api_ctrl);
+fsp_err_t R_SDHI_CacheFlush(sdmmc_ctrl_t * const p_api_ctrl);
 
 /* Common macro for FSP header files. There is also a corresponding FSP_HEADER macro at the top of this file. */
 FSP_FOOTER
@@ -28,6 +28,7 @@
 
 #include "bsp_api.h"
 #include "r_slcdc_api.h"
+#include "r_transfer_api.h"
 
 /* Common macro for FSP header files. There is also a corresponding FSP_FOOTER macro at the end of this file. */
 FSP_HEADER
@@ -42,12 +43,34 @@ FSP_HEADER
  * Typedef definitions
  **********************************************************************************************************************/
 
+/** Shadow buffer settings passed to R_SLCDC_ShadowStart(). */
+typedef struct st_slcdc_shadow_cfg
+{
+    /** DTC instance that copies the display image, activated once per display update. Use ELC_EVENT_RTC_PERIOD to
+     * update in step with blinking, or an AGT underflow for a faster animation rate. */
+    transfer_instance_t const * p_transfer;
+
+    uint8_t   start_segment;           ///< First segment data register mirrored by the shadow buffer
+    uint8_t   segment_count;           ///< Number of segment data registers mirrored, 1 to the number of segments
+    uint8_t * p_buffer[2];             ///< Two buffers of segment_count bytes, one displayed and one being staged
+} slcdc_shadow_cfg_t;
+
 /** SLCDC control block. DO NOT INITIALIZE.  Initialization occurs when @ref slcdc_api_t::open is called */
 typedef struct st_slcdc_instance_ctrl
 {
     uint32_t            open;          // Status of SLCD module
     slcdc_cfg_t const * p_cfg;         // Pointer to SLCDC configuration
     void const        * p_context;     // Pointer to the higher level device context
+
+    /* Shadow buffer state */
+    slcdc_shadow_cfg_t const * p_shadow;          // Shadow buffer settings, NULL when not in use
+    uint8_t                  * p_shadow_front;    // Last committed image
+    uint8_t                  * p_shadow_back;     // Image staged by R_SLCDC_ShadowWrite() and R_SLCDC_ShadowModify()
+    uint8_t const            * p_shadow_busy;     // Previous DTC source, NULL once the DTC no longer reads it
+    uint32_t                   shadow_busy_bytes; // Size of p_shadow_busy
+    bool                       shadow_back_stale; // Back buffer must be refreshed from the front buffer
+    uint32_t volatile          shadow_reload[2];  // Source and counter of the display sequence
+    transfer_info_t            shadow_info[3];    // DTC chain that copies the display sequence
 } slcdc_instance_ctrl_t;
 
 /**********************************************************************************************************************
@@ -76,6 +99,18 @@ fsp_err_t R_SLCDC_Start(slcdc_ctrl_t * const p_ctrl);
 fsp_err_t R_SLCDC_Stop(slcdc_ctrl_t * const p_ctrl);
 fsp_err_t R_SLCDC_SetContrast(slcdc_ctrl_t * const p_ctrl, slcdc_contrast_t const contrast);
 fsp_err_t R_SLCDC_SetDisplayArea(slcdc_ctrl_t * const p_ctrl, slcdc_display_area_t const display_area);
+fsp_err_t R_SLCDC_ShadowStart(slcdc_ctrl_t * const p_ctrl, slcdc_shadow_cfg_t const * const p_shadow_cfg);
+fsp_err_t R_SLCDC_ShadowWrite(slcdc_ctrl_t * const p_ctrl,
+                              uint8_t const        start_segment,
+                              uint8_t const      * p_data,
+                              uint8_t const        segment_count);
+fsp_err_t R_SLCDC_ShadowModify(slcdc_ctrl_t * const p_ctrl,
+                               uint8_t const        segment,
+                               uint8_t const        data,
+                               uint8_t const        data_mask);
+fsp_err_t R_SLCDC_ShadowCommit(slcdc_ctrl_t * const p_ctrl);
+fsp_err_t R_SLCDC_AnimationStart(slcdc_ctrl_t * const p_ctrl, uint8_t const * const p_frames, uint16_t const num_frames);
+fsp_err_t R_SLCDC_ShadowStop(slcdc_ctrl_t * const p_ctrl);
 fsp_err_t R_SLCDC_Close(slcdc_ctrl_t * const p_ctrl);
 fsp_err_t R_SLCDC_VersionGet(fsp_version_t * p_version);
 
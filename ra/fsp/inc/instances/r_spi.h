@@ -118,6 +118,24 @@ typedef struct
     uint8_t brdv : 2;                  ///< BRDV setting in SPCMD0
 } rspck_div_setting_t;
 
+/** Slave select behavior at the end of a queued transaction. */
+typedef enum e_spi_transaction_ssl
+{
+    SPI_TRANSACTION_SSL_NEGATE,        ///< Negate SSL after this transaction
+    SPI_TRANSACTION_SSL_KEEP           ///< Keep SSL asserted into the next transaction (4-wire master mode only)
+} spi_transaction_ssl_t;
+
+/** One segment of a transaction queue started by R_SPI_TransactionQueueStart. */
+typedef struct st_spi_transaction
+{
+    void const          * p_src;       ///< Buffer to transmit, or NULL to transmit zeros
+    void                * p_dest;      ///< Buffer to store received data, or NULL to discard received data
+    uint32_t              length;      ///< Number of data frames to transfer
+    spi_bit_width_t       bit_width;   ///< Data frame size (8-bit, 16-bit, 32-bit)
+    spi_ssl_select_t      ssl_select;  ///< Slave select line asserted during this transaction
+    spi_transaction_ssl_t ssl_end;     ///< Slave select behavior at the end of this transaction
+} spi_transaction_t;
+
 /** Extended SPI interface configuration */
 typedef struct st_spi_extended_cfg
 {
@@ -147,6 +165,10 @@ typedef struct st_spi_instance_ctrl
     uint32_t          count;           ///< Number of Data Frames to transfer (8-bit, 16-bit, 32-bit)
     spi_bit_width_t   bit_width;       ///< Bits per Data frame (8-bit, 16-bit, 32-bit)
 
+    spi_transaction_t const * p_queue; ///< Transaction queue in progress, or NULL
+    uint32_t queue_length;             ///< Number of transactions in the queue
+    uint32_t queue_index;              ///< Index of the transaction in progress
+
     /* Pointer to callback and optional working memory */
     void (* p_callback)(spi_callback_args_t *);
     spi_callback_args_t * p_callback_memory;
@@ -186,6 +208,9 @@ fsp_err_t R_SPI_WriteRead(spi_ctrl_t * const    p_api_ctrl,
                           uint32_t const        length,
                           spi_bit_width_t const bit_width);
 
+fsp_err_t R_SPI_TransactionQueueStart(spi_ctrl_t * const              p_api_ctrl,
+                                      spi_transaction_t const * const p_transactions,
+                                      uint32_t const                  num_transactions);
 fsp_err_t R_SPI_Close(spi_ctrl_t * const p_api_ctrl);
 
 fsp_err_t R_SPI_VersionGet(fsp_version_t * p_version);
@@ -70,6 +70,59 @@ typedef enum e_ssi_clock_div
     SSI_CLOCK_DIV_128 = 7,             ///< Clock divisor 128
 } ssi_clock_div_t;
 
+/** Direction of an audio stream. */
+typedef enum e_ssi_stream_dir
+{
+    SSI_STREAM_DIR_TX = 0,             ///< Transmit ring
+    SSI_STREAM_DIR_RX = 1,             ///< Receive ring
+} ssi_stream_dir_t;
+
+/** Audio stream period callback arguments. */
+typedef struct st_ssi_stream_callback_args
+{
+    ssi_stream_dir_t dir;              ///< Ring the period belongs to
+    uint32_t         period;           ///< Index of the period in the ring
+    void           * p_buffer;         ///< Period buffer, to be refilled (transmit) or consumed (receive)
+    uint32_t         frames;           ///< Stereo frames in the period
+
+    /** Measured sample rate error relative to ssi_stream_cfg_t::sample_rate_hz in parts per million (positive when
+     *  the interface runs fast), for use by a sample rate converter stage. 0 if rate tracking is not used. */
+    int32_t      rate_error_ppm;
+    void const * p_context;            ///< Placeholder for user data
+} ssi_stream_callback_args_t;
+
+/** Audio streaming configuration, passed to R_SSI_StreamStart. */
+typedef struct st_ssi_stream_cfg
+{
+    /** DMAC instances activated by the SSI transmit and receive interrupts, with chain loop enabled and
+     *  transfer_cfg_t::p_info pointing to an array of num_periods transfer_info_t. The DMAC callbacks must call
+     *  R_SSI_StreamTransferEnd. Set one of them to NULL to stream in a single direction. */
+    transfer_instance_t const * p_transfer_tx;
+    transfer_instance_t const * p_transfer_rx;
+
+    void   * p_tx_buffer;              ///< Transmit ring of num_periods periods, filled before the stream starts
+    void   * p_rx_buffer;              ///< Receive ring of num_periods periods
+    uint32_t num_periods;              ///< Periods in each ring (2 to 32)
+    uint16_t period_frames;            ///< Stereo frames per period
+
+    /** Free running timer used to measure the sample rate at the end of each period, or NULL if unused. */
+    timer_instance_t const * p_timestamp;
+    uint32_t                 sample_rate_hz; ///< Nominal sample rate, used for rate tracking
+
+    void (* p_callback)(ssi_stream_callback_args_t * p_args); ///< Called at the end of each period
+    void const * p_context;                                    ///< Placeholder for user data
+} ssi_stream_cfg_t;
+
+/** Audio stream accounting, returned by R_SSI_StreamStatusGet. */
+typedef struct st_ssi_stream_status
+{
+    uint32_t tx_underruns;             ///< Periods played before the application released them, and FIFO underflows
+    uint32_t rx_overruns;              ///< Periods overwritten before the application released them, and FIFO overflows
+    uint32_t tx_latency_frames;        ///< Frames queued for transmission
+    uint32_t rx_latency_frames;        ///< Frames received and not yet released by the application
+    int32_t  rate_error_ppm;           ///< Measured sample rate error, see @ref ssi_stream_callback_args_t
+} ssi_stream_status_t;
+
 /** Channel instance control block. DO NOT INITIALIZE.  Initialization occurs when @ref i2s_api_t::open is called. */
 typedef struct st_ssi_instance_ctrl
 {
@@ -94,6 +147,15 @@ typedef struct st_ssi_instance_ctrl
     void (* p_callback)(i2s_callback_args_t *);
     i2s_callback_args_t * p_callback_memory;
     void const          * p_context;   // < User defined context passed into callback function
+
+    /* Audio streaming state. */
+    ssi_stream_cfg_t const * p_stream_cfg;     // Streaming configuration, NULL when not streaming
+    uint32_t                 stream_app[2];    // Periods of each ring held by the application (bit per period)
+    uint32_t                 tx_underruns;     // Transmit underrun count
+    uint32_t                 rx_overruns;      // Receive overrun count
+    uint32_t                 stream_timestamp; // Timer count at the end of the last period
+    uint32_t                 stream_ticks;     // Filtered timer counts per period, scaled by 16
+    int32_t                  rate_error_ppm;   // Measured sample rate error
 } ssi_instance_ctrl_t;
 
 /** SSI configuration extension. This extension is optional. */
@@ -126,6 +188,11 @@ fsp_err_t R_SSI_WriteRead(i2s_ctrl_t * const p_ctrl, void const * const p_src, v
 fsp_err_t R_SSI_Mute(i2s_ctrl_t * const p_ctrl, i2s_mute_t const mute_enable);
 fsp_err_t R_SSI_Close(i2s_ctrl_t * const p_ctrl);
 fsp_err_t R_SSI_VersionGet(fsp_version_t * const p_version);
+fsp_err_t R_SSI_StreamStart(i2s_ctrl_t * const p_ctrl, ssi_stream_cfg_t const * const p_stream_cfg);
+fsp_err_t R_SSI_StreamStop(i2s_ctrl_t * const p_ctrl);
+fsp_err_t R_SSI_StreamTransferEnd(i2s_ctrl_t * const p_ctrl, transfer_info_t const * const p_info);
+fsp_err_t R_SSI_StreamPeriodRelease(i2s_ctrl_t * const p_ctrl, ssi_stream_dir_t dir, uint32_t period);
+fsp_err_t R_SSI_StreamStatusGet(i2s_ctrl_t * const p_ctrl, ssi_stream_status_t * const p_status);
 fsp_err_t R_SSI_CallbackSet(i2s_ctrl_t * const          p_api_ctrl,
                             void (                    * p_callback)(i2s_callback_args_t *),
                             void const * const          p_context,
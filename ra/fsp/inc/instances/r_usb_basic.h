@@ -39,6 +39,11 @@ FSP_HEADER
 #define USB_CODE_VERSION_MAJOR    (1U)
 #define USB_CODE_VERSION_MINOR    (2U)
 
+/** Maximum number of buffers in an isochronous stream. */
+#ifndef USB_CFG_ISO_STREAM_BUFFER_NUM_MAX
+ #define USB_CFG_ISO_STREAM_BUFFER_NUM_MAX    (4U)
+#endif
+
 /***********************************************************************************************************************
  * Typedef definitions
  **********************************************************************************************************************/
@@ -47,6 +52,40 @@ FSP_HEADER
 
 typedef usb_event_info_t usb_instance_ctrl_t;
 
+/** Isochronous stream events */
+typedef enum e_usb_iso_stream_event
+{
+    USB_ISO_STREAM_EVENT_SOF,          ///< Start of frame; frame holds the frame number
+    USB_ISO_STREAM_EVENT_IN_REQUEST,   ///< Fill p_buffer and set size to the bytes to send in a coming frame
+    USB_ISO_STREAM_EVENT_IN_COMPLETE,  ///< p_buffer was sent
+    USB_ISO_STREAM_EVENT_OUT_COMPLETE, ///< size bytes were received into p_buffer
+    USB_ISO_STREAM_EVENT_STOPPED,      ///< A transfer ended with an error; the pipe is no longer armed
+} usb_iso_stream_event_t;
+
+/** Arguments passed to the isochronous stream callback */
+typedef struct st_usb_iso_stream_callback_args
+{
+    usb_iso_stream_event_t event;      ///< Event
+    uint8_t                pipe;       ///< Isochronous pipe of the stream
+    uint16_t               frame;      ///< Frame number, for USB_ISO_STREAM_EVENT_SOF
+    uint8_t              * p_buffer;   ///< Buffer the event refers to
+    uint32_t               size;       ///< Bytes received or sent. Set by the callback for IN_REQUEST
+    void const           * p_context;  ///< Context from the stream configuration
+} usb_iso_stream_callback_args_t;
+
+/** Isochronous stream configuration */
+typedef struct st_usb_iso_stream_cfg
+{
+    uint8_t   pipe;                    ///< USB_PIPE1 or USB_PIPE2, configured as isochronous by the descriptor
+    uint8_t * p_buffer;                ///< buffer_num buffers of buffer_size bytes, 4-byte aligned
+    uint32_t  buffer_size;             ///< Bytes per frame, at most the max packet size of the endpoint
+    uint8_t   buffer_num;              ///< 2 to USB_CFG_ISO_STREAM_BUFFER_NUM_MAX buffers
+
+    /** Called from the USB driver context for each event. */
+    void (* p_callback)(usb_iso_stream_callback_args_t * p_args);
+    void const * p_context;            ///< Placeholder for user data, passed back in the callback arguments
+} usb_iso_stream_cfg_t;
+
 /**********************************************************************************************************************
  * Exported global variables
  **********************************************************************************************************************/
@@ -92,6 +131,8 @@ fsp_err_t R_USB_PullUp(usb_ctrl_t * const p_api_ctrl, uint8_t state);
 
 fsp_err_t R_USB_EventGet(usb_ctrl_t * const p_api_ctrl, usb_status_t * event);
 
+fsp_err_t R_USB_EventPending(usb_ctrl_t * const p_api_ctrl, bool * p_pending);
+
 fsp_err_t R_USB_VersionGet(fsp_version_t * const p_version);
 
 fsp_err_t R_USB_Callback(usb_callback_t * p_callback);
@@ -123,6 +164,10 @@ fsp_err_t R_USB_DataSizeGet(usb_ctrl_t * const p_api_ctrl, uint32_t * data_size)
 
 fsp_err_t R_USB_SetupGet(usb_ctrl_t * const p_api_ctrl, usb_setup_t * setup);
 
+fsp_err_t R_USB_IsoStreamOpen(usb_ctrl_t * const p_api_ctrl, usb_iso_stream_cfg_t const * const p_cfg);
+
+fsp_err_t R_USB_IsoStreamClose(usb_ctrl_t * const p_api_ctrl, uint8_t pipe_number);
+
 /* Common macro for FSP header files. There is also a corresponding FSP_HEADER macro at the top of this file. */
 FSP_FOOTER
 
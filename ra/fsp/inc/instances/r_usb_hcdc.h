@@ -0,0 +1,94 @@
+/***********************************************************************************************************************
+ * Copyright [2020] Renesas Electronics Corporation and/or its affiliates.  All Rights Reserved.
+ *
+ * This software and documentation are supplied by Renesas Electronics America Inc. and may only be used with products
+ * of Renesas Electronics Corp. and its affiliates ("Renesas").  No other uses are authorized.  Renesas products are
+ * sold pursuant to Renesas terms and conditions of sale.  Purchasers are solely responsible for the selection and use
+ * of Renesas products and Renesas assumes no liability.  No license, express or implied, to any intellectual property
+ * right is granted by Renesas. This software is protected under all applicable laws, including copyright laws. Renesas
+ * reserves the right to change or discontinue this software and/or this documentation. THE SOFTWARE AND DOCUMENTATION
+ * IS DELIVERED TO YOU "AS IS," AND RENESAS MAKES NO REPRESENTATIONS OR WARRANTIES, AND TO THE FULLEST EXTENT
+ * PERMISSIBLE UNDER APPLICABLE LAW, DISCLAIMS ALL WARRANTIES, WHETHER EXPLICITLY OR IMPLICITLY, INCLUDING WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, AND NONINFRINGEMENT, WITH RESPECT TO THE SOFTWARE OR
+ * DOCUMENTATION.  RENESAS SHALL HAVE NO LIABILITY ARISING OUT OF ANY SECURITY VULNERABILITY OR BREACH.  TO THE MAXIMUM
+ * EXTENT PERMITTED BY LAW, IN NO EVENT WILL RENESAS BE LIABLE TO YOU IN CONNECTION WITH THE SOFTWARE OR DOCUMENTATION
+ * (OR ANY PERSON OR ENTITY CLAIMING RIGHTS DERIVED FROM YOU) FOR ANY LOSS, DAMAGES, OR CLAIMS WHATSOEVER, INCLUDING,
+ * WITHOUT LIMITATION, ANY DIRECT, CONSEQUENTIAL, SPECIAL, INDIRECT, PUNITIVE, OR INCIDENTAL DAMAGES; ANY LOST PROFITS,
+ * OTHER ECONOMIC DAMAGE, PROPERTY DAMAGE, OR PERSONAL INJURY; AND EVEN IF RENESAS HAS BEEN ADVISED OF THE POSSIBILITY
+ * OF SUCH LOSS, DAMAGES, CLAIMS OR COSTS.
+ **********************************************************************************************************************/
+/**********************************************************************************************************************
+ * File Name    : r_usb_hcdc.h
+ * Description  : USB HCDC public APIs.
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * @addtogroup USB_HCDC
+ * @{
+ **********************************************************************************************************************/
+
+#ifndef USB_HCDC_H
+#define USB_HCDC_H
+
+/******************************************************************************
+ * Includes   <System Includes> , "Project Includes"
+ ******************************************************************************/
+#include "r_usb_hcdc_cfg.h"
+#include "r_usb_basic_api.h"
+#include "r_usb_hcdc_api.h"
+
+/* Common macro for FSP header files. There is also a corresponding FSP_FOOTER macro at the end of this file. */
+FSP_HEADER
+
+/*******************************************************************************
+ * Typedef definitions
+ *******************************************************************************/
+
+/** Streaming receive events */
+typedef enum e_usb_hcdc_stream_event
+{
+    USB_HCDC_STREAM_EVENT_RX_COMPLETE, ///< A receive buffer was filled or ended by a short packet
+    USB_HCDC_STREAM_EVENT_RX_PAUSED,   ///< Every receive buffer is held; bulk IN is parked and the device is NAKed
+    USB_HCDC_STREAM_EVENT_RX_RESUMED,  ///< A buffer was released after RX_PAUSED and bulk IN is armed again
+    USB_HCDC_STREAM_EVENT_STOPPED,     ///< A transfer ended with an error, the device detached or the stream closed
+} usb_hcdc_stream_event_t;
+
+/** Arguments passed to the streaming receive callback */
+typedef struct st_usb_hcdc_stream_callback_args
+{
+    usb_hcdc_stream_event_t event;     ///< Event
+    uint8_t               * p_buffer;  ///< Buffer the event refers to, NULL for RX_PAUSED and RX_RESUMED
+    uint32_t                size;      ///< Bytes received
+    void const            * p_context; ///< Context from the streaming receive configuration
+} usb_hcdc_stream_callback_args_t;
+
+/** Streaming receive configuration */
+typedef struct st_usb_hcdc_stream_cfg
+{
+    uint8_t * p_rx_buffer;             ///< rx_buffer_num receive buffers of rx_buffer_size bytes, 4-byte aligned
+
+    /** Size of each receive buffer, a multiple of the bulk IN max packet size. A buffer is reported when it is full,
+     * so this is the notification threshold; a short packet from the device (idle line) reports it early. */
+    uint32_t rx_buffer_size;
+    uint8_t  rx_buffer_num;            ///< Number of receive buffers, at least 2
+
+    /** Called from the USB driver context when a buffer completes or the flow state changes. */
+    void (* p_callback)(usb_hcdc_stream_callback_args_t * p_args);
+    void const * p_context;            ///< Placeholder for user data, passed back in the callback arguments
+} usb_hcdc_stream_cfg_t;
+
+/******************************************************************************
+ * Exported global functions (to be accessed by other files)
+ ******************************************************************************/
+fsp_err_t R_USB_HCDC_StreamOpen(usb_ctrl_t * const p_api_ctrl, usb_hcdc_stream_cfg_t const * const p_cfg);
+fsp_err_t R_USB_HCDC_StreamRelease(usb_ctrl_t * const p_api_ctrl, uint8_t * const p_buf);
+fsp_err_t R_USB_HCDC_StreamClose(usb_ctrl_t * const p_api_ctrl);
+
+/* Common macro for FSP header files. There is also a corresponding FSP_HEADER macro at the top of this file. */
+FSP_FOOTER
+
+#endif                                 /* USB_HCDC_H */
+
+/*******************************************************************************************************************//**
+ * @} (end addtogroup USB_HCDC)
+ **********************************************************************************************************************/
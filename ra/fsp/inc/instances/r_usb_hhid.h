@@ -37,6 +37,60 @@
 #include "r_usb_hhid_cfg.h"
 #include "r_usb_basic_api.h"
 
+/******************************************************************************
+ * Macro definitions
+ ******************************************************************************/
+
+/** Largest interrupt IN packet that fits in a report ring entry. */
+#ifndef USB_CFG_HHID_REPORT_SIZE_MAX
+ #define USB_CFG_HHID_REPORT_SIZE_MAX    (64U)
+#endif
+
+/*******************************************************************************
+ * Typedef definitions
+ *******************************************************************************/
+
+/** Report ring events */
+typedef enum e_usb_hhid_report_ring_event
+{
+    USB_HHID_REPORT_RING_EVENT_RECEIVED, ///< A report was queued into an empty ring
+    USB_HHID_REPORT_RING_EVENT_OVERFLOW, ///< A report was dropped because the ring was full
+    USB_HHID_REPORT_RING_EVENT_STOPPED,  ///< The transfer ended with an error or on detach; the pipe is no longer armed
+} usb_hhid_report_ring_event_t;
+
+/** One received report */
+typedef struct st_usb_hhid_report
+{
+    uint32_t timestamp;                          ///< Receive time from p_timestamp_get, or the USB frame number
+    uint16_t length;                             ///< Bytes received
+    uint8_t  device_address;                     ///< Device the report came from
+    uint8_t  reserved;
+    uint8_t  data[USB_CFG_HHID_REPORT_SIZE_MAX]; ///< Report data
+} usb_hhid_report_t;
+
+/** Arguments passed to the report ring callback */
+typedef struct st_usb_hhid_report_ring_callback_args
+{
+    usb_hhid_report_ring_event_t event;     ///< Event
+    uint32_t                     dropped;   ///< Reports dropped since the ring was opened
+    void const                 * p_context; ///< Context from the report ring configuration
+} usb_hhid_report_ring_callback_args_t;
+
+/** Report ring configuration */
+typedef struct st_usb_hhid_report_ring_cfg
+{
+    usb_hhid_report_t * p_reports;     ///< Ring storage of num_reports entries, 4-byte aligned
+    uint16_t            num_reports;   ///< Number of entries, at least 2. One entry is always being received into.
+    uint8_t             device_address;
+
+    /** Optional time source sampled when a report completes. When NULL the USB frame number is used. */
+    uint32_t (* p_timestamp_get)(void);
+
+    /** Optional notification, called from the USB driver context. */
+    void (* p_callback)(usb_hhid_report_ring_callback_args_t * p_args);
+    void const * p_context;            ///< Placeholder for user data, passed back in the callback arguments
+} usb_hhid_report_ring_cfg_t;
+
 /******************************************************************************
  * Exported global functions (to be accessed by other files)
  ******************************************************************************/
@@ -45,6 +99,12 @@ fsp_err_t R_USB_HHID_MaxPacketSizeGet(usb_ctrl_t * const p_api_ctrl,
                                       uint16_t         * p_size,
                                       uint8_t            direction,
                                       uint8_t            device_address);
+fsp_err_t R_USB_HHID_ReportRingOpen(usb_ctrl_t * const p_api_ctrl, usb_hhid_report_ring_cfg_t const * const p_cfg);
+fsp_err_t R_USB_HHID_ReportRingRead(usb_ctrl_t * const        p_api_ctrl,
+                                    usb_hhid_report_t * const p_dest,
+                                    uint16_t                  max_reports,
+                                    uint16_t * const          p_count);
+fsp_err_t R_USB_HHID_ReportRingClose(usb_ctrl_t * const p_api_ctrl);
 
 #endif                                 /* USB_HHID_H */
 
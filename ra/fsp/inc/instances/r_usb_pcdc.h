@@ -0,0 +1,100 @@
+/***********************************************************************************************************************
+ * Copyright [2020] Renesas Electronics Corporation and/or its affiliates.  All Rights Reserved.
+ *
+ * This software and documentation are supplied by Renesas Electronics America Inc. and may only be used with products
+ * of Renesas Electronics Corp. and its affiliates ("Renesas").  No other uses are authorized.  Renesas products are
+ * sold pursuant to Renesas terms and conditions of sale.  Purchasers are solely responsible for the selection and use
+ * of Renesas products and Renesas assumes no liability.  No license, express or implied, to any intellectual property
+ * right is granted by Renesas. This software is protected under all applicable laws, including copyright laws. Renesas
+ * reserves the right to change or discontinue this software and/or this documentation. THE SOFTWARE AND DOCUMENTATION
+ * IS DELIVERED TO YOU "AS IS," AND RENESAS MAKES NO REPRESENTATIONS OR WARRANTIES, AND TO THE FULLEST EXTENT
+ * PERMISSIBLE UNDER APPLICABLE LAW, DISCLAIMS ALL WARRANTIES, WHETHER EXPLICITLY OR IMPLICITLY, INCLUDING WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, AND NONINFRINGEMENT, WITH RESPECT TO THE SOFTWARE OR
+ * DOCUMENTATION.  RENESAS SHALL HAVE NO LIABILITY ARISING OUT OF ANY SECURITY VULNERABILITY OR BREACH.  TO THE MAXIMUM
+ * EXTENT PERMITTED BY LAW, IN NO EVENT WILL RENESAS BE LIABLE TO YOU IN CONNECTION WITH THE SOFTWARE OR DOCUMENTATION
+ * (OR ANY PERSON OR ENTITY CLAIMING RIGHTS DERIVED FROM YOU) FOR ANY LOSS, DAMAGES, OR CLAIMS WHATSOEVER, INCLUDING,
+ * WITHOUT LIMITATION, ANY DIRECT, CONSEQUENTIAL, SPECIAL, INDIRECT, PUNITIVE, OR INCIDENTAL DAMAGES; ANY LOST PROFITS,
+ * OTHER ECONOMIC DAMAGE, PROPERTY DAMAGE, OR PERSONAL INJURY; AND EVEN IF RENESAS HAS BEEN ADVISED OF THE POSSIBILITY
+ * OF SUCH LOSS, DAMAGES, CLAIMS OR COSTS.
+ **********************************************************************************************************************/
+/**********************************************************************************************************************
+ * File Name    : r_usb_pcdc.h
+ * Description  : USB PCDC public APIs.
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * @addtogroup USB_PCDC
+ * @{
+ **********************************************************************************************************************/
+
+#ifndef USB_PCDC_H
+#define USB_PCDC_H
+
+/******************************************************************************
+ * Includes   <System Includes> , "Project Includes"
+ ******************************************************************************/
+#include "r_usb_pcdc_cfg.h"
+#include "r_usb_basic_api.h"
+#include "r_usb_pcdc_api.h"
+
+/* Common macro for FSP header files. There is also a corresponding FSP_FOOTER macro at the end of this file. */
+FSP_HEADER
+
+/******************************************************************************
+ * Macro definitions
+ ******************************************************************************/
+
+/** Depth of the streaming transmit queue. */
+#ifndef USB_CFG_PCDC_STREAM_TX_QUEUE_DEPTH
+ #define USB_CFG_PCDC_STREAM_TX_QUEUE_DEPTH    (8U)
+#endif
+
+/*******************************************************************************
+ * Typedef definitions
+ *******************************************************************************/
+
+/** Streaming mode events */
+typedef enum e_usb_pcdc_stream_event
+{
+    USB_PCDC_STREAM_EVENT_RX_COMPLETE, ///< A receive buffer was filled or ended by a short packet
+    USB_PCDC_STREAM_EVENT_TX_COMPLETE, ///< A queued transmit buffer was sent
+    USB_PCDC_STREAM_EVENT_STOPPED,     ///< A transfer ended with an error or was stopped; the pipe is no longer armed
+} usb_pcdc_stream_event_t;
+
+/** Arguments passed to the streaming mode callback */
+typedef struct st_usb_pcdc_stream_callback_args
+{
+    usb_pcdc_stream_event_t event;     ///< Event
+    uint8_t               * p_buffer;  ///< Buffer the event refers to
+    uint32_t                size;      ///< Bytes received or sent
+    void const            * p_context; ///< Context from the streaming mode configuration
+} usb_pcdc_stream_callback_args_t;
+
+/** Streaming mode configuration */
+typedef struct st_usb_pcdc_stream_cfg
+{
+    uint8_t * p_rx_buffer;             ///< rx_buffer_num receive buffers of rx_buffer_size bytes, 4-byte aligned
+    uint32_t  rx_buffer_size;          ///< Size of each receive buffer, a multiple of the bulk OUT max packet size
+    uint8_t   rx_buffer_num;           ///< Number of receive buffers, at least 2
+
+    /** Called from the USB driver context when a buffer completes. */
+    void (* p_callback)(usb_pcdc_stream_callback_args_t * p_args);
+    void const * p_context;            ///< Placeholder for user data, passed back in the callback arguments
+} usb_pcdc_stream_cfg_t;
+
+/******************************************************************************
+ * Exported global functions (to be accessed by other files)
+ ******************************************************************************/
+fsp_err_t R_USB_PCDC_StreamOpen(usb_ctrl_t * const p_api_ctrl, usb_pcdc_stream_cfg_t const * const p_cfg);
+fsp_err_t R_USB_PCDC_StreamWrite(usb_ctrl_t * const p_api_ctrl, uint8_t const * const p_buf, uint32_t size);
+fsp_err_t R_USB_PCDC_StreamRelease(usb_ctrl_t * const p_api_ctrl, uint8_t * const p_buf);
+fsp_err_t R_USB_PCDC_StreamClose(usb_ctrl_t * const p_api_ctrl);
+
+/* Common macro for FSP header files. There is also a corresponding FSP_HEADER macro at the top of this file. */
+FSP_FOOTER
+
+#endif                                 /* USB_PCDC_H */
+
+/*******************************************************************************************************************//**
+ * @} (end addtogroup USB_PCDC)
+ **********************************************************************************************************************/
@@ -0,0 +1,122 @@
+/***********************************************************************************************************************
+ * Copyright [2020] Renesas Electronics Corporation and/or its affiliates.  All Rights Reserved.
+ *
+ * This software and documentation are supplied by Renesas Electronics America Inc. and may only be used with products
+ * of Renesas Electronics Corp. and its affiliates ("Renesas").  No other uses are authorized.  Renesas products are
+ * sold pursuant to Renesas terms and conditions of sale.  Purchasers are solely responsible for the selection and use
+ * of Renesas products and Renesas assumes no liability.  No license, express or implied, to any intellectual property
+ * right is granted by Renesas. This software is protected under all applicable laws, including copyright laws. Renesas
+ * reserves the right to change or discontinue this software and/or this documentation. THE SOFTWARE AND DOCUMENTATION
+ * IS DELIVERED TO YOU "AS IS," AND RENESAS MAKES NO REPRESENTATIONS OR WARRANTIES, AND TO THE FULLEST EXTENT
+ * PERMISSIBLE UNDER APPLICABLE LAW, DISCLAIMS ALL WARRANTIES, WHETHER EXPLICITLY OR IMPLICITLY, INCLUDING WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, AND NONINFRINGEMENT, WITH RESPECT TO THE SOFTWARE OR
+ * DOCUMENTATION.  RENESAS SHALL HAVE NO LIABILITY ARISING OUT OF ANY SECURITY VULNERABILITY OR BREACH.  TO THE MAXIMUM
+ * EXTENT PERMITTED BY LAW, IN NO EVENT WILL RENESAS BE LIABLE TO YOU IN CONNECTION WITH THE SOFTWARE OR DOCUMENTATION
+ * (OR ANY PERSON OR ENTITY CLAIMING RIGHTS DERIVED FROM YOU) FOR ANY LOSS, DAMAGES, OR CLAIMS WHATSOEVER, INCLUDING,
+ * WITHOUT LIMITATION, ANY DIRECT, CONSEQUENTIAL, SPECIAL, INDIRECT, PUNITIVE, OR INCIDENTAL DAMAGES; ANY LOST PROFITS,
+ * OTHER ECONOMIC DAMAGE, PROPERTY DAMAGE, OR PERSONAL INJURY; AND EVEN IF RENESAS HAS BEEN ADVISED OF THE POSSIBILITY
+ * OF SUCH LOSS, DAMAGES, CLAIMS OR COSTS.
+ **********************************************************************************************************************/
+
+#ifndef RM_AIO_BLOCK_MEDIA_H
+#define RM_AIO_BLOCK_MEDIA_H
+
+/***********************************************************************************************************************
+ * Includes
+ **********************************************************************************************************************/
+#include "rm_aio_api.h"
+#include "rm_block_media_api.h"
+#include "r_timer_api.h"
+#include "rm_aio_block_media_cfg.h"
+
+/* Common macro for FSP header files. There is also a corresponding FSP_FOOTER macro at the end of this file. */
+FSP_HEADER
+
+/*******************************************************************************************************************//**
+ * @addtogroup RM_AIO_BLOCK_MEDIA
+ * @{
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+#define RM_AIO_BLOCK_MEDIA_CODE_VERSION_MAJOR    (1U)
+#define RM_AIO_BLOCK_MEDIA_CODE_VERSION_MINOR    (0U)
+
+/** Number of chains that can be submitted and not yet returned by the completion queue. Must be a power of two. */
+#ifndef RM_AIO_BLOCK_MEDIA_CFG_QUEUE_LENGTH
+ #define RM_AIO_BLOCK_MEDIA_CFG_QUEUE_LENGTH     (8U)
+#endif
+
+/***********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+
+/** Extended configuration structure. This extension is required. */
+typedef struct st_rm_aio_block_media_extended_cfg
+{
+    /** Opened block media instance with its media initialized. Its callback is taken over while the asynchronous I/O
+     * instance is open. Addresses and lengths of requests are in blocks of this instance. */
+    rm_block_media_instance_t const * p_block_media;
+
+    /** Optional opened and started periodic timer that times requests. rm_aio_request_t::timeout is a number of its
+     * periods. Its callback is taken over while the asynchronous I/O instance is open. May be NULL if no request has
+     * a timeout. */
+    timer_instance_t const * p_timer;
+} rm_aio_block_media_extended_cfg_t;
+
+/** Instance control block. This is private to the FSP and should not be used or modified by the application. */
+typedef struct st_rm_aio_block_media_instance_ctrl
+{
+    uint32_t                                  open;
+    rm_aio_cfg_t const                      * p_cfg;
+    rm_aio_block_media_extended_cfg_t const * p_extend;
+    rm_aio_request_t                        * p_pending_head; // Chains waiting to start, oldest first
+    rm_aio_request_t                        * p_pending_tail; // Last chain waiting to start
+    rm_aio_request_t                        * p_chain;        // First request of the running chain
+    rm_aio_request_t * volatile               p_active;       // Request of the running chain to run or running
+    volatile bool                  issued;                    // p_active has been started on the media
+    volatile bool                  poll_status;               // p_active completes when the media is not busy
+    volatile bool                  stale;                     // A timed out operation runs; polled until idle
+    volatile bool                  starting;                  // Requests are being started
+    volatile uint32_t              tick;                      // Timer periods since open
+    uint32_t                       start_tick;                // Tick p_active started at
+    volatile uint32_t              submitted;                 // Chains submitted and not yet returned
+    bsp_queue_t                    completions;               // Completed chains
+    rm_aio_request_t             * p_completion_buffer[RM_AIO_BLOCK_MEDIA_CFG_QUEUE_LENGTH];
+    uint32_t                       completion_sequence[RM_AIO_BLOCK_MEDIA_CFG_QUEUE_LENGTH];
+    rm_block_media_callback_args_t block_media_args;          // Callback memory given to the block media instance
+    timer_callback_args_t          timer_args;                // Callback memory given to the timer instance
+} rm_aio_block_media_instance_ctrl_t;
+
+/**********************************************************************************************************************
+ * Exported global variables
+ **********************************************************************************************************************/
+
+/** @cond INC_HEADER_DEFS_SEC */
+/** Filled in Interface API structure for this Instance. */
+extern const rm_aio_api_t g_rm_aio_on_block_media;
+
+/** @endcond */
+
+/**********************************************************************************************************************
+ * Function Prototypes
+ **********************************************************************************************************************/
+fsp_err_t RM_AIO_BLOCK_MEDIA_Open(rm_aio_ctrl_t * const p_api_ctrl, rm_aio_cfg_t const * const p_cfg);
+fsp_err_t RM_AIO_BLOCK_MEDIA_Submit(rm_aio_ctrl_t * const p_api_ctrl, rm_aio_request_t * const p_request);
+fsp_err_t RM_AIO_BLOCK_MEDIA_CompletionGet(rm_aio_ctrl_t * const p_api_ctrl, rm_aio_request_t ** const pp_request);
+fsp_err_t RM_AIO_BLOCK_MEDIA_CompletionWait(rm_aio_ctrl_t * const     p_api_ctrl,
+                                            rm_aio_request_t ** const pp_request,
+                                            uint32_t const            timeout_ms);
+fsp_err_t RM_AIO_BLOCK_MEDIA_StatusGet(rm_aio_ctrl_t * const p_api_ctrl, rm_aio_status_t * const p_status);
+fsp_err_t RM_AIO_BLOCK_MEDIA_Close(rm_aio_ctrl_t * const p_api_ctrl);
+fsp_err_t RM_AIO_BLOCK_MEDIA_VersionGet(fsp_version_t * const p_version);
+
+/*******************************************************************************************************************//**
+ * @} (end addtogroup RM_AIO_BLOCK_MEDIA)
+ **********************************************************************************************************************/
+
+/* Common macro for FSP header files. There is also a corresponding FSP_HEADER macro at the top of this file. */
+FSP_FOOTER
+
+#endif                                 // RM_AIO_BLOCK_MEDIA_H
@@ -0,0 +1,158 @@
+/***********************************************************************************************************************
+ * Copyright [2020] Renesas Electronics Corporation and/or its affiliates.  All Rights Reserved.
+ *
+ * This software and documentation are supplied by Renesas Electronics America Inc. and may only be used with products
+ * of Renesas Electronics Corp. and its affiliates ("Renesas").  No other uses are authorized.  Renesas products are
+ * sold pursuant to Renesas terms and conditions of sale.  Purchasers are solely responsible for the selection and use
+ * of Renesas products and Renesas assumes no liability.  No license, express or implied, to any intellectual property
+ * right is granted by Renesas. This software is protected under all applicable laws, including copyright laws. Renesas
+ * reserves the right to change or discontinue this software and/or this documentation. THE SOFTWARE AND DOCUMENTATION
+ * IS DELIVERED TO YOU "AS IS," AND RENESAS MAKES NO REPRESENTATIONS OR WARRANTIES, AND TO THE FULLEST EXTENT
+ * PERMISSIBLE UNDER APPLICABLE LAW, DISCLAIMS ALL WARRANTIES, WHETHER EXPLICITLY OR IMPLICITLY, INCLUDING WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, AND NONINFRINGEMENT, WITH RESPECT TO THE SOFTWARE OR
+ * DOCUMENTATION.  RENESAS SHALL HAVE NO LIABILITY ARISING OUT OF ANY SECURITY VULNERABILITY OR BREACH.  TO THE MAXIMUM
+ * EXTENT PERMITTED BY LAW, IN NO EVENT WILL RENESAS BE LIABLE TO YOU IN CONNECTION WITH THE SOFTWARE OR DOCUMENTATION
+ * (OR ANY PERSON OR ENTITY CLAIMING RIGHTS DERIVED FROM YOU) FOR ANY LOSS, DAMAGES, OR CLAIMS WHATSOEVER, INCLUDING,
+ * WITHOUT LIMITATION, ANY DIRECT, CONSEQUENTIAL, SPECIAL, INDIRECT, PUNITIVE, OR INCIDENTAL DAMAGES; ANY LOST PROFITS,
+ * OTHER ECONOMIC DAMAGE, PROPERTY DAMAGE, OR PERSONAL INJURY; AND EVEN IF RENESAS HAS BEEN ADVISED OF THE POSSIBILITY
+ * OF SUCH LOSS, DAMAGES, CLAIMS OR COSTS.
+ **********************************************************************************************************************/
+#ifndef RM_BINARY_LOG_H
+#define RM_BINARY_LOG_H
+
+/***********************************************************************************************************************
+ * Includes
+ **********************************************************************************************************************/
+#include "bsp_api.h"
+#include "r_uart_api.h"
+#include "rm_binary_log_cfg.h"
+
+/* Common macro for FSP header files. There is also a corresponding FSP_FOOTER macro at the end of this file. */
+FSP_HEADER
+
+/*******************************************************************************************************************//**
+ * @addtogroup RM_BINARY_LOG
+ * @{
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+#define RM_BINARY_LOG_CODE_VERSION_MAJOR    (1U)
+#define RM_BINARY_LOG_CODE_VERSION_MINOR    (0U)
+
+/** Largest number of arguments of one log record. */
+#ifndef RM_BINARY_LOG_CFG_ARGS_MAX
+ #define RM_BINARY_LOG_CFG_ARGS_MAX         (8U)
+#endif
+
+/** Largest number of bytes passed to one UART write. Larger backlogs are sent in several segments. */
+#ifndef RM_BINARY_LOG_CFG_SEGMENT_MAX_BYTES
+ #define RM_BINARY_LOG_CFG_SEGMENT_MAX_BYTES    (1024U)
+#endif
+
+/** Timestamp of the records. Defaults to the DWT cycle counter. MCUs without one must provide a free running 32-bit
+ * counter, e.g. one read from a GPT. */
+#ifndef RM_BINARY_LOG_CFG_TIMESTAMP
+ #if BSP_FEATURE_DWT_CYCCNT
+  #define RM_BINARY_LOG_CFG_TIMESTAMP()     (DWT->CYCCNT)
+ #endif
+#endif
+
+/** Section holding the format strings. The strings are only read by the host decoder, so the linker script may place
+ * the section outside the load image, e.g. with `.rm_binary_log_fmt 0 (INFO) : { KEEP(*(.rm_binary_log_fmt)) }`. */
+#define RM_BINARY_LOG_FMT_SECTION           ".rm_binary_log_fmt"
+
+/** Format ID of the record that reports records dropped because the buffer was full. Its argument is the count. */
+#define RM_BINARY_LOG_FMT_ID_DROPPED        (0U)
+
+/** Logs a printf style message without formatting it. Only the address of the format string, which the host decoder
+ * maps back to the string with the ELF file, the timestamp and the arguments are stored, so a call costs a few dozen
+ * cycles and may be made from any context, including interrupts. The arguments are converted to uint32_t: cast
+ * pointers to uintptr_t, and pass floats through RM_BINARY_LOG_FLOAT(). %s arguments must point to strings in the
+ * ELF file, e.g. string literals. For example:
+ *
+ * @code
+ * RM_BINARY_LOG(&g_log_ctrl, "adc ch%u = %d mV", channel, millivolts);
+ * @endcode
+ */
+#define RM_BINARY_LOG(p_ctrl, ...)                                                                         \
+    do                                                                                                     \
+    {                                                                                                      \
+        static const char rm_binary_log_fmt[] BSP_PLACE_IN_SECTION(RM_BINARY_LOG_FMT_SECTION) =            \
+            RM_BINARY_LOG_PRV_FIRST(__VA_ARGS__, 0);                                                       \
+        uint32_t const rm_binary_log_args[] = {RM_BINARY_LOG_PRV_REST(__VA_ARGS__, 0U)};                   \
+        RM_BINARY_LOG_Write((p_ctrl), rm_binary_log_fmt, rm_binary_log_args,                               \
+                            (sizeof(rm_binary_log_args) / sizeof(uint32_t)) - 1U);                         \
+    } while (0)
+
+/** Passes a float argument to RM_BINARY_LOG() for %f, %e or %g. */
+#define RM_BINARY_LOG_FLOAT(x)              (((union { float f; uint32_t u; }) {.f = (float) (x)}).u)
+
+/* Splits the arguments of RM_BINARY_LOG() into the format string and the values, followed by a terminating 0. */
+#define RM_BINARY_LOG_PRV_FIRST(fmt, ...)    fmt
+#define RM_BINARY_LOG_PRV_REST(fmt, ...)     __VA_ARGS__
+
+/***********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+
+/** Log status */
+typedef struct st_rm_binary_log_status
+{
+    uint32_t pending_bytes;            ///< Bytes stored and not sent yet, including the segment being sent
+    uint32_t dropped;                  ///< Records dropped since open because the buffer was full
+} rm_binary_log_status_t;
+
+/** User configuration structure, used in open function */
+typedef struct st_rm_binary_log_cfg
+{
+    /** Opened UART the records are sent on, preferably with a transfer instance for transmission. Its callback is
+     * taken over; events other than UART_EVENT_TX_COMPLETE are forwarded to the callback of its configuration. */
+    uart_instance_t const * p_uart;
+    uint32_t              * p_buffer;     ///< Record buffer, sent from directly by the UART
+    uint32_t                buffer_words; ///< Size of the buffer in words, a power of two from 16 to 32768
+} rm_binary_log_cfg_t;
+
+/** Instance control block.  This is private to the FSP and should not be used or modified by the application. */
+typedef struct st_rm_binary_log_instance_ctrl
+{
+    uint32_t                    open;
+    rm_binary_log_cfg_t const * p_cfg;
+    uint32_t volatile         * p_ring;               // Record buffer
+    uint32_t                    mask;                 // buffer_words - 1
+    volatile uint32_t           head;                 // Word position past the last reserved record
+    volatile uint32_t           tail;                 // Word position of the first word not sent yet
+    uint32_t                    scan;                 // Word position of the first record not checked for completion
+    volatile uint32_t           tx_words;             // Words of the segment being sent, 0 if the UART is idle
+    volatile uint32_t           dropped;              // Records dropped and not reported yet
+    uint32_t                    dropped_reported;     // Records dropped and reported in a dropped record
+    uart_callback_args_t        uart_args;            // Callback arguments of the UART
+} rm_binary_log_instance_ctrl_t;
+
+/**********************************************************************************************************************
+ * Exported global variables
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Public APIs
+ **********************************************************************************************************************/
+fsp_err_t RM_BINARY_LOG_Open(rm_binary_log_instance_ctrl_t * const p_ctrl, rm_binary_log_cfg_t const * const p_cfg);
+void      RM_BINARY_LOG_Write(rm_binary_log_instance_ctrl_t * const p_ctrl,
+                              char const * const                    p_fmt,
+                              uint32_t const * const                p_args,
+                              uint32_t                              num_args);
+fsp_err_t RM_BINARY_LOG_Drain(rm_binary_log_instance_ctrl_t * const p_ctrl);
+fsp_err_t RM_BINARY_LOG_StatusGet(rm_binary_log_instance_ctrl_t * const p_ctrl,
+                                  rm_binary_log_status_t * const        p_status);
+fsp_err_t RM_BINARY_LOG_Close(rm_binary_log_instance_ctrl_t * const p_ctrl);
+fsp_err_t RM_BINARY_LOG_VersionGet(fsp_version_t * const p_version);
+
+/* Common macro for FSP header files. There is also a corresponding FSP_HEADER macro at the top of this file. */
+FSP_FOOTER
+
+#endif                                 // RM_BINARY_LOG_H
+
+/*******************************************************************************************************************//**
+ * @} (end addtogroup RM_BINARY_LOG)
+ **********************************************************************************************************************/
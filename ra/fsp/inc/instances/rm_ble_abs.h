@@ -121,6 +121,75 @@ typedef struct st_ble_abs_timer
     ble_abs_timer_cb_t cb;
 } ble_abs_timer_t;
 
+/** Largest notification value, the 3-byte notification header subtracted from the largest ATT_MTU of 247 bytes. */
+#define BLE_ABS_NOTIFICATION_VALUE_MAX    (244U)
+
+/** Notification queue events */
+typedef enum e_ble_abs_notification_event
+{
+    BLE_ABS_NOTIFICATION_EVENT_READY   = 0, ///< The queue was full and now has at least low_water_mark bytes free.
+    BLE_ABS_NOTIFICATION_EVENT_DROPPED = 1, ///< A queued value was rejected by the host stack and discarded.
+} ble_abs_notification_event_t;
+
+/** Notification queue callback parameter data */
+typedef struct st_ble_abs_notification_callback_args
+{
+    ble_abs_notification_event_t event;      ///< Notification queue event.
+    uint16_t                     conn_hdl;   ///< Connection of the discarded value, only for DROPPED.
+    uint16_t                     attr_hdl;   ///< Attribute of the discarded value, only for DROPPED.
+    uint32_t                     free_bytes; ///< Free bytes in the queue.
+    void const                 * p_context;  ///< Placeholder for user data.
+} ble_abs_notification_callback_args_t;
+
+/** Notification queue configuration, used by RM_BLE_ABS_NotificationQueueOpen() */
+typedef struct st_ble_abs_notification_queue_cfg
+{
+    uint8_t * p_buffer;                ///< Queue storage, 2-byte aligned.
+    uint32_t  buffer_size;             ///< Size of p_buffer in bytes, a multiple of 2.
+    uint32_t  low_water_mark;          ///< Free bytes required before BLE_ABS_NOTIFICATION_EVENT_READY is reported.
+    void (* p_callback)(ble_abs_notification_callback_args_t * p_args); ///< Optional queue event callback.
+    void const * p_context;                                             ///< Placeholder for user data.
+} ble_abs_notification_queue_cfg_t;
+
+/** Number of links tracked by the throughput profile. */
+#define BLE_ABS_THROUGHPUT_LINK_MAX    (8U)
+
+/** Throughput profile callback parameter data, reported when the tuning procedures of a link have completed. */
+typedef struct st_ble_abs_throughput_callback_args
+{
+    uint16_t     conn_hdl;             ///< Connection handle of the tuned link.
+    uint8_t      tx_phy;               ///< Transmitter PHY, 1: 1M, 2: 2M, 3: Coded.
+    uint16_t     tx_octets;            ///< Maximum transmission packet size.
+    uint16_t     conn_intv;            ///< Connection interval, Time(ms) = conn_intv * 1.25.
+    uint16_t     mtu;                  ///< ATT_MTU.
+    uint32_t     throughput_bps;       ///< Estimated notification throughput in bits per second.
+    void const * p_context;            ///< Placeholder for user data.
+} ble_abs_throughput_callback_args_t;
+
+/** Throughput profile, used by RM_BLE_ABS_ThroughputProfileSet() */
+typedef struct st_ble_abs_throughput_cfg
+{
+    uint8_t  phys;                     ///< Preferred PHYs, BLE_GAP_SET_PHYS_HOST_PREF_xx. 0 skips the PHY update.
+    uint16_t tx_octets;                ///< Maximum transmission packet size, 0x1B - 0xFB. 0 skips the DLE update.
+    uint16_t tx_time;                  ///< Maximum transmission time(us), 0x148 - 0x4290.
+    uint16_t conn_intv_min;            ///< Minimum connection interval. 0 skips the connection parameter update.
+    uint16_t conn_intv_max;            ///< Maximum connection interval.
+    uint16_t conn_latency;             ///< Slave latency.
+    uint16_t sup_to;                   ///< Supervision timeout, Time(ms) = sup_to * 10.
+    void (* p_callback)(ble_abs_throughput_callback_args_t * p_args); ///< Optional tuning complete callback.
+    void const * p_context;                                           ///< Placeholder for user data.
+} ble_abs_throughput_cfg_t;
+
+/** Link state tracked by the throughput profile. */
+typedef struct st_ble_abs_throughput_link
+{
+    uint16_t conn_hdl;                 ///< Connection handle, BLE_GAP_INVALID_CONN_HDL when free.
+    uint8_t  step;                     ///< Pending tuning procedure.
+    uint8_t  tx_phy;                   ///< Transmitter PHY.
+    uint16_t tx_octets;                ///< Maximum transmission packet size.
+    uint16_t conn_intv;                ///< Connection interval.
+} ble_abs_throughput_link_t;
+
 /** BLE ABS private control block. DO NOT MODIFY. Initialization occurs when RM_BLE_ABS_Open() is called. */
 typedef struct st_ble_abs_instance_ctrl
 {
@@ -141,6 +210,17 @@ typedef struct st_ble_abs_instance_ctrl
     uint32_t elapsed_timeout_ms;                                                    ///< Elapsed timeout.
 
     ble_abs_cfg_t const * p_cfg;                                                    ///< Pointer to the BLE ABS configuration block.
+
+    ble_abs_notification_queue_cfg_t const * p_notification_cfg;                    ///< Notification queue.
+    uint32_t notification_head;                                                     ///< Oldest queued value.
+    uint32_t notification_tail;                                                     ///< Next free byte.
+    uint32_t notification_used;                                                     ///< Queued bytes and padding.
+    bool     notification_blocked;                                                  ///< A value was refused.
+    bool     notification_flow_off;                                                 ///< Host TxFlow is off.
+    uint8_t  notification_value[BLE_ABS_NOTIFICATION_VALUE_MAX];                    ///< Packed stream values.
+
+    ble_abs_throughput_cfg_t const * p_throughput_cfg;                              ///< Throughput profile.
+    ble_abs_throughput_link_t throughput_links[BLE_ABS_THROUGHPUT_LINK_MAX];        ///< Tracked links.
 } ble_abs_instance_ctrl_t;
 
 /******************************************************************************************************************//**
@@ -248,6 +328,24 @@ fsp_err_t RM_BLE_ABS_SetLocalPrivacy(ble_abs_ctrl_t * const p_ctrl, uint8_t cons
 
 fsp_err_t RM_BLE_ABS_StartAuthentication(ble_abs_ctrl_t * const p_ctrl, uint16_t connection_handle);
 
+fsp_err_t RM_BLE_ABS_NotificationQueueOpen(ble_abs_ctrl_t * const                         p_ctrl,
+                                           ble_abs_notification_queue_cfg_t const * const p_queue_cfg);
+
+fsp_err_t RM_BLE_ABS_NotificationSend(ble_abs_ctrl_t * const                     p_ctrl,
+                                      uint16_t                                   conn_hdl,
+                                      st_ble_gatt_hdl_value_pair_t const * const p_ntf_data,
+                                      bool                                       stream,
+                                      uint32_t * const                           p_free_bytes);
+
+fsp_err_t RM_BLE_ABS_NotificationFlush(ble_abs_ctrl_t * const p_ctrl);
+
+fsp_err_t RM_BLE_ABS_NotificationQueueClose(ble_abs_ctrl_t * const p_ctrl);
+
+fsp_err_t RM_BLE_ABS_ThroughputProfileSet(ble_abs_ctrl_t * const                 p_ctrl,
+                                          ble_abs_throughput_cfg_t const * const p_throughput_cfg);
+
+fsp_err_t RM_BLE_ABS_ThroughputGet(ble_abs_ctrl_t * const p_ctrl, uint16_t conn_hdl, uint32_t * const p_throughput_bps);
+
 /* Common macro for FSP header files. There is also a corresponding FSP_HEADER macro at the top of this file. */
 FSP_FOOTER
 
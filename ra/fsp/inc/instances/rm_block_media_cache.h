@@ -0,0 +1,86 @@
+/***********************************************************************************************************************
+ * Copyright [2020] Renesas Electronics Corporation and/or its affiliates.  All Rights Reserved.
+ *
+ * This software and documentation are supplied by Renesas Electronics America Inc. and may only be used with products
+ * of Renesas Electronics Corp. and its affiliates ("Renesas").  No other uses are authorized.  Renesas products are
+ * sold pursuant to Renesas terms and conditions of sale.  Purchasers are solely responsible for the selection and use
+ * of Renesas products and Renesas assumes no liability.  No license, express or implied, to any intellectual property
+ * right is granted by Renesas. This software is protected under all applicable laws, including copyright laws. Renesas
+ * reserves the right to change or discontinue this software and/or this documentation. THE SOFTWARE AND DOCUMENTATION
+ * IS DELIVERED TO YOU "AS IS," AND RENESAS MAKES NO REPRESENTATIONS OR WARRANTIES, AND TO THE FULLEST EXTENT
+ * PERMISSIBLE UNDER APPLICABLE LAW, DISCLAIMS ALL WARRANTIES, WHETHER EXPLICITLY OR IMPLICITLY, INCLUDING WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, AND NONINFRINGEMENT, WITH RESPECT TO THE SOFTWARE OR
+ * DOCUMENTATION.  RENESAS SHALL HAVE NO LIABILITY ARISING OUT OF ANY SECURITY VULNERABILITY OR BREACH.  TO THE MAXIMUM
+ * EXTENT PERMITTED BY LAW, IN NO EVENT WILL RENESAS BE LIABLE TO YOU IN CONNECTION WITH THE SOFTWARE OR DOCUMENTATION
+ * (OR ANY PERSON OR ENTITY CLAIMING RIGHTS DERIVED FROM YOU) FOR ANY LOSS, DAMAGES, OR CLAIMS WHATSOEVER, INCLUDING,
+ * WITHOUT LIMITATION, ANY DIRECT, CONSEQUENTIAL, SPECIAL, INDIRECT, PUNITIVE, OR INCIDENTAL DAMAGES; ANY LOST PROFITS,
+ * OTHER ECONOMIC DAMAGE, PROPERTY DAMAGE, OR PERSONAL INJURY; AND EVEN IF RENESAS HAS BEEN ADVISED OF THE POSSIBILITY
+ * OF SUCH LOSS, DAMAGES, CLAIMS OR COSTS.
+ **********************************************************************************************************************/
+
+#ifndef RM_BLOCK_MEDIA_CACHE_H
+#define RM_BLOCK_MEDIA_CACHE_H
+
+/***********************************************************************************************************************
+ * Includes
+ **********************************************************************************************************************/
+#include "rm_block_media_api.h"
+
+/* Common macro for FSP header files. There is also a corresponding FSP_FOOTER macro at the end of this file. */
+FSP_HEADER
+
+/***********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+
+/** Sector cache entry. The contents are private to the block media modules. */
+typedef struct st_rm_block_media_cache_entry
+{
+    uint32_t sector;                   // Sector cached in this entry
+    uint32_t last_use;                 // Access tick for LRU eviction
+    bool     valid;                    // Entry holds a sector
+    bool     dirty;                    // Sector has not been written to the device yet
+} rm_block_media_cache_entry_t;
+
+/** Reads or writes sectors of the device for the cache. Returns when the transfer is complete. */
+typedef fsp_err_t (* rm_block_media_cache_transfer_t)(rm_block_media_ctrl_t * const p_ctrl, bool write,
+                                                      uint8_t * p_buffer, uint32_t sector, uint32_t num_sectors);
+
+/** Write-back sector cache shared by the block media modules. This is private to the FSP and should not be used or
+ * modified by the application. */
+typedef struct st_rm_block_media_cache
+{
+    rm_block_media_cache_entry_t  * p_entries;         // Array of num_sectors entries
+    uint8_t                       * p_buffer;          // num_sectors * sector_size_bytes of sector data
+    uint32_t                        num_sectors;       // Number of sectors in the cache, 0 if it is disabled
+    uint32_t                        sector_size_bytes; // Sector size of the device
+    uint32_t                        tick;              // Incremented on each cache access
+    rm_block_media_cache_transfer_t p_transfer;        // Device transfer of the block media module
+    rm_block_media_ctrl_t         * p_ctrl;            // Passed to p_transfer
+} rm_block_media_cache_t;
+
+/**********************************************************************************************************************
+ * Function Prototypes
+ **********************************************************************************************************************/
+void rm_block_media_cache_open(rm_block_media_cache_t * const       p_cache,
+                               rm_block_media_ctrl_t * const        p_ctrl,
+                               rm_block_media_cache_transfer_t      p_transfer,
+                               rm_block_media_cache_entry_t * const p_entries,
+                               uint8_t * const                      p_buffer,
+                               uint32_t                             num_sectors);
+void      rm_block_media_cache_invalidate(rm_block_media_cache_t * const p_cache, uint32_t sector_size_bytes);
+void      rm_block_media_cache_discard(rm_block_media_cache_t * const p_cache, uint32_t sector, uint32_t num_sectors);
+fsp_err_t rm_block_media_cache_read(rm_block_media_cache_t * const p_cache,
+                                    uint8_t * const                p_dest,
+                                    uint32_t                       sector,
+                                    uint32_t                       num_sectors);
+fsp_err_t rm_block_media_cache_write(rm_block_media_cache_t * const p_cache,
+                                     uint8_t const * const          p_src,
+                                     uint32_t                       sector,
+                                     uint32_t                       num_sectors);
+fsp_err_t rm_block_media_cache_sync(rm_block_media_cache_t * const p_cache);
+
+/* Common macro for FSP header files. There is also a corresponding FSP_HEADER macro at the top of this file. */
+FSP_FOOTER
+
+#endif                                 // RM_BLOCK_MEDIA_CACHE_H
@@ -25,6 +25,7 @@
  * Includes
  **********************************************************************************************************************/
 #include "rm_block_media_api.h"
+#include "rm_block_media_cache.h"
 #include "r_sdmmc_api.h"
 #if BSP_CFG_RTOS == 2
  #include "FreeRTOS.h"
@@ -48,11 +49,19 @@ FSP_HEADER
  * Typedef definitions
  **********************************************************************************************************************/
 
+/** Sector cache entry. The contents are private to the module. */
+typedef rm_block_media_cache_entry_t rm_block_media_sdmmc_cache_entry_t;
+
 /* Extended configuration structure. */
 typedef struct st_rm_block_media_sdmmc_extended_cfg
 {
     /** Add an SDMMC instance. */
     sdmmc_instance_t const * p_sdmmc;
+
+    /** Optional write-back sector cache. Set cache_num_sectors to 0 to disable the cache. */
+    rm_block_media_sdmmc_cache_entry_t * p_cache_entries; ///< Array of cache_num_sectors entries
+    uint8_t * p_cache_buffer;                             ///< cache_num_sectors * sector size bytes, 4-byte aligned
+    uint32_t  cache_num_sectors;                          ///< Number of sectors in the cache
 } rm_block_media_sdmmc_extended_cfg_t;
 
 /** Instance control block.  This is private to the FSP and should not be used or modified by the application. */
@@ -68,6 +77,10 @@ typedef struct st_rm_block_media_sdmmc_instance_ctrl
     void (* p_callback)(rm_block_media_callback_args_t *); // Pointer to callback
     rm_block_media_callback_args_t * p_callback_memory;    // Pointer to optional callback argument memory
     void const * p_context;                                // Pointer to context to be passed into callback function
+
+    rm_block_media_cache_t cache;                          // Write-back sector cache
+    volatile bool cache_transfer_pending;                  // Cache transfer waiting for the SDMMC callback
+    volatile bool cache_transfer_error;                    // Cache transfer reported an error
 } rm_block_media_sdmmc_instance_ctrl_t;
 
 /**********************************************************************************************************************
@@ -106,6 +119,7 @@ fsp_err_t RM_BLOCK_MEDIA_SDMMC_StatusGet(rm_block_media_ctrl_t * const   p_api_c
 fsp_err_t RM_BLOCK_MEDIA_SDMMC_InfoGet(rm_block_media_ctrl_t * const p_ctrl, rm_block_media_info_t * const p_info);
 fsp_err_t RM_BLOCK_MEDIA_SDMMC_Close(rm_block_media_ctrl_t * const p_ctrl);
 fsp_err_t RM_BLOCK_MEDIA_SDMMC_VersionGet(fsp_version_t * const p_version);
+fsp_err_t RM_BLOCK_MEDIA_SDMMC_CacheSync(rm_block_media_ctrl_t * const p_ctrl);
 
 /* Common macro for FSP header files. There is also a corresponding FSP_HEADER macro at the top of this file. */
 FSP_FOOTER
@@ -25,6 +25,7 @@
  * Includes
  **********************************************************************************************************************/
 #include "rm_block_media_api.h"
+#include "rm_block_media_cache.h"
 #include "r_usb_basic_api.h"
 #include "r_usb_basic_cfg.h"
 #include "r_usb_hmsc_api.h"
@@ -52,10 +53,26 @@ FSP_HEADER
  * Typedef definitions
  **********************************************************************************************************************/
 
+/** Sector cache entry. The contents are private to the module. */
+typedef rm_block_media_cache_entry_t rm_block_media_usb_cache_entry_t;
+
 /* Extended configuration structure. */
 typedef struct st_rm_block_media_usb_extended_cfg
 {
     usb_instance_t const * p_usb;
+
+    /** Optional write-back sector cache. Set cache_num_sectors to 0 to disable the cache. */
+    rm_block_media_usb_cache_entry_t * p_cache_entries; ///< Array of cache_num_sectors entries
+    uint8_t * p_cache_buffer;                           ///< cache_num_sectors * sector size bytes, 4-byte aligned
+    uint32_t  cache_num_sectors;                        ///< Number of sectors in the cache
+
+    /** Optional read-ahead for sequential reads. Set read_ahead_sectors to 0 to disable read-ahead. */
+    uint8_t * p_read_ahead_buffer;                      ///< read_ahead_sectors * sector size bytes, 4-byte aligned
+    uint32_t  read_ahead_sectors;                       ///< Sectors read from the device for a short sequential read
+
+    /** Optional gathering of consecutive writes. Set write_buffer_sectors to 0 to disable write gathering. */
+    uint8_t * p_write_buffer;                           ///< write_buffer_sectors * sector size bytes, 4-byte aligned
+    uint32_t  write_buffer_sectors;                     ///< Sectors collected before they are written in one transfer
 } rm_block_media_usb_extended_cfg_t;
 
 /** Instance control block.  This is private to the FSP and should not be used or modified by the application. */
@@ -69,6 +86,13 @@ typedef struct st_rm_block_media_usb_instance_ctrl
     bool               initialized;
     uint8_t            p_read_buffer[USB_HMSC_SECTOR_SIZE] __attribute__((__aligned__(4)));
     EventGroupHandle_t event_group;
+    rm_block_media_cache_t cache;        // Write-back sector cache
+    uint32_t           read_next;        // Sector following the previous read
+    bool               read_sequential;  // The current read continues the previous read
+    uint32_t           read_ahead_first; // First sector in the read-ahead buffer
+    uint32_t           read_ahead_count; // Number of sectors in the read-ahead buffer
+    uint32_t           write_first;      // First sector in the write buffer
+    uint32_t           write_count;      // Number of sectors in the write buffer
 } rm_block_media_usb_instance_ctrl_t;
 
 /**********************************************************************************************************************
@@ -108,6 +132,7 @@ fsp_err_t RM_BLOCK_MEDIA_USB_StatusGet(rm_block_media_ctrl_t * const   p_api_ctr
 fsp_err_t RM_BLOCK_MEDIA_USB_InfoGet(rm_block_media_ctrl_t * const p_ctrl, rm_block_media_info_t * const p_info);
 fsp_err_t RM_BLOCK_MEDIA_USB_Close(rm_block_media_ctrl_t * const p_ctrl);
 fsp_err_t RM_BLOCK_MEDIA_USB_VersionGet(fsp_version_t * const p_version);
+fsp_err_t RM_BLOCK_MEDIA_USB_CacheSync(rm_block_media_ctrl_t * const p_ctrl);
 
 /* Common macro for FSP header files. There is also a corresponding FSP_HEADER macro at the top of this file. */
 FSP_FOOTER
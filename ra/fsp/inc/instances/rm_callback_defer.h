@@ -0,0 +1,159 @@
+/***********************************************************************************************************************
+ * Copyright [2020] Renesas Electronics Corporation and/or its affiliates.  All Rights Reserved.
+ *
+ * This software and documentation are supplied by Renesas Electronics America Inc. and may only be used with products
+ * of Renesas Electronics Corp. and its affiliates ("Renesas").  No other uses are authorized.  Renesas products are
+ * sold pursuant to Renesas terms and conditions of sale.  Purchasers are solely responsible for the selection and use
+ * of Renesas products and Renesas assumes no liability.  No license, express or implied, to any intellectual property
+ * right is granted by Renesas. This software is protected under all applicable laws, including copyright laws. Renesas
+ * reserves the right to change or discontinue this software and/or this documentation. THE SOFTWARE AND DOCUMENTATION
+ * IS DELIVERED TO YOU "AS IS," AND RENESAS MAKES NO REPRESENTATIONS OR WARRANTIES, AND TO THE FULLEST EXTENT
+ * PERMISSIBLE UNDER APPLICABLE LAW, DISCLAIMS ALL WARRANTIES, WHETHER EXPLICITLY OR IMPLICITLY, INCLUDING WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, AND NONINFRINGEMENT, WITH RESPECT TO THE SOFTWARE OR
+ * DOCUMENTATION.  RENESAS SHALL HAVE NO LIABILITY ARISING OUT OF ANY SECURITY VULNERABILITY OR BREACH.  TO THE MAXIMUM
+ * EXTENT PERMITTED BY LAW, IN NO EVENT WILL RENESAS BE LIABLE TO YOU IN CONNECTION WITH THE SOFTWARE OR DOCUMENTATION
+ * (OR ANY PERSON OR ENTITY CLAIMING RIGHTS DERIVED FROM YOU) FOR ANY LOSS, DAMAGES, OR CLAIMS WHATSOEVER, INCLUDING,
+ * WITHOUT LIMITATION, ANY DIRECT, CONSEQUENTIAL, SPECIAL, INDIRECT, PUNITIVE, OR INCIDENTAL DAMAGES; ANY LOST PROFITS,
+ * OTHER ECONOMIC DAMAGE, PROPERTY DAMAGE, OR PERSONAL INJURY; AND EVEN IF RENESAS HAS BEEN ADVISED OF THE POSSIBILITY
+ * OF SUCH LOSS, DAMAGES, CLAIMS OR COSTS.
+ **********************************************************************************************************************/
+
+#ifndef RM_CALLBACK_DEFER_H
+#define RM_CALLBACK_DEFER_H
+
+/***********************************************************************************************************************
+ * Includes
+ **********************************************************************************************************************/
+#include "bsp_api.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "rm_callback_defer_cfg.h"
+
+/* Common macro for FSP header files. There is also a corresponding FSP_FOOTER macro at the end of this file. */
+FSP_HEADER
+
+/*******************************************************************************************************************//**
+ * @addtogroup RM_CALLBACK_DEFER
+ * @{
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+#define RM_CALLBACK_DEFER_CODE_VERSION_MAJOR    (1U)
+#define RM_CALLBACK_DEFER_CODE_VERSION_MINOR    (0U)
+
+/** Number of deferred-work priorities. Priority 0 is served first. */
+#ifndef RM_CALLBACK_DEFER_CFG_PRIORITIES
+ #define RM_CALLBACK_DEFER_CFG_PRIORITIES       (3U)
+#endif
+
+/** Largest driver callback argument structure that can be deferred, in bytes. */
+#ifndef RM_CALLBACK_DEFER_CFG_ARGS_MAX_BYTES
+ #define RM_CALLBACK_DEFER_CFG_ARGS_MAX_BYTES   (32U)
+#endif
+
+/** Defines a deferred client: a callback of type void name(args_t * p_args) to pass to the callbackSet API of a driver,
+ * and the client object it posts to. The driver ISR only copies its callback arguments and posts them; the worker task
+ * of the deferral instance then calls user_callback with the copy. The p_context set with callbackSet is copied with
+ * the arguments. For example, to run a UART callback from the worker task at priority 1:
+ *
+ * @code
+ * RM_CALLBACK_DEFER_CLIENT_DEFINE(g_uart0_deferred, &g_callback_defer_ctrl, uart_callback_args_t, user_uart_callback,
+ *                                 1U, false);
+ * ...
+ * err = R_SCI_UART_CallbackSet(&g_uart0_ctrl, g_uart0_deferred, NULL, NULL);
+ * @endcode
+ *
+ * With coalesce set, events posted while the previous one is still queued replace its arguments instead of queueing
+ * again, so only the latest event is delivered. Do not coalesce events that carry data, such as UART_EVENT_RX_CHAR. */
+#define RM_CALLBACK_DEFER_CLIENT_DEFINE(name, p_defer_ctrl, args_t, user_callback, prio, coalesce_events)       \
+    typedef char name ## _args_fit_t[(sizeof(args_t) <= RM_CALLBACK_DEFER_CFG_ARGS_MAX_BYTES) ? 1 : -1];          \
+    static void name ## _dispatch (void const * p_args)                                                         \
+    {                                                                                                            \
+        user_callback((args_t *) p_args);                                                                        \
+    }                                                                                                            \
+    rm_callback_defer_client_t name ## _client =                                                                 \
+    {                                                                                                            \
+        .p_ctrl     = (p_defer_ctrl),                                                                            \
+        .p_dispatch = name ## _dispatch,                                                                         \
+        .args_size  = sizeof(args_t),                                                                            \
+        .priority   = (prio),                                                                                    \
+        .coalesce   = (coalesce_events),                                                                         \
+    };                                                                                                           \
+    void name (args_t * p_args)                                                                                  \
+    {                                                                                                            \
+        RM_CALLBACK_DEFER_Post(&name ## _client, p_args);                                                        \
+    }
+
+/***********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+
+/** Event counters of one client */
+typedef struct st_rm_callback_defer_client_status
+{
+    uint32_t posted;                   ///< Events posted by the driver
+    uint32_t coalesced;                ///< Events merged into one already queued
+    uint32_t dropped;                  ///< Events lost because the queue of the client priority was full
+} rm_callback_defer_client_status_t;
+
+struct st_rm_callback_defer_instance_ctrl;
+
+/** Deferred client, defined with RM_CALLBACK_DEFER_CLIENT_DEFINE. */
+typedef struct st_rm_callback_defer_client
+{
+    struct st_rm_callback_defer_instance_ctrl * p_ctrl;    ///< Deferral instance serving the client
+    void (* p_dispatch)(void const * p_args);              ///< Calls the user callback with the copied arguments
+    uint32_t args_size;                                    ///< Size of the driver callback arguments
+    uint32_t priority;                                     ///< Deferred-work priority, 0 is served first
+    bool     coalesce;                                     ///< Deliver only the latest of the events queued
+    volatile bool                     pending;             ///< A coalesced event is queued
+    rm_callback_defer_client_status_t status;              ///< Event counters
+
+    /** Arguments of the latest coalesced event. */
+    uint32_t latest[(RM_CALLBACK_DEFER_CFG_ARGS_MAX_BYTES + 3U) / 4U];
+} rm_callback_defer_client_t;
+
+/** User configuration structure, used in open function */
+typedef struct st_rm_callback_defer_cfg
+{
+    char const * p_name;                       ///< Worker task name
+    uint32_t     stack_words;                  ///< Worker task stack depth, in words
+    UBaseType_t  task_priority;                ///< Worker task priority
+    uint32_t     queue_length[RM_CALLBACK_DEFER_CFG_PRIORITIES]; ///< Events each deferred-work priority can queue
+} rm_callback_defer_cfg_t;
+
+/** Instance control block.  This is private to the FSP and should not be used or modified by the application. */
+typedef struct st_rm_callback_defer_instance_ctrl
+{
+    uint32_t                        open;
+    rm_callback_defer_cfg_t const * p_cfg;
+    TaskHandle_t                    task;                                     // Worker task
+    QueueHandle_t                   queue[RM_CALLBACK_DEFER_CFG_PRIORITIES]; // Queued events, one queue per priority
+} rm_callback_defer_instance_ctrl_t;
+
+/**********************************************************************************************************************
+ * Exported global variables
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Public APIs
+ **********************************************************************************************************************/
+fsp_err_t RM_CALLBACK_DEFER_Open(rm_callback_defer_instance_ctrl_t * const p_ctrl,
+                                 rm_callback_defer_cfg_t const * const     p_cfg);
+void      RM_CALLBACK_DEFER_Post(rm_callback_defer_client_t * const p_client, void const * const p_args);
+fsp_err_t RM_CALLBACK_DEFER_StatusGet(rm_callback_defer_client_t * const        p_client,
+                                      rm_callback_defer_client_status_t * const p_status);
+fsp_err_t RM_CALLBACK_DEFER_Close(rm_callback_defer_instance_ctrl_t * const p_ctrl);
+fsp_err_t RM_CALLBACK_DEFER_VersionGet(fsp_version_t * const p_version);
+
+/* Common macro for FSP header files. There is also a corresponding FSP_HEADER macro at the top of this file. */
+FSP_FOOTER
+
+#endif                                 // RM_CALLBACK_DEFER_H
+
+/*******************************************************************************************************************//**
+ * @} (end addtogroup RM_CALLBACK_DEFER)
+ **********************************************************************************************************************/
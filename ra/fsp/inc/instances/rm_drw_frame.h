@@ -0,0 +1,178 @@
+/***********************************************************************************************************************
+ * Copyright [2020] Renesas Electronics Corporation and/or its affiliates.  All Rights Reserved.
+ *
+ * This software and documentation are supplied by Renesas Electronics America Inc. and may only be used with products
+ * of Renesas Electronics Corp. and its affiliates ("Renesas").  No other uses are authorized.  Renesas products are
+ * sold pursuant to Renesas terms and conditions of sale.  Purchasers are solely responsible for the selection and use
+ * of Renesas products and Renesas assumes no liability.  No license, express or implied, to any intellectual property
+ * right is granted by Renesas. This software is protected under all applicable laws, including copyright laws. Renesas
+ * reserves the right to change or discontinue this software and/or this documentation. THE SOFTWARE AND DOCUMENTATION
+ * IS DELIVERED TO YOU "AS IS," AND RENESAS MAKES NO REPRESENTATIONS OR WARRANTIES, AND TO THE FULLEST EXTENT
+ * PERMISSIBLE UNDER APPLICABLE LAW, DISCLAIMS ALL WARRANTIES, WHETHER EXPLICITLY OR IMPLICITLY, INCLUDING WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, AND NONINFRINGEMENT, WITH RESPECT TO THE SOFTWARE OR
+ * DOCUMENTATION.  RENESAS SHALL HAVE NO LIABILITY ARISING OUT OF ANY SECURITY VULNERABILITY OR BREACH.  TO THE MAXIMUM
+ * EXTENT PERMITTED BY LAW, IN NO EVENT WILL RENESAS BE LIABLE TO YOU IN CONNECTION WITH THE SOFTWARE OR DOCUMENTATION
+ * (OR ANY PERSON OR ENTITY CLAIMING RIGHTS DERIVED FROM YOU) FOR ANY LOSS, DAMAGES, OR CLAIMS WHATSOEVER, INCLUDING,
+ * WITHOUT LIMITATION, ANY DIRECT, CONSEQUENTIAL, SPECIAL, INDIRECT, PUNITIVE, OR INCIDENTAL DAMAGES; ANY LOST PROFITS,
+ * OTHER ECONOMIC DAMAGE, PROPERTY DAMAGE, OR PERSONAL INJURY; AND EVEN IF RENESAS HAS BEEN ADVISED OF THE POSSIBILITY
+ * OF SUCH LOSS, DAMAGES, CLAIMS OR COSTS.
+ **********************************************************************************************************************/
+
+#ifndef RM_DRW_FRAME_H
+#define RM_DRW_FRAME_H
+
+/***********************************************************************************************************************
+ * Includes
+ **********************************************************************************************************************/
+#include "bsp_api.h"
+#include "r_display_api.h"
+#include "dave_driver.h"
+#include "rm_drw_frame_cfg.h"
+
+/* Common macro for FSP header files. There is also a corresponding FSP_FOOTER macro at the end of this file. */
+FSP_HEADER
+
+/*******************************************************************************************************************//**
+ * @addtogroup RM_DRW_FRAME
+ * @{
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+#define RM_DRW_FRAME_CODE_VERSION_MAJOR    (1U)
+#define RM_DRW_FRAME_CODE_VERSION_MINOR    (0U)
+
+/** Maximum number of frame buffers managed by the scheduler. */
+#define RM_DRW_FRAME_BUFFER_MAX            (4U)
+
+/** Number of D/AVE 2D performance counters. */
+#define RM_DRW_FRAME_PERF_COUNTERS         (2U)
+
+/***********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+
+/** Events reported to the callback function from the display line detection interrupt. */
+typedef enum e_rm_drw_frame_event
+{
+    RM_DRW_FRAME_EVENT_FRAME_DISPLAYED = 0, ///< A new frame is being scanned out, a frame buffer may have been freed
+    RM_DRW_FRAME_EVENT_FRAME_REPEATED  = 1, ///< No new frame was ready, the previous frame is scanned out again
+} rm_drw_frame_event_t;
+
+/** Callback function parameter structure */
+typedef struct st_rm_drw_frame_callback_args
+{
+    rm_drw_frame_event_t event;        ///< Event code
+    void const         * p_context;    ///< Context provided to user during callback
+} rm_drw_frame_callback_args_t;
+
+/** Frame statistics. Times are in ticks of rm_drw_frame_cfg_t::p_timestamp_get and are 0 if no timestamp source is
+ * configured. */
+typedef struct st_rm_drw_frame_statistics
+{
+    uint32_t frames_rendered;          ///< Frames completed by the D/AVE 2D
+    uint32_t frames_displayed;         ///< Frames that reached the display
+    uint32_t frames_dropped;           ///< Completed frames replaced by a newer frame before they were displayed
+    uint32_t frames_repeated;          ///< Vertical blanks without a new frame to display
+    uint32_t render_time_last;         ///< Time from RM_DRW_FRAME_Begin until rendering was complete, last frame
+    uint32_t render_time_max;          ///< Maximum of render_time_last
+    uint32_t scanout_latency_last;     ///< Time from completion of rendering until scanout started, last frame
+    uint32_t scanout_latency_max;      ///< Maximum of scanout_latency_last
+
+    /** Underflow events per graphics layer (index 0: layer 1, index 1: layer 2). */
+    uint32_t underflows[2];
+
+    /** Estimated line of the last underflow per graphics layer, counted from the line detection position. Needs a
+     * timestamp source. */
+    uint32_t underflow_line_last[2];
+
+    uint32_t perf_count_last[RM_DRW_FRAME_PERF_COUNTERS]; ///< Performance counter totals of the last rendered frame
+    uint32_t perf_count_max[RM_DRW_FRAME_PERF_COUNTERS];  ///< Maximum of perf_count_last
+    uint8_t  throttle_level;                              ///< Current adaptive step, 0 if frames are not throttled
+    uint8_t  tiles;                                       ///< Number of bands frames are currently rendered in
+    bool     other_layer_disabled;                        ///< The other graphics layer is disabled to save bandwidth
+} rm_drw_frame_statistics_t;
+
+/** User configuration structure, used in open function */
+typedef struct st_rm_drw_frame_cfg
+{
+    /** Opened display instance. The line detection interrupt must be enabled and should be set to the first line of the
+     * vertical blanking period. Its callback must call rm_drw_frame_display_callback(). */
+    display_instance_t const * p_display;
+    display_frame_layer_t      layer;             ///< Graphics layer the frames are displayed on
+    d2_device                * p_d2_handle;       ///< Opened and initialized D/AVE 2D device
+    uint8_t * const          * pp_buffers;        ///< Frame buffers, sized as the layer input setting
+    uint8_t                    num_buffers;       ///< Number of frame buffers (3 for triple buffering)
+    d2_s32                     d2_format;         ///< D/AVE 2D pixel format of the frame buffers, e.g. d2_mode_rgb565
+
+    /** Optional free running timestamp source for the timing statistics, or NULL. */
+    uint32_t (* p_timestamp_get)(void);
+
+    /** D/AVE 2D performance counter events (d2_pc_*) totalled per frame, d2_pc_disable to leave a counter unused.
+     * d2_pc_fbwordsread, d2_pc_fbwordswritten and d2_pc_texwordsread measure the external memory traffic. */
+    d2_u32 perf_events[RM_DRW_FRAME_PERF_COUNTERS];
+
+    /** Adaptive underflow prevention. Each vertical blank after an underflow raises the throttle level by one step:
+     * frames are rendered in 2, 4, ... horizontal bands up to tiles_max, then the other graphics layer is disabled if
+     * p_other_layer_buffer is set. The level drops by one step after recovery_frames vertical blanks without underflow.
+     * The display underflow interrupts must be enabled. */
+    uint8_t   tiles_max;                ///< Maximum number of bands, 0 or 1 disables render throttling
+    uint16_t  recovery_frames;          ///< Vertical blanks without underflow before the throttle level is lowered
+    uint8_t * p_other_layer_buffer;     ///< Buffer shown on the other layer, restored when re-enabling it, or NULL
+
+    void (* p_callback)(rm_drw_frame_callback_args_t * p_args); ///< Optional callback called at vertical blank
+    void const * p_context;                                      ///< User defined context passed to the callback
+} rm_drw_frame_cfg_t;
+
+/** Instance control block.  This is private to the FSP and should not be used or modified by the application. */
+typedef struct st_rm_drw_frame_instance_ctrl
+{
+    uint32_t                   open;
+    rm_drw_frame_cfg_t const * p_cfg;
+    volatile uint8_t           displayed;                  // Buffer scanned out by the display
+    volatile uint8_t           flip_pending;               // Buffer passed to the display, latched at next vblank
+    volatile uint8_t           queued;                     // Rendered buffer waiting for the next vertical blank
+    uint8_t                    rendering;                  // Buffer the D/AVE 2D is executing the display list for
+    uint8_t                    recording;                  // Buffer between RM_DRW_FRAME_Begin and RM_DRW_FRAME_End
+    uint32_t                   begin_time;                 // Timestamp of RM_DRW_FRAME_Begin for the recording buffer
+    uint32_t                   render_time;                // Timestamp of RM_DRW_FRAME_Begin for the rendering buffer
+    uint32_t                   queue_time[RM_DRW_FRAME_BUFFER_MAX]; // Timestamp when each buffer was queued
+    uint32_t                   perf_count[RM_DRW_FRAME_PERF_COUNTERS]; // Counter totals of the frame being rendered
+    uint8_t                    tile_count;                 // Bands of the recording frame
+    uint8_t                    tile_index;                 // Band being recorded
+    uint8_t                    throttle_max;               // Highest throttle level
+    volatile uint8_t           throttle_level;             // Throttle level, updated at vertical blank
+    volatile uint32_t          frame_underflows;           // Underflows since the last vertical blank
+    uint32_t                   calm_frames;                // Vertical blanks without underflow at the current level
+    uint32_t                   vblank_time;                // Timestamp of the last line detection
+    uint32_t                   frame_period;               // Timestamp ticks between the last two line detections
+    rm_drw_frame_statistics_t  statistics;
+} rm_drw_frame_instance_ctrl_t;
+
+/**********************************************************************************************************************
+ * Exported global variables
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Public APIs
+ **********************************************************************************************************************/
+fsp_err_t RM_DRW_FRAME_Open(rm_drw_frame_instance_ctrl_t * const p_ctrl, rm_drw_frame_cfg_t const * const p_cfg);
+fsp_err_t RM_DRW_FRAME_Begin(rm_drw_frame_instance_ctrl_t * const p_ctrl, uint8_t ** const pp_framebuffer);
+fsp_err_t RM_DRW_FRAME_TileNext(rm_drw_frame_instance_ctrl_t * const p_ctrl, bool * const p_more);
+fsp_err_t RM_DRW_FRAME_End(rm_drw_frame_instance_ctrl_t * const p_ctrl);
+fsp_err_t RM_DRW_FRAME_StatisticsGet(rm_drw_frame_instance_ctrl_t * const p_ctrl,
+                                     rm_drw_frame_statistics_t * const    p_statistics);
+fsp_err_t RM_DRW_FRAME_Close(rm_drw_frame_instance_ctrl_t * const p_ctrl);
+fsp_err_t RM_DRW_FRAME_VersionGet(fsp_version_t * const p_version);
+
+void rm_drw_frame_display_callback(display_callback_args_t * p_args);
+
+/* Common macro for FSP header files. There is also a corresponding FSP_HEADER macro at the top of this file. */
+FSP_FOOTER
+
+#endif                                 // RM_DRW_FRAME_H
+
+/*******************************************************************************************************************//**
+ * @} (end defgroup RM_DRW_FRAME)
+ **********************************************************************************************************************/
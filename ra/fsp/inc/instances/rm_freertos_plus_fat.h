@@ -58,6 +58,12 @@ typedef struct
     rm_freertos_plus_fat_cfg_t const * p_cfg;
     volatile rm_block_media_event_t    last_event;
     bool reentrant;
+    uint32_t sector_size;              // Sector size of the media, set in RM_FREERTOS_PLUS_FAT_MediaInit
+    uint32_t next_sector;              // Sector following the last read, used to detect sequential access
+    uint32_t read_ahead_sector;        // First sector held or being read into the read-ahead buffer
+    uint32_t read_ahead_count;         // Sectors held or being read into the read-ahead buffer
+    bool     read_ahead_valid;         // Read-ahead buffer holds read_ahead_count sectors
+    bool     read_ahead_pending;       // Read-ahead request in flight on the block media
  #if 2 == BSP_CFG_RTOS
     volatile TaskHandle_t current_task;
     SemaphoreHandle_t     p_mutex;
@@ -66,6 +72,22 @@ typedef struct
  #endif
 } rm_freertos_plus_fat_instance_ctrl_t;
 
+/** Contiguous append-only log file. Set p_disk, p_buffer and buffer_size_bytes before calling
+ * RM_FREERTOS_PLUS_FAT_LogCreate or RM_FREERTOS_PLUS_FAT_LogOpen. The remaining members are internal. */
+typedef struct st_rm_freertos_plus_fat_log
+{
+    FF_Disk_t * p_disk;                ///< Mounted disk holding the log file
+    uint8_t   * p_buffer;              ///< Streaming buffer, must be 4 byte aligned
+    uint32_t    buffer_size_bytes;     ///< Multiple of the sector size and at least 2 sectors. Larger buffers give
+                                       ///< longer multi-block writes. The last sector is used for header I/O.
+    uint32_t header_sector;            // First sector of the file, holds the two checkpoint headers
+    uint32_t data_sectors;             // Sectors available for log data
+    uint32_t length;                   // Bytes appended to the log
+    uint32_t buffer_sector;            // Data sector held at the start of p_buffer
+    uint32_t buffer_used;              // Bytes held in p_buffer
+    uint32_t sequence;                 // Sequence number of the last checkpoint header written
+} rm_freertos_plus_fat_log_t;
+
 /**********************************************************************************************************************
  * Public Function Prototypes
  **********************************************************************************************************************/
@@ -83,6 +105,21 @@ fsp_err_t RM_FREERTOS_PLUS_FAT_InfoGet(rm_freertos_plus_fat_ctrl_t * const p_ctr
                                        rm_freertos_plus_fat_info_t * const p_info);
 fsp_err_t RM_FREERTOS_PLUS_FAT_Close(rm_freertos_plus_fat_ctrl_t * const p_ctrl);
 fsp_err_t RM_FREERTOS_PLUS_FAT_VersionGet(fsp_version_t * const p_version);
+fsp_err_t RM_FREERTOS_PLUS_FAT_LogCreate(rm_freertos_plus_fat_ctrl_t * const p_ctrl,
+                                         rm_freertos_plus_fat_log_t * const  p_log,
+                                         char const * const                  p_path,
+                                         uint32_t const                      size_bytes);
+fsp_err_t RM_FREERTOS_PLUS_FAT_LogOpen(rm_freertos_plus_fat_ctrl_t * const p_ctrl,
+                                       rm_freertos_plus_fat_log_t * const  p_log,
+                                       char const * const                  p_path);
+fsp_err_t RM_FREERTOS_PLUS_FAT_LogWrite(rm_freertos_plus_fat_ctrl_t * const p_ctrl,
+                                        rm_freertos_plus_fat_log_t * const  p_log,
+                                        uint8_t const * const               p_data,
+                                        uint32_t const                      bytes);
+fsp_err_t RM_FREERTOS_PLUS_FAT_LogCheckpoint(rm_freertos_plus_fat_ctrl_t * const p_ctrl,
+                                             rm_freertos_plus_fat_log_t * const  p_log);
+fsp_err_t RM_FREERTOS_PLUS_FAT_LogClose(rm_freertos_plus_fat_ctrl_t * const p_ctrl,
+                                        rm_freertos_plus_fat_log_t * const  p_log);
 
  #ifdef __cplusplus
 }                                      /* extern "C" */
@@ -0,0 +1,128 @@
+/***********************************************************************************************************************
+ * Copyright [2020] Renesas Electronics Corporation and/or its affiliates.  All Rights Reserved.
+ *
+ * This software and documentation are supplied by Renesas Electronics America Inc. and may only be used with products
+ * of Renesas Electronics Corp. and its affiliates ("Renesas").  No other uses are authorized.  Renesas products are
+ * sold pursuant to Renesas terms and conditions of sale.  Purchasers are solely responsible for the selection and use
+ * of Renesas products and Renesas assumes no liability.  No license, express or implied, to any intellectual property
+ * right is granted by Renesas. This software is protected under all applicable laws, including copyright laws. Renesas
+ * reserves the right to change or discontinue this software and/or this documentation. THE SOFTWARE AND DOCUMENTATION
+ * IS DELIVERED TO YOU "AS IS," AND RENESAS MAKES NO REPRESENTATIONS OR WARRANTIES, AND TO THE FULLEST EXTENT
+ * PERMISSIBLE UNDER APPLICABLE LAW, DISCLAIMS ALL WARRANTIES, WHETHER EXPLICITLY OR IMPLICITLY, INCLUDING WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, AND NONINFRINGEMENT, WITH RESPECT TO THE SOFTWARE OR
+ * DOCUMENTATION.  RENESAS SHALL HAVE NO LIABILITY ARISING OUT OF ANY SECURITY VULNERABILITY OR BREACH.  TO THE MAXIMUM
+ * EXTENT PERMITTED BY LAW, IN NO EVENT WILL RENESAS BE LIABLE TO YOU IN CONNECTION WITH THE SOFTWARE OR DOCUMENTATION
+ * (OR ANY PERSON OR ENTITY CLAIMING RIGHTS DERIVED FROM YOU) FOR ANY LOSS, DAMAGES, OR CLAIMS WHATSOEVER, INCLUDING,
+ * WITHOUT LIMITATION, ANY DIRECT, CONSEQUENTIAL, SPECIAL, INDIRECT, PUNITIVE, OR INCIDENTAL DAMAGES; ANY LOST PROFITS,
+ * OTHER ECONOMIC DAMAGE, PROPERTY DAMAGE, OR PERSONAL INJURY; AND EVEN IF RENESAS HAS BEEN ADVISED OF THE POSSIBILITY
+ * OF SUCH LOSS, DAMAGES, CLAIMS OR COSTS.
+ **********************************************************************************************************************/
+
+#ifndef RM_FREERTOS_RUNTIME_STATS_H
+#define RM_FREERTOS_RUNTIME_STATS_H
+
+/***********************************************************************************************************************
+ * Includes
+ **********************************************************************************************************************/
+#include "bsp_api.h"
+#include "r_timer_api.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include "rm_freertos_runtime_stats_cfg.h"
+
+/* Common macro for FSP header files. There is also a corresponding FSP_FOOTER macro at the end of this file. */
+FSP_HEADER
+
+/*******************************************************************************************************************//**
+ * @addtogroup RM_FREERTOS_RUNTIME_STATS
+ * @{
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+#define RM_FREERTOS_RUNTIME_STATS_CODE_VERSION_MAJOR    (1U)
+#define RM_FREERTOS_RUNTIME_STATS_CODE_VERSION_MINOR    (0U)
+
+/** CPU load reported when the idle task handle is not available (INCLUDE_xTaskGetIdleTaskHandle is 0). */
+#define RM_FREERTOS_RUNTIME_STATS_LOAD_UNKNOWN          (0xFFFFFFFFU)
+
+/***********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+
+/** Usage of one task */
+typedef struct st_rm_freertos_runtime_stats_task
+{
+    TaskHandle_t task;                 ///< Task handle
+    char const * p_name;               ///< Task name
+    UBaseType_t  task_number;          ///< Unique number assigned by FreeRTOS, the entries are sorted by it
+    UBaseType_t  priority;             ///< Current priority
+    uint32_t     run_time;             ///< Run time counts since the task was created
+    uint32_t     load_permille;        ///< Share of the interval since the previous call
+    uint32_t     total_permille;       ///< Share of the run time since the timer was started
+    uint32_t     stack_free_min_bytes; ///< Smallest amount of free stack the task has had
+} rm_freertos_runtime_stats_task_t;
+
+/** Usage of all tasks over the interval since the previous call to RM_FREERTOS_RUNTIME_STATS_TaskUsageGet */
+typedef struct st_rm_freertos_runtime_stats_usage
+{
+    uint32_t num_tasks;                ///< Entries of rm_freertos_runtime_stats_cfg_t::p_tasks that are valid
+    uint32_t interval_counts;          ///< Run time counts in the interval
+    uint32_t cpu_load_permille;        ///< Share of the interval the idle task did not run, or LOAD_UNKNOWN
+} rm_freertos_runtime_stats_usage_t;
+
+/** User configuration structure, used in open function */
+typedef struct st_rm_freertos_runtime_stats_cfg
+{
+    /** Periodic GPT or AGT instance that times the run time counter, opened and started by
+     * RM_FREERTOS_RUNTIME_STATS_Open. FreeRTOS recommends a count frequency 10 to 100 times the tick rate. Its cycle
+     * end interrupt must be enabled, and the callback of the instance is replaced by this module. A 32-bit GPT with the
+     * maximum period keeps the interrupt rate lowest. */
+    timer_instance_t const * p_timer;
+
+    /** Work buffer of num_tasks entries for uxTaskGetSystemState. */
+    TaskStatus_t * p_status;
+
+    /** Output of RM_FREERTOS_RUNTIME_STATS_TaskUsageGet, num_tasks entries. The previous output is used to compute the
+     * load over the interval, so it must not be modified by the application. */
+    rm_freertos_runtime_stats_task_t * p_tasks;
+
+    uint32_t num_tasks;                ///< Number of tasks that can be reported, at least uxTaskGetNumberOfTasks()
+} rm_freertos_runtime_stats_cfg_t;
+
+/** Instance control block.  This is private to the FSP and should not be used or modified by the application. */
+typedef struct st_rm_freertos_runtime_stats_instance_ctrl
+{
+    uint32_t                                open;
+    rm_freertos_runtime_stats_cfg_t const * p_cfg;
+    uint32_t          period_counts;   // Timer period, 0 for 2^32 counts
+    bool              count_down;      // The timer counts down from period_counts - 1
+    volatile uint32_t overflows;       // Cycle end interrupts serviced
+    uint32_t          last_total;      // Run time counter at the previous RM_FREERTOS_RUNTIME_STATS_TaskUsageGet
+    uint32_t          last_num_tasks;  // Valid entries of p_tasks
+} rm_freertos_runtime_stats_instance_ctrl_t;
+
+/**********************************************************************************************************************
+ * Exported global variables
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Public APIs
+ **********************************************************************************************************************/
+fsp_err_t RM_FREERTOS_RUNTIME_STATS_Open(rm_freertos_runtime_stats_instance_ctrl_t * const p_ctrl,
+                                         rm_freertos_runtime_stats_cfg_t const * const     p_cfg);
+uint32_t  RM_FREERTOS_RUNTIME_STATS_CounterGet(void);
+fsp_err_t RM_FREERTOS_RUNTIME_STATS_TaskUsageGet(rm_freertos_runtime_stats_instance_ctrl_t * const p_ctrl,
+                                                 rm_freertos_runtime_stats_usage_t * const         p_usage);
+fsp_err_t RM_FREERTOS_RUNTIME_STATS_Close(rm_freertos_runtime_stats_instance_ctrl_t * const p_ctrl);
+fsp_err_t RM_FREERTOS_RUNTIME_STATS_VersionGet(fsp_version_t * const p_version);
+
+/* Common macro for FSP header files. There is also a corresponding FSP_HEADER macro at the top of this file. */
+FSP_FOOTER
+
+#endif                                 // RM_FREERTOS_RUNTIME_STATS_H
+
+/*******************************************************************************************************************//**
+ * @} (end defgroup RM_FREERTOS_RUNTIME_STATS)
+ **********************************************************************************************************************/
@@ -0,0 +1,178 @@
+/***********************************************************************************************************************
+ * Copyright [2020] Renesas Electronics Corporation and/or its affiliates.  All Rights Reserved.
+ *
+ * This software and documentation are supplied by Renesas Electronics America Inc. and may only be used with products
+ * of Renesas Electronics Corp. and its affiliates ("Renesas").  No other uses are authorized.  Renesas products are
+ * sold pursuant to Renesas terms and conditions of sale.  Purchasers are solely responsible for the selection and use
+ * of Renesas products and Renesas assumes no liability.  No license, express or implied, to any intellectual property
+ * right is granted by Renesas. This software is protected under all applicable laws, including copyright laws. Renesas
+ * reserves the right to change or discontinue this software and/or this documentation. THE SOFTWARE AND DOCUMENTATION
+ * IS DELIVERED TO YOU "AS IS," AND RENESAS MAKES NO REPRESENTATIONS OR WARRANTIES, AND TO THE FULLEST EXTENT
+ * PERMISSIBLE UNDER APPLICABLE LAW, DISCLAIMS ALL WARRANTIES, WHETHER EXPLICITLY OR IMPLICITLY, INCLUDING WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, AND NONINFRINGEMENT, WITH RESPECT TO THE SOFTWARE OR
+ * DOCUMENTATION.  RENESAS SHALL HAVE NO LIABILITY ARISING OUT OF ANY SECURITY VULNERABILITY OR BREACH.  TO THE MAXIMUM
+ * EXTENT PERMITTED BY LAW, IN NO EVENT WILL RENESAS BE LIABLE TO YOU IN CONNECTION WITH THE SOFTWARE OR DOCUMENTATION
+ * (OR ANY PERSON OR ENTITY CLAIMING RIGHTS DERIVED FROM YOU) FOR ANY LOSS, DAMAGES, OR CLAIMS WHATSOEVER, INCLUDING,
+ * WITHOUT LIMITATION, ANY DIRECT, CONSEQUENTIAL, SPECIAL, INDIRECT, PUNITIVE, OR INCIDENTAL DAMAGES; ANY LOST PROFITS,
+ * OTHER ECONOMIC DAMAGE, PROPERTY DAMAGE, OR PERSONAL INJURY; AND EVEN IF RENESAS HAS BEEN ADVISED OF THE POSSIBILITY
+ * OF SUCH LOSS, DAMAGES, CLAIMS OR COSTS.
+ **********************************************************************************************************************/
+
+#ifndef RM_GLCDC_COMPOSITOR_H
+#define RM_GLCDC_COMPOSITOR_H
+
+/***********************************************************************************************************************
+ * Includes
+ **********************************************************************************************************************/
+#include "bsp_api.h"
+#include "r_display_api.h"
+#include "rm_glcdc_compositor_cfg.h"
+
+/* Common macro for FSP header files. There is also a corresponding FSP_FOOTER macro at the end of this file. */
+FSP_HEADER
+
+/*******************************************************************************************************************//**
+ * @addtogroup RM_GLCDC_COMPOSITOR
+ * @{
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+#define RM_GLCDC_COMPOSITOR_CODE_VERSION_MAJOR    (1U)
+#define RM_GLCDC_COMPOSITOR_CODE_VERSION_MINOR    (0U)
+
+/** Number of graphics layers composited by the GLCDC. */
+#define RM_GLCDC_COMPOSITOR_LAYER_NUM             (2U)
+
+/***********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+
+/** Events reported to the callback function from the display line detection interrupt. */
+typedef enum e_rm_glcdc_compositor_event
+{
+    RM_GLCDC_COMPOSITOR_EVENT_MOVE_COMPLETE   = 0, ///< The layer reached the target of RM_GLCDC_COMPOSITOR_Move
+    RM_GLCDC_COMPOSITOR_EVENT_FADE_COMPLETE   = 1, ///< The fade of the layer completed, a faded out layer is hidden
+    RM_GLCDC_COMPOSITOR_EVENT_BUFFER_RELEASED = 2, ///< New content of the layer is on the display, the layer can be
+                                                   ///< rendered again
+} rm_glcdc_compositor_event_t;
+
+/** Callback function parameter structure */
+typedef struct st_rm_glcdc_compositor_callback_args
+{
+    rm_glcdc_compositor_event_t event; ///< Event code
+    display_frame_layer_t       layer; ///< Layer the event is for
+    void const                * p_context; ///< Context provided to user during callback
+} rm_glcdc_compositor_callback_args_t;
+
+/** Render function parameter structure */
+typedef struct st_rm_glcdc_compositor_render_args
+{
+    display_frame_layer_t layer;       ///< Layer whose content is rendered
+    uint8_t             * p_buffer;    ///< Buffer to render into, sized as the display input setting of the layer
+    void const          * p_context;   ///< Context provided to user during callback
+} rm_glcdc_compositor_render_args_t;
+
+/** Configuration of one graphics layer. */
+typedef struct st_rm_glcdc_compositor_layer_cfg
+{
+    /** Content buffers, sized and aligned as the display input setting of the layer. With two buffers content is
+     * rendered into the one not on the display and swapped in at vertical blank. With only p_buffers[0] content is
+     * rendered in place. Set both to NULL to leave the layer alone. */
+    uint8_t * p_buffers[2];
+
+    display_coordinate_t position;     ///< Initial position of the layer
+    bool                 visible;      ///< Show the layer once its content is first rendered
+} rm_glcdc_compositor_layer_cfg_t;
+
+/** Compositor statistics. */
+typedef struct st_rm_glcdc_compositor_statistics
+{
+    uint32_t renders[RM_GLCDC_COMPOSITOR_LAYER_NUM]; ///< Calls of the render function per layer
+    uint32_t layer_changes;                          ///< Layer settings written to the display
+    uint32_t layer_change_retries;                   ///< Layer changes postponed because the display was busy
+} rm_glcdc_compositor_statistics_t;
+
+/** User configuration structure, used in open function */
+typedef struct st_rm_glcdc_compositor_cfg
+{
+    /** Opened display instance. The line detection interrupt must be enabled and should be set to the first line of the
+     * vertical blanking period. Its callback must call rm_glcdc_compositor_display_callback(). */
+    display_instance_t const * p_display;
+
+    rm_glcdc_compositor_layer_cfg_t layer[RM_GLCDC_COMPOSITOR_LAYER_NUM]; ///< Layer 1 and layer 2 settings
+
+    /** Renders the content of a layer, called from RM_GLCDC_COMPOSITOR_Update. The content must be complete in the
+     * buffer when the function returns, e.g. after d2_flushframe(). */
+    void (* p_render)(rm_glcdc_compositor_render_args_t * p_args);
+
+    void (* p_callback)(rm_glcdc_compositor_callback_args_t * p_args); ///< Optional callback called at vertical blank
+    void const * p_context;                                             ///< Context passed to the callbacks
+} rm_glcdc_compositor_cfg_t;
+
+/** State of one graphics layer. This is private to the FSP and should not be used or modified by the application. */
+typedef struct st_rm_glcdc_compositor_layer
+{
+    display_coordinate_t            position;     // Position of the layer on the display
+    display_coordinate_t            move_start;   // Position at the start of the slide
+    display_coordinate_t            move_target;  // Position at the end of the slide
+    uint16_t                        move_frames;  // Length of the slide in vertical blanks
+    uint16_t                        move_frame;   // Vertical blanks of the slide elapsed
+    volatile bool                   moving;       // A slide is in progress
+    volatile display_fade_control_t fade_request; // Fade to start at the next vertical blank
+    uint8_t                         fade_speed;   // Alpha step per frame of the requested fade
+    display_fade_control_t          fading;       // Fade running in the display, DISPLAY_FADE_CONTROL_NONE if none
+    volatile bool                   visible;      // The layer is shown
+    volatile bool                   update;       // Layer settings must be written at the next vertical blank
+    volatile bool                   dirty;        // Content must be rendered again
+    volatile bool                   flip_pending; // Rendered buffer to show at the next vertical blank
+    volatile bool                   releasing;    // Replaced buffer is scanned out until the new address latches
+    uint8_t                         front;        // Buffer on the display
+    bool                            move_done;    // Report MOVE_COMPLETE once the target is written
+} rm_glcdc_compositor_layer_t;
+
+/** Instance control block.  This is private to the FSP and should not be used or modified by the application. */
+typedef struct st_rm_glcdc_compositor_instance_ctrl
+{
+    uint32_t                          open;
+    rm_glcdc_compositor_cfg_t const * p_cfg;
+    rm_glcdc_compositor_layer_t       layer[RM_GLCDC_COMPOSITOR_LAYER_NUM];
+    rm_glcdc_compositor_statistics_t  statistics;
+} rm_glcdc_compositor_instance_ctrl_t;
+
+/**********************************************************************************************************************
+ * Exported global variables
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Public APIs
+ **********************************************************************************************************************/
+fsp_err_t RM_GLCDC_COMPOSITOR_Open(rm_glcdc_compositor_instance_ctrl_t * const p_ctrl,
+                                   rm_glcdc_compositor_cfg_t const * const     p_cfg);
+fsp_err_t RM_GLCDC_COMPOSITOR_ContentInvalidate(rm_glcdc_compositor_instance_ctrl_t * const p_ctrl,
+                                                display_frame_layer_t                       layer);
+fsp_err_t RM_GLCDC_COMPOSITOR_Update(rm_glcdc_compositor_instance_ctrl_t * const p_ctrl);
+fsp_err_t RM_GLCDC_COMPOSITOR_Move(rm_glcdc_compositor_instance_ctrl_t * const p_ctrl,
+                                   display_frame_layer_t                       layer,
+                                   display_coordinate_t                        target,
+                                   uint16_t                                    frames);
+fsp_err_t RM_GLCDC_COMPOSITOR_Fade(rm_glcdc_compositor_instance_ctrl_t * const p_ctrl,
+                                   display_frame_layer_t                       layer,
+                                   display_fade_control_t                      fade,
+                                   uint16_t                                    frames);
+fsp_err_t RM_GLCDC_COMPOSITOR_StatisticsGet(rm_glcdc_compositor_instance_ctrl_t * const p_ctrl,
+                                            rm_glcdc_compositor_statistics_t * const    p_statistics);
+fsp_err_t RM_GLCDC_COMPOSITOR_Close(rm_glcdc_compositor_instance_ctrl_t * const p_ctrl);
+fsp_err_t RM_GLCDC_COMPOSITOR_VersionGet(fsp_version_t * const p_version);
+
+void rm_glcdc_compositor_display_callback(display_callback_args_t * p_args);
+
+/* Common macro for FSP header files. There is also a corresponding FSP_HEADER macro at the top of this file. */
+FSP_FOOTER
+
+#endif                                 // RM_GLCDC_COMPOSITOR_H
+
+/*******************************************************************************************************************//**
+ * @} (end defgroup RM_GLCDC_COMPOSITOR)
+ **********************************************************************************************************************/
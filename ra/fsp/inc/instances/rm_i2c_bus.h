@@ -0,0 +1,155 @@
+/***********************************************************************************************************************
+ * Copyright [2020] Renesas Electronics Corporation and/or its affiliates.  All Rights Reserved.
+ *
+ * This software and documentation are supplied by Renesas Electronics America Inc. and may only be used with products
+ * of Renesas Electronics Corp. and its affiliates ("Renesas").  No other uses are authorized.  Renesas products are
+ * sold pursuant to Renesas terms and conditions of sale.  Purchasers are solely responsible for the selection and use
+ * of Renesas products and Renesas assumes no liability.  No license, express or implied, to any intellectual property
+ * right is granted by Renesas. This software is protected under all applicable laws, including copyright laws. Renesas
+ * reserves the right to change or discontinue this software and/or this documentation. THE SOFTWARE AND DOCUMENTATION
+ * IS DELIVERED TO YOU "AS IS," AND RENESAS MAKES NO REPRESENTATIONS OR WARRANTIES, AND TO THE FULLEST EXTENT
+ * PERMISSIBLE UNDER APPLICABLE LAW, DISCLAIMS ALL WARRANTIES, WHETHER EXPLICITLY OR IMPLICITLY, INCLUDING WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, AND NONINFRINGEMENT, WITH RESPECT TO THE SOFTWARE OR
+ * DOCUMENTATION.  RENESAS SHALL HAVE NO LIABILITY ARISING OUT OF ANY SECURITY VULNERABILITY OR BREACH.  TO THE MAXIMUM
+ * EXTENT PERMITTED BY LAW, IN NO EVENT WILL RENESAS BE LIABLE TO YOU IN CONNECTION WITH THE SOFTWARE OR DOCUMENTATION
+ * (OR ANY PERSON OR ENTITY CLAIMING RIGHTS DERIVED FROM YOU) FOR ANY LOSS, DAMAGES, OR CLAIMS WHATSOEVER, INCLUDING,
+ * WITHOUT LIMITATION, ANY DIRECT, CONSEQUENTIAL, SPECIAL, INDIRECT, PUNITIVE, OR INCIDENTAL DAMAGES; ANY LOST PROFITS,
+ * OTHER ECONOMIC DAMAGE, PROPERTY DAMAGE, OR PERSONAL INJURY; AND EVEN IF RENESAS HAS BEEN ADVISED OF THE POSSIBILITY
+ * OF SUCH LOSS, DAMAGES, CLAIMS OR COSTS.
+ **********************************************************************************************************************/
+
+
+#ifndef RM_I2C_BUS_H
+#define RM_I2C_BUS_H
+
+/***********************************************************************************************************************
+ * Includes
+ **********************************************************************************************************************/
+#include "bsp_api.h"
+#include "r_i2c_master_api.h"
+#include "rm_i2c_bus_cfg.h"
+#if BSP_CFG_RTOS == 2
+ #include "FreeRTOS.h"
+ #include "task.h"
+#endif
+
+/* Common macro for FSP header files. There is also a corresponding FSP_FOOTER macro at the end of this file. */
+FSP_HEADER
+
+/*******************************************************************************************************************//**
+ * @addtogroup RM_I2C_BUS
+ * @{
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+#define RM_I2C_BUS_CODE_VERSION_MAJOR    (1U)
+#define RM_I2C_BUS_CODE_VERSION_MINOR    (0U)
+
+/** Timeout for RM_I2C_BUS_TransactionWait that never expires. */
+#define RM_I2C_BUS_WAIT_FOREVER          (UINT32_MAX)
+
+/***********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+
+/** Transaction states */
+typedef enum e_rm_i2c_bus_state
+{
+    RM_I2C_BUS_STATE_IDLE   = 0,       ///< Never submitted
+    RM_I2C_BUS_STATE_QUEUED = 1,       ///< Waiting for the bus
+    RM_I2C_BUS_STATE_ACTIVE = 2,       ///< On the bus
+    RM_I2C_BUS_STATE_DONE   = 3,       ///< Finished, the result is valid
+} rm_i2c_bus_state_t;
+
+struct st_rm_i2c_bus_transaction;
+
+/** Callback function parameter structure */
+typedef struct st_rm_i2c_bus_callback_args
+{
+    struct st_rm_i2c_bus_transaction * p_transaction; ///< Transaction that finished
+    fsp_err_t    result;                              ///< FSP_SUCCESS, FSP_ERR_ABORTED on a NACK or bus error
+    void const * p_context;                           ///< Context of the transaction
+} rm_i2c_bus_callback_args_t;
+
+/** One bus transaction: an optional write followed by an optional read from the same device, joined by a repeated
+ * START. A register read is a write of the register address followed by a read. At least one of the phases should
+ * have data; a transaction without data sends the address only.
+ *
+ * Transactions are owned by the caller and must stay valid until they are done. */
+typedef struct st_rm_i2c_bus_transaction
+{
+    uint32_t               slave;       ///< Slave address
+    i2c_master_addr_mode_t addr_mode;   ///< Addressing mode of the slave
+    uint8_t                priority;    ///< Bus priority, 0 is the highest. Equal priorities are served in order.
+    uint8_t const        * p_write;     ///< Data to write, may be NULL if write_bytes is 0
+    uint32_t               write_bytes; ///< Number of bytes to write
+    uint8_t              * p_read;      ///< Buffer to read into, may be NULL if read_bytes is 0
+    uint32_t               read_bytes;  ///< Number of bytes to read
+
+    /** Optional callback, called from the I2C interrupt when the transaction is done. */
+    void (* p_callback)(rm_i2c_bus_callback_args_t * p_args);
+    void const * p_context;             ///< User defined context passed to the callback
+
+    /* The remaining members are private to the module. */
+    struct st_rm_i2c_bus_transaction * p_next; // Next transaction in the queue
+    volatile rm_i2c_bus_state_t        state;  // Transaction state
+    volatile fsp_err_t                 result; // Result, valid in RM_I2C_BUS_STATE_DONE
+    bool read_phase;                           // The read phase is on the bus
+#if BSP_CFG_RTOS == 2
+    TaskHandle_t volatile p_task;              // Task blocked in RM_I2C_BUS_TransactionWait
+#endif
+} rm_i2c_bus_transaction_t;
+
+/** User configuration structure, used in open function */
+typedef struct st_rm_i2c_bus_cfg
+{
+    /** I2C master instance, e.g. on r_iic_master or r_sci_i2c, opened by RM_I2C_BUS_Open. The callback of the instance
+     * is replaced by this module. Enable DTC support on the instance to move the payload without per-byte
+     * interrupts. */
+    i2c_master_instance_t const * p_i2c;
+
+    /** Most transactions chained to one device with repeated START conditions before the bus is offered to other
+     * devices. Set to 0 to end every transaction with a STOP condition. */
+    uint32_t merge_max;
+} rm_i2c_bus_cfg_t;
+
+/** Instance control block.  This is private to the FSP and should not be used or modified by the application. */
+typedef struct st_rm_i2c_bus_instance_ctrl
+{
+    uint32_t                            open;
+    rm_i2c_bus_cfg_t const            * p_cfg;
+    rm_i2c_bus_transaction_t          * p_head;      // Queue sorted by priority
+    rm_i2c_bus_transaction_t * volatile p_active;    // Transaction on the bus
+    rm_i2c_bus_transaction_t          * p_merged;    // Transaction chained after p_active with a repeated START
+    bool                     volatile   restart;     // The phase on the bus ends with a repeated START
+    uint32_t                            merged;      // Transactions chained since the last STOP condition
+    uint32_t                            slave;       // Slave address set in the I2C driver
+    i2c_master_addr_mode_t              addr_mode;   // Addressing mode set in the I2C driver
+} rm_i2c_bus_instance_ctrl_t;
+
+/**********************************************************************************************************************
+ * Exported global variables
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Public APIs
+ **********************************************************************************************************************/
+fsp_err_t RM_I2C_BUS_Open(rm_i2c_bus_instance_ctrl_t * const p_ctrl, rm_i2c_bus_cfg_t const * const p_cfg);
+fsp_err_t RM_I2C_BUS_TransactionSubmit(rm_i2c_bus_instance_ctrl_t * const p_ctrl,
+                                       rm_i2c_bus_transaction_t * const   p_transaction);
+fsp_err_t RM_I2C_BUS_TransactionWait(rm_i2c_bus_instance_ctrl_t * const p_ctrl,
+                                     rm_i2c_bus_transaction_t * const   p_transaction,
+                                     uint32_t                           timeout_ms);
+fsp_err_t RM_I2C_BUS_Close(rm_i2c_bus_instance_ctrl_t * const p_ctrl);
+fsp_err_t RM_I2C_BUS_VersionGet(fsp_version_t * const p_version);
+
+/* Common macro for FSP header files. There is also a corresponding FSP_HEADER macro at the top of this file. */
+FSP_FOOTER
+
+#endif                                 // RM_I2C_BUS_H
+
+/*******************************************************************************************************************//**
+ * @} (end defgroup RM_I2C_BUS)
+ **********************************************************************************************************************/
@@ -0,0 +1,152 @@
+/***********************************************************************************************************************
+ * Copyright [2020] Renesas Electronics Corporation and/or its affiliates.  All Rights Reserved.
+ *
+ * This software and documentation are supplied by Renesas Electronics America Inc. and may only be used with products
+ * of Renesas Electronics Corp. and its affiliates ("Renesas").  No other uses are authorized.  Renesas products are
+ * sold pursuant to Renesas terms and conditions of sale.  Purchasers are solely responsible for the selection and use
+ * of Renesas products and Renesas assumes no liability.  No license, express or implied, to any intellectual property
+ * right is granted by Renesas. This software is protected under all applicable laws, including copyright laws. Renesas
+ * reserves the right to change or discontinue this software and/or this documentation. THE SOFTWARE AND DOCUMENTATION
+ * IS DELIVERED TO YOU "AS IS," AND RENESAS MAKES NO REPRESENTATIONS OR WARRANTIES, AND TO THE FULLEST EXTENT
+ * PERMISSIBLE UNDER APPLICABLE LAW, DISCLAIMS ALL WARRANTIES, WHETHER EXPLICITLY OR IMPLICITLY, INCLUDING WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, AND NONINFRINGEMENT, WITH RESPECT TO THE SOFTWARE OR
+ * DOCUMENTATION.  RENESAS SHALL HAVE NO LIABILITY ARISING OUT OF ANY SECURITY VULNERABILITY OR BREACH.  TO THE MAXIMUM
+ * EXTENT PERMITTED BY LAW, IN NO EVENT WILL RENESAS BE LIABLE TO YOU IN CONNECTION WITH THE SOFTWARE OR DOCUMENTATION
+ * (OR ANY PERSON OR ENTITY CLAIMING RIGHTS DERIVED FROM YOU) FOR ANY LOSS, DAMAGES, OR CLAIMS WHATSOEVER, INCLUDING,
+ * WITHOUT LIMITATION, ANY DIRECT, CONSEQUENTIAL, SPECIAL, INDIRECT, PUNITIVE, OR INCIDENTAL DAMAGES; ANY LOST PROFITS,
+ * OTHER ECONOMIC DAMAGE, PROPERTY DAMAGE, OR PERSONAL INJURY; AND EVEN IF RENESAS HAS BEEN ADVISED OF THE POSSIBILITY
+ * OF SUCH LOSS, DAMAGES, CLAIMS OR COSTS.
+ **********************************************************************************************************************/
+
+#ifndef RM_JPEG_STREAM_H
+#define RM_JPEG_STREAM_H
+
+/***********************************************************************************************************************
+ * Includes
+ **********************************************************************************************************************/
+#include "bsp_api.h"
+#include "r_jpeg_api.h"
+#include "rm_jpeg_stream_cfg.h"
+
+/* Common macro for FSP header files. There is also a corresponding FSP_FOOTER macro at the end of this file. */
+FSP_HEADER
+
+/*******************************************************************************************************************//**
+ * @addtogroup RM_JPEG_STREAM
+ * @{
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+#define RM_JPEG_STREAM_CODE_VERSION_MAJOR    (1U)
+#define RM_JPEG_STREAM_CODE_VERSION_MINOR    (0U)
+
+/** Largest input chunk the JPEG codec can pause after. */
+#define RM_JPEG_STREAM_INPUT_CHUNK_MAX       (0xFFF8U)
+
+/***********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+
+/** Events reported to the callback function from the JPEG interrupts. */
+typedef enum e_rm_jpeg_stream_event
+{
+    RM_JPEG_STREAM_EVENT_STRIP_READY  = 0, ///< A strip was decoded and can be read with RM_JPEG_STREAM_StripGet
+    RM_JPEG_STREAM_EVENT_INPUT_NEEDED = 1, ///< The codec paused for input, call RM_JPEG_STREAM_StripGet to refill it
+    RM_JPEG_STREAM_EVENT_ERROR        = 2, ///< Decoding stopped, RM_JPEG_STREAM_StripGet returns the error
+} rm_jpeg_stream_event_t;
+
+/** Callback function parameter structure */
+typedef struct st_rm_jpeg_stream_callback_args
+{
+    rm_jpeg_stream_event_t event;      ///< Event code
+    void const           * p_context;  ///< Context provided to user during callback
+} rm_jpeg_stream_callback_args_t;
+
+/** Decoded strip returned by RM_JPEG_STREAM_StripGet. */
+typedef struct st_rm_jpeg_stream_strip
+{
+    uint8_t * p_data;                  ///< First line of the strip in the ring
+    uint16_t  line;                    ///< Image line of the first strip line
+    uint16_t  lines;                   ///< Valid lines in the strip, less than strip_lines for the last strip
+    uint16_t  width;                   ///< Image width in pixels
+    uint16_t  height;                  ///< Image height in lines
+    uint16_t  stride;                  ///< Strip line stride in pixels
+    bool      last;                    ///< This is the last strip of the image
+} rm_jpeg_stream_strip_t;
+
+/** User configuration structure, used in open function */
+typedef struct st_rm_jpeg_stream_cfg
+{
+    /** JPEG codec in decode mode, opened by RM_JPEG_STREAM_Open. Its decode callback must be
+     * rm_jpeg_stream_jpeg_callback() with the control structure of this module as p_decode_context. */
+    jpeg_instance_t const * p_jpeg;
+
+    /** Strip ring: strip_count strips of strip_lines lines of stride_pixels pixels in the codec's pixel format. Its
+     * size only depends on the image width, so images of any height decode without a full image buffer. */
+    uint8_t * p_ring;
+    uint8_t   strip_count;             ///< Number of strips in the ring, at least 2 to overlap decoding and consuming
+    uint8_t   strip_lines;             ///< Lines per strip, a multiple of 8. YCbCr 4:2:0 images need a multiple of 16.
+    uint16_t  stride_pixels;           ///< Strip line stride in pixels, at least the image width, 8-byte aligned lines
+
+    /** Two input chunks of input_chunk_size bytes each, 8-byte aligned. The codec reads one while the other is
+     * refilled. */
+    uint8_t * p_input_buffer;
+    uint32_t  input_chunk_size;        ///< Multiple of 8, at most RM_JPEG_STREAM_INPUT_CHUNK_MAX
+
+    /** Reads up to size bytes of the JPEG stream into p_buffer and returns the number of bytes read, 0 at the end of
+     * the stream. Called from RM_JPEG_STREAM_DecodeStart and RM_JPEG_STREAM_StripGet, never from an interrupt. */
+    uint32_t (* p_input_read)(void const * p_context, uint8_t * p_buffer, uint32_t size);
+
+    void (* p_callback)(rm_jpeg_stream_callback_args_t * p_args); ///< Optional callback called from the JPEG interrupts
+    void const * p_context;                                        ///< User defined context passed to the callbacks
+} rm_jpeg_stream_cfg_t;
+
+/** Instance control block.  This is private to the FSP and should not be used or modified by the application. */
+typedef struct st_rm_jpeg_stream_instance_ctrl
+{
+    uint32_t                     open;
+    rm_jpeg_stream_cfg_t const * p_cfg;
+    uint32_t                     strip_bytes;       // Size of one strip in the ring
+    uint16_t                     width;             // Image width, valid after the header was decoded
+    uint16_t                     height;            // Image height, valid after the header was decoded
+    bool                         started;           // A decode was started since the codec was opened
+    volatile bool                decoding;          // The codec still produces strips for the current image
+    volatile fsp_err_t           err;               // First error of the current image
+    uint8_t                      strip_read;        // Oldest ring slot not yet released
+    volatile uint8_t             strips_ready;      // Decoded strips not yet released, including strips_held
+    uint8_t                      strips_held;       // Strips returned by StripGet and not yet released
+    uint16_t                     strips_taken;      // Strips of the image returned by StripGet
+    volatile bool                output_stalled;    // Codec paused because the ring is full
+    uint8_t                      input_active;      // Input chunk the codec reads
+    volatile bool                input_next_ready;  // The other input chunk holds data for the codec
+    volatile bool                input_stalled;     // Codec paused because no input chunk is ready
+    bool                         input_end;         // p_input_read reported the end of the stream
+} rm_jpeg_stream_instance_ctrl_t;
+
+/**********************************************************************************************************************
+ * Exported global variables
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Public APIs
+ **********************************************************************************************************************/
+fsp_err_t RM_JPEG_STREAM_Open(rm_jpeg_stream_instance_ctrl_t * const p_ctrl, rm_jpeg_stream_cfg_t const * const p_cfg);
+fsp_err_t RM_JPEG_STREAM_DecodeStart(rm_jpeg_stream_instance_ctrl_t * const p_ctrl);
+fsp_err_t RM_JPEG_STREAM_StripGet(rm_jpeg_stream_instance_ctrl_t * const p_ctrl,
+                                  rm_jpeg_stream_strip_t * const         p_strip);
+fsp_err_t RM_JPEG_STREAM_StripRelease(rm_jpeg_stream_instance_ctrl_t * const p_ctrl);
+fsp_err_t RM_JPEG_STREAM_Close(rm_jpeg_stream_instance_ctrl_t * const p_ctrl);
+fsp_err_t RM_JPEG_STREAM_VersionGet(fsp_version_t * const p_version);
+
+void rm_jpeg_stream_jpeg_callback(jpeg_callback_args_t * p_args);
+
+/* Common macro for FSP header files. There is also a corresponding FSP_HEADER macro at the top of this file. */
+FSP_FOOTER
+
+#endif                                 // RM_JPEG_STREAM_H
+
+/*******************************************************************************************************************//**
+ * @} (end defgroup RM_JPEG_STREAM)
+ **********************************************************************************************************************/
@@ -0,0 +1,146 @@
+/***********************************************************************************************************************
+ * Copyright [2020] Renesas Electronics Corporation and/or its affiliates.  All Rights Reserved.
+ *
+ * This software and documentation are supplied by Renesas Electronics America Inc. and may only be used with products
+ * of Renesas Electronics Corp. and its affiliates ("Renesas").  No other uses are authorized.  Renesas products are
+ * sold pursuant to Renesas terms and conditions of sale.  Purchasers are solely responsible for the selection and use
+ * of Renesas products and Renesas assumes no liability.  No license, express or implied, to any intellectual property
+ * right is granted by Renesas. This software is protected under all applicable laws, including copyright laws. Renesas
+ * reserves the right to change or discontinue this software and/or this documentation. THE SOFTWARE AND DOCUMENTATION
+ * IS DELIVERED TO YOU "AS IS," AND RENESAS MAKES NO REPRESENTATIONS OR WARRANTIES, AND TO THE FULLEST EXTENT
+ * PERMISSIBLE UNDER APPLICABLE LAW, DISCLAIMS ALL WARRANTIES, WHETHER EXPLICITLY OR IMPLICITLY, INCLUDING WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, AND NONINFRINGEMENT, WITH RESPECT TO THE SOFTWARE OR
+ * DOCUMENTATION.  RENESAS SHALL HAVE NO LIABILITY ARISING OUT OF ANY SECURITY VULNERABILITY OR BREACH.  TO THE MAXIMUM
+ * EXTENT PERMITTED BY LAW, IN NO EVENT WILL RENESAS BE LIABLE TO YOU IN CONNECTION WITH THE SOFTWARE OR DOCUMENTATION
+ * (OR ANY PERSON OR ENTITY CLAIMING RIGHTS DERIVED FROM YOU) FOR ANY LOSS, DAMAGES, OR CLAIMS WHATSOEVER, INCLUDING,
+ * WITHOUT LIMITATION, ANY DIRECT, CONSEQUENTIAL, SPECIAL, INDIRECT, PUNITIVE, OR INCIDENTAL DAMAGES; ANY LOST PROFITS,
+ * OTHER ECONOMIC DAMAGE, PROPERTY DAMAGE, OR PERSONAL INJURY; AND EVEN IF RENESAS HAS BEEN ADVISED OF THE POSSIBILITY
+ * OF SUCH LOSS, DAMAGES, CLAIMS OR COSTS.
+ **********************************************************************************************************************/
+
+#ifndef RM_KEYPAD_H
+#define RM_KEYPAD_H
+
+/***********************************************************************************************************************
+ * Includes
+ **********************************************************************************************************************/
+#include "bsp_api.h"
+#include "r_keymatrix_api.h"
+#include "r_timer_api.h"
+#include "r_ioport_api.h"
+#include "rm_keypad_cfg.h"
+
+/* Common macro for FSP header files. There is also a corresponding FSP_FOOTER macro at the end of this file. */
+FSP_HEADER
+
+/*******************************************************************************************************************//**
+ * @addtogroup RM_KEYPAD
+ * @{
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+#define RM_KEYPAD_CODE_VERSION_MAJOR    (1U)
+#define RM_KEYPAD_CODE_VERSION_MINOR    (0U)
+
+/** Maximum number of rows, one per KINT channel. */
+#define RM_KEYPAD_MAX_ROWS              (8U)
+
+/** Maximum number of columns. */
+#define RM_KEYPAD_MAX_COLUMNS           (8U)
+
+/***********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+
+/** Key event types */
+typedef enum e_rm_keypad_event_type
+{
+    RM_KEYPAD_EVENT_TYPE_PRESSED  = 0, ///< The key was pressed
+    RM_KEYPAD_EVENT_TYPE_RELEASED = 1, ///< The key was released
+} rm_keypad_event_type_t;
+
+/** Debounced key event */
+typedef struct st_rm_keypad_event
+{
+    uint8_t                row;        ///< Row of the key
+    uint8_t                column;     ///< Column of the key
+    rm_keypad_event_type_t type;       ///< Pressed or released
+} rm_keypad_event_t;
+
+/** Callback function parameter structure */
+typedef struct st_rm_keypad_callback_args
+{
+    rm_keypad_event_t event;           ///< Key event, also stored in the event queue
+    void const      * p_context;       ///< Context provided to user during callback
+} rm_keypad_callback_args_t;
+
+/** User configuration structure, used in open function */
+typedef struct st_rm_keypad_cfg
+{
+    /** KINT instance on the row pins, opened by RM_KEYPAD_Open. It must trigger on the falling edge of every row, and
+     * the rows must be pulled up. The callback of the instance is replaced by this module. */
+    keymatrix_instance_t const * p_kint;
+
+    /** Periodic AGT instance that schedules the scans while a key is held, opened by RM_KEYPAD_Open. Its period is the
+     * scan period, and its underflow interrupt must be enabled. The callback of the instance is replaced by this
+     * module. */
+    timer_instance_t const * p_timer;
+
+    ioport_instance_t const * p_ioport;        ///< I/O port instance used to drive the columns and read the rows
+
+    /** Row pins, configured as inputs with pull-up on the KINT channels of p_kint. */
+    bsp_io_port_pin_t const * p_row_pins;
+
+    /** Column pins, configured as NMOS open-drain outputs so columns that are not scanned float. */
+    bsp_io_port_pin_t const * p_column_pins;
+
+    uint8_t  num_rows;                         ///< Number of rows, at most RM_KEYPAD_MAX_ROWS
+    uint8_t  num_columns;                      ///< Number of columns, at most RM_KEYPAD_MAX_COLUMNS
+    uint32_t debounce_ms;                      ///< Time the matrix must be stable before a change is reported
+    uint32_t settle_us;                        ///< Settling time after a column is driven, before the rows are read
+
+    rm_keypad_event_t * p_event_queue;         ///< Event queue storage
+    uint32_t            event_queue_size;      ///< Number of events p_event_queue holds
+
+    void (* p_callback)(rm_keypad_callback_args_t * p_args); ///< Optional callback for each key event
+    void const * p_context;                                   ///< User defined context passed to the callback
+} rm_keypad_cfg_t;
+
+/** Instance control block.  This is private to the FSP and should not be used or modified by the application. */
+typedef struct st_rm_keypad_instance_ctrl
+{
+    uint32_t                open;
+    rm_keypad_cfg_t const * p_cfg;
+    uint32_t                debounce_scans;                  // Scans the matrix must be stable for
+    uint32_t                stable_scans;                    // Scans the raw matrix has been unchanged for
+    uint8_t                 raw_state[RM_KEYPAD_MAX_COLUMNS]; // Row mask of each column from the last scan
+    uint8_t                 key_state[RM_KEYPAD_MAX_COLUMNS]; // Debounced row mask of each column
+    volatile bool           scanning;                        // Keys are held and the AGT is scanning the matrix
+    volatile uint32_t       queue_head;                      // Events written, modulo 2^32
+    volatile uint32_t       queue_tail;                      // Events read, modulo 2^32
+    volatile uint32_t       dropped_events;                  // Events lost because the queue was full
+} rm_keypad_instance_ctrl_t;
+
+/**********************************************************************************************************************
+ * Exported global variables
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Public APIs
+ **********************************************************************************************************************/
+fsp_err_t RM_KEYPAD_Open(rm_keypad_instance_ctrl_t * const p_ctrl, rm_keypad_cfg_t const * const p_cfg);
+fsp_err_t RM_KEYPAD_EventGet(rm_keypad_instance_ctrl_t * const p_ctrl, rm_keypad_event_t * const p_event);
+fsp_err_t RM_KEYPAD_KeysGet(rm_keypad_instance_ctrl_t * const p_ctrl, uint8_t * const p_row_masks);
+fsp_err_t RM_KEYPAD_Close(rm_keypad_instance_ctrl_t * const p_ctrl);
+fsp_err_t RM_KEYPAD_VersionGet(fsp_version_t * const p_version);
+
+/* Common macro for FSP header files. There is also a corresponding FSP_HEADER macro at the top of this file. */
+FSP_FOOTER
+
+#endif                                 // RM_KEYPAD_H
+
+/*******************************************************************************************************************//**
+ * @} (end defgroup RM_KEYPAD)
+ **********************************************************************************************************************/
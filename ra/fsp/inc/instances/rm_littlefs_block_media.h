@@ -0,0 +1,142 @@
+/***********************************************************************************************************************
+ * Copyright [2020] Renesas Electronics Corporation and/or its affiliates.  All Rights Reserved.
+ *
+ * This software and documentation are supplied by Renesas Electronics America Inc. and may only be used with products
+ * of Renesas Electronics Corp. and its affiliates ("Renesas").  No other uses are authorized.  Renesas products are
+ * sold pursuant to Renesas terms and conditions of sale.  Purchasers are solely responsible for the selection and use
+ * of Renesas products and Renesas assumes no liability.  No license, express or implied, to any intellectual property
+ * right is granted by Renesas. This software is protected under all applicable laws, including copyright laws. Renesas
+ * reserves the right to change or discontinue this software and/or this documentation. THE SOFTWARE AND DOCUMENTATION
+ * IS DELIVERED TO YOU "AS IS," AND RENESAS MAKES NO REPRESENTATIONS OR WARRANTIES, AND TO THE FULLEST EXTENT
+ * PERMISSIBLE UNDER APPLICABLE LAW, DISCLAIMS ALL WARRANTIES, WHETHER EXPLICITLY OR IMPLICITLY, INCLUDING WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, AND NONINFRINGEMENT, WITH RESPECT TO THE SOFTWARE OR
+ * DOCUMENTATION.  RENESAS SHALL HAVE NO LIABILITY ARISING OUT OF ANY SECURITY VULNERABILITY OR BREACH.  TO THE MAXIMUM
+ * EXTENT PERMITTED BY LAW, IN NO EVENT WILL RENESAS BE LIABLE TO YOU IN CONNECTION WITH THE SOFTWARE OR DOCUMENTATION
+ * (OR ANY PERSON OR ENTITY CLAIMING RIGHTS DERIVED FROM YOU) FOR ANY LOSS, DAMAGES, OR CLAIMS WHATSOEVER, INCLUDING,
+ * WITHOUT LIMITATION, ANY DIRECT, CONSEQUENTIAL, SPECIAL, INDIRECT, PUNITIVE, OR INCIDENTAL DAMAGES; ANY LOST PROFITS,
+ * OTHER ECONOMIC DAMAGE, PROPERTY DAMAGE, OR PERSONAL INJURY; AND EVEN IF RENESAS HAS BEEN ADVISED OF THE POSSIBILITY
+ * OF SUCH LOSS, DAMAGES, CLAIMS OR COSTS.
+ **********************************************************************************************************************/
+
+#ifndef RM_LITTLEFS_BLOCK_MEDIA_H
+#define RM_LITTLEFS_BLOCK_MEDIA_H
+
+/***********************************************************************************************************************
+ * Includes
+ **********************************************************************************************************************/
+#include "rm_littlefs_api.h"
+#include "rm_block_media_api.h"
+#include "lfs.h"
+#if LFS_THREAD_SAFE || (BSP_CFG_RTOS == 2)
+ #include "FreeRTOS.h"
+ #include "task.h"
+ #include "semphr.h"
+
+#endif
+
+/* Common macro for FSP header files. There is also a corresponding FSP_FOOTER macro at the end of this file. */
+FSP_HEADER
+
+/*******************************************************************************************************************//**
+ * @addtogroup RM_LITTLEFS_BLOCK_MEDIA
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+#define RM_LITTLEFS_BLOCK_MEDIA_CODE_VERSION_MAJOR    (1U)
+#define RM_LITTLEFS_BLOCK_MEDIA_CODE_VERSION_MINOR    (0U)
+
+/***********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+
+/** User configuration structure, used in open function.
+ *
+ * The littlefs read_size and prog_size must be multiples of the media sector size (usually 512 bytes). Set the
+ * littlefs block_size to the erase page of the card (for SD cards the allocation unit or a power of two fraction of
+ * it), so each littlefs block is rewritten as one erase page, and set cache_size to a multiple of prog_size that
+ * divides block_size. Larger caches let littlefs issue multi-sector transfers. */
+typedef struct st_rm_littlefs_block_media_cfg
+{
+    rm_block_media_instance_t const * p_block_media; ///< Pointer to a block media instance (SD/MMC or USB)
+
+    /** First media sector of the filesystem. The filesystem spans block_count littlefs blocks from here. */
+    uint32_t start_sector;
+
+    /** Issue a block media erase for each littlefs block erase. SD cards can then discard the erase page before it is
+     * rewritten. Set to false for media without erase support (USB mass storage). littlefs does not depend on the
+     * erased value. */
+    bool erase_enable;
+
+    /** Word aligned buffer of one media sector for littlefs buffers that are not word aligned, or NULL if every
+     * littlefs buffer is word aligned. */
+    uint8_t * p_align_buffer;
+} rm_littlefs_block_media_cfg_t;
+
+/** Instance control block.  This is private to the FSP and should not be used or modified by the application. */
+typedef struct st_rm_littlefs_block_media_instance_ctrl
+{
+    uint32_t open;
+    rm_littlefs_cfg_t const * p_cfg;
+    uint32_t                  sector_size;          // Sector size of the media in bytes
+    uint32_t                  sectors_per_block;    // Media sectors per littlefs block
+    volatile rm_block_media_event_t last_event;     // Completion events of the request in flight
+    rm_block_media_callback_args_t  callback_memory;
+#if BSP_CFG_RTOS == 2
+    volatile TaskHandle_t current_task;             // Task waiting for the request in flight
+#else
+    volatile bool event_ready;                      // The request in flight completed
+#endif
+#if LFS_THREAD_SAFE
+    SemaphoreHandle_t xSemaphore;
+    StaticSemaphore_t xMutexBuffer;
+#endif
+} rm_littlefs_block_media_instance_ctrl_t;
+
+/**********************************************************************************************************************
+ * Exported global variables
+ **********************************************************************************************************************/
+
+/** @cond INC_HEADER_DEFS_SEC */
+/** Filled in Interface API structure for this Instance. */
+extern const rm_littlefs_api_t g_rm_littlefs_on_block_media;
+
+/** @endcond */
+
+/**********************************************************************************************************************
+ * Function Prototypes
+ **********************************************************************************************************************/
+fsp_err_t RM_LITTLEFS_BLOCK_MEDIA_Open(rm_littlefs_ctrl_t * const p_ctrl, rm_littlefs_cfg_t const * const p_cfg);
+
+fsp_err_t RM_LITTLEFS_BLOCK_MEDIA_Close(rm_littlefs_ctrl_t * const p_ctrl);
+
+fsp_err_t RM_LITTLEFS_BLOCK_MEDIA_VersionGet(fsp_version_t * const p_version);
+
+int rm_littlefs_block_media_read(const struct lfs_config * c, lfs_block_t block, lfs_off_t off, void * buffer,
+                                 lfs_size_t size);
+
+int rm_littlefs_block_media_write(const struct lfs_config * c,
+                                  lfs_block_t               block,
+                                  lfs_off_t                 off,
+                                  const void              * buffer,
+                                  lfs_size_t                size);
+
+int rm_littlefs_block_media_erase(const struct lfs_config * c, lfs_block_t block);
+
+int rm_littlefs_block_media_lock(const struct lfs_config * c);
+
+int rm_littlefs_block_media_unlock(const struct lfs_config * c);
+
+int rm_littlefs_block_media_sync(const struct lfs_config * c);
+
+void rm_littlefs_block_media_callback(rm_block_media_callback_args_t * p_args);
+
+/* Common macro for FSP header files. There is also a corresponding FSP_HEADER macro at the top of this file. */
+FSP_FOOTER
+
+#endif                                 // RM_LITTLEFS_BLOCK_MEDIA_H
+
+/*******************************************************************************************************************//**
+ * @} (end addtogroup RM_LITTLEFS_BLOCK_MEDIA)
+ **********************************************************************************************************************/
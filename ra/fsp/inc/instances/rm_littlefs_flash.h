@@ -54,6 +54,19 @@ FSP_HEADER
 typedef struct st_rm_littlefs_flash_cfg
 {
     flash_instance_t const * p_flash;  ///< Pointer to a flash instance
+
+    /** Read cache of cache_blocks * block_size bytes, or NULL to read directly from the flash. */
+    uint8_t * p_cache;
+
+    /** Logical block held by each read cache entry. Must have cache_blocks entries. */
+    lfs_block_t * p_cache_tags;
+    uint32_t      cache_blocks;        ///< Number of logical blocks held in the read cache
+
+    /** Bitmap of blocks known to be erased, (block_count + 31) / 32 words, or NULL to disable erase-ahead. */
+    uint32_t * p_erased;
+
+    /** Work area used by RM_LITTLEFS_FLASH_IdleErase, (block_count + 31) / 32 words. */
+    uint32_t * p_in_use;
 } rm_littlefs_flash_cfg_t;
 
 /** Instance control block.  This is private to the FSP and should not be used or modified by the application. */
@@ -61,6 +74,8 @@ typedef struct st_rm_littlefs_flash_instance_ctrl
 {
     uint32_t open;
     rm_littlefs_cfg_t const * p_cfg;
+    uint32_t cache_next;               ///< Read cache entry to replace on the next miss
+    uint32_t generation;               ///< Incremented on every write and erase requested by LittleFS
 #if LFS_THREAD_SAFE
     SemaphoreHandle_t xSemaphore;
     StaticSemaphore_t xMutexBuffer;
@@ -86,6 +101,8 @@ fsp_err_t RM_LITTLEFS_FLASH_Close(rm_littlefs_ctrl_t * const p_ctrl);
 
 fsp_err_t RM_LITTLEFS_FLASH_VersionGet(fsp_version_t * const p_version);
 
+fsp_err_t RM_LITTLEFS_FLASH_IdleErase(rm_littlefs_ctrl_t * const p_ctrl, lfs_t * const p_lfs, uint32_t max_blocks);
+
 int rm_littlefs_flash_read(const struct lfs_config * c, lfs_block_t block, lfs_off_t off, void * buffer,
                            lfs_size_t size);
 
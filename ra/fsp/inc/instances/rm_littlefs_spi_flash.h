@@ -0,0 +1,118 @@
+/***********************************************************************************************************************
+ * Copyright [2020] Renesas Electronics Corporation and/or its affiliates.  All Rights Reserved.
+ *
+ * This software and documentation are supplied by Renesas Electronics America Inc. and may only be used with products
+ * of Renesas Electronics Corp. and its affiliates ("Renesas").  No other uses are authorized.  Renesas products are
+ * sold pursuant to Renesas terms and conditions of sale.  Purchasers are solely responsible for the selection and use
+ * of Renesas products and Renesas assumes no liability.  No license, express or implied, to any intellectual property
+ * right is granted by Renesas. This software is protected under all applicable laws, including copyright laws. Renesas
+ * reserves the right to change or discontinue this software and/or this documentation. THE SOFTWARE AND DOCUMENTATION
+ * IS DELIVERED TO YOU "AS IS," AND RENESAS MAKES NO REPRESENTATIONS OR WARRANTIES, AND TO THE FULLEST EXTENT
+ * PERMISSIBLE UNDER APPLICABLE LAW, DISCLAIMS ALL WARRANTIES, WHETHER EXPLICITLY OR IMPLICITLY, INCLUDING WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, AND NONINFRINGEMENT, WITH RESPECT TO THE SOFTWARE OR
+ * DOCUMENTATION.  RENESAS SHALL HAVE NO LIABILITY ARISING OUT OF ANY SECURITY VULNERABILITY OR BREACH.  TO THE MAXIMUM
+ * EXTENT PERMITTED BY LAW, IN NO EVENT WILL RENESAS BE LIABLE TO YOU IN CONNECTION WITH THE SOFTWARE OR DOCUMENTATION
+ * (OR ANY PERSON OR ENTITY CLAIMING RIGHTS DERIVED FROM YOU) FOR ANY LOSS, DAMAGES, OR CLAIMS WHATSOEVER, INCLUDING,
+ * WITHOUT LIMITATION, ANY DIRECT, CONSEQUENTIAL, SPECIAL, INDIRECT, PUNITIVE, OR INCIDENTAL DAMAGES; ANY LOST PROFITS,
+ * OTHER ECONOMIC DAMAGE, PROPERTY DAMAGE, OR PERSONAL INJURY; AND EVEN IF RENESAS HAS BEEN ADVISED OF THE POSSIBILITY
+ * OF SUCH LOSS, DAMAGES, CLAIMS OR COSTS.
+ **********************************************************************************************************************/
+
+#ifndef RM_LITTLEFS_SPI_FLASH_H
+#define RM_LITTLEFS_SPI_FLASH_H
+
+/***********************************************************************************************************************
+ * Includes
+ **********************************************************************************************************************/
+#include "rm_littlefs_api.h"
+#include "r_spi_flash_api.h"
+#include "lfs.h"
+#if LFS_THREAD_SAFE || (BSP_CFG_RTOS == 2)
+ #include "FreeRTOS.h"
+ #include "task.h"
+ #include "semphr.h"
+
+#endif
+
+/* Common macro for FSP header files. There is also a corresponding FSP_FOOTER macro at the end of this file. */
+FSP_HEADER
+
+/*******************************************************************************************************************//**
+ * @addtogroup RM_LITTLEFS_SPI_FLASH
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+#define RM_LITTLEFS_SPI_FLASH_CODE_VERSION_MAJOR    (1U)
+#define RM_LITTLEFS_SPI_FLASH_CODE_VERSION_MINOR    (0U)
+
+/***********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+
+/** User configuration structure, used in open function */
+typedef struct st_rm_littlefs_spi_flash_cfg
+{
+    spi_flash_instance_t const * p_flash;  ///< Pointer to a QSPI or OSPI flash instance
+
+    /** Address of the first filesystem block in the memory mapped (XIP) window of the flash device. The filesystem must
+     * be inside the window currently mapped by the lower level driver. */
+    uint32_t base_address;
+} rm_littlefs_spi_flash_cfg_t;
+
+/** Instance control block.  This is private to the FSP and should not be used or modified by the application. */
+typedef struct st_rm_littlefs_spi_flash_instance_ctrl
+{
+    uint32_t open;
+    rm_littlefs_cfg_t const * p_cfg;
+#if LFS_THREAD_SAFE
+    SemaphoreHandle_t xSemaphore;
+    StaticSemaphore_t xMutexBuffer;
+#endif
+} rm_littlefs_spi_flash_instance_ctrl_t;
+
+/**********************************************************************************************************************
+ * Exported global variables
+ **********************************************************************************************************************/
+
+/** @cond INC_HEADER_DEFS_SEC */
+/** Filled in Interface API structure for this Instance. */
+extern const rm_littlefs_api_t g_rm_littlefs_on_spi_flash;
+
+/** @endcond */
+
+/**********************************************************************************************************************
+ * Function Prototypes
+ **********************************************************************************************************************/
+fsp_err_t RM_LITTLEFS_SPI_FLASH_Open(rm_littlefs_ctrl_t * const p_ctrl, rm_littlefs_cfg_t const * const p_cfg);
+
+fsp_err_t RM_LITTLEFS_SPI_FLASH_Close(rm_littlefs_ctrl_t * const p_ctrl);
+
+fsp_err_t RM_LITTLEFS_SPI_FLASH_VersionGet(fsp_version_t * const p_version);
+
+int rm_littlefs_spi_flash_read(const struct lfs_config * c, lfs_block_t block, lfs_off_t off, void * buffer,
+                               lfs_size_t size);
+
+int rm_littlefs_spi_flash_write(const struct lfs_config * c,
+                                lfs_block_t               block,
+                                lfs_off_t                 off,
+                                const void              * buffer,
+                                lfs_size_t                size);
+
+int rm_littlefs_spi_flash_erase(const struct lfs_config * c, lfs_block_t block);
+
+int rm_littlefs_spi_flash_lock(const struct lfs_config * c);
+
+int rm_littlefs_spi_flash_unlock(const struct lfs_config * c);
+
+int rm_littlefs_spi_flash_sync(const struct lfs_config * c);
+
+/* Common macro for FSP header files. There is also a corresponding FSP_HEADER macro at the top of this file. */
+FSP_FOOTER
+
+#endif                                 // RM_LITTLEFS_SPI_FLASH_H
+
+/*******************************************************************************************************************//**
+ * @} (end addtogroup RM_LITTLEFS_SPI_FLASH)
+ **********************************************************************************************************************/
@@ -0,0 +1,140 @@
+/***********************************************************************************************************************
+ * Copyright [2020] Renesas Electronics Corporation and/or its affiliates.  All Rights Reserved.
+ *
+ * This software and documentation are supplied by Renesas Electronics America Inc. and may only be used with products
+ * of Renesas Electronics Corp. and its affiliates ("Renesas").  No other uses are authorized.  Renesas products are
+ * sold pursuant to Renesas terms and conditions of sale.  Purchasers are solely responsible for the selection and use
+ * of Renesas products and Renesas assumes no liability.  No license, express or implied, to any intellectual property
+ * right is granted by Renesas. This software is protected under all applicable laws, including copyright laws. Renesas
+ * reserves the right to change or discontinue this software and/or this documentation. THE SOFTWARE AND DOCUMENTATION
+ * IS DELIVERED TO YOU "AS IS," AND RENESAS MAKES NO REPRESENTATIONS OR WARRANTIES, AND TO THE FULLEST EXTENT
+ * PERMISSIBLE UNDER APPLICABLE LAW, DISCLAIMS ALL WARRANTIES, WHETHER EXPLICITLY OR IMPLICITLY, INCLUDING WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, AND NONINFRINGEMENT, WITH RESPECT TO THE SOFTWARE OR
+ * DOCUMENTATION.  RENESAS SHALL HAVE NO LIABILITY ARISING OUT OF ANY SECURITY VULNERABILITY OR BREACH.  TO THE MAXIMUM
+ * EXTENT PERMITTED BY LAW, IN NO EVENT WILL RENESAS BE LIABLE TO YOU IN CONNECTION WITH THE SOFTWARE OR DOCUMENTATION
+ * (OR ANY PERSON OR ENTITY CLAIMING RIGHTS DERIVED FROM YOU) FOR ANY LOSS, DAMAGES, OR CLAIMS WHATSOEVER, INCLUDING,
+ * WITHOUT LIMITATION, ANY DIRECT, CONSEQUENTIAL, SPECIAL, INDIRECT, PUNITIVE, OR INCIDENTAL DAMAGES; ANY LOST PROFITS,
+ * OTHER ECONOMIC DAMAGE, PROPERTY DAMAGE, OR PERSONAL INJURY; AND EVEN IF RENESAS HAS BEEN ADVISED OF THE POSSIBILITY
+ * OF SUCH LOSS, DAMAGES, CLAIMS OR COSTS.
+ **********************************************************************************************************************/
+
+#ifndef RM_LPM_TICKLESS_H
+#define RM_LPM_TICKLESS_H
+
+/***********************************************************************************************************************
+ * Includes
+ **********************************************************************************************************************/
+#include "bsp_api.h"
+#include "r_lpm_api.h"
+#include "r_timer_api.h"
+#include "rm_lpm_tickless_cfg.h"
+
+/* Common macro for FSP header files. There is also a corresponding FSP_FOOTER macro at the end of this file. */
+FSP_HEADER
+
+/*******************************************************************************************************************//**
+ * @addtogroup RM_LPM_TICKLESS
+ * @{
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+#define RM_LPM_TICKLESS_CODE_VERSION_MAJOR    (1U)
+#define RM_LPM_TICKLESS_CODE_VERSION_MINOR    (0U)
+
+/***********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+
+/** Idle depths, from the shallowest to the deepest. A constraint on a depth allows that depth and shallower ones. */
+typedef enum e_rm_lpm_tickless_depth
+{
+    RM_LPM_TICKLESS_DEPTH_SLEEP   = 0, ///< Sleep mode, all peripherals keep running
+    RM_LPM_TICKLESS_DEPTH_SNOOZE  = 1, ///< Software Standby mode with Snooze mode enabled
+    RM_LPM_TICKLESS_DEPTH_STANDBY = 2, ///< Software Standby mode
+    RM_LPM_TICKLESS_DEPTH_COUNT   = 3, ///< Number of idle depths
+} rm_lpm_tickless_depth_t;
+
+/** Events reported to the callback function */
+typedef enum e_rm_lpm_tickless_event
+{
+    RM_LPM_TICKLESS_EVENT_PRE_SLEEP  = 0, ///< The MCU is about to enter the idle depth
+    RM_LPM_TICKLESS_EVENT_POST_SLEEP = 1, ///< The MCU woke up, the elapsed ticks are valid
+} rm_lpm_tickless_event_t;
+
+/** Callback function parameter structure */
+typedef struct st_rm_lpm_tickless_callback_args
+{
+    rm_lpm_tickless_event_t event;         ///< Event code
+    rm_lpm_tickless_depth_t depth;         ///< Idle depth entered
+    uint32_t                elapsed_ticks; ///< Ticks spent idle, only valid for RM_LPM_TICKLESS_EVENT_POST_SLEEP
+    void const            * p_context;     ///< Context provided to user during callback
+} rm_lpm_tickless_callback_args_t;
+
+/** User configuration structure, used in open function */
+typedef struct st_rm_lpm_tickless_cfg
+{
+    /** Low power mode instance, opened with p_mode_cfg[RM_LPM_TICKLESS_DEPTH_SLEEP] by RM_LPM_TICKLESS_Open. */
+    lpm_instance_t const * p_lpm;
+
+    /** Low power mode configuration of each depth, applied with lpm_api_t::lowPowerReconfigure when the depth changes.
+     * The sleep configuration is required. Set the snooze or standby configuration to NULL to never enter that depth.
+     * The standby and snooze configurations must have the AGT underflow of p_timer as standby wake source. */
+    lpm_cfg_t const * p_mode_cfg[RM_LPM_TICKLESS_DEPTH_COUNT];
+
+    /** Shortest expected idle time in ticks worth entering each depth. It must cover the entry and wake-up latency of
+     * the depth, for example the oscillator stabilization time after Software Standby mode. Entry 0 is not used. */
+    uint32_t min_idle_ticks[RM_LPM_TICKLESS_DEPTH_COUNT];
+
+    /** AGT instance used as low-power tick, opened by RM_LPM_TICKLESS_Open. It must count from LOCO or the sub-clock so
+     * it keeps running in Software Standby mode, and its underflow interrupt must be enabled. The callback of the
+     * instance is replaced by this module. */
+    timer_instance_t const * p_timer;
+
+    uint32_t tick_rate_hz;                                          ///< RTOS tick rate, at most the AGT clock
+    void (* p_callback)(rm_lpm_tickless_callback_args_t * p_args); ///< Optional callback around each idle period
+    void const * p_context;                                         ///< User defined context passed to the callback
+} rm_lpm_tickless_cfg_t;
+
+/** Instance control block.  This is private to the FSP and should not be used or modified by the application. */
+typedef struct st_rm_lpm_tickless_instance_ctrl
+{
+    uint32_t                      open;
+    rm_lpm_tickless_cfg_t const * p_cfg;
+    uint32_t                      timer_hz;                                 // AGT count frequency
+    uint32_t                      max_idle_ticks;                           // Longest idle period the AGT can time
+    uint32_t                      fraction;                                 // Counts not yet accounted as a tick,
+                                                                            // scaled by tick_rate_hz
+    rm_lpm_tickless_depth_t       depth_applied;                            // Depth of the active LPM configuration
+    volatile bool                 timer_expired;                            // The AGT underflowed while idle
+    volatile uint8_t              constraints[RM_LPM_TICKLESS_DEPTH_COUNT]; // Registered constraints per depth
+} rm_lpm_tickless_instance_ctrl_t;
+
+/**********************************************************************************************************************
+ * Exported global variables
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Public APIs
+ **********************************************************************************************************************/
+fsp_err_t RM_LPM_TICKLESS_Open(rm_lpm_tickless_instance_ctrl_t * const p_ctrl,
+                               rm_lpm_tickless_cfg_t const * const     p_cfg);
+fsp_err_t RM_LPM_TICKLESS_ConstraintSet(rm_lpm_tickless_instance_ctrl_t * const p_ctrl,
+                                        rm_lpm_tickless_depth_t                 depth);
+fsp_err_t RM_LPM_TICKLESS_ConstraintRelease(rm_lpm_tickless_instance_ctrl_t * const p_ctrl,
+                                            rm_lpm_tickless_depth_t                 depth);
+fsp_err_t RM_LPM_TICKLESS_Sleep(rm_lpm_tickless_instance_ctrl_t * const p_ctrl,
+                                uint32_t                                expected_idle_ticks,
+                                uint32_t * const                        p_elapsed_ticks);
+fsp_err_t RM_LPM_TICKLESS_Close(rm_lpm_tickless_instance_ctrl_t * const p_ctrl);
+fsp_err_t RM_LPM_TICKLESS_VersionGet(fsp_version_t * const p_version);
+
+/* Common macro for FSP header files. There is also a corresponding FSP_HEADER macro at the top of this file. */
+FSP_FOOTER
+
+#endif                                 // RM_LPM_TICKLESS_H
+
+/*******************************************************************************************************************//**
+ * @} (end defgroup RM_LPM_TICKLESS)
+ **********************************************************************************************************************/
@@ -0,0 +1,188 @@
+/***********************************************************************************************************************
+ * Copyright [2020] Renesas Electronics Corporation and/or its affiliates.  All Rights Reserved.
+ *
+ * This software and documentation are supplied by Renesas Electronics America Inc. and may only be used with products
+ * of Renesas Electronics Corp. and its affiliates ("Renesas").  No other uses are authorized.  Renesas products are
+ * sold pursuant to Renesas terms and conditions of sale.  Purchasers are solely responsible for the selection and use
+ * of Renesas products and Renesas assumes no liability.  No license, express or implied, to any intellectual property
+ * right is granted by Renesas. This software is protected under all applicable laws, including copyright laws. Renesas
+ * reserves the right to change or discontinue this software and/or this documentation. THE SOFTWARE AND DOCUMENTATION
+ * IS DELIVERED TO YOU "AS IS," AND RENESAS MAKES NO REPRESENTATIONS OR WARRANTIES, AND TO THE FULLEST EXTENT
+ * PERMISSIBLE UNDER APPLICABLE LAW, DISCLAIMS ALL WARRANTIES, WHETHER EXPLICITLY OR IMPLICITLY, INCLUDING WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, AND NONINFRINGEMENT, WITH RESPECT TO THE SOFTWARE OR
+ * DOCUMENTATION.  RENESAS SHALL HAVE NO LIABILITY ARISING OUT OF ANY SECURITY VULNERABILITY OR BREACH.  TO THE MAXIMUM
+ * EXTENT PERMITTED BY LAW, IN NO EVENT WILL RENESAS BE LIABLE TO YOU IN CONNECTION WITH THE SOFTWARE OR DOCUMENTATION
+ * (OR ANY PERSON OR ENTITY CLAIMING RIGHTS DERIVED FROM YOU) FOR ANY LOSS, DAMAGES, OR CLAIMS WHATSOEVER, INCLUDING,
+ * WITHOUT LIMITATION, ANY DIRECT, CONSEQUENTIAL, SPECIAL, INDIRECT, PUNITIVE, OR INCIDENTAL DAMAGES; ANY LOST PROFITS,
+ * OTHER ECONOMIC DAMAGE, PROPERTY DAMAGE, OR PERSONAL INJURY; AND EVEN IF RENESAS HAS BEEN ADVISED OF THE POSSIBILITY
+ * OF SUCH LOSS, DAMAGES, CLAIMS OR COSTS.
+ **********************************************************************************************************************/
+
+#ifndef RM_MJPEG_H
+#define RM_MJPEG_H
+
+/***********************************************************************************************************************
+ * Includes
+ **********************************************************************************************************************/
+#include "bsp_api.h"
+#include "r_jpeg_api.h"
+#include "rm_drw_frame.h"
+#include "rm_mjpeg_cfg.h"
+
+/* Common macro for FSP header files. There is also a corresponding FSP_FOOTER macro at the end of this file. */
+FSP_HEADER
+
+/*******************************************************************************************************************//**
+ * @addtogroup RM_MJPEG
+ * @{
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+#define RM_MJPEG_CODE_VERSION_MAJOR    (1U)
+#define RM_MJPEG_CODE_VERSION_MINOR    (0U)
+
+/** Maximum number of compressed frames held in the frame queue. */
+#define RM_MJPEG_QUEUE_MAX             (8U)
+
+/** Number of decode buffers. One is decoded into while the D/AVE 2D converts the other. */
+#define RM_MJPEG_DECODE_BUFFERS        (2U)
+
+/***********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+
+/** Events reported to the callback function. Call RM_MJPEG_Process after each event. */
+typedef enum e_rm_mjpeg_event
+{
+    RM_MJPEG_EVENT_FRAME_DECODED = 0,  ///< The JPEG codec finished a frame, from the JPEG interrupt
+    RM_MJPEG_EVENT_VSYNC         = 1,  ///< Vertical blank, from the display interrupt
+} rm_mjpeg_event_t;
+
+/** Callback function parameter structure */
+typedef struct st_rm_mjpeg_callback_args
+{
+    rm_mjpeg_event_t event;            ///< Event code
+    void const     * p_context;        ///< Context provided to user during callback
+} rm_mjpeg_callback_args_t;
+
+/** Stream information read from the AVI headers. */
+typedef struct st_rm_mjpeg_info
+{
+    uint16_t width;                    ///< Frame width in pixels
+    uint16_t height;                   ///< Frame height in lines
+    uint32_t frame_count;              ///< Number of frames in the file as declared by the main AVI header
+    uint32_t frame_period_us;          ///< Time between frames in microseconds
+} rm_mjpeg_info_t;
+
+/** Playback statistics. */
+typedef struct st_rm_mjpeg_statistics
+{
+    uint32_t frames_read;              ///< Compressed frames read from the source into the frame queue
+    uint32_t frames_decoded;           ///< Frames decoded by the JPEG codec
+    uint32_t frames_presented;         ///< Frames converted by the D/AVE 2D and passed to the frame scheduler
+    uint32_t frames_dropped;           ///< Frames skipped because they were late or did not fit the queue or buffers
+    uint32_t decode_errors;            ///< Frames the JPEG codec reported an error for
+    uint32_t fps_x100;                 ///< Presented frames per second since playback started, times 100
+    uint8_t  queue_frames;             ///< Compressed frames currently queued
+} rm_mjpeg_statistics_t;
+
+/** User configuration structure, used in open function */
+typedef struct st_rm_mjpeg_cfg
+{
+    /** Reads size bytes of the AVI file at offset into p_buffer, for example with ff_fseek/ff_fread from a
+     * FreeRTOS+FAT file or with memcpy from QSPI flash in XIP mode. Only called from RM_MJPEG_Open and
+     * RM_MJPEG_Process. */
+    fsp_err_t (* p_read)(void const * p_context, uint32_t offset, void * p_buffer, uint32_t size);
+
+    /** JPEG codec in decode mode, opened by this module. Its decode callback must be rm_mjpeg_jpeg_callback() with the
+     * control structure of this module as p_decode_context. */
+    jpeg_instance_t const * p_jpeg;
+
+    /** Opened frame scheduler the converted frames are presented with. Its callback must be rm_mjpeg_frame_callback()
+     * with the control structure of this module as p_context. */
+    rm_drw_frame_instance_ctrl_t * p_frame;
+
+    uint8_t * p_queue;                 ///< Compressed frame queue, 8-byte aligned, holds at least the largest frame
+    uint32_t  queue_size;              ///< Size of the frame queue in bytes
+
+    /** Decode buffers of decode_buffer_size bytes each, in the pixel format of the JPEG codec. */
+    uint8_t * p_decode_buffers[RM_MJPEG_DECODE_BUFFERS];
+    uint32_t  decode_buffer_size;      ///< Size of each decode buffer in bytes
+    uint16_t  decode_stride;           ///< Line stride of the decode buffers in pixels, 8-byte aligned lines
+
+    /** Destination rectangle in the frame buffer. A width or height of 0 uses the video size, other sizes scale the
+     * video with bilinear filtering. */
+    int16_t  x;
+    int16_t  y;
+    uint16_t width;
+    uint16_t height;
+
+    uint32_t display_frame_us;         ///< Display refresh period in microseconds, the playback clock
+    bool     loop;                     ///< Restart from the first frame at the end of the file
+
+    void (* p_callback)(rm_mjpeg_callback_args_t * p_args); ///< Optional callback called from the interrupts
+    void const * p_context;                                  ///< User defined context passed to the callbacks
+} rm_mjpeg_cfg_t;
+
+/** Compressed frame in the frame queue. */
+typedef struct st_rm_mjpeg_queue_entry
+{
+    uint32_t offset;                   // Start of the frame data in the frame queue
+    uint32_t size;                     // Frame size rounded up to 8 bytes, 0 for a frame repeating the previous one
+    uint32_t frame;                    // Frame number since playback started
+} rm_mjpeg_queue_entry_t;
+
+/** Instance control block.  This is private to the FSP and should not be used or modified by the application. */
+typedef struct st_rm_mjpeg_instance_ctrl
+{
+    uint32_t               open;
+    rm_mjpeg_cfg_t const * p_cfg;
+    rm_mjpeg_info_t        info;
+    uint32_t               video_stream;     // Stream number of the video stream, selects the movi chunk IDs
+    uint32_t               movi_start;       // Offset of the first chunk in the movi list
+    uint32_t               movi_end;         // Offset after the movi list
+    uint32_t               movi_pos;         // Offset of the next movi chunk to read
+    bool                   source_end;       // All frames of the file were read and loop is disabled
+    uint32_t               frames_queued;    // Frame number of the next frame read from the source
+    uint32_t               wrap_frame;       // frames_queued when the movi list was last restarted
+    rm_mjpeg_queue_entry_t queue[RM_MJPEG_QUEUE_MAX];
+    uint8_t                queue_head;       // Oldest queued frame
+    uint8_t                queue_count;      // Number of queued frames
+    uint32_t               queue_write;      // Offset in the frame queue the next frame is read to
+    volatile uint8_t       decode_state;     // State of the frame in the decode buffer
+    uint8_t                decode_buffer;    // Decode buffer of the current frame
+    uint32_t               decode_frame;     // Frame number of the current frame
+    bool                   decode_queued;    // The current frame is still in the frame queue
+    bool                   codec_used;       // The codec decoded a frame since it was opened
+    bool                   started;          // RM_MJPEG_Process was called, the playback clock runs
+    volatile uint32_t      vsyncs;           // Vertical blanks since playback started
+    rm_mjpeg_statistics_t  statistics;
+} rm_mjpeg_instance_ctrl_t;
+
+/**********************************************************************************************************************
+ * Exported global variables
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Public APIs
+ **********************************************************************************************************************/
+fsp_err_t RM_MJPEG_Open(rm_mjpeg_instance_ctrl_t * const p_ctrl, rm_mjpeg_cfg_t const * const p_cfg);
+fsp_err_t RM_MJPEG_InfoGet(rm_mjpeg_instance_ctrl_t * const p_ctrl, rm_mjpeg_info_t * const p_info);
+fsp_err_t RM_MJPEG_Process(rm_mjpeg_instance_ctrl_t * const p_ctrl, bool * const p_end);
+fsp_err_t RM_MJPEG_StatisticsGet(rm_mjpeg_instance_ctrl_t * const p_ctrl, rm_mjpeg_statistics_t * const p_statistics);
+fsp_err_t RM_MJPEG_Close(rm_mjpeg_instance_ctrl_t * const p_ctrl);
+fsp_err_t RM_MJPEG_VersionGet(fsp_version_t * const p_version);
+
+void rm_mjpeg_jpeg_callback(jpeg_callback_args_t * p_args);
+void rm_mjpeg_frame_callback(rm_drw_frame_callback_args_t * p_args);
+
+/* Common macro for FSP header files. There is also a corresponding FSP_HEADER macro at the top of this file. */
+FSP_FOOTER
+
+#endif                                 // RM_MJPEG_H
+
+/*******************************************************************************************************************//**
+ * @} (end defgroup RM_MJPEG)
+ **********************************************************************************************************************/
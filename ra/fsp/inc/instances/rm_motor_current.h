@@ -56,6 +56,13 @@ typedef enum  e_motor_current_voltage_compensation_select
     MOTOR_CURRENT_VOLTAGE_COMPENSATION_SELECT_ENABLE  = 1
 } motor_current_voltage_compensation_select_t;
 
+/** Coordinate transform kernels (floating point current loop) */
+typedef enum e_motor_current_transform_select
+{
+    MOTOR_CURRENT_TRANSFORM_SELECT_STANDARD = 0, ///< sinf/cosf evaluated for each transform
+    MOTOR_CURRENT_TRANSFORM_SELECT_TABLE    = 1  ///< Interpolated sin/cos table, shared by the transforms of a cycle
+} motor_current_transform_select_t;
+
 typedef struct st_motor_current_pi_params
 {
     float f_err;                       ///< Error
@@ -94,6 +101,72 @@ typedef struct st_motor_current_voltage_compensation
     motor_current_voltage_compensation_select_t u1_volt_err_comp_enable;
 } motor_currnt_voltage_compensation_t;
 
+/** Gain of the fixed-point current loop, value = s2_mant / 32768 * 2^s1_exp */
+typedef struct st_motor_current_fixed_gain
+{
+    int16_t s2_mant;                   ///< Q15 mantissa
+    int8_t  s1_exp;                    ///< Binary exponent
+} motor_current_fixed_gain_t;
+
+/** Per-unit state of the fixed-point current loop (used when MOTOR_CURRENT_CFG_FIXED_POINT_ENABLE is set) */
+typedef struct st_motor_current_fixed
+{
+    float f_i_to_pu;                   ///< 32768 / current base [1/A]
+    float f_v_to_pu;                   ///< 32768 / voltage base [1/V]
+    float f_w_to_pu;                   ///< 32768 / speed base [s/rad]
+    float f_pu_to_i;                   ///< Current base / 32768 [A]
+    float f_pu_to_v;                   ///< Voltage base / 32768 [V]
+
+    motor_current_fixed_gain_t kp;     ///< Proportional gain of the current PI controllers
+    motor_current_fixed_gain_t ki;     ///< Integral gain of the current PI controllers
+    motor_current_fixed_gain_t ld;     ///< Speed * Ld for decoupling
+    motor_current_fixed_gain_t lq;     ///< Speed * Lq for decoupling
+    motor_current_fixed_gain_t m;      ///< Speed * magnet flux for decoupling
+
+    int32_t s4_ilimit;                 ///< Limit of the integral terms (Q30)
+    int32_t s4_refi_d;                 ///< Integral term of the d-axis PI controller (Q30)
+    int32_t s4_refi_q;                 ///< Integral term of the q-axis PI controller (Q30)
+    int16_t s2_id;                     ///< D-axis current (Q15)
+    int16_t s2_iq;                     ///< Q-axis current (Q15)
+} motor_current_fixed_t;
+
+/** Estimator input captured by the current control cycle (multi-rate execution) */
+typedef struct st_motor_current_angle_input
+{
+    motor_angle_current_t           current;                ///< Dq-axis current [A]
+    motor_angle_voltage_reference_t voltage;                ///< Dq-axis voltage reference [V]
+    float    f_ref_speed_rad_ctrl;                          ///< Command speed [rad/s]
+    float    f_damp_comp_speed;                             ///< Damping speed [rad/s]
+    uint32_t u4_cycle;                                      ///< Current control cycle of the capture
+    uint8_t  u1_flag_pi;                                    ///< PI control flag of the speed module
+} motor_current_angle_input_t;
+
+/** Estimator output applied by the current control cycle (multi-rate execution) */
+typedef struct st_motor_current_angle_output
+{
+    float    f_rotor_angle;                                 ///< Rotor angle at the capture [rad]
+    float    f_speed_rad;                                   ///< Rotor speed [rad/s]
+    float    f_phase_err;                                   ///< Phase error [rad]
+    float    f_ed;                                          ///< Estimated d-axis BEMF [V]
+    float    f_eq;                                          ///< Estimated q-axis BEMF [V]
+    uint32_t u4_cycle;                                      ///< Current control cycle of the input
+} motor_current_angle_output_t;
+
+/** State of the multi-rate execution. Both directions are double buffered and published by incrementing the
+ * sequence, so neither interrupt ever waits for the other. */
+typedef struct st_motor_current_multi_rate
+{
+    uint32_t u4_cycle;                                      ///< Current control cycles since the start
+    volatile uint32_t u4_input_sequence;                    ///< Inputs published, bit 0 indexes the newest one
+    uint32_t u4_input_taken;                                ///< Input sequence consumed by the estimation
+    volatile uint32_t u4_output_sequence;                   ///< Outputs published, bit 0 indexes the newest one
+    uint32_t u4_output_applied;                             ///< Output sequence applied by the current control
+    uint32_t u4_overruns;                                   ///< Inputs replaced before they were estimated
+    float    f_period;                                      ///< Current control period [s]
+    motor_current_angle_input_t  st_input[2];
+    motor_current_angle_output_t st_output[2];
+} motor_current_multi_rate_t;
+
 typedef struct st_motor_current_extended_cfg
 {
     float f_comp_v[MOTOR_CURRENT_VOLTAGE_COMPENSATION_TABLE_ARRAY_SIZE]; ///< Voltage error compensation table of voltage
@@ -101,6 +174,15 @@ typedef struct st_motor_current_extended_cfg
     motor_current_voltage_compensation_select_t vcomp_enable;            ///< Enable/Disable select of voltage error compensation
     float f_current_ctrl_period;                                         ///< Current control period [usec]
     float f_ilimit;                                                      ///< Current limit [A]
+    float f_current_base;                                                ///< Full scale current [A] (fixed point)
+    float f_voltage_base;                                                ///< Full scale voltage [V] (fixed point)
+    motor_current_transform_select_t transform_select;                   ///< Coordinate transform kernels
+
+    /* Multi-rate execution (MOTOR_CURRENT_CFG_MULTI_RATE_ENABLE). The angle module ctrl period must be set to
+     * u1_angle_divisor times the current control period. */
+    uint8_t   u1_angle_divisor;                                          ///< Current control cycles per estimation, 0 or 1 to estimate every cycle
+    IRQn_Type angle_irq;                                                 ///< Unused interrupt whose vector is rm_motor_current_angle_isr
+    uint8_t   angle_ipl;                                                 ///< Estimation priority, lower than the A/D interrupt
 
     motor_current_motor_parameter_t  * p_motor_parameter;                ///< Motor Parameters
     motor_current_design_parameter_t * p_design_parameter;               ///< PI control designed parameters
@@ -141,10 +223,18 @@ typedef struct st_motor_current_instance_ctrl
 
     motor_currnt_voltage_compensation_t st_vcomp; ///< Data for Voltage Error Compensation
 
+    motor_current_fixed_t st_fixed;               ///< Data for the fixed-point current loop
+
     motor_current_input_t st_input;               ///< Data buffer from Speed Control
 
     motor_angle_instance_t const  * p_angle_instance;
     motor_driver_instance_t const * p_driver_instance;
+
+    motor_current_multi_rate_t st_multi_rate;     ///< Data for the multi-rate execution
+
+    /* Benchmark (MOTOR_CURRENT_CFG_BENCHMARK_ENABLE) */
+    bsp_latency_stats_t st_cycles;                ///< CPU cycles of each current control cycle
+    bsp_latency_stats_t st_angle_cycles;          ///< CPU cycles of each angle/speed estimation (angle module calls)
 } motor_current_instance_ctrl_t;
 
 /**********************************************************************************************************************
@@ -200,6 +290,8 @@ fsp_err_t RM_MOTOR_CURRENT_ParameterUpdate(motor_current_ctrl_t * const      p_c
 
 fsp_err_t RM_MOTOR_CURRENT_VersionGet(fsp_version_t * const p_version);
 
+void rm_motor_current_angle_isr(void);
+
 /* Common macro for FSP header files. There is also a corresponding FSP_HEADER macro at the top of this file. */
 FSP_FOOTER
 
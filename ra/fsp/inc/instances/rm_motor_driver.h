@@ -42,9 +42,19 @@ FSP_HEADER
 #define MOTOR_DRIVER_CODE_VERSION_MAJOR    (1U)
 #define MOTOR_DRIVER_CODE_VERSION_MINOR    (0U)
 
+#define MOTOR_DRIVER_ADC_BUFFER_MAX        (32U) ///< Maximum number of A/D result registers transferred per scan
+
 /***********************************************************************************************************************
  * Typedef definitions
  **********************************************************************************************************************/
+
+/** SVPWM common mode calculation */
+typedef enum e_motor_driver_svpwm_select
+{
+    MOTOR_DRIVER_SVPWM_SELECT_STANDARD   = 0, ///< Sort the phase voltages with compare and branch
+    MOTOR_DRIVER_SVPWM_SELECT_BRANCHLESS = 1  ///< Minimum/maximum by absolute differences, without branches
+} motor_driver_svpwm_select_t;
+
 typedef struct st_motor_driver_modulation
 {
     float   f4_vdc;                    ///< Main Line Voltage (Vdc) [V]
@@ -54,6 +64,10 @@ typedef struct st_motor_driver_modulation
     float   f4_min_duty;               ///< Minimum duty cycle
     float   f4_neutral_duty;           ///< Duty cycle that represents 0[V]
     uint8_t u1_sat_flag;               ///< Saturation flag
+    int16_t s2_max_duty;               ///< Maximum duty cycle (Q15, fixed point modulation)
+    int16_t s2_min_duty;               ///< Minimum duty cycle (Q15, fixed point modulation)
+    int16_t s2_neutral_duty;           ///< Duty cycle that represents 0[V] (Q15, fixed point modulation)
+    motor_driver_svpwm_select_t svpwm_select; ///< SVPWM common mode calculation
 } motor_driver_modulation_t;
 
 typedef struct st_motor_driverextended_cfg
@@ -71,6 +85,11 @@ typedef struct st_motor_driverextended_cfg
     uint16_t u2_offset_calc_count;     ///< Calculation counts for current offset
 
     motor_driver_modulation_t mod_param;
+
+    /* Optional DTC/DMAC transfer of the A/D results, activated by the A/D scan end event (scan started by GPT via
+     * ELC). Set p_adc_transfer to NULL to read the A/D results in the interrupt. */
+    transfer_instance_t const * p_adc_transfer;       ///< Transfer of the A/D result registers to the buffer
+    adc_channel_t               adc_transfer_first_ch; ///< Lowest channel of the scan (first transferred register)
 } motor_driver_extended_cfg_t;
 
 typedef struct st_motor_driver_instance_ctrl
@@ -100,6 +119,17 @@ typedef struct st_motor_driver_instance_ctrl
 
     /* For ADC callback */
     adc_callback_args_t adc_callback_args; ///< For call ADC callbackSet function
+
+    /* For A/D result transfer */
+    transfer_info_t adc_transfer_info;                             ///< Transfer settings (referenced by DTC/DMAC)
+    uint16_t        u2_adc_buffer[2][MOTOR_DRIVER_ADC_BUFFER_MAX]; ///< Ping-pong buffer of the A/D results
+    uint8_t         u1_adc_buffer_ready;                           ///< Buffer holding the latest A/D results
+    uint8_t         u1_iu_index;                                   ///< Buffer index of U phase current
+    uint8_t         u1_iw_index;                                   ///< Buffer index of W phase current
+    uint8_t         u1_vdc_index;                                  ///< Buffer index of Main Line Voltage
+
+    /* Benchmark (MOTOR_DRIVER_CFG_BENCHMARK_ENABLE) */
+    bsp_latency_stats_t st_cycles;     ///< CPU cycles of each cyclic process, including the current control
 } motor_driver_instance_ctrl_t;
 
 /**********************************************************************************************************************
@@ -0,0 +1,155 @@
+/***********************************************************************************************************************
+ * Copyright [2020] Renesas Electronics Corporation and/or its affiliates.  All Rights Reserved.
+ *
+ * This software and documentation are supplied by Renesas Electronics America Inc. and may only be used with products
+ * of Renesas Electronics Corp. and its affiliates ("Renesas").  No other uses are authorized.  Renesas products are
+ * sold pursuant to Renesas terms and conditions of sale.  Purchasers are solely responsible for the selection and use
+ * of Renesas products and Renesas assumes no liability.  No license, express or implied, to any intellectual property
+ * right is granted by Renesas. This software is protected under all applicable laws, including copyright laws. Renesas
+ * reserves the right to change or discontinue this software and/or this documentation. THE SOFTWARE AND DOCUMENTATION
+ * IS DELIVERED TO YOU "AS IS," AND RENESAS MAKES NO REPRESENTATIONS OR WARRANTIES, AND TO THE FULLEST EXTENT
+ * PERMISSIBLE UNDER APPLICABLE LAW, DISCLAIMS ALL WARRANTIES, WHETHER EXPLICITLY OR IMPLICITLY, INCLUDING WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, AND NONINFRINGEMENT, WITH RESPECT TO THE SOFTWARE OR
+ * DOCUMENTATION.  RENESAS SHALL HAVE NO LIABILITY ARISING OUT OF ANY SECURITY VULNERABILITY OR BREACH.  TO THE MAXIMUM
+ * EXTENT PERMITTED BY LAW, IN NO EVENT WILL RENESAS BE LIABLE TO YOU IN CONNECTION WITH THE SOFTWARE OR DOCUMENTATION
+ * (OR ANY PERSON OR ENTITY CLAIMING RIGHTS DERIVED FROM YOU) FOR ANY LOSS, DAMAGES, OR CLAIMS WHATSOEVER, INCLUDING,
+ * WITHOUT LIMITATION, ANY DIRECT, CONSEQUENTIAL, SPECIAL, INDIRECT, PUNITIVE, OR INCIDENTAL DAMAGES; ANY LOST PROFITS,
+ * OTHER ECONOMIC DAMAGE, PROPERTY DAMAGE, OR PERSONAL INJURY; AND EVEN IF RENESAS HAS BEEN ADVISED OF THE POSSIBILITY
+ * OF SUCH LOSS, DAMAGES, CLAIMS OR COSTS.
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * @addtogroup MOTOR_PROTECTION
+ * @{
+ **********************************************************************************************************************/
+
+#ifndef RM_MOTOR_PROTECTION_H
+#define RM_MOTOR_PROTECTION_H
+
+/***********************************************************************************************************************
+ * Includes
+ **********************************************************************************************************************/
+#include "bsp_api.h"
+
+#include "r_comparator_api.h"
+#include "r_dac_api.h"
+#include "r_poeg_api.h"
+#include "rm_motor_api.h"
+
+/* Common macro for FSP header files. There is also a corresponding FSP_FOOTER macro at the end of this file. */
+FSP_HEADER
+
+/***********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+#define MOTOR_PROTECTION_CODE_VERSION_MAJOR    (1U)
+#define MOTOR_PROTECTION_CODE_VERSION_MINOR    (0U)
+
+#define MOTOR_PROTECTION_COMPARATOR_MAX        (3U) ///< Maximum number of overcurrent comparators
+#define MOTOR_PROTECTION_FAULT_LOG_NUM         (8U) ///< Number of faults kept in the fault log, a power of two
+
+/***********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+
+/** Record of one output disable */
+typedef struct st_motor_protection_fault
+{
+    poeg_state_t state;                ///< POEG status flags, i.e. the requests that disabled the outputs
+    uint32_t     u4_comparators;       ///< Bit n is set if comparator n still detected overcurrent in the interrupt
+    uint32_t     u4_timestamp;         ///< Timestamp counter when the POEG interrupt was serviced
+    uint32_t     u4_latency;           ///< Timestamp counts from the captured trip to the interrupt, 0 if not captured
+} motor_protection_fault_t;
+
+/** Protection status */
+typedef struct st_motor_protection_status
+{
+    bool     tripped;                  ///< Outputs are disabled, call RM_MOTOR_PROTECTION_Rearm
+    uint32_t u4_fault_num;             ///< Output disables since open
+    uint32_t u4_latency_max;           ///< Longest trip to interrupt latency in timestamp counts
+    uint32_t u4_rearm_num;             ///< Successful re-arms
+    uint32_t u4_rearm_failure_num;     ///< Re-arms refused because the disable request persisted
+} motor_protection_status_t;
+
+/** Callback function parameter data */
+typedef struct st_motor_protection_callback_args
+{
+    void const * p_context;                  ///< Placeholder for user data
+    motor_protection_fault_t const * p_fault; ///< Fault that disabled the outputs
+} motor_protection_callback_args_t;
+
+/** Configuration parameters. */
+typedef struct st_motor_protection_cfg
+{
+    /** POEG group that disables the GPT outputs of the inverter. Its trigger must include POEG_TRIGGER_ACMPHSn for each
+     * comparator, and its interrupt must be enabled. RM_MOTOR_PROTECTION_Open installs its own POEG callback. */
+    poeg_instance_t const * p_poeg;
+
+    /** Opened overcurrent comparators, e.g. one per phase current amplifier. RM_MOTOR_PROTECTION_Open enables their
+     * outputs once the threshold is set. */
+    comparator_instance_t const * p_comparator[MOTOR_PROTECTION_COMPARATOR_MAX];
+
+    /** Opened and started DAC that drives the reference of each comparator, or NULL for a fixed reference. One DAC
+     * may serve several comparators. */
+    dac_instance_t const * p_threshold_dac[MOTOR_PROTECTION_COMPARATOR_MAX];
+
+    uint8_t  u1_comparator_num;         ///< Number of comparators
+    float    f_overcurrent_limit;       ///< Trip current [A]
+    float    f_dac_counts_per_ampere;   ///< DAC counts per ampere, including the gain of the current amplifier
+    uint16_t u2_dac_offset;             ///< DAC counts at 0 A
+
+    /** Free running counter read first in the POEG interrupt, e.g. &R_GPT4->GTCNT, or NULL. */
+    uint32_t const volatile * p_timestamp;
+
+    /** Counter captured at the trip itself, e.g. &R_GPT4->GTCCRA of the same timer captured on the ACMPHS ELC event,
+     * or NULL. The difference to p_timestamp is recorded as trip to interrupt latency. */
+    uint32_t const volatile * p_trip_capture;
+
+    /** Motor notified with MOTOR_ERROR_OVER_CURRENT_HW on a comparator or pin trip, and reset on re-arm, or NULL. */
+    motor_instance_t const * p_motor;
+
+    uint32_t u4_rearm_retries;          ///< POEG resets RM_MOTOR_PROTECTION_Rearm tries before it gives up
+
+    /** Called from the POEG interrupt after the fault is recorded, or NULL */
+    void (* p_callback)(motor_protection_callback_args_t * p_args);
+    void const * p_context;             ///< Placeholder for user data, passed to p_callback
+} motor_protection_cfg_t;
+
+/** Instance control block. This is private to the FSP and should not be used or modified by the application. */
+typedef struct st_motor_protection_instance_ctrl
+{
+    uint32_t open;
+
+    motor_protection_fault_t  fault_log[MOTOR_PROTECTION_FAULT_LOG_NUM]; ///< Latest faults, indexed by fault number
+    motor_protection_status_t status;
+
+    motor_protection_cfg_t const * p_cfg;
+} motor_protection_instance_ctrl_t;
+
+/**********************************************************************************************************************
+ * Public Function Prototypes
+ **********************************************************************************************************************/
+fsp_err_t RM_MOTOR_PROTECTION_Open(motor_protection_instance_ctrl_t * const p_ctrl,
+                                   motor_protection_cfg_t const * const     p_cfg);
+
+fsp_err_t RM_MOTOR_PROTECTION_Close(motor_protection_instance_ctrl_t * const p_ctrl);
+
+fsp_err_t RM_MOTOR_PROTECTION_Rearm(motor_protection_instance_ctrl_t * const p_ctrl);
+
+fsp_err_t RM_MOTOR_PROTECTION_StatusGet(motor_protection_instance_ctrl_t * const p_ctrl,
+                                        motor_protection_status_t * const        p_status);
+
+fsp_err_t RM_MOTOR_PROTECTION_FaultGet(motor_protection_instance_ctrl_t * const p_ctrl,
+                                       uint32_t                                 u4_index,
+                                       motor_protection_fault_t * const         p_fault);
+
+void rm_motor_protection_poeg_callback(poeg_callback_args_t * p_args);
+
+/*******************************************************************************************************************//**
+ * @} (end addtogroup MOTOR_PROTECTION)
+ **********************************************************************************************************************/
+
+/* Common macro for FSP header files. There is also a corresponding FSP_HEADER macro at the top of this file. */
+FSP_FOOTER
+
+#endif                                 // RM_MOTOR_PROTECTION_H
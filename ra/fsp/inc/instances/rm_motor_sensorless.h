@@ -43,6 +43,8 @@ FSP_HEADER
 #define MOTOR_SENSORLESS_CODE_VERSION_MAJOR    (1U)
 #define MOTOR_SENSORLESS_CODE_VERSION_MINOR    (0U)
 
+#define MOTOR_SENSORLESS_MULTI_AXIS_MAX        (3U) ///< Maximum number of axes of a multi-axis coordinator
+
 /***********************************************************************************************************************
  * Typedef definitions
  **********************************************************************************************************************/
@@ -91,12 +93,35 @@ typedef struct st_motor_sensorless_extended_cfg
     void (* p_callback)(motor_sensorless_callback_args_t * p_args);
     void const * p_context;            ///< Placeholder for user data.
 
-    float f_overcurrent_limit;         ///< Over-current limit [A]
+    float f_overcurrent_limit;         ///< Over-current limit [A], 0 to only use the hardware trip
     float f_overvoltage_limit;         ///< Over-voltage limit [V]
     float f_overspeed_limit;           ///< Over-speed limit [rad/s]
     float f_lowvoltage_limit;          ///< Low-voltage limit [V]
 } motor_sensorless_extended_cfg_t;
 
+/** Current control loop latency of one axis, in PWM timer counts from the carrier trough (A/D trigger) to the end of
+ * the current control (PWM duty set). Only measured while the axis belongs to a multi-axis coordinator. */
+typedef struct st_motor_sensorless_latency
+{
+    uint32_t u4_latency_last;          ///< Latency of the latest current control cycle
+    uint32_t u4_latency_max;           ///< Worst-case latency since the coordinator was opened or the last reset
+    uint32_t u4_carrier_counts;        ///< Counts of one carrier period, latencies are valid up to half of it
+} motor_sensorless_latency_t;
+
+/** CPU cycles of the control loops of one axis and the CPU load they cause. Cycles are measured with the DWT cycle
+ * counter when MOTOR_DRIVER_CFG_BENCHMARK_ENABLE, MOTOR_CURRENT_CFG_BENCHMARK_ENABLE and
+ * MOTOR_SPEED_CFG_BENCHMARK_ENABLE are set; the stats of a module built without its option stay empty. */
+typedef struct st_motor_sensorless_benchmark
+{
+    bsp_latency_stats_t st_driver;     ///< Driver cyclic process (A/D read, current control, PWM duty set)
+    bsp_latency_stats_t st_current;    ///< Current control, including the angle/speed estimation
+    bsp_latency_stats_t st_estimate;   ///< Angle/speed estimation
+    bsp_latency_stats_t st_speed;      ///< Speed control
+    float               f_current_hz;  ///< Current control frequency [Hz]
+    float               f_speed_hz;    ///< Speed control frequency [Hz]
+    float               f_cpu_load;    ///< Average CPU load of the driver and speed control [%]
+} motor_sensorless_benchmark_t;
+
 typedef struct st_motor_sensorless_instance_ctrl
 {
     uint32_t open;                     ///< Used to determine if the channel is configured
@@ -111,9 +136,36 @@ typedef struct st_motor_sensorless_instance_ctrl
     motor_current_input_t  st_current_input;
     motor_current_output_t st_current_output;
 
+    /* Multi-axis coordination */
+    timer_instance_t const   * p_latency_timer; ///< PWM timer used for latency measurement (NULL: not measured)
+    motor_sensorless_latency_t st_latency;      ///< Current control loop latency
+
     motor_cfg_t const * p_cfg;
 } motor_sensorless_instance_ctrl_t;
 
+/** One axis of a multi-axis coordinator */
+typedef struct st_motor_sensorless_axis_cfg
+{
+    motor_instance_t const * p_motor;           ///< Opened rm_motor_sensorless instance of the axis
+    void const             * p_adc_channel_cfg; ///< R_ADC_ScanCfg configuration (NULL: keep), one per unit
+    adc_event_t              adc_event;         ///< Scan end event of the axis (group A or group B)
+} motor_sensorless_axis_cfg_t;
+
+/** Multi-axis coordinator configuration */
+typedef struct st_motor_sensorless_multi_axis_cfg
+{
+    uint8_t u1_axis_num;                        ///< Number of axes, up to MOTOR_SENSORLESS_MULTI_AXIS_MAX
+    motor_sensorless_axis_cfg_t const * p_axis; ///< Axes, the carrier of axis n is delayed by n / u1_axis_num period
+} motor_sensorless_multi_axis_cfg_t;
+
+/** Multi-axis coordinator control block. Allocate an instance specific control block to pass into the API calls. */
+typedef struct st_motor_sensorless_multi_axis_ctrl
+{
+    uint32_t open;                                                  ///< Used to determine if it is opened
+    motor_driver_instance_t const * p_driver[MOTOR_SENSORLESS_MULTI_AXIS_MAX]; ///< Motor driver of each axis
+    motor_sensorless_multi_axis_cfg_t const * p_cfg;                ///< Pointer to the configuration
+} motor_sensorless_multi_axis_ctrl_t;
+
 /**********************************************************************************************************************
  * Exported global variables
  **********************************************************************************************************************/
@@ -155,6 +207,20 @@ fsp_err_t RM_MOTOR_SENSORLESS_ErrorCheck(motor_ctrl_t * const p_ctrl, uint16_t *
 
 fsp_err_t RM_MOTOR_SENSORLESS_VersionGet(fsp_version_t * const p_version);
 
+fsp_err_t RM_MOTOR_SENSORLESS_MultiAxisOpen(motor_sensorless_multi_axis_ctrl_t * const      p_ctrl,
+                                            motor_sensorless_multi_axis_cfg_t const * const p_cfg);
+
+fsp_err_t RM_MOTOR_SENSORLESS_MultiAxisClose(motor_sensorless_multi_axis_ctrl_t * const p_ctrl);
+
+fsp_err_t RM_MOTOR_SENSORLESS_LatencyGet(motor_ctrl_t * const p_ctrl, motor_sensorless_latency_t * const p_latency);
+
+fsp_err_t RM_MOTOR_SENSORLESS_LatencyReset(motor_ctrl_t * const p_ctrl);
+
+fsp_err_t RM_MOTOR_SENSORLESS_BenchmarkGet(motor_ctrl_t * const                 p_ctrl,
+                                           motor_sensorless_benchmark_t * const p_benchmark);
+
+fsp_err_t RM_MOTOR_SENSORLESS_BenchmarkReset(motor_ctrl_t * const p_ctrl);
+
 /*******************************************************************************************************************//**
  * @} (end addtogroup MOTOR_SENSORLESS)
  **********************************************************************************************************************/
@@ -215,6 +215,9 @@ typedef struct st_motor_speed_instance_ctrl
     motor_speed_input_t       st_input;
     motor_speed_lpf_t         st_speed_lpf;
     motor_speed_lpf_t         st_phase_err_lpf;
+
+    /* Benchmark (MOTOR_SPEED_CFG_BENCHMARK_ENABLE) */
+    bsp_latency_stats_t st_cycles;     ///< CPU cycles of each speed control cycle
 } motor_speed_instance_ctrl_t;
 
 /**********************************************************************************************************************
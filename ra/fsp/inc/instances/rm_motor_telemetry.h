@@ -0,0 +1,159 @@
+/***********************************************************************************************************************
+ * Copyright [2020] Renesas Electronics Corporation and/or its affiliates.  All Rights Reserved.
+ *
+ * This software and documentation are supplied by Renesas Electronics America Inc. and may only be used with products
+ * of Renesas Electronics Corp. and its affiliates ("Renesas").  No other uses are authorized.  Renesas products are
+ * sold pursuant to Renesas terms and conditions of sale.  Purchasers are solely responsible for the selection and use
+ * of Renesas products and Renesas assumes no liability.  No license, express or implied, to any intellectual property
+ * right is granted by Renesas. This software is protected under all applicable laws, including copyright laws. Renesas
+ * reserves the right to change or discontinue this software and/or this documentation. THE SOFTWARE AND DOCUMENTATION
+ * IS DELIVERED TO YOU "AS IS," AND RENESAS MAKES NO REPRESENTATIONS OR WARRANTIES, AND TO THE FULLEST EXTENT
+ * PERMISSIBLE UNDER APPLICABLE LAW, DISCLAIMS ALL WARRANTIES, WHETHER EXPLICITLY OR IMPLICITLY, INCLUDING WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, AND NONINFRINGEMENT, WITH RESPECT TO THE SOFTWARE OR
+ * DOCUMENTATION.  RENESAS SHALL HAVE NO LIABILITY ARISING OUT OF ANY SECURITY VULNERABILITY OR BREACH.  TO THE MAXIMUM
+ * EXTENT PERMITTED BY LAW, IN NO EVENT WILL RENESAS BE LIABLE TO YOU IN CONNECTION WITH THE SOFTWARE OR DOCUMENTATION
+ * (OR ANY PERSON OR ENTITY CLAIMING RIGHTS DERIVED FROM YOU) FOR ANY LOSS, DAMAGES, OR CLAIMS WHATSOEVER, INCLUDING,
+ * WITHOUT LIMITATION, ANY DIRECT, CONSEQUENTIAL, SPECIAL, INDIRECT, PUNITIVE, OR INCIDENTAL DAMAGES; ANY LOST PROFITS,
+ * OTHER ECONOMIC DAMAGE, PROPERTY DAMAGE, OR PERSONAL INJURY; AND EVEN IF RENESAS HAS BEEN ADVISED OF THE POSSIBILITY
+ * OF SUCH LOSS, DAMAGES, CLAIMS OR COSTS.
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * @addtogroup MOTOR_TELEMETRY
+ * @{
+ **********************************************************************************************************************/
+
+#ifndef RM_MOTOR_TELEMETRY_H
+#define RM_MOTOR_TELEMETRY_H
+
+/***********************************************************************************************************************
+ * Includes
+ **********************************************************************************************************************/
+#include "bsp_api.h"
+
+#include "r_uart_api.h"
+
+/* Common macro for FSP header files. There is also a corresponding FSP_FOOTER macro at the end of this file. */
+FSP_HEADER
+
+/***********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+#define MOTOR_TELEMETRY_CODE_VERSION_MAJOR    (1U)
+#define MOTOR_TELEMETRY_CODE_VERSION_MINOR    (0U)
+
+#define MOTOR_TELEMETRY_CHANNEL_MAX           (8U) ///< Maximum number of recorded variables
+
+/***********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+
+/** Recording mode */
+typedef enum  e_motor_telemetry_trigger
+{
+    MOTOR_TELEMETRY_TRIGGER_NONE    = 0, ///< Continuous recording, every record is exported
+    MOTOR_TELEMETRY_TRIGGER_RISING  = 1, ///< Single shot, the trigger channel rises through the trigger level
+    MOTOR_TELEMETRY_TRIGGER_FALLING = 2  ///< Single shot, the trigger channel falls through the trigger level
+} motor_telemetry_trigger_t;
+
+/** One word of a record. A record is the sample index followed by one value per channel. */
+typedef union u_motor_telemetry_word
+{
+    uint32_t u4_index;                 ///< Sample index (the first word of a record)
+    float    f_value;                  ///< Channel value
+} motor_telemetry_word_t;
+
+/** Recorder status */
+typedef struct st_motor_telemetry_status
+{
+    uint32_t u4_recorded;              ///< Records written into the ring
+    uint32_t u4_exported;              ///< Records exported
+    uint32_t u4_overrun;               ///< Records lost because the export did not keep up
+    bool     triggered;                ///< Trigger occurred (single shot modes)
+    bool     complete;                 ///< Single shot capture recorded and exported, call RM_MOTOR_TELEMETRY_Arm
+} motor_telemetry_status_t;
+
+/** Configuration parameters. */
+typedef struct st_motor_telemetry_cfg
+{
+    /** Variables recorded at each sample, e.g. &g_motor_current0_ctrl.f_id_ad or &g_motor_current0_ctrl.f_vq_ref */
+    float const * p_channel[MOTOR_TELEMETRY_CHANNEL_MAX];
+    uint8_t       u1_channel_num;      ///< Number of recorded variables
+
+    /** Ring of u4_record_num * (1 + u1_channel_num) words */
+    motor_telemetry_word_t * p_buffer;
+    uint32_t                 u4_record_num;      ///< Number of records in the ring, a power of two
+    uint16_t                 u2_decimation;      ///< Record one of every u2_decimation samples (1: every sample)
+
+    motor_telemetry_trigger_t trigger;           ///< Recording mode
+    uint8_t                   u1_trigger_channel; ///< Channel compared to the trigger level
+    float                     f_trigger_level;    ///< Trigger level
+    uint32_t                  u4_pretrigger_num;  ///< Records kept from before the trigger
+    uint32_t                  u4_posttrigger_num; ///< Records captured from the trigger on
+
+    /** UART the records are exported with. Configure uart_cfg_t::p_transfer_tx so the write runs by DMAC/DTC, and call
+     * RM_MOTOR_TELEMETRY_TxComplete from the UART_EVENT_TX_COMPLETE callback. NULL uses p_write. */
+    uart_instance_t const * p_uart;
+
+    /** Starts an asynchronous write of bytes from p_data, e.g. R_USB_Write for USB PCDC. Call
+     * RM_MOTOR_TELEMETRY_TxComplete when the write completed. */
+    fsp_err_t (* p_write)(void const * p_context, uint8_t const * p_data, uint32_t bytes);
+    void const * p_context;            ///< Placeholder for user data, passed to p_write
+} motor_telemetry_cfg_t;
+
+/** Instance control block. This is private to the FSP and should not be used or modified by the application. */
+typedef struct st_motor_telemetry_instance_ctrl
+{
+    uint32_t open;
+
+    /* Written by RM_MOTOR_TELEMETRY_Sample only */
+    volatile uint32_t u4_head;         ///< Records written
+    uint32_t          u4_index;        ///< Sample index
+    uint32_t          u4_decimation_count;
+    uint32_t          u4_recording;    ///< 1 while recording, 0 otherwise
+    uint32_t          u4_stop;         ///< Record count at which a single shot capture stops
+    uint32_t          u4_stop_enable;  ///< 1 after the trigger in single shot modes
+    uint32_t          u4_overwrite;    ///< 1 before the trigger in single shot modes (pre-trigger history)
+    uint32_t          u4_arm_head;     ///< Records written when the capture was armed
+    uint32_t          u4_overrun;
+    float             f_trigger_prev;  ///< Previous value of the trigger channel
+
+    /* Written by the export functions */
+    volatile uint32_t u4_tail;         ///< Records exported
+    uint32_t          u4_tx_records;   ///< Records of the write in progress (0: idle)
+
+    uint32_t u4_record_words;          ///< Words per record
+    uint32_t u4_mask;                  ///< u4_record_num - 1
+
+    motor_telemetry_word_t scratch[1U + MOTOR_TELEMETRY_CHANNEL_MAX]; ///< Target of samples that are not recorded
+
+    motor_telemetry_cfg_t const * p_cfg;
+} motor_telemetry_instance_ctrl_t;
+
+/**********************************************************************************************************************
+ * Public Function Prototypes
+ **********************************************************************************************************************/
+fsp_err_t RM_MOTOR_TELEMETRY_Open(motor_telemetry_instance_ctrl_t * const p_ctrl,
+                                  motor_telemetry_cfg_t const * const     p_cfg);
+
+fsp_err_t RM_MOTOR_TELEMETRY_Close(motor_telemetry_instance_ctrl_t * const p_ctrl);
+
+void RM_MOTOR_TELEMETRY_Sample(motor_telemetry_instance_ctrl_t * const p_ctrl);
+
+fsp_err_t RM_MOTOR_TELEMETRY_Process(motor_telemetry_instance_ctrl_t * const p_ctrl);
+
+void RM_MOTOR_TELEMETRY_TxComplete(motor_telemetry_instance_ctrl_t * const p_ctrl);
+
+fsp_err_t RM_MOTOR_TELEMETRY_Arm(motor_telemetry_instance_ctrl_t * const p_ctrl);
+
+fsp_err_t RM_MOTOR_TELEMETRY_StatusGet(motor_telemetry_instance_ctrl_t * const p_ctrl,
+                                       motor_telemetry_status_t * const        p_status);
+
+/*******************************************************************************************************************//**
+ * @} (end addtogroup MOTOR_TELEMETRY)
+ **********************************************************************************************************************/
+
+/* Common macro for FSP header files. There is also a corresponding FSP_HEADER macro at the top of this file. */
+FSP_FOOTER
+
+#endif                                 // RM_MOTOR_TELEMETRY_H
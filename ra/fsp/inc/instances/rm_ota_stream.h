@@ -0,0 +1,158 @@
+/***********************************************************************************************************************
+ * Copyright [2020] Renesas Electronics Corporation and/or its affiliates.  All Rights Reserved.
+ *
+ * This software and documentation are supplied by Renesas Electronics America Inc. and may only be used with products
+ * of Renesas Electronics Corp. and its affiliates ("Renesas").  No other uses are authorized.  Renesas products are
+ * sold pursuant to Renesas terms and conditions of sale.  Purchasers are solely responsible for the selection and use
+ * of Renesas products and Renesas assumes no liability.  No license, express or implied, to any intellectual property
+ * right is granted by Renesas. This software is protected under all applicable laws, including copyright laws. Renesas
+ * reserves the right to change or discontinue this software and/or this documentation. THE SOFTWARE AND DOCUMENTATION
+ * IS DELIVERED TO YOU "AS IS," AND RENESAS MAKES NO REPRESENTATIONS OR WARRANTIES, AND TO THE FULLEST EXTENT
+ * PERMISSIBLE UNDER APPLICABLE LAW, DISCLAIMS ALL WARRANTIES, WHETHER EXPLICITLY OR IMPLICITLY, INCLUDING WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, AND NONINFRINGEMENT, WITH RESPECT TO THE SOFTWARE OR
+ * DOCUMENTATION.  RENESAS SHALL HAVE NO LIABILITY ARISING OUT OF ANY SECURITY VULNERABILITY OR BREACH.  TO THE MAXIMUM
+ * EXTENT PERMITTED BY LAW, IN NO EVENT WILL RENESAS BE LIABLE TO YOU IN CONNECTION WITH THE SOFTWARE OR DOCUMENTATION
+ * (OR ANY PERSON OR ENTITY CLAIMING RIGHTS DERIVED FROM YOU) FOR ANY LOSS, DAMAGES, OR CLAIMS WHATSOEVER, INCLUDING,
+ * WITHOUT LIMITATION, ANY DIRECT, CONSEQUENTIAL, SPECIAL, INDIRECT, PUNITIVE, OR INCIDENTAL DAMAGES; ANY LOST PROFITS,
+ * OTHER ECONOMIC DAMAGE, PROPERTY DAMAGE, OR PERSONAL INJURY; AND EVEN IF RENESAS HAS BEEN ADVISED OF THE POSSIBILITY
+ * OF SUCH LOSS, DAMAGES, CLAIMS OR COSTS.
+ **********************************************************************************************************************/
+
+#ifndef RM_OTA_STREAM_H
+#define RM_OTA_STREAM_H
+
+/***********************************************************************************************************************
+ * Includes
+ **********************************************************************************************************************/
+#include "bsp_api.h"
+#include "r_flash_hp.h"
+#include "rm_ota_stream_cfg.h"
+
+#if !defined(MBEDTLS_CONFIG_FILE)
+ #include "mbedtls/config.h"
+#else
+ #include MBEDTLS_CONFIG_FILE
+#endif
+#include "mbedtls/aes.h"
+#include "mbedtls/gcm.h"
+#include "mbedtls/sha256.h"
+
+/* Common macro for FSP header files. There is also a corresponding FSP_FOOTER macro at the end of this file. */
+FSP_HEADER
+
+/*******************************************************************************************************************//**
+ * @addtogroup RM_OTA_STREAM
+ * @{
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+#define RM_OTA_STREAM_CODE_VERSION_MAJOR    (1U)
+#define RM_OTA_STREAM_CODE_VERSION_MINOR    (0U)
+
+/** Size of the SHA-256 digest of the image. */
+#define RM_OTA_STREAM_DIGEST_SIZE           (32U)
+
+/***********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+
+/** Cipher of the received image. */
+typedef enum e_rm_ota_stream_cipher
+{
+    RM_OTA_STREAM_CIPHER_AES_CTR = 0,  ///< AES-CTR. The image must be authenticated separately, for example by MCUboot
+    RM_OTA_STREAM_CIPHER_AES_GCM = 1,  ///< AES-GCM. The tag is checked by RM_OTA_STREAM_Finish
+} rm_ota_stream_cipher_t;
+
+/** Decryption parameters of one image, passed to RM_OTA_STREAM_Begin. */
+typedef struct st_rm_ota_stream_image
+{
+    rm_ota_stream_cipher_t cipher;     ///< Cipher of the image
+    uint8_t const        * p_key;      ///< AES key
+    uint32_t               key_bits;   ///< Key size, 128 or 256
+    uint8_t const        * p_iv;       ///< Initial counter block for AES-CTR, IV for AES-GCM
+    uint32_t               iv_length;  ///< Size of p_iv in bytes, 16 for AES-CTR
+    uint8_t const        * p_aad;      ///< Additional authenticated data for AES-GCM, may be NULL
+    uint32_t               aad_length; ///< Size of p_aad in bytes
+} rm_ota_stream_image_t;
+
+/** User configuration structure, used in open function */
+typedef struct st_rm_ota_stream_cfg
+{
+    /** Flash HP instance opened by the application in dual bank mode, with code flash programming and data flash BGO
+     * enabled so requests run in the background. The instance can be shared with other users of the request queue. */
+    flash_instance_t const * p_flash;
+
+    uint32_t  slot_address;            ///< Start of the secondary slot in the bank not executed from, block aligned
+    uint32_t  slot_size;               ///< Size of the slot, ending on a block boundary
+
+    /** Two staging buffers of buffer_size bytes each, 4-byte aligned. One buffer is filled and decrypted while the
+     * other one is programmed. */
+    uint8_t * p_buffers;
+    uint32_t  buffer_size;             ///< Size of one buffer, a multiple of the code flash write size
+    uint8_t   priority;                ///< Priority of the flash requests of this module
+} rm_ota_stream_cfg_t;
+
+/** Staging buffer and the flash requests programming it. */
+typedef struct st_rm_ota_stream_buffer
+{
+    flash_hp_request_t erase;          // Erase of the blocks the buffer is the first to reach
+    flash_hp_request_t write;          // Write of the buffer
+    uint32_t           fill;           // Bytes received into the buffer
+    uint32_t           decrypted;      // Bytes decrypted in place and hashed
+} rm_ota_stream_buffer_t;
+
+/** Instance control block.  This is private to the FSP and should not be used or modified by the application. */
+typedef struct st_rm_ota_stream_instance_ctrl
+{
+    uint32_t                    open;
+    rm_ota_stream_cfg_t const * p_cfg;
+    bool                        active;              // An image is being received
+    fsp_err_t                   err;                 // First error of the image, returned until it is finished
+    rm_ota_stream_cipher_t      cipher;              // Cipher of the image
+    uint32_t                    current;             // Buffer being filled
+    rm_ota_stream_buffer_t      buffers[2];          // Staging buffers
+    uint32_t                    received;            // Bytes received for the image
+    uint32_t                    write_address;       // Flash address of the next buffer
+    uint32_t                    erased_end;          // End of the blocks erased or queued for erasing
+    union
+    {
+        mbedtls_aes_context aes;                     // AES-CTR key schedule
+        mbedtls_gcm_context gcm;                     // AES-GCM state
+    } cipher_ctx;
+    size_t                 nc_off;                   // AES-CTR offset in stream_block
+    unsigned char          nonce_counter[16];        // AES-CTR counter block
+    unsigned char          stream_block[16];         // AES-CTR key stream of the current counter block
+    mbedtls_sha256_context sha;                      // SHA-256 of the decrypted image
+} rm_ota_stream_instance_ctrl_t;
+
+/**********************************************************************************************************************
+ * Exported global variables
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Public APIs
+ **********************************************************************************************************************/
+fsp_err_t RM_OTA_STREAM_Open(rm_ota_stream_instance_ctrl_t * const p_ctrl, rm_ota_stream_cfg_t const * const p_cfg);
+fsp_err_t RM_OTA_STREAM_Begin(rm_ota_stream_instance_ctrl_t * const p_ctrl,
+                              rm_ota_stream_image_t const * const   p_image);
+fsp_err_t RM_OTA_STREAM_Write(rm_ota_stream_instance_ctrl_t * const p_ctrl,
+                              uint8_t const * const                 p_data,
+                              uint32_t const                        length);
+fsp_err_t RM_OTA_STREAM_Finish(rm_ota_stream_instance_ctrl_t * const p_ctrl,
+                               uint8_t const * const                 p_tag,
+                               uint32_t const                        tag_length,
+                               uint8_t * const                       p_digest);
+fsp_err_t RM_OTA_STREAM_Abort(rm_ota_stream_instance_ctrl_t * const p_ctrl);
+fsp_err_t RM_OTA_STREAM_Close(rm_ota_stream_instance_ctrl_t * const p_ctrl);
+fsp_err_t RM_OTA_STREAM_VersionGet(fsp_version_t * const p_version);
+
+/* Common macro for FSP header files. There is also a corresponding FSP_HEADER macro at the top of this file. */
+FSP_FOOTER
+
+#endif                                 // RM_OTA_STREAM_H
+
+/*******************************************************************************************************************//**
+ * @} (end defgroup RM_OTA_STREAM)
+ **********************************************************************************************************************/
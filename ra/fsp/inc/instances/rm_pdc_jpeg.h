@@ -0,0 +1,177 @@
+/***********************************************************************************************************************
+ * Copyright [2020] Renesas Electronics Corporation and/or its affiliates.  All Rights Reserved.
+ *
+ * This software and documentation are supplied by Renesas Electronics America Inc. and may only be used with products
+ * of Renesas Electronics Corp. and its affiliates ("Renesas").  No other uses are authorized.  Renesas products are
+ * sold pursuant to Renesas terms and conditions of sale.  Purchasers are solely responsible for the selection and use
+ * of Renesas products and Renesas assumes no liability.  No license, express or implied, to any intellectual property
+ * right is granted by Renesas. This software is protected under all applicable laws, including copyright laws. Renesas
+ * reserves the right to change or discontinue this software and/or this documentation. THE SOFTWARE AND DOCUMENTATION
+ * IS DELIVERED TO YOU "AS IS," AND RENESAS MAKES NO REPRESENTATIONS OR WARRANTIES, AND TO THE FULLEST EXTENT
+ * PERMISSIBLE UNDER APPLICABLE LAW, DISCLAIMS ALL WARRANTIES, WHETHER EXPLICITLY OR IMPLICITLY, INCLUDING WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, AND NONINFRINGEMENT, WITH RESPECT TO THE SOFTWARE OR
+ * DOCUMENTATION.  RENESAS SHALL HAVE NO LIABILITY ARISING OUT OF ANY SECURITY VULNERABILITY OR BREACH.  TO THE MAXIMUM
+ * EXTENT PERMITTED BY LAW, IN NO EVENT WILL RENESAS BE LIABLE TO YOU IN CONNECTION WITH THE SOFTWARE OR DOCUMENTATION
+ * (OR ANY PERSON OR ENTITY CLAIMING RIGHTS DERIVED FROM YOU) FOR ANY LOSS, DAMAGES, OR CLAIMS WHATSOEVER, INCLUDING,
+ * WITHOUT LIMITATION, ANY DIRECT, CONSEQUENTIAL, SPECIAL, INDIRECT, PUNITIVE, OR INCIDENTAL DAMAGES; ANY LOST PROFITS,
+ * OTHER ECONOMIC DAMAGE, PROPERTY DAMAGE, OR PERSONAL INJURY; AND EVEN IF RENESAS HAS BEEN ADVISED OF THE POSSIBILITY
+ * OF SUCH LOSS, DAMAGES, CLAIMS OR COSTS.
+ **********************************************************************************************************************/
+
+#ifndef RM_PDC_JPEG_H
+#define RM_PDC_JPEG_H
+
+/***********************************************************************************************************************
+ * Includes
+ **********************************************************************************************************************/
+#include "bsp_api.h"
+#include "r_pdc_api.h"
+#include "r_jpeg_api.h"
+#include "rm_pdc_jpeg_cfg.h"
+
+/* Common macro for FSP header files. There is also a corresponding FSP_FOOTER macro at the end of this file. */
+FSP_HEADER
+
+/*******************************************************************************************************************//**
+ * @addtogroup RM_PDC_JPEG
+ * @{
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+#define RM_PDC_JPEG_CODE_VERSION_MAJOR    (1U)
+#define RM_PDC_JPEG_CODE_VERSION_MINOR    (0U)
+
+/** Maximum number of JPEG frame buffers. */
+#define RM_PDC_JPEG_MAX_FRAMES            (8U)
+
+/***********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+
+/** Events reported to the callback function from the PDC, DMAC and JPEG interrupts. */
+typedef enum e_rm_pdc_jpeg_event
+{
+    RM_PDC_JPEG_EVENT_FRAME_READY   = 0, ///< A frame was encoded and can be read with RM_PDC_JPEG_FrameGet
+    RM_PDC_JPEG_EVENT_FRAME_DROPPED = 1, ///< A frame was lost, see the statistics for the reason
+} rm_pdc_jpeg_event_t;
+
+/** Callback function parameter structure */
+typedef struct st_rm_pdc_jpeg_callback_args
+{
+    rm_pdc_jpeg_event_t event;         ///< Event code
+    void const        * p_context;     ///< Context provided to user during callback
+} rm_pdc_jpeg_callback_args_t;
+
+/** Encoded frame returned by RM_PDC_JPEG_FrameGet. */
+typedef struct st_rm_pdc_jpeg_frame
+{
+    uint8_t * p_data;                  ///< JPEG image
+    uint32_t  size;                    ///< Size of the JPEG image in bytes
+    uint32_t  sequence;                ///< Number of the frame, counted from RM_PDC_JPEG_Start
+} rm_pdc_jpeg_frame_t;
+
+/** Frame statistics, counted from RM_PDC_JPEG_Open. */
+typedef struct st_rm_pdc_jpeg_statistics
+{
+    uint32_t frames_encoded;           ///< Frames encoded and queued for the application
+    uint32_t frames_skipped;           ///< Captures held back because the encoder or the application fell behind
+    uint32_t frames_overrun;           ///< Frames dropped because the capture overtook the encoder in the stripe ring
+    uint32_t frames_error;             ///< Frames dropped because of a PDC or JPEG error 
+} rm_pdc_jpeg_statistics_t;
+
+/** User configuration structure, used in open function */
+typedef struct st_rm_pdc_jpeg_cfg
+{
+    /** PDC instance capturing YCbCr 4:2:2 with 2 bytes per pixel through a DMAC instance, opened by RM_PDC_JPEG_Open.
+     * Its callback must be rm_pdc_jpeg_pdc_callback() with the control structure of this module as p_context. The
+     * DMAC instance must not loop chained transfers. */
+    pdc_instance_t const * p_pdc;
+
+    /** JPEG codec in encode mode for the image size of the PDC, opened by RM_PDC_JPEG_Open. Its encode callback must
+     * be rm_pdc_jpeg_jpeg_callback() with the control structure of this module as p_encode_context. */
+    jpeg_instance_t const * p_jpeg;
+
+    /** Stripe ring: stripe_count stripes of stripe_lines lines each, 8-byte aligned. The PDC writes each stripe while
+     * the codec encodes the stripes before it, so no full frame buffer is needed. */
+    uint8_t * p_stripes;
+    uint8_t   stripe_count;            ///< Number of stripes in the ring, at least 2
+    uint8_t   stripe_lines;            ///< Lines per stripe, a multiple of 8 that divides the image height
+
+    /** One transfer link per stripe of a frame, used for the chained PDC capture. */
+    transfer_info_t * p_links;
+
+    /** JPEG frame buffers: num_frames buffers of frame_buffer_size bytes each, 8-byte aligned. The codec does not
+     * limit its output, so each buffer must hold the largest image for the configured quality. */
+    uint8_t * p_frame_buffers;
+    uint32_t  frame_buffer_size;       ///< Size of one JPEG frame buffer, a multiple of 8
+    uint8_t   num_frames;              ///< Number of JPEG frame buffers, at most RM_PDC_JPEG_MAX_FRAMES
+
+    void (* p_callback)(rm_pdc_jpeg_callback_args_t * p_args); ///< Optional callback called from the interrupts
+    void const * p_context;                                     ///< User defined context passed to the callback
+} rm_pdc_jpeg_cfg_t;
+
+/** Encoding state of a frame in flight. */
+typedef struct st_rm_pdc_jpeg_frame_state
+{
+    bool     active;                   // The frame is captured or encoded
+    bool     corrupt;                  // A stripe of the frame was overwritten before it was encoded
+    uint8_t  buffer;                   // JPEG frame buffer of the frame
+    uint32_t sequence;                 // Number of the frame
+} rm_pdc_jpeg_frame_state_t;
+
+/** Instance control block.  This is private to the FSP and should not be used or modified by the application. */
+typedef struct st_rm_pdc_jpeg_instance_ctrl
+{
+    uint32_t                    open;
+    rm_pdc_jpeg_cfg_t const   * p_cfg;
+    uint32_t                    stripe_bytes;      // Size of one stripe
+    uint32_t                    frame_stripes;     // Stripes per frame
+    bool                        running;           // Started and not stopped
+    bool                        capturing;         // A chained PDC capture is in progress
+    bool                        stalled;           // The next capture waits for a frame record or frame buffer
+    bool                        frame_held;        // The oldest frame was returned by RM_PDC_JPEG_FrameGet
+    uint32_t                    capture_stripes;   // Stripes written by the current capture
+    uint32_t                    stripe_base;       // Ring slot of stripe 0 of frames[0]
+    uint32_t                    stripes_captured;  // Stripes written since stripe 0 of frames[0]
+    uint32_t                    stripes_fed;       // Stripes of frames[0] handed to the codec
+    uint32_t                    stripes_encoded;   // Stripes of frames[0] encoded, their ring slots are free
+    rm_pdc_jpeg_frame_state_t   frames[2];         // Frame being encoded and frame being captured after it
+    uint32_t                    sequence;          // Number of the next frame
+    uint32_t                    buffers_allocated; // JPEG frame buffers taken, modulo 2^32
+    uint32_t                    buffers_done;      // JPEG frame buffers completed, modulo 2^32
+    uint32_t                    buffers_released;  // JPEG frame buffers released, modulo 2^32
+    uint32_t                    frame_size[RM_PDC_JPEG_MAX_FRAMES];     // Image size, 0 for a dropped frame
+    uint32_t                    frame_sequence[RM_PDC_JPEG_MAX_FRAMES]; // Number of the frame in each buffer
+    rm_pdc_jpeg_statistics_t    statistics;
+} rm_pdc_jpeg_instance_ctrl_t;
+
+/**********************************************************************************************************************
+ * Exported global variables
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Public APIs
+ **********************************************************************************************************************/
+fsp_err_t RM_PDC_JPEG_Open(rm_pdc_jpeg_instance_ctrl_t * const p_ctrl, rm_pdc_jpeg_cfg_t const * const p_cfg);
+fsp_err_t RM_PDC_JPEG_Start(rm_pdc_jpeg_instance_ctrl_t * const p_ctrl);
+fsp_err_t RM_PDC_JPEG_Stop(rm_pdc_jpeg_instance_ctrl_t * const p_ctrl);
+fsp_err_t RM_PDC_JPEG_FrameGet(rm_pdc_jpeg_instance_ctrl_t * const p_ctrl, rm_pdc_jpeg_frame_t * const p_frame);
+fsp_err_t RM_PDC_JPEG_FrameRelease(rm_pdc_jpeg_instance_ctrl_t * const p_ctrl);
+fsp_err_t RM_PDC_JPEG_StatisticsGet(rm_pdc_jpeg_instance_ctrl_t * const p_ctrl,
+                                    rm_pdc_jpeg_statistics_t * const    p_statistics);
+fsp_err_t RM_PDC_JPEG_Close(rm_pdc_jpeg_instance_ctrl_t * const p_ctrl);
+fsp_err_t RM_PDC_JPEG_VersionGet(fsp_version_t * const p_version);
+
+void rm_pdc_jpeg_pdc_callback(pdc_callback_args_t * p_args);
+void rm_pdc_jpeg_jpeg_callback(jpeg_callback_args_t * p_args);
+
+/* Common macro for FSP header files. There is also a corresponding FSP_HEADER macro at the top of this file. */
+FSP_FOOTER
+
+#endif                                 // RM_PDC_JPEG_H
+
+/*******************************************************************************************************************//**
+ * @} (end defgroup RM_PDC_JPEG)
+ **********************************************************************************************************************/
@@ -28,6 +28,13 @@
 #include "r_flash_api.h"
 #include "rm_vee_flash_cfg.h"
 
+#ifndef RM_VEE_FLASH_CFG_CACHE_ENABLE
+ #define RM_VEE_FLASH_CFG_CACHE_ENABLE    (0)
+#endif
+#if RM_VEE_FLASH_CFG_CACHE_ENABLE
+ #include "r_lvd_api.h"
+#endif
+
 /* Common macro for FSP header files. There is also a corresponding FSP_FOOTER macro at the end of this file. */
 FSP_HEADER
 
@@ -46,10 +53,28 @@ FSP_HEADER
  * Typedef definitions
  **********************************************************************************************************************/
 
+/** RAM write-back cache entry of one record ID, see rm_vee_flash_cfg_t::p_cache. */
+typedef struct st_rm_vee_flash_cache_entry
+{
+    uint32_t      rec_id;              ///< ID of the cached record
+    uint8_t     * p_data;              ///< RAM copy of the record
+    uint32_t      size;                ///< Size of p_data in bytes, a multiple of 4
+    uint32_t      length;              ///< Length of the cached record, 0 while the record has never been written
+    volatile bool dirty;               ///< The RAM copy is newer than the record in data flash
+} rm_vee_flash_cache_entry_t;
+
 /** User configuration structure, used in open function */
 typedef struct st_rm_vee_flash_cfg
 {
     flash_instance_t const * p_flash;  ///< Pointer to a flash instance
+
+    /** Number of records moved by each call to RM_VEE_FLASH_Refresh, or 0 to move all records in one refresh. */
+    uint32_t refresh_step_records;
+
+    /** Write-back cache entries, only used when RM_VEE_FLASH_CFG_CACHE_ENABLE is set. Writes to these record IDs only
+     * update RAM until RM_VEE_FLASH_CacheFlush() is called. */
+    rm_vee_flash_cache_entry_t * p_cache;
+    uint32_t                     cache_entries; ///< Number of entries in p_cache
 } rm_vee_flash_cfg_t;
 
 /* Segment Header */
@@ -112,8 +137,16 @@ typedef struct st_rm_vee_flash_instance_ctrl
     uint32_t                 refresh_dst_rec_end_addr; // addr of first byte after last record
     uint32_t                 refresh_xfer_src_addr;
     uint32_t                 refresh_xfer_bytes_left;
+    uint32_t                 refresh_remaining;        // number of records still to be copied during Refresh
+    uint32_t                 refresh_step_left;        // records to copy before pausing Refresh (UINT32_MAX: all)
+    uint32_t                 refresh_dst_write_addr;   // next write addr in the new segment while Refresh is paused
+    bool                     refresh_paused;           // Refresh paused; records are written to previous segment
     flash_instance_t const * p_flash;
     uint32_t                 segment_size;
+#if RM_VEE_FLASH_CFG_CACHE_ENABLE
+    rm_vee_flash_cache_entry_t * volatile p_cache_flushing; // Cache entry being written to data flash, NULL if none
+    volatile bool                         cache_flush;      // Dirty cache entries are written back when ready
+#endif
 
     void (* p_callback)(rm_vee_callback_args_t *); // Pointer to callback
     rm_vee_callback_args_t * p_callback_memory;    // Pointer to optional callback argument memory
@@ -153,6 +186,12 @@ fsp_err_t RM_VEE_FLASH_CallbackSet(rm_vee_ctrl_t * const          p_api_ctrl,
                                    rm_vee_callback_args_t * const p_callback_memory);
 fsp_err_t RM_VEE_FLASH_Close(rm_vee_ctrl_t * const p_api_ctrl);
 fsp_err_t RM_VEE_FLASH_VersionGet(fsp_version_t * const p_version);
+fsp_err_t RM_VEE_FLASH_CacheFlush(rm_vee_ctrl_t * const p_api_ctrl);
+
+#if RM_VEE_FLASH_CFG_CACHE_ENABLE
+void rm_vee_flash_lvd_callback(lvd_callback_args_t * p_args);
+
+#endif
 
 /* Common macro for FSP header files. There is also a corresponding FSP_HEADER macro at the top of this file. */
 FSP_FOOTER
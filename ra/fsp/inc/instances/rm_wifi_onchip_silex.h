@@ -43,6 +43,7 @@
 #include "FreeRTOS.h"
 #include "semphr.h"
 #include "stream_buffer.h"
+#include "task.h"
 
 #include "aws_secure_sockets_config.h"
 #include "aws_wifi_config.h"
@@ -113,6 +114,7 @@ typedef struct
     uint32_t             socket_recv_error_count;                                    ///< Socket receive error count
     uint32_t             socket_create_flag;                                         ///< Flag to determine in socket has been created.
     uint32_t             socket_read_write_flag;                                     ///< flag to determine if read and/or write channels are active.
+    volatile uint32_t    socket_waiting;                                             ///< Number of send and receive calls waiting for the mutexes
 } ulpgn_socket_t;
 
 /** Silex ULPGN Wifi SCI UART state information */
@@ -142,12 +144,19 @@ typedef struct
     uint8_t              curr_ipaddr[4];                                                     ///< Current IP address of module
     uint8_t              curr_subnetmask[4];                                                 ///< Current Subnet Mask of module
     uint8_t              curr_gateway[4];                                                    ///< Current GAteway of module
+    uint8_t              curr_macaddr[6];                                                    ///< Cached MAC address of module
+    uint32_t             curr_macaddr_valid;                                                 ///< Flag to indicate curr_macaddr has been read
     SemaphoreHandle_t    tx_sem;                                                             ///< Transmit binary semaphore handle
     SemaphoreHandle_t    rx_sem;                                                             ///< Receive binary semaphore handle
     uint8_t              last_data[WIFI_ONCHIP_SILEX_RETURN_TEXT_LENGTH];                    ///< Tailing buffer used for command parser
     uart_instance_t    * uart_instance_objects[WIFI_ONCHIP_SILEX_CFG_MAX_NUMBER_UART_PORTS]; ///< UART instance objects
     uart_state_t         uart_state_info[WIFI_ONCHIP_SILEX_CFG_MAX_NUMBER_UART_PORTS];       ///< UART instance state information
     ulpgn_socket_t       sockets[WIFI_ONCHIP_SILEX_CFG_NUM_CREATEABLE_SOCKETS];              ///< Internal socket instances
+    uint8_t * volatile   p_recv_direct;                                                      ///< User buffer filled by the UART callback
+    volatile uint32_t    recv_direct_size;                                                   ///< Size of the direct receive buffer
+    volatile uint32_t    recv_direct_count;                                                  ///< Bytes written to the direct receive buffer
+    uint32_t             recv_direct_socket;                                                 ///< Socket of the direct receive buffer
+    TaskHandle_t         recv_direct_task;                                                   ///< Task waiting on the direct receive buffer
 } wifi_onchip_silex_instance_ctrl_t;
 
 /**********************************************************************************************************************
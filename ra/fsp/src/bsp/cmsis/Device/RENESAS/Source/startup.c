@@ -85,14 +85,27 @@ void Default_Handler (void)
 }
 
 /* Main stack */
+#if BSP_CFG_MONITOR_ENABLE
+
+/* Painted and scanned by bsp_monitor.c. */
+BSP_DONT_REMOVE uint8_t g_main_stack[BSP_CFG_STACK_MAIN_BYTES + BSP_TZ_STACK_SEAL_SIZE] BSP_ALIGN_VARIABLE(
+    BSP_STACK_ALIGNMENT) BSP_PLACE_IN_SECTION(BSP_SECTION_STACK);
+#else
 static uint8_t g_main_stack[BSP_CFG_STACK_MAIN_BYTES + BSP_TZ_STACK_SEAL_SIZE] BSP_ALIGN_VARIABLE(BSP_STACK_ALIGNMENT)
 BSP_PLACE_IN_SECTION(BSP_SECTION_STACK);
+#endif
 
 /* Heap */
 #if (BSP_CFG_HEAP_BYTES > 0)
+ #if BSP_CFG_HEAP_TLSF_ENABLE
 
+/* Managed by the TLSF allocator in bsp_heap.c. */
+BSP_DONT_REMOVE uint8_t g_heap[BSP_CFG_HEAP_BYTES] BSP_ALIGN_VARIABLE(BSP_STACK_ALIGNMENT) \
+    BSP_PLACE_IN_SECTION(BSP_SECTION_HEAP);
+ #else
 BSP_DONT_REMOVE static uint8_t g_heap[BSP_CFG_HEAP_BYTES] BSP_ALIGN_VARIABLE(BSP_STACK_ALIGNMENT) \
     BSP_PLACE_IN_SECTION(BSP_SECTION_HEAP);
+ #endif
 #endif
 
 /* All system exceptions in the vector table are weak references to Default_Handler. If the user wishes to handle
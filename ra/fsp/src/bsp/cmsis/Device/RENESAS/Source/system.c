@@ -59,6 +59,33 @@
 
 #define BSP_TZ_STACK_SEAL_VALUE                       (0xFEF5EDA5)
 
+#if BSP_CFG_FAST_BOOT_ENABLE && BSP_CFG_C_RUNTIME_INIT
+ #if defined(__ARMCC_VERSION)
+  #define BSP_PRV_BSS_START                           ((uint8_t *) &Image$$BSS$$ZI$$Base)
+  #define BSP_PRV_BSS_SIZE                            ((uint32_t) &Image$$BSS$$ZI$$Length)
+ #elif defined(__GNUC__)
+  #define BSP_PRV_BSS_START                           ((uint8_t *) &__bss_start__)
+  #define BSP_PRV_BSS_SIZE                            ((uint32_t) &__bss_end__ - (uint32_t) &__bss_start__)
+ #elif defined(__ICCARM__)
+  #define BSP_PRV_BSS_START                           ((uint8_t *) __section_begin(".bss"))
+  #define BSP_PRV_BSS_SIZE                            ((uint32_t) __section_size(".bss"))
+ #endif
+#endif
+
+#if BSP_CFG_BOOT_PROFILE_ENABLE
+ #if !BSP_FEATURE_DWT_CYCCNT
+  #error "BSP_CFG_BOOT_PROFILE_ENABLE requires the DWT cycle counter, which is not available on this MCU."
+ #endif
+ #define BSP_PRV_BOOT_STAMP(phase)                       \
+    do                                                   \
+    {                                                    \
+        g_bsp_boot_timestamp[phase] = DWT->CYCCNT;       \
+        g_bsp_boot_phases          |= 1U << (phase);     \
+    } while (0)
+#else
+ #define BSP_PRV_BOOT_STAMP(phase)    do {} while (0)
+#endif
+
 /***********************************************************************************************************************
  * Typedef definitions
  **********************************************************************************************************************/
@@ -78,6 +105,11 @@ extern uint32_t Image$$DATA$$Base;
 extern uint32_t Image$$DATA$$Length;
 extern uint32_t Image$$STACK$$ZI$$Base;
 extern uint32_t Image$$STACK$$ZI$$Length;
+ #if BSP_CFG_CODE_IN_RAM_COPY_ENABLE
+extern uint32_t Image$$CODE_IN_RAM$$Base;
+extern uint32_t Image$$CODE_IN_RAM$$Length;
+extern uint32_t Load$$CODE_IN_RAM$$Base;
+ #endif
 #elif defined(__GNUC__)
 
 /* Generated by linker. */
@@ -88,6 +120,11 @@ extern uint32_t __bss_start__;
 extern uint32_t __bss_end__;
 extern uint32_t __StackLimit;
 extern uint32_t __StackTop;
+ #if BSP_CFG_CODE_IN_RAM_COPY_ENABLE
+extern uint32_t __code_in_ram_start__;
+extern uint32_t __code_in_ram_end__;
+extern uint32_t __code_in_ram_load__;
+ #endif
 #elif defined(__ICCARM__)
  #pragma section=".bss"
  #pragma section=".data"
@@ -115,6 +152,25 @@ extern void * __Vectors[];
 
 extern void R_BSP_SecurityInit(void);
 
+#if BSP_CFG_RAM_VECTOR_TABLE_ENABLE
+extern const fsp_vector_t g_vector_table[BSP_ICU_VECTOR_MAX_ENTRIES];
+
+/* VTOR requires the vector table to be aligned to its size rounded up to a power of 2. RA MCUs have at most 128
+ * vectors. */
+ #define BSP_PRV_RAM_VECTOR_TABLE_ALIGNMENT    ((BSP_VECTOR_TABLE_MAX_ENTRIES <= 64U) ? 256U : 512U)
+
+/* RAM copy of the fixed and application vector tables. */
+ #if BSP_CFG_FAST_BOOT_ENABLE
+
+/* Every entry is written by SystemInit, so fast boot keeps the table out of BSS to avoid clearing it first. */
+static fsp_vector_t g_bsp_ram_vector_table[BSP_VECTOR_TABLE_MAX_ENTRIES] BSP_ALIGN_VARIABLE(
+    BSP_PRV_RAM_VECTOR_TABLE_ALIGNMENT) BSP_PLACE_IN_SECTION(BSP_SECTION_NOINIT);
+ #else
+static fsp_vector_t g_bsp_ram_vector_table[BSP_VECTOR_TABLE_MAX_ENTRIES] BSP_ALIGN_VARIABLE(
+    BSP_PRV_RAM_VECTOR_TABLE_ALIGNMENT);
+ #endif
+#endif
+
 /***********************************************************************************************************************
  * Private global variables and functions
  **********************************************************************************************************************/
@@ -124,6 +180,21 @@ static void bsp_reset_trng_circuit(void);
 
 #endif
 
+/* These are written before the C runtime is initialized, so they are kept out of BSS. */
+#if BSP_CFG_FAST_BOOT_ENABLE && BSP_CFG_C_RUNTIME_INIT
+
+/* Next BSS byte to clear and the end of BSS. */
+static uint8_t * gp_bsp_boot_bss_next BSP_PLACE_IN_SECTION(BSP_SECTION_NOINIT);
+static uint8_t * gp_bsp_boot_bss_end BSP_PLACE_IN_SECTION(BSP_SECTION_NOINIT);
+#endif
+
+#if BSP_CFG_BOOT_PROFILE_ENABLE
+
+/* Cycle count at each boot phase and a bit mask of the phases reached. */
+static uint32_t g_bsp_boot_timestamp[BSP_BOOT_PHASE_COUNT] BSP_PLACE_IN_SECTION(BSP_SECTION_NOINIT);
+static uint32_t g_bsp_boot_phases BSP_PLACE_IN_SECTION(BSP_SECTION_NOINIT);
+#endif
+
 #if defined(__ICCARM__)
 
 void R_BSP_WarmStart(bsp_warm_start_event_t event);
@@ -141,6 +212,16 @@ void R_BSP_WarmStart(bsp_warm_start_event_t event) __attribute__((weak));
  **********************************************************************************************************************/
 void SystemInit (void)
 {
+#if BSP_CFG_BOOT_PROFILE_ENABLE
+
+    /* Start the cycle counter used to time stamp the boot phases. It is reset so the stamps count from reset. */
+    R_BSP_CycleCounterStart();
+    DWT->CYCCNT       = 0U;
+    g_bsp_boot_phases = 0U;
+    bsp_boot_profile_init();
+    BSP_PRV_BOOT_STAMP(BSP_BOOT_PHASE_RESET);
+#endif
+
 #if __FPU_USED
 
     /* Enable the FPU only when it is used.
@@ -186,6 +267,13 @@ void SystemInit (void)
  #endif
 #endif
 
+#if BSP_CFG_FAST_BOOT_ENABLE && BSP_CFG_C_RUNTIME_INIT
+
+    /* bsp_clock_init clears BSS in chunks while the clock sources stabilize. The rest is cleared below. */
+    gp_bsp_boot_bss_next = BSP_PRV_BSS_START;
+    gp_bsp_boot_bss_end  = BSP_PRV_BSS_START + BSP_PRV_BSS_SIZE;
+#endif
+
     /* Call pre clock initialization hook. */
     R_BSP_WarmStart(BSP_WARM_START_RESET);
 
@@ -198,15 +286,18 @@ void SystemInit (void)
     /* Configure system clocks. */
     bsp_clock_init();
 
- #if BSP_FEATURE_BSP_RESET_TRNG
+ #if BSP_FEATURE_BSP_RESET_TRNG && !BSP_CFG_FAST_BOOT_ENABLE
 
     /* To prevent an undesired current draw, this MCU requires a reset
-     * of the TRNG circuit after the clocks are initialized */
+     * of the TRNG circuit after the clocks are initialized. In fast boot mode this is done in
+     * R_BSP_FastBootDeferredInit. */
 
     bsp_reset_trng_circuit();
  #endif
 #endif
 
+    BSP_PRV_BOOT_STAMP(BSP_BOOT_PHASE_CLOCK);
+
     /* Call post clock initialization hook. */
     R_BSP_WarmStart(BSP_WARM_START_POST_CLOCK);
 
@@ -242,7 +333,12 @@ void SystemInit (void)
 
     /* Initialize C runtime environment. */
     /* Zero out BSS */
- #if defined(__ARMCC_VERSION)
+ #if BSP_CFG_FAST_BOOT_ENABLE
+
+    /* Clear the part of BSS not cleared while the clocks stabilized. */
+    memset(gp_bsp_boot_bss_next, 0U, (uint32_t) (gp_bsp_boot_bss_end - gp_bsp_boot_bss_next));
+    gp_bsp_boot_bss_next = gp_bsp_boot_bss_end;
+ #elif defined(__ARMCC_VERSION)
     memset((uint8_t *) &Image$$BSS$$ZI$$Base, 0U, (uint32_t) &Image$$BSS$$ZI$$Length);
  #elif defined(__GNUC__)
     memset(&__bss_start__, 0U, ((uint32_t) &__bss_end__ - (uint32_t) &__bss_start__));
@@ -273,6 +369,22 @@ void SystemInit (void)
            (uint32_t) __section_size("__DLIB_PERTHREAD_init"));
  #endif
 
+ #if BSP_CFG_CODE_IN_RAM_COPY_ENABLE && !defined(__ICCARM__)
+
+    /* Copy functions to be executed from RAM. This is done before static constructors in case they call them. */
+  #if defined(__ARMCC_VERSION)
+    memcpy((uint8_t *) &Image$$CODE_IN_RAM$$Base, (uint8_t *) &Load$$CODE_IN_RAM$$Base,
+           (uint32_t) &Image$$CODE_IN_RAM$$Length);
+  #elif defined(__GNUC__)
+    memcpy(&__code_in_ram_start__, &__code_in_ram_load__,
+           ((uint32_t) &__code_in_ram_end__ - (uint32_t) &__code_in_ram_start__));
+  #endif
+
+    /* Make sure the copied instructions are visible before they are fetched. */
+    __DSB();
+    __ISB();
+ #endif
+
     /* Initialize static constructors */
  #if defined(__ARMCC_VERSION)
     int32_t count = Image$$INIT_ARRAY$$Limit - Image$$INIT_ARRAY$$Base;
@@ -297,6 +409,22 @@ void SystemInit (void)
  #endif
 #endif                                 // BSP_CFG_C_RUNTIME_INIT
 
+    BSP_PRV_BOOT_STAMP(BSP_BOOT_PHASE_C_RUNTIME);
+
+#if BSP_CFG_RAM_VECTOR_TABLE_ENABLE
+
+    /* Relocate the vector table to RAM so vector fetches do not incur flash wait states. This is done after the C
+     * runtime is initialized so the table is not cleared with BSS, and before any interrupt is enabled. */
+    memcpy(&g_bsp_ram_vector_table[0], &__Vectors[0], BSP_CORTEX_VECTOR_TABLE_ENTRIES * sizeof(fsp_vector_t));
+    memcpy(&g_bsp_ram_vector_table[BSP_CORTEX_VECTOR_TABLE_ENTRIES],
+           &g_vector_table[0],
+           BSP_ICU_VECTOR_MAX_ENTRIES * sizeof(fsp_vector_t));
+    __DSB();
+    SCB->VTOR = (uint32_t) &g_bsp_ram_vector_table[0];
+    __DSB();
+    __ISB();
+#endif
+
     /* Initialize SystemCoreClock variable. */
     SystemCoreClockUpdate();
 
@@ -331,11 +459,35 @@ void SystemInit (void)
     /* Call Post C runtime initialization hook. */
     R_BSP_WarmStart(BSP_WARM_START_POST_C);
 
+    BSP_PRV_BOOT_STAMP(BSP_BOOT_PHASE_POST_C);
+
+#if BSP_CFG_LATENCY_MEASURE_ENABLE
+
+    /* Start the cycle counter used to measure ISR durations. */
+    bsp_latency_init();
+#endif
+
+#if BSP_CFG_TRACE_ENABLE
+
+    /* Set up the driver event trace buffer. */
+    bsp_trace_init();
+#endif
+
+#if BSP_CFG_MONITOR_ENABLE
+
+    /* Paint the unused main stack for the high-water mark. */
+    bsp_monitor_init();
+#endif
+
     /* Initialize ELC events that will be used to trigger NVIC interrupts. */
     bsp_irq_cfg();
 
+    BSP_PRV_BOOT_STAMP(BSP_BOOT_PHASE_IRQ_CFG);
+
     /* Call any BSP specific code. No arguments are needed so NULL is sent. */
     bsp_init(NULL);
+
+    BSP_PRV_BOOT_STAMP(BSP_BOOT_PHASE_MAIN);
 }
 
 /*******************************************************************************************************************//**
@@ -361,12 +513,87 @@ void R_BSP_WarmStart (bsp_warm_start_event_t event)
     {
         /* C runtime environment, system clocks, and pins are all setup. */
     }
+    else if (BSP_WARM_START_DEFERRED == event)
+    {
+        /* Called from R_BSP_FastBootDeferredInit after main has started. Interrupts may be enabled. */
+    }
     else
     {
         /* Do nothing */
     }
 }
 
+#if BSP_CFG_FAST_BOOT_ENABLE
+
+/*******************************************************************************************************************//**
+ * Runs the startup steps that fast boot moves out of SystemInit, then calls R_BSP_WarmStart with
+ * BSP_WARM_START_DEFERRED so the application can run its own non-critical initialization. Call once from the
+ * application after its time critical startup work is done.
+ **********************************************************************************************************************/
+void R_BSP_FastBootDeferredInit (void)
+{
+ #if BSP_FEATURE_BSP_RESET_TRNG && !BSP_TZ_CFG_SKIP_INIT
+
+    /* To prevent an undesired current draw, this MCU requires a reset of the TRNG circuit. */
+    bsp_reset_trng_circuit();
+ #endif
+
+    R_BSP_WarmStart(BSP_WARM_START_DEFERRED);
+
+    BSP_PRV_BOOT_STAMP(BSP_BOOT_PHASE_DEFERRED);
+}
+
+#endif
+
+#if BSP_CFG_FAST_BOOT_ENABLE && BSP_CFG_C_RUNTIME_INIT
+
+/*******************************************************************************************************************//**
+ * Clears the next chunk of BSS. Called by bsp_clock_init while it waits for clock sources to stabilize.
+ **********************************************************************************************************************/
+void bsp_boot_bss_clear_step (void)
+{
+    uint32_t size = (uint32_t) (gp_bsp_boot_bss_end - gp_bsp_boot_bss_next);
+
+    if (size > BSP_CFG_FAST_BOOT_BSS_CHUNK_BYTES)
+    {
+        size = BSP_CFG_FAST_BOOT_BSS_CHUNK_BYTES;
+    }
+
+    memset(gp_bsp_boot_bss_next, 0U, size);
+    gp_bsp_boot_bss_next += size;
+}
+
+#endif
+
+#if BSP_CFG_BOOT_PROFILE_ENABLE
+
+/*******************************************************************************************************************//**
+ * Gets the DWT cycle count recorded when a boot phase was reached. The count starts at 0 on entry to SystemInit.
+ * Cycles counted before BSP_BOOT_PHASE_CLOCK run at the reset clock, later cycles run at SystemCoreClock.
+ *
+ * @param[in]  phase       Boot phase to read.
+ * @param[out] p_cycles    Cycle count at the boot phase.
+ *
+ * @retval FSP_SUCCESS                Time stamp returned.
+ * @retval FSP_ERR_ASSERTION          p_cycles is NULL or phase is invalid.
+ * @retval FSP_ERR_NOT_INITIALIZED    The boot phase has not been reached.
+ **********************************************************************************************************************/
+fsp_err_t R_BSP_BootTimestampGet (bsp_boot_phase_t phase, uint32_t * p_cycles)
+{
+ #if BSP_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_cycles);
+    FSP_ASSERT(phase < BSP_BOOT_PHASE_COUNT);
+ #endif
+
+    FSP_ERROR_RETURN(0U != (g_bsp_boot_phases & (1U << phase)), FSP_ERR_NOT_INITIALIZED);
+
+    *p_cycles = g_bsp_boot_timestamp[phase];
+
+    return FSP_SUCCESS;
+}
+
+#endif
+
 /*******************************************************************************************************************//**
  * Disable TRNG circuit to prevent unnecessary current draw which may otherwise occur when the Crypto module
  * is not in use.
@@ -0,0 +1,225 @@
+/***********************************************************************************************************************
+ * Copyright [2020] Renesas Electronics Corporation and/or its affiliates.  All Rights Reserved.
+ *
+ * This software and documentation are supplied by Renesas Electronics America Inc. and may only be used with products
+ * of Renesas Electronics Corp. and its affiliates ("Renesas").  No other uses are authorized.  Renesas products are
+ * sold pursuant to Renesas terms and conditions of sale.  Purchasers are solely responsible for the selection and use
+ * of Renesas products and Renesas assumes no liability.  No license, express or implied, to any intellectual property
+ * right is granted by Renesas. This software is protected under all applicable laws, including copyright laws. Renesas
+ * reserves the right to change or discontinue this software and/or this documentation. THE SOFTWARE AND DOCUMENTATION
+ * IS DELIVERED TO YOU "AS IS," AND RENESAS MAKES NO REPRESENTATIONS OR WARRANTIES, AND TO THE FULLEST EXTENT
+ * PERMISSIBLE UNDER APPLICABLE LAW, DISCLAIMS ALL WARRANTIES, WHETHER EXPLICITLY OR IMPLICITLY, INCLUDING WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, AND NONINFRINGEMENT, WITH RESPECT TO THE SOFTWARE OR
+ * DOCUMENTATION.  RENESAS SHALL HAVE NO LIABILITY ARISING OUT OF ANY SECURITY VULNERABILITY OR BREACH.  TO THE MAXIMUM
+ * EXTENT PERMITTED BY LAW, IN NO EVENT WILL RENESAS BE LIABLE TO YOU IN CONNECTION WITH THE SOFTWARE OR DOCUMENTATION
+ * (OR ANY PERSON OR ENTITY CLAIMING RIGHTS DERIVED FROM YOU) FOR ANY LOSS, DAMAGES, OR CLAIMS WHATSOEVER, INCLUDING,
+ * WITHOUT LIMITATION, ANY DIRECT, CONSEQUENTIAL, SPECIAL, INDIRECT, PUNITIVE, OR INCIDENTAL DAMAGES; ANY LOST PROFITS,
+ * OTHER ECONOMIC DAMAGE, PROPERTY DAMAGE, OR PERSONAL INJURY; AND EVEN IF RENESAS HAS BEEN ADVISED OF THE POSSIBILITY
+ * OF SUCH LOSS, DAMAGES, CLAIMS OR COSTS.
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Includes   <System Includes> , "Project Includes"
+ **********************************************************************************************************************/
+#include "bsp_api.h"
+
+#if BSP_CFG_BOOT_PROFILE_ENABLE
+
+/***********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+
+/* Index of the open being measured when no open is being measured. */
+ #define BSP_PRV_BOOT_OPEN_NONE       (UINT32_MAX)
+
+ #define BSP_PRV_BOOT_US_PER_SECOND   (1000000U)
+
+/***********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Private function prototypes
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Exported global variables (to be accessed by other files)
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Private global variables and functions
+ **********************************************************************************************************************/
+
+/* Names of the boot phases. Entry n of the breakdown covers the time from the previous phase reached to phase n. */
+static char const * const g_bsp_boot_phase_names[BSP_BOOT_PHASE_COUNT] =
+{
+    [BSP_BOOT_PHASE_RESET]     = "reset",
+    [BSP_BOOT_PHASE_CLOCK]     = "clock",
+    [BSP_BOOT_PHASE_C_RUNTIME] = "c_runtime",
+    [BSP_BOOT_PHASE_POST_C]    = "warm_start_post_c",
+    [BSP_BOOT_PHASE_IRQ_CFG]   = "bsp_services",
+    [BSP_BOOT_PHASE_MAIN]      = "board_init",
+    [BSP_BOOT_PHASE_DEFERRED]  = "deferred_init",
+};
+
+/* Driver opens recorded. The delay hook runs before the C runtime is set up, so the state it reads is not in BSS. */
+static bsp_boot_profile_entry_t g_bsp_boot_opens[BSP_CFG_BOOT_PROFILE_OPEN_MAX];
+static uint32_t g_bsp_boot_open_count BSP_PLACE_IN_SECTION(BSP_SECTION_NOINIT);
+static uint32_t g_bsp_boot_open_active BSP_PLACE_IN_SECTION(BSP_SECTION_NOINIT);
+static uint32_t g_bsp_boot_open_depth BSP_PLACE_IN_SECTION(BSP_SECTION_NOINIT);
+
+/*******************************************************************************************************************//**
+ * @addtogroup BSP_MCU
+ * @{
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * Starts measuring a driver open. Use BSP_BOOT_OPEN_MEASURE instead of calling this function directly. Opens called
+ * while another open is measured, such as an r_sdhi open from rm_block_media_sdmmc, count towards the outer open.
+ *
+ * @param[in]  p_name      Name of the open, stored by reference.
+ **********************************************************************************************************************/
+void R_BSP_BootOpenStart (char const * p_name)
+{
+    g_bsp_boot_open_depth++;
+
+    if ((1U == g_bsp_boot_open_depth) && (g_bsp_boot_open_count < BSP_CFG_BOOT_PROFILE_OPEN_MAX))
+    {
+        bsp_boot_profile_entry_t * p_entry = &g_bsp_boot_opens[g_bsp_boot_open_count];
+
+        p_entry->p_name        = p_name;
+        p_entry->wait_cycles   = 0U;
+        p_entry->flags         = 0U;
+        g_bsp_boot_open_active = g_bsp_boot_open_count;
+        p_entry->start         = DWT->CYCCNT;
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Ends the measurement started by R_BSP_BootOpenStart().
+ **********************************************************************************************************************/
+void R_BSP_BootOpenEnd (void)
+{
+    uint32_t now = DWT->CYCCNT;
+
+    if (g_bsp_boot_open_depth > 0U)
+    {
+        g_bsp_boot_open_depth--;
+    }
+
+    if ((0U == g_bsp_boot_open_depth) && (BSP_PRV_BOOT_OPEN_NONE != g_bsp_boot_open_active))
+    {
+        g_bsp_boot_opens[g_bsp_boot_open_active].cycles = now - g_bsp_boot_opens[g_bsp_boot_open_active].start;
+        g_bsp_boot_open_active = BSP_PRV_BOOT_OPEN_NONE;
+        g_bsp_boot_open_count++;
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Gets the boot time breakdown: one entry per boot phase reached and one per driver open recorded with
+ * BSP_BOOT_OPEN_MEASURE, sorted by duration, longest first. Driver opens are flagged with bsp_boot_profile_flag_t
+ * hints. Cycles of the clock phase run at the reset clock, later cycles run at SystemCoreClock. The deferred_init
+ * phase covers everything from the return of SystemInit to the return of R_BSP_FastBootDeferredInit().
+ *
+ * @param[out]    p_entries      Breakdown entries.
+ * @param[in,out] p_count        Number of entries p_entries can hold. Set to the number of entries written.
+ *
+ * @retval FSP_SUCCESS                Breakdown returned.
+ * @retval FSP_ERR_ASSERTION          p_entries or p_count is NULL.
+ * @retval FSP_ERR_NOT_INITIALIZED    The boot profile was not started.
+ **********************************************************************************************************************/
+fsp_err_t R_BSP_BootProfileGet (bsp_boot_profile_entry_t * p_entries, uint32_t * p_count)
+{
+ #if BSP_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_entries);
+    FSP_ASSERT(NULL != p_count);
+ #endif
+
+    uint32_t previous;
+    fsp_err_t err = R_BSP_BootTimestampGet(BSP_BOOT_PHASE_RESET, &previous);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+    uint32_t count     = 0U;
+    uint32_t max       = *p_count;
+    uint32_t defer_min = (SystemCoreClock / BSP_PRV_BOOT_US_PER_SECOND) * BSP_CFG_BOOT_PROFILE_DEFER_US;
+
+    /* Boot phases, each measured from the previous phase reached. */
+    for (uint32_t phase = BSP_BOOT_PHASE_CLOCK; phase < BSP_BOOT_PHASE_COUNT; phase++)
+    {
+        uint32_t timestamp;
+        if ((count < max) && (FSP_SUCCESS == R_BSP_BootTimestampGet((bsp_boot_phase_t) phase, &timestamp)))
+        {
+            p_entries[count].p_name      = g_bsp_boot_phase_names[phase];
+            p_entries[count].start       = previous;
+            p_entries[count].cycles      = timestamp - previous;
+            p_entries[count].wait_cycles = 0U;
+            p_entries[count].flags       = 0U;
+            previous                     = timestamp;
+            count++;
+        }
+    }
+
+    /* Driver opens. */
+    for (uint32_t i = 0U; (i < g_bsp_boot_open_count) && (count < max); i++)
+    {
+        p_entries[count] = g_bsp_boot_opens[i];
+
+        if (p_entries[count].cycles > defer_min)
+        {
+            p_entries[count].flags |= BSP_BOOT_PROFILE_FLAG_DEFER;
+        }
+
+        if (p_entries[count].wait_cycles > (p_entries[count].cycles / 2U))
+        {
+            p_entries[count].flags |= BSP_BOOT_PROFILE_FLAG_PARALLEL;
+        }
+
+        count++;
+    }
+
+    /* Sort by duration, longest first. The breakdown is short, so an insertion sort is enough. */
+    for (uint32_t i = 1U; i < count; i++)
+    {
+        bsp_boot_profile_entry_t entry = p_entries[i];
+        uint32_t                 j     = i;
+
+        while ((j > 0U) && (p_entries[j - 1U].cycles < entry.cycles))
+        {
+            p_entries[j] = p_entries[j - 1U];
+            j--;
+        }
+
+        p_entries[j] = entry;
+    }
+
+    *p_count = count;
+
+    return FSP_SUCCESS;
+}
+
+/** @} (end addtogroup BSP_MCU) */
+
+/*******************************************************************************************************************//**
+ * Clears the driver open records. Called from SystemInit before the C runtime is set up.
+ **********************************************************************************************************************/
+void bsp_boot_profile_init (void)
+{
+    g_bsp_boot_open_count  = 0U;
+    g_bsp_boot_open_active = BSP_PRV_BOOT_OPEN_NONE;
+    g_bsp_boot_open_depth  = 0U;
+}
+
+/*******************************************************************************************************************//**
+ * Adds the cycles of a software delay to the driver open being measured. Called from R_BSP_SoftwareDelay.
+ *
+ * @param[in]  cycles      Cycles spent in the delay.
+ **********************************************************************************************************************/
+void bsp_boot_profile_delay (uint32_t cycles)
+{
+    if (BSP_PRV_BOOT_OPEN_NONE != g_bsp_boot_open_active)
+    {
+        g_bsp_boot_opens[g_bsp_boot_open_active].wait_cycles += cycles;
+    }
+}
+
+#endif
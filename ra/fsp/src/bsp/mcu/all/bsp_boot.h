@@ -0,0 +1,142 @@
+/***********************************************************************************************************************
+ * Copyright [2020] Renesas Electronics Corporation and/or its affiliates.  All Rights Reserved.
+ *
+ * This software and documentation are supplied by Renesas Electronics America Inc. and may only be used with products
+ * of Renesas Electronics Corp. and its affiliates ("Renesas").  No other uses are authorized.  Renesas products are
+ * sold pursuant to Renesas terms and conditions of sale.  Purchasers are solely responsible for the selection and use
+ * of Renesas products and Renesas assumes no liability.  No license, express or implied, to any intellectual property
+ * right is granted by Renesas. This software is protected under all applicable laws, including copyright laws. Renesas
+ * reserves the right to change or discontinue this software and/or this documentation. THE SOFTWARE AND DOCUMENTATION
+ * IS DELIVERED TO YOU "AS IS," AND RENESAS MAKES NO REPRESENTATIONS OR WARRANTIES, AND TO THE FULLEST EXTENT
+ * PERMISSIBLE UNDER APPLICABLE LAW, DISCLAIMS ALL WARRANTIES, WHETHER EXPLICITLY OR IMPLICITLY, INCLUDING WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, AND NONINFRINGEMENT, WITH RESPECT TO THE SOFTWARE OR
+ * DOCUMENTATION.  RENESAS SHALL HAVE NO LIABILITY ARISING OUT OF ANY SECURITY VULNERABILITY OR BREACH.  TO THE MAXIMUM
+ * EXTENT PERMITTED BY LAW, IN NO EVENT WILL RENESAS BE LIABLE TO YOU IN CONNECTION WITH THE SOFTWARE OR DOCUMENTATION
+ * (OR ANY PERSON OR ENTITY CLAIMING RIGHTS DERIVED FROM YOU) FOR ANY LOSS, DAMAGES, OR CLAIMS WHATSOEVER, INCLUDING,
+ * WITHOUT LIMITATION, ANY DIRECT, CONSEQUENTIAL, SPECIAL, INDIRECT, PUNITIVE, OR INCIDENTAL DAMAGES; ANY LOST PROFITS,
+ * OTHER ECONOMIC DAMAGE, PROPERTY DAMAGE, OR PERSONAL INJURY; AND EVEN IF RENESAS HAS BEEN ADVISED OF THE POSSIBILITY
+ * OF SUCH LOSS, DAMAGES, CLAIMS OR COSTS.
+ **********************************************************************************************************************/
+
+#ifndef BSP_BOOT_H
+#define BSP_BOOT_H
+
+/***********************************************************************************************************************
+ * Includes   <System Includes> , "Project Includes"
+ **********************************************************************************************************************/
+
+/** Common macro for FSP header files. There is also a corresponding FSP_FOOTER macro at the end of this file. */
+FSP_HEADER
+
+/*******************************************************************************************************************//**
+ * @addtogroup BSP_MCU
+ * @{
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+
+/** Set BSP_CFG_FAST_BOOT_ENABLE to 1 to shorten the time from reset to main. BSS is cleared in chunks while SystemInit
+ * waits for the clock sources to stabilize, and steps not needed to reach main are moved to
+ * R_BSP_FastBootDeferredInit(), which the application calls once its time critical startup work is done. */
+#ifndef BSP_CFG_FAST_BOOT_ENABLE
+ #define BSP_CFG_FAST_BOOT_ENABLE              (0)
+#endif
+
+/** Number of BSS bytes cleared each time a clock stabilization wait polls its status flag. */
+#ifndef BSP_CFG_FAST_BOOT_BSS_CHUNK_BYTES
+ #define BSP_CFG_FAST_BOOT_BSS_CHUNK_BYTES     (256U)
+#endif
+
+/** Set BSP_CFG_BOOT_PROFILE_ENABLE to 1 to record a DWT cycle count time stamp at each boot phase. See
+ * R_BSP_BootTimestampGet(). */
+#ifndef BSP_CFG_BOOT_PROFILE_ENABLE
+ #define BSP_CFG_BOOT_PROFILE_ENABLE           (0)
+#endif
+
+/** Number of driver opens BSP_BOOT_OPEN_MEASURE can record. Later opens are not recorded. */
+#ifndef BSP_CFG_BOOT_PROFILE_OPEN_MAX
+ #define BSP_CFG_BOOT_PROFILE_OPEN_MAX         (16U)
+#endif
+
+/** Driver opens that take longer than this many microseconds are flagged with BSP_BOOT_PROFILE_FLAG_DEFER. */
+#ifndef BSP_CFG_BOOT_PROFILE_DEFER_US
+ #define BSP_CFG_BOOT_PROFILE_DEFER_US         (1000U)
+#endif
+
+/** Time stamps a driver open call from the application startup sequence, for R_BSP_BootProfileGet(). For example:
+ * BSP_BOOT_OPEN_MEASURE("ether", err = R_ETHER_Open(&g_ether0_ctrl, &g_ether0_cfg)); */
+#if BSP_CFG_BOOT_PROFILE_ENABLE
+ #define BSP_BOOT_OPEN_MEASURE(name, call)    \
+    {                                         \
+        R_BSP_BootOpenStart(name);            \
+        call;                                 \
+        R_BSP_BootOpenEnd();                  \
+    }
+#else
+ #define BSP_BOOT_OPEN_MEASURE(name, call)    {call;}
+#endif
+
+/***********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+
+/** Boot phases time stamped when BSP_CFG_BOOT_PROFILE_ENABLE is set. */
+typedef enum e_bsp_boot_phase
+{
+    BSP_BOOT_PHASE_RESET = 0,          ///< Entry to SystemInit. The cycle counter is started here.
+    BSP_BOOT_PHASE_CLOCK,              ///< System clocks configured.
+    BSP_BOOT_PHASE_C_RUNTIME,          ///< BSS cleared, data copied and static constructors run.
+    BSP_BOOT_PHASE_POST_C,             ///< BSP_WARM_START_POST_C hook returned.
+    BSP_BOOT_PHASE_IRQ_CFG,            ///< BSP services and ELC events set up. bsp_init (board_init.c) runs next.
+    BSP_BOOT_PHASE_MAIN,               ///< SystemInit returned.
+    BSP_BOOT_PHASE_DEFERRED,           ///< R_BSP_FastBootDeferredInit returned.
+    BSP_BOOT_PHASE_COUNT
+} bsp_boot_phase_t;
+
+/** Hints set in bsp_boot_profile_entry_t::flags for driver opens. */
+typedef enum e_bsp_boot_profile_flag
+{
+    /** The open took longer than BSP_CFG_BOOT_PROFILE_DEFER_US. Consider opening the driver once the time critical
+     * startup work is done, for example from R_BSP_WarmStart(BSP_WARM_START_DEFERRED) or a low priority task. */
+    BSP_BOOT_PROFILE_FLAG_DEFER = (1U << 0),
+
+    /** More than half of the open was spent in R_BSP_SoftwareDelay waiting for the hardware. The wait can overlap
+     * other startup work if the driver is opened from its own RTOS task. */
+    BSP_BOOT_PROFILE_FLAG_PARALLEL = (1U << 1),
+} bsp_boot_profile_flag_t;
+
+/** One line of the boot time breakdown returned by R_BSP_BootProfileGet(). All times are in DWT cycles counted from
+ * entry to SystemInit. */
+typedef struct st_bsp_boot_profile_entry
+{
+    char const * p_name;               ///< Boot phase name, or the name passed to BSP_BOOT_OPEN_MEASURE
+    uint32_t     start;                ///< Cycle count when the phase or open started
+    uint32_t     cycles;               ///< Cycles spent in the phase or open
+    uint32_t     wait_cycles;          ///< Cycles of the open spent in R_BSP_SoftwareDelay (0 for boot phases)
+    uint32_t     flags;                ///< Bit mask of bsp_boot_profile_flag_t (0 for boot phases)
+} bsp_boot_profile_entry_t;
+
+/** @} (end addtogroup BSP_MCU) */
+
+/***********************************************************************************************************************
+ * Exported global variables
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Exported global functions (to be accessed by other files)
+ **********************************************************************************************************************/
+fsp_err_t R_BSP_BootTimestampGet(bsp_boot_phase_t phase, uint32_t * p_cycles);
+void      R_BSP_BootOpenStart(char const * p_name);
+void      R_BSP_BootOpenEnd(void);
+fsp_err_t R_BSP_BootProfileGet(bsp_boot_profile_entry_t * p_entries, uint32_t * p_count);
+void      R_BSP_FastBootDeferredInit(void);
+void      bsp_boot_bss_clear_step(void);          // Used internally by BSP
+void      bsp_boot_profile_init(void);            // Used internally by BSP
+void      bsp_boot_profile_delay(uint32_t cycles); // Used internally by BSP
+
+/** Common macro for FSP header files. There is also a corresponding FSP_HEADER macro at the top of this file. */
+FSP_FOOTER
+
+#endif
@@ -38,6 +38,13 @@
 
 #define BSP_PRV_MAXIMUM_HOCOWTR_HSTS          ((uint8_t) 0x6U)
 
+/* Waits for a clock source to stabilize during startup. In fast boot mode BSS is cleared while waiting. */
+#if BSP_CFG_FAST_BOOT_ENABLE && BSP_CFG_C_RUNTIME_INIT
+ #define BSP_PRV_STARTUP_WAIT(reg, required_value)    while (reg != required_value) {bsp_boot_bss_clear_step();}
+#else
+ #define BSP_PRV_STARTUP_WAIT(reg, required_value)    FSP_HARDWARE_REGISTER_WAIT(reg, required_value)
+#endif
+
 /* Wait state definitions for MEMWAIT. */
 #define BSP_PRV_MEMWAIT_ZERO_WAIT_CYCLES      (0U)
 #define BSP_PRV_MEMWAIT_TWO_WAIT_CYCLES       (1U)
@@ -442,6 +449,18 @@ void bsp_prv_prepare_pll (uint32_t pll_freq_hz)
 
 #endif
 
+/*******************************************************************************************************************//**
+ * Gets the frequency of a system clock source, before the system clock dividers.
+ *
+ * @param[in] clock                    System clock source, as written to SCKSCR
+ *
+ * @return Frequency of the clock source in Hertz.
+ **********************************************************************************************************************/
+uint32_t bsp_prv_source_clock_hz_get (uint32_t clock)
+{
+    return g_clock_freq[clock];
+}
+
 /*******************************************************************************************************************//**
  * Update SystemCoreClock variable based on current clock settings.
  **********************************************************************************************************************/
@@ -888,11 +907,11 @@ void bsp_clock_init (void)
    #endif
 
     /* Wait for HOCO to stabilize. */
-    FSP_HARDWARE_REGISTER_WAIT(R_SYSTEM->OSCSF_b.HOCOSF, 1U);
+    BSP_PRV_STARTUP_WAIT(R_SYSTEM->OSCSF_b.HOCOSF, 1U);
   #else
 
     /* Wait for main oscillator to stabilize. */
-    FSP_HARDWARE_REGISTER_WAIT(R_SYSTEM->OSCSF_b.MOSCSF, 1U);
+    BSP_PRV_STARTUP_WAIT(R_SYSTEM->OSCSF_b.MOSCSF, 1U);
   #endif
  #endif
 #endif
@@ -908,7 +927,7 @@ void bsp_clock_init (void)
  #endif
 
     /* Wait for HOCO to stabilize. */
-    FSP_HARDWARE_REGISTER_WAIT(R_SYSTEM->OSCSF_b.HOCOSF, 1U);
+    BSP_PRV_STARTUP_WAIT(R_SYSTEM->OSCSF_b.HOCOSF, 1U);
 #elif BSP_CLOCKS_SOURCE_CLOCK_MOCO == BSP_CFG_CLOCK_SOURCE
  #if BSP_CFG_SOFT_RESET_SUPPORTED
 
@@ -937,12 +956,12 @@ void bsp_clock_init (void)
     R_SYSTEM->MOSCCR = 0U;
 
     /* Wait for main oscillator to stabilize. */
-    FSP_HARDWARE_REGISTER_WAIT(R_SYSTEM->OSCSF_b.MOSCSF, 1U);
+    BSP_PRV_STARTUP_WAIT(R_SYSTEM->OSCSF_b.MOSCSF, 1U);
 #elif BSP_CLOCKS_SOURCE_CLOCK_PLL == BSP_CFG_CLOCK_SOURCE
     R_SYSTEM->PLLCR = 0U;
 
     /* Wait for PLL to stabilize. */
-    FSP_HARDWARE_REGISTER_WAIT(R_SYSTEM->OSCSF_b.PLLSF, 1U);
+    BSP_PRV_STARTUP_WAIT(R_SYSTEM->OSCSF_b.PLLSF, 1U);
 #else
 
     /* Do nothing. Subclock is already started and stabilized if it is populated and selected as system clock. */
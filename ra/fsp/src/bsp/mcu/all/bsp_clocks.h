@@ -317,8 +317,9 @@ void     bsp_prv_power_change_mstp_clear(uint32_t mstp_clear_bitmask);
 
 #endif
 
-void bsp_prv_prepare_pll(uint32_t pll_freq_hz);
-void bsp_prv_clock_set(uint32_t clock, uint32_t sckdivcr);
+void     bsp_prv_prepare_pll(uint32_t pll_freq_hz);
+void     bsp_prv_clock_set(uint32_t clock, uint32_t sckdivcr);
+uint32_t bsp_prv_source_clock_hz_get(uint32_t clock);
 
 /** Common macro for FSP header files. There is also a corresponding FSP_HEADER macro at the top of this file. */
 FSP_FOOTER
@@ -58,8 +58,19 @@ FSP_HEADER
 #define BSP_API_VERSION_MAJOR     (1U)
 #define BSP_API_VERSION_MINOR     (0U)
 
-#define FSP_CONTEXT_SAVE
-#define FSP_CONTEXT_RESTORE
+/** Set BSP_CFG_LATENCY_MEASURE_ENABLE to 1 to measure the duration of every ISR that uses FSP_CONTEXT_SAVE and
+ * FSP_CONTEXT_RESTORE with the DWT cycle counter. See R_BSP_LatencyIsrStatsGet(). */
+#ifndef BSP_CFG_LATENCY_MEASURE_ENABLE
+ #define BSP_CFG_LATENCY_MEASURE_ENABLE    (0)
+#endif
+
+#if BSP_CFG_LATENCY_MEASURE_ENABLE
+ #define FSP_CONTEXT_SAVE                  R_BSP_LatencyIsrEnter();
+ #define FSP_CONTEXT_RESTORE               R_BSP_LatencyIsrExit();
+#else
+ #define FSP_CONTEXT_SAVE
+ #define FSP_CONTEXT_RESTORE
+#endif
 
 /** Macro to log and return error without an assertion. */
 #ifndef FSP_RETURN
@@ -190,7 +201,8 @@ typedef enum e_bsp_warm_start_event
 {
     BSP_WARM_START_RESET = 0,          ///< Called almost immediately after reset. No C runtime environment, clocks, or IRQs.
     BSP_WARM_START_POST_CLOCK,         ///< Called after clock initialization. No C runtime environment or IRQs.
-    BSP_WARM_START_POST_C              ///< Called after clocks and C runtime environment have been set up
+    BSP_WARM_START_POST_C,             ///< Called after clocks and C runtime environment have been set up
+    BSP_WARM_START_DEFERRED            ///< Called from R_BSP_FastBootDeferredInit() after main has started
 } bsp_warm_start_event_t;
 
 /* Private enum used in R_FSP_SystemClockHzGet.  Maps clock name to base bit in SCKDIVCR. */
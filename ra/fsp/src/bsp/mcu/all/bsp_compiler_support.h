@@ -62,12 +62,24 @@
 #define BSP_SECTION_APPLICATION_VECTORS    ".application_vectors"
 #define BSP_SECTION_ROM_REGISTERS          ".rom_registers"
 #define BSP_SECTION_ID_CODE                ".id_code"
+#define BSP_SECTION_CODE_IN_RAM            ".code_in_ram"
 
 /* Compiler neutral macros. */
 #define BSP_PLACE_IN_SECTION(x)    __attribute__((section(x))) __attribute__((__used__))
 
 #define BSP_ALIGN_VARIABLE(x)      __attribute__((aligned(x)))
 
+/** Places a function in RAM. The linker must place BSP_SECTION_CODE_IN_RAM in RAM with its load image in ROM so that
+ * it is copied with initialized data at startup, or see BSP_CFG_CODE_IN_RAM_COPY_ENABLE. */
+#define BSP_PLACE_IN_RAM           BSP_PLACE_IN_SECTION(BSP_SECTION_CODE_IN_RAM)
+
+/** Set BSP_CFG_CODE_IN_RAM_COPY_ENABLE to 1 when the GCC or AC6 linker script gives BSP_SECTION_CODE_IN_RAM its own
+ * output section, so SystemInit copies it from ROM. GCC scripts define __code_in_ram_start__, __code_in_ram_end__ and
+ * __code_in_ram_load__; AC6 scatter files name the execution region CODE_IN_RAM. IAR always copies the section. */
+#ifndef BSP_CFG_CODE_IN_RAM_COPY_ENABLE
+ #define BSP_CFG_CODE_IN_RAM_COPY_ENABLE    (0)
+#endif
+
 #define BSP_PACKED                    __attribute__((aligned(1)))
 
 #define BSP_WEAK_REFERENCE            __attribute__((weak))
@@ -23,6 +23,10 @@
  **********************************************************************************************************************/
 #include "bsp_api.h"
 #include "bsp_delay.h"
+#if (2 == BSP_CFG_RTOS) && (BSP_CFG_DELAY_RTOS_YIELD_US > 0U)
+ #include "FreeRTOS.h"
+ #include "task.h"
+#endif
 
 /***********************************************************************************************************************
  * Macro definitions
@@ -30,6 +34,13 @@
 #define BSP_DELAY_NS_PER_SECOND    (1000000000)
 #define BSP_DELAY_NS_PER_US        (1000)
 
+#if (2 == BSP_CFG_RTOS) && (BSP_CFG_DELAY_RTOS_YIELD_US > 0U)
+ #define BSP_PRV_DELAY_RTOS_YIELD    (1)
+ #define BSP_PRV_DELAY_US_PER_TICK   (1000000U / configTICK_RATE_HZ)
+#else
+ #define BSP_PRV_DELAY_RTOS_YIELD    (0)
+#endif
+
 /***********************************************************************************************************************
  * Typedef definitions
  **********************************************************************************************************************/
@@ -37,6 +48,10 @@
 /***********************************************************************************************************************
  * Private function prototypes
  **********************************************************************************************************************/
+#if BSP_PRV_DELAY_RTOS_YIELD
+static bool bsp_prv_delay_rtos_yield(uint32_t total_us);
+
+#endif
 
 /***********************************************************************************************************************
  * Exported global variables (to be accessed by other files)
@@ -75,6 +90,9 @@
  *              overhead associated with executing the code to just get to this point has certainly satisfied the requested delay.
  *
  *
+ * With FreeRTOS, delays of at least BSP_CFG_DELAY_RTOS_YIELD_US requested from a task block it with vTaskDelay()
+ * instead, rounded up to whole ticks plus one.
+ *
  * @note This function calls bsp_cpu_clock_get() which ultimately calls R_CGC_SystemClockFreqGet() and therefore requires
  *       that the BSP has already initialized the CGC (which it does as part of the Sysinit).
  *       Care should be taken to ensure this remains the case if in the future this function were to be called as part
@@ -90,6 +108,13 @@ void R_BSP_SoftwareDelay (uint32_t delay, bsp_delay_units_t units)
     uint32_t total_us       = (delay * units);                        /** Convert the requested time to microseconds. */
     uint64_t ns_64bits;
 
+#if BSP_PRV_DELAY_RTOS_YIELD
+    if (bsp_prv_delay_rtos_yield(total_us))
+    {
+        return;
+    }
+#endif
+
     iclk_hz = SystemCoreClock;                                        /** Get the system clock frequency in Hz. */
 
     /* Running on the Sub-clock (32768 Hz) there are 30517 ns/cycle. This means one cycle takes 31 us. One execution
@@ -132,12 +157,61 @@ void R_BSP_SoftwareDelay (uint32_t delay, bsp_delay_units_t units)
     /** Only delay if the supplied parameters constitute a delay. */
     if (loops_required > (uint32_t) 0)
     {
+#if BSP_CFG_BOOT_PROFILE_ENABLE
+
+        /* Let the boot profiler tell hardware waits apart from work in the driver opens it measures. */
+        uint32_t start = DWT->CYCCNT;
+        bsp_prv_software_delay_loop(loops_required);
+        bsp_boot_profile_delay(DWT->CYCCNT - start);
+#else
         bsp_prv_software_delay_loop(loops_required);
+#endif
     }
 }
 
 /** @} (end addtogroup BSP_MCU) */
 
+#if BSP_PRV_DELAY_RTOS_YIELD
+
+/*******************************************************************************************************************//**
+ *        Blocks the calling task for a delay long enough to be worth a context switch, if it is safe to block.
+ * @param[in]     total_us  The requested delay in microseconds.
+ * @retval        true      The delay was spent blocked.
+ * @retval        false     The caller must busy wait.
+ **********************************************************************************************************************/
+static bool bsp_prv_delay_rtos_yield (uint32_t total_us)
+{
+    if (total_us < BSP_CFG_DELAY_RTOS_YIELD_US)
+    {
+        return false;
+    }
+
+    /* Only block from a task, with interrupts enabled and the scheduler running. */
+    if ((0U != __get_IPSR()) || (0U != __get_PRIMASK()))
+    {
+        return false;
+    }
+
+ #if (4U == __CORTEX_M) || (33U == __CORTEX_M)
+    if (0U != __get_BASEPRI())
+    {
+        return false;
+    }
+ #endif
+
+    if (taskSCHEDULER_RUNNING != xTaskGetSchedulerState())
+    {
+        return false;
+    }
+
+    /* The first tick may come right after the call, so wait one tick more than the delay rounded up. */
+    vTaskDelay((TickType_t) ((total_us / BSP_PRV_DELAY_US_PER_TICK) + 2U));
+
+    return true;
+}
+
+#endif
+
 /*******************************************************************************************************************//**
  *        This assembly language routine takes roughly 4 cycles per loop. 2 additional cycles
  *        occur when the loop exits. The 'naked' attribute  indicates that the specified function does not need
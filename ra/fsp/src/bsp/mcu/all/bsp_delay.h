@@ -50,6 +50,14 @@ FSP_HEADER
  * of 0. */
 #define BSP_DELAY_LOOPS_CALCULATE(cycles)    (((cycles) / BSP_DELAY_LOOP_CYCLES) + 1U)
 
+/** With FreeRTOS (BSP_CFG_RTOS == 2), R_BSP_SoftwareDelay() blocks the calling task with vTaskDelay() for delays of
+ * at least this many microseconds, so other tasks run while drivers wait for hardware. Shorter delays, and delays
+ * requested from an interrupt, with interrupts masked or before the scheduler starts, busy wait. Set to 0 to always
+ * busy wait. */
+#ifndef BSP_CFG_DELAY_RTOS_YIELD_US
+ #define BSP_CFG_DELAY_RTOS_YIELD_US         (1000U)
+#endif
+
 /** Available delay units for R_BSP_SoftwareDelay(). These are ultimately used to calculate a total # of microseconds */
 typedef enum
 {
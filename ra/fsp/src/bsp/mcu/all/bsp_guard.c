@@ -52,4 +52,90 @@ BSP_CMSE_NONSECURE_ENTRY fsp_err_t R_BSP_ClockUpdateCallbackSet (bsp_clock_updat
 
  #endif
 
+/* Handlers of the operations that can be requested with R_BSP_SecureCallBatch(). */
+static bsp_secure_call_handler_t const * gp_bsp_secure_call_table    = NULL;
+static uint32_t                          g_bsp_secure_call_table_size = 0U;
+
+/*******************************************************************************************************************//**
+ * Set the handlers of the operations the nonsecure project can request with R_BSP_SecureCallBatch(). Called by the
+ * secure project before starting the nonsecure project. The table must stay valid while it is in use.
+ *
+ * @param[in]  p_table  Handlers, indexed by bsp_secure_call_t::id. NULL entries are rejected at call time.
+ * @param[in]  count    Number of entries in p_table.
+ *
+ * @retval FSP_SUCCESS              Table set.
+ * @retval FSP_ERR_ASSERTION        p_table is NULL.
+ **********************************************************************************************************************/
+fsp_err_t R_BSP_SecureCallTableSet (bsp_secure_call_handler_t const * p_table, uint32_t count)
+{
+    FSP_ASSERT(NULL != p_table);
+
+    gp_bsp_secure_call_table     = p_table;
+    g_bsp_secure_call_table_size = count;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Run several secure operations with a single transition to the secure state. Operations run in order. After the
+ * first failure the remaining operations are not run and their result is set to FSP_ERR_ABORTED.
+ *
+ * Each entry is copied before it is used, so the nonsecure project cannot redirect an operation after it has been
+ * checked.
+ *
+ * @param[in,out] p_calls  Operations, in nonsecure memory. The result of each operation is written back.
+ * @param[in]     count    Number of operations, up to BSP_CFG_SECURE_CALL_BATCH_MAX.
+ *
+ * @retval FSP_SUCCESS              All operations succeeded.
+ * @retval FSP_ERR_NOT_INITIALIZED  The secure project has not set a handler table.
+ * @retval FSP_ERR_INVALID_SIZE     count is 0 or larger than BSP_CFG_SECURE_CALL_BATCH_MAX.
+ * @retval FSP_ERR_INVALID_POINTER  p_calls, or the arguments of an operation, are not in nonsecure memory.
+ * @retval FSP_ERR_UNSUPPORTED      An operation has an id without a handler.
+ * @return                          Otherwise, the error returned by the handler of the first failing operation.
+ **********************************************************************************************************************/
+BSP_CMSE_NONSECURE_ENTRY fsp_err_t R_BSP_SecureCallBatch (bsp_secure_call_t * p_calls, uint32_t count)
+{
+    FSP_ERROR_RETURN(NULL != gp_bsp_secure_call_table, FSP_ERR_NOT_INITIALIZED);
+    FSP_ERROR_RETURN((count > 0U) && (count <= BSP_CFG_SECURE_CALL_BATCH_MAX), FSP_ERR_INVALID_SIZE);
+
+    void * p_calls_checked = cmse_check_address_range(p_calls, count * sizeof(bsp_secure_call_t), CMSE_AU_NONSECURE);
+    FSP_ERROR_RETURN(p_calls == p_calls_checked, FSP_ERR_INVALID_POINTER);
+
+    fsp_err_t err = FSP_SUCCESS;
+
+    for (uint32_t i = 0U; i < count; i++)
+    {
+        bsp_secure_call_t volatile * p_call = &p_calls[i];
+
+        if (FSP_SUCCESS != err)
+        {
+            p_call->result = FSP_ERR_ABORTED;
+            continue;
+        }
+
+        uint32_t id        = p_call->id;
+        void   * p_args    = p_call->p_args;
+        uint32_t args_size = p_call->args_size;
+
+        fsp_err_t result = FSP_SUCCESS;
+        if ((id >= g_bsp_secure_call_table_size) || (NULL == gp_bsp_secure_call_table[id]))
+        {
+            result = FSP_ERR_UNSUPPORTED;
+        }
+        else if ((0U != args_size) && (p_args != cmse_check_address_range(p_args, args_size, CMSE_AU_NONSECURE)))
+        {
+            result = FSP_ERR_INVALID_POINTER;
+        }
+        else
+        {
+            result = gp_bsp_secure_call_table[id](p_args, args_size);
+        }
+
+        p_call->result = result;
+        err            = result;
+    }
+
+    return err;
+}
+
 #endif
@@ -32,9 +32,34 @@
 /** Common macro for FSP header files. There is also a corresponding FSP_FOOTER macro at the end of this file. */
 FSP_HEADER
 
+/** Maximum number of operations in one R_BSP_SecureCallBatch() call. This bounds the time spent in the secure
+ * project per call. */
+#ifndef BSP_CFG_SECURE_CALL_BATCH_MAX
+ #define BSP_CFG_SECURE_CALL_BATCH_MAX    (16U)
+#endif
+
+/** Secure project handler of a batched operation. p_args has been checked to be args_size bytes of nonsecure memory,
+ * but its contents are still untrusted and may change while the handler runs. */
+typedef fsp_err_t (* bsp_secure_call_handler_t)(void * p_args, uint32_t args_size);
+
+/** One operation of a batch passed to R_BSP_SecureCallBatch(). */
+typedef struct st_bsp_secure_call
+{
+    uint32_t  id;                      ///< Index of the handler in the table set with R_BSP_SecureCallTableSet()
+    void    * p_args;                  ///< Arguments and results of the operation, in nonsecure memory
+    uint32_t  args_size;               ///< Size of the arguments in bytes
+    fsp_err_t result;                  ///< Set by the secure project. FSP_ERR_ABORTED if the operation was not run.
+} bsp_secure_call_t;
+
 #if BSP_TZ_SECURE_BUILD || BSP_TZ_NONSECURE_BUILD
 BSP_CMSE_NONSECURE_ENTRY fsp_err_t R_BSP_ClockUpdateCallbackSet(bsp_clock_update_callback_t        p_callback,
                                                                 bsp_clock_update_callback_args_t * p_callback_memory);
+BSP_CMSE_NONSECURE_ENTRY fsp_err_t R_BSP_SecureCallBatch(bsp_secure_call_t * p_calls, uint32_t count);
+
+#endif
+
+#if BSP_TZ_SECURE_BUILD
+fsp_err_t R_BSP_SecureCallTableSet(bsp_secure_call_handler_t const * p_table, uint32_t count);
 
 #endif
 
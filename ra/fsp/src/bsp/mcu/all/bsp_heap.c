@@ -0,0 +1,712 @@
+/***********************************************************************************************************************
+ * Copyright [2020] Renesas Electronics Corporation and/or its affiliates.  All Rights Reserved.
+ *
+ * This software and documentation are supplied by Renesas Electronics America Inc. and may only be used with products
+ * of Renesas Electronics Corp. and its affiliates ("Renesas").  No other uses are authorized.  Renesas products are
+ * sold pursuant to Renesas terms and conditions of sale.  Purchasers are solely responsible for the selection and use
+ * of Renesas products and Renesas assumes no liability.  No license, express or implied, to any intellectual property
+ * right is granted by Renesas. This software is protected under all applicable laws, including copyright laws. Renesas
+ * reserves the right to change or discontinue this software and/or this documentation. THE SOFTWARE AND DOCUMENTATION
+ * IS DELIVERED TO YOU "AS IS," AND RENESAS MAKES NO REPRESENTATIONS OR WARRANTIES, AND TO THE FULLEST EXTENT
+ * PERMISSIBLE UNDER APPLICABLE LAW, DISCLAIMS ALL WARRANTIES, WHETHER EXPLICITLY OR IMPLICITLY, INCLUDING WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, AND NONINFRINGEMENT, WITH RESPECT TO THE SOFTWARE OR
+ * DOCUMENTATION.  RENESAS SHALL HAVE NO LIABILITY ARISING OUT OF ANY SECURITY VULNERABILITY OR BREACH.  TO THE MAXIMUM
+ * EXTENT PERMITTED BY LAW, IN NO EVENT WILL RENESAS BE LIABLE TO YOU IN CONNECTION WITH THE SOFTWARE OR DOCUMENTATION
+ * (OR ANY PERSON OR ENTITY CLAIMING RIGHTS DERIVED FROM YOU) FOR ANY LOSS, DAMAGES, OR CLAIMS WHATSOEVER, INCLUDING,
+ * WITHOUT LIMITATION, ANY DIRECT, CONSEQUENTIAL, SPECIAL, INDIRECT, PUNITIVE, OR INCIDENTAL DAMAGES; ANY LOST PROFITS,
+ * OTHER ECONOMIC DAMAGE, PROPERTY DAMAGE, OR PERSONAL INJURY; AND EVEN IF RENESAS HAS BEEN ADVISED OF THE POSSIBILITY
+ * OF SUCH LOSS, DAMAGES, CLAIMS OR COSTS.
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Includes   <System Includes> , "Project Includes"
+ **********************************************************************************************************************/
+#include "bsp_api.h"
+
+#if BSP_CFG_HEAP_TLSF_ENABLE
+ #include <string.h>
+ #if defined(__GNUC__) && !defined(__ARMCC_VERSION)
+  #include <reent.h>
+ #endif
+
+/***********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+
+/* Blocks and payloads are 8-byte aligned, as required for 64-bit types and by the AAPCS stack alignment. */
+ #define BSP_PRV_HEAP_ALIGN_LOG2      (3U)
+ #define BSP_PRV_HEAP_ALIGN           (1U << BSP_PRV_HEAP_ALIGN_LOG2)
+ #define BSP_PRV_HEAP_SIZE_MASK       (~(BSP_PRV_HEAP_ALIGN - 1U))
+
+/* Each power of two size range (first level) is split into 8 linear ranges (second level). Blocks smaller than
+ * BSP_PRV_HEAP_SMALL_BLOCK are all in first level list 0, one second level list per 8 bytes. */
+ #define BSP_PRV_HEAP_SL_LOG2         (3U)
+ #define BSP_PRV_HEAP_SL_COUNT        (1U << BSP_PRV_HEAP_SL_LOG2)
+ #define BSP_PRV_HEAP_FL_SHIFT        (BSP_PRV_HEAP_SL_LOG2 + BSP_PRV_HEAP_ALIGN_LOG2)
+ #define BSP_PRV_HEAP_SMALL_BLOCK     (1U << BSP_PRV_HEAP_FL_SHIFT)
+
+/* Free blocks up to 2^28 - 8 bytes can be indexed, so a region may be up to 256 MB. */
+ #define BSP_PRV_HEAP_FL_MAX_LOG2     (27U)
+ #define BSP_PRV_HEAP_FL_COUNT        (BSP_PRV_HEAP_FL_MAX_LOG2 - BSP_PRV_HEAP_FL_SHIFT + 2U)
+ #define BSP_PRV_HEAP_BLOCK_LIMIT     (1U << (BSP_PRV_HEAP_FL_MAX_LOG2 + 1U))
+ #define BSP_PRV_HEAP_ALLOC_MAX       (1U << BSP_PRV_HEAP_FL_MAX_LOG2)
+
+/* The header of an allocated block is the physical link and the size. A free block also stores its free list links
+ * in the payload, which sets the minimum payload size. */
+ #define BSP_PRV_HEAP_HEADER_BYTES    (offsetof(bsp_prv_heap_block_t, p_next_free))
+ #define BSP_PRV_HEAP_PAYLOAD_MIN     (sizeof(bsp_prv_heap_block_t) - BSP_PRV_HEAP_HEADER_BYTES)
+
+/* Bit 0 of the block size is set while the block is free. */
+ #define BSP_PRV_HEAP_BLOCK_FREE      (1U)
+
+ #define BSP_PRV_HEAP_ALIGN_UP(x)     ((((uint32_t) (x)) + BSP_PRV_HEAP_ALIGN - 1U) & BSP_PRV_HEAP_SIZE_MASK)
+
+/***********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+
+/* Block header. Blocks are contiguous in a region and end with a zero size sentinel block that is never free. */
+typedef struct st_bsp_prv_heap_block
+{
+    struct st_bsp_prv_heap_block * p_prev_phys; // Physically previous block, NULL for the first block of a region
+    uint32_t                       size;        // Payload size in bytes, BSP_PRV_HEAP_BLOCK_FREE in bit 0
+
+    /* Free list links, only valid while the block is free. */
+    struct st_bsp_prv_heap_block * p_next_free;
+    struct st_bsp_prv_heap_block * p_prev_free;
+} bsp_prv_heap_block_t;
+
+/* Region control block, stored at the start of the region. A bit is set in fl_bitmap and sl_bitmap when the
+ * matching free list is not empty, so a suitable list is found with two bit scans. */
+typedef struct st_bsp_prv_heap_control
+{
+    uint32_t               fl_bitmap;
+    uint8_t                sl_bitmap[BSP_PRV_HEAP_FL_COUNT];
+    bsp_prv_heap_block_t * p_free[BSP_PRV_HEAP_FL_COUNT][BSP_PRV_HEAP_SL_COUNT];
+    uint8_t              * p_first;
+    uint8_t              * p_end;
+    uint32_t               attributes;
+    uint32_t               total_bytes;
+    uint32_t               free_bytes;
+    uint32_t               min_free_bytes;
+    uint32_t               alloc_count;
+    uint32_t               fail_count;
+} bsp_prv_heap_control_t;
+
+/***********************************************************************************************************************
+ * Private function prototypes
+ **********************************************************************************************************************/
+static void                   bsp_prv_heap_init(void);
+static fsp_err_t              bsp_prv_heap_region_init(void * const p_start, uint32_t size, uint32_t const attributes);
+static bsp_prv_heap_control_t * bsp_prv_heap_region_find(void const * const p_block);
+static void                   bsp_prv_heap_mapping(uint32_t size, uint32_t * p_fl, uint32_t * p_sl);
+static void                   bsp_prv_heap_list_insert(bsp_prv_heap_control_t * p_ctrl, bsp_prv_heap_block_t * p_block);
+static void                   bsp_prv_heap_list_remove(bsp_prv_heap_control_t * p_ctrl, bsp_prv_heap_block_t * p_block);
+static void                 * bsp_prv_heap_region_alloc(bsp_prv_heap_control_t * p_ctrl, uint32_t size);
+static void                   bsp_prv_heap_region_free(bsp_prv_heap_control_t * p_ctrl, bsp_prv_heap_block_t * p_block);
+
+/***********************************************************************************************************************
+ * Exported global variables (to be accessed by other files)
+ **********************************************************************************************************************/
+ #if (BSP_CFG_HEAP_BYTES > 0)
+extern uint8_t g_heap[BSP_CFG_HEAP_BYTES];
+ #endif
+
+/***********************************************************************************************************************
+ * Private global variables and functions
+ **********************************************************************************************************************/
+static bsp_prv_heap_control_t * gp_bsp_heap_region[BSP_CFG_HEAP_REGION_MAX];
+static uint32_t                 g_bsp_heap_region_count = 0U;
+static bool                     g_bsp_heap_initialized  = false;
+
+/*******************************************************************************************************************//**
+ * @addtogroup BSP_MCU
+ * @{
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * Add a memory area to the TLSF heap. Regions are searched in the order they are added, after the BSP heap.
+ *
+ * @param[in]  p_start     Start of the memory area. It is aligned up to 8 bytes.
+ * @param[in]  size        Size of the memory area in bytes. About 800 bytes are used for the region control block.
+ * @param[in]  attributes  BSP_HEAP_ATTRIBUTE_* bits describing the memory, used to select a region in
+ *                         R_BSP_HeapAlloc().
+ *
+ * @retval FSP_SUCCESS             The region was added.
+ * @retval FSP_ERR_ASSERTION       p_start is NULL.
+ * @retval FSP_ERR_OUT_OF_MEMORY   BSP_CFG_HEAP_REGION_MAX regions have already been added.
+ * @retval FSP_ERR_INVALID_SIZE    The region is too small for the control block or larger than 256 MB.
+ **********************************************************************************************************************/
+fsp_err_t R_BSP_HeapRegionAdd (void * const p_start, uint32_t const size, uint32_t const attributes)
+{
+ #if BSP_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_start);
+ #endif
+
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+
+    bsp_prv_heap_init();
+
+    fsp_err_t err = bsp_prv_heap_region_init(p_start, size, attributes);
+
+    FSP_CRITICAL_SECTION_EXIT;
+
+    return err;
+}
+
+/*******************************************************************************************************************//**
+ * Allocate a block from the first region that has all of the requested attributes. Allocation takes constant time
+ * and runs with interrupts masked, so it may be used from an ISR.
+ *
+ * @param[in]  size        Number of bytes to allocate.
+ * @param[in]  attributes  Required BSP_HEAP_ATTRIBUTE_* bits. 0 accepts any region.
+ *
+ * @return 8-byte aligned pointer to the block, or NULL if no matching region has a large enough free block.
+ **********************************************************************************************************************/
+void * R_BSP_HeapAlloc (size_t size, uint32_t attributes)
+{
+    void * p_block = NULL;
+
+    if (size < BSP_PRV_HEAP_ALLOC_MAX)
+    {
+        uint32_t block_size = BSP_PRV_HEAP_ALIGN_UP(size);
+        if (block_size < BSP_PRV_HEAP_PAYLOAD_MIN)
+        {
+            block_size = BSP_PRV_HEAP_PAYLOAD_MIN;
+        }
+
+        FSP_CRITICAL_SECTION_DEFINE;
+        FSP_CRITICAL_SECTION_ENTER;
+
+        bsp_prv_heap_init();
+
+        for (uint32_t i = 0U; (i < g_bsp_heap_region_count) && (NULL == p_block); i++)
+        {
+            if ((gp_bsp_heap_region[i]->attributes & attributes) == attributes)
+            {
+                p_block = bsp_prv_heap_region_alloc(gp_bsp_heap_region[i], block_size);
+            }
+        }
+
+ #if BSP_CFG_MONITOR_ENABLE
+
+        /* The block may be larger than requested when the remainder was too small to split off. */
+        if (NULL != p_block)
+        {
+            block_size = ((bsp_prv_heap_block_t *) ((uint8_t *) p_block - BSP_PRV_HEAP_HEADER_BYTES))->size;
+        }
+
+        bsp_monitor_heap_alloc((uint32_t) size, block_size, NULL != p_block);
+ #endif
+
+        FSP_CRITICAL_SECTION_EXIT;
+    }
+
+    return p_block;
+}
+
+/*******************************************************************************************************************//**
+ * Allocate a zero initialized array from a BSP_HEAP_ATTRIBUTE_DEFAULT region. This function has the signature of the
+ * standard calloc, so it can be passed to mbedtls_platform_set_calloc_free() together with R_BSP_HeapFree().
+ *
+ * @param[in]  count  Number of elements.
+ * @param[in]  size   Size of each element in bytes.
+ *
+ * @return Pointer to the zeroed block, or NULL if it cannot be allocated or count * size overflows.
+ **********************************************************************************************************************/
+void * R_BSP_HeapCalloc (size_t count, size_t size)
+{
+    if ((0U != size) && (count > (SIZE_MAX / size)))
+    {
+        return NULL;
+    }
+
+    void * p_block = R_BSP_HeapAlloc(count * size, BSP_HEAP_ATTRIBUTE_DEFAULT);
+
+    if (NULL != p_block)
+    {
+        memset(p_block, 0, count * size);
+    }
+
+    return p_block;
+}
+
+/*******************************************************************************************************************//**
+ * Resize a block. A new block is allocated from a region with the same attributes as the one holding p_block, unless
+ * the existing block is already large enough.
+ *
+ * @param[in]  p_block  Block to resize. If NULL, a block is allocated from a BSP_HEAP_ATTRIBUTE_DEFAULT region.
+ * @param[in]  size     New size in bytes. If 0, p_block is freed and NULL is returned.
+ *
+ * @return Pointer to the resized block, or NULL if it cannot be allocated. p_block is not freed in that case.
+ **********************************************************************************************************************/
+void * R_BSP_HeapRealloc (void * p_block, size_t size)
+{
+    if (NULL == p_block)
+    {
+        return R_BSP_HeapAlloc(size, BSP_HEAP_ATTRIBUTE_DEFAULT);
+    }
+
+    if (0U == size)
+    {
+        R_BSP_HeapFree(p_block);
+
+        return NULL;
+    }
+
+    /* Blocks are never moved between regions while allocated, so the header can be read without the lock. */
+    bsp_prv_heap_control_t * p_ctrl = bsp_prv_heap_region_find(p_block);
+    if (NULL == p_ctrl)
+    {
+        return NULL;
+    }
+
+    bsp_prv_heap_block_t * p_header  = (bsp_prv_heap_block_t *) ((uint8_t *) p_block - BSP_PRV_HEAP_HEADER_BYTES);
+    uint32_t               available = p_header->size & BSP_PRV_HEAP_SIZE_MASK;
+    if (size <= available)
+    {
+        return p_block;
+    }
+
+    void * p_new = R_BSP_HeapAlloc(size, p_ctrl->attributes);
+    if (NULL != p_new)
+    {
+        memcpy(p_new, p_block, available);
+        R_BSP_HeapFree(p_block);
+    }
+
+    return p_new;
+}
+
+/*******************************************************************************************************************//**
+ * Free a block allocated from the TLSF heap. It is merged with free neighboring blocks in constant time.
+ *
+ * @param[in]  p_block  Block to free. NULL, pointers outside every region and blocks that are already free are ignored.
+ **********************************************************************************************************************/
+void R_BSP_HeapFree (void * p_block)
+{
+    if (NULL == p_block)
+    {
+        return;
+    }
+
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+
+    bsp_prv_heap_control_t * p_ctrl = bsp_prv_heap_region_find(p_block);
+    if (NULL != p_ctrl)
+    {
+        bsp_prv_heap_block_t * p_header = (bsp_prv_heap_block_t *) ((uint8_t *) p_block - BSP_PRV_HEAP_HEADER_BYTES);
+        if (0U == (p_header->size & BSP_PRV_HEAP_BLOCK_FREE))
+        {
+ #if BSP_CFG_MONITOR_ENABLE
+            bsp_monitor_heap_free(p_header->size);
+ #endif
+            bsp_prv_heap_region_free(p_ctrl, p_header);
+        }
+    }
+
+    FSP_CRITICAL_SECTION_EXIT;
+}
+
+/*******************************************************************************************************************//**
+ * Get the usage statistics of a heap region.
+ *
+ * @param[in]  region   Region index. The BSP heap is region 0 when BSP_CFG_HEAP_BYTES is not 0.
+ * @param[out] p_stats  Statistics of the region.
+ *
+ * @retval FSP_SUCCESS             Statistics stored in p_stats.
+ * @retval FSP_ERR_ASSERTION       p_stats is NULL.
+ * @retval FSP_ERR_INVALID_ARGUMENT  The region does not exist.
+ **********************************************************************************************************************/
+fsp_err_t R_BSP_HeapStatsGet (uint32_t const region, bsp_heap_stats_t * const p_stats)
+{
+ #if BSP_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_stats);
+ #endif
+
+    fsp_err_t err = FSP_ERR_INVALID_ARGUMENT;
+
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+
+    bsp_prv_heap_init();
+
+    if (region < g_bsp_heap_region_count)
+    {
+        bsp_prv_heap_control_t * p_ctrl = gp_bsp_heap_region[region];
+
+        p_stats->total_bytes        = p_ctrl->total_bytes;
+        p_stats->free_bytes         = p_ctrl->free_bytes;
+        p_stats->min_free_bytes     = p_ctrl->min_free_bytes;
+        p_stats->alloc_count        = p_ctrl->alloc_count;
+        p_stats->fail_count         = p_ctrl->fail_count;
+        p_stats->largest_free_bytes = 0U;
+
+        /* The largest free block is in the highest non-empty list. Only that list has to be searched. */
+        if (0U != p_ctrl->fl_bitmap)
+        {
+            uint32_t               fl      = 31U - __CLZ(p_ctrl->fl_bitmap);
+            uint32_t               sl      = 31U - __CLZ(p_ctrl->sl_bitmap[fl]);
+            bsp_prv_heap_block_t * p_block = p_ctrl->p_free[fl][sl];
+
+            while (NULL != p_block)
+            {
+                uint32_t size = p_block->size & BSP_PRV_HEAP_SIZE_MASK;
+                if (size > p_stats->largest_free_bytes)
+                {
+                    p_stats->largest_free_bytes = size;
+                }
+
+                p_block = p_block->p_next_free;
+            }
+        }
+
+        err = FSP_SUCCESS;
+    }
+
+    FSP_CRITICAL_SECTION_EXIT;
+
+    return err;
+}
+
+/** @} (end addtogroup BSP_MCU) */
+
+ #if defined(__GNUC__) && !defined(__ARMCC_VERSION)
+
+/* Serve the newlib allocator entry points from the TLSF heap. The reentrant versions are used by newlib itself. */
+void * malloc (size_t size)
+{
+    return R_BSP_HeapAlloc(size, BSP_HEAP_ATTRIBUTE_DEFAULT);
+}
+
+void free (void * p_block)
+{
+    R_BSP_HeapFree(p_block);
+}
+
+void * calloc (size_t count, size_t size)
+{
+    return R_BSP_HeapCalloc(count, size);
+}
+
+void * realloc (void * p_block, size_t size)
+{
+    return R_BSP_HeapRealloc(p_block, size);
+}
+
+void * _malloc_r (struct _reent * p_reent, size_t size)
+{
+    FSP_PARAMETER_NOT_USED(p_reent);
+
+    return R_BSP_HeapAlloc(size, BSP_HEAP_ATTRIBUTE_DEFAULT);
+}
+
+void _free_r (struct _reent * p_reent, void * p_block)
+{
+    FSP_PARAMETER_NOT_USED(p_reent);
+
+    R_BSP_HeapFree(p_block);
+}
+
+void * _calloc_r (struct _reent * p_reent, size_t count, size_t size)
+{
+    FSP_PARAMETER_NOT_USED(p_reent);
+
+    return R_BSP_HeapCalloc(count, size);
+}
+
+void * _realloc_r (struct _reent * p_reent, void * p_block, size_t size)
+{
+    FSP_PARAMETER_NOT_USED(p_reent);
+
+    return R_BSP_HeapRealloc(p_block, size);
+}
+
+ #endif
+
+/*******************************************************************************************************************//**
+ * Add the BSP heap as region 0 on first use. Must be called with interrupts masked.
+ **********************************************************************************************************************/
+static void bsp_prv_heap_init (void)
+{
+    if (!g_bsp_heap_initialized)
+    {
+        g_bsp_heap_initialized = true;
+
+ #if (BSP_CFG_HEAP_BYTES > 0)
+        (void) bsp_prv_heap_region_init(&g_heap[0], BSP_CFG_HEAP_BYTES, BSP_CFG_HEAP_ATTRIBUTES);
+ #endif
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Place a control block at the start of a memory area and make the rest of it one free block.
+ *
+ * @param[in]  p_start     Start of the memory area.
+ * @param[in]  size        Size of the memory area.
+ * @param[in]  attributes  Region attributes.
+ *
+ * @retval FSP_SUCCESS             The region was added.
+ * @retval FSP_ERR_OUT_OF_MEMORY   No region slot is free.
+ * @retval FSP_ERR_INVALID_SIZE    The region is too small or too large.
+ **********************************************************************************************************************/
+static fsp_err_t bsp_prv_heap_region_init (void * const p_start, uint32_t size, uint32_t const attributes)
+{
+    FSP_ERROR_RETURN(g_bsp_heap_region_count < BSP_CFG_HEAP_REGION_MAX, FSP_ERR_OUT_OF_MEMORY);
+
+    /* Align the region, then reserve the control block and the block headers of the first and sentinel blocks. */
+    uint32_t start    = BSP_PRV_HEAP_ALIGN_UP(p_start);
+    uint32_t overhead = (start - (uint32_t) p_start) + BSP_PRV_HEAP_ALIGN_UP(sizeof(bsp_prv_heap_control_t)) +
+                        (2U * BSP_PRV_HEAP_HEADER_BYTES);
+    FSP_ERROR_RETURN(size >= (overhead + BSP_PRV_HEAP_PAYLOAD_MIN), FSP_ERR_INVALID_SIZE);
+
+    uint32_t payload = (size - overhead) & BSP_PRV_HEAP_SIZE_MASK;
+    FSP_ERROR_RETURN(payload < BSP_PRV_HEAP_BLOCK_LIMIT, FSP_ERR_INVALID_SIZE);
+
+    bsp_prv_heap_control_t * p_ctrl = (bsp_prv_heap_control_t *) start;
+    memset(p_ctrl, 0, sizeof(bsp_prv_heap_control_t));
+
+    bsp_prv_heap_block_t * p_block = (bsp_prv_heap_block_t *) (start +
+                                                                BSP_PRV_HEAP_ALIGN_UP(sizeof(bsp_prv_heap_control_t)));
+    p_block->p_prev_phys = NULL;
+    p_block->size        = payload | BSP_PRV_HEAP_BLOCK_FREE;
+
+    bsp_prv_heap_block_t * p_sentinel =
+        (bsp_prv_heap_block_t *) ((uint8_t *) p_block + BSP_PRV_HEAP_HEADER_BYTES + payload);
+    p_sentinel->p_prev_phys = p_block;
+    p_sentinel->size        = 0U;
+
+    p_ctrl->p_first    = (uint8_t *) p_block;
+    p_ctrl->p_end      = (uint8_t *) p_sentinel;
+    p_ctrl->attributes = attributes;
+
+    /* Block headers of free blocks are counted as free memory, because they are released when blocks merge. */
+    p_ctrl->total_bytes    = payload + BSP_PRV_HEAP_HEADER_BYTES;
+    p_ctrl->free_bytes     = p_ctrl->total_bytes;
+    p_ctrl->min_free_bytes = p_ctrl->total_bytes;
+
+    bsp_prv_heap_list_insert(p_ctrl, p_block);
+
+    gp_bsp_heap_region[g_bsp_heap_region_count] = p_ctrl;
+    g_bsp_heap_region_count++;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Find the region holding a block.
+ *
+ * @param[in]  p_block  Payload pointer of the block.
+ *
+ * @return Region control block, or NULL if p_block is not in any region.
+ **********************************************************************************************************************/
+static bsp_prv_heap_control_t * bsp_prv_heap_region_find (void const * const p_block)
+{
+    uint8_t const * p_addr = (uint8_t const *) p_block;
+
+    for (uint32_t i = 0U; i < g_bsp_heap_region_count; i++)
+    {
+        bsp_prv_heap_control_t * p_ctrl = gp_bsp_heap_region[i];
+        if ((p_addr > p_ctrl->p_first) && (p_addr < p_ctrl->p_end))
+        {
+            return p_ctrl;
+        }
+    }
+
+    return NULL;
+}
+
+/*******************************************************************************************************************//**
+ * Get the free list indexes of a block size.
+ *
+ * @param[in]  size  Payload size, a multiple of 8.
+ * @param[out] p_fl  First level index.
+ * @param[out] p_sl  Second level index.
+ **********************************************************************************************************************/
+static void bsp_prv_heap_mapping (uint32_t size, uint32_t * p_fl, uint32_t * p_sl)
+{
+    if (size < BSP_PRV_HEAP_SMALL_BLOCK)
+    {
+        *p_fl = 0U;
+        *p_sl = size >> BSP_PRV_HEAP_ALIGN_LOG2;
+    }
+    else
+    {
+        uint32_t log2 = 31U - __CLZ(size);
+
+        *p_fl = log2 - BSP_PRV_HEAP_FL_SHIFT + 1U;
+        *p_sl = (size >> (log2 - BSP_PRV_HEAP_SL_LOG2)) ^ BSP_PRV_HEAP_SL_COUNT;
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Push a free block onto the free list matching its size.
+ *
+ * @param[in]  p_ctrl   Region control block.
+ * @param[in]  p_block  Free block.
+ **********************************************************************************************************************/
+static void bsp_prv_heap_list_insert (bsp_prv_heap_control_t * p_ctrl, bsp_prv_heap_block_t * p_block)
+{
+    uint32_t fl;
+    uint32_t sl;
+    bsp_prv_heap_mapping(p_block->size & BSP_PRV_HEAP_SIZE_MASK, &fl, &sl);
+
+    bsp_prv_heap_block_t * p_head = p_ctrl->p_free[fl][sl];
+    p_block->p_prev_free = NULL;
+    p_block->p_next_free = p_head;
+    if (NULL != p_head)
+    {
+        p_head->p_prev_free = p_block;
+    }
+
+    p_ctrl->p_free[fl][sl] = p_block;
+    p_ctrl->fl_bitmap     |= 1U << fl;
+    p_ctrl->sl_bitmap[fl]  = (uint8_t) (p_ctrl->sl_bitmap[fl] | (1U << sl));
+}
+
+/*******************************************************************************************************************//**
+ * Unlink a free block from its free list.
+ *
+ * @param[in]  p_ctrl   Region control block.
+ * @param[in]  p_block  Free block.
+ **********************************************************************************************************************/
+static void bsp_prv_heap_list_remove (bsp_prv_heap_control_t * p_ctrl, bsp_prv_heap_block_t * p_block)
+{
+    uint32_t fl;
+    uint32_t sl;
+    bsp_prv_heap_mapping(p_block->size & BSP_PRV_HEAP_SIZE_MASK, &fl, &sl);
+
+    if (NULL != p_block->p_next_free)
+    {
+        p_block->p_next_free->p_prev_free = p_block->p_prev_free;
+    }
+
+    if (NULL != p_block->p_prev_free)
+    {
+        p_block->p_prev_free->p_next_free = p_block->p_next_free;
+    }
+    else
+    {
+        p_ctrl->p_free[fl][sl] = p_block->p_next_free;
+        if (NULL == p_block->p_next_free)
+        {
+            p_ctrl->sl_bitmap[fl] = (uint8_t) (p_ctrl->sl_bitmap[fl] & ~(1U << sl));
+            if (0U == p_ctrl->sl_bitmap[fl])
+            {
+                p_ctrl->fl_bitmap &= ~(1U << fl);
+            }
+        }
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Allocate a block from a region. The size is rounded up to the start of the next second level range, so the first
+ * block of any list at or above that range is large enough and no list has to be searched.
+ *
+ * @param[in]  p_ctrl  Region control block.
+ * @param[in]  size    Payload size, a multiple of 8 and at least BSP_PRV_HEAP_PAYLOAD_MIN.
+ *
+ * @return Payload pointer, or NULL if the region has no large enough free block.
+ **********************************************************************************************************************/
+static void * bsp_prv_heap_region_alloc (bsp_prv_heap_control_t * p_ctrl, uint32_t size)
+{
+    uint32_t search = size;
+    if (search >= BSP_PRV_HEAP_SMALL_BLOCK)
+    {
+        search += (1U << ((31U - __CLZ(search)) - BSP_PRV_HEAP_SL_LOG2)) - 1U;
+    }
+
+    uint32_t fl;
+    uint32_t sl;
+    bsp_prv_heap_mapping(search, &fl, &sl);
+
+    /* Find the first non-empty list in this first level at or above sl, otherwise in the next non-empty first
+     * level. */
+    uint32_t sl_map = (fl < BSP_PRV_HEAP_FL_COUNT) ? (p_ctrl->sl_bitmap[fl] & (UINT32_MAX << sl)) : 0U;
+    if (0U == sl_map)
+    {
+        uint32_t fl_map = ((fl + 1U) < BSP_PRV_HEAP_FL_COUNT) ? (p_ctrl->fl_bitmap & (UINT32_MAX << (fl + 1U))) : 0U;
+        if (0U == fl_map)
+        {
+            p_ctrl->fail_count++;
+
+            return NULL;
+        }
+
+        fl     = __CLZ(__RBIT(fl_map));
+        sl_map = p_ctrl->sl_bitmap[fl];
+    }
+
+    sl = __CLZ(__RBIT(sl_map));
+
+    bsp_prv_heap_block_t * p_block = p_ctrl->p_free[fl][sl];
+    bsp_prv_heap_list_remove(p_ctrl, p_block);
+
+    /* Return the end of the block to the free lists if it can hold a block of its own. */
+    uint32_t block_size = p_block->size & BSP_PRV_HEAP_SIZE_MASK;
+    if (block_size >= (size + BSP_PRV_HEAP_HEADER_BYTES + BSP_PRV_HEAP_PAYLOAD_MIN))
+    {
+        bsp_prv_heap_block_t * p_rest =
+            (bsp_prv_heap_block_t *) ((uint8_t *) p_block + BSP_PRV_HEAP_HEADER_BYTES + size);
+        p_rest->p_prev_phys = p_block;
+        p_rest->size        = (block_size - size - BSP_PRV_HEAP_HEADER_BYTES) | BSP_PRV_HEAP_BLOCK_FREE;
+
+        bsp_prv_heap_block_t * p_next =
+            (bsp_prv_heap_block_t *) ((uint8_t *) p_block + BSP_PRV_HEAP_HEADER_BYTES + block_size);
+        p_next->p_prev_phys = p_rest;
+
+        bsp_prv_heap_list_insert(p_ctrl, p_rest);
+        block_size = size;
+    }
+
+    p_block->size = block_size;
+
+    p_ctrl->free_bytes -= block_size + BSP_PRV_HEAP_HEADER_BYTES;
+    p_ctrl->alloc_count++;
+    if (p_ctrl->free_bytes < p_ctrl->min_free_bytes)
+    {
+        p_ctrl->min_free_bytes = p_ctrl->free_bytes;
+    }
+
+    return (uint8_t *) p_block + BSP_PRV_HEAP_HEADER_BYTES;
+}
+
+/*******************************************************************************************************************//**
+ * Free a block and merge it with its free physical neighbors.
+ *
+ * @param[in]  p_ctrl   Region control block.
+ * @param[in]  p_block  Allocated block.
+ **********************************************************************************************************************/
+static void bsp_prv_heap_region_free (bsp_prv_heap_control_t * p_ctrl, bsp_prv_heap_block_t * p_block)
+{
+    uint32_t block_size = p_block->size;
+
+    p_ctrl->free_bytes += block_size + BSP_PRV_HEAP_HEADER_BYTES;
+    p_ctrl->alloc_count--;
+
+    bsp_prv_heap_block_t * p_prev = p_block->p_prev_phys;
+    if ((NULL != p_prev) && (0U != (p_prev->size & BSP_PRV_HEAP_BLOCK_FREE)))
+    {
+        bsp_prv_heap_list_remove(p_ctrl, p_prev);
+        block_size += (p_prev->size & BSP_PRV_HEAP_SIZE_MASK) + BSP_PRV_HEAP_HEADER_BYTES;
+        p_block     = p_prev;
+    }
+
+    /* The sentinel block is never free, so this does not run past the end of the region. */
+    bsp_prv_heap_block_t * p_next =
+        (bsp_prv_heap_block_t *) ((uint8_t *) p_block + BSP_PRV_HEAP_HEADER_BYTES + block_size);
+    if (0U != (p_next->size & BSP_PRV_HEAP_BLOCK_FREE))
+    {
+        bsp_prv_heap_list_remove(p_ctrl, p_next);
+        block_size += (p_next->size & BSP_PRV_HEAP_SIZE_MASK) + BSP_PRV_HEAP_HEADER_BYTES;
+        p_next      = (bsp_prv_heap_block_t *) ((uint8_t *) p_block + BSP_PRV_HEAP_HEADER_BYTES + block_size);
+    }
+
+    p_next->p_prev_phys = p_block;
+    p_block->size       = block_size | BSP_PRV_HEAP_BLOCK_FREE;
+    bsp_prv_heap_list_insert(p_ctrl, p_block);
+}
+
+#endif
@@ -0,0 +1,101 @@
+/***********************************************************************************************************************
+ * Copyright [2020] Renesas Electronics Corporation and/or its affiliates.  All Rights Reserved.
+ *
+ * This software and documentation are supplied by Renesas Electronics America Inc. and may only be used with products
+ * of Renesas Electronics Corp. and its affiliates ("Renesas").  No other uses are authorized.  Renesas products are
+ * sold pursuant to Renesas terms and conditions of sale.  Purchasers are solely responsible for the selection and use
+ * of Renesas products and Renesas assumes no liability.  No license, express or implied, to any intellectual property
+ * right is granted by Renesas. This software is protected under all applicable laws, including copyright laws. Renesas
+ * reserves the right to change or discontinue this software and/or this documentation. THE SOFTWARE AND DOCUMENTATION
+ * IS DELIVERED TO YOU "AS IS," AND RENESAS MAKES NO REPRESENTATIONS OR WARRANTIES, AND TO THE FULLEST EXTENT
+ * PERMISSIBLE UNDER APPLICABLE LAW, DISCLAIMS ALL WARRANTIES, WHETHER EXPLICITLY OR IMPLICITLY, INCLUDING WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, AND NONINFRINGEMENT, WITH RESPECT TO THE SOFTWARE OR
+ * DOCUMENTATION.  RENESAS SHALL HAVE NO LIABILITY ARISING OUT OF ANY SECURITY VULNERABILITY OR BREACH.  TO THE MAXIMUM
+ * EXTENT PERMITTED BY LAW, IN NO EVENT WILL RENESAS BE LIABLE TO YOU IN CONNECTION WITH THE SOFTWARE OR DOCUMENTATION
+ * (OR ANY PERSON OR ENTITY CLAIMING RIGHTS DERIVED FROM YOU) FOR ANY LOSS, DAMAGES, OR CLAIMS WHATSOEVER, INCLUDING,
+ * WITHOUT LIMITATION, ANY DIRECT, CONSEQUENTIAL, SPECIAL, INDIRECT, PUNITIVE, OR INCIDENTAL DAMAGES; ANY LOST PROFITS,
+ * OTHER ECONOMIC DAMAGE, PROPERTY DAMAGE, OR PERSONAL INJURY; AND EVEN IF RENESAS HAS BEEN ADVISED OF THE POSSIBILITY
+ * OF SUCH LOSS, DAMAGES, CLAIMS OR COSTS.
+ **********************************************************************************************************************/
+
+#ifndef BSP_HEAP_H
+#define BSP_HEAP_H
+
+/***********************************************************************************************************************
+ * Includes   <System Includes> , "Project Includes"
+ **********************************************************************************************************************/
+#include <stddef.h>
+
+/** Common macro for FSP header files. There is also a corresponding FSP_FOOTER macro at the end of this file. */
+FSP_HEADER
+
+/*******************************************************************************************************************//**
+ * @addtogroup BSP_MCU
+ * @{
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+
+/** Set BSP_CFG_HEAP_TLSF_ENABLE to 1 to manage the heap with a two level segregated fit (TLSF) allocator. Allocation
+ * and free take constant time and adjacent free blocks are merged immediately. The BSP heap (BSP_CFG_HEAP_BYTES) is
+ * region 0 and further regions can be added with R_BSP_HeapRegionAdd(). With GCC, malloc, calloc, realloc and free
+ * are served from the regions with the BSP_HEAP_ATTRIBUTE_DEFAULT attribute instead of _sbrk. */
+#ifndef BSP_CFG_HEAP_TLSF_ENABLE
+ #define BSP_CFG_HEAP_TLSF_ENABLE           (0)
+#endif
+
+/** Maximum number of heap regions, including the BSP heap. */
+#ifndef BSP_CFG_HEAP_REGION_MAX
+ #define BSP_CFG_HEAP_REGION_MAX            (4U)
+#endif
+
+/** Attributes of the BSP heap (region 0). On-chip SRAM is accessible by the DMAC and DTC. */
+#ifndef BSP_CFG_HEAP_ATTRIBUTES
+ #define BSP_CFG_HEAP_ATTRIBUTES            (BSP_HEAP_ATTRIBUTE_DEFAULT | BSP_HEAP_ATTRIBUTE_DMA)
+#endif
+
+/** Region attributes. An allocation is served from the first region that has every requested attribute. Bits from
+ * BSP_HEAP_ATTRIBUTE_USER upwards are free for application defined attributes. */
+#define BSP_HEAP_ATTRIBUTE_DEFAULT          (1U << 0) ///< Used by malloc and the other standard library functions
+#define BSP_HEAP_ATTRIBUTE_DMA              (1U << 1) ///< Accessible by the DMAC, DTC and bus master peripherals
+#define BSP_HEAP_ATTRIBUTE_FAST             (1U << 2) ///< Zero wait state memory such as SRAMHS
+#define BSP_HEAP_ATTRIBUTE_EXTERNAL         (1U << 3) ///< External memory such as SDRAM
+#define BSP_HEAP_ATTRIBUTE_USER             (1U << 8)
+
+/***********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+
+/** Usage statistics of a heap region. */
+typedef struct st_bsp_heap_stats
+{
+    uint32_t total_bytes;              ///< Bytes available for allocation when the region is empty
+    uint32_t free_bytes;               ///< Bytes currently free, including block headers
+    uint32_t min_free_bytes;           ///< Lowest value of free_bytes since the region was added
+    uint32_t largest_free_bytes;       ///< Size of the largest free block, a measure of fragmentation
+    uint32_t alloc_count;              ///< Number of blocks currently allocated
+    uint32_t fail_count;               ///< Number of allocations that could not be served by this region
+} bsp_heap_stats_t;
+
+/** @} (end addtogroup BSP_MCU) */
+
+/***********************************************************************************************************************
+ * Exported global variables
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Exported global functions (to be accessed by other files)
+ **********************************************************************************************************************/
+fsp_err_t R_BSP_HeapRegionAdd(void * const p_start, uint32_t const size, uint32_t const attributes);
+void    * R_BSP_HeapAlloc(size_t size, uint32_t attributes);
+void    * R_BSP_HeapCalloc(size_t count, size_t size);
+void    * R_BSP_HeapRealloc(void * p_block, size_t size);
+void      R_BSP_HeapFree(void * p_block);
+fsp_err_t R_BSP_HeapStatsGet(uint32_t const region, bsp_heap_stats_t * const p_stats);
+
+/** Common macro for FSP header files. There is also a corresponding FSP_HEADER macro at the top of this file. */
+FSP_FOOTER
+
+#endif
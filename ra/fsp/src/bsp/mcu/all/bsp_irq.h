@@ -31,6 +31,19 @@ FSP_HEADER
  **********************************************************************************************************************/
 #define BSP_ICU_VECTOR_MAX_ENTRIES    (BSP_VECTOR_TABLE_MAX_ENTRIES - BSP_CORTEX_VECTOR_TABLE_ENTRIES)
 
+/* Set BSP_CFG_RAM_VECTOR_TABLE_ENABLE to 1 to copy the vector table to RAM at startup and to execute ISRs declared with
+ * BSP_ISR_IN_RAM from RAM. This removes flash wait states from interrupt entry. */
+#ifndef BSP_CFG_RAM_VECTOR_TABLE_ENABLE
+ #define BSP_CFG_RAM_VECTOR_TABLE_ENABLE    (0)
+#endif
+
+/** Attribute for latency critical ISRs. They are placed in RAM if BSP_CFG_RAM_VECTOR_TABLE_ENABLE is set. */
+#if BSP_CFG_RAM_VECTOR_TABLE_ENABLE
+ #define BSP_ISR_IN_RAM                     BSP_PLACE_IN_RAM
+#else
+ #define BSP_ISR_IN_RAM
+#endif
+
 /***********************************************************************************************************************
  * Typedef definitions
  **********************************************************************************************************************/
@@ -0,0 +1,562 @@
+/***********************************************************************************************************************
+ * Copyright [2020] Renesas Electronics Corporation and/or its affiliates.  All Rights Reserved.
+ *
+ * This software and documentation are supplied by Renesas Electronics America Inc. and may only be used with products
+ * of Renesas Electronics Corp. and its affiliates ("Renesas").  No other uses are authorized.  Renesas products are
+ * sold pursuant to Renesas terms and conditions of sale.  Purchasers are solely responsible for the selection and use
+ * of Renesas products and Renesas assumes no liability.  No license, express or implied, to any intellectual property
+ * right is granted by Renesas. This software is protected under all applicable laws, including copyright laws. Renesas
+ * reserves the right to change or discontinue this software and/or this documentation. THE SOFTWARE AND DOCUMENTATION
+ * IS DELIVERED TO YOU "AS IS," AND RENESAS MAKES NO REPRESENTATIONS OR WARRANTIES, AND TO THE FULLEST EXTENT
+ * PERMISSIBLE UNDER APPLICABLE LAW, DISCLAIMS ALL WARRANTIES, WHETHER EXPLICITLY OR IMPLICITLY, INCLUDING WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, AND NONINFRINGEMENT, WITH RESPECT TO THE SOFTWARE OR
+ * DOCUMENTATION.  RENESAS SHALL HAVE NO LIABILITY ARISING OUT OF ANY SECURITY VULNERABILITY OR BREACH.  TO THE MAXIMUM
+ * EXTENT PERMITTED BY LAW, IN NO EVENT WILL RENESAS BE LIABLE TO YOU IN CONNECTION WITH THE SOFTWARE OR DOCUMENTATION
+ * (OR ANY PERSON OR ENTITY CLAIMING RIGHTS DERIVED FROM YOU) FOR ANY LOSS, DAMAGES, OR CLAIMS WHATSOEVER, INCLUDING,
+ * WITHOUT LIMITATION, ANY DIRECT, CONSEQUENTIAL, SPECIAL, INDIRECT, PUNITIVE, OR INCIDENTAL DAMAGES; ANY LOST PROFITS,
+ * OTHER ECONOMIC DAMAGE, PROPERTY DAMAGE, OR PERSONAL INJURY; AND EVEN IF RENESAS HAS BEEN ADVISED OF THE POSSIBILITY
+ * OF SUCH LOSS, DAMAGES, CLAIMS OR COSTS.
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Includes   <System Includes> , "Project Includes"
+ **********************************************************************************************************************/
+#include <stdarg.h>
+#include <stdio.h>
+#include "bsp_api.h"
+
+/***********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+
+/* The first histogram bucket holds durations below 2^6 cycles and each following bucket is 4 times wider. */
+#define BSP_PRV_LATENCY_BUCKET_LOG2_MIN    (6U)
+
+#if BSP_CFG_LATENCY_MEASURE_ENABLE
+ #if !BSP_FEATURE_DWT_CYCCNT
+  #error "BSP_CFG_LATENCY_MEASURE_ENABLE requires the DWT cycle counter, which is not available on this MCU."
+ #endif
+
+/* ISRs can only be nested as deep as the number of NVIC priority levels. */
+ #define BSP_PRV_LATENCY_NEST_MAX           (1U << __NVIC_PRIO_BITS)
+
+/* Fetch benchmark: passes timed per memory, and the instructions in one pass of the loop (12 moves, sub, cmp, bne). */
+ #define BSP_PRV_LATENCY_FETCH_LOOPS                 (64U)
+ #define BSP_PRV_LATENCY_FETCH_LOOP_INSTRUCTIONS     (15U)
+
+/* MEMWAIT value selecting two ROM wait cycles. */
+ #define BSP_PRV_LATENCY_MEMWAIT_TWO_WAITS           (1U)
+
+/* Straight-line 16-bit instructions with no data accesses, so the loop speed is limited by instruction fetch. */
+ #define BSP_PRV_LATENCY_FETCH_MOVES    "   mov r1, r0          \n" \
+    "   mov r1, r0          \n"                                    \
+    "   mov r1, r0          \n"                                    \
+    "   mov r1, r0          \n"
+
+ #if defined(__ICCARM__) || defined(__ARMCC_VERSION)
+  #define BSP_PRV_LATENCY_FETCH_DECREMENT    "   subs r0, #1         \n"
+ #elif defined(__GNUC__)
+  #define BSP_PRV_LATENCY_FETCH_DECREMENT    "   sub r0, r0, #1      \n"
+ #endif
+
+/* CM0 and CM23 have a different instruction set */
+ #if defined(__CORE_CM0PLUS_H_GENERIC) || defined(__CORE_CM23_H_GENERIC)
+  #define BSP_PRV_LATENCY_FETCH_BRANCH(label)    "   bne " label "  \n"
+ #else
+  #define BSP_PRV_LATENCY_FETCH_BRANCH(label)    "   bne.n " label "\n"
+ #endif
+
+/***********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Private function prototypes
+ **********************************************************************************************************************/
+static uint32_t bsp_prv_latency_fetch_time(void (* p_loop)(uint32_t));
+BSP_ATTRIBUTE_STACKLESS static void bsp_prv_latency_fetch_flash(uint32_t loop_cnt);
+BSP_ATTRIBUTE_STACKLESS static void bsp_prv_latency_fetch_sram(uint32_t loop_cnt) BSP_PLACE_IN_RAM;
+
+/***********************************************************************************************************************
+ * Exported global variables (to be accessed by other files)
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Private global variables and functions
+ **********************************************************************************************************************/
+static bsp_latency_stats_t g_bsp_latency_isr_stats[BSP_ICU_VECTOR_MAX_ENTRIES];
+static bsp_latency_stats_t g_bsp_latency_api_stats[BSP_CFG_LATENCY_API_SLOTS];
+
+/* Entry time stamps of the ISRs currently active, and the cycles spent in ISRs that preempted them. */
+static uint32_t g_bsp_latency_isr_start[BSP_PRV_LATENCY_NEST_MAX];
+static uint32_t g_bsp_latency_isr_nested[BSP_PRV_LATENCY_NEST_MAX];
+static uint32_t g_bsp_latency_isr_depth = 0U;
+
+/* Cycle count at the most recent entry of each vector. */
+static uint32_t g_bsp_latency_isr_entry[BSP_ICU_VECTOR_MAX_ENTRIES];
+
+/*******************************************************************************************************************//**
+ * @addtogroup BSP_MCU
+ * @{
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * Records the entry time of the current ISR. Called from FSP_CONTEXT_SAVE when BSP_CFG_LATENCY_MEASURE_ENABLE is set.
+ **********************************************************************************************************************/
+void R_BSP_LatencyIsrEnter (void)
+{
+    uint32_t  now = DWT->CYCCNT;
+    IRQn_Type irq = R_FSP_CurrentIrqGet();
+
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+
+    if ((irq >= (IRQn_Type) 0) && ((uint32_t) irq < BSP_ICU_VECTOR_MAX_ENTRIES))
+    {
+        g_bsp_latency_isr_entry[irq] = now;
+    }
+
+    if (g_bsp_latency_isr_depth < BSP_PRV_LATENCY_NEST_MAX)
+    {
+        g_bsp_latency_isr_nested[g_bsp_latency_isr_depth] = 0U;
+        g_bsp_latency_isr_start[g_bsp_latency_isr_depth]  = DWT->CYCCNT;
+    }
+
+    g_bsp_latency_isr_depth++;
+
+    __set_PRIMASK(primask);
+}
+
+/*******************************************************************************************************************//**
+ * Records the duration of the current ISR in the statistics of its vector. Called from FSP_CONTEXT_RESTORE when
+ * BSP_CFG_LATENCY_MEASURE_ENABLE is set.
+ *
+ * The time spent in ISRs that preempted the current ISR is not included in its duration.
+ **********************************************************************************************************************/
+void R_BSP_LatencyIsrExit (void)
+{
+    uint32_t  now = DWT->CYCCNT;
+    IRQn_Type irq = R_FSP_CurrentIrqGet();
+
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+
+    if (g_bsp_latency_isr_depth > 0U)
+    {
+        g_bsp_latency_isr_depth--;
+
+        if (g_bsp_latency_isr_depth < BSP_PRV_LATENCY_NEST_MAX)
+        {
+            uint32_t elapsed = now - g_bsp_latency_isr_start[g_bsp_latency_isr_depth];
+
+            /* Charge the whole duration of this ISR to the ISR it preempted, if any. */
+            if (g_bsp_latency_isr_depth > 0U)
+            {
+                g_bsp_latency_isr_nested[g_bsp_latency_isr_depth - 1U] += elapsed;
+            }
+
+            if ((irq >= (IRQn_Type) 0) && ((uint32_t) irq < BSP_ICU_VECTOR_MAX_ENTRIES))
+            {
+                R_BSP_LatencyStatsRecord(&g_bsp_latency_isr_stats[irq],
+                                       elapsed - g_bsp_latency_isr_nested[g_bsp_latency_isr_depth]);
+            }
+        }
+    }
+
+    __set_PRIMASK(primask);
+}
+
+/*******************************************************************************************************************//**
+ * Records the duration of an API call. Called by BSP_LATENCY_API_MEASURE.
+ *
+ * @param[in]  slot       Statistics slot to record the duration in.
+ * @param[in]  cycles     Duration in CPU cycles.
+ **********************************************************************************************************************/
+void R_BSP_LatencyApiRecord (uint32_t slot, uint32_t cycles)
+{
+    if (slot < BSP_CFG_LATENCY_API_SLOTS)
+    {
+        uint32_t primask = __get_PRIMASK();
+        __disable_irq();
+
+        R_BSP_LatencyStatsRecord(&g_bsp_latency_api_stats[slot], cycles);
+
+        __set_PRIMASK(primask);
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Gets the duration statistics of an interrupt vector. Only ISRs that use FSP_CONTEXT_SAVE and FSP_CONTEXT_RESTORE are
+ * measured.
+ *
+ * @param[in]  irq        Interrupt vector to get the statistics for.
+ * @param[out] p_stats    Copy of the statistics.
+ *
+ * @retval FSP_SUCCESS          Statistics copied.
+ * @retval FSP_ERR_ASSERTION    p_stats is NULL or irq is not a valid interrupt vector.
+ **********************************************************************************************************************/
+fsp_err_t R_BSP_LatencyIsrStatsGet (IRQn_Type irq, bsp_latency_stats_t * p_stats)
+{
+ #if BSP_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_stats);
+    FSP_ASSERT((irq >= (IRQn_Type) 0) && ((uint32_t) irq < BSP_ICU_VECTOR_MAX_ENTRIES));
+ #endif
+
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+    *p_stats = g_bsp_latency_isr_stats[irq];
+    FSP_CRITICAL_SECTION_EXIT;
+
+    p_stats->average = (p_stats->count > 0U) ? (uint32_t) (p_stats->total / p_stats->count) : 0U;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Gets the cycle count recorded by FSP_CONTEXT_SAVE at the most recent entry of an interrupt vector. Comparing it to
+ * DWT->CYCCNT in a callback gives the time spent between the first instruction of the ISR and the callback.
+ *
+ * @param[in]  irq        Interrupt vector to get the entry time for.
+ * @param[out] p_cycles   DWT->CYCCNT value at the most recent entry.
+ *
+ * @retval FSP_SUCCESS          Entry time copied.
+ * @retval FSP_ERR_ASSERTION    p_cycles is NULL or irq is not a valid interrupt vector.
+ **********************************************************************************************************************/
+fsp_err_t R_BSP_LatencyIsrEntryGet (IRQn_Type irq, uint32_t * p_cycles)
+{
+ #if BSP_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_cycles);
+    FSP_ASSERT((irq >= (IRQn_Type) 0) && ((uint32_t) irq < BSP_ICU_VECTOR_MAX_ENTRIES));
+ #endif
+
+    *p_cycles = g_bsp_latency_isr_entry[irq];
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Gets the duration statistics of an API slot.
+ *
+ * @param[in]  slot       Statistics slot used with BSP_LATENCY_API_MEASURE.
+ * @param[out] p_stats    Copy of the statistics.
+ *
+ * @retval FSP_SUCCESS          Statistics copied.
+ * @retval FSP_ERR_ASSERTION    p_stats is NULL or slot is not less than BSP_CFG_LATENCY_API_SLOTS.
+ **********************************************************************************************************************/
+fsp_err_t R_BSP_LatencyApiStatsGet (uint32_t slot, bsp_latency_stats_t * p_stats)
+{
+ #if BSP_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_stats);
+    FSP_ASSERT(slot < BSP_CFG_LATENCY_API_SLOTS);
+ #endif
+
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+    *p_stats = g_bsp_latency_api_stats[slot];
+    FSP_CRITICAL_SECTION_EXIT;
+
+    p_stats->average = (p_stats->count > 0U) ? (uint32_t) (p_stats->total / p_stats->count) : 0U;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Clears the statistics of all interrupt vectors and API slots.
+ **********************************************************************************************************************/
+void R_BSP_LatencyStatsReset (void)
+{
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+
+    for (uint32_t i = 0U; i < BSP_ICU_VECTOR_MAX_ENTRIES; i++)
+    {
+        R_BSP_LatencyStatsClear(&g_bsp_latency_isr_stats[i]);
+    }
+
+    for (uint32_t i = 0U; i < BSP_CFG_LATENCY_API_SLOTS; i++)
+    {
+        R_BSP_LatencyStatsClear(&g_bsp_latency_api_stats[i]);
+    }
+
+    FSP_CRITICAL_SECTION_EXIT;
+}
+
+/*******************************************************************************************************************//**
+ * Measures instruction fetch performance at the current clock and wait state settings. The same loop of 16-bit
+ * instructions is timed from code flash with the current flash cache setting, from code flash with the flash cache
+ * disabled (on MCUs with a flash cache) and from SRAM. Use the results to decide which hot code to place in RAM with
+ * BSP_PLACE_IN_RAM, or whether a lower ICLK with fewer flash wait states runs flash code as fast.
+ *
+ * Interrupts are disabled for the duration of the measurement, which takes a few thousand cycles.
+ *
+ * @param[out] p_fetch         Pointer to store the results.
+ *
+ * @retval FSP_SUCCESS         Results stored in p_fetch.
+ * @retval FSP_ERR_ASSERTION   p_fetch is NULL.
+ **********************************************************************************************************************/
+fsp_err_t R_BSP_LatencyFetchBenchmark (bsp_latency_fetch_t * p_fetch)
+{
+ #if BSP_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_fetch);
+ #endif
+
+    memset(p_fetch, 0, sizeof(bsp_latency_fetch_t));
+    p_fetch->clock_hz = SystemCoreClock;
+
+ #if BSP_FEATURE_CGC_HAS_FLWT
+    p_fetch->flash_wait_states = R_FCACHE->FLWT;
+ #elif BSP_FEATURE_CGC_HAS_MEMWAIT
+    p_fetch->flash_wait_states = (BSP_PRV_LATENCY_MEMWAIT_TWO_WAITS == R_SYSTEM->MEMWAIT) ? 2U : 0U;
+ #endif
+
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+
+    p_fetch->flash_cycles = bsp_prv_latency_fetch_time(bsp_prv_latency_fetch_flash);
+    p_fetch->sram_cycles  = bsp_prv_latency_fetch_time(bsp_prv_latency_fetch_sram);
+
+ #if BSP_FEATURE_BSP_FLASH_CACHE
+    if (0U != R_FCACHE->FCACHEE)
+    {
+        R_BSP_FlashCacheDisable();
+        p_fetch->flash_uncached_cycles = bsp_prv_latency_fetch_time(bsp_prv_latency_fetch_flash);
+        R_BSP_FlashCacheEnable();
+    }
+    else
+    {
+        p_fetch->flash_uncached_cycles = p_fetch->flash_cycles;
+    }
+ #endif
+
+    FSP_CRITICAL_SECTION_EXIT;
+
+    uint32_t instructions = BSP_PRV_LATENCY_FETCH_LOOPS * BSP_PRV_LATENCY_FETCH_LOOP_INSTRUCTIONS * 1000U;
+    p_fetch->flash_ipc_milli = instructions / p_fetch->flash_cycles;
+    p_fetch->sram_ipc_milli  = instructions / p_fetch->sram_cycles;
+    if (0U != p_fetch->flash_uncached_cycles)
+    {
+        p_fetch->flash_uncached_ipc_milli = instructions / p_fetch->flash_uncached_cycles;
+    }
+
+    return FSP_SUCCESS;
+}
+
+/** @} (end addtogroup BSP_MCU) */
+
+/*******************************************************************************************************************//**
+ * Runs a fetch benchmark loop once to load the flash cache, then returns the cycles taken by a second run.
+ *
+ * @param[in]  p_loop          Benchmark loop to time.
+ *
+ * @return Cycles taken by BSP_PRV_LATENCY_FETCH_LOOPS passes of the loop.
+ **********************************************************************************************************************/
+static uint32_t bsp_prv_latency_fetch_time (void (* p_loop)(uint32_t))
+{
+    p_loop(BSP_PRV_LATENCY_FETCH_LOOPS);
+
+    uint32_t start = DWT->CYCCNT;
+    p_loop(BSP_PRV_LATENCY_FETCH_LOOPS);
+
+    return DWT->CYCCNT - start;
+}
+
+/*******************************************************************************************************************//**
+ * Fetch benchmark loop executed from code flash.
+ *
+ * @param[in]  loop_cnt        Number of passes, must be at least 1.
+ **********************************************************************************************************************/
+BSP_ATTRIBUTE_STACKLESS static void bsp_prv_latency_fetch_flash (__attribute__((unused)) uint32_t loop_cnt)
+{
+    __asm volatile ("latency_fetch_flash_loop:  \n"
+                    BSP_PRV_LATENCY_FETCH_MOVES
+                    BSP_PRV_LATENCY_FETCH_MOVES
+                    BSP_PRV_LATENCY_FETCH_MOVES
+                    BSP_PRV_LATENCY_FETCH_DECREMENT
+                    "   cmp r0, #0          \n"
+                    BSP_PRV_LATENCY_FETCH_BRANCH("latency_fetch_flash_loop")
+                    "   bx lr               \n");
+}
+
+/*******************************************************************************************************************//**
+ * Fetch benchmark loop executed from SRAM.
+ *
+ * @param[in]  loop_cnt        Number of passes, must be at least 1.
+ **********************************************************************************************************************/
+BSP_ATTRIBUTE_STACKLESS static void bsp_prv_latency_fetch_sram (__attribute__((unused)) uint32_t loop_cnt)
+{
+    __asm volatile ("latency_fetch_sram_loop:   \n"
+                    BSP_PRV_LATENCY_FETCH_MOVES
+                    BSP_PRV_LATENCY_FETCH_MOVES
+                    BSP_PRV_LATENCY_FETCH_MOVES
+                    BSP_PRV_LATENCY_FETCH_DECREMENT
+                    "   cmp r0, #0          \n"
+                    BSP_PRV_LATENCY_FETCH_BRANCH("latency_fetch_sram_loop")
+                    "   bx lr               \n");
+}
+
+/*******************************************************************************************************************//**
+ * Starts the DWT cycle counter and clears the statistics. Called from SystemInit.
+ **********************************************************************************************************************/
+void bsp_latency_init (void)
+{
+    /* Only durations are measured, so the counter is not reset when the boot profile is already using it. */
+ #if !BSP_CFG_BOOT_PROFILE_ENABLE
+    DWT->CYCCNT = 0U;
+ #endif
+    R_BSP_CycleCounterStart();
+
+    R_BSP_LatencyStatsReset();
+}
+
+#endif
+
+/*******************************************************************************************************************//**
+ * @addtogroup BSP_MCU
+ * @{
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * Adds a duration to a statistics record. Also available without BSP_CFG_LATENCY_MEASURE_ENABLE, so modules can keep
+ * their own records. Must not be preempted by another writer of the same record.
+ *
+ * @param[in]  p_stats    Statistics record to update.
+ * @param[in]  cycles     Duration in CPU cycles.
+ **********************************************************************************************************************/
+void R_BSP_LatencyStatsRecord (bsp_latency_stats_t * p_stats, uint32_t cycles)
+{
+    /* Select the histogram bucket from the position of the highest bit set: each bucket covers 2 bits. */
+    uint32_t log2   = 31U - __CLZ(cycles | 1U);
+    uint32_t bucket = 0U;
+    if (log2 >= BSP_PRV_LATENCY_BUCKET_LOG2_MIN)
+    {
+        bucket = ((log2 - BSP_PRV_LATENCY_BUCKET_LOG2_MIN) >> 1U) + 1U;
+        if (bucket >= BSP_LATENCY_HISTOGRAM_BUCKETS)
+        {
+            bucket = BSP_LATENCY_HISTOGRAM_BUCKETS - 1U;
+        }
+    }
+
+    p_stats->histogram[bucket]++;
+    p_stats->count++;
+    p_stats->total += cycles;
+
+    if (cycles < p_stats->min)
+    {
+        p_stats->min = cycles;
+    }
+
+    if (cycles > p_stats->max)
+    {
+        p_stats->max = cycles;
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Starts the DWT cycle counter. The counter is shared by the BSP and every module that measures durations, so it is
+ * never reset here. Also available without BSP_CFG_LATENCY_MEASURE_ENABLE; does nothing on MCUs without the DWT cycle
+ * counter.
+ **********************************************************************************************************************/
+void R_BSP_CycleCounterStart (void)
+{
+#if BSP_FEATURE_DWT_CYCCNT
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL        |= DWT_CTRL_CYCCNTENA_Msk;
+#endif
+}
+
+/*******************************************************************************************************************//**
+ * Reads the DWT cycle counter. Returns 0 on MCUs without the DWT cycle counter.
+ **********************************************************************************************************************/
+uint32_t R_BSP_CycleCounterGet (void)
+{
+#if BSP_FEATURE_DWT_CYCCNT
+    return DWT->CYCCNT;
+#else
+    return 0U;
+#endif
+}
+
+/*******************************************************************************************************************//**
+ * Selects the cycle counter of a benchmark: the counter supplied by the application if there is one, otherwise the
+ * DWT cycle counter, which is started.
+ *
+ * @param[in]  p_cycles_get    Counter supplied by the application, or NULL.
+ * @param[out] p_selected      Counter to use.
+ *
+ * @retval FSP_SUCCESS         A counter was selected.
+ * @retval FSP_ERR_ASSERTION   p_selected is NULL.
+ * @retval FSP_ERR_UNSUPPORTED p_cycles_get is NULL and the MCU has no DWT cycle counter.
+ **********************************************************************************************************************/
+fsp_err_t R_BSP_CycleCounterSelect (bsp_cycle_counter_get_t p_cycles_get, bsp_cycle_counter_get_t * p_selected)
+{
+#if BSP_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_selected);
+#endif
+
+    if (NULL == p_cycles_get)
+    {
+#if BSP_FEATURE_DWT_CYCCNT
+        R_BSP_CycleCounterStart();
+        p_cycles_get = R_BSP_CycleCounterGet;
+#else
+
+        return FSP_ERR_UNSUPPORTED;
+#endif
+    }
+
+    *p_selected = p_cycles_get;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Formats part of a report row with snprintf() semantics. Start a row with written set to 0 and pass the result of
+ * each call to the next to append columns. Once the row no longer fits, the remaining parts are only measured.
+ *
+ * @param[out] p_line          Row buffer.
+ * @param[in]  line_size       Size of p_line in bytes.
+ * @param[in]  written         Characters already in the row, as returned by the previous call.
+ * @param[in]  p_format        printf() format of the columns to append.
+ *
+ * @return Number of characters the row needs, excluding the terminating null character. The row is truncated if this
+ *         is not less than line_size. A negative value is returned on an encoding error, and passed through by later
+ *         calls.
+ **********************************************************************************************************************/
+int32_t R_BSP_ReportRowFormat (char * const p_line, uint32_t line_size, int32_t written, char const * const p_format,
+                               ...)
+{
+    if (written < 0)
+    {
+        return written;
+    }
+
+    va_list args;
+    va_start(args, p_format);
+
+    int more;
+    if ((uint32_t) written < line_size)
+    {
+        more = vsnprintf(&p_line[written], line_size - (uint32_t) written, p_format, args);
+    }
+    else
+    {
+        more = vsnprintf(NULL, 0U, p_format, args);
+    }
+
+    va_end(args);
+
+    return (more < 0) ? (int32_t) more : (written + (int32_t) more);
+}
+
+/*******************************************************************************************************************//**
+ * Clears a statistics record. Also available without BSP_CFG_LATENCY_MEASURE_ENABLE.
+ *
+ * @param[in]  p_stats    Statistics record to clear.
+ **********************************************************************************************************************/
+void R_BSP_LatencyStatsClear (bsp_latency_stats_t * p_stats)
+{
+    memset(p_stats, 0, sizeof(bsp_latency_stats_t));
+    p_stats->min = UINT32_MAX;
+}
+
+/** @} (end addtogroup BSP_MCU) */
@@ -0,0 +1,125 @@
+/***********************************************************************************************************************
+ * Copyright [2020] Renesas Electronics Corporation and/or its affiliates.  All Rights Reserved.
+ *
+ * This software and documentation are supplied by Renesas Electronics America Inc. and may only be used with products
+ * of Renesas Electronics Corp. and its affiliates ("Renesas").  No other uses are authorized.  Renesas products are
+ * sold pursuant to Renesas terms and conditions of sale.  Purchasers are solely responsible for the selection and use
+ * of Renesas products and Renesas assumes no liability.  No license, express or implied, to any intellectual property
+ * right is granted by Renesas. This software is protected under all applicable laws, including copyright laws. Renesas
+ * reserves the right to change or discontinue this software and/or this documentation. THE SOFTWARE AND DOCUMENTATION
+ * IS DELIVERED TO YOU "AS IS," AND RENESAS MAKES NO REPRESENTATIONS OR WARRANTIES, AND TO THE FULLEST EXTENT
+ * PERMISSIBLE UNDER APPLICABLE LAW, DISCLAIMS ALL WARRANTIES, WHETHER EXPLICITLY OR IMPLICITLY, INCLUDING WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, AND NONINFRINGEMENT, WITH RESPECT TO THE SOFTWARE OR
+ * DOCUMENTATION.  RENESAS SHALL HAVE NO LIABILITY ARISING OUT OF ANY SECURITY VULNERABILITY OR BREACH.  TO THE MAXIMUM
+ * EXTENT PERMITTED BY LAW, IN NO EVENT WILL RENESAS BE LIABLE TO YOU IN CONNECTION WITH THE SOFTWARE OR DOCUMENTATION
+ * (OR ANY PERSON OR ENTITY CLAIMING RIGHTS DERIVED FROM YOU) FOR ANY LOSS, DAMAGES, OR CLAIMS WHATSOEVER, INCLUDING,
+ * WITHOUT LIMITATION, ANY DIRECT, CONSEQUENTIAL, SPECIAL, INDIRECT, PUNITIVE, OR INCIDENTAL DAMAGES; ANY LOST PROFITS,
+ * OTHER ECONOMIC DAMAGE, PROPERTY DAMAGE, OR PERSONAL INJURY; AND EVEN IF RENESAS HAS BEEN ADVISED OF THE POSSIBILITY
+ * OF SUCH LOSS, DAMAGES, CLAIMS OR COSTS.
+ **********************************************************************************************************************/
+
+#ifndef BSP_LATENCY_H
+#define BSP_LATENCY_H
+
+/***********************************************************************************************************************
+ * Includes   <System Includes> , "Project Includes"
+ **********************************************************************************************************************/
+
+/** Common macro for FSP header files. There is also a corresponding FSP_FOOTER macro at the end of this file. */
+FSP_HEADER
+
+/*******************************************************************************************************************//**
+ * @addtogroup BSP_MCU
+ * @{
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+
+/** Number of buckets in each duration histogram. Bucket n counts durations below 2^(2n + 6) cycles, the last bucket
+ * counts everything longer. */
+#define BSP_LATENCY_HISTOGRAM_BUCKETS    (8U)
+
+/** Number of statistics slots available to BSP_LATENCY_API_MEASURE. */
+#ifndef BSP_CFG_LATENCY_API_SLOTS
+ #define BSP_CFG_LATENCY_API_SLOTS       (8U)
+#endif
+
+/** Measures the number of CPU cycles spent in an API call and records it in the statistics slot given. For example:
+ * BSP_LATENCY_API_MEASURE(0U, err = R_SPI_Write(&g_spi0_ctrl, p_src, length, SPI_BIT_WIDTH_8_BITS)); */
+#if BSP_CFG_LATENCY_MEASURE_ENABLE
+ #define BSP_LATENCY_API_MEASURE(slot, call)                                     \
+    do                                                                           \
+    {                                                                            \
+        uint32_t bsp_latency_api_start = DWT->CYCCNT;                            \
+        call;                                                                    \
+        R_BSP_LatencyApiRecord((slot), DWT->CYCCNT - bsp_latency_api_start);     \
+    } while (0)
+#else
+ #define BSP_LATENCY_API_MEASURE(slot, call)    do {call;} while (0)
+#endif
+
+/***********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+
+/** Cycle count statistics for one interrupt vector or API slot. All durations are in CPU cycles. */
+typedef struct st_bsp_latency_stats
+{
+    uint32_t count;                                       ///< Number of samples recorded
+    uint32_t min;                                         ///< Shortest duration recorded
+    uint32_t max;                                         ///< Longest duration recorded
+    uint32_t average;                                     ///< Average duration, calculated when the stats are read
+    uint64_t total;                                       ///< Sum of all durations recorded
+    uint32_t histogram[BSP_LATENCY_HISTOGRAM_BUCKETS];    ///< Number of samples per duration bucket
+} bsp_latency_stats_t;
+
+/** Reads a free running 32-bit cycle counter. Benchmarks accept one to run on MCUs without the DWT cycle counter, see
+ * R_BSP_CycleCounterSelect(). */
+typedef uint32_t (* bsp_cycle_counter_get_t)(void);
+
+/** Instruction fetch performance measured by R_BSP_LatencyFetchBenchmark(). Instructions per cycle are scaled by 1000,
+ * so 1000 means one instruction per cycle. */
+typedef struct st_bsp_latency_fetch
+{
+    uint32_t clock_hz;                 ///< ICLK frequency during the measurement
+    uint32_t flash_wait_states;        ///< Code flash wait states during the measurement (FLWT or MEMWAIT)
+    uint32_t flash_cycles;             ///< Cycles taken from code flash with the current flash cache setting
+    uint32_t flash_uncached_cycles;    ///< Cycles taken from code flash with the flash cache disabled, 0 without cache
+    uint32_t sram_cycles;              ///< Cycles taken from SRAM
+    uint32_t flash_ipc_milli;          ///< Instructions per 1000 cycles from code flash
+    uint32_t flash_uncached_ipc_milli; ///< Instructions per 1000 cycles from uncached code flash, 0 without cache
+    uint32_t sram_ipc_milli;           ///< Instructions per 1000 cycles from SRAM
+} bsp_latency_fetch_t;
+
+/** @} (end addtogroup BSP_MCU) */
+
+/***********************************************************************************************************************
+ * Exported global variables
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Exported global functions (to be accessed by other files)
+ **********************************************************************************************************************/
+void      R_BSP_LatencyIsrEnter(void);
+void      R_BSP_LatencyIsrExit(void);
+void      R_BSP_LatencyApiRecord(uint32_t slot, uint32_t cycles);
+fsp_err_t R_BSP_LatencyIsrStatsGet(IRQn_Type irq, bsp_latency_stats_t * p_stats);
+fsp_err_t R_BSP_LatencyIsrEntryGet(IRQn_Type irq, uint32_t * p_cycles);
+fsp_err_t R_BSP_LatencyApiStatsGet(uint32_t slot, bsp_latency_stats_t * p_stats);
+void      R_BSP_LatencyStatsReset(void);
+fsp_err_t R_BSP_LatencyFetchBenchmark(bsp_latency_fetch_t * p_fetch);
+void      R_BSP_LatencyStatsRecord(bsp_latency_stats_t * p_stats, uint32_t cycles);
+void      R_BSP_LatencyStatsClear(bsp_latency_stats_t * p_stats);
+void      R_BSP_CycleCounterStart(void);
+uint32_t  R_BSP_CycleCounterGet(void);
+fsp_err_t R_BSP_CycleCounterSelect(bsp_cycle_counter_get_t p_cycles_get, bsp_cycle_counter_get_t * p_selected);
+int32_t   R_BSP_ReportRowFormat(char * const p_line, uint32_t line_size, int32_t written, char const * const p_format,
+                                ...);
+void      bsp_latency_init(void);       // Used internally by BSP
+
+/** Common macro for FSP header files. There is also a corresponding FSP_HEADER macro at the top of this file. */
+FSP_FOOTER
+
+#endif
@@ -0,0 +1,300 @@
+/***********************************************************************************************************************
+ * Copyright [2020] Renesas Electronics Corporation and/or its affiliates.  All Rights Reserved.
+ *
+ * This software and documentation are supplied by Renesas Electronics America Inc. and may only be used with products
+ * of Renesas Electronics Corp. and its affiliates ("Renesas").  No other uses are authorized.  Renesas products are
+ * sold pursuant to Renesas terms and conditions of sale.  Purchasers are solely responsible for the selection and use
+ * of Renesas products and Renesas assumes no liability.  No license, express or implied, to any intellectual property
+ * right is granted by Renesas. This software is protected under all applicable laws, including copyright laws. Renesas
+ * reserves the right to change or discontinue this software and/or this documentation. THE SOFTWARE AND DOCUMENTATION
+ * IS DELIVERED TO YOU "AS IS," AND RENESAS MAKES NO REPRESENTATIONS OR WARRANTIES, AND TO THE FULLEST EXTENT
+ * PERMISSIBLE UNDER APPLICABLE LAW, DISCLAIMS ALL WARRANTIES, WHETHER EXPLICITLY OR IMPLICITLY, INCLUDING WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, AND NONINFRINGEMENT, WITH RESPECT TO THE SOFTWARE OR
+ * DOCUMENTATION.  RENESAS SHALL HAVE NO LIABILITY ARISING OUT OF ANY SECURITY VULNERABILITY OR BREACH.  TO THE MAXIMUM
+ * EXTENT PERMITTED BY LAW, IN NO EVENT WILL RENESAS BE LIABLE TO YOU IN CONNECTION WITH THE SOFTWARE OR DOCUMENTATION
+ * (OR ANY PERSON OR ENTITY CLAIMING RIGHTS DERIVED FROM YOU) FOR ANY LOSS, DAMAGES, OR CLAIMS WHATSOEVER, INCLUDING,
+ * WITHOUT LIMITATION, ANY DIRECT, CONSEQUENTIAL, SPECIAL, INDIRECT, PUNITIVE, OR INCIDENTAL DAMAGES; ANY LOST PROFITS,
+ * OTHER ECONOMIC DAMAGE, PROPERTY DAMAGE, OR PERSONAL INJURY; AND EVEN IF RENESAS HAS BEEN ADVISED OF THE POSSIBILITY
+ * OF SUCH LOSS, DAMAGES, CLAIMS OR COSTS.
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Includes   <System Includes> , "Project Includes"
+ **********************************************************************************************************************/
+#include "bsp_api.h"
+
+#if BSP_CFG_MONITOR_ENABLE
+
+/***********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+
+/* Bytes left unpainted below the stack pointer of bsp_monitor_init() for its own frame. */
+ #define BSP_PRV_MONITOR_PAINT_MARGIN       (32U)
+
+/* The first histogram bucket holds requests of up to 2^4 bytes and each following bucket is twice as wide. */
+ #define BSP_PRV_MONITOR_BUCKET_LOG2_MIN    (4U)
+
+/***********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Private function prototypes
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Exported global variables (to be accessed by other files)
+ **********************************************************************************************************************/
+
+/* Main stack, defined in startup.c. */
+extern uint8_t g_main_stack[];
+
+/***********************************************************************************************************************
+ * Private global variables and functions
+ **********************************************************************************************************************/
+
+/* Lowest main stack word known to be used, and the next word R_BSP_MonitorSample() checks. The words below the
+ * watermark still hold the paint. */
+static uint32_t * gp_bsp_monitor_watermark;
+static uint32_t * gp_bsp_monitor_cursor;
+
+/* Lowest main stack pointer seen by R_BSP_MonitorSample(). */
+static uint32_t g_bsp_monitor_msp_min;
+
+static bsp_monitor_heap_t g_bsp_monitor_heap;
+
+/*******************************************************************************************************************//**
+ * @addtogroup BSP_MCU
+ * @{
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * Paints a stack, e.g. a task stack allocated by the application, so its high-water mark can be read with
+ * R_BSP_MonitorStackUsed(). The stack must not be in use. The main stack is painted at boot.
+ *
+ * @param[in]  p_stack    Lowest address of the stack, word aligned.
+ * @param[in]  size       Size of the stack in bytes.
+ **********************************************************************************************************************/
+void R_BSP_MonitorStackPaint (void * const p_stack, uint32_t const size)
+{
+    uint32_t * p_word = (uint32_t *) p_stack;
+
+    for (uint32_t i = 0U; i < (size / sizeof(uint32_t)); i++)
+    {
+        p_word[i] = BSP_MONITOR_STACK_PAINT;
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Gets the high-water mark of a stack painted with R_BSP_MonitorStackPaint(). The stack is scanned from its lowest
+ * address up to the first word that no longer holds the paint.
+ *
+ * @param[in]  p_stack    Lowest address of the stack, word aligned.
+ * @param[in]  size       Size of the stack in bytes.
+ *
+ * @return Number of bytes of the stack that have been used.
+ **********************************************************************************************************************/
+uint32_t R_BSP_MonitorStackUsed (void const * const p_stack, uint32_t const size)
+{
+    uint32_t const * p_word = (uint32_t const *) p_stack;
+    uint32_t         words  = size / sizeof(uint32_t);
+    uint32_t         unused = 0U;
+
+    while ((unused < words) && (BSP_MONITOR_STACK_PAINT == p_word[unused]))
+    {
+        unused++;
+    }
+
+    return size - (unused * sizeof(uint32_t));
+}
+
+/*******************************************************************************************************************//**
+ * Gets the usage of the main stack. The painted part of the stack below the known watermark is scanned, so the time
+ * this function takes grows with the unused stack size.
+ *
+ * @param[out] p_stack    Main stack usage.
+ *
+ * @retval FSP_SUCCESS          Usage stored in p_stack.
+ * @retval FSP_ERR_ASSERTION    p_stack is NULL.
+ **********************************************************************************************************************/
+fsp_err_t R_BSP_MonitorStackGet (bsp_monitor_stack_t * const p_stack)
+{
+ #if BSP_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_stack);
+ #endif
+
+    uint32_t * p_bottom = (uint32_t *) &g_main_stack[0];
+    uint32_t   top      = (uint32_t) &g_main_stack[BSP_CFG_STACK_MAIN_BYTES];
+    uint32_t * p_used   = p_bottom;
+
+    while ((p_used < gp_bsp_monitor_watermark) && (BSP_MONITOR_STACK_PAINT == *p_used))
+    {
+        p_used++;
+    }
+
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+    if (p_used < gp_bsp_monitor_watermark)
+    {
+        gp_bsp_monitor_watermark = p_used;
+    }
+
+    p_stack->used_bytes    = top - (uint32_t) gp_bsp_monitor_watermark;
+    p_stack->sampled_bytes = top - g_bsp_monitor_msp_min;
+    FSP_CRITICAL_SECTION_EXIT;
+
+    p_stack->size_bytes    = BSP_CFG_STACK_MAIN_BYTES;
+    p_stack->current_bytes = top - __get_MSP();
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Gets the heap usage. With BSP_CFG_HEAP_TLSF_ENABLE every allocation is recorded; see also R_BSP_HeapStatsGet() for
+ * the free space and fragmentation of each region. Otherwise only the growth of the heap through _sbrk is known,
+ * which is the peak heap footprint of the C library allocator, as it does not return memory.
+ *
+ * @param[out] p_heap     Heap usage.
+ *
+ * @retval FSP_SUCCESS          Usage stored in p_heap.
+ * @retval FSP_ERR_ASSERTION    p_heap is NULL.
+ **********************************************************************************************************************/
+fsp_err_t R_BSP_MonitorHeapGet (bsp_monitor_heap_t * const p_heap)
+{
+ #if BSP_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_heap);
+ #endif
+
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+    *p_heap = g_bsp_monitor_heap;
+    FSP_CRITICAL_SECTION_EXIT;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Samples the main stack. Call periodically, e.g. from a timer callback or the RTOS tick hook: the main stack pointer
+ * is recorded, which gives the interrupt stack depth at that moment, and BSP_CFG_MONITOR_SAMPLE_WORDS words of the
+ * paint are checked, so the high-water mark is kept up to date at a fixed cost per call. May be called from an ISR.
+ **********************************************************************************************************************/
+void R_BSP_MonitorSample (void)
+{
+    uint32_t msp = __get_MSP();
+
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+
+    if (msp < g_bsp_monitor_msp_min)
+    {
+        g_bsp_monitor_msp_min = msp;
+    }
+
+    for (uint32_t i = 0U; (i < BSP_CFG_MONITOR_SAMPLE_WORDS) && (gp_bsp_monitor_cursor < gp_bsp_monitor_watermark); i++)
+    {
+        if (BSP_MONITOR_STACK_PAINT != *gp_bsp_monitor_cursor)
+        {
+            gp_bsp_monitor_watermark = gp_bsp_monitor_cursor;
+        }
+        else
+        {
+            gp_bsp_monitor_cursor++;
+        }
+    }
+
+    /* Start the next pass from the bottom of the stack. */
+    if (gp_bsp_monitor_cursor >= gp_bsp_monitor_watermark)
+    {
+        gp_bsp_monitor_cursor = (uint32_t *) &g_main_stack[0];
+    }
+
+    FSP_CRITICAL_SECTION_EXIT;
+}
+
+/** @} (end addtogroup BSP_MCU) */
+
+/*******************************************************************************************************************//**
+ * Paints the unused part of the main stack. Called from SystemInit before any interrupt is enabled.
+ **********************************************************************************************************************/
+void bsp_monitor_init (void)
+{
+    uint32_t   msp      = __get_MSP();
+    uint32_t * p_bottom = (uint32_t *) &g_main_stack[0];
+    uint32_t * p_end    = (uint32_t *) ((msp - BSP_PRV_MONITOR_PAINT_MARGIN) & ~(sizeof(uint32_t) - 1U));
+
+    for (uint32_t * p_word = p_bottom; p_word < p_end; p_word++)
+    {
+        *p_word = BSP_MONITOR_STACK_PAINT;
+    }
+
+    gp_bsp_monitor_watermark = p_end;
+    gp_bsp_monitor_cursor    = p_bottom;
+    g_bsp_monitor_msp_min    = msp;
+}
+
+/*******************************************************************************************************************//**
+ * Records an allocation request. Called by the TLSF heap with interrupts masked.
+ *
+ * @param[in]  size        Requested size in bytes.
+ * @param[in]  block_size  Payload size of the block allocated.
+ * @param[in]  success     False if no region could serve the request.
+ **********************************************************************************************************************/
+void bsp_monitor_heap_alloc (uint32_t size, uint32_t block_size, bool success)
+{
+    uint32_t bucket = 0U;
+    if (size > (1U << BSP_PRV_MONITOR_BUCKET_LOG2_MIN))
+    {
+        /* Round up to the next power of two. */
+        bucket = (32U - __CLZ(size - 1U)) - BSP_PRV_MONITOR_BUCKET_LOG2_MIN;
+        if (bucket >= BSP_MONITOR_HEAP_BUCKETS)
+        {
+            bucket = BSP_MONITOR_HEAP_BUCKETS - 1U;
+        }
+    }
+
+    g_bsp_monitor_heap.histogram[bucket]++;
+
+    if (success)
+    {
+        g_bsp_monitor_heap.alloc_count++;
+        g_bsp_monitor_heap.in_use_bytes += block_size;
+        if (g_bsp_monitor_heap.in_use_bytes > g_bsp_monitor_heap.peak_in_use_bytes)
+        {
+            g_bsp_monitor_heap.peak_in_use_bytes = g_bsp_monitor_heap.in_use_bytes;
+        }
+    }
+    else
+    {
+        g_bsp_monitor_heap.fail_count++;
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Records a free. Called by the TLSF heap with interrupts masked.
+ *
+ * @param[in]  block_size  Payload size of the block freed.
+ **********************************************************************************************************************/
+void bsp_monitor_heap_free (uint32_t block_size)
+{
+    g_bsp_monitor_heap.free_count++;
+    g_bsp_monitor_heap.in_use_bytes -= block_size;
+}
+
+/*******************************************************************************************************************//**
+ * Records a heap extension through _sbrk.
+ *
+ * @param[in]  bytes       Bytes of the heap in use by the C library after the call.
+ * @param[in]  success     False if the request did not fit in the heap.
+ **********************************************************************************************************************/
+void bsp_monitor_sbrk (uint32_t bytes, bool success)
+{
+    g_bsp_monitor_heap.sbrk_bytes = bytes;
+
+    if (!success)
+    {
+        g_bsp_monitor_heap.sbrk_fail_count++;
+    }
+}
+
+#endif
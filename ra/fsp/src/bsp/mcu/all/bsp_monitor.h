@@ -0,0 +1,107 @@
+/***********************************************************************************************************************
+ * Copyright [2020] Renesas Electronics Corporation and/or its affiliates.  All Rights Reserved.
+ *
+ * This software and documentation are supplied by Renesas Electronics America Inc. and may only be used with products
+ * of Renesas Electronics Corp. and its affiliates ("Renesas").  No other uses are authorized.  Renesas products are
+ * sold pursuant to Renesas terms and conditions of sale.  Purchasers are solely responsible for the selection and use
+ * of Renesas products and Renesas assumes no liability.  No license, express or implied, to any intellectual property
+ * right is granted by Renesas. This software is protected under all applicable laws, including copyright laws. Renesas
+ * reserves the right to change or discontinue this software and/or this documentation. THE SOFTWARE AND DOCUMENTATION
+ * IS DELIVERED TO YOU "AS IS," AND RENESAS MAKES NO REPRESENTATIONS OR WARRANTIES, AND TO THE FULLEST EXTENT
+ * PERMISSIBLE UNDER APPLICABLE LAW, DISCLAIMS ALL WARRANTIES, WHETHER EXPLICITLY OR IMPLICITLY, INCLUDING WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, AND NONINFRINGEMENT, WITH RESPECT TO THE SOFTWARE OR
+ * DOCUMENTATION.  RENESAS SHALL HAVE NO LIABILITY ARISING OUT OF ANY SECURITY VULNERABILITY OR BREACH.  TO THE MAXIMUM
+ * EXTENT PERMITTED BY LAW, IN NO EVENT WILL RENESAS BE LIABLE TO YOU IN CONNECTION WITH THE SOFTWARE OR DOCUMENTATION
+ * (OR ANY PERSON OR ENTITY CLAIMING RIGHTS DERIVED FROM YOU) FOR ANY LOSS, DAMAGES, OR CLAIMS WHATSOEVER, INCLUDING,
+ * WITHOUT LIMITATION, ANY DIRECT, CONSEQUENTIAL, SPECIAL, INDIRECT, PUNITIVE, OR INCIDENTAL DAMAGES; ANY LOST PROFITS,
+ * OTHER ECONOMIC DAMAGE, PROPERTY DAMAGE, OR PERSONAL INJURY; AND EVEN IF RENESAS HAS BEEN ADVISED OF THE POSSIBILITY
+ * OF SUCH LOSS, DAMAGES, CLAIMS OR COSTS.
+ **********************************************************************************************************************/
+
+#ifndef BSP_MONITOR_H
+#define BSP_MONITOR_H
+
+/***********************************************************************************************************************
+ * Includes   <System Includes> , "Project Includes"
+ **********************************************************************************************************************/
+
+/** Common macro for FSP header files. There is also a corresponding FSP_FOOTER macro at the end of this file. */
+FSP_HEADER
+
+/*******************************************************************************************************************//**
+ * @addtogroup BSP_MCU
+ * @{
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+
+/** Set BSP_CFG_MONITOR_ENABLE to 1 to paint the main stack at boot and record heap usage. See
+ * R_BSP_MonitorStackGet() and R_BSP_MonitorHeapGet(). */
+#ifndef BSP_CFG_MONITOR_ENABLE
+ #define BSP_CFG_MONITOR_ENABLE             (0)
+#endif
+
+/** Number of stack words R_BSP_MonitorSample() checks per call. */
+#ifndef BSP_CFG_MONITOR_SAMPLE_WORDS
+ #define BSP_CFG_MONITOR_SAMPLE_WORDS       (32U)
+#endif
+
+/** Value unused stack words are painted with. */
+#define BSP_MONITOR_STACK_PAINT             (0xA5A5A5A5U)
+
+/** Number of buckets in the allocation size histogram. Bucket n counts requests of at most 2^(n + 4) bytes, the last
+ * bucket counts everything larger. */
+#define BSP_MONITOR_HEAP_BUCKETS            (12U)
+
+/***********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+
+/** Main stack usage. Exceptions and interrupts always run on the main stack, and so does the application without an
+ * RTOS. With an RTOS the tasks run on their own stacks and the main stack is the interrupt stack. */
+typedef struct st_bsp_monitor_stack
+{
+    uint32_t size_bytes;               ///< Size of the main stack
+    uint32_t used_bytes;               ///< High-water mark: deepest use found in the paint
+    uint32_t current_bytes;            ///< Use at the time of the call
+    uint32_t sampled_bytes;            ///< Deepest use seen by R_BSP_MonitorSample()
+} bsp_monitor_stack_t;
+
+/** Heap usage. */
+typedef struct st_bsp_monitor_heap
+{
+    uint32_t sbrk_bytes;                              ///< Bytes handed to the C library by _sbrk (GCC without TLSF)
+    uint32_t sbrk_fail_count;                         ///< _sbrk calls that did not fit in the heap
+    uint32_t alloc_count;                             ///< Blocks allocated from the TLSF heap
+    uint32_t free_count;                              ///< Blocks freed to the TLSF heap
+    uint32_t fail_count;                              ///< TLSF allocations that no region could serve
+    uint32_t in_use_bytes;                            ///< TLSF payload bytes currently allocated
+    uint32_t peak_in_use_bytes;                       ///< Highest value of in_use_bytes
+    uint32_t histogram[BSP_MONITOR_HEAP_BUCKETS];     ///< TLSF allocation requests per size bucket
+} bsp_monitor_heap_t;
+
+/** @} (end addtogroup BSP_MCU) */
+
+/***********************************************************************************************************************
+ * Exported global variables
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Exported global functions (to be accessed by other files)
+ **********************************************************************************************************************/
+void      R_BSP_MonitorStackPaint(void * const p_stack, uint32_t const size);
+uint32_t  R_BSP_MonitorStackUsed(void const * const p_stack, uint32_t const size);
+fsp_err_t R_BSP_MonitorStackGet(bsp_monitor_stack_t * const p_stack);
+fsp_err_t R_BSP_MonitorHeapGet(bsp_monitor_heap_t * const p_heap);
+void      R_BSP_MonitorSample(void);
+void      bsp_monitor_init(void);                                                 // Used internally by BSP
+void      bsp_monitor_heap_alloc(uint32_t size, uint32_t block_size, bool success); // Used internally by BSP
+void      bsp_monitor_heap_free(uint32_t block_size);                               // Used internally by BSP
+void      bsp_monitor_sbrk(uint32_t bytes, bool success);                           // Used internally by BSP
+
+/** Common macro for FSP header files. There is also a corresponding FSP_HEADER macro at the top of this file. */
+FSP_FOOTER
+
+#endif
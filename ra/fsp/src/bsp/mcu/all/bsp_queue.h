@@ -0,0 +1,322 @@
+/***********************************************************************************************************************
+ * Copyright [2020] Renesas Electronics Corporation and/or its affiliates.  All Rights Reserved.
+ *
+ * This software and documentation are supplied by Renesas Electronics America Inc. and may only be used with products
+ * of Renesas Electronics Corp. and its affiliates ("Renesas").  No other uses are authorized.  Renesas products are
+ * sold pursuant to Renesas terms and conditions of sale.  Purchasers are solely responsible for the selection and use
+ * of Renesas products and Renesas assumes no liability.  No license, express or implied, to any intellectual property
+ * right is granted by Renesas. This software is protected under all applicable laws, including copyright laws. Renesas
+ * reserves the right to change or discontinue this software and/or this documentation. THE SOFTWARE AND DOCUMENTATION
+ * IS DELIVERED TO YOU "AS IS," AND RENESAS MAKES NO REPRESENTATIONS OR WARRANTIES, AND TO THE FULLEST EXTENT
+ * PERMISSIBLE UNDER APPLICABLE LAW, DISCLAIMS ALL WARRANTIES, WHETHER EXPLICITLY OR IMPLICITLY, INCLUDING WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, AND NONINFRINGEMENT, WITH RESPECT TO THE SOFTWARE OR
+ * DOCUMENTATION.  RENESAS SHALL HAVE NO LIABILITY ARISING OUT OF ANY SECURITY VULNERABILITY OR BREACH.  TO THE MAXIMUM
+ * EXTENT PERMITTED BY LAW, IN NO EVENT WILL RENESAS BE LIABLE TO YOU IN CONNECTION WITH THE SOFTWARE OR DOCUMENTATION
+ * (OR ANY PERSON OR ENTITY CLAIMING RIGHTS DERIVED FROM YOU) FOR ANY LOSS, DAMAGES, OR CLAIMS WHATSOEVER, INCLUDING,
+ * WITHOUT LIMITATION, ANY DIRECT, CONSEQUENTIAL, SPECIAL, INDIRECT, PUNITIVE, OR INCIDENTAL DAMAGES; ANY LOST PROFITS,
+ * OTHER ECONOMIC DAMAGE, PROPERTY DAMAGE, OR PERSONAL INJURY; AND EVEN IF RENESAS HAS BEEN ADVISED OF THE POSSIBILITY
+ * OF SUCH LOSS, DAMAGES, CLAIMS OR COSTS.
+ **********************************************************************************************************************/
+
+#ifndef BSP_QUEUE_H
+#define BSP_QUEUE_H
+
+/***********************************************************************************************************************
+ * Includes   <System Includes> , "Project Includes"
+ **********************************************************************************************************************/
+
+/** Common macro for FSP header files. There is also a corresponding FSP_FOOTER macro at the end of this file. */
+FSP_HEADER
+
+/*******************************************************************************************************************//**
+ * @addtogroup BSP_MCU
+ * @{
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+
+/* R_BSP_QueueMpscPush reserves slots with LDREX/STREX on Cortex-M4 and Cortex-M33, and in a short interrupt masked
+ * section on Cortex-M23. */
+#if (4U == __CORTEX_M) || (33U == __CORTEX_M)
+ #define BSP_QUEUE_PRV_EXCLUSIVE_ACCESS    (1)
+#else
+ #define BSP_QUEUE_PRV_EXCLUSIVE_ACCESS    (0)
+#endif
+
+/** Defines the storage of a queue of capacity items of item_type. capacity must be a power of two. The sequence array
+ * is only used by the multiple producer functions. For example:
+ * BSP_QUEUE_STORAGE_DEFINE(g_rx_queue, uint8_t, 64U);
+ * R_BSP_QueueInit(&g_rx_queue, g_rx_queue_buffer, g_rx_queue_sequence, sizeof(uint8_t), 64U); */
+#define BSP_QUEUE_STORAGE_DEFINE(name, item_type, capacity) \
+    static bsp_queue_t name;                                \
+    static item_type   name ## _buffer[capacity];           \
+    static uint32_t    name ## _sequence[capacity]
+
+/***********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+
+struct st_bsp_queue;
+
+/** Wakeup hook called after an item is pushed or popped, with the number of items in the queue after the operation.
+ * Typically gives a task notification or a semaphore. Called from the context of the push or pop. */
+typedef void (* bsp_queue_wakeup_t)(struct st_bsp_queue * p_queue, uint32_t count);
+
+/** Allocation-free queue of fixed size items for interrupt to task handoff. Use either the single producer functions
+ * (R_BSP_QueuePush) or the multiple producer functions (R_BSP_QueueMpscPush) on a queue, with a single consumer in
+ * both cases. Indexes run freely and wrap with the capacity mask. */
+typedef struct st_bsp_queue
+{
+    uint8_t               * p_buffer;          ///< Item storage, capacity * item_size bytes
+    volatile uint32_t     * p_sequence;        ///< Slot sequence numbers for multiple producers, or NULL
+    uint32_t                item_size;         ///< Size of an item in bytes
+    uint32_t                mask;              ///< Capacity - 1
+    volatile uint32_t       head;              ///< Next slot to write
+    volatile uint32_t       tail;              ///< Next slot to read
+    bsp_queue_wakeup_t      p_consumer_wakeup; ///< Called after every push, or NULL
+    bsp_queue_wakeup_t      p_producer_wakeup; ///< Called after a pop that made room in a full queue, or NULL
+    void const            * p_context;         ///< User defined context, not used by the queue
+} bsp_queue_t;
+
+/***********************************************************************************************************************
+ * Exported global functions (to be accessed by other files)
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * Initializes an empty queue.
+ *
+ * @param[out] p_queue         The queue
+ * @param[in]  p_buffer        Storage for capacity items
+ * @param[in]  p_sequence      Storage for capacity sequence numbers if multiple producers push, otherwise NULL
+ * @param[in]  item_size       Size of an item in bytes
+ * @param[in]  capacity        Number of items the queue holds. Must be a power of two.
+ **********************************************************************************************************************/
+__STATIC_INLINE void R_BSP_QueueInit (bsp_queue_t * const p_queue,
+                                      void * const        p_buffer,
+                                      uint32_t * const    p_sequence,
+                                      uint32_t            item_size,
+                                      uint32_t            capacity)
+{
+    p_queue->p_buffer          = (uint8_t *) p_buffer;
+    p_queue->p_sequence        = p_sequence;
+    p_queue->item_size         = item_size;
+    p_queue->mask              = capacity - 1U;
+    p_queue->head              = 0U;
+    p_queue->tail              = 0U;
+    p_queue->p_consumer_wakeup = NULL;
+    p_queue->p_producer_wakeup = NULL;
+    p_queue->p_context         = NULL;
+
+    if (NULL != p_sequence)
+    {
+        /* A slot is free for the producer reserving index i while its sequence is i. */
+        for (uint32_t i = 0U; i < capacity; i++)
+        {
+            p_sequence[i] = i;
+        }
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Returns the number of items in the queue. With multiple producers, this includes items still being written.
+ *
+ * @param[in]  p_queue         The queue
+ *
+ * @return     Number of items in the queue.
+ **********************************************************************************************************************/
+__STATIC_INLINE uint32_t R_BSP_QueueCount (bsp_queue_t const * const p_queue)
+{
+    return p_queue->head - p_queue->tail;
+}
+
+/*******************************************************************************************************************//**
+ * Pushes an item from the single producer. Safe against a consumer running in another context.
+ *
+ * @param[in]  p_queue         The queue
+ * @param[in]  p_item          Item to copy into the queue
+ *
+ * @retval     true            The item was pushed.
+ * @retval     false           The queue is full.
+ **********************************************************************************************************************/
+__STATIC_INLINE bool R_BSP_QueuePush (bsp_queue_t * const p_queue, void const * const p_item)
+{
+    uint32_t head = p_queue->head;
+
+    if ((head - p_queue->tail) > p_queue->mask)
+    {
+        return false;
+    }
+
+    memcpy(&p_queue->p_buffer[(head & p_queue->mask) * p_queue->item_size], p_item, p_queue->item_size);
+
+    /* Publish the index after the item is written. */
+    __DMB();
+    p_queue->head = head + 1U;
+
+    if (NULL != p_queue->p_consumer_wakeup)
+    {
+        p_queue->p_consumer_wakeup(p_queue, head + 1U - p_queue->tail);
+    }
+
+    return true;
+}
+
+/*******************************************************************************************************************//**
+ * Pops an item pushed with R_BSP_QueuePush. Must only be called by the single consumer.
+ *
+ * @param[in]  p_queue         The queue
+ * @param[out] p_item          Where to copy the item
+ *
+ * @retval     true            An item was popped.
+ * @retval     false           The queue is empty.
+ **********************************************************************************************************************/
+__STATIC_INLINE bool R_BSP_QueuePop (bsp_queue_t * const p_queue, void * const p_item)
+{
+    uint32_t tail  = p_queue->tail;
+    uint32_t count = p_queue->head - tail;
+
+    if (0U == count)
+    {
+        return false;
+    }
+
+    /* Read the item after the index that published it. */
+    __DMB();
+    memcpy(p_item, &p_queue->p_buffer[(tail & p_queue->mask) * p_queue->item_size], p_queue->item_size);
+
+    /* Release the slot after the item is read. */
+    __DMB();
+    p_queue->tail = tail + 1U;
+
+    if ((NULL != p_queue->p_producer_wakeup) && (count > p_queue->mask))
+    {
+        p_queue->p_producer_wakeup(p_queue, count - 1U);
+    }
+
+    return true;
+}
+
+/*******************************************************************************************************************//**
+ * Pushes an item from any of several producers, e.g. interrupts of different priorities. The queue must have been
+ * initialized with a sequence array. A producer preempted while writing its item never blocks the others; the
+ * consumer sees the queue as empty at that item until it is complete.
+ *
+ * @param[in]  p_queue         The queue
+ * @param[in]  p_item          Item to copy into the queue
+ *
+ * @retval     true            The item was pushed.
+ * @retval     false           The queue is full.
+ **********************************************************************************************************************/
+__STATIC_INLINE bool R_BSP_QueueMpscPush (bsp_queue_t * const p_queue, void const * const p_item)
+{
+    uint32_t head;
+
+    /* Reserve a slot. It is free once the consumer has released it for this lap of the indexes. */
+#if BSP_QUEUE_PRV_EXCLUSIVE_ACCESS
+    for ( ; ; )
+    {
+        head = __LDREXW(&p_queue->head);
+
+        /* The slot is ahead of this lap if another producer reserved it after head was read; head is stale, so
+         * retry. It is behind this lap only if the consumer has not released it yet, i.e. the queue is full. */
+        int32_t lap = (int32_t) (p_queue->p_sequence[head & p_queue->mask] - head);
+        if (lap < 0)
+        {
+            __CLREX();
+
+            return false;
+        }
+
+        if (lap > 0)
+        {
+            __CLREX();
+        }
+        else if (0U == __STREXW(head + 1U, &p_queue->head))
+        {
+            break;
+        }
+        else
+        {
+            /* Reservation was interrupted; retry. */
+        }
+    }
+#else
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+    head = p_queue->head;
+    bool reserved = (p_queue->p_sequence[head & p_queue->mask] == head);
+    if (reserved)
+    {
+        p_queue->head = head + 1U;
+    }
+
+    FSP_CRITICAL_SECTION_EXIT;
+
+    if (!reserved)
+    {
+        return false;
+    }
+#endif
+
+    memcpy(&p_queue->p_buffer[(head & p_queue->mask) * p_queue->item_size], p_item, p_queue->item_size);
+
+    /* Mark the slot complete after the item is written. */
+    __DMB();
+    p_queue->p_sequence[head & p_queue->mask] = head + 1U;
+
+    if (NULL != p_queue->p_consumer_wakeup)
+    {
+        p_queue->p_consumer_wakeup(p_queue, R_BSP_QueueCount(p_queue));
+    }
+
+    return true;
+}
+
+/*******************************************************************************************************************//**
+ * Pops an item pushed with R_BSP_QueueMpscPush. Must only be called by the single consumer.
+ *
+ * @param[in]  p_queue         The queue
+ * @param[out] p_item          Where to copy the item
+ *
+ * @retval     true            An item was popped.
+ * @retval     false           The queue is empty, or the oldest item is still being written.
+ **********************************************************************************************************************/
+__STATIC_INLINE bool R_BSP_QueueMpscPop (bsp_queue_t * const p_queue, void * const p_item)
+{
+    uint32_t tail = p_queue->tail;
+    uint32_t slot = tail & p_queue->mask;
+
+    if (p_queue->p_sequence[slot] != (tail + 1U))
+    {
+        return false;
+    }
+
+    /* Read the item after the sequence that published it. */
+    __DMB();
+    memcpy(p_item, &p_queue->p_buffer[slot * p_queue->item_size], p_queue->item_size);
+
+    /* Release the slot for the next lap after the item is read. */
+    __DMB();
+    p_queue->tail             = tail + 1U;
+    p_queue->p_sequence[slot] = tail + p_queue->mask + 1U;
+
+    if (NULL != p_queue->p_producer_wakeup)
+    {
+        uint32_t count = p_queue->head - (tail + 1U);
+        if (count >= p_queue->mask)
+        {
+            p_queue->p_producer_wakeup(p_queue, count);
+        }
+    }
+
+    return true;
+}
+
+/** @} (end addtogroup BSP_MCU) */
+
+/** Common macro for FSP header files. There is also a corresponding FSP_HEADER macro at the top of this file. */
+FSP_FOOTER
+
+#endif
@@ -28,7 +28,20 @@
  **********************************************************************************************************************/
 
 /* Key code for writing PRCR register. */
-#define BSP_PRV_PRCR_KEY    (0xA500U)
+#define BSP_PRV_PRCR_KEY                    (0xA500U)
+
+/* PRCR bits managed by the protection counters. */
+#define BSP_PRV_PRCR_PRC_MASK               (0x001BU)
+
+/* Lower byte of PRCR, the key reads as 0. */
+#define BSP_PRV_PRCR_BITS_MASK              (0x00FFU)
+
+/* Counters are updated with LDREX/STREX on cores with an exclusive monitor and in a critical section otherwise. */
+#if (4U == __CORTEX_M) || (33U == __CORTEX_M)
+ #define BSP_PRV_PROTECT_EXCLUSIVE_ACCESS    (1)
+#else
+ #define BSP_PRV_PROTECT_EXCLUSIVE_ACCESS    (0)
+#endif
 
 /***********************************************************************************************************************
  * Typedef definitions
@@ -43,7 +56,7 @@
  **********************************************************************************************************************/
 
 /** Used for holding reference counters for protection bits. */
-static volatile uint16_t g_protect_counters[] =
+static volatile uint32_t g_protect_counters[] =
 {
     0U, 0U, 0U, 0U
 };
@@ -57,6 +70,9 @@ static const uint16_t g_prcr_masks[] =
     0x0010U,                           /* PRC4. */
 };
 
+static uint32_t bsp_prv_protect_counter_update(bsp_reg_protect_t regs, bool increment);
+static void     bsp_prv_prcr_sync(void);
+
 /*******************************************************************************************************************//**
  * @addtogroup BSP_MCU
  *
@@ -67,62 +83,123 @@ static const uint16_t g_prcr_masks[] =
  *        Enable register protection. Registers that are protected cannot be written to. Register protection is
  *          enabled by using the Protect Register (PRCR) and the MPC's Write-Protect Register (PWPR).
  *
+ * Nested calls only update the reference counter, without masking interrupts. PRCR is written when the counter
+ * reaches 0.
+ *
  * @param[in] regs_to_protect Registers which have write protection enabled.
  **********************************************************************************************************************/
 void R_BSP_RegisterProtectEnable (bsp_reg_protect_t regs_to_protect)
 {
-    /** Get/save the current state of interrupts */
-    FSP_CRITICAL_SECTION_DEFINE;
-    FSP_CRITICAL_SECTION_ENTER;
-
-    /* Is it safe to disable write access? */
-    if (0U != g_protect_counters[regs_to_protect])
+    /* Is it safe to enable write protection? */
+    if (0U == bsp_prv_protect_counter_update(regs_to_protect, false))
     {
-        /* Decrement the protect counter */
-        g_protect_counters[regs_to_protect]--;
+        bsp_prv_prcr_sync();
     }
+}
+
+/*******************************************************************************************************************//**
+ *        Disable register protection. Registers that are protected cannot be written to. Register protection is
+ *          disabled by using the Protect Register (PRCR) and the MPC's Write-Protect Register (PWPR).
+ *
+ * Nested calls only update the reference counter, without masking interrupts. PRCR is written on the first entry,
+ * or if a context that preempted the first entry gets here before it wrote PRCR.
+ *
+ * @param[in] regs_to_unprotect Registers which have write protection disabled.
+ **********************************************************************************************************************/
+void R_BSP_RegisterProtectDisable (bsp_reg_protect_t regs_to_unprotect)
+{
+    uint32_t count = bsp_prv_protect_counter_update(regs_to_unprotect, true);
 
-    /* Is it safe to disable write access? */
-    if (0U == g_protect_counters[regs_to_protect])
+    /* The first entry always writes PRCR, whatever state the bit was left in. A nested entry still finds the bit
+     * cleared if it preempted the first entry before that wrote PRCR. */
+    if ((1U == count) || (0U == (R_SYSTEM->PRCR & g_prcr_masks[regs_to_unprotect])))
     {
-        /** Enable protection using PRCR register. */
+        bsp_prv_prcr_sync();
+    }
+}
+
+/** @} (end addtogroup BSP_MCU) */
+
+/*******************************************************************************************************************//**
+ * Increments or decrements a protection reference counter. The counter does not go below 0.
+ *
+ * @param[in] regs          Counter to update.
+ * @param[in] increment     True to increment, false to decrement.
+ *
+ * @return    The updated counter.
+ **********************************************************************************************************************/
+static uint32_t bsp_prv_protect_counter_update (bsp_reg_protect_t regs, bool increment)
+{
+    uint32_t count;
 
-        /** When writing to the PRCR register the upper 8-bits must be the correct key. Set lower bits to 0 to
-         * disable writes. */
-        R_SYSTEM->PRCR = ((R_SYSTEM->PRCR | BSP_PRV_PRCR_KEY) & (uint16_t) (~g_prcr_masks[regs_to_protect]));
+#if BSP_PRV_PROTECT_EXCLUSIVE_ACCESS
+    do
+    {
+        count = __LDREXW(&g_protect_counters[regs]);
+        if (increment)
+        {
+            count++;
+        }
+        else if (0U != count)
+        {
+            count--;
+        }
+        else
+        {
+            __CLREX();
+
+            return 0U;
+        }
+    } while (0U != __STREXW(count, &g_protect_counters[regs]));
+#else
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+    count = g_protect_counters[regs];
+    if (increment)
+    {
+        count++;
+    }
+    else if (0U != count)
+    {
+        count--;
+    }
+    else
+    {
+        /* Already 0. */
     }
 
-    /** Restore the interrupt state */
+    g_protect_counters[regs] = count;
     FSP_CRITICAL_SECTION_EXIT;
+#endif
+
+    return count;
 }
 
 /*******************************************************************************************************************//**
- *        Disable register protection. Registers that are protected cannot be written to. Register protection is
- *          disabled by using the Protect Register (PRCR) and the MPC's Write-Protect Register (PWPR).
- *
- * @param[in] regs_to_unprotect Registers which have write protection disabled.
+ * Writes PRCR so that exactly the registers with a non-zero reference counter are unprotected. The check and the write
+ * must not be separated by a context that changes a counter and relies on PRCR before this context resumes, so this
+ * short sequence runs with interrupts masked. It only runs on 0 to 1 and 1 to 0 transitions.
  **********************************************************************************************************************/
-void R_BSP_RegisterProtectDisable (bsp_reg_protect_t regs_to_unprotect)
+static void bsp_prv_prcr_sync (void)
 {
-    /** Get/save the current state of interrupts */
     FSP_CRITICAL_SECTION_DEFINE;
     FSP_CRITICAL_SECTION_ENTER;
 
-    /* If this is first entry then disable protection. */
-    if (0U == g_protect_counters[regs_to_unprotect])
+    uint16_t unprotected = 0U;
+    for (uint32_t i = 0U; i < (sizeof(g_prcr_masks) / sizeof(g_prcr_masks[0])); i++)
     {
-        /** Disable protection using PRCR register. */
-
-        /** When writing to the PRCR register the upper 8-bits must be the correct key. Set lower bits to 0 to
-         * disable writes. */
-        R_SYSTEM->PRCR = ((R_SYSTEM->PRCR | BSP_PRV_PRCR_KEY) | g_prcr_masks[regs_to_unprotect]);
+        if (0U != g_protect_counters[i])
+        {
+            unprotected |= g_prcr_masks[i];
+        }
     }
 
-    /** Increment the protect counter */
-    g_protect_counters[regs_to_unprotect]++;
+    uint16_t prcr = (uint16_t) (R_SYSTEM->PRCR & BSP_PRV_PRCR_BITS_MASK);
+    if ((prcr & BSP_PRV_PRCR_PRC_MASK) != unprotected)
+    {
+        /** When writing to the PRCR register the upper 8-bits must be the correct key. */
+        R_SYSTEM->PRCR = (uint16_t) (BSP_PRV_PRCR_KEY | (prcr & (uint16_t) ~BSP_PRV_PRCR_PRC_MASK) | unprotected);
+    }
 
-    /** Restore the interrupt state */
     FSP_CRITICAL_SECTION_EXIT;
 }
-
-/** @} (end addtogroup BSP_MCU) */
@@ -28,6 +28,17 @@ FSP_HEADER
  * Macro definitions
  **********************************************************************************************************************/
 
+/** Writes value to a single register protected by regs_to_unprotect. Nested inside another unprotected section, this
+ * only updates the reference counter, without masking interrupts or writing PRCR. For example:
+ * BSP_REG_PROTECT_WRITE(BSP_REG_PROTECT_CGC, R_SYSTEM->OSTDCR, 0U); */
+#define BSP_REG_PROTECT_WRITE(regs_to_unprotect, reg, value) \
+    do                                                        \
+    {                                                         \
+        R_BSP_RegisterProtectDisable(regs_to_unprotect);      \
+        (reg) = (value);                                      \
+        R_BSP_RegisterProtectEnable(regs_to_unprotect);       \
+    } while (0)
+
 /***********************************************************************************************************************
  * Typedef definitions
  **********************************************************************************************************************/
@@ -67,6 +67,14 @@ caddr_t _sbrk(int incr);
 
 caddr_t _sbrk (int incr)
 {
+ #if BSP_CFG_HEAP_TLSF_ENABLE
+
+    /* The heap is owned by the TLSF allocator in bsp_heap.c, which also replaces malloc. */
+    FSP_PARAMETER_NOT_USED(incr);
+    errno = ENOMEM;
+
+    return (caddr_t) -1;
+ #else
     extern char _Heap_Begin __asm("__HeapBase");  ///< Defined by the linker.
 
     extern char _Heap_Limit __asm("__HeapLimit"); ///< Defined by the linker.
@@ -90,13 +98,20 @@ caddr_t _sbrk (int incr)
     {
         /** Heap has overflowed */
         errno = ENOMEM;
+  #if BSP_CFG_MONITOR_ENABLE
+        bsp_monitor_sbrk((uint32_t) (current_heap_end - &_Heap_Begin), false);
+  #endif
 
         return (caddr_t) -1;
     }
 
     current_heap_end += bytes;
+  #if BSP_CFG_MONITOR_ENABLE
+    bsp_monitor_sbrk((uint32_t) (current_heap_end - &_Heap_Begin), true);
+  #endif
 
     return (caddr_t) current_block_address;
+ #endif
 }
 
 #endif
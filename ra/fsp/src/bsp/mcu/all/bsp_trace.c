@@ -0,0 +1,257 @@
+/***********************************************************************************************************************
+ * Copyright [2020] Renesas Electronics Corporation and/or its affiliates.  All Rights Reserved.
+ *
+ * This software and documentation are supplied by Renesas Electronics America Inc. and may only be used with products
+ * of Renesas Electronics Corp. and its affiliates ("Renesas").  No other uses are authorized.  Renesas products are
+ * sold pursuant to Renesas terms and conditions of sale.  Purchasers are solely responsible for the selection and use
+ * of Renesas products and Renesas assumes no liability.  No license, express or implied, to any intellectual property
+ * right is granted by Renesas. This software is protected under all applicable laws, including copyright laws. Renesas
+ * reserves the right to change or discontinue this software and/or this documentation. THE SOFTWARE AND DOCUMENTATION
+ * IS DELIVERED TO YOU "AS IS," AND RENESAS MAKES NO REPRESENTATIONS OR WARRANTIES, AND TO THE FULLEST EXTENT
+ * PERMISSIBLE UNDER APPLICABLE LAW, DISCLAIMS ALL WARRANTIES, WHETHER EXPLICITLY OR IMPLICITLY, INCLUDING WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, AND NONINFRINGEMENT, WITH RESPECT TO THE SOFTWARE OR
+ * DOCUMENTATION.  RENESAS SHALL HAVE NO LIABILITY ARISING OUT OF ANY SECURITY VULNERABILITY OR BREACH.  TO THE MAXIMUM
+ * EXTENT PERMITTED BY LAW, IN NO EVENT WILL RENESAS BE LIABLE TO YOU IN CONNECTION WITH THE SOFTWARE OR DOCUMENTATION
+ * (OR ANY PERSON OR ENTITY CLAIMING RIGHTS DERIVED FROM YOU) FOR ANY LOSS, DAMAGES, OR CLAIMS WHATSOEVER, INCLUDING,
+ * WITHOUT LIMITATION, ANY DIRECT, CONSEQUENTIAL, SPECIAL, INDIRECT, PUNITIVE, OR INCIDENTAL DAMAGES; ANY LOST PROFITS,
+ * OTHER ECONOMIC DAMAGE, PROPERTY DAMAGE, OR PERSONAL INJURY; AND EVEN IF RENESAS HAS BEEN ADVISED OF THE POSSIBILITY
+ * OF SUCH LOSS, DAMAGES, CLAIMS OR COSTS.
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Includes   <System Includes> , "Project Includes"
+ **********************************************************************************************************************/
+#include "bsp_api.h"
+
+#if BSP_CFG_TRACE_ENABLE
+ #ifndef BSP_CFG_TRACE_TIMESTAMP
+  #error "BSP_CFG_TRACE_ENABLE requires BSP_CFG_TRACE_TIMESTAMP() on MCUs without the DWT cycle counter."
+ #endif
+ #if (0U != (BSP_CFG_TRACE_RECORDS & (BSP_CFG_TRACE_RECORDS - 1U))) || (BSP_CFG_TRACE_RECORDS < 2U)
+  #error "BSP_CFG_TRACE_RECORDS must be a power of two."
+ #endif
+
+/***********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+ #define BSP_PRV_TRACE_INDEX_MASK     (BSP_CFG_TRACE_RECORDS - 1U)
+
+/* Records copied per call to the write function of R_BSP_TraceFlush(). */
+ #define BSP_PRV_TRACE_FLUSH_CHUNK    (8U)
+
+/***********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Private function prototypes
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Exported global variables (to be accessed by other files)
+ **********************************************************************************************************************/
+
+/** Trace control block and ring. Not static so a debugger can locate it by name. */
+bsp_trace_t g_bsp_trace;
+
+/***********************************************************************************************************************
+ * Private global variables and functions
+ **********************************************************************************************************************/
+
+/* Records lost since the last LOST record was read. */
+static uint32_t g_bsp_trace_lost;
+
+/*******************************************************************************************************************//**
+ * @addtogroup BSP_MCU
+ * @{
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * Records an event. Normally called through BSP_TRACE(). The slot is reserved with an exclusive access, so this
+ * function may be called from any context, including nested interrupts, without masking interrupts.
+ *
+ * @param[in]  module     fsp_ip_t of the driver, or BSP_TRACE_MODULE_BSP.
+ * @param[in]  channel    Channel of the driver.
+ * @param[in]  event      Callback event code or bsp_trace_event_t.
+ * @param[in]  data       Event specific data.
+ **********************************************************************************************************************/
+void R_BSP_TraceRecord (uint8_t module, uint8_t channel, uint16_t event, uint32_t data)
+{
+    uint32_t sequence;
+
+    do
+    {
+        sequence = __LDREXW(&g_bsp_trace.head);
+    } while (0U != __STREXW(sequence + 1U, &g_bsp_trace.head));
+
+    bsp_trace_record_t volatile * p_record = &g_bsp_trace.ring[sequence & BSP_PRV_TRACE_INDEX_MASK];
+
+    /* Invalidate the slot while it is written. sequence - 1 can neither be the old nor the new sequence of the slot. */
+    p_record->sequence  = sequence - 1U;
+    p_record->timestamp = BSP_CFG_TRACE_TIMESTAMP();
+    p_record->data      = data;
+    p_record->event     = event;
+    p_record->module    = module;
+    p_record->channel   = channel;
+    p_record->sequence  = sequence;
+}
+
+/*******************************************************************************************************************//**
+ * Copies the records that were not read yet, oldest first. If records were overwritten before they could be read, a
+ * BSP_TRACE_EVENT_LOST record with the number of records lost follows. Records are read in the order they were
+ * reserved, so reading stops at a record that an interrupted context is still writing. Only one context may read.
+ *
+ * @param[out] p_records     Buffer for the records.
+ * @param[in]  max_records   Number of records the buffer can hold.
+ *
+ * @return Number of records copied.
+ **********************************************************************************************************************/
+uint32_t R_BSP_TraceRead (bsp_trace_record_t * const p_records, uint32_t const max_records)
+{
+    uint32_t count = 0U;
+    uint32_t head  = g_bsp_trace.head;
+    uint32_t tail  = g_bsp_trace.tail;
+
+    /* Skip the records that were overwritten. */
+    if ((head - tail) > BSP_CFG_TRACE_RECORDS)
+    {
+        g_bsp_trace_lost += (head - tail) - BSP_CFG_TRACE_RECORDS;
+        tail              = head - BSP_CFG_TRACE_RECORDS;
+    }
+
+    while ((count < max_records) && (tail != head))
+    {
+        bsp_trace_record_t volatile * p_record = &g_bsp_trace.ring[tail & BSP_PRV_TRACE_INDEX_MASK];
+
+        uint32_t sequence = p_record->sequence;
+
+        /* Still being written. */
+        if ((int32_t) (sequence - tail) < 0)
+        {
+            break;
+        }
+
+        p_records[count].sequence  = sequence;
+        p_records[count].timestamp = p_record->timestamp;
+        p_records[count].data      = p_record->data;
+        p_records[count].event     = p_record->event;
+        p_records[count].module    = p_record->module;
+        p_records[count].channel   = p_record->channel;
+
+        /* Keep the copy only if the slot was not reused while it was copied. */
+        if ((sequence == tail) && (p_record->sequence == tail))
+        {
+            count++;
+        }
+        else
+        {
+            g_bsp_trace_lost++;
+        }
+
+        tail++;
+    }
+
+    g_bsp_trace.tail = tail;
+
+    if ((0U != g_bsp_trace_lost) && (count < max_records))
+    {
+        p_records[count].sequence  = tail;
+        p_records[count].timestamp = BSP_CFG_TRACE_TIMESTAMP();
+        p_records[count].data      = g_bsp_trace_lost;
+        p_records[count].event     = (uint16_t) BSP_TRACE_EVENT_LOST;
+        p_records[count].module    = BSP_TRACE_MODULE_BSP;
+        p_records[count].channel   = 0U;
+        count++;
+
+        g_bsp_trace_lost = 0U;
+    }
+
+    return count;
+}
+
+/*******************************************************************************************************************//**
+ * Passes every record not read yet to a write function, e.g. R_BSP_TraceItmWrite() for SWO or a function that writes
+ * to a UART. The records are written as they are stored in memory, see bsp_trace_decode.py for the host side.
+ *
+ * @param[in]  p_write    Function that writes the records. data is word aligned and bytes is a multiple of
+ *                        sizeof(bsp_trace_record_t).
+ *
+ * @return Number of records written.
+ **********************************************************************************************************************/
+uint32_t R_BSP_TraceFlush (void (* p_write)(uint8_t const * const p_data, uint32_t const bytes))
+{
+    bsp_trace_record_t records[BSP_PRV_TRACE_FLUSH_CHUNK];
+    uint32_t           total = 0U;
+    uint32_t           count;
+
+    do
+    {
+        count = R_BSP_TraceRead(records, BSP_PRV_TRACE_FLUSH_CHUNK);
+        if (0U != count)
+        {
+            p_write((uint8_t const *) records, count * sizeof(bsp_trace_record_t));
+        }
+
+        total += count;
+    } while (BSP_PRV_TRACE_FLUSH_CHUNK == count);
+
+    return total;
+}
+
+/*******************************************************************************************************************//**
+ * Writes trace data to ITM stimulus port BSP_CFG_TRACE_ITM_PORT, for use with R_BSP_TraceFlush(). The debugger must
+ * enable the ITM, the port and SWO. Nothing is written otherwise, or on MCUs without ITM.
+ *
+ * @param[in]  p_data     Word aligned data.
+ * @param[in]  bytes      Number of bytes, a multiple of 4.
+ **********************************************************************************************************************/
+void R_BSP_TraceItmWrite (uint8_t const * const p_data, uint32_t const bytes)
+{
+ #ifdef ITM
+    uint32_t const * p_word = (uint32_t const *) p_data;
+
+    if ((0U != (ITM->TCR & ITM_TCR_ITMENA_Msk)) && (0U != (ITM->TER & (1UL << BSP_CFG_TRACE_ITM_PORT))))
+    {
+        for (uint32_t i = 0U; i < (bytes / sizeof(uint32_t)); i++)
+        {
+            /* Wait for the stimulus port FIFO. */
+            while (0U == ITM->PORT[BSP_CFG_TRACE_ITM_PORT].u32)
+            {
+                ;
+            }
+
+            ITM->PORT[BSP_CFG_TRACE_ITM_PORT].u32 = p_word[i];
+        }
+    }
+
+ #else
+    FSP_PARAMETER_NOT_USED(p_data);
+    FSP_PARAMETER_NOT_USED(bytes);
+ #endif
+}
+
+/*******************************************************************************************************************//**
+ * Discards the records not read yet.
+ **********************************************************************************************************************/
+void R_BSP_TraceReset (void)
+{
+    g_bsp_trace.tail = g_bsp_trace.head;
+    g_bsp_trace_lost = 0U;
+}
+
+/** @} (end addtogroup BSP_MCU) */
+
+/*******************************************************************************************************************//**
+ * Initializes the control block and starts the DWT cycle counter if it is the timestamp. Called from SystemInit.
+ **********************************************************************************************************************/
+void bsp_trace_init (void)
+{
+    g_bsp_trace.magic   = BSP_TRACE_MAGIC;
+    g_bsp_trace.records = BSP_CFG_TRACE_RECORDS;
+    g_bsp_trace.head    = 0U;
+    g_bsp_trace.tail    = 0U;
+
+    R_BSP_CycleCounterStart();
+}
+
+#endif
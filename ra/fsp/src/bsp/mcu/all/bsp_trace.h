@@ -0,0 +1,138 @@
+/***********************************************************************************************************************
+ * Copyright [2020] Renesas Electronics Corporation and/or its affiliates.  All Rights Reserved.
+ *
+ * This software and documentation are supplied by Renesas Electronics America Inc. and may only be used with products
+ * of Renesas Electronics Corp. and its affiliates ("Renesas").  No other uses are authorized.  Renesas products are
+ * sold pursuant to Renesas terms and conditions of sale.  Purchasers are solely responsible for the selection and use
+ * of Renesas products and Renesas assumes no liability.  No license, express or implied, to any intellectual property
+ * right is granted by Renesas. This software is protected under all applicable laws, including copyright laws. Renesas
+ * reserves the right to change or discontinue this software and/or this documentation. THE SOFTWARE AND DOCUMENTATION
+ * IS DELIVERED TO YOU "AS IS," AND RENESAS MAKES NO REPRESENTATIONS OR WARRANTIES, AND TO THE FULLEST EXTENT
+ * PERMISSIBLE UNDER APPLICABLE LAW, DISCLAIMS ALL WARRANTIES, WHETHER EXPLICITLY OR IMPLICITLY, INCLUDING WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, AND NONINFRINGEMENT, WITH RESPECT TO THE SOFTWARE OR
+ * DOCUMENTATION.  RENESAS SHALL HAVE NO LIABILITY ARISING OUT OF ANY SECURITY VULNERABILITY OR BREACH.  TO THE MAXIMUM
+ * EXTENT PERMITTED BY LAW, IN NO EVENT WILL RENESAS BE LIABLE TO YOU IN CONNECTION WITH THE SOFTWARE OR DOCUMENTATION
+ * (OR ANY PERSON OR ENTITY CLAIMING RIGHTS DERIVED FROM YOU) FOR ANY LOSS, DAMAGES, OR CLAIMS WHATSOEVER, INCLUDING,
+ * WITHOUT LIMITATION, ANY DIRECT, CONSEQUENTIAL, SPECIAL, INDIRECT, PUNITIVE, OR INCIDENTAL DAMAGES; ANY LOST PROFITS,
+ * OTHER ECONOMIC DAMAGE, PROPERTY DAMAGE, OR PERSONAL INJURY; AND EVEN IF RENESAS HAS BEEN ADVISED OF THE POSSIBILITY
+ * OF SUCH LOSS, DAMAGES, CLAIMS OR COSTS.
+ **********************************************************************************************************************/
+
+#ifndef BSP_TRACE_H
+#define BSP_TRACE_H
+
+/***********************************************************************************************************************
+ * Includes   <System Includes> , "Project Includes"
+ **********************************************************************************************************************/
+
+/** Common macro for FSP header files. There is also a corresponding FSP_FOOTER macro at the end of this file. */
+FSP_HEADER
+
+/*******************************************************************************************************************//**
+ * @addtogroup BSP_MCU
+ * @{
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+
+/** Set BSP_CFG_TRACE_ENABLE to 1 to record driver events (callbacks, open, close and transfer starts) in a RAM ring
+ * buffer. See R_BSP_TraceFlush(). When 0, the trace hooks in the drivers compile to nothing. */
+#ifndef BSP_CFG_TRACE_ENABLE
+ #define BSP_CFG_TRACE_ENABLE          (0)
+#endif
+
+/** Number of records in the ring buffer, a power of two. The oldest records are overwritten when it is full. */
+#ifndef BSP_CFG_TRACE_RECORDS
+ #define BSP_CFG_TRACE_RECORDS         (256U)
+#endif
+
+/** Timestamp source of the records. Defaults to the DWT cycle counter. MCUs without one must provide a free running
+ * 32-bit counter, e.g. one read from a GPT. */
+#ifndef BSP_CFG_TRACE_TIMESTAMP
+ #if BSP_FEATURE_DWT_CYCCNT
+  #define BSP_CFG_TRACE_TIMESTAMP()    (DWT->CYCCNT)
+ #endif
+#endif
+
+/** ITM stimulus port used by R_BSP_TraceItmWrite(). */
+#ifndef BSP_CFG_TRACE_ITM_PORT
+ #define BSP_CFG_TRACE_ITM_PORT        (1U)
+#endif
+
+/** "TRCE" in ASCII, marks the trace control block for tools reading it from memory. */
+#define BSP_TRACE_MAGIC                (0x54524345U)
+
+/** Module ID of records that are not from a driver (see fsp_ip_t for the driver module IDs). */
+#define BSP_TRACE_MODULE_BSP           (0xFFU)
+
+/** Records a driver event. Events below BSP_TRACE_EVENT_OPEN are the event codes passed to the driver callback. */
+#if BSP_CFG_TRACE_ENABLE
+ #define BSP_TRACE(module, channel, event, data)                                        \
+    R_BSP_TraceRecord((uint8_t) (module), (uint8_t) (channel), (uint16_t) (event), (uint32_t) (data))
+#else
+ #define BSP_TRACE(module, channel, event, data)
+#endif
+
+/***********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+
+/** Events recorded besides the callback events of each driver. */
+typedef enum e_bsp_trace_event
+{
+    BSP_TRACE_EVENT_OPEN       = 0x8000, ///< Driver opened
+    BSP_TRACE_EVENT_CLOSE      = 0x8001, ///< Driver closed
+    BSP_TRACE_EVENT_START      = 0x8002, ///< Operation started, e.g. a timer or a reception
+    BSP_TRACE_EVENT_STOP       = 0x8003, ///< Operation stopped or aborted
+    BSP_TRACE_EVENT_WRITE      = 0x8004, ///< Write started, data is the length
+    BSP_TRACE_EVENT_READ       = 0x8005, ///< Read started, data is the length
+    BSP_TRACE_EVENT_WRITE_READ = 0x8006, ///< Full duplex transfer started, data is the length
+    BSP_TRACE_EVENT_ERASE      = 0x8007, ///< Erase started, data is the number of blocks
+    BSP_TRACE_EVENT_USER       = 0xC000, ///< First event code available to the application
+    BSP_TRACE_EVENT_LOST       = 0xFFFF, ///< Records overwritten before they were flushed, data is the count
+} bsp_trace_event_t;
+
+/** Trace record. The sequence is the index of the record since boot and is written last, so readers can tell records
+ * that were overwritten or are being written apart. */
+typedef struct st_bsp_trace_record
+{
+    uint32_t sequence;                 ///< Index of the record
+    uint32_t timestamp;                ///< BSP_CFG_TRACE_TIMESTAMP() when the event was recorded
+    uint32_t data;                     ///< Event specific data, e.g. the callback data or a transfer length
+    uint16_t event;                    ///< Callback event code or bsp_trace_event_t
+    uint8_t  module;                   ///< fsp_ip_t of the driver, or BSP_TRACE_MODULE_BSP
+    uint8_t  channel;                  ///< Channel of the driver
+} bsp_trace_record_t;
+
+/** Trace control block. A debugger can read it directly, e.g. while the MCU runs, and pass it to the decoder. */
+typedef struct st_bsp_trace
+{
+    uint32_t           magic;          ///< BSP_TRACE_MAGIC
+    uint32_t           records;        ///< Number of records in the ring
+    volatile uint32_t  head;           ///< Sequence of the next record
+    uint32_t           tail;           ///< Sequence of the next record to flush
+    bsp_trace_record_t ring[BSP_CFG_TRACE_RECORDS];
+} bsp_trace_t;
+
+/** @} (end addtogroup BSP_MCU) */
+
+/***********************************************************************************************************************
+ * Exported global variables
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Exported global functions (to be accessed by other files)
+ **********************************************************************************************************************/
+void     R_BSP_TraceRecord(uint8_t module, uint8_t channel, uint16_t event, uint32_t data);
+uint32_t R_BSP_TraceRead(bsp_trace_record_t * const p_records, uint32_t const max_records);
+uint32_t R_BSP_TraceFlush(void (* p_write)(uint8_t const * const p_data, uint32_t const bytes));
+void     R_BSP_TraceItmWrite(uint8_t const * const p_data, uint32_t const bytes);
+void     R_BSP_TraceReset(void);
+void     bsp_trace_init(void);         // Used internally by BSP
+
+/** Common macro for FSP header files. There is also a corresponding FSP_HEADER macro at the top of this file. */
+FSP_FOOTER
+
+#endif
@@ -0,0 +1,175 @@
+#!/usr/bin/env python3
+#
+# Copyright [2020] Renesas Electronics Corporation and/or its affiliates.  All Rights Reserved.
+#
+# This software and documentation are supplied by Renesas Electronics America Inc. and may only be used with products
+# of Renesas Electronics Corp. and its affiliates ("Renesas").  No other uses are authorized.  Renesas products are
+# sold pursuant to Renesas terms and conditions of sale.  Purchasers are solely responsible for the selection and use
+# of Renesas products and Renesas assumes no liability.  No license, express or implied, to any intellectual property
+# right is granted by Renesas. This software is protected under all applicable laws, including copyright laws. Renesas
+# reserves the right to change or discontinue this software and/or this documentation. THE SOFTWARE AND DOCUMENTATION
+# IS DELIVERED TO YOU "AS IS," AND RENESAS MAKES NO REPRESENTATIONS OR WARRANTIES, AND TO THE FULLEST EXTENT
+# PERMISSIBLE UNDER APPLICABLE LAW, DISCLAIMS ALL WARRANTIES, WHETHER EXPLICITLY OR IMPLICITLY, INCLUDING WARRANTIES
+# OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, AND NONINFRINGEMENT, WITH RESPECT TO THE SOFTWARE OR
+# DOCUMENTATION.  RENESAS SHALL HAVE NO LIABILITY ARISING OUT OF ANY SECURITY VULNERABILITY OR BREACH.  TO THE MAXIMUM
+# EXTENT PERMITTED BY LAW, IN NO EVENT WILL RENESAS BE LIABLE TO YOU IN CONNECTION WITH THE SOFTWARE OR DOCUMENTATION
+# (OR ANY PERSON OR ENTITY CLAIMING RIGHTS DERIVED FROM IT) FOR ANY DAMAGES, INCLUDING WITHOUT LIMITATION, ANY DIRECT,
+# CONSEQUENTIAL, SPECIAL, INDIRECT, PUNITIVE, OR INCIDENTAL DAMAGES; ANY LOST PROFITS, OTHER ECONOMIC DAMAGE,
+# PROPERTY DAMAGE, OR PERSONAL INJURY; AND EVEN IF RENESAS HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGES.
+#
+"""Host decoder of the BSP_TRACE() event records.
+
+Reads the 16 byte records written by R_BSP_TraceFlush() (e.g. captured from a UART), the ITM stimulus port stream
+written by R_BSP_TraceItmWrite() (e.g. captured from SWO), or a memory dump of g_bsp_trace read by a debugger, and
+prints one line per event.
+
+Examples:
+    bsp_trace_decode.py stream uart_capture.bin --clock 120000000
+    bsp_trace_decode.py itm swo_capture.bin --port 1
+    bsp_trace_decode.py dump g_bsp_trace.bin
+"""
+
+import argparse
+import struct
+import sys
+
+MAGIC = 0x54524345
+RECORD_FORMAT = "<IIIHBB"
+RECORD_SIZE = struct.calcsize(RECORD_FORMAT)
+HEADER_FORMAT = "<IIII"
+HEADER_SIZE = struct.calcsize(HEADER_FORMAT)
+MODULE_BSP = 0xFF
+
+MODULE_NAMES = {3: "lpm", 4: "fcu", 7: "dmac", 8: "dtc", 20: "sci", 21: "iic", 22: "spi", 32: "adc", 40: "rtc",
+                43: "gpt", 47: "agt", 48: "can", 50: "qspi", 52: "sdhi", 54: "ssi", 67: "glcdc", 68: "drw", 72: "ospi",
+                MODULE_BSP: "bsp"}
+TRACE_EVENTS = {0x8000: "open", 0x8001: "close", 0x8002: "start", 0x8003: "stop", 0x8004: "write", 0x8005: "read",
+                0x8006: "write-read", 0x8007: "erase", 0xFFFF: "lost"}
+EVENT_USER = 0xC000
+
+# Callback events, as defined by the API of each module. Bitmask events are decoded bit by bit.
+BITMASK_EVENTS = {
+    20: ("rx-complete", "tx-complete", "rx-char", "err-parity", "err-framing", "err-overflow", "break-detect",
+         "tx-data-empty"),
+    52: ("card-removed", "card-inserted", None, "response", "sdio", "transfer-complete", "transfer-error",
+         "erase-complete", "erase-busy"),
+}
+ENUM_EVENTS = {
+    21: {1: "aborted", 2: "rx-complete", 3: "tx-complete", 4: "rx-request", 5: "tx-request", 6: "rx-more-request",
+         7: "tx-more-request", 8: "general-call"},
+    22: {1: "transfer-complete", 2: "transfer-aborted", 3: "err-mode-fault", 4: "err-read-overflow", 5: "err-parity",
+         6: "err-overrun", 7: "err-framing"},
+    40: {0: "alarm", 1: "periodic"},
+    43: {0: "cycle-end", 1: "capture-a", 2: "capture-b", 3: "trough"},
+    48: {2: "err-warning", 4: "err-passive", 8: "err-bus-off", 16: "bus-recovery", 32: "message-lost",
+         1024: "rx-complete", 2048: "tx-complete"},
+    54: {0: "idle", 1: "tx-empty", 2: "rx-full"},
+    4: {0: "erase-complete", 1: "write-complete", 2: "blank", 3: "not-blank", 4: "err-df-access", 5: "err-cf-access",
+        6: "err-cmd-locked", 7: "err-failure"},
+}
+
+
+def event_name(module, event):
+    if event in TRACE_EVENTS:
+        return TRACE_EVENTS[event]
+    if event >= EVENT_USER:
+        return "user+0x%x" % (event - EVENT_USER)
+    if module in BITMASK_EVENTS:
+        names = [name for bit, name in enumerate(BITMASK_EVENTS[module]) if name and event & (1 << bit)]
+        if names:
+            return "|".join(names)
+    return ENUM_EVENTS.get(module, {}).get(event, "0x%04x" % event)
+
+
+def parse_records(data):
+    return [struct.unpack_from(RECORD_FORMAT, data, offset) for offset in range(0, len(data) - RECORD_SIZE + 1,
+                                                                                   RECORD_SIZE)]
+
+
+def align_stream(data):
+    """Finds the byte offset at which consecutive records have consecutive sequence numbers (a capture may start in
+    the middle of a record)."""
+    for offset in range(RECORD_SIZE):
+        records = parse_records(data[offset:offset + 4 * RECORD_SIZE])
+        if len(records) < 2 or all(b[0] == a[0] + 1 for a, b in zip(records, records[1:])):
+            return offset
+    return 0
+
+
+def skip_continuation(data, i):
+    """Skips the payload bytes of a timestamp or extension packet, the last one has bit 7 clear."""
+    while i < len(data) and data[i] & 0x80:
+        i += 1
+    return i + 1
+
+
+def strip_itm(data, port):
+    """Extracts the payload of one ITM stimulus port from a SWO byte stream."""
+    payload = bytearray()
+    sizes = {1: 1, 2: 2, 3: 4}
+    i = 0
+    while i < len(data):
+        header = data[i]
+        i += 1
+        if header & 3:
+            # Source packet, bit 2 is set for hardware (DWT) sources.
+            size = sizes[header & 3]
+            if not header & 4 and (header >> 3) == port:
+                payload += data[i:i + size]
+            i += size
+        elif header in (0x00, 0x80, 0x70):
+            # Synchronization or overflow.
+            continue
+        elif header & 0x80:
+            # Timestamp or extension packet with payload.
+            i = skip_continuation(data, i)
+    return bytes(payload)
+
+
+def parse_dump(data):
+    """Orders the ring of a g_bsp_trace memory dump oldest record first."""
+    magic, count, head, _ = struct.unpack_from(HEADER_FORMAT, data)
+    if MAGIC != magic:
+        sys.exit("not a g_bsp_trace dump (magic 0x%08x)" % magic)
+    records = parse_records(data[HEADER_SIZE:HEADER_SIZE + count * RECORD_SIZE])
+    # Keep only complete records from the last lap of the ring.
+    valid = [r for slot, r in enumerate(records) if (head - 1 - r[0]) % (1 << 32) < count and r[0] % count == slot]
+    return sorted(valid, key=lambda r: (r[0] - head) % (1 << 32))
+
+
+def print_records(records, clock):
+    previous = None
+    for sequence, timestamp, data, event, module, channel in records:
+        delta = 0 if previous is None else (timestamp - previous) % (1 << 32)
+        previous = timestamp
+        if clock:
+            stamp = "%12.3f %+10.3f" % (timestamp * 1e6 / clock, delta * 1e6 / clock)
+        else:
+            stamp = "%12u %+10u" % (timestamp, delta)
+        if MODULE_BSP == module and 0xFFFF == event:
+            print("%10u %s  --- %u records lost ---" % (sequence, stamp, data))
+            continue
+        name = MODULE_NAMES.get(module, "ip%u" % module)
+        print("%10u %s %5s%-3u %-24s 0x%08x" % (sequence, stamp, name, channel, event_name(module, event), data))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("format", choices=("stream", "itm", "dump"))
+    parser.add_argument("file", help="capture file, - for stdin")
+    parser.add_argument("--clock", type=float, default=0.0, help="timestamp clock in Hz, to print times in us")
+    parser.add_argument("--port", type=int, default=1, help="ITM stimulus port (BSP_CFG_TRACE_ITM_PORT)")
+    args = parser.parse_args()
+
+    data = sys.stdin.buffer.read() if "-" == args.file else open(args.file, "rb").read()
+    if "dump" == args.format:
+        records = parse_dump(data)
+    else:
+        if "itm" == args.format:
+            data = strip_itm(data, args.port)
+        records = parse_records(data[align_stream(data):])
+    print_records(records, args.clock)
+
+
+if __name__ == "__main__":
+    main()
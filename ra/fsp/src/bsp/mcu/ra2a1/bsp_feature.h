@@ -182,6 +182,7 @@
 #define BSP_FEATURE_ETHER_MAX_CHANNELS                    (0)           // Feature not available on this MCU
 
 #define BSP_FEATURE_FLASH_DATA_FLASH_START                (0x40100000U)
+#define BSP_FEATURE_FLASH_HP_CF_DUAL_BANK_START           (0)           // Feature not available on this MCU
 #define BSP_FEATURE_FLASH_HP_CF_REGION0_BLOCK_SIZE        (0)           // Feature not available on this MCU
 #define BSP_FEATURE_FLASH_HP_CF_REGION0_SIZE              (0)           // Feature not available on this MCU
 #define BSP_FEATURE_FLASH_HP_CF_REGION1_BLOCK_SIZE        (0)           // Feature not available on this MCU
@@ -189,6 +190,7 @@
 #define BSP_FEATURE_FLASH_HP_DF_BLOCK_SIZE                (0)           // Feature not available on this MCU
 #define BSP_FEATURE_FLASH_HP_DF_WRITE_SIZE                (0)           // Feature not available on this MCU
 #define BSP_FEATURE_FLASH_HP_HAS_FMEPROT                  (0)           // Feature not available on this MCU
+#define BSP_FEATURE_FLASH_HP_SUPPORTS_DUAL_BANK           (0)           // Feature not available on this MCU
 #define BSP_FEATURE_FLASH_HP_VERSION                      (0)           // Feature not available on this MCU
 #define BSP_FEATURE_FLASH_LP_AWS_FAW_MASK                 (0xFFFU)
 #define BSP_FEATURE_FLASH_LP_AWS_FAW_SHIFT                (10)
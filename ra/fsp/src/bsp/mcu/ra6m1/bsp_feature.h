@@ -186,6 +186,7 @@
 #define BSP_FEATURE_ETHER_MAX_CHANNELS                    (0)           // Feature not available on this MCU
 
 #define BSP_FEATURE_FLASH_DATA_FLASH_START                (0x40100000U)
+#define BSP_FEATURE_FLASH_HP_CF_DUAL_BANK_START           (0) // Feature not available on this MCU
 #define BSP_FEATURE_FLASH_HP_CF_REGION0_BLOCK_SIZE        (0x2000U)
 #define BSP_FEATURE_FLASH_HP_CF_REGION0_SIZE              (0x10000U)
 #define BSP_FEATURE_FLASH_HP_CF_REGION1_BLOCK_SIZE        (0x8000U)
@@ -193,6 +194,7 @@
 #define BSP_FEATURE_FLASH_HP_DF_BLOCK_SIZE                (64U)
 #define BSP_FEATURE_FLASH_HP_DF_WRITE_SIZE                (4U)
 #define BSP_FEATURE_FLASH_HP_HAS_FMEPROT                  (0) // Feature not available on this MCU
+#define BSP_FEATURE_FLASH_HP_SUPPORTS_DUAL_BANK           (0) // Feature not available on this MCU
 #define BSP_FEATURE_FLASH_HP_VERSION                      (40U)
 #define BSP_FEATURE_FLASH_LP_AWS_FAW_MASK                 (0) // Feature not available on this MCU
 #define BSP_FEATURE_FLASH_LP_AWS_FAW_SHIFT                (0) // Feature not available on this MCU
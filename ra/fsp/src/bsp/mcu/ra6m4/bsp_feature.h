@@ -168,6 +168,7 @@
 #define BSP_FEATURE_ETHER_MAX_CHANNELS                    (1U)
 
 #define BSP_FEATURE_FLASH_DATA_FLASH_START                (0x08000000U)
+#define BSP_FEATURE_FLASH_HP_CF_DUAL_BANK_START           (0x200000U)
 #define BSP_FEATURE_FLASH_HP_CF_REGION0_BLOCK_SIZE        (0x2000U)
 #define BSP_FEATURE_FLASH_HP_CF_REGION0_SIZE              (0x10000U)
 #define BSP_FEATURE_FLASH_HP_CF_REGION1_BLOCK_SIZE        (0x8000U)
@@ -175,6 +176,7 @@
 #define BSP_FEATURE_FLASH_HP_DF_BLOCK_SIZE                (64U)
 #define BSP_FEATURE_FLASH_HP_DF_WRITE_SIZE                (4U)
 #define BSP_FEATURE_FLASH_HP_HAS_FMEPROT                  (1)
+#define BSP_FEATURE_FLASH_HP_SUPPORTS_DUAL_BANK           (1)
 #define BSP_FEATURE_FLASH_HP_VERSION                      (40U)
 #define BSP_FEATURE_FLASH_LP_AWS_FAW_MASK                 (0) // Feature not available on this MCU
 #define BSP_FEATURE_FLASH_LP_AWS_FAW_SHIFT                (0) // Feature not available on this MCU
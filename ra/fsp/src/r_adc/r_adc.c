@@ -78,6 +78,20 @@
 
 #define ADC_PRV_TSCR_TSN_ENABLE                     (R_TSN_CTRL_TSCR_TSEN_Msk | R_TSN_CTRL_TSCR_TSOE_Msk)
 
+/* Set ADC_CFG_RAMFUNC_ENABLE to 1 to execute the scan end interrupt handlers, R_ADC_ScanStart and R_ADC_Read from
+ * RAM. Otherwise the scan end handlers follow BSP_ISR_IN_RAM. */
+#ifndef ADC_CFG_RAMFUNC_ENABLE
+ #define ADC_CFG_RAMFUNC_ENABLE                     (0)
+#endif
+
+#if ADC_CFG_RAMFUNC_ENABLE
+ #define ADC_PRV_RAMFUNC                            BSP_PLACE_IN_RAM
+ #define ADC_PRV_ISR_RAMFUNC                        BSP_PLACE_IN_RAM
+#else
+ #define ADC_PRV_RAMFUNC
+ #define ADC_PRV_ISR_RAMFUNC                        BSP_ISR_IN_RAM
+#endif
+
 /***********************************************************************************************************************
  * Typedef definitions
  **********************************************************************************************************************/
@@ -129,10 +143,17 @@ static fsp_err_t r_adc_scan_cfg_check(adc_instance_ctrl_t * const     p_instance
 static void r_adc_scan_cfg(adc_instance_ctrl_t * const     p_instance_ctrl,
                            adc_channel_cfg_t const * const p_channel_cfg);
 static void    r_adc_sensor_sample_state_calculation(uint32_t * const p_sample_states);
-void           adc_scan_end_b_isr(void);
-void           adc_scan_end_isr(void);
+void           adc_scan_end_b_isr(void) ADC_PRV_ISR_RAMFUNC;
+void           adc_scan_end_isr(void) ADC_PRV_ISR_RAMFUNC;
 static int32_t r_adc_lowest_channel_get(uint32_t adc_mask);
-static void    r_adc_scan_end_common_isr(adc_event_t event);
+static void    r_adc_scan_end_common_isr(adc_event_t event) ADC_PRV_RAMFUNC;
+static void    r_adc_stream_decimate(adc_instance_ctrl_t * const p_instance_ctrl,
+                                     uint16_t const * const      p_data,
+                                     int32_t * const             p_out) ADC_PRV_RAMFUNC;
+
+/* Scans are typically restarted and read from a timer or scan end callback. */
+fsp_err_t R_ADC_ScanStart(adc_ctrl_t * p_ctrl) ADC_PRV_RAMFUNC;
+fsp_err_t R_ADC_Read(adc_ctrl_t * p_ctrl, adc_channel_t const reg_id, uint16_t * const p_data) ADC_PRV_RAMFUNC;
 
 /** Version data structure used by error logger macro. */
 static const fsp_version_t g_adc_version =
@@ -243,6 +264,7 @@ fsp_err_t R_ADC_Open (adc_ctrl_t * p_ctrl, adc_cfg_t const * const p_cfg)
     p_instance_ctrl->p_callback        = p_cfg->p_callback;
     p_instance_ctrl->p_context         = p_cfg->p_context;
     p_instance_ctrl->p_callback_memory = NULL;
+    p_instance_ctrl->p_stream_cfg      = NULL;
 
     /* Calculate the register base address. */
     uint32_t address_gap = (uint32_t) R_ADC1 - (uint32_t) R_ADC0;
@@ -804,6 +826,197 @@ fsp_err_t R_ADC_OffsetSet (adc_ctrl_t * const p_ctrl, adc_channel_t const reg_id
     return FSP_ERR_UNSUPPORTED;
 }
 
+/*******************************************************************************************************************//**
+ * Starts continuous acquisition into a circular buffer. The scan trigger configured in R_ADC_Open (GPT through ELC)
+ * sets the sample rate and the DMAC moves the results of each scan. R_ADC_StreamTransferEnd, called from the DMAC
+ * callback, optionally decimates each filled buffer half with a CIC filter and calls adc_stream_cfg_t::p_callback.
+ *
+ * @pre Call R_ADC_ScanCfg before starting the stream. The scan end interrupt must be disabled (scan_end_irq set to
+ * FSP_INVALID_VECTOR) and the DMAC must be configured with the scan end event as activation source and chain loop
+ * enabled.
+ *
+ * @retval FSP_SUCCESS                 Stream started.
+ * @retval FSP_ERR_ASSERTION           An input argument is invalid.
+ * @retval FSP_ERR_NOT_OPEN            Unit is not open.
+ * @retval FSP_ERR_IN_USE              A stream is already running.
+ * @retval FSP_ERR_INVALID_ARGUMENT    No channels are scanned, or more than ADC_STREAM_REGISTER_MAX result registers
+ *                                     are transferred.
+ * @return                             See @ref RENESAS_ERROR_CODES or functions called by this function for other
+ *                                     possible return codes.
+ **********************************************************************************************************************/
+fsp_err_t R_ADC_StreamStart (adc_ctrl_t * p_ctrl, adc_stream_cfg_t const * const p_stream_cfg)
+{
+    adc_instance_ctrl_t * p_instance_ctrl = (adc_instance_ctrl_t *) p_ctrl;
+    adc_info_t            adc_info;
+    fsp_err_t             err;
+
+#if ADC_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_instance_ctrl);
+    FSP_ASSERT(NULL != p_stream_cfg);
+    FSP_ASSERT(NULL != p_stream_cfg->p_transfer);
+    FSP_ASSERT(NULL != p_stream_cfg->p_buffer);
+    FSP_ASSERT(0U != p_stream_cfg->num_half_scans);
+    FSP_ASSERT(0U != p_stream_cfg->decimation);
+    FSP_ASSERT(0U == (p_stream_cfg->num_half_scans % p_stream_cfg->decimation));
+    if (p_stream_cfg->decimation > 1U)
+    {
+        FSP_ASSERT(NULL != p_stream_cfg->p_cic);
+        FSP_ASSERT(NULL != p_stream_cfg->p_decimated);
+        FSP_ASSERT((p_stream_cfg->cic_order > 0U) && (p_stream_cfg->cic_order <= ADC_STREAM_CIC_ORDER_MAX));
+    }
+
+    FSP_ERROR_RETURN(ADC_OPEN == p_instance_ctrl->opened, FSP_ERR_NOT_OPEN);
+#endif
+    FSP_ERROR_RETURN(NULL == p_instance_ctrl->p_stream_cfg, FSP_ERR_IN_USE);
+
+    /* All result registers from the lowest to the highest scanned channel are moved as one block per scan. */
+    (void) R_ADC_InfoGet(p_instance_ctrl, &adc_info);
+    FSP_ERROR_RETURN((adc_info.length > 0U) && (adc_info.length <= ADC_STREAM_REGISTER_MAX),
+                     FSP_ERR_INVALID_ARGUMENT);
+
+    /* The CIC gain (decimation ^ order) must keep a 16-bit result within 32 bits. */
+    uint32_t gain = 1U;
+    if (p_stream_cfg->decimation > 1U)
+    {
+        for (uint32_t i = 0U; i < p_stream_cfg->cic_order; i++)
+        {
+            gain *= p_stream_cfg->decimation;
+        }
+
+        FSP_ERROR_RETURN(gain <= UINT16_MAX, FSP_ERR_INVALID_ARGUMENT);
+
+        for (uint32_t i = 0U; i < adc_info.length; i++)
+        {
+            for (uint32_t j = 0U; j < ADC_STREAM_CIC_ORDER_MAX; j++)
+            {
+                p_stream_cfg->p_cic[i].integrator[j] = 0U;
+                p_stream_cfg->p_cic[i].comb[j]       = 0U;
+            }
+        }
+    }
+
+    p_instance_ctrl->stream_registers = adc_info.length;
+    p_instance_ctrl->stream_gain      = gain;
+
+    /* Two link DMAC chain, one link per buffer half, looped by the DMAC. Each link transfers one block per scan end
+     * event with the source rewound to the first result register after each block. */
+    for (uint32_t i = 0U; i < 2U; i++)
+    {
+        transfer_info_t * p_info = &p_instance_ctrl->stream_info[i];
+
+        p_info->transfer_settings_word = 0U;
+
+        p_info->mode           = TRANSFER_MODE_BLOCK;
+        p_info->size           = TRANSFER_SIZE_2_BYTE;
+        p_info->src_addr_mode  = TRANSFER_ADDR_MODE_INCREMENTED;
+        p_info->dest_addr_mode = TRANSFER_ADDR_MODE_INCREMENTED;
+        p_info->repeat_area    = TRANSFER_REPEAT_AREA_SOURCE;
+        p_info->irq            = TRANSFER_IRQ_EACH;
+        p_info->chain_mode     = (0U == i) ? TRANSFER_CHAIN_MODE_END : TRANSFER_CHAIN_MODE_DISABLED;
+        p_info->p_src          = (void const *) adc_info.p_address;
+        p_info->p_dest         = &p_stream_cfg->p_buffer[i * p_stream_cfg->num_half_scans * adc_info.length];
+        p_info->num_blocks     = p_stream_cfg->num_half_scans;
+        p_info->length         = (uint16_t) adc_info.length;
+    }
+
+    transfer_instance_t const * p_transfer = p_stream_cfg->p_transfer;
+    err = p_transfer->p_api->open(p_transfer->p_ctrl, p_transfer->p_cfg);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+    err = p_transfer->p_api->reconfigure(p_transfer->p_ctrl, &p_instance_ctrl->stream_info[0]);
+    if (FSP_SUCCESS != err)
+    {
+        (void) p_transfer->p_api->close(p_transfer->p_ctrl);
+
+        return err;
+    }
+
+    p_instance_ctrl->p_stream_cfg = p_stream_cfg;
+
+    /* Enable the hardware trigger. */
+    p_instance_ctrl->p_reg->ADCSR = p_instance_ctrl->scan_start_adcsr;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Stops the stream started by R_ADC_StreamStart and closes the DMAC instance. A scan in progress is not aborted.
+ *
+ * @retval FSP_SUCCESS                 Stream stopped.
+ * @retval FSP_ERR_ASSERTION           An input argument is invalid.
+ * @retval FSP_ERR_NOT_OPEN            Unit is not open.
+ * @retval FSP_ERR_NOT_ENABLED         No stream is running.
+ **********************************************************************************************************************/
+fsp_err_t R_ADC_StreamStop (adc_ctrl_t * p_ctrl)
+{
+    adc_instance_ctrl_t * p_instance_ctrl = (adc_instance_ctrl_t *) p_ctrl;
+
+#if ADC_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_instance_ctrl);
+    FSP_ERROR_RETURN(ADC_OPEN == p_instance_ctrl->opened, FSP_ERR_NOT_OPEN);
+#endif
+    FSP_ERROR_RETURN(NULL != p_instance_ctrl->p_stream_cfg, FSP_ERR_NOT_ENABLED);
+
+    /* Disable the hardware trigger. */
+    p_instance_ctrl->p_reg->ADCSR = 0U;
+
+    transfer_instance_t const * p_transfer = p_instance_ctrl->p_stream_cfg->p_transfer;
+    (void) p_transfer->p_api->close(p_transfer->p_ctrl);
+
+    p_instance_ctrl->p_stream_cfg = NULL;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Processes a filled buffer half. Call from the DMAC callback with the completed link (dmac_callback_args_t::p_info).
+ * The next half is already being filled by the DMAC, so decimation and adc_stream_cfg_t::p_callback must complete
+ * within one buffer half.
+ *
+ * @retval FSP_SUCCESS                 Buffer half processed.
+ * @retval FSP_ERR_ASSERTION           An input argument is invalid.
+ * @retval FSP_ERR_NOT_ENABLED         No stream is running.
+ **********************************************************************************************************************/
+fsp_err_t R_ADC_StreamTransferEnd (adc_ctrl_t * p_ctrl, transfer_info_t const * const p_info)
+{
+    adc_instance_ctrl_t * p_instance_ctrl = (adc_instance_ctrl_t *) p_ctrl;
+
+#if ADC_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_instance_ctrl);
+    FSP_ASSERT(NULL != p_info);
+#endif
+
+    adc_stream_cfg_t const * p_stream_cfg = p_instance_ctrl->p_stream_cfg;
+    FSP_ERROR_RETURN(NULL != p_stream_cfg, FSP_ERR_NOT_ENABLED);
+
+    uint32_t                   half      = (p_info == &p_instance_ctrl->stream_info[1]) ? 1U : 0U;
+    uint32_t                   registers = p_instance_ctrl->stream_registers;
+    uint32_t                   samples   = (uint32_t) p_stream_cfg->num_half_scans / p_stream_cfg->decimation;
+    adc_stream_callback_args_t args;
+
+    args.event         = (adc_stream_event_t) half;
+    args.p_data        = &p_stream_cfg->p_buffer[half * p_stream_cfg->num_half_scans * registers];
+    args.p_decimated   = NULL;
+    args.num_scans     = p_stream_cfg->num_half_scans;
+    args.num_decimated = 0U;
+    args.num_registers = registers;
+    args.p_context     = p_stream_cfg->p_context;
+
+    if (p_stream_cfg->decimation > 1U)
+    {
+        r_adc_stream_decimate(p_instance_ctrl, args.p_data, p_stream_cfg->p_decimated);
+        args.p_decimated   = p_stream_cfg->p_decimated;
+        args.num_decimated = samples;
+    }
+
+    if (NULL != p_stream_cfg->p_callback)
+    {
+        p_stream_cfg->p_callback(&args);
+    }
+
+    return FSP_SUCCESS;
+}
+
 /*******************************************************************************************************************//**
  * @} (end addtogroup ADC)
  **********************************************************************************************************************/
@@ -1457,6 +1670,56 @@ static int32_t r_adc_lowest_channel_get (uint32_t adc_mask)
     return adc_mask_count;
 }
 
+/*******************************************************************************************************************//**
+ * Decimates a buffer half with a CIC filter (integrators at the input rate, differential delay 1 combs at the output
+ * rate). The filter runs in modulo 2^32 arithmetic, so integrator overflow does not affect the result.
+ *
+ * @param[in]  p_instance_ctrl         Pointer to instance control structure
+ * @param[in]  p_data                  Results of the buffer half
+ * @param[out] p_out                   Decimated results, normalized by the filter gain
+ **********************************************************************************************************************/
+static void r_adc_stream_decimate (adc_instance_ctrl_t * const p_instance_ctrl,
+                                   uint16_t const * const      p_data,
+                                   int32_t * const             p_out)
+{
+    adc_stream_cfg_t const * p_stream_cfg = p_instance_ctrl->p_stream_cfg;
+    uint32_t                 registers    = p_instance_ctrl->stream_registers;
+    uint32_t                 order        = p_stream_cfg->cic_order;
+    uint32_t                 decimation   = p_stream_cfg->decimation;
+    uint32_t                 samples      = (uint32_t) p_stream_cfg->num_half_scans / decimation;
+
+    for (uint32_t r = 0U; r < registers; r++)
+    {
+        adc_stream_cic_t * p_cic = &p_stream_cfg->p_cic[r];
+        uint16_t const   * p_in  = &p_data[r];
+
+        for (uint32_t n = 0U; n < samples; n++)
+        {
+            for (uint32_t k = 0U; k < decimation; k++)
+            {
+                uint32_t value = *p_in;
+                p_in += registers;
+
+                for (uint32_t i = 0U; i < order; i++)
+                {
+                    p_cic->integrator[i] += value;
+                    value                 = p_cic->integrator[i];
+                }
+            }
+
+            uint32_t value = p_cic->integrator[order - 1U];
+            for (uint32_t i = 0U; i < order; i++)
+            {
+                uint32_t delayed = p_cic->comb[i];
+                p_cic->comb[i] = value;
+                value         -= delayed;
+            }
+
+            p_out[(n * registers) + r] = (int32_t) (value / p_instance_ctrl->stream_gain);
+        }
+    }
+}
+
 /*******************************************************************************************************************//**
  * Clears interrupt flag and calls a callback to notify application of the event.
  *
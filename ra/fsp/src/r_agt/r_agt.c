@@ -52,6 +52,21 @@
 #define AGT_PRV_AGTCMSR_PIN_B_OFFSET            (4U)
 #define AGT_PRV_AGTCMSR_VALID_BITS              (0x77U)
 
+/* Transfers run by the measurement history. Repeat mode reloads the register transfers for every activation and wraps
+ * the circular buffers. No CPU interrupt is requested. */
+#define AGT_PRV_DTC_HISTORY_READ_SETTINGS       ((TRANSFER_MODE_REPEAT << 30U) | (TRANSFER_ADDR_MODE_FIXED << 26U) | \
+                                                 (TRANSFER_IRQ_END << 21U) |                                       \
+                                                 (TRANSFER_REPEAT_AREA_DESTINATION << 20U) |                       \
+                                                 (TRANSFER_ADDR_MODE_INCREMENTED << 18U))
+#define AGT_PRV_DTC_HISTORY_WRITE_SETTINGS      ((TRANSFER_MODE_REPEAT << 30U) | (TRANSFER_ADDR_MODE_FIXED << 26U) | \
+                                                 (TRANSFER_IRQ_END << 21U) |                                       \
+                                                 (TRANSFER_REPEAT_AREA_SOURCE << 20U) |                            \
+                                                 (TRANSFER_ADDR_MODE_FIXED << 18U))
+
+/* Entries per history are limited by the DTC repeat counter. */
+#define AGT_PRV_DTC_MAX_REPEAT_TRANSFER         (0x100U)
+#define AGT_PRV_DTC_REPEAT_REMAINING_MASK       (0xFFU)
+
 /**********************************************************************************************************************
  * Typedef definitions
  **********************************************************************************************************************/
@@ -77,6 +92,17 @@ static fsp_err_t r_agt_open_param_checking(agt_instance_ctrl_t * p_instance_ctrl
 
 #endif
 
+#if AGT_CFG_INPUT_SUPPORT_ENABLE
+static uint32_t r_agt_history_head_get(agt_instance_ctrl_t * p_instance_ctrl);
+static bool     r_agt_history_decode(agt_instance_ctrl_t * p_instance_ctrl,
+                                     uint32_t              head,
+                                     uint32_t            * p_tail,
+                                     uint32_t            * p_extension,
+                                     uint32_t            * p_measurement);
+static uint32_t r_agt_sqrt(uint64_t value);
+
+#endif
+
 /* ISRs. */
 void agt_int_isr(void);
 
@@ -190,6 +216,8 @@ fsp_err_t R_AGT_Open (timer_ctrl_t * const p_ctrl, timer_cfg_t const * const p_c
     p_instance_ctrl->p_context         = p_cfg->p_context;
     p_instance_ctrl->p_callback_memory = NULL;
 
+    p_instance_ctrl->p_history = NULL;
+
     p_instance_ctrl->open = AGT_OPEN;
 
     /* All done.  */
@@ -555,6 +583,16 @@ fsp_err_t R_AGT_Close (timer_ctrl_t * const p_ctrl)
     fsp_err_t err = r_agt_common_preamble(p_instance_ctrl);
     FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
 
+#if AGT_CFG_INPUT_SUPPORT_ENABLE
+    if (NULL != p_instance_ctrl->p_history)
+    {
+        /* Stop the AGT interrupt from activating the history transfers. */
+        transfer_instance_t const * p_transfer = p_instance_ctrl->p_history->p_transfer;
+        (void) p_transfer->p_api->disable(p_transfer->p_ctrl);
+        p_instance_ctrl->p_history = NULL;
+    }
+#endif
+
     /* Cleanup the device: Stop counter, disable interrupts, and power down if no other channels are in use. */
 
     /* Stop timer */
@@ -593,6 +631,290 @@ fsp_err_t R_AGT_VersionGet (fsp_version_t * const p_version)
     return FSP_SUCCESS;
 }
 
+/*******************************************************************************************************************//**
+ * Starts recording the measurements of pulse width or pulse period measurement mode in a circular history, without
+ * a CPU interrupt per measurement.
+ *
+ * Each AGT interrupt activates a DTC chain that stores the captured counter and the AGTCR status flags in the
+ * history and clears the flags. In pulse width measurement mode the chain also resets the counter, which is done by
+ * the interrupt otherwise. R_AGT_HistoryRead and R_AGT_HistoryStatisticsGet decode the history on demand; underflows
+ * recorded between two captures extend the measurement to 32 bits, so pulses longer than the timer period are
+ * measured correctly.
+ *
+ * The transfer instance must use the DTC with cycle_end_irq as activation source. The callback is not called for
+ * recorded measurements. To record measurements in Software Standby mode, count from LOCO or the subclock and
+ * configure the low power mode instance to enter Snooze mode on the AGT interrupt, with the DTC enabled in Snooze
+ * mode. Read the history before more than num_entries interrupts occur; older entries are overwritten. Call this
+ * function before R_AGT_Start and do not change the period while the history is running.
+ *
+ * @retval FSP_SUCCESS                 Measurement history started.
+ * @retval FSP_ERR_ASSERTION           A required pointer is NULL, num_entries is out of range, or the instance is not
+ *                                     configured for a measurement mode with an interrupt.
+ * @retval FSP_ERR_NOT_OPEN            The instance control structure is not opened.
+ * @retval FSP_ERR_IN_USE              A measurement history is already running.
+ * @retval FSP_ERR_UNSUPPORTED         AGT_CFG_INPUT_SUPPORT_ENABLE is set to 0.
+ *
+ * @return See @ref RENESAS_ERROR_CODES or functions called by this function for other possible return codes. This
+ *         function calls:
+ *           - @ref transfer_api_t::reconfigure
+ **********************************************************************************************************************/
+fsp_err_t R_AGT_HistoryStart (timer_ctrl_t * const p_ctrl, agt_history_cfg_t const * const p_history)
+{
+#if AGT_CFG_INPUT_SUPPORT_ENABLE
+    agt_instance_ctrl_t * p_instance_ctrl = (agt_instance_ctrl_t *) p_ctrl;
+
+ #if AGT_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_history);
+    FSP_ASSERT(NULL != p_history->p_transfer);
+    FSP_ASSERT(NULL != p_history->p_counts);
+    FSP_ASSERT(NULL != p_history->p_flags);
+    FSP_ASSERT(0U < p_history->num_entries);
+    FSP_ASSERT(p_history->num_entries <= AGT_PRV_DTC_MAX_REPEAT_TRANSFER);
+ #endif
+
+    fsp_err_t err = r_agt_common_preamble(p_instance_ctrl);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+    agt_extended_cfg_t const * p_extend = (agt_extended_cfg_t const *) p_instance_ctrl->p_cfg->p_extend;
+
+ #if AGT_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(AGT_MEASURE_DISABLED != p_extend->measurement_mode);
+    FSP_ASSERT(p_instance_ctrl->p_cfg->cycle_end_irq >= 0);
+ #endif
+
+    FSP_ERROR_RETURN(NULL == p_instance_ctrl->p_history, FSP_ERR_IN_USE);
+
+    /* Writing 0 to the status flags clears them; TSTART stays set so the count continues. */
+    p_instance_ctrl->history_agtcr  = (uint8_t) R_AGT0_AGTCR_TSTART_Msk;
+    p_instance_ctrl->history_reload = (uint16_t) (p_instance_ctrl->period - 1U);
+
+    /* Counter, read from the read-out buffer in measurement modes. */
+    p_instance_ctrl->history_info[0].transfer_settings_word = AGT_PRV_DTC_HISTORY_READ_SETTINGS;
+    p_instance_ctrl->history_info[0].size                   = TRANSFER_SIZE_2_BYTE;
+    p_instance_ctrl->history_info[0].chain_mode             = TRANSFER_CHAIN_MODE_EACH;
+    p_instance_ctrl->history_info[0].p_src                  = (void const *) &p_instance_ctrl->p_reg->AGT;
+    p_instance_ctrl->history_info[0].p_dest                 = p_history->p_counts;
+    p_instance_ctrl->history_info[0].num_blocks             = 0U;
+    p_instance_ctrl->history_info[0].length                 = (uint16_t) p_history->num_entries;
+
+    /* Status flags, telling captures from underflows. */
+    p_instance_ctrl->history_info[1].transfer_settings_word = AGT_PRV_DTC_HISTORY_READ_SETTINGS;
+    p_instance_ctrl->history_info[1].size                   = TRANSFER_SIZE_1_BYTE;
+    p_instance_ctrl->history_info[1].chain_mode             = TRANSFER_CHAIN_MODE_EACH;
+    p_instance_ctrl->history_info[1].p_src                  = (void const *) &p_instance_ctrl->p_reg->AGTCR;
+    p_instance_ctrl->history_info[1].p_dest                 = p_history->p_flags;
+    p_instance_ctrl->history_info[1].num_blocks             = 0U;
+    p_instance_ctrl->history_info[1].length                 = (uint16_t) p_history->num_entries;
+
+    /* Clear the status flags. */
+    p_instance_ctrl->history_info[2].transfer_settings_word = AGT_PRV_DTC_HISTORY_WRITE_SETTINGS;
+    p_instance_ctrl->history_info[2].size                   = TRANSFER_SIZE_1_BYTE;
+    p_instance_ctrl->history_info[2].p_src                  = &p_instance_ctrl->history_agtcr;
+    p_instance_ctrl->history_info[2].p_dest                 = (void *) &p_instance_ctrl->p_reg->AGTCR;
+    p_instance_ctrl->history_info[2].num_blocks             = 0U;
+    p_instance_ctrl->history_info[2].length                 = 1U;
+
+    /* The counter is not reset by hardware in pulse width measurement mode. */
+    if (AGT_PRV_AGTMR1_TMOD_PULSE_WIDTH == p_instance_ctrl->p_reg->AGTMR1_b.TMOD)
+    {
+        p_instance_ctrl->history_info[2].chain_mode = TRANSFER_CHAIN_MODE_EACH;
+
+        p_instance_ctrl->history_info[3].transfer_settings_word = AGT_PRV_DTC_HISTORY_WRITE_SETTINGS;
+        p_instance_ctrl->history_info[3].size                   = TRANSFER_SIZE_2_BYTE;
+        p_instance_ctrl->history_info[3].p_src                  = &p_instance_ctrl->history_reload;
+        p_instance_ctrl->history_info[3].p_dest                 = (void *) &p_instance_ctrl->p_reg->AGT;
+        p_instance_ctrl->history_info[3].num_blocks             = 0U;
+        p_instance_ctrl->history_info[3].length                 = 1U;
+    }
+
+    p_instance_ctrl->history_tail      = 0U;
+    p_instance_ctrl->history_extension = 0U;
+
+    transfer_instance_t const * p_transfer = p_history->p_transfer;
+    err = p_transfer->p_api->reconfigure(p_transfer->p_ctrl, &p_instance_ctrl->history_info[0]);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+    p_instance_ctrl->p_history = p_history;
+
+    return FSP_SUCCESS;
+#else
+    FSP_PARAMETER_NOT_USED(p_ctrl);
+    FSP_PARAMETER_NOT_USED(p_history);
+
+    return FSP_ERR_UNSUPPORTED;
+#endif
+}
+
+/*******************************************************************************************************************//**
+ * Reads the oldest unread measurements from the history. Measurements are in counts, the same as
+ * timer_callback_args_t::capture, and are removed from the history.
+ *
+ * @param[in]  p_ctrl                  Pointer to the instance control structure.
+ * @param[out] p_dest                  Buffer for the measurements.
+ * @param[in]  max_measurements        Number of measurements that fit in p_dest.
+ * @param[out] p_count                 Number of measurements stored in p_dest.
+ *
+ * @retval FSP_SUCCESS                 Measurements stored in p_dest.
+ * @retval FSP_ERR_ASSERTION           A required pointer is NULL.
+ * @retval FSP_ERR_NOT_OPEN            The instance control structure is not opened.
+ * @retval FSP_ERR_NOT_ENABLED         No measurement history is running.
+ * @retval FSP_ERR_UNSUPPORTED         AGT_CFG_INPUT_SUPPORT_ENABLE is set to 0.
+ **********************************************************************************************************************/
+fsp_err_t R_AGT_HistoryRead (timer_ctrl_t * const p_ctrl,
+                             uint32_t * const     p_dest,
+                             uint32_t const       max_measurements,
+                             uint32_t * const     p_count)
+{
+#if AGT_CFG_INPUT_SUPPORT_ENABLE
+    agt_instance_ctrl_t * p_instance_ctrl = (agt_instance_ctrl_t *) p_ctrl;
+
+ #if AGT_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_dest);
+    FSP_ASSERT(NULL != p_count);
+ #endif
+
+    fsp_err_t err = r_agt_common_preamble(p_instance_ctrl);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+    FSP_ERROR_RETURN(NULL != p_instance_ctrl->p_history, FSP_ERR_NOT_ENABLED);
+
+    uint32_t head  = r_agt_history_head_get(p_instance_ctrl);
+    uint32_t count = 0U;
+
+    while ((count < max_measurements) &&
+           r_agt_history_decode(p_instance_ctrl, head, &p_instance_ctrl->history_tail,
+                                &p_instance_ctrl->history_extension, &p_dest[count]))
+    {
+        count++;
+    }
+
+    *p_count = count;
+
+    return FSP_SUCCESS;
+#else
+    FSP_PARAMETER_NOT_USED(p_ctrl);
+    FSP_PARAMETER_NOT_USED(p_dest);
+    FSP_PARAMETER_NOT_USED(max_measurements);
+    FSP_PARAMETER_NOT_USED(p_count);
+
+    return FSP_ERR_UNSUPPORTED;
+#endif
+}
+
+/*******************************************************************************************************************//**
+ * Computes the minimum, maximum, mean and jitter (standard deviation) of all unread measurements in the history and
+ * removes them from the history. All values are 0 if there are no unread measurements.
+ *
+ * @retval FSP_SUCCESS                 Statistics stored in p_statistics.
+ * @retval FSP_ERR_ASSERTION           A required pointer is NULL.
+ * @retval FSP_ERR_NOT_OPEN            The instance control structure is not opened.
+ * @retval FSP_ERR_NOT_ENABLED         No measurement history is running.
+ * @retval FSP_ERR_UNSUPPORTED         AGT_CFG_INPUT_SUPPORT_ENABLE is set to 0.
+ **********************************************************************************************************************/
+fsp_err_t R_AGT_HistoryStatisticsGet (timer_ctrl_t * const p_ctrl, agt_history_statistics_t * const p_statistics)
+{
+#if AGT_CFG_INPUT_SUPPORT_ENABLE
+    agt_instance_ctrl_t * p_instance_ctrl = (agt_instance_ctrl_t *) p_ctrl;
+
+ #if AGT_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_statistics);
+ #endif
+
+    fsp_err_t err = r_agt_common_preamble(p_instance_ctrl);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+    FSP_ERROR_RETURN(NULL != p_instance_ctrl->p_history, FSP_ERR_NOT_ENABLED);
+
+    /* Entries added after this point are left for the next call. */
+    uint32_t head = r_agt_history_head_get(p_instance_ctrl);
+
+    /* First pass: count, range and mean. */
+    uint32_t tail        = p_instance_ctrl->history_tail;
+    uint32_t extension   = p_instance_ctrl->history_extension;
+    uint32_t measurement = 0U;
+    uint32_t count       = 0U;
+    uint32_t min         = UINT32_MAX;
+    uint32_t max         = 0U;
+    uint64_t sum         = 0U;
+    while (r_agt_history_decode(p_instance_ctrl, head, &tail, &extension, &measurement))
+    {
+        min  = (measurement < min) ? measurement : min;
+        max  = (measurement > max) ? measurement : max;
+        sum += measurement;
+        count++;
+    }
+
+    p_statistics->count  = count;
+    p_statistics->min    = 0U;
+    p_statistics->max    = 0U;
+    p_statistics->mean   = 0U;
+    p_statistics->jitter = 0U;
+
+    if (0U < count)
+    {
+        uint32_t mean = (uint32_t) (sum / count);
+
+        /* Second pass over the same entries: deviation from the mean. The sum saturates for deviations that are a
+         * large fraction of the 32-bit range. */
+        uint64_t sum_squares = 0U;
+        while (r_agt_history_decode(p_instance_ctrl, head, &p_instance_ctrl->history_tail,
+                                    &p_instance_ctrl->history_extension, &measurement))
+        {
+            uint64_t deviation = (measurement > mean) ? (measurement - mean) : (mean - measurement);
+            uint64_t square    = deviation * deviation;
+            sum_squares = (sum_squares > (UINT64_MAX - square)) ? UINT64_MAX : (sum_squares + square);
+        }
+
+        p_statistics->min    = min;
+        p_statistics->max    = max;
+        p_statistics->mean   = mean;
+        p_statistics->jitter = r_agt_sqrt(sum_squares / count);
+    }
+
+    return FSP_SUCCESS;
+#else
+    FSP_PARAMETER_NOT_USED(p_ctrl);
+    FSP_PARAMETER_NOT_USED(p_statistics);
+
+    return FSP_ERR_UNSUPPORTED;
+#endif
+}
+
+/*******************************************************************************************************************//**
+ * Stops the measurement history. The AGT interrupt calls the callback for each measurement again. Unread
+ * measurements are discarded.
+ *
+ * @retval FSP_SUCCESS                 Measurement history stopped.
+ * @retval FSP_ERR_ASSERTION           p_ctrl is NULL.
+ * @retval FSP_ERR_NOT_OPEN            The instance control structure is not opened.
+ * @retval FSP_ERR_NOT_ENABLED         No measurement history is running.
+ * @retval FSP_ERR_UNSUPPORTED         AGT_CFG_INPUT_SUPPORT_ENABLE is set to 0.
+ *
+ * @return See @ref RENESAS_ERROR_CODES or functions called by this function for other possible return codes. This
+ *         function calls:
+ *           - @ref transfer_api_t::disable
+ **********************************************************************************************************************/
+fsp_err_t R_AGT_HistoryStop (timer_ctrl_t * const p_ctrl)
+{
+#if AGT_CFG_INPUT_SUPPORT_ENABLE
+    agt_instance_ctrl_t * p_instance_ctrl = (agt_instance_ctrl_t *) p_ctrl;
+
+    fsp_err_t err = r_agt_common_preamble(p_instance_ctrl);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+    FSP_ERROR_RETURN(NULL != p_instance_ctrl->p_history, FSP_ERR_NOT_ENABLED);
+
+    transfer_instance_t const * p_transfer = p_instance_ctrl->p_history->p_transfer;
+    err = p_transfer->p_api->disable(p_transfer->p_ctrl);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+    p_instance_ctrl->p_history = NULL;
+
+    return FSP_SUCCESS;
+#else
+    FSP_PARAMETER_NOT_USED(p_ctrl);
+
+    return FSP_ERR_UNSUPPORTED;
+#endif
+}
+
 /** @} (end addtogroup AGT) */
 
 /***********************************************************************************************************************
@@ -891,6 +1213,120 @@ static uint32_t r_agt_clock_frequency_get (R_AGT0_Type * p_agt_regs)
     return clock_freq_hz;
 }
 
+#if AGT_CFG_INPUT_SUPPORT_ENABLE
+
+/*******************************************************************************************************************//**
+ * Gets the history entry the DTC will write next.
+ *
+ * @param[in]  p_instance_ctrl    Control block for this instance
+ *
+ * @return     Index of the next entry written.
+ **********************************************************************************************************************/
+static uint32_t r_agt_history_head_get (agt_instance_ctrl_t * p_instance_ctrl)
+{
+    uint32_t num_entries = p_instance_ctrl->p_history->num_entries;
+
+    /* The flags are written after the counter, so the remaining count of the flags transfer marks entries that are
+     * complete. The DTC writes the remaining count back to the transfer information. A 256 entry history reads 0
+     * when it has just wrapped. */
+    uint32_t remaining = p_instance_ctrl->history_info[1].length & AGT_PRV_DTC_REPEAT_REMAINING_MASK;
+
+    return (num_entries - remaining) % num_entries;
+}
+
+/*******************************************************************************************************************//**
+ * Decodes history entries up to the next measurement. Underflows are accumulated until the capture that ends the
+ * measurement.
+ *
+ * @param[in]     p_instance_ctrl    Control block for this instance
+ * @param[in]     head               Entry the DTC writes next
+ * @param[in,out] p_tail             Next entry to decode
+ * @param[in,out] p_extension        Counts of the underflows decoded since the last capture
+ * @param[out]    p_measurement      Measurement in counts
+ *
+ * @retval     true               A measurement was decoded.
+ * @retval     false              No complete measurement is left before head.
+ **********************************************************************************************************************/
+static bool r_agt_history_decode (agt_instance_ctrl_t * p_instance_ctrl,
+                                  uint32_t              head,
+                                  uint32_t            * p_tail,
+                                  uint32_t            * p_extension,
+                                  uint32_t            * p_measurement)
+{
+    agt_history_cfg_t const * p_history = p_instance_ctrl->p_history;
+
+    while (*p_tail != head)
+    {
+        uint32_t entry = *p_tail;
+        uint32_t flags = p_history->p_flags[entry];
+        *p_tail = (entry + 1U) % p_history->num_entries;
+
+        if (flags & R_AGT0_AGTCR_TUNDF_Msk)
+        {
+            *p_extension += p_instance_ctrl->period;
+        }
+
+        /* An edge between the flag read and the flag clear of the previous entry leaves an entry without flags. Its
+         * counter holds the capture of that edge. When both flags are set the underflow came first, the edge would
+         * have reloaded the counter otherwise. */
+        if ((flags & R_AGT0_AGTCR_TEDGF_Msk) || (0U == (flags & R_AGT0_AGTCR_TUNDF_Msk)))
+        {
+            uint32_t measurement = (p_instance_ctrl->period - 1U) - p_history->p_counts[entry];
+
+            /* Period of input pulse = (initial value of counter [AGT register] - reading value of the read-out buffer)
+             * + 1. Reference section 25.4.5 of the RA6M3 manual R01UH0886EJ0100. */
+            if (AGT_PRV_AGTMR1_TMOD_PULSE_WIDTH != p_instance_ctrl->p_reg->AGTMR1_b.TMOD)
+            {
+                measurement++;
+            }
+
+            *p_measurement = *p_extension + measurement;
+            *p_extension   = 0U;
+
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/*******************************************************************************************************************//**
+ * Integer square root.
+ *
+ * @param[in]  value              Radicand
+ *
+ * @return     Square root of value, rounded down.
+ **********************************************************************************************************************/
+static uint32_t r_agt_sqrt (uint64_t value)
+{
+    uint64_t root = 0U;
+    uint64_t bit  = 1ULL << 62U;
+
+    while (bit > value)
+    {
+        bit >>= 2U;
+    }
+
+    while (0U != bit)
+    {
+        if (value >= (root + bit))
+        {
+            value -= root + bit;
+            root   = (root >> 1U) + bit;
+        }
+        else
+        {
+            root >>= 1U;
+        }
+
+        bit >>= 2U;
+    }
+
+    return (uint32_t) root;
+}
+
+#endif
+
 /*********************************************************************************************************************
  * AGT counter underflow interrupt.
  **********************************************************************************************************************/
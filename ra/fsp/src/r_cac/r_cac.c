@@ -76,6 +76,10 @@
 #define CAC_PRV_CASTR_OVFF_OFFSET       (2U)
 #define CAC_PRV_CASTR_OVFF_MASK         (1U << CAC_PRV_CASTR_OVFF_OFFSET)
 
+/* Continuous monitor definitions */
+#define CAC_PRV_PPM                     (1000000)
+#define CAC_PRV_TRIM_STEPS_MAX          (255)
+
 /***********************************************************************************************************************
  * Typedef definitions
  **********************************************************************************************************************/
@@ -94,6 +98,8 @@ void cac_ovfi_isr(void);
 
 static void r_cac_hw_configure(cac_instance_ctrl_t * const p_instance_ctrl);
 static void r_cac_isr_handler(cac_event_t event, uint32_t clear_mask);
+static void r_cac_monitor_update(cac_instance_ctrl_t * const p_instance_ctrl);
+static void r_cac_monitor_trim(cac_instance_ctrl_t * const p_instance_ctrl, int32_t error_average_ppm);
 
 /** Name of module used by error logger macro */
 #if BSP_CFG_ERROR_LOG != 0
@@ -165,6 +171,7 @@ fsp_err_t R_CAC_Open (cac_ctrl_t * const p_ctrl, cac_cfg_t const * const p_cfg)
     p_instance_ctrl->p_callback        = p_cfg->p_callback;
     p_instance_ctrl->p_context         = p_cfg->p_context;
     p_instance_ctrl->p_callback_memory = NULL;
+    p_instance_ctrl->p_monitor         = NULL;
 
     /* Configure the CAC per the configuration. */
     r_cac_hw_configure(p_instance_ctrl);
@@ -301,6 +308,126 @@ fsp_err_t R_CAC_CallbackSet (cac_ctrl_t * const          p_ctrl,
     return FSP_SUCCESS;
 }
 
+/*******************************************************************************************************************//**
+ * Starts continuous monitoring of the clock accuracy. The CAC measures back to back, and each measurement end
+ * interrupt updates the drift statistics returned by R_CAC_MonitorStatusGet(). Every
+ * cac_monitor_cfg_t::average_samples measurements, the averaged error is compared against
+ * cac_monitor_cfg_t::deadband_ppm and, if cac_monitor_cfg_t::p_cgc_ctrl is set, the trimming value of
+ * cac_monitor_cfg_t::trim_clock is stepped toward the expected frequency with R_CGC_ClockTrimSet(). This keeps
+ * HOCO or MOCO within the error budget of high speed UARTs or USB-FS across temperature without a crystal, as long as
+ * the reference clock (for example the subclock or a CACREF input) is accurate.
+ *
+ * The measurement after an overflow or a trimming change is discarded. The user callback is still called for each
+ * CAC event. Upper and lower limits in cac_cfg_t still raise CAC_EVENT_FREQUENCY_ERROR.
+ *
+ * @retval     FSP_SUCCESS               Monitoring started.
+ * @retval     FSP_ERR_ASSERTION         An argument is invalid, or the measurement end interrupt is not enabled.
+ * @retval     FSP_ERR_NOT_OPEN          R_CAC_Open() has not been successfully called.
+ * @return See @ref RENESAS_ERROR_CODES or functions called by this function for other possible return codes.
+ *         This function calls:
+ *             * @ref R_CGC_ClockTrimGet()
+ **********************************************************************************************************************/
+fsp_err_t R_CAC_MonitorStart (cac_ctrl_t * const p_ctrl, cac_monitor_cfg_t const * const p_monitor_cfg)
+{
+    cac_instance_ctrl_t * p_instance_ctrl = (cac_instance_ctrl_t *) p_ctrl;
+
+#if (CAC_CFG_PARAM_CHECKING_ENABLE == 1)
+    FSP_ASSERT(NULL != p_instance_ctrl);
+    FSP_ASSERT(NULL != p_monitor_cfg);
+    FSP_ERROR_RETURN((CAC_OPEN == p_instance_ctrl->open), FSP_ERR_NOT_OPEN);
+    FSP_ASSERT(p_instance_ctrl->p_cfg->mendi_irq >= 0);
+    FSP_ASSERT(0U != p_monitor_cfg->expected_count);
+    FSP_ASSERT(0U != p_monitor_cfg->average_samples);
+    FSP_ASSERT(p_monitor_cfg->trim_min <= p_monitor_cfg->trim_max);
+    FSP_ASSERT((NULL == p_monitor_cfg->p_cgc_ctrl) || (CGC_CLOCK_HOCO == p_monitor_cfg->trim_clock) ||
+               (CGC_CLOCK_MOCO == p_monitor_cfg->trim_clock));
+#endif
+
+    int8_t trim = 0;
+    if (NULL != p_monitor_cfg->p_cgc_ctrl)
+    {
+        fsp_err_t err = R_CGC_ClockTrimGet(p_monitor_cfg->p_cgc_ctrl, p_monitor_cfg->trim_clock, &trim);
+        FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+    }
+
+    /* Stop measuring so no measurement end interrupt sees a partially initialized monitor. */
+    R_CAC->CACR0 = 0U;
+    FSP_HARDWARE_REGISTER_WAIT(R_CAC->CACR0, 0);
+    R_CAC->CAICR |= (uint8_t) (CAC_PRV_CAICR_MENDFCL_MASK | CAC_PRV_CAICR_OVFFCL_MASK);
+
+    p_instance_ctrl->monitor_status.samples           = 0U;
+    p_instance_ctrl->monitor_status.overflows         = 0U;
+    p_instance_ctrl->monitor_status.trims             = 0U;
+    p_instance_ctrl->monitor_status.error_ppm         = 0;
+    p_instance_ctrl->monitor_status.error_average_ppm = 0;
+    p_instance_ctrl->monitor_status.error_min_ppm     = INT32_MAX;
+    p_instance_ctrl->monitor_status.error_max_ppm     = INT32_MIN;
+    p_instance_ctrl->monitor_status.trim              = trim;
+    p_instance_ctrl->monitor_error_sum                = 0;
+    p_instance_ctrl->monitor_window                   = 0U;
+    p_instance_ctrl->monitor_discard                  = false;
+    p_instance_ctrl->p_monitor                        = p_monitor_cfg;
+
+    /* With CFME left set, a new measurement starts at every valid reference edge. */
+    R_CAC->CACR0 = 1U;
+    FSP_HARDWARE_REGISTER_WAIT(R_CAC->CACR0, 1U);
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Gets the drift statistics collected since R_CAC_MonitorStart(). May be called from the CAC callback.
+ *
+ * @retval     FSP_SUCCESS               Statistics returned in p_status.
+ * @retval     FSP_ERR_ASSERTION         An argument is NULL.
+ * @retval     FSP_ERR_NOT_OPEN          R_CAC_Open() has not been successfully called.
+ * @retval     FSP_ERR_NOT_ENABLED       The monitor has not been started.
+ **********************************************************************************************************************/
+fsp_err_t R_CAC_MonitorStatusGet (cac_ctrl_t * const p_ctrl, cac_monitor_status_t * const p_status)
+{
+    cac_instance_ctrl_t * p_instance_ctrl = (cac_instance_ctrl_t *) p_ctrl;
+
+#if (CAC_CFG_PARAM_CHECKING_ENABLE == 1)
+    FSP_ASSERT(NULL != p_instance_ctrl);
+    FSP_ASSERT(NULL != p_status);
+    FSP_ERROR_RETURN((CAC_OPEN == p_instance_ctrl->open), FSP_ERR_NOT_OPEN);
+#endif
+    FSP_ERROR_RETURN(NULL != p_instance_ctrl->p_monitor, FSP_ERR_NOT_ENABLED);
+
+    /* Copy the statistics without a measurement end interrupt updating them halfway. */
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+    *p_status = p_instance_ctrl->monitor_status;
+    FSP_CRITICAL_SECTION_EXIT;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Stops continuous monitoring and measurements. The trimming value is left as last set by the monitor.
+ *
+ * @retval     FSP_SUCCESS               Monitoring stopped.
+ * @retval     FSP_ERR_ASSERTION         An argument is NULL.
+ * @retval     FSP_ERR_NOT_OPEN          R_CAC_Open() has not been successfully called.
+ **********************************************************************************************************************/
+fsp_err_t R_CAC_MonitorStop (cac_ctrl_t * const p_ctrl)
+{
+    cac_instance_ctrl_t * p_instance_ctrl = (cac_instance_ctrl_t *) p_ctrl;
+
+#if (CAC_CFG_PARAM_CHECKING_ENABLE == 1)
+    FSP_ASSERT(NULL != p_instance_ctrl);
+    FSP_ERROR_RETURN((CAC_OPEN == p_instance_ctrl->open), FSP_ERR_NOT_OPEN);
+#endif
+
+    /* Disable measurements. */
+    R_CAC->CACR0 = 0U;
+    FSP_HARDWARE_REGISTER_WAIT(R_CAC->CACR0, 0);
+
+    p_instance_ctrl->p_monitor = NULL;
+
+    return FSP_SUCCESS;
+}
+
 /*******************************************************************************************************************//**
  * Release any resources that were allocated by the Open() or any subsequent CAC operations.
  *
@@ -319,6 +446,8 @@ fsp_err_t R_CAC_Close (cac_ctrl_t * const p_ctrl)
     /* Disable measurements. */
     R_CAC->CACR0 = 0U;
 
+    p_instance_ctrl->p_monitor = NULL;
+
     /* Disable interrupts in NVIC. */
     NVIC_DisableIRQ(p_instance_ctrl->p_cfg->ferri_irq);
     NVIC_DisableIRQ(p_instance_ctrl->p_cfg->mendi_irq);
@@ -442,6 +571,127 @@ static void r_cac_hw_configure (cac_instance_ctrl_t * const p_instance_ctrl)
     R_CAC->CALLVR = p_cfg->cac_lower_limit;
 }
 
+/*******************************************************************************************************************//**
+ * Processes one measurement of the continuous monitor.
+ *
+ * @param[in]  p_instance_ctrl  A pointer to the instance control structure.
+ **********************************************************************************************************************/
+static void r_cac_monitor_update (cac_instance_ctrl_t * const p_instance_ctrl)
+{
+    cac_monitor_cfg_t const * p_monitor = p_instance_ctrl->p_monitor;
+    cac_monitor_status_t    * p_status  = &p_instance_ctrl->monitor_status;
+
+    /* The overflow flag is cleared here when the overflow interrupt is not used. */
+    if (R_CAC->CASTR & CAC_PRV_CASTR_OVFF_MASK)
+    {
+        R_CAC->CAICR |= (uint8_t) CAC_PRV_CAICR_OVFFCL_MASK;
+        p_instance_ctrl->monitor_discard = true;
+        p_status->overflows++;
+    }
+
+    uint16_t count = R_CAC->CACNTBR;
+
+    /* Skip measurements that overflowed or straddle a trimming change. */
+    if (p_instance_ctrl->monitor_discard)
+    {
+        p_instance_ctrl->monitor_discard = false;
+
+        return;
+    }
+
+    int64_t error_ppm = (((int64_t) count - (int64_t) p_monitor->expected_count) * CAC_PRV_PPM) /
+                        (int64_t) p_monitor->expected_count;
+
+    /* A high count means the reference clock is slow. */
+    if (p_monitor->trim_reference)
+    {
+        error_ppm = -error_ppm;
+    }
+
+    /* The error can only exceed 32 bits for expected counts below 32, which are too coarse to trim with anyway. */
+    if (error_ppm > INT32_MAX)
+    {
+        error_ppm = INT32_MAX;
+    }
+    else if (error_ppm < -INT32_MAX)
+    {
+        error_ppm = -INT32_MAX;
+    }
+
+    p_status->samples++;
+    p_status->error_ppm = (int32_t) error_ppm;
+    if (p_status->error_ppm < p_status->error_min_ppm)
+    {
+        p_status->error_min_ppm = p_status->error_ppm;
+    }
+
+    if (p_status->error_ppm > p_status->error_max_ppm)
+    {
+        p_status->error_max_ppm = p_status->error_ppm;
+    }
+
+    p_instance_ctrl->monitor_error_sum += error_ppm;
+    p_instance_ctrl->monitor_window++;
+
+    if (p_instance_ctrl->monitor_window >= p_monitor->average_samples)
+    {
+        p_status->error_average_ppm =
+            (int32_t) (p_instance_ctrl->monitor_error_sum / (int64_t) p_instance_ctrl->monitor_window);
+        p_instance_ctrl->monitor_error_sum = 0;
+        p_instance_ctrl->monitor_window    = 0U;
+
+        if (NULL != p_monitor->p_cgc_ctrl)
+        {
+            r_cac_monitor_trim(p_instance_ctrl, p_status->error_average_ppm);
+        }
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Steps the trimming value of the monitored oscillator toward the expected frequency.
+ *
+ * @param[in]  p_instance_ctrl    A pointer to the instance control structure.
+ * @param[in]  error_average_ppm  Averaged error of the oscillator, positive when it is fast.
+ **********************************************************************************************************************/
+static void r_cac_monitor_trim (cac_instance_ctrl_t * const p_instance_ctrl, int32_t error_average_ppm)
+{
+    cac_monitor_cfg_t const * p_monitor = p_instance_ctrl->p_monitor;
+    cac_monitor_status_t    * p_status  = &p_instance_ctrl->monitor_status;
+
+    uint32_t magnitude = (error_average_ppm < 0) ? (uint32_t) -error_average_ppm : (uint32_t) error_average_ppm;
+    if (magnitude <= p_monitor->deadband_ppm)
+    {
+        return;
+    }
+
+    /* Move by the rounded number of steps that cancels the error, at least one. */
+    uint32_t steps = 1U;
+    if (0U != p_monitor->trim_step_ppm)
+    {
+        steps = (magnitude + (p_monitor->trim_step_ppm / 2U)) / p_monitor->trim_step_ppm;
+        steps = (0U == steps) ? 1U : steps;
+        steps = (steps > CAC_PRV_TRIM_STEPS_MAX) ? CAC_PRV_TRIM_STEPS_MAX : steps;
+    }
+
+    /* Positive trimming values raise the frequency, so a fast oscillator is trimmed down. */
+    int32_t trim = p_status->trim;
+    trim = (error_average_ppm > 0) ? (trim - (int32_t) steps) : (trim + (int32_t) steps);
+    trim = (trim < p_monitor->trim_min) ? p_monitor->trim_min : trim;
+    trim = (trim > p_monitor->trim_max) ? p_monitor->trim_max : trim;
+
+    if (trim != p_status->trim)
+    {
+        if (FSP_SUCCESS == R_CGC_ClockTrimSet(p_monitor->p_cgc_ctrl, p_monitor->trim_clock, (int8_t) trim))
+        {
+            p_status->trim = (int8_t) trim;
+            p_status->trims++;
+
+            /* The measurement in progress ran partly at the old frequency. */
+            p_instance_ctrl->monitor_discard = true;
+        }
+    }
+}
+
 /*******************************************************************************************************************//**
  * Generic routine for handling all of the CAC interrupts.
  *
@@ -529,6 +779,15 @@ void cac_ovfi_isr (void)
 {
     FSP_CONTEXT_SAVE;
 
+    cac_instance_ctrl_t * p_instance_ctrl = (cac_instance_ctrl_t *) R_FSP_IsrContextGet(R_FSP_CurrentIrqGet());
+
+    /* The overflowed measurement ends at the next measurement end interrupt. */
+    if (NULL != p_instance_ctrl->p_monitor)
+    {
+        p_instance_ctrl->monitor_discard = true;
+        p_instance_ctrl->monitor_status.overflows++;
+    }
+
     r_cac_isr_handler(CAC_EVENT_COUNTER_OVERFLOW, CAC_PRV_CAICR_OVFFCL_MASK);
 
     FSP_CONTEXT_RESTORE;
@@ -541,6 +800,14 @@ void cac_mendi_isr (void)
 {
     FSP_CONTEXT_SAVE;
 
+    cac_instance_ctrl_t * p_instance_ctrl = (cac_instance_ctrl_t *) R_FSP_IsrContextGet(R_FSP_CurrentIrqGet());
+
+    /* Update the monitor before the callback so the callback sees this measurement in R_CAC_MonitorStatusGet(). */
+    if (NULL != p_instance_ctrl->p_monitor)
+    {
+        r_cac_monitor_update(p_instance_ctrl);
+    }
+
     r_cac_isr_handler(CAC_EVENT_MEASUREMENT_COMPLETE, CAC_PRV_CAICR_MENDFCL_MASK);
 
     FSP_CONTEXT_RESTORE;
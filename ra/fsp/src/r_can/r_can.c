@@ -76,6 +76,8 @@
 #define CAN_ERROR_INTERRUPTS_ENABLE         (0x3EU)
 #define CAN_ERROR_INTERRUPTS_DISABLE        (0x00U)
 
+#define CAN_FILTER_GROUPS_MAX               (CAN_MAX_NO_MAILBOXES / CAN_MAILBOX_GROUP_SIZE)
+
 /***********************************************************************************************************************
  * Typedef definitions
  **********************************************************************************************************************/
@@ -102,6 +104,13 @@ typedef union
     } int_status_b;
 } can_error_interrrupt_status_t;
 
+/* Acceptance filter block: accepts every ID where (ID & mask) == id. */
+typedef struct st_can_filter_entry
+{
+    uint32_t id;
+    uint32_t mask;
+} can_filter_entry_t;
+
 #if defined(__ARMCC_VERSION) || defined(__ICCARM__)
 typedef void (BSP_CMSE_NONSECURE_CALL * can_prv_ns_callback)(can_callback_args_t * p_args);
 #elif defined(__GNUC__)
@@ -117,6 +126,19 @@ static void r_can_mode_transition(can_instance_ctrl_t * p_ctrl,
                                   can_operation_mode_t  operation_mode,
                                   can_test_mode_t       test_mode);
 static void r_can_bsp_irq_cfg_enable(can_instance_ctrl_t * p_ctrl, IRQn_Type const irq);
+static void r_can_mailbox_read(can_instance_ctrl_t * p_ctrl, uint32_t mailbox, can_frame_t * p_frame);
+static void r_can_mailbox_write(can_instance_ctrl_t * p_ctrl, uint32_t mailbox, can_frame_t const * p_frame);
+static uint32_t r_can_mailbox_id_get(can_instance_ctrl_t * p_ctrl, uint32_t mailbox);
+static void r_can_tx_queue_insert(can_instance_ctrl_t * p_ctrl, can_frame_t const * p_frame, bool ahead);
+static void r_can_tx_queue_service(can_instance_ctrl_t * p_ctrl);
+static void r_can_rx_fifo_fill(can_instance_ctrl_t * p_ctrl);
+static uint32_t r_can_filter_add(can_filter_entry_t * p_entries,
+                                 uint32_t             count,
+                                 uint32_t             max_count,
+                                 uint32_t             id,
+                                 uint32_t             mask,
+                                 uint32_t             id_limit);
+static uint64_t r_can_filter_size(uint32_t mask, uint32_t id_limit);
 
 /***********************************************************************************************************************
  * ISR prototypes
@@ -288,6 +310,17 @@ fsp_err_t R_CAN_Open (can_ctrl_t * const p_api_ctrl, can_cfg_t const * const p_c
     p_ctrl->p_context         = p_cfg->p_context;
     p_ctrl->p_callback_memory = NULL;
 
+    /* Frames are passed to the callback one at a time until R_CAN_RxFifoEnable is called. */
+    p_ctrl->p_rx_fifo     = NULL;
+    p_ctrl->rx_fifo_head  = 0U;
+    p_ctrl->rx_fifo_tail  = 0U;
+    p_ctrl->rx_fifo_batch = 0U;
+
+    /* Transmit mailboxes are written by the caller until R_CAN_TxQueueEnable is called. */
+    p_ctrl->p_tx_queue     = NULL;
+    p_ctrl->tx_queue_count = 0U;
+    p_ctrl->tx_queue_mbox  = 0U;
+
     /* Set the clock source to the user configured source. */
     p_ctrl->clock_source = extended_cfg->clock_source;
 
@@ -435,6 +468,8 @@ fsp_err_t R_CAN_Open (can_ctrl_t * const p_api_ctrl, can_cfg_t const * const p_c
     p_ctrl->p_reg->EIER = CAN_ERROR_INTERRUPTS_ENABLE;
     p_ctrl->p_reg->MIER = CAN_TX_RX_INTERRUPTS_ENABLE; // Enable interrupts for all mailboxes, transmit and receive
 
+    BSP_TRACE(FSP_IP_CAN, p_cfg->channel, BSP_TRACE_EVENT_OPEN, 0U);
+
     /* If successful, Mark the control block as open */
     p_ctrl->open = CAN_OPEN;
 
@@ -456,7 +491,11 @@ fsp_err_t R_CAN_Close (can_ctrl_t * const p_api_ctrl)
     FSP_ERROR_RETURN(p_ctrl->open == CAN_OPEN, FSP_ERR_NOT_OPEN);
 #endif
 
-    p_ctrl->open = 0U;
+    BSP_TRACE(FSP_IP_CAN, p_ctrl->p_cfg->channel, BSP_TRACE_EVENT_CLOSE, 0U);
+
+    p_ctrl->open      = 0U;
+    p_ctrl->p_rx_fifo  = NULL;
+    p_ctrl->p_tx_queue = NULL;
 
     R_BSP_IrqDisable(p_ctrl->p_cfg->error_irq);
     R_BSP_IrqDisable(p_ctrl->p_cfg->mailbox_rx_irq);
@@ -480,6 +519,7 @@ fsp_err_t R_CAN_Close (can_ctrl_t * const p_api_ctrl)
  * @retval FSP_ERR_NOT_OPEN                 Control block not open.
  * @retval FSP_ERR_CAN_TRANSMIT_NOT_READY   Transmit in progress, cannot write data at this time.
  * @retval FSP_ERR_CAN_RECEIVE_MAILBOX      Mailbox is setup for receive and cannot send.
+ * @retval FSP_ERR_IN_USE                   Mailbox is managed by the transmit queue.
  * @retval FSP_ERR_INVALID_ARGUMENT         Data length or frame type invalid.
  * @retval FSP_ERR_ASSERTION                Null pointer presented
  *****************************************************************************************************************/
@@ -497,36 +537,13 @@ fsp_err_t R_CAN_Write (can_ctrl_t * const p_api_ctrl, uint32_t mailbox, can_fram
 
     FSP_ERROR_RETURN((p_frame->data_length_code <= CAN_MAX_DATA_LENGTH), FSP_ERR_INVALID_ARGUMENT);
 #endif
-    uint32_t i;
+    /* Transmit mailboxes belong to the transmit queue while it is enabled. */
+    FSP_ERROR_RETURN((NULL == p_ctrl->p_tx_queue) || (0U == (p_ctrl->tx_queue_mbox & (1U << mailbox))), FSP_ERR_IN_USE);
     FSP_ERROR_RETURN(0U == p_ctrl->p_reg->MCTL_TX_b[mailbox].TRMREQ, FSP_ERR_CAN_TRANSMIT_NOT_READY);
 
-    /* Setup the frame to be transmitted. */
-
-    /* Set the ID based on the ID mode */
-    if (CAN_ID_MODE_STANDARD == p_ctrl->p_cfg->id_mode)
-    {
-        p_ctrl->p_reg->MB[mailbox].ID = ((uint32_t) (0U << R_CAN0_MB_ID_IDE_Pos) |
-                                         (uint32_t) (p_frame->type << R_CAN0_MB_ID_RTR_Pos) |
-                                         (uint32_t) ((p_frame->id & CAN_SID_MASK) << R_CAN0_MB_ID_SID_Pos));
-    }
-    else
-    {
-        p_ctrl->p_reg->MB[mailbox].ID = ((uint32_t) (0U << R_CAN0_MB_ID_IDE_Pos) |
-                                         (uint32_t) (p_frame->type << R_CAN0_MB_ID_RTR_Pos) |
-                                         (uint32_t) ((p_frame->id & CAN_XID_MASK) << R_CAN0_MB_ID_EID_Pos));
-    }
-
-    /* Put mailbox data length code */
-    p_ctrl->p_reg->MB[mailbox].DL_b.DLC = (p_frame->data_length_code & 0x0FU);
-
-    /* Put mailbox data. */
-    for (i = 0U; i < p_frame->data_length_code; i++)
-    {
-        p_ctrl->p_reg->MB[mailbox].D[i] = p_frame->data[i];
-    }
+    BSP_TRACE(FSP_IP_CAN, p_ctrl->p_cfg->channel, BSP_TRACE_EVENT_WRITE, mailbox);
 
-    /* Transmit the frame */
-    p_ctrl->p_reg->MCTL_TX[mailbox] = CAN_MAILBOX_TX;
+    r_can_mailbox_write(p_ctrl, mailbox, p_frame);
 
     return FSP_SUCCESS;
 }
@@ -642,224 +659,632 @@ fsp_err_t R_CAN_CallbackSet (can_ctrl_t * const          p_api_ctrl,
 }
 
 /*******************************************************************************************************************//**
- * Get CAN module code and API versions.
- * @retval  FSP_SUCCESS             Operation succeeded.
- * @retval  FSP_ERR_ASSERTION       Null pointer presented
- * note This function is reentrant.
+ * Collect received frames in a software FIFO instead of passing each frame to the callback.
+ *
+ * The receive ISR drains every mailbox holding new data into the FIFO in a single pass. The callback is called with
+ * event CAN_EVENT_RX_COMPLETE, p_frame set to NULL and mailbox set to the number of unread frames each time
+ * p_fifo_cfg->batch_size frames have been stored. If the FIFO is full the frame is discarded and
+ * CAN_EVENT_MAILBOX_MESSAGE_LOST is added to the event. Frames are read with R_CAN_RxFifoRead.
+ *
+ * @retval FSP_SUCCESS                      FIFO enabled.
+ * @retval FSP_ERR_NOT_OPEN                 Control block not open.
+ * @retval FSP_ERR_INVALID_SIZE             FIFO length is not a power of two.
+ * @retval FSP_ERR_INVALID_ARGUMENT         Batch size is zero or larger than the FIFO.
+ * @retval FSP_ERR_ASSERTION                Null pointer presented.
  **********************************************************************************************************************/
-fsp_err_t R_CAN_VersionGet (fsp_version_t * const p_version)
+fsp_err_t R_CAN_RxFifoEnable (can_ctrl_t * const p_api_ctrl, can_rx_fifo_cfg_t const * const p_fifo_cfg)
 {
+    can_instance_ctrl_t * p_ctrl = (can_instance_ctrl_t *) p_api_ctrl;
+
 #if CAN_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ASSERT(NULL != p_fifo_cfg);
+    FSP_ASSERT(NULL != p_fifo_cfg->p_buffer);
+    FSP_ERROR_RETURN(p_ctrl->open == CAN_OPEN, FSP_ERR_NOT_OPEN);
 
-    /* Check pointer for NULL value */
-    FSP_ASSERT(NULL != p_version);
+    /* The FIFO indices are free running, so the length must divide 2^32. */
+    FSP_ERROR_RETURN((0U != p_fifo_cfg->length) && (0U == (p_fifo_cfg->length & (p_fifo_cfg->length - 1U))),
+                     FSP_ERR_INVALID_SIZE);
+    FSP_ERROR_RETURN((p_fifo_cfg->batch_size >= 1U) && (p_fifo_cfg->batch_size <= p_fifo_cfg->length),
+                     FSP_ERR_INVALID_ARGUMENT);
 #endif
 
-    /* Return module version information. */
-    p_version->version_id = g_can_version.version_id;
+    /* Keep the receive ISR out while the FIFO is initialized. */
+    R_BSP_IrqDisable(p_ctrl->p_cfg->mailbox_rx_irq);
+
+    p_ctrl->rx_fifo_head  = 0U;
+    p_ctrl->rx_fifo_tail  = 0U;
+    p_ctrl->rx_fifo_batch = 0U;
+    p_ctrl->p_rx_fifo     = p_fifo_cfg;
+
+    R_BSP_IrqEnableNoClear(p_ctrl->p_cfg->mailbox_rx_irq);
 
     return FSP_SUCCESS;
 }
 
 /*******************************************************************************************************************//**
- * @} (end addtogroup CAN)
+ * Stop using the software receive FIFO. Unread frames are discarded and received frames are passed to the callback
+ * one at a time again.
+ *
+ * @retval FSP_SUCCESS                      FIFO disabled.
+ * @retval FSP_ERR_NOT_OPEN                 Control block not open.
+ * @retval FSP_ERR_ASSERTION                Null pointer presented.
  **********************************************************************************************************************/
+fsp_err_t R_CAN_RxFifoDisable (can_ctrl_t * const p_api_ctrl)
+{
+    can_instance_ctrl_t * p_ctrl = (can_instance_ctrl_t *) p_api_ctrl;
 
-/***********************************************************************************************************************
- * Private Functions
- **********************************************************************************************************************/
+#if CAN_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ERROR_RETURN(p_ctrl->open == CAN_OPEN, FSP_ERR_NOT_OPEN);
+#endif
+
+    R_BSP_IrqDisable(p_ctrl->p_cfg->mailbox_rx_irq);
+    p_ctrl->p_rx_fifo = NULL;
+    R_BSP_IrqEnableNoClear(p_ctrl->p_cfg->mailbox_rx_irq);
+
+    return FSP_SUCCESS;
+}
 
 /*******************************************************************************************************************//**
- * Calls user callback.
+ * Copy up to max_frames frames out of the software receive FIFO, oldest first. This function may be called from the
+ * FIFO callback or from a single thread, but not from both.
  *
- * @param[in]     p_ctrl     Pointer to CAN instance control block
- * @param[in]     p_args     Pointer to arguments on stack
+ * @retval FSP_SUCCESS                      *p_count frames copied to p_frames. *p_count is 0 if the FIFO is empty.
+ * @retval FSP_ERR_NOT_OPEN                 Control block not open.
+ * @retval FSP_ERR_NOT_ENABLED              FIFO not enabled with R_CAN_RxFifoEnable.
+ * @retval FSP_ERR_ASSERTION                Null pointer presented.
  **********************************************************************************************************************/
-static void r_can_call_callback (can_instance_ctrl_t * p_ctrl, can_callback_args_t * p_args)
+fsp_err_t R_CAN_RxFifoRead (can_ctrl_t * const  p_api_ctrl,
+                            can_frame_t * const p_frames,
+                            uint32_t const      max_frames,
+                            uint32_t * const    p_count)
 {
-    can_callback_args_t args;
+    can_instance_ctrl_t * p_ctrl = (can_instance_ctrl_t *) p_api_ctrl;
 
-    /* Store callback arguments in memory provided by user if available.  This allows callback arguments to be
-     * stored in non-secure memory so they can be accessed by a non-secure callback function. */
-    can_callback_args_t * p_args_memory = p_ctrl->p_callback_memory;
-    if (NULL == p_args_memory)
-    {
-        /* Use provided args struct on stack */
-        p_args_memory = p_args;
-    }
-    else
-    {
-        /* Save current arguments on the stack in case this is a nested interrupt. */
-        args = *p_args_memory;
+#if CAN_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ASSERT(NULL != p_frames);
+    FSP_ASSERT(NULL != p_count);
+    FSP_ERROR_RETURN(p_ctrl->open == CAN_OPEN, FSP_ERR_NOT_OPEN);
+#endif
 
-        /* Copy the stacked args to callback memory */
-        *p_args_memory = *p_args;
-    }
+    can_rx_fifo_cfg_t const * p_fifo = p_ctrl->p_rx_fifo;
+    FSP_ERROR_RETURN(NULL != p_fifo, FSP_ERR_NOT_ENABLED);
 
-#if BSP_TZ_SECURE_BUILD
+    /* Only the ISR writes head and only this function writes tail, so no critical section is required. */
+    uint32_t tail  = p_ctrl->rx_fifo_tail;
+    uint32_t count = p_ctrl->rx_fifo_head - tail;
 
-    /* p_callback can point to a secure function or a non-secure function. */
-    if (!cmse_is_nsfptr(p_ctrl->p_callback))
+    if (count > max_frames)
     {
-        /* If p_callback is secure, then the project does not need to change security state. */
-        p_ctrl->p_callback(p_args_memory);
+        count = max_frames;
     }
-    else
+
+    for (uint32_t i = 0U; i < count; i++)
     {
-        /* If p_callback is Non-secure, then the project must change to Non-secure state in order to call the callback. */
-        can_prv_ns_callback p_callback = (can_prv_ns_callback) (p_ctrl->p_callback);
-        p_callback(p_args_memory);
+        p_frames[i] = p_fifo->p_buffer[(tail + i) & (p_fifo->length - 1U)];
     }
 
-#else
+    p_ctrl->rx_fifo_tail = tail + count;
+    *p_count             = count;
 
-    /* If the project is not Trustzone Secure, then it will never need to change security state in order to call the callback. */
-    p_ctrl->p_callback(p_args_memory);
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Hand all transmit mailboxes to a driver managed queue ordered by CAN ID.
+ *
+ * Frames written with R_CAN_TxQueueWrite are loaded into free transmit mailboxes lowest ID first, and the transmit
+ * ISR refills each mailbox as soon as its frame is sent. When every mailbox is loaded and a frame with a lower ID is
+ * queued, the loaded frame with the highest ID is aborted and requeued so the hardware always arbitrates with the
+ * highest priority frames available. Frames with the same ID are sent in the order they were written.
+ *
+ * R_CAN_Write returns FSP_ERR_IN_USE for transmit mailboxes while the queue is enabled.
+ *
+ * @retval FSP_SUCCESS                      Queue enabled.
+ * @retval FSP_ERR_NOT_OPEN                 Control block not open.
+ * @retval FSP_ERR_INVALID_SIZE             Queue length is zero.
+ * @retval FSP_ERR_INVALID_MODE             No mailbox is configured for transmit.
+ * @retval FSP_ERR_ASSERTION                Null pointer presented.
+ **********************************************************************************************************************/
+fsp_err_t R_CAN_TxQueueEnable (can_ctrl_t * const p_api_ctrl, can_tx_queue_cfg_t const * const p_queue_cfg)
+{
+    can_instance_ctrl_t * p_ctrl = (can_instance_ctrl_t *) p_api_ctrl;
+
+#if CAN_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ASSERT(NULL != p_queue_cfg);
+    FSP_ASSERT(NULL != p_queue_cfg->p_buffer);
+    FSP_ERROR_RETURN(p_ctrl->open == CAN_OPEN, FSP_ERR_NOT_OPEN);
+    FSP_ERROR_RETURN(0U != p_queue_cfg->length, FSP_ERR_INVALID_SIZE);
 #endif
 
-    if (NULL != p_ctrl->p_callback_memory)
+    uint32_t tx_mbox = 0U;
+    for (uint32_t mailbox = 0U; mailbox < p_ctrl->p_cfg->mailbox_count; mailbox++)
     {
-        /* Restore callback memory in case this is a nested interrupt. */
-        *p_ctrl->p_callback_memory = args;
+        if (CAN_MAILBOX_TRANSMIT == p_ctrl->p_cfg->p_mailbox[mailbox].mailbox_type)
+        {
+            tx_mbox |= 1U << mailbox;
+        }
     }
+
+    FSP_ERROR_RETURN(0U != tx_mbox, FSP_ERR_INVALID_MODE);
+
+    /* Keep the transmit ISR out while the queue is initialized. */
+    R_BSP_IrqDisable(p_ctrl->p_cfg->mailbox_tx_irq);
+
+    p_ctrl->tx_queue_count = 0U;
+    p_ctrl->tx_queue_mbox  = tx_mbox;
+    p_ctrl->p_tx_queue     = p_queue_cfg;
+
+    R_BSP_IrqEnableNoClear(p_ctrl->p_cfg->mailbox_tx_irq);
+
+    return FSP_SUCCESS;
 }
 
 /*******************************************************************************************************************//**
- * Error ISR.
+ * Stop using the transmit queue. Frames still in the queue are discarded. Frames already loaded into mailboxes are
+ * sent.
  *
- * Saves context if RTOS is used, clears interrupts, calls common error function, and restores context if RTOS is used.
+ * @retval FSP_SUCCESS                      Queue disabled.
+ * @retval FSP_ERR_NOT_OPEN                 Control block not open.
+ * @retval FSP_ERR_ASSERTION                Null pointer presented.
  **********************************************************************************************************************/
-void can_error_isr (void)
+fsp_err_t R_CAN_TxQueueDisable (can_ctrl_t * const p_api_ctrl)
 {
-    /* Save context if RTOS is used */
-    FSP_CONTEXT_SAVE
-    /* Clear interrupt */
-    R_BSP_IrqStatusClear(R_FSP_CurrentIrqGet());
+    can_instance_ctrl_t * p_ctrl = (can_instance_ctrl_t *) p_api_ctrl;
 
-    IRQn_Type             irq    = R_FSP_CurrentIrqGet();
-    can_instance_ctrl_t * p_ctrl = (can_instance_ctrl_t *) R_FSP_IsrContextGet(irq);
+#if CAN_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ERROR_RETURN(p_ctrl->open == CAN_OPEN, FSP_ERR_NOT_OPEN);
+#endif
 
-    can_callback_args_t args    = {0U};
-    uint32_t            mailbox = 0U;
+    R_BSP_IrqDisable(p_ctrl->p_cfg->mailbox_tx_irq);
+    p_ctrl->p_tx_queue     = NULL;
+    p_ctrl->tx_queue_count = 0U;
+    R_BSP_IrqEnableNoClear(p_ctrl->p_cfg->mailbox_tx_irq);
 
-    /* Get source of error interrupt. */
-    args.event = (can_event_t) p_ctrl->p_reg->EIFR; // Read Error Interrupt Factor Judge register
+    return FSP_SUCCESS;
+}
 
-    p_ctrl->p_reg->EIFR = 0x00U;                    // Clear Error Interrupt Factor Judge register
+/*******************************************************************************************************************//**
+ * Queue a frame for transmission. The frame is copied, so p_frame may be reused on return. CAN_EVENT_TX_COMPLETE is
+ * reported for each frame sent, with the mailbox that sent it.
+ *
+ * @retval FSP_SUCCESS                      Frame queued or loaded into a mailbox.
+ * @retval FSP_ERR_NOT_OPEN                 Control block not open.
+ * @retval FSP_ERR_NOT_ENABLED              Queue not enabled with R_CAN_TxQueueEnable.
+ * @retval FSP_ERR_QUEUE_FULL               No room in the queue.
+ * @retval FSP_ERR_INVALID_ARGUMENT         Data length invalid.
+ * @retval FSP_ERR_ASSERTION                Null pointer presented.
+ **********************************************************************************************************************/
+fsp_err_t R_CAN_TxQueueWrite (can_ctrl_t * const p_api_ctrl, can_frame_t const * const p_frame)
+{
+    can_instance_ctrl_t * p_ctrl = (can_instance_ctrl_t *) p_api_ctrl;
 
-    /* Although NMLST detects both Overwrite and Overrun conditions,
-     * in such a scenario this interrupt is fired only when the peripheral is in the overrun mode
-     * (Either on its own or manually by setting NVIC_SetPendingIRQ below).
-     * The receive_overrun bit may not be checked here.
-     */
-    if (p_ctrl->p_reg->STR_b.NMLST)
-    {
-        args.event |= CAN_EVENT_MAILBOX_MESSAGE_LOST;
-        uint8_t saved_msmr = p_ctrl->p_reg->MSMR;          // Save the current MSMR value
-        p_ctrl->p_reg->MSMR = CAN_ERROR_SEARCH;            // search for lowest numbered mailbox with message lost
-        mailbox             = p_ctrl->p_reg->MSSR_b.MBNST; // get mailbox number
-        p_ctrl->p_reg->MSMR = saved_msmr;                  // Restore the previous MSMR value
-        p_ctrl->p_reg->MCTL_RX_b[mailbox].MSGLOST = 0U;    // Clear the error so that NMLST is not set again for an already handled error.
-    }
+#if CAN_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ASSERT(NULL != p_frame);
+    FSP_ERROR_RETURN(p_ctrl->open == CAN_OPEN, FSP_ERR_NOT_OPEN);
+    FSP_ERROR_RETURN((p_frame->data_length_code <= CAN_MAX_DATA_LENGTH), FSP_ERR_INVALID_ARGUMENT);
+#endif
 
-    args.p_frame   = NULL;
-    args.channel   = p_ctrl->p_cfg->channel;
-    args.p_context = p_ctrl->p_context;
-    args.mailbox   = mailbox;
-    r_can_call_callback(p_ctrl, &args);
+    FSP_ERROR_RETURN(NULL != p_ctrl->p_tx_queue, FSP_ERR_NOT_ENABLED);
 
-    /* Check for mailboxes with data loss due to overrun,
-     * if true, fire this interrupt again.
-     * Do not re-trigger this interrupt due to message loss in overwrite mode.
-     */
-    if (p_ctrl->p_reg->STR_b.NMLST && (CAN_MESSAGE_MODE_OVERWRITE != p_ctrl->p_cfg->message_mode))
+    /* The transmit ISR also updates the queue and the mailboxes. */
+    R_BSP_IrqDisable(p_ctrl->p_cfg->mailbox_tx_irq);
+
+    fsp_err_t err = FSP_ERR_QUEUE_FULL;
+    if (p_ctrl->tx_queue_count < p_ctrl->p_tx_queue->length)
     {
-        NVIC_SetPendingIRQ(p_ctrl->p_cfg->error_irq);
+        r_can_tx_queue_insert(p_ctrl, p_frame, false);
+        r_can_tx_queue_service(p_ctrl);
+        err = FSP_SUCCESS;
     }
 
-    /* Restore context if RTOS is used */
-    FSP_CONTEXT_RESTORE
+    R_BSP_IrqEnableNoClear(p_ctrl->p_cfg->mailbox_tx_irq);
+
+    return err;
 }
 
 /*******************************************************************************************************************//**
- * Receive ISR.
+ * Program the receive mailbox IDs and group masks to accept the listed IDs and ID ranges.
  *
- * Saves context if RTOS is used, clears interrupts, calls common receive function
- * and restores context if RTOS is used.
+ * Each range is split into aligned blocks that one mask describes exactly. If there are more blocks than receive
+ * mailboxes, the two blocks whose smallest common block admits the fewest extra IDs are merged until they fit. Blocks
+ * are then placed into the mailbox groups (one mask per 4 mailboxes) so that widening a group mask admits as few extra
+ * IDs as possible. The filter therefore always accepts every listed ID and may accept some unlisted IDs when the list
+ * cannot be described exactly.
+ *
+ * The channel is placed in halt mode while the mailboxes are reprogrammed and returned to its previous mode afterwards.
+ * Frames held in receive mailboxes and not yet read are discarded.
+ *
+ * @retval FSP_SUCCESS                      Filters programmed.
+ * @retval FSP_ERR_NOT_OPEN                 Control block not open.
+ * @retval FSP_ERR_INVALID_ARGUMENT         Count is zero, or a range is reversed or outside the configured ID mode.
+ * @retval FSP_ERR_INVALID_MODE             No mailbox is configured for receive.
+ * @retval FSP_ERR_ASSERTION                Null pointer presented.
  **********************************************************************************************************************/
-void can_mailbox_rx_isr (void)
+fsp_err_t R_CAN_FilterSet (can_ctrl_t * const p_api_ctrl, can_filter_t const * const p_filters, uint32_t const count)
 {
-    /* Save context if RTOS is used */
-    FSP_CONTEXT_SAVE
-    /* Clear interrupt */
-    R_BSP_IrqStatusClear(R_FSP_CurrentIrqGet());
-
-    IRQn_Type             irq    = R_FSP_CurrentIrqGet();
-    can_instance_ctrl_t * p_ctrl = (can_instance_ctrl_t *) R_FSP_IsrContextGet(irq);
-
-    can_callback_args_t args;
-    uint32_t            mailbox    = 0U;
-    uint8_t             saved_msmr = p_ctrl->p_reg->MSMR; // Save the current MSMR value
-    p_ctrl->p_reg->MSMR = CAN_RECEIVE_SEARCH;             // search for lowest numbered &mailbox with message received
-    mailbox             = p_ctrl->p_reg->MSSR_b.MBNST;    // get mailbox number
-    p_ctrl->p_reg->MSMR = saved_msmr;                     // Restore the previous MSMR value
-    can_frame_t frame;
+    can_instance_ctrl_t * p_ctrl = (can_instance_ctrl_t *) p_api_ctrl;
 
-    /* Get frame data. */
-    uint32_t i;
-    uint32_t mbox_id = p_ctrl->p_reg->MB[mailbox].ID;
+#if CAN_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ASSERT(NULL != p_filters);
+    FSP_ERROR_RETURN(p_ctrl->open == CAN_OPEN, FSP_ERR_NOT_OPEN);
+    FSP_ERROR_RETURN(0U != count, FSP_ERR_INVALID_ARGUMENT);
+#endif
 
-    /* Get the frame type */
-    frame.type = (can_frame_type_t) ((mbox_id & R_CAN0_MB_ID_RTR_Msk) >> R_CAN0_MB_ID_RTR_Pos);
+    can_cfg_t const * p_cfg    = p_ctrl->p_cfg;
+    uint32_t          id_limit = (CAN_ID_MODE_STANDARD == p_cfg->id_mode) ? CAN_SID_MASK : CAN_XID_MASK;
 
-    /* Get the frame id */
-    if (CAN_ID_MODE_STANDARD == p_ctrl->p_cfg->id_mode)
-    {
-        frame.id = (mbox_id & R_CAN0_MB_ID_SID_Msk) >> R_CAN0_MB_ID_SID_Pos;
-    }
-    else
+#if CAN_CFG_PARAM_CHECKING_ENABLE
+    for (uint32_t f = 0U; f < count; f++)
     {
-        frame.id = mbox_id;
+        FSP_ERROR_RETURN(p_filters[f].id_min <= p_filters[f].id_max, FSP_ERR_INVALID_ARGUMENT);
+        FSP_ERROR_RETURN(p_filters[f].id_max <= id_limit, FSP_ERR_INVALID_ARGUMENT);
     }
+#endif
 
-    /* Get the frame data length code */
-    frame.data_length_code = p_ctrl->p_reg->MB[mailbox].DL_b.DLC;
+    /* Count the receive mailboxes available in each mask group. */
+    uint32_t group_count = p_cfg->mailbox_count / CAN_MAILBOX_GROUP_SIZE;
+    uint32_t capacity[CAN_FILTER_GROUPS_MAX];
+    uint32_t slots = 0U;
 
-    /* Refer Note 1 about DLC[3:0] under Section 37.2.6
-     * 'Mailbox Register j (MBj_ID, MBj_DL, MBj_Dm, MBj_TS) (j = 0 to 31; m = 0 to 7)'
-     * of RA6M3 manual R01UH0886EJ010.
-     */
-    if (frame.data_length_code > CAN_MAX_DATA_LENGTH)
+    for (uint32_t g = 0U; g < group_count; g++)
     {
-        frame.data_length_code = CAN_MAX_DATA_LENGTH;
+        capacity[g] = 0U;
+        for (uint32_t k = 0U; k < CAN_MAILBOX_GROUP_SIZE; k++)
+        {
+            if (CAN_MAILBOX_RECEIVE == p_cfg->p_mailbox[(g * CAN_MAILBOX_GROUP_SIZE) + k].mailbox_type)
+            {
+                capacity[g]++;
+            }
+        }
+
+        slots += capacity[g];
     }
 
-    /* Be sure to check data_length_code in calling function */
-    for (i = 0U; i < frame.data_length_code; i++)
+    FSP_ERROR_RETURN(0U != slots, FSP_ERR_INVALID_MODE);
+
+    /* Split each range into aligned power-of-two blocks, merging blocks whenever there are more than slots. */
+    can_filter_entry_t entries[CAN_MAX_NO_MAILBOXES + 1U];
+    uint32_t           entry_count = 0U;
+
+    for (uint32_t f = 0U; f < count; f++)
     {
-        frame.data[i] = p_ctrl->p_reg->MB[mailbox].D[i]; // Copy receive data to buffer
+        uint32_t id   = p_filters[f].id_min;
+        bool     more = true;
+
+        while (more)
+        {
+            uint32_t size = 1U;
+            while ((0U == (id & ((size << 1) - 1U))) && (((size << 1) - 1U) <= (p_filters[f].id_max - id)))
+            {
+                size <<= 1;
+            }
+
+            entry_count = r_can_filter_add(entries, entry_count, slots, id, id_limit & ~(size - 1U), id_limit);
+
+            more = (id + size - 1U) < p_filters[f].id_max;
+            id  += size;
+        }
     }
 
-    /* Clear rx data flag. Do not modify message-lost flag as this keeps track of
-     * error interrupts to be fired.
-     * This flag will be cleared in the error isr.
-     * Message Lost flag is written as 1 as that has no effect on this bit.
-     * Refer 'Note 1. Write 0 only. Writing 1 has no effect.' under section
-     * '29.2.10 Message Control Register for Receive (MCTL_RXj) (j = 0 to 31)'
-     * or RA6M3 HW manual R01UH0886EJ0100.
-     */
-    p_ctrl->p_reg->MCTL_RX[mailbox] = CAN_MAILBOX_RX_MASK_MSGLOST;
+    /* Place each block in the group whose shared mask grows the least. Open an empty group for a block that would
+     * widen every group already in use. */
+    uint32_t group_mask[CAN_FILTER_GROUPS_MAX];
+    uint32_t group_used[CAN_FILTER_GROUPS_MAX];
+    uint8_t  group_entry[CAN_FILTER_GROUPS_MAX][CAN_MAILBOX_GROUP_SIZE];
 
-    args.p_frame = &frame;
-    args.event   = CAN_EVENT_RX_COMPLETE;
+    for (uint32_t g = 0U; g < group_count; g++)
+    {
+        group_mask[g] = id_limit;
+        group_used[g] = 0U;
+    }
 
-    /* Save the receive mailbox number. */
-    args.mailbox = mailbox;
+    for (uint32_t e = 0U; e < entry_count; e++)
+    {
+        uint32_t best_group = group_count;
+        uint32_t free_group = group_count;
+        uint64_t best_cost  = UINT64_MAX;
+
+        for (uint32_t g = 0U; g < group_count; g++)
+        {
+            if (group_used[g] >= capacity[g])
+            {
+                continue;
+            }
+
+            if (0U == group_used[g])
+            {
+                free_group = (free_group < group_count) ? free_group : g;
+                continue;
+            }
+
+            uint32_t mask     = group_mask[g] & entries[e].mask;
+            uint64_t new_size = r_can_filter_size(mask, id_limit);
+            uint64_t cost     = (group_used[g] * (new_size - r_can_filter_size(group_mask[g], id_limit))) +
+                                (new_size - r_can_filter_size(entries[e].mask, id_limit));
+            if (cost < best_cost)
+            {
+                best_cost  = cost;
+                best_group = g;
+            }
+        }
+
+        if ((free_group < group_count) && (0U != best_cost))
+        {
+            best_group = free_group;
+        }
+
+        group_entry[best_group][group_used[best_group]] = (uint8_t) e;
+        group_mask[best_group] &= entries[e].mask;
+        group_used[best_group]++;
+    }
+
+    /* Mailbox IDs and masks are written in halt mode. */
+    can_operation_mode_t operation_mode = p_ctrl->operation_mode;
+    r_can_mode_transition(p_ctrl, CAN_OPERATION_MODE_HALT, p_ctrl->test_mode);
+
+    uint32_t group_bits   = CAN_GROUP_MASK;
+    uint32_t mask_enabled = 0U;
+
+    for (uint32_t g = 0U; g < group_count; g++)
+    {
+        uint32_t slot = 0U;
+
+        for (uint32_t k = 0U; k < CAN_MAILBOX_GROUP_SIZE; k++)
+        {
+            uint32_t mailbox = (g * CAN_MAILBOX_GROUP_SIZE) + k;
+            if (CAN_MAILBOX_RECEIVE != p_cfg->p_mailbox[mailbox].mailbox_type)
+            {
+                continue;
+            }
+
+            /* Spare mailboxes repeat the last block of their group. Mailboxes in an unused group take an exact
+             * copy of the first block so they accept nothing that is not already accepted. */
+            uint32_t id = entries[0].id;
+            if (0U != group_used[g])
+            {
+                id = entries[group_entry[g][(slot < group_used[g]) ? slot : (group_used[g] - 1U)]].id;
+            }
+
+            slot++;
+
+            /* Stop reception on the mailbox before changing its ID. */
+            p_ctrl->p_reg->MCTL_RX[mailbox] = 0x00U;
+
+            if (CAN_ID_MODE_STANDARD == p_cfg->id_mode)
+            {
+                p_ctrl->p_reg->MB[mailbox].ID = ((uint32_t) (0U << R_CAN0_MB_ID_IDE_Pos) |
+                                                 (uint32_t) (p_cfg->p_mailbox[mailbox].frame_type <<
+                                                             R_CAN0_MB_ID_RTR_Pos) |
+                                                 (uint32_t) ((id & CAN_SID_MASK) << R_CAN0_MB_ID_SID_Pos));
+            }
+            else
+            {
+                p_ctrl->p_reg->MB[mailbox].ID = ((uint32_t) (0U << R_CAN0_MB_ID_IDE_Pos) |
+                                                 (uint32_t) (p_cfg->p_mailbox[mailbox].frame_type <<
+                                                             R_CAN0_MB_ID_RTR_Pos) |
+                                                 (uint32_t) ((id & CAN_XID_MASK) << R_CAN0_MB_ID_EID_Pos));
+            }
+
+            p_ctrl->p_reg->MCTL_RX[mailbox] = CAN_MAILBOX_RX;
+        }
+
+        if (0U != capacity[g])
+        {
+            if (CAN_ID_MODE_STANDARD == p_cfg->id_mode)
+            {
+                p_ctrl->p_reg->MKR[g] = CAN_DEFAULT_MASK & ((group_mask[g] & CAN_SID_MASK) << R_CAN0_MB_ID_SID_Pos);
+            }
+            else
+            {
+                p_ctrl->p_reg->MKR[g] = (group_mask[g] & CAN_XID_MASK);
+            }
+
+            mask_enabled |= group_bits;
+        }
+
+        group_bits = group_bits << CAN_MAILBOX_GROUP_SIZE;
+    }
+
+    p_ctrl->p_reg->MKIVLR = ~(mask_enabled);
+
+    r_can_mode_transition(p_ctrl, operation_mode, p_ctrl->test_mode);
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Get CAN module code and API versions.
+ * @retval  FSP_SUCCESS             Operation succeeded.
+ * @retval  FSP_ERR_ASSERTION       Null pointer presented
+ * note This function is reentrant.
+ **********************************************************************************************************************/
+fsp_err_t R_CAN_VersionGet (fsp_version_t * const p_version)
+{
+#if CAN_CFG_PARAM_CHECKING_ENABLE
+
+    /* Check pointer for NULL value */
+    FSP_ASSERT(NULL != p_version);
+#endif
+
+    /* Return module version information. */
+    p_version->version_id = g_can_version.version_id;
+
+    return FSP_SUCCESS;
+}
 
+/*******************************************************************************************************************//**
+ * @} (end addtogroup CAN)
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Private Functions
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * Calls user callback.
+ *
+ * @param[in]     p_ctrl     Pointer to CAN instance control block
+ * @param[in]     p_args     Pointer to arguments on stack
+ **********************************************************************************************************************/
+static void r_can_call_callback (can_instance_ctrl_t * p_ctrl, can_callback_args_t * p_args)
+{
+    can_callback_args_t args;
+
+    BSP_TRACE(FSP_IP_CAN, p_ctrl->p_cfg->channel, p_args->event, p_args->mailbox);
+
+    /* Store callback arguments in memory provided by user if available.  This allows callback arguments to be
+     * stored in non-secure memory so they can be accessed by a non-secure callback function. */
+    can_callback_args_t * p_args_memory = p_ctrl->p_callback_memory;
+    if (NULL == p_args_memory)
+    {
+        /* Use provided args struct on stack */
+        p_args_memory = p_args;
+    }
+    else
+    {
+        /* Save current arguments on the stack in case this is a nested interrupt. */
+        args = *p_args_memory;
+
+        /* Copy the stacked args to callback memory */
+        *p_args_memory = *p_args;
+    }
+
+#if BSP_TZ_SECURE_BUILD
+
+    /* p_callback can point to a secure function or a non-secure function. */
+    if (!cmse_is_nsfptr(p_ctrl->p_callback))
+    {
+        /* If p_callback is secure, then the project does not need to change security state. */
+        p_ctrl->p_callback(p_args_memory);
+    }
+    else
+    {
+        /* If p_callback is Non-secure, then the project must change to Non-secure state in order to call the callback. */
+        can_prv_ns_callback p_callback = (can_prv_ns_callback) (p_ctrl->p_callback);
+        p_callback(p_args_memory);
+    }
+
+#else
+
+    /* If the project is not Trustzone Secure, then it will never need to change security state in order to call the callback. */
+    p_ctrl->p_callback(p_args_memory);
+#endif
+
+    if (NULL != p_ctrl->p_callback_memory)
+    {
+        /* Restore callback memory in case this is a nested interrupt. */
+        *p_ctrl->p_callback_memory = args;
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Error ISR.
+ *
+ * Saves context if RTOS is used, clears interrupts, calls common error function, and restores context if RTOS is used.
+ **********************************************************************************************************************/
+void can_error_isr (void)
+{
+    /* Save context if RTOS is used */
+    FSP_CONTEXT_SAVE
+    /* Clear interrupt */
+    R_BSP_IrqStatusClear(R_FSP_CurrentIrqGet());
+
+    IRQn_Type             irq    = R_FSP_CurrentIrqGet();
+    can_instance_ctrl_t * p_ctrl = (can_instance_ctrl_t *) R_FSP_IsrContextGet(irq);
+
+    can_callback_args_t args    = {0U};
+    uint32_t            mailbox = 0U;
+
+    /* Get source of error interrupt. */
+    args.event = (can_event_t) p_ctrl->p_reg->EIFR; // Read Error Interrupt Factor Judge register
+
+    p_ctrl->p_reg->EIFR = 0x00U;                    // Clear Error Interrupt Factor Judge register
+
+    /* Although NMLST detects both Overwrite and Overrun conditions,
+     * in such a scenario this interrupt is fired only when the peripheral is in the overrun mode
+     * (Either on its own or manually by setting NVIC_SetPendingIRQ below).
+     * The receive_overrun bit may not be checked here.
+     */
+    if (p_ctrl->p_reg->STR_b.NMLST)
+    {
+        args.event |= CAN_EVENT_MAILBOX_MESSAGE_LOST;
+        uint8_t saved_msmr = p_ctrl->p_reg->MSMR;          // Save the current MSMR value
+        p_ctrl->p_reg->MSMR = CAN_ERROR_SEARCH;            // search for lowest numbered mailbox with message lost
+        mailbox             = p_ctrl->p_reg->MSSR_b.MBNST; // get mailbox number
+        p_ctrl->p_reg->MSMR = saved_msmr;                  // Restore the previous MSMR value
+        p_ctrl->p_reg->MCTL_RX_b[mailbox].MSGLOST = 0U;    // Clear the error so that NMLST is not set again for an already handled error.
+    }
+
+    args.p_frame   = NULL;
     args.channel   = p_ctrl->p_cfg->channel;
     args.p_context = p_ctrl->p_context;
+    args.mailbox   = mailbox;
     r_can_call_callback(p_ctrl, &args);
 
+    /* Check for mailboxes with data loss due to overrun,
+     * if true, fire this interrupt again.
+     * Do not re-trigger this interrupt due to message loss in overwrite mode.
+     */
+    if (p_ctrl->p_reg->STR_b.NMLST && (CAN_MESSAGE_MODE_OVERWRITE != p_ctrl->p_cfg->message_mode))
+    {
+        NVIC_SetPendingIRQ(p_ctrl->p_cfg->error_irq);
+    }
+
+    /* Restore context if RTOS is used */
+    FSP_CONTEXT_RESTORE
+}
+
+/*******************************************************************************************************************//**
+ * Receive ISR.
+ *
+ * Saves context if RTOS is used, clears interrupts, calls common receive function
+ * and restores context if RTOS is used.
+ **********************************************************************************************************************/
+void can_mailbox_rx_isr (void)
+{
+    /* Save context if RTOS is used */
+    FSP_CONTEXT_SAVE
+    /* Clear interrupt */
+    R_BSP_IrqStatusClear(R_FSP_CurrentIrqGet());
+
+    IRQn_Type             irq    = R_FSP_CurrentIrqGet();
+    can_instance_ctrl_t * p_ctrl = (can_instance_ctrl_t *) R_FSP_IsrContextGet(irq);
+
+    if (NULL != p_ctrl->p_rx_fifo)
+    {
+        /* Drain all receive mailboxes into the software FIFO. */
+        r_can_rx_fifo_fill(p_ctrl);
+    }
+    else
+    {
+        can_callback_args_t args;
+        uint32_t            mailbox    = 0U;
+        uint8_t             saved_msmr = p_ctrl->p_reg->MSMR; // Save the current MSMR value
+        p_ctrl->p_reg->MSMR = CAN_RECEIVE_SEARCH;             // search for lowest numbered mailbox with new data
+        mailbox             = p_ctrl->p_reg->MSSR_b.MBNST;    // get mailbox number
+        p_ctrl->p_reg->MSMR = saved_msmr;                     // Restore the previous MSMR value
+        can_frame_t frame;
+
+        r_can_mailbox_read(p_ctrl, mailbox, &frame);
+
+        args.p_frame = &frame;
+        args.event   = CAN_EVENT_RX_COMPLETE;
+
+        /* Save the receive mailbox number. */
+        args.mailbox = mailbox;
+
+        args.channel   = p_ctrl->p_cfg->channel;
+        args.p_context = p_ctrl->p_context;
+        r_can_call_callback(p_ctrl, &args);
+    }
+
     /* Check for mailboxes with receive data, if true, fire this interrupt again */
     if ((p_ctrl->p_reg->STR_b.NDST))
     {
@@ -914,6 +1339,12 @@ void can_mailbox_tx_isr (void)
     args.p_frame   = NULL;
     r_can_call_callback(p_ctrl, &args);
 
+    /* Reload the free mailbox from the transmit queue. */
+    if (NULL != p_ctrl->p_tx_queue)
+    {
+        r_can_tx_queue_service(p_ctrl);
+    }
+
     /* Check for other mailboxes with pending transmit complete flags. */
     if ((p_ctrl->p_reg->STR_b.SDST))
     {
@@ -987,6 +1418,373 @@ static void r_can_switch_to_operation_mode (can_instance_ctrl_t * p_ctrl, can_op
                                (uint32_t) ((uint8_t) canm_mode_setting << R_CAN0_CTLR_CANM_Pos));
 }
 
+/*******************************************************************************************************************//**
+ * Copy a received frame out of a mailbox and release the mailbox for the next frame.
+ * @param[in]  p_ctrl            - pointer to control structure
+ * @param[in]  mailbox           - receive mailbox holding new data
+ * @param[out] p_frame           - destination frame
+ **********************************************************************************************************************/
+static void r_can_mailbox_read (can_instance_ctrl_t * p_ctrl, uint32_t mailbox, can_frame_t * p_frame)
+{
+    /* Get frame data. */
+    uint32_t i;
+    uint32_t mbox_id = p_ctrl->p_reg->MB[mailbox].ID;
+
+    /* Get the frame type */
+    p_frame->type = (can_frame_type_t) ((mbox_id & R_CAN0_MB_ID_RTR_Msk) >> R_CAN0_MB_ID_RTR_Pos);
+
+    /* Get the frame id */
+    if (CAN_ID_MODE_STANDARD == p_ctrl->p_cfg->id_mode)
+    {
+        p_frame->id = (mbox_id & R_CAN0_MB_ID_SID_Msk) >> R_CAN0_MB_ID_SID_Pos;
+    }
+    else
+    {
+        p_frame->id = mbox_id;
+    }
+
+    /* Get the frame data length code */
+    p_frame->data_length_code = p_ctrl->p_reg->MB[mailbox].DL_b.DLC;
+
+    /* Refer Note 1 about DLC[3:0] under Section 37.2.6
+     * 'Mailbox Register j (MBj_ID, MBj_DL, MBj_Dm, MBj_TS) (j = 0 to 31; m = 0 to 7)'
+     * of RA6M3 manual R01UH0886EJ010.
+     */
+    if (p_frame->data_length_code > CAN_MAX_DATA_LENGTH)
+    {
+        p_frame->data_length_code = CAN_MAX_DATA_LENGTH;
+    }
+
+    /* Be sure to check data_length_code in calling function */
+    for (i = 0U; i < p_frame->data_length_code; i++)
+    {
+        p_frame->data[i] = p_ctrl->p_reg->MB[mailbox].D[i]; // Copy receive data to buffer
+    }
+
+    /* Clear rx data flag. Do not modify message-lost flag as this keeps track of
+     * error interrupts to be fired.
+     * This flag will be cleared in the error isr.
+     * Message Lost flag is written as 1 as that has no effect on this bit.
+     * Refer 'Note 1. Write 0 only. Writing 1 has no effect.' under section
+     * '29.2.10 Message Control Register for Receive (MCTL_RXj) (j = 0 to 31)'
+     * or RA6M3 HW manual R01UH0886EJ0100.
+     */
+    p_ctrl->p_reg->MCTL_RX[mailbox] = CAN_MAILBOX_RX_MASK_MSGLOST;
+}
+
+/*******************************************************************************************************************//**
+ * Move every frame waiting in the receive mailboxes into the software FIFO and notify the user once per batch.
+ * @param[in]  p_ctrl            - pointer to control structure
+ **********************************************************************************************************************/
+static void r_can_rx_fifo_fill (can_instance_ctrl_t * p_ctrl)
+{
+    can_rx_fifo_cfg_t const * p_fifo = p_ctrl->p_rx_fifo;
+    uint32_t                  head   = p_ctrl->rx_fifo_head;
+    uint32_t                  lost   = 0U;
+    can_frame_t               discard;
+
+    uint8_t saved_msmr = p_ctrl->p_reg->MSMR;          // Save the current MSMR value
+    p_ctrl->p_reg->MSMR = CAN_RECEIVE_SEARCH;          // search for lowest numbered mailbox with message received
+
+    /* Bound the pass to one frame per mailbox so a saturated bus cannot hold the CPU in this ISR. */
+    for (uint32_t n = 0U; (n < p_ctrl->p_cfg->mailbox_count) && p_ctrl->p_reg->STR_b.NDST; n++)
+    {
+        uint32_t mailbox = p_ctrl->p_reg->MSSR_b.MBNST; // get mailbox number
+
+        if ((head - p_ctrl->rx_fifo_tail) < p_fifo->length)
+        {
+            r_can_mailbox_read(p_ctrl, mailbox, &p_fifo->p_buffer[head & (p_fifo->length - 1U)]);
+            head++;
+            p_ctrl->rx_fifo_batch++;
+        }
+        else
+        {
+            /* The FIFO is full. Release the mailbox anyway so newer frames are not lost in hardware. */
+            r_can_mailbox_read(p_ctrl, mailbox, &discard);
+            lost++;
+        }
+    }
+
+    p_ctrl->p_reg->MSMR = saved_msmr;                  // Restore the previous MSMR value
+
+    /* Publish the new frames to R_CAN_RxFifoRead. */
+    p_ctrl->rx_fifo_head = head;
+
+    if ((p_ctrl->rx_fifo_batch >= p_fifo->batch_size) || (0U != lost))
+    {
+        can_callback_args_t args;
+
+        p_ctrl->rx_fifo_batch = 0U;
+
+        args.event = CAN_EVENT_RX_COMPLETE;
+        if (0U != lost)
+        {
+            args.event |= CAN_EVENT_MAILBOX_MESSAGE_LOST;
+        }
+
+        /* The mailbox argument carries the number of unread frames. */
+        args.mailbox   = head - p_ctrl->rx_fifo_tail;
+        args.p_frame   = NULL;
+        args.channel   = p_ctrl->p_cfg->channel;
+        args.p_context = p_ctrl->p_context;
+        r_can_call_callback(p_ctrl, &args);
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Load a frame into a transmit mailbox and request transmission.
+ * @param[in]  p_ctrl            - pointer to control structure
+ * @param[in]  mailbox           - free transmit mailbox
+ * @param[in]  p_frame           - frame to send
+ **********************************************************************************************************************/
+static void r_can_mailbox_write (can_instance_ctrl_t * p_ctrl, uint32_t mailbox, can_frame_t const * p_frame)
+{
+    /* Setup the frame to be transmitted. */
+
+    /* Set the ID based on the ID mode */
+    if (CAN_ID_MODE_STANDARD == p_ctrl->p_cfg->id_mode)
+    {
+        p_ctrl->p_reg->MB[mailbox].ID = ((uint32_t) (0U << R_CAN0_MB_ID_IDE_Pos) |
+                                         (uint32_t) (p_frame->type << R_CAN0_MB_ID_RTR_Pos) |
+                                         (uint32_t) ((p_frame->id & CAN_SID_MASK) << R_CAN0_MB_ID_SID_Pos));
+    }
+    else
+    {
+        p_ctrl->p_reg->MB[mailbox].ID = ((uint32_t) (0U << R_CAN0_MB_ID_IDE_Pos) |
+                                         (uint32_t) (p_frame->type << R_CAN0_MB_ID_RTR_Pos) |
+                                         (uint32_t) ((p_frame->id & CAN_XID_MASK) << R_CAN0_MB_ID_EID_Pos));
+    }
+
+    /* Put mailbox data length code */
+    p_ctrl->p_reg->MB[mailbox].DL_b.DLC = (p_frame->data_length_code & 0x0FU);
+
+    /* Put mailbox data. */
+    for (uint32_t i = 0U; i < p_frame->data_length_code; i++)
+    {
+        p_ctrl->p_reg->MB[mailbox].D[i] = p_frame->data[i];
+    }
+
+    /* Transmit the frame */
+    p_ctrl->p_reg->MCTL_TX[mailbox] = CAN_MAILBOX_TX;
+}
+
+/*******************************************************************************************************************//**
+ * Read the CAN ID held in a mailbox.
+ * @param[in]  p_ctrl            - pointer to control structure
+ * @param[in]  mailbox           - mailbox number
+ *
+ * @return CAN ID of the mailbox.
+ **********************************************************************************************************************/
+static uint32_t r_can_mailbox_id_get (can_instance_ctrl_t * p_ctrl, uint32_t mailbox)
+{
+    uint32_t mbox_id = p_ctrl->p_reg->MB[mailbox].ID;
+
+    if (CAN_ID_MODE_STANDARD == p_ctrl->p_cfg->id_mode)
+    {
+        return (mbox_id & R_CAN0_MB_ID_SID_Msk) >> R_CAN0_MB_ID_SID_Pos;
+    }
+
+    return mbox_id & CAN_XID_MASK;
+}
+
+/*******************************************************************************************************************//**
+ * Insert a frame into the transmit queue, which is kept sorted by ID (lowest ID at index 0). The caller makes sure
+ * there is room.
+ * @param[in]  p_ctrl            - pointer to control structure
+ * @param[in]  p_frame           - frame to insert
+ * @param[in]  ahead             - true to place the frame before queued frames with the same ID
+ **********************************************************************************************************************/
+static void r_can_tx_queue_insert (can_instance_ctrl_t * p_ctrl, can_frame_t const * p_frame, bool ahead)
+{
+    can_frame_t * p_buffer = p_ctrl->p_tx_queue->p_buffer;
+    uint32_t      i        = p_ctrl->tx_queue_count;
+
+    /* Shift lower priority frames up by one. */
+    while ((i > 0U) && ((p_buffer[i - 1U].id > p_frame->id) || (ahead && (p_buffer[i - 1U].id == p_frame->id))))
+    {
+        p_buffer[i] = p_buffer[i - 1U];
+        i--;
+    }
+
+    p_buffer[i] = *p_frame;
+    p_ctrl->tx_queue_count++;
+}
+
+/*******************************************************************************************************************//**
+ * Load free transmit mailboxes from the head of the queue. If the queue still holds a frame with a lower ID than a
+ * loaded mailbox, abort the loaded frame with the highest ID, requeue it and load the queued frame in its place.
+ * @param[in]  p_ctrl            - pointer to control structure
+ **********************************************************************************************************************/
+static void r_can_tx_queue_service (can_instance_ctrl_t * p_ctrl)
+{
+    can_frame_t * p_buffer       = p_ctrl->p_tx_queue->p_buffer;
+    uint32_t      lowest_mailbox = CAN_MAX_NO_MAILBOXES;
+    uint32_t      lowest_id      = 0U;
+
+    for (uint32_t mailbox = 0U; mailbox < p_ctrl->p_cfg->mailbox_count; mailbox++)
+    {
+        if (0U == (p_ctrl->tx_queue_mbox & (1U << mailbox)))
+        {
+            continue;
+        }
+
+        uint8_t mctl = p_ctrl->p_reg->MCTL_TX[mailbox];
+
+        if (0U == (mctl & (R_CAN0_MCTL_TX_TRMREQ_Msk | R_CAN0_MCTL_TX_SENTDATA_Msk)))
+        {
+            /* Free mailbox. Frames pending SENTDATA are left for the transmit ISR. */
+            if (0U != p_ctrl->tx_queue_count)
+            {
+                r_can_mailbox_write(p_ctrl, mailbox, &p_buffer[0]);
+                p_ctrl->tx_queue_count--;
+                for (uint32_t i = 0U; i < p_ctrl->tx_queue_count; i++)
+                {
+                    p_buffer[i] = p_buffer[i + 1U];
+                }
+            }
+        }
+        else if (0U == (mctl & R_CAN0_MCTL_TX_SENTDATA_Msk))
+        {
+            /* Track the loaded frame that loses arbitration against every other loaded frame. */
+            uint32_t id = r_can_mailbox_id_get(p_ctrl, mailbox);
+            if ((CAN_MAX_NO_MAILBOXES == lowest_mailbox) || (id > lowest_id))
+            {
+                lowest_mailbox = mailbox;
+                lowest_id      = id;
+            }
+        }
+        else
+        {
+            /* Transmission complete, waiting for the transmit ISR. */
+        }
+    }
+
+    if ((0U == p_ctrl->tx_queue_count) || (CAN_MAX_NO_MAILBOXES == lowest_mailbox) || (p_buffer[0].id >= lowest_id))
+    {
+        return;
+    }
+
+    /* Abort the lowest priority frame. A frame already on the bus completes and is handled by the transmit ISR.
+     * Clear only TRMREQ, as SENTDATA and TRMREQ cannot be cleared simultaneously. */
+    p_ctrl->p_reg->MCTL_TX_b[lowest_mailbox].TRMREQ = 0U;
+    FSP_HARDWARE_REGISTER_WAIT(p_ctrl->p_reg->MCTL_TX_b[lowest_mailbox].TRMACTIVE, 0U);
+
+    if (p_ctrl->p_reg->MCTL_TX_b[lowest_mailbox].TRMABT)
+    {
+        can_frame_t aborted;
+
+        aborted.id               = lowest_id;
+        aborted.type             =
+            (can_frame_type_t) ((p_ctrl->p_reg->MB[lowest_mailbox].ID & R_CAN0_MB_ID_RTR_Msk) >> R_CAN0_MB_ID_RTR_Pos);
+        aborted.data_length_code = p_ctrl->p_reg->MB[lowest_mailbox].DL_b.DLC;
+        for (uint32_t i = 0U; i < aborted.data_length_code; i++)
+        {
+            aborted.data[i] = p_ctrl->p_reg->MB[lowest_mailbox].D[i];
+        }
+
+        /* Clear TRMABT, then send the queued frame from this mailbox. */
+        p_ctrl->p_reg->MCTL_TX[lowest_mailbox] = CAN_TRANSMIT_CLEAR;
+        r_can_mailbox_write(p_ctrl, lowest_mailbox, &p_buffer[0]);
+
+        /* Replace the head with the aborted frame and move it back to its place. It was written before any queued
+         * frame with the same ID, so it goes ahead of them. */
+        p_ctrl->tx_queue_count--;
+        for (uint32_t i = 0U; i < p_ctrl->tx_queue_count; i++)
+        {
+            p_buffer[i] = p_buffer[i + 1U];
+        }
+
+        r_can_tx_queue_insert(p_ctrl, &aborted, true);
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Add an acceptance filter block, keeping at most max_count blocks.
+ *
+ * Blocks already covered by an existing block are dropped. When the list overflows, the pair of blocks whose smallest
+ * common block admits the fewest IDs not accepted before is merged.
+ *
+ * @param[in,out] p_entries      - block list with room for max_count + 1 blocks
+ * @param[in]     count          - number of blocks in the list
+ * @param[in]     max_count      - maximum number of blocks to keep
+ * @param[in]     id             - first ID of the new block
+ * @param[in]     mask           - compare mask of the new block
+ * @param[in]     id_limit       - ID bits used in the current ID mode
+ *
+ * @return Number of blocks in the list.
+ **********************************************************************************************************************/
+static uint32_t r_can_filter_add (can_filter_entry_t * p_entries,
+                                  uint32_t             count,
+                                  uint32_t             max_count,
+                                  uint32_t             id,
+                                  uint32_t             mask,
+                                  uint32_t             id_limit)
+{
+    for (uint32_t i = 0U; i < count; i++)
+    {
+        if (((p_entries[i].mask & mask) == p_entries[i].mask) && (0U == ((id ^ p_entries[i].id) & p_entries[i].mask)))
+        {
+            return count;
+        }
+    }
+
+    p_entries[count].id   = id & mask;
+    p_entries[count].mask = mask;
+    count++;
+
+    if (count > max_count)
+    {
+        uint32_t best_i    = 0U;
+        uint32_t best_j    = 1U;
+        int64_t  best_cost = INT64_MAX;
+
+        for (uint32_t i = 0U; i < count; i++)
+        {
+            for (uint32_t j = i + 1U; j < count; j++)
+            {
+                uint32_t merged = p_entries[i].mask & p_entries[j].mask & ~(p_entries[i].id ^ p_entries[j].id);
+                int64_t  cost   = (int64_t) r_can_filter_size(merged, id_limit) -
+                                  (int64_t) r_can_filter_size(p_entries[i].mask, id_limit) -
+                                  (int64_t) r_can_filter_size(p_entries[j].mask, id_limit);
+                if (cost < best_cost)
+                {
+                    best_cost = cost;
+                    best_i    = i;
+                    best_j    = j;
+                }
+            }
+        }
+
+        p_entries[best_i].mask &= p_entries[best_j].mask & ~(p_entries[best_i].id ^ p_entries[best_j].id);
+        p_entries[best_i].id   &= p_entries[best_i].mask;
+        p_entries[best_j]       = p_entries[count - 1U];
+        count--;
+    }
+
+    return count;
+}
+
+/*******************************************************************************************************************//**
+ * Number of IDs accepted by a compare mask.
+ * @param[in]  mask              - compare mask
+ * @param[in]  id_limit          - ID bits used in the current ID mode
+ *
+ * @return Number of IDs accepted.
+ **********************************************************************************************************************/
+static uint64_t r_can_filter_size (uint32_t mask, uint32_t id_limit)
+{
+    uint32_t dont_care = id_limit & ~mask;
+    uint64_t size      = 1U;
+
+    while (0U != dont_care)
+    {
+        size      <<= 1;
+        dont_care &= dont_care - 1U;
+    }
+
+    return size;
+}
+
 /*******************************************************************************************************************//**
  * Enable CAN interrupt
  * @param[in]  p_ctrl            - pointer to control structure
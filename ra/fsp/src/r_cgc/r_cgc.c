@@ -137,6 +137,11 @@ static void                  r_cgc_clock_change(cgc_clock_t clock, cgc_clock_cha
 static cgc_prv_clock_state_t r_cgc_clock_run_state_get(cgc_clock_t clock);
 static void                  r_cgc_post_change(cgc_prv_change_t change);
 static void                  r_cgc_pre_change(cgc_prv_change_t change);
+static uint32_t              r_cgc_notifier_hz_get(cgc_notifier_t const * p_notifier, uint32_t clock_source,
+                                                   uint32_t sckdivcr);
+static void                  r_cgc_notify(cgc_instance_ctrl_t * p_instance_ctrl, cgc_notify_event_t event,
+                                          uint32_t clock_source, uint32_t sckdivcr);
+static uint8_t volatile *    r_cgc_trim_register_get(cgc_clock_t clock_source);
 
 #if !BSP_CFG_USE_LOW_VOLTAGE_MODE
 static bool r_cgc_subosc_mode_possible(uint32_t sckdivcr);
@@ -289,6 +294,7 @@ fsp_err_t R_CGC_Open (cgc_ctrl_t * const p_ctrl, cgc_cfg_t const * const p_cfg)
     p_instance_ctrl->p_callback        = p_cfg->p_callback;
     p_instance_ctrl->p_context         = p_cfg->p_context;
     p_instance_ctrl->p_callback_memory = NULL;
+    p_instance_ctrl->p_notifiers       = NULL;
 
     /* Mark the module as open so other APIs can be used. */
     p_instance_ctrl->open = CGC_OPEN;
@@ -835,6 +841,10 @@ fsp_err_t R_CGC_ClockStop (cgc_ctrl_t * const p_ctrl, cgc_clock_t clock_source)
  * This function also updates the RAM and ROM wait states, the operating power control mode, and the SystemCoreClock
  * CMSIS global variable.
  *
+ * The change is rejected if an internal clock would drop below the minimum frequency of a notifier registered with
+ * R_CGC_NotifierRegister(). Otherwise the notifier callbacks are called with CGC_NOTIFY_EVENT_PRE_CHANGE before and
+ * CGC_NOTIFY_EVENT_POST_CHANGE after the clocks are switched.
+ *
  * Example:
  * @snippet r_cgc_example.c R_CGC_SystemClockSet
  *
@@ -843,6 +853,7 @@ fsp_err_t R_CGC_ClockStop (cgc_ctrl_t * const p_ctrl, cgc_clock_t clock_source)
  * @retval FSP_ERR_NOT_OPEN             Module is not open.
  * @retval FSP_ERR_CLOCK_INACTIVE       The specified clock source is inactive.
  * @retval FSP_ERR_NOT_STABILIZED       The clock source has not stabilized
+ * @retval FSP_ERR_IN_USE               A registered notifier needs a faster clock than requested.
  **********************************************************************************************************************/
 fsp_err_t R_CGC_SystemClockSet (cgc_ctrl_t * const              p_ctrl,
                                 cgc_clock_t                     clock_source,
@@ -868,9 +879,6 @@ fsp_err_t R_CGC_SystemClockSet (cgc_ctrl_t * const              p_ctrl,
     FSP_PARAMETER_NOT_USED(p_instance_ctrl);
 #endif
 
-    /* Prerequisite to starting clocks or changing the system clock. */
-    r_cgc_pre_change(CGC_PRV_CHANGE_LPM_CGC);
-
     cgc_divider_cfg_t clock_cfg;
     clock_cfg.sckdivcr_w = p_divider_cfg->sckdivcr_w;
 #if BSP_FEATURE_CGC_SCKDIVCR_BCLK_MATCHES_PCLKB
@@ -878,11 +886,28 @@ fsp_err_t R_CGC_SystemClockSet (cgc_ctrl_t * const              p_ctrl,
     /* Some MCUs require the bits normally used for BCLK to be set the same as PCLKB. */
     clock_cfg.bclk_div = clock_cfg.pclkb_div;
 #endif
+
+    /* Reject the change before anything is modified if a driver cannot run at the new frequency. */
+    for (cgc_notifier_t const * p_notifier = p_instance_ctrl->p_notifiers;
+         NULL != p_notifier;
+         p_notifier = p_notifier->p_next)
+    {
+        FSP_ERROR_RETURN(r_cgc_notifier_hz_get(p_notifier, clock_source, clock_cfg.sckdivcr_w) >= p_notifier->min_hz,
+                         FSP_ERR_IN_USE);
+    }
+
+    r_cgc_notify(p_instance_ctrl, CGC_NOTIFY_EVENT_PRE_CHANGE, clock_source, clock_cfg.sckdivcr_w);
+
+    /* Prerequisite to starting clocks or changing the system clock. */
+    r_cgc_pre_change(CGC_PRV_CHANGE_LPM_CGC);
+
     bsp_prv_clock_set(clock_source, clock_cfg.sckdivcr_w);
 
     /* Apply the optimal operating power mode and restore the cache to it's previous state. */
     r_cgc_post_change(CGC_PRV_CHANGE_LPM_CGC);
 
+    r_cgc_notify(p_instance_ctrl, CGC_NOTIFY_EVENT_POST_CHANGE, clock_source, clock_cfg.sckdivcr_w);
+
     return FSP_SUCCESS;
 }
 
@@ -1023,9 +1048,7 @@ fsp_err_t R_CGC_OscStopDetectEnable (cgc_ctrl_t * const p_ctrl)
     R_ICU->NMIER = R_ICU_NMIER_OSTEN_Msk;
 
     /* Enable oscillation stop detection */
-    R_BSP_RegisterProtectDisable(BSP_REG_PROTECT_CGC);
-    R_SYSTEM->OSTDCR = CGC_PRV_OSTDCR_OSC_STOP_ENABLE;
-    R_BSP_RegisterProtectEnable(BSP_REG_PROTECT_CGC);
+    BSP_REG_PROTECT_WRITE(BSP_REG_PROTECT_CGC, R_SYSTEM->OSTDCR, CGC_PRV_OSTDCR_OSC_STOP_ENABLE);
 
     return FSP_SUCCESS;
 }
@@ -1059,9 +1082,7 @@ fsp_err_t R_CGC_OscStopDetectDisable (cgc_ctrl_t * const p_ctrl)
 #endif
 
     /* Disable oscillation stop detection. */
-    R_BSP_RegisterProtectDisable(BSP_REG_PROTECT_CGC);
-    R_SYSTEM->OSTDCR = 0U;             // disable osc stop detection
-    R_BSP_RegisterProtectEnable(BSP_REG_PROTECT_CGC);
+    BSP_REG_PROTECT_WRITE(BSP_REG_PROTECT_CGC, R_SYSTEM->OSTDCR, 0U); // disable osc stop detection
 
 #if !BSP_CFG_USE_LOW_VOLTAGE_MODE
 
@@ -1206,6 +1227,163 @@ fsp_err_t R_CGC_CallbackSet (cgc_ctrl_t * const          p_api_ctrl,
     return FSP_SUCCESS;
 }
 
+/*******************************************************************************************************************//**
+ * Registers a clock constraint and change notification for a driver. R_CGC_SystemClockSet() keeps
+ * cgc_notifier_t::clock at or above cgc_notifier_t::min_hz while the notifier is registered, and calls
+ * cgc_notifier_t::p_callback around each change so the driver settings that depend on the clock can be updated. For
+ * example, a notifier on FSP_PRIV_CLOCK_PCLKA can stop SCI UART transfers before the change and call
+ * R_SCI_UART_BaudCalculate() and R_SCI_UART_BaudSet() after it.
+ *
+ * Callbacks are called from R_CGC_SystemClockSet() in registration order, with interrupts enabled.
+ *
+ * @retval FSP_SUCCESS                 Notifier registered.
+ * @retval FSP_ERR_ASSERTION           Invalid input argument.
+ * @retval FSP_ERR_NOT_OPEN            Module is not open.
+ * @retval FSP_ERR_ALREADY_OPEN        The notifier is already registered.
+ **********************************************************************************************************************/
+fsp_err_t R_CGC_NotifierRegister (cgc_ctrl_t * const p_ctrl, cgc_notifier_t * const p_notifier)
+{
+    cgc_instance_ctrl_t * p_instance_ctrl = (cgc_instance_ctrl_t *) p_ctrl;
+
+#if CGC_CFG_PARAM_CHECKING_ENABLE
+
+    /* Verify p_instance_ctrl is not NULL and the module is open. */
+    fsp_err_t err = r_cgc_common_parameter_checking(p_instance_ctrl);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+    FSP_ASSERT(NULL != p_notifier);
+#endif
+
+    for (cgc_notifier_t * p_node = p_instance_ctrl->p_notifiers; NULL != p_node; p_node = p_node->p_next)
+    {
+        FSP_ERROR_RETURN(p_node != p_notifier, FSP_ERR_ALREADY_OPEN);
+    }
+
+    /* Append so notifiers are called in registration order. */
+    p_notifier->p_next = NULL;
+
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+
+    cgc_notifier_t ** pp_next = &p_instance_ctrl->p_notifiers;
+    while (NULL != *pp_next)
+    {
+        pp_next = &(*pp_next)->p_next;
+    }
+
+    *pp_next = p_notifier;
+
+    FSP_CRITICAL_SECTION_EXIT;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Removes a notifier registered with R_CGC_NotifierRegister(), for example when the driver is closed.
+ *
+ * @retval FSP_SUCCESS                 Notifier removed.
+ * @retval FSP_ERR_ASSERTION           Invalid input argument.
+ * @retval FSP_ERR_NOT_OPEN            Module is not open.
+ * @retval FSP_ERR_NOT_FOUND           The notifier is not registered.
+ **********************************************************************************************************************/
+fsp_err_t R_CGC_NotifierUnregister (cgc_ctrl_t * const p_ctrl, cgc_notifier_t * const p_notifier)
+{
+    cgc_instance_ctrl_t * p_instance_ctrl = (cgc_instance_ctrl_t *) p_ctrl;
+
+#if CGC_CFG_PARAM_CHECKING_ENABLE
+
+    /* Verify p_instance_ctrl is not NULL and the module is open. */
+    fsp_err_t err = r_cgc_common_parameter_checking(p_instance_ctrl);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+    FSP_ASSERT(NULL != p_notifier);
+#endif
+
+    fsp_err_t ret = FSP_ERR_NOT_FOUND;
+
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+
+    for (cgc_notifier_t ** pp_next = &p_instance_ctrl->p_notifiers; NULL != *pp_next; pp_next = &(*pp_next)->p_next)
+    {
+        if (p_notifier == *pp_next)
+        {
+            *pp_next = p_notifier->p_next;
+            ret      = FSP_SUCCESS;
+            break;
+        }
+    }
+
+    FSP_CRITICAL_SECTION_EXIT;
+
+    FSP_ERROR_RETURN(FSP_SUCCESS == ret, ret);
+
+    p_notifier->p_next = NULL;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Sets the user trimming value of an on-chip oscillator. The value is added to the factory trimming value, so 0
+ * restores the factory frequency. Positive values raise the frequency and negative values lower it; refer to the
+ * electrical characteristics in the hardware manual for the step size. R_CAC_MonitorStart() uses this to keep HOCO or
+ * MOCO on frequency across temperature.
+ *
+ * This function may be called from an interrupt.
+ *
+ * @retval FSP_SUCCESS                 Trimming value set.
+ * @retval FSP_ERR_ASSERTION           Invalid input argument.
+ * @retval FSP_ERR_NOT_OPEN            Module is not open.
+ * @retval FSP_ERR_INVALID_ARGUMENT    The clock has no user trimming register. Only HOCO, MOCO and LOCO can be
+ *                                     trimmed.
+ **********************************************************************************************************************/
+fsp_err_t R_CGC_ClockTrimSet (cgc_ctrl_t * const p_ctrl, cgc_clock_t clock_source, int8_t trim)
+{
+#if CGC_CFG_PARAM_CHECKING_ENABLE
+
+    /* Verify p_instance_ctrl is not NULL and the module is open. */
+    fsp_err_t err = r_cgc_common_parameter_checking((cgc_instance_ctrl_t *) p_ctrl);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+#else
+    FSP_PARAMETER_NOT_USED(p_ctrl);
+#endif
+
+    uint8_t volatile * p_trim_register = r_cgc_trim_register_get(clock_source);
+    FSP_ERROR_RETURN(NULL != p_trim_register, FSP_ERR_INVALID_ARGUMENT);
+
+    /* The user trimming registers are protected by PRC0. */
+    BSP_REG_PROTECT_WRITE(BSP_REG_PROTECT_CGC, *p_trim_register, (uint8_t) trim);
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Gets the user trimming value of an on-chip oscillator set by R_CGC_ClockTrimSet().
+ *
+ * @retval FSP_SUCCESS                 Trimming value returned in p_trim.
+ * @retval FSP_ERR_ASSERTION           Invalid input argument.
+ * @retval FSP_ERR_NOT_OPEN            Module is not open.
+ * @retval FSP_ERR_INVALID_ARGUMENT    The clock has no user trimming register. Only HOCO, MOCO and LOCO can be
+ *                                     trimmed.
+ **********************************************************************************************************************/
+fsp_err_t R_CGC_ClockTrimGet (cgc_ctrl_t * const p_ctrl, cgc_clock_t clock_source, int8_t * const p_trim)
+{
+#if CGC_CFG_PARAM_CHECKING_ENABLE
+
+    /* Verify p_instance_ctrl is not NULL and the module is open. */
+    fsp_err_t err = r_cgc_common_parameter_checking((cgc_instance_ctrl_t *) p_ctrl);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+    FSP_ASSERT(NULL != p_trim);
+#else
+    FSP_PARAMETER_NOT_USED(p_ctrl);
+#endif
+
+    uint8_t volatile * p_trim_register = r_cgc_trim_register_get(clock_source);
+    FSP_ERROR_RETURN(NULL != p_trim_register, FSP_ERR_INVALID_ARGUMENT);
+
+    *p_trim = (int8_t) *p_trim_register;
+
+    return FSP_SUCCESS;
+}
+
 /******************************************************************************************************************//**
  * Closes the CGC module.  Implements @ref cgc_api_t::close.
  *
@@ -1272,6 +1450,84 @@ static fsp_err_t r_cgc_common_parameter_checking (cgc_instance_ctrl_t * p_instan
 
 #endif
 
+/*******************************************************************************************************************//**
+ * Gets the user trimming register of an on-chip oscillator.
+ *
+ * @param[in]  clock_source            Oscillator to trim.
+ *
+ * @return Address of the trimming register, or NULL if the clock cannot be trimmed.
+ **********************************************************************************************************************/
+static uint8_t volatile * r_cgc_trim_register_get (cgc_clock_t clock_source)
+{
+    switch (clock_source)
+    {
+        case CGC_CLOCK_HOCO:
+        {
+            return &R_SYSTEM->HOCOUTCR;
+        }
+
+        case CGC_CLOCK_MOCO:
+        {
+            return &R_SYSTEM->MOCOUTCR;
+        }
+
+        case CGC_CLOCK_LOCO:
+        {
+            return &R_SYSTEM->LOCOUTCR;
+        }
+
+        default:
+        {
+            return NULL;
+        }
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Computes the frequency of the clock of a notifier for a system clock configuration.
+ *
+ * @param[in]  p_notifier              Registered notifier.
+ * @param[in]  clock_source            System clock source.
+ * @param[in]  sckdivcr                SCKDIVCR register setting.
+ *
+ * @return Frequency of the notifier clock in Hertz.
+ **********************************************************************************************************************/
+static uint32_t r_cgc_notifier_hz_get (cgc_notifier_t const * p_notifier, uint32_t clock_source, uint32_t sckdivcr)
+{
+    uint32_t clock_div = (sckdivcr >> p_notifier->clock) & FSP_PRIV_SCKDIVCR_DIV_MASK;
+
+    return bsp_prv_source_clock_hz_get(clock_source) >> clock_div;
+}
+
+/*******************************************************************************************************************//**
+ * Calls the callback of every registered notifier.
+ *
+ * @param[in]  p_instance_ctrl         Pointer to instance control structure.
+ * @param[in]  event                   Notification event.
+ * @param[in]  clock_source            System clock source after the change.
+ * @param[in]  sckdivcr                SCKDIVCR register setting after the change.
+ **********************************************************************************************************************/
+static void r_cgc_notify (cgc_instance_ctrl_t * p_instance_ctrl,
+                          cgc_notify_event_t    event,
+                          uint32_t              clock_source,
+                          uint32_t              sckdivcr)
+{
+    for (cgc_notifier_t const * p_notifier = p_instance_ctrl->p_notifiers;
+         NULL != p_notifier;
+         p_notifier = p_notifier->p_next)
+    {
+        if (NULL != p_notifier->p_callback)
+        {
+            cgc_notify_args_t args;
+
+            args.event     = event;
+            args.clock_hz  = r_cgc_notifier_hz_get(p_notifier, clock_source, sckdivcr);
+            args.p_context = p_notifier->p_context;
+            p_notifier->p_callback(&args);
+        }
+    }
+}
+
 /*******************************************************************************************************************//**
  * Sets operating mode to high speed mode, unlocks CGC and LPM protection registers, disables the flash cache, and
  * returns the previous state of the flash cache.  Must be paired with r_cgc_post_change().
@@ -33,6 +33,17 @@
 
 #define CRC_CRCCR1_CRCSWR_SHIFT    (5)
 
+/* Blocks of this many transfers are used for calculations that do not fit in a single normal mode transfer. */
+#define CRC_PRV_TRANSFER_BLOCK_LENGTH    (1024U)
+#define CRC_PRV_TRANSFER_MAX_LENGTH      (0xFFFFU)
+#define CRC_PRV_TRANSFER_MAX_BLOCKS      (0xFFFFU)
+
+/* Fixed part of the transfer settings, the mode and source are set for each calculation. */
+#define CRC_PRV_TRANSFER_SETTINGS        ((TRANSFER_ADDR_MODE_FIXED << TRANSFER_SETTINGS_DEST_ADDR_BITS) |           \
+                                          (TRANSFER_REPEAT_AREA_DESTINATION << TRANSFER_SETTINGS_REPEAT_AREA_BITS) | \
+                                          (TRANSFER_IRQ_END << TRANSFER_SETTINGS_IRQ_BITS) |                         \
+                                          (TRANSFER_ADDR_MODE_INCREMENTED << TRANSFER_SETTINGS_SRC_ADDR_BITS))
+
 /***********************************************************************************************************************
  * Typedef definitions
  **********************************************************************************************************************/
@@ -44,8 +55,12 @@ static void crc_calculate_polynomial(crc_instance_ctrl_t * const p_instance_ctrl
                                      crc_input_t * const         p_crc_input,
                                      uint32_t                  * calculatedValue);
 
+static void     crc_input_write(crc_instance_ctrl_t * const p_instance_ctrl, void const * p_buffer, uint32_t length);
 static void     crc_seed_value_update(crc_instance_ctrl_t * const p_instance_ctrl, uint32_t crc_seed);
 static uint32_t crc_calculated_value_get(crc_instance_ctrl_t * const p_instance_ctrl);
+static void     crc_crccr0_set(crc_instance_ctrl_t * const p_instance_ctrl, uint8_t dorclr);
+static void     crc_snoop_start(crc_snoop_address_t snoop_address);
+static bool     crc_transfer_busy(void);
 
 /***********************************************************************************************************************
  * Private global variables
@@ -60,16 +75,23 @@ static const fsp_version_t s_crc_version =
     .code_version_minor = CRC_CODE_VERSION_MINOR
 };
 
+/* Transfer feeding the calculator, NULL when no DMA calculation is in progress. The calculator is shared by every
+ * instance, so this is tracked for the peripheral rather than per instance. */
+static transfer_instance_t const * gp_crc_transfer_active = NULL;
+
 /* Filled in Interface API structure for this Instance. */
 const crc_api_t g_crc_on_crc =
 {
-    .open         = R_CRC_Open,
-    .close        = R_CRC_Close,
-    .calculate    = R_CRC_Calculate,
-    .crcResultGet = R_CRC_CalculatedValueGet,
-    .snoopEnable  = R_CRC_SnoopEnable,
-    .snoopDisable = R_CRC_SnoopDisable,
-    .versionGet   = R_CRC_VersionGet
+    .open           = R_CRC_Open,
+    .close          = R_CRC_Close,
+    .calculate      = R_CRC_Calculate,
+    .calculateStart = R_CRC_CalculateStart,
+    .stateSave      = R_CRC_StateSave,
+    .stateRestore   = R_CRC_StateRestore,
+    .crcResultGet   = R_CRC_CalculatedValueGet,
+    .snoopEnable    = R_CRC_SnoopEnable,
+    .snoopDisable   = R_CRC_SnoopDisable,
+    .versionGet     = R_CRC_VersionGet
 };
 
 /*******************************************************************************************************************//**
@@ -92,6 +114,9 @@ const crc_api_t g_crc_on_crc =
  * @retval FSP_SUCCESS             Configuration was successful.
  * @retval FSP_ERR_ASSERTION       p_ctrl or p_cfg is NULL.
  * @retval FSP_ERR_ALREADY_OPEN    Module already open
+ * @return                         See @ref RENESAS_ERROR_CODES or functions called by this function for other possible
+ *                                 return codes. This function calls:
+ *                                     * @ref transfer_api_t::open
  **********************************************************************************************************************/
 fsp_err_t R_CRC_Open (crc_ctrl_t * const p_ctrl, crc_cfg_t const * const p_cfg)
 {
@@ -108,24 +133,34 @@ fsp_err_t R_CRC_Open (crc_ctrl_t * const p_ctrl, crc_cfg_t const * const p_cfg)
     /* Save the configuration  */
     p_instance_ctrl->p_cfg = p_cfg;
 
+    transfer_instance_t const * p_transfer = p_cfg->p_transfer;
+    if (NULL != p_transfer)
+    {
+        /* The transfer writes to the data input register that matches the width of the polynomial. */
+        p_transfer->p_cfg->p_info->transfer_settings_word = CRC_PRV_TRANSFER_SETTINGS;
+        if ((CRC_POLYNOMIAL_CRC_32 == p_cfg->polynomial) || (CRC_POLYNOMIAL_CRC_32C == p_cfg->polynomial))
+        {
+            p_transfer->p_cfg->p_info->size   = TRANSFER_SIZE_4_BYTE;
+            p_transfer->p_cfg->p_info->p_dest = (void *) &R_CRC->CRCDIR;
+        }
+        else
+        {
+            p_transfer->p_cfg->p_info->size   = TRANSFER_SIZE_1_BYTE;
+            p_transfer->p_cfg->p_info->p_dest = (void *) &R_CRC->CRCDIR_BY;
+        }
+
+        fsp_err_t err = p_transfer->p_api->open(p_transfer->p_ctrl, p_transfer->p_cfg);
+        FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+    }
+
     /* Mark driver as initialized by setting the open value to the ASCII equivalent of "CRC" */
     p_instance_ctrl->open = CRC_OPEN;
 
     /* Power on CRC */
     R_BSP_MODULE_START(FSP_IP_CRC, 0);
 
-    uint8_t crccr0 = 0;
-
-    /* Set bit order value */
-    crccr0 = (uint8_t) (p_instance_ctrl->p_cfg->bit_order << R_CRC_CRCCR0_LMS_Pos);
-
-    /* Set CRC polynomial */
-    crccr0 |= (uint8_t) (p_instance_ctrl->p_cfg->polynomial << R_CRC_CRCCR0_GPS_Pos);
-
-    /* Set DORCLR to clear CRCDOR */
-    crccr0 |= (uint8_t) (1 << R_CRC_CRCCR0_DORCLR_Pos);
-
-    R_CRC->CRCCR0 = crccr0;
+    /* Set the bit order and polynomial, and set DORCLR to clear CRCDOR */
+    crc_crccr0_set(p_instance_ctrl, 1U);
 
     /* Disable snooping */
     R_CRC->CRCCR1 = 0;
@@ -152,6 +187,18 @@ fsp_err_t R_CRC_Close (crc_ctrl_t * const p_ctrl)
     FSP_ERROR_RETURN(CRC_OPEN == p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
 #endif
 
+    transfer_instance_t const * p_transfer = p_instance_ctrl->p_cfg->p_transfer;
+    if (NULL != p_transfer)
+    {
+        /* Abort a calculation in progress on this instance's transfer. */
+        if (p_transfer == gp_crc_transfer_active)
+        {
+            gp_crc_transfer_active = NULL;
+        }
+
+        p_transfer->p_api->close(p_transfer->p_ctrl);
+    }
+
     R_BSP_MODULE_STOP(FSP_IP_CRC, 0);
 
     /* Mark driver as closed */
@@ -172,6 +219,7 @@ fsp_err_t R_CRC_Close (crc_ctrl_t * const p_ctrl)
  * @retval FSP_ERR_ASSERTION        Either p_ctrl, inputBuffer, or calculatedValue is NULL.
  * @retval FSP_ERR_INVALID_ARGUMENT length value is NULL.
  * @retval FSP_ERR_NOT_OPEN         The driver is not opened.
+ * @retval FSP_ERR_IN_USE           A DMA calculation is in progress.
  **********************************************************************************************************************/
 fsp_err_t R_CRC_Calculate (crc_ctrl_t * const p_ctrl, crc_input_t * const p_crc_input, uint32_t * calculatedValue)
 {
@@ -183,6 +231,7 @@ fsp_err_t R_CRC_Calculate (crc_ctrl_t * const p_ctrl, crc_input_t * const p_crc_
     FSP_ERROR_RETURN((0UL != p_crc_input->num_bytes), FSP_ERR_INVALID_ARGUMENT);
     FSP_ERROR_RETURN(CRC_OPEN == p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
 #endif
+    FSP_ERROR_RETURN(!crc_transfer_busy(), FSP_ERR_IN_USE);
 
     /* Calculate CRC value for the input buffer */
     crc_calculate_polynomial(p_instance_ctrl, p_crc_input, calculatedValue);
@@ -190,6 +239,163 @@ fsp_err_t R_CRC_Calculate (crc_ctrl_t * const p_ctrl, crc_input_t * const p_crc_
     return FSP_SUCCESS;
 }
 
+/*******************************************************************************************************************//**
+ * Start a CRC calculation on a block of 8-bit/32-bit (for 32-bit polynomial) data using the DMAC transfer configured
+ * in @ref crc_cfg_t::p_transfer.
+ *
+ * Implements @ref crc_api_t::calculateStart
+ *
+ * The calculator is fed by the DMAC so the CPU is free while large memory regions such as firmware images are checked.
+ * Completion is signalled by the transfer callback, or can be polled with R_CRC_CalculatedValueGet(), which returns
+ * FSP_ERR_IN_USE until the last data has been written. Data that does not fit in a single normal mode transfer is
+ * sent in blocks of 1024 transfers; the leading remainder is written by the CPU before the transfer is started.
+ *
+ * @retval FSP_SUCCESS              Calculation started.
+ * @retval FSP_ERR_ASSERTION        Either p_ctrl, p_crc_input, or the input buffer is NULL.
+ * @retval FSP_ERR_INVALID_ARGUMENT Length is less than one transfer.
+ * @retval FSP_ERR_INVALID_SIZE     Length exceeds the maximum number of blocks the DMAC can transfer.
+ * @retval FSP_ERR_NOT_OPEN         The driver is not opened.
+ * @retval FSP_ERR_UNSUPPORTED      No transfer instance is configured.
+ * @retval FSP_ERR_IN_USE           A DMA calculation is already in progress.
+ * @return                          See @ref RENESAS_ERROR_CODES or functions called by this function for other possible
+ *                                  return codes. This function calls:
+ *                                      * @ref transfer_api_t::reconfigure
+ *                                      * @ref transfer_api_t::softwareStart
+ **********************************************************************************************************************/
+fsp_err_t R_CRC_CalculateStart (crc_ctrl_t * const p_ctrl, crc_input_t * const p_crc_input)
+{
+    crc_instance_ctrl_t * p_instance_ctrl = (crc_instance_ctrl_t *) p_ctrl;
+#if CRC_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(p_ctrl);
+    FSP_ASSERT(p_crc_input);
+    FSP_ASSERT(p_crc_input->p_input_buffer);
+    FSP_ERROR_RETURN(CRC_OPEN == p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
+    FSP_ERROR_RETURN(NULL != p_instance_ctrl->p_cfg->p_transfer, FSP_ERR_UNSUPPORTED);
+#endif
+    FSP_ERROR_RETURN(!crc_transfer_busy(), FSP_ERR_IN_USE);
+
+    transfer_instance_t const * p_transfer = p_instance_ctrl->p_cfg->p_transfer;
+    transfer_info_t           * p_info     = p_transfer->p_cfg->p_info;
+
+    /* 32-bit polynomials consume 4 bytes per transfer, trailing bytes are ignored as in R_CRC_Calculate(). */
+    uint32_t shift     = (TRANSFER_SIZE_4_BYTE == p_info->size) ? 2U : 0U;
+    uint32_t transfers = p_crc_input->num_bytes >> shift;
+    uint32_t head      = 0U;
+
+    FSP_ERROR_RETURN(0U != transfers, FSP_ERR_INVALID_ARGUMENT);
+
+    if (transfers <= CRC_PRV_TRANSFER_MAX_LENGTH)
+    {
+        p_info->mode   = TRANSFER_MODE_NORMAL;
+        p_info->length = (uint16_t) transfers;
+    }
+    else
+    {
+        uint32_t num_blocks = transfers / CRC_PRV_TRANSFER_BLOCK_LENGTH;
+        FSP_ERROR_RETURN(num_blocks <= CRC_PRV_TRANSFER_MAX_BLOCKS, FSP_ERR_INVALID_SIZE);
+
+        head               = transfers % CRC_PRV_TRANSFER_BLOCK_LENGTH;
+        p_info->mode       = TRANSFER_MODE_BLOCK;
+        p_info->length     = (uint16_t) CRC_PRV_TRANSFER_BLOCK_LENGTH;
+        p_info->num_blocks = (uint16_t) num_blocks;
+    }
+
+    crc_seed_value_update(p_instance_ctrl, p_crc_input->crc_seed);
+
+    /* Write the data that does not fill a whole block first so the data reaches the calculator in order. */
+    uint8_t const * p_buffer = (uint8_t const *) p_crc_input->p_input_buffer;
+    crc_input_write(p_instance_ctrl, p_buffer, head << shift);
+    p_info->p_src = p_buffer + (head << shift);
+
+    fsp_err_t err = p_transfer->p_api->reconfigure(p_transfer->p_ctrl, p_info);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+    gp_crc_transfer_active = p_transfer;
+
+    /* Keep requesting transfers until all the data has been written. */
+    err = p_transfer->p_api->softwareStart(p_transfer->p_ctrl, TRANSFER_START_MODE_REPEAT);
+    if (FSP_SUCCESS != err)
+    {
+        gp_crc_transfer_active = NULL;
+    }
+
+    return err;
+}
+
+/*******************************************************************************************************************//**
+ * Save the partial calculation so the calculator can be used for another stream of data.
+ *
+ * Implements @ref crc_api_t::stateSave
+ *
+ * If snooping is enabled it is disabled and recorded in the saved state so R_CRC_StateRestore() can enable it again.
+ *
+ * @retval FSP_SUCCESS             State saved.
+ * @retval FSP_ERR_ASSERTION       Either p_ctrl or p_state is NULL.
+ * @retval FSP_ERR_NOT_OPEN        The driver is not opened.
+ * @retval FSP_ERR_IN_USE          A DMA calculation is in progress.
+ **********************************************************************************************************************/
+fsp_err_t R_CRC_StateSave (crc_ctrl_t * const p_ctrl, crc_state_t * const p_state)
+{
+    crc_instance_ctrl_t * p_instance_ctrl = (crc_instance_ctrl_t *) p_ctrl;
+
+#if CRC_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(p_ctrl);
+    FSP_ASSERT(p_state);
+    FSP_ERROR_RETURN(CRC_OPEN == p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+    FSP_ERROR_RETURN(!crc_transfer_busy(), FSP_ERR_IN_USE);
+
+    p_state->snoop_address = CRC_SNOOP_ADDRESS_NONE;
+    if (R_CRC->CRCCR1 & R_CRC_CRCCR1_CRCSEN_Msk)
+    {
+        /* Stop snooping before reading the value so no data is lost between the read and the restore. */
+        R_CRC->CRCCR1          = 0;
+        p_state->snoop_address = p_instance_ctrl->p_cfg->snoop_address;
+    }
+
+    p_state->value = crc_calculated_value_get(p_instance_ctrl);
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Resume a partial calculation saved by R_CRC_StateSave().
+ *
+ * Implements @ref crc_api_t::stateRestore
+ *
+ * Selects the polynomial and bit order of this instance, loads the partial value and enables snooping again if it was
+ * enabled when the state was saved. Data written with R_CRC_Calculate() or R_CRC_CalculateStart() continues the
+ * calculation when the saved value is passed as the seed.
+ *
+ * @retval FSP_SUCCESS             State restored.
+ * @retval FSP_ERR_ASSERTION       Either p_ctrl or p_state is NULL.
+ * @retval FSP_ERR_NOT_OPEN        The driver is not opened.
+ * @retval FSP_ERR_IN_USE          A DMA calculation is in progress.
+ **********************************************************************************************************************/
+fsp_err_t R_CRC_StateRestore (crc_ctrl_t * const p_ctrl, crc_state_t const * const p_state)
+{
+    crc_instance_ctrl_t * p_instance_ctrl = (crc_instance_ctrl_t *) p_ctrl;
+
+#if CRC_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(p_ctrl);
+    FSP_ASSERT(p_state);
+    FSP_ERROR_RETURN(CRC_OPEN == p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+    FSP_ERROR_RETURN(!crc_transfer_busy(), FSP_ERR_IN_USE);
+
+    /* Snooping of another stream must not feed this one. */
+    R_CRC->CRCCR1 = 0;
+
+    crc_seed_value_update(p_instance_ctrl, p_state->value);
+
+    if (CRC_SNOOP_ADDRESS_NONE != p_state->snoop_address)
+    {
+        crc_snoop_start(p_state->snoop_address);
+    }
+
+    return FSP_SUCCESS;
+}
+
 /*******************************************************************************************************************//**
  * Return the current calculated value.
  *
@@ -200,6 +406,7 @@ fsp_err_t R_CRC_Calculate (crc_ctrl_t * const p_ctrl, crc_input_t * const p_crc_
  * @retval FSP_SUCCESS             Return of calculated value successful.
  * @retval FSP_ERR_ASSERTION       Either p_ctrl or calculatedValue is NULL.
  * @retval FSP_ERR_NOT_OPEN        The driver is not opened.
+ * @retval FSP_ERR_IN_USE          A DMA calculation is still in progress.
  *
  **********************************************************************************************************************/
 fsp_err_t R_CRC_CalculatedValueGet (crc_ctrl_t * const p_ctrl, uint32_t * calculatedValue)
@@ -211,6 +418,7 @@ fsp_err_t R_CRC_CalculatedValueGet (crc_ctrl_t * const p_ctrl, uint32_t * calcul
     FSP_ASSERT(calculatedValue);
     FSP_ERROR_RETURN(CRC_OPEN == p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
 #endif
+    FSP_ERROR_RETURN(!crc_transfer_busy(), FSP_ERR_IN_USE);
 
     /* Based on the selected polynomial, return the calculated CRC value */
     *calculatedValue = crc_calculated_value_get(p_instance_ctrl);
@@ -230,6 +438,7 @@ fsp_err_t R_CRC_CalculatedValueGet (crc_ctrl_t * const p_ctrl, uint32_t * calcul
  * @retval FSP_SUCCESS             Snoop configured successfully.
  * @retval FSP_ERR_ASSERTION       Pointer to control stucture is NULL
  * @retval FSP_ERR_NOT_OPEN        The driver is not opened.
+ * @retval FSP_ERR_IN_USE          A DMA calculation is in progress.
  *
  **********************************************************************************************************************/
 fsp_err_t R_CRC_SnoopEnable (crc_ctrl_t * const p_ctrl, uint32_t crc_seed)
@@ -240,22 +449,11 @@ fsp_err_t R_CRC_SnoopEnable (crc_ctrl_t * const p_ctrl, uint32_t crc_seed)
     FSP_ASSERT(p_ctrl);
     FSP_ERROR_RETURN(CRC_OPEN == p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
 #endif
-    uint8_t crccr1 = 0;
-    uint8_t crcsar = 0;
-
-    /* Set CRC snoop direction */
-    crccr1 = (uint8_t) ((p_instance_ctrl->p_cfg->snoop_address & 2) << CRC_CRCCR1_CRCSWR_SHIFT);
-
-    /* Set CRC snoop address */
-    crcsar = (uint8_t) (p_instance_ctrl->p_cfg->snoop_address & R_CRC_CRCSAR_CRCSA_Msk);
-
-    R_CRC->CRCSAR = crcsar;
+    FSP_ERROR_RETURN(!crc_transfer_busy(), FSP_ERR_IN_USE);
 
     crc_seed_value_update(p_instance_ctrl, crc_seed);
 
-    /* Enable the snoop operation */
-    crccr1       |= (1 << R_CRC_CRCCR1_CRCSEN_Pos);
-    R_CRC->CRCCR1 = crccr1;
+    crc_snoop_start(p_instance_ctrl->p_cfg->snoop_address);
 
     return FSP_SUCCESS;
 }
@@ -321,6 +519,9 @@ static void crc_seed_value_update (crc_instance_ctrl_t * const p_instance_ctrl,
 {
     uint32_t crcdor = 0;
 
+    /* Select this instance's polynomial and bit order, another instance may have used the calculator since. */
+    crc_crccr0_set(p_instance_ctrl, 0U);
+
     /* Based on the selected polynomial, set the initial CRC seed value */
     switch (p_instance_ctrl->p_cfg->polynomial)
     {
@@ -401,12 +602,25 @@ static uint32_t crc_calculated_value_get (crc_instance_ctrl_t * const p_instance
 static void crc_calculate_polynomial (crc_instance_ctrl_t * const p_instance_ctrl,
                                       crc_input_t * const         p_crc_input,
                                       uint32_t                  * calculatedValue)
+{
+    crc_seed_value_update(p_instance_ctrl, p_crc_input->crc_seed);
+
+    crc_input_write(p_instance_ctrl, p_crc_input->p_input_buffer, p_crc_input->num_bytes);
+
+    /* Return the calculated value */
+    *calculatedValue = crc_calculated_value_get(p_instance_ctrl);
+}
+
+/*******************************************************************************************************************//**
+ * Write a block of data to the CRC calculator.
+ *
+ * @param[in]  p_instance_ctrl         Pointer to instance control block
+ * @param[in]  p_buffer                Pointer to the data
+ * @param[in]  length                  Length of the data in bytes
+ **********************************************************************************************************************/
+static void crc_input_write (crc_instance_ctrl_t * const p_instance_ctrl, void const * p_buffer, uint32_t length)
 {
     uint32_t i;
-    void   * inputBuffer = p_crc_input->p_input_buffer;
-    uint32_t length      = p_crc_input->num_bytes;
-    uint32_t crc_seed    = p_crc_input->crc_seed;
-    crc_seed_value_update(p_instance_ctrl, crc_seed);
 
     /* Write each element of the inputBuffer to the CRC Data Input Register. Each write to the
      * Data Input Register generates a new calculated value in the Data Output Register.  */
@@ -416,7 +630,7 @@ static void crc_calculate_polynomial (crc_instance_ctrl_t * const p_instance_ctr
         case CRC_POLYNOMIAL_CRC_16:
         case CRC_POLYNOMIAL_CRC_CCITT:
         {
-            uint8_t * p_data = (uint8_t *) inputBuffer;
+            uint8_t const * p_data = (uint8_t const *) p_buffer;
             for (i = (uint32_t) 0; i < length; i++)
             {
                 /* CRCDIR is a 32-bit read/write register to write data to for CRC-32 or CRC-32C calculation.
@@ -432,7 +646,7 @@ static void crc_calculate_polynomial (crc_instance_ctrl_t * const p_instance_ctr
 
         default:
         {
-            uint32_t * p_data = (uint32_t *) inputBuffer;
+            uint32_t const * p_data = (uint32_t const *) p_buffer;
 
             for (i = (uint32_t) 0; i < (length / 4); i++)
             {
@@ -444,7 +658,78 @@ static void crc_calculate_polynomial (crc_instance_ctrl_t * const p_instance_ctr
             break;
         }
     }
+}
 
-    /* Return the calculated value */
-    *calculatedValue = crc_calculated_value_get(p_instance_ctrl);
+/*******************************************************************************************************************//**
+ * Select the polynomial and bit order of an instance.
+ *
+ * @param[in]  p_instance_ctrl         Pointer to instance control block
+ * @param[in]  dorclr                  1 to clear CRCDOR, 0 to keep it
+ **********************************************************************************************************************/
+static void crc_crccr0_set (crc_instance_ctrl_t * const p_instance_ctrl, uint8_t dorclr)
+{
+    uint8_t crccr0 = 0;
+
+    /* Set bit order value */
+    crccr0 = (uint8_t) (p_instance_ctrl->p_cfg->bit_order << R_CRC_CRCCR0_LMS_Pos);
+
+    /* Set CRC polynomial */
+    crccr0 |= (uint8_t) (p_instance_ctrl->p_cfg->polynomial << R_CRC_CRCCR0_GPS_Pos);
+
+    /* Set DORCLR to clear CRCDOR */
+    crccr0 |= (uint8_t) (dorclr << R_CRC_CRCCR0_DORCLR_Pos);
+
+    R_CRC->CRCCR0 = crccr0;
+}
+
+/*******************************************************************************************************************//**
+ * Configure the snoop address and enable snooping.
+ *
+ * @param[in]  snoop_address           SCI register to snoop
+ **********************************************************************************************************************/
+static void crc_snoop_start (crc_snoop_address_t snoop_address)
+{
+    uint8_t crccr1 = 0;
+    uint8_t crcsar = 0;
+
+    /* Set CRC snoop direction */
+    crccr1 = (uint8_t) ((snoop_address & 2) << CRC_CRCCR1_CRCSWR_SHIFT);
+
+    /* Set CRC snoop address */
+    crcsar = (uint8_t) (snoop_address & R_CRC_CRCSAR_CRCSA_Msk);
+
+    R_CRC->CRCSAR = crcsar;
+
+    /* Enable the snoop operation */
+    crccr1       |= (1 << R_CRC_CRCCR1_CRCSEN_Pos);
+    R_CRC->CRCCR1 = crccr1;
+}
+
+/*******************************************************************************************************************//**
+ * Check whether a DMA calculation is still writing to the calculator.
+ *
+ * @retval true                        The transfer has data remaining.
+ * @retval false                       No transfer is in progress.
+ **********************************************************************************************************************/
+static bool crc_transfer_busy (void)
+{
+    transfer_instance_t const * p_transfer = gp_crc_transfer_active;
+
+    if (NULL != p_transfer)
+    {
+        transfer_properties_t properties = {0U};
+        p_transfer->p_api->infoGet(p_transfer->p_ctrl, &properties);
+
+        /* The transfer count reloads after each block in block mode, so the block count indicates completion. */
+        uint32_t remaining = (TRANSFER_MODE_NORMAL == p_transfer->p_cfg->p_info->mode) ?
+                             properties.transfer_length_remaining : properties.block_count_remaining;
+        if (0U != remaining)
+        {
+            return true;
+        }
+
+        gp_crc_transfer_active = NULL;
+    }
+
+    return false;
 }
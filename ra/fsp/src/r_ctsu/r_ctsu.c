@@ -182,6 +182,7 @@ typedef BSP_CMSE_NONSECURE_CALL void (*volatile ctsu_prv_ns_callback)(ctsu_callb
 static fsp_err_t ctsu_transfer_open(ctsu_instance_ctrl_t * const p_instance_ctrl);
 static fsp_err_t ctsu_transfer_close(ctsu_instance_ctrl_t * const p_instance_ctrl);
 static fsp_err_t ctsu_transfer_configure(ctsu_instance_ctrl_t * const p_instance_ctrl);
+static bool      ctsu_auto_scan_judge(ctsu_instance_ctrl_t * const p_instance_ctrl);
 
 #endif
 static void ctsu_initial_offset_tuning(ctsu_instance_ctrl_t * const p_instance_ctrl);
@@ -632,6 +633,7 @@ fsp_err_t R_CTSU_Open (ctsu_ctrl_t * const p_ctrl, ctsu_cfg_t const * const p_cf
     p_instance_ctrl->p_callback        = p_cfg->p_callback;
     p_instance_ctrl->p_context         = p_cfg->p_context;
     p_instance_ctrl->p_callback_memory = NULL;
+    p_instance_ctrl->p_auto_scan_cfg   = NULL;
 
     /* Mark driver as open */
     p_instance_ctrl->open = CTSU_OPEN;
@@ -972,6 +974,84 @@ fsp_err_t R_CTSU_CallbackSet (ctsu_ctrl_t * const          p_api_ctrl,
     return FSP_SUCCESS;
 }
 
+/*******************************************************************************************************************//**
+ * @brief Starts autonomous scanning. Each external trigger (for example an AGT underflow linked through the ELC) starts
+ * a scan, the DTC writes the element settings and collects every result, and the CTSUFN interrupt compares the raw
+ * counts with the wake thresholds. The DTC is re-armed for the next trigger inside the interrupt, so the callback is
+ * only called when an element reaches its threshold (CTSU_EVENT_THRESHOLD), an error is detected, or wake_interval
+ * scans have elapsed. After the callback, call R_CTSU_DataGet() and R_CTSU_ScanStart() to process the scan and resume
+ * autonomous scanning.
+ *
+ * To keep the CPU in Software Standby between scans, use the low power mode driver to enter Snooze with DTC operation
+ * enabled, and select CTSU_CTSUFN as a wake up source. Initial offset tuning must be complete before starting.
+ *
+ * @retval FSP_SUCCESS              Autonomous scanning started.
+ * @retval FSP_ERR_ASSERTION        Null pointer passed as a parameter.
+ * @retval FSP_ERR_NOT_OPEN         Module is not open.
+ * @retval FSP_ERR_UNSUPPORTED      DTC support is disabled.
+ * @retval FSP_ERR_INVALID_MODE     Not configured for external trigger in self or mutual full scan mode.
+ * @retval FSP_ERR_CTSU_INCOMPLETE_TUNING      Incomplete initial offset tuning.
+ * @return                          See @ref R_CTSU_ScanStart for other possible return codes.
+ **********************************************************************************************************************/
+fsp_err_t R_CTSU_AutoScanStart (ctsu_ctrl_t * const p_ctrl, ctsu_auto_scan_cfg_t const * const p_auto_scan_cfg)
+{
+    fsp_err_t              err             = FSP_SUCCESS;
+    ctsu_instance_ctrl_t * p_instance_ctrl = (ctsu_instance_ctrl_t *) p_ctrl;
+
+#if (CTSU_CFG_PARAM_CHECKING_ENABLE == 1)
+    FSP_ASSERT(p_instance_ctrl);
+    FSP_ASSERT(p_auto_scan_cfg);
+    FSP_ASSERT(p_auto_scan_cfg->p_threshold);
+    FSP_ERROR_RETURN(CTSU_OPEN == p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+#if (CTSU_CFG_DTC_SUPPORT_ENABLE == 1)
+    FSP_ERROR_RETURN(CTSU_CAP_EXTERNAL == p_instance_ctrl->p_ctsu_cfg->cap, FSP_ERR_INVALID_MODE);
+    FSP_ERROR_RETURN((CTSU_MODE_SELF_MULTI_SCAN == p_instance_ctrl->p_ctsu_cfg->md) ||
+                     (CTSU_MODE_MUTUAL_FULL_SCAN == p_instance_ctrl->p_ctsu_cfg->md),
+                     FSP_ERR_INVALID_MODE);
+    FSP_ERROR_RETURN(CTSU_TUNING_COMPLETE == p_instance_ctrl->tuning, FSP_ERR_CTSU_INCOMPLETE_TUNING);
+
+    p_instance_ctrl->p_auto_scan_cfg = p_auto_scan_cfg;
+    p_instance_ctrl->auto_scan_count = 0;
+
+    err = R_CTSU_ScanStart(p_ctrl);
+    if (FSP_SUCCESS != err)
+    {
+        p_instance_ctrl->p_auto_scan_cfg = NULL;
+    }
+
+    return err;
+#else
+    FSP_PARAMETER_NOT_USED(err);
+    FSP_PARAMETER_NOT_USED(p_instance_ctrl);
+    FSP_PARAMETER_NOT_USED(p_auto_scan_cfg);
+
+    return FSP_ERR_UNSUPPORTED;
+#endif
+}
+
+/*******************************************************************************************************************//**
+ * @brief Stops autonomous scanning. A scan already triggered completes as a normal scan and is reported to the
+ * callback; further scans are not re-armed until R_CTSU_ScanStart() is called.
+ *
+ * @retval FSP_SUCCESS              Autonomous scanning stopped.
+ * @retval FSP_ERR_ASSERTION        Null pointer passed as a parameter.
+ * @retval FSP_ERR_NOT_OPEN         Module is not open.
+ **********************************************************************************************************************/
+fsp_err_t R_CTSU_AutoScanStop (ctsu_ctrl_t * const p_ctrl)
+{
+    ctsu_instance_ctrl_t * p_instance_ctrl = (ctsu_instance_ctrl_t *) p_ctrl;
+
+#if (CTSU_CFG_PARAM_CHECKING_ENABLE == 1)
+    FSP_ASSERT(p_instance_ctrl);
+    FSP_ERROR_RETURN(CTSU_OPEN == p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+
+    p_instance_ctrl->p_auto_scan_cfg = NULL;
+
+    return FSP_SUCCESS;
+}
+
 /*******************************************************************************************************************//**
  * @brief Disables specified CTSU control block. Implements @ref ctsu_api_t::close.
  *
@@ -1007,8 +1087,9 @@ fsp_err_t R_CTSU_Close (ctsu_ctrl_t * const p_ctrl)
 #endif
     }
 
-    p_instance_ctrl->state = CTSU_STATE_INIT;
-    p_instance_ctrl->open  = false;
+    p_instance_ctrl->state           = CTSU_STATE_INIT;
+    p_instance_ctrl->p_auto_scan_cfg = NULL;
+    p_instance_ctrl->open            = false;
 
     return err;
 }
@@ -1278,6 +1359,50 @@ fsp_err_t ctsu_transfer_configure (ctsu_instance_ctrl_t * const p_instance_ctrl)
     return FSP_SUCCESS;
 }
 
+/***********************************************************************************************************************
+ * ctsu_auto_scan_judge
+ ***********************************************************************************************************************/
+bool ctsu_auto_scan_judge (ctsu_instance_ctrl_t * const p_instance_ctrl)
+{
+    uint16_t const * p_threshold = p_instance_ctrl->p_auto_scan_cfg->p_threshold;
+    uint16_t         element_id;
+    int32_t          value;
+
+    for (element_id = 0; element_id < p_instance_ctrl->num_elements; element_id++)
+    {
+        value = 0;
+ #if (CTSU_CFG_NUM_SELF_ELEMENTS != 0)
+        if (CTSU_MODE_SELF_MULTI_SCAN == p_instance_ctrl->p_ctsu_cfg->md)
+        {
+  #if (BSP_FEATURE_CTSU_VERSION == 2)
+            value = p_instance_ctrl->p_self_raw[element_id * CTSU_CFG_NUM_SUMULTI];
+  #else
+            value = (p_instance_ctrl->p_self_raw + element_id)->sen;
+  #endif
+        }
+ #endif
+ #if (CTSU_CFG_NUM_MUTUAL_ELEMENTS != 0)
+        if (CTSU_MODE_MUTUAL_FULL_SCAN == p_instance_ctrl->p_ctsu_cfg->md)
+        {
+  #if (BSP_FEATURE_CTSU_VERSION == 2)
+            value = (int32_t) p_instance_ctrl->p_mutual_raw[(element_id * CTSU_MUTUAL_BUF_SIZE) + 1] -
+                    (int32_t) p_instance_ctrl->p_mutual_raw[element_id * CTSU_MUTUAL_BUF_SIZE];
+  #else
+            value = (int32_t) (p_instance_ctrl->p_mutual_raw + element_id)->snd_sen -
+                    (int32_t) (p_instance_ctrl->p_mutual_raw + element_id)->pri_sen;
+  #endif
+        }
+ #endif
+
+        if (value >= (int32_t) p_threshold[element_id])
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
 #endif
 
 /***********************************************************************************************************************
@@ -1720,6 +1845,43 @@ void ctsu_end_isr (void)
  #endif
 #endif
 
+#if (CTSU_CFG_DTC_SUPPORT_ENABLE == 1)
+    if (NULL != p_instance_ctrl->p_auto_scan_cfg)
+    {
+        bool wake = (CTSU_EVENT_SCAN_COMPLETE != p_args->event);
+
+        if (ctsu_auto_scan_judge(p_instance_ctrl))
+        {
+            p_args->event |= CTSU_EVENT_THRESHOLD;
+            wake           = true;
+        }
+
+        p_instance_ctrl->auto_scan_count++;
+        if (p_instance_ctrl->auto_scan_count == p_instance_ctrl->p_auto_scan_cfg->wake_interval)
+        {
+            wake = true;
+        }
+
+        if (!wake)
+        {
+            /* Re-arm the DTC for the next external trigger and stay in the scanning state without notifying. */
+            p_instance_ctrl->wr_index = 0;
+            p_instance_ctrl->rd_index = 0;
+            (void) ctsu_transfer_configure(p_instance_ctrl);
+
+            if (NULL != p_instance_ctrl->p_callback_memory)
+            {
+                /* Restore callback memory in case this is a nested interrupt. */
+                *p_instance_ctrl->p_callback_memory = args;
+            }
+
+            return;
+        }
+
+        p_instance_ctrl->auto_scan_count = 0;
+    }
+#endif
+
     p_instance_ctrl->state = CTSU_STATE_SCANNED;
     p_args->p_context      = p_instance_ctrl->p_context;
 
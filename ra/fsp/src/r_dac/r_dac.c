@@ -22,6 +22,7 @@
  * Includes
  **********************************************************************************************************************/
 #include <string.h>
+#include <math.h>
 #include "r_dac.h"
 
 /***********************************************************************************************************************
@@ -40,6 +41,9 @@
 #define DAC_DAASWCR_DAASW0_MASK                      (0x40)
 #define DAC_DAASWCR_DAASW1_MASK                      (0x80)
 #define DAC_ADC_UNIT_1                               (0x01)
+#define DAC_MAX_VALUE                                (0x0FFFU)
+#define DAC_LEFT_JUSTIFIED_SHIFT                     (4U)
+#define DAC_TWO_PI                                   (6.28318530718F)
 
 /* Conversion time with Output Amplifier. See hardware manual (see Table 60.44
  *'D/A conversion characteristics' of the RA6M3 manual R01UH0886EJ0100). */
@@ -189,6 +193,7 @@ fsp_err_t R_DAC_Open (dac_ctrl_t * p_api_ctrl, dac_cfg_t const * const p_cfg)
 
     /* Initialize the channel state information. */
     p_ctrl->channel        = p_cfg->channel;
+    p_ctrl->p_waveform_cfg = NULL;
     p_ctrl->channel_opened = DAC_OPEN;
 
     return FSP_SUCCESS;
@@ -403,6 +408,198 @@ fsp_err_t R_DAC_VersionGet (fsp_version_t * p_version)
     return FSP_SUCCESS;
 }
 
+/******************************************************************************************************************//**
+ * Start waveform playback. Each activation of the transfer instance (paced by an AGT or GPT event) writes the next
+ * sample of the table to the D/A Data Register, so the output timing does not depend on CPU interrupt latency. Call
+ * R_DAC_Start to enable the output.
+ *
+ * In circular mode no CPU interrupt is used. In double buffer mode the DMAC transfer end callback must call
+ * R_DAC_WaveformTransferEnd; the DMAC switches tables without a gap before the callback runs.
+ *
+ * @retval   FSP_SUCCESS           Playback started.
+ * @retval   FSP_ERR_ASSERTION     An input parameter is invalid.
+ * @retval   FSP_ERR_NOT_OPEN      Channel associated with p_ctrl has not been opened.
+ * @retval   FSP_ERR_IN_USE        Playback is already started.
+ * @return                         See @ref RENESAS_ERROR_CODES or functions called by this function for other possible
+ *                                 return codes.
+ **********************************************************************************************************************/
+fsp_err_t R_DAC_WaveformStart (dac_ctrl_t * p_api_ctrl, dac_waveform_cfg_t const * const p_waveform_cfg)
+{
+    dac_instance_ctrl_t * p_ctrl = (dac_instance_ctrl_t *) p_api_ctrl;
+    fsp_err_t             err;
+
+#if DAC_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ASSERT(NULL != p_waveform_cfg);
+    FSP_ASSERT(NULL != p_waveform_cfg->p_transfer);
+    FSP_ASSERT(NULL != p_waveform_cfg->p_buffer[0]);
+    FSP_ASSERT(0U != p_waveform_cfg->num_samples);
+    if (DAC_WAVEFORM_MODE_DOUBLE_BUFFER == p_waveform_cfg->mode)
+    {
+        FSP_ASSERT(NULL != p_waveform_cfg->p_buffer[1]);
+    }
+
+    FSP_ERROR_RETURN(p_ctrl->channel_opened, FSP_ERR_NOT_OPEN);
+#endif
+    FSP_ERROR_RETURN(NULL == p_ctrl->p_waveform_cfg, FSP_ERR_IN_USE);
+
+    uint32_t num_links = (DAC_WAVEFORM_MODE_DOUBLE_BUFFER == p_waveform_cfg->mode) ? 2U : 1U;
+    for (uint32_t i = 0U; i < num_links; i++)
+    {
+        transfer_info_t * p_info = &p_ctrl->waveform_info[i];
+        p_info->transfer_settings_word = 0U;
+
+        p_info->size           = TRANSFER_SIZE_2_BYTE;
+        p_info->src_addr_mode  = TRANSFER_ADDR_MODE_INCREMENTED;
+        p_info->dest_addr_mode = TRANSFER_ADDR_MODE_FIXED;
+        p_info->repeat_area    = TRANSFER_REPEAT_AREA_SOURCE;
+        p_info->p_src          = p_waveform_cfg->p_buffer[i];
+        p_info->p_dest         = (void *) &R_DAC->DADR[p_ctrl->channel];
+        p_info->num_blocks     = 0U;
+        p_info->length         = p_waveform_cfg->num_samples;
+
+        if (DAC_WAVEFORM_MODE_CIRCULAR == p_waveform_cfg->mode)
+        {
+            /* The source is rewound after each table, a DTC repeats indefinitely. */
+            p_info->mode       = TRANSFER_MODE_REPEAT;
+            p_info->irq        = TRANSFER_IRQ_END;
+            p_info->chain_mode = TRANSFER_CHAIN_MODE_DISABLED;
+        }
+        else
+        {
+            /* Two link chain, looped by the DMAC, with a notification at the end of each link. */
+            p_info->mode       = TRANSFER_MODE_NORMAL;
+            p_info->irq        = TRANSFER_IRQ_EACH;
+            p_info->chain_mode = (0U == i) ? TRANSFER_CHAIN_MODE_END : TRANSFER_CHAIN_MODE_DISABLED;
+        }
+    }
+
+    transfer_instance_t const * p_transfer = p_waveform_cfg->p_transfer;
+    err = p_transfer->p_api->open(p_transfer->p_ctrl, p_transfer->p_cfg);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+    err = p_transfer->p_api->reconfigure(p_transfer->p_ctrl, &p_ctrl->waveform_info[0]);
+    if (FSP_SUCCESS != err)
+    {
+        (void) p_transfer->p_api->close(p_transfer->p_ctrl);
+
+        return err;
+    }
+
+    p_ctrl->p_waveform_cfg = p_waveform_cfg;
+
+    return FSP_SUCCESS;
+}
+
+/******************************************************************************************************************//**
+ * Stop waveform playback and close the transfer instance. The last sample written stays on the output.
+ *
+ * @retval   FSP_SUCCESS           Playback stopped.
+ * @retval   FSP_ERR_ASSERTION     p_api_ctrl is NULL.
+ * @retval   FSP_ERR_NOT_OPEN      Channel associated with p_ctrl has not been opened.
+ * @retval   FSP_ERR_NOT_ENABLED   Playback is not started.
+ **********************************************************************************************************************/
+fsp_err_t R_DAC_WaveformStop (dac_ctrl_t * p_api_ctrl)
+{
+    dac_instance_ctrl_t * p_ctrl = (dac_instance_ctrl_t *) p_api_ctrl;
+
+#if DAC_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ERROR_RETURN(p_ctrl->channel_opened, FSP_ERR_NOT_OPEN);
+#endif
+    FSP_ERROR_RETURN(NULL != p_ctrl->p_waveform_cfg, FSP_ERR_NOT_ENABLED);
+
+    transfer_instance_t const * p_transfer = p_ctrl->p_waveform_cfg->p_transfer;
+    (void) p_transfer->p_api->close(p_transfer->p_ctrl);
+
+    p_ctrl->p_waveform_cfg = NULL;
+
+    return FSP_SUCCESS;
+}
+
+/******************************************************************************************************************//**
+ * Report the table that has been played in double buffer mode. Call from the DMAC callback with the completed link
+ * (dmac_callback_args_t::p_info). The table must be refilled before the other table has been played.
+ *
+ * @retval   FSP_SUCCESS           Callback called.
+ * @retval   FSP_ERR_ASSERTION     An input parameter is NULL.
+ * @retval   FSP_ERR_NOT_ENABLED   Playback is not started.
+ **********************************************************************************************************************/
+fsp_err_t R_DAC_WaveformTransferEnd (dac_ctrl_t * p_api_ctrl, transfer_info_t const * const p_info)
+{
+    dac_instance_ctrl_t * p_ctrl = (dac_instance_ctrl_t *) p_api_ctrl;
+
+#if DAC_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ASSERT(NULL != p_info);
+#endif
+
+    dac_waveform_cfg_t const * p_waveform_cfg = p_ctrl->p_waveform_cfg;
+    FSP_ERROR_RETURN(NULL != p_waveform_cfg, FSP_ERR_NOT_ENABLED);
+
+    if (NULL != p_waveform_cfg->p_callback)
+    {
+        dac_waveform_callback_args_t args;
+        args.buffer    = (p_info == &p_ctrl->waveform_info[1]) ? 1U : 0U;
+        args.p_context = p_waveform_cfg->p_context;
+        p_waveform_cfg->p_callback(&args);
+    }
+
+    return FSP_SUCCESS;
+}
+
+/******************************************************************************************************************//**
+ * Fill a table with one period of a sine wave, offset + amplitude * sin(2 * pi * n / num_samples), in the data format
+ * configured in R_DAC_Open. Results are limited to the 12-bit range. Played in circular mode, the output frequency is
+ * the pacing event rate divided by num_samples.
+ *
+ * @retval   FSP_SUCCESS           Table generated.
+ * @retval   FSP_ERR_ASSERTION     An input parameter is invalid.
+ * @retval   FSP_ERR_NOT_OPEN      Channel associated with p_ctrl has not been opened.
+ **********************************************************************************************************************/
+fsp_err_t R_DAC_WaveformSineGenerate (dac_ctrl_t     * p_api_ctrl,
+                                      uint16_t * const p_table,
+                                      uint16_t         num_samples,
+                                      uint16_t         amplitude,
+                                      uint16_t         offset)
+{
+    dac_instance_ctrl_t * p_ctrl = (dac_instance_ctrl_t *) p_api_ctrl;
+
+#if DAC_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ASSERT(NULL != p_table);
+    FSP_ASSERT(0U != num_samples);
+    FSP_ERROR_RETURN(p_ctrl->channel_opened, FSP_ERR_NOT_OPEN);
+#else
+    FSP_PARAMETER_NOT_USED(p_ctrl);
+#endif
+
+    uint32_t shift = (0U != (R_DAC->DADPR & (1U << DAC_DADPR_REG_DPSEL_BIT_POS))) ? DAC_LEFT_JUSTIFIED_SHIFT : 0U;
+    float    step  = DAC_TWO_PI / (float) num_samples;
+
+    for (uint32_t n = 0U; n < num_samples; n++)
+    {
+        float value = (float) offset + ((float) amplitude * sinf(step * (float) n)) + 0.5F;
+
+        if (value < 0.0F)
+        {
+            value = 0.0F;
+        }
+        else if (value > (float) DAC_MAX_VALUE)
+        {
+            value = (float) DAC_MAX_VALUE;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+
+        p_table[n] = (uint16_t) ((uint32_t) value << shift);
+    }
+
+    return FSP_SUCCESS;
+}
+
 /*******************************************************************************************************************//**
  * @} (end addtogroup DAC)
  **********************************************************************************************************************/
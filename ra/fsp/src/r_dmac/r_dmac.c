@@ -87,6 +87,17 @@
 #define DMAC_PRV_DMREQ_CLRS_OFFSET     (4U)
 #define DMAC_PRV_DMREQ_CLRS_MASK       (1U << DMAC_PRV_DMREQ_CLRS_OFFSET)
 
+/* Set DMAC_CFG_RAMFUNC_ENABLE to 1 to execute the transfer end interrupt handler and R_DMAC_Reset from RAM. */
+#ifndef DMAC_CFG_RAMFUNC_ENABLE
+ #define DMAC_CFG_RAMFUNC_ENABLE       (0)
+#endif
+
+#if DMAC_CFG_RAMFUNC_ENABLE
+ #define DMAC_PRV_RAMFUNC              BSP_PLACE_IN_RAM
+#else
+ #define DMAC_PRV_RAMFUNC
+#endif
+
 /***********************************************************************************************************************
  * Typedef definitions
  **********************************************************************************************************************/
@@ -104,11 +115,17 @@ typedef struct st_dmac_callback
 /***********************************************************************************************************************
  * Private function prototypes
  **********************************************************************************************************************/
-void dmac_int_isr(void);
+void dmac_int_isr(void) DMAC_PRV_RAMFUNC;
+
+/* Transfers are typically rearmed with R_DMAC_Reset from the transfer end callback. */
+fsp_err_t R_DMAC_Reset(transfer_ctrl_t * const p_api_ctrl, void const * volatile p_src, void * volatile p_dest,
+                       uint16_t const num_transfers) DMAC_PRV_RAMFUNC;
 
-static fsp_err_t r_dmac_prv_enable(dmac_instance_ctrl_t * p_ctrl);
-static void      r_dmac_prv_disable(dmac_instance_ctrl_t * p_ctrl);
+static fsp_err_t r_dmac_prv_enable(dmac_instance_ctrl_t * p_ctrl) DMAC_PRV_RAMFUNC;
+static void      r_dmac_prv_disable(dmac_instance_ctrl_t * p_ctrl) DMAC_PRV_RAMFUNC;
 static void      r_dmac_config_transfer_info(dmac_instance_ctrl_t * p_ctrl, transfer_info_t * p_info);
+static void      r_dmac_prv_link_write(dmac_instance_ctrl_t * p_ctrl, transfer_info_t const * p_info) DMAC_PRV_RAMFUNC;
+static bool      r_dmac_prv_irq_required(dmac_instance_ctrl_t const * p_ctrl);
 
 #if DMAC_CFG_PARAM_CHECKING_ENABLE
 static fsp_err_t r_dma_open_parameter_checking(dmac_instance_ctrl_t * const p_ctrl, transfer_cfg_t const * const p_cfg);
@@ -213,6 +230,12 @@ fsp_err_t R_DMAC_Reconfigure (transfer_ctrl_t * const p_api_ctrl, transfer_info_
     FSP_ERROR_RETURN(p_ctrl->open == DMAC_ID, FSP_ERR_NOT_OPEN);
     err = r_dmac_info_paramter_checking(p_info);
     FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+    /* Chained transfers are advanced by the transfer end interrupt. */
+    if (TRANSFER_CHAIN_MODE_DISABLED != p_info->chain_mode)
+    {
+        FSP_ERROR_RETURN(((dmac_extended_cfg_t *) p_ctrl->p_cfg->p_extend)->irq >= 0, FSP_ERR_IRQ_BSP_DISABLED);
+    }
 #endif
 
     /* Reconfigure the transfer settings. */
@@ -417,7 +440,7 @@ fsp_err_t R_DMAC_Close (transfer_ctrl_t * const p_api_ctrl)
     R_ICU->DELSR[p_extend->channel] = ELC_EVENT_NONE;
     p_ctrl->p_reg->DMCNT            = 0;
 
-    if (NULL != p_extend->p_callback)
+    if (r_dmac_prv_irq_required(p_ctrl))
     {
         R_BSP_IrqDisable(p_extend->irq);
         R_FSP_IsrContextSet(p_extend->irq, NULL);
@@ -502,21 +525,45 @@ static void r_dmac_prv_disable (dmac_instance_ctrl_t * p_ctrl)
  * Write the transfer info to the hardware registers.
  *
  * @param[in]   p_ctrl         Pointer to control structure.
- * @param       p_info         Pointer to transfer info.
+ * @param       p_info         Pointer to transfer info. May be the first link of a chain.
  **********************************************************************************************************************/
 static void r_dmac_config_transfer_info (dmac_instance_ctrl_t * p_ctrl, transfer_info_t * p_info)
 {
     dmac_extended_cfg_t * p_extend = (dmac_extended_cfg_t *) p_ctrl->p_cfg->p_extend;
 
+    /* Disable transfers if they are currently enabled. */
+    r_dmac_prv_disable(p_ctrl);
+
+    /* Store the chain so the ISR can load the following links. */
+    p_ctrl->p_chain_head    = p_info;
+    p_ctrl->p_chain_current = p_info;
+
+    if (r_dmac_prv_irq_required(p_ctrl))
+    {
+        /* Enable the IRQ in the NVIC. */
+        R_BSP_IrqCfgEnable(p_extend->irq, p_extend->ipl, p_ctrl);
+    }
+
+    r_dmac_prv_link_write(p_ctrl, p_info);
+}
+
+/*******************************************************************************************************************//**
+ * Write the register settings of a single transfer info (chain link). Transfers must be disabled when this function is
+ * called.
+ *
+ * @param[in]   p_ctrl         Pointer to control structure.
+ * @param[in]   p_info         Pointer to transfer info.
+ **********************************************************************************************************************/
+static void r_dmac_prv_link_write (dmac_instance_ctrl_t * p_ctrl, transfer_info_t const * p_info)
+{
+    dmac_extended_cfg_t * p_extend = (dmac_extended_cfg_t *) p_ctrl->p_cfg->p_extend;
+
     uint32_t dmcra = 0;
     uint32_t dmcrb = 0;
     uint32_t dmtmd = 0;
     uint32_t dmint = 0;
     uint32_t dmamd = 0;
 
-    /* Disable transfers if they are currently enabled. */
-    r_dmac_prv_disable(p_ctrl);
-
     /* Configure the Transfer Data Size (1,2,4) bytes. */
     dmtmd |= (uint32_t) (p_info->size << DMAC_PRV_DMTMD_SZ_OFFSET);
 
@@ -554,20 +601,19 @@ static void r_dmac_config_transfer_info (dmac_instance_ctrl_t * p_ctrl, transfer
         dmtmd |= 1U << DMAC_PRV_DMTMD_DCTG_OFFSET;
     }
 
-    if (NULL != p_extend->p_callback)
+    if (r_dmac_prv_irq_required(p_ctrl))
     {
         /* Enable transfer end interrupt requests. */
         dmint |= DMAC_PRV_DMINT_DTIE_MASK;
 
-        if (TRANSFER_IRQ_EACH == p_info->irq)
+        /* In a chain, TRANSFER_IRQ_EACH selects a notification at the end of the link instead. */
+        if ((TRANSFER_IRQ_EACH == p_info->irq) &&
+            (TRANSFER_CHAIN_MODE_DISABLED == p_ctrl->p_chain_head->chain_mode))
         {
             /* Enable the transfer end escape interrupt requests
              * (Repeat size end and Extended Repeat area overflow requests). */
             dmint |= (DMAC_PRV_DMINT_RPTIE_MASK | DMAC_PRV_DMINT_ESIE_MASK);
         }
-
-        /* Enable the IRQ in the NVIC. */
-        R_BSP_IrqCfgEnable(p_extend->irq, p_extend->ipl, p_ctrl);
     }
 
     /* Write register settings. */
@@ -581,6 +627,22 @@ static void r_dmac_config_transfer_info (dmac_instance_ctrl_t * p_ctrl, transfer
     p_ctrl->p_reg->DMINT = (uint8_t) dmint;
 }
 
+/*******************************************************************************************************************//**
+ * Check whether the transfer end interrupt is needed, either for the user callback or to advance a chained transfer.
+ *
+ * @param[in]   p_ctrl         Pointer to control structure.
+ *
+ * @retval      true           The DMAC interrupt must be enabled.
+ * @retval      false          The DMAC interrupt is not used.
+ **********************************************************************************************************************/
+static bool r_dmac_prv_irq_required (dmac_instance_ctrl_t const * p_ctrl)
+{
+    dmac_extended_cfg_t * p_extend = (dmac_extended_cfg_t *) p_ctrl->p_cfg->p_extend;
+
+    return (NULL != p_extend->p_callback) ||
+           ((NULL != p_ctrl->p_chain_head) && (TRANSFER_CHAIN_MODE_DISABLED != p_ctrl->p_chain_head->chain_mode));
+}
+
 #if DMAC_CFG_PARAM_CHECKING_ENABLE
 
 /*******************************************************************************************************************//**
@@ -605,19 +667,20 @@ static fsp_err_t r_dma_open_parameter_checking (dmac_instance_ctrl_t * const p_c
     FSP_ASSERT(NULL != p_cfg->p_extend);
     FSP_ERROR_RETURN(p_extend->channel < BSP_FEATURE_DMAC_MAX_CHANNEL, FSP_ERR_IP_CHANNEL_NOT_PRESENT);
 
-    if (NULL != p_extend->p_callback)
+    fsp_err_t err = r_dmac_info_paramter_checking(p_cfg->p_info);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+    /* The transfer end interrupt is required for the callback and to advance chained transfers. */
+    if ((NULL != p_extend->p_callback) || (TRANSFER_CHAIN_MODE_DISABLED != p_cfg->p_info->chain_mode))
     {
         FSP_ERROR_RETURN(p_extend->irq >= 0, FSP_ERR_IRQ_BSP_DISABLED);
     }
 
-    fsp_err_t err = r_dmac_info_paramter_checking(p_cfg->p_info);
-    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
-
     return FSP_SUCCESS;
 }
 
 /*******************************************************************************************************************//**
- * Checks for errors in the transfer into structure.
+ * Checks for errors in the transfer into structure. Every link of a chained transfer is checked.
  *
  * @param[in]   p_info              Pointer transfer info.
  *
@@ -626,12 +689,20 @@ static fsp_err_t r_dma_open_parameter_checking (dmac_instance_ctrl_t * const p_c
  **********************************************************************************************************************/
 static fsp_err_t r_dmac_info_paramter_checking (transfer_info_t const * const p_info)
 {
+    transfer_info_t const * p_link = p_info;
+
     FSP_ASSERT(p_info != NULL);
 
-    if (TRANSFER_MODE_NORMAL != p_info->mode)
+    do
     {
-        FSP_ASSERT(p_info->length <= DMAC_REPEAT_BLOCK_MAX_LENGTH);
-    }
+        /* DMAC advances the chain from the transfer end interrupt, so chaining after each transfer is not supported. */
+        FSP_ASSERT(TRANSFER_CHAIN_MODE_EACH != p_link->chain_mode);
+
+        if (TRANSFER_MODE_NORMAL != p_link->mode)
+        {
+            FSP_ASSERT(p_link->length <= DMAC_REPEAT_BLOCK_MAX_LENGTH);
+        }
+    } while (TRANSFER_CHAIN_MODE_DISABLED != (p_link++)->chain_mode);
 
     return FSP_SUCCESS;
 }
@@ -683,13 +754,50 @@ void dmac_int_isr (void)
     /* Clear IRQ to make sure it doesn't fire again after exiting */
     R_BSP_IrqStatusClear(irq);
 
-    dmac_instance_ctrl_t * p_ctrl   = R_FSP_IsrContextGet(irq);
-    dmac_extended_cfg_t  * p_extend = (dmac_extended_cfg_t *) p_ctrl->p_cfg->p_extend;
+    dmac_instance_ctrl_t * p_ctrl      = R_FSP_IsrContextGet(irq);
+    dmac_extended_cfg_t  * p_extend    = (dmac_extended_cfg_t *) p_ctrl->p_cfg->p_extend;
+    transfer_info_t      * p_completed = p_ctrl->p_chain_current;
+    transfer_info_t      * p_next      = NULL;
+    bool                   notify      = true;
+
+    /* A link is complete once the block/repeat count reaches 0 (always 0 in normal mode). */
+    if ((0U == p_ctrl->p_reg->DMCRB) && (TRANSFER_CHAIN_MODE_DISABLED != p_ctrl->p_chain_head->chain_mode))
+    {
+        if (TRANSFER_CHAIN_MODE_DISABLED != p_completed->chain_mode)
+        {
+            p_next = p_completed + 1;
+        }
+        else if (DMAC_CHAIN_LOOP_ENABLED == p_extend->chain_loop)
+        {
+            p_next = p_ctrl->p_chain_head;
+        }
+        else
+        {
+            /* Last link of the chain. */
+        }
+
+        if (NULL != p_next)
+        {
+            /* Load and start the next link before calling back so the gap between links is as short as possible. */
+            p_ctrl->p_reg->DMCNT    = 0;
+            p_ctrl->p_chain_current = p_next;
+            r_dmac_prv_link_write(p_ctrl, p_next);
+            p_ctrl->p_reg->DMCNT = 1;
+
+            /* The application is only notified at the end of the chain, or after links with TRANSFER_IRQ_EACH. */
+            notify = (TRANSFER_CHAIN_MODE_DISABLED == p_completed->chain_mode) ||
+                     (TRANSFER_IRQ_EACH == p_completed->irq);
+        }
+    }
 
     /* Call user callback */
-    dmac_callback_args_t args;
-    args.p_context = p_extend->p_context;
-    p_extend->p_callback(&args);
+    if (notify && (NULL != p_extend->p_callback))
+    {
+        dmac_callback_args_t args;
+        args.p_context = p_extend->p_context;
+        args.p_info    = p_completed;
+        p_extend->p_callback(&args);
+    }
 
     /* Transfers are disabled during the interrupt if an interrupt is requested after each block or after each repeat
      * length. If not all transfers are complete, reenable transfer here. See section 17.4.2 Transfer End by Repeat
@@ -31,7 +31,10 @@
  **********************************************************************************************************************/
 
 /* "DOCO" in ASCII, used to identify Data Operation Circuit (DOC) configuration */
-#define DOC_OPEN    (0x444F434fU)
+#define DOC_OPEN                     (0x444F434fU)
+
+/* Maximum number of samples in one batch (16-bit transfer count). */
+#define DOC_PRV_BATCH_SAMPLES_MAX    (0xFFFFU)
 
 /***********************************************************************************************************************
  * Typedef definitions
@@ -48,6 +51,8 @@ typedef BSP_CMSE_NONSECURE_CALL void (*volatile doc_prv_ns_callback)(doc_callbac
  **********************************************************************************************************************/
 void doc_int_isr(void);
 
+static uint32_t r_doc_batch_remaining(doc_instance_ctrl_t * const p_ctrl);
+
 /***********************************************************************************************************************
  * Private global variables
  **********************************************************************************************************************/
@@ -73,6 +78,7 @@ const doc_api_t g_doc_on_doc =
     .close       = R_DOC_Close,
     .statusGet   = R_DOC_StatusGet,
     .write       = R_DOC_Write,
+    .batchWrite  = R_DOC_BatchWrite,
     .versionGet  = R_DOC_VersionGet,
     .callbackSet = R_DOC_CallbackSet,
 };
@@ -97,6 +103,9 @@ const doc_api_t g_doc_on_doc =
  * @retval FSP_ERR_ALREADY_OPEN         Module already open.
  * @retval FSP_ERR_ASSERTION            One or more pointers point to NULL or callback is NULL or the interrupt vector
  *                                      is invalid.
+ * @return                              See @ref RENESAS_ERROR_CODES or functions called by this function for other
+ *                                      possible return codes. This function calls:
+ *                                          * @ref transfer_api_t::open
  *
  ***********************************************************************************************************************/
 fsp_err_t R_DOC_Open (doc_ctrl_t * const p_api_ctrl, doc_cfg_t const * const p_cfg)
@@ -112,6 +121,28 @@ fsp_err_t R_DOC_Open (doc_ctrl_t * const p_api_ctrl, doc_cfg_t const * const p_c
     FSP_ERROR_RETURN(DOC_OPEN != p_ctrl->open, FSP_ERR_ALREADY_OPEN);
 #endif
 
+    if (NULL != p_cfg->p_transfer)
+    {
+        /* Each sample is a 16-bit write to DODIR. The source and length are set for each batch. */
+        transfer_info_t * p_info = p_cfg->p_transfer->p_cfg->p_info;
+        p_info->transfer_settings_word = 0U;
+        p_info->mode                   = TRANSFER_MODE_NORMAL;
+        p_info->size                   = TRANSFER_SIZE_2_BYTE;
+        p_info->src_addr_mode          = TRANSFER_ADDR_MODE_INCREMENTED;
+        p_info->dest_addr_mode         = TRANSFER_ADDR_MODE_FIXED;
+        p_info->irq                    = TRANSFER_IRQ_END;
+        p_info->p_dest                 = (void *) &R_DOC->DODIR;
+        p_info->length                 = 0U;
+
+        fsp_err_t err = p_cfg->p_transfer->p_api->open(p_cfg->p_transfer->p_ctrl, p_cfg->p_transfer->p_cfg);
+        FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+    }
+
+    p_ctrl->batch_count   = 0U;
+    p_ctrl->batch_matches = 0U;
+    p_ctrl->batch_mode    = DOC_BATCH_MODE_ALL;
+    p_ctrl->batch_active  = false;
+
     /* save pointers for later use */
     p_ctrl->p_cfg             = p_cfg;
     p_ctrl->p_callback        = p_cfg->p_callback;
@@ -162,6 +193,11 @@ fsp_err_t R_DOC_Close (doc_ctrl_t * const p_api_ctrl)
         R_FSP_IsrContextSet(p_ctrl->p_cfg->irq, NULL);
     }
 
+    if (NULL != p_ctrl->p_cfg->p_transfer)
+    {
+        (void) p_ctrl->p_cfg->p_transfer->p_api->close(p_ctrl->p_cfg->p_transfer->p_ctrl);
+    }
+
     R_BSP_MODULE_STOP(FSP_IP_DOC, 0);
 
     /* Mark driver as closed.  */
@@ -195,7 +231,9 @@ fsp_err_t R_DOC_StatusGet (doc_ctrl_t * const p_api_ctrl, doc_status_t * const p
 #endif
 
     /*Read the result of addition or subtraction operation from the register and store in the user supplied location */
-    p_status->result = R_DOC->DODSR;
+    p_status->result          = R_DOC->DODSR;
+    p_status->batch_remaining = r_doc_batch_remaining(p_ctrl);
+    p_status->batch_matches   = p_ctrl->batch_matches;
 
     return FSP_SUCCESS;
 }
@@ -229,6 +267,71 @@ fsp_err_t R_DOC_Write (doc_ctrl_t * const p_api_ctrl, uint16_t data)
     return FSP_SUCCESS;
 }
 
+/*******************************************************************************************************************//**
+ * Writes a buffer of samples to the DODIR - DOC Input Register with the transfer instance, for window comparison or
+ * accumulation of data streams without a call per sample. The callback is only called when the configured event is
+ * detected. In DOC_BATCH_MODE_FIRST_MATCH mode the transfer is stopped on the first event.
+ *
+ * Use @ref doc_api_t::statusGet to check whether the batch has finished and how many events were detected.
+ *
+ * @retval FSP_SUCCESS          Batch started.
+ * @retval FSP_ERR_NOT_OPEN     Driver not open.
+ * @retval FSP_ERR_ASSERTION    One or more pointers point to NULL, no transfer instance is configured, or count is 0
+ *                              or too large for one transfer.
+ * @retval FSP_ERR_IN_USE       A batch is still being written.
+ * @return                      See @ref RENESAS_ERROR_CODES or functions called by this function for other possible
+ *                              return codes. This function calls:
+ *                                  * @ref transfer_api_t::reconfigure
+ *                                  * @ref transfer_api_t::softwareStart
+ **********************************************************************************************************************/
+fsp_err_t R_DOC_BatchWrite (doc_ctrl_t * const     p_api_ctrl,
+                            uint16_t const * const p_data,
+                            uint32_t               count,
+                            doc_batch_mode_t       mode)
+{
+    doc_instance_ctrl_t * p_ctrl = (doc_instance_ctrl_t *) p_api_ctrl;
+
+    /* Validate the parameters and check if the module is initialized */
+#if DOC_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ERROR_RETURN(DOC_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+    FSP_ASSERT(NULL != p_ctrl->p_cfg->p_transfer);
+    FSP_ASSERT(NULL != p_data);
+    FSP_ASSERT((count > 0U) && (count <= DOC_PRV_BATCH_SAMPLES_MAX));
+#endif
+
+    FSP_ERROR_RETURN(0U == r_doc_batch_remaining(p_ctrl), FSP_ERR_IN_USE);
+
+    transfer_instance_t const * p_transfer = p_ctrl->p_cfg->p_transfer;
+    transfer_info_t           * p_info     = p_transfer->p_cfg->p_info;
+    p_info->p_src  = p_data;
+    p_info->length = (uint16_t) count;
+
+    p_ctrl->batch_count   = count;
+    p_ctrl->batch_matches = 0U;
+    p_ctrl->batch_mode    = mode;
+    p_ctrl->batch_active  = true;
+
+    fsp_err_t err = p_transfer->p_api->reconfigure(p_transfer->p_ctrl, p_info);
+    if (FSP_SUCCESS == err)
+    {
+        /* A transfer without an activation source streams the whole batch. Transfers paced by a peripheral event
+         * do not support a software start. */
+        err = p_transfer->p_api->softwareStart(p_transfer->p_ctrl, TRANSFER_START_MODE_REPEAT);
+        if (FSP_ERR_UNSUPPORTED == err)
+        {
+            err = FSP_SUCCESS;
+        }
+    }
+
+    if (FSP_SUCCESS != err)
+    {
+        p_ctrl->batch_active = false;
+    }
+
+    return err;
+}
+
 /*******************************************************************************************************************//**
  * Returns DOC HAL driver version.
  *
@@ -309,6 +412,35 @@ fsp_err_t R_DOC_CallbackSet (doc_ctrl_t * const          p_api_ctrl,
  * Private Functions
  **********************************************************************************************************************/
 
+/*******************************************************************************************************************//**
+ * Returns the number of samples of the current batch not yet written.
+ *
+ * @param[in] p_ctrl  Pointer to the control block.
+ *
+ * @return Samples remaining, 0 if no batch is running.
+ **********************************************************************************************************************/
+static uint32_t r_doc_batch_remaining (doc_instance_ctrl_t * const p_ctrl)
+{
+    uint32_t remaining = 0U;
+
+    if (p_ctrl->batch_active)
+    {
+        transfer_properties_t properties = {0U};
+        transfer_instance_t const * p_transfer = p_ctrl->p_cfg->p_transfer;
+        if (FSP_SUCCESS == p_transfer->p_api->infoGet(p_transfer->p_ctrl, &properties))
+        {
+            remaining = properties.transfer_length_remaining;
+        }
+
+        if (0U == remaining)
+        {
+            p_ctrl->batch_active = false;
+        }
+    }
+
+    return remaining;
+}
+
 /*******************************************************************************************************************//**
  * DOC ISR.
  *
@@ -342,6 +474,27 @@ void doc_int_isr (void)
     }
 
     p_args->p_context = p_ctrl->p_context;
+    p_args->index     = 0U;
+    p_args->result    = R_DOC->DODSR;
+
+    if (p_ctrl->batch_active)
+    {
+        transfer_instance_t const * p_transfer = p_ctrl->p_cfg->p_transfer;
+
+        /* Stop the batch before reading the position so no further samples are written. */
+        if (DOC_BATCH_MODE_FIRST_MATCH == p_ctrl->batch_mode)
+        {
+            (void) p_transfer->p_api->disable(p_transfer->p_ctrl);
+        }
+
+        p_args->index = p_ctrl->batch_count - r_doc_batch_remaining(p_ctrl);
+        p_ctrl->batch_matches++;
+
+        if (DOC_BATCH_MODE_FIRST_MATCH == p_ctrl->batch_mode)
+        {
+            p_ctrl->batch_active = false;
+        }
+    }
 
 #if BSP_TZ_SECURE_BUILD
 
@@ -134,6 +134,12 @@ void d1_setregister (d1_device * handle, d1_int_t deviceid, d1_int_t index, d1_l
     {
         case D1_DAVE2D:
         {
+            /* Assign the display list its fence before the hardware can complete it. */
+            if (DRW_PRV_D2_DLISTSTART == index)
+            {
+                (void) d1_fencesubmit_intern();
+            }
+
 #if DRW_CFG_USE_DLIST_INDIRECT
 
             /* If indirect mode is configured start processing the display list list in indirect mode */
@@ -46,6 +46,16 @@ typedef long         d1_long_t;
 typedef int          d1_int_t;
 typedef unsigned int d1_uint_t;
 
+/** Usage statistics of one fixed-block memory pool, see d1_querypoolmem. */
+typedef struct _d1_pool_stats
+{
+    uint32_t block_size;               /* Size of each block in bytes */
+    uint32_t block_count;              /* Number of blocks in the pool */
+    uint32_t in_use;                   /* Number of blocks currently allocated */
+    uint32_t high_water_mark;          /* Highest number of blocks allocated at the same time */
+    uint32_t exhausted;                /* Allocations that fitted this pool but were served elsewhere as it was full */
+} d1_pool_stats;
+
 /** Device handle type definition for FSP implementation. */
 typedef struct _d1_device_flex
 {
@@ -55,6 +65,8 @@ typedef struct _d1_device_flex
 
 d1_int_t d1_initirq_intern(d1_device_flex * handle);
 d1_int_t d1_shutdownirq_intern(d1_device_flex * handle);
+d1_int_t d1_querypoolmem(d1_uint_t pool, d1_pool_stats * p_stats);
+d1_fence d1_fencesubmit_intern(void);
 
 /** Common macro for FSP header files. There is also a corresponding FSP_HEADER macro at the top of this file. */
 FSP_FOOTER
@@ -33,6 +33,7 @@
 #if (BSP_CFG_RTOS == 2)                // FreeRTOS
  #include "FreeRTOS.h"
  #include "semphr.h"
+ #include "task.h"
 #endif
 
 /**********************************************************************************************************************
@@ -49,6 +50,9 @@
      DRW_PRV_IRQCTL_DLISTIRQ_ENABLE)
 #define DRW_PRV_STATUS_DLISTIRQ_TRIGGERED          (1U << 5)
 
+/* True once the display list with the given fence has completed. Fences wrap around, so compare the distance. */
+#define DRW_PRV_FENCE_SIGNALED(fence)              ((int32_t) (g_drw_fence_completed - (uint32_t) (fence)) >= 0)
+
 /***********************************************************************************************************************
  * Private global variables
  **********************************************************************************************************************/
@@ -59,6 +63,21 @@ static SemaphoreHandle_t g_d1_queryirq_sem;
 static StaticSemaphore_t g_d1_queryirq_sem_data;
 #endif
 
+/* Fence of the last display list started and of the last one completed. */
+static volatile uint32_t g_drw_fence_submitted = 0;
+static volatile uint32_t g_drw_fence_completed = 0;
+
+/* Called from the DRW_INT ISR when a display list completes. */
+static d1_fence_callback g_drw_fence_callback     = NULL;
+static void            * g_drw_fence_callback_arg = NULL;
+
+#if (BSP_CFG_RTOS == 2)                // FreeRTOS
+
+/* Task blocked in d1_fencewait and the fence it waits for. */
+static TaskHandle_t volatile g_drw_fence_waiter = NULL;
+static volatile uint32_t     g_drw_fence_target = 0;
+#endif
+
 /***********************************************************************************************************************
  * Extern variables
  **********************************************************************************************************************/
@@ -100,8 +119,13 @@ d1_int_t d1_initirq_intern (d1_device_flex * handle)
 
         /* Initialize semaphore for use in d1_queryirq() */
         g_d1_queryirq_sem = xSemaphoreCreateBinaryStatic(&g_d1_queryirq_sem_data);
+        g_drw_fence_waiter = NULL;
 #endif
 
+        /* Nothing has been submitted yet, so fence 0 is signaled. */
+        g_drw_fence_submitted = 0U;
+        g_drw_fence_completed = 0U;
+
         ret = 1;
     }
 
@@ -183,6 +207,142 @@ d1_int_t d1_queryirq (d1_device * handle, d1_int_t irqmask, d1_int_t timeout)
     return ret;
 }
 
+/*******************************************************************************************************************//**
+ * Assigns the next fence to a display list that is about to be started. Called by d1_setregister before DLISTSTART is
+ * written, so the completion interrupt always sees the new fence.
+ *
+ * @retval    Fence     The fence of the display list being started.
+ **********************************************************************************************************************/
+d1_fence d1_fencesubmit_intern (void)
+{
+    g_drw_fence_submitted++;
+
+    return (d1_fence) g_drw_fence_submitted;
+}
+
+/*******************************************************************************************************************//**
+ * Returns the fence of the display list started last. The fence is signaled once that display list and all display
+ * lists started before it have completed.
+ *
+ * @param[in] handle    Pointer to the d1_device object (Not used).
+ * @retval    Fence     The fence of the display list started last, or 0 if none has been started.
+ **********************************************************************************************************************/
+d1_fence d1_fencecurrent (d1_device * handle)
+{
+    FSP_PARAMETER_NOT_USED(handle);
+
+    return (d1_fence) g_drw_fence_submitted;
+}
+
+/*******************************************************************************************************************//**
+ * Checks whether a fence is signaled without blocking.
+ *
+ * @param[in] handle    Pointer to the d1_device object (Not used).
+ * @param[in] fence     Fence returned by d1_fencecurrent.
+ * @retval    0         The display list has not completed yet.
+ * @retval    1         The display list has completed.
+ **********************************************************************************************************************/
+d1_int_t d1_fencesignaled (d1_device * handle, d1_fence fence)
+{
+    FSP_PARAMETER_NOT_USED(handle);
+
+    return DRW_PRV_FENCE_SIGNALED(fence) ? 1 : 0;
+}
+
+/*******************************************************************************************************************//**
+ * Waits until a fence is signaled. With FreeRTOS the calling task blocks and is woken with a direct-to-task
+ * notification from DRW_INT; only one task can block at a time, other tasks poll once per tick. Without an RTOS the
+ * function polls like d1_queryirq.
+ *
+ * @param[in] handle    Pointer to the d1_device object (Not used).
+ * @param[in] fence     Fence returned by d1_fencecurrent.
+ * @param[in] timeout   Timeout in ticks (FreeRTOS) or polling loops (no RTOS), or d1_to_wait_forever.
+ * @retval    0         The wait timed out.
+ * @retval    1         The fence is signaled.
+ **********************************************************************************************************************/
+d1_int_t d1_fencewait (d1_device * handle, d1_fence fence, d1_int_t timeout)
+{
+    FSP_PARAMETER_NOT_USED(handle);
+
+#if (BSP_CFG_RTOS == 2)                // FreeRTOS
+    if (!DRW_PRV_FENCE_SIGNALED(fence) && (d1_to_no_wait != timeout))
+    {
+        TimeOut_t  timeout_state;
+        TickType_t ticks  = (TickType_t) timeout;
+        bool       waiter = false;
+
+        vTaskSetTimeOutState(&timeout_state);
+
+        taskENTER_CRITICAL();
+        if (NULL == g_drw_fence_waiter)
+        {
+            /* Register before checking the fence again so a completion in between is not lost. */
+            g_drw_fence_target = (uint32_t) fence;
+            g_drw_fence_waiter = xTaskGetCurrentTaskHandle();
+            waiter             = true;
+        }
+
+        taskEXIT_CRITICAL();
+
+        while (!DRW_PRV_FENCE_SIGNALED(fence) && (pdFALSE == xTaskCheckForTimeOut(&timeout_state, &ticks)))
+        {
+            if (waiter)
+            {
+                (void) ulTaskNotifyTake(pdTRUE, ticks);
+            }
+            else
+            {
+                vTaskDelay(1);
+            }
+        }
+
+        if (waiter)
+        {
+            /* DRW_INT clears the waiter when it wakes it, and another task may have registered since. */
+            taskENTER_CRITICAL();
+            if (xTaskGetCurrentTaskHandle() == g_drw_fence_waiter)
+            {
+                g_drw_fence_waiter = NULL;
+            }
+
+            taskEXIT_CRITICAL();
+        }
+    }
+#else
+    while (!DRW_PRV_FENCE_SIGNALED(fence) && timeout)
+    {
+        if (timeout != d1_to_wait_forever)
+        {
+            timeout--;
+        }
+    }
+#endif
+
+    return DRW_PRV_FENCE_SIGNALED(fence) ? 1 : 0;
+}
+
+/*******************************************************************************************************************//**
+ * Registers a function that DRW_INT calls each time a display list completes. The callback runs in interrupt context
+ * and receives the fence of the completed display list.
+ *
+ * @param[in] handle    Pointer to the d1_device object (Not used).
+ * @param[in] callback  Function to call, or NULL to remove the callback.
+ * @param[in] usrdata   User data passed to the callback.
+ * @retval    1         The function returns 1.
+ **********************************************************************************************************************/
+d1_int_t d1_setfencecallback (d1_device * handle, d1_fence_callback callback, void * usrdata)
+{
+    FSP_PARAMETER_NOT_USED(handle);
+
+    /* Keep the ISR from seeing a new callback with old user data. */
+    NVIC_DisableIRQ((IRQn_Type) DRW_CFG_INT_IRQ);
+    g_drw_fence_callback     = callback;
+    g_drw_fence_callback_arg = usrdata;
+    NVIC_EnableIRQ((IRQn_Type) DRW_CFG_INT_IRQ);
+
+    return 1;
+}
+
 /*******************************************************************************************************************//**
  * @}
  **********************************************************************************************************************/
@@ -229,8 +389,23 @@ void drw_int_isr (void)
         else
 #endif
         {
+            /* The display list started last (and every one before it) is done. */
+            g_drw_fence_completed = g_drw_fence_submitted;
+
+            if (NULL != g_drw_fence_callback)
+            {
+                g_drw_fence_callback((d1_fence) g_drw_fence_completed, g_drw_fence_callback_arg);
+            }
+
 #if (BSP_CFG_RTOS == 2)                // FreeRTOS
 
+            /* Wake the task waiting in d1_fencewait once its fence is reached. */
+            if ((NULL != g_drw_fence_waiter) && DRW_PRV_FENCE_SIGNALED(g_drw_fence_target))
+            {
+                vTaskNotifyGiveFromISR(g_drw_fence_waiter, &context_switch);
+                g_drw_fence_waiter = NULL;
+            }
+
             /* Put semaphore */
             xSemaphoreGiveFromISR(g_d1_queryirq_sem, &context_switch);
 
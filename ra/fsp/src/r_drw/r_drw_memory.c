@@ -35,9 +35,126 @@
  #include "FreeRTOS.h"
 #endif
 
+/***********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+
+/* Attributes of the BSP TLSF heap region d1_allocmem allocates from when BSP_CFG_HEAP_TLSF_ENABLE is set. Display
+ * lists and textures are read by the D/AVE 2D bus master, so the region must be DMA capable. */
+#ifndef DRW_CFG_MEMORY_HEAP_ATTRIBUTES
+ #define DRW_CFG_MEMORY_HEAP_ATTRIBUTES       (BSP_HEAP_ATTRIBUTE_DMA)
+#endif
+
+/* When set to 1, d1_allocmem serves requests from three built-in fixed-block pools before falling back to the heap.
+ * Display list blocks and context objects are allocated and freed every frame, so taking them from a pool avoids heap
+ * fragmentation and the heap lock. The pools are lock-free (LDREX/STREX), so they are safe to use from any task or
+ * interrupt. The default sizes fit display list block headers, display list blocks of D2_DLISTBLOCKSIZE entries
+ * (about 1 KB) and context objects. Use d1_querypoolmem to size the pools from their high-water marks. */
+#ifndef DRW_CFG_MEMORY_POOL_ENABLE
+ #define DRW_CFG_MEMORY_POOL_ENABLE           (0)
+#endif
+#ifndef DRW_CFG_MEMORY_POOL_SMALL_SIZE
+ #define DRW_CFG_MEMORY_POOL_SMALL_SIZE       (64U)
+#endif
+#ifndef DRW_CFG_MEMORY_POOL_SMALL_COUNT
+ #define DRW_CFG_MEMORY_POOL_SMALL_COUNT      (32U)
+#endif
+#ifndef DRW_CFG_MEMORY_POOL_MEDIUM_SIZE
+ #define DRW_CFG_MEMORY_POOL_MEDIUM_SIZE      (1024U)
+#endif
+#ifndef DRW_CFG_MEMORY_POOL_MEDIUM_COUNT
+ #define DRW_CFG_MEMORY_POOL_MEDIUM_COUNT     (16U)
+#endif
+#ifndef DRW_CFG_MEMORY_POOL_LARGE_SIZE
+ #define DRW_CFG_MEMORY_POOL_LARGE_SIZE       (2048U)
+#endif
+#ifndef DRW_CFG_MEMORY_POOL_LARGE_COUNT
+ #define DRW_CFG_MEMORY_POOL_LARGE_COUNT      (4U)
+#endif
+
+#if DRW_CFG_MEMORY_POOL_ENABLE
+ #define DRW_MEMORY_POOL_NUM                  (3U)
+ #define DRW_MEMORY_POOL_ALIGN                (8U)
+
+/* Round a block size up so every block stays 8-byte aligned, like a heap allocation. */
+ #define DRW_MEMORY_POOL_BLOCK_SIZE(size)     ((((size) + DRW_MEMORY_POOL_ALIGN) - 1U) & ~(DRW_MEMORY_POOL_ALIGN - 1U))
+
+ #if (DRW_CFG_MEMORY_POOL_SMALL_SIZE > DRW_CFG_MEMORY_POOL_MEDIUM_SIZE) || \
+    (DRW_CFG_MEMORY_POOL_MEDIUM_SIZE > DRW_CFG_MEMORY_POOL_LARGE_SIZE)
+  #error "DRW memory pool block sizes must be given in increasing order (small, medium, large)."
+ #endif
+#endif
+
+/***********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+#if DRW_CFG_MEMORY_POOL_ENABLE
+
+/* Header of a free block, stored in the block itself. */
+typedef struct st_drw_pool_block
+{
+    struct st_drw_pool_block * p_next;
+} drw_pool_block_t;
+
+typedef struct st_drw_pool
+{
+    uint8_t                   * p_base;          /* Start of the pool memory */
+    uint32_t                    block_size;      /* Size of each block in bytes */
+    uint32_t                    block_count;     /* Number of blocks */
+    drw_pool_block_t * volatile p_free;          /* Blocks returned with d1_freemem */
+    volatile uint32_t           next_unused;     /* Index of the first block never handed out */
+    volatile uint32_t           in_use;          /* Statistics reported by d1_querypoolmem */
+    volatile uint32_t           high_water_mark;
+    volatile uint32_t           exhausted;
+} drw_pool_t;
+#endif
+
+/***********************************************************************************************************************
+ * Private function prototypes
+ **********************************************************************************************************************/
+static void   * drw_memory_heap_alloc(d1_uint_t size);
+static void     drw_memory_heap_free(void * ptr);
+
+#if DRW_CFG_MEMORY_POOL_ENABLE
+static void   * drw_memory_pool_alloc(d1_uint_t size);
+static bool     drw_memory_pool_free(void * ptr);
+static uint32_t drw_memory_pool_count(volatile uint32_t * p_counter, uint32_t increment);
+static void     drw_memory_pool_high_water_mark_update(drw_pool_t * p_pool, uint32_t in_use);
+
+#endif
+
 /***********************************************************************************************************************
  * Private global variables
  **********************************************************************************************************************/
+#if DRW_CFG_MEMORY_POOL_ENABLE
+static uint64_t g_drw_pool_small[(DRW_MEMORY_POOL_BLOCK_SIZE(DRW_CFG_MEMORY_POOL_SMALL_SIZE) *
+                                  DRW_CFG_MEMORY_POOL_SMALL_COUNT) / sizeof(uint64_t)];
+static uint64_t g_drw_pool_medium[(DRW_MEMORY_POOL_BLOCK_SIZE(DRW_CFG_MEMORY_POOL_MEDIUM_SIZE) *
+                                   DRW_CFG_MEMORY_POOL_MEDIUM_COUNT) / sizeof(uint64_t)];
+static uint64_t g_drw_pool_large[(DRW_MEMORY_POOL_BLOCK_SIZE(DRW_CFG_MEMORY_POOL_LARGE_SIZE) *
+                                  DRW_CFG_MEMORY_POOL_LARGE_COUNT) / sizeof(uint64_t)];
+
+/* Pools in increasing block size order. Blocks are handed out from next_unused first, so no initialization is needed
+ * before the first allocation. */
+static drw_pool_t g_drw_pool[DRW_MEMORY_POOL_NUM] =
+{
+    {
+        .p_base      = (uint8_t *) g_drw_pool_small,
+        .block_size  = DRW_MEMORY_POOL_BLOCK_SIZE(DRW_CFG_MEMORY_POOL_SMALL_SIZE),
+        .block_count = DRW_CFG_MEMORY_POOL_SMALL_COUNT,
+    },
+    {
+        .p_base      = (uint8_t *) g_drw_pool_medium,
+        .block_size  = DRW_MEMORY_POOL_BLOCK_SIZE(DRW_CFG_MEMORY_POOL_MEDIUM_SIZE),
+        .block_count = DRW_CFG_MEMORY_POOL_MEDIUM_COUNT,
+    },
+    {
+        .p_base      = (uint8_t *) g_drw_pool_large,
+        .block_size  = DRW_MEMORY_POOL_BLOCK_SIZE(DRW_CFG_MEMORY_POOL_LARGE_SIZE),
+        .block_count = DRW_CFG_MEMORY_POOL_LARGE_COUNT,
+    },
+};
+#endif
 
 /***********************************************************************************************************************
  * Extern functions
@@ -70,10 +187,83 @@ extern void   d1_free(void * ptr);
  **********************************************************************************************************************/
 void * d1_allocmem (d1_uint_t size)
 {
+#if DRW_CFG_MEMORY_POOL_ENABLE
+    void * ptr = drw_memory_pool_alloc(size);
+
+    if (NULL != ptr)
+    {
+        return ptr;
+    }
+#endif
+
+    return drw_memory_heap_alloc(size);
+}
+
+/*******************************************************************************************************************//**
+ * Frees the specified memory area in the driver heap.
+ *
+ * @param[in] ptr       Pointer to the memory area to be freed.
+ **********************************************************************************************************************/
+void d1_freemem (void * ptr)
+{
+#if DRW_CFG_MEMORY_POOL_ENABLE
+    if (drw_memory_pool_free(ptr))
+    {
+        return;
+    }
+#endif
+
+    drw_memory_heap_free(ptr);
+}
+
+/*******************************************************************************************************************//**
+ * Get the usage statistics of a built-in fixed-block memory pool.
+ *
+ * @param[in]  pool     Pool index: 0 (small), 1 (medium) or 2 (large).
+ * @param[out] p_stats  Pointer to the statistics to fill in.
+ * @retval     1        The statistics were stored in p_stats.
+ * @retval     0        The pools are disabled, or pool or p_stats is invalid.
+ **********************************************************************************************************************/
+d1_int_t d1_querypoolmem (d1_uint_t pool, d1_pool_stats * p_stats)
+{
+#if DRW_CFG_MEMORY_POOL_ENABLE
+    if ((DRW_MEMORY_POOL_NUM <= pool) || (NULL == p_stats))
+    {
+        return 0;
+    }
+
+    p_stats->block_size      = g_drw_pool[pool].block_size;
+    p_stats->block_count     = g_drw_pool[pool].block_count;
+    p_stats->in_use          = g_drw_pool[pool].in_use;
+    p_stats->high_water_mark = g_drw_pool[pool].high_water_mark;
+    p_stats->exhausted       = g_drw_pool[pool].exhausted;
+
+    return 1;
+#else
+    FSP_PARAMETER_NOT_USED(pool);
+    FSP_PARAMETER_NOT_USED(p_stats);
+
+    return 0;
+#endif
+}
+
+/*******************************************************************************************************************//**
+ * Allocates memory in the heap.
+ *
+ * @param[in] size      Size of the memory to be allocated.
+ * @retval Non-NULL     The function returns a pointer to the allocation if successful.
+ * @retval NULL         The function returns NULL if memory allocation failed.
+ **********************************************************************************************************************/
+static void * drw_memory_heap_alloc (d1_uint_t size)
+{
 #if DRW_CFG_CUSTOM_MALLOC
 
     /* Use user-defined malloc */
     return d1_malloc((size_t) size);
+#elif BSP_CFG_HEAP_TLSF_ENABLE
+
+    /* Use the BSP TLSF heap, which has constant time allocation and can be restricted to a region. */
+    return R_BSP_HeapAlloc((size_t) size, DRW_CFG_MEMORY_HEAP_ATTRIBUTES);
 #elif (BSP_CFG_RTOS == 2)              // FreeRTOS
  #if configSUPPORT_DYNAMIC_ALLOCATION
 
@@ -92,16 +282,20 @@ void * d1_allocmem (d1_uint_t size)
 }
 
 /*******************************************************************************************************************//**
- * Frees the specified memory area in the driver heap.
+ * Frees the specified memory area in the heap.
  *
  * @param[in] ptr       Pointer to the memory area to be freed.
  **********************************************************************************************************************/
-void d1_freemem (void * ptr)
+static void drw_memory_heap_free (void * ptr)
 {
 #if DRW_CFG_CUSTOM_MALLOC
 
     /* Use user-defined free */
     d1_free(ptr);
+#elif BSP_CFG_HEAP_TLSF_ENABLE
+
+    /* Use the BSP TLSF heap */
+    R_BSP_HeapFree(ptr);
 #elif (BSP_CFG_RTOS == 2)              // FreeRTOS
  #if configSUPPORT_DYNAMIC_ALLOCATION
 
@@ -345,3 +539,151 @@ d1_int_t d1_cacheblockflush (d1_device * handle, d1_int_t memtype, const void *
 /*******************************************************************************************************************//**
  * @}
  **********************************************************************************************************************/
+
+#if DRW_CFG_MEMORY_POOL_ENABLE
+
+/*******************************************************************************************************************//**
+ * Takes a block from the smallest pool that fits the request and still has a free block.
+ *
+ * @param[in] size      Size of the memory to be allocated.
+ * @retval Non-NULL     Pointer to the pool block.
+ * @retval NULL         No pool block fits the request or all fitting pools are full.
+ **********************************************************************************************************************/
+static void * drw_memory_pool_alloc (d1_uint_t size)
+{
+    drw_pool_t       * p_pool;
+    drw_pool_block_t * p_block = NULL;
+    uint32_t           index;
+    uint32_t           in_use;
+    uint32_t           first = DRW_MEMORY_POOL_NUM;
+
+    for (uint32_t i = 0U; (i < DRW_MEMORY_POOL_NUM) && (NULL == p_block); i++)
+    {
+        p_pool = &g_drw_pool[i];
+
+        if (size > p_pool->block_size)
+        {
+            continue;
+        }
+
+        if (DRW_MEMORY_POOL_NUM == first)
+        {
+            first = i;
+        }
+
+        /* Pop a freed block. An interrupt between LDREX and STREX clears the exclusive monitor, so the pop is retried
+         * if the free list was modified in between. */
+        do
+        {
+            p_block = (drw_pool_block_t *) __LDREXW((volatile uint32_t *) &p_pool->p_free);
+            if (NULL == p_block)
+            {
+                __CLREX();
+                break;
+            }
+        } while (0U != __STREXW((uint32_t) p_block->p_next, (volatile uint32_t *) &p_pool->p_free));
+
+        /* Otherwise hand out a block that was never used. */
+        while (NULL == p_block)
+        {
+            index = __LDREXW(&p_pool->next_unused);
+            if (index >= p_pool->block_count)
+            {
+                __CLREX();
+                break;
+            }
+
+            if (0U == __STREXW(index + 1U, &p_pool->next_unused))
+            {
+                p_block = (drw_pool_block_t *) &p_pool->p_base[index * p_pool->block_size];
+            }
+        }
+
+        if (NULL != p_block)
+        {
+            in_use = drw_memory_pool_count(&p_pool->in_use, 1U);
+            drw_memory_pool_high_water_mark_update(p_pool, in_use);
+        }
+    }
+
+    if ((NULL == p_block) && (DRW_MEMORY_POOL_NUM != first))
+    {
+        /* The request fitted a pool but all fitting pools were full. */
+        (void) drw_memory_pool_count(&g_drw_pool[first].exhausted, 1U);
+    }
+
+    return p_block;
+}
+
+/*******************************************************************************************************************//**
+ * Returns a block to the pool it was taken from.
+ *
+ * @param[in] ptr       Pointer to the memory area to be freed.
+ * @retval    true      The memory was a pool block and has been returned to its pool.
+ * @retval    false     The memory does not belong to a pool.
+ **********************************************************************************************************************/
+static bool drw_memory_pool_free (void * ptr)
+{
+    drw_pool_t       * p_pool;
+    drw_pool_block_t * p_block = (drw_pool_block_t *) ptr;
+    uint8_t          * p_addr  = (uint8_t *) ptr;
+
+    for (uint32_t i = 0U; i < DRW_MEMORY_POOL_NUM; i++)
+    {
+        p_pool = &g_drw_pool[i];
+
+        if ((p_addr >= p_pool->p_base) && (p_addr < &p_pool->p_base[p_pool->block_size * p_pool->block_count]))
+        {
+            /* Push the block onto the free list. */
+            do
+            {
+                p_block->p_next = (drw_pool_block_t *) __LDREXW((volatile uint32_t *) &p_pool->p_free);
+            } while (0U != __STREXW((uint32_t) p_block, (volatile uint32_t *) &p_pool->p_free));
+
+            (void) drw_memory_pool_count(&p_pool->in_use, (uint32_t) -1);
+
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/*******************************************************************************************************************//**
+ * Atomically adds a value to a pool counter.
+ *
+ * @param[in] p_counter Pointer to the counter.
+ * @param[in] increment Value to add (modulo 2^32).
+ * @return    The new value of the counter.
+ **********************************************************************************************************************/
+static uint32_t drw_memory_pool_count (volatile uint32_t * p_counter, uint32_t increment)
+{
+    uint32_t value;
+
+    do
+    {
+        value = __LDREXW(p_counter);
+    } while (0U != __STREXW(value + increment, p_counter));
+
+    return value + increment;
+}
+
+/*******************************************************************************************************************//**
+ * Atomically raises the high-water mark of a pool.
+ *
+ * @param[in] p_pool    Pointer to the pool.
+ * @param[in] in_use    Number of blocks in use after an allocation.
+ **********************************************************************************************************************/
+static void drw_memory_pool_high_water_mark_update (drw_pool_t * p_pool, uint32_t in_use)
+{
+    do
+    {
+        if (in_use <= __LDREXW(&p_pool->high_water_mark))
+        {
+            __CLREX();
+            break;
+        }
+    } while (0U != __STREXW(in_use, &p_pool->high_water_mark));
+}
+
+#endif
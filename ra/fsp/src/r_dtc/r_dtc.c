@@ -63,17 +63,13 @@
 /* Offset of in_progress bit in R_DTC->DTCSTS. */
 #define DTC_PRV_OFFSET_IN_PROGRESS    (15U)
 
-/* DTC Control Register RRS Enable value. */
-#define DTC_PRV_RRS_ENABLE            (0x18)
-
-/* DTC Control Register RRS Disable value. */
-#define DTC_PRV_RRS_DISABLE           (0x08)
 
 /***********************************************************************************************************************
  * Private function prototypes
  **********************************************************************************************************************/
 
 static fsp_err_t r_dtc_prv_enable(dtc_instance_ctrl_t * p_ctrl);
+static void      r_dtc_prv_wait_idle(dtc_instance_ctrl_t * p_ctrl);
 static void      r_dtc_state_initialize(void);
 static void      r_dtc_block_repeat_initialize(transfer_info_t * p_info);
 static void      r_dtc_set_info(dtc_instance_ctrl_t * p_ctrl, transfer_info_t * p_info);
@@ -215,11 +211,7 @@ fsp_err_t R_DTC_Reconfigure (transfer_ctrl_t * const p_api_ctrl, transfer_info_t
     R_ICU->IELSR_b[p_ctrl->irq].DTCE = 0U;
 
     /* Wait for current transfer to finish. */
-    uint32_t in_progress = (1U << DTC_PRV_OFFSET_IN_PROGRESS) | R_ICU->IELSR_b[p_ctrl->irq].IELS;
-    while (in_progress == R_DTC->DTCSTS)
-    {
-        ;
-    }
+    r_dtc_prv_wait_idle(p_ctrl);
 
     /* Copy p_info into the DTC vector table. */
     r_dtc_set_info(p_ctrl, p_info);
@@ -256,11 +248,7 @@ fsp_err_t R_DTC_Reset (transfer_ctrl_t * const p_api_ctrl,
     R_ICU->IELSR_b[p_ctrl->irq].DTCE = 0U;
 
     /* Wait for current transfer to finish. */
-    uint32_t in_progress = (1U << DTC_PRV_OFFSET_IN_PROGRESS) | R_ICU->IELSR_b[p_ctrl->irq].IELS;
-    while (in_progress == R_DTC->DTCSTS)
-    {
-        ;
-    }
+    r_dtc_prv_wait_idle(p_ctrl);
 
     /* Disable read skip prior to modifying settings. It will be enabled later
      * (See DTC Section 18.4.1 of the RA6M3 manual R01UH0886EJ0100). */
@@ -456,6 +444,94 @@ fsp_err_t R_DTC_Close (transfer_ctrl_t * const p_api_ctrl)
     return err;
 }
 
+/*******************************************************************************************************************//**
+ * Link an array of transfer_info_t into a single DTC chain. Every link except the last is set to chain_mode and the
+ * last link terminates the chain. The resulting chain is validated so it can be passed to R_DTC_Open,
+ * R_DTC_Reconfigure or R_DTC_ChainSwap. This is typically used to describe a multi-step peripheral access such as
+ * "write register address, write command, then transfer payload" that runs on a single activation source without CPU
+ * intervention.
+ *
+ * @note The priority of DTC transfers relative to DMAC transfers is fixed in hardware (the DMAC and DTC share a bus
+ *       master and DMAC requests are serviced first). Activation sources that must not be delayed by a long chain
+ *       should be assigned to a DMAC channel.
+ *
+ * @retval FSP_SUCCESS              Chain built and validated.
+ * @retval FSP_ERR_ASSERTION        An input parameter is invalid.
+ * @retval FSP_ERR_UNSUPPORTED      Address Mode Offset is selected in one of the links.
+ **********************************************************************************************************************/
+fsp_err_t R_DTC_ChainBuild (transfer_info_t * const     p_links,
+                            uint32_t const              num_links,
+                            transfer_chain_mode_t const chain_mode)
+{
+#if DTC_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_links);
+    FSP_ASSERT(num_links > 0U);
+    FSP_ASSERT(num_links <= DTC_MAX_CHAIN_LENGTH);
+    FSP_ASSERT((1U == num_links) || (TRANSFER_CHAIN_MODE_DISABLED != chain_mode));
+#endif
+
+    /* Link every transfer to the next one and terminate the chain at the last link. */
+    for (uint32_t i = 0U; i < num_links - 1U; i++)
+    {
+        p_links[i].chain_mode = chain_mode;
+    }
+
+    p_links[num_links - 1U].chain_mode = TRANSFER_CHAIN_MODE_DISABLED;
+
+#if DTC_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(FSP_SUCCESS == r_dtc_length_assert(p_links));
+    fsp_err_t err = r_dtc_source_destination_parameter_check(p_links);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+#endif
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Replace the transfer chain used by this activation source without disabling it. The vector table entry is updated
+ * in a single write, so each activation uses either the previous chain or the new chain in its entirety and no
+ * activation requests are lost while the chain is replaced.
+ *
+ * @retval FSP_SUCCESS              New chain installed. The previous chain is no longer in use by the DTC.
+ * @retval FSP_ERR_ASSERTION        An input parameter is invalid.
+ * @retval FSP_ERR_NOT_OPEN         Handle is not initialized.  Call R_DTC_Open to initialize the control block.
+ * @retval FSP_ERR_UNSUPPORTED      Address Mode Offset is selected in one of the links.
+ *
+ * @note p_chain must persist until all transfers are completed or until it is replaced by another call to this
+ *       function.
+ **********************************************************************************************************************/
+fsp_err_t R_DTC_ChainSwap (transfer_ctrl_t * const  p_api_ctrl,
+                           transfer_info_t * const  p_chain,
+                           transfer_info_t ** const pp_previous)
+{
+    dtc_instance_ctrl_t * p_ctrl = (dtc_instance_ctrl_t *) p_api_ctrl;
+
+#if DTC_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ERROR_RETURN(p_ctrl->open == DTC_OPEN, FSP_ERR_NOT_OPEN);
+    FSP_ASSERT(NULL != p_chain);
+    FSP_ASSERT(FSP_SUCCESS == r_dtc_length_assert(p_chain));
+    fsp_err_t err = r_dtc_source_destination_parameter_check(p_chain);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+#endif
+
+    transfer_info_t * p_previous = gp_dtc_vector_table[p_ctrl->irq];
+
+    /* Install the new chain. Transfers on this activation source remain enabled. */
+    r_dtc_set_info(p_ctrl, p_chain);
+
+    /* An activation that started before the vector table was updated completes using the previous chain. Wait for it
+     * to finish so the caller may reuse the previous chain. */
+    r_dtc_prv_wait_idle(p_ctrl);
+
+    if (NULL != pp_previous)
+    {
+        *pp_previous = p_previous;
+    }
+
+    return FSP_SUCCESS;
+}
+
 /*******************************************************************************************************************//**
  * Get the driver version based on compile time macros.  Implements @ref transfer_api_t::versionGet.
  *
@@ -499,6 +575,18 @@ static fsp_err_t r_dtc_prv_enable (dtc_instance_ctrl_t * p_ctrl)
     return FSP_SUCCESS;
 }
 
+/*******************************************************************************************************************//**
+ * Wait for a transfer in progress on this activation source to finish.
+ **********************************************************************************************************************/
+static void r_dtc_prv_wait_idle (dtc_instance_ctrl_t * p_ctrl)
+{
+    uint32_t in_progress = (1U << DTC_PRV_OFFSET_IN_PROGRESS) | R_ICU->IELSR_b[p_ctrl->irq].IELS;
+    while (in_progress == R_DTC->DTCSTS)
+    {
+        ;
+    }
+}
+
 /*******************************************************************************************************************//**
  * One time state initialization for all DTC instances.
  **********************************************************************************************************************/
@@ -52,6 +52,10 @@ static fsp_err_t r_elc_common_parameter_checking(elc_instance_ctrl_t * p_instanc
 
 #endif
 
+static fsp_err_t r_elc_pipeline_validate(elc_pipeline_t const * const p_pipeline);
+static fsp_err_t r_elc_pipeline_input_claim(elc_peripheral_t peripheral, elc_event_t event, uint32_t * p_used);
+static void      r_elc_pipeline_counters_stop(elc_pipeline_t const * const p_pipeline, uint32_t num_links);
+
 /***********************************************************************************************************************
  * Private global variables
  **********************************************************************************************************************/
@@ -79,6 +83,9 @@ const elc_api_t g_elc_on_elc =
     .linkBreak             = R_ELC_LinkBreak,
     .enable                = R_ELC_Enable,
     .disable               = R_ELC_Disable,
+    .pipelineEnable        = R_ELC_PipelineEnable,
+    .pipelineDisable       = R_ELC_PipelineDisable,
+    .pipelineCountGet      = R_ELC_PipelineCountGet,
     .versionGet            = R_ELC_VersionGet
 };
 
@@ -299,6 +306,180 @@ fsp_err_t R_ELC_Disable (elc_ctrl_t * const p_ctrl)
     return FSP_SUCCESS;
 }
 
+/*******************************************************************************************************************//**
+ * Validate a peripheral pipeline and set all of its links. Implements @ref elc_api_t::pipelineEnable
+ *
+ * The whole pipeline is checked before any link is set, so the ELC is left unchanged if the pipeline is invalid. Each
+ * peripheral and counter input may appear only once, and must not already be linked to a different event. Counters
+ * are reset and started before the links are set. Links should be listed from the start of the chain; they are set
+ * in reverse order with interrupts disabled so every stage is ready before the stage feeding it is connected.
+ *
+ * The ELC must also be enabled with R_ELC_Enable for the links to operate.
+ *
+ * @retval FSP_SUCCESS                    All links of the pipeline set.
+ * @retval FSP_ERR_ASSERTION              p_ctrl or p_pipeline was NULL
+ * @retval FSP_ERR_NOT_OPEN               The module has not been opened
+ * @retval FSP_ERR_INVALID_ARGUMENT       A link has no event, an invalid counter input, or uses a peripheral or
+ *                                        counter input that is already used by another link of the pipeline.
+ * @retval FSP_ERR_IP_CHANNEL_NOT_PRESENT A peripheral or counter input is not available on this MCU.
+ * @retval FSP_ERR_IN_USE                 A peripheral or counter input is already linked to a different event.
+ * @return                                See @ref RENESAS_ERROR_CODES or functions called by this function for other
+ *                                        possible return codes. This function calls:
+ *                                            * @ref timer_api_t::start
+ **********************************************************************************************************************/
+fsp_err_t R_ELC_PipelineEnable (elc_ctrl_t * const p_ctrl, elc_pipeline_t const * const p_pipeline)
+{
+    fsp_err_t err = FSP_SUCCESS;
+
+#if ELC_CFG_PARAM_CHECKING_ENABLE
+    elc_instance_ctrl_t * p_instance_ctrl = (elc_instance_ctrl_t *) p_ctrl;
+    err = r_elc_common_parameter_checking(p_instance_ctrl);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+    FSP_ASSERT(NULL != p_pipeline);
+    FSP_ASSERT((NULL != p_pipeline->p_links) || (0U == p_pipeline->num_links));
+#else
+    FSP_PARAMETER_NOT_USED(p_ctrl);
+#endif
+
+    err = r_elc_pipeline_validate(p_pipeline);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+    /* Start the counters before the links are set so no event is missed. */
+    for (uint32_t i = 0U; i < p_pipeline->num_links; i++)
+    {
+        timer_instance_t const * p_counter = p_pipeline->p_links[i].p_counter;
+        if (NULL != p_counter)
+        {
+            (void) p_counter->p_api->reset(p_counter->p_ctrl);
+            err = p_counter->p_api->start(p_counter->p_ctrl);
+            if (FSP_SUCCESS != err)
+            {
+                r_elc_pipeline_counters_stop(p_pipeline, i);
+            }
+
+            FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+        }
+    }
+
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+
+    for (uint32_t i = p_pipeline->num_links; i > 0U; i--)
+    {
+        elc_link_t const * p_link = &p_pipeline->p_links[i - 1U];
+
+        if (NULL != p_link->p_counter)
+        {
+            R_ELC->ELSR[(uint32_t) p_link->counter_input].HA = (uint16_t) p_link->event;
+        }
+
+        R_ELC->ELSR[(uint32_t) p_link->peripheral].HA = (uint16_t) p_link->event;
+    }
+
+    FSP_CRITICAL_SECTION_EXIT;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Break all links of a peripheral pipeline. Implements @ref elc_api_t::pipelineDisable
+ *
+ * Links are broken from the start of the chain with interrupts disabled. Only links that are still set to the event
+ * of the pipeline are broken. Counters are stopped afterwards and keep their value until the pipeline is enabled
+ * again.
+ *
+ * @retval FSP_SUCCESS             All links of the pipeline broken.
+ * @retval FSP_ERR_ASSERTION       p_ctrl or p_pipeline was NULL, or a link uses an invalid peripheral
+ * @retval FSP_ERR_NOT_OPEN        The module has not been opened
+ **********************************************************************************************************************/
+fsp_err_t R_ELC_PipelineDisable (elc_ctrl_t * const p_ctrl, elc_pipeline_t const * const p_pipeline)
+{
+#if ELC_CFG_PARAM_CHECKING_ENABLE
+    elc_instance_ctrl_t * p_instance_ctrl = (elc_instance_ctrl_t *) p_ctrl;
+    fsp_err_t             err             = r_elc_common_parameter_checking(p_instance_ctrl);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+    FSP_ASSERT(NULL != p_pipeline);
+    FSP_ASSERT((NULL != p_pipeline->p_links) || (0U == p_pipeline->num_links));
+    for (uint32_t i = 0U; i < p_pipeline->num_links; i++)
+    {
+        FSP_ASSERT((uint32_t) p_pipeline->p_links[i].peripheral < ELC_PERIPHERAL_NUM);
+        FSP_ASSERT((uint32_t) p_pipeline->p_links[i].counter_input < ELC_PERIPHERAL_NUM);
+    }
+#else
+    FSP_PARAMETER_NOT_USED(p_ctrl);
+#endif
+
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+
+    for (uint32_t i = 0U; i < p_pipeline->num_links; i++)
+    {
+        elc_link_t const * p_link = &p_pipeline->p_links[i];
+
+        /* Leave links that have since been reassigned to another event untouched. */
+        if ((uint16_t) p_link->event == R_ELC->ELSR[(uint32_t) p_link->peripheral].HA)
+        {
+            R_ELC->ELSR[(uint32_t) p_link->peripheral].HA = ELC_EVENT_NONE;
+        }
+
+        if ((NULL != p_link->p_counter) &&
+            ((uint16_t) p_link->event == R_ELC->ELSR[(uint32_t) p_link->counter_input].HA))
+        {
+            R_ELC->ELSR[(uint32_t) p_link->counter_input].HA = ELC_EVENT_NONE;
+        }
+    }
+
+    FSP_CRITICAL_SECTION_EXIT;
+
+    r_elc_pipeline_counters_stop(p_pipeline, p_pipeline->num_links);
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Get the number of events a counted link has fired since its pipeline was enabled.
+ * Implements @ref elc_api_t::pipelineCountGet
+ *
+ * The count is read from the counting timer, so it wraps at the period of that timer.
+ *
+ * @retval FSP_SUCCESS              Count returned in p_count.
+ * @retval FSP_ERR_ASSERTION        p_ctrl, p_pipeline or p_count was NULL
+ * @retval FSP_ERR_NOT_OPEN         The module has not been opened
+ * @retval FSP_ERR_INVALID_ARGUMENT link is not an index of the pipeline.
+ * @retval FSP_ERR_UNSUPPORTED      The link has no counter.
+ * @return                          See @ref RENESAS_ERROR_CODES or functions called by this function for other possible
+ *                                  return codes. This function calls:
+ *                                      * @ref timer_api_t::statusGet
+ **********************************************************************************************************************/
+fsp_err_t R_ELC_PipelineCountGet (elc_ctrl_t * const           p_ctrl,
+                                  elc_pipeline_t const * const p_pipeline,
+                                  uint32_t                     link,
+                                  uint32_t * const             p_count)
+{
+#if ELC_CFG_PARAM_CHECKING_ENABLE
+    elc_instance_ctrl_t * p_instance_ctrl = (elc_instance_ctrl_t *) p_ctrl;
+    fsp_err_t             err             = r_elc_common_parameter_checking(p_instance_ctrl);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+    FSP_ASSERT(NULL != p_pipeline);
+    FSP_ASSERT(NULL != p_count);
+#else
+    FSP_PARAMETER_NOT_USED(p_ctrl);
+#endif
+
+    FSP_ERROR_RETURN(link < p_pipeline->num_links, FSP_ERR_INVALID_ARGUMENT);
+
+    timer_instance_t const * p_counter = p_pipeline->p_links[link].p_counter;
+    FSP_ERROR_RETURN(NULL != p_counter, FSP_ERR_UNSUPPORTED);
+
+    timer_status_t status;
+    fsp_err_t      status_err = p_counter->p_api->statusGet(p_counter->p_ctrl, &status);
+    FSP_ERROR_RETURN(FSP_SUCCESS == status_err, status_err);
+
+    *p_count = status.counter;
+
+    return FSP_SUCCESS;
+}
+
 /*******************************************************************************************************************//**
  * Get the driver version based on compile time macros. Implements @ref elc_api_t::versionGet
  *
@@ -325,6 +506,91 @@ fsp_err_t R_ELC_VersionGet (fsp_version_t * const p_version)
  * @} (end addtogroup ELC)
  **********************************************************************************************************************/
 
+/*******************************************************************************************************************//**
+ * Check that every link of a pipeline can be set without affecting links outside of the pipeline.
+ *
+ * @param[in]  p_pipeline               Pipeline to check.
+ *
+ * @retval FSP_SUCCESS                  The pipeline can be enabled.
+ * @retval FSP_ERR_INVALID_ARGUMENT     A link is invalid or uses an input that another link of the pipeline uses.
+ * @retval FSP_ERR_IP_CHANNEL_NOT_PRESENT An input is not available on this MCU.
+ * @retval FSP_ERR_IN_USE               An input is already linked to a different event.
+ **********************************************************************************************************************/
+static fsp_err_t r_elc_pipeline_validate (elc_pipeline_t const * const p_pipeline)
+{
+    uint32_t used = 0U;
+
+    for (uint32_t i = 0U; i < p_pipeline->num_links; i++)
+    {
+        elc_link_t const * p_link = &p_pipeline->p_links[i];
+
+        FSP_ERROR_RETURN(ELC_EVENT_NONE != p_link->event, FSP_ERR_INVALID_ARGUMENT);
+
+        fsp_err_t err = r_elc_pipeline_input_claim(p_link->peripheral, p_link->event, &used);
+        FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+        if (NULL != p_link->p_counter)
+        {
+            /* Only the GPT can count ELC events. */
+            FSP_ERROR_RETURN(p_link->counter_input <= ELC_PERIPHERAL_GPT_H, FSP_ERR_INVALID_ARGUMENT);
+
+            err = r_elc_pipeline_input_claim(p_link->counter_input, p_link->event, &used);
+            FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+        }
+    }
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Check that an ELC input can be linked to an event and mark it as used by the pipeline.
+ *
+ * @param[in]     peripheral            ELC input to claim.
+ * @param[in]     event                 Event the input will be linked to.
+ * @param[in,out] p_used                Inputs already claimed by the pipeline.
+ *
+ * @retval FSP_SUCCESS                  The input was claimed.
+ * @retval FSP_ERR_INVALID_ARGUMENT     The input is invalid or already claimed by the pipeline.
+ * @retval FSP_ERR_IP_CHANNEL_NOT_PRESENT The input is not available on this MCU.
+ * @retval FSP_ERR_IN_USE               The input is already linked to a different event.
+ **********************************************************************************************************************/
+static fsp_err_t r_elc_pipeline_input_claim (elc_peripheral_t peripheral, elc_event_t event, uint32_t * p_used)
+{
+    FSP_ERROR_RETURN((uint32_t) peripheral < ELC_PERIPHERAL_NUM, FSP_ERR_INVALID_ARGUMENT);
+
+    uint32_t mask = 1U << (uint32_t) peripheral;
+    FSP_ERROR_RETURN(0U != (BSP_FEATURE_ELC_PERIPHERAL_MASK & mask), FSP_ERR_IP_CHANNEL_NOT_PRESENT);
+
+    /* Each ELSR selects a single event, so an input can only be used once in a pipeline. */
+    FSP_ERROR_RETURN(0U == (*p_used & mask), FSP_ERR_INVALID_ARGUMENT);
+
+    /* An input linked to another event belongs to another pipeline or to the configuration passed to R_ELC_Open. */
+    uint16_t current = R_ELC->ELSR[(uint32_t) peripheral].HA;
+    FSP_ERROR_RETURN((ELC_EVENT_NONE == current) || ((uint16_t) event == current), FSP_ERR_IN_USE);
+
+    *p_used |= mask;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Stop the counters of the first links of a pipeline.
+ *
+ * @param[in]  p_pipeline               Pipeline containing the counters.
+ * @param[in]  num_links                Number of links from the start of the pipeline.
+ **********************************************************************************************************************/
+static void r_elc_pipeline_counters_stop (elc_pipeline_t const * const p_pipeline, uint32_t num_links)
+{
+    for (uint32_t i = 0U; i < num_links; i++)
+    {
+        timer_instance_t const * p_counter = p_pipeline->p_links[i].p_counter;
+        if (NULL != p_counter)
+        {
+            (void) p_counter->p_api->stop(p_counter->p_ctrl);
+        }
+    }
+}
+
 #if ELC_CFG_PARAM_CHECKING_ENABLE
 
 /*******************************************************************************************************************//**
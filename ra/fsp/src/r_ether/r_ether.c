@@ -139,6 +139,21 @@
 /* ETHER_NO_DATA is the return value that indicates that no received data. */
 #define ETHER_NO_DATA                                   (0)
 
+/* Software multicast filter. The upper 6 bits of the Ethernet CRC-32 of the destination address select one of
+ * ETHER_MULTICAST_HASH_TABLE_SIZE buckets. */
+#define ETHER_MAC_ADDRESS_SIZE                          (6U)
+#define ETHER_MAC_ADDRESS_MULTICAST_BIT                 (0x01U)
+#define ETHER_MULTICAST_CRC32_POLYNOMIAL                (0xEDB88320UL)
+#define ETHER_MULTICAST_HASH_SHIFT                      (26U)
+
+/* Frame layout used to classify frames for priority reception */
+#define ETHER_FRAME_TYPE_OFFSET                         (12U)
+#define ETHER_FRAME_VLAN_TYPE_OFFSET                    (16U)
+#define ETHER_FRAME_HEADER_SIZE                         (14U)
+#define ETHER_FRAME_VLAN_HEADER_SIZE                    (18U)
+#define ETHER_FRAME_TYPE_VLAN                           (0x8100U)
+#define ETHER_FRAME_VLAN_PCP_SHIFT                      (5U)
+
 /* PAUSE link mask and shift values */
 
 /***********************************************************************************************************************
@@ -176,6 +191,21 @@ static void ether_configure_mac(ether_instance_ctrl_t * const p_instance_ctrl,
 static fsp_err_t ether_do_link(ether_instance_ctrl_t * const p_instance_ctrl, const uint8_t mode);
 static fsp_err_t ether_link_status_check(ether_instance_ctrl_t const * const p_instance_ctrl);
 static uint8_t   ether_check_magic_packet_detection_bit(ether_instance_ctrl_t const * const p_instance_ctrl);
+static uint32_t  ether_multicast_hash(uint8_t const * const p_mac_address);
+static uint8_t   ether_multicast_filter_accept(ether_instance_ctrl_t const * const       p_instance_ctrl,
+                                               ether_instance_descriptor_t const * const p_descriptor);
+static uint32_t ether_tx_descriptors_free(ether_instance_ctrl_t const * const p_instance_ctrl);
+static uint32_t ether_tx_complete_request(ether_instance_ctrl_t * const             p_instance_ctrl,
+                                          ether_instance_descriptor_t const * const p_next_descriptor,
+                                          uint32_t const                            num_descriptors);
+static fsp_err_t ether_tx_queue_write(ether_instance_ctrl_t * const p_instance_ctrl,
+                                      void * const                  p_buffer,
+                                      uint32_t const                frame_length,
+                                      ether_tx_priority_t const     priority);
+static void ether_tx_queue_dispatch(ether_instance_ctrl_t * const p_instance_ctrl);
+static void ether_rx_timestamp_capture(ether_instance_ctrl_t * const p_instance_ctrl, uint32_t const timestamp);
+static void ether_rx_timestamp_save(ether_instance_ctrl_t * const             p_instance_ctrl,
+                                    ether_instance_descriptor_t const * const p_descriptor);
 
 /***********************************************************************************************************************
  * Private global variables
@@ -208,14 +238,21 @@ static const fsp_version_t module_version =
 /*LDRA_INSPECTED 27 D This structure must be accessible in user code. It cannot be static. */
 const ether_api_t g_ether_on_ether =
 {
-    .open            = R_ETHER_Open,
-    .close           = R_ETHER_Close,
-    .read            = R_ETHER_Read,
-    .bufferRelease   = R_ETHER_BufferRelease,
-    .write           = R_ETHER_Write,
-    .linkProcess     = R_ETHER_LinkProcess,
-    .wakeOnLANEnable = R_ETHER_WakeOnLANEnable,
-    .versionGet      = R_ETHER_VersionGet
+    .open                   = R_ETHER_Open,
+    .close                  = R_ETHER_Close,
+    .read                   = R_ETHER_Read,
+    .bufferRelease          = R_ETHER_BufferRelease,
+    .write                  = R_ETHER_Write,
+    .writeGather            = R_ETHER_WriteGather,
+    .txBufferReclaim        = R_ETHER_TxBufferReclaim,
+    .priorityWrite          = R_ETHER_PriorityWrite,
+    .priorityRead           = R_ETHER_PriorityRead,
+    .rxTimestampGet         = R_ETHER_RxTimestampGet,
+    .multicastAddressAdd    = R_ETHER_MulticastAddressAdd,
+    .multicastAddressRemove = R_ETHER_MulticastAddressRemove,
+    .linkProcess            = R_ETHER_LinkProcess,
+    .wakeOnLANEnable        = R_ETHER_WakeOnLANEnable,
+    .versionGet             = R_ETHER_VersionGet
 };
 
 /*
@@ -255,8 +292,10 @@ static const ether_pause_resolution_t pause_resolution[ETHER_PAUSE_TABLE_ENTRIES
  *                                                  instance. Call close() then open() to reconfigure.
  * @retval  FSP_ERR_ETHER_ERROR_PHY_COMMUNICATION   Initialization of PHY-LSI failed.
  * @retval  FSP_ERR_INVALID_CHANNEL                 Invalid channel number is given.
- * @retval  FSP_ERR_INVALID_POINTER                 Pointer to MAC address is NULL.
- * @retval  FSP_ERR_INVALID_ARGUMENT                Interrupt is not enabled.
+ * @retval  FSP_ERR_INVALID_POINTER                 Pointer to MAC address is NULL, a descriptor or buffer is not
+ *                                                  aligned, or a transmit queue has no storage.
+ * @retval  FSP_ERR_INVALID_ARGUMENT                Interrupt is not enabled, or the transmit queue configuration is
+ *                                                  invalid.
  * @retval  FSP_ERR_ETHER_PHY_ERROR_LINK            Initialization of PHY-LSI failed.
  ***********************************************************************************************************************/
 fsp_err_t R_ETHER_Open (ether_ctrl_t * const p_ctrl, ether_cfg_t const * const p_cfg)
@@ -293,6 +332,10 @@ fsp_err_t R_ETHER_Open (ether_ctrl_t * const p_ctrl, ether_cfg_t const * const p
     p_instance_ctrl->link_change           = ETHER_LINK_CHANGE_NO_CHANGE;
     p_instance_ctrl->previous_link_status  = ETHER_PREVIOUS_LINK_STATUS_DOWN;
 
+    /* No multicast address registered: every multicast frame is accepted when multicast reception is enabled. */
+    memset(p_instance_ctrl->multicast_hash_count, 0x00, sizeof(p_instance_ctrl->multicast_hash_count));
+    p_instance_ctrl->multicast_filter_count = 0U;
+
     /* Initialize the transmit and receive descriptor */
     memset(p_instance_ctrl->p_ether_cfg->p_rx_descriptors,
            0x00,
@@ -312,6 +355,17 @@ fsp_err_t R_ETHER_Open (ether_ctrl_t * const p_ctrl, ether_cfg_t const * const p
                p_instance_ctrl->p_ether_cfg->ether_buffer_size);
     }
 
+    /* No frame has been queued yet. */
+    p_instance_ctrl->p_tx_descriptor         = &p_instance_ctrl->p_ether_cfg->p_tx_descriptors[0];
+    p_instance_ctrl->p_tx_reclaim_descriptor = &p_instance_ctrl->p_ether_cfg->p_tx_descriptors[0];
+    p_instance_ctrl->tx_write_count          = 0U;
+    p_instance_ctrl->tx_reclaim_count        = 0U;
+
+    /* The software transmit queues are empty. */
+    memset(p_instance_ctrl->tx_queue_head, 0x00, sizeof(p_instance_ctrl->tx_queue_head));
+    memset(p_instance_ctrl->tx_queue_count, 0x00, sizeof(p_instance_ctrl->tx_queue_count));
+    p_instance_ctrl->tx_high_credit = 0U;
+
     R_BSP_MODULE_START(FSP_IP_ETHER, p_instance_ctrl->p_ether_cfg->channel);
 
     /* Software reset */
@@ -471,6 +525,13 @@ fsp_err_t R_ETHER_BufferRelease (ether_ctrl_t * const p_ctrl)
         /* Enable current descriptor */
         p_instance_ctrl->p_rx_descriptor->status |= ETHER_RD0_RACT;
 
+        if (NULL != p_instance_ctrl->p_ether_cfg->p_rx_timestamps)
+        {
+            /* The timestamp is invalidated after RACT is set, so the ISR cannot stamp the released frame again. */
+            p_instance_ctrl->p_ether_cfg->p_rx_timestamps[p_instance_ctrl->p_rx_descriptor -
+                                                          p_instance_ctrl->p_ether_cfg->p_rx_descriptors].valid = 0U;
+        }
+
         /* Move to next descriptor */
         p_instance_ctrl->p_rx_descriptor = p_instance_ctrl->p_rx_descriptor->p_next;
     }
@@ -512,6 +573,8 @@ fsp_err_t R_ETHER_LinkProcess (ether_ctrl_t * const p_ctrl)
     ether_callback_args_t                 callback_arg;
     ether_cfg_t const                   * p_ether_cfg;
     volatile ether_previous_link_status_t previous_link_status;
+    uint8_t  multicast_hash_count[ETHER_MULTICAST_HASH_TABLE_SIZE];
+    uint32_t multicast_filter_count;
 
     uint32_t i;
 
@@ -539,6 +602,10 @@ fsp_err_t R_ETHER_LinkProcess (ether_ctrl_t * const p_ctrl)
          *//* back up previous_link_status */
         previous_link_status = p_instance_ctrl->previous_link_status;
 
+        /* back up the multicast filter */
+        memcpy(multicast_hash_count, p_instance_ctrl->multicast_hash_count, sizeof(multicast_hash_count));
+        multicast_filter_count = p_instance_ctrl->multicast_filter_count;
+
         p_ether_cfg = p_instance_ctrl->p_ether_cfg;
 
         err = R_ETHER_Close((ether_ctrl_t *) p_instance_ctrl);
@@ -549,6 +616,10 @@ fsp_err_t R_ETHER_LinkProcess (ether_ctrl_t * const p_ctrl)
 
         /* restore previous_link_status */
         p_instance_ctrl->previous_link_status = previous_link_status;
+
+        /* restore the multicast filter */
+        memcpy(p_instance_ctrl->multicast_hash_count, multicast_hash_count, sizeof(multicast_hash_count));
+        p_instance_ctrl->multicast_filter_count = multicast_filter_count;
     }
 
 #if (ETHER_CFG_USE_LINKSTA == 0)
@@ -600,13 +671,11 @@ fsp_err_t R_ETHER_LinkProcess (ether_ctrl_t * const p_ctrl)
              */
             p_instance_ctrl->link_change = ETHER_LINK_CHANGE_LINK_DOWN;
 
-            /* Initialize the transmit and receive descriptor */
+            /* Initialize the receive descriptor. The transmit descriptors are rebuilt by ether_init_descriptors,
+             * which keeps the buffers not yet reclaimed in zero copy mode. */
             memset(p_instance_ctrl->p_ether_cfg->p_rx_descriptors,
                    0x00,
                    sizeof(ether_instance_descriptor_t) * p_instance_ctrl->p_ether_cfg->num_rx_descriptors);
-            memset(p_instance_ctrl->p_ether_cfg->p_tx_descriptors,
-                   0x00,
-                   sizeof(ether_instance_descriptor_t) * p_instance_ctrl->p_ether_cfg->num_tx_descriptors);
 
             /* Initialize the Ether buffer */
             for (i = 0;
@@ -660,13 +729,11 @@ fsp_err_t R_ETHER_LinkProcess (ether_ctrl_t * const p_ctrl)
          */
         p_instance_ctrl->link_change = ETHER_LINK_CHANGE_NO_CHANGE;
 
-        /* Initialize the transmit and receive descriptor */
+        /* Initialize the receive descriptor. The transmit descriptors are rebuilt by ether_init_descriptors,
+         * which keeps the buffers not yet reclaimed in zero copy mode. */
         memset(p_instance_ctrl->p_ether_cfg->p_rx_descriptors,
                0x00,
                sizeof(ether_instance_descriptor_t) * p_instance_ctrl->p_ether_cfg->num_rx_descriptors);
-        memset(p_instance_ctrl->p_ether_cfg->p_tx_descriptors,
-               0x00,
-               sizeof(ether_instance_descriptor_t) * p_instance_ctrl->p_ether_cfg->num_tx_descriptors);
 
         /* Initialize the Ether buffer */
         for (i = 0;
@@ -842,7 +909,8 @@ fsp_err_t R_ETHER_WakeOnLANEnable (ether_ctrl_t * const p_ctrl)
  * @retval  FSP_ERR_ETHER_ERROR_MAGIC_PACKET_MODE       As a Magic Packet is being detected, transmission and reception
  *                                                      is not enabled.
  * @retval  FSP_ERR_ETHER_ERROR_FILTERING               Multicast Frame filter is enable, and Multicast Address Frame is
- *                                                      received.
+ *                                                      received, or its address is not registered with
+ *                                                      @ref R_ETHER_MulticastAddressAdd.
  * @retval  FSP_ERR_INVALID_POINTER                     Value of the pointer is NULL.
  *
  ***********************************************************************************************************************/
@@ -877,26 +945,27 @@ fsp_err_t R_ETHER_Read (ether_ctrl_t * const p_ctrl, void * const p_buffer, uint
 
         if (ETHER_RD0_RACT != (p_instance_ctrl->p_rx_descriptor->status & ETHER_RD0_RACT))
         {
-            /* Check multicast is detected when multicast frame filter is enabled */
-
-            if (ETHER_MULTICAST_DISABLE == p_instance_ctrl->p_ether_cfg->multicast)
+            if (ETHER_NO_DATA == p_instance_ctrl->p_rx_descriptor->size)
             {
-                if (ETHER_RD0_RFS7_RMAF == (p_instance_ctrl->p_rx_descriptor->status & ETHER_RD0_RFS7_RMAF))
-                {
-                    /* The buffer is released at the multicast frame detect.  */
-
-                    err = R_ETHER_BufferRelease((ether_ctrl_t *) p_instance_ctrl);
+                /* The frame was already delivered by R_ETHER_PriorityRead. Only return the buffer to the EDMAC. */
+                err = R_ETHER_BufferRelease((ether_ctrl_t *) p_instance_ctrl);
+            }
+            /* Check multicast is detected when multicast frame filter is enabled, or when its destination address is
+             * not registered in the multicast filter. The frame is dropped here before any copy. */
+            else if (0U == ether_multicast_filter_accept(p_instance_ctrl, p_instance_ctrl->p_rx_descriptor))
+            {
+                /* The buffer is released at the multicast frame detect.  */
 
-                    if (FSP_SUCCESS == err)
-                    {
-                        err = FSP_ERR_ETHER_ERROR_FILTERING;
-                    }
+                err = R_ETHER_BufferRelease((ether_ctrl_t *) p_instance_ctrl);
 
-                    break;
+                if (FSP_SUCCESS == err)
+                {
+                    err = FSP_ERR_ETHER_ERROR_FILTERING;
                 }
-            }
 
-            if (ETHER_RD0_RFE == (p_instance_ctrl->p_rx_descriptor->status & ETHER_RD0_RFE))
+                break;
+            }
+            else if (ETHER_RD0_RFE == (p_instance_ctrl->p_rx_descriptor->status & ETHER_RD0_RFE))
             {
                 /* The buffer is released at the error.  */
                 err = R_ETHER_BufferRelease((ether_ctrl_t *) p_instance_ctrl);
@@ -911,6 +980,8 @@ fsp_err_t R_ETHER_Read (ether_ctrl_t * const p_ctrl, void * const p_buffer, uint
 
                 /* Get bytes received */
                 received_size = p_instance_ctrl->p_rx_descriptor->size;
+
+                ether_rx_timestamp_save(p_instance_ctrl, p_instance_ctrl->p_rx_descriptor);
                 break;
             }
         }
@@ -956,6 +1027,10 @@ fsp_err_t R_ETHER_Read (ether_ctrl_t * const p_ctrl, void * const p_buffer, uint
  * @brief Transmit Ethernet frame. Transmits data from the location specified by the pointer to the transmit
  *  buffer, with the data size equal to the specified frame length.
  *  In the non zero copy mode, transmits data after being copied to the internal buffer.
+ *  In zero copy mode, the buffer must stay valid until it is returned by @ref R_ETHER_TxBufferReclaim.
+ *  When software transmit queues are configured, the frame is queued as high priority if it is VLAN tagged with a PCP
+ *  of at least ether_extended_cfg_t::tx_pcp_threshold, and as normal priority otherwise. See
+ *  @ref R_ETHER_PriorityWrite.
  *  Implements @ref ether_api_t::write.
  *
  * @retval  FSP_SUCCESS                                 Processing completed successfully.
@@ -964,7 +1039,7 @@ fsp_err_t R_ETHER_Read (ether_ctrl_t * const p_ctrl, void * const p_buffer, uint
  * @retval  FSP_ERR_ETHER_ERROR_LINK                    Auto-negotiation is not completed, and reception is not enabled.
  * @retval  FSP_ERR_ETHER_ERROR_MAGIC_PACKET_MODE       As a Magic Packet is being detected, transmission and reception
  *                                                      is not enabled.
- * @retval  FSP_ERR_ETHER_ERROR_TRANSMIT_BUFFER_FULL    Transmit buffer is not empty.
+ * @retval  FSP_ERR_ETHER_ERROR_TRANSMIT_BUFFER_FULL    Transmit buffer is not empty, or the transmit queue is full.
  * @retval  FSP_ERR_INVALID_POINTER                     Value of the pointer is NULL.
  * @retval  FSP_ERR_INVALID_ARGUMENT                    Value of the send frame size is out of range.
  *
@@ -974,9 +1049,13 @@ fsp_err_t R_ETHER_Write (ether_ctrl_t * const p_ctrl, void * const p_buffer, uin
     fsp_err_t               err             = FSP_SUCCESS;
     ether_instance_ctrl_t * p_instance_ctrl = (ether_instance_ctrl_t *) p_ctrl;
     R_ETHERC_EDMAC_Type   * p_reg_edmac;
+    ether_extended_cfg_t const * p_extend;
 
-    uint8_t * p_write_buffer;
-    uint32_t  write_buffer_size;
+    uint8_t       * p_write_buffer;
+    uint32_t        write_buffer_size;
+    uint8_t const * p_frame;
+    uint16_t        frame_type;
+    ether_tx_priority_t priority;
 
     /* Check argument */
 #if (ETHER_CFG_PARAM_CHECKING_ENABLE)
@@ -1000,6 +1079,23 @@ fsp_err_t R_ETHER_Write (ether_ctrl_t * const p_ctrl, void * const p_buffer, uin
     ETHER_ERROR_RETURN(0 == ether_check_magic_packet_detection_bit(p_instance_ctrl),
                        FSP_ERR_ETHER_ERROR_MAGIC_PACKET_MODE);
 
+    p_extend = (ether_extended_cfg_t const *) p_instance_ctrl->p_ether_cfg->p_extend;
+    if (NULL != p_extend)
+    {
+        /* Classify the frame by its VLAN priority code point. */
+        p_frame    = (uint8_t const *) p_buffer;
+        frame_type = (uint16_t) ((p_frame[ETHER_FRAME_TYPE_OFFSET] << 8) | p_frame[ETHER_FRAME_TYPE_OFFSET + 1U]);
+        priority   = ETHER_TX_PRIORITY_NORMAL;
+
+        if ((ETHER_FRAME_TYPE_VLAN == frame_type) &&
+            ((p_frame[ETHER_FRAME_HEADER_SIZE] >> ETHER_FRAME_VLAN_PCP_SHIFT) >= p_extend->tx_pcp_threshold))
+        {
+            priority = ETHER_TX_PRIORITY_HIGH;
+        }
+
+        return ether_tx_queue_write(p_instance_ctrl, p_buffer, frame_length, priority);
+    }
+
     if (ETHER_ZEROCOPY_DISABLE == p_instance_ctrl->p_ether_cfg->zerocopy)
     {
         /* (1) Retrieve the transmit buffer location controlled by the  descriptor. */
@@ -1021,6 +1117,15 @@ fsp_err_t R_ETHER_Write (ether_ctrl_t * const p_ctrl, void * const p_buffer, uin
             }
         }
     }
+    else if (0U == ether_tx_descriptors_free(p_instance_ctrl))
+    {
+        /* Every descriptor still holds a buffer that has not been returned by R_ETHER_TxBufferReclaim. */
+        err = FSP_ERR_ETHER_ERROR_TRANSMIT_BUFFER_FULL;
+    }
+    else
+    {
+        /* Do nothing. */
+    }
 
     /* Writing to the transmit buffer (buf) is enabled. */
     if (FSP_SUCCESS == err)
@@ -1035,9 +1140,16 @@ fsp_err_t R_ETHER_Write (ether_ctrl_t * const p_ctrl, void * const p_buffer, uin
         }
 
         p_instance_ctrl->p_tx_descriptor->buffer_size = (uint16_t) frame_length;
-        p_instance_ctrl->p_tx_descriptor->status     &= (~(ETHER_TD0_TFP1 | ETHER_TD0_TFP0));
-        p_instance_ctrl->p_tx_descriptor->status     |= ((ETHER_TD0_TFP1 | ETHER_TD0_TFP0) | ETHER_TD0_TACT);
-        p_instance_ctrl->p_tx_descriptor              = p_instance_ctrl->p_tx_descriptor->p_next;
+        p_instance_ctrl->p_tx_descriptor->status     &= (~(ETHER_TD0_TFP1 | ETHER_TD0_TFP0 | ETHER_TD0_TWBI));
+        p_instance_ctrl->p_tx_descriptor->status     |=
+            ((ETHER_TD0_TFP1 | ETHER_TD0_TFP0) | ETHER_TD0_TACT) |
+            ether_tx_complete_request(p_instance_ctrl, p_instance_ctrl->p_tx_descriptor->p_next, 1U);
+        p_instance_ctrl->p_tx_descriptor = p_instance_ctrl->p_tx_descriptor->p_next;
+
+        if (ETHER_ZEROCOPY_ENABLE == p_instance_ctrl->p_ether_cfg->zerocopy)
+        {
+            p_instance_ctrl->tx_write_count++;
+        }
 
         p_reg_edmac = (R_ETHERC_EDMAC_Type *) p_instance_ctrl->p_reg_edmac;
 
@@ -1051,6 +1163,491 @@ fsp_err_t R_ETHER_Write (ether_ctrl_t * const p_ctrl, void * const p_buffer, uin
     return err;
 }                                      /* End of function R_ETHER_Write() */
 
+/********************************************************************************************************************//**
+ * @brief Transmit an Ethernet frame that is split across several buffer fragments.
+ *  In zero copy mode, each fragment is mapped onto its own transmit descriptor. The first descriptor is marked as the
+ *  frame start (TFP1) and the last descriptor is marked as the frame end (TFP0), so the EDMAC gathers the fragments
+ *  into one frame without any copy. The first descriptor is activated last so the EDMAC never sees a partial frame.
+ *  The fragment buffers must stay valid until they are returned by @ref R_ETHER_TxBufferReclaim.
+ *  In the non zero copy mode, the fragments are copied back to back into one internal transmit buffer.
+ *  The frame bypasses the software transmit queues, but counts towards ether_extended_cfg_t::tx_descriptor_depth.
+ *  Implements @ref ether_api_t::writeGather.
+ *
+ * @retval  FSP_SUCCESS                                 Processing completed successfully.
+ * @retval  FSP_ERR_ASSERTION                           Pointer to ETHER control block is NULL.
+ * @retval  FSP_ERR_NOT_OPEN                            The control block has not been opened.
+ * @retval  FSP_ERR_ETHER_ERROR_LINK                    Auto-negotiation is not completed, and reception is not enabled.
+ * @retval  FSP_ERR_ETHER_ERROR_MAGIC_PACKET_MODE       As a Magic Packet is being detected, transmission and reception
+ *                                                      is not enabled.
+ * @retval  FSP_ERR_ETHER_ERROR_TRANSMIT_BUFFER_FULL    Not enough free transmit descriptors for all fragments.
+ * @retval  FSP_ERR_INVALID_POINTER                     Value of a pointer is NULL.
+ * @retval  FSP_ERR_INVALID_ARGUMENT                    Number of fragments, a fragment length or the total frame size
+ *                                                      is out of range.
+ ***********************************************************************************************************************/
+fsp_err_t R_ETHER_WriteGather (ether_ctrl_t * const                 p_ctrl,
+                               ether_buffer_fragment_t const * const p_fragments,
+                               uint32_t const                        num_fragments)
+{
+    fsp_err_t                     err             = FSP_SUCCESS;
+    ether_instance_ctrl_t       * p_instance_ctrl = (ether_instance_ctrl_t *) p_ctrl;
+    ether_instance_descriptor_t * p_descriptor;
+    ether_instance_descriptor_t * p_first_descriptor;
+    R_ETHERC_EDMAC_Type         * p_reg_edmac;
+
+    uint8_t * p_write_buffer;
+    uint32_t  write_buffer_size;
+    uint32_t  frame_length = 0;
+    uint32_t  status;
+    uint32_t  i;
+
+    /* Check argument */
+#if (ETHER_CFG_PARAM_CHECKING_ENABLE)
+    FSP_ASSERT(p_instance_ctrl);
+    ETHER_ERROR_RETURN(ETHER_OPEN == p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
+    ETHER_ERROR_RETURN(NULL != p_fragments, FSP_ERR_INVALID_POINTER);
+    ETHER_ERROR_RETURN(0U != num_fragments, FSP_ERR_INVALID_ARGUMENT);
+    if (ETHER_ZEROCOPY_ENABLE == p_instance_ctrl->p_ether_cfg->zerocopy)
+    {
+        ETHER_ERROR_RETURN(p_instance_ctrl->p_ether_cfg->num_tx_descriptors >= num_fragments,
+                           FSP_ERR_INVALID_ARGUMENT);
+    }
+
+    for (i = 0; i < num_fragments; i++)
+    {
+        ETHER_ERROR_RETURN(NULL != p_fragments[i].p_buffer, FSP_ERR_INVALID_POINTER);
+        ETHER_ERROR_RETURN(0U != p_fragments[i].length, FSP_ERR_INVALID_ARGUMENT);
+        frame_length += p_fragments[i].length;
+    }
+
+    ETHER_ERROR_RETURN((ETHER_MINIMUM_FRAME_SIZE <= frame_length) && (ETHER_MAXIMUM_FRAME_SIZE >= frame_length),
+                       FSP_ERR_INVALID_ARGUMENT);
+#endif
+
+    /* When the Link up processing is not completed, return error */
+    ETHER_ERROR_RETURN(ETHER_LINK_ESTABLISH_STATUS_UP == p_instance_ctrl->link_establish_status,
+                       FSP_ERR_ETHER_ERROR_LINK);
+
+    /* In case of detection mode of magic packet, return error. */
+    ETHER_ERROR_RETURN(0 == ether_check_magic_packet_detection_bit(p_instance_ctrl),
+                       FSP_ERR_ETHER_ERROR_MAGIC_PACKET_MODE);
+
+    p_first_descriptor = p_instance_ctrl->p_tx_descriptor;
+
+    if (ETHER_ZEROCOPY_DISABLE == p_instance_ctrl->p_ether_cfg->zerocopy)
+    {
+        /* (1) Retrieve the transmit buffer location controlled by the descriptor. */
+        err = ether_buffer_get(p_instance_ctrl, (void **) &p_write_buffer, &write_buffer_size);
+
+        if (FSP_SUCCESS == err)
+        {
+            /* (2) Gather the fragments into the transmit buffer controlled by the descriptor. */
+            frame_length = 0;
+            for (i = 0; (i < num_fragments) && (FSP_SUCCESS == err); i++)
+            {
+                if ((write_buffer_size - frame_length) < p_fragments[i].length)
+                {
+                    err = FSP_ERR_ETHER_ERROR_TRANSMIT_BUFFER_FULL; /* Transmit buffer overflow */
+                }
+                else
+                {
+                    memcpy(&p_write_buffer[frame_length], p_fragments[i].p_buffer, p_fragments[i].length);
+                    frame_length += p_fragments[i].length;
+                }
+            }
+        }
+
+        if (FSP_SUCCESS == err)
+        {
+            p_first_descriptor->buffer_size = (uint16_t) frame_length;
+            p_first_descriptor->status     &= (~(ETHER_TD0_TFP1 | ETHER_TD0_TFP0 | ETHER_TD0_TWBI));
+            p_first_descriptor->status     |= ((ETHER_TD0_TFP1 | ETHER_TD0_TFP0) | ETHER_TD0_TACT) |
+                                              ether_tx_complete_request(p_instance_ctrl, p_first_descriptor->p_next,
+                                                                        1U);
+            p_instance_ctrl->p_tx_descriptor = p_first_descriptor->p_next;
+        }
+    }
+    else
+    {
+        /* (1) Make sure a free descriptor is available for every fragment before any of them is modified. A
+         *     descriptor is free once its previous buffer has been returned by R_ETHER_TxBufferReclaim. */
+        if (ether_tx_descriptors_free(p_instance_ctrl) < num_fragments)
+        {
+            err = FSP_ERR_ETHER_ERROR_TRANSMIT_BUFFER_FULL;
+        }
+
+        if (FSP_SUCCESS == err)
+        {
+            /* (2) Map each fragment onto a descriptor. The frame position bits are TFP1 for the first fragment and
+             *     TFP0 for the last fragment. Middle fragments have neither bit set. */
+            p_descriptor = p_first_descriptor;
+            for (i = 0; i < num_fragments; i++)
+            {
+                status = 0U;
+                if (0U == i)
+                {
+                    status |= ETHER_TD0_TFP1;
+                }
+
+                if ((num_fragments - 1U) == i)
+                {
+                    /* The write-back complete interrupt is requested on the descriptor that ends the frame. */
+                    status |= ETHER_TD0_TFP0 |
+                              ether_tx_complete_request(p_instance_ctrl, p_descriptor->p_next, num_fragments);
+                }
+
+                p_descriptor->p_buffer    = (uint8_t *) p_fragments[i].p_buffer;
+                p_descriptor->buffer_size = (uint16_t) p_fragments[i].length;
+                p_descriptor->status     &= (~(ETHER_TD0_TFP1 | ETHER_TD0_TFP0 | ETHER_TD0_TWBI));
+                p_descriptor->status     |= status;
+
+                /* The first descriptor is activated after all others so the EDMAC cannot start on a partial frame. */
+                if (0U != i)
+                {
+                    p_descriptor->status |= ETHER_TD0_TACT;
+                }
+
+                p_descriptor = p_descriptor->p_next;
+            }
+
+            p_first_descriptor->status      |= ETHER_TD0_TACT;
+            p_instance_ctrl->p_tx_descriptor = p_descriptor;
+            p_instance_ctrl->tx_write_count += num_fragments;
+        }
+    }
+
+    if (FSP_SUCCESS == err)
+    {
+        /* (3) Enable the EDMAC to transmit data in the transmit buffer. */
+        p_reg_edmac = (R_ETHERC_EDMAC_Type *) p_instance_ctrl->p_reg_edmac;
+
+        if (ETHER_EDMAC_EDTRR_TRANSMIT_REQUEST != p_reg_edmac->EDTRR)
+        {
+            /* Restart if stopped */
+            p_reg_edmac->EDTRR = ETHER_EDMAC_EDTRR_TRANSMIT_REQUEST;
+        }
+    }
+
+    return err;
+}                                      /* End of function R_ETHER_WriteGather() */
+
+/********************************************************************************************************************//**
+ * @brief Return the buffers of frames that have been transmitted in zero copy mode. The buffers are returned in
+ *  transmit order, one entry per transmit descriptor, so a frame written with @ref R_ETHER_WriteGather returns one
+ *  entry per fragment. A transmit descriptor is reused by @ref R_ETHER_Write and @ref R_ETHER_WriteGather only after
+ *  its buffer has been returned here. Buffers of frames that were still queued when the link was re-established are
+ *  returned as well. Frames waiting in the software transmit queues are then moved to the freed descriptors.
+ *  Implements @ref ether_api_t::txBufferReclaim.
+ *
+ *  This function may be called from a different thread than the write functions, but not from more than one thread
+ *  at a time. When software transmit queues are configured, it must not run concurrently with the write functions.
+ *
+ * @retval  FSP_SUCCESS                                 Processing completed successfully.
+ * @retval  FSP_ERR_ASSERTION                           Pointer to ETHER control block is NULL.
+ * @retval  FSP_ERR_NOT_OPEN                            The control block has not been opened.
+ * @retval  FSP_ERR_INVALID_POINTER                     Value of the pointer is NULL.
+ * @retval  FSP_ERR_UNSUPPORTED                         Zero copy mode is disabled.
+ ***********************************************************************************************************************/
+fsp_err_t R_ETHER_TxBufferReclaim (ether_ctrl_t * const p_ctrl,
+                                   void ** const        pp_buffers,
+                                   uint32_t const       max_buffers,
+                                   uint32_t * const     p_num_buffers)
+{
+    ether_instance_ctrl_t       * p_instance_ctrl = (ether_instance_ctrl_t *) p_ctrl;
+    ether_instance_descriptor_t * p_descriptor;
+    uint32_t num_buffers = 0U;
+
+    /* Check argument */
+#if (ETHER_CFG_PARAM_CHECKING_ENABLE)
+    FSP_ASSERT(p_instance_ctrl);
+    ETHER_ERROR_RETURN(ETHER_OPEN == p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
+    ETHER_ERROR_RETURN(NULL != pp_buffers, FSP_ERR_INVALID_POINTER);
+    ETHER_ERROR_RETURN(NULL != p_num_buffers, FSP_ERR_INVALID_POINTER);
+#endif
+
+    /* In the non zero copy mode the transmit buffers belong to the driver. */
+    ETHER_ERROR_RETURN(ETHER_ZEROCOPY_ENABLE == p_instance_ctrl->p_ether_cfg->zerocopy, FSP_ERR_UNSUPPORTED);
+
+    p_descriptor = p_instance_ctrl->p_tx_reclaim_descriptor;
+
+    /* Walk the queued descriptors in transmit order up to the first one still owned by the EDMAC. */
+    while ((num_buffers < max_buffers) &&
+           (p_instance_ctrl->tx_reclaim_count != p_instance_ctrl->tx_write_count) &&
+           (ETHER_TD0_TACT != (p_descriptor->status & ETHER_TD0_TACT)))
+    {
+        pp_buffers[num_buffers] = p_descriptor->p_buffer;
+        num_buffers++;
+
+        p_descriptor                             = p_descriptor->p_next;
+        p_instance_ctrl->p_tx_reclaim_descriptor = p_descriptor;
+        p_instance_ctrl->tx_reclaim_count++;
+    }
+
+    *p_num_buffers = num_buffers;
+
+    if (NULL != p_instance_ctrl->p_ether_cfg->p_extend)
+    {
+        ether_tx_queue_dispatch(p_instance_ctrl);
+    }
+
+    return FSP_SUCCESS;
+}                                      /* End of function R_ETHER_TxBufferReclaim() */
+
+/********************************************************************************************************************//**
+ * @brief Queue an Ethernet frame for transmission in the software transmit queue of the given priority. The frames
+ *  of each queue are sent in order. The scheduler moves frames to the transmit descriptors while fewer than
+ *  ether_extended_cfg_t::tx_descriptor_depth frames are in them, serving the queues according to
+ *  ether_extended_cfg_t::tx_schedule, so a high priority frame only waits behind the frames already in the
+ *  descriptors. The buffer must stay valid until it is returned by @ref R_ETHER_TxBufferReclaim.
+ *  Only supported in zero copy mode with software transmit queues configured in ether_cfg_t::p_extend.
+ *  Implements @ref ether_api_t::priorityWrite.
+ *
+ * @retval  FSP_SUCCESS                                 Processing completed successfully.
+ * @retval  FSP_ERR_ASSERTION                           Pointer to ETHER control block is NULL.
+ * @retval  FSP_ERR_NOT_OPEN                            The control block has not been opened.
+ * @retval  FSP_ERR_ETHER_ERROR_LINK                    Auto-negotiation is not completed, and reception is not enabled.
+ * @retval  FSP_ERR_ETHER_ERROR_MAGIC_PACKET_MODE       As a Magic Packet is being detected, transmission and reception
+ *                                                      is not enabled.
+ * @retval  FSP_ERR_ETHER_ERROR_TRANSMIT_BUFFER_FULL    The transmit queue is full.
+ * @retval  FSP_ERR_INVALID_POINTER                     Value of the pointer is NULL or the buffer is not aligned.
+ * @retval  FSP_ERR_INVALID_ARGUMENT                    Value of the send frame size or the priority is out of range.
+ * @retval  FSP_ERR_UNSUPPORTED                         No software transmit queues are configured.
+ ***********************************************************************************************************************/
+fsp_err_t R_ETHER_PriorityWrite (ether_ctrl_t * const      p_ctrl,
+                                 void * const              p_buffer,
+                                 uint32_t const            frame_length,
+                                 ether_tx_priority_t const priority)
+{
+    ether_instance_ctrl_t * p_instance_ctrl = (ether_instance_ctrl_t *) p_ctrl;
+
+    /* Check argument */
+#if (ETHER_CFG_PARAM_CHECKING_ENABLE)
+    FSP_ASSERT(p_instance_ctrl);
+    ETHER_ERROR_RETURN(ETHER_OPEN == p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
+    ETHER_ERROR_RETURN(NULL != p_buffer, FSP_ERR_INVALID_POINTER);
+    ETHER_ERROR_RETURN(0 == ((uint32_t) p_buffer & (uint32_t) ETHER_BUFFER_32BYTE_ALIGNMENT_MASK),
+                       FSP_ERR_INVALID_POINTER);
+    ETHER_ERROR_RETURN((ETHER_MINIMUM_FRAME_SIZE <= frame_length) && (ETHER_MAXIMUM_FRAME_SIZE >= frame_length),
+                       FSP_ERR_INVALID_ARGUMENT);
+    ETHER_ERROR_RETURN(ETHER_TX_QUEUE_NUM > (uint32_t) priority, FSP_ERR_INVALID_ARGUMENT);
+#endif
+
+    ETHER_ERROR_RETURN(NULL != p_instance_ctrl->p_ether_cfg->p_extend, FSP_ERR_UNSUPPORTED);
+
+    /* When the Link up processing is not completed, return error */
+    ETHER_ERROR_RETURN(ETHER_LINK_ESTABLISH_STATUS_UP == p_instance_ctrl->link_establish_status,
+                       FSP_ERR_ETHER_ERROR_LINK);
+
+    /* In case of detection mode of magic packet, return error. */
+    ETHER_ERROR_RETURN(0 == ether_check_magic_packet_detection_bit(p_instance_ctrl),
+                       FSP_ERR_ETHER_ERROR_MAGIC_PACKET_MODE);
+
+    return ether_tx_queue_write(p_instance_ctrl, p_buffer, frame_length, priority);
+}                                      /* End of function R_ETHER_PriorityWrite() */
+
+/********************************************************************************************************************//**
+ * @brief Receive the oldest pending Ethernet frame of the given EtherType ahead of any earlier frames still waiting
+ *  in the receive descriptors, so time-critical traffic (e.g. PTP) is not delayed behind bulk traffic. The frames
+ *  are searched in reception order up to the first descriptor still owned by the EDMAC; VLAN tagged frames are
+ *  matched on their inner EtherType. The delivered frame is copied to the buffer specified by the user and its
+ *  descriptor is returned to the EDMAC when @ref R_ETHER_Read reaches it. Multicast frames rejected by the multicast
+ *  filter are never delivered. Only supported in the non zero copy mode.
+ *  Implements @ref ether_api_t::priorityRead.
+ *
+ * @retval  FSP_SUCCESS                                 Processing completed successfully.
+ * @retval  FSP_ERR_ASSERTION                           Pointer to ETHER control block is NULL.
+ * @retval  FSP_ERR_NOT_OPEN                            The control block has not been opened.
+ * @retval  FSP_ERR_ETHER_ERROR_NO_DATA                 There is no pending frame of the given EtherType.
+ * @retval  FSP_ERR_ETHER_ERROR_LINK                    Auto-negotiation is not completed, and reception is not enabled.
+ * @retval  FSP_ERR_ETHER_ERROR_MAGIC_PACKET_MODE       As a Magic Packet is being detected, transmission and reception
+ *                                                      is not enabled.
+ * @retval  FSP_ERR_INVALID_POINTER                     Value of the pointer is NULL.
+ * @retval  FSP_ERR_UNSUPPORTED                         Zero copy mode is enabled.
+ ***********************************************************************************************************************/
+fsp_err_t R_ETHER_PriorityRead (ether_ctrl_t * const p_ctrl,
+                                void * const         p_buffer,
+                                uint32_t * const     length_bytes,
+                                uint16_t const       ether_type)
+{
+    fsp_err_t                     err             = FSP_ERR_ETHER_ERROR_NO_DATA;
+    ether_instance_ctrl_t       * p_instance_ctrl = (ether_instance_ctrl_t *) p_ctrl;
+    ether_instance_descriptor_t * p_descriptor;
+    uint8_t const               * p_frame;
+    uint16_t frame_type;
+    uint32_t i;
+
+    /* Check argument */
+#if (ETHER_CFG_PARAM_CHECKING_ENABLE)
+    FSP_ASSERT(p_instance_ctrl);
+    ETHER_ERROR_RETURN(ETHER_OPEN == p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
+    ETHER_ERROR_RETURN(NULL != p_buffer, FSP_ERR_INVALID_POINTER);
+    ETHER_ERROR_RETURN(NULL != length_bytes, FSP_ERR_INVALID_POINTER);
+#endif
+
+    /* A zero copy frame must be released in reception order, so it cannot be delivered out of order. */
+    ETHER_ERROR_RETURN(ETHER_ZEROCOPY_DISABLE == p_instance_ctrl->p_ether_cfg->zerocopy, FSP_ERR_UNSUPPORTED);
+
+    /* When the Link up processing is not completed, return error */
+    ETHER_ERROR_RETURN(ETHER_LINK_ESTABLISH_STATUS_UP == p_instance_ctrl->link_establish_status,
+                       FSP_ERR_ETHER_ERROR_LINK);
+
+    /* In case of detection mode of magic packet, return error. */
+    ETHER_ERROR_RETURN(0 == ether_check_magic_packet_detection_bit(p_instance_ctrl),
+                       FSP_ERR_ETHER_ERROR_MAGIC_PACKET_MODE);
+
+    p_descriptor = p_instance_ctrl->p_rx_descriptor;
+
+    for (i = 0U;
+         (i < p_instance_ctrl->p_ether_cfg->num_rx_descriptors) &&
+         (ETHER_RD0_RACT != (p_descriptor->status & ETHER_RD0_RACT));
+         i++)
+    {
+        /* Skip frames already delivered, received with an error or rejected by the multicast filter. */
+        if ((ETHER_FRAME_HEADER_SIZE <= p_descriptor->size) &&
+            (ETHER_RD0_RFE != (p_descriptor->status & ETHER_RD0_RFE)) &&
+            (0U != ether_multicast_filter_accept(p_instance_ctrl, p_descriptor)))
+        {
+            p_frame    = p_descriptor->p_buffer;
+            frame_type = (uint16_t) ((p_frame[ETHER_FRAME_TYPE_OFFSET] << 8) | p_frame[ETHER_FRAME_TYPE_OFFSET + 1U]);
+
+            if ((ETHER_FRAME_TYPE_VLAN == frame_type) && (ETHER_FRAME_VLAN_HEADER_SIZE <= p_descriptor->size))
+            {
+                frame_type = (uint16_t) ((p_frame[ETHER_FRAME_VLAN_TYPE_OFFSET] << 8) |
+                                         p_frame[ETHER_FRAME_VLAN_TYPE_OFFSET + 1U]);
+            }
+
+            if (ether_type == frame_type)
+            {
+                memcpy(p_buffer, p_frame, p_descriptor->size);
+                *length_bytes = p_descriptor->size;
+
+                ether_rx_timestamp_save(p_instance_ctrl, p_descriptor);
+
+                if (p_descriptor == p_instance_ctrl->p_rx_descriptor)
+                {
+                    /* The frame is the oldest one, so the buffer can be released right away. */
+                    err = R_ETHER_BufferRelease((ether_ctrl_t *) p_instance_ctrl);
+                }
+                else
+                {
+                    /* Mark the frame as delivered. R_ETHER_Read releases the buffer in reception order. */
+                    p_descriptor->size = ETHER_NO_DATA;
+                    err                = FSP_SUCCESS;
+                }
+
+                break;
+            }
+        }
+
+        p_descriptor = p_descriptor->p_next;
+    }
+
+    return err;
+}                                      /* End of function R_ETHER_PriorityRead() */
+
+/********************************************************************************************************************//**
+ * @brief Get the receive time of the frame most recently delivered by @ref R_ETHER_Read or
+ *  @ref R_ETHER_PriorityRead. The time is the counter of ether_cfg_t::p_timestamp_timer sampled on entry to the
+ *  receive frame interrupt that follows the frame, so frames are only stamped while that interrupt is enabled.
+ *  Implements @ref ether_api_t::rxTimestampGet.
+ *
+ * @retval  FSP_SUCCESS                                 Processing completed successfully.
+ * @retval  FSP_ERR_ASSERTION                           Pointer to ETHER control block is NULL.
+ * @retval  FSP_ERR_NOT_OPEN                            The control block has not been opened.
+ * @retval  FSP_ERR_INVALID_POINTER                     Value of the pointer is NULL.
+ * @retval  FSP_ERR_NOT_ENABLED                         No timestamp timer or receive timestamp array is configured.
+ * @retval  FSP_ERR_ETHER_ERROR_NO_DATA                 The frame was read before it was stamped.
+ ***********************************************************************************************************************/
+fsp_err_t R_ETHER_RxTimestampGet (ether_ctrl_t * const p_ctrl, uint32_t * const p_timestamp)
+{
+    ether_instance_ctrl_t * p_instance_ctrl = (ether_instance_ctrl_t *) p_ctrl;
+
+    /* Check argument */
+#if (ETHER_CFG_PARAM_CHECKING_ENABLE)
+    FSP_ASSERT(p_instance_ctrl);
+    ETHER_ERROR_RETURN(ETHER_OPEN == p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
+    ETHER_ERROR_RETURN(NULL != p_timestamp, FSP_ERR_INVALID_POINTER);
+#endif
+
+    ETHER_ERROR_RETURN((NULL != p_instance_ctrl->p_ether_cfg->p_timestamp_timer) &&
+                       (NULL != p_instance_ctrl->p_ether_cfg->p_rx_timestamps),
+                       FSP_ERR_NOT_ENABLED);
+
+    ETHER_ERROR_RETURN(0U != p_instance_ctrl->rx_timestamp.valid, FSP_ERR_ETHER_ERROR_NO_DATA);
+
+    *p_timestamp = p_instance_ctrl->rx_timestamp.timestamp;
+
+    return FSP_SUCCESS;
+}                                      /* End of function R_ETHER_RxTimestampGet() */
+
+/********************************************************************************************************************//**
+ * @brief Register a multicast MAC address with the software multicast filter.
+ *  While no address is registered, every multicast frame is received. Once at least one address is registered,
+ *  @ref R_ETHER_Read and @ref R_ETHER_PriorityRead drop multicast frames whose destination address does not hash to
+ *  a registered address before they are copied. The filter applies only when multicast reception is enabled.
+ *  An address can be registered several times and stays accepted until it is removed as often.
+ *  Implements @ref ether_api_t::multicastAddressAdd.
+ *
+ * @retval  FSP_SUCCESS                                 Processing completed successfully.
+ * @retval  FSP_ERR_ASSERTION                           Pointer to ETHER control block is NULL.
+ * @retval  FSP_ERR_NOT_OPEN                            The control block has not been opened.
+ * @retval  FSP_ERR_INVALID_POINTER                     Pointer to MAC address is NULL.
+ * @retval  FSP_ERR_INVALID_ARGUMENT                    The MAC address is not a multicast address.
+ * @retval  FSP_ERR_OVERFLOW                            Too many addresses registered in the same hash bucket.
+ ***********************************************************************************************************************/
+fsp_err_t R_ETHER_MulticastAddressAdd (ether_ctrl_t * const p_ctrl, uint8_t const * const p_mac_address)
+{
+    ether_instance_ctrl_t * p_instance_ctrl = (ether_instance_ctrl_t *) p_ctrl;
+    uint32_t                hash;
+
+#if (ETHER_CFG_PARAM_CHECKING_ENABLE)
+    FSP_ASSERT(p_instance_ctrl);
+    ETHER_ERROR_RETURN(ETHER_OPEN == p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
+    ETHER_ERROR_RETURN(NULL != p_mac_address, FSP_ERR_INVALID_POINTER);
+    ETHER_ERROR_RETURN(0U != (p_mac_address[0] & ETHER_MAC_ADDRESS_MULTICAST_BIT), FSP_ERR_INVALID_ARGUMENT);
+#endif
+
+    hash = ether_multicast_hash(p_mac_address);
+
+    ETHER_ERROR_RETURN(UINT8_MAX > p_instance_ctrl->multicast_hash_count[hash], FSP_ERR_OVERFLOW);
+
+    p_instance_ctrl->multicast_hash_count[hash]++;
+    p_instance_ctrl->multicast_filter_count++;
+
+    return FSP_SUCCESS;
+}                                      /* End of function R_ETHER_MulticastAddressAdd() */
+
+/********************************************************************************************************************//**
+ * @brief Remove a multicast MAC address registered with @ref R_ETHER_MulticastAddressAdd. When the last address is
+ *  removed, every multicast frame is received again.
+ *  Implements @ref ether_api_t::multicastAddressRemove.
+ *
+ * @retval  FSP_SUCCESS                                 Processing completed successfully.
+ * @retval  FSP_ERR_ASSERTION                           Pointer to ETHER control block is NULL.
+ * @retval  FSP_ERR_NOT_OPEN                            The control block has not been opened.
+ * @retval  FSP_ERR_INVALID_POINTER                     Pointer to MAC address is NULL.
+ * @retval  FSP_ERR_NOT_FOUND                           The MAC address is not registered.
+ ***********************************************************************************************************************/
+fsp_err_t R_ETHER_MulticastAddressRemove (ether_ctrl_t * const p_ctrl, uint8_t const * const p_mac_address)
+{
+    ether_instance_ctrl_t * p_instance_ctrl = (ether_instance_ctrl_t *) p_ctrl;
+    uint32_t                hash;
+
+#if (ETHER_CFG_PARAM_CHECKING_ENABLE)
+    FSP_ASSERT(p_instance_ctrl);
+    ETHER_ERROR_RETURN(ETHER_OPEN == p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
+    ETHER_ERROR_RETURN(NULL != p_mac_address, FSP_ERR_INVALID_POINTER);
+#endif
+
+    hash = ether_multicast_hash(p_mac_address);
+
+    ETHER_ERROR_RETURN(0U != p_instance_ctrl->multicast_hash_count[hash], FSP_ERR_NOT_FOUND);
+
+    p_instance_ctrl->multicast_hash_count[hash]--;
+    p_instance_ctrl->multicast_filter_count--;
+
+    return FSP_SUCCESS;
+}                                      /* End of function R_ETHER_MulticastAddressRemove() */
+
 /********************************************************************************************************************//**
  * @brief Provides API and code version in the user provided pointer. Implements @ref ether_api_t::versionGet.
  *
@@ -1100,6 +1697,35 @@ static fsp_err_t ether_open_param_check (ether_instance_ctrl_t const * const p_i
     ETHER_ERROR_RETURN((BSP_FEATURE_ETHER_MAX_CHANNELS > p_cfg->channel), FSP_ERR_INVALID_CHANNEL);
     ETHER_ERROR_RETURN((0 <= p_cfg->irq), FSP_ERR_INVALID_ARGUMENT);
 
+    /* The EDMAC needs aligned descriptors and buffers. See ETHER_DESCRIPTOR_PLACE_IN_SECTION and
+     * ETHER_BUFFER_PLACE_IN_SECTION. */
+    ETHER_ERROR_RETURN(0U == ((uint32_t) p_cfg->p_rx_descriptors & (ETHER_DESCRIPTOR_ALIGNMENT - 1U)),
+                       FSP_ERR_INVALID_POINTER);
+    ETHER_ERROR_RETURN(0U == ((uint32_t) p_cfg->p_tx_descriptors & (ETHER_DESCRIPTOR_ALIGNMENT - 1U)),
+                       FSP_ERR_INVALID_POINTER);
+    for (uint32_t i = 0U; i < ((uint32_t) p_cfg->num_rx_descriptors + p_cfg->num_tx_descriptors); i++)
+    {
+        ETHER_ERROR_RETURN(0U == ((uint32_t) p_cfg->pp_ether_buffers[i] & (ETHER_BUFFER_ALIGNMENT - 1U)),
+                           FSP_ERR_INVALID_POINTER);
+    }
+
+    /* The software transmit queues hold the buffers of the application, so they need zero copy mode. */
+    ether_extended_cfg_t const * p_extend = (ether_extended_cfg_t const *) p_cfg->p_extend;
+    if (NULL != p_extend)
+    {
+        ETHER_ERROR_RETURN(ETHER_ZEROCOPY_ENABLE == p_cfg->zerocopy, FSP_ERR_INVALID_ARGUMENT);
+        ETHER_ERROR_RETURN((0U != p_extend->tx_descriptor_depth) &&
+                           (p_cfg->num_tx_descriptors >= p_extend->tx_descriptor_depth),
+                           FSP_ERR_INVALID_ARGUMENT);
+        ETHER_ERROR_RETURN((ETHER_TX_SCHEDULE_STRICT == p_extend->tx_schedule) || (0U != p_extend->tx_high_weight),
+                           FSP_ERR_INVALID_ARGUMENT);
+        for (uint32_t i = 0U; i < ETHER_TX_QUEUE_NUM; i++)
+        {
+            ETHER_ERROR_RETURN(NULL != p_extend->tx_queues[i].p_frames, FSP_ERR_INVALID_POINTER);
+            ETHER_ERROR_RETURN(0U != p_extend->tx_queues[i].num_frames, FSP_ERR_INVALID_ARGUMENT);
+        }
+    }
+
     ETHER_ERROR_RETURN((ETHER_OPEN != p_instance_ctrl->open), FSP_ERR_ALREADY_OPEN);
 
     return FSP_SUCCESS;
@@ -1159,12 +1785,27 @@ static void ether_init_descriptors (ether_instance_ctrl_t * const p_instance_ctr
         p_instance_ctrl->p_rx_descriptor = &p_instance_ctrl->p_ether_cfg->p_rx_descriptors[0];
     }
 
+    /* No receive descriptor holds a frame, so no receive timestamp is valid. */
+    if (NULL != p_instance_ctrl->p_ether_cfg->p_rx_timestamps)
+    {
+        memset(p_instance_ctrl->p_ether_cfg->p_rx_timestamps, 0,
+               sizeof(ether_rx_timestamp_t) * p_instance_ctrl->p_ether_cfg->num_rx_descriptors);
+    }
+
+    p_instance_ctrl->rx_timestamp.valid = 0U;
+
     /* Initialize the transmit descriptors */
     for (i = 0; i < p_instance_ctrl->p_ether_cfg->num_tx_descriptors; i++)
     {
-        p_descriptor           = &p_instance_ctrl->p_ether_cfg->p_tx_descriptors[i];
-        p_descriptor->p_buffer =
-            p_instance_ctrl->p_ether_cfg->pp_ether_buffers[(p_instance_ctrl->p_ether_cfg->num_rx_descriptors + i)];
+        p_descriptor = &p_instance_ctrl->p_ether_cfg->p_tx_descriptors[i];
+
+        /* In zero copy mode the buffer of a transmitted frame is kept until R_ETHER_TxBufferReclaim returns it. */
+        if (ETHER_ZEROCOPY_DISABLE == p_instance_ctrl->p_ether_cfg->zerocopy)
+        {
+            p_descriptor->p_buffer =
+                p_instance_ctrl->p_ether_cfg->pp_ether_buffers[(p_instance_ctrl->p_ether_cfg->num_rx_descriptors + i)];
+        }
+
         p_descriptor->buffer_size = 1; /* Set a value equal to or greater than 1. (reference to UMH)
                                         * When transmitting data, the value of size is set to the function argument
                                         * R_ETHER_Write. */
@@ -1179,9 +1820,15 @@ static void ether_init_descriptors (ether_instance_ctrl_t * const p_instance_ctr
         p_descriptor->status |= ETHER_TD0_TDLE;
         p_descriptor->p_next  = &p_instance_ctrl->p_ether_cfg->p_tx_descriptors[0];
 
-        /* Initialize application transmit descriptor pointer */
-        p_instance_ctrl->p_tx_descriptor = &p_instance_ctrl->p_ether_cfg->p_tx_descriptors[0];
+        /* Initialize application transmit descriptor pointer. In zero copy mode transmission resumes after the
+         * frames not yet reclaimed, which now read as transmitted. */
+        if (ETHER_ZEROCOPY_DISABLE == p_instance_ctrl->p_ether_cfg->zerocopy)
+        {
+            p_instance_ctrl->p_tx_descriptor = &p_instance_ctrl->p_ether_cfg->p_tx_descriptors[0];
+        }
     }
+
+    p_instance_ctrl->tx_complete_count = 0U;
 }                                      /* End of function ether_init_descriptors() */
 
 /********************************************************************************************************************//**
@@ -1216,6 +1863,207 @@ static fsp_err_t ether_buffer_get (ether_instance_ctrl_t * const p_instance_ctrl
     return err;
 }                                      /* End of function ether_buffer_get() */
 
+/********************************************************************************************************************//**
+ * @brief Get the number of transmit descriptors that can be queued in zero copy mode.
+ * @param[in]  p_instance_ctrl                              Ethernet driver control block.
+ * @return     Number of transmit descriptors whose buffer has been reclaimed.
+ ***********************************************************************************************************************/
+static uint32_t ether_tx_descriptors_free (ether_instance_ctrl_t const * const p_instance_ctrl)
+{
+    return (uint32_t) p_instance_ctrl->p_ether_cfg->num_tx_descriptors -
+           (p_instance_ctrl->tx_write_count - p_instance_ctrl->tx_reclaim_count);
+}                                      /* End of function ether_tx_descriptors_free() */
+
+/********************************************************************************************************************//**
+ * @brief Decide whether the frame being queued requests the write-back complete interrupt. When
+ *  ether_cfg_t::tx_complete_interval is set, only every tx_complete_interval-th frame requests it. A frame that leaves
+ *  no free transmit descriptor always requests it, so the application learns when descriptors become free again.
+ * @param[in]  p_instance_ctrl                              Ethernet driver control block.
+ * @param[in]  p_next_descriptor                            Descriptor following the last descriptor of the frame.
+ * @param[in]  num_descriptors                              Number of descriptors used by the frame.
+ * @retval     ETHER_TD0_TWBI                               Set TD0.TWBI in the last descriptor of the frame.
+ * @retval     0                                            The frame does not request an interrupt.
+ ***********************************************************************************************************************/
+static uint32_t ether_tx_complete_request (ether_instance_ctrl_t * const             p_instance_ctrl,
+                                           ether_instance_descriptor_t const * const p_next_descriptor,
+                                           uint32_t const                            num_descriptors)
+{
+    uint32_t twbi = 0U;
+
+    if (0U != p_instance_ctrl->p_ether_cfg->tx_complete_interval)
+    {
+        p_instance_ctrl->tx_complete_count++;
+
+        if ((p_instance_ctrl->tx_complete_count >= p_instance_ctrl->p_ether_cfg->tx_complete_interval) ||
+            (ETHER_TD0_TACT == (p_next_descriptor->status & ETHER_TD0_TACT)) ||
+            ((ETHER_ZEROCOPY_ENABLE == p_instance_ctrl->p_ether_cfg->zerocopy) &&
+             (ether_tx_descriptors_free(p_instance_ctrl) <= num_descriptors)))
+        {
+            p_instance_ctrl->tx_complete_count = 0U;
+            twbi = ETHER_TD0_TWBI;
+        }
+    }
+
+    return twbi;
+}                                      /* End of function ether_tx_complete_request() */
+
+/********************************************************************************************************************//**
+ * @brief Append a frame to a software transmit queue and move queued frames to the transmit descriptors.
+ * @param[in]  p_instance_ctrl                              Ethernet driver control block.
+ * @param[in]  p_buffer                                     Frame to queue.
+ * @param[in]  frame_length                                 Length of the frame in bytes.
+ * @param[in]  priority                                     Queue of the frame.
+ * @retval     FSP_SUCCESS                                  Frame queued.
+ * @retval     FSP_ERR_ETHER_ERROR_TRANSMIT_BUFFER_FULL     The queue is full.
+ ***********************************************************************************************************************/
+static fsp_err_t ether_tx_queue_write (ether_instance_ctrl_t * const p_instance_ctrl,
+                                       void * const                  p_buffer,
+                                       uint32_t const                frame_length,
+                                       ether_tx_priority_t const     priority)
+{
+    ether_extended_cfg_t const * p_extend = (ether_extended_cfg_t const *) p_instance_ctrl->p_ether_cfg->p_extend;
+    ether_tx_queue_cfg_t const * p_queue  = &p_extend->tx_queues[priority];
+    uint32_t tail;
+
+    ETHER_ERROR_RETURN(p_instance_ctrl->tx_queue_count[priority] < p_queue->num_frames,
+                       FSP_ERR_ETHER_ERROR_TRANSMIT_BUFFER_FULL);
+
+    tail = p_instance_ctrl->tx_queue_head[priority] + p_instance_ctrl->tx_queue_count[priority];
+    if (tail >= p_queue->num_frames)
+    {
+        tail -= p_queue->num_frames;
+    }
+
+    p_queue->p_frames[tail].p_buffer = p_buffer;
+    p_queue->p_frames[tail].length   = frame_length;
+    p_instance_ctrl->tx_queue_count[priority]++;
+
+    ether_tx_queue_dispatch(p_instance_ctrl);
+
+    return FSP_SUCCESS;
+}                                      /* End of function ether_tx_queue_write() */
+
+/********************************************************************************************************************//**
+ * @brief Move frames from the software transmit queues to the transmit descriptors while fewer than
+ *  ether_extended_cfg_t::tx_descriptor_depth frames are in them. Frames that have been sent but not reclaimed yet
+ *  count as in the descriptors. Every frame requests the transmit complete interrupt, so the application reclaims the
+ *  buffers, and the next frames are moved to the descriptors, as soon as a frame has been sent.
+ * @param[in]  p_instance_ctrl                              Ethernet driver control block.
+ ***********************************************************************************************************************/
+static void ether_tx_queue_dispatch (ether_instance_ctrl_t * const p_instance_ctrl)
+{
+    ether_extended_cfg_t const * p_extend = (ether_extended_cfg_t const *) p_instance_ctrl->p_ether_cfg->p_extend;
+    ether_instance_descriptor_t * p_descriptor;
+    ether_buffer_fragment_t     * p_frame;
+    R_ETHERC_EDMAC_Type         * p_reg_edmac;
+    uint32_t queue;
+    uint32_t twbi;
+    uint32_t dispatched = 0U;
+    uint32_t high       = (uint32_t) ETHER_TX_PRIORITY_HIGH;
+    uint32_t normal     = (uint32_t) ETHER_TX_PRIORITY_NORMAL;
+
+    /* With tx_complete_interval set to 0 the frame transmit end interrupt already fires after every frame. */
+    twbi = (0U != p_instance_ctrl->p_ether_cfg->tx_complete_interval) ? ETHER_TD0_TWBI : 0U;
+
+    /* Frames stay queued while the link is down, so they are not discarded when the descriptors are reset. */
+    while ((ETHER_LINK_ESTABLISH_STATUS_UP == p_instance_ctrl->link_establish_status) &&
+           (0U != (p_instance_ctrl->tx_queue_count[high] + p_instance_ctrl->tx_queue_count[normal])) &&
+           ((p_instance_ctrl->tx_write_count - p_instance_ctrl->tx_reclaim_count) < p_extend->tx_descriptor_depth))
+    {
+        /* Strict priority serves the high priority queue whenever it holds a frame. The weighted schedule lets one
+         * normal frame through after every tx_high_weight high priority frames. */
+        if ((0U != p_instance_ctrl->tx_queue_count[high]) &&
+            ((0U == p_instance_ctrl->tx_queue_count[normal]) ||
+             (ETHER_TX_SCHEDULE_STRICT == p_extend->tx_schedule) ||
+             (p_instance_ctrl->tx_high_credit < p_extend->tx_high_weight)))
+        {
+            queue = high;
+            p_instance_ctrl->tx_high_credit++;
+        }
+        else
+        {
+            queue = normal;
+            p_instance_ctrl->tx_high_credit = 0U;
+        }
+
+        p_frame = &p_extend->tx_queues[queue].p_frames[p_instance_ctrl->tx_queue_head[queue]];
+        p_instance_ctrl->tx_queue_head[queue]++;
+        if (p_instance_ctrl->tx_queue_head[queue] >= p_extend->tx_queues[queue].num_frames)
+        {
+            p_instance_ctrl->tx_queue_head[queue] = 0U;
+        }
+
+        p_instance_ctrl->tx_queue_count[queue]--;
+
+        p_descriptor              = p_instance_ctrl->p_tx_descriptor;
+        p_descriptor->p_buffer    = (uint8_t *) p_frame->p_buffer;
+        p_descriptor->buffer_size = (uint16_t) p_frame->length;
+        p_descriptor->status     &= (~(ETHER_TD0_TFP1 | ETHER_TD0_TFP0 | ETHER_TD0_TWBI));
+        p_descriptor->status     |= (ETHER_TD0_TFP1 | ETHER_TD0_TFP0 | ETHER_TD0_TACT) | twbi;
+
+        p_instance_ctrl->p_tx_descriptor = p_descriptor->p_next;
+        p_instance_ctrl->tx_write_count++;
+        dispatched++;
+    }
+
+    if (0U != dispatched)
+    {
+        p_reg_edmac = (R_ETHERC_EDMAC_Type *) p_instance_ctrl->p_reg_edmac;
+
+        if (ETHER_EDMAC_EDTRR_TRANSMIT_REQUEST != p_reg_edmac->EDTRR)
+        {
+            /* Restart if stopped */
+            p_reg_edmac->EDTRR = ETHER_EDMAC_EDTRR_TRANSMIT_REQUEST;
+        }
+    }
+}                                      /* End of function ether_tx_queue_dispatch() */
+
+/********************************************************************************************************************//**
+ * @brief Stamp every receive descriptor that holds a frame without a valid timestamp. Called from the receive frame
+ *  interrupt, so the frames received since the previous interrupt get the time of this interrupt.
+ * @param[in]  p_instance_ctrl                              Ethernet driver control block.
+ * @param[in]  timestamp                                    Timestamp timer counter value at interrupt entry.
+ ***********************************************************************************************************************/
+static void ether_rx_timestamp_capture (ether_instance_ctrl_t * const p_instance_ctrl, uint32_t const timestamp)
+{
+    ether_rx_timestamp_t * p_timestamps = p_instance_ctrl->p_ether_cfg->p_rx_timestamps;
+    uint32_t               i;
+
+    if (NULL != p_timestamps)
+    {
+        for (i = 0U; i < p_instance_ctrl->p_ether_cfg->num_rx_descriptors; i++)
+        {
+            if ((ETHER_RD0_RACT != (p_instance_ctrl->p_ether_cfg->p_rx_descriptors[i].status & ETHER_RD0_RACT)) &&
+                (0U == p_timestamps[i].valid))
+            {
+                p_timestamps[i].timestamp = timestamp;
+                p_timestamps[i].valid     = 1U;
+            }
+        }
+    }
+}                                      /* End of function ether_rx_timestamp_capture() */
+
+/********************************************************************************************************************//**
+ * @brief Keep the receive timestamp of a frame being delivered for @ref R_ETHER_RxTimestampGet.
+ * @param[in]  p_instance_ctrl                              Ethernet driver control block.
+ * @param[in]  p_descriptor                                 Receive descriptor of the frame.
+ ***********************************************************************************************************************/
+static void ether_rx_timestamp_save (ether_instance_ctrl_t * const             p_instance_ctrl,
+                                     ether_instance_descriptor_t const * const p_descriptor)
+{
+    ether_rx_timestamp_t * p_timestamps = p_instance_ctrl->p_ether_cfg->p_rx_timestamps;
+
+    p_instance_ctrl->rx_timestamp.valid = 0U;
+
+    if (NULL != p_timestamps)
+    {
+        p_instance_ctrl->rx_timestamp.timestamp =
+            p_timestamps[p_descriptor - p_instance_ctrl->p_ether_cfg->p_rx_descriptors].timestamp;
+        p_instance_ctrl->rx_timestamp.valid =
+            p_timestamps[p_descriptor - p_instance_ctrl->p_ether_cfg->p_rx_descriptors].valid;
+    }
+}                                      /* End of function ether_rx_timestamp_save() */
+
 /***********************************************************************************************************************
  * Function Name: ether_config_ethernet
  * Description  : Configure the Ethernet Controller (EtherC) and the Ethernet
@@ -1268,7 +2116,16 @@ static void ether_config_ethernet (ether_instance_ctrl_t const * const p_instanc
 
         /* Frame receive interrupt and frame transmit end interrupt */
         p_reg_edmac->EESIPR_b.FRIP = 1;                   /* Enable the frame receive interrupt. */
-        p_reg_edmac->EESIPR_b.TCIP = 1;                   /* Enable the frame transmit end interrupt. */
+
+        if (0U == p_instance_ctrl->p_ether_cfg->tx_complete_interval)
+        {
+            p_reg_edmac->EESIPR_b.TCIP = 1;               /* Enable the frame transmit end interrupt. */
+        }
+        else
+        {
+            /* Only the frames queued with TD0.TWBI set raise the write-back complete interrupt. */
+            p_reg_edmac->EESIPR_b.TWBIP = 1;
+        }
     }
 
     /* Ethernet length 1514bytes + CRC and intergap is 96-bit time */
@@ -1622,6 +2479,67 @@ static uint8_t ether_check_magic_packet_detection_bit (ether_instance_ctrl_t con
     return ret;
 }                                      /* End of function ether_check_magic_packet_detection_bit() */
 
+/***********************************************************************************************************************
+ * Function Name: ether_multicast_hash
+ * Description  : Calculates the multicast filter bucket of a MAC address from its Ethernet CRC-32.
+ * Arguments    : p_mac_address -
+ *                    Pointer to the MAC address
+ * Return Value : Bucket index, 0 to ETHER_MULTICAST_HASH_TABLE_SIZE - 1
+ ***********************************************************************************************************************/
+static uint32_t ether_multicast_hash (uint8_t const * const p_mac_address)
+{
+    uint32_t crc = 0xFFFFFFFFUL;
+    uint32_t i;
+    uint32_t j;
+
+    for (i = 0U; i < ETHER_MAC_ADDRESS_SIZE; i++)
+    {
+        crc ^= p_mac_address[i];
+
+        for (j = 0U; j < 8U; j++)
+        {
+            crc = (crc >> 1) ^ ((0UL - (crc & 1UL)) & ETHER_MULTICAST_CRC32_POLYNOMIAL);
+        }
+    }
+
+    return (~crc) >> ETHER_MULTICAST_HASH_SHIFT;
+}                                      /* End of function ether_multicast_hash() */
+
+/***********************************************************************************************************************
+ * Function Name: ether_multicast_filter_accept
+ * Description  : Checks a received frame against the multicast reception setting and the multicast filter.
+ * Arguments    : p_instance_ctrl -
+ *                    Pointer to the control block for the channel
+ *                p_descriptor -
+ *                    Receive descriptor holding the frame
+ * Return Value : 1: The frame is accepted.
+ *                0: The frame is a multicast frame that must be dropped.
+ ***********************************************************************************************************************/
+static uint8_t ether_multicast_filter_accept (ether_instance_ctrl_t const * const       p_instance_ctrl,
+                                              ether_instance_descriptor_t const * const p_descriptor)
+{
+    uint8_t ret = 1;
+
+    if (ETHER_RD0_RFS7_RMAF == (p_descriptor->status & ETHER_RD0_RFS7_RMAF))
+    {
+        if (ETHER_MULTICAST_DISABLE == p_instance_ctrl->p_ether_cfg->multicast)
+        {
+            ret = 0;
+        }
+        else if ((0U != p_instance_ctrl->multicast_filter_count) &&
+                 (0U == p_instance_ctrl->multicast_hash_count[ether_multicast_hash(p_descriptor->p_buffer)]))
+        {
+            ret = 0;
+        }
+        else
+        {
+            /* Accept the multicast frame */
+        }
+    }
+
+    return ret;
+}                                      /* End of function ether_multicast_filter_accept() */
+
 /*******************************************************************************************************************//**
  * @brief Verifies the Etherent link is up or not.
  *
@@ -1668,8 +2586,16 @@ void ether_eint_isr (void)
     R_ETHERC0_Type      * p_reg_etherc;
     R_ETHERC_EDMAC_Type * p_reg_edmac;
 
-    IRQn_Type               irq             = R_FSP_CurrentIrqGet();
-    ether_instance_ctrl_t * p_instance_ctrl = (ether_instance_ctrl_t *) R_FSP_IsrContextGet(irq);
+    IRQn_Type                irq             = R_FSP_CurrentIrqGet();
+    ether_instance_ctrl_t  * p_instance_ctrl = (ether_instance_ctrl_t *) R_FSP_IsrContextGet(irq);
+    timer_instance_t const * p_timer         = p_instance_ctrl->p_ether_cfg->p_timestamp_timer;
+    timer_status_t           timer_status    = {0};
+
+    if (NULL != p_timer)
+    {
+        /* Sample the timestamp timer first, so the time is as close as possible to the EDMAC event. */
+        (void) p_timer->p_api->statusGet(p_timer->p_ctrl, &timer_status);
+    }
 
     p_reg_etherc = (R_ETHERC0_Type *) p_instance_ctrl->p_reg_etherc;
     p_reg_edmac  = (R_ETHERC_EDMAC_Type *) p_instance_ctrl->p_reg_edmac;
@@ -1677,6 +2603,12 @@ void ether_eint_isr (void)
     status_ecsr = p_reg_etherc->ECSR;
     status_eesr = p_reg_edmac->EESR;
 
+    /* Stamp the frames received since the last interrupt before the callback lets the application read them. */
+    if ((NULL != p_timer) && (status_eesr & ETHER_EDMAC_INTERRUPT_FACTOR_FR))
+    {
+        ether_rx_timestamp_capture(p_instance_ctrl, timer_status.counter);
+    }
+
     /* Callback : Interrupt handler */
     if (NULL != p_instance_ctrl->p_ether_cfg->p_callback)
     {
@@ -1684,6 +2616,7 @@ void ether_eint_isr (void)
         callback_arg.event       = ETHER_EVENT_INTERRUPT;
         callback_arg.status_ecsr = status_ecsr;
         callback_arg.status_eesr = status_eesr;
+        callback_arg.timestamp   = timer_status.counter;
         (*p_instance_ctrl->p_ether_cfg->p_callback)((void *) &callback_arg);
     }
 
@@ -77,6 +77,7 @@
 #define ETHER_PHY_STATUS_LINK_UP                (1 << 2)
 #define ETHER_PHY_STATUS_JABBER                 (1 << 1)
 #define ETHER_PHY_STATUS_EX_CAPABILITY          (1 << 0)
+#define ETHER_PHY_STATUS_PREAMBLE_SUPPRESSION   (1 << 6)
 
 /* Auto Negotiation Advertisement Bit Definitions */
 #define ETHER_PHY_AN_ADVERTISEMENT_NEXT_PAGE    (1 << 15)
@@ -112,7 +113,13 @@
 #define ETHER_PHY_PIR_MDC_LOW                   (0x00)
 
 #define ETHER_PHY_PREAMBLE_LENGTH               (32U)
-#define ETHER_PHY_WRITE_DATA_BIT_MASK           (0x8000)
+#define ETHER_PHY_PREAMBLE_SUPPRESSED_LENGTH    (1U)
+#define ETHER_PHY_REG_SET_LENGTH                (14U)
+#define ETHER_PHY_DATA_LENGTH                   (16U)
+#define ETHER_PHY_REG_ADDRESS_MAX               (31U)
+
+/* Number of management frames read for the link state: the status register twice, then the link partner ability. */
+#define ETHER_PHY_LINK_STATE_READ_NUM           (3U)
 
 /***********************************************************************************************************************
  * Typedef definitions
@@ -128,6 +135,7 @@
 uint32_t ether_phy_read(ether_phy_instance_ctrl_t * p_instance_ctrl, uint32_t reg_addr);
 void     ether_phy_write(ether_phy_instance_ctrl_t * p_instance_ctrl, uint32_t reg_addr, uint32_t data);
 void     ether_phy_targets_initialize(ether_phy_instance_ctrl_t * p_instance_ctrl) __attribute__((weak));
+void     ether_phy_targets_link_interrupt_clear(ether_phy_instance_ctrl_t * p_instance_ctrl) __attribute__((weak));
 
 /***********************************************************************************************************************
  * Private global variables and functions
@@ -138,8 +146,12 @@ static void ether_phy_reg_read(ether_phy_instance_ctrl_t * p_instance_ctrl, uint
 static void ether_phy_reg_write(ether_phy_instance_ctrl_t * p_instance_ctrl, uint32_t data);
 static void ether_phy_trans_zto0(ether_phy_instance_ctrl_t * p_instance_ctrl);
 static void ether_phy_trans_1to0(ether_phy_instance_ctrl_t * p_instance_ctrl);
-static void ether_phy_mii_write1(ether_phy_instance_ctrl_t * p_instance_ctrl);
-static void ether_phy_mii_write0(ether_phy_instance_ctrl_t * p_instance_ctrl);
+static void ether_phy_mii_bits_write(ether_phy_instance_ctrl_t * p_instance_ctrl, uint32_t data, uint32_t num_bits);
+
+static uint32_t ether_phy_mii_bits_read(ether_phy_instance_ctrl_t * p_instance_ctrl, uint32_t num_bits);
+static void     ether_phy_link_state_read(ether_phy_instance_ctrl_t * p_instance_ctrl,
+                                          uint32_t                  * p_status,
+                                          uint32_t                  * p_partner);
 
 /** ETHER_PHYHAL module version data structure */
 static const fsp_version_t module_version =
@@ -159,6 +171,8 @@ const ether_phy_api_t g_ether_phy_on_ether_phy =
     .startAutoNegotiate    = R_ETHER_PHY_StartAutoNegotiate,
     .linkPartnerAbilityGet = R_ETHER_PHY_LinkPartnerAbilityGet,
     .linkStatusGet         = R_ETHER_PHY_LinkStatusGet,
+    .registersRead         = R_ETHER_PHY_RegistersRead,
+    .linkStateInvalidate   = R_ETHER_PHY_LinkStateInvalidate,
     .versionGet            = R_ETHER_PHY_VersionGet
 };
 
@@ -189,6 +203,7 @@ fsp_err_t R_ETHER_PHY_Open (ether_phy_ctrl_t * const p_ctrl, ether_phy_cfg_t con
     R_ETHERC0_Type            * p_reg_etherc;
     uint32_t reg;
     uint32_t count = 0;
+    uint32_t hold;
 
 #if (ETHER_PHY_CFG_PARAM_CHECKING_ENABLE)
     FSP_ASSERT(p_instance_ctrl);
@@ -205,6 +220,21 @@ fsp_err_t R_ETHER_PHY_Open (ether_phy_ctrl_t * const p_ctrl, ether_phy_cfg_t con
     /* Initialize configuration of ethernet phy module. */
     p_instance_ctrl->p_ether_phy_cfg = p_cfg;
 
+#if (ETHER_PHY_CFG_MDC_FREQUENCY_HZ > 0)
+
+    /* Each PIR write takes at least one PCLKA cycle. Round up so that MDC does not run faster than configured. */
+    hold = (R_FSP_SystemClockHzGet(FSP_PRIV_CLOCK_PCLKA) + ((4U * ETHER_PHY_CFG_MDC_FREQUENCY_HZ) - 1U)) /
+           (4U * ETHER_PHY_CFG_MDC_FREQUENCY_HZ);
+#else
+    hold = (p_cfg->mii_bit_access_wait_time > 0) ? (uint32_t) p_cfg->mii_bit_access_wait_time : 0U;
+#endif
+    p_instance_ctrl->mdc_hold        = (hold > 0U) ? hold : 1U;
+    p_instance_ctrl->preamble_length = ETHER_PHY_PREAMBLE_LENGTH;
+
+#if (ETHER_PHY_CFG_LINK_INTERRUPT_ENABLE)
+    p_instance_ctrl->link_state_valid = 0U;
+#endif
+
     /* Reset PHY */
     ether_phy_write(p_instance_ctrl, ETHER_PHY_REG_CONTROL, ETHER_PHY_CONTROL_RESET);
 
@@ -217,6 +247,16 @@ fsp_err_t R_ETHER_PHY_Open (ether_phy_ctrl_t * const p_ctrl, ether_phy_cfg_t con
 
     if (count < p_cfg->phy_reset_wait_time)
     {
+#if (ETHER_PHY_CFG_PREAMBLE_SUPPRESSION_ENABLE)
+
+        /* Drop the preamble if the PHY-LSI accepts management frames without it. */
+        if (ETHER_PHY_STATUS_PREAMBLE_SUPPRESSION ==
+            (ether_phy_read(p_instance_ctrl, ETHER_PHY_REG_STATUS) & ETHER_PHY_STATUS_PREAMBLE_SUPPRESSION))
+        {
+            p_instance_ctrl->preamble_length = ETHER_PHY_PREAMBLE_SUPPRESSED_LENGTH;
+        }
+#endif
+
         ether_phy_targets_initialize(p_instance_ctrl);
 
         p_instance_ctrl->open = ETHER_PHY_OPEN;
@@ -307,6 +347,12 @@ fsp_err_t R_ETHER_PHY_StartAutoNegotiate (ether_phy_ctrl_t * const p_ctrl)
 
     ether_phy_read(p_instance_ctrl, ETHER_PHY_REG_AN_ADVERTISEMENT);
 
+#if (ETHER_PHY_CFG_LINK_INTERRUPT_ENABLE)
+
+    /* Restarting auto-negotiation drops the link. */
+    p_instance_ctrl->link_state_valid = 0U;
+#endif
+
     return FSP_SUCCESS;
 }                                      /* End of function R_ETHER_PHY_StartAutoNegotiate() */
 
@@ -327,6 +373,7 @@ fsp_err_t R_ETHER_PHY_LinkPartnerAbilityGet (ether_phy_ctrl_t * const p_ctrl,
 {
     ether_phy_instance_ctrl_t * p_instance_ctrl = (ether_phy_instance_ctrl_t *) p_ctrl;
     uint32_t reg;
+    uint32_t partner;
 
 #if (ETHER_PHY_CFG_PARAM_CHECKING_ENABLE)
     FSP_ASSERT(p_instance_ctrl);
@@ -336,9 +383,8 @@ fsp_err_t R_ETHER_PHY_LinkPartnerAbilityGet (ether_phy_ctrl_t * const p_ctrl,
     ETHER_PHY_ERROR_RETURN(NULL != p_partner_pause, FSP_ERR_INVALID_POINTER);
 #endif
 
-    /* Because reading the first time shows the previous state, the Link status bit is read twice. */
-    ether_phy_read(p_instance_ctrl, ETHER_PHY_REG_STATUS);
-    reg = ether_phy_read(p_instance_ctrl, ETHER_PHY_REG_STATUS);
+    /* Read the status and the link partner ability together. */
+    ether_phy_link_state_read(p_instance_ctrl, &reg, &partner);
 
     /* When the link isn't up, return error */
     ETHER_PHY_ERROR_RETURN(ETHER_PHY_STATUS_LINK_UP == (reg & ETHER_PHY_STATUS_LINK_UP), FSP_ERR_ETHER_PHY_ERROR_LINK);
@@ -359,7 +405,7 @@ fsp_err_t R_ETHER_PHY_LinkPartnerAbilityGet (ether_phy_ctrl_t * const p_ctrl,
                            FSP_ERR_ETHER_PHY_NOT_READY);
 
     /* Get the link partner response */
-    reg = ether_phy_read(p_instance_ctrl, ETHER_PHY_REG_AN_LINK_PARTNER);
+    reg = partner;
 
     /* Establish partner pause capability */
     if (ETHER_PHY_AN_LINK_PARTNER_PAUSE == (reg & ETHER_PHY_AN_LINK_PARTNER_PAUSE))
@@ -415,9 +461,17 @@ fsp_err_t R_ETHER_PHY_LinkStatusGet (ether_phy_ctrl_t * const p_ctrl)
     ETHER_PHY_ERROR_RETURN(ETHER_PHY_OPEN == p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
 #endif
 
+#if (ETHER_PHY_CFG_LINK_INTERRUPT_ENABLE)
+    uint32_t partner;
+
+    /* The link state is only read again after a link change interrupt. */
+    ether_phy_link_state_read(p_instance_ctrl, &reg, &partner);
+#else
+
     /* Because reading the first time shows the previous state, the Link status bit is read twice. */
     ether_phy_read(p_instance_ctrl, ETHER_PHY_REG_STATUS);
     reg = ether_phy_read(p_instance_ctrl, ETHER_PHY_REG_STATUS);
+#endif
 
     /* When the link isn't up, return error */
     if (ETHER_PHY_STATUS_LINK_UP != (reg & ETHER_PHY_STATUS_LINK_UP))
@@ -434,6 +488,73 @@ fsp_err_t R_ETHER_PHY_LinkStatusGet (ether_phy_ctrl_t * const p_ctrl)
     return err;
 }                                      /* End of function R_ETHER_PHY_LinkStatusGet() */
 
+/********************************************************************************************************************//**
+ * @brief Reads several PHY-LSI registers back to back, e.g. for diagnostics. Implements
+ * @ref ether_phy_api_t::registersRead.
+ *
+ * @retval  FSP_SUCCESS                                 The registers were read.
+ * @retval  FSP_ERR_ASSERTION                           Pointer to ETHER_PHY control block is NULL.
+ * @retval  FSP_ERR_INVALID_POINTER                     Pointer to arguments are NULL.
+ * @retval  FSP_ERR_INVALID_ARGUMENT                    num_registers is 0 or a register address is larger than 31.
+ * @retval  FSP_ERR_NOT_OPEN                            The control block has not been opened
+ ***********************************************************************************************************************/
+fsp_err_t R_ETHER_PHY_RegistersRead (ether_phy_ctrl_t * const p_ctrl,
+                                     uint32_t const * const   p_reg_addr,
+                                     uint32_t * const         p_data,
+                                     uint32_t                 num_registers)
+{
+    ether_phy_instance_ctrl_t * p_instance_ctrl = (ether_phy_instance_ctrl_t *) p_ctrl;
+    uint32_t i;
+
+#if (ETHER_PHY_CFG_PARAM_CHECKING_ENABLE)
+    FSP_ASSERT(p_instance_ctrl);
+    ETHER_PHY_ERROR_RETURN(ETHER_PHY_OPEN == p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
+    ETHER_PHY_ERROR_RETURN(NULL != p_reg_addr, FSP_ERR_INVALID_POINTER);
+    ETHER_PHY_ERROR_RETURN(NULL != p_data, FSP_ERR_INVALID_POINTER);
+    ETHER_PHY_ERROR_RETURN(0U != num_registers, FSP_ERR_INVALID_ARGUMENT);
+    for (i = 0U; i < num_registers; i++)
+    {
+        ETHER_PHY_ERROR_RETURN(ETHER_PHY_REG_ADDRESS_MAX >= p_reg_addr[i], FSP_ERR_INVALID_ARGUMENT);
+    }
+#endif
+
+    for (i = 0U; i < num_registers; i++)
+    {
+        p_data[i] = ether_phy_read(p_instance_ctrl, p_reg_addr[i]);
+    }
+
+    return FSP_SUCCESS;
+}                                      /* End of function R_ETHER_PHY_RegistersRead() */
+
+/********************************************************************************************************************//**
+ * @brief Discards the link state read since the last link change, so the next link check reads the PHY-LSI again.
+ * Call it from the interrupt of the PHY-LSI INT pin. Implements @ref ether_phy_api_t::linkStateInvalidate.
+ *
+ * The link state is only kept when ETHER_PHY_CFG_LINK_INTERRUPT_ENABLE is 1. Otherwise every link check reads the
+ * PHY-LSI and this function has no effect.
+ *
+ * @retval  FSP_SUCCESS                                 The link state was discarded.
+ * @retval  FSP_ERR_ASSERTION                           Pointer to ETHER_PHY control block is NULL.
+ * @retval  FSP_ERR_NOT_OPEN                            The control block has not been opened
+ ***********************************************************************************************************************/
+fsp_err_t R_ETHER_PHY_LinkStateInvalidate (ether_phy_ctrl_t * const p_ctrl)
+{
+    ether_phy_instance_ctrl_t * p_instance_ctrl = (ether_phy_instance_ctrl_t *) p_ctrl;
+
+#if (ETHER_PHY_CFG_PARAM_CHECKING_ENABLE)
+    FSP_ASSERT(p_instance_ctrl);
+    ETHER_PHY_ERROR_RETURN(ETHER_PHY_OPEN == p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+
+#if (ETHER_PHY_CFG_LINK_INTERRUPT_ENABLE)
+    p_instance_ctrl->link_state_valid = 0U;
+#else
+    FSP_PARAMETER_NOT_USED(p_instance_ctrl);
+#endif
+
+    return FSP_SUCCESS;
+}                                      /* End of function R_ETHER_PHY_LinkStateInvalidate() */
+
 /********************************************************************************************************************//**
  * @brief Provides API and code version in the user provided pointer. Implements @ref ether_phy_api_t::versionGet.
  *
@@ -522,18 +643,12 @@ void ether_phy_write (ether_phy_instance_ctrl_t * p_instance_ctrl, uint32_t reg_
  ***********************************************************************************************************************/
 static void ether_phy_preamble (ether_phy_instance_ctrl_t * p_instance_ctrl)
 {
-    int16_t i;
-
     /*
      * The processing of PRE (preamble) about the frame format of MII Management Interface which is
      * provided by "Table 22-12" of "22.2.4.5" of "IEEE 802.3-2008_section2".
+     * When the PHY-LSI accepts suppressed preambles, a single idle bit separates the frames.
      */
-    i = ETHER_PHY_PREAMBLE_LENGTH;
-    while (i > 0)
-    {
-        ether_phy_mii_write1(p_instance_ctrl);
-        i--;
-    }
+    ether_phy_mii_bits_write(p_instance_ctrl, UINT32_MAX, p_instance_ctrl->preamble_length);
 }                                      /* End of function ether_phy_preamble() */
 
 /***********************************************************************************************************************
@@ -549,7 +664,6 @@ static void ether_phy_preamble (ether_phy_instance_ctrl_t * p_instance_ctrl)
  ***********************************************************************************************************************/
 static void ether_phy_reg_set (ether_phy_instance_ctrl_t * p_instance_ctrl, uint32_t reg_addr, int32_t option)
 {
-    int32_t  i;
     uint32_t data = 0;
 
     /*
@@ -557,36 +671,22 @@ static void ether_phy_reg_set (ether_phy_instance_ctrl_t * p_instance_ctrl, uint
      * REGAD (Register Address)  about the frame format of MII Management Interface which is
      * provided by "Table 22-12" of "22.2.4.5" of "IEEE 802.3-2008_section2".
      */
-    data = (ETHER_PHY_MII_ST << 14);                                             /* ST code    */
+    data = (ETHER_PHY_MII_ST << 12);                                             /* ST code    */
 
     if (ETHER_PHY_MII_READ == option)
     {
-        data |= (ETHER_PHY_MII_READ << 12);                                      /* OP code(RD)  */
+        data |= (ETHER_PHY_MII_READ << 10);                                      /* OP code(RD)  */
     }
     else
     {
-        data |= (ETHER_PHY_MII_WRITE << 12);                                     /* OP code(WT)  */
+        data |= (ETHER_PHY_MII_WRITE << 10);                                     /* OP code(WT)  */
     }
 
-    data |= (uint32_t) (p_instance_ctrl->p_ether_phy_cfg->phy_lsi_address << 7); /* PHY Address  */
-
-    data |= (reg_addr << 2);                                                     /* Reg Address  */
+    data |= (uint32_t) (p_instance_ctrl->p_ether_phy_cfg->phy_lsi_address << 5); /* PHY Address  */
 
-    i = 14;
-    while (i > 0)
-    {
-        if (0 == (data & ETHER_PHY_WRITE_DATA_BIT_MASK))
-        {
-            ether_phy_mii_write0(p_instance_ctrl);
-        }
-        else
-        {
-            ether_phy_mii_write1(p_instance_ctrl);
-        }
+    data |= reg_addr;                                                            /* Reg Address  */
 
-        data = (data << 1);
-        i--;
-    }
+    ether_phy_mii_bits_write(p_instance_ctrl, data, ETHER_PHY_REG_SET_LENGTH);
 }                                      /* End of function ether_phy_reg_set() */
 
 /***********************************************************************************************************************
@@ -600,50 +700,11 @@ static void ether_phy_reg_set (ether_phy_instance_ctrl_t * p_instance_ctrl, uint
  ***********************************************************************************************************************/
 static void ether_phy_reg_read (ether_phy_instance_ctrl_t * p_instance_ctrl, uint32_t * pdata)
 {
-    int32_t  i;
-    int32_t  j;
-    uint32_t reg_data;
-
-    volatile uint32_t * petherc_pir;
-
-    petherc_pir = p_instance_ctrl->p_reg_pir;
-
     /*
      * The processing of DATA (data) about reading of the frame format of MII Management Interface which is
      * provided by "Table 22-12" of "22.2.4.5" of "IEEE 802.3-2008_section2".
      */
-    reg_data = 0;
-    i        = 16;
-    while (i > 0)
-    {
-        for (j = p_instance_ctrl->p_ether_phy_cfg->mii_bit_access_wait_time; j > 0; j--)
-        {
-            (*petherc_pir) = (ETHER_PHY_PIR_MDO_LOW | ETHER_PHY_PIR_MMD_READ | ETHER_PHY_PIR_MDC_LOW);
-        }
-
-        for (j = p_instance_ctrl->p_ether_phy_cfg->mii_bit_access_wait_time; j > 0; j--)
-        {
-            (*petherc_pir) = (ETHER_PHY_PIR_MDO_LOW | ETHER_PHY_PIR_MMD_READ | ETHER_PHY_PIR_MDC_HIGH);
-        }
-
-        reg_data = (reg_data << 1);
-
-        reg_data |= (uint32_t) (((*petherc_pir) & ETHER_PHY_PIR_MDI_MASK) >> 3); /* MDI read  */
-
-        for (j = p_instance_ctrl->p_ether_phy_cfg->mii_bit_access_wait_time; j > 0; j--)
-        {
-            (*petherc_pir) = (ETHER_PHY_PIR_MDO_LOW | ETHER_PHY_PIR_MMD_READ | ETHER_PHY_PIR_MDC_HIGH);
-        }
-
-        for (j = p_instance_ctrl->p_ether_phy_cfg->mii_bit_access_wait_time; j > 0; j--)
-        {
-            (*petherc_pir) = (ETHER_PHY_PIR_MDO_LOW | ETHER_PHY_PIR_MMD_READ | ETHER_PHY_PIR_MDC_LOW);
-        }
-
-        i--;
-    }
-
-    (*pdata) = reg_data;
+    (*pdata) = ether_phy_mii_bits_read(p_instance_ctrl, ETHER_PHY_DATA_LENGTH);
 }                                      /* End of function ether_phy_reg_read() */
 
 /***********************************************************************************************************************
@@ -657,27 +718,11 @@ static void ether_phy_reg_read (ether_phy_instance_ctrl_t * p_instance_ctrl, uin
  ***********************************************************************************************************************/
 static void ether_phy_reg_write (ether_phy_instance_ctrl_t * p_instance_ctrl, uint32_t data)
 {
-    int32_t i;
-
     /*
      * The processing of DATA (data) about writing of the frame format of MII Management Interface which is
      * provided by "Table 22-12" of "22.2.4.5" of "IEEE 802.3-2008_section2".
      */
-    i = 16;
-    while (i > 0)
-    {
-        if (0 == (data & ETHER_PHY_WRITE_DATA_BIT_MASK))
-        {
-            ether_phy_mii_write0(p_instance_ctrl);
-        }
-        else
-        {
-            ether_phy_mii_write1(p_instance_ctrl);
-        }
-
-        i--;
-        data = (data << 1);
-    }
+    ether_phy_mii_bits_write(p_instance_ctrl, data, ETHER_PHY_DATA_LENGTH);
 }                                      /* End of function ether_phy_reg_write() */
 
 /***********************************************************************************************************************
@@ -690,35 +735,11 @@ static void ether_phy_reg_write (ether_phy_instance_ctrl_t * p_instance_ctrl, ui
  ***********************************************************************************************************************/
 static void ether_phy_trans_zto0 (ether_phy_instance_ctrl_t * p_instance_ctrl)
 {
-    int32_t j;
-
-    volatile uint32_t * petherc_pir;
-
-    petherc_pir = p_instance_ctrl->p_reg_pir;
-
     /*
      * The processing of TA (turnaround) about reading of the frame format of MII Management Interface which is
      * provided by "Table 22-12" of "22.2.4.5" of "IEEE 802.3-2008_section2".
      */
-    for (j = p_instance_ctrl->p_ether_phy_cfg->mii_bit_access_wait_time; j > 0; j--)
-    {
-        (*petherc_pir) = (ETHER_PHY_PIR_MDO_LOW | ETHER_PHY_PIR_MMD_READ | ETHER_PHY_PIR_MDC_LOW);
-    }
-
-    for (j = p_instance_ctrl->p_ether_phy_cfg->mii_bit_access_wait_time; j > 0; j--)
-    {
-        (*petherc_pir) = (ETHER_PHY_PIR_MDO_LOW | ETHER_PHY_PIR_MMD_READ | ETHER_PHY_PIR_MDC_HIGH);
-    }
-
-    for (j = p_instance_ctrl->p_ether_phy_cfg->mii_bit_access_wait_time; j > 0; j--)
-    {
-        (*petherc_pir) = (ETHER_PHY_PIR_MDO_LOW | ETHER_PHY_PIR_MMD_READ | ETHER_PHY_PIR_MDC_HIGH);
-    }
-
-    for (j = p_instance_ctrl->p_ether_phy_cfg->mii_bit_access_wait_time; j > 0; j--)
-    {
-        (*petherc_pir) = (ETHER_PHY_PIR_MDO_LOW | ETHER_PHY_PIR_MMD_READ | ETHER_PHY_PIR_MDC_LOW);
-    }
+    ether_phy_mii_bits_read(p_instance_ctrl, 1U);
 }                                      /* End of function ether_phy_trans_zto0() */
 
 /***********************************************************************************************************************
@@ -735,89 +756,161 @@ static void ether_phy_trans_1to0 (ether_phy_instance_ctrl_t * p_instance_ctrl)
      * The processing of TA (turnaround) about writing of the frame format of MII Management Interface which is
      * provided by "Table 22-12" of "22.2.4.5" of "IEEE 802.3-2008_section2".
      */
-    ether_phy_mii_write1(p_instance_ctrl);
-    ether_phy_mii_write0(p_instance_ctrl);
+    ether_phy_mii_bits_write(p_instance_ctrl, 0x2U, 2U);
 }                                      /* End of function ether_phy_trans_1to0() */
 
 /***********************************************************************************************************************
- * Function Name: ether_phy_mii_write1
- * Description  : Outputs 1 to the MII interface
- * Arguments    : ether_channel -
- *                    Ethernet channel number
+ * Function Name: ether_phy_mii_bits_write
+ * Description  : Outputs bits to the MII interface, most significant bit first
+ * Arguments    : p_instance_ctrl -
+ *                    Ethernet PHY control block
+ *                data -
+ *                    bits to output in the low num_bits bits
+ *                num_bits -
+ *                    number of bits to output
  * Return Value : none
  ***********************************************************************************************************************/
-static void ether_phy_mii_write1 (ether_phy_instance_ctrl_t * p_instance_ctrl)
+static void ether_phy_mii_bits_write (ether_phy_instance_ctrl_t * p_instance_ctrl, uint32_t data, uint32_t num_bits)
 {
-    int32_t             j;
-    volatile uint32_t * petherc_pir;
-
-    petherc_pir = p_instance_ctrl->p_reg_pir;
+    volatile uint32_t * petherc_pir = p_instance_ctrl->p_reg_pir;
+    uint32_t            hold        = p_instance_ctrl->mdc_hold;
+    uint32_t            pir;
+    uint32_t            j;
 
     /*
      * The processing of one bit about frame format of MII Management Interface which is
      * provided by "Table 22-12" of "22.2.4.5" of "IEEE 802.3-2008_section2".
-     * The data that 1 is output.
+     * MDO is held for a whole MDC period: a quarter low, a half high and a quarter low.
      */
-    for (j = p_instance_ctrl->p_ether_phy_cfg->mii_bit_access_wait_time; j > 0; j--)
+    while (num_bits > 0U)
     {
-        (*petherc_pir) = (ETHER_PHY_PIR_MDO_HIGH | ETHER_PHY_PIR_MMD_WRITE | ETHER_PHY_PIR_MDC_LOW);
-    }
+        num_bits--;
+        pir = (0U != ((data >> num_bits) & 1U)) ? ETHER_PHY_PIR_MDO_HIGH : ETHER_PHY_PIR_MDO_LOW;
+        pir |= ETHER_PHY_PIR_MMD_WRITE;
 
-    for (j = p_instance_ctrl->p_ether_phy_cfg->mii_bit_access_wait_time; j > 0; j--)
-    {
-        (*petherc_pir) = (ETHER_PHY_PIR_MDO_HIGH | ETHER_PHY_PIR_MMD_WRITE | ETHER_PHY_PIR_MDC_HIGH);
-    }
+        for (j = hold; j > 0U; j--)
+        {
+            (*petherc_pir) = (pir | ETHER_PHY_PIR_MDC_LOW);
+        }
 
-    for (j = p_instance_ctrl->p_ether_phy_cfg->mii_bit_access_wait_time; j > 0; j--)
-    {
-        (*petherc_pir) = (ETHER_PHY_PIR_MDO_HIGH | ETHER_PHY_PIR_MMD_WRITE | ETHER_PHY_PIR_MDC_HIGH);
+        for (j = 2U * hold; j > 0U; j--)
+        {
+            (*petherc_pir) = (pir | ETHER_PHY_PIR_MDC_HIGH);
+        }
+
+        for (j = hold; j > 0U; j--)
+        {
+            (*petherc_pir) = (pir | ETHER_PHY_PIR_MDC_LOW);
+        }
     }
+}                                      /* End of function ether_phy_mii_bits_write() */
+
+/***********************************************************************************************************************
+ * Function Name: ether_phy_mii_bits_read
+ * Description  : Releases MDIO and inputs bits from the MII interface, most significant bit first
+ * Arguments    : p_instance_ctrl -
+ *                    Ethernet PHY control block
+ *                num_bits -
+ *                    number of bits to input
+ * Return Value : bits read
+ ***********************************************************************************************************************/
+static uint32_t ether_phy_mii_bits_read (ether_phy_instance_ctrl_t * p_instance_ctrl, uint32_t num_bits)
+{
+    volatile uint32_t * petherc_pir = p_instance_ctrl->p_reg_pir;
+    uint32_t            hold        = p_instance_ctrl->mdc_hold;
+    uint32_t            data        = 0U;
+    uint32_t            j;
 
-    for (j = p_instance_ctrl->p_ether_phy_cfg->mii_bit_access_wait_time; j > 0; j--)
+    /* MDI is sampled in the middle of the high half of the MDC period. */
+    while (num_bits > 0U)
     {
-        (*petherc_pir) = (ETHER_PHY_PIR_MDO_HIGH | ETHER_PHY_PIR_MMD_WRITE | ETHER_PHY_PIR_MDC_LOW);
+        for (j = hold; j > 0U; j--)
+        {
+            (*petherc_pir) = (ETHER_PHY_PIR_MDO_LOW | ETHER_PHY_PIR_MMD_READ | ETHER_PHY_PIR_MDC_LOW);
+        }
+
+        for (j = hold; j > 0U; j--)
+        {
+            (*petherc_pir) = (ETHER_PHY_PIR_MDO_LOW | ETHER_PHY_PIR_MMD_READ | ETHER_PHY_PIR_MDC_HIGH);
+        }
+
+        data = (data << 1) | (((*petherc_pir) & ETHER_PHY_PIR_MDI_MASK) >> 3); /* MDI read  */
+
+        for (j = hold; j > 0U; j--)
+        {
+            (*petherc_pir) = (ETHER_PHY_PIR_MDO_LOW | ETHER_PHY_PIR_MMD_READ | ETHER_PHY_PIR_MDC_HIGH);
+        }
+
+        for (j = hold; j > 0U; j--)
+        {
+            (*petherc_pir) = (ETHER_PHY_PIR_MDO_LOW | ETHER_PHY_PIR_MMD_READ | ETHER_PHY_PIR_MDC_LOW);
+        }
+
+        num_bits--;
     }
-}                                      /* End of function ether_phy_mii_write1() */
+
+    return data;
+}                                      /* End of function ether_phy_mii_bits_read() */
 
 /***********************************************************************************************************************
- * Function Name: ether_phy_mii_write0
- * Description  : Outputs 0 to the MII interface
- * Arguments    : ether_channel -
- *                    Ethernet channel number
+ * Function Name: ether_phy_link_state_read
+ * Description  : Reads the basic status and the link partner ability registers in one go. With the link interrupt
+ *                enabled the values are kept until the next link change interrupt.
+ * Arguments    : p_instance_ctrl -
+ *                    Ethernet PHY control block
+ *                p_status -
+ *                    pointer to store the basic status register
+ *                p_partner -
+ *                    pointer to store the link partner ability register
  * Return Value : none
  ***********************************************************************************************************************/
-static void ether_phy_mii_write0 (ether_phy_instance_ctrl_t * p_instance_ctrl)
+static void ether_phy_link_state_read (ether_phy_instance_ctrl_t * p_instance_ctrl,
+                                       uint32_t                  * p_status,
+                                       uint32_t                  * p_partner)
 {
-    int32_t             j;
-    volatile uint32_t * petherc_pir;
-
-    petherc_pir = p_instance_ctrl->p_reg_pir;
-
-    /*
-     * The processing of one bit about frame format of MII Management Interface which is
-     * provided by "Table 22-12" of "22.2.4.5" of "IEEE 802.3-2008_section2".
-     * The data that 0 is output.
-     */
-    for (j = p_instance_ctrl->p_ether_phy_cfg->mii_bit_access_wait_time; j > 0; j--)
+    /* Because reading the first time shows the previous state, the Link status bit is read twice. */
+    static const uint32_t reg_addr[ETHER_PHY_LINK_STATE_READ_NUM] =
     {
-        (*petherc_pir) = (ETHER_PHY_PIR_MDO_LOW | ETHER_PHY_PIR_MMD_WRITE | ETHER_PHY_PIR_MDC_LOW);
-    }
+        ETHER_PHY_REG_STATUS, ETHER_PHY_REG_STATUS, ETHER_PHY_REG_AN_LINK_PARTNER
+    };
+    uint32_t data[ETHER_PHY_LINK_STATE_READ_NUM];
+    uint32_t i;
 
-    for (j = p_instance_ctrl->p_ether_phy_cfg->mii_bit_access_wait_time; j > 0; j--)
+#if (ETHER_PHY_CFG_LINK_INTERRUPT_ENABLE)
+    if (0U != p_instance_ctrl->link_state_valid)
     {
-        (*petherc_pir) = (ETHER_PHY_PIR_MDO_LOW | ETHER_PHY_PIR_MMD_WRITE | ETHER_PHY_PIR_MDC_HIGH);
+        (*p_status)  = p_instance_ctrl->link_status;
+        (*p_partner) = p_instance_ctrl->link_partner;
+
+        return;
     }
 
-    for (j = p_instance_ctrl->p_ether_phy_cfg->mii_bit_access_wait_time; j > 0; j--)
+    /* Mark the state valid before reading it, so a link change interrupt during the read invalidates it again. */
+    p_instance_ctrl->link_state_valid = 1U;
+
+    /* Release the INT pin before sampling the link status, so a link change after this point is signaled again. */
+    ether_phy_targets_link_interrupt_clear(p_instance_ctrl);
+#endif
+
+    for (i = 0U; i < ETHER_PHY_LINK_STATE_READ_NUM; i++)
     {
-        (*petherc_pir) = (ETHER_PHY_PIR_MDO_LOW | ETHER_PHY_PIR_MMD_WRITE | ETHER_PHY_PIR_MDC_HIGH);
+        data[i] = ether_phy_read(p_instance_ctrl, reg_addr[i]);
     }
 
-    for (j = p_instance_ctrl->p_ether_phy_cfg->mii_bit_access_wait_time; j > 0; j--)
+#if (ETHER_PHY_CFG_LINK_INTERRUPT_ENABLE)
+    p_instance_ctrl->link_status  = data[1];
+    p_instance_ctrl->link_partner = data[2];
+
+    /* The PHY-LSI raises no interrupt when auto-negotiation completes, so an incomplete state is not kept. */
+    if ((0U != (data[1] & ETHER_PHY_STATUS_LINK_UP)) && (0U == (data[1] & ETHER_PHY_STATUS_AN_COMPLETE)))
     {
-        (*petherc_pir) = (ETHER_PHY_PIR_MDO_LOW | ETHER_PHY_PIR_MMD_WRITE | ETHER_PHY_PIR_MDC_LOW);
+        p_instance_ctrl->link_state_valid = 0U;
     }
-}                                      /* End of function ether_phy_mii_write0() */
+#endif
+
+    (*p_status)  = data[1];
+    (*p_partner) = data[2];
+}                                      /* End of function ether_phy_link_state_read() */
 
 /***********************************************************************************************************************
  * Function Name: ether_phy_targets_initialize
@@ -830,3 +923,15 @@ void ether_phy_targets_initialize (ether_phy_instance_ctrl_t * p_instance_ctrl)
 {
     (void) p_instance_ctrl;
 }                                      /* End of function ether_phy_targets_initialize() */
+
+/***********************************************************************************************************************
+ * Function Name: ether_phy_targets_link_interrupt_clear
+ * Description  : PHY-LSI specific clearing of the latched link change interrupt
+ * Arguments    : p_instance_ctrl -
+ *                    Ethernet PHY control block
+ * Return Value : none
+ ***********************************************************************************************************************/
+void ether_phy_targets_link_interrupt_clear (ether_phy_instance_ctrl_t * p_instance_ctrl)
+{
+    (void) p_instance_ctrl;
+}                                      /* End of function ether_phy_targets_link_interrupt_clear() */
@@ -53,6 +53,7 @@
  * Exported global function
  ***********************************************************************************************************************/
 void            ether_phy_targets_initialize(ether_phy_instance_ctrl_t * p_instance_ctrl);
+void            ether_phy_targets_link_interrupt_clear(ether_phy_instance_ctrl_t * p_instance_ctrl);
 extern uint32_t ether_phy_read(ether_phy_instance_ctrl_t * p_instance_ctrl, uint32_t reg_addr);
 extern void     ether_phy_write(ether_phy_instance_ctrl_t * p_instance_ctrl, uint32_t reg_addr, uint32_t data);
 
@@ -93,8 +94,21 @@ void ether_phy_targets_initialize (ether_phy_instance_ctrl_t * p_instance_ctrl)
  #endif
 
     /* b9=0:Interrupt pin active low */
-    reg &= (uint16_t) ~ETHER_PHY_REG_PHY_CONTROL2_RMII_IL_OFFSET;
+    reg &= (uint16_t) ~(0x1 << ETHER_PHY_REG_PHY_CONTROL2_RMII_IL_OFFSET);
     ether_phy_write(p_instance_ctrl, ETHER_PHY_REG_PHY_CONTROL2, reg);
 }                                      /* End of function ether_phy_targets_initialize() */
 
+/***********************************************************************************************************************
+ * Function Name: ether_phy_targets_link_interrupt_clear
+ * Description  : Clears the latched link-up/link-down interrupt and releases the INT pin
+ * Arguments    : p_instance_ctrl -
+ *                    Ethernet PHY control block
+ * Return Value : none
+ ***********************************************************************************************************************/
+void ether_phy_targets_link_interrupt_clear (ether_phy_instance_ctrl_t * p_instance_ctrl)
+{
+    /* The interrupt status bits (b7-b0) of the interrupt control/status register are cleared on read. */
+    ether_phy_read(p_instance_ctrl, ETHER_PHY_REG_INTERRUPT_CONTROL);
+}                                      /* End of function ether_phy_targets_link_interrupt_clear() */
+
 #endif /* ETHER_PHY_CFG_USE_PHY == ETHER_PHY_CFG_USE_PHY_KSZ8091RNB */
@@ -122,6 +122,21 @@ typedef BSP_CMSE_NONSECURE_CALL void (*volatile flash_hp_prv_ns_callback)(flash_
 
 #define FLASH_HP_FSUACR_KEY                             (0x6600U)
 
+/* Dual bank mode option setting memory (DUALSEL and BANKSEL) */
+#define FLASH_HP_FCU_CONFIG_SET_DUAL_MODE               (0x0100A110U)
+#define FLASH_HP_FCU_CONFIG_SET_BANK_MODE               (0x0100A190U)
+#define FLASH_HP_DUALSEL_BANKMD_MASK                    (0x7U)
+#define FLASH_HP_DUALSEL_BANKMD_DUAL                    (0x0U)
+#define FLASH_HP_BANKSEL_BANKSWP_MASK                   (0x7U)
+
+/* In dual bank mode each bank has half of the code flash and starts with the small blocks of region 0. */
+#define FLASH_HP_CF_BANK_SIZE                           (BSP_ROM_SIZE_BYTES / 2U)
+#if BSP_FEATURE_FLASH_HP_SUPPORTS_DUAL_BANK
+ #define FLASH_HP_CF_BANK_OFFSET_MASK                   (BSP_FEATURE_FLASH_HP_CF_DUAL_BANK_START - 1U)
+#else
+ #define FLASH_HP_CF_BANK_OFFSET_MASK                   (UINT32_MAX)
+#endif
+
 #define FLASH_HP_SAS_KEY                                (0x6600U)
 
 /** Register masks */
@@ -269,6 +284,16 @@ static fsp_err_t flash_hp_df_write(flash_hp_instance_ctrl_t * const p_ctrl);
 
 static fsp_err_t flash_hp_df_erase(flash_hp_instance_ctrl_t * p_ctrl, uint32_t block_address, uint32_t num_blocks);
 
+static void r_flash_hp_request_insert(flash_hp_instance_ctrl_t * p_ctrl, flash_hp_request_t * p_request, bool resume);
+
+static void r_flash_hp_request_dispatch(flash_hp_instance_ctrl_t * p_ctrl);
+
+static bool r_flash_hp_request_preempt(flash_hp_instance_ctrl_t * p_ctrl);
+
+static void r_flash_hp_request_complete(flash_hp_instance_ctrl_t * p_ctrl, flash_event_t event);
+
+static void r_flash_hp_request_flush(flash_hp_instance_ctrl_t * p_ctrl);
+
 #endif
 
 #if (FLASH_HP_CFG_CODE_FLASH_PROGRAMMING_ENABLE == 1)
@@ -298,6 +323,19 @@ static fsp_err_t flash_hp_set_id_code(flash_hp_instance_ctrl_t * p_ctrl,
                                       uint8_t const * const      p_id_code,
                                       flash_id_code_mode_t       mode) PLACE_IN_RAM_SECTION;
 
+static fsp_err_t flash_hp_bank_swap(flash_hp_instance_ctrl_t * p_ctrl) PLACE_IN_RAM_SECTION;
+
+static bool flash_hp_cf_bank_bgo_address(flash_hp_instance_ctrl_t * const p_ctrl, uint32_t address);
+
+static bool flash_hp_cf_bank_verify(flash_hp_instance_ctrl_t * const p_ctrl);
+
+static uint32_t flash_hp_cf_block_size(uint32_t address);
+
+ #if (FLASH_HP_CFG_PARAM_CHECKING_ENABLE == 1)
+
+static uint32_t flash_hp_cf_erase_size(uint32_t block_address, uint32_t num_blocks);
+
+ #endif
 #endif
 
 #if (FLASH_HP_CFG_PARAM_CHECKING_ENABLE == 1)
@@ -391,6 +429,10 @@ fsp_err_t R_FLASH_HP_Open (flash_ctrl_t * const p_api_ctrl, flash_cfg_t const *
     /* Set the parameters struct based on the user supplied settings */
     p_ctrl->p_cfg = p_cfg;
 
+    /* Start with an empty request queue. */
+    p_ctrl->p_request_head   = NULL;
+    p_ctrl->p_request_active = NULL;
+
     if (true == p_cfg->data_flash_bgo)
     {
         p_ctrl->p_callback        = p_cfg->p_callback;
@@ -418,6 +460,8 @@ fsp_err_t R_FLASH_HP_Open (flash_ctrl_t * const p_api_ctrl, flash_cfg_t const *
     err = flash_hp_init(p_ctrl);
     FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
 
+    BSP_TRACE(FSP_IP_FCU, 0U, BSP_TRACE_EVENT_OPEN, 0U);
+
     /* If successful mark the control block as open. Otherwise release the hardware lock. */
     p_ctrl->opened = FLASH_HP_OPEN;
 
@@ -427,6 +471,11 @@ fsp_err_t R_FLASH_HP_Open (flash_ctrl_t * const p_api_ctrl, flash_cfg_t const *
 /*******************************************************************************************************************//**
  * Writes to the specified Code or Data Flash memory area. Implements @ref flash_api_t::write.
  *
+ * In dual bank mode with BGO enabled, writes to the bank that is not being executed from
+ * (BSP_FEATURE_FLASH_HP_CF_DUAL_BANK_START onwards) run in the background like data flash writes and complete with
+ * FLASH_EVENT_WRITE_COMPLETE after the written data has been read back and compared with the source.
+ * FLASH_EVENT_ERR_FAILURE is reported if the comparison fails.
+ *
  * Example:
  * @snippet r_flash_hp_example.c R_FLASH_HP_Write
  *
@@ -460,13 +509,15 @@ fsp_err_t R_FLASH_HP_Write (flash_ctrl_t * const p_api_ctrl,
     FSP_ERROR_RETURN((err == FSP_SUCCESS), err);
 #endif
 
+    BSP_TRACE(FSP_IP_FCU, 0U, BSP_TRACE_EVENT_WRITE, num_bytes);
+
     p_ctrl->operations_remaining = (num_bytes) >> 1; // Since two bytes will be written at a time
     p_ctrl->source_start_address = src_address;
     p_ctrl->dest_end_address     = flash_address;
     p_ctrl->current_operation    = FLASH_OPERATION_NON_BGO;
 
 #if (FLASH_HP_CFG_CODE_FLASH_PROGRAMMING_ENABLE == 1)
-    if (flash_address < BSP_ROM_SIZE_BYTES)
+    if ((flash_address < BSP_ROM_SIZE_BYTES) || flash_hp_cf_bank_bgo_address(p_ctrl, flash_address))
     {
  #if (FLASH_HP_CFG_PARAM_CHECKING_ENABLE == 1)
 
@@ -496,6 +547,9 @@ fsp_err_t R_FLASH_HP_Write (flash_ctrl_t * const p_api_ctrl,
  * @note       Code flash may contain blocks of different sizes. When erasing code flash it is important to take this
  *             into consideration to prevent erasing a larger address space than desired.
  *
+ * In dual bank mode with BGO enabled, erasing blocks of the bank that is not being executed from runs in the
+ * background and completes with FLASH_EVENT_ERASE_COMPLETE.
+ *
  * Example:
  * @snippet r_flash_hp_example.c R_FLASH_HP_Erase
  *
@@ -532,37 +586,24 @@ fsp_err_t R_FLASH_HP_Erase (flash_ctrl_t * const p_api_ctrl, uint32_t const addr
     FSP_ERROR_RETURN(num_blocks != 0U, FSP_ERR_INVALID_BLOCKS);
 #endif
 
+    BSP_TRACE(FSP_IP_FCU, 0U, BSP_TRACE_EVENT_ERASE, num_blocks);
+
     p_ctrl->current_operation = FLASH_OPERATION_NON_BGO;
 
 #if (FLASH_HP_CFG_CODE_FLASH_PROGRAMMING_ENABLE == 1)
-    if (address < BSP_ROM_SIZE_BYTES)
-    {
-        uint32_t start_address = 0;
- #if (FLASH_HP_CFG_PARAM_CHECKING_ENABLE == 1)
-        uint32_t region0_blocks = 0;
- #endif
+    bool background_bank = flash_hp_cf_bank_bgo_address(p_ctrl, address);
 
+    if ((address < BSP_ROM_SIZE_BYTES) || background_bank)
+    {
         /* Configure the current parameters based on if the operation is for code flash or data flash. */
-        if (address < BSP_FEATURE_FLASH_HP_CF_REGION0_SIZE)
-        {
-            start_address = address & ~(BSP_FEATURE_FLASH_HP_CF_REGION0_BLOCK_SIZE - 1);
- #if (FLASH_HP_CFG_PARAM_CHECKING_ENABLE == 1)
-            region0_blocks = (BSP_FEATURE_FLASH_HP_CF_REGION0_SIZE - start_address) /
-                             BSP_FEATURE_FLASH_HP_CF_REGION0_BLOCK_SIZE;
- #endif
-        }
-        else
-        {
-            start_address = address & ~(BSP_FEATURE_FLASH_HP_CF_REGION1_BLOCK_SIZE - 1);
-        }
+        uint32_t start_address = address & ~(flash_hp_cf_block_size(address) - 1U);
 
  #if (FLASH_HP_CFG_PARAM_CHECKING_ENABLE == 1)
-        uint32_t num_bytes = (region0_blocks * BSP_FEATURE_FLASH_HP_CF_REGION0_BLOCK_SIZE);
-        if (num_blocks > region0_blocks)
-        {
-            num_bytes += ((num_blocks - region0_blocks) * BSP_FEATURE_FLASH_HP_CF_REGION1_BLOCK_SIZE);
-        }
-        FSP_ERROR_RETURN(start_address + num_bytes <= BSP_ROM_SIZE_BYTES, FSP_ERR_INVALID_BLOCKS);
+        uint32_t bank_end = background_bank ? (BSP_FEATURE_FLASH_HP_CF_DUAL_BANK_START + FLASH_HP_CF_BANK_SIZE) :
+                            BSP_ROM_SIZE_BYTES;
+
+        FSP_ERROR_RETURN(start_address + flash_hp_cf_erase_size(start_address, num_blocks) <= bank_end,
+                         FSP_ERR_INVALID_BLOCKS);
  #endif
 
         err = flash_hp_cf_erase(p_ctrl, start_address, num_blocks);
@@ -634,7 +675,7 @@ fsp_err_t R_FLASH_HP_BlankCheck (flash_ctrl_t * const p_api_ctrl,
 
     /* Is this a request to Blank check Code Flash? */
     /* If the address is code flash check if the region is blank. If not blank return error. */
-    if (address < BSP_ROM_SIZE_BYTES)
+    if ((address < BSP_ROM_SIZE_BYTES) || flash_hp_cf_bank_bgo_address(p_ctrl, address))
     {
         /* Blank checking for Code Flash does not require any FCU operations. The specified address area
          * can simply be checked for non 0xFF. */
@@ -859,7 +900,8 @@ fsp_err_t R_FLASH_HP_AccessWindowClear (flash_ctrl_t * const p_api_ctrl)
  * Reset the FLASH peripheral. Implements @ref flash_api_t::reset.
  *
  * No attempt is made to check if the flash is busy before executing the reset since the assumption is that a reset will
- * terminate any existing operation.
+ * terminate any existing operation. Requests queued with R_FLASH_HP_RequestSubmit() are discarded without a callback
+ * and their status is set to FLASH_HP_REQUEST_STATUS_IDLE.
  *
  * @retval     FSP_SUCCESS         Flash circuit successfully reset.
  * @retval     FSP_ERR_ASSERTION   NULL provided for p_ctrl.
@@ -884,6 +926,12 @@ fsp_err_t R_FLASH_HP_Reset (flash_ctrl_t * const p_api_ctrl)
     FSP_ERROR_RETURN(FLASH_HP_OPEN == p_ctrl->opened, FSP_ERR_NOT_OPEN);
 #endif
 
+#if (FLASH_HP_CFG_DATA_FLASH_PROGRAMMING_ENABLE == 1)
+
+    /* Discard queued requests, including the one the reset is about to cancel. */
+    r_flash_hp_request_flush(p_ctrl);
+#endif
+
     /* Reset the flash. */
     return flash_hp_reset(p_ctrl);
 }
@@ -896,16 +944,22 @@ fsp_err_t R_FLASH_HP_Reset (flash_ctrl_t * const p_api_ctrl)
  * switch, update the block and switch them back without having to touch the access window. Implements
  * @ref flash_api_t::startupAreaSelect.
  *
+ * In dual bank mode, FLASH_STARTUP_AREA_BANK_SWAP makes the bank that is not being executed from the startup bank
+ * after the next reset. The swap is refused with FSP_ERR_INVALID_STATE unless that bank holds a vector table with an
+ * initial stack pointer and a reset vector inside the bank, and BANKSEL is read back after it has been written.
+ *
  * @retval     FSP_SUCCESS               Start-up area successfully toggled.
  * @retval     FSP_ERR_IN_USE            FLASH peripheral is busy with a prior operation.
  * @retval     FSP_ERR_ASSERTION         NULL provided for p_ctrl.
  * @retval     FSP_ERR_NOT_OPEN          The control block is not open.
- * @retval     FSP_ERR_UNSUPPORTED       Code Flash Programming is not enabled.
+ * @retval     FSP_ERR_UNSUPPORTED       Code Flash Programming is not enabled, or FLASH_STARTUP_AREA_BANK_SWAP
+ *                                       requested but the device is not in dual bank mode.
  * @retval     FSP_ERR_PE_FAILURE        Failed to enter or exit Code Flash P/E mode.
  * @retval     FSP_ERR_TIMEOUT           Timed out waiting for the FCU to become ready.
  * @retval     FSP_ERR_WRITE_FAILED      Status is indicating a Programming error for the requested operation.
  * @retval     FSP_ERR_CMD_LOCKED        FCU is in locked state, typically as a result of having received an illegal
  *                                       command.
+ * @retval     FSP_ERR_INVALID_STATE     FLASH_STARTUP_AREA_BANK_SWAP requested but the other bank holds no image.
  **********************************************************************************************************************/
 fsp_err_t R_FLASH_HP_StartUpAreaSelect (flash_ctrl_t * const      p_api_ctrl,
                                         flash_startup_area_swap_t swap_type,
@@ -927,9 +981,19 @@ fsp_err_t R_FLASH_HP_StartUpAreaSelect (flash_ctrl_t * const      p_api_ctrl,
 
     /* If the swap type is BTFLG and the operation is temporary there's nothing to do. */
     FSP_ASSERT(!((swap_type == FLASH_STARTUP_AREA_BTFLG) && (is_temporary == false)));
+
+    /* A bank swap only takes effect after the next reset. */
+    FSP_ASSERT(!((swap_type == FLASH_STARTUP_AREA_BANK_SWAP) && (is_temporary == true)));
  #endif
 
-    err = flash_hp_set_startup_area_boot(p_ctrl, swap_type, is_temporary);
+    if (FLASH_STARTUP_AREA_BANK_SWAP == swap_type)
+    {
+        err = flash_hp_bank_swap(p_ctrl);
+    }
+    else
+    {
+        err = flash_hp_set_startup_area_boot(p_ctrl, swap_type, is_temporary);
+    }
 #else
 
     /* Eliminate warning if code flash programming is disabled. */
@@ -1003,8 +1067,8 @@ fsp_err_t R_FLASH_HP_InfoGet (flash_ctrl_t * const p_api_ctrl, flash_info_t * co
 }
 
 /*******************************************************************************************************************//**
- * Releases any resources that were allocated by the Open() or any subsequent Flash operations. Implements
- * @ref flash_api_t::close.
+ * Releases any resources that were allocated by the Open() or any subsequent Flash operations. Requests queued with
+ * R_FLASH_HP_RequestSubmit() are discarded without a callback. Implements @ref flash_api_t::close.
  *
  * @retval     FSP_SUCCESS        Successful close.
  * @retval     FSP_ERR_NOT_OPEN   The control block is not open.
@@ -1031,6 +1095,14 @@ fsp_err_t R_FLASH_HP_Close (flash_ctrl_t * const p_api_ctrl)
     /* Close the API */
     p_ctrl->opened = FLASH_HP_CLOSE;
 
+    BSP_TRACE(FSP_IP_FCU, 0U, BSP_TRACE_EVENT_CLOSE, 0U);
+
+#if (FLASH_HP_CFG_DATA_FLASH_PROGRAMMING_ENABLE == 1)
+
+    /* Discard any queued requests. */
+    r_flash_hp_request_flush(p_ctrl);
+#endif
+
     /* Disable interrupt in ICU */
     R_BSP_IrqDisable(p_ctrl->p_cfg->irq);
 
@@ -1115,6 +1187,128 @@ fsp_err_t R_FLASH_HP_VersionGet (fsp_version_t * const p_version)
     return FSP_SUCCESS;
 }
 
+/*******************************************************************************************************************//**
+ * Queues a data flash write, erase or blank check. Requests are started in priority order (FIFO within a priority)
+ * from the flash ready interrupt as the previous operation completes, so several users can share the data flash
+ * without serializing around the callback. When a request with a higher priority is queued, a multi-block erase or
+ * multi-unit write in progress yields to it between flash commands and resumes afterwards; src_address,
+ * flash_address and num of the yielding request are advanced to reflect its progress.
+ *
+ * On completion p_request->event holds the result (FLASH_EVENT_WRITE_COMPLETE, FLASH_EVENT_ERASE_COMPLETE,
+ * FLASH_EVENT_BLANK, FLASH_EVENT_NOT_BLANK or an error event), p_request->status becomes
+ * FLASH_HP_REQUEST_STATUS_COMPLETE and p_request->p_callback is called if it is not NULL. The callback set in
+ * flash_cfg_t is not called for queued requests. Operations started with R_FLASH_HP_Write(), R_FLASH_HP_Erase() or
+ * R_FLASH_HP_BlankCheck() are allowed while the queue is idle; queued requests wait for them to complete.
+ *
+ * In dual bank mode, writes and erases of the code flash bank that is not being executed from can be queued too, so an
+ * update image can be streamed into that bank while the application keeps running. These writes are verified as
+ * described for R_FLASH_HP_Write().
+ *
+ * A request submitted while a blocking code flash operation is in progress is started by the next call to this
+ * function.
+ *
+ * @retval     FSP_SUCCESS              Request queued, or started if the flash was idle.
+ * @retval     FSP_ERR_ASSERTION        NULL provided for p_ctrl or p_request.
+ * @retval     FSP_ERR_NOT_OPEN         The Flash API is not Open.
+ * @retval     FSP_ERR_UNSUPPORTED      Data flash programming or data flash BGO is not enabled.
+ * @retval     FSP_ERR_IN_USE           p_request is already queued or in progress.
+ * @retval     FSP_ERR_INVALID_ADDRESS  flash_address is not in data flash or the background bank, or is not on a
+ *                                      programming or block boundary.
+ * @retval     FSP_ERR_INVALID_SIZE     num is zero, not a multiple of the programming size or exceeds data flash.
+ * @retval     FSP_ERR_INVALID_BLOCKS   num is zero or the erase exceeds data flash.
+ **********************************************************************************************************************/
+fsp_err_t R_FLASH_HP_RequestSubmit (flash_ctrl_t * const p_api_ctrl, flash_hp_request_t * const p_request)
+{
+    flash_hp_instance_ctrl_t * p_ctrl = (flash_hp_instance_ctrl_t *) p_api_ctrl;
+
+#if (FLASH_HP_CFG_DATA_FLASH_PROGRAMMING_ENABLE == 1)
+ #if (FLASH_HP_CFG_PARAM_CHECKING_ENABLE == 1)
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ASSERT(NULL != p_request);
+    FSP_ERROR_RETURN(FLASH_HP_OPEN == p_ctrl->opened, FSP_ERR_NOT_OPEN);
+
+    /* Requests are dispatched from the flash ready interrupt, so data flash BGO is required. */
+    FSP_ERROR_RETURN(true == p_ctrl->p_cfg->data_flash_bgo, FSP_ERR_UNSUPPORTED);
+
+    uint32_t  region_start = FLASH_HP_DF_START_ADDRESS;
+    uint32_t  region_end   = FLASH_HP_DF_START_ADDRESS + BSP_DATA_FLASH_SIZE_BYTES;
+    uint32_t  write_size   = BSP_FEATURE_FLASH_HP_DF_WRITE_SIZE;
+    uint32_t  block_size   = BSP_FEATURE_FLASH_HP_DF_BLOCK_SIZE;
+    uint32_t  num_bytes    = p_request->num;
+    fsp_err_t size_err     = FSP_ERR_INVALID_SIZE;
+
+  #if (FLASH_HP_CFG_CODE_FLASH_PROGRAMMING_ENABLE == 1)
+    bool background_bank = false;
+
+    /* Writes and erases of the code flash bank that is not being executed from are also run in the background. */
+    if ((FLASH_HP_REQUEST_OP_BLANK_CHECK != p_request->op) &&
+        flash_hp_cf_bank_bgo_address(p_ctrl, p_request->flash_address))
+    {
+        background_bank = true;
+        region_start    = BSP_FEATURE_FLASH_HP_CF_DUAL_BANK_START;
+        region_end      = BSP_FEATURE_FLASH_HP_CF_DUAL_BANK_START + FLASH_HP_CF_BANK_SIZE;
+        write_size      = BSP_FEATURE_FLASH_HP_CF_WRITE_SIZE;
+        block_size      = flash_hp_cf_block_size(p_request->flash_address);
+    }
+  #endif
+
+    if (FLASH_HP_REQUEST_OP_ERASE == p_request->op)
+    {
+        FSP_ERROR_RETURN(!(p_request->flash_address & (block_size - 1U)), FSP_ERR_INVALID_ADDRESS);
+        num_bytes = p_request->num * block_size;
+        size_err  = FSP_ERR_INVALID_BLOCKS;
+  #if (FLASH_HP_CFG_CODE_FLASH_PROGRAMMING_ENABLE == 1)
+        if (background_bank)
+        {
+            num_bytes = flash_hp_cf_erase_size(p_request->flash_address, p_request->num);
+        }
+  #endif
+    }
+    else if (FLASH_HP_REQUEST_OP_WRITE == p_request->op)
+    {
+        FSP_ERROR_RETURN(!(p_request->flash_address & (write_size - 1U)), FSP_ERR_INVALID_ADDRESS);
+        FSP_ERROR_RETURN(!(p_request->num & (write_size - 1U)), FSP_ERR_INVALID_SIZE);
+    }
+    else
+    {
+        FSP_ASSERT(FLASH_HP_REQUEST_OP_BLANK_CHECK == p_request->op);
+    }
+
+    FSP_ERROR_RETURN(0U != p_request->num, size_err);
+    FSP_ERROR_RETURN((p_request->flash_address >= region_start) && (p_request->flash_address < region_end),
+                     FSP_ERR_INVALID_ADDRESS);
+    FSP_ERROR_RETURN(p_request->flash_address + num_bytes <= region_end, size_err);
+ #endif
+
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+
+    /* A request that is already linked into the queue must not be linked again. */
+    bool in_use = (FLASH_HP_REQUEST_STATUS_QUEUED == p_request->status) ||
+                  (FLASH_HP_REQUEST_STATUS_ACTIVE == p_request->status);
+    if (!in_use)
+    {
+        r_flash_hp_request_insert(p_ctrl, p_request, false);
+    }
+
+    FSP_CRITICAL_SECTION_EXIT;
+
+    FSP_ERROR_RETURN(!in_use, FSP_ERR_IN_USE);
+
+    /* Start the request now if the flash is idle. Otherwise it is started when the current operation completes. */
+    r_flash_hp_request_dispatch(p_ctrl);
+
+    return FSP_SUCCESS;
+#else
+
+    /* Eliminate warning if data flash programming is disabled. */
+    FSP_PARAMETER_NOT_USED(p_ctrl);
+    FSP_PARAMETER_NOT_USED(p_request);
+
+    return FSP_ERR_UNSUPPORTED;
+#endif
+}
+
 /*******************************************************************************************************************//**
  * @} (end addtogroup FLASH_HP)
  **********************************************************************************************************************/
@@ -1251,10 +1445,26 @@ static fsp_err_t flash_hp_cf_write (flash_hp_instance_ctrl_t * const p_ctrl)
 {
     fsp_err_t err = FSP_SUCCESS;
 
+    /* The option setting memory is not readable in P/E mode, so check for a background bank write first. */
+    bool background_bank = flash_hp_cf_bank_bgo_address(p_ctrl, p_ctrl->dest_end_address);
+
     /* Update Flash state and enter the respective Code or Data Flash P/E mode. If failure return error */
     err = flash_hp_enter_pe_cf_mode(p_ctrl);
     FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
 
+    /* The CPU keeps executing from the other bank, so the write can continue in the flash ready ISR. */
+    if (background_bank)
+    {
+        p_ctrl->current_operation    = FLASH_OPERATION_CF_BGO_WRITE;
+        p_ctrl->verify_start_address = p_ctrl->dest_end_address;
+
+        R_BSP_IrqEnable(p_ctrl->p_cfg->irq);
+        R_BSP_IrqEnable(p_ctrl->p_cfg->err_irq);
+
+        /* Errors will be handled in the error interrupt when using BGO. */
+        return flash_hp_write_data(p_ctrl, BSP_FEATURE_FLASH_HP_CF_WRITE_SIZE, 0);
+    }
+
     /* Iterate through the number of data bytes */
     while (p_ctrl->operations_remaining && (err == FSP_SUCCESS))
     {
@@ -1377,6 +1587,12 @@ static fsp_err_t r_flash_hp_write_bc_parameter_checking (flash_hp_instance_ctrl_
         FSP_ERROR_RETURN(flash_address + num_bytes <= BSP_ROM_SIZE_BYTES, FSP_ERR_INVALID_SIZE);
         write_size = BSP_FEATURE_FLASH_HP_CF_WRITE_SIZE;
     }
+    else if (flash_hp_cf_bank_bgo_address(p_ctrl, flash_address))
+    {
+        FSP_ERROR_RETURN(flash_address + num_bytes <= (BSP_FEATURE_FLASH_HP_CF_DUAL_BANK_START + FLASH_HP_CF_BANK_SIZE),
+                         FSP_ERR_INVALID_SIZE);
+        write_size = BSP_FEATURE_FLASH_HP_CF_WRITE_SIZE;
+    }
     else
  #endif
     {
@@ -1697,6 +1913,9 @@ static fsp_err_t flash_hp_cf_erase (flash_hp_instance_ctrl_t * p_ctrl, uint32_t
     uint32_t wait_count;
     uint32_t block_size;
 
+    /* The option setting memory is not readable in P/E mode, so check for a background bank erase first. */
+    bool background_bank = flash_hp_cf_bank_bgo_address(p_ctrl, block_address);
+
     err = flash_hp_enter_pe_cf_mode(p_ctrl);
     FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
 
@@ -1705,7 +1924,7 @@ static fsp_err_t flash_hp_cf_erase (flash_hp_instance_ctrl_t * p_ctrl, uint32_t
 
     while (p_ctrl->operations_remaining && (FSP_SUCCESS == err))
     {
-        if (p_ctrl->source_start_address < BSP_FEATURE_FLASH_HP_CF_REGION0_SIZE)
+        if ((p_ctrl->source_start_address & FLASH_HP_CF_BANK_OFFSET_MASK) < BSP_FEATURE_FLASH_HP_CF_REGION0_SIZE)
         {
             wait_count = p_ctrl->timeout_erase_cf_small_block;
             block_size = BSP_FEATURE_FLASH_HP_CF_REGION0_BLOCK_SIZE;
@@ -1716,6 +1935,18 @@ static fsp_err_t flash_hp_cf_erase (flash_hp_instance_ctrl_t * p_ctrl, uint32_t
             block_size = BSP_FEATURE_FLASH_HP_CF_REGION1_BLOCK_SIZE;
         }
 
+        /* The CPU keeps executing from the other bank, so the erase can continue in the flash ready ISR. */
+        if (background_bank)
+        {
+            p_ctrl->current_operation = FLASH_OPERATION_CF_BGO_ERASE;
+
+            R_BSP_IrqEnable(p_ctrl->p_cfg->irq);
+            R_BSP_IrqEnable(p_ctrl->p_cfg->err_irq);
+
+            /* Errors will be handled in the error interrupt when using BGO. */
+            return flash_hp_erase_block(p_ctrl, block_size, 0);
+        }
+
         err = flash_hp_erase_block(p_ctrl, block_size, wait_count);
 
         /* Check the status of the erase operation. */
@@ -2238,6 +2469,167 @@ static fsp_err_t flash_hp_configuration_area_write (flash_hp_instance_ctrl_t * p
     return FSP_SUCCESS;
 }
 
+
+/*******************************************************************************************************************//**
+ * Makes the other code flash bank the startup bank after the next reset. The bank is checked for an image first and
+ * BANKSEL is read back after it has been written.
+ *
+ * @param[in]  p_ctrl                 Pointer to the instance control block
+ *
+ * @retval     FSP_SUCCESS            BANKSEL updated, the banks swap on the next reset.
+ * @retval     FSP_ERR_UNSUPPORTED    The device is not in dual bank mode.
+ * @retval     FSP_ERR_INVALID_STATE  The other bank does not hold a vector table for an image linked at address 0.
+ * @retval     FSP_ERR_PE_FAILURE     Failed to enter or exit Code Flash P/E mode.
+ * @retval     FSP_ERR_TIMEOUT        Timed out waiting for the FCU to become ready.
+ * @retval     FSP_ERR_WRITE_FAILED   BANKSEL was not updated.
+ * @retval     FSP_ERR_CMD_LOCKED     FCU is in locked state, typically as a result of having received an illegal
+ *                                    command.
+ **********************************************************************************************************************/
+static fsp_err_t flash_hp_bank_swap (flash_hp_instance_ctrl_t * p_ctrl)
+{
+ #if BSP_FEATURE_FLASH_HP_SUPPORTS_DUAL_BANK
+    uint32_t dualsel = *((uint32_t *) FLASH_HP_FCU_CONFIG_SET_DUAL_MODE);
+    FSP_ERROR_RETURN(FLASH_HP_DUALSEL_BANKMD_DUAL == (dualsel & FLASH_HP_DUALSEL_BANKMD_MASK), FSP_ERR_UNSUPPORTED);
+
+    /* After the swap the other bank is mapped at address 0, so its initial stack pointer must be programmed and its
+     * reset vector must be a Thumb address inside the bank. */
+    uint32_t const * p_vector_table = (uint32_t const *) BSP_FEATURE_FLASH_HP_CF_DUAL_BANK_START;
+    uint32_t         reset_vector   = p_vector_table[1];
+    FSP_ERROR_RETURN((UINT32_MAX != p_vector_table[0]) && (reset_vector & 1U) &&
+                     (reset_vector < FLASH_HP_CF_BANK_SIZE),
+                     FSP_ERR_INVALID_STATE);
+
+    /* Invert BANKSWP to select the other bank. The remaining bits of BANKSEL are written back unchanged. */
+    uint32_t banksel = *((uint32_t *) FLASH_HP_FCU_CONFIG_SET_BANK_MODE) ^ FLASH_HP_BANKSEL_BANKSWP_MASK;
+
+    memset(g_configuration_area_data, UINT8_MAX, sizeof(g_configuration_area_data));
+    g_configuration_area_data[0] = (uint16_t) banksel;
+    g_configuration_area_data[1] = (uint16_t) (banksel >> 16U);
+
+    fsp_err_t err = flash_hp_enter_pe_cf_mode(p_ctrl);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+    err = flash_hp_configuration_area_write(p_ctrl, FLASH_HP_FCU_CONFIG_SET_BANK_MODE);
+
+    err = flash_hp_check_errors(err, 0, FSP_ERR_WRITE_FAILED);
+
+    /* Return to read mode*/
+    fsp_err_t pe_exit_err = flash_hp_pe_mode_exit();
+
+    if (FSP_SUCCESS == err)
+    {
+        err = pe_exit_err;
+    }
+
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+    /* Verify the new bank selection was stored. */
+    FSP_ERROR_RETURN(banksel == *((uint32_t *) FLASH_HP_FCU_CONFIG_SET_BANK_MODE), FSP_ERR_WRITE_FAILED);
+
+    return FSP_SUCCESS;
+ #else
+    FSP_PARAMETER_NOT_USED(p_ctrl);
+
+    return FSP_ERR_UNSUPPORTED;
+ #endif
+}
+
+/*******************************************************************************************************************//**
+ * Checks whether an address is in the code flash bank that is not being executed from. In dual bank mode that bank
+ * can be programmed while the CPU keeps executing from the other bank, so writes and erases to it are run in the
+ * background when BGO is enabled. Must be called while the flash is in read mode.
+ *
+ * @param[in]  p_ctrl      Pointer to the instance control block
+ * @param[in]  address     Address to check
+ *
+ * @retval     true        The address can be programmed in the background.
+ * @retval     false       The address is not in the background bank, or dual bank mode or BGO is not enabled.
+ **********************************************************************************************************************/
+static bool flash_hp_cf_bank_bgo_address (flash_hp_instance_ctrl_t * const p_ctrl, uint32_t address)
+{
+ #if BSP_FEATURE_FLASH_HP_SUPPORTS_DUAL_BANK
+    uint32_t dualsel = *((uint32_t *) FLASH_HP_FCU_CONFIG_SET_DUAL_MODE);
+
+    return p_ctrl->p_cfg->data_flash_bgo &&
+           (FLASH_HP_DUALSEL_BANKMD_DUAL == (dualsel & FLASH_HP_DUALSEL_BANKMD_MASK)) &&
+           (address >= BSP_FEATURE_FLASH_HP_CF_DUAL_BANK_START) &&
+           (address < (BSP_FEATURE_FLASH_HP_CF_DUAL_BANK_START + FLASH_HP_CF_BANK_SIZE));
+ #else
+    FSP_PARAMETER_NOT_USED(p_ctrl);
+    FSP_PARAMETER_NOT_USED(address);
+
+    return false;
+ #endif
+}
+
+/*******************************************************************************************************************//**
+ * Compares a completed background bank write with its source. Must be called after returning to read mode, which
+ * also invalidates the flash cache.
+ *
+ * @param[in]  p_ctrl      Pointer to the instance control block
+ *
+ * @retval     true        The flash contents match the source.
+ * @retval     false       The flash contents differ from the source.
+ **********************************************************************************************************************/
+static bool flash_hp_cf_bank_verify (flash_hp_instance_ctrl_t * const p_ctrl)
+{
+    /* The source and destination addresses have been advanced past the end of the write. */
+    uint32_t num_bytes = p_ctrl->dest_end_address - p_ctrl->verify_start_address;
+
+    return 0 == memcmp((void const *) p_ctrl->verify_start_address,
+                       (void const *) (p_ctrl->source_start_address - num_bytes),
+                       num_bytes);
+}
+
+/*******************************************************************************************************************//**
+ * Gets the size of the code flash block at an address. In dual bank mode both banks start with the small blocks.
+ *
+ * @param[in]  address     Code flash address
+ *
+ * @return     Block size in bytes
+ **********************************************************************************************************************/
+static uint32_t flash_hp_cf_block_size (uint32_t address)
+{
+    if ((address & FLASH_HP_CF_BANK_OFFSET_MASK) < BSP_FEATURE_FLASH_HP_CF_REGION0_SIZE)
+    {
+        return BSP_FEATURE_FLASH_HP_CF_REGION0_BLOCK_SIZE;
+    }
+
+    return BSP_FEATURE_FLASH_HP_CF_REGION1_BLOCK_SIZE;
+}
+
+ #if (FLASH_HP_CFG_PARAM_CHECKING_ENABLE == 1)
+
+/*******************************************************************************************************************//**
+ * Gets the number of bytes covered by erasing code flash blocks, taking the change from small to large blocks into
+ * account.
+ *
+ * @param[in]  block_address   Start address of the first block
+ * @param[in]  num_blocks      Number of blocks
+ *
+ * @return     Number of bytes erased
+ **********************************************************************************************************************/
+static uint32_t flash_hp_cf_erase_size (uint32_t block_address, uint32_t num_blocks)
+{
+    uint32_t offset         = block_address & FLASH_HP_CF_BANK_OFFSET_MASK;
+    uint32_t region0_blocks = 0U;
+
+    if (offset < BSP_FEATURE_FLASH_HP_CF_REGION0_SIZE)
+    {
+        region0_blocks = (BSP_FEATURE_FLASH_HP_CF_REGION0_SIZE - offset) / BSP_FEATURE_FLASH_HP_CF_REGION0_BLOCK_SIZE;
+    }
+
+    if (num_blocks <= region0_blocks)
+    {
+        return num_blocks * BSP_FEATURE_FLASH_HP_CF_REGION0_BLOCK_SIZE;
+    }
+
+    return (region0_blocks * BSP_FEATURE_FLASH_HP_CF_REGION0_BLOCK_SIZE) +
+           ((num_blocks - region0_blocks) * BSP_FEATURE_FLASH_HP_CF_REGION1_BLOCK_SIZE);
+}
+
+ #endif
+
 #endif
 
 /** If BGO is being used then we require both interrupts to be enabled (RDY and ERR). If either one
@@ -2296,8 +2688,24 @@ void fcu_fiferr_isr (void)
     /* Clear the Error Interrupt. */
     R_BSP_IrqStatusClear(irq);
 
-    /* Call the user callback. */
-    r_flash_hp_call_callback(p_ctrl, event);
+#if (FLASH_HP_CFG_DATA_FLASH_PROGRAMMING_ENABLE == 1)
+    if (NULL != p_ctrl->p_request_active)
+    {
+        /* Fail the queued request that caused the error. */
+        r_flash_hp_request_complete(p_ctrl, event);
+    }
+    else
+#endif
+    {
+        /* Call the user callback. */
+        r_flash_hp_call_callback(p_ctrl, event);
+    }
+
+#if (FLASH_HP_CFG_DATA_FLASH_PROGRAMMING_ENABLE == 1)
+
+    /* Continue with the next queued request. */
+    r_flash_hp_request_dispatch(p_ctrl);
+#endif
 
     /* Restore context if RTOS is used */
     FSP_CONTEXT_RESTORE
@@ -2329,17 +2737,29 @@ void fcu_frdyi_isr (void)
      * subsequent to the reset. We want to ignore that */
 
     /* Continue the current operation. If unknown operation set callback event to failure. */
-    if (FLASH_OPERATION_DF_BGO_WRITE == p_ctrl->current_operation)
+    if ((FLASH_OPERATION_DF_BGO_WRITE == p_ctrl->current_operation) ||
+        (FLASH_OPERATION_CF_BGO_WRITE == p_ctrl->current_operation))
     {
         /* If there are still bytes to write */
         if (p_ctrl->operations_remaining)
         {
-            fsp_err_t err = flash_hp_write_data(p_ctrl, BSP_FEATURE_FLASH_HP_DF_WRITE_SIZE, 0);
+#if (FLASH_HP_CFG_DATA_FLASH_PROGRAMMING_ENABLE == 1)
 
-            if (FSP_SUCCESS != err)
+            /* Yield to a higher priority request between programming units. */
+            if (!r_flash_hp_request_preempt(p_ctrl))
+#endif
             {
-                flash_hp_reset(p_ctrl);
-                event = FLASH_EVENT_ERR_FAILURE;
+                uint32_t write_size = (FLASH_OPERATION_CF_BGO_WRITE == p_ctrl->current_operation) ?
+                                      BSP_FEATURE_FLASH_HP_CF_WRITE_SIZE : BSP_FEATURE_FLASH_HP_DF_WRITE_SIZE;
+
+                fsp_err_t err = flash_hp_write_data(p_ctrl, write_size, 0);
+
+                if (FSP_SUCCESS != err)
+                {
+                    flash_hp_reset(p_ctrl);
+                    event               = FLASH_EVENT_ERR_FAILURE;
+                    operation_completed = true;
+                }
             }
         }
         /*Done writing all bytes*/
@@ -2349,11 +2769,27 @@ void fcu_frdyi_isr (void)
             operation_completed = true;
         }
     }
-    else if ((FLASH_OPERATION_DF_BGO_ERASE == p_ctrl->current_operation))
+    else if ((FLASH_OPERATION_DF_BGO_ERASE == p_ctrl->current_operation) ||
+             (FLASH_OPERATION_CF_BGO_ERASE == p_ctrl->current_operation))
     {
         if (p_ctrl->operations_remaining)
         {
-            flash_hp_erase_block(p_ctrl, BSP_FEATURE_FLASH_HP_DF_BLOCK_SIZE, 0);
+#if (FLASH_HP_CFG_DATA_FLASH_PROGRAMMING_ENABLE == 1)
+
+            /* Yield to a higher priority request between blocks. */
+            if (!r_flash_hp_request_preempt(p_ctrl))
+#endif
+            {
+                uint32_t block_size = BSP_FEATURE_FLASH_HP_DF_BLOCK_SIZE;
+#if (FLASH_HP_CFG_CODE_FLASH_PROGRAMMING_ENABLE == 1)
+                if (FLASH_OPERATION_CF_BGO_ERASE == p_ctrl->current_operation)
+                {
+                    block_size = flash_hp_cf_block_size(p_ctrl->source_start_address);
+                }
+#endif
+
+                flash_hp_erase_block(p_ctrl, block_size, 0);
+            }
         }
         /* If all blocks are erased*/
         else
@@ -2382,11 +2818,37 @@ void fcu_frdyi_isr (void)
         /* finished current operation. Exit P/E mode*/
         flash_hp_pe_mode_exit();
 
+#if (FLASH_HP_CFG_CODE_FLASH_PROGRAMMING_ENABLE == 1)
+
+        /* Back in read mode, so a background bank write can now be read back and verified. */
+        if ((FLASH_OPERATION_CF_BGO_WRITE == p_ctrl->current_operation) && (FLASH_EVENT_WRITE_COMPLETE == event) &&
+            !flash_hp_cf_bank_verify(p_ctrl))
+        {
+            event = FLASH_EVENT_ERR_FAILURE;
+        }
+#endif
+
         /* Release lock and Set current state to Idle*/
         p_ctrl->current_operation = FLASH_OPERATION_NON_BGO;
 
-        /* Set data to identify callback to user, then call user callback. */
-        r_flash_hp_call_callback(p_ctrl, event);
+#if (FLASH_HP_CFG_DATA_FLASH_PROGRAMMING_ENABLE == 1)
+        if (NULL != p_ctrl->p_request_active)
+        {
+            /* Report the result to the owner of the queued request. */
+            r_flash_hp_request_complete(p_ctrl, event);
+        }
+        else
+#endif
+        {
+            /* Set data to identify callback to user, then call user callback. */
+            r_flash_hp_call_callback(p_ctrl, event);
+        }
+
+#if (FLASH_HP_CFG_DATA_FLASH_PROGRAMMING_ENABLE == 1)
+
+        /* Start the next queued request. */
+        r_flash_hp_request_dispatch(p_ctrl);
+#endif
     }
 
     FSP_CONTEXT_RESTORE
@@ -2402,6 +2864,8 @@ static void r_flash_hp_call_callback (flash_hp_instance_ctrl_t * p_ctrl, flash_e
 {
     flash_callback_args_t args;
 
+    BSP_TRACE(FSP_IP_FCU, 0U, event, 0U);
+
     /* Store callback arguments in memory provided by user if available.  This allows callback arguments to be
      * stored in non-secure memory so they can be accessed by a non-secure callback function. */
     flash_callback_args_t * p_args = p_ctrl->p_callback_memory;
@@ -2446,6 +2910,207 @@ static void r_flash_hp_call_callback (flash_hp_instance_ctrl_t * p_ctrl, flash_e
     }
 }
 
+#if (FLASH_HP_CFG_DATA_FLASH_PROGRAMMING_ENABLE == 1)
+
+/*******************************************************************************************************************//**
+ * Links a request into the queue behind all requests of higher priority. A new request also goes behind requests of
+ * equal priority; a preempted request being resumed goes ahead of them. Must be called with interrupts masked.
+ *
+ * @param[in]     p_ctrl     Pointer to FLASH_HP instance control block
+ * @param[in]     p_request  Request to queue
+ * @param[in]     resume     true if the request was preempted and is resuming
+ **********************************************************************************************************************/
+static void r_flash_hp_request_insert (flash_hp_instance_ctrl_t * p_ctrl, flash_hp_request_t * p_request, bool resume)
+{
+    flash_hp_request_t ** pp_link = &p_ctrl->p_request_head;
+
+    while ((NULL != *pp_link) &&
+           (((*pp_link)->priority > p_request->priority) ||
+            (!resume && ((*pp_link)->priority == p_request->priority))))
+    {
+        pp_link = &(*pp_link)->p_next;
+    }
+
+    p_request->p_next = *pp_link;
+    p_request->status = FLASH_HP_REQUEST_STATUS_QUEUED;
+    *pp_link          = p_request;
+}
+
+/*******************************************************************************************************************//**
+ * Starts the request at the head of the queue if the flash is idle. A request that fails to start is completed with
+ * FLASH_EVENT_ERR_FAILURE and the next one is tried.
+ *
+ * @param[in]     p_ctrl     Pointer to FLASH_HP instance control block
+ **********************************************************************************************************************/
+static void r_flash_hp_request_dispatch (flash_hp_instance_ctrl_t * p_ctrl)
+{
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+
+    while ((NULL == p_ctrl->p_request_active) && (NULL != p_ctrl->p_request_head) &&
+           (FLASH_OPERATION_NON_BGO == p_ctrl->current_operation) &&
+           ((R_FACI_HP->FENTRYR & FLASH_HP_FENTRYR_PE_MODE_BITS) == 0x0000U))
+    {
+        flash_hp_request_t * p_request = p_ctrl->p_request_head;
+        fsp_err_t            err;
+
+        p_ctrl->p_request_head   = p_request->p_next;
+        p_ctrl->p_request_active = p_request;
+        p_request->status        = FLASH_HP_REQUEST_STATUS_ACTIVE;
+
+        if (FLASH_HP_REQUEST_OP_WRITE == p_request->op)
+        {
+            p_ctrl->operations_remaining = (p_request->num) >> 1; // Since two bytes will be written at a time
+            p_ctrl->source_start_address = p_request->src_address;
+            p_ctrl->dest_end_address     = p_request->flash_address;
+
+#if (FLASH_HP_CFG_CODE_FLASH_PROGRAMMING_ENABLE == 1)
+            if (flash_hp_cf_bank_bgo_address(p_ctrl, p_request->flash_address))
+            {
+                err = flash_hp_cf_write(p_ctrl);
+            }
+            else
+#endif
+            {
+                err = flash_hp_df_write(p_ctrl);
+            }
+        }
+        else if (FLASH_HP_REQUEST_OP_ERASE == p_request->op)
+        {
+#if (FLASH_HP_CFG_CODE_FLASH_PROGRAMMING_ENABLE == 1)
+            if (flash_hp_cf_bank_bgo_address(p_ctrl, p_request->flash_address))
+            {
+                err = flash_hp_cf_erase(p_ctrl, p_request->flash_address, p_request->num);
+            }
+            else
+#endif
+            {
+                err = flash_hp_df_erase(p_ctrl, p_request->flash_address, p_request->num);
+            }
+        }
+        else
+        {
+            flash_result_t blank_check_result;
+
+            err = flash_hp_df_blank_check(p_ctrl, p_request->flash_address, p_request->num, &blank_check_result);
+        }
+
+        if (FSP_SUCCESS != err)
+        {
+            /* Return the FCU to read mode and report the failure. */
+            flash_hp_reset(p_ctrl);
+            r_flash_hp_request_complete(p_ctrl, FLASH_EVENT_ERR_FAILURE);
+        }
+    }
+
+    FSP_CRITICAL_SECTION_EXIT;
+}
+
+/*******************************************************************************************************************//**
+ * Called from the FRDYI ISR between the commands of a queued write or erase. If a request of higher priority is
+ * waiting, the progress of the active request is saved in it, it is put back at the front of its priority and the
+ * waiting request is started.
+ *
+ * @param[in]     p_ctrl     Pointer to FLASH_HP instance control block
+ *
+ * @retval        true       The active request yielded; the caller must not continue it.
+ * @retval        false      The active operation should continue.
+ **********************************************************************************************************************/
+static bool r_flash_hp_request_preempt (flash_hp_instance_ctrl_t * p_ctrl)
+{
+    flash_hp_request_t * p_request = p_ctrl->p_request_active;
+    bool                 preempted = false;
+
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+
+    /* Only yield to strictly higher priorities so requests of equal priority complete in submission order. A
+     * background bank write is not split because it is verified as a whole on completion. */
+    if ((NULL != p_request) && (NULL != p_ctrl->p_request_head) &&
+        (p_ctrl->p_request_head->priority > p_request->priority) &&
+        (FLASH_OPERATION_CF_BGO_WRITE != p_ctrl->current_operation))
+    {
+        if (FLASH_OPERATION_DF_BGO_WRITE == p_ctrl->current_operation)
+        {
+            p_request->src_address   = p_ctrl->source_start_address;
+            p_request->flash_address = p_ctrl->dest_end_address;
+            p_request->num           = p_ctrl->operations_remaining << 1;
+        }
+        else
+        {
+            p_request->flash_address = p_ctrl->source_start_address;
+            p_request->num           = p_ctrl->operations_remaining;
+        }
+
+        /* The last command has completed, so the FCU can return to read mode before the next request starts. */
+        flash_hp_pe_mode_exit();
+        p_ctrl->current_operation = FLASH_OPERATION_NON_BGO;
+        p_ctrl->p_request_active  = NULL;
+
+        r_flash_hp_request_insert(p_ctrl, p_request, true);
+        r_flash_hp_request_dispatch(p_ctrl);
+
+        preempted = true;
+    }
+
+    FSP_CRITICAL_SECTION_EXIT;
+
+    return preempted;
+}
+
+/*******************************************************************************************************************//**
+ * Completes the active request and calls its callback.
+ *
+ * @param[in]     p_ctrl     Pointer to FLASH_HP instance control block
+ * @param[in]     event      Event code
+ **********************************************************************************************************************/
+static void r_flash_hp_request_complete (flash_hp_instance_ctrl_t * p_ctrl, flash_event_t event)
+{
+    flash_hp_request_t * p_request = p_ctrl->p_request_active;
+
+    /* Release the request before the callback so it can be submitted again from the callback. */
+    p_ctrl->p_request_active = NULL;
+    p_request->event         = event;
+    p_request->status        = FLASH_HP_REQUEST_STATUS_COMPLETE;
+
+    if (NULL != p_request->p_callback)
+    {
+        flash_callback_args_t args;
+
+        args.event     = event;
+        args.p_context = p_request->p_context;
+
+        p_request->p_callback(&args);
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Discards the active request and all queued requests without calling their callbacks.
+ *
+ * @param[in]     p_ctrl     Pointer to FLASH_HP instance control block
+ **********************************************************************************************************************/
+static void r_flash_hp_request_flush (flash_hp_instance_ctrl_t * p_ctrl)
+{
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+
+    if (NULL != p_ctrl->p_request_active)
+    {
+        p_ctrl->p_request_active->status = FLASH_HP_REQUEST_STATUS_IDLE;
+        p_ctrl->p_request_active         = NULL;
+    }
+
+    while (NULL != p_ctrl->p_request_head)
+    {
+        p_ctrl->p_request_head->status = FLASH_HP_REQUEST_STATUS_IDLE;
+        p_ctrl->p_request_head         = p_ctrl->p_request_head->p_next;
+    }
+
+    FSP_CRITICAL_SECTION_EXIT;
+}
+
+#endif
+
 /*******************************************************************************************************************//**
  * This function switches the peripheral to P/E mode for Data Flash.
  * @param[in]  p_ctrl              Pointer to the Flash control block.
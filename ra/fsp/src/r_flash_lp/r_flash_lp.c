@@ -138,6 +138,9 @@
 
 #define FLASH_LP_FPR_UNLOCK                           0xA5U
 
+/* Value used to pad partial programming units of a stream. Programming 0xFF leaves the flash erased. */
+#define FLASH_LP_STREAM_PAD_BYTE                      (0xFFU)
+
 /** The maximum timeout for commands is 100usec when FCLK is 16 MHz i.e. 1600 FCLK cycles.
  * Assuming worst case of ICLK at 240 MHz and FCLK at 4 MHz, and optimization set to max such that
  * each count decrement loop takes only 5 cycles, then ((240/4)*1600)/5 = 19200 */
@@ -225,6 +228,20 @@ static void r_flash_lp_reset(flash_lp_instance_ctrl_t * const p_ctrl) PLACE_IN_R
 
 static void r_flash_lp_write_fpmcr(uint8_t value) PLACE_IN_RAM_SECTION;
 
+static uint32_t r_flash_lp_stream_length(flash_lp_stream_t * const p_stream);
+
+static void r_flash_lp_stream_stage(flash_lp_stream_t * const p_stream, uint8_t const * const p_src,
+                                    uint32_t const num_bytes);
+
+static void r_flash_lp_stream_pad(flash_lp_stream_t * const p_stream, uint32_t const num_bytes);
+
+static void r_flash_lp_stream_advance(flash_lp_stream_t * const p_stream, uint32_t const num_bytes);
+
+static fsp_err_t r_flash_lp_stream_drain(flash_lp_instance_ctrl_t * const p_ctrl);
+
+static bool r_flash_lp_stream_bgo_continue(flash_lp_instance_ctrl_t * const p_ctrl,
+                                           flash_callback_args_t * const    p_cb_data);
+
 static fsp_err_t r_flash_lp_wait_for_ready(flash_lp_instance_ctrl_t * const p_ctrl,
                                            uint32_t                         timeout,
                                            uint32_t                         error_bits,
@@ -247,6 +264,8 @@ static fsp_err_t r_flash_lp_df_write(flash_lp_instance_ctrl_t * const p_ctrl,
                                      uint32_t                         dest_start_address,
                                      uint32_t                         num_bytes);
 
+static void r_flash_lp_stream_bgo_start(flash_lp_instance_ctrl_t * const p_ctrl);
+
 #endif
 
 #if (FLASH_LP_CFG_CODE_FLASH_PROGRAMMING_ENABLE == 1)
@@ -434,6 +453,8 @@ fsp_err_t R_FLASH_LP_Open (flash_ctrl_t * const p_api_ctrl, flash_cfg_t const *
     }
 
     p_ctrl->current_operation = FLASH_OPERATION_NON_BGO;
+    p_ctrl->stream.open       = false;
+    p_ctrl->stream.in_flight  = 0U;
 
     /* Check FCLK, calculate timeout values. */
     err = r_flash_lp_setup(p_ctrl);
@@ -884,6 +905,10 @@ fsp_err_t R_FLASH_LP_Reset (flash_ctrl_t * const p_api_ctrl)
     /* Reset the flash. */
     r_flash_lp_reset(p_ctrl);
 
+    /* Any staged stream data is discarded. */
+    p_ctrl->stream.open      = false;
+    p_ctrl->stream.in_flight = 0U;
+
     return err;
 }
 
@@ -924,6 +949,9 @@ fsp_err_t R_FLASH_LP_StartUpAreaSelect (flash_ctrl_t * const      p_api_ctrl,
     /* If the swap type is BTFLG and the operation is temporary there's nothing to do. */
     FSP_ASSERT(!((swap_type == FLASH_STARTUP_AREA_BTFLG) && (is_temporary == false)));
 
+    /* Dual bank mode is not available on MCUs with low power flash. */
+    FSP_ERROR_RETURN(FLASH_STARTUP_AREA_BANK_SWAP != swap_type, FSP_ERR_UNSUPPORTED);
+
     err = r_flash_lp_set_startup_area_boot(p_ctrl, swap_type, is_temporary);
 #else
 
@@ -1023,8 +1051,9 @@ fsp_err_t R_FLASH_LP_Close (flash_ctrl_t * const p_api_ctrl)
     FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
 #endif
 
-    /* Mark the control block as closed. */
-    p_ctrl->opened = 0;
+    /* Mark the control block as closed. Any staged stream data is discarded. */
+    p_ctrl->opened      = 0;
+    p_ctrl->stream.open = false;
 
     /* Disable the flash interrupt. */
     if (FSP_INVALID_VECTOR != p_ctrl->p_cfg->irq)
@@ -1075,6 +1104,248 @@ fsp_err_t R_FLASH_LP_VersionGet (fsp_version_t * const p_version)
     return FSP_SUCCESS;
 }
 
+/*******************************************************************************************************************//**
+ * Open a streaming write at the specified Code or Data Flash address.
+ *
+ * Data appended with R_FLASH_LP_StreamWrite() is staged in p_buffer and programmed in whole programming units, so
+ * neither the address nor the chunk lengths need to be aligned. If flash_address is not on a programming boundary the
+ * start of the first unit is padded with 0xFF. The area being streamed to must be erased.
+ *
+ * Data flash streams use BGO when it is enabled. p_buffer is then a ring buffer: new data is staged while earlier data
+ * is programmed in the background. Otherwise the buffer is programmed each time it fills. p_buffer must remain valid
+ * until the stream is flushed.
+ *
+ * @retval     FSP_SUCCESS               Stream opened.
+ * @retval     FSP_ERR_ASSERTION         NULL provided for p_ctrl or p_buffer, p_buffer is in code flash when streaming
+ *                                       to code flash, or buffer_size is not a non-zero multiple of the programming
+ *                                       size.
+ * @retval     FSP_ERR_NOT_OPEN          The Flash API is not Open.
+ * @retval     FSP_ERR_IN_USE            A stream is already open or the flash is busy.
+ * @retval     FSP_ERR_INVALID_ADDRESS   Invalid address was input.
+ **********************************************************************************************************************/
+fsp_err_t R_FLASH_LP_StreamOpen (flash_ctrl_t * const p_api_ctrl,
+                                 uint32_t const       flash_address,
+                                 uint8_t * const      p_buffer,
+                                 uint32_t const       buffer_size)
+{
+    flash_lp_instance_ctrl_t * p_ctrl = (flash_lp_instance_ctrl_t *) p_api_ctrl;
+
+#if (FLASH_LP_CFG_PARAM_CHECKING_ENABLE == 1)
+
+    /* Check parameters. If failure return error */
+    fsp_err_t err = r_flash_lp_write_read_bc_parameter_checking(p_ctrl, flash_address, 1U, false);
+    FSP_ERROR_RETURN((err == FSP_SUCCESS), err);
+    FSP_ASSERT(NULL != p_buffer);
+    FSP_ERROR_RETURN(!p_ctrl->stream.open, FSP_ERR_IN_USE);
+#endif
+
+    flash_lp_stream_t * p_stream = &p_ctrl->stream;
+
+    p_stream->unit        = BSP_FEATURE_FLASH_LP_DF_WRITE_SIZE;
+    p_stream->end_address = FLASH_LP_DF_START_ADDRESS + BSP_DATA_FLASH_SIZE_BYTES;
+    p_stream->bgo         = p_ctrl->p_cfg->data_flash_bgo;
+
+#if (FLASH_LP_CFG_CODE_FLASH_PROGRAMMING_ENABLE == 1)
+    if (flash_address < BSP_ROM_SIZE_BYTES)
+    {
+ #if (FLASH_LP_CFG_PARAM_CHECKING_ENABLE == 1)
+
+        /* The staging buffer is the write source. It will not be available in P/E mode if it is in code flash. */
+        FSP_ASSERT((uint32_t) p_buffer > BSP_ROM_SIZE_BYTES);
+ #endif
+
+        /* Code flash is always programmed in blocking mode. */
+        p_stream->unit        = BSP_FEATURE_FLASH_LP_CF_WRITE_SIZE;
+        p_stream->end_address = BSP_ROM_SIZE_BYTES;
+        p_stream->bgo         = false;
+    }
+#endif
+
+#if (FLASH_LP_CFG_PARAM_CHECKING_ENABLE == 1)
+
+    /* Writes never wrap around the end of the buffer, so it must hold a whole number of programming units. */
+    FSP_ASSERT((0U != buffer_size) && (0U == (buffer_size & (p_stream->unit - 1U))));
+#endif
+
+    p_stream->p_buffer      = p_buffer;
+    p_stream->buffer_size   = buffer_size;
+    p_stream->flash_address = flash_address & ~(p_stream->unit - 1U);
+    p_stream->next_address  = flash_address;
+    p_stream->head          = 0U;
+    p_stream->tail          = 0U;
+    p_stream->in_flight     = 0U;
+    p_stream->flush         = false;
+
+    /* Start the stream on a programming boundary. */
+    p_stream->count = flash_address - p_stream->flash_address;
+    r_flash_lp_stream_pad(p_stream, p_stream->count);
+
+    p_stream->open = true;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Append data to the stream opened with R_FLASH_LP_StreamOpen().
+ *
+ * Data is copied into the staging buffer, so p_src may be reused as soon as this function returns. Whole programming
+ * units are programmed as they become available. A partial unit at the end is held until more data is appended or the
+ * stream is flushed.
+ *
+ * In BGO mode a chunk is staged completely or not at all. If the staging buffer does not currently have room for it
+ * FSP_ERR_IN_USE is returned and the call can be retried once the data in progress has been programmed.
+ *
+ * @retval     FSP_SUCCESS               Data staged. In blocking mode every full buffer has been programmed.
+ * @retval     FSP_ERR_ASSERTION         NULL provided for p_ctrl or p_src.
+ * @retval     FSP_ERR_NOT_OPEN          The Flash API or the stream is not open.
+ * @retval     FSP_ERR_IN_USE            The stream is being flushed, or in BGO mode there is not enough room in the
+ *                                       staging buffer.
+ * @retval     FSP_ERR_INVALID_SIZE      The data would extend past the end of the flash area, or in BGO mode num_bytes
+ *                                       exceeds the size of the staging buffer.
+ * @retval     FSP_ERR_WRITE_FAILED      Status is indicating a Programming error. The stream is closed.
+ * @retval     FSP_ERR_TIMEOUT           Timed out waiting for FCU operation to complete. The stream is closed.
+ **********************************************************************************************************************/
+fsp_err_t R_FLASH_LP_StreamWrite (flash_ctrl_t * const  p_api_ctrl,
+                                  uint8_t const * const p_src,
+                                  uint32_t const        num_bytes)
+{
+    flash_lp_instance_ctrl_t * p_ctrl = (flash_lp_instance_ctrl_t *) p_api_ctrl;
+    fsp_err_t err = FSP_SUCCESS;
+
+#if (FLASH_LP_CFG_PARAM_CHECKING_ENABLE == 1)
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ASSERT(NULL != p_src);
+    FSP_ERROR_RETURN((FLASH_HP_OPEN == p_ctrl->opened), FSP_ERR_NOT_OPEN);
+    FSP_ERROR_RETURN(p_ctrl->stream.open, FSP_ERR_NOT_OPEN);
+    FSP_ERROR_RETURN(!p_ctrl->stream.flush, FSP_ERR_IN_USE);
+    FSP_ERROR_RETURN(p_ctrl->stream.next_address + num_bytes <= p_ctrl->stream.end_address, FSP_ERR_INVALID_SIZE);
+#endif
+
+    flash_lp_stream_t * p_stream = &p_ctrl->stream;
+
+#if (FLASH_LP_CFG_DATA_FLASH_PROGRAMMING_ENABLE == 1)
+    if (p_stream->bgo)
+    {
+        FSP_ERROR_RETURN(num_bytes <= p_stream->buffer_size, FSP_ERR_INVALID_SIZE);
+
+        /* The count only decreases while a write is in progress, so this check is safe outside the critical section. */
+        FSP_ERROR_RETURN(num_bytes <= p_stream->buffer_size - p_stream->count, FSP_ERR_IN_USE);
+
+        r_flash_lp_stream_stage(p_stream, p_src, num_bytes);
+
+        /* Start programming if the flash is idle. If a stream write is in progress the FRDYI interrupt continues with
+         * the new data. */
+        FSP_CRITICAL_SECTION_DEFINE;
+        FSP_CRITICAL_SECTION_ENTER;
+        p_stream->count += num_bytes;
+        r_flash_lp_stream_bgo_start(p_ctrl);
+        FSP_CRITICAL_SECTION_EXIT;
+
+        return FSP_SUCCESS;
+    }
+#endif
+
+    uint8_t const * p_data    = p_src;
+    uint32_t        remaining = num_bytes;
+
+    while (remaining > 0U)
+    {
+        uint32_t num_staged = p_stream->buffer_size - p_stream->count;
+        if (num_staged > remaining)
+        {
+            num_staged = remaining;
+        }
+
+        r_flash_lp_stream_stage(p_stream, p_data, num_staged);
+        p_stream->count += num_staged;
+        p_data          += num_staged;
+        remaining       -= num_staged;
+
+        /* Program the staging buffer each time it fills. */
+        if (p_stream->count == p_stream->buffer_size)
+        {
+            err = r_flash_lp_stream_drain(p_ctrl);
+            FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+        }
+    }
+
+    return err;
+}
+
+/*******************************************************************************************************************//**
+ * Program all data staged in the stream and close it. A partial programming unit at the end is padded with 0xFF.
+ *
+ * In BGO mode FLASH_EVENT_WRITE_COMPLETE is passed to the callback once the last staged byte has been programmed, or
+ * FLASH_EVENT_ERR_FAILURE if a write of the stream failed. If no data is staged the stream is closed immediately and
+ * the callback is not called.
+ *
+ * @retval     FSP_SUCCESS               Stream programmed and closed (blocking), or flush started (BGO).
+ * @retval     FSP_ERR_ASSERTION         NULL provided for p_ctrl.
+ * @retval     FSP_ERR_NOT_OPEN          The Flash API or the stream is not open.
+ * @retval     FSP_ERR_IN_USE            The stream is already being flushed or the flash is busy with another
+ *                                       operation.
+ * @retval     FSP_ERR_WRITE_FAILED      Status is indicating a Programming error. The stream is closed.
+ * @retval     FSP_ERR_TIMEOUT           Timed out waiting for FCU operation to complete. The stream is closed.
+ **********************************************************************************************************************/
+fsp_err_t R_FLASH_LP_StreamFlush (flash_ctrl_t * const p_api_ctrl)
+{
+    flash_lp_instance_ctrl_t * p_ctrl = (flash_lp_instance_ctrl_t *) p_api_ctrl;
+    fsp_err_t err = FSP_SUCCESS;
+
+#if (FLASH_LP_CFG_PARAM_CHECKING_ENABLE == 1)
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ERROR_RETURN((FLASH_HP_OPEN == p_ctrl->opened), FSP_ERR_NOT_OPEN);
+    FSP_ERROR_RETURN(p_ctrl->stream.open, FSP_ERR_NOT_OPEN);
+    FSP_ERROR_RETURN(!p_ctrl->stream.flush, FSP_ERR_IN_USE);
+#endif
+
+    flash_lp_stream_t * p_stream = &p_ctrl->stream;
+
+    /* Complete the last programming unit. The buffer holds whole units, so the padding always fits. */
+    uint32_t pad = (p_stream->unit - (p_stream->count & (p_stream->unit - 1U))) & (p_stream->unit - 1U);
+
+#if (FLASH_LP_CFG_DATA_FLASH_PROGRAMMING_ENABLE == 1)
+    if (p_stream->bgo)
+    {
+        FSP_CRITICAL_SECTION_DEFINE;
+        FSP_CRITICAL_SECTION_ENTER;
+
+        /* The flash is in use by an operation other than this stream. */
+        if ((0U == p_stream->in_flight) && (FLASH_LP_PRV_FENTRYR & FLASH_LP_FENTRYR_PE_MODE_BITS))
+        {
+            FSP_CRITICAL_SECTION_EXIT;
+
+            return FSP_ERR_IN_USE;
+        }
+
+        r_flash_lp_stream_pad(p_stream, pad);
+        p_stream->count += pad;
+        p_stream->flush  = true;
+
+        if (0U == p_stream->count)
+        {
+            p_stream->open = false;
+        }
+        else
+        {
+            /* The FRDYI interrupt reports completion once the staged data has been programmed. */
+            r_flash_lp_stream_bgo_start(p_ctrl);
+        }
+
+        FSP_CRITICAL_SECTION_EXIT;
+
+        return FSP_SUCCESS;
+    }
+#endif
+
+    r_flash_lp_stream_pad(p_stream, pad);
+    p_stream->count += pad;
+    err              = r_flash_lp_stream_drain(p_ctrl);
+    p_stream->open   = false;
+
+    return err;
+}
+
 /*******************************************************************************************************************//**
  * @} (end addtogroup FLASH_LP)
  **********************************************************************************************************************/
@@ -1441,6 +1712,34 @@ static fsp_err_t r_flash_lp_df_write (flash_lp_instance_ctrl_t * const p_ctrl,
     return err;
 }
 
+/*******************************************************************************************************************//**
+ * Start a Data Flash BGO write of the staged stream data if the flash is idle. Must be called with the flash interrupt
+ * masked.
+ *
+ * @param[in]  p_ctrl  Pointer to the Flash control block
+ **********************************************************************************************************************/
+static void r_flash_lp_stream_bgo_start (flash_lp_instance_ctrl_t * const p_ctrl)
+{
+    flash_lp_stream_t * p_stream = &p_ctrl->stream;
+
+    /* A stream write in progress picks up the new data when it completes. Another operation in progress leaves the data
+     * staged until the next call to R_FLASH_LP_StreamWrite() or R_FLASH_LP_StreamFlush(). */
+    if ((0U != p_stream->in_flight) || (FLASH_LP_PRV_FENTRYR & FLASH_LP_FENTRYR_PE_MODE_BITS))
+    {
+        return;
+    }
+
+    uint32_t length = r_flash_lp_stream_length(p_stream);
+    if (0U != length)
+    {
+        p_stream->in_flight = length;
+        (void) r_flash_lp_df_write(p_ctrl,
+                                   (uint32_t) &p_stream->p_buffer[p_stream->tail],
+                                   p_stream->flash_address,
+                                   length);
+    }
+}
+
 #endif
 
 #if (FLASH_LP_CFG_CODE_FLASH_PROGRAMMING_ENABLE == 1)
@@ -1957,6 +2256,186 @@ static inline bool r_flash_lp_frdyi_df_bgo_blankcheck (flash_lp_instance_ctrl_t
     return true;
 }
 
+/*******************************************************************************************************************//**
+ * Get the number of staged stream bytes that can be programmed with one write.
+ *
+ * @param[in]  p_stream  Pointer to the stream state
+ *
+ * @return     Number of bytes, a multiple of the programming unit. Writes never wrap around the end of the buffer.
+ **********************************************************************************************************************/
+static uint32_t r_flash_lp_stream_length (flash_lp_stream_t * const p_stream)
+{
+    uint32_t length = p_stream->count;
+
+    if (length > p_stream->buffer_size - p_stream->tail)
+    {
+        length = p_stream->buffer_size - p_stream->tail;
+    }
+
+    /* A partial unit at the end is held until more data is staged or the stream is flushed. */
+    return length & ~(p_stream->unit - 1U);
+}
+
+/*******************************************************************************************************************//**
+ * Copy data into the stream staging buffer. The caller updates the staged byte count.
+ *
+ * @param[in]  p_stream   Pointer to the stream state
+ * @param[in]  p_src      Data to stage
+ * @param[in]  num_bytes  Number of bytes to stage. Must not exceed the free space in the buffer.
+ **********************************************************************************************************************/
+static void r_flash_lp_stream_stage (flash_lp_stream_t * const p_stream, uint8_t const * const p_src,
+                                     uint32_t const num_bytes)
+{
+    uint32_t first = p_stream->buffer_size - p_stream->head;
+
+    if (first > num_bytes)
+    {
+        first = num_bytes;
+    }
+
+    memcpy(&p_stream->p_buffer[p_stream->head], p_src, first);
+    memcpy(&p_stream->p_buffer[0], &p_src[first], num_bytes - first);
+
+    p_stream->head += num_bytes;
+    if (p_stream->head >= p_stream->buffer_size)
+    {
+        p_stream->head -= p_stream->buffer_size;
+    }
+
+    p_stream->next_address += num_bytes;
+}
+
+/*******************************************************************************************************************//**
+ * Stage padding bytes to complete a programming unit. The caller updates the staged byte count.
+ *
+ * @param[in]  p_stream   Pointer to the stream state
+ * @param[in]  num_bytes  Number of padding bytes. Always less than one programming unit, so they never wrap.
+ **********************************************************************************************************************/
+static void r_flash_lp_stream_pad (flash_lp_stream_t * const p_stream, uint32_t const num_bytes)
+{
+    memset(&p_stream->p_buffer[p_stream->head], FLASH_LP_STREAM_PAD_BYTE, num_bytes);
+    p_stream->head += num_bytes;
+}
+
+/*******************************************************************************************************************//**
+ * Release programmed bytes from the stream staging buffer.
+ *
+ * @param[in]  p_stream   Pointer to the stream state
+ * @param[in]  num_bytes  Number of bytes programmed
+ **********************************************************************************************************************/
+static void r_flash_lp_stream_advance (flash_lp_stream_t * const p_stream, uint32_t const num_bytes)
+{
+    p_stream->tail += num_bytes;
+    if (p_stream->tail == p_stream->buffer_size)
+    {
+        p_stream->tail = 0U;
+    }
+
+    p_stream->flash_address += num_bytes;
+    p_stream->count         -= num_bytes;
+}
+
+/*******************************************************************************************************************//**
+ * Program all whole programming units staged in the stream in blocking mode. The stream is closed on failure.
+ *
+ * @param[in]  p_ctrl                Pointer to the Flash control block
+ *
+ * @retval     FSP_SUCCESS           Staged data successfully written.
+ * @retval     FSP_ERR_WRITE_FAILED  Status is indicating a Programming error for the requested operation.
+ * @retval     FSP_ERR_TIMEOUT       Timed out waiting for the Flash sequencer to become ready.
+ **********************************************************************************************************************/
+static fsp_err_t r_flash_lp_stream_drain (flash_lp_instance_ctrl_t * const p_ctrl)
+{
+    flash_lp_stream_t * p_stream = &p_ctrl->stream;
+    fsp_err_t           err      = FSP_SUCCESS;
+    uint32_t            length   = r_flash_lp_stream_length(p_stream);
+
+    p_ctrl->current_operation = FLASH_OPERATION_NON_BGO;
+
+    while ((0U != length) && (FSP_SUCCESS == err))
+    {
+        uint32_t src_address = (uint32_t) &p_stream->p_buffer[p_stream->tail];
+
+#if (FLASH_LP_CFG_CODE_FLASH_PROGRAMMING_ENABLE == 1)
+        if (p_stream->flash_address < BSP_ROM_SIZE_BYTES)
+        {
+            err = r_flash_lp_cf_write(p_ctrl, src_address, p_stream->flash_address, length);
+        }
+        else
+#endif
+        {
+#if (FLASH_LP_CFG_DATA_FLASH_PROGRAMMING_ENABLE == 1)
+            err = r_flash_lp_df_write(p_ctrl, src_address, p_stream->flash_address, length);
+#else
+            FSP_PARAMETER_NOT_USED(src_address);
+#endif
+        }
+
+        r_flash_lp_stream_advance(p_stream, length);
+        length = r_flash_lp_stream_length(p_stream);
+    }
+
+    if (FSP_SUCCESS != err)
+    {
+        p_stream->open = false;
+    }
+
+    return err;
+}
+
+/*******************************************************************************************************************//**
+ * Handle the completion of a Data Flash BGO write started by the stream. If more whole programming units are staged
+ * the next write is started without leaving P/E mode.
+ *
+ * @param[in]  p_ctrl     Pointer to the Flash control block
+ * @param[in]  p_cb_data  Pointer to the Flash callback event structure.
+ *
+ * @retval     true       When the stream has been flushed or an error has occurred.
+ **********************************************************************************************************************/
+static bool r_flash_lp_stream_bgo_continue (flash_lp_instance_ctrl_t * const p_ctrl,
+                                            flash_callback_args_t * const    p_cb_data)
+{
+    flash_lp_stream_t * p_stream = &p_ctrl->stream;
+
+    uint32_t programmed = p_stream->in_flight;
+    p_stream->in_flight = 0U;
+
+    if (FLASH_EVENT_ERR_FAILURE == p_cb_data->event)
+    {
+        p_stream->open = false;
+
+        return true;
+    }
+
+    r_flash_lp_stream_advance(p_stream, programmed);
+
+    uint32_t length = r_flash_lp_stream_length(p_stream);
+    if (0U != length)
+    {
+        p_stream->in_flight          = length;
+        p_ctrl->source_start_address = (uint32_t) &p_stream->p_buffer[p_stream->tail];
+        p_ctrl->dest_end_address     = p_stream->flash_address;
+        p_ctrl->operations_remaining = length;
+
+        r_flash_lp_df_write_operation(p_ctrl->source_start_address, p_ctrl->dest_end_address);
+
+        return false;
+    }
+
+    if (p_stream->flush)
+    {
+        /* Report FLASH_EVENT_WRITE_COMPLETE for the whole stream. */
+        p_stream->open = false;
+
+        return true;
+    }
+
+    /* Wait in read mode for more data to be staged. */
+    r_flash_lp_pe_mode_exit(p_ctrl);
+
+    return false;
+}
+
 /*******************************************************************************************************************//**
  * FLASH ready interrupt routine.
  *
@@ -1982,6 +2461,12 @@ void fcu_frdyi_isr (void)
     if (FLASH_OPERATION_DF_BGO_WRITE == p_ctrl->current_operation)
     {
         operation_completed = r_flash_lp_frdyi_df_bgo_write(p_ctrl, &cb_data);
+
+        /* A completed stream write continues with the next staged data and only reports the end of the stream. */
+        if (operation_completed && (0U != p_ctrl->stream.in_flight))
+        {
+            operation_completed = r_flash_lp_stream_bgo_continue(p_ctrl, &cb_data);
+        }
     }
     else if ((FLASH_OPERATION_DF_BGO_ERASE == p_ctrl->current_operation))
     {
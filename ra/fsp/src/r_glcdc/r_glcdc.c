@@ -159,6 +159,10 @@
 #define GLCDC_PRV_SYSCNT_DTCTEN_INIT                   (6U)
 #define GLCDC_PRV_SYSCNT_INTEN_INIT                    (7U)
 
+#define GLCDC_PRV_GAMMA_BLOCK_NUM                      (3U)
+#define GLCDC_PRV_SHADOW_BRIGHTNESS_CONTRAST           (1U << 0)
+#define GLCDC_PRV_SHADOW_GAMMA                         (1U << 1)
+
 /***********************************************************************************************************************
  * Typedef definitions
  **********************************************************************************************************************/
@@ -189,6 +193,21 @@ typedef struct st_recalculated_param
     uint32_t base_address;
 } glcdc_recalculated_param_t;
 
+/* Range of CLUT entries [start, end) to be written to the hardware, empty when start >= end */
+typedef struct st_glcdc_clut_range
+{
+    uint32_t start;
+    uint32_t end;
+} glcdc_clut_range_t;
+
+/* Register image of one gamma correction block */
+typedef struct st_glcdc_gamma_regs
+{
+    uint32_t lut[DISPLAY_GAMMA_CURVE_ELEMENT_NUM / 2];
+    uint32_t area[DISPLAY_GAMMA_CURVE_ELEMENT_NUM / 3];
+    uint32_t gam_sw;
+} glcdc_gamma_regs_t;
+
 /***********************************************************************************************************************
  * Private function prototypes
  **********************************************************************************************************************/
@@ -221,6 +240,8 @@ static fsp_err_t r_glcdc_open_param_check(display_cfg_t const * const p_cfg);
 
 static fsp_err_t r_glcdc_param_check_brightness(display_brightness_t const * const p_brightness);
 
+static fsp_err_t r_glcdc_param_check_gamma(display_gamma_correction_t const * const p_gamma);
+
  #endif
 
 #endif
@@ -244,10 +265,22 @@ static void r_glcdc_contrast_correction(glcdc_instance_ctrl_t const * const p_ct
 
 static void r_glcdc_color_correction_order(display_cfg_t const * const p_cfg);
 
-static void r_glcdc_gamma_correction(display_cfg_t const * const p_cfg);
+static void r_glcdc_gamma_correction(display_gamma_correction_t const * const p_gamma);
+
+static void r_glcdc_gamma_write(void);
+
+static void r_glcdc_correction_commit(glcdc_instance_ctrl_t const * const p_ctrl);
 
 #endif
 
+static void r_glcdc_clut_dirty_set(display_frame_layer_t layer, uint32_t start, uint32_t end);
+
+static void r_glcdc_clut_commit(display_frame_layer_t layer);
+
+static void r_glcdc_shadow_unlock(glcdc_instance_ctrl_t const * const p_ctrl);
+
+static void r_glcdc_shadow_commit(glcdc_instance_ctrl_t const * const p_ctrl);
+
 /***********************************************************************************************************************
  * Private global variables
  **********************************************************************************************************************/
@@ -296,8 +329,30 @@ void glcdc_underflow_2_isr(void);
 static uint32_t          g_fade_pending[2] = {false, false};
 static volatile uint32_t g_frame_ctr       = 0;
 
-/* Tracks when an edited CLUT has been latched in */
-static volatile bool g_clut_data_latched[2] = {true, true};
+/* CLUT shadow tables. R_GLCDC_ClutUpdate and R_GLCDC_ClutEdit only write here; the line detect ISR (raised in the
+ * vertical blanking period) copies the changed entries into the CLUT plane not in use and selects it for the next
+ * frame. g_clut_stale holds the entries the plane not in use missed at the previous commit. */
+static uint32_t           g_clut_shadow[2][GLCDC_PRV_CLUT_ENTRY_SIZE];
+static glcdc_clut_range_t g_clut_dirty[2] =
+{
+    {GLCDC_PRV_CLUT_ENTRY_SIZE, 0U}, {GLCDC_PRV_CLUT_ENTRY_SIZE, 0U}
+};
+static glcdc_clut_range_t g_clut_stale[2] =
+{
+    {GLCDC_PRV_CLUT_ENTRY_SIZE, 0U}, {GLCDC_PRV_CLUT_ENTRY_SIZE, 0U}
+};
+
+#if GLCDC_CFG_COLOR_CORRECTION_ENABLE
+
+/* Color correction settings staged by R_GLCDC_ColorCorrection and R_GLCDC_GammaCorrection */
+static display_brightness_t g_brightness_shadow;
+static display_contrast_t   g_contrast_shadow;
+static glcdc_gamma_regs_t   g_gamma_shadow[GLCDC_PRV_GAMMA_BLOCK_NUM];
+static volatile uint32_t    g_correction_pending = 0U;
+#endif
+
+/* Set while an API writes the shadow state; the line detect ISR then defers the commit to the next frame */
+static volatile bool g_shadow_busy = false;
 
 /* Look-up table for r_glcdc_tcon_set */
 static uint32_t volatile * g_tcon_lut[] =
@@ -417,9 +472,13 @@ fsp_err_t R_GLCDC_Open (display_ctrl_t * const p_api_ctrl, display_cfg_t const *
     r_glcdc_contrast_correction(p_ctrl, &p_cfg->output.contrast);
     if (p_cfg->output.p_gamma_correction)
     {
-        r_glcdc_gamma_correction(p_cfg);
+        /* Nothing is displayed yet, so write the gamma tables right away */
+        r_glcdc_gamma_correction(p_cfg->output.p_gamma_correction);
+        r_glcdc_gamma_write();
     }
 
+    g_correction_pending = 0U;
+
     /* Set the color correction order (brightness/contrast or gamma first) */
     r_glcdc_color_correction_order(p_cfg);
 #else
@@ -689,12 +748,11 @@ fsp_err_t R_GLCDC_BufferChange (display_ctrl_t const * const p_api_ctrl,
  * @retval  FSP_ERR_ASSERTION                  Pointer to the control block or the display correction structure is NULL.
  * @retval  FSP_ERR_INVALID_MODE               Function call is performed when the driver state is not
  *                                              DISPLAY_STATE_DISPLAYING.
- * @retval  FSP_ERR_INVALID_UPDATE_TIMING      A function call is performed while the GLCDC is updating registers
- *                                              internally.
  * @retval  FSP_ERR_INVALID_BRIGHTNESS_SETTING Invalid brightness correction setting found
- * @note    This API can be called when the driver is in the DISPLAY_STATE_DISPLAYING state. It returns an error if
- *           the register update operation for the background screen generation blocks or the output control block is
- *           being held.
+ * @note    This API can be called when the driver is in the DISPLAY_STATE_DISPLAYING state. The setting is staged and
+ *           returns immediately; it is written to the output control block in the next vertical blanking period, or
+ *           in the first one after the register update operation held by the GLCDC has completed. When called more
+ *           than once in a frame, the last setting is used.
  **********************************************************************************************************************/
 fsp_err_t R_GLCDC_ColorCorrection (display_ctrl_t const * const       p_api_ctrl,
                                    display_correction_t const * const p_correction)
@@ -714,16 +772,47 @@ fsp_err_t R_GLCDC_ColorCorrection (display_ctrl_t const * const       p_api_ctrl
     }
  #endif
 
-    /* Return immediately if the register updatings are performed */
-    FSP_ERROR_RETURN(false == (bool) (R_GLCDC->OUT.VLATCH_b.VEN), FSP_ERR_INVALID_UPDATE_TIMING);
-    FSP_ERROR_RETURN(false == (bool) (R_GLCDC->BG.EN_b.VEN), FSP_ERR_INVALID_UPDATE_TIMING);
+    /* Stage the brightness and contrast setting; it is committed from the line detect ISR */
+    g_shadow_busy        = true;
+    g_brightness_shadow  = p_correction->brightness;
+    g_contrast_shadow    = p_correction->contrast;
+    g_correction_pending |= GLCDC_PRV_SHADOW_BRIGHTNESS_CONTRAST;
+    r_glcdc_shadow_unlock(p_ctrl);
 
-    /* Configure the brightness and contrast correction register setting. */
-    r_glcdc_brightness_correction(p_ctrl, &p_correction->brightness);
-    r_glcdc_contrast_correction(p_ctrl, &p_correction->contrast);
+    return FSP_SUCCESS;
+}
 
-    /* Update the Output block register setting. */
-    R_GLCDC->OUT.VLATCH_b.VEN = 1U;
+/*******************************************************************************************************************//**
+ * Change the gamma correction setting of the GLCDC module at runtime.
+ *
+ * @retval  FSP_SUCCESS                        Gamma correction setting was staged successfully.
+ * @retval  FSP_ERR_ASSERTION                  Pointer to the control block, the gamma correction structure or its
+ *                                              gain/threshold tables is NULL.
+ * @retval  FSP_ERR_NOT_OPEN                   GLCDC module has not been opened.
+ * @retval  FSP_ERR_INVALID_GAMMA_SETTING      Invalid gamma correction setting found
+ * @note    This API can be called any time after R_GLCDC_Open. The setting is copied and the call returns
+ *           immediately; while displaying, the gamma tables are written in the next vertical blanking period in which
+ *           the gamma correction blocks are not holding a register update.
+ **********************************************************************************************************************/
+fsp_err_t R_GLCDC_GammaCorrection (display_ctrl_t const * const             p_api_ctrl,
+                                   display_gamma_correction_t const * const p_gamma)
+{
+    glcdc_instance_ctrl_t * p_ctrl = (glcdc_instance_ctrl_t *) p_api_ctrl;
+
+ #if (GLCDC_CFG_PARAM_CHECKING_ENABLE)
+    FSP_ASSERT(p_ctrl);
+    FSP_ASSERT(p_gamma);
+    FSP_ERROR_RETURN(DISPLAY_STATE_CLOSED != p_ctrl->state, FSP_ERR_NOT_OPEN);
+
+    fsp_err_t err = r_glcdc_param_check_gamma(p_gamma);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+ #endif
+
+    /* Build the gamma register images; they are committed from the line detect ISR */
+    g_shadow_busy = true;
+    r_glcdc_gamma_correction(p_gamma);
+    g_correction_pending |= GLCDC_PRV_SHADOW_GAMMA;
+    r_glcdc_shadow_unlock(p_ctrl);
 
     return FSP_SUCCESS;
 }
@@ -735,38 +824,30 @@ fsp_err_t R_GLCDC_ColorCorrection (display_ctrl_t const * const       p_api_ctrl
  *
  * @retval  FSP_SUCCESS                    CLUT written successfully.
  * @retval  FSP_ERR_ASSERTION              Pointer to the control block or CLUT source data is NULL.
- * @retval  FSP_ERR_INVALID_UPDATE_TIMING  R_GLCDC_ClutEdit was already used to edit the specified CLUT this frame.
  * @retval  FSP_ERR_INVALID_CLUT_ACCESS    Illegal CLUT entry or size is specified.
- * @note    This API can be called any time. The written data will be used after the next vertical sync event.
+ * @note    This API can be called any time. The data is written to a shadow table and the call returns immediately;
+ *           while displaying, the changed entries are copied to the hardware in the next vertical blanking period and
+ *           used from the following frame. Several updates and edits within one frame are committed together.
  **********************************************************************************************************************/
 fsp_err_t R_GLCDC_ClutUpdate (display_ctrl_t const * const     p_api_ctrl,
                               display_clut_cfg_t const * const p_clut_cfg,
                               display_frame_layer_t            layer)
 {
     glcdc_instance_ctrl_t * p_ctrl = (glcdc_instance_ctrl_t *) p_api_ctrl;
-    FSP_PARAMETER_NOT_USED(p_ctrl);
 
 #if (GLCDC_CFG_PARAM_CHECKING_ENABLE)
     FSP_ASSERT(p_ctrl);
     FSP_ASSERT(p_clut_cfg);
-    FSP_ERROR_RETURN(g_clut_data_latched[layer], FSP_ERR_INVALID_UPDATE_TIMING);
     FSP_ERROR_RETURN((GLCDC_PRV_CLUT_ENTRY_SIZE > p_clut_cfg->start), FSP_ERR_INVALID_CLUT_ACCESS);
-    FSP_ERROR_RETURN((GLCDC_PRV_CLUT_ENTRY_SIZE >= p_clut_cfg->size), FSP_ERR_INVALID_CLUT_ACCESS);
+    FSP_ERROR_RETURN((GLCDC_PRV_CLUT_ENTRY_SIZE >= (p_clut_cfg->start + p_clut_cfg->size)),
+                     FSP_ERR_INVALID_CLUT_ACCESS);
 #endif
 
-    /* Get the index of the CLUT not in use */
-    uint32_t target_plane = R_GLCDC->GR[layer].CLUTINT_b.SEL ? 0 : 1;
-
-    /* Get the start address in the destination CLUT hardware array based on the currently selected table and layer */
-    uint32_t volatile * clut_hw = R_GLCDC->GR1_CLUT0 +
-                                  ((target_plane + (uint32_t) (layer << 1)) * GLCDC_PRV_CLUT_ENTRY_SIZE) +
-                                  p_clut_cfg->start;
-
-    /* Copy the new CLUT data from the source memory to the CLUT SRAM in the GLCDC module */
-    memcpy((void *) clut_hw, p_clut_cfg->p_base, sizeof(uint32_t) * p_clut_cfg->size);
-
-    /* Swap to the new CLUT table data on the next frame */
-    R_GLCDC->GR[layer].CLUTINT_b.SEL = target_plane & 1;
+    /* Copy the new CLUT data from the source memory to the shadow table */
+    g_shadow_busy = true;
+    memcpy(&g_clut_shadow[layer][p_clut_cfg->start], p_clut_cfg->p_base, sizeof(uint32_t) * p_clut_cfg->size);
+    r_glcdc_clut_dirty_set(layer, p_clut_cfg->start, p_clut_cfg->start + p_clut_cfg->size);
+    r_glcdc_shadow_unlock(p_ctrl);
 
     return FSP_SUCCESS;
 }
@@ -776,7 +857,8 @@ fsp_err_t R_GLCDC_ClutUpdate (display_ctrl_t const * const     p_api_ctrl,
  *
  * @retval  FSP_SUCCESS                  CLUT element updated successfully.
  * @retval  FSP_ERR_ASSERTION            Pointer to the control block is NULL.
- * @note    This API can be called any time. The written data will be used after the next vertical sync event.
+ * @note    This API can be called any time. The element is written to the shadow table and committed to the
+ *           hardware together with the other changes of the frame in the next vertical blanking period.
  **********************************************************************************************************************/
 fsp_err_t R_GLCDC_ClutEdit (display_ctrl_t const * const p_api_ctrl,
                             display_frame_layer_t        layer,
@@ -784,36 +866,16 @@ fsp_err_t R_GLCDC_ClutEdit (display_ctrl_t const * const p_api_ctrl,
                             uint32_t                     color)
 {
     glcdc_instance_ctrl_t * p_ctrl = (glcdc_instance_ctrl_t *) p_api_ctrl;
-    FSP_PARAMETER_NOT_USED(p_ctrl);
 
 #if (GLCDC_CFG_PARAM_CHECKING_ENABLE)
     FSP_ASSERT(p_ctrl);
 #endif
 
-    static uint32_t volatile * clut_hw[2] = {R_GLCDC->GR1_CLUT0, R_GLCDC->GR2_CLUT0};
-
-    /* If the previously written CLUT has been selected, switch to the unused one */
-    if (g_clut_data_latched[layer])
-    {
-        g_clut_data_latched[layer] = false;
-
-        /* Get the index of the CLUT not in use */
-        uint32_t target_plane = R_GLCDC->GR[layer].CLUTINT_b.SEL ? 0 : 1;
-
-        /* Get the start address of the destination CLUT hardware array */
-        uint32_t volatile * clut_hw_new = R_GLCDC->GR1_CLUT0 +
-                                          ((target_plane + (uint32_t) (layer << 1)) * GLCDC_PRV_CLUT_ENTRY_SIZE);
-
-        /* Copy the old data to the new table then save the new table address */
-        memcpy((void *) clut_hw_new, (void *) clut_hw[layer], GLCDC_PRV_CLUT_ENTRY_SIZE * 4U);
-        clut_hw[layer] = clut_hw_new;
-
-        /* Swap to the new CLUT table data on the next frame */
-        R_GLCDC->GR[layer].CLUTINT_b.SEL = target_plane & 1;
-    }
-
-    /* Set the CLUT element */
-    clut_hw[layer][index] = color;
+    /* Set the CLUT element in the shadow table */
+    g_shadow_busy               = true;
+    g_clut_shadow[layer][index] = color;
+    r_glcdc_clut_dirty_set(layer, index, (uint32_t) index + 1U);
+    r_glcdc_shadow_unlock(p_ctrl);
 
     return FSP_SUCCESS;
 }
@@ -936,6 +998,38 @@ static fsp_err_t r_glcdc_param_check_gamma_correction (gamma_correction_t const
     return FSP_SUCCESS;
 }
 
+/*******************************************************************************************************************//**
+ * The parameter checking subroutine for a gamma correction setting.
+ * @param[in]     p_gamma   Pointer to the gamma correction setting for all colors
+ * @retval  FSP_SUCCESS                      No parameter error found
+ * @retval  FSP_ERR_ASSERTION                Gain or threshold table pointers are NULL
+ * @retval  FSP_ERR_INVALID_GAMMA_SETTING    Invalid gamma correction setting found
+ **********************************************************************************************************************/
+static fsp_err_t r_glcdc_param_check_gamma (display_gamma_correction_t const * const p_gamma)
+{
+    fsp_err_t error;
+
+    if (p_gamma->b.enable)
+    {
+        error = r_glcdc_param_check_gamma_correction(&(p_gamma->b));
+        FSP_ERROR_RETURN(FSP_SUCCESS == error, error);
+    }
+
+    if (p_gamma->g.enable)
+    {
+        error = r_glcdc_param_check_gamma_correction(&(p_gamma->g));
+        FSP_ERROR_RETURN(FSP_SUCCESS == error, error);
+    }
+
+    if (p_gamma->r.enable)
+    {
+        error = r_glcdc_param_check_gamma_correction(&(p_gamma->r));
+        FSP_ERROR_RETURN(FSP_SUCCESS == error, error);
+    }
+
+    return FSP_SUCCESS;
+}
+
  #endif
 
 /*******************************************************************************************************************//**
@@ -1111,23 +1205,8 @@ static fsp_err_t r_glcdc_open_param_check_correction_setting (display_cfg_t cons
 
     if (p_cfg->output.p_gamma_correction)
     {
-        if (p_cfg->output.p_gamma_correction->b.enable)
-        {
-            error = r_glcdc_param_check_gamma_correction(&(p_cfg->output.p_gamma_correction->b));
-            FSP_ERROR_RETURN(FSP_SUCCESS == error, error);
-        }
-
-        if (p_cfg->output.p_gamma_correction->g.enable)
-        {
-            error = r_glcdc_param_check_gamma_correction(&(p_cfg->output.p_gamma_correction->g));
-            FSP_ERROR_RETURN(FSP_SUCCESS == error, error);
-        }
-
-        if (p_cfg->output.p_gamma_correction->r.enable)
-        {
-            error = r_glcdc_param_check_gamma_correction(&(p_cfg->output.p_gamma_correction->r));
-            FSP_ERROR_RETURN(FSP_SUCCESS == error, error);
-        }
+        error = r_glcdc_param_check_gamma(p_cfg->output.p_gamma_correction);
+        FSP_ERROR_RETURN(FSP_SUCCESS == error, error);
     }
 
     return FSP_SUCCESS;
@@ -1567,10 +1646,12 @@ static void r_glcdc_graphics_layer_set (display_input_cfg_t const * const p_inpu
     /* Set the alpha blending condition */
     r_glcdc_graphics_layer_blend_condition_set(p_layer, layer);
 
-    /* Reset CLUT table selection */
+    /* Reset CLUT table selection and have the whole shadow table written again at the next commit */
     R_GLCDC->GR[layer].CLUTINT = 0;
-    g_clut_data_latched[0]     = true;
-    g_clut_data_latched[1]     = true;
+    g_shadow_busy              = true;
+    r_glcdc_clut_dirty_set(layer, 0U, GLCDC_PRV_CLUT_ENTRY_SIZE);
+    __DMB();
+    g_shadow_busy = false;
 }
 
 /*******************************************************************************************************************//**
@@ -1749,19 +1830,19 @@ static void r_glcdc_color_correction_order (display_cfg_t const * const p_cfg)
 }
 
 /*******************************************************************************************************************//**
- * Subroutine to configure the gamma correction register setting.
- * @param[in]     p_cfg      Pointer to the configuration structure for the display interface
+ * Subroutine to build the gamma correction register images in the shadow state.
+ * @param[in]     p_gamma    Pointer to the gamma correction setting
  * @retval        void
  **********************************************************************************************************************/
-static void r_glcdc_gamma_correction (display_cfg_t const * const p_cfg)
+static void r_glcdc_gamma_correction (display_gamma_correction_t const * const p_gamma)
 {
     uint8_t i;
     uint8_t j;
 
-    gamma_correction_t * LUT_ptr;
+    gamma_correction_t const * LUT_ptr;
 
     /* Set gamma correction LUTs based on config struct */
-    for (j = 0U; j < 3U; j++)
+    for (j = 0U; j < GLCDC_PRV_GAMMA_BLOCK_NUM; j++)
     {
         /* Get pointer to LUT */
         switch (j)
@@ -1769,19 +1850,19 @@ static void r_glcdc_gamma_correction (display_cfg_t const * const p_cfg)
             default:
             case 0:
             {
-                LUT_ptr = &(p_cfg->output.p_gamma_correction->g);
+                LUT_ptr = &(p_gamma->g);
                 break;
             }
 
             case 1:
             {
-                LUT_ptr = &(p_cfg->output.p_gamma_correction->b);
+                LUT_ptr = &(p_gamma->b);
                 break;
             }
 
             case 2:
             {
-                LUT_ptr = &(p_cfg->output.p_gamma_correction->r);
+                LUT_ptr = &(p_gamma->r);
                 break;
             }
         }
@@ -1790,31 +1871,169 @@ static void r_glcdc_gamma_correction (display_cfg_t const * const p_cfg)
         {
             for (i = 0U; i < (uint8_t) (DISPLAY_GAMMA_CURVE_ELEMENT_NUM / 2); i++)
             {
-                R_GLCDC->GAM[j].LUT[i] = ((LUT_ptr->gain[i * 2U] & GLCDC_PRV_GAMX_LUTX_GAIN_MASK) << 16) +
-                                         (LUT_ptr->gain[(i * 2U) + 1U] & GLCDC_PRV_GAMX_LUTX_GAIN_MASK);
+                g_gamma_shadow[j].lut[i] = ((LUT_ptr->gain[i * 2U] & GLCDC_PRV_GAMX_LUTX_GAIN_MASK) << 16) +
+                                           (LUT_ptr->gain[(i * 2U) + 1U] & GLCDC_PRV_GAMX_LUTX_GAIN_MASK);
             }
 
             for (i = 0U; i < (uint8_t) (DISPLAY_GAMMA_CURVE_ELEMENT_NUM / 3); i++)
             {
-                R_GLCDC->GAM[j].AREA[i] = ((LUT_ptr->threshold[(i * 3U) + 1U] & GLCDC_PRV_GAMX_AREAX_MASK) << 20) +
-                                          ((LUT_ptr->threshold[(i * 3U) + 2U] & GLCDC_PRV_GAMX_AREAX_MASK) << 10) +
-                                          (LUT_ptr->threshold[(i * 3U) + 3U] & GLCDC_PRV_GAMX_AREAX_MASK);
+                g_gamma_shadow[j].area[i] = ((LUT_ptr->threshold[(i * 3U) + 1U] & GLCDC_PRV_GAMX_AREAX_MASK) << 20) +
+                                            ((LUT_ptr->threshold[(i * 3U) + 2U] & GLCDC_PRV_GAMX_AREAX_MASK) << 10) +
+                                            (LUT_ptr->threshold[(i * 3U) + 3U] & GLCDC_PRV_GAMX_AREAX_MASK);
             }
 
             /* Enable LUT */
-            R_GLCDC->GAM[j].GAM_SW = 1U;
+            g_gamma_shadow[j].gam_sw = 1U;
         }
         else
         {
-            R_GLCDC->GAM[j].GAM_SW = 0U;
+            g_gamma_shadow[j].gam_sw = 0U;
+        }
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Subroutine to write the gamma correction register images to the GLCDC and request them to be latched at the next
+ * vertical sync.
+ * @retval        void
+ **********************************************************************************************************************/
+static void r_glcdc_gamma_write (void)
+{
+    for (uint32_t j = 0U; j < GLCDC_PRV_GAMMA_BLOCK_NUM; j++)
+    {
+        if (g_gamma_shadow[j].gam_sw)
+        {
+            memcpy((void *) R_GLCDC->GAM[j].LUT, g_gamma_shadow[j].lut, sizeof(g_gamma_shadow[j].lut));
+            memcpy((void *) R_GLCDC->GAM[j].AREA, g_gamma_shadow[j].area, sizeof(g_gamma_shadow[j].area));
         }
 
-        R_GLCDC->GAM[j].LATCH = 1U;
+        R_GLCDC->GAM[j].GAM_SW = g_gamma_shadow[j].gam_sw;
+        R_GLCDC->GAM[j].LATCH  = 1U;
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Subroutine to commit the staged color correction settings. Each setting is held back to a later frame while the
+ * GLCDC still holds a previous register update of the same block.
+ * @param[in]     p_ctrl     Pointer to the control block for the Display Interface
+ * @retval        void
+ **********************************************************************************************************************/
+static void r_glcdc_correction_commit (glcdc_instance_ctrl_t const * const p_ctrl)
+{
+    if ((g_correction_pending & GLCDC_PRV_SHADOW_BRIGHTNESS_CONTRAST) && !R_GLCDC->OUT.VLATCH_b.VEN &&
+        !R_GLCDC->BG.EN_b.VEN)
+    {
+        r_glcdc_brightness_correction(p_ctrl, &g_brightness_shadow);
+        r_glcdc_contrast_correction(p_ctrl, &g_contrast_shadow);
+
+        /* Update the Output block register setting. */
+        R_GLCDC->OUT.VLATCH_b.VEN = 1U;
+        g_correction_pending     &= ~GLCDC_PRV_SHADOW_BRIGHTNESS_CONTRAST;
+    }
+
+    if ((g_correction_pending & GLCDC_PRV_SHADOW_GAMMA) && !R_GLCDC->GAM[0].LATCH_b.VEN &&
+        !R_GLCDC->GAM[1].LATCH_b.VEN && !R_GLCDC->GAM[2].LATCH_b.VEN)
+    {
+        r_glcdc_gamma_write();
+        g_correction_pending &= ~GLCDC_PRV_SHADOW_GAMMA;
     }
 }
 
 #endif
 
+/*******************************************************************************************************************//**
+ * Subroutine to extend the range of CLUT shadow entries waiting to be committed.
+ * @param[in]     layer      Graphics layer of the CLUT
+ * @param[in]     start      First changed entry
+ * @param[in]     end        One past the last changed entry
+ * @retval        void
+ **********************************************************************************************************************/
+static void r_glcdc_clut_dirty_set (display_frame_layer_t layer, uint32_t start, uint32_t end)
+{
+    if (start < g_clut_dirty[layer].start)
+    {
+        g_clut_dirty[layer].start = start;
+    }
+
+    if (end > g_clut_dirty[layer].end)
+    {
+        g_clut_dirty[layer].end = end;
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Subroutine to copy the changed CLUT shadow entries into the CLUT plane not in use and select it for the next frame.
+ * The plane not in use also receives the entries committed to the other plane last time, so both planes follow the
+ * shadow table.
+ * @param[in]     layer      Graphics layer of the CLUT
+ * @retval        void
+ **********************************************************************************************************************/
+static void r_glcdc_clut_commit (display_frame_layer_t layer)
+{
+    glcdc_clut_range_t * p_dirty = &g_clut_dirty[layer];
+    glcdc_clut_range_t * p_stale = &g_clut_stale[layer];
+
+    if (p_dirty->start >= p_dirty->end)
+    {
+        return;
+    }
+
+    uint32_t start = (p_stale->start < p_dirty->start) ? p_stale->start : p_dirty->start;
+    uint32_t end   = (p_stale->end > p_dirty->end) ? p_stale->end : p_dirty->end;
+
+    /* Get the index of the CLUT not in use */
+    uint32_t target_plane = R_GLCDC->GR[layer].CLUTINT_b.SEL ? 0 : 1;
+
+    /* Get the start address in the destination CLUT hardware array based on the currently selected table and layer */
+    uint32_t volatile * clut_hw = R_GLCDC->GR1_CLUT0 +
+                                  ((target_plane + (uint32_t) (layer << 1)) * GLCDC_PRV_CLUT_ENTRY_SIZE) + start;
+
+    /* Copy the new CLUT data from the shadow table to the CLUT SRAM in the GLCDC module */
+    memcpy((void *) clut_hw, &g_clut_shadow[layer][start], sizeof(uint32_t) * (end - start));
+
+    /* Swap to the new CLUT table data on the next frame */
+    R_GLCDC->GR[layer].CLUTINT_b.SEL = target_plane & 1;
+
+    *p_stale       = *p_dirty;
+    p_dirty->start = GLCDC_PRV_CLUT_ENTRY_SIZE;
+    p_dirty->end   = 0U;
+}
+
+/*******************************************************************************************************************//**
+ * Subroutine to release the shadow state after an API has staged a change. While the GLCDC is not displaying there is
+ * no line detect interrupt, so the change is committed right away.
+ * @param[in]     p_ctrl     Pointer to the control block for the Display Interface
+ * @retval        void
+ **********************************************************************************************************************/
+static void r_glcdc_shadow_unlock (glcdc_instance_ctrl_t const * const p_ctrl)
+{
+    /* Make the shadow writes complete before the ISR may observe the state as free */
+    __DMB();
+    g_shadow_busy = false;
+
+    if (DISPLAY_STATE_DISPLAYING != p_ctrl->state)
+    {
+        r_glcdc_shadow_commit(p_ctrl);
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Subroutine to commit all staged CLUT and color correction changes to the GLCDC.
+ * @param[in]     p_ctrl     Pointer to the control block for the Display Interface
+ * @retval        void
+ **********************************************************************************************************************/
+static void r_glcdc_shadow_commit (glcdc_instance_ctrl_t const * const p_ctrl)
+{
+    r_glcdc_clut_commit(DISPLAY_FRAME_LAYER_1);
+    r_glcdc_clut_commit(DISPLAY_FRAME_LAYER_2);
+
+#if GLCDC_CFG_COLOR_CORRECTION_ENABLE
+    r_glcdc_correction_commit(p_ctrl);
+#else
+    FSP_PARAMETER_NOT_USED(p_ctrl);
+#endif
+}
+
 /*******************************************************************************************************************//**
  * Subroutine to get the bit size of the specified format.
  * @param[in]     format   Color format (specify display_in_format_t type enumeration value)
@@ -1850,9 +2069,12 @@ void glcdc_line_detect_isr (void)
         g_fade_pending[1] = 0;
     }
 
-    /* Set CLUT state to latched */
-    g_clut_data_latched[0] = true;
-    g_clut_data_latched[1] = true;
+    /* Commit the staged CLUT and color correction changes in the vertical blanking period, unless an API is writing
+     * them right now (they are then committed in the next frame) */
+    if (!g_shadow_busy)
+    {
+        r_glcdc_shadow_commit(p_ctrl);
+    }
 
     /* Call back callback function if it is registered */
     if (NULL != p_ctrl->p_callback)
@@ -59,6 +59,28 @@
 
 #define R_GPT0_GTINTAD_ADTRAUEN_Pos                      (16U)
 
+/* Set GPT_CFG_RAMFUNC_ENABLE to 1 to execute the interrupt handlers and R_GPT_DutyCycleSet from RAM. Otherwise the
+ * overflow and underflow handlers follow BSP_ISR_IN_RAM. */
+#ifndef GPT_CFG_RAMFUNC_ENABLE
+ #define GPT_CFG_RAMFUNC_ENABLE                          (0)
+#endif
+
+#if GPT_CFG_RAMFUNC_ENABLE
+ #define GPT_PRV_RAMFUNC                                 BSP_PLACE_IN_RAM
+ #define GPT_PRV_ISR_RAMFUNC                             BSP_PLACE_IN_RAM
+#else
+ #define GPT_PRV_RAMFUNC
+ #define GPT_PRV_ISR_RAMFUNC                             BSP_ISR_IN_RAM
+#endif
+
+/* Sequencer: DTC repeat mode rewinds the source after at most 256 transfers. */
+#define GPT_PRV_SEQUENCE_MAX_LOOP_STEPS                  (256U)
+
+/* Capture stream: timestamps converted per pass of R_GPT_CaptureStreamMeasure(), and the marker for no edge yet. */
+#define GPT_PRV_STREAM_CHUNK                             (16U)
+#define GPT_PRV_STREAM_NO_EDGE                           (UINT64_MAX)
+#define GPT_PRV_STREAM_PPM                               (1000000ULL)
+
 /***********************************************************************************************************************
  * Typedef definitions
  **********************************************************************************************************************/
@@ -119,21 +141,41 @@ static void r_gpt_enable_irq(IRQn_Type const irq, uint32_t priority, void * p_co
 
 static void gpt_calculate_duty_cycle(gpt_instance_ctrl_t * const p_instance_ctrl,
                                      uint32_t const              duty_cycle_counts,
-                                     gpt_prv_duty_registers_t  * p_duty_reg);
+                                     gpt_prv_duty_registers_t  * p_duty_reg) GPT_PRV_RAMFUNC;
 
 static uint32_t gpt_gtior_calculate(timer_cfg_t const * const p_cfg, gpt_pin_level_t const stop_level);
 
 #endif
 
-static void r_gpt_call_callback(gpt_instance_ctrl_t * p_ctrl, timer_event_t event, uint32_t capture);
+static void r_gpt_call_callback(gpt_instance_ctrl_t * p_ctrl, timer_event_t event, uint32_t capture) GPT_PRV_RAMFUNC;
+static void r_gpt_capture_common_isr(gpt_prv_capture_event_t event) GPT_PRV_RAMFUNC;
+
+static void     gpt_stream_close(gpt_instance_ctrl_t * const p_instance_ctrl);
+static uint32_t gpt_stream_available(gpt_instance_ctrl_t * const p_instance_ctrl, uint32_t const event);
+static uint64_t gpt_stream_anchor(gpt_instance_ctrl_t * const p_instance_ctrl, uint32_t const capture);
+static uint32_t gpt_stream_read(gpt_instance_ctrl_t * const p_instance_ctrl,
+                                uint32_t const              event,
+                                uint64_t * const            p_timestamps,
+                                uint32_t const              max_count);
+
+#if !GPT_CFG_WRITE_PROTECT_ENABLE
+static uint32_t gpt_sequence_info_set(gpt_instance_ctrl_t * const  p_instance_ctrl,
+                                      gpt_sequence_t const * const p_sequence) GPT_PRV_RAMFUNC;
+static bool gpt_sequence_advance(gpt_instance_ctrl_t * const p_instance_ctrl) GPT_PRV_RAMFUNC;
+
+#endif
 
 /***********************************************************************************************************************
  * ISR prototypes
  **********************************************************************************************************************/
-void gpt_counter_overflow_isr(void);
-void gpt_counter_underflow_isr(void);
-void gpt_capture_a_isr(void);
-void gpt_capture_b_isr(void);
+void gpt_counter_overflow_isr(void) GPT_PRV_ISR_RAMFUNC;
+void gpt_counter_underflow_isr(void) GPT_PRV_ISR_RAMFUNC;
+void gpt_capture_a_isr(void) GPT_PRV_RAMFUNC;
+void gpt_capture_b_isr(void) GPT_PRV_RAMFUNC;
+
+/* Duty cycle updates are made from the cycle end interrupt, so they are placed with the interrupt handlers. */
+fsp_err_t R_GPT_DutyCycleSet(timer_ctrl_t * const p_ctrl, uint32_t const duty_cycle_counts,
+                             uint32_t const pin) GPT_PRV_RAMFUNC;
 
 /***********************************************************************************************************************
  * Private global variables
@@ -243,6 +285,8 @@ fsp_err_t R_GPT_Open (timer_ctrl_t * const p_ctrl, timer_cfg_t const * const p_c
 
     gpt_hardware_initialize(p_instance_ctrl, p_cfg);
 
+    BSP_TRACE(FSP_IP_GPT, p_cfg->channel, BSP_TRACE_EVENT_OPEN, 0U);
+
     p_instance_ctrl->open = GPT_OPEN;
 
     return FSP_SUCCESS;
@@ -266,6 +310,8 @@ fsp_err_t R_GPT_Stop (timer_ctrl_t * const p_ctrl)
     FSP_ERROR_RETURN(GPT_OPEN == p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
 #endif
 
+    BSP_TRACE(FSP_IP_GPT, p_instance_ctrl->p_cfg->channel, BSP_TRACE_EVENT_STOP, 0U);
+
     /* Stop timer */
     p_instance_ctrl->p_reg->GTSTP = p_instance_ctrl->channel_mask;
 
@@ -290,6 +336,8 @@ fsp_err_t R_GPT_Start (timer_ctrl_t * const p_ctrl)
     FSP_ERROR_RETURN(GPT_OPEN == p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
 #endif
 
+    BSP_TRACE(FSP_IP_GPT, p_instance_ctrl->p_cfg->channel, BSP_TRACE_EVENT_START, 0U);
+
     /* Start timer */
     p_instance_ctrl->p_reg->GTSTR = p_instance_ctrl->channel_mask;
 
@@ -706,6 +754,57 @@ fsp_err_t R_GPT_OutputDisable (timer_ctrl_t * const p_ctrl, gpt_io_pin_t pin)
     return FSP_SUCCESS;
 }
 
+/*******************************************************************************************************************//**
+ * Drive GTIOCA and/or GTIOCB to a level while the timer is stopped. The level is held when counting starts and stops,
+ * so the pin afterwards changes only on the compare match and cycle end events of the configured mode. This lets a
+ * one-shot timer started by a hardware event end a pulse that software started, e.g. an RS-485 driver enable signal.
+ *
+ * @retval FSP_SUCCESS                 Pin level updated.
+ * @retval FSP_ERR_ASSERTION           p_ctrl was NULL.
+ * @retval FSP_ERR_NOT_OPEN            The instance is not opened.
+ * @retval FSP_ERR_IN_USE              The timer is counting.
+ **********************************************************************************************************************/
+fsp_err_t R_GPT_OutputLevelSet (timer_ctrl_t * const p_ctrl, gpt_io_pin_t pin, gpt_pin_level_t level)
+{
+    gpt_instance_ctrl_t * p_instance_ctrl = (gpt_instance_ctrl_t *) p_ctrl;
+#if GPT_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_instance_ctrl);
+    FSP_ERROR_RETURN(GPT_OPEN == p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+
+    /* GTIOR must only be modified while the counter is stopped. */
+    FSP_ERROR_RETURN(0U == p_instance_ctrl->p_reg->GTCR_b.CST, FSP_ERR_IN_USE);
+
+    r_gpt_write_protect_disable(p_instance_ctrl);
+
+    uint32_t gtior = p_instance_ctrl->p_reg->GTIOR;
+    uint32_t hold  = 0U;
+    if (GPT_IO_PIN_GTIOCB != pin)
+    {
+        /* GTIOCA or both GTIOCA and GTIOCB. */
+        gtior &= ~(R_GPT0_GTIOR_OAHLD_Msk | R_GPT0_GTIOR_OADFLT_Msk);
+        gtior |= (uint32_t) level << R_GPT0_GTIOR_OADFLT_Pos;
+        hold  |= R_GPT0_GTIOR_OAHLD_Msk;
+    }
+
+    if (GPT_IO_PIN_GTIOCA != pin)
+    {
+        /* GTIOCB or both GTIOCA and GTIOCB. */
+        gtior &= ~(R_GPT0_GTIOR_OBHLD_Msk | R_GPT0_GTIOR_OBDFLT_Msk);
+        gtior |= (uint32_t) level << R_GPT0_GTIOR_OBDFLT_Pos;
+        hold  |= R_GPT0_GTIOR_OBHLD_Msk;
+    }
+
+    /* With the hold bit cleared, the stopped pin outputs the stop level. Setting the hold bit afterwards keeps this
+     * level when counting starts and when it stops again. */
+    p_instance_ctrl->p_reg->GTIOR = gtior;
+    p_instance_ctrl->p_reg->GTIOR = gtior | hold;
+
+    r_gpt_write_protect_enable(p_instance_ctrl);
+
+    return FSP_SUCCESS;
+}
+
 /*******************************************************************************************************************//**
  * Set A/D converter start request compare match value.
  *
@@ -784,6 +883,365 @@ fsp_err_t R_GPT_CallbackSet (timer_ctrl_t * const          p_api_ctrl,
     return FSP_SUCCESS;
 }
 
+/*******************************************************************************************************************//**
+ * Start logging input captures into RAM rings without CPU involvement. Each capture A (and optionally capture B) event
+ * activates a transfer instance that copies GTCCRA (GTCCRB) into the next ring entry; the rings wrap in repeat mode
+ * so no interrupt is taken per edge. Counter overflows are counted by the cycle end interrupt, which
+ * R_GPT_CaptureStreamRead() uses to extend each capture to a 64-bit timestamp.
+ *
+ * The timer must be opened in periodic (sawtooth, count up) mode with the capture sources configured, and the cycle
+ * end interrupt must be enabled. Consecutive edges in a ring must be less than one timer period apart.
+ *
+ * @retval FSP_SUCCESS                 Capture stream started.
+ * @retval FSP_ERR_ASSERTION           An input parameter is invalid or the cycle end interrupt is not enabled.
+ * @retval FSP_ERR_NOT_OPEN            The instance is not opened.
+ * @retval FSP_ERR_IN_USE              The capture stream or a waveform sequence is already started.
+ * @return                             See @ref RENESAS_ERROR_CODES or functions called by this function for other
+ *                                     possible return codes.
+ **********************************************************************************************************************/
+fsp_err_t R_GPT_CaptureStreamStart (timer_ctrl_t * const p_ctrl, gpt_capture_stream_cfg_t const * const p_stream_cfg)
+{
+    gpt_instance_ctrl_t * p_instance_ctrl = (gpt_instance_ctrl_t *) p_ctrl;
+    fsp_err_t             err             = FSP_SUCCESS;
+
+#if GPT_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_instance_ctrl);
+    FSP_ASSERT(NULL != p_stream_cfg);
+    FSP_ASSERT(NULL != p_stream_cfg->p_transfer_a);
+    FSP_ASSERT(NULL != p_stream_cfg->p_buffer_a);
+    FSP_ASSERT((NULL == p_stream_cfg->p_transfer_b) || (NULL != p_stream_cfg->p_buffer_b));
+    FSP_ASSERT(p_stream_cfg->ring_length > 1U);
+    FSP_ERROR_RETURN(GPT_OPEN == p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
+    FSP_ASSERT(p_instance_ctrl->p_cfg->cycle_end_irq >= 0);
+#endif
+    FSP_ERROR_RETURN(NULL == p_instance_ctrl->p_stream_cfg, FSP_ERR_IN_USE);
+    FSP_ERROR_RETURN(NULL == p_instance_ctrl->p_sequence, FSP_ERR_IN_USE);
+
+    transfer_instance_t const * p_transfer[2] = {p_stream_cfg->p_transfer_a, p_stream_cfg->p_transfer_b};
+    uint32_t                  * p_buffer[2]   = {p_stream_cfg->p_buffer_a, p_stream_cfg->p_buffer_b};
+
+    /* Seed the software time base before the first capture can be transferred. */
+    uint32_t counter = p_instance_ctrl->p_reg->GTCNT;
+    p_instance_ctrl->stream_overflows = 0U;
+    p_instance_ctrl->stream_edge      = GPT_PRV_STREAM_NO_EDGE;
+
+    for (uint32_t i = 0U; i < 2U; i++)
+    {
+        p_instance_ctrl->stream_read[i] = 0U;
+        p_instance_ctrl->stream_last[i] = counter;
+        p_instance_ctrl->stream_time[i] = counter;
+
+        if (NULL == p_transfer[i])
+        {
+            continue;
+        }
+
+        /* GTCCRx is copied to the ring; the destination is rewound at the end of the ring indefinitely. */
+        transfer_info_t * p_info = &p_instance_ctrl->stream_info[i];
+        p_info->transfer_settings_word = 0U;
+
+        p_info->size           = TRANSFER_SIZE_4_BYTE;
+        p_info->mode           = TRANSFER_MODE_REPEAT;
+        p_info->src_addr_mode  = TRANSFER_ADDR_MODE_FIXED;
+        p_info->dest_addr_mode = TRANSFER_ADDR_MODE_INCREMENTED;
+        p_info->repeat_area    = TRANSFER_REPEAT_AREA_DESTINATION;
+        p_info->irq            = TRANSFER_IRQ_END;
+        p_info->chain_mode     = TRANSFER_CHAIN_MODE_DISABLED;
+        p_info->p_src          = (void const *) &p_instance_ctrl->p_reg->GTCCR[i];
+        p_info->p_dest         = p_buffer[i];
+        p_info->num_blocks     = 0U;
+        p_info->length         = p_stream_cfg->ring_length;
+
+        err = p_transfer[i]->p_api->open(p_transfer[i]->p_ctrl, p_transfer[i]->p_cfg);
+        if (FSP_SUCCESS == err)
+        {
+            err = p_transfer[i]->p_api->reconfigure(p_transfer[i]->p_ctrl, p_info);
+            if (FSP_SUCCESS != err)
+            {
+                (void) p_transfer[i]->p_api->close(p_transfer[i]->p_ctrl);
+            }
+        }
+
+        if (FSP_SUCCESS != err)
+        {
+            /* Release capture A if capture B could not be started. */
+            if (0U != i)
+            {
+                (void) p_transfer[0]->p_api->close(p_transfer[0]->p_ctrl);
+            }
+
+            return err;
+        }
+    }
+
+    p_instance_ctrl->p_stream_cfg = p_stream_cfg;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Stop logging input captures and close the transfer instances. Captures already in the rings are discarded.
+ *
+ * @retval FSP_SUCCESS                 Capture stream stopped.
+ * @retval FSP_ERR_ASSERTION           p_ctrl was NULL.
+ * @retval FSP_ERR_NOT_OPEN            The instance is not opened.
+ * @retval FSP_ERR_NOT_ENABLED         The capture stream is not started.
+ **********************************************************************************************************************/
+fsp_err_t R_GPT_CaptureStreamStop (timer_ctrl_t * const p_ctrl)
+{
+    gpt_instance_ctrl_t * p_instance_ctrl = (gpt_instance_ctrl_t *) p_ctrl;
+
+#if GPT_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_instance_ctrl);
+    FSP_ERROR_RETURN(GPT_OPEN == p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+    FSP_ERROR_RETURN(NULL != p_instance_ctrl->p_stream_cfg, FSP_ERR_NOT_ENABLED);
+
+    gpt_stream_close(p_instance_ctrl);
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Read the captures logged since the previous read as 64-bit timestamps in timer counts. A timestamp is the number of
+ * counts since the start of the timer period in which R_GPT_CaptureStreamStart() was called.
+ *
+ * The ring must be read at least once per ring_length edges; older entries are overwritten by the transfer.
+ *
+ * @retval FSP_SUCCESS                 Timestamps stored in p_timestamps and their number in p_count.
+ * @retval FSP_ERR_ASSERTION           An input parameter is invalid.
+ * @retval FSP_ERR_NOT_OPEN            The instance is not opened.
+ * @retval FSP_ERR_NOT_ENABLED         The capture stream is not started, or pin is not logged.
+ **********************************************************************************************************************/
+fsp_err_t R_GPT_CaptureStreamRead (timer_ctrl_t * const p_ctrl,
+                                   gpt_io_pin_t const   pin,
+                                   uint64_t * const     p_timestamps,
+                                   uint32_t const       max_count,
+                                   uint32_t * const     p_count)
+{
+    gpt_instance_ctrl_t * p_instance_ctrl = (gpt_instance_ctrl_t *) p_ctrl;
+
+#if GPT_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_instance_ctrl);
+    FSP_ASSERT(NULL != p_timestamps);
+    FSP_ASSERT(NULL != p_count);
+    FSP_ASSERT(GPT_IO_PIN_GTIOCA_AND_GTIOCB != pin);
+    FSP_ERROR_RETURN(GPT_OPEN == p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+    gpt_capture_stream_cfg_t const * p_stream_cfg = p_instance_ctrl->p_stream_cfg;
+    FSP_ERROR_RETURN(NULL != p_stream_cfg, FSP_ERR_NOT_ENABLED);
+    FSP_ERROR_RETURN((GPT_IO_PIN_GTIOCA == pin) || (NULL != p_stream_cfg->p_transfer_b), FSP_ERR_NOT_ENABLED);
+
+    *p_count = gpt_stream_read(p_instance_ctrl, (uint32_t) pin, p_timestamps, max_count);
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Consume every capture logged since the previous call and compute the mean period and frequency of the capture A
+ * edges. When capture B is logged, each capture B is paired with the capture A before it to compute the mean duty
+ * cycle, so the stream must be started while the input is idle (before a capture A edge). Captures are converted in
+ * batches of GPT_PRV_STREAM_CHUNK on the stack.
+ *
+ * @retval FSP_SUCCESS                 Measurement stored in p_result.
+ * @retval FSP_ERR_ASSERTION           An input parameter is NULL.
+ * @retval FSP_ERR_NOT_OPEN            The instance is not opened.
+ * @retval FSP_ERR_NOT_ENABLED         The capture stream is not started.
+ **********************************************************************************************************************/
+fsp_err_t R_GPT_CaptureStreamMeasure (timer_ctrl_t * const p_ctrl, gpt_capture_measurement_t * const p_result)
+{
+    gpt_instance_ctrl_t * p_instance_ctrl = (gpt_instance_ctrl_t *) p_ctrl;
+
+#if GPT_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_instance_ctrl);
+    FSP_ASSERT(NULL != p_result);
+    FSP_ERROR_RETURN(GPT_OPEN == p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+    gpt_capture_stream_cfg_t const * p_stream_cfg = p_instance_ctrl->p_stream_cfg;
+    FSP_ERROR_RETURN(NULL != p_stream_cfg, FSP_ERR_NOT_ENABLED);
+
+    bool pair = (NULL != p_stream_cfg->p_transfer_b);
+
+    /* Only consume complete A/B pairs so the next call starts on a capture A. */
+    uint32_t remaining = gpt_stream_available(p_instance_ctrl, GPT_PRV_GTCCRA);
+    if (pair)
+    {
+        uint32_t available_b = gpt_stream_available(p_instance_ctrl, GPT_PRV_GTCCRB);
+        remaining = (available_b < remaining) ? available_b : remaining;
+    }
+
+    uint64_t time_a[GPT_PRV_STREAM_CHUNK];
+    uint64_t time_b[GPT_PRV_STREAM_CHUNK];
+    uint64_t period_sum = 0U;
+    uint64_t high_sum   = 0U;
+    uint32_t periods    = 0U;
+    uint32_t edges      = remaining;
+
+    while (remaining > 0U)
+    {
+        uint32_t count = (remaining < GPT_PRV_STREAM_CHUNK) ? remaining : GPT_PRV_STREAM_CHUNK;
+        count = gpt_stream_read(p_instance_ctrl, GPT_PRV_GTCCRA, time_a, count);
+        if (pair)
+        {
+            (void) gpt_stream_read(p_instance_ctrl, GPT_PRV_GTCCRB, time_b, count);
+        }
+
+        for (uint32_t i = 0U; i < count; i++)
+        {
+            if (GPT_PRV_STREAM_NO_EDGE != p_instance_ctrl->stream_edge)
+            {
+                period_sum += time_a[i] - p_instance_ctrl->stream_edge;
+                periods++;
+            }
+
+            p_instance_ctrl->stream_edge = time_a[i];
+
+            if (pair)
+            {
+                high_sum += time_b[i] - time_a[i];
+            }
+        }
+
+        remaining -= count;
+    }
+
+    p_result->edges         = edges;
+    p_result->period_counts = 0U;
+    p_result->frequency_hz  = 0U;
+    p_result->duty_ppm      = 0U;
+
+    if (0U != period_sum)
+    {
+        uint64_t period = period_sum / periods;
+        uint64_t clock  = gpt_clock_frequency_get(p_instance_ctrl);
+
+        p_result->period_counts = (uint32_t) period;
+        p_result->frequency_hz  = (uint32_t) ((clock * periods) / period_sum);
+
+        if (pair && (0U != period))
+        {
+            p_result->duty_ppm = (uint32_t) ((high_sum * GPT_PRV_STREAM_PPM) / ((uint64_t) edges * period));
+        }
+    }
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Start a waveform sequence. Each counter overflow activates p_transfer, which loads the next step of the table into
+ * GTPBR, GTCCRC and GTCCRD; the buffer operation applies the step from the following cycle, so the waveform changes
+ * every cycle without CPU involvement. Loop tables repeat until R_GPT_SequenceStop() is called. One-shot tables are
+ * followed by p_next from the cycle end interrupt, which starts the next table without a gap. The cycle end callback
+ * is made only once, with TIMER_EVENT_CYCLE_END, after the last step of the last table has been loaded.
+ *
+ * p_transfer must be a DTC instance activated by ELC_EVENT_GPTn_COUNTER_OVERFLOW of this channel, and the cycle end
+ * interrupt must be enabled. The timer must be running in saw-wave PWM or periodic mode. Values are written to the
+ * buffer registers as-is, so 0% and 100% duty must be set with R_GPT_DutyCycleSet() before or after the sequence.
+ * Only available when GPT_CFG_WRITE_PROTECT_ENABLE is 0, since the write protection also blocks transfers.
+ *
+ * @retval FSP_SUCCESS                 Sequence started.
+ * @retval FSP_ERR_ASSERTION           An input parameter is invalid or the cycle end interrupt is not enabled.
+ * @retval FSP_ERR_NOT_OPEN            The instance is not opened.
+ * @retval FSP_ERR_IN_USE              A sequence or the capture stream is already started.
+ * @retval FSP_ERR_UNSUPPORTED         GPT_CFG_WRITE_PROTECT_ENABLE is set.
+ * @return                             See @ref RENESAS_ERROR_CODES or functions called by this function for other
+ *                                     possible return codes.
+ **********************************************************************************************************************/
+fsp_err_t R_GPT_SequenceStart (timer_ctrl_t * const              p_ctrl,
+                               transfer_instance_t const * const p_transfer,
+                               gpt_sequence_t const * const      p_sequence)
+{
+#if !GPT_CFG_WRITE_PROTECT_ENABLE
+    gpt_instance_ctrl_t * p_instance_ctrl = (gpt_instance_ctrl_t *) p_ctrl;
+
+ #if GPT_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_instance_ctrl);
+    FSP_ASSERT(NULL != p_transfer);
+    FSP_ASSERT(NULL != p_sequence);
+
+    /* Every table in the chain must have steps and load at least one register. A loop table ends the chain. */
+    for (gpt_sequence_t const * p_table = p_sequence; NULL != p_table; p_table = p_table->p_next)
+    {
+        FSP_ASSERT(p_table->steps > 0U);
+        FSP_ASSERT((NULL != p_table->p_period) || (NULL != p_table->p_duty_a) || (NULL != p_table->p_duty_b));
+        if (GPT_SEQUENCE_MODE_LOOP == p_table->mode)
+        {
+            FSP_ASSERT(p_table->steps <= GPT_PRV_SEQUENCE_MAX_LOOP_STEPS);
+            break;
+        }
+    }
+
+    FSP_ERROR_RETURN(GPT_OPEN == p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
+    FSP_ASSERT(p_instance_ctrl->p_cfg->cycle_end_irq >= 0);
+ #endif
+    FSP_ERROR_RETURN(NULL == p_instance_ctrl->p_sequence, FSP_ERR_IN_USE);
+    FSP_ERROR_RETURN(NULL == p_instance_ctrl->p_stream_cfg, FSP_ERR_IN_USE);
+
+    (void) gpt_sequence_info_set(p_instance_ctrl, p_sequence);
+
+    fsp_err_t err = p_transfer->p_api->open(p_transfer->p_ctrl, p_transfer->p_cfg);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+    /* Publish the sequence before the first overflow can complete a one-shot table. */
+    p_instance_ctrl->p_seq_transfer = p_transfer;
+    p_instance_ctrl->p_sequence     = p_sequence;
+
+    err = p_transfer->p_api->reconfigure(p_transfer->p_ctrl, &p_instance_ctrl->sequence_info[0]);
+    if (FSP_SUCCESS != err)
+    {
+        p_instance_ctrl->p_sequence = NULL;
+        (void) p_transfer->p_api->close(p_transfer->p_ctrl);
+    }
+
+    return err;
+#else
+    FSP_PARAMETER_NOT_USED(p_ctrl);
+    FSP_PARAMETER_NOT_USED(p_transfer);
+    FSP_PARAMETER_NOT_USED(p_sequence);
+
+    return FSP_ERR_UNSUPPORTED;
+#endif
+}
+
+/*******************************************************************************************************************//**
+ * Stop the waveform sequence and close its transfer instance. The last step loaded stays in the buffer registers and
+ * keeps being output, and the cycle end callback is made every cycle again.
+ *
+ * @retval FSP_SUCCESS                 Sequence stopped.
+ * @retval FSP_ERR_ASSERTION           p_ctrl was NULL.
+ * @retval FSP_ERR_NOT_OPEN            The instance is not opened.
+ * @retval FSP_ERR_NOT_ENABLED         No sequence is running.
+ * @retval FSP_ERR_UNSUPPORTED         GPT_CFG_WRITE_PROTECT_ENABLE is set.
+ **********************************************************************************************************************/
+fsp_err_t R_GPT_SequenceStop (timer_ctrl_t * const p_ctrl)
+{
+#if !GPT_CFG_WRITE_PROTECT_ENABLE
+    gpt_instance_ctrl_t * p_instance_ctrl = (gpt_instance_ctrl_t *) p_ctrl;
+
+ #if GPT_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_instance_ctrl);
+    FSP_ERROR_RETURN(GPT_OPEN == p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
+ #endif
+
+    /* The cycle end interrupt may end the sequence at the same time. */
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+    gpt_sequence_t const * p_sequence = p_instance_ctrl->p_sequence;
+    p_instance_ctrl->p_sequence = NULL;
+    FSP_CRITICAL_SECTION_EXIT;
+
+    FSP_ERROR_RETURN(NULL != p_sequence, FSP_ERR_NOT_ENABLED);
+
+    (void) p_instance_ctrl->p_seq_transfer->p_api->close(p_instance_ctrl->p_seq_transfer->p_ctrl);
+
+    return FSP_SUCCESS;
+#else
+    FSP_PARAMETER_NOT_USED(p_ctrl);
+
+    return FSP_ERR_UNSUPPORTED;
+#endif
+}
+
 /*******************************************************************************************************************//**
  * Stops counter, disables output pins, and clears internal driver data. Implements @ref timer_api_t::close.
  *
@@ -804,6 +1262,24 @@ fsp_err_t R_GPT_Close (timer_ctrl_t * const p_ctrl)
     /* Clear open flag. */
     p_instance_ctrl->open = 0U;
 
+    BSP_TRACE(FSP_IP_GPT, p_instance_ctrl->p_cfg->channel, BSP_TRACE_EVENT_CLOSE, 0U);
+
+    /* Release the capture stream transfers, if used. */
+    if (NULL != p_instance_ctrl->p_stream_cfg)
+    {
+        gpt_stream_close(p_instance_ctrl);
+    }
+
+#if !GPT_CFG_WRITE_PROTECT_ENABLE
+
+    /* Release the sequence transfer, if used. */
+    if (NULL != p_instance_ctrl->p_sequence)
+    {
+        p_instance_ctrl->p_sequence = NULL;
+        (void) p_instance_ctrl->p_seq_transfer->p_api->close(p_instance_ctrl->p_seq_transfer->p_ctrl);
+    }
+#endif
+
     r_gpt_write_protect_disable(p_instance_ctrl);
 
     /* Stop counter. */
@@ -912,6 +1388,9 @@ static void gpt_common_open (gpt_instance_ctrl_t * const p_instance_ctrl, timer_
     p_instance_ctrl->p_callback        = p_cfg->p_callback;
     p_instance_ctrl->p_context         = p_cfg->p_context;
     p_instance_ctrl->p_callback_memory = NULL;
+
+    p_instance_ctrl->p_stream_cfg = NULL;
+    p_instance_ctrl->p_sequence   = NULL;
 }
 
 /*******************************************************************************************************************//**
@@ -1292,6 +1771,8 @@ static void r_gpt_call_callback (gpt_instance_ctrl_t * p_ctrl, timer_event_t eve
 {
     timer_callback_args_t args;
 
+    BSP_TRACE(FSP_IP_GPT, p_ctrl->p_cfg->channel, event, capture);
+
     /* Store callback arguments in memory provided by user if available.  This allows callback arguments to be
      * stored in non-secure memory so they can be accessed by a non-secure callback function. */
     timer_callback_args_t * p_args = p_ctrl->p_callback_memory;
@@ -1338,6 +1819,234 @@ static void r_gpt_call_callback (gpt_instance_ctrl_t * p_ctrl, timer_event_t eve
     }
 }
 
+/*******************************************************************************************************************//**
+ * Closes the capture stream transfer instances.
+ *
+ * @param[in]  p_instance_ctrl         Instance control block.
+ **********************************************************************************************************************/
+static void gpt_stream_close (gpt_instance_ctrl_t * const p_instance_ctrl)
+{
+    gpt_capture_stream_cfg_t const * p_stream_cfg = p_instance_ctrl->p_stream_cfg;
+
+    (void) p_stream_cfg->p_transfer_a->p_api->close(p_stream_cfg->p_transfer_a->p_ctrl);
+    if (NULL != p_stream_cfg->p_transfer_b)
+    {
+        (void) p_stream_cfg->p_transfer_b->p_api->close(p_stream_cfg->p_transfer_b->p_ctrl);
+    }
+
+    p_instance_ctrl->p_stream_cfg = NULL;
+}
+
+#if !GPT_CFG_WRITE_PROTECT_ENABLE
+
+/*******************************************************************************************************************//**
+ * Builds the chained transfer links that load one step of a sequence table per counter overflow. Each used table
+ * column is copied to its buffer register with the source incremented. Loop tables rewind the source in repeat mode
+ * and never interrupt the CPU; one-shot tables interrupt the CPU after the last step.
+ *
+ * @param[in]  p_instance_ctrl         Instance control block.
+ * @param[in]  p_sequence              Table to transfer.
+ *
+ * @return Number of links used.
+ **********************************************************************************************************************/
+static uint32_t gpt_sequence_info_set (gpt_instance_ctrl_t * const  p_instance_ctrl,
+                                       gpt_sequence_t const * const p_sequence)
+{
+    uint32_t const    * p_src[3]  = {p_sequence->p_period, p_sequence->p_duty_a, p_sequence->p_duty_b};
+    volatile uint32_t * p_dest[3] =
+    {
+        &p_instance_ctrl->p_reg->GTPBR,
+        &p_instance_ctrl->p_reg->GTCCR[GPT_PRV_GTCCRC],
+        &p_instance_ctrl->p_reg->GTCCR[GPT_PRV_GTCCRD],
+    };
+
+    uint32_t links = 0U;
+    for (uint32_t i = 0U; i < 3U; i++)
+    {
+        if (NULL == p_src[i])
+        {
+            continue;
+        }
+
+        transfer_info_t * p_info = &p_instance_ctrl->sequence_info[links];
+        p_info->transfer_settings_word = 0U;
+
+        p_info->size = TRANSFER_SIZE_4_BYTE;
+        p_info->mode =
+            (GPT_SEQUENCE_MODE_LOOP == p_sequence->mode) ? TRANSFER_MODE_REPEAT : TRANSFER_MODE_NORMAL;
+        p_info->src_addr_mode  = TRANSFER_ADDR_MODE_INCREMENTED;
+        p_info->dest_addr_mode = TRANSFER_ADDR_MODE_FIXED;
+        p_info->repeat_area    = TRANSFER_REPEAT_AREA_SOURCE;
+        p_info->irq            = TRANSFER_IRQ_END;
+        p_info->chain_mode     = TRANSFER_CHAIN_MODE_EACH;
+        p_info->p_src          = p_src[i];
+        p_info->p_dest         = (void *) p_dest[i];
+        p_info->num_blocks     = 0U;
+        p_info->length         = p_sequence->steps;
+
+        links++;
+    }
+
+    /* The last link ends the chain. */
+    p_instance_ctrl->sequence_info[links - 1U].chain_mode = TRANSFER_CHAIN_MODE_DISABLED;
+
+    return links;
+}
+
+/*******************************************************************************************************************//**
+ * Called from the cycle end interrupt after the last step of a one-shot table was loaded. Starts the next table, which
+ * is loaded from the next overflow so no cycle is skipped, or ends the sequence.
+ *
+ * @param[in]  p_instance_ctrl         Instance control block.
+ *
+ * @retval true                        The next table was started.
+ * @retval false                       The sequence ended.
+ **********************************************************************************************************************/
+static bool gpt_sequence_advance (gpt_instance_ctrl_t * const p_instance_ctrl)
+{
+    gpt_sequence_t const      * p_next     = p_instance_ctrl->p_sequence->p_next;
+    transfer_instance_t const * p_transfer = p_instance_ctrl->p_seq_transfer;
+
+    if (NULL != p_next)
+    {
+        (void) gpt_sequence_info_set(p_instance_ctrl, p_next);
+        if (FSP_SUCCESS == p_transfer->p_api->reconfigure(p_transfer->p_ctrl, &p_instance_ctrl->sequence_info[0]))
+        {
+            p_instance_ctrl->p_sequence = p_next;
+
+            return true;
+        }
+    }
+
+    p_instance_ctrl->p_sequence = NULL;
+    (void) p_transfer->p_api->close(p_transfer->p_ctrl);
+
+    return false;
+}
+
+#endif
+
+/*******************************************************************************************************************//**
+ * Returns the number of unread entries in a capture ring. The write position is derived from the number of transfers
+ * remaining before the transfer rewinds the ring.
+ *
+ * @param[in]  p_instance_ctrl         Instance control block.
+ * @param[in]  event                   GPT_PRV_GTCCRA or GPT_PRV_GTCCRB.
+ **********************************************************************************************************************/
+static uint32_t gpt_stream_available (gpt_instance_ctrl_t * const p_instance_ctrl, uint32_t const event)
+{
+    gpt_capture_stream_cfg_t const * p_stream_cfg = p_instance_ctrl->p_stream_cfg;
+    transfer_instance_t const      * p_transfer   =
+        (GPT_PRV_GTCCRA == event) ? p_stream_cfg->p_transfer_a : p_stream_cfg->p_transfer_b;
+    transfer_properties_t properties = {0U};
+    uint32_t              length     = p_stream_cfg->ring_length;
+
+    (void) p_transfer->p_api->infoGet(p_transfer->p_ctrl, &properties);
+
+    /* A remaining count of 0 or length both mean the ring was just rewound. */
+    uint32_t write = (length - (properties.transfer_length_remaining % length)) % length;
+
+    return (write + length - p_instance_ctrl->stream_read[event]) % length;
+}
+
+/*******************************************************************************************************************//**
+ * Returns the 64-bit time of a capture that occurred in the current or previous timer period, based on the overflow
+ * count and the current counter value.
+ *
+ * @param[in]  p_instance_ctrl         Instance control block.
+ * @param[in]  capture                 Captured counter value.
+ **********************************************************************************************************************/
+static uint64_t gpt_stream_anchor (gpt_instance_ctrl_t * const p_instance_ctrl, uint32_t const capture)
+{
+    uint64_t period = (uint64_t) p_instance_ctrl->p_reg->GTPR + 1U;
+    uint32_t overflows;
+    uint32_t counter;
+
+    /* Read the overflow count and counter consistently in case the overflow interrupt runs in between. */
+    do
+    {
+        overflows = p_instance_ctrl->stream_overflows;
+        counter   = p_instance_ctrl->p_reg->GTCNT;
+    } while (overflows != p_instance_ctrl->stream_overflows);
+
+    /* An overflow that has not been counted yet (the caller runs at or above the overflow interrupt priority). */
+    if (NVIC_GetPendingIRQ(p_instance_ctrl->p_cfg->cycle_end_irq) && (counter < (period / 2U)))
+    {
+        overflows++;
+    }
+
+    /* A capture above the current counter value was taken in the previous period. */
+    if ((capture > counter) && (0U != overflows))
+    {
+        overflows--;
+    }
+
+    return ((uint64_t) overflows * period) + capture;
+}
+
+/*******************************************************************************************************************//**
+ * Converts up to max_count unread ring entries to 64-bit timestamps. Consecutive captures are unwrapped modulo the
+ * timer period, then the whole batch is shifted by any periods that elapsed without an edge so the newest capture
+ * agrees with the overflow count.
+ *
+ * @param[in]  p_instance_ctrl         Instance control block.
+ * @param[in]  event                   GPT_PRV_GTCCRA or GPT_PRV_GTCCRB.
+ * @param[out] p_timestamps            Converted timestamps.
+ * @param[in]  max_count               Maximum number of timestamps to convert.
+ *
+ * @return     Number of timestamps stored in p_timestamps.
+ **********************************************************************************************************************/
+static uint32_t gpt_stream_read (gpt_instance_ctrl_t * const p_instance_ctrl,
+                                 uint32_t const              event,
+                                 uint64_t * const            p_timestamps,
+                                 uint32_t const              max_count)
+{
+    gpt_capture_stream_cfg_t const * p_stream_cfg = p_instance_ctrl->p_stream_cfg;
+    uint32_t const * p_ring = (GPT_PRV_GTCCRA == event) ? p_stream_cfg->p_buffer_a : p_stream_cfg->p_buffer_b;
+    uint32_t         length = p_stream_cfg->ring_length;
+    uint32_t         period = p_instance_ctrl->p_reg->GTPR + 1U;
+
+    uint32_t available = gpt_stream_available(p_instance_ctrl, event);
+    if (0U == available)
+    {
+        return 0U;
+    }
+
+    /* Unwrap every unread entry to find the time of the newest one. */
+    uint32_t read = p_instance_ctrl->stream_read[event];
+    uint32_t last = p_instance_ctrl->stream_last[event];
+    uint64_t time = p_instance_ctrl->stream_time[event];
+    for (uint32_t i = 0U; i < available; i++)
+    {
+        uint32_t capture = p_ring[(read + i) % length];
+        time += (capture >= last) ? (capture - last) : (capture + period - last);
+        last  = capture;
+    }
+
+    /* Periods without any edge are only visible in the overflow count. */
+    uint64_t anchor = gpt_stream_anchor(p_instance_ctrl, last);
+    uint64_t offset = (anchor > time) ? (anchor - time) : 0U;
+
+    uint32_t count = (available < max_count) ? available : max_count;
+    last = p_instance_ctrl->stream_last[event];
+    time = p_instance_ctrl->stream_time[event] + offset;
+    for (uint32_t i = 0U; i < count; i++)
+    {
+        uint32_t capture = p_ring[read];
+        time += (capture >= last) ? (capture - last) : (capture + period - last);
+        last  = capture;
+
+        p_timestamps[i] = time;
+        read            = (read + 1U) % length;
+    }
+
+    p_instance_ctrl->stream_read[event] = read;
+    p_instance_ctrl->stream_last[event] = last;
+    p_instance_ctrl->stream_time[event] = time;
+
+    return count;
+}
+
 /*******************************************************************************************************************//**
  * Common processing for input capture interrupt.
  *
@@ -1415,7 +2124,24 @@ void gpt_counter_overflow_isr (void)
         R_BSP_IrqClearPending(irq);
     }
 
-    if (NULL != p_instance_ctrl->p_callback)
+    bool notify = true;
+
+#if !GPT_CFG_WRITE_PROTECT_ENABLE
+
+    /* While a sequence runs, overflows only reach the CPU after the last step of a one-shot table. The callback is
+     * made once the whole sequence has ended. */
+    if (NULL != p_instance_ctrl->p_sequence)
+    {
+        notify = !gpt_sequence_advance(p_instance_ctrl);
+    }
+    else
+#endif
+    {
+        /* Extend capture stream timestamps beyond the counter width. */
+        p_instance_ctrl->stream_overflows++;
+    }
+
+    if (notify && (NULL != p_instance_ctrl->p_callback))
     {
         r_gpt_call_callback(p_instance_ctrl, TIMER_EVENT_CYCLE_END, 0);
     }
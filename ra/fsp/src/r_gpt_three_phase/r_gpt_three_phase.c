@@ -40,6 +40,9 @@
 #define GPT_THREE_PHASE_PRV_GTBER_SINGLE_BUFFER    (0x50000U)
 #define GPT_THREE_PHASE_PRV_GTBER_DOUBLE_BUFFER    (0xA0000U)
 
+/* GTCCR and GTDV buffer operation disable bits, held while a batched update is staged. */
+#define GPT_THREE_PHASE_PRV_GTBER_UPDATE_HOLD      (R_GPT0_GTBER_BD0_Msk | R_GPT0_GTBER_BD3_Msk)
+
 #define GPT_THREE_PHASE_PRV_GTWP_RESET_VALUE       (0xA500U)
 #define GPT_THREE_PHASE_PRV_GTWP_WRITE_PROTECT     (0xA501U)
 
@@ -162,6 +165,17 @@ fsp_err_t R_GPT_THREE_PHASE_Open (three_phase_ctrl_t * const p_ctrl, three_phase
             p_instance_ctrl->p_reg[ch]->GTBER |= GPT_THREE_PHASE_PRV_GTBER_DOUBLE_BUFFER;
         }
 
+        p_instance_ctrl->gtber[ch] = p_instance_ctrl->p_reg[ch]->GTBER;
+
+        /* With automatic dead time, buffer GTDVU through GTDBU so dead time changes are applied with the duty cycle.
+         * GTDBU is seeded with the configured value first so the next buffer transfer does not change it. */
+        p_instance_ctrl->dead_time_auto = (bool) p_instance_ctrl->p_reg[ch]->GTDTCR_b.TDE;
+        if (p_instance_ctrl->dead_time_auto)
+        {
+            p_instance_ctrl->p_reg[ch]->GTDBU   = p_instance_ctrl->p_reg[ch]->GTDVU;
+            p_instance_ctrl->p_reg[ch]->GTDTCR |= R_GPT0_GTDTCR_TDBUE_Msk;
+        }
+
 #if GPT_CFG_WRITE_PROTECT_ENABLE
 
         /* Re-enable write protection */
@@ -315,6 +329,96 @@ fsp_err_t R_GPT_THREE_PHASE_DutyCycleSet (three_phase_ctrl_t * const       p_ctr
     return FSP_SUCCESS;
 }
 
+/*******************************************************************************************************************//**
+ * Stages the duty cycle of all three phases, and optionally the dead time, in the GPT buffer registers so they are
+ * applied together at the next buffer transfer (crest and/or trough).
+ *
+ * Buffer operation for GTCCR and GTDV is held on all three channels while the buffers are written, so a crest or trough
+ * occurring part way through the update transfers the previous values on every channel instead of a mix of old and new
+ * values. When automatic dead time is enabled (GTDTCR.TDE) the GTIOCB compare values are generated by hardware, so
+ * only the GTIOCA buffers are written.
+ *
+ * @param[in]  p_ctrl                  Control block set in @ref three_phase_api_t::open call.
+ * @param[in]  p_duty_cycle            Duty cycle values. duty_buffer is only used in double-buffer mode.
+ * @param[in]  dead_time_counts        New dead time applied with the duty cycle (automatic dead time only), or 0 to
+ *                                     keep the current dead time.
+ *
+ * @retval FSP_SUCCESS                 Duty cycle staged successfully.
+ * @retval FSP_ERR_ASSERTION           p_ctrl or p_duty_cycle was NULL.
+ * @retval FSP_ERR_NOT_OPEN            The instance is not opened.
+ * @retval FSP_ERR_INVALID_ARGUMENT    A duty cycle value was outside the range 1..(period - 1), or a dead time was
+ *                                     requested without automatic dead time.
+ **********************************************************************************************************************/
+fsp_err_t R_GPT_THREE_PHASE_DutyCycleUpdate (three_phase_ctrl_t * const             p_ctrl,
+                                             three_phase_duty_cycle_t const * const p_duty_cycle,
+                                             uint32_t const                         dead_time_counts)
+{
+    gpt_three_phase_instance_ctrl_t * p_instance_ctrl = (gpt_three_phase_instance_ctrl_t *) p_ctrl;
+#if GPT_THREE_PHASE_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_instance_ctrl);
+    FSP_ASSERT(NULL != p_duty_cycle);
+    FSP_ERROR_RETURN(GPT_THREE_PHASE_OPEN == p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
+    FSP_ERROR_RETURN((0U == dead_time_counts) || p_instance_ctrl->dead_time_auto, FSP_ERR_INVALID_ARGUMENT);
+
+    uint32_t gtpr = p_instance_ctrl->p_reg[THREE_PHASE_CHANNEL_U]->GTPR;
+    for (three_phase_channel_t ch = THREE_PHASE_CHANNEL_U; ch <= THREE_PHASE_CHANNEL_W; ch++)
+    {
+        FSP_ERROR_RETURN((p_duty_cycle->duty[ch] < gtpr) && (p_duty_cycle->duty[ch] > 0), FSP_ERR_INVALID_ARGUMENT);
+        if (THREE_PHASE_BUFFER_MODE_DOUBLE == p_instance_ctrl->buffer_mode)
+        {
+            FSP_ERROR_RETURN((p_duty_cycle->duty_buffer[ch] < gtpr) && (p_duty_cycle->duty_buffer[ch] > 0),
+                             FSP_ERR_INVALID_ARGUMENT);
+        }
+    }
+#endif
+
+    bool double_buffer = (THREE_PHASE_BUFFER_MODE_DOUBLE == p_instance_ctrl->buffer_mode);
+    bool write_b       = !p_instance_ctrl->dead_time_auto;
+
+    r_gpt_write_protect_disable_all(p_instance_ctrl);
+
+    /* Hold buffer transfers on all channels before any buffer is written. GTBER is written from the copy cached in
+     * open to avoid read-modify-write accesses. */
+    for (three_phase_channel_t ch = THREE_PHASE_CHANNEL_U; ch <= THREE_PHASE_CHANNEL_W; ch++)
+    {
+        p_instance_ctrl->p_reg[ch]->GTBER = p_instance_ctrl->gtber[ch] | GPT_THREE_PHASE_PRV_GTBER_UPDATE_HOLD;
+    }
+
+    for (three_phase_channel_t ch = THREE_PHASE_CHANNEL_U; ch <= THREE_PHASE_CHANNEL_W; ch++)
+    {
+        R_GPT0_Type * p_reg = p_instance_ctrl->p_reg[ch];
+
+        p_reg->GTCCR[GPT_THREE_PHASE_PRV_GTCCRC] = p_duty_cycle->duty[ch];
+        if (write_b)
+        {
+            p_reg->GTCCR[GPT_THREE_PHASE_PRV_GTCCRE] = p_duty_cycle->duty[ch];
+        }
+
+        if (double_buffer)
+        {
+            p_reg->GTCCR[GPT_THREE_PHASE_PRV_GTCCRD] = p_duty_cycle->duty_buffer[ch];
+            if (write_b)
+            {
+                p_reg->GTCCR[GPT_THREE_PHASE_PRV_GTCCRF] = p_duty_cycle->duty_buffer[ch];
+            }
+        }
+
+        if (0U != dead_time_counts)
+        {
+            p_reg->GTDBU = dead_time_counts;
+        }
+    }
+
+    /* Release the hold with back-to-back writes so all channels take the new values at the same transfer. */
+    p_instance_ctrl->p_reg[THREE_PHASE_CHANNEL_U]->GTBER = p_instance_ctrl->gtber[THREE_PHASE_CHANNEL_U];
+    p_instance_ctrl->p_reg[THREE_PHASE_CHANNEL_V]->GTBER = p_instance_ctrl->gtber[THREE_PHASE_CHANNEL_V];
+    p_instance_ctrl->p_reg[THREE_PHASE_CHANNEL_W]->GTBER = p_instance_ctrl->gtber[THREE_PHASE_CHANNEL_W];
+
+    r_gpt_write_protect_enable_all(p_instance_ctrl);
+
+    return FSP_SUCCESS;
+}
+
 /*******************************************************************************************************************//**
  * Updates the user callback for the GPT U-channel with the option to provide memory for the callback argument
  * structure.
@@ -378,6 +482,83 @@ fsp_err_t R_GPT_THREE_PHASE_Close (three_phase_ctrl_t * const p_ctrl)
     return err;
 }
 
+/*******************************************************************************************************************//**
+ * Delays the carrier of all three timers by phase_counts. Used with R_GPT_THREE_PHASE_SyncStart to stagger the
+ * carriers (and the A/D triggers and interrupts derived from them) of several 3-phase instances.
+ *
+ * One triangle-wave carrier period is 2 * GTPR counts. A phase up to GTPR starts the counters counting up from
+ * phase_counts, a larger phase starts them counting down from (2 * GTPR - phase_counts).
+ *
+ * @note The timers must be stopped.
+ *
+ * @retval FSP_SUCCESS                 Counters and count direction set successfully.
+ * @retval FSP_ERR_ASSERTION           p_ctrl was NULL.
+ * @retval FSP_ERR_NOT_OPEN            The instance is not opened.
+ * @retval FSP_ERR_IN_USE              The timers are running.
+ * @retval FSP_ERR_INVALID_ARGUMENT    phase_counts is not less than one carrier period.
+ **********************************************************************************************************************/
+fsp_err_t R_GPT_THREE_PHASE_PhaseSet (three_phase_ctrl_t * const p_ctrl, uint32_t phase_counts)
+{
+    gpt_three_phase_instance_ctrl_t * p_instance_ctrl = (gpt_three_phase_instance_ctrl_t *) p_ctrl;
+#if GPT_THREE_PHASE_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_instance_ctrl);
+    FSP_ERROR_RETURN(GPT_THREE_PHASE_OPEN == p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
+    FSP_ERROR_RETURN(0U == p_instance_ctrl->p_reg[THREE_PHASE_CHANNEL_U]->GTCR_b.CST, FSP_ERR_IN_USE);
+    FSP_ERROR_RETURN(phase_counts < (p_instance_ctrl->p_reg[THREE_PHASE_CHANNEL_U]->GTPR << 1),
+                     FSP_ERR_INVALID_ARGUMENT);
+#endif
+
+    uint32_t gtpr    = p_instance_ctrl->p_reg[THREE_PHASE_CHANNEL_U]->GTPR;
+    uint32_t ud      = R_GPT0_GTUDDTYC_UD_Msk;
+    uint32_t counter = phase_counts;
+
+    if (phase_counts > gtpr)
+    {
+        ud      = 0U;
+        counter = (gtpr << 1) - phase_counts;
+    }
+
+    r_gpt_write_protect_disable_all(p_instance_ctrl);
+
+    for (three_phase_channel_t ch = THREE_PHASE_CHANNEL_U; ch <= THREE_PHASE_CHANNEL_W; ch++)
+    {
+        R_GPT0_Type * p_reg    = p_instance_ctrl->p_reg[ch];
+        uint32_t      gtuddtyc = p_reg->GTUDDTYC & ~(R_GPT0_GTUDDTYC_UD_Msk | R_GPT0_GTUDDTYC_UDF_Msk);
+
+        p_reg->GTCNT = counter;
+
+        /* Force the count direction, then release it so the counter keeps alternating in triangle-wave mode. */
+        p_reg->GTUDDTYC = gtuddtyc | ud | R_GPT0_GTUDDTYC_UDF_Msk;
+        p_reg->GTUDDTYC = gtuddtyc | ud;
+    }
+
+    r_gpt_write_protect_enable_all(p_instance_ctrl);
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Starts all timers of this instance together with the GPT channels in sync_channel_mask using a single start
+ * register write, so the carriers of several 3-phase instances keep the phase set by R_GPT_THREE_PHASE_PhaseSet.
+ *
+ * @retval FSP_SUCCESS                 Timers successfully started.
+ * @retval FSP_ERR_ASSERTION           p_ctrl was NULL.
+ * @retval FSP_ERR_NOT_OPEN            The instance is not opened.
+ **********************************************************************************************************************/
+fsp_err_t R_GPT_THREE_PHASE_SyncStart (three_phase_ctrl_t * const p_ctrl, uint32_t sync_channel_mask)
+{
+    gpt_three_phase_instance_ctrl_t * p_instance_ctrl = (gpt_three_phase_instance_ctrl_t *) p_ctrl;
+#if GPT_THREE_PHASE_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_instance_ctrl);
+    FSP_ERROR_RETURN(GPT_THREE_PHASE_OPEN == p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+
+    /* Start timers */
+    p_instance_ctrl->p_reg[THREE_PHASE_CHANNEL_U]->GTSTR = p_instance_ctrl->channel_mask | sync_channel_mask;
+
+    return FSP_SUCCESS;
+}
+
 /*******************************************************************************************************************//**
  * Sets driver version based on compile time macros. Implements @ref three_phase_api_t::versionGet.
  *
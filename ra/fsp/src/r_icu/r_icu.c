@@ -48,7 +48,12 @@ typedef BSP_CMSE_NONSECURE_CALL void (*volatile icu_prv_ns_callback)(external_ir
 /***********************************************************************************************************************
  * Private function prototypes
  **********************************************************************************************************************/
-void r_icu_isr(void);
+void r_icu_isr(void) BSP_ISR_IN_RAM;
+
+#if ICU_CFG_EVENT_QUEUE_ENABLE
+static bool r_icu_event_queue(icu_instance_ctrl_t * p_ctrl) BSP_ISR_IN_RAM;
+
+#endif
 
 /***********************************************************************************************************************
  * Private global variables
@@ -119,6 +124,15 @@ fsp_err_t R_ICU_ExternalIrqOpen (external_irq_ctrl_t * const p_api_ctrl, externa
     {
         FSP_ERROR_RETURN(BSP_IRQ_DISABLED != p_cfg->ipl, FSP_ERR_INVALID_ARGUMENT);
     }
+
+ #if ICU_CFG_EVENT_QUEUE_ENABLE
+
+    /* Events are queued by the ISR. */
+    if ((NULL != p_cfg->p_extend) && (NULL != ((icu_extended_cfg_t const *) p_cfg->p_extend)->p_event_queue))
+    {
+        FSP_ERROR_RETURN(BSP_IRQ_DISABLED != p_cfg->ipl, FSP_ERR_INVALID_ARGUMENT);
+    }
+ #endif
 #endif
 
     p_ctrl->irq = p_cfg->irq;
@@ -139,6 +153,26 @@ fsp_err_t R_ICU_ExternalIrqOpen (external_irq_ctrl_t * const p_api_ctrl, externa
     p_ctrl->p_context  = p_cfg->p_context;
     p_ctrl->channel    = p_cfg->channel;
 
+#if ICU_CFG_EVENT_QUEUE_ENABLE
+    icu_extended_cfg_t const * p_extend = (icu_extended_cfg_t const *) p_cfg->p_extend;
+    p_ctrl->p_event_queue = NULL;
+    p_ctrl->p_timestamp   = NULL;
+    if (NULL != p_extend)
+    {
+        p_ctrl->p_event_queue = p_extend->p_event_queue;
+        p_ctrl->p_timestamp   = p_extend->p_timestamp;
+    }
+
+    if (NULL != p_ctrl->p_event_queue)
+    {
+        /* The first event notifies the consumer. */
+        p_ctrl->p_event_queue->armed = true;
+    }
+
+    memset(&p_ctrl->statistics, 0, sizeof(p_ctrl->statistics));
+    p_ctrl->statistics.interval_min = UINT32_MAX;
+#endif
+
     /* Disable digital filter */
     R_ICU->IRQCR[p_ctrl->channel] = 0U;
 
@@ -301,6 +335,89 @@ fsp_err_t R_ICU_ExternalIrqClose (external_irq_ctrl_t * const p_api_ctrl)
     return FSP_SUCCESS;
 }
 
+#if ICU_CFG_EVENT_QUEUE_ENABLE
+
+/*******************************************************************************************************************//**
+ * Reads events from the event queue of the channel, oldest first. The queue may be shared with other channels; the
+ * events of all of them are read. Only one thread may read a queue.
+ *
+ * Call this function until it returns fewer than max_events events. The callback of the channel that queues the next
+ * event is then called again, so the reader can wait for the callback between batches.
+ *
+ * @retval FSP_SUCCESS                 Events read. p_num_events may be 0.
+ * @retval FSP_ERR_ASSERTION           A required pointer is NULL.
+ * @retval FSP_ERR_NOT_OPEN            The channel is not opened.
+ * @retval FSP_ERR_NOT_ENABLED         The channel has no event queue.
+ **********************************************************************************************************************/
+fsp_err_t R_ICU_ExternalIrqEventsRead (external_irq_ctrl_t * const p_api_ctrl,
+                                       icu_event_t * const         p_events,
+                                       uint32_t                    max_events,
+                                       uint32_t * const            p_num_events)
+{
+    icu_instance_ctrl_t * p_ctrl = (icu_instance_ctrl_t *) p_api_ctrl;
+
+ #if ICU_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ASSERT(NULL != p_events);
+    FSP_ASSERT(NULL != p_num_events);
+    FSP_ERROR_RETURN(ICU_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+ #endif
+    FSP_ERROR_RETURN(NULL != p_ctrl->p_event_queue, FSP_ERR_NOT_ENABLED);
+
+    icu_event_queue_t * p_queue = p_ctrl->p_event_queue;
+    uint32_t            num     = 0U;
+
+    while ((num < max_events) && R_BSP_QueueMpscPop(&p_queue->queue, &p_events[num]))
+    {
+        num++;
+    }
+
+    if (num < max_events)
+    {
+        /* The queue is drained. Ask for a callback for the next event, then read events that were queued before the
+         * request was seen. */
+        p_queue->armed = true;
+
+        while ((num < max_events) && R_BSP_QueueMpscPop(&p_queue->queue, &p_events[num]))
+        {
+            num++;
+        }
+    }
+
+    *p_num_events = num;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Gets the event statistics of the channel.
+ *
+ * @retval FSP_SUCCESS                 Statistics copied.
+ * @retval FSP_ERR_ASSERTION           A required pointer is NULL.
+ * @retval FSP_ERR_NOT_OPEN            The channel is not opened.
+ **********************************************************************************************************************/
+fsp_err_t R_ICU_ExternalIrqStatisticsGet (external_irq_ctrl_t * const    p_api_ctrl,
+                                          icu_event_statistics_t * const p_statistics)
+{
+    icu_instance_ctrl_t * p_ctrl = (icu_instance_ctrl_t *) p_api_ctrl;
+
+ #if ICU_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ASSERT(NULL != p_statistics);
+    FSP_ERROR_RETURN(ICU_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+ #endif
+
+    /* The ISR updates the statistics. */
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+    *p_statistics = p_ctrl->statistics;
+    FSP_CRITICAL_SECTION_EXIT;
+
+    return FSP_SUCCESS;
+}
+
+#endif
+
 /*******************************************************************************************************************//**
  * Set driver version based on compile time macros.  Implements @ref external_irq_api_t::versionGet.
  *
@@ -333,6 +450,16 @@ void r_icu_isr (void)
     IRQn_Type             irq    = R_FSP_CurrentIrqGet();
     icu_instance_ctrl_t * p_ctrl = (icu_instance_ctrl_t *) R_FSP_IsrContextGet(irq);
 
+#if ICU_CFG_EVENT_QUEUE_ENABLE
+
+    /* Queue the event first to keep the timestamp close to the edge. */
+    bool notify = true;
+    if ((NULL != p_ctrl) && (NULL != p_ctrl->p_event_queue))
+    {
+        notify = r_icu_event_queue(p_ctrl);
+    }
+#endif
+
     bool level_irq = false;
     if (EXTERNAL_IRQ_TRIG_LEVEL_LOW == R_ICU->IRQCR_b[p_ctrl->channel].IRQMD)
     {
@@ -345,7 +472,11 @@ void r_icu_isr (void)
         R_BSP_IrqStatusClear(irq);
     }
 
+#if ICU_CFG_EVENT_QUEUE_ENABLE
+    if (notify && (NULL != p_ctrl) && (NULL != p_ctrl->p_callback))
+#else
     if ((NULL != p_ctrl) && (NULL != p_ctrl->p_callback))
+#endif
     {
 #if BSP_TZ_SECURE_BUILD
 
@@ -395,3 +526,53 @@ void r_icu_isr (void)
     /* Restore context if RTOS is used */
     FSP_CONTEXT_RESTORE
 }
+
+#if ICU_CFG_EVENT_QUEUE_ENABLE
+
+/*******************************************************************************************************************//**
+ * Queues an event of the channel and updates its statistics.
+ *
+ * @param[in]  p_ctrl                  Channel control block
+ *
+ * @retval     true                    The consumer waits for this event; call the callback.
+ * @retval     false                   The consumer has been notified already.
+ **********************************************************************************************************************/
+static bool r_icu_event_queue (icu_instance_ctrl_t * p_ctrl)
+{
+    icu_event_statistics_t * p_statistics = &p_ctrl->statistics;
+    icu_event_queue_t      * p_queue      = p_ctrl->p_event_queue;
+    icu_event_t              event;
+
+    event.timestamp = (NULL != p_ctrl->p_timestamp) ? *p_ctrl->p_timestamp : 0U;
+    event.channel   = p_ctrl->channel;
+
+    if (0U != p_statistics->events)
+    {
+        uint32_t interval = event.timestamp - p_statistics->last_timestamp;
+        if (interval < p_statistics->interval_min)
+        {
+            p_statistics->interval_min = interval;
+        }
+    }
+
+    p_statistics->last_timestamp = event.timestamp;
+    p_statistics->events++;
+
+    if (!R_BSP_QueueMpscPush(&p_queue->queue, &event))
+    {
+        p_statistics->overruns++;
+    }
+
+    /* Notify once per batch. The consumer asks again when it has drained the queue. */
+    if (!p_queue->armed)
+    {
+        return false;
+    }
+
+    p_queue->armed = false;
+    p_statistics->notifications++;
+
+    return true;
+}
+
+#endif
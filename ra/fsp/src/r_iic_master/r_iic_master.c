@@ -155,6 +155,11 @@ static fsp_err_t iic_master_read_write(i2c_master_ctrl_t * const p_api_ctrl,
                                        uint32_t const            bytes,
                                        iic_master_transfer_dir_t direction);
 static void iic_master_notify(iic_master_instance_ctrl_t * const p_ctrl, i2c_master_event_t const event);
+static void iic_master_address_setup(iic_master_instance_ctrl_t * const p_ctrl,
+                                     uint32_t const                     slave,
+                                     i2c_master_addr_mode_t const       addr_mode,
+                                     iic_master_transfer_dir_t          direction);
+static fsp_err_t iic_master_batch_next(iic_master_instance_ctrl_t * const p_ctrl);
 
 #if IIC_MASTER_CFG_DTC_ENABLE
 static fsp_err_t iic_master_transfer_open(iic_master_instance_ctrl_t * p_ctrl, i2c_master_cfg_t const * const p_cfg);
@@ -176,6 +181,7 @@ static void iic_master_open_hw_master(iic_master_instance_ctrl_t * const p_ctrl,
 static fsp_err_t iic_master_run_hw_master(iic_master_instance_ctrl_t * const p_ctrl);
 static void      iic_master_rxi_read_data(iic_master_instance_ctrl_t * const p_ctrl);
 static void      iic_master_txi_send_address(iic_master_instance_ctrl_t * const p_ctrl);
+static void      iic_master_txi_send_subaddr(iic_master_instance_ctrl_t * const p_ctrl);
 
 /***********************************************************************************************************************
  * Private global variables
@@ -282,15 +288,20 @@ fsp_err_t R_IIC_MASTER_Open (i2c_master_ctrl_t * const p_api_ctrl, i2c_master_cf
     }
 #endif
 
-    p_ctrl->p_buff    = NULL;
-    p_ctrl->total     = 0U;
-    p_ctrl->remain    = 0U;
-    p_ctrl->loaded    = 0U;
-    p_ctrl->read      = false;
-    p_ctrl->restart   = false;
-    p_ctrl->err       = false;
-    p_ctrl->restarted = false;
-    p_ctrl->open      = IIC_MASTER_OPEN;
+    p_ctrl->p_buff         = NULL;
+    p_ctrl->total          = 0U;
+    p_ctrl->remain         = 0U;
+    p_ctrl->loaded         = 0U;
+    p_ctrl->read           = false;
+    p_ctrl->restart        = false;
+    p_ctrl->err            = false;
+    p_ctrl->restarted      = false;
+    p_ctrl->p_subaddr      = NULL;
+    p_ctrl->subaddr_remain = 0U;
+    p_ctrl->p_batch        = NULL;
+    p_ctrl->batch_length   = 0U;
+    p_ctrl->batch_index    = 0U;
+    p_ctrl->open           = IIC_MASTER_OPEN;
 
     return FSP_SUCCESS;
 }
@@ -360,6 +371,66 @@ fsp_err_t R_IIC_MASTER_Write (i2c_master_ctrl_t * const p_api_ctrl,
     return err;
 }
 
+/*******************************************************************************************************************//**
+ * Performs a batch of register-map accesses, possibly to different slaves, as one bus transaction.
+ *
+ * Each segment issues the slave address and the sub-address bytes. A write segment then sends its payload; a read
+ * segment issues a restart and reads its payload. Consecutive segments are joined with a restart condition and the
+ * last segment ends with a stop condition. The next segment is started from the interrupt that detects the restart,
+ * so the callback is only invoked once, with I2C_MASTER_EVENT_RX_COMPLETE or I2C_MASTER_EVENT_TX_COMPLETE according
+ * to the direction of the last segment, or with I2C_MASTER_EVENT_ABORTED if any segment fails. Payload bytes use the
+ * transfer interfaces when they are configured.
+ *
+ * The segment list must remain valid until the callback is invoked.
+ *
+ * @retval  FSP_SUCCESS           Batch started.
+ * @retval  FSP_ERR_ASSERTION     p_api_ctrl or p_segments is NULL, num_segments is 0, or a segment is invalid.
+ * @retval  FSP_ERR_INVALID_SIZE  A segment payload is larger than uint16_t size (65535) while DTC is used
+ *                                for data transfer.
+ * @retval  FSP_ERR_IN_USE        Bus busy condition. Another transfer was in progress.
+ * @retval  FSP_ERR_NOT_OPEN      Handle is not initialized.  Call R_IIC_MASTER_Open to initialize the control block.
+ **********************************************************************************************************************/
+fsp_err_t R_IIC_MASTER_BatchStart (i2c_master_ctrl_t * const                p_api_ctrl,
+                                   iic_master_batch_segment_t const * const p_segments,
+                                   uint32_t const                           num_segments)
+{
+    iic_master_instance_ctrl_t * p_ctrl = (iic_master_instance_ctrl_t *) p_api_ctrl;
+
+#if IIC_MASTER_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(p_ctrl != NULL);
+    FSP_ASSERT(p_segments != NULL);
+    FSP_ASSERT(num_segments != 0U);
+    FSP_ERROR_RETURN((p_ctrl->open == IIC_MASTER_OPEN), FSP_ERR_NOT_OPEN);
+    FSP_ASSERT(p_ctrl->p_callback != NULL);
+
+    for (uint32_t i = 0U; i < num_segments; i++)
+    {
+        FSP_ASSERT((0U == p_segments[i].subaddr_bytes) || (NULL != p_segments[i].p_subaddr));
+        FSP_ASSERT((0U == p_segments[i].bytes) || (NULL != p_segments[i].p_buffer));
+
+        /* A read must transfer at least one byte */
+        FSP_ASSERT((IIC_MASTER_BATCH_DIR_WRITE == p_segments[i].direction) || (0U != p_segments[i].bytes));
+ #if IIC_MASTER_CFG_DTC_ENABLE
+        FSP_ERROR_RETURN((p_segments[i].bytes <= UINT16_MAX), FSP_ERR_INVALID_SIZE);
+ #endif
+    }
+#endif
+
+    p_ctrl->p_batch          = p_segments;
+    p_ctrl->batch_length     = num_segments;
+    p_ctrl->batch_index      = 0U;
+    p_ctrl->batch_data_phase = false;
+
+    /* Kickoff the first segment. The rest are started from the ERI interrupt. */
+    fsp_err_t err = iic_master_batch_next(p_ctrl);
+    if (FSP_SUCCESS != err)
+    {
+        p_ctrl->p_batch = NULL;
+    }
+
+    return err;
+}
+
 /*******************************************************************************************************************//**
  * Safely aborts any in-progress transfer and forces the IIC peripheral into ready state.
  *
@@ -585,15 +656,40 @@ static fsp_err_t iic_master_read_write (i2c_master_ctrl_t * const p_api_ctrl,
 
     fsp_err_t err = FSP_SUCCESS;
 
-    p_ctrl->p_buff = p_buffer;
-    p_ctrl->total  = bytes;
+    p_ctrl->p_buff         = p_buffer;
+    p_ctrl->total          = bytes;
+    p_ctrl->subaddr_remain = 0U;
+    p_ctrl->p_batch        = NULL;
+
+    iic_master_address_setup(p_ctrl, p_ctrl->slave, p_ctrl->addr_mode, direction);
+
+    /* Kickoff the read operation as a master */
+    err = iic_master_run_hw_master(p_ctrl);
+
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+    return FSP_SUCCESS;
+}
 
+/*******************************************************************************************************************//**
+ * Sets up the address bytes and direction of the next transfer.
+ *
+ * @param      p_ctrl          Pointer to control block
+ * @param[in]  slave           Address of the slave device.
+ * @param[in]  addr_mode       Addressing mode of the slave device.
+ * @param[in]  direction       Read or Write
+ **********************************************************************************************************************/
+static void iic_master_address_setup (iic_master_instance_ctrl_t * const p_ctrl,
+                                      uint32_t const                     slave,
+                                      i2c_master_addr_mode_t const       addr_mode,
+                                      iic_master_transfer_dir_t          direction)
+{
     /* Handle the (different) addressing mode(s) */
-    if (p_ctrl->addr_mode == I2C_MASTER_ADDR_MODE_7BIT)
+    if (addr_mode == I2C_MASTER_ADDR_MODE_7BIT)
     {
         /* Set the address bytes according to a 7-bit slave read command */
         p_ctrl->addr_high  = 0U;
-        p_ctrl->addr_low   = (uint8_t) ((p_ctrl->slave << 1U) | (uint8_t) direction);
+        p_ctrl->addr_low   = (uint8_t) ((slave << 1U) | (uint8_t) direction);
         p_ctrl->addr_total = 1U;
     }
 
@@ -601,24 +697,72 @@ static fsp_err_t iic_master_read_write (i2c_master_ctrl_t * const p_api_ctrl,
     else
     {
         /* Set the address bytes according to a 10-bit slave read command */
-        p_ctrl->addr_high = (uint8_t) (((p_ctrl->slave >> 7U) | I2C_CODE_10BIT) & (uint8_t) ~(I2C_CODE_READ));
-        p_ctrl->addr_low  = (uint8_t) p_ctrl->slave;
+        p_ctrl->addr_high = (uint8_t) (((slave >> 7U) | I2C_CODE_10BIT) & (uint8_t) ~(I2C_CODE_READ));
+        p_ctrl->addr_low  = (uint8_t) slave;
 
         /* Addr total = 3 for Read and 2 for Write.
          * See Section 36.3.1 "Communication Data Format" of the RA6M3 manual R01UH0886EJ0100
          */
         p_ctrl->addr_total = (uint8_t) ((uint8_t) direction + IIC_MASTER_SLAVE_10_BIT_ADDR_LEN_ADJUST);
     }
+#else
+    FSP_PARAMETER_NOT_USED(addr_mode);
 #endif
 
     p_ctrl->read = (bool) direction;
+}
 
-    /* Kickoff the read operation as a master */
-    err = iic_master_run_hw_master(p_ctrl);
+/*******************************************************************************************************************//**
+ * Starts the next phase of a batched transfer. A read segment with a sub-address takes two phases: the sub-address is
+ * written first and the payload is read after a restart.
+ *
+ * @param      p_ctrl          Pointer to control block
+ *
+ * @retval  FSP_SUCCESS       Phase started.
+ * @retval  FSP_ERR_IN_USE    Bus busy condition. Another transfer was in progress.
+ **********************************************************************************************************************/
+static fsp_err_t iic_master_batch_next (iic_master_instance_ctrl_t * const p_ctrl)
+{
+    iic_master_batch_segment_t const * p_segment = &p_ctrl->p_batch[p_ctrl->batch_index];
+    iic_master_transfer_dir_t          direction = (iic_master_transfer_dir_t) p_segment->direction;
 
-    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+    p_ctrl->p_buff = p_segment->p_buffer;
 
-    return FSP_SUCCESS;
+    if ((IIC_MASTER_TRANSFER_DIR_READ == direction) && (0U != p_segment->subaddr_bytes) &&
+        (false == p_ctrl->batch_data_phase))
+    {
+        /* Write the sub-address only and restart into the data phase of this segment */
+        direction                = IIC_MASTER_TRANSFER_DIR_WRITE;
+        p_ctrl->total            = 0U;
+        p_ctrl->p_subaddr        = p_segment->p_subaddr;
+        p_ctrl->subaddr_remain   = p_segment->subaddr_bytes;
+        p_ctrl->restart          = true;
+        p_ctrl->batch_data_phase = true;
+    }
+    else
+    {
+        /* The sub-address of a read has already been sent in the previous phase */
+        if (IIC_MASTER_TRANSFER_DIR_READ == direction)
+        {
+            p_ctrl->subaddr_remain = 0U;
+        }
+        else
+        {
+            p_ctrl->p_subaddr      = p_segment->p_subaddr;
+            p_ctrl->subaddr_remain = p_segment->subaddr_bytes;
+        }
+
+        p_ctrl->total            = p_segment->bytes;
+        p_ctrl->batch_data_phase = false;
+        p_ctrl->batch_index++;
+
+        /* Segments are joined with restart conditions; only the last one ends with a stop */
+        p_ctrl->restart = (p_ctrl->batch_index < p_ctrl->batch_length);
+    }
+
+    iic_master_address_setup(p_ctrl, p_segment->slave, p_segment->addr_mode, direction);
+
+    return iic_master_run_hw_master(p_ctrl);
 }
 
 /*******************************************************************************************************************//**
@@ -706,7 +850,7 @@ static void iic_master_notify (iic_master_instance_ctrl_t * const p_ctrl, i2c_ma
 static void iic_master_abort_seq_master (iic_master_instance_ctrl_t * const p_ctrl, bool iic_reset)
 {
     /* Check if there is an in-progress transfer associated with the match or an error event occurred */
-    if ((0U != p_ctrl->remain) || (p_ctrl->restarted) || (true == p_ctrl->err))
+    if ((0U != p_ctrl->remain) || (0U != p_ctrl->subaddr_remain) || (p_ctrl->restarted) || (true == p_ctrl->err))
     {
         /* Reset the peripheral */
         if (true == iic_reset)
@@ -736,7 +880,9 @@ static void iic_master_abort_seq_master (iic_master_instance_ctrl_t * const p_ct
         }
 
         /* Update the transfer descriptor to show no longer in-progress and an error */
-        p_ctrl->remain = 0U;
+        p_ctrl->remain         = 0U;
+        p_ctrl->subaddr_remain = 0U;
+        p_ctrl->p_batch        = NULL;
 
         /* Update the transfer descriptor to make sure interrupts no longer process */
         p_ctrl->addr_loaded = p_ctrl->addr_total;
@@ -1036,6 +1182,11 @@ static void iic_master_txi_master (iic_master_instance_ctrl_t * p_ctrl)
     {
         iic_master_txi_send_address(p_ctrl);
     }
+    /* Issue the sub-address of a batched segment ahead of the data bytes */
+    else if ((!p_ctrl->read) && (0U < p_ctrl->subaddr_remain))
+    {
+        iic_master_txi_send_subaddr(p_ctrl);
+    }
     else if (!p_ctrl->read)
     {
 #if IIC_MASTER_CFG_DTC_ENABLE
@@ -1217,6 +1368,13 @@ static void iic_master_err_master (iic_master_instance_ctrl_t * p_ctrl)
         /* This interrupt will be fired again when wither stop condition is sent
          * or the hardware detects the line is stuck low causing a timeout */
     }
+    /* This is the START from a restart between two phases of a batch. Start the next phase without notifying the
+     * user. The bus is held by the restart, so starting the next phase cannot fail. */
+    else if ((false == p_ctrl->err) && (p_ctrl->restarted) && (errs_events & (uint8_t) IIC_MASTER_ERR_EVENT_START) &&
+             (NULL != p_ctrl->p_batch) && (p_ctrl->batch_index < p_ctrl->batch_length))
+    {
+        (void) iic_master_batch_next(p_ctrl);
+    }
     /* This is a STOP, START or RESTART event. We need to process these events only at the
      * end of the requisite transfers.
      * NOTE: Do not use p_transfer->loaded or p_transfer->remain to check whether the transfer is
@@ -1228,6 +1386,8 @@ static void iic_master_err_master (iic_master_instance_ctrl_t * p_ctrl)
         i2c_master_event_t event = I2C_MASTER_EVENT_ABORTED;
         if (false == p_ctrl->err)      /* Successful transaction */
         {
+            p_ctrl->p_batch = NULL;
+
             /* Get the correct event to notify the user */
             event = (p_ctrl->read) ? I2C_MASTER_EVENT_RX_COMPLETE : I2C_MASTER_EVENT_TX_COMPLETE;
 
@@ -1410,7 +1570,8 @@ static void iic_master_txi_send_address (iic_master_instance_ctrl_t * const p_ct
         /* If this is the last address byte, enable transfer */
         if (1U == p_ctrl->addr_remain)
         {
-            if ((NULL != p_ctrl->p_cfg->p_transfer_tx) && !(p_ctrl->read) && (p_ctrl->total > 0U))
+            if ((NULL != p_ctrl->p_cfg->p_transfer_tx) && !(p_ctrl->read) && (p_ctrl->total > 0U) &&
+                (0U == p_ctrl->subaddr_remain))
             {
                 p_ctrl->p_cfg->p_transfer_tx->p_api->reset(p_ctrl->p_cfg->p_transfer_tx->p_ctrl,
                                                            (void *) (p_ctrl->p_buff),
@@ -1432,6 +1593,37 @@ static void iic_master_txi_send_address (iic_master_instance_ctrl_t * const p_ct
     }
 }
 
+/*******************************************************************************************************************//**
+ * Write the next sub-address byte to the iic bus
+ *
+ * @param[in]       p_ctrl  Pointer to transfer control block
+ **********************************************************************************************************************/
+static void iic_master_txi_send_subaddr (iic_master_instance_ctrl_t * const p_ctrl)
+{
+#if IIC_MASTER_CFG_DTC_ENABLE
+    uint8_t volatile const * p_iic_master_tx_buffer = &(p_ctrl->p_reg->ICDRT);
+
+    /* If this is the last sub-address byte, enable transfer for the data bytes */
+    if ((1U == p_ctrl->subaddr_remain) && (NULL != p_ctrl->p_cfg->p_transfer_tx) && (p_ctrl->total > 0U))
+    {
+        p_ctrl->p_cfg->p_transfer_tx->p_api->reset(p_ctrl->p_cfg->p_transfer_tx->p_ctrl,
+                                                   (void *) (p_ctrl->p_buff),
+                                                   (uint8_t *) (p_iic_master_tx_buffer),
+                                                   (uint16_t) (p_ctrl->remain));
+        p_ctrl->remain            = 0U;
+        p_ctrl->loaded            = p_ctrl->total;
+        p_ctrl->activation_on_txi = true;
+    }
+#endif
+
+    /* Write the sub-address byte */
+    p_ctrl->p_reg->ICDRT = *p_ctrl->p_subaddr;
+
+    /* Update the number of sub-address bytes remaining for next pass */
+    p_ctrl->p_subaddr++;
+    p_ctrl->subaddr_remain--;
+}
+
 #if IIC_MASTER_CFG_DTC_ENABLE
 
 /*******************************************************************************************************************//**
@@ -93,6 +93,9 @@
 /* I2C Bus Status Register 2 Mask */
 #define IIC_SLAVE_STATUS_REGISTER_2_ERR_MASK               (0x1FU)
 
+/* Tests whether a register is set in a register-file bitmap */
+#define IIC_SLAVE_PRV_REGISTER_SELECTED(p_mask, reg)    (0U != ((p_mask)[(reg) >> 5U] & (1UL << ((reg) & 0x1FU))))
+
 /* Register Wait Time */
 
 /* Worst case ratio of (ICLK/PCLKB) = 64 bytes approximately.
@@ -135,13 +138,16 @@ static fsp_err_t iic_slave_read_write(i2c_slave_ctrl_t * const p_api_ctrl,
 static void r_iic_slave_call_callback(iic_slave_instance_ctrl_t * p_ctrl,
                                       i2c_slave_event_t           event,
                                       uint32_t                    transaction_count);
+static void iic_slave_register_file_start(iic_slave_instance_ctrl_t * p_ctrl, iic_slave_transfer_dir_t direction);
 
 /* Functions that manipulate hardware */
 static void iic_open_hw_slave(iic_slave_instance_ctrl_t * const p_ctrl);
 
 /* Interrupt handlers */
 static void iic_rxi_slave(iic_slave_instance_ctrl_t * p_ctrl);
+static void iic_rxi_slave_register_file(iic_slave_instance_ctrl_t * p_ctrl);
 static void iic_txi_slave(iic_slave_instance_ctrl_t * p_ctrl);
+static void iic_txi_slave_register_file(iic_slave_instance_ctrl_t * p_ctrl);
 static void iic_tei_slave(iic_slave_instance_ctrl_t * p_ctrl);
 static void iic_err_slave(iic_slave_instance_ctrl_t * p_ctrl);
 
@@ -240,6 +246,8 @@ fsp_err_t R_IIC_SLAVE_Open (i2c_slave_ctrl_t * const p_api_ctrl, i2c_slave_cfg_t
     R_BSP_IrqCfgEnable(p_ctrl->p_cfg->tei_irq, p_ctrl->p_cfg->ipl, p_ctrl);
     R_BSP_IrqCfgEnable(p_ctrl->p_cfg->rxi_irq, p_ctrl->p_cfg->ipl, p_ctrl);
 
+    BSP_TRACE(FSP_IP_IIC, p_cfg->channel, BSP_TRACE_EVENT_OPEN, 0U);
+
     /* Finally, we can consider the device opened */
     p_ctrl->p_buff                = NULL;
     p_ctrl->total                 = 0U;
@@ -252,6 +260,15 @@ fsp_err_t R_IIC_SLAVE_Open (i2c_slave_ctrl_t * const p_api_ctrl, i2c_slave_cfg_t
     p_ctrl->notify_request    = false;
     p_ctrl->transaction_count = 0U;
 
+    /* Start in buffer mode */
+    p_ctrl->p_register_file      = NULL;
+    p_ctrl->register_pointer     = 0U;
+    p_ctrl->register_write_first = 0U;
+    p_ctrl->register_write_start = 0U;
+    p_ctrl->register_write_bytes = 0U;
+    p_ctrl->register_addr_remain = 0U;
+    p_ctrl->register_notify      = false;
+
     return FSP_SUCCESS;
 }
 
@@ -266,7 +283,7 @@ fsp_err_t R_IIC_SLAVE_Open (i2c_slave_ctrl_t * const p_api_ctrl, i2c_slave_cfg_t
  *
  * @retval  FSP_SUCCESS        Function executed without issue
  * @retval  FSP_ERR_ASSERTION  p_api_ctrl, bytes or p_dest is NULL.
- * @retval  FSP_ERR_IN_USE     Another transfer was in progress.
+ * @retval  FSP_ERR_IN_USE     Another transfer was in progress or register-file mode is active.
  * @retval  FSP_ERR_NOT_OPEN   Device is not open.
  *********************************************************************************************************************/
 fsp_err_t R_IIC_SLAVE_Read (i2c_slave_ctrl_t * const p_api_ctrl, uint8_t * const p_dest, uint32_t const bytes)
@@ -289,7 +306,7 @@ fsp_err_t R_IIC_SLAVE_Read (i2c_slave_ctrl_t * const p_api_ctrl, uint8_t * const
  *
  * @retval  FSP_SUCCESS        Function executed without issue.
  * @retval  FSP_ERR_ASSERTION  p_api_ctrl or p_src is NULL.
- * @retval  FSP_ERR_IN_USE     Another transfer was in progress.
+ * @retval  FSP_ERR_IN_USE     Another transfer was in progress or register-file mode is active.
  * @retval  FSP_ERR_NOT_OPEN   Device is not open.
  *********************************************************************************************************************/
 fsp_err_t R_IIC_SLAVE_Write (i2c_slave_ctrl_t * const p_api_ctrl, uint8_t * const p_src, uint32_t const bytes)
@@ -351,6 +368,87 @@ fsp_err_t R_IIC_SLAVE_CallbackSet (i2c_slave_ctrl_t * const          p_api_ctrl,
     return FSP_SUCCESS;
 }
 
+/*******************************************************************************************************************//**
+ * Serves master transactions from a register file in the interrupt handlers instead of application buffers. Pass NULL
+ * to return to buffer mode.
+ *
+ * A master write sets the register pointer from its first addr_bytes bytes and stores any further bytes in consecutive
+ * registers. Bytes written to registers not set in p_write_mask are acknowledged and discarded. A master read returns
+ * consecutive registers starting at the register pointer. The pointer wraps at the end of the register file. No
+ * callback is needed to serve a transaction, so the clock is not stretched waiting for the application.
+ *
+ * The callback is invoked with I2C_SLAVE_EVENT_RX_COMPLETE at the end of a master write that changed a register set in
+ * p_notify_mask (see @ref R_IIC_SLAVE_RegisterFileWriteGet), and with I2C_SLAVE_EVENT_ABORTED on bus errors. No other
+ * events are reported and the callback may be NULL. General calls are NACKed.
+ *
+ * The application may update the registers at any time. Disable the RXI and TXI interrupts around updates of
+ * multi-byte values that the master must not read half-updated.
+ *
+ * @retval  FSP_SUCCESS        Register-file mode updated.
+ * @retval  FSP_ERR_ASSERTION  p_api_ctrl is NULL, or the register file is empty or has an invalid address size.
+ * @retval  FSP_ERR_NOT_OPEN   Device is not open.
+ * @retval  FSP_ERR_IN_USE     A transaction is in progress.
+ **********************************************************************************************************************/
+fsp_err_t R_IIC_SLAVE_RegisterFileSet (i2c_slave_ctrl_t * const                p_api_ctrl,
+                                       iic_slave_register_file_t const * const p_register_file)
+{
+    iic_slave_instance_ctrl_t * p_ctrl = (iic_slave_instance_ctrl_t *) p_api_ctrl;
+
+#if IIC_SLAVE_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(p_ctrl != NULL);
+    FSP_ERROR_RETURN(IIC_SLAVE_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+
+    if (NULL != p_register_file)
+    {
+        FSP_ASSERT(p_register_file->p_registers != NULL);
+        FSP_ASSERT(p_register_file->size > 0U);
+        FSP_ASSERT((1U == p_register_file->addr_bytes) || (2U == p_register_file->addr_bytes));
+    }
+
+    /* Fail if there is already a transfer in progress */
+    FSP_ERROR_RETURN(IIC_SLAVE_TRANSFER_DIR_NOT_ESTABLISHED == p_ctrl->direction, FSP_ERR_IN_USE);
+#endif
+
+    p_ctrl->register_pointer     = 0U;
+    p_ctrl->register_write_first = 0U;
+    p_ctrl->register_write_start = 0U;
+    p_ctrl->register_write_bytes = 0U;
+    p_ctrl->register_notify      = false;
+    p_ctrl->p_register_file      = p_register_file;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Gets the register range changed by the last master write that was notified in register-file mode. Call this from
+ * the I2C_SLAVE_EVENT_RX_COMPLETE callback.
+ *
+ * The range starts at p_start and spans p_bytes data bytes, wrapping at the end of the register file. It may include
+ * registers that are not set in p_write_mask and were not written.
+ *
+ * @retval  FSP_SUCCESS        Range returned.
+ * @retval  FSP_ERR_ASSERTION  A required pointer is NULL.
+ * @retval  FSP_ERR_NOT_OPEN   Device is not open.
+ **********************************************************************************************************************/
+fsp_err_t R_IIC_SLAVE_RegisterFileWriteGet (i2c_slave_ctrl_t * const p_api_ctrl,
+                                            uint32_t * const         p_start,
+                                            uint32_t * const         p_bytes)
+{
+    iic_slave_instance_ctrl_t * p_ctrl = (iic_slave_instance_ctrl_t *) p_api_ctrl;
+
+#if IIC_SLAVE_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(p_ctrl != NULL);
+    FSP_ASSERT(p_start != NULL);
+    FSP_ASSERT(p_bytes != NULL);
+    FSP_ERROR_RETURN(IIC_SLAVE_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+
+    *p_start = p_ctrl->register_write_start;
+    *p_bytes = p_ctrl->register_write_bytes;
+
+    return FSP_SUCCESS;
+}
+
 /******************************************************************************************************************//**
  * Closes the I2C device.
  *
@@ -372,6 +470,8 @@ fsp_err_t R_IIC_SLAVE_Close (i2c_slave_ctrl_t * const p_api_ctrl)
     /* The device is now considered closed */
     p_ctrl->open = 0U;
 
+    BSP_TRACE(FSP_IP_IIC, p_ctrl->p_cfg->channel, BSP_TRACE_EVENT_CLOSE, 0U);
+
     /* Clear all interrupt bits */
     p_ctrl->p_reg->ICIER = 0U;
 
@@ -442,9 +542,18 @@ static fsp_err_t iic_slave_read_write (i2c_slave_ctrl_t * const p_api_ctrl,
     /* Fail if there is already a transfer in progress */
     FSP_ERROR_RETURN(IIC_SLAVE_TRANSFER_DIR_NOT_ESTABLISHED == p_ctrl->direction, FSP_ERR_IN_USE);
 
+    /* Transactions are served from the register file in register-file mode */
+    FSP_ERROR_RETURN(NULL == p_ctrl->p_register_file, FSP_ERR_IN_USE);
+
     FSP_ASSERT(((iic_slave_instance_ctrl_t *) p_api_ctrl)->p_callback != NULL);
 #endif
 
+    BSP_TRACE(FSP_IP_IIC,
+              p_ctrl->p_cfg->channel,
+              (IIC_SLAVE_TRANSFER_DIR_MASTER_READ_SLAVE_WRITE == direction) ?
+              BSP_TRACE_EVENT_WRITE : BSP_TRACE_EVENT_READ,
+              bytes);
+
     /* Record the new information about this transfer */
     p_ctrl->p_buff    = p_buffer;
     p_ctrl->total     = bytes;
@@ -523,8 +632,28 @@ static void iic_slave_notify (iic_slave_instance_ctrl_t * const p_ctrl, i2c_slav
 
     p_ctrl->direction = IIC_SLAVE_TRANSFER_DIR_NOT_ESTABLISHED;
 
-    /* Invoke the callback */
-    r_iic_slave_call_callback(p_ctrl, slave_event, transaction_count);
+    if (NULL == p_ctrl->p_register_file)
+    {
+        /* Invoke the callback */
+        r_iic_slave_call_callback(p_ctrl, slave_event, transaction_count);
+    }
+    else
+    {
+        /* In register-file mode only writes to registers selected for notification and errors are reported */
+        bool notify = p_ctrl->register_notify && (I2C_SLAVE_EVENT_RX_COMPLETE == slave_event);
+        p_ctrl->register_notify = false;
+
+        if (notify)
+        {
+            p_ctrl->register_write_start = p_ctrl->register_write_first;
+            p_ctrl->register_write_bytes = transaction_count;
+        }
+
+        if ((NULL != p_ctrl->p_callback) && (notify || (I2C_SLAVE_EVENT_ABORTED == slave_event)))
+        {
+            r_iic_slave_call_callback(p_ctrl, slave_event, transaction_count);
+        }
+    }
 }
 
 /*******************************************************************************************************************//**
@@ -720,6 +849,8 @@ static void r_iic_slave_call_callback (iic_slave_instance_ctrl_t * p_ctrl,
 {
     i2c_slave_callback_args_t args;
 
+    BSP_TRACE(FSP_IP_IIC, p_ctrl->p_cfg->channel, event, transaction_count);
+
     /* Store callback arguments in memory provided by user if available.  This allows callback arguments to be
      * stored in non-secure memory so they can be accessed by a non-secure callback function. */
     i2c_slave_callback_args_t * p_args = p_ctrl->p_callback_memory;
@@ -765,6 +896,105 @@ static void r_iic_slave_call_callback (iic_slave_instance_ctrl_t * p_ctrl,
     }
 }
 
+/*******************************************************************************************************************//**
+ * Sets up a register-file transaction on the first data byte after an address match. This takes the place of the
+ * request callback in buffer mode.
+ *
+ * @param      p_ctrl          Pointer to the control structure.
+ * @param[in]  direction       Direction of the transaction.
+ **********************************************************************************************************************/
+static void iic_slave_register_file_start (iic_slave_instance_ctrl_t * p_ctrl, iic_slave_transfer_dir_t direction)
+{
+    /* Set the status flag to ensure this is executed only once per transaction */
+    p_ctrl->notify_request        = true;
+    p_ctrl->direction             = direction;
+    p_ctrl->transaction_completed = false;
+    p_ctrl->register_notify       = false;
+    p_ctrl->register_addr_remain  =
+        (IIC_SLAVE_TRANSFER_DIR_MASTER_WRITE_SLAVE_READ == direction) ? p_ctrl->p_register_file->addr_bytes : 0U;
+
+    /* Set the response as ACK */
+    p_ctrl->p_reg->ICMR3_b.ACKWP = 1;
+    p_ctrl->p_reg->ICMR3_b.ACKBT = 0;
+    p_ctrl->p_reg->ICMR3_b.ACKWP = 0;
+
+    /* Clear the Start and Stop condition flags and enable their detection together with the error conditions */
+    p_ctrl->p_reg->ICSR2 &= ((uint8_t) ~((uint8_t) ICSR2_STOP_BIT | (uint8_t) ICSR2_START_BIT));
+    p_ctrl->p_reg->ICIER  = (uint8_t) ((uint8_t) IIC_STP_EN_BIT |
+                                       (uint8_t) IIC_STR_EN_BIT |
+                                       (uint8_t) IIC_TMO_EN_BIT |
+                                       (uint8_t) IIC_ALD_EN_BIT |
+                                       (uint8_t) IIC_NAK_EN_BIT |
+                                       (uint8_t) IIC_RXI_EN_BIT |
+                                       (uint8_t) IIC_TXI_EN_BIT);
+
+    /* Allow timeouts to be generated on the low value of SCL using long count mode */
+    p_ctrl->p_reg->ICMR2 = IIC_SLAVE_BUS_MODE_REGISTER_2_MASK;
+
+    /* Enable timeout function. Timeouts are disabled at the end of a IIC Slave transaction. */
+    p_ctrl->p_reg->ICFER_b.TMOE = 1;
+}
+
+/******************************************************************************************************************//**
+ * Handles the receive data full interrupt when operating as a slave in register-file mode. The first bytes of a master
+ * write set the register pointer, further bytes are stored in the register file.
+ *
+ * @param[in]       p_ctrl     The target IIC block's control block.
+ *********************************************************************************************************************/
+static void iic_rxi_slave_register_file (iic_slave_instance_ctrl_t * p_ctrl)
+{
+    iic_slave_register_file_t const * p_file = p_ctrl->p_register_file;
+
+    if (!p_ctrl->notify_request)
+    {
+        iic_slave_register_file_start(p_ctrl, IIC_SLAVE_TRANSFER_DIR_MASTER_WRITE_SLAVE_READ);
+    }
+
+    /* Read data, this will also release SCL */
+    uint8_t data = p_ctrl->p_reg->ICDRR;
+
+    if (R_IIC0_ICSR1_GCA_Msk == (p_ctrl->p_reg->ICSR1 & R_IIC0_ICSR1_GCA_Msk))
+    {
+        /* General calls are not served in register-file mode. Set the response as NACK to end the transaction. */
+        p_ctrl->p_reg->ICMR3_b.ACKWP = 1;
+        p_ctrl->p_reg->ICMR3_b.ACKBT = 1;
+        p_ctrl->p_reg->ICMR3_b.ACKWP = 0;
+    }
+    else if (p_ctrl->register_addr_remain > 0U)
+    {
+        /* Register address, MSB first */
+        p_ctrl->register_pointer = (p_ctrl->register_addr_remain == p_file->addr_bytes) ?
+                                   data : ((p_ctrl->register_pointer << 8U) | data);
+        p_ctrl->register_addr_remain--;
+
+        if (0U == p_ctrl->register_addr_remain)
+        {
+            /* Addresses beyond the end of the register file wrap around */
+            p_ctrl->register_pointer    %= p_file->size;
+            p_ctrl->register_write_first = p_ctrl->register_pointer;
+        }
+    }
+    else
+    {
+        uint32_t reg = p_ctrl->register_pointer;
+
+        if ((NULL == p_file->p_write_mask) || IIC_SLAVE_PRV_REGISTER_SELECTED(p_file->p_write_mask, reg))
+        {
+            p_file->p_registers[reg] = data;
+
+            if ((NULL != p_file->p_notify_mask) && IIC_SLAVE_PRV_REGISTER_SELECTED(p_file->p_notify_mask, reg))
+            {
+                p_ctrl->register_notify = true;
+            }
+        }
+
+        p_ctrl->register_pointer = (reg + 1U < p_file->size) ? (reg + 1U) : 0U;
+
+        /* Keep track of the the actual number of transactions */
+        p_ctrl->transaction_count++;
+    }
+}
+
 /******************************************************************************************************************//**
  * Handles the receive data full interrupt when operating as a slave.
  *
@@ -794,6 +1024,10 @@ static void iic_rxi_slave (iic_slave_instance_ctrl_t * p_ctrl)
                                           (uint8_t) IIC_TXI_EN_BIT |
                                           (uint8_t) IIC_STP_EN_BIT);
     }
+    else if (NULL != p_ctrl->p_register_file)
+    {
+        iic_rxi_slave_register_file(p_ctrl);
+    }
     else
     {
         /* Check if the read request event has been notified through callback, if not provide the callback */
@@ -939,6 +1173,29 @@ static void iic_txi_slave (iic_slave_instance_ctrl_t * p_ctrl)
     }
 }
 
+/******************************************************************************************************************//**
+ * Handles the transmit data empty interrupt when operating as a slave in register-file mode. Registers are sent
+ * starting at the register pointer until the master NACKs.
+ *
+ * @param[in]       p_ctrl     The target IIC block's control block.
+ *********************************************************************************************************************/
+static void iic_txi_slave_register_file (iic_slave_instance_ctrl_t * p_ctrl)
+{
+    iic_slave_register_file_t const * p_file = p_ctrl->p_register_file;
+
+    if (!p_ctrl->notify_request)
+    {
+        iic_slave_register_file_start(p_ctrl, IIC_SLAVE_TRANSFER_DIR_MASTER_READ_SLAVE_WRITE);
+    }
+
+    /* Write the register, this will also release SCL */
+    p_ctrl->p_reg->ICDRT     = p_file->p_registers[p_ctrl->register_pointer];
+    p_ctrl->register_pointer = (p_ctrl->register_pointer + 1U < p_file->size) ? (p_ctrl->register_pointer + 1U) : 0U;
+
+    /* Keep track of the the actual number of transactions */
+    p_ctrl->transaction_count++;
+}
+
 /******************************************************************************************************************//**
  * Handles the transmission end interrupt when operating as a slave.
  *
@@ -1015,6 +1272,17 @@ static void iic_err_slave (iic_slave_instance_ctrl_t * p_ctrl)
             {
                 p_ctrl->transaction_count -= 1U;
             }
+
+            /* In register-file mode the register after the last one read by the master has always been loaded.
+             * Step the register pointer back so the next read starts with it. */
+            if ((NULL != p_ctrl->p_register_file) &&
+                (IIC_SLAVE_TRANSFER_DIR_MASTER_READ_SLAVE_WRITE == p_ctrl->direction) &&
+                (p_ctrl->transaction_count > 0U))
+            {
+                p_ctrl->transaction_count -= 1U;
+                p_ctrl->register_pointer   = (p_ctrl->register_pointer > 0U) ?
+                                             (p_ctrl->register_pointer - 1U) : (p_ctrl->p_register_file->size - 1U);
+            }
         }
 
         /* Notify the user */
@@ -1087,7 +1355,14 @@ void iic_slave_txi_isr (void)
     IRQn_Type irq = R_FSP_CurrentIrqGet();
     iic_slave_instance_ctrl_t * p_ctrl = (iic_slave_instance_ctrl_t *) R_FSP_IsrContextGet(irq);
 
-    iic_txi_slave(p_ctrl);
+    if (NULL != p_ctrl->p_register_file)
+    {
+        iic_txi_slave_register_file(p_ctrl);
+    }
+    else
+    {
+        iic_txi_slave(p_ctrl);
+    }
 
     /* Restore context if RTOS is used */
     FSP_CONTEXT_RESTORE
@@ -66,6 +66,9 @@
 #define IOPORT_PRV_SET_PWPR_PFSWE         (0x40U)
 #define IOPORT_PRV_SET_PWPR_BOWI          (0x80U)
 
+/* Maximum number of words in one output stream (16-bit transfer count). */
+#define IOPORT_PRV_STREAM_WORDS_MAX       (0xFFFFU)
+
 #define IOPORT_PRV_PORT_ADDRESS(port_number)    ((uint32_t) (R_PORT1 - R_PORT0) * (port_number) + R_PORT0)
 
 /***********************************************************************************************************************
@@ -84,6 +87,8 @@ static void r_ioport_hw_pin_event_output_data_write(bsp_io_port_t  port,
 
 static void r_ioport_pfs_write(bsp_io_port_pin_t pin, uint32_t value);
 
+static void r_ioport_stream_end(ioport_instance_ctrl_t * const p_instance_ctrl);
+
 #if BSP_MCU_VBATT_SUPPORT
 static void bsp_vbatt_init(ioport_cfg_t const * const p_pin_cfg); // Used internally by BSP
 
@@ -165,7 +170,8 @@ fsp_err_t R_IOPORT_Open (ioport_ctrl_t * const p_ctrl, const ioport_cfg_t * p_cf
 #endif
 
     /* Set driver status to open */
-    p_instance_ctrl->open = IOPORT_OPEN;
+    p_instance_ctrl->open         = IOPORT_OPEN;
+    p_instance_ctrl->p_stream_cfg = NULL;
 
     r_ioport_pins_config(p_cfg);
 
@@ -191,6 +197,12 @@ fsp_err_t R_IOPORT_Close (ioport_ctrl_t * const p_ctrl)
     FSP_PARAMETER_NOT_USED(p_ctrl);
 #endif
 
+    /* Stop an output stream left running. */
+    if (NULL != p_instance_ctrl->p_stream_cfg)
+    {
+        r_ioport_stream_end(p_instance_ctrl);
+    }
+
     /* Set state to closed */
     p_instance_ctrl->open = IOPORT_CLOSED;
 
@@ -737,6 +749,117 @@ fsp_err_t R_IOPORT_EthernetModeCfg (ioport_ctrl_t * const     p_ctrl,
     return FSP_SUCCESS;
 }
 
+/*******************************************************************************************************************//**
+ * Streams words to a port at a fixed rate, for parallel buses emulated in software (for example an 8080 display
+ * interface or a custom FPGA link). Each word is written to PCNTR3 by the DTC or DMAC when the pacing timer fires, so
+ * only the pins selected by the word change and the rest of the port is unaffected. Build the words with
+ * IOPORT_PCNTR3_WORD; a write strobe is produced by driving it low in one word and high in the next.
+ *
+ * The pins must already be configured as outputs. The stream ends after count words; call R_IOPORT_PortStreamStop
+ * from the transfer callback or afterwards to stop the timer and release the transfer.
+ *
+ * @retval FSP_SUCCESS                  Stream started
+ * @retval FSP_ERR_ASSERTION            NULL pointer, or count is 0 or too large for one transfer
+ * @retval FSP_ERR_NOT_OPEN             The module has not been opened
+ * @retval FSP_ERR_IN_USE               A stream is already running
+ * @return                              See @ref RENESAS_ERROR_CODES or functions called by this function for other
+ *                                      possible return codes. This function calls:
+ *                                          * @ref transfer_api_t::open
+ *                                          * @ref transfer_api_t::reconfigure
+ *                                          * @ref timer_api_t::reset
+ *                                          * @ref timer_api_t::start
+ *
+ * @note The words must stay valid until the stream ends.
+ **********************************************************************************************************************/
+fsp_err_t R_IOPORT_PortStreamStart (ioport_ctrl_t * const             p_ctrl,
+                                    ioport_stream_cfg_t const * const p_stream_cfg,
+                                    uint32_t const * const            p_words,
+                                    uint32_t                          count)
+{
+    ioport_instance_ctrl_t * p_instance_ctrl = (ioport_instance_ctrl_t *) p_ctrl;
+
+#if (1 == IOPORT_CFG_PARAM_CHECKING_ENABLE)
+    FSP_ASSERT(NULL != p_instance_ctrl);
+    FSP_ERROR_RETURN(IOPORT_OPEN == p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
+    FSP_ASSERT(NULL != p_stream_cfg);
+    FSP_ASSERT(NULL != p_stream_cfg->p_transfer);
+    FSP_ASSERT(NULL != p_stream_cfg->p_timer);
+    FSP_ASSERT(NULL != p_words);
+    FSP_ASSERT((count > 0U) && (count <= IOPORT_PRV_STREAM_WORDS_MAX));
+#endif
+
+    FSP_ERROR_RETURN(NULL == p_instance_ctrl->p_stream_cfg, FSP_ERR_IN_USE);
+
+    transfer_instance_t const * p_transfer = p_stream_cfg->p_transfer;
+    timer_instance_t const    * p_timer    = p_stream_cfg->p_timer;
+
+    /* Get the port address */
+    R_PORT0_Type * p_ioport_regs = IOPORT_PRV_PORT_ADDRESS((p_stream_cfg->port >> IOPORT_PRV_PORT_OFFSET) &
+                                                           IOPORT_PRV_8BIT_MASK);
+
+    /* One 32-bit PCNTR3 write per timer event. */
+    transfer_info_t * p_info = p_transfer->p_cfg->p_info;
+    p_info->transfer_settings_word = 0U;
+    p_info->mode                   = TRANSFER_MODE_NORMAL;
+    p_info->size                   = TRANSFER_SIZE_4_BYTE;
+    p_info->src_addr_mode          = TRANSFER_ADDR_MODE_INCREMENTED;
+    p_info->dest_addr_mode         = TRANSFER_ADDR_MODE_FIXED;
+    p_info->irq                    = TRANSFER_IRQ_END;
+    p_info->p_src                  = p_words;
+    p_info->p_dest                 = (void *) &p_ioport_regs->PCNTR3;
+    p_info->length                 = (uint16_t) count;
+
+    fsp_err_t err = p_transfer->p_api->open(p_transfer->p_ctrl, p_transfer->p_cfg);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+    err = p_transfer->p_api->reconfigure(p_transfer->p_ctrl, p_info);
+    if (FSP_SUCCESS == err)
+    {
+        /* Start pacing from a full period so the first word has the same spacing as the rest. */
+        err = p_timer->p_api->reset(p_timer->p_ctrl);
+    }
+
+    if (FSP_SUCCESS == err)
+    {
+        err = p_timer->p_api->start(p_timer->p_ctrl);
+    }
+
+    if (FSP_SUCCESS != err)
+    {
+        (void) p_transfer->p_api->close(p_transfer->p_ctrl);
+
+        return err;
+    }
+
+    p_instance_ctrl->p_stream_cfg = p_stream_cfg;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Stops an output stream started by R_IOPORT_PortStreamStart. The port keeps the levels of the last word written.
+ *
+ * @retval FSP_SUCCESS                  Stream stopped
+ * @retval FSP_ERR_ASSERTION            NULL pointer
+ * @retval FSP_ERR_NOT_OPEN             The module has not been opened
+ * @retval FSP_ERR_NOT_ENABLED          No stream is running
+ **********************************************************************************************************************/
+fsp_err_t R_IOPORT_PortStreamStop (ioport_ctrl_t * const p_ctrl)
+{
+    ioport_instance_ctrl_t * p_instance_ctrl = (ioport_instance_ctrl_t *) p_ctrl;
+
+#if (1 == IOPORT_CFG_PARAM_CHECKING_ENABLE)
+    FSP_ASSERT(NULL != p_instance_ctrl);
+    FSP_ERROR_RETURN(IOPORT_OPEN == p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+
+    FSP_ERROR_RETURN(NULL != p_instance_ctrl->p_stream_cfg, FSP_ERR_NOT_ENABLED);
+
+    r_ioport_stream_end(p_instance_ctrl);
+
+    return FSP_SUCCESS;
+}
+
 /*******************************************************************************************************************//**
  * @} (end addtogroup IOPORT)
  **********************************************************************************************************************/
@@ -745,6 +868,21 @@ fsp_err_t R_IOPORT_EthernetModeCfg (ioport_ctrl_t * const     p_ctrl,
  * Private Functions
  **********************************************************************************************************************/
 
+/*******************************************************************************************************************//**
+ * Stops the pacing timer and closes the transfer of the output stream.
+ *
+ * @param[in] p_instance_ctrl  Pointer to the control block.
+ **********************************************************************************************************************/
+static void r_ioport_stream_end (ioport_instance_ctrl_t * const p_instance_ctrl)
+{
+    ioport_stream_cfg_t const * p_stream_cfg = p_instance_ctrl->p_stream_cfg;
+
+    (void) p_stream_cfg->p_timer->p_api->stop(p_stream_cfg->p_timer->p_ctrl);
+    (void) p_stream_cfg->p_transfer->p_api->close(p_stream_cfg->p_transfer->p_ctrl);
+
+    p_instance_ctrl->p_stream_cfg = NULL;
+}
+
 /*******************************************************************************************************************//**
  * Configures pins.
  *
@@ -385,6 +385,11 @@ fsp_err_t R_JPEG_OutputBufferSet (jpeg_ctrl_t * p_api_ctrl, void * p_output_buff
  * @note   When encoding images the minimum data buffer size is 8 lines by 16 Y'CbCr 4:2:2 pixels (256 bytes).  This
  *         corresponds to one minimum coded unit (MCU) of the resulting JPEG output.
  *
+ * @note   With JPEG_CFG_ENCODE_STREAM_ENABLE each encode callback reports the compressed data of the lines encoded
+ *         since the previous one in jpeg_callback_args_t::p_chunk, so the input buffer size sets the chunk size. The
+ *         codec writes to one contiguous output buffer, so it must still hold the whole image, but the data can be
+ *         sent as soon as it is reported.
+ *
  * @retval        FSP_SUCCESS                    The input data buffer is properly assigned to JPEG Codec device.
  * @retval        FSP_ERR_ASSERTION              Pointer to the control block is NULL, or the pointer to the input_buffer is
  *                                               NULL, or the input_buffer_size is 0.
@@ -442,6 +447,12 @@ fsp_err_t R_JPEG_InputBufferSet (jpeg_ctrl_t * const p_api_ctrl, void * p_data_b
             /* Clear lines encoded */
             p_ctrl->total_lines_encoded = 0U;
 
+ #if JPEG_CFG_ENCODE_STREAM_ENABLE
+
+            /* Nothing of the new image has been reported yet */
+            p_ctrl->stream_offset = 0U;
+ #endif
+
             /* Start the encoder */
 
             /* If the vertical resolution is greater than or equal to the number of lines to encode the encoder does not
@@ -1564,6 +1575,23 @@ void jpeg_jdti_isr ()
                 args.image_size = p_ctrl->output_buffer_size;
                 args.status     = p_ctrl->status;
                 args.p_context  = p_ctrl->p_cfg->p_encode_context;
+
+ #if JPEG_CFG_ENCODE_STREAM_ENABLE
+
+                /* The codec writes the output in 8-byte units, so while paused only the aligned part is in memory. The
+                 * correction at the end rewrites the first bytes with the values the codec wrote there at the start,
+                 * so a chunk already sent stays valid. */
+                uint32_t stream_end = p_ctrl->output_buffer_size;
+                if (!((uint32_t) JPEG_STATUS_OPERATION_COMPLETE & (uint32_t) p_ctrl->status))
+                {
+                    stream_end &= ~((uint32_t) JPEG_PRV_ALIGNMENT_8);
+                }
+
+                args.p_chunk          = (uint8_t const *) R_JPEG->JIFEDA + p_ctrl->stream_offset;
+                args.chunk_size       = stream_end - p_ctrl->stream_offset;
+                p_ctrl->stream_offset = stream_end;
+ #endif
+
                 p_ctrl->p_cfg->p_encode_callback(&args);
             }
         }
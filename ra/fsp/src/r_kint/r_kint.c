@@ -51,11 +51,12 @@ static const fsp_version_t g_kint_version =
 /* KeyMatrix Implementation of Key Interrupt  */
 const keymatrix_api_t g_keymatrix_on_kint =
 {
-    .open       = R_KINT_Open,
-    .enable     = R_KINT_Enable,
-    .disable    = R_KINT_Disable,
-    .close      = R_KINT_Close,
-    .versionGet = R_KINT_VersionGet
+    .open        = R_KINT_Open,
+    .enable      = R_KINT_Enable,
+    .disable     = R_KINT_Disable,
+    .callbackSet = R_KINT_CallbackSet,
+    .close       = R_KINT_Close,
+    .versionGet  = R_KINT_VersionGet
 };
 
 /***********************************************************************************************************************
@@ -99,7 +100,10 @@ fsp_err_t R_KINT_Open (keymatrix_ctrl_t * const p_api_ctrl, keymatrix_cfg_t cons
     FSP_ERROR_RETURN(p_cfg->channel_mask <= UINT8_MAX, FSP_ERR_IP_CHANNEL_NOT_PRESENT);
 #endif
 
-    p_ctrl->p_cfg = p_cfg;
+    p_ctrl->p_cfg             = p_cfg;
+    p_ctrl->p_callback        = p_cfg->p_callback;
+    p_ctrl->p_context         = p_cfg->p_context;
+    p_ctrl->p_callback_memory = NULL;
 
     /* Configure the trigger edge. */
     R_KINT->KRCTL = (uint8_t) p_cfg->trigger | R_KINT_KRCTL_KRMD_Msk;
@@ -210,6 +214,35 @@ fsp_err_t R_KINT_Disable (keymatrix_ctrl_t * const p_api_ctrl)
     return FSP_SUCCESS;
 }
 
+/*******************************************************************************************************************//**
+ * Updates the user callback with the option to provide memory for the callback argument structure.
+ * Implements @ref keymatrix_api_t::callbackSet.
+ *
+ * @retval FSP_SUCCESS        Callback updated successfully.
+ * @retval FSP_ERR_ASSERTION  A required pointer is NULL.
+ * @retval FSP_ERR_NOT_OPEN   The control block has not been opened.
+ **********************************************************************************************************************/
+fsp_err_t R_KINT_CallbackSet (keymatrix_ctrl_t * const          p_api_ctrl,
+                              void (                         * p_callback)(keymatrix_callback_args_t *),
+                              void const * const               p_context,
+                              keymatrix_callback_args_t * const p_callback_memory)
+{
+    kint_instance_ctrl_t * p_ctrl = (kint_instance_ctrl_t *) p_api_ctrl;
+
+#if KINT_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ASSERT(NULL != p_callback);
+    FSP_ERROR_RETURN(p_ctrl->open == KINT_OPEN, FSP_ERR_NOT_OPEN);
+#endif
+
+    /* Store callback and context */
+    p_ctrl->p_callback        = p_callback;
+    p_ctrl->p_context         = p_context;
+    p_ctrl->p_callback_memory = p_callback_memory;
+
+    return FSP_SUCCESS;
+}
+
 /*******************************************************************************************************************//**
  * Set driver version based on compile time macros.
  *
@@ -262,15 +295,20 @@ void key_int_isr (void)
      *   21.3.2 Operation when using the key interrupt flags in the RA6M3 manual R01UH0886EJ0100). */
     R_KINT->KRF = (uint8_t) ~status;
 
-    /* Set data to identify callback to user. */
-    keymatrix_callback_args_t cb_data =
+    /* Use the callback argument memory if it was provided, otherwise build the arguments on the stack. */
+    keymatrix_callback_args_t   cb_data;
+    keymatrix_callback_args_t * p_args = p_ctrl->p_callback_memory;
+    if (NULL == p_args)
     {
-        .channel_mask = status,
-        .p_context    = p_ctrl->p_cfg->p_context
-    };
+        p_args = &cb_data;
+    }
+
+    /* Set data to identify callback to user. */
+    p_args->channel_mask = status;
+    p_args->p_context    = p_ctrl->p_context;
 
     /* Call the callback function. */
-    p_ctrl->p_cfg->p_callback(&cb_data);
+    p_ctrl->p_callback(p_args);
 
     /* Restore context if RTOS is used. */
     FSP_CONTEXT_RESTORE
@@ -23,6 +23,7 @@
  **********************************************************************************************************************/
 
 #include "bsp_api.h"
+#include <string.h>
 #include "r_lpm.h"
 
 /***********************************************************************************************************************
@@ -58,6 +59,13 @@
 
 #define LPM_OPEN                             (0x524c504d)
 
+/* Cycle counts are measured with the DWT cycle counter when profiling or collecting fast resume statistics. */
+#if (LPM_CFG_PROFILE_ENABLE || LPM_CFG_FAST_RESUME_ENABLE) && BSP_FEATURE_DWT_CYCCNT
+ #define LPM_PRV_PROFILE_CYCLES_GET()        (DWT->CYCCNT)
+#else
+ #define LPM_PRV_PROFILE_CYCLES_GET()        (0U)
+#endif
+
 /***********************************************************************************************************************
  * Typedef definitions
  **********************************************************************************************************************/
@@ -114,7 +122,23 @@ const lpm_api_t g_lpm_on_lpm =
 static fsp_err_t r_lpm_configure(lpm_cfg_t const * const p_cfg);
 static fsp_err_t r_lpm_low_power_enter(lpm_instance_ctrl_t * const p_instance_ctrl);
 static fsp_err_t r_lpm_check_clocks(uint32_t clock_source);
-static void      r_lpm_wait_for_operating_mode_flags(void);
+static uint32_t  r_lpm_wait_for_operating_mode_flags(void);
+
+#if LPM_CFG_PROFILE_ENABLE
+static uint32_t r_lpm_profile_elapsed_get(lpm_instance_ctrl_t * const p_ctrl);
+static void     r_lpm_profile_enter(lpm_instance_ctrl_t * const p_ctrl);
+static void     r_lpm_profile_exit(lpm_instance_ctrl_t * const p_ctrl);
+static void     r_lpm_profile_transition(lpm_instance_ctrl_t * const p_ctrl, uint32_t cycles);
+static void     r_lpm_profile_done(lpm_instance_ctrl_t * const p_ctrl);
+
+#endif
+
+#if LPM_CFG_FAST_RESUME_ENABLE
+static void r_lpm_fast_resume_prepare(lpm_instance_ctrl_t * const p_ctrl);
+static void r_lpm_fast_resume_start(lpm_instance_ctrl_t * const p_ctrl);
+static void r_lpm_fast_resume_finish(lpm_instance_ctrl_t * const p_ctrl);
+
+#endif
 
 #if LPM_CFG_PARAM_CHECKING_ENABLE
 static fsp_err_t r_lpm_mcu_specific_low_power_check(lpm_cfg_t const * const p_cfg);
@@ -160,6 +184,13 @@ fsp_err_t R_LPM_Open (lpm_ctrl_t * const p_api_ctrl, lpm_cfg_t const * const p_c
 
     /* Save the configuration  */
     p_ctrl->p_cfg = p_cfg;
+#if LPM_CFG_PROFILE_ENABLE
+    p_ctrl->p_profile_cfg = NULL;
+#endif
+#if LPM_CFG_FAST_RESUME_ENABLE
+    memset(&p_ctrl->fast_resume_stats, 0, sizeof(p_ctrl->fast_resume_stats));
+    p_ctrl->fast_resume_active = false;
+#endif
 
     fsp_err_t err = r_lpm_configure(p_cfg);
     FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
@@ -216,6 +247,12 @@ fsp_err_t R_LPM_LowPowerReconfigure (lpm_ctrl_t * const p_api_ctrl, lpm_cfg_t co
  *
  * Function will return after waking from low power mode.
  *
+ * With LPM_CFG_FAST_RESUME_ENABLE, a Software Standby entry running on the PLL first caches the system clock source
+ * and dividers, moves the system clock to HOCO (or MOCO when HOCO is stopped or faster than the PLL) and stops the PLL
+ * and the main oscillator. The wake-up then only waits for the on-chip oscillator. The PLL is restarted right after
+ * the wake-up, the wake-up interrupt runs on HOCO or MOCO while the PLL locks, and the cached clock tree is restored
+ * before this function returns. The wake-up interrupt must not change the clock configuration.
+ *
  * @retval     FSP_SUCCESS                   Successful.
  * @retval     FSP_ERR_ASSERTION             Null pointer.
  * @retval     FSP_ERR_NOT_OPEN              LPM instance is not open
@@ -235,11 +272,25 @@ fsp_err_t R_LPM_LowPowerModeEnter (lpm_ctrl_t * const p_api_ctrl)
     FSP_ERROR_RETURN(LPM_OPEN == p_ctrl->lpm_open, FSP_ERR_NOT_OPEN);
 #endif
 
+    BSP_TRACE(FSP_IP_LPM, 0U, BSP_TRACE_EVENT_START, p_ctrl->p_cfg->low_power_mode);
+
+#if LPM_CFG_PROFILE_ENABLE
+    p_ctrl->profile_entered = false;
+    p_ctrl->profile_cycles  = LPM_PRV_PROFILE_CYCLES_GET();
+#endif
+
     /* Wait for ongoing operating mode transition (OPCMTSF, SOPCMTSF) */
-    r_lpm_wait_for_operating_mode_flags();
+    uint32_t transition_cycles = r_lpm_wait_for_operating_mode_flags();
 
     fsp_err_t err = r_lpm_low_power_enter(p_ctrl);
 
+#if LPM_CFG_PROFILE_ENABLE
+    r_lpm_profile_transition(p_ctrl, transition_cycles);
+    r_lpm_profile_done(p_ctrl);
+#else
+    FSP_PARAMETER_NOT_USED(transition_cycles);
+#endif
+
 #if BSP_FEATURE_LPM_HAS_DEEP_STANDBY
     if (FSP_ERR_INVALID_MODE == err)
     {
@@ -248,6 +299,8 @@ fsp_err_t R_LPM_LowPowerModeEnter (lpm_ctrl_t * const p_api_ctrl)
     }
 #endif
 
+    BSP_TRACE(FSP_IP_LPM, 0U, BSP_TRACE_EVENT_STOP, (uint32_t) err);
+
     return err;
 }
 
@@ -290,6 +343,9 @@ fsp_err_t R_LPM_Close (lpm_ctrl_t * const p_api_ctrl)
 #endif
 
     p_ctrl->lpm_open = 0;
+#if LPM_CFG_PROFILE_ENABLE
+    p_ctrl->p_profile_cfg = NULL;
+#endif
 
     return FSP_SUCCESS;
 }
@@ -311,6 +367,150 @@ fsp_err_t R_LPM_VersionGet (fsp_version_t * const p_version)
     return FSP_SUCCESS;
 }
 
+/*******************************************************************************************************************//**
+ * Start profiling the low power modes. The results are cleared and then updated by each R_LPM_LowPowerModeEnter() call
+ * until R_LPM_ProfileStop() is called.
+ *
+ * @retval     FSP_SUCCESS          Profiling started.
+ * @retval     FSP_ERR_ASSERTION    A pointer is NULL.
+ * @retval     FSP_ERR_NOT_OPEN     LPM instance is not open.
+ * @retval     FSP_ERR_UNSUPPORTED  LPM_CFG_PROFILE_ENABLE is not set.
+ * @return     See @ref RENESAS_ERROR_CODES or functions called by this function for other possible return codes.
+ *             This function calls:
+ *             * @ref timer_api_t::infoGet
+ **********************************************************************************************************************/
+fsp_err_t R_LPM_ProfileStart (lpm_ctrl_t * const              p_api_ctrl,
+                              lpm_profile_cfg_t const * const p_profile_cfg,
+                              lpm_profile_t * const           p_profile)
+{
+#if LPM_CFG_PROFILE_ENABLE
+    lpm_instance_ctrl_t * p_ctrl = (lpm_instance_ctrl_t *) p_api_ctrl;
+ #if LPM_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ASSERT(NULL != p_profile_cfg);
+    FSP_ASSERT(NULL != p_profile_cfg->p_timer);
+    FSP_ASSERT(NULL != p_profile);
+    FSP_ERROR_RETURN(LPM_OPEN == p_ctrl->lpm_open, FSP_ERR_NOT_OPEN);
+ #endif
+
+    timer_instance_t const * p_timer = p_profile_cfg->p_timer;
+    timer_info_t             info    = {0};
+    fsp_err_t                err     = p_timer->p_api->infoGet(p_timer->p_ctrl, &info);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+    memset(p_profile, 0, sizeof(lpm_profile_t));
+    p_profile->timebase_hz = info.clock_frequency;
+
+    p_ctrl->p_profile        = p_profile;
+    p_ctrl->profile_period   = info.period_counts;
+    p_ctrl->profile_count_up = (TIMER_DIRECTION_UP == info.count_direction);
+    p_ctrl->profile_entered  = false;
+    p_ctrl->p_profile_cfg    = p_profile_cfg;
+
+    /* Start accounting the run time from now. */
+    (void) r_lpm_profile_elapsed_get(p_ctrl);
+
+    return FSP_SUCCESS;
+#else
+    FSP_PARAMETER_NOT_USED(p_api_ctrl);
+    FSP_PARAMETER_NOT_USED(p_profile_cfg);
+    FSP_PARAMETER_NOT_USED(p_profile);
+
+    return FSP_ERR_UNSUPPORTED;
+#endif
+}
+
+/*******************************************************************************************************************//**
+ * Copy the profiling results, with the run time accounted up to this call.
+ *
+ * @retval     FSP_SUCCESS          Results copied to p_snapshot.
+ * @retval     FSP_ERR_ASSERTION    A pointer is NULL.
+ * @retval     FSP_ERR_NOT_OPEN     LPM instance is not open.
+ * @retval     FSP_ERR_NOT_ENABLED  Profiling is not started.
+ * @retval     FSP_ERR_UNSUPPORTED  LPM_CFG_PROFILE_ENABLE is not set.
+ **********************************************************************************************************************/
+fsp_err_t R_LPM_ProfileGet (lpm_ctrl_t * const p_api_ctrl, lpm_profile_t * const p_snapshot)
+{
+#if LPM_CFG_PROFILE_ENABLE
+    lpm_instance_ctrl_t * p_ctrl = (lpm_instance_ctrl_t *) p_api_ctrl;
+ #if LPM_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ASSERT(NULL != p_snapshot);
+    FSP_ERROR_RETURN(LPM_OPEN == p_ctrl->lpm_open, FSP_ERR_NOT_OPEN);
+ #endif
+    FSP_ERROR_RETURN(NULL != p_ctrl->p_profile_cfg, FSP_ERR_NOT_ENABLED);
+
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+    p_ctrl->p_profile->run_counts += r_lpm_profile_elapsed_get(p_ctrl);
+    *p_snapshot = *p_ctrl->p_profile;
+    FSP_CRITICAL_SECTION_EXIT;
+
+    return FSP_SUCCESS;
+#else
+    FSP_PARAMETER_NOT_USED(p_api_ctrl);
+    FSP_PARAMETER_NOT_USED(p_snapshot);
+
+    return FSP_ERR_UNSUPPORTED;
+#endif
+}
+
+/*******************************************************************************************************************//**
+ * Stop profiling. The results are kept.
+ *
+ * @retval     FSP_SUCCESS          Profiling stopped.
+ * @retval     FSP_ERR_ASSERTION    p_api_ctrl is NULL.
+ * @retval     FSP_ERR_NOT_OPEN     LPM instance is not open.
+ * @retval     FSP_ERR_UNSUPPORTED  LPM_CFG_PROFILE_ENABLE is not set.
+ **********************************************************************************************************************/
+fsp_err_t R_LPM_ProfileStop (lpm_ctrl_t * const p_api_ctrl)
+{
+#if LPM_CFG_PROFILE_ENABLE
+    lpm_instance_ctrl_t * p_ctrl = (lpm_instance_ctrl_t *) p_api_ctrl;
+ #if LPM_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ERROR_RETURN(LPM_OPEN == p_ctrl->lpm_open, FSP_ERR_NOT_OPEN);
+ #endif
+
+    p_ctrl->p_profile_cfg = NULL;
+
+    return FSP_SUCCESS;
+#else
+    FSP_PARAMETER_NOT_USED(p_api_ctrl);
+
+    return FSP_ERR_UNSUPPORTED;
+#endif
+}
+
+/*******************************************************************************************************************//**
+ * Copy the fast resume statistics.
+ *
+ * @retval     FSP_SUCCESS          Statistics copied to p_stats.
+ * @retval     FSP_ERR_ASSERTION    A pointer is NULL.
+ * @retval     FSP_ERR_NOT_OPEN     LPM instance is not open.
+ * @retval     FSP_ERR_UNSUPPORTED  LPM_CFG_FAST_RESUME_ENABLE is not set.
+ **********************************************************************************************************************/
+fsp_err_t R_LPM_FastResumeStatsGet (lpm_ctrl_t * const p_api_ctrl, lpm_fast_resume_stats_t * const p_stats)
+{
+#if LPM_CFG_FAST_RESUME_ENABLE
+    lpm_instance_ctrl_t * p_ctrl = (lpm_instance_ctrl_t *) p_api_ctrl;
+ #if LPM_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ASSERT(NULL != p_stats);
+    FSP_ERROR_RETURN(LPM_OPEN == p_ctrl->lpm_open, FSP_ERR_NOT_OPEN);
+ #endif
+
+    *p_stats = p_ctrl->fast_resume_stats;
+
+    return FSP_SUCCESS;
+#else
+    FSP_PARAMETER_NOT_USED(p_api_ctrl);
+    FSP_PARAMETER_NOT_USED(p_stats);
+
+    return FSP_ERR_UNSUPPORTED;
+#endif
+}
+
 /*******************************************************************************************************************//**
  * @} (end addtogroup LPM)
  **********************************************************************************************************************/
@@ -595,6 +795,12 @@ fsp_err_t r_lpm_low_power_enter (lpm_instance_ctrl_t * const p_instance_ctrl)
         FSP_ERROR_RETURN(0U == R_SYSTEM->FLLCR1, FSP_ERR_INVALID_MODE);
 #endif
 
+#if LPM_CFG_FAST_RESUME_ENABLE
+
+        /* Move the system clock off the PLL first so the standby settings below match the clock used in standby. */
+        r_lpm_fast_resume_prepare(p_instance_ctrl);
+#endif
+
         /* Get system clock */
         uint32_t clock_source = R_SYSTEM->SCKSCR;
 
@@ -711,6 +917,18 @@ fsp_err_t r_lpm_low_power_enter (lpm_instance_ctrl_t * const p_instance_ctrl)
 #endif
     }
 
+#if LPM_CFG_PROFILE_ENABLE
+    r_lpm_profile_enter(p_instance_ctrl);
+#endif
+#if LPM_CFG_FAST_RESUME_ENABLE
+    if (p_instance_ctrl->fast_resume_active)
+    {
+        /* Keep the wake-up interrupt pending until the PLL restart is requested. */
+        p_instance_ctrl->fast_resume_primask = __get_PRIMASK();
+        __disable_irq();
+    }
+#endif
+
     if (LPM_MODE_STANDBY_SNOOZE == p_instance_ctrl->p_cfg->low_power_mode)
     {
 #if !BSP_FEATURE_LPM_HAS_DEEP_STANDBY
@@ -738,13 +956,25 @@ fsp_err_t r_lpm_low_power_enter (lpm_instance_ctrl_t * const p_instance_ctrl)
      * See Section 11.8.2 "Canceling Snooze Mode" in the RA6M3 manual  R01UM0004EU0110 */
     R_SYSTEM->SNZCR_b.SNZE = 0;
 
+#if LPM_CFG_FAST_RESUME_ENABLE
+    r_lpm_fast_resume_start(p_instance_ctrl);
+#endif
+#if LPM_CFG_PROFILE_ENABLE
+    r_lpm_profile_exit(p_instance_ctrl);
+#endif
+
 #if BSP_FEATURE_LPM_HAS_DEEP_STANDBY || (BSP_PRV_POWER_USE_DCDC)
     if (1U == R_SYSTEM->SBYCR_b.SSBY)
     {
  #if BSP_FEATURE_LPM_HAS_DEEP_STANDBY
 
         /* Wait for ongoing operating mode transition (OPCMTSF, SOPCMTSF) */
-        r_lpm_wait_for_operating_mode_flags();
+        uint32_t transition_cycles = r_lpm_wait_for_operating_mode_flags();
+  #if LPM_CFG_PROFILE_ENABLE
+        r_lpm_profile_transition(p_instance_ctrl, transition_cycles);
+  #else
+        FSP_PARAMETER_NOT_USED(transition_cycles);
+  #endif
 
         /* Restore system registers to the values prior to entering standby. */
         R_SYSTEM->OPCCR          = saved_opccr & R_SYSTEM_OPCCR_OPCM_Msk;
@@ -779,17 +1009,320 @@ fsp_err_t r_lpm_low_power_enter (lpm_instance_ctrl_t * const p_instance_ctrl)
     }
 #endif
 
+#if LPM_CFG_FAST_RESUME_ENABLE
+
+    /* Switch back to the PLL once the operating power mode is restored. */
+    r_lpm_fast_resume_finish(p_instance_ctrl);
+#endif
+
     return FSP_SUCCESS;
 }
 
 /*******************************************************************************************************************//**
  * Wait for opccr and sopccr transition flags to clear.
+ *
+ * @return     CPU cycles spent waiting when profiling on an MCU with BSP_FEATURE_DWT_CYCCNT, 0 otherwise.
  **********************************************************************************************************************/
-void r_lpm_wait_for_operating_mode_flags (void)
+uint32_t r_lpm_wait_for_operating_mode_flags (void)
 {
+    uint32_t start = LPM_PRV_PROFILE_CYCLES_GET();
+
     /* Wait for transition to complete. */
     FSP_HARDWARE_REGISTER_WAIT(R_SYSTEM->OPCCR_b.OPCMTSF, 0U);
 
     /* Wait for transition to complete. */
     FSP_HARDWARE_REGISTER_WAIT(R_SYSTEM->SOPCCR_b.SOPCMTSF, 0U);
+
+    return LPM_PRV_PROFILE_CYCLES_GET() - start;
+}
+
+#if LPM_CFG_PROFILE_ENABLE
+
+/*******************************************************************************************************************//**
+ * Reads the timebase and returns the counts elapsed since the previous call.
+ *
+ * @param[in]  p_ctrl                  Pointer to instance control structure.
+ **********************************************************************************************************************/
+static uint32_t r_lpm_profile_elapsed_get (lpm_instance_ctrl_t * const p_ctrl)
+{
+    timer_instance_t const * p_timer = p_ctrl->p_profile_cfg->p_timer;
+    timer_status_t           status  = {0};
+
+    (void) p_timer->p_api->statusGet(p_timer->p_ctrl, &status);
+
+    uint32_t elapsed = p_ctrl->profile_count_up ? (status.counter - p_ctrl->profile_count) :
+                       (p_ctrl->profile_count - status.counter);
+
+    /* The difference wraps around when the counter reloaded since the previous read. */
+    if (elapsed >= p_ctrl->profile_period)
+    {
+        elapsed += p_ctrl->profile_period;
+    }
+
+    p_ctrl->profile_count = status.counter;
+
+    return elapsed;
+}
+
+/*******************************************************************************************************************//**
+ * Accounts the time spent running and masks interrupts right before WFI. WFI still wakes up on a pending interrupt
+ * with PRIMASK set, which lets r_lpm_profile_exit() find the interrupt that woke the MCU before it is serviced.
+ *
+ * @param[in]  p_ctrl                  Pointer to instance control structure.
+ **********************************************************************************************************************/
+static void r_lpm_profile_enter (lpm_instance_ctrl_t * const p_ctrl)
+{
+    if (NULL == p_ctrl->p_profile_cfg)
+    {
+        return;
+    }
+
+    p_ctrl->profile_primask = __get_PRIMASK();
+    __disable_irq();
+
+    lpm_profile_t      * p_profile = p_ctrl->p_profile;
+    lpm_profile_mode_t * p_mode    = &p_profile->mode[p_ctrl->p_cfg->low_power_mode];
+
+    p_profile->run_counts += r_lpm_profile_elapsed_get(p_ctrl);
+    p_mode->entries++;
+
+    uint32_t cycles = LPM_PRV_PROFILE_CYCLES_GET() - p_ctrl->profile_cycles;
+    if (cycles > p_mode->entry_cycles_max)
+    {
+        p_mode->entry_cycles_max = cycles;
+    }
+
+    p_ctrl->profile_entered = true;
+
+    if (LPM_PROFILE_MARKER_NONE != p_ctrl->p_profile_cfg->marker_pin)
+    {
+        R_BSP_PinAccessEnable();
+        R_BSP_PinWrite(p_ctrl->p_profile_cfg->marker_pin, BSP_IO_LEVEL_HIGH);
+        R_BSP_PinAccessDisable();
+    }
 }
+
+/*******************************************************************************************************************//**
+ * Accounts the time spent in the low power mode and counts the pending interrupts as wake-up sources.
+ *
+ * @param[in]  p_ctrl                  Pointer to instance control structure.
+ **********************************************************************************************************************/
+static void r_lpm_profile_exit (lpm_instance_ctrl_t * const p_ctrl)
+{
+    if (!p_ctrl->profile_entered)
+    {
+        return;
+    }
+
+    p_ctrl->profile_cycles = LPM_PRV_PROFILE_CYCLES_GET();
+
+    if (LPM_PROFILE_MARKER_NONE != p_ctrl->p_profile_cfg->marker_pin)
+    {
+        R_BSP_PinAccessEnable();
+        R_BSP_PinWrite(p_ctrl->p_profile_cfg->marker_pin, BSP_IO_LEVEL_LOW);
+        R_BSP_PinAccessDisable();
+    }
+
+    lpm_profile_t * p_profile = p_ctrl->p_profile;
+    p_profile->mode[p_ctrl->p_cfg->low_power_mode].residency_counts += r_lpm_profile_elapsed_get(p_ctrl);
+
+    bool found = false;
+    for (uint32_t irq = 0U; irq < BSP_ICU_VECTOR_MAX_ENTRIES; irq++)
+    {
+        if (NVIC_GetPendingIRQ((IRQn_Type) irq))
+        {
+            p_profile->wake_irq[irq]++;
+            found = true;
+        }
+    }
+
+    if (!found)
+    {
+        p_profile->wake_other++;
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Records the time spent waiting for an operating power mode transition.
+ *
+ * @param[in]  p_ctrl                  Pointer to instance control structure.
+ * @param[in]  cycles                  CPU cycles spent waiting.
+ **********************************************************************************************************************/
+static void r_lpm_profile_transition (lpm_instance_ctrl_t * const p_ctrl, uint32_t cycles)
+{
+    if (NULL != p_ctrl->p_profile_cfg)
+    {
+        lpm_profile_mode_t * p_mode = &p_ctrl->p_profile->mode[p_ctrl->p_cfg->low_power_mode];
+        if (cycles > p_mode->transition_cycles_max)
+        {
+            p_mode->transition_cycles_max = cycles;
+        }
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Records the wake-up latency and lets the wake-up interrupt run.
+ *
+ * @param[in]  p_ctrl                  Pointer to instance control structure.
+ **********************************************************************************************************************/
+static void r_lpm_profile_done (lpm_instance_ctrl_t * const p_ctrl)
+{
+    if (!p_ctrl->profile_entered)
+    {
+        return;
+    }
+
+    p_ctrl->profile_entered = false;
+
+    lpm_profile_mode_t * p_mode = &p_ctrl->p_profile->mode[p_ctrl->p_cfg->low_power_mode];
+    uint32_t             cycles = LPM_PRV_PROFILE_CYCLES_GET() - p_ctrl->profile_cycles;
+    if (cycles > p_mode->exit_cycles_max)
+    {
+        p_mode->exit_cycles_max = cycles;
+    }
+
+    __set_PRIMASK(p_ctrl->profile_primask);
+}
+
+#endif
+
+#if LPM_CFG_FAST_RESUME_ENABLE
+
+/*******************************************************************************************************************//**
+ * Caches the clock tree, moves the system clock from the PLL to HOCO or MOCO and stops the PLL and the main oscillator
+ * before a Software Standby entry. Nothing is changed unless the PLL is the system clock.
+ *
+ * @param[in]  p_ctrl                  Pointer to instance control structure.
+ **********************************************************************************************************************/
+static void r_lpm_fast_resume_prepare (lpm_instance_ctrl_t * const p_ctrl)
+{
+    p_ctrl->fast_resume_active = false;
+
+    if ((LPM_MODE_STANDBY != p_ctrl->p_cfg->low_power_mode) || (1U == R_SYSTEM->SNZCR_b.RXDREQEN))
+    {
+        return;
+    }
+
+ #if BSP_FEATURE_CGC_HAS_PLL
+    uint32_t bridge_clock;
+    if (LPM_CLOCK_PLL != R_SYSTEM->SCKSCR)
+    {
+        p_ctrl->fast_resume_stats.skipped++;
+
+        return;
+    }
+
+    /* HOCO is only used when it is stable and not faster than the PLL, so the cached dividers stay valid. */
+    if ((0U == R_SYSTEM->HOCOCR) && (1U == R_SYSTEM->OSCSF_b.HOCOSF) &&
+        (bsp_prv_source_clock_hz_get(LPM_CLOCK_HOCO) <= bsp_prv_source_clock_hz_get(LPM_CLOCK_PLL)))
+    {
+        bridge_clock = LPM_CLOCK_HOCO;
+    }
+    else if (0U == R_SYSTEM->MOCOCR)
+    {
+        bridge_clock = LPM_CLOCK_MOCO;
+    }
+    else
+    {
+        p_ctrl->fast_resume_stats.skipped++;
+
+        return;
+    }
+
+    p_ctrl->fast_resume_sckscr   = R_SYSTEM->SCKSCR;
+    p_ctrl->fast_resume_sckdivcr = R_SYSTEM->SCKDIVCR;
+
+    R_BSP_RegisterProtectDisable(BSP_REG_PROTECT_CGC);
+
+    bsp_prv_clock_set(bridge_clock, p_ctrl->fast_resume_sckdivcr);
+
+    R_SYSTEM->PLLCR = 1U;
+    FSP_HARDWARE_REGISTER_WAIT(R_SYSTEM->OSCSF_b.PLLSF, 0U);
+
+    /* The main oscillator is only stopped while oscillation stop detection is disabled. */
+    p_ctrl->fast_resume_mosc = (0U == R_SYSTEM->MOSCCR) && (0U == R_SYSTEM->OSTDCR_b.OSTDE);
+    if (p_ctrl->fast_resume_mosc)
+    {
+        R_SYSTEM->MOSCCR = 1U;
+        FSP_HARDWARE_REGISTER_WAIT(R_SYSTEM->OSCSF_b.MOSCSF, 0U);
+    }
+
+    R_BSP_RegisterProtectEnable(BSP_REG_PROTECT_CGC);
+
+    p_ctrl->fast_resume_active = true;
+ #else
+    p_ctrl->fast_resume_stats.skipped++;
+ #endif
+}
+
+/*******************************************************************************************************************//**
+ * Restarts the oscillators stopped by r_lpm_fast_resume_prepare() right after the wake-up, then lets the wake-up
+ * interrupt run on HOCO or MOCO while they stabilize.
+ *
+ * @param[in]  p_ctrl                  Pointer to instance control structure.
+ **********************************************************************************************************************/
+static void r_lpm_fast_resume_start (lpm_instance_ctrl_t * const p_ctrl)
+{
+    if (!p_ctrl->fast_resume_active)
+    {
+        return;
+    }
+
+    p_ctrl->fast_resume_cycles = LPM_PRV_PROFILE_CYCLES_GET();
+
+    R_BSP_RegisterProtectDisable(BSP_REG_PROTECT_CGC);
+
+    /* The PLL may run from the main oscillator, so it is only started once the main oscillator is stable. */
+    if (p_ctrl->fast_resume_mosc)
+    {
+        R_SYSTEM->MOSCCR = 0U;
+    }
+    else
+    {
+        R_SYSTEM->PLLCR = 0U;
+    }
+
+    R_BSP_RegisterProtectEnable(BSP_REG_PROTECT_CGC);
+
+    __set_PRIMASK(p_ctrl->fast_resume_primask);
+}
+
+/*******************************************************************************************************************//**
+ * Waits for the PLL to lock, restores the cached system clock source and dividers and records the resume time.
+ *
+ * @param[in]  p_ctrl                  Pointer to instance control structure.
+ **********************************************************************************************************************/
+static void r_lpm_fast_resume_finish (lpm_instance_ctrl_t * const p_ctrl)
+{
+    if (!p_ctrl->fast_resume_active)
+    {
+        return;
+    }
+
+    p_ctrl->fast_resume_active = false;
+
+    R_BSP_RegisterProtectDisable(BSP_REG_PROTECT_CGC);
+
+    if (p_ctrl->fast_resume_mosc)
+    {
+        FSP_HARDWARE_REGISTER_WAIT(R_SYSTEM->OSCSF_b.MOSCSF, 1U);
+        R_SYSTEM->PLLCR = 0U;
+    }
+
+    FSP_HARDWARE_REGISTER_WAIT(R_SYSTEM->OSCSF_b.PLLSF, 1U);
+
+    bsp_prv_clock_set(p_ctrl->fast_resume_sckscr, p_ctrl->fast_resume_sckdivcr);
+
+    R_BSP_RegisterProtectEnable(BSP_REG_PROTECT_CGC);
+
+    lpm_fast_resume_stats_t * p_stats = &p_ctrl->fast_resume_stats;
+    uint32_t                  cycles  = LPM_PRV_PROFILE_CYCLES_GET() - p_ctrl->fast_resume_cycles;
+    p_stats->resumes++;
+    p_stats->lock_cycles_last = cycles;
+    if (cycles > p_stats->lock_cycles_max)
+    {
+        p_stats->lock_cycles_max = cycles;
+    }
+}
+
+#endif
@@ -24,6 +24,7 @@
  * Includes
  **********************************************************************************************************************/
 #include "r_ospi.h"
+#include <string.h>
 
 /***********************************************************************************************************************
  * Macro definitions
@@ -40,6 +41,28 @@
 #define OSPI_PRV_DIRECT_ADDR_AND_DATA_MASK           (7U)
 #define OSPI_PRV_PAGE_SIZE_BYTES                     (256U)
 
+/* Serial Flash Discoverable Parameters (JESD216) definitions. */
+#define OSPI_PRV_SFDP_READ_COMMAND                   (0x5AU)
+#define OSPI_PRV_SFDP_DUMMY_CYCLES                   (8U)
+#define OSPI_PRV_SFDP_SIGNATURE                      (0x50444653U) /* "SFDP" */
+#define OSPI_PRV_SFDP_HEADER_ADDRESS                 (8U)
+#define OSPI_PRV_SFDP_BFPT_ID                        (0xFF00U)
+#define OSPI_PRV_SFDP_PROFILE_1_0_ID                 (0xFF05U)
+#define OSPI_PRV_SFDP_BFPT_DWORDS_MAX                (18U)
+#define OSPI_PRV_SFDP_BFPT_DWORDS_MIN                (9U)
+#define OSPI_PRV_SFDP_BFPT_EXTENSION_DWORDS          (18U)
+#define OSPI_PRV_SFDP_PROFILE_1_0_DWORDS             (5U)
+#define OSPI_PRV_SFDP_DENSITY_EXPONENT               (1U << 31)
+#define OSPI_PRV_SFDP_EXTENSION_INVERT               (1U)
+#define OSPI_PRV_SFDP_EXTENSION_RESERVED             (2U)
+#define OSPI_PRV_SFDP_EXTENSION_16_BIT               (3U)
+#define OSPI_PRV_SFDP_DUMMY_MASK                     (0x1FU)
+#define OSPI_PRV_SFDP_DUMMY_DEFAULT                  (20U)
+
+#define OSPI_PRV_4BYTE_PAGE_PROGRAM_COMMAND          (0x12U)
+#define OSPI_PRV_WRITE_ENABLE_COMMAND                (0x06U)
+#define OSPI_PRV_READ_STATUS_COMMAND                 (0x05U)
+
 /***********************************************************************************************************************
  * Typedef definitions
  **********************************************************************************************************************/
@@ -55,6 +78,17 @@ static void r_ospi_wen(ospi_instance_ctrl_t * p_instance_ctrl);
 static void r_ospi_direct_transfer(ospi_instance_ctrl_t              * p_instance_ctrl,
                                    spi_flash_direct_transfer_t * const p_transfer,
                                    spi_flash_direct_transfer_dir_t     direction);
+static void r_ospi_write_combine_commit(ospi_instance_ctrl_t * p_instance_ctrl);
+
+#if OSPI_CFG_SFDP_SUPPORT_ENABLE
+static void r_ospi_sfdp_configure(ospi_instance_ctrl_t * p_instance_ctrl);
+static void r_ospi_sfdp_read(ospi_instance_ctrl_t * p_instance_ctrl,
+                             uint32_t               address,
+                             uint32_t * const       p_dest,
+                             uint32_t               dwords);
+static uint16_t r_ospi_sfdp_command(uint32_t command, uint8_t invert);
+
+#endif
 
 /***********************************************************************************************************************
  * Private global variables
@@ -102,6 +136,11 @@ const spi_flash_api_t g_ospi_on_spi_flash =
 /*******************************************************************************************************************//**
  * Open the OSPI driver module. After the driver is open, the OSPI can be accessed like internal flash memory.
  *
+ * If ospi_extended_cfg_t::sfdp is enabled, the SFDP tables of the device are read in SPI mode. The memory size, and
+ * for xSPI Profile 1.0 devices the DOPI read command, its dummy cycles and the OPI commands, replace the configured
+ * ones. They are applied when R_OSPI_SpiProtocolSet() selects DOPI. The settings in use are returned by
+ * R_OSPI_ConfigGet().
+ *
  * Implements @ref spi_flash_api_t::open.
  *
  * Example:
@@ -127,10 +166,22 @@ fsp_err_t R_OSPI_Open (spi_flash_ctrl_t * p_ctrl, spi_flash_cfg_t const * const
     R_BSP_MODULE_START(FSP_IP_OSPI, 0U);
     ospi_extended_cfg_t * p_cfg_extend = (ospi_extended_cfg_t *) p_cfg->p_extend;
 
+#if OSPI_CFG_PARAM_CHECKING_ENABLE
+ #if OSPI_CFG_SFDP_SUPPORT_ENABLE
+
+    /* SFDP is read in SPI mode. */
+    FSP_ASSERT((OSPI_SFDP_DISABLED == p_cfg_extend->sfdp) ||
+               (SPI_FLASH_PROTOCOL_EXTENDED_SPI == p_cfg->spi_protocol));
+ #else
+    FSP_ASSERT(OSPI_SFDP_DISABLED == p_cfg_extend->sfdp);
+ #endif
+#endif
+
     /* Initialize control block. */
     p_instance_ctrl->p_cfg        = p_cfg;
     p_instance_ctrl->spi_protocol = p_cfg->spi_protocol;
     p_instance_ctrl->channel      = p_cfg_extend->channel;
+    p_instance_ctrl->p_wc_page    = NULL;
 
     /* Perform OSPI initial setup as described in hardware manual (see Section 34.3.6.1
      * 'Initial Settings' of the RA6M4 manual R01UH0890EJ0100). */
@@ -180,6 +231,13 @@ fsp_err_t R_OSPI_Open (spi_flash_ctrl_t * p_ctrl, spi_flash_cfg_t const * const
     fsp_err_t ret = r_ospi_spi_protocol_specific_settings(p_instance_ctrl, p_cfg->spi_protocol);
     if (FSP_SUCCESS == ret)
     {
+#if OSPI_CFG_SFDP_SUPPORT_ENABLE
+        if (OSPI_SFDP_DISABLED != p_cfg_extend->sfdp)
+        {
+            r_ospi_sfdp_configure(p_instance_ctrl);
+        }
+#endif
+
         p_instance_ctrl->open = OSPI_PRV_OPEN;
     }
 
@@ -414,7 +472,7 @@ fsp_err_t R_OSPI_Erase (spi_flash_ctrl_t * p_ctrl, uint8_t * const p_device_addr
         /* If requested byte_count is supported by underlying flash, store the command. */
         if (byte_count == p_cfg->p_erase_command_list[index].size)
         {
-            if (p_cfg_extend->memory_size == byte_count)
+            if ((SPI_FLASH_ERASE_SIZE_CHIP_ERASE == byte_count) || (p_cfg_extend->memory_size == byte_count))
             {
                 /* Don't send address for chip erase. */
                 send_address = false;
@@ -530,7 +588,9 @@ fsp_err_t R_OSPI_Close (spi_flash_ctrl_t * p_ctrl)
     FSP_ERROR_RETURN(OSPI_PRV_OPEN == p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
 #endif
 
-    p_instance_ctrl->open = 0U;
+    /* Data still being combined by R_OSPI_WriteCombine() is discarded. */
+    p_instance_ctrl->open      = 0U;
+    p_instance_ctrl->p_wc_page = NULL;
 
     /* Disable clock to the OSPI block */
     R_BSP_MODULE_STOP(FSP_IP_OSPI, 0U);
@@ -558,6 +618,177 @@ fsp_err_t R_OSPI_VersionGet (fsp_version_t * const p_version)
     return FSP_SUCCESS;
 }
 
+/*******************************************************************************************************************//**
+ * Combine data into page programs of the OctaFlash.
+ *
+ * Data may be written to any address in the memory-mapped window and may cross page boundaries. It is collected in
+ * ospi_extended_cfg_t::p_write_combine_buffer and a page is programmed when a write reaches the end of the page, or
+ * when a write targets a different page. Programming runs in the background: the device busy status is only polled
+ * when the next page has to be programmed, so the next page is collected while the previous one is being programmed.
+ *
+ * Unwritten bytes within the programmed range are sent as 0xFF, which leaves them unchanged. Data still being combined
+ * is not visible in the memory-mapped window until it is programmed. Call R_OSPI_WriteCombineFlush() before reading it
+ * back, erasing, or using R_OSPI_Write().
+ *
+ * @retval FSP_SUCCESS                 The data was combined. Completed pages have been sent to the flash.
+ * @retval FSP_ERR_ASSERTION           p_instance_ctrl, p_dest, p_src or the write combine buffer is NULL, or
+ *                                     byte_count is 0.
+ * @retval FSP_ERR_NOT_OPEN            Driver is not opened.
+ **********************************************************************************************************************/
+fsp_err_t R_OSPI_WriteCombine (spi_flash_ctrl_t    * p_ctrl,
+                               uint8_t const * const p_src,
+                               uint8_t * const       p_dest,
+                               uint32_t              byte_count)
+{
+    ospi_instance_ctrl_t * p_instance_ctrl = (ospi_instance_ctrl_t *) p_ctrl;
+#if OSPI_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_instance_ctrl);
+    FSP_ASSERT(NULL != p_src);
+    FSP_ASSERT(NULL != p_dest);
+    FSP_ASSERT(0 != byte_count);
+    FSP_ERROR_RETURN(OSPI_PRV_OPEN == p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
+    FSP_ASSERT(NULL != ((ospi_extended_cfg_t *) p_instance_ctrl->p_cfg->p_extend)->p_write_combine_buffer);
+#endif
+    uint8_t * p_page_buffer =
+        (uint8_t *) ((ospi_extended_cfg_t *) p_instance_ctrl->p_cfg->p_extend)->p_write_combine_buffer;
+    uint32_t address   = (uint32_t) p_dest;
+    uint32_t remaining = byte_count;
+    uint32_t src_index = 0U;
+
+    while (remaining > 0U)
+    {
+        uint8_t * p_page = (uint8_t *) (address & ~(OSPI_PRV_PAGE_SIZE_BYTES - 1U));
+        uint32_t  offset = address & (OSPI_PRV_PAGE_SIZE_BYTES - 1U);
+        uint32_t  length = OSPI_PRV_PAGE_SIZE_BYTES - offset;
+        if (length > remaining)
+        {
+            length = remaining;
+        }
+
+        /* Start combining a new page. Any other page being combined is programmed first. */
+        if (p_page != p_instance_ctrl->p_wc_page)
+        {
+            r_ospi_write_combine_commit(p_instance_ctrl);
+
+            memset(p_page_buffer, UINT8_MAX, OSPI_PRV_PAGE_SIZE_BYTES);
+            p_instance_ctrl->p_wc_page = p_page;
+            p_instance_ctrl->wc_start  = offset;
+            p_instance_ctrl->wc_end    = offset + length;
+        }
+        else
+        {
+            if (offset < p_instance_ctrl->wc_start)
+            {
+                p_instance_ctrl->wc_start = offset;
+            }
+
+            if (offset + length > p_instance_ctrl->wc_end)
+            {
+                p_instance_ctrl->wc_end = offset + length;
+            }
+        }
+
+        memcpy(&p_page_buffer[offset], &p_src[src_index], length);
+
+        /* Program the page as soon as data reaches the end of it, as is the case for sequential writes. */
+        if (OSPI_PRV_PAGE_SIZE_BYTES == offset + length)
+        {
+            r_ospi_write_combine_commit(p_instance_ctrl);
+        }
+
+        address   += length;
+        src_index += length;
+        remaining -= length;
+    }
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Program the page being combined by R_OSPI_WriteCombine(), if any. The program runs in the background; use
+ * R_OSPI_StatusGet() to check for completion.
+ *
+ * @retval FSP_SUCCESS                 Any combined data has been sent to the flash.
+ * @retval FSP_ERR_ASSERTION           p_instance_ctrl is NULL.
+ * @retval FSP_ERR_NOT_OPEN            Driver is not opened.
+ **********************************************************************************************************************/
+fsp_err_t R_OSPI_WriteCombineFlush (spi_flash_ctrl_t * p_ctrl)
+{
+    ospi_instance_ctrl_t * p_instance_ctrl = (ospi_instance_ctrl_t *) p_ctrl;
+#if OSPI_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_instance_ctrl);
+    FSP_ERROR_RETURN(OSPI_PRV_OPEN == p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+
+    r_ospi_write_combine_commit(p_instance_ctrl);
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Repeat the automatic calibration of the data latch delay, for example after a temperature or voltage change.
+ *
+ * Single continuous read mode is left as it is, so the memory-mapped window remains usable once this function returns.
+ * The OctaFlash must not be accessed while the calibration runs, so this function must not be called from code
+ * executing from the OctaFlash. If the calibration fails the previous delay setting is kept.
+ *
+ * @retval FSP_SUCCESS                 Calibration completed and the new delay is in use.
+ * @retval FSP_ERR_ASSERTION           p_instance_ctrl is NULL.
+ * @retval FSP_ERR_NOT_OPEN            Driver is not opened.
+ * @retval FSP_ERR_UNSUPPORTED         Calibration is only used in OPI modes.
+ * @retval FSP_ERR_DEVICE_BUSY         A Write/Erase transaction is in progress.
+ * @retval FSP_ERR_CALIBRATE_FAILED    Failed to perform auto-calibrate.
+ **********************************************************************************************************************/
+fsp_err_t R_OSPI_AutoCalibrate (spi_flash_ctrl_t * p_ctrl)
+{
+    ospi_instance_ctrl_t * p_instance_ctrl = (ospi_instance_ctrl_t *) p_ctrl;
+#if OSPI_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_instance_ctrl);
+    FSP_ERROR_RETURN(OSPI_PRV_OPEN == p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+    FSP_ERROR_RETURN(SPI_FLASH_PROTOCOL_EXTENDED_SPI != p_instance_ctrl->spi_protocol, FSP_ERR_UNSUPPORTED);
+
+    /* The preamble pattern can't be read while the device is programming or erasing. */
+    FSP_ERROR_RETURN(false == r_ospi_status_sub(p_instance_ctrl, p_instance_ctrl->p_cfg->write_status_bit),
+                     FSP_ERR_DEVICE_BUSY);
+
+    uint32_t  mdtr = R_OSPI->MDTR;
+    fsp_err_t ret  = r_ospi_automatic_calibration_seq(p_instance_ctrl);
+    if (FSP_SUCCESS != ret)
+    {
+        /* Keep the last good delay so the memory-mapped window stays readable. */
+        R_OSPI->MDTR = mdtr;
+    }
+
+    return ret;
+}
+
+/*******************************************************************************************************************//**
+ * Gets the settings in use. If ospi_extended_cfg_t::sfdp is enabled, these include the settings read from SFDP in
+ * R_OSPI_Open(). The memory size and OPI commands are in the ospi_extended_cfg_t referenced by p_extend.
+ *
+ * @param[in]  p_ctrl                  Pointer to a driver handle
+ * @param[out] pp_cfg                  Set to the settings in use
+ *
+ * @retval FSP_SUCCESS                 The settings are in pp_cfg.
+ * @retval FSP_ERR_ASSERTION           p_instance_ctrl or pp_cfg is NULL.
+ * @retval FSP_ERR_NOT_OPEN            Driver is not opened.
+ **********************************************************************************************************************/
+fsp_err_t R_OSPI_ConfigGet (spi_flash_ctrl_t * p_ctrl, spi_flash_cfg_t const ** const pp_cfg)
+{
+    ospi_instance_ctrl_t * p_instance_ctrl = (ospi_instance_ctrl_t *) p_ctrl;
+
+#if OSPI_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_instance_ctrl);
+    FSP_ASSERT(NULL != pp_cfg);
+    FSP_ERROR_RETURN(OSPI_PRV_OPEN == p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+
+    *pp_cfg = p_instance_ctrl->p_cfg;
+
+    return FSP_SUCCESS;
+}
+
 /*******************************************************************************************************************//**
  * @} (end addtogroup OSPI)
  **********************************************************************************************************************/
@@ -762,6 +993,43 @@ static fsp_err_t r_ospi_automatic_calibration_seq (ospi_instance_ctrl_t * p_inst
     return ret;
 }
 
+/*******************************************************************************************************************//**
+ * Program the page being combined by R_OSPI_WriteCombine(). Waits for the previous program to finish, but does not
+ * wait for this one.
+ *
+ * @param[in]   p_instance_ctrl    Pointer to OSPI specific control structure
+ **********************************************************************************************************************/
+static void r_ospi_write_combine_commit (ospi_instance_ctrl_t * p_instance_ctrl)
+{
+    if (NULL == p_instance_ctrl->p_wc_page)
+    {
+        return;
+    }
+
+    uint32_t const * p_page_buffer =
+        ((ospi_extended_cfg_t *) p_instance_ctrl->p_cfg->p_extend)->p_write_combine_buffer;
+
+    /* The previous page has been programming while this one was combined. Wait for it to finish. */
+    while (r_ospi_status_sub(p_instance_ctrl, p_instance_ctrl->p_cfg->write_status_bit))
+    {
+        /* Do nothing. */
+    }
+
+    r_ospi_wen(p_instance_ctrl);
+
+    /* Program the combined range with word accesses so it is sent as one single continuous write (see R_OSPI_Write).
+     * The bytes added by rounding to words are 0xFF in the buffer. */
+    uint32_t   start  = p_instance_ctrl->wc_start / 4U;
+    uint32_t   end    = (p_instance_ctrl->wc_end + 3U) / 4U;
+    uint32_t * p_dest = (uint32_t *) p_instance_ctrl->p_wc_page;
+    for (uint32_t i = start; i < end; i++)
+    {
+        p_dest[i] = p_page_buffer[i];
+    }
+
+    p_instance_ctrl->p_wc_page = NULL;
+}
+
 /*******************************************************************************************************************//**
  * Performs direct data transfer with the OctaFlash
  *
@@ -801,3 +1069,170 @@ static void r_ospi_direct_transfer (ospi_instance_ctrl_t              * p_instan
         p_transfer->data = R_OSPI->CRR;
     }
 }
+
+#if OSPI_CFG_SFDP_SUPPORT_ENABLE
+
+/*******************************************************************************************************************//**
+ * Reads the SFDP tables of the device in SPI mode and replaces the memory size and the DOPI settings with the ones
+ * they describe. The configured settings are kept if the device has no SFDP tables.
+ *
+ * @param[in]   p_instance_ctrl    Pointer to OSPI specific control structure
+ **********************************************************************************************************************/
+static void r_ospi_sfdp_configure (ospi_instance_ctrl_t * p_instance_ctrl)
+{
+    spi_flash_cfg_t const     * p_cfg        = p_instance_ctrl->p_cfg;
+    ospi_extended_cfg_t const * p_cfg_extend = (ospi_extended_cfg_t const *) p_cfg->p_extend;
+    uint32_t                    header[2];
+
+    /* Read the SFDP header (JESD216 section 6.2). */
+    r_ospi_sfdp_read(p_instance_ctrl, 0U, header, 2U);
+    if (OSPI_PRV_SFDP_SIGNATURE != header[0])
+    {
+        return;
+    }
+
+    /* Read the Basic Flash Parameter Table and the xSPI Profile 1.0 table (JESD251). */
+    uint32_t bfpt[OSPI_PRV_SFDP_BFPT_DWORDS_MAX]       = {0U};
+    uint32_t profile[OSPI_PRV_SFDP_PROFILE_1_0_DWORDS] = {0U};
+    uint32_t bfpt_dwords   = 0U;
+    bool     profile_found = false;
+    uint32_t headers       = ((header[1] >> 16) & UINT8_MAX) + 1U;
+
+    for (uint32_t i = 0U; i < headers; i++)
+    {
+        uint32_t param[2];
+        r_ospi_sfdp_read(p_instance_ctrl, OSPI_PRV_SFDP_HEADER_ADDRESS + (i * (uint32_t) sizeof(param)), param, 2U);
+
+        uint32_t id      = (param[0] & UINT8_MAX) | ((param[1] >> 16) & 0xFF00U);
+        uint32_t dwords  = param[0] >> 24;
+        uint32_t address = param[1] & 0xFFFFFFU;
+
+        if ((OSPI_PRV_SFDP_BFPT_ID == id) && (0U == bfpt_dwords))
+        {
+            bfpt_dwords = (dwords < OSPI_PRV_SFDP_BFPT_DWORDS_MAX) ? dwords : OSPI_PRV_SFDP_BFPT_DWORDS_MAX;
+            r_ospi_sfdp_read(p_instance_ctrl, address, bfpt, bfpt_dwords);
+        }
+        else if ((OSPI_PRV_SFDP_PROFILE_1_0_ID == id) && (dwords >= OSPI_PRV_SFDP_PROFILE_1_0_DWORDS))
+        {
+            r_ospi_sfdp_read(p_instance_ctrl, address, profile, OSPI_PRV_SFDP_PROFILE_1_0_DWORDS);
+            profile_found = true;
+        }
+        else
+        {
+            /* Other tables are not used. */
+        }
+    }
+
+    if (bfpt_dwords < OSPI_PRV_SFDP_BFPT_DWORDS_MIN)
+    {
+        return;
+    }
+
+    p_instance_ctrl->sfdp_cfg          = *p_cfg;
+    p_instance_ctrl->sfdp_cfg_extend   = *p_cfg_extend;
+    p_instance_ctrl->sfdp_cfg.p_extend = &p_instance_ctrl->sfdp_cfg_extend;
+
+    /* The density in DWORD 2 is in bits, either as the highest bit address or as a power of 2. Sizes beyond the
+     * 32-bit address space keep the configured size. */
+    if (bfpt[1] & OSPI_PRV_SFDP_DENSITY_EXPONENT)
+    {
+        uint32_t exponent = bfpt[1] & ~OSPI_PRV_SFDP_DENSITY_EXPONENT;
+        if ((exponent >= 3U) && (exponent < 35U))
+        {
+            p_instance_ctrl->sfdp_cfg_extend.memory_size = 1U << (exponent - 3U);
+        }
+    }
+    else
+    {
+        p_instance_ctrl->sfdp_cfg_extend.memory_size = (bfpt[1] / 8U) + 1U;
+    }
+
+    /* The command extension used in 8D-8D-8D mode is in DWORD 18 (JESD216C and later). 16-bit commands are not
+     * described by the xSPI Profile 1.0 table, so the configured OPI commands are kept for them. */
+    uint32_t extension = (bfpt_dwords >= OSPI_PRV_SFDP_BFPT_EXTENSION_DWORDS) ? ((bfpt[17] >> 29) & 3U) :
+                         OSPI_PRV_SFDP_EXTENSION_16_BIT;
+
+    if (profile_found && (OSPI_PRV_SFDP_EXTENSION_16_BIT != extension) &&
+        (OSPI_PRV_SFDP_EXTENSION_RESERVED != extension))
+    {
+        ospi_opi_command_set_t * p_opi_commands = &p_instance_ctrl->sfdp_opi_commands;
+        uint8_t                  invert         = (OSPI_PRV_SFDP_EXTENSION_INVERT == extension) ? UINT8_MAX : 0U;
+
+        if (NULL != p_cfg_extend->p_opi_commands)
+        {
+            *p_opi_commands = *p_cfg_extend->p_opi_commands;
+        }
+        else
+        {
+            /* There is no SOPI read command in the xSPI Profile 1.0 table. Use the DOPI one. */
+            p_opi_commands->read_command = r_ospi_sfdp_command((profile[0] >> 8) & UINT8_MAX, invert);
+        }
+
+        /* Commands are 1 byte followed by the extension. xSPI Profile 1.0 devices use the standard commands for
+         * programming, write enable and status. */
+        p_opi_commands->dual_read_command    = r_ospi_sfdp_command((profile[0] >> 8) & UINT8_MAX, invert);
+        p_opi_commands->page_program_command = r_ospi_sfdp_command(OSPI_PRV_4BYTE_PAGE_PROGRAM_COMMAND, invert);
+        p_opi_commands->write_enable_command = r_ospi_sfdp_command(OSPI_PRV_WRITE_ENABLE_COMMAND, invert);
+        p_opi_commands->status_command       = r_ospi_sfdp_command(OSPI_PRV_READ_STATUS_COMMAND, invert);
+        p_opi_commands->command_bytes        = 2U;
+
+        /* Use the dummy cycles of the highest frequency described, since the OCTACLK frequency is not known here.
+         * An even number of cycles is used in DDR mode. */
+        uint32_t dummy = (profile[3] >> 7) & OSPI_PRV_SFDP_DUMMY_MASK;
+        dummy = (0U != dummy) ? dummy : ((profile[4] >> 27) & OSPI_PRV_SFDP_DUMMY_MASK);
+        dummy = (0U != dummy) ? dummy : ((profile[4] >> 17) & OSPI_PRV_SFDP_DUMMY_MASK);
+        dummy = (0U != dummy) ? dummy : ((profile[4] >> 7) & OSPI_PRV_SFDP_DUMMY_MASK);
+        dummy = (0U != dummy) ? dummy : OSPI_PRV_SFDP_DUMMY_DEFAULT;
+
+        p_instance_ctrl->sfdp_cfg_extend.opi_mem_read_dummy_cycles = (uint8_t) ((dummy + 1U) & ~1U);
+        p_instance_ctrl->sfdp_cfg_extend.p_opi_commands            = p_opi_commands;
+    }
+
+    /* Use the settings read from SFDP. */
+    p_instance_ctrl->p_cfg = &p_instance_ctrl->sfdp_cfg;
+
+    R_OSPI->DSR[p_instance_ctrl->channel] = p_instance_ctrl->sfdp_cfg_extend.memory_size & R_OSPI_DSR_DVSZ_Msk;
+}
+
+/*******************************************************************************************************************//**
+ * Reads SFDP data in SPI mode. SFDP is read with a 3 byte address and 8 dummy cycles.
+ *
+ * @param[in]   p_instance_ctrl    Pointer to OSPI specific control structure
+ * @param[in]   address            SFDP address to read from
+ * @param[out]  p_dest             Pointer to store data
+ * @param[in]   dwords             Number of DWORDs to read
+ **********************************************************************************************************************/
+static void r_ospi_sfdp_read (ospi_instance_ctrl_t * p_instance_ctrl,
+                              uint32_t               address,
+                              uint32_t * const       p_dest,
+                              uint32_t               dwords)
+{
+    spi_flash_direct_transfer_t direct_command = {0};
+    direct_command.command        = OSPI_PRV_SFDP_READ_COMMAND;
+    direct_command.command_length = 1U;
+    direct_command.address_length = 3U;
+    direct_command.dummy_cycles   = OSPI_PRV_SFDP_DUMMY_CYCLES;
+    direct_command.data_length    = (uint8_t) sizeof(uint32_t);
+
+    for (uint32_t i = 0U; i < dwords; i++)
+    {
+        direct_command.address = address + (i * (uint32_t) sizeof(uint32_t));
+        r_ospi_direct_transfer(p_instance_ctrl, &direct_command, SPI_FLASH_DIRECT_TRANSFER_DIR_READ);
+        p_dest[i] = direct_command.data;
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Builds a 2 byte OPI command from a command and its extension.
+ *
+ * @param[in]   command            Command byte
+ * @param[in]   invert             UINT8_MAX if the extension is the inverted command, 0 if it is the command repeated
+ *
+ * @return OPI command.
+ **********************************************************************************************************************/
+static uint16_t r_ospi_sfdp_command (uint32_t command, uint8_t invert)
+{
+    return (uint16_t) ((command << 8) | ((command ^ invert) & UINT8_MAX));
+}
+
+#endif
@@ -75,8 +75,9 @@ void pdc_int_isr(void);
 /***********************************************************************************************************************
  * Private function prototypes
  **********************************************************************************************************************/
-void        r_pdc_transfer_callback(pdc_instance_ctrl_t * p_ctrl);
-static void r_pdc_error_handler(pdc_instance_ctrl_t * p_ctrl);
+void             r_pdc_transfer_callback(pdc_instance_ctrl_t * p_ctrl);
+static void      r_pdc_error_handler(pdc_instance_ctrl_t * p_ctrl);
+static fsp_err_t r_pdc_capture_configure(pdc_instance_ctrl_t * p_ctrl);
 
 /***********************************************************************************************************************
  * Private global variables
@@ -98,10 +99,11 @@ static const fsp_version_t g_pdc_version =
 /* PDC API  */
 const pdc_api_t g_pdc_on_pdc =
 {
-    .open         = R_PDC_Open,
-    .close        = R_PDC_Close,
-    .captureStart = R_PDC_CaptureStart,
-    .versionGet   = R_PDC_VersionGet,
+    .open              = R_PDC_Open,
+    .close             = R_PDC_Close,
+    .captureStart      = R_PDC_CaptureStart,
+    .captureChainStart = R_PDC_CaptureChainStart,
+    .versionGet        = R_PDC_VersionGet,
 };
 
 /*******************************************************************************************************************//**
@@ -181,6 +183,9 @@ fsp_err_t R_PDC_Open (pdc_ctrl_t * const p_api_ctrl, pdc_cfg_t const * const p_c
     p_ctrl->transfer_in_progress = false;
     p_ctrl->p_callback           = p_cfg->p_callback;
     p_ctrl->p_context            = p_cfg->p_context;
+    p_ctrl->p_links              = NULL;
+    p_ctrl->num_links            = 0U;
+    p_ctrl->links_done           = 0U;
 
     /** Disable module stop mode for PDC */
     R_BSP_MODULE_START(FSP_IP_PDC, 0);
@@ -316,59 +321,24 @@ fsp_err_t R_PDC_CaptureStart (pdc_ctrl_t * const p_api_ctrl, uint8_t * const p_b
     /* Check if a transfer is already in progress */
     FSP_ERROR_RETURN((p_ctrl->transfer_in_progress == false), FSP_ERR_IN_USE);
 #endif
-    uint32_t pccr0_initial_setting =
-        (uint32_t) ((uint32_t) (p_ctrl->p_cfg->clock_division << R_PDC_PCCR0_PCKDIV_Pos) & R_PDC_PCCR0_PCKDIV_Msk) |
-        (1U << R_PDC_PCCR0_PCKOE_Pos) |
-        (1U << R_PDC_PCCR0_PCKE_Pos);
-
     if (NULL != p_buffer)
     {
         p_ctrl->p_current_buffer = p_buffer;
     }
 
-    /* Reset PDC */
-    /* Retain old settings and apply reset */
-    R_PDC->PCCR0 = pccr0_initial_setting | (1U << R_PDC_PCCR0_PRST_Pos);
+    err = r_pdc_capture_configure(p_ctrl);
+    FSP_ERROR_RETURN((err == FSP_SUCCESS), err);
 
-    /* Wait for PDC reset bit (PRST) to clear as described in hardware manual (see Section 44.2.1
-     * 'PDC Control Register 0 (PCCR0): PRST' of the RA6M3 manual R01UH0886EJ0100).
-     */
-    uint32_t timeout = PDC_PERIPHERAL_REG_MAX_WAIT;
-    PDC_HARDWARE_REGISTER_WAIT(R_PDC->PCCR0, pccr0_initial_setting, timeout);
-    if (!timeout)
+    if (NULL != p_ctrl->p_links)
     {
-        return FSP_ERR_TIMEOUT;
+        /* The previous capture was chained, restore the single transfer. */
+        p_ctrl->p_links = NULL;
+        err             = p_ctrl->p_cfg->p_lower_lvl_transfer->p_api->reconfigure(
+            p_ctrl->p_cfg->p_lower_lvl_transfer->p_ctrl,
+            p_ctrl->p_cfg->p_lower_lvl_transfer->p_cfg->p_info);
+        FSP_ERROR_RETURN((err == FSP_SUCCESS), err);
     }
 
-    /** Set horizontal capture range */
-    R_PDC->HCR =
-        (uint32_t) ((uint32_t) (p_ctrl->p_cfg->x_capture_start_pixel * p_ctrl->p_cfg->bytes_per_pixel) &
-                    R_PDC_HCR_HST_Msk) |
-        (uint32_t) ((uint32_t) ((p_ctrl->p_cfg->x_capture_pixels * p_ctrl->p_cfg->bytes_per_pixel) << 16) &
-                    R_PDC_HCR_HSZ_Msk);
-
-    /** Set vertical capture range */
-    R_PDC->VCR = (uint32_t) ((p_ctrl->p_cfg->y_capture_start_pixel) & R_PDC_VCR_VST_Msk) |
-                 (uint32_t) ((uint32_t) ((p_ctrl->p_cfg->y_capture_pixels) << 16) & R_PDC_VCR_VSZ_Msk);
-
-    /**
-     * Set VSYNC polarity
-     * Set HSYNC polarity
-     * Set endianess of capture data
-     * Enable interrupts
-     * Receive data ready interrupt,
-     * Underrun interrupt,
-     * Overrun interrupt,
-     * Frame end interrupt,
-     * Vertical line number setting error interrupt,
-     * Horizontal byte number setting error interrupt */
-    R_PDC->PCCR0 = pccr0_initial_setting |
-                   (uint32_t) ((uint32_t) p_ctrl->p_cfg->vsync_polarity << R_PDC_PCCR0_VPS_Pos |
-                               (uint32_t) p_ctrl->p_cfg->hsync_polarity << R_PDC_PCCR0_HPS_Pos |
-                               (uint32_t) p_ctrl->p_cfg->endian << R_PDC_PCCR0_EDS_Pos |
-                               (R_PDC_PCCR0_DFIE_Msk | R_PDC_PCCR0_UDRIE_Msk | R_PDC_PCCR0_OVIE_Msk |
-                                R_PDC_PCCR0_FEIE_Msk | R_PDC_PCCR0_VERIE_Msk | R_PDC_PCCR0_HERIE_Msk));
-
     /* Set destination buffer and enable transfer */
     err = p_ctrl->p_cfg->p_lower_lvl_transfer->p_api->reset(p_ctrl->p_cfg->p_lower_lvl_transfer->p_ctrl,
                                                             p_ctrl->p_cfg->p_lower_lvl_transfer->p_cfg->p_info->p_src,
@@ -385,6 +355,94 @@ fsp_err_t R_PDC_CaptureStart (pdc_ctrl_t * const p_api_ctrl, uint8_t * const p_b
     return FSP_SUCCESS;
 }
 
+/*******************************************************************************************************************//**
+ * @brief  Starts a capture split across a chain of DMAC transfers. Enables interrupts.
+ *
+ * Implements @ref pdc_api_t::captureChainStart.
+ *
+ * Works like @ref pdc_api_t::captureStart, except that the frame is written to the destinations of the links in
+ * order. The caller sets p_dest and num_blocks of each link, the driver fills in the other fields. A block is
+ * 32 bytes, and the blocks of all links must add up to the frame. The callback is called with
+ * PDC_EVENT_STRIPE_COMPLETE and the destination of the link after each link but the last one, and with
+ * PDC_EVENT_TRANSFER_COMPLETE and the destination of the last link at the end of the frame. The links must stay valid
+ * until the capture is complete. The DMAC instance must not loop the chain. A frame lost to an error is only reported
+ * with the error event, and the next capture may be started from the callback.
+ *
+ * @retval FSP_SUCCESS              Capture start successful.
+ * @retval FSP_ERR_ASSERTION        p_api_ctrl or p_links is NULL, or num_links is 0.
+ * @retval FSP_ERR_NOT_OPEN         Open has not been successfully called.
+ * @retval FSP_ERR_IN_USE           PDC transfer is already in progress.
+ * @retval FSP_ERR_INVALID_ARGUMENT The blocks of the links do not add up to the frame.
+ * @retval FSP_ERR_UNSUPPORTED      The PDC uses the DTC, which cannot notify the end of each link.
+ * @retval FSP_ERR_TIMEOUT          Reset operation timed out.
+ **********************************************************************************************************************/
+fsp_err_t R_PDC_CaptureChainStart (pdc_ctrl_t * const      p_api_ctrl,
+                                   transfer_info_t * const p_links,
+                                   uint32_t const          num_links)
+{
+    pdc_instance_ctrl_t * p_ctrl = (pdc_instance_ctrl_t *) p_api_ctrl;
+    fsp_err_t             err    = FSP_SUCCESS;
+    uint32_t              blocks = 0U;
+
+#if (PDC_CFG_PARAM_CHECKING_ENABLE)
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ASSERT(NULL != p_links);
+    FSP_ASSERT(0U != num_links);
+
+    /* Check driver is open */
+    FSP_ERROR_RETURN((PDC_PRV_OPEN == p_ctrl->open), FSP_ERR_NOT_OPEN);
+
+    /* Check if a transfer is already in progress */
+    FSP_ERROR_RETURN((p_ctrl->transfer_in_progress == false), FSP_ERR_IN_USE);
+#endif
+
+    /* The DTC only interrupts at the end of the whole chain. */
+    FSP_ERROR_RETURN(p_ctrl->p_cfg->transfer_req_irq < 0, FSP_ERR_UNSUPPORTED);
+
+    /* Every link reads blocks from PCDR like the single transfer set up in open, and notifies its end. */
+    uint32_t transfer_settings = p_ctrl->p_cfg->p_lower_lvl_transfer->p_cfg->p_info->transfer_settings_word;
+    transfer_settings &= ~(((uint32_t) 3U << TRANSFER_SETTINGS_CHAIN_MODE_BITS) |
+                           ((uint32_t) 1U << TRANSFER_SETTINGS_IRQ_BITS));
+
+    for (uint32_t i = 0U; i < num_links; i++)
+    {
+        blocks += p_links[i].num_blocks;
+
+        p_links[i].transfer_settings_word = transfer_settings;
+        p_links[i].p_src                  = (void const *) &R_PDC->PCDR;
+        p_links[i].length                 = PDC_PRV_TRANSFERS_PER_BLOCK;
+
+        if (i < (num_links - 1U))
+        {
+            p_links[i].chain_mode = TRANSFER_CHAIN_MODE_END;
+            p_links[i].irq        = TRANSFER_IRQ_EACH;
+        }
+    }
+
+    FSP_ERROR_RETURN(blocks == p_ctrl->num_blocks, FSP_ERR_INVALID_ARGUMENT);
+
+    err = r_pdc_capture_configure(p_ctrl);
+    FSP_ERROR_RETURN((err == FSP_SUCCESS), err);
+
+    /* Load the chain and enable transfer */
+    err = p_ctrl->p_cfg->p_lower_lvl_transfer->p_api->reconfigure(p_ctrl->p_cfg->p_lower_lvl_transfer->p_ctrl,
+                                                                  p_links);
+    FSP_ERROR_RETURN((err == FSP_SUCCESS), err);
+
+    p_ctrl->p_links          = p_links;
+    p_ctrl->num_links        = num_links;
+    p_ctrl->links_done       = 0U;
+    p_ctrl->p_current_buffer = (uint8_t *) p_links[num_links - 1U].p_dest;
+
+    /* Mark transfer as in progress */
+    p_ctrl->transfer_in_progress = true;
+
+    /* Set PCCR1.PCE as 1 */
+    R_PDC->PCCR1 = 1;
+
+    return FSP_SUCCESS;
+}
+
 /*******************************************************************************************************************//**
  * @brief Return PDC HAL driver version.
  *
@@ -414,6 +472,64 @@ fsp_err_t R_PDC_VersionGet (fsp_version_t * const p_version)
  * Private Functions
  **********************************************************************************************************************/
 
+/*******************************************************************************************************************//**
+ * @brief  Resets the PDC and applies the capture settings. The PIXCLK input must be running.
+ *
+ * @param[in]     p_ctrl         Pointer to the instance control block.
+ *
+ * @retval FSP_SUCCESS           PDC configured.
+ * @retval FSP_ERR_TIMEOUT       Reset operation timed out.
+ **********************************************************************************************************************/
+static fsp_err_t r_pdc_capture_configure (pdc_instance_ctrl_t * p_ctrl)
+{
+    uint32_t pccr0_initial_setting =
+        (uint32_t) ((uint32_t) (p_ctrl->p_cfg->clock_division << R_PDC_PCCR0_PCKDIV_Pos) & R_PDC_PCCR0_PCKDIV_Msk) |
+        (1U << R_PDC_PCCR0_PCKOE_Pos) |
+        (1U << R_PDC_PCCR0_PCKE_Pos);
+
+    /* Reset PDC */
+    /* Retain old settings and apply reset */
+    R_PDC->PCCR0 = pccr0_initial_setting | (1U << R_PDC_PCCR0_PRST_Pos);
+
+    /* Wait for PDC reset bit (PRST) to clear as described in hardware manual (see Section 44.2.1
+     * 'PDC Control Register 0 (PCCR0): PRST' of the RA6M3 manual R01UH0886EJ0100).
+     */
+    uint32_t timeout = PDC_PERIPHERAL_REG_MAX_WAIT;
+    PDC_HARDWARE_REGISTER_WAIT(R_PDC->PCCR0, pccr0_initial_setting, timeout);
+    FSP_ERROR_RETURN(0U != timeout, FSP_ERR_TIMEOUT);
+
+    /** Set horizontal capture range */
+    R_PDC->HCR =
+        (uint32_t) ((uint32_t) (p_ctrl->p_cfg->x_capture_start_pixel * p_ctrl->p_cfg->bytes_per_pixel) &
+                    R_PDC_HCR_HST_Msk) |
+        (uint32_t) ((uint32_t) ((p_ctrl->p_cfg->x_capture_pixels * p_ctrl->p_cfg->bytes_per_pixel) << 16) &
+                    R_PDC_HCR_HSZ_Msk);
+
+    /** Set vertical capture range */
+    R_PDC->VCR = (uint32_t) ((p_ctrl->p_cfg->y_capture_start_pixel) & R_PDC_VCR_VST_Msk) |
+                 (uint32_t) ((uint32_t) ((p_ctrl->p_cfg->y_capture_pixels) << 16) & R_PDC_VCR_VSZ_Msk);
+
+    /**
+     * Set VSYNC polarity
+     * Set HSYNC polarity
+     * Set endianess of capture data
+     * Enable interrupts
+     * Receive data ready interrupt,
+     * Underrun interrupt,
+     * Overrun interrupt,
+     * Frame end interrupt,
+     * Vertical line number setting error interrupt,
+     * Horizontal byte number setting error interrupt */
+    R_PDC->PCCR0 = pccr0_initial_setting |
+                   (uint32_t) ((uint32_t) p_ctrl->p_cfg->vsync_polarity << R_PDC_PCCR0_VPS_Pos |
+                               (uint32_t) p_ctrl->p_cfg->hsync_polarity << R_PDC_PCCR0_HPS_Pos |
+                               (uint32_t) p_ctrl->p_cfg->endian << R_PDC_PCCR0_EDS_Pos |
+                               (R_PDC_PCCR0_DFIE_Msk | R_PDC_PCCR0_UDRIE_Msk | R_PDC_PCCR0_OVIE_Msk |
+                                R_PDC_PCCR0_FEIE_Msk | R_PDC_PCCR0_VERIE_Msk | R_PDC_PCCR0_HERIE_Msk));
+
+    return FSP_SUCCESS;
+}
+
 /*******************************************************************************************************************//**
  * @brief  Internal transfer complete callback for PDC driver.
  *
@@ -428,6 +544,23 @@ void r_pdc_transfer_callback (pdc_instance_ctrl_t * p_ctrl)
 {
     pdc_callback_args_t pdc_args;
     uint16_t            timeout = PDC_PERIPHERAL_REG_MAX_WAIT;
+    bool                chained = (NULL != p_ctrl->p_links);
+
+    if (chained)
+    {
+        p_ctrl->links_done++;
+
+        if (p_ctrl->links_done < p_ctrl->num_links)
+        {
+            /* A link of a chained capture is complete, the PDC keeps capturing into the next link. */
+            pdc_args.p_context = p_ctrl->p_context;
+            pdc_args.event     = PDC_EVENT_STRIPE_COMPLETE;
+            pdc_args.p_buffer  = (uint8_t *) p_ctrl->p_links[p_ctrl->links_done - 1U].p_dest;
+            p_ctrl->p_callback(&pdc_args);
+
+            return;
+        }
+    }
 
     /* Performs PDC operation flow as described in hardware manual (see Figure 44.19
      * 'Example operation flow' of the RA6M3 manual R01UH0886EJ0100).
@@ -449,6 +582,8 @@ void r_pdc_transfer_callback (pdc_instance_ctrl_t * p_ctrl)
     /* Clear FEF frame end flag */
     R_PDC->PCSR &= ~R_PDC_PCSR_FEF_Msk;
 
+    p_ctrl->transfer_in_progress = false;
+
     if (0UL != (R_PDC_PCSR_UDRF_Msk & R_PDC->PCSR))
     {
         /* Underrun error has occurred */
@@ -458,12 +593,18 @@ void r_pdc_transfer_callback (pdc_instance_ctrl_t * p_ctrl)
 
         /* Call the error handler */
         r_pdc_error_handler(p_ctrl);
+
+        /* A chained capture reports the lost frame with the error event only, so the callback can start the next
+         * capture from there. */
+        if (chained)
+        {
+            return;
+        }
     }
 
-    p_ctrl->transfer_in_progress = false;
-    pdc_args.p_context           = p_ctrl;
-    pdc_args.event               = PDC_EVENT_TRANSFER_COMPLETE;
-    pdc_args.p_buffer            = p_ctrl->p_current_buffer;
+    pdc_args.p_context = p_ctrl->p_context;
+    pdc_args.event     = PDC_EVENT_TRANSFER_COMPLETE;
+    pdc_args.p_buffer  = p_ctrl->p_current_buffer;
     p_ctrl->p_callback(&pdc_args);
 }
 
@@ -527,6 +668,9 @@ static void r_pdc_error_handler (pdc_instance_ctrl_t * p_ctrl)
     /* Disable the transfer */
     p_ctrl->p_cfg->p_lower_lvl_transfer->p_api->disable(p_ctrl->p_cfg->p_lower_lvl_transfer->p_ctrl);
 
+    /* The capture is stopped, so a new one can be started from the callback */
+    p_ctrl->transfer_in_progress = false;
+
     /* Report all the errors at once */
     uint32_t event = R_PDC->PCSR;
     R_PDC->PCSR        = ~event & PDC_PRV_PCSR_MASK;
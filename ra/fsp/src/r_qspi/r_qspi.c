@@ -36,6 +36,35 @@
 #define QSPI_PRV_LSB_NIBBLE_CLEARED           (0xEEEEEEEE)
 #define QSPI_PRV_EVEN_BITS_CLEARED            (0xAAAA)
 
+#define QSPI_PRV_DMAC_MAX_TRANSFERS           (0xFFFFU)
+
+/* Serial Flash Discoverable Parameters (JESD216) definitions. */
+#define QSPI_PRV_SFDP_READ_COMMAND            (0x5AU)
+#define QSPI_PRV_SFDP_SIGNATURE               (0x50444653U) /* "SFDP" */
+#define QSPI_PRV_SFDP_HEADER_ADDRESS          (8U)
+#define QSPI_PRV_SFDP_BFPT_ID                 (0xFF00U)
+#define QSPI_PRV_SFDP_4BAIT_ID                (0xFF84U)
+#define QSPI_PRV_SFDP_BFPT_DWORDS_MAX         (16U)
+#define QSPI_PRV_SFDP_BFPT_DWORDS_MIN         (9U)
+#define QSPI_PRV_SFDP_BFPT_PAGE_SIZE_DWORDS   (11U)
+#define QSPI_PRV_SFDP_BFPT_QER_DWORDS         (15U)
+#define QSPI_PRV_SFDP_4BAIT_DWORDS            (2U)
+#define QSPI_PRV_SFDP_4BAIT_PAGE_PROGRAM      (1U << 6)
+#define QSPI_PRV_SFDP_4BAIT_ERASE_TYPE_1      (1U << 9)
+#define QSPI_PRV_SFDP_DENSITY_EXPONENT        (1U << 31)
+#define QSPI_PRV_SFDP_4_BYTE_ONLY             (2U)
+#define QSPI_PRV_SFDP_3_BYTE_SIZE_MAX         (16U * 1024U * 1024U)
+
+#define QSPI_PRV_PAGE_PROGRAM_COMMAND         (0x02U)
+#define QSPI_PRV_4BYTE_PAGE_PROGRAM_COMMAND   (0x12U)
+#define QSPI_PRV_CHIP_ERASE_COMMAND           (0xC7U)
+#define QSPI_PRV_READ_STATUS_1_COMMAND        (0x05U)
+#define QSPI_PRV_WRITE_STATUS_COMMAND         (0x01U)
+#define QSPI_PRV_DEFAULT_PAGE_SIZE_BYTES      (256U)
+#define QSPI_PRV_FAST_READ_DUMMY_CLOCKS       (8U)
+#define QSPI_PRV_DUMMY_CLOCKS_MIN             (3U)
+#define QSPI_PRV_DUMMY_CLOCKS_MAX             (17U)
+
 /***********************************************************************************************************************
  * Typedef definitions
  **********************************************************************************************************************/
@@ -43,6 +72,22 @@
 /* Number of address bytes in 4 byte address mode. */
 #define QSPI_4_BYTE_ADDRESS                   (4U)
 
+#if QSPI_CFG_SFDP_SUPPORT_ENABLE
+
+/* Fast read mode described in the Basic Flash Parameter Table. */
+typedef struct st_qspi_prv_sfdp_read_mode
+{
+    spi_flash_read_mode_t read_mode;      // Read mode, which selects the command the QSPI sends
+    uint8_t               command;        // Command the QSPI sends in 3 byte address mode
+    uint8_t               dword;          // BFPT DWORD number describing the mode, 0 if it is not described
+    uint8_t               shift;          // Position of the wait state, mode clock and command fields in the DWORD
+    uint32_t              support_mask;   // BFPT DWORD 1 bit set if the mode is supported, 0 if always supported
+    uint32_t              bait_mask;      // 4BAIT DWORD 1 bit set if the 4 byte address command is supported
+    uint8_t               default_clocks; // Dummy clocks used by SPI_FLASH_DUMMY_CLOCKS_DEFAULT
+} qspi_prv_sfdp_read_mode_t;
+
+#endif
+
 /***********************************************************************************************************************
  * Private function prototypes
  **********************************************************************************************************************/
@@ -61,8 +106,27 @@ static void r_qspi_direct_write_sub(uint8_t const * const p_src, uint32_t const
 static void r_qspi_direct_read_sub(uint8_t * const p_dest, uint32_t const bytes);
 static bool r_qspi_status_sub(qspi_instance_ctrl_t * p_instance_ctrl);
 
+static bool r_qspi_page_program_start(qspi_instance_ctrl_t * p_instance_ctrl, uint8_t * const p_dest);
+
+static void r_qspi_page_program_end(bool restore_spi_mode);
+
+#if QSPI_CFG_DMAC_SUPPORT_ENABLE
+
+static fsp_err_t r_qspi_dma_start(qspi_instance_ctrl_t * p_instance_ctrl);
+
+#endif
+
 static fsp_err_t r_qspi_xip(qspi_instance_ctrl_t * p_instance_ctrl, uint8_t code, bool enter_mode);
 
+#if QSPI_CFG_SFDP_SUPPORT_ENABLE
+
+static void r_qspi_sfdp_configure(qspi_instance_ctrl_t * p_instance_ctrl, qspi_sfdp_t sfdp);
+static void r_qspi_sfdp_read(uint32_t address, void * const p_dest, uint32_t bytes);
+static bool r_qspi_sfdp_quad_enable(qspi_instance_ctrl_t * p_instance_ctrl, uint32_t qer, bool set);
+static uint8_t r_qspi_register_read(uint8_t command);
+
+#endif
+
 #if QSPI_CFG_PARAM_CHECKING_ENABLE
 
 static fsp_err_t r_qspi_param_checking_dcom(qspi_instance_ctrl_t * p_instance_ctrl);
@@ -99,6 +163,21 @@ static void(*const gp_qspi_prv_byte_write[3]) (uint8_t byte) =
 };
 #endif
 
+#if QSPI_CFG_SFDP_SUPPORT_ENABLE
+
+/* Fast read modes in order of preference. The QSPI sends a fixed command for each read mode, so a mode is only
+ * selected if the device uses the same command. */
+static const qspi_prv_sfdp_read_mode_t g_qspi_prv_sfdp_read_modes[] =
+{
+    {SPI_FLASH_READ_MODE_FAST_READ_QUAD_IO,     0xEBU, 3U, 0U,  1U << 21, 1U << 5, 6U},
+    {SPI_FLASH_READ_MODE_FAST_READ_QUAD_OUTPUT, 0x6BU, 3U, 16U, 1U << 22, 1U << 4, 8U},
+    {SPI_FLASH_READ_MODE_FAST_READ_DUAL_IO,     0xBBU, 4U, 16U, 1U << 20, 1U << 3, 4U},
+    {SPI_FLASH_READ_MODE_FAST_READ_DUAL_OUTPUT, 0x3BU, 4U, 0U,  1U << 16, 1U << 2, 8U},
+    {SPI_FLASH_READ_MODE_FAST_READ,             0x0BU, 0U, 0U,  0U,       1U << 1, 8U},
+    {SPI_FLASH_READ_MODE_STANDARD,              0x03U, 0U, 0U,  0U,       1U << 0, 0U},
+};
+#endif
+
 /*******************************************************************************************************************//**
  * @addtogroup QSPI
  * @{
@@ -132,6 +211,11 @@ const spi_flash_api_t g_qspi_on_spi_flash =
  * Open the QSPI driver module. After the driver is open, the QSPI can be accessed like internal flash memory starting
  * at address 0x60000000.
  *
+ * If qspi_extended_cfg_t::sfdp is enabled, the SFDP tables of the device are read and the fastest supported read
+ * mode, the address mode, the page size and the erase commands replace the ones in p_cfg. The remaining settings are
+ * kept. The settings in use are returned by R_QSPI_ConfigGet(). If the device has no SFDP tables, p_cfg is used as
+ * configured.
+ *
  * Implements @ref spi_flash_api_t::open.
  *
  * @retval FSP_SUCCESS             Configuration was successful.
@@ -153,6 +237,17 @@ fsp_err_t R_QSPI_Open (spi_flash_ctrl_t * p_ctrl, spi_flash_cfg_t const * const
 
     qspi_extended_cfg_t * p_cfg_extend = (qspi_extended_cfg_t *) p_cfg->p_extend;
 
+#if QSPI_CFG_PARAM_CHECKING_ENABLE
+ #if QSPI_CFG_SFDP_SUPPORT_ENABLE
+
+    /* SFDP is read with a single line command. */
+    FSP_ASSERT((QSPI_SFDP_DISABLED == p_cfg_extend->sfdp) ||
+               (SPI_FLASH_PROTOCOL_EXTENDED_SPI == p_cfg->spi_protocol));
+ #else
+    FSP_ASSERT(QSPI_SFDP_DISABLED == p_cfg_extend->sfdp);
+ #endif
+#endif
+
     /* Initialized unused registers. */
     R_QSPI->SFMCST  = 0U;
     R_QSPI->SFMSIC  = 0U;
@@ -193,6 +288,14 @@ fsp_err_t R_QSPI_Open (spi_flash_ctrl_t * p_ctrl, spi_flash_cfg_t const * const
 
     /* The memory size is read from the device if needed. */
     p_instance_ctrl->total_size_bytes = 0U;
+    p_instance_ctrl->dma_in_progress  = false;
+
+#if QSPI_CFG_SFDP_SUPPORT_ENABLE
+    if (QSPI_SFDP_DISABLED != p_cfg_extend->sfdp)
+    {
+        r_qspi_sfdp_configure(p_instance_ctrl, p_cfg_extend->sfdp);
+    }
+#endif
 
     p_instance_ctrl->open = QSPI_PRV_OPEN;
 
@@ -329,59 +432,8 @@ fsp_err_t R_QSPI_Write (spi_flash_ctrl_t    * p_ctrl,
     FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
 #endif
 
-    uint32_t chip_address = (uint32_t) p_dest - (uint32_t) QSPI_DEVICE_START_ADDRESS + R_QSPI->SFMCNT1;
-
-    bool restore_spi_mode = false;
-    void (* write_command)(uint8_t byte) = qspi_d0_byte_write_standard;
-    void (* write_address)(uint8_t byte) = qspi_d0_byte_write_standard;
-
-#if QSPI_CFG_SUPPORT_EXTENDED_SPI_MULTI_LINE_PROGRAM
-
-    /* If the peripheral is in extended SPI mode, and the configuration provided in the BSP allows for programming on
-     * multiple data lines, and a unique command is provided for the required mode, update the SPI protocol to send
-     * data on multiple lines. */
-    if ((SPI_FLASH_DATA_LINES_1 != p_instance_ctrl->data_lines) &&
-        (SPI_FLASH_PROTOCOL_EXTENDED_SPI == R_QSPI->SFMSPC_b.SFMSPI))
-    {
-        R_QSPI->SFMSPC_b.SFMSPI = p_instance_ctrl->data_lines;
-
-        restore_spi_mode = true;
-
-        /* Write command in extended SPI mode on one line. */
-        write_command = gp_qspi_prv_byte_write[p_instance_ctrl->data_lines];
-
-        if (SPI_FLASH_DATA_LINES_1 == p_instance_ctrl->p_cfg->page_program_address_lines)
-        {
-            /* Write address in extended SPI mode on one line. */
-            write_address = gp_qspi_prv_byte_write[p_instance_ctrl->data_lines];
-        }
-    }
-#endif
-
-    /* Enter Direct Communication mode */
-    R_QSPI->SFMCMD = 1;
-
-    /* Send command to enable writing */
-    write_command(p_instance_ctrl->p_cfg->write_enable_command);
-
-    /* Close the SPI bus cycle. Reference section 39.10.3 "Generating the SPI Bus Cycle during Direct Communication"
-     * in the RA6M3 manual R01UH0886EJ0100. */
-    R_QSPI->SFMCMD = 1;
-
-    /* Send command to write data */
-    write_command(p_instance_ctrl->p_cfg->page_program_command);
-
-    /* Write the address. */
-    if ((p_instance_ctrl->p_cfg->address_bytes & R_QSPI_SFMSAC_SFMAS_Msk) == SPI_FLASH_ADDRESS_BYTES_4)
-    {
-        /* Send the most significant byte of the address */
-        write_address((uint8_t) (chip_address >> 24));
-    }
-
-    /* Send the remaining bytes of the address */
-    write_address((uint8_t) (chip_address >> 16));
-    write_address((uint8_t) (chip_address >> 8));
-    write_address((uint8_t) (chip_address));
+    /* Send the write enable, page program command and address. */
+    bool restore_spi_mode = r_qspi_page_program_start(p_instance_ctrl, p_dest);
 
     /* Write the data. */
     uint32_t index = 0;
@@ -392,19 +444,8 @@ fsp_err_t R_QSPI_Write (spi_flash_ctrl_t    * p_ctrl,
         index++;
     }
 
-    /* Close the SPI bus cycle. Reference section 39.10.3 "Generating the SPI Bus Cycle during Direct Communication"
-     * in the RA6M3 manual R01UH0886EJ0100. */
-    R_QSPI->SFMCMD = 1;
-
-    /* If the SPI protocol was modified in this function, restore it. */
-    if (restore_spi_mode)
-    {
-        /* Restore SPI mode to extended SPI mode. */
-        R_QSPI->SFMSPC_b.SFMSPI = SPI_FLASH_PROTOCOL_EXTENDED_SPI;
-    }
-
-    /* Return to ROM access mode */
-    R_QSPI->SFMCMD = 0;
+    /* Close the bus cycle and return to ROM access mode. */
+    r_qspi_page_program_end(restore_spi_mode);
 
     return FSP_SUCCESS;
 }
@@ -629,6 +670,167 @@ fsp_err_t R_QSPI_VersionGet (fsp_version_t * const p_version)
     return FSP_SUCCESS;
 }
 
+/*******************************************************************************************************************//**
+ * Read data from the memory-mapped QSPI area with the DMAC. The QSPI stays in ROM access mode, so XIP remains enabled
+ * if it was entered. The callback in qspi_extended_cfg_t is called with QSPI_EVENT_READ_COMPLETE when all data has been
+ * copied.
+ *
+ * Word transfers are used when p_dest and p_src are word aligned. Transfers longer than the DMAC transfer count are
+ * split and continued from the DMAC interrupt.
+ *
+ * @retval FSP_SUCCESS                 The transfer was started.
+ * @retval FSP_ERR_ASSERTION           p_instance_ctrl, p_dest, p_src or the DMAC instance is NULL, or byte_count is
+ *                                     0.
+ * @retval FSP_ERR_NOT_OPEN            Driver is not opened.
+ * @retval FSP_ERR_INVALID_MODE        The QSPI is in direct communication mode.
+ * @retval FSP_ERR_IN_USE              A DMAC read or page program is already in progress.
+ * @retval FSP_ERR_UNSUPPORTED         DMAC support is not enabled (QSPI_CFG_DMAC_SUPPORT_ENABLE).
+ * @return                             See @ref RENESAS_ERROR_CODES or functions called by this function for other
+ *                                     possible return codes. This function calls:
+ *                                         * @ref transfer_api_t::reconfigure
+ *                                         * @ref transfer_api_t::softwareStart
+ **********************************************************************************************************************/
+fsp_err_t R_QSPI_DmaRead (spi_flash_ctrl_t * p_ctrl, uint8_t * const p_dest, uint8_t const * const p_src,
+                          uint32_t byte_count)
+{
+#if QSPI_CFG_DMAC_SUPPORT_ENABLE
+    qspi_instance_ctrl_t * p_instance_ctrl = (qspi_instance_ctrl_t *) p_ctrl;
+
+ #if QSPI_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_instance_ctrl);
+    FSP_ASSERT(NULL != p_dest);
+    FSP_ASSERT(NULL != p_src);
+    FSP_ASSERT(0U != byte_count);
+    FSP_ERROR_RETURN(QSPI_PRV_OPEN == p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
+    FSP_ASSERT(NULL != ((qspi_extended_cfg_t *) p_instance_ctrl->p_cfg->p_extend)->p_transfer);
+
+    /* Memory-mapped reads are ignored in direct communication mode. */
+    FSP_ERROR_RETURN(0U == R_QSPI->SFMCMD, FSP_ERR_INVALID_MODE);
+ #endif
+    FSP_ERROR_RETURN(!p_instance_ctrl->dma_in_progress, FSP_ERR_IN_USE);
+
+    p_instance_ctrl->dma_in_progress = true;
+    p_instance_ctrl->dma_event       = QSPI_EVENT_READ_COMPLETE;
+    p_instance_ctrl->p_dma_src       = p_src;
+    p_instance_ctrl->p_dma_dest      = p_dest;
+    p_instance_ctrl->dma_remaining   = byte_count;
+
+    fsp_err_t err = r_qspi_dma_start(p_instance_ctrl);
+    if (FSP_SUCCESS != err)
+    {
+        p_instance_ctrl->dma_in_progress = false;
+    }
+
+    return err;
+#else
+    FSP_PARAMETER_NOT_USED(p_ctrl);
+    FSP_PARAMETER_NOT_USED(p_dest);
+    FSP_PARAMETER_NOT_USED(p_src);
+    FSP_PARAMETER_NOT_USED(byte_count);
+
+    return FSP_ERR_UNSUPPORTED;
+#endif
+}
+
+/*******************************************************************************************************************//**
+ * Program a page of data to the flash, sending the page data to SFMCOM with the DMAC. The command and address are
+ * sent by the CPU as in R_QSPI_Write(). The callback in qspi_extended_cfg_t is called with QSPI_EVENT_WRITE_COMPLETE
+ * once all data has been sent and the QSPI is back in ROM access mode. The QSPI area must not be accessed until then.
+ *
+ * @retval FSP_SUCCESS                 The transfer was started.
+ * @retval FSP_ERR_ASSERTION           p_instance_ctrl, p_dest, p_src or the DMAC instance is NULL, or byte_count
+ *                                     crosses a page boundary.
+ * @retval FSP_ERR_NOT_OPEN            Driver is not opened.
+ * @retval FSP_ERR_INVALID_MODE        This function can't be called when XIP mode is enabled.
+ * @retval FSP_ERR_DEVICE_BUSY         The device is busy.
+ * @retval FSP_ERR_IN_USE              A DMAC read or page program is already in progress.
+ * @retval FSP_ERR_UNSUPPORTED         DMAC support is not enabled (QSPI_CFG_DMAC_SUPPORT_ENABLE).
+ * @return                             See @ref RENESAS_ERROR_CODES or functions called by this function for other
+ *                                     possible return codes. This function calls:
+ *                                         * @ref transfer_api_t::reconfigure
+ *                                         * @ref transfer_api_t::softwareStart
+ **********************************************************************************************************************/
+fsp_err_t R_QSPI_DmaWrite (spi_flash_ctrl_t    * p_ctrl,
+                           uint8_t const * const p_src,
+                           uint8_t * const       p_dest,
+                           uint32_t              byte_count)
+{
+#if QSPI_CFG_DMAC_SUPPORT_ENABLE
+    qspi_instance_ctrl_t * p_instance_ctrl = (qspi_instance_ctrl_t *) p_ctrl;
+
+ #if QSPI_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_instance_ctrl);
+    FSP_ERROR_RETURN(!p_instance_ctrl->dma_in_progress, FSP_ERR_IN_USE);
+    fsp_err_t err = qspi_program_param_check(p_instance_ctrl, p_src, p_dest, byte_count);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+    FSP_ASSERT(0U != byte_count);
+    FSP_ASSERT(NULL != ((qspi_extended_cfg_t *) p_instance_ctrl->p_cfg->p_extend)->p_transfer);
+ #else
+    FSP_ERROR_RETURN(!p_instance_ctrl->dma_in_progress, FSP_ERR_IN_USE);
+    fsp_err_t err;
+ #endif
+
+    p_instance_ctrl->dma_in_progress = true;
+    p_instance_ctrl->dma_event       = QSPI_EVENT_WRITE_COMPLETE;
+    p_instance_ctrl->p_dma_src       = p_src;
+    p_instance_ctrl->p_dma_dest      = (uint8_t *) &R_QSPI->SFMCOM;
+    p_instance_ctrl->dma_remaining   = byte_count;
+
+    /* Send the write enable, page program command and address. The DMAC sends the data. */
+    p_instance_ctrl->dma_restore_spi = r_qspi_page_program_start(p_instance_ctrl, p_dest);
+
+    err = r_qspi_dma_start(p_instance_ctrl);
+    if (FSP_SUCCESS != err)
+    {
+        /* Close the bus cycle without data. The device does not program anything. */
+        r_qspi_page_program_end(p_instance_ctrl->dma_restore_spi);
+        p_instance_ctrl->dma_in_progress = false;
+    }
+
+    return err;
+#else
+    FSP_PARAMETER_NOT_USED(p_ctrl);
+    FSP_PARAMETER_NOT_USED(p_src);
+    FSP_PARAMETER_NOT_USED(p_dest);
+    FSP_PARAMETER_NOT_USED(byte_count);
+
+    return FSP_ERR_UNSUPPORTED;
+#endif
+}
+
+/*******************************************************************************************************************//**
+ * Gets the settings in use. If qspi_extended_cfg_t::sfdp is enabled, these include the settings read from SFDP in
+ * R_QSPI_Open().
+ *
+ * @param[in]  p_ctrl                  Pointer to a driver handle
+ * @param[out] pp_cfg                  Set to the settings in use
+ * @param[out] p_size_bytes            Set to the device size read from SFDP, or 0 if it was not read. May be NULL.
+ *
+ * @retval FSP_SUCCESS                 The settings are in pp_cfg.
+ * @retval FSP_ERR_ASSERTION           p_instance_ctrl or pp_cfg is NULL.
+ * @retval FSP_ERR_NOT_OPEN            Driver is not opened.
+ **********************************************************************************************************************/
+fsp_err_t R_QSPI_ConfigGet (spi_flash_ctrl_t * p_ctrl, spi_flash_cfg_t const ** const pp_cfg,
+                            uint32_t * const p_size_bytes)
+{
+    qspi_instance_ctrl_t * p_instance_ctrl = (qspi_instance_ctrl_t *) p_ctrl;
+
+#if QSPI_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_instance_ctrl);
+    FSP_ASSERT(NULL != pp_cfg);
+    FSP_ERROR_RETURN(QSPI_PRV_OPEN == p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+
+    *pp_cfg = p_instance_ctrl->p_cfg;
+
+    if (NULL != p_size_bytes)
+    {
+        *p_size_bytes = p_instance_ctrl->total_size_bytes;
+    }
+
+    return FSP_SUCCESS;
+}
+
 /*******************************************************************************************************************//**
  * @} (end addtogroup QSPI)
  **********************************************************************************************************************/
@@ -674,6 +876,196 @@ static fsp_err_t r_qspi_xip (qspi_instance_ctrl_t * p_instance_ctrl, uint8_t cod
     return FSP_SUCCESS;
 }
 
+/*******************************************************************************************************************//**
+ * Enters direct communication mode and sends the write enable, page program command and address. The page data is
+ * sent next through SFMCOM.
+ *
+ * @param[in]  p_instance_ctrl         Pointer to a driver handle
+ * @param[in]  p_dest                  The address in QSPI to write to
+ *
+ * @return True if the SPI protocol was changed and must be restored by r_qspi_page_program_end().
+ **********************************************************************************************************************/
+static bool r_qspi_page_program_start (qspi_instance_ctrl_t * p_instance_ctrl, uint8_t * const p_dest)
+{
+    uint32_t chip_address = (uint32_t) p_dest - (uint32_t) QSPI_DEVICE_START_ADDRESS + R_QSPI->SFMCNT1;
+
+    bool restore_spi_mode = false;
+    void (* write_command)(uint8_t byte) = qspi_d0_byte_write_standard;
+    void (* write_address)(uint8_t byte) = qspi_d0_byte_write_standard;
+
+#if QSPI_CFG_SUPPORT_EXTENDED_SPI_MULTI_LINE_PROGRAM
+
+    /* If the peripheral is in extended SPI mode, and the configuration provided in the BSP allows for programming on
+     * multiple data lines, and a unique command is provided for the required mode, update the SPI protocol to send
+     * data on multiple lines. */
+    if ((SPI_FLASH_DATA_LINES_1 != p_instance_ctrl->data_lines) &&
+        (SPI_FLASH_PROTOCOL_EXTENDED_SPI == R_QSPI->SFMSPC_b.SFMSPI))
+    {
+        R_QSPI->SFMSPC_b.SFMSPI = p_instance_ctrl->data_lines;
+
+        restore_spi_mode = true;
+
+        /* Write command in extended SPI mode on one line. */
+        write_command = gp_qspi_prv_byte_write[p_instance_ctrl->data_lines];
+
+        if (SPI_FLASH_DATA_LINES_1 == p_instance_ctrl->p_cfg->page_program_address_lines)
+        {
+            /* Write address in extended SPI mode on one line. */
+            write_address = gp_qspi_prv_byte_write[p_instance_ctrl->data_lines];
+        }
+    }
+#endif
+
+    /* Enter Direct Communication mode */
+    R_QSPI->SFMCMD = 1;
+
+    /* Send command to enable writing */
+    write_command(p_instance_ctrl->p_cfg->write_enable_command);
+
+    /* Close the SPI bus cycle. Reference section 39.10.3 "Generating the SPI Bus Cycle during Direct Communication"
+     * in the RA6M3 manual R01UH0886EJ0100. */
+    R_QSPI->SFMCMD = 1;
+
+    /* Send command to write data */
+    write_command(p_instance_ctrl->p_cfg->page_program_command);
+
+    /* Write the address. */
+    if ((p_instance_ctrl->p_cfg->address_bytes & R_QSPI_SFMSAC_SFMAS_Msk) == SPI_FLASH_ADDRESS_BYTES_4)
+    {
+        /* Send the most significant byte of the address */
+        write_address((uint8_t) (chip_address >> 24));
+    }
+
+    /* Send the remaining bytes of the address */
+    write_address((uint8_t) (chip_address >> 16));
+    write_address((uint8_t) (chip_address >> 8));
+    write_address((uint8_t) (chip_address));
+
+    return restore_spi_mode;
+}
+
+/*******************************************************************************************************************//**
+ * Closes the page program bus cycle, restores the SPI protocol if needed and returns to ROM access mode.
+ *
+ * @param[in]  restore_spi_mode        Value returned by r_qspi_page_program_start()
+ **********************************************************************************************************************/
+static void r_qspi_page_program_end (bool restore_spi_mode)
+{
+    /* Close the SPI bus cycle. Reference section 39.10.3 "Generating the SPI Bus Cycle during Direct Communication"
+     * in the RA6M3 manual R01UH0886EJ0100. */
+    R_QSPI->SFMCMD = 1;
+
+    /* If the SPI protocol was modified by r_qspi_page_program_start, restore it. */
+    if (restore_spi_mode)
+    {
+        /* Restore SPI mode to extended SPI mode. */
+        R_QSPI->SFMSPC_b.SFMSPI = SPI_FLASH_PROTOCOL_EXTENDED_SPI;
+    }
+
+    /* Return to ROM access mode */
+    R_QSPI->SFMCMD = 0;
+}
+
+#if QSPI_CFG_DMAC_SUPPORT_ENABLE
+
+/*******************************************************************************************************************//**
+ * DMAC transfer end callback for R_QSPI_DmaRead() and R_QSPI_DmaWrite(). Set this as the callback of the DMAC instance
+ * in qspi_extended_cfg_t::p_transfer, with the QSPI control block as its context.
+ *
+ * @param[in] p_args                   DMAC callback arguments
+ **********************************************************************************************************************/
+void qspi_dmac_callback (dmac_callback_args_t * p_args)
+{
+    qspi_instance_ctrl_t * p_instance_ctrl = (qspi_instance_ctrl_t *) p_args->p_context;
+
+    /* Continue a transfer longer than one DMAC transfer count. */
+    if (0U != p_instance_ctrl->dma_remaining)
+    {
+        if (FSP_SUCCESS == r_qspi_dma_start(p_instance_ctrl))
+        {
+            return;
+        }
+    }
+
+    if (QSPI_EVENT_WRITE_COMPLETE == p_instance_ctrl->dma_event)
+    {
+        /* Close the bus cycle to start programming and return to ROM access mode. */
+        r_qspi_page_program_end(p_instance_ctrl->dma_restore_spi);
+    }
+
+    p_instance_ctrl->dma_in_progress = false;
+
+    qspi_extended_cfg_t * p_cfg_extend = (qspi_extended_cfg_t *) p_instance_ctrl->p_cfg->p_extend;
+    if (NULL != p_cfg_extend->p_callback)
+    {
+        qspi_callback_args_t args;
+        args.event     = p_instance_ctrl->dma_event;
+        args.p_context = p_cfg_extend->p_context;
+        p_cfg_extend->p_callback(&args);
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Configures and starts the next DMAC transfer of the operation in progress.
+ *
+ * @param[in]  p_instance_ctrl         Pointer to a driver handle
+ *
+ * @return See @ref RENESAS_ERROR_CODES or functions called by this function for possible return codes. This function
+ *         calls:
+ *             * @ref transfer_api_t::reconfigure
+ *             * @ref transfer_api_t::softwareStart
+ **********************************************************************************************************************/
+static fsp_err_t r_qspi_dma_start (qspi_instance_ctrl_t * p_instance_ctrl)
+{
+    transfer_instance_t const * p_transfer = ((qspi_extended_cfg_t *) p_instance_ctrl->p_cfg->p_extend)->p_transfer;
+    transfer_info_t           * p_info     = &p_instance_ctrl->dma_info;
+    bool     read      = (QSPI_EVENT_READ_COMPLETE == p_instance_ctrl->dma_event);
+    uint32_t unit_size = 1U;
+
+    p_info->transfer_settings_word = 0U;
+    p_info->size                   = TRANSFER_SIZE_1_BYTE;
+
+    /* SFMCOM takes one byte per access. Reads use word transfers when both buffers are word aligned. */
+    if (read && (p_instance_ctrl->dma_remaining >= 4U) &&
+        (0U == (((uint32_t) p_instance_ctrl->p_dma_src | (uint32_t) p_instance_ctrl->p_dma_dest) & 3U)))
+    {
+        p_info->size = TRANSFER_SIZE_4_BYTE;
+        unit_size    = 4U;
+    }
+
+    uint32_t num_transfers = p_instance_ctrl->dma_remaining / unit_size;
+    if (num_transfers > QSPI_PRV_DMAC_MAX_TRANSFERS)
+    {
+        num_transfers = QSPI_PRV_DMAC_MAX_TRANSFERS;
+    }
+
+    p_info->mode           = TRANSFER_MODE_NORMAL;
+    p_info->src_addr_mode  = TRANSFER_ADDR_MODE_INCREMENTED;
+    p_info->dest_addr_mode = read ? TRANSFER_ADDR_MODE_INCREMENTED : TRANSFER_ADDR_MODE_FIXED;
+    p_info->irq            = TRANSFER_IRQ_END;
+    p_info->chain_mode     = TRANSFER_CHAIN_MODE_DISABLED;
+    p_info->p_src          = p_instance_ctrl->p_dma_src;
+    p_info->p_dest         = p_instance_ctrl->p_dma_dest;
+    p_info->num_blocks     = 0U;
+    p_info->length         = (uint16_t) num_transfers;
+
+    /* Record where the next transfer continues. */
+    uint32_t num_bytes = num_transfers * unit_size;
+    p_instance_ctrl->p_dma_src     += num_bytes;
+    p_instance_ctrl->dma_remaining -= num_bytes;
+    if (read)
+    {
+        p_instance_ctrl->p_dma_dest += num_bytes;
+    }
+
+    fsp_err_t err = p_transfer->p_api->reconfigure(p_transfer->p_ctrl, p_info);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+    return p_transfer->p_api->softwareStart(p_transfer->p_ctrl, TRANSFER_START_MODE_REPEAT);
+}
+
+#endif
+
 /*******************************************************************************************************************//**
  * Gets device status.
  *
@@ -750,6 +1142,349 @@ static void r_qspi_direct_read_sub (uint8_t * const p_dest, uint32_t const bytes
     R_QSPI->SFMCMD = 0U;
 }
 
+#if QSPI_CFG_SFDP_SUPPORT_ENABLE
+
+/*******************************************************************************************************************//**
+ * Reads the SFDP tables of the device and replaces the read mode, dummy clocks, address mode, page size and erase
+ * commands with the ones they describe. The configured settings are kept if the device has no SFDP tables.
+ *
+ * @param[in]  p_instance_ctrl         Pointer to a driver handle
+ * @param[in]  sfdp                    Whether the Quad Enable bit may be set
+ **********************************************************************************************************************/
+static void r_qspi_sfdp_configure (qspi_instance_ctrl_t * p_instance_ctrl, qspi_sfdp_t sfdp)
+{
+    spi_flash_cfg_t const * p_cfg = p_instance_ctrl->p_cfg;
+    uint32_t                header[2];
+
+    /* Read the SFDP header (JESD216 section 6.2). */
+    r_qspi_sfdp_read(0U, header, sizeof(header));
+    if (QSPI_PRV_SFDP_SIGNATURE != header[0])
+    {
+        return;
+    }
+
+    /* Read the Basic Flash Parameter Table and the 4-byte Address Instruction Table. Only the first Basic Flash
+     * Parameter Table is used, newer revisions are backwards compatible. */
+    uint32_t bfpt[QSPI_PRV_SFDP_BFPT_DWORDS_MAX] = {0U};
+    uint32_t bait[QSPI_PRV_SFDP_4BAIT_DWORDS]    = {0U};
+    uint32_t bfpt_dwords = 0U;
+    bool     bait_found  = false;
+    uint32_t headers     = ((header[1] >> 16) & UINT8_MAX) + 1U;
+
+    for (uint32_t i = 0U; i < headers; i++)
+    {
+        uint32_t param[2];
+        r_qspi_sfdp_read(QSPI_PRV_SFDP_HEADER_ADDRESS + (i * (uint32_t) sizeof(param)), param, sizeof(param));
+
+        uint32_t id      = (param[0] & UINT8_MAX) | ((param[1] >> 16) & 0xFF00U);
+        uint32_t dwords  = param[0] >> 24;
+        uint32_t address = param[1] & 0xFFFFFFU;
+
+        if ((QSPI_PRV_SFDP_BFPT_ID == id) && (0U == bfpt_dwords))
+        {
+            bfpt_dwords = (dwords < QSPI_PRV_SFDP_BFPT_DWORDS_MAX) ? dwords : QSPI_PRV_SFDP_BFPT_DWORDS_MAX;
+            r_qspi_sfdp_read(address, bfpt, bfpt_dwords * sizeof(uint32_t));
+        }
+        else if ((QSPI_PRV_SFDP_4BAIT_ID == id) && (dwords >= QSPI_PRV_SFDP_4BAIT_DWORDS))
+        {
+            r_qspi_sfdp_read(address, bait, sizeof(bait));
+            bait_found = true;
+        }
+        else
+        {
+            /* Other tables are not used. */
+        }
+    }
+
+    if (bfpt_dwords < QSPI_PRV_SFDP_BFPT_DWORDS_MIN)
+    {
+        return;
+    }
+
+    spi_flash_cfg_t * p_sfdp_cfg = &p_instance_ctrl->sfdp_cfg;
+    *p_sfdp_cfg = *p_cfg;
+
+    /* The density in DWORD 2 is in bits, either as the highest bit address or as a power of 2. */
+    uint32_t size_bytes;
+    if (bfpt[1] & QSPI_PRV_SFDP_DENSITY_EXPONENT)
+    {
+        uint32_t exponent = bfpt[1] & ~QSPI_PRV_SFDP_DENSITY_EXPONENT;
+        size_bytes = ((exponent >= 3U) && (exponent < 35U)) ? (1U << (exponent - 3U)) : 0U;
+    }
+    else
+    {
+        size_bytes = (bfpt[1] / 8U) + 1U;
+    }
+
+    /* Devices beyond 3 byte addresses use the 4 byte address commands from the 4BAIT. If the device has no 4BAIT,
+     * the configured address mode is kept. The configured commands are also kept if the configured address mode uses
+     * 4 byte addresses, since they depend on how the application set up the device. */
+    bool four_byte = bait_found && (0U != (bait[0] & QSPI_PRV_SFDP_4BAIT_PAGE_PROGRAM)) &&
+                     ((0U == size_bytes) || (size_bytes > QSPI_PRV_SFDP_3_BYTE_SIZE_MAX) ||
+                      (QSPI_PRV_SFDP_4_BYTE_ONLY == ((bfpt[0] >> 17) & 3U)));
+    bool keep_commands = !four_byte && (SPI_FLASH_ADDRESS_BYTES_3 != p_cfg->address_bytes);
+
+    if (!keep_commands)
+    {
+        uint32_t erase_count = 0U;
+
+        /* Erase types 1 to 4 are in DWORDs 8 and 9. */
+        for (uint32_t type = 0U; type < 4U; type++)
+        {
+            uint32_t field    = (bfpt[7U + (type / 2U)] >> (16U * (type % 2U))) & UINT16_MAX;
+            uint32_t exponent = field & UINT8_MAX;
+            uint32_t command  = field >> 8;
+
+            if (four_byte)
+            {
+                command = (bait[1] >> (8U * type)) & UINT8_MAX;
+                if (0U == (bait[0] & (QSPI_PRV_SFDP_4BAIT_ERASE_TYPE_1 << type)))
+                {
+                    exponent = 0U;
+                }
+            }
+
+            if ((0U != exponent) && (exponent < 32U))
+            {
+                p_instance_ctrl->sfdp_erase_list[erase_count].command = (uint16_t) command;
+                p_instance_ctrl->sfdp_erase_list[erase_count].size    = 1U << exponent;
+                erase_count++;
+            }
+        }
+
+        p_instance_ctrl->sfdp_erase_list[erase_count].command = QSPI_PRV_CHIP_ERASE_COMMAND;
+        p_instance_ctrl->sfdp_erase_list[erase_count].size    = SPI_FLASH_ERASE_SIZE_CHIP_ERASE;
+        erase_count++;
+
+        p_sfdp_cfg->p_erase_command_list      = &p_instance_ctrl->sfdp_erase_list[0];
+        p_sfdp_cfg->erase_command_list_length = (uint8_t) erase_count;
+
+        /* Data is programmed on one line. SFDP does not describe the multi-line page program commands. */
+        p_sfdp_cfg->page_program_command = four_byte ? QSPI_PRV_4BYTE_PAGE_PROGRAM_COMMAND :
+                                           QSPI_PRV_PAGE_PROGRAM_COMMAND;
+        p_sfdp_cfg->page_program_address_lines = SPI_FLASH_DATA_LINES_1;
+        p_sfdp_cfg->address_bytes              = four_byte ? SPI_FLASH_ADDRESS_BYTES_4_4BYTE_READ_CODE :
+                                                 SPI_FLASH_ADDRESS_BYTES_3;
+    }
+
+    /* The page size is in DWORD 11 (JESD216A and later). */
+    p_sfdp_cfg->page_size_bytes = (bfpt_dwords >= QSPI_PRV_SFDP_BFPT_PAGE_SIZE_DWORDS) ?
+                                  (1U << ((bfpt[10] >> 4) & 0xFU)) : QSPI_PRV_DEFAULT_PAGE_SIZE_BYTES;
+
+    /* The Quad Enable requirements are in DWORD 15 (JESD216A and later). If they are not described, quad modes are
+     * only used if a quad mode is configured. */
+    uint32_t qer = (bfpt_dwords >= QSPI_PRV_SFDP_BFPT_QER_DWORDS) ? ((bfpt[14] >> 20) & 7U) : UINT32_MAX;
+
+    /* The 4 byte read commands are only used if the 4BAIT lists them. */
+    bool bait_read = bait_found && (SPI_FLASH_ADDRESS_BYTES_4_4BYTE_READ_CODE == p_sfdp_cfg->address_bytes);
+
+    /* Select the first supported mode. */
+    qspi_prv_sfdp_read_mode_t const * p_mode = NULL;
+    for (uint32_t i = 0U; i < (sizeof(g_qspi_prv_sfdp_read_modes) / sizeof(g_qspi_prv_sfdp_read_modes[0])); i++)
+    {
+        qspi_prv_sfdp_read_mode_t const * p_candidate = &g_qspi_prv_sfdp_read_modes[i];
+        uint32_t clocks = p_candidate->default_clocks;
+
+        if ((0U != p_candidate->support_mask) && (0U == (bfpt[0] & p_candidate->support_mask)))
+        {
+            continue;
+        }
+
+        if (bait_read && (0U == (bait[0] & p_candidate->bait_mask)))
+        {
+            continue;
+        }
+
+        if (0U != p_candidate->dword)
+        {
+            /* Each mode is described by 5 bits of wait states, 3 bits of mode clocks and the command. */
+            uint32_t field = (bfpt[p_candidate->dword - 1U] >> p_candidate->shift) & UINT16_MAX;
+            if (p_candidate->command != (field >> 8))
+            {
+                continue;
+            }
+
+            clocks = (field & 0x1FU) + ((field >> 5) & 7U);
+        }
+
+        if (clocks == p_candidate->default_clocks)
+        {
+            p_sfdp_cfg->dummy_clocks = SPI_FLASH_DUMMY_CLOCKS_DEFAULT;
+        }
+        else if ((clocks >= QSPI_PRV_DUMMY_CLOCKS_MIN) && (clocks <= QSPI_PRV_DUMMY_CLOCKS_MAX))
+        {
+            /* SPI_FLASH_DUMMY_CLOCKS_3 is 1. */
+            p_sfdp_cfg->dummy_clocks = (spi_flash_dummy_clocks_t) (clocks - 2U);
+        }
+        else
+        {
+            continue;
+        }
+
+        if ((SPI_FLASH_READ_MODE_FAST_READ_QUAD_OUTPUT <= p_candidate->read_mode) &&
+            !r_qspi_sfdp_quad_enable(p_instance_ctrl, qer, QSPI_SFDP_ENABLED_QUAD_ENABLE == sfdp))
+        {
+            continue;
+        }
+
+        p_mode = p_candidate;
+        break;
+    }
+
+    if (NULL == p_mode)
+    {
+        return;
+    }
+
+    p_sfdp_cfg->read_mode = p_mode->read_mode;
+
+    /* Use the settings read from SFDP. */
+    p_instance_ctrl->p_cfg            = p_sfdp_cfg;
+    p_instance_ctrl->total_size_bytes = size_bytes;
+    if (!keep_commands)
+    {
+        p_instance_ctrl->data_lines = SPI_FLASH_DATA_LINES_1;
+    }
+
+    R_QSPI->SFMSAC = p_sfdp_cfg->address_bytes;
+    R_QSPI->SFMSDC = p_sfdp_cfg->dummy_clocks | R_QSPI_SFMSDC_SFMXD_Msk;
+    R_QSPI->SFMSMD = R_QSPI_SFMSMD_SFMPFE_Msk | p_sfdp_cfg->read_mode;
+}
+
+/*******************************************************************************************************************//**
+ * Reads SFDP data. SFDP is read with a 3 byte address and 8 dummy clocks.
+ *
+ * @param[in]  address                 SFDP address to read from
+ * @param[out] p_dest                  Pointer to store data
+ * @param[in]  bytes                   Number of bytes to read
+ **********************************************************************************************************************/
+static void r_qspi_sfdp_read (uint32_t address, void * const p_dest, uint32_t bytes)
+{
+    uint8_t command[5] =
+    {
+        QSPI_PRV_SFDP_READ_COMMAND, (uint8_t) (address >> 16), (uint8_t) (address >> 8), (uint8_t) address, 0U
+    };
+
+    r_qspi_direct_write_sub(command, sizeof(command), true);
+    r_qspi_direct_read_sub((uint8_t *) p_dest, bytes);
+}
+
+/*******************************************************************************************************************//**
+ * Checks the Quad Enable bit described by the Quad Enable Requirements of BFPT DWORD 15, and sets it if allowed.
+ *
+ * @param[in]  p_instance_ctrl         Pointer to a driver handle
+ * @param[in]  qer                     Quad Enable Requirements, UINT32_MAX if they are not described
+ * @param[in]  set                     Whether the Quad Enable bit may be set
+ *
+ * @return True if quad modes can be used.
+ **********************************************************************************************************************/
+static bool r_qspi_sfdp_quad_enable (qspi_instance_ctrl_t * p_instance_ctrl, uint32_t qer, bool set)
+{
+    uint8_t read_command;
+    uint8_t write_command;
+    uint8_t bit;
+
+    switch (qer)
+    {
+        case 0U:
+        {
+            /* The device has no Quad Enable bit. */
+            return true;
+        }
+
+        case 2U:
+        {
+            /* Bit 6 of status register 1. */
+            read_command  = QSPI_PRV_READ_STATUS_1_COMMAND;
+            write_command = QSPI_PRV_WRITE_STATUS_COMMAND;
+            bit           = 6U;
+            break;
+        }
+
+        case 3U:
+        {
+            /* Bit 7 of status register 2, read with 0x3F and written with 0x3E. */
+            read_command  = 0x3FU;
+            write_command = 0x3EU;
+            bit           = 7U;
+            break;
+        }
+
+        case 4U:
+        case 5U:
+        {
+            /* Bit 1 of status register 2, read with 0x35 and written with 0x01 after status register 1. */
+            read_command  = 0x35U;
+            write_command = QSPI_PRV_WRITE_STATUS_COMMAND;
+            bit           = 1U;
+            break;
+        }
+
+        case 6U:
+        {
+            /* Bit 1 of status register 2, read with 0x35 and written with 0x31. */
+            read_command  = 0x35U;
+            write_command = 0x31U;
+            bit           = 1U;
+            break;
+        }
+
+        default:
+        {
+            /* The Quad Enable bit is unknown, or status register 2 cannot be read (QER 1). Rely on the configured
+             * read mode. */
+            return SPI_FLASH_READ_MODE_FAST_READ_QUAD_OUTPUT <= p_instance_ctrl->p_cfg->read_mode;
+        }
+    }
+
+    uint8_t status = r_qspi_register_read(read_command);
+    if ((0U != (status & (1U << bit))) || !set)
+    {
+        return 0U != (status & (1U << bit));
+    }
+
+    /* Status register 2 is written with 0x01 together with status register 1. */
+    uint8_t  command[3];
+    uint32_t bytes = 0U;
+    command[bytes++] = write_command;
+    if ((QSPI_PRV_WRITE_STATUS_COMMAND == write_command) && (1U == bit))
+    {
+        command[bytes++] = r_qspi_register_read(QSPI_PRV_READ_STATUS_1_COMMAND);
+    }
+
+    command[bytes++] = (uint8_t) (status | (1U << bit));
+
+    r_qspi_direct_write_sub(&p_instance_ctrl->p_cfg->write_enable_command, 1U, false);
+    r_qspi_direct_write_sub(command, bytes, false);
+
+    /* Wait for the non-volatile status register write to complete. */
+    while (r_qspi_status_sub(p_instance_ctrl))
+    {
+        /* Do nothing. */
+    }
+
+    return 0U != (r_qspi_register_read(read_command) & (1U << bit));
+}
+
+/*******************************************************************************************************************//**
+ * Reads a register of the device selected by a single byte command.
+ *
+ * @param[in]  command                 Command to send
+ *
+ * @return Register value.
+ **********************************************************************************************************************/
+static uint8_t r_qspi_register_read (uint8_t command)
+{
+    uint8_t value;
+
+    r_qspi_direct_write_sub(&command, 1U, true);
+    r_qspi_direct_read_sub(&value, 1U);
+
+    return value;
+}
+
+#endif
+
 #if QSPI_CFG_SUPPORT_EXTENDED_SPI_MULTI_LINE_PROGRAM
 
 /*******************************************************************************************************************//**
@@ -82,6 +82,10 @@
 #define RTC_SUB_CLK_STABLIZATION_TIME_MS    (100)
 #define RTC_LOCO_STABLIZATION_TIME_US       (190)
 
+#define RTC_PRV_DAYS_FROM_1970_TO_2000      (10957U)
+#define RTC_PRV_SECONDS_PER_DAY             (86400U)
+#define RTC_PRV_US_PER_SECOND               (1000000U)
+
 /***********************************************************************************************************************
  * Typedef definitions
  **********************************************************************************************************************/
@@ -124,6 +128,7 @@ const rtc_api_t g_rtc_on_rtc =
     .close              = R_RTC_Close,
     .calendarTimeGet    = R_RTC_CalendarTimeGet,
     .calendarTimeSet    = R_RTC_CalendarTimeSet,
+    .timestampGet       = R_RTC_TimestampGet,
     .calendarAlarmGet   = R_RTC_CalendarAlarmGet,
     .calendarAlarmSet   = R_RTC_CalendarAlarmSet,
     .periodicIrqRateSet = R_RTC_PeriodicIrqRateSet,
@@ -139,6 +144,12 @@ const rtc_api_t g_rtc_on_rtc =
 static const uint8_t days_in_months[12] = {31U, 28U, 31U, 30U, 31U, 30U, 31U, 31U, 30U, 31U, 30U, 31U};
 #endif
 
+#if RTC_CFG_TIMESTAMP_ENABLE
+
+/* Number of days in a non-leap year before the start of each month */
+static const uint16_t days_before_months[12] = {0U, 31U, 59U, 90U, 120U, 151U, 181U, 212U, 243U, 273U, 304U, 334U};
+#endif
+
 /***********************************************************************************************************************
  * Functions
  **********************************************************************************************************************/
@@ -178,6 +189,17 @@ static fsp_err_t r_rtc_alarm_dayofmonth_and_dayofweek_validate(rtc_alarm_time_t
 
 static void r_rtc_error_adjustment_set(rtc_error_adjustment_cfg_t const * const err_adj_cfg);
 
+#if RTC_CFG_TIMESTAMP_ENABLE
+static fsp_err_t r_rtc_timestamp_open(rtc_instance_ctrl_t * const p_ctrl, rtc_cfg_t const * const p_cfg);
+
+static void r_rtc_timestamp_sample(rtc_instance_ctrl_t * const p_ctrl);
+
+static uint32_t r_rtc_timestamp_counter_get(rtc_instance_ctrl_t * const p_ctrl);
+
+static uint32_t r_rtc_epoch_seconds_get(void);
+
+#endif
+
 /*******************************************************************************************************************//**
  * @addtogroup RTC
  * @{
@@ -209,6 +231,11 @@ fsp_err_t R_RTC_Open (rtc_ctrl_t * const p_ctrl, rtc_cfg_t const * const p_cfg)
     FSP_ASSERT(NULL != p_instance_ctrl);
     FSP_ASSERT(NULL != p_cfg);
     FSP_ERROR_RETURN(RTC_OPEN != p_instance_ctrl->open, FSP_ERR_ALREADY_OPEN);
+ #if RTC_CFG_TIMESTAMP_ENABLE
+
+    /* The calendar is sampled by the carry interrupt. */
+    FSP_ERROR_RETURN(p_cfg->carry_irq >= 0, FSP_ERR_IRQ_BSP_DISABLED);
+ #endif
 #endif
 
     /* Save the configuration  */
@@ -235,6 +262,11 @@ fsp_err_t R_RTC_Open (rtc_ctrl_t * const p_ctrl, rtc_cfg_t const * const p_cfg)
 
     p_instance_ctrl->carry_isr_triggered = false;
 
+#if RTC_CFG_TIMESTAMP_ENABLE
+    err = r_rtc_timestamp_open(p_instance_ctrl, p_cfg);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+#endif
+
     r_rtc_config_rtc_interrupts(p_instance_ctrl, p_cfg);
 
     /* Check if the RTC is already running */
@@ -250,6 +282,19 @@ fsp_err_t R_RTC_Open (rtc_ctrl_t * const p_ctrl, rtc_cfg_t const * const p_cfg)
         r_rtc_set_clock_source(p_instance_ctrl, p_cfg);
     }
 
+#if RTC_CFG_TIMESTAMP_ENABLE
+    else
+    {
+        /* The calendar was set before, e.g. before a reset. */
+        r_rtc_timestamp_sample(p_instance_ctrl);
+    }
+
+    r_rtc_irq_set(true, R_RTC_RCR1_CIE_Msk);
+    R_BSP_IrqEnable(p_cfg->carry_irq);
+#endif
+
+    BSP_TRACE(FSP_IP_RTC, 0U, BSP_TRACE_EVENT_OPEN, 0U);
+
     /** Mark driver as open by initializing it to "RTC" in its ASCII equivalent. */
     p_instance_ctrl->open = RTC_OPEN;
 
@@ -274,6 +319,8 @@ fsp_err_t R_RTC_Close (rtc_ctrl_t * const p_ctrl)
     FSP_ERROR_RETURN(RTC_OPEN == p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
 #endif
 
+    BSP_TRACE(FSP_IP_RTC, 0U, BSP_TRACE_EVENT_CLOSE, 0U);
+
     /* Clear PIE, AIE, CIE*/
     R_RTC->RCR1 = 0U;
 
@@ -357,6 +404,12 @@ fsp_err_t R_RTC_CalendarTimeSet (rtc_ctrl_t * const p_ctrl, rtc_time_t * const p
     /* Set the START bit to 1 */
     r_rtc_start_bit_update(1U);
 
+#if RTC_CFG_TIMESTAMP_ENABLE
+
+    /* The second starts now, so the sub-second part counts from here. */
+    r_rtc_timestamp_sample(p_instance_ctrl);
+#endif
+
     return err;
 }
 
@@ -424,6 +477,87 @@ fsp_err_t R_RTC_CalendarTimeGet (rtc_ctrl_t * const p_ctrl, rtc_time_t * const p
     return err;
 }
 
+/*******************************************************************************************************************//**
+ * Get the calendar time as microseconds since 1970-01-01 00:00:00.
+ *
+ * The calendar registers are not read. Instead the calendar is sampled once per second by the carry interrupt and the
+ * time since the sample is read from the timer in rtc_extended_cfg_t::p_timestamp_timer. The sample is double
+ * buffered, so this function does not wait for the carry interrupt and can be called from any interrupt.
+ *
+ * The timestamp steps when the calendar time is set. Otherwise it does not go backwards: if the carry interrupt is
+ * late, the timestamp stops just short of the next second until the interrupt runs.
+ *
+ * Implements @ref rtc_api_t::timestampGet
+ *
+ * @retval FSP_SUCCESS              Timestamp read.
+ * @retval FSP_ERR_ASSERTION        Invalid input argument.
+ * @retval FSP_ERR_NOT_OPEN         Driver not open already for operation.
+ * @retval FSP_ERR_NOT_INITIALIZED  The calendar time has not been set.
+ * @retval FSP_ERR_UNSUPPORTED      RTC_CFG_TIMESTAMP_ENABLE is 0.
+ **********************************************************************************************************************/
+fsp_err_t R_RTC_TimestampGet (rtc_ctrl_t * const p_ctrl, uint64_t * const p_timestamp)
+{
+    rtc_instance_ctrl_t * p_instance_ctrl = (rtc_instance_ctrl_t *) p_ctrl;
+#if RTC_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_instance_ctrl);
+    FSP_ASSERT(p_timestamp);
+    FSP_ERROR_RETURN(RTC_OPEN == p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+
+#if RTC_CFG_TIMESTAMP_ENABLE
+    uint32_t sequence;
+    uint32_t seconds;
+    uint32_t base;
+    uint32_t counter;
+
+    /* A sample taken while this one is read goes to the other buffer, but the time since it must be measured from it.
+     * Start over if a sample was taken. */
+    do
+    {
+        sequence = p_instance_ctrl->timestamp_sequence;
+        seconds  = p_instance_ctrl->timestamp_sample[sequence & 1U].seconds;
+        base     = p_instance_ctrl->timestamp_sample[sequence & 1U].counter;
+        counter  = r_rtc_timestamp_counter_get(p_instance_ctrl);
+    } while (sequence != p_instance_ctrl->timestamp_sequence);
+
+    FSP_ERROR_RETURN(0U != sequence, FSP_ERR_NOT_INITIALIZED);
+
+    uint64_t timestamp = (uint64_t) seconds * RTC_PRV_US_PER_SECOND;
+
+    if (NULL != p_instance_ctrl->p_timer)
+    {
+        uint32_t elapsed = base - counter;
+        if (TIMER_DIRECTION_UP == p_instance_ctrl->timer_direction)
+        {
+            elapsed = counter - base;
+        }
+
+        /* The counter wrapped since the sample. */
+        if (elapsed >= p_instance_ctrl->timer_period)
+        {
+            elapsed += p_instance_ctrl->timer_period;
+        }
+
+        /* Never reach the next second before it is sampled. */
+        if (elapsed >= p_instance_ctrl->timer_frequency)
+        {
+            elapsed = p_instance_ctrl->timer_frequency - 1U;
+        }
+
+        timestamp += ((uint64_t) elapsed * p_instance_ctrl->timer_scale) >> p_instance_ctrl->timer_shift;
+    }
+
+    *p_timestamp = timestamp;
+
+    return FSP_SUCCESS;
+#else
+    FSP_PARAMETER_NOT_USED(p_instance_ctrl);
+    FSP_PARAMETER_NOT_USED(p_timestamp);
+
+    return FSP_ERR_UNSUPPORTED;
+#endif
+}
+
 /*******************************************************************************************************************//**
  * Set the calendar alarm time.
  *
@@ -914,6 +1048,8 @@ static void r_rtc_call_callback (rtc_instance_ctrl_t * p_ctrl, rtc_event_t event
 {
     rtc_callback_args_t args;
 
+    BSP_TRACE(FSP_IP_RTC, 0U, event, 0U);
+
     /* Store callback arguments in memory provided by user if available.  This allows callback arguments to be
      * stored in non-secure memory so they can be accessed by a non-secure callback function. */
     rtc_callback_args_t * p_args = p_ctrl->p_callback_memory;
@@ -1344,6 +1480,141 @@ static void r_rtc_error_adjustment_set (rtc_error_adjustment_cfg_t const * const
     FSP_HARDWARE_REGISTER_WAIT(R_RTC->RADJ, error_adjustment);
 }
 
+#if RTC_CFG_TIMESTAMP_ENABLE
+
+/*******************************************************************************************************************//**
+ * Initializes the timestamp service.
+ *
+ * @param[in]  p_ctrl                  Instance control block
+ * @param[in]  p_cfg                   Pointer to rtc configuration.
+ *
+ * @retval FSP_SUCCESS                 Timestamp service initialized.
+ * @retval FSP_ERR_ASSERTION           The sub-second timer runs slower than 256 Hz or within one second.
+ * @return See @ref RENESAS_ERROR_CODES or functions called by this function for other possible return codes.
+ *         This function calls:
+ *             * @ref timer_api_t::infoGet
+ **********************************************************************************************************************/
+static fsp_err_t r_rtc_timestamp_open (rtc_instance_ctrl_t * const p_ctrl, rtc_cfg_t const * const p_cfg)
+{
+    rtc_extended_cfg_t const * p_extend = (rtc_extended_cfg_t const *) p_cfg->p_extend;
+
+    p_ctrl->timestamp_sequence = 0U;
+    p_ctrl->p_timer            = NULL;
+
+    if ((NULL != p_extend) && (NULL != p_extend->p_timestamp_timer))
+    {
+        timer_instance_t const * p_timer = p_extend->p_timestamp_timer;
+        timer_info_t             info;
+
+        fsp_err_t err = p_timer->p_api->infoGet(p_timer->p_ctrl, &info);
+        FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+#if RTC_CFG_PARAM_CHECKING_ENABLE
+
+        /* The counter may wrap only once between two samples. */
+        FSP_ASSERT(info.period_counts > info.clock_frequency);
+        FSP_ASSERT(info.clock_frequency >= 256U);
+#endif
+
+        /* Use the finest scale that fits 32 bits. The count is below the timer frequency, so the product of count and
+         * scale stays below 2^52. */
+        uint32_t shift = 32U;
+        while ((((uint64_t) RTC_PRV_US_PER_SECOND << shift) / info.clock_frequency) > UINT32_MAX)
+        {
+            shift--;
+        }
+
+        p_ctrl->timer_direction = info.count_direction;
+        p_ctrl->timer_period    = info.period_counts;
+        p_ctrl->timer_frequency = info.clock_frequency;
+        p_ctrl->timer_scale     = (uint32_t) (((uint64_t) RTC_PRV_US_PER_SECOND << shift) / info.clock_frequency);
+        p_ctrl->timer_shift     = shift;
+        p_ctrl->p_timer         = p_timer;
+    }
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Samples the calendar and the sub-second timer for @ref R_RTC_TimestampGet.
+ *
+ * @param[in]  p_ctrl                  Instance control block
+ **********************************************************************************************************************/
+static void r_rtc_timestamp_sample (rtc_instance_ctrl_t * const p_ctrl)
+{
+    /* Called from the carry interrupt and from threads. */
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+
+    /* Fill the buffer not being read, then publish it. */
+    uint32_t sequence = p_ctrl->timestamp_sequence + 1U;
+    p_ctrl->timestamp_sample[sequence & 1U].seconds = r_rtc_epoch_seconds_get();
+    p_ctrl->timestamp_sample[sequence & 1U].counter = r_rtc_timestamp_counter_get(p_ctrl);
+    p_ctrl->timestamp_sequence                      = sequence;
+
+    FSP_CRITICAL_SECTION_EXIT;
+}
+
+/*******************************************************************************************************************//**
+ * Reads the counter of the sub-second timer.
+ *
+ * @param[in]  p_ctrl                  Instance control block
+ *
+ * @return Counter value, 0 if no timer is used.
+ **********************************************************************************************************************/
+static uint32_t r_rtc_timestamp_counter_get (rtc_instance_ctrl_t * const p_ctrl)
+{
+    timer_status_t status = {0};
+
+    if (NULL != p_ctrl->p_timer)
+    {
+        (void) p_ctrl->p_timer->p_api->statusGet(p_ctrl->p_timer->p_ctrl, &status);
+    }
+
+    return status.counter;
+}
+
+/*******************************************************************************************************************//**
+ * Reads the calendar counters as seconds since 1970-01-01 00:00:00.
+ *
+ * @return Seconds since 1970-01-01 00:00:00.
+ **********************************************************************************************************************/
+static uint32_t r_rtc_epoch_seconds_get (void)
+{
+    uint32_t sec;
+    uint32_t min;
+    uint32_t hour;
+    uint32_t mday;
+    uint32_t mon;
+    uint32_t year;
+
+    /* Read again if the seconds carried while the counters were read. The years are counted from 2000. */
+    do
+    {
+        sec  = rtc_bcd_to_dec(R_RTC->RSECCNT);
+        min  = rtc_bcd_to_dec(R_RTC->RMINCNT);
+        hour = rtc_bcd_to_dec(R_RTC->RHRCNT & RTC_RHRCNT_HOUR_MASK);
+        mday = rtc_bcd_to_dec(R_RTC->RDAYCNT);
+        mon  = rtc_bcd_to_dec(R_RTC->RMONCNT) - 1U;
+        year = rtc_bcd_to_dec((uint8_t) R_RTC->RYRCNT);
+    } while (sec != rtc_bcd_to_dec(R_RTC->RSECCNT));
+
+    /* Guard the table against a calendar that was never set. */
+    mon = (mon < 12U) ? mon : 0U;
+
+    /* Every fourth year from 2000 to 2099 is a leap year, which adds a day after February. */
+    uint32_t days = RTC_PRV_DAYS_FROM_1970_TO_2000 + (year * 365U) + ((year + 3U) / 4U) + days_before_months[mon] +
+                    mday - 1U;
+    if ((0U == (year & 3U)) && (mon > 1U))
+    {
+        days++;
+    }
+
+    return (days * RTC_PRV_SECONDS_PER_DAY) + (hour * 3600U) + (min * 60U) + sec;
+}
+
+#endif
+
 /*******************************************************************************************************************//**
  * RTC Callback ISR for alarm and periodic interrupt.
  *
@@ -1400,6 +1671,12 @@ void rtc_carry_isr (void)
 
     p_ctrl->carry_isr_triggered = true;
 
+#if RTC_CFG_TIMESTAMP_ENABLE
+
+    /* The second counter has just been incremented. */
+    r_rtc_timestamp_sample(p_ctrl);
+#endif
+
     /* Clear the IR flag in the ICU */
     R_BSP_IrqStatusClear(irq);
 
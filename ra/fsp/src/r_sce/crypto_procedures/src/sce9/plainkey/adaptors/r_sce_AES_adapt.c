@@ -20,6 +20,7 @@
 
 #include "hw_sce_ra_private.h"
 #include "hw_sce_private.h"
+#include "hw_sce_aes_private.h"
 
 typedef enum e_sce_aes_key_size
 {
@@ -28,6 +29,11 @@ typedef enum e_sce_aes_key_size
     SCE_AES_KEY_SIZE_256
 } sce_aes_key_size_t;
 
+/* Command words for HW_SCE_AesXXXEncryptDecryptInitSub. */
+#define SCE_AES_CMD_CBC_ENCRYPT    (0x00000002u)
+#define SCE_AES_CMD_CBC_DECRYPT    (0x00000003u)
+#define SCE_AES_CMD_CTR            (0x00000004u)
+
 fsp_err_t (* init[])(const uint32_t * InData_Cmd, const uint32_t * InData_KeyIndex, const uint32_t * InData_IV) =
 {
     [SCE_AES_KEY_SIZE_128] = HW_SCE_Aes128EncryptDecryptInitSub,
@@ -268,3 +274,883 @@ fsp_err_t HW_SCE_AES_256CreateEncryptedKey (uint32_t * OutData_KeyIndex)
 
     return FSP_SUCCESS;
 }
+
+static void      hw_sce_aes_counter_add(uint32_t * counter, uint32_t num_blocks);
+static fsp_err_t hw_sce_aes_chained(sce_aes_key_size_t key_size,
+                                    uint32_t           command,
+                                    const uint32_t   * InData_KeyIndex,
+                                    const uint32_t   * InData_IV,
+                                    const uint32_t     num_words,
+                                    const uint32_t   * InData_Text,
+                                    uint32_t         * OutData_Text,
+                                    uint32_t         * OutData_IV);
+
+/* Advances a 128-bit big-endian counter by num_blocks. */
+static void hw_sce_aes_counter_add (uint32_t * counter, uint32_t num_blocks)
+{
+    uint32_t carry = num_blocks;
+
+    for (uint32_t i = 4U; (i > 0U) && (0U != carry); i--)
+    {
+        uint32_t word = change_endian_long(counter[i - 1U]);
+        uint32_t sum  = word + carry;
+
+        carry           = (sum < word) ? 1U : 0U;
+        counter[i - 1U] = change_endian_long(sum);
+    }
+}
+
+/* Runs a whole CBC or CTR buffer through a single Init/Update/Final sequence. The SCE9 Final procedure does not return
+ * the chaining value, so the IV for the next call is derived here: the last ciphertext block for CBC and the initial
+ * counter advanced by the number of blocks (as a 128-bit big-endian integer) for CTR. */
+static fsp_err_t hw_sce_aes_chained (sce_aes_key_size_t key_size,
+                                     uint32_t           command,
+                                     const uint32_t   * InData_KeyIndex,
+                                     const uint32_t   * InData_IV,
+                                     const uint32_t     num_words,
+                                     const uint32_t   * InData_Text,
+                                     uint32_t         * OutData_Text,
+                                     uint32_t         * OutData_IV)
+{
+    fsp_err_t status     = FSP_ERR_CRYPTO_SCE_FAIL;
+    uint32_t  indata_cmd = change_endian_long(command);
+    uint32_t  next_iv[4];
+
+    for (uint32_t i = 0U; i < 4U; i++)
+    {
+        next_iv[i] = InData_IV[i];
+    }
+
+    if (0U == num_words)
+    {
+        for (uint32_t i = 0U; i < 4U; i++)
+        {
+            OutData_IV[i] = next_iv[i];
+        }
+
+        return FSP_SUCCESS;
+    }
+
+    /* Capture the last ciphertext block before an in-place decryption overwrites it. */
+    if (SCE_AES_CMD_CBC_DECRYPT == command)
+    {
+        for (uint32_t i = 0U; i < 4U; i++)
+        {
+            next_iv[i] = InData_Text[num_words - 4U + i];
+        }
+    }
+
+    status = init[key_size](&indata_cmd, InData_KeyIndex, InData_IV);
+    if (FSP_SUCCESS == status)
+    {
+        update[key_size](InData_Text, OutData_Text, num_words);
+        status = final[key_size]();
+    }
+
+    if (FSP_SUCCESS != status)
+    {
+        return FSP_ERR_CRYPTO_SCE_FAIL;
+    }
+
+    if (SCE_AES_CMD_CBC_ENCRYPT == command)
+    {
+        for (uint32_t i = 0U; i < 4U; i++)
+        {
+            next_iv[i] = OutData_Text[num_words - 4U + i];
+        }
+    }
+    else if (SCE_AES_CMD_CTR == command)
+    {
+        hw_sce_aes_counter_add(next_iv, num_words >> 2);
+    }
+    else
+    {
+        /* CBC decryption already captured the chaining value. */
+    }
+
+    for (uint32_t i = 0U; i < 4U; i++)
+    {
+        OutData_IV[i] = next_iv[i];
+    }
+
+    return FSP_SUCCESS;
+}
+
+fsp_err_t HW_SCE_AES_128CbcEncrypt (const uint32_t * InData_KeyIndex,
+                                    const uint32_t * InData_IV,
+                                    const uint32_t   num_words,
+                                    const uint32_t * InData_Text,
+                                    uint32_t       * OutData_Text,
+                                    uint32_t       * OutData_IV)
+{
+    return hw_sce_aes_chained(SCE_AES_KEY_SIZE_128,
+                              SCE_AES_CMD_CBC_ENCRYPT,
+                              InData_KeyIndex,
+                              InData_IV,
+                              num_words,
+                              InData_Text,
+                              OutData_Text,
+                              OutData_IV);
+}
+
+fsp_err_t HW_SCE_AES_128CbcDecrypt (const uint32_t * InData_KeyIndex,
+                                    const uint32_t * InData_IV,
+                                    const uint32_t   num_words,
+                                    const uint32_t * InData_Text,
+                                    uint32_t       * OutData_Text,
+                                    uint32_t       * OutData_IV)
+{
+    return hw_sce_aes_chained(SCE_AES_KEY_SIZE_128,
+                              SCE_AES_CMD_CBC_DECRYPT,
+                              InData_KeyIndex,
+                              InData_IV,
+                              num_words,
+                              InData_Text,
+                              OutData_Text,
+                              OutData_IV);
+}
+
+fsp_err_t HW_SCE_AES_128CtrEncrypt (const uint32_t * InData_KeyIndex,
+                                    const uint32_t * InData_IV,
+                                    const uint32_t   num_words,
+                                    const uint32_t * InData_Text,
+                                    uint32_t       * OutData_Text,
+                                    uint32_t       * OutData_IV)
+{
+    return hw_sce_aes_chained(SCE_AES_KEY_SIZE_128,
+                              SCE_AES_CMD_CTR,
+                              InData_KeyIndex,
+                              InData_IV,
+                              num_words,
+                              InData_Text,
+                              OutData_Text,
+                              OutData_IV);
+}
+
+fsp_err_t HW_SCE_AES_192CbcEncrypt (const uint32_t * InData_KeyIndex,
+                                    const uint32_t * InData_IV,
+                                    const uint32_t   num_words,
+                                    const uint32_t * InData_Text,
+                                    uint32_t       * OutData_Text,
+                                    uint32_t       * OutData_IV)
+{
+    return hw_sce_aes_chained(SCE_AES_KEY_SIZE_192,
+                              SCE_AES_CMD_CBC_ENCRYPT,
+                              InData_KeyIndex,
+                              InData_IV,
+                              num_words,
+                              InData_Text,
+                              OutData_Text,
+                              OutData_IV);
+}
+
+fsp_err_t HW_SCE_AES_192CbcDecrypt (const uint32_t * InData_KeyIndex,
+                                    const uint32_t * InData_IV,
+                                    const uint32_t   num_words,
+                                    const uint32_t * InData_Text,
+                                    uint32_t       * OutData_Text,
+                                    uint32_t       * OutData_IV)
+{
+    return hw_sce_aes_chained(SCE_AES_KEY_SIZE_192,
+                              SCE_AES_CMD_CBC_DECRYPT,
+                              InData_KeyIndex,
+                              InData_IV,
+                              num_words,
+                              InData_Text,
+                              OutData_Text,
+                              OutData_IV);
+}
+
+fsp_err_t HW_SCE_AES_192CtrEncrypt (const uint32_t * InData_KeyIndex,
+                                    const uint32_t * InData_IV,
+                                    const uint32_t   num_words,
+                                    const uint32_t * InData_Text,
+                                    uint32_t       * OutData_Text,
+                                    uint32_t       * OutData_IV)
+{
+    return hw_sce_aes_chained(SCE_AES_KEY_SIZE_192,
+                              SCE_AES_CMD_CTR,
+                              InData_KeyIndex,
+                              InData_IV,
+                              num_words,
+                              InData_Text,
+                              OutData_Text,
+                              OutData_IV);
+}
+
+fsp_err_t HW_SCE_AES_256CbcEncrypt (const uint32_t * InData_KeyIndex,
+                                    const uint32_t * InData_IV,
+                                    const uint32_t   num_words,
+                                    const uint32_t * InData_Text,
+                                    uint32_t       * OutData_Text,
+                                    uint32_t       * OutData_IV)
+{
+    return hw_sce_aes_chained(SCE_AES_KEY_SIZE_256,
+                              SCE_AES_CMD_CBC_ENCRYPT,
+                              InData_KeyIndex,
+                              InData_IV,
+                              num_words,
+                              InData_Text,
+                              OutData_Text,
+                              OutData_IV);
+}
+
+fsp_err_t HW_SCE_AES_256CbcDecrypt (const uint32_t * InData_KeyIndex,
+                                    const uint32_t * InData_IV,
+                                    const uint32_t   num_words,
+                                    const uint32_t * InData_Text,
+                                    uint32_t       * OutData_Text,
+                                    uint32_t       * OutData_IV)
+{
+    return hw_sce_aes_chained(SCE_AES_KEY_SIZE_256,
+                              SCE_AES_CMD_CBC_DECRYPT,
+                              InData_KeyIndex,
+                              InData_IV,
+                              num_words,
+                              InData_Text,
+                              OutData_Text,
+                              OutData_IV);
+}
+
+fsp_err_t HW_SCE_AES_256CtrEncrypt (const uint32_t * InData_KeyIndex,
+                                    const uint32_t * InData_IV,
+                                    const uint32_t   num_words,
+                                    const uint32_t * InData_Text,
+                                    uint32_t       * OutData_Text,
+                                    uint32_t       * OutData_IV)
+{
+    return hw_sce_aes_chained(SCE_AES_KEY_SIZE_256,
+                              SCE_AES_CMD_CTR,
+                              InData_KeyIndex,
+                              InData_IV,
+                              num_words,
+                              InData_Text,
+                              OutData_Text,
+                              OutData_IV);
+}
+
+/* Streaming GCM and CCM procedures for one key size and direction. */
+typedef struct st_hw_sce_gcm_procedures
+{
+    fsp_err_t (* init)(uint32_t * InData_KeyType, uint32_t * InData_KeyIndex, uint32_t * InData_IV);
+    void (* update_aad)(uint32_t * InData_DataA, uint32_t MAX_CNT);
+    void (* update_transition)(void);
+    void (* update)(uint32_t * InData_Text, uint32_t * OutData_Text, uint32_t MAX_CNT);
+} hw_sce_gcm_procedures_t;
+
+typedef struct st_hw_sce_ccm_procedures
+{
+    fsp_err_t (* init)(uint32_t * InData_KeyIndex, uint32_t * InData_IV, uint32_t * InData_Header, uint32_t Header_Len);
+    void (* update)(uint32_t * InData_Text, uint32_t * OutData_Text, uint32_t MAX_CNT);
+} hw_sce_ccm_procedures_t;
+
+static fsp_err_t hw_sce_aes_key_size_get(uint32_t key_bits, sce_aes_key_size_t * p_key_size);
+static fsp_err_t hw_sce_aes_256gcm_encrypt_init(uint32_t * InData_KeyType, uint32_t * InData_KeyIndex,
+                                                uint32_t * InData_IV);
+static fsp_err_t hw_sce_aes_256gcm_decrypt_init(uint32_t * InData_KeyType, uint32_t * InData_KeyIndex,
+                                                uint32_t * InData_IV);
+
+/* Indexed by [key size][0 = encrypt, 1 = decrypt]. */
+static const hw_sce_gcm_procedures_t g_hw_sce_gcm[][2] =
+{
+    [SCE_AES_KEY_SIZE_128] =
+    {
+        {HW_SCE_Aes128GcmEncryptInitSub, HW_SCE_Aes128GcmEncryptUpdateAADSub,
+         HW_SCE_Aes128GcmEncryptUpdateTransitionSub, HW_SCE_Aes128GcmEncryptUpdateSub},
+        {HW_SCE_Aes128GcmDecryptInitSub, HW_SCE_Aes128GcmDecryptUpdateAADSub,
+         HW_SCE_Aes128GcmDecryptUpdateTransitionSub, HW_SCE_Aes128GcmDecryptUpdateSub},
+    },
+    [SCE_AES_KEY_SIZE_192] =
+    {
+        {HW_SCE_Aes192GcmEncryptInitSub, HW_SCE_Aes192GcmEncryptUpdateAADSub,
+         HW_SCE_Aes192GcmEncryptUpdateTransitionSub, HW_SCE_Aes192GcmEncryptUpdateSub},
+        {HW_SCE_Aes192GcmDecryptInitSub, HW_SCE_Aes192GcmDecryptUpdateAADSub,
+         HW_SCE_Aes192GcmDecryptUpdateTransitionSub, HW_SCE_Aes192GcmDecryptUpdateSub},
+    },
+    [SCE_AES_KEY_SIZE_256] =
+    {
+        {hw_sce_aes_256gcm_encrypt_init, HW_SCE_Aes256GcmEncryptUpdateAADSub,
+         HW_SCE_Aes256GcmEncryptUpdateTransitionSub, HW_SCE_Aes256GcmEncryptUpdateSub},
+        {hw_sce_aes_256gcm_decrypt_init, HW_SCE_Aes256GcmDecryptUpdateAADSub,
+         HW_SCE_Aes256GcmDecryptUpdateTransitionSub, HW_SCE_Aes256GcmDecryptUpdateSub},
+    },
+};
+
+static fsp_err_t (* const g_hw_sce_gcm_encrypt_final[])(uint32_t * InData_Text, uint32_t * InData_DataALen,
+                                                        uint32_t * InData_TextLen, uint32_t * OutData_Text,
+                                                        uint32_t * OutData_DataT) =
+{
+    [SCE_AES_KEY_SIZE_128] = HW_SCE_Aes128GcmEncryptFinalSub,
+    [SCE_AES_KEY_SIZE_192] = HW_SCE_Aes192GcmEncryptFinalSub,
+    [SCE_AES_KEY_SIZE_256] = HW_SCE_Aes256GcmEncryptFinalSub,
+};
+
+static fsp_err_t (* const g_hw_sce_gcm_decrypt_final[])(uint32_t * InData_Text, uint32_t * InData_DataT,
+                                                        uint32_t * InData_DataALen, uint32_t * InData_TextLen,
+                                                        uint32_t * InData_DataTLen, uint32_t * OutData_Text) =
+{
+    [SCE_AES_KEY_SIZE_128] = HW_SCE_Aes128GcmDecryptFinalSub,
+    [SCE_AES_KEY_SIZE_192] = HW_SCE_Aes192GcmDecryptFinalSub,
+    [SCE_AES_KEY_SIZE_256] = HW_SCE_Aes256GcmDecryptFinalSub,
+};
+
+/* Indexed by [key size][0 = encrypt, 1 = decrypt]. */
+static const hw_sce_ccm_procedures_t g_hw_sce_ccm[][2] =
+{
+    [SCE_AES_KEY_SIZE_128] =
+    {
+        {HW_SCE_Aes128CcmEncryptInitSub, HW_SCE_Aes128CcmEncryptUpdateSub},
+        {HW_SCE_Aes128CcmDecryptInitSub, HW_SCE_Aes128CcmDecryptUpdateSub},
+    },
+    [SCE_AES_KEY_SIZE_192] =
+    {
+        {HW_SCE_Aes192CcmEncryptInitSub, HW_SCE_Aes192CcmEncryptUpdateSub},
+        {HW_SCE_Aes192CcmDecryptInitSub, HW_SCE_Aes192CcmDecryptUpdateSub},
+    },
+    [SCE_AES_KEY_SIZE_256] =
+    {
+        {HW_SCE_Aes256CcmEncryptInitSub, HW_SCE_Aes256CcmEncryptUpdateSub},
+        {HW_SCE_Aes256CcmDecryptInitSub, HW_SCE_Aes256CcmDecryptUpdateSub},
+    },
+};
+
+static fsp_err_t (* const g_hw_sce_ccm_encrypt_final[])(uint32_t * InData_TextLen, uint32_t * InData_Text,
+                                                        uint32_t * OutData_Text, uint32_t * OutData_MAC) =
+{
+    [SCE_AES_KEY_SIZE_128] = HW_SCE_Aes128CcmEncryptFinalSub,
+    [SCE_AES_KEY_SIZE_192] = HW_SCE_Aes192CcmEncryptFinalSub,
+    [SCE_AES_KEY_SIZE_256] = HW_SCE_Aes256CcmEncryptFinalSub,
+};
+
+static fsp_err_t (* const g_hw_sce_ccm_decrypt_final[])(uint32_t * InData_Text, uint32_t * InData_TextLen,
+                                                        uint32_t * InData_MAC, uint32_t * InData_MACLength,
+                                                        uint32_t * OutData_Text) =
+{
+    [SCE_AES_KEY_SIZE_128] = HW_SCE_Aes128CcmDecryptFinalSub,
+    [SCE_AES_KEY_SIZE_192] = HW_SCE_Aes192CcmDecryptFinalSub,
+    [SCE_AES_KEY_SIZE_256] = HW_SCE_Aes256CcmDecryptFinalSub,
+};
+
+static fsp_err_t hw_sce_aes_key_size_get (uint32_t key_bits, sce_aes_key_size_t * p_key_size)
+{
+    switch (key_bits)
+    {
+        case SIZE_AES_128BIT_KEYLEN_BITS:
+        {
+            *p_key_size = SCE_AES_KEY_SIZE_128;
+            break;
+        }
+
+        case SIZE_AES_192BIT_KEYLEN_BITS:
+        {
+            *p_key_size = SCE_AES_KEY_SIZE_192;
+            break;
+        }
+
+        case SIZE_AES_256BIT_KEYLEN_BITS:
+        {
+            *p_key_size = SCE_AES_KEY_SIZE_256;
+            break;
+        }
+
+        default:
+        {
+            return FSP_ERR_CRYPTO_SCE_FAIL;
+        }
+    }
+
+    return FSP_SUCCESS;
+}
+
+/* The AES-256 GCM procedures take no key type argument. */
+static fsp_err_t hw_sce_aes_256gcm_encrypt_init (uint32_t * InData_KeyType, uint32_t * InData_KeyIndex,
+                                                 uint32_t * InData_IV)
+{
+    (void) InData_KeyType;
+
+    return HW_SCE_Aes256GcmEncryptInitSub(InData_KeyIndex, InData_IV);
+}
+
+static fsp_err_t hw_sce_aes_256gcm_decrypt_init (uint32_t * InData_KeyType, uint32_t * InData_KeyIndex,
+                                                 uint32_t * InData_IV)
+{
+    (void) InData_KeyType;
+
+    return HW_SCE_Aes256GcmDecryptInitSub(InData_KeyIndex, InData_IV);
+}
+
+fsp_err_t HW_SCE_AES_GcmInit (const uint32_t   key_bits,
+                              const uint32_t   decrypt,
+                              const uint32_t * InData_KeyIndex,
+                              const uint32_t * InData_IV)
+{
+    sce_aes_key_size_t key_size       = SCE_AES_KEY_SIZE_128;
+    uint32_t           indata_keytype = 0U; /* Key index generated from a plain key */
+
+    if (FSP_SUCCESS != hw_sce_aes_key_size_get(key_bits, &key_size))
+    {
+        return FSP_ERR_CRYPTO_SCE_FAIL;
+    }
+
+    return g_hw_sce_gcm[key_size][decrypt != 0U].init(&indata_keytype,
+                                                      (uint32_t *) InData_KeyIndex,
+                                                      (uint32_t *) InData_IV);
+}
+
+fsp_err_t HW_SCE_AES_GcmUpdateAad (const uint32_t   key_bits,
+                                   const uint32_t   decrypt,
+                                   const uint32_t * InData_DataA,
+                                   const uint32_t   num_words)
+{
+    sce_aes_key_size_t key_size = SCE_AES_KEY_SIZE_128;
+
+    if (FSP_SUCCESS != hw_sce_aes_key_size_get(key_bits, &key_size))
+    {
+        return FSP_ERR_CRYPTO_SCE_FAIL;
+    }
+
+    g_hw_sce_gcm[key_size][decrypt != 0U].update_aad((uint32_t *) InData_DataA, num_words);
+
+    return FSP_SUCCESS;
+}
+
+fsp_err_t HW_SCE_AES_GcmUpdateTransition (const uint32_t key_bits, const uint32_t decrypt)
+{
+    sce_aes_key_size_t key_size = SCE_AES_KEY_SIZE_128;
+
+    if (FSP_SUCCESS != hw_sce_aes_key_size_get(key_bits, &key_size))
+    {
+        return FSP_ERR_CRYPTO_SCE_FAIL;
+    }
+
+    g_hw_sce_gcm[key_size][decrypt != 0U].update_transition();
+
+    return FSP_SUCCESS;
+}
+
+fsp_err_t HW_SCE_AES_GcmUpdate (const uint32_t   key_bits,
+                                const uint32_t   decrypt,
+                                const uint32_t * InData_Text,
+                                uint32_t       * OutData_Text,
+                                const uint32_t   num_words)
+{
+    sce_aes_key_size_t key_size = SCE_AES_KEY_SIZE_128;
+
+    if (FSP_SUCCESS != hw_sce_aes_key_size_get(key_bits, &key_size))
+    {
+        return FSP_ERR_CRYPTO_SCE_FAIL;
+    }
+
+    g_hw_sce_gcm[key_size][decrypt != 0U].update((uint32_t *) InData_Text, OutData_Text, num_words);
+
+    return FSP_SUCCESS;
+}
+
+fsp_err_t HW_SCE_AES_GcmEncryptFinal (const uint32_t   key_bits,
+                                      const uint32_t * InData_Text,
+                                      const uint32_t * InData_DataALen,
+                                      const uint32_t * InData_TextLen,
+                                      uint32_t       * OutData_Text,
+                                      uint32_t       * OutData_DataT)
+{
+    sce_aes_key_size_t key_size = SCE_AES_KEY_SIZE_128;
+
+    if (FSP_SUCCESS != hw_sce_aes_key_size_get(key_bits, &key_size))
+    {
+        return FSP_ERR_CRYPTO_SCE_FAIL;
+    }
+
+    return g_hw_sce_gcm_encrypt_final[key_size]((uint32_t *) InData_Text,
+                                                (uint32_t *) InData_DataALen,
+                                                (uint32_t *) InData_TextLen,
+                                                OutData_Text,
+                                                OutData_DataT);
+}
+
+fsp_err_t HW_SCE_AES_GcmDecryptFinal (const uint32_t   key_bits,
+                                      const uint32_t * InData_Text,
+                                      const uint32_t * InData_DataT,
+                                      const uint32_t * InData_DataALen,
+                                      const uint32_t * InData_TextLen,
+                                      const uint32_t * InData_DataTLen,
+                                      uint32_t       * OutData_Text)
+{
+    sce_aes_key_size_t key_size = SCE_AES_KEY_SIZE_128;
+
+    if (FSP_SUCCESS != hw_sce_aes_key_size_get(key_bits, &key_size))
+    {
+        return FSP_ERR_CRYPTO_SCE_FAIL;
+    }
+
+    return g_hw_sce_gcm_decrypt_final[key_size]((uint32_t *) InData_Text,
+                                                (uint32_t *) InData_DataT,
+                                                (uint32_t *) InData_DataALen,
+                                                (uint32_t *) InData_TextLen,
+                                                (uint32_t *) InData_DataTLen,
+                                                OutData_Text);
+}
+
+fsp_err_t HW_SCE_AES_Ghash (const uint32_t * InData_HV,
+                            const uint32_t * InData_IV,
+                            const uint32_t * InData_Text,
+                            uint32_t       * OutData_DataT,
+                            const uint32_t   num_words)
+{
+    return HW_SCE_Ghash((uint32_t *) InData_HV, (uint32_t *) InData_IV, (uint32_t *) InData_Text, OutData_DataT,
+                        num_words);
+}
+
+fsp_err_t HW_SCE_AES_CcmInit (const uint32_t   key_bits,
+                              const uint32_t   decrypt,
+                              const uint32_t * InData_KeyIndex,
+                              const uint32_t * InData_IV,
+                              const uint32_t * InData_Header,
+                              const uint32_t   header_words)
+{
+    sce_aes_key_size_t key_size = SCE_AES_KEY_SIZE_128;
+
+    if (FSP_SUCCESS != hw_sce_aes_key_size_get(key_bits, &key_size))
+    {
+        return FSP_ERR_CRYPTO_SCE_FAIL;
+    }
+
+    return g_hw_sce_ccm[key_size][decrypt != 0U].init((uint32_t *) InData_KeyIndex,
+                                                      (uint32_t *) InData_IV,
+                                                      (uint32_t *) InData_Header,
+                                                      header_words);
+}
+
+fsp_err_t HW_SCE_AES_CcmUpdate (const uint32_t   key_bits,
+                                const uint32_t   decrypt,
+                                const uint32_t * InData_Text,
+                                uint32_t       * OutData_Text,
+                                const uint32_t   num_words)
+{
+    sce_aes_key_size_t key_size = SCE_AES_KEY_SIZE_128;
+
+    if (FSP_SUCCESS != hw_sce_aes_key_size_get(key_bits, &key_size))
+    {
+        return FSP_ERR_CRYPTO_SCE_FAIL;
+    }
+
+    g_hw_sce_ccm[key_size][decrypt != 0U].update((uint32_t *) InData_Text, OutData_Text, num_words);
+
+    return FSP_SUCCESS;
+}
+
+fsp_err_t HW_SCE_AES_CcmEncryptFinal (const uint32_t   key_bits,
+                                      const uint32_t * InData_TextLen,
+                                      const uint32_t * InData_Text,
+                                      uint32_t       * OutData_Text,
+                                      uint32_t       * OutData_MAC)
+{
+    sce_aes_key_size_t key_size = SCE_AES_KEY_SIZE_128;
+
+    if (FSP_SUCCESS != hw_sce_aes_key_size_get(key_bits, &key_size))
+    {
+        return FSP_ERR_CRYPTO_SCE_FAIL;
+    }
+
+    return g_hw_sce_ccm_encrypt_final[key_size]((uint32_t *) InData_TextLen,
+                                                (uint32_t *) InData_Text,
+                                                OutData_Text,
+                                                OutData_MAC);
+}
+
+fsp_err_t HW_SCE_AES_CcmDecryptFinal (const uint32_t   key_bits,
+                                      const uint32_t * InData_Text,
+                                      const uint32_t * InData_TextLen,
+                                      const uint32_t * InData_MAC,
+                                      const uint32_t * InData_MACLength,
+                                      uint32_t       * OutData_Text)
+{
+    sce_aes_key_size_t key_size = SCE_AES_KEY_SIZE_128;
+
+    if (FSP_SUCCESS != hw_sce_aes_key_size_get(key_bits, &key_size))
+    {
+        return FSP_ERR_CRYPTO_SCE_FAIL;
+    }
+
+    return g_hw_sce_ccm_decrypt_final[key_size]((uint32_t *) InData_Text,
+                                                (uint32_t *) InData_TextLen,
+                                                (uint32_t *) InData_MAC,
+                                                (uint32_t *) InData_MACLength,
+                                                OutData_Text);
+}
+
+/* Asynchronous AES: the Init and Final procedures run on the CPU, the data phase between them is fed by the DMAC. */
+typedef struct st_hw_sce_aes_async_ctrl
+{
+    hw_sce_aes_async_cfg_t const * p_cfg;
+    hw_sce_aes_async_request_t   * p_head;     /* Request being processed */
+    hw_sce_aes_async_request_t   * p_tail;     /* Last queued request */
+    sce_aes_key_size_t             key_size;   /* Key size of p_head */
+    uint32_t                       next_iv[4]; /* CBC decryption chaining value, captured before an in-place run */
+    transfer_info_t                write_info;
+    transfer_info_t                read_info;
+    bool                           open;
+} hw_sce_aes_async_ctrl_t;
+
+static void (* const g_hw_sce_aes_update_start[])(void) =
+{
+    [SCE_AES_KEY_SIZE_128] = HW_SCE_Aes128EncryptDecryptUpdateStartSub,
+    [SCE_AES_KEY_SIZE_192] = HW_SCE_Aes192EncryptDecryptUpdateStartSub,
+    [SCE_AES_KEY_SIZE_256] = HW_SCE_Aes256EncryptDecryptUpdateStartSub,
+};
+
+static void (* const g_hw_sce_aes_update_end[])(void) =
+{
+    [SCE_AES_KEY_SIZE_128] = HW_SCE_Aes128EncryptDecryptUpdateEndSub,
+    [SCE_AES_KEY_SIZE_192] = HW_SCE_Aes192EncryptDecryptUpdateEndSub,
+    [SCE_AES_KEY_SIZE_256] = HW_SCE_Aes256EncryptDecryptUpdateEndSub,
+};
+
+static hw_sce_aes_async_ctrl_t g_hw_sce_aes_async_ctrl;
+
+static void hw_sce_aes_async_start(void);
+static void hw_sce_aes_async_complete(fsp_err_t status);
+
+fsp_err_t HW_SCE_AES_AsyncOpen (hw_sce_aes_async_cfg_t const * const p_cfg)
+{
+    hw_sce_aes_async_ctrl_t * p_ctrl = &g_hw_sce_aes_async_ctrl;
+
+    FSP_ERROR_RETURN(NULL != p_cfg, FSP_ERR_ASSERTION);
+    FSP_ERROR_RETURN(NULL != p_cfg->p_transfer_write, FSP_ERR_ASSERTION);
+    FSP_ERROR_RETURN(NULL != p_cfg->p_transfer_read, FSP_ERR_ASSERTION);
+    FSP_ERROR_RETURN(false == p_ctrl->open, FSP_ERR_ALREADY_OPEN);
+
+    transfer_instance_t const * p_write = p_cfg->p_transfer_write;
+    transfer_instance_t const * p_read  = p_cfg->p_transfer_read;
+
+    fsp_err_t err = p_write->p_api->open(p_write->p_ctrl, p_write->p_cfg);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+    err = p_read->p_api->open(p_read->p_ctrl, p_read->p_cfg);
+    if (FSP_SUCCESS != err)
+    {
+        p_write->p_api->close(p_write->p_ctrl);
+
+        return err;
+    }
+
+    p_ctrl->p_cfg  = p_cfg;
+    p_ctrl->p_head = NULL;
+    p_ctrl->p_tail = NULL;
+    p_ctrl->open   = true;
+
+    return FSP_SUCCESS;
+}
+
+fsp_err_t HW_SCE_AES_AsyncSubmit (hw_sce_aes_async_request_t * const p_request)
+{
+    hw_sce_aes_async_ctrl_t * p_ctrl   = &g_hw_sce_aes_async_ctrl;
+    sce_aes_key_size_t        key_size = SCE_AES_KEY_SIZE_128;
+
+    FSP_ERROR_RETURN(NULL != p_request, FSP_ERR_ASSERTION);
+    FSP_ERROR_RETURN(NULL != p_request->p_key_index, FSP_ERR_ASSERTION);
+    FSP_ERROR_RETURN(NULL != p_request->p_input, FSP_ERR_ASSERTION);
+    FSP_ERROR_RETURN(NULL != p_request->p_output, FSP_ERR_ASSERTION);
+    FSP_ERROR_RETURN(p_ctrl->open, FSP_ERR_NOT_OPEN);
+    FSP_ERROR_RETURN(FSP_SUCCESS == hw_sce_aes_key_size_get(p_request->key_bits, &key_size), FSP_ERR_INVALID_ARGUMENT);
+    FSP_ERROR_RETURN(p_request->mode <= HW_SCE_AES_ASYNC_MODE_CTR, FSP_ERR_INVALID_ARGUMENT);
+    FSP_ERROR_RETURN((0U != p_request->num_words) && (0U == (p_request->num_words % SIZE_AES_BLOCK_WORDS)) &&
+                     (p_request->num_words <= HW_SCE_AES_ASYNC_MAX_WORDS),
+                     FSP_ERR_INVALID_SIZE);
+
+    p_request->status = FSP_ERR_IN_USE;
+    p_request->p_next = NULL;
+
+    /* The queue is also updated from the DMAC interrupt when a request completes. */
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+    bool idle = (NULL == p_ctrl->p_head);
+    if (idle)
+    {
+        p_ctrl->p_head = p_request;
+    }
+    else
+    {
+        p_ctrl->p_tail->p_next = p_request;
+    }
+
+    p_ctrl->p_tail = p_request;
+    FSP_CRITICAL_SECTION_EXIT;
+
+    if (idle)
+    {
+        hw_sce_aes_async_start();
+    }
+
+    return FSP_SUCCESS;
+}
+
+fsp_err_t HW_SCE_AES_AsyncClose (void)
+{
+    hw_sce_aes_async_ctrl_t * p_ctrl = &g_hw_sce_aes_async_ctrl;
+
+    FSP_ERROR_RETURN(p_ctrl->open, FSP_ERR_NOT_OPEN);
+    FSP_ERROR_RETURN(NULL == p_ctrl->p_head, FSP_ERR_IN_USE);
+
+    transfer_instance_t const * p_write = p_ctrl->p_cfg->p_transfer_write;
+    transfer_instance_t const * p_read  = p_ctrl->p_cfg->p_transfer_read;
+
+    p_write->p_api->close(p_write->p_ctrl);
+    p_read->p_api->close(p_read->p_ctrl);
+    p_ctrl->open = false;
+
+    return FSP_SUCCESS;
+}
+
+/* Read channel transfer end: every output block of the current request has been stored. */
+void hw_sce_aes_async_dmac_callback (dmac_callback_args_t * p_args)
+{
+    hw_sce_aes_async_ctrl_t * p_ctrl = &g_hw_sce_aes_async_ctrl;
+
+    FSP_PARAMETER_NOT_USED(p_args);
+
+    g_hw_sce_aes_update_end[p_ctrl->key_size]();
+    fsp_err_t err = final[p_ctrl->key_size]();
+
+    hw_sce_aes_async_complete((FSP_SUCCESS == err) ? FSP_SUCCESS : FSP_ERR_CRYPTO_SCE_FAIL);
+}
+
+/* Runs the Init procedure of the request at the head of the queue and hands the data phase to the DMAC. */
+static void hw_sce_aes_async_start (void)
+{
+    hw_sce_aes_async_ctrl_t    * p_ctrl     = &g_hw_sce_aes_async_ctrl;
+    hw_sce_aes_async_request_t * p_request  = p_ctrl->p_head;
+    transfer_instance_t const  * p_write    = p_ctrl->p_cfg->p_transfer_write;
+    transfer_instance_t const  * p_read     = p_ctrl->p_cfg->p_transfer_read;
+    uint32_t                     num_blocks = p_request->num_words / SIZE_AES_BLOCK_WORDS;
+    uint32_t                     indata_cmd = change_endian_long((uint32_t) p_request->mode);
+
+    (void) hw_sce_aes_key_size_get(p_request->key_bits, &p_ctrl->key_size);
+
+    /* Capture the last ciphertext block before an in-place decryption overwrites it. */
+    if (HW_SCE_AES_ASYNC_MODE_CBC_DECRYPT == p_request->mode)
+    {
+        for (uint32_t i = 0U; i < 4U; i++)
+        {
+            p_ctrl->next_iv[i] = p_request->p_input[p_request->num_words - 4U + i];
+        }
+    }
+
+    if (FSP_SUCCESS != init[p_ctrl->key_size](&indata_cmd, p_request->p_key_index, p_request->iv))
+    {
+        hw_sce_aes_async_complete(FSP_ERR_CRYPTO_SCE_FAIL);
+
+        return;
+    }
+
+    g_hw_sce_aes_update_start[p_ctrl->key_size]();
+
+    /* One 16-byte block is moved per INTEGRATE_RDRDY request, into the output buffer. */
+    p_ctrl->read_info.transfer_settings_word = 0U;
+    p_ctrl->read_info.mode                   = TRANSFER_MODE_BLOCK;
+    p_ctrl->read_info.size                   = TRANSFER_SIZE_4_BYTE;
+    p_ctrl->read_info.src_addr_mode          = TRANSFER_ADDR_MODE_FIXED;
+    p_ctrl->read_info.dest_addr_mode         = TRANSFER_ADDR_MODE_INCREMENTED;
+    p_ctrl->read_info.repeat_area            = TRANSFER_REPEAT_AREA_SOURCE;
+    p_ctrl->read_info.irq                    = TRANSFER_IRQ_END;
+    p_ctrl->read_info.chain_mode             = TRANSFER_CHAIN_MODE_DISABLED;
+    p_ctrl->read_info.p_src                  = (void const *) &SCE->REG_100H;
+    p_ctrl->read_info.p_dest                 = p_request->p_output;
+    p_ctrl->read_info.num_blocks             = (uint16_t) num_blocks;
+    p_ctrl->read_info.length                 = SIZE_AES_BLOCK_WORDS;
+
+    fsp_err_t err = p_read->p_api->reconfigure(p_read->p_ctrl, &p_ctrl->read_info);
+
+    /* The first block is written by the CPU below. Each later INTEGRATE_WRRDY request moves one more block in, so the
+     * write channel is armed before the first write and no request can be missed. */
+    if ((FSP_SUCCESS == err) && (num_blocks > 1U))
+    {
+        p_ctrl->write_info.transfer_settings_word = 0U;
+        p_ctrl->write_info.mode                   = TRANSFER_MODE_BLOCK;
+        p_ctrl->write_info.size                   = TRANSFER_SIZE_4_BYTE;
+        p_ctrl->write_info.src_addr_mode          = TRANSFER_ADDR_MODE_INCREMENTED;
+        p_ctrl->write_info.dest_addr_mode         = TRANSFER_ADDR_MODE_FIXED;
+        p_ctrl->write_info.repeat_area            = TRANSFER_REPEAT_AREA_DESTINATION;
+        p_ctrl->write_info.irq                    = TRANSFER_IRQ_END;
+        p_ctrl->write_info.chain_mode             = TRANSFER_CHAIN_MODE_DISABLED;
+        p_ctrl->write_info.p_src                  = &p_request->p_input[SIZE_AES_BLOCK_WORDS];
+        p_ctrl->write_info.p_dest                 = (void *) &SCE->REG_100H;
+        p_ctrl->write_info.num_blocks             = (uint16_t) (num_blocks - 1U);
+        p_ctrl->write_info.length                 = SIZE_AES_BLOCK_WORDS;
+
+        err = p_write->p_api->reconfigure(p_write->p_ctrl, &p_ctrl->write_info);
+    }
+
+    if (FSP_SUCCESS != err)
+    {
+        p_read->p_api->disable(p_read->p_ctrl);
+        g_hw_sce_aes_update_end[p_ctrl->key_size]();
+        hw_sce_aes_async_complete(err);
+
+        return;
+    }
+
+    /* WAIT_LOOP */
+    while (1U != SCE->REG_104H_b.B31)
+    {
+        /* waiting */
+    }
+
+    SCE->REG_100H = p_request->p_input[0];
+    SCE->REG_100H = p_request->p_input[1];
+    SCE->REG_100H = p_request->p_input[2];
+    SCE->REG_100H = p_request->p_input[3];
+}
+
+/* Reports the result of the head request and starts the next one. */
+static void hw_sce_aes_async_complete (fsp_err_t status)
+{
+    hw_sce_aes_async_ctrl_t    * p_ctrl    = &g_hw_sce_aes_async_ctrl;
+    hw_sce_aes_async_request_t * p_request = p_ctrl->p_head;
+
+    if (FSP_SUCCESS == status)
+    {
+        if (HW_SCE_AES_ASYNC_MODE_CBC_ENCRYPT == p_request->mode)
+        {
+            for (uint32_t i = 0U; i < 4U; i++)
+            {
+                p_request->iv[i] = p_request->p_output[p_request->num_words - 4U + i];
+            }
+        }
+        else if (HW_SCE_AES_ASYNC_MODE_CBC_DECRYPT == p_request->mode)
+        {
+            for (uint32_t i = 0U; i < 4U; i++)
+            {
+                p_request->iv[i] = p_ctrl->next_iv[i];
+            }
+        }
+        else if (HW_SCE_AES_ASYNC_MODE_CTR == p_request->mode)
+        {
+            hw_sce_aes_counter_add(p_request->iv, p_request->num_words / SIZE_AES_BLOCK_WORDS);
+        }
+        else
+        {
+            /* ECB has no chaining value. */
+        }
+    }
+
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+    p_ctrl->p_head = p_request->p_next;
+    if (NULL == p_ctrl->p_head)
+    {
+        p_ctrl->p_tail = NULL;
+    }
+
+    FSP_CRITICAL_SECTION_EXIT;
+
+    p_request->status = status;
+    if (NULL != p_request->p_callback)
+    {
+        p_request->p_callback(p_request);
+    }
+
+    if (NULL != p_ctrl->p_head)
+    {
+        hw_sce_aes_async_start();
+    }
+}
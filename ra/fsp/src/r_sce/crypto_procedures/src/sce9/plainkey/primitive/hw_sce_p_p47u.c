@@ -50,6 +50,54 @@ Private global variables and functions
 
 void HW_SCE_Aes128EncryptDecryptUpdateSub (const uint32_t * InData_Text, uint32_t * OutData_Text,
                                            const uint32_t MAX_CNT)
+{
+    uint32_t iLoop = 0u;
+    HW_SCE_Aes128EncryptDecryptUpdateStartSub();
+    /* WAIT_LOOP */
+    while (1u != SCE->REG_104H_b.B31)
+    {
+        /* waiting */
+    }
+    SCE->REG_100H = InData_Text[0];
+    SCE->REG_100H = InData_Text[1];
+    SCE->REG_100H = InData_Text[2];
+    SCE->REG_100H = InData_Text[3];
+    for (iLoop = 4; iLoop < MAX_CNT ; iLoop = iLoop + 4)
+    {
+        /* WAIT_LOOP */
+        while (1u != SCE->REG_104H_b.B31)
+        {
+            /* waiting */
+        }
+        SCE->REG_100H = InData_Text[iLoop + 0];
+        SCE->REG_100H = InData_Text[iLoop + 1];
+        SCE->REG_100H = InData_Text[iLoop + 2];
+        SCE->REG_100H = InData_Text[iLoop + 3];
+        /* WAIT_LOOP */
+        while (1u != SCE->REG_04H_b.B30)
+        {
+            /* waiting */
+        }
+        OutData_Text[iLoop-4 + 0] = SCE->REG_100H;
+        OutData_Text[iLoop-4 + 1] = SCE->REG_100H;
+        OutData_Text[iLoop-4 + 2] = SCE->REG_100H;
+        OutData_Text[iLoop-4 + 3] = SCE->REG_100H;
+    }
+    /* WAIT_LOOP */
+    while (1u != SCE->REG_04H_b.B30)
+    {
+        /* waiting */
+    }
+    OutData_Text[MAX_CNT-4 + 0] = SCE->REG_100H;
+    OutData_Text[MAX_CNT-4 + 1] = SCE->REG_100H;
+    OutData_Text[MAX_CNT-4 + 2] = SCE->REG_100H;
+    OutData_Text[MAX_CNT-4 + 3] = SCE->REG_100H;
+    HW_SCE_Aes128EncryptDecryptUpdateEndSub();
+}
+
+/* Sets up the data phase and enables the INTEGRATE_WRRDYB and INTEGRATE_RDRDYB request signals. The data can then be
+ * moved through REG_100H by the CPU or by the DMAC. */
+void HW_SCE_Aes128EncryptDecryptUpdateStartSub (void)
 {
     uint32_t iLoop = 0u, iLoop1 = 0u, iLoop2 = 0u, jLoop = 0u, kLoop = 0u, oLoop = 0u, oLoop1 = 0u, oLoop2 = 0u, KEY_ADR = 0u, OFS_ADR = 0u, MAX_CNT2 = 0u;
     uint32_t dummy = 0u;
@@ -105,45 +153,25 @@ void HW_SCE_Aes128EncryptDecryptUpdateSub (const uint32_t * InData_Text, uint32_
         SCE->REG_A4H = 0x000007b6u;
         SCE->REG_04H = 0x0000c100u;
     }
-    /* WAIT_LOOP */
-    while (1u != SCE->REG_104H_b.B31)
-    {
-        /* waiting */
-    }
-    SCE->REG_100H = InData_Text[0];
-    SCE->REG_100H = InData_Text[1];
-    SCE->REG_100H = InData_Text[2];
-    SCE->REG_100H = InData_Text[3];
-    for (iLoop = 4; iLoop < MAX_CNT ; iLoop = iLoop + 4)
-    {
-        /* WAIT_LOOP */
-        while (1u != SCE->REG_104H_b.B31)
-        {
-            /* waiting */
-        }
-        SCE->REG_100H = InData_Text[iLoop + 0];
-        SCE->REG_100H = InData_Text[iLoop + 1];
-        SCE->REG_100H = InData_Text[iLoop + 2];
-        SCE->REG_100H = InData_Text[iLoop + 3];
-        /* WAIT_LOOP */
-        while (1u != SCE->REG_04H_b.B30)
-        {
-            /* waiting */
-        }
-        OutData_Text[iLoop-4 + 0] = SCE->REG_100H;
-        OutData_Text[iLoop-4 + 1] = SCE->REG_100H;
-        OutData_Text[iLoop-4 + 2] = SCE->REG_100H;
-        OutData_Text[iLoop-4 + 3] = SCE->REG_100H;
-    }
-    /* WAIT_LOOP */
-    while (1u != SCE->REG_04H_b.B30)
-    {
-        /* waiting */
-    }
-    OutData_Text[MAX_CNT-4 + 0] = SCE->REG_100H;
-    OutData_Text[MAX_CNT-4 + 1] = SCE->REG_100H;
-    OutData_Text[MAX_CNT-4 + 2] = SCE->REG_100H;
-    OutData_Text[MAX_CNT-4 + 3] = SCE->REG_100H;
+}
+
+/* Ends the data phase once all output words have been read. */
+void HW_SCE_Aes128EncryptDecryptUpdateEndSub (void)
+{
+    uint32_t iLoop = 0u, iLoop1 = 0u, iLoop2 = 0u, jLoop = 0u, kLoop = 0u, oLoop = 0u, oLoop1 = 0u, oLoop2 = 0u, KEY_ADR = 0u, OFS_ADR = 0u, MAX_CNT2 = 0u;
+    uint32_t dummy = 0u;
+    (void)iLoop;
+    (void)iLoop1;
+    (void)iLoop2;
+    (void)jLoop;
+    (void)kLoop;
+    (void)oLoop;
+    (void)oLoop1;
+    (void)oLoop2;
+    (void)dummy;
+    (void)KEY_ADR;
+    (void)OFS_ADR;
+    (void)MAX_CNT2;
     if (0x00000000u == (SCE->REG_1CH & 0xff000000u))
     {
         HW_SCE_p_func206();//DisableINTEGRATE_WRRDYBandINTEGRATE_RDRDYBinthisfunction.
@@ -441,12 +441,18 @@ fsp_err_t HW_SCE_VerifyFirmwareMacSub(uint32_t *InData_Program, uint32_t MAX_CNT
 
 fsp_err_t HW_SCE_Aes128EncryptDecryptInitSub(const uint32_t *InData_Cmd, const uint32_t *InData_KeyIndex, const uint32_t *InData_IV);
 void         HW_SCE_Aes128EncryptDecryptUpdateSub(const uint32_t *InData_Text, uint32_t *OutData_Text, const uint32_t MAX_CNT);
+void         HW_SCE_Aes128EncryptDecryptUpdateStartSub(void);
+void         HW_SCE_Aes128EncryptDecryptUpdateEndSub(void);
 fsp_err_t HW_SCE_Aes128EncryptDecryptFinalSub(void);
 fsp_err_t HW_SCE_Aes192EncryptDecryptInitSub(const uint32_t *InData_Cmd, const uint32_t *InData_KeyIndex, const uint32_t *InData_IV);
 void         HW_SCE_Aes192EncryptDecryptUpdateSub(const uint32_t *InData_Text, uint32_t *OutData_Text, const uint32_t MAX_CNT);
+void         HW_SCE_Aes192EncryptDecryptUpdateStartSub(void);
+void         HW_SCE_Aes192EncryptDecryptUpdateEndSub(void);
 fsp_err_t HW_SCE_Aes192EncryptDecryptFinalSub(void);
 fsp_err_t HW_SCE_Aes256EncryptDecryptInitSub(const uint32_t *InData_Cmd, const uint32_t *InData_KeyIndex, const uint32_t *InData_IV);
 void         HW_SCE_Aes256EncryptDecryptUpdateSub(const uint32_t *InData_Text, uint32_t *OutData_Text, const uint32_t MAX_CNT);
+void         HW_SCE_Aes256EncryptDecryptUpdateStartSub(void);
+void         HW_SCE_Aes256EncryptDecryptUpdateEndSub(void);
 fsp_err_t HW_SCE_Aes256EncryptDecryptFinalSub(void);
 
 fsp_err_t HW_SCE_GenerateAes128XtsRandomKeyIndexSub(uint32_t *OutData_KeyIndex);
@@ -23,6 +23,9 @@
 
 #include <stdint.h>
 #include "bsp_api.h"
+#if BSP_FEATURE_CRYPTO_HAS_SCE9
+ #include "r_dmac.h"
+#endif
 
 /* AES key lengths defined for SCE operations. */
 #define SIZE_AES_128BIT_KEYLEN_BITS             (128)
@@ -59,6 +62,47 @@ typedef struct st_sce_data
     uint32_t * p_data;
 } r_sce_data_t;
 
+#if BSP_FEATURE_CRYPTO_HAS_SCE9
+
+/* Largest request accepted by HW_SCE_AES_AsyncSubmit, limited by the DMAC block count. */
+ #define HW_SCE_AES_ASYNC_MAX_WORDS    (0xFFFFU * SIZE_AES_BLOCK_WORDS)
+
+/* Cipher operation of an asynchronous AES request. */
+typedef enum e_hw_sce_aes_async_mode
+{
+    HW_SCE_AES_ASYNC_MODE_ECB_ENCRYPT = 0,
+    HW_SCE_AES_ASYNC_MODE_ECB_DECRYPT = 1,
+    HW_SCE_AES_ASYNC_MODE_CBC_ENCRYPT = 2,
+    HW_SCE_AES_ASYNC_MODE_CBC_DECRYPT = 3,
+    HW_SCE_AES_ASYNC_MODE_CTR         = 4,
+} hw_sce_aes_async_mode_t;
+
+/* Asynchronous AES request. The request and the buffers it points to must stay valid until p_callback is called. */
+typedef struct st_hw_sce_aes_async_request
+{
+    uint32_t                key_bits;        /* 128, 192 or 256 */
+    hw_sce_aes_async_mode_t mode;
+    const uint32_t        * p_key_index;     /* Wrapped key index */
+    uint32_t                iv[4];           /* IV or initial counter, replaced by the chaining value on completion */
+    const uint32_t        * p_input;
+    uint32_t              * p_output;        /* May be the same as p_input */
+    uint32_t                num_words;       /* Multiple of 4, at most HW_SCE_AES_ASYNC_MAX_WORDS */
+    void (* p_callback)(struct st_hw_sce_aes_async_request * p_request);
+    void const            * p_context;       /* Placeholder for user data */
+    volatile fsp_err_t      status;          /* FSP_ERR_IN_USE while queued, then the result of the request */
+    struct st_hw_sce_aes_async_request * p_next; /* Used by the queue, do not initialize */
+} hw_sce_aes_async_request_t;
+
+/* DMAC channels used by the asynchronous AES mode. The write channel must be activated by
+ * ELC_EVENT_SCE_INTEGRATE_WRRDY and needs no callback. The read channel must be activated by
+ * ELC_EVENT_SCE_INTEGRATE_RDRDY, have its interrupt enabled and use hw_sce_aes_async_dmac_callback(). */
+typedef struct st_hw_sce_aes_async_cfg
+{
+    transfer_instance_t const * p_transfer_write;
+    transfer_instance_t const * p_transfer_read;
+} hw_sce_aes_async_cfg_t;
+#endif
+
 extern fsp_err_t HW_SCE_AES_128EcbEncrypt(const uint32_t * InData_Key,
                                           const uint32_t   num_words,
                                           const uint32_t * InData_Text,
@@ -114,6 +158,27 @@ extern fsp_err_t HW_SCE_AES_192EcbDecrypt(const uint32_t * InData_Key,
                                           const uint32_t * InData_Text,
                                           uint32_t       * OutData_Text);
 
+extern fsp_err_t HW_SCE_AES_192CbcEncrypt(const uint32_t * InData_Key,
+                                          const uint32_t * InData_IV,
+                                          const uint32_t   num_words,
+                                          const uint32_t * InData_Text,
+                                          uint32_t       * OutData_Text,
+                                          uint32_t       * OutData_IV);
+
+extern fsp_err_t HW_SCE_AES_192CbcDecrypt(const uint32_t * InData_Key,
+                                          const uint32_t * InData_IV,
+                                          const uint32_t   num_words,
+                                          const uint32_t * InData_Text,
+                                          uint32_t       * OutData_Text,
+                                          uint32_t       * OutData_IV);
+
+extern fsp_err_t HW_SCE_AES_192CtrEncrypt(const uint32_t * InData_Key,
+                                          const uint32_t * InData_IV,
+                                          const uint32_t   num_words,
+                                          const uint32_t * InData_Text,
+                                          uint32_t       * OutData_Text,
+                                          uint32_t       * OutData_IV);
+
 extern fsp_err_t HW_SCE_AES_256EcbEncrypt(const uint32_t * InData_Key,
                                           const uint32_t   num_words,
                                           const uint32_t * InData_Text,
@@ -215,4 +280,87 @@ extern void HW_SCE_Aes256EncryptDecryptUpdate(const uint32_t * InData_Text,
 
 extern fsp_err_t HW_SCE_Aes256EncryptDecryptFinal(void);
 
+/* Streaming AES-GCM and AES-CCM (SCE9 only). key_bits selects AES-128, AES-192 or AES-256; decrypt selects the
+ * direction. Text and AAD are passed in whole 16-byte blocks, the final partial block is handled by the Final call. */
+extern fsp_err_t HW_SCE_AES_GcmInit(const uint32_t   key_bits,
+                                    const uint32_t   decrypt,
+                                    const uint32_t * InData_KeyIndex,
+                                    const uint32_t * InData_IV);
+
+extern fsp_err_t HW_SCE_AES_GcmUpdateAad(const uint32_t   key_bits,
+                                         const uint32_t   decrypt,
+                                         const uint32_t * InData_DataA,
+                                         const uint32_t   num_words);
+
+extern fsp_err_t HW_SCE_AES_GcmUpdateTransition(const uint32_t key_bits, const uint32_t decrypt);
+
+extern fsp_err_t HW_SCE_AES_GcmUpdate(const uint32_t   key_bits,
+                                      const uint32_t   decrypt,
+                                      const uint32_t * InData_Text,
+                                      uint32_t       * OutData_Text,
+                                      const uint32_t   num_words);
+
+extern fsp_err_t HW_SCE_AES_GcmEncryptFinal(const uint32_t   key_bits,
+                                            const uint32_t * InData_Text,
+                                            const uint32_t * InData_DataALen,
+                                            const uint32_t * InData_TextLen,
+                                            uint32_t       * OutData_Text,
+                                            uint32_t       * OutData_DataT);
+
+extern fsp_err_t HW_SCE_AES_GcmDecryptFinal(const uint32_t   key_bits,
+                                            const uint32_t * InData_Text,
+                                            const uint32_t * InData_DataT,
+                                            const uint32_t * InData_DataALen,
+                                            const uint32_t * InData_TextLen,
+                                            const uint32_t * InData_DataTLen,
+                                            uint32_t       * OutData_Text);
+
+extern fsp_err_t HW_SCE_AES_Ghash(const uint32_t * InData_HV,
+                                  const uint32_t * InData_IV,
+                                  const uint32_t * InData_Text,
+                                  uint32_t       * OutData_DataT,
+                                  const uint32_t   num_words);
+
+extern fsp_err_t HW_SCE_AES_CcmInit(const uint32_t   key_bits,
+                                    const uint32_t   decrypt,
+                                    const uint32_t * InData_KeyIndex,
+                                    const uint32_t * InData_IV,
+                                    const uint32_t * InData_Header,
+                                    const uint32_t   header_words);
+
+extern fsp_err_t HW_SCE_AES_CcmUpdate(const uint32_t   key_bits,
+                                      const uint32_t   decrypt,
+                                      const uint32_t * InData_Text,
+                                      uint32_t       * OutData_Text,
+                                      const uint32_t   num_words);
+
+extern fsp_err_t HW_SCE_AES_CcmEncryptFinal(const uint32_t   key_bits,
+                                            const uint32_t * InData_TextLen,
+                                            const uint32_t * InData_Text,
+                                            uint32_t       * OutData_Text,
+                                            uint32_t       * OutData_MAC);
+
+extern fsp_err_t HW_SCE_AES_CcmDecryptFinal(const uint32_t   key_bits,
+                                            const uint32_t * InData_Text,
+                                            const uint32_t * InData_TextLen,
+                                            const uint32_t * InData_MAC,
+                                            const uint32_t * InData_MACLength,
+                                            uint32_t       * OutData_Text);
+
+#if BSP_FEATURE_CRYPTO_HAS_SCE9
+
+/* Asynchronous AES (SCE9 only). Requests are queued and run one after the other; the input and output blocks are
+ * moved between memory and the SCE by the DMAC, so the CPU is only used to start and finish each request. The
+ * completion callback is called from the DMAC interrupt. The SCE must not be used by any other procedure while a
+ * request is queued. */
+extern fsp_err_t HW_SCE_AES_AsyncOpen(hw_sce_aes_async_cfg_t const * const p_cfg);
+
+extern fsp_err_t HW_SCE_AES_AsyncSubmit(hw_sce_aes_async_request_t * const p_request);
+
+extern fsp_err_t HW_SCE_AES_AsyncClose(void);
+
+extern void hw_sce_aes_async_dmac_callback(dmac_callback_args_t * p_args);
+
+#endif
+
 #endif                                 /* HW_SCE_AES_PRIVATE_H */
@@ -88,6 +88,19 @@ fsp_err_t HW_SCE_secureBoot(void);
 void                 HW_SCE_EndianSetBig(void);
 void                 HW_SCE_EndianSetLittle(void);
 crypto_word_endian_t HW_SCE_EndianFlagGet(void);
+
+/* Every MCU family sets the procedure interface to little endian words in HW_SCE_McuSpecificInit() and the FSP does not
+ * change it afterwards, so drivers convert words against HW_SCE_WORD_ENDIAN and the checks are resolved at build time.
+ * Set HW_SCE_CFG_WORD_ENDIAN_RUNTIME to 1 if the application changes the endianness with HW_SCE_EndianSetBig(). */
+#ifndef HW_SCE_CFG_WORD_ENDIAN_RUNTIME
+ #define HW_SCE_CFG_WORD_ENDIAN_RUNTIME    (0)
+#endif
+
+#if HW_SCE_CFG_WORD_ENDIAN_RUNTIME
+ #define HW_SCE_WORD_ENDIAN                (HW_SCE_EndianFlagGet())
+#else
+ #define HW_SCE_WORD_ENDIAN                (CRYPTO_WORD_ENDIAN_LITTLE)
+#endif
 fsp_err_t            HW_SCE_McuSpecificInit(void);
 
 fsp_err_t HW_SCE_FW_IntegrityChk(void);
@@ -24,6 +24,20 @@
 #include "SC324_private.h"
 #include "sc324_aes_private.h"
 #include "hw_sce_private.h"
+#include "r_dtc.h"
+
+/* Bulk AES mode: DTC transfers configured with HW_SCE_AES_BulkOpen. */
+typedef struct st_hw_sc324_aes_bulk_ctrl
+{
+    hw_sc324_aes_bulk_cfg_t const * p_cfg;
+    bool                            open;
+    IRQn_Type                       write_irq;  // Activation source of the write transfer
+    IRQn_Type                       read_irq;   // Activation source of the read transfer
+    transfer_info_t                 write_info; // Transfer info of the write transfer, used by the DTC vector table
+    transfer_info_t                 read_info;  // Transfer info of the read transfer, used by the DTC vector table
+} hw_sc324_aes_bulk_ctrl_t;
+
+static hw_sc324_aes_bulk_ctrl_t g_hw_sc324_aes_bulk_ctrl;
 
 __STATIC_INLINE void hw_sc324_aes_kernel_module_enable ()
 {
@@ -65,7 +79,7 @@ static void hw_sc324_aes_endian_convert (uint32_t * p_dest, const uint32_t * p_s
     uint32_t             nw;
     crypto_word_endian_t flag;
 
-    flag = HW_SCE_EndianFlagGet();
+    flag = HW_SCE_WORD_ENDIAN;
     for (nw = 0; nw < num_words; nw++)
     {
         if (CRYPTO_WORD_ENDIAN_LITTLE == flag)
@@ -156,36 +170,234 @@ static void hw_sc324_aes_kernel_iv_get (uint32_t * p_iv)
 
 static void hw_sc324_aes_kernel_data_write (const uint32_t * p_data)
 {
-    uint32_t temp[4];
-
     // wait for write_ready
     while (SCE1_AES->AESCMD_b.write_ready == 0)
     {
         ;
     }
 
-    hw_sc324_aes_endian_convert(temp, (uint32_t *) p_data, 4);
-    SCE1_AES->AESDW = temp[0];
-    SCE1_AES->AESDW = temp[1];
-    SCE1_AES->AESDW = temp[2];
-    SCE1_AES->AESDW = temp[3];
+    SCE1_AES->AESDW = p_data[0];
+    SCE1_AES->AESDW = p_data[1];
+    SCE1_AES->AESDW = p_data[2];
+    SCE1_AES->AESDW = p_data[3];
 }
 
 static void hw_sc324_aes_kernel_data_read (uint32_t * p_data)
 {
-    uint32_t temp[4];
-
     // wait for read_ready
     while (SCE1_AES->AESCMD_b.read_ready == 0)
     {
         ;
     }
 
-    temp[0] = SCE1_AES->AESDW;
-    temp[1] = SCE1_AES->AESDW;
-    temp[2] = SCE1_AES->AESDW;
-    temp[3] = SCE1_AES->AESDW;
-    hw_sc324_aes_endian_convert(p_data, temp, 4);
+    p_data[0] = SCE1_AES->AESDW;
+    p_data[1] = SCE1_AES->AESDW;
+    p_data[2] = SCE1_AES->AESDW;
+    p_data[3] = SCE1_AES->AESDW;
+}
+
+static void hw_sc324_aes_block_convert (uint32_t * p_dest, const uint32_t * p_source, crypto_word_endian_t flag)
+{
+    if (CRYPTO_WORD_ENDIAN_LITTLE == flag)
+    {
+        p_dest[0] = __REV(p_source[0]);
+        p_dest[1] = __REV(p_source[1]);
+        p_dest[2] = __REV(p_source[2]);
+        p_dest[3] = __REV(p_source[3]);
+    }
+    else
+    {
+        p_dest[0] = p_source[0];
+        p_dest[1] = p_source[1];
+        p_dest[2] = p_source[2];
+        p_dest[3] = p_source[3];
+    }
+}
+
+/* Polled data phase. The next input block is converted while the current one is being processed. */
+static void hw_sc324_aes_kernel_data_process_polled (const uint32_t * p_in, uint32_t * p_out, uint32_t num_words)
+{
+    crypto_word_endian_t flag = HW_SCE_WORD_ENDIAN;
+    uint32_t             in_block[SIZE_AES_BLOCK_WORDS];
+    uint32_t             out_block[SIZE_AES_BLOCK_WORDS];
+
+    hw_sc324_aes_block_convert(in_block, p_in, flag);
+
+    for (uint32_t indx = 0; indx < num_words; indx += SIZE_AES_BLOCK_WORDS)
+    {
+        // 5. Write data to data-register (one block (128 bits) of data).
+        // When writing to data-register, write 1 word (32 bits) to AESDW after confirmation of write_ready=1
+        // When you write to the data-register, you write the whole 4 words of data.
+        hw_sc324_aes_kernel_data_write(in_block);
+
+        // The input block is in the data-register, so the next one can be prepared while this one is processed.
+        // It is read before the output of this block is stored, which also allows p_out to be the same as p_in.
+        if ((indx + SIZE_AES_BLOCK_WORDS) < num_words)
+        {
+            hw_sc324_aes_block_convert(in_block, p_in + indx + SIZE_AES_BLOCK_WORDS, flag);
+        }
+
+        // 6. When encrypt (decrypt) is completed, read_ready will be 1. The read_request will be asserted
+        // and you will be able to read the data on which encrypt (decrypt) was done. Please read
+        // 1 word (32 bits) from AESDW.
+        hw_sc324_aes_kernel_data_read(out_block);
+        hw_sc324_aes_block_convert(p_out + indx, out_block, flag);
+
+        // 7. When encrypt (decrypt) is completed, write_ready will be 1. The write_request will be
+        // asserted. When continuing encrypting (decrypting), write 1 block of data (128 bits) to
+        // data-register.
+    }
+}
+
+/* DTC data phase. The first block is written by the CPU and each write_request then moves the next input block into
+ * the data-register, while each read_request moves one output block out. */
+static fsp_err_t hw_sc324_aes_kernel_data_process_dtc (const uint32_t * p_in, uint32_t * p_out, uint32_t num_words)
+{
+    hw_sc324_aes_bulk_ctrl_t  * p_bulk     = &g_hw_sc324_aes_bulk_ctrl;
+    transfer_instance_t const * p_write    = p_bulk->p_cfg->p_transfer_write;
+    transfer_instance_t const * p_read     = p_bulk->p_cfg->p_transfer_read;
+    uint32_t                    num_blocks = num_words / SIZE_AES_BLOCK_WORDS;
+    bool                        convert    = (CRYPTO_WORD_ENDIAN_LITTLE == HW_SCE_WORD_ENDIAN);
+
+    // The DTC moves words unchanged, so little endian words are converted in the output buffer and written from there.
+    // The write transfer always stays ahead of the read transfer, so the buffer can be used for both.
+    const uint32_t * p_src = convert ? p_out : p_in;
+
+    p_bulk->read_info.transfer_settings_word = 0U;
+    p_bulk->read_info.mode                   = TRANSFER_MODE_BLOCK;
+    p_bulk->read_info.size                   = TRANSFER_SIZE_4_BYTE;
+    p_bulk->read_info.src_addr_mode          = TRANSFER_ADDR_MODE_FIXED;
+    p_bulk->read_info.dest_addr_mode         = TRANSFER_ADDR_MODE_INCREMENTED;
+    p_bulk->read_info.repeat_area            = TRANSFER_REPEAT_AREA_SOURCE;
+    p_bulk->read_info.irq                    = TRANSFER_IRQ_END;
+    p_bulk->read_info.chain_mode             = TRANSFER_CHAIN_MODE_DISABLED;
+    p_bulk->read_info.p_src                  = (void const *) &SCE1_AES->AESDW;
+    p_bulk->read_info.p_dest                 = p_out;
+    p_bulk->read_info.num_blocks             = (uint16_t) num_blocks;
+    p_bulk->read_info.length                 = SIZE_AES_BLOCK_WORDS;
+
+    fsp_err_t err = p_read->p_api->reconfigure(p_read->p_ctrl, &p_bulk->read_info);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+    p_bulk->write_info.transfer_settings_word = 0U;
+    p_bulk->write_info.mode                   = TRANSFER_MODE_BLOCK;
+    p_bulk->write_info.size                   = TRANSFER_SIZE_4_BYTE;
+    p_bulk->write_info.src_addr_mode          = TRANSFER_ADDR_MODE_INCREMENTED;
+    p_bulk->write_info.dest_addr_mode         = TRANSFER_ADDR_MODE_FIXED;
+    p_bulk->write_info.repeat_area            = TRANSFER_REPEAT_AREA_DESTINATION;
+    p_bulk->write_info.irq                    = TRANSFER_IRQ_END;
+    p_bulk->write_info.chain_mode             = TRANSFER_CHAIN_MODE_DISABLED;
+    p_bulk->write_info.p_src                  = p_src + SIZE_AES_BLOCK_WORDS;
+    p_bulk->write_info.p_dest                 = (void *) &SCE1_AES->AESDW;
+    p_bulk->write_info.num_blocks             = (uint16_t) (num_blocks - 1U);
+    p_bulk->write_info.length                 = SIZE_AES_BLOCK_WORDS;
+
+    err = p_write->p_api->reconfigure(p_write->p_ctrl, &p_bulk->write_info);
+    if (FSP_SUCCESS != err)
+    {
+        p_read->p_api->disable(p_read->p_ctrl);
+
+        return err;
+    }
+
+    // The input is only modified once the transfers are set up, so a request can still fall back to polling above.
+    if (convert)
+    {
+        for (uint32_t i = 0U; i < num_words; i++)
+        {
+            p_out[i] = __REV(p_in[i]);
+        }
+    }
+
+    SCE1_AES->AESMOD_b.read_req_en  = 1;
+    SCE1_AES->AESMOD_b.write_req_en = 1;
+
+    hw_sc324_aes_kernel_data_write(p_src);
+
+    // The last read transfer requests the CPU interrupt, which is left disabled in the NVIC.
+    while (0U == R_ICU->IELSR_b[p_bulk->read_irq].IR)
+    {
+        ;
+    }
+
+    SCE1_AES->AESMOD_b.write_req_en = 0;
+    SCE1_AES->AESMOD_b.read_req_en  = 0;
+
+    R_BSP_IrqStatusClear(p_bulk->write_irq);
+    R_BSP_IrqStatusClear(p_bulk->read_irq);
+
+    if (convert)
+    {
+        for (uint32_t i = 0U; i < num_words; i++)
+        {
+            p_out[i] = __REV(p_out[i]);
+        }
+    }
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Opens the DTC transfers of the bulk AES mode. Later AES requests of at least HW_SC324_AES_BULK_MIN_BLOCKS blocks move
+ * their data with the DTC, and the CPU only waits for the last output block.
+ *
+ * @param[in]  p_cfg                        DTC transfers to use.
+ *
+ * @retval FSP_SUCCESS                      The bulk mode is enabled.
+ * @retval FSP_ERR_ASSERTION                A transfer instance is missing.
+ * @retval FSP_ERR_ALREADY_OPEN             The bulk mode is already enabled.
+ * @return See @ref RENESAS_ERROR_CODES or functions called by this function for other possible return codes.
+ *         This function calls:
+ *             * @ref transfer_api_t::open
+ **********************************************************************************************************************/
+fsp_err_t HW_SCE_AES_BulkOpen (hw_sc324_aes_bulk_cfg_t const * const p_cfg)
+{
+    hw_sc324_aes_bulk_ctrl_t * p_bulk = &g_hw_sc324_aes_bulk_ctrl;
+
+    FSP_ERROR_RETURN(NULL != p_cfg, FSP_ERR_ASSERTION);
+    FSP_ERROR_RETURN(NULL != p_cfg->p_transfer_write, FSP_ERR_ASSERTION);
+    FSP_ERROR_RETURN(NULL != p_cfg->p_transfer_read, FSP_ERR_ASSERTION);
+    FSP_ERROR_RETURN(false == p_bulk->open, FSP_ERR_ALREADY_OPEN);
+
+    transfer_instance_t const * p_write = p_cfg->p_transfer_write;
+    transfer_instance_t const * p_read  = p_cfg->p_transfer_read;
+
+    fsp_err_t err = p_write->p_api->open(p_write->p_ctrl, p_write->p_cfg);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+    err = p_read->p_api->open(p_read->p_ctrl, p_read->p_cfg);
+    if (FSP_SUCCESS != err)
+    {
+        p_write->p_api->close(p_write->p_ctrl);
+
+        return err;
+    }
+
+    p_bulk->write_irq = ((dtc_extended_cfg_t const *) p_write->p_cfg->p_extend)->activation_source;
+    p_bulk->read_irq  = ((dtc_extended_cfg_t const *) p_read->p_cfg->p_extend)->activation_source;
+    p_bulk->p_cfg     = p_cfg;
+    p_bulk->open      = true;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Closes the DTC transfers of the bulk AES mode. Later AES requests are polled.
+ *
+ * @retval FSP_SUCCESS                      The bulk mode is disabled.
+ * @retval FSP_ERR_NOT_OPEN                 The bulk mode is not enabled.
+ **********************************************************************************************************************/
+fsp_err_t HW_SCE_AES_BulkClose (void)
+{
+    hw_sc324_aes_bulk_ctrl_t * p_bulk = &g_hw_sc324_aes_bulk_ctrl;
+
+    FSP_ERROR_RETURN(p_bulk->open, FSP_ERR_NOT_OPEN);
+
+    p_bulk->p_cfg->p_transfer_write->p_api->close(p_bulk->p_cfg->p_transfer_write->p_ctrl);
+    p_bulk->p_cfg->p_transfer_read->p_api->close(p_bulk->p_cfg->p_transfer_read->p_ctrl);
+    p_bulk->open = false;
+
+    return FSP_SUCCESS;
 }
 
 /*******************************************************************************************************************//**
@@ -239,26 +451,20 @@ fsp_err_t hw_sc324_aes_kernel_process_data (hw_sc324_aes_ctrl_t * p_ctrl,
     // When writing to the AESCMD, check if the AESCMD.com_write_ready is 1
     hw_sc324_aes_kernel_inverse_cipher_set(p_ctrl->encrypt_flag);
 
-    for (uint32_t indx = 0; indx < num_words; indx += SIZE_AES_BLOCK_WORDS)
+    // 5. - 7. Write the input blocks to the data-register and read the output blocks, by DTC when the bulk mode is
+    // enabled and the request is long enough to benefit from it.
+    fsp_err_t err        = FSP_ERR_UNSUPPORTED;
+    uint32_t  num_blocks = num_words / SIZE_AES_BLOCK_WORDS;
+    if (g_hw_sc324_aes_bulk_ctrl.open && (num_blocks >= HW_SC324_AES_BULK_MIN_BLOCKS) &&
+        (num_blocks <= HW_SC324_AES_BULK_MAX_BLOCKS))
     {
-        // 5. Write data to data-register (one block (128 bits) of data).
-        // When writing to data-register, write 1 word (32 bits) to AESDW after confirmation of write_ready=1
-        // When you write to the data-register, you write the whole 4 words of data.
-        hw_sc324_aes_kernel_data_write(InData_Text + indx);
-
-        // 6. When encrypt (decrypt) is completed, read_ready will be 1. The read_request will be asserted
-        // and you will be able to read the data on which encrypt (decrypt) was done. Please read
-        // 1 word (32 bits) from AESDW.
-        // When reading iv_data, read 1 word (32 bits) from AESIVW after confirmation of iv_read_ready=1
-        // When you read the iv-window, you must read the whole 4 words of data.
-        hw_sc324_aes_kernel_data_read(OutData_Text + indx);
+        err = hw_sc324_aes_kernel_data_process_dtc(InData_Text, OutData_Text, num_words);
+    }
 
-        // 7. When encrypt (decrypt) is completed, write_ready will be 1. The write_request will be
-        // asserted. When continuing encrypting (decrypting), write 1 block of data (128 bits) to
-        // data-register.
-        // When you write to the data-window, you must write the whole 4 words of data.
-        // When writing to data-register, write 1 word (32 bits) to AESDW after confirmation of write_ready=1
-        continue;
+    // Nothing has been written to the data-register if the transfers could not be set up.
+    if (FSP_SUCCESS != err)
+    {
+        hw_sc324_aes_kernel_data_process_polled(InData_Text, OutData_Text, num_words);
     }
 
     if (OutData_IV)
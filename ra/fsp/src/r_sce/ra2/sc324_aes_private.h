@@ -23,11 +23,18 @@
 
 #include <stdint.h>
 #include "bsp_api.h"
+#include "r_transfer_api.h"
 
 #define SIZE_AES_BLOCK_BITS  (128)
 #define SIZE_AES_BLOCK_BYTES ((SIZE_AES_BLOCK_BITS) / 8)
 #define SIZE_AES_BLOCK_WORDS ((SIZE_AES_BLOCK_BITS) / 32)
 
+/* Smallest request moved by DTC in bulk mode. Shorter requests cost less to poll than to set up the transfers for. */
+#define HW_SC324_AES_BULK_MIN_BLOCKS    (4U)
+
+/* Largest request moved by DTC in bulk mode, limited by the DTC block count. Longer requests are polled. */
+#define HW_SC324_AES_BULK_MAX_BLOCKS    (0xFFFFU)
+
 typedef enum e_hw_sc324_aes_modes
 {
     SC324_AES_ECB = 0,
@@ -60,6 +67,14 @@ typedef struct st_hw_sc324_aes_ctrl
     hw_sc324_aes_encrypt_flag_t encrypt_flag;
 } hw_sc324_aes_ctrl_t;
 
+/* DTC transfers used by the bulk AES mode. The write transfer must be activated by ELC_EVENT_AES_WRREQ and the read
+ * transfer by ELC_EVENT_AES_RDREQ. Neither interrupt needs to be enabled in the NVIC. */
+typedef struct st_hw_sc324_aes_bulk_cfg
+{
+    transfer_instance_t const * p_transfer_write;
+    transfer_instance_t const * p_transfer_read;
+} hw_sc324_aes_bulk_cfg_t;
+
 fsp_err_t hw_sc324_aes_kernel_process_data(hw_sc324_aes_ctrl_t * p_ctrl,
                                            const uint32_t      * InData_Key,
                                            const uint32_t      * InData_IV,
@@ -68,4 +83,9 @@ fsp_err_t hw_sc324_aes_kernel_process_data(hw_sc324_aes_ctrl_t * p_ctrl,
                                            uint32_t            * OutData_Text,
                                            uint32_t            * OutData_IV);
 
+/* Bulk AES (SC324 only). Once opened, requests of at least HW_SC324_AES_BULK_MIN_BLOCKS blocks move their input and
+ * output blocks between memory and the AES data window by DTC instead of CPU polling. */
+fsp_err_t HW_SCE_AES_BulkOpen(hw_sc324_aes_bulk_cfg_t const * const p_cfg);
+fsp_err_t HW_SCE_AES_BulkClose(void);
+
 #endif                                 /* SC324_AES_PRIVATE_H */
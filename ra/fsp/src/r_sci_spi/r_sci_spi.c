@@ -39,6 +39,25 @@
                                                  (TRANSFER_ADDR_MODE_INCREMENTED << 26U) | (TRANSFER_IRQ_END << 21U) | \
                                                  (TRANSFER_ADDR_MODE_FIXED << 18U))
 
+/* Single byte register writes run by the frame stream. Repeat mode reloads the transfer for every activation. */
+#define SCI_SPI_PRV_DTC_STREAM_REG_SETTINGS     ((TRANSFER_MODE_REPEAT << 30U) | (TRANSFER_SIZE_1_BYTE << 28U) | \
+                                                 (TRANSFER_ADDR_MODE_FIXED << 26U) | (TRANSFER_IRQ_END << 21U) | \
+                                                 (TRANSFER_REPEAT_AREA_SOURCE << 20U) |                        \
+                                                 (TRANSFER_ADDR_MODE_FIXED << 18U))
+
+#define SCI_SPI_PRV_DTC_STREAM_TX_SETTINGS      ((TRANSFER_MODE_REPEAT << 30U) | (TRANSFER_SIZE_1_BYTE << 28U) |       \
+                                                 (TRANSFER_ADDR_MODE_INCREMENTED << 26U) | (TRANSFER_IRQ_END << 21U) | \
+                                                 (TRANSFER_REPEAT_AREA_SOURCE << 20U) |                              \
+                                                 (TRANSFER_ADDR_MODE_FIXED << 18U))
+
+#define SCI_SPI_PRV_DTC_STREAM_RX_SETTINGS      ((TRANSFER_MODE_REPEAT << 30U) | (TRANSFER_SIZE_1_BYTE << 28U) | \
+                                                 (TRANSFER_ADDR_MODE_FIXED << 26U) | (TRANSFER_IRQ_END << 21U) | \
+                                                 (TRANSFER_REPEAT_AREA_DESTINATION << 20U) |                   \
+                                                 (TRANSFER_ADDR_MODE_INCREMENTED << 18U))
+
+/* Transfers per repeat is limited by the DTC repeat counter. */
+#define SCI_SPI_PRV_DTC_MAX_REPEAT_TRANSFER     (0x100U)
+
 #define SCI_SPI_PRV_CLK_MIN_DIV                 (4U)
 #define SCI_SPI_PRV_CLK_MAX_DIV                 ((UINT16_MAX + 1U) * 2U)
 
@@ -97,6 +116,12 @@ static void r_sci_spi_start_transfer(sci_spi_instance_ctrl_t * const p_ctrl);
 static void r_sci_spi_transmit(sci_spi_instance_ctrl_t * p_ctrl);
 static void r_sci_spi_call_callback(sci_spi_instance_ctrl_t * p_ctrl, spi_event_t event);
 
+#if SCI_SPI_DTC_SUPPORT_ENABLE == 1
+static uint32_t  r_sci_spi_frame_stream_head_get(sci_spi_instance_ctrl_t * const p_ctrl);
+static fsp_err_t r_sci_spi_frame_stream_release(sci_spi_instance_ctrl_t * const p_ctrl);
+
+#endif
+
 void sci_spi_txi_isr(void);
 void sci_spi_rxi_isr(void);
 void sci_spi_tei_isr(void);
@@ -153,6 +178,9 @@ fsp_err_t R_SCI_SPI_Open (spi_ctrl_t * p_api_ctrl, spi_cfg_t const * const p_cfg
     p_ctrl->p_context         = p_cfg->p_context;
     p_ctrl->p_callback_memory = NULL;
 
+    p_ctrl->p_stream    = NULL;
+    p_ctrl->stream_tail = 0U;
+
 #if SCI_SPI_DTC_SUPPORT_ENABLE == 1
 
     /* Open the SCI SPI transfer interface if available. */
@@ -169,6 +197,8 @@ fsp_err_t R_SCI_SPI_Open (spi_ctrl_t * p_api_ctrl, spi_cfg_t const * const p_cfg
     R_BSP_IrqCfgEnable(p_cfg->tei_irq, p_cfg->tei_ipl, p_ctrl);
     R_BSP_IrqCfgEnable(p_cfg->eri_irq, p_cfg->eri_ipl, p_ctrl);
 
+    BSP_TRACE(FSP_IP_SCI, p_cfg->channel, BSP_TRACE_EVENT_OPEN, 0U);
+
     p_ctrl->open = SCI_SPI_OPEN;
 
     return err;
@@ -386,6 +416,258 @@ fsp_err_t R_SCI_SPI_CallbackSet (spi_ctrl_t * const          p_api_ctrl,
     return FSP_SUCCESS;
 }
 
+/*******************************************************************************************************************//**
+ * Starts a periodic stream of fixed-length full-duplex frames. Each activation of p_transfer_trigger, typically by a
+ * GPT overflow, sends p_tx_frame and the received bytes are stored in consecutive frames of p_ring. The trigger, TXI
+ * and RXI transfers are chained so that no CPU interrupt is raised for a frame. Use R_SCI_SPI_FrameStreamInfoGet to
+ * find new frames and R_SCI_SPI_FrameStreamConsume to release them.
+ *
+ * The SCI has no slave select output in master mode. Drive slave select from a GPT output compare on the timer that
+ * triggers the stream, so that it is asserted ahead of the trigger event and deasserted after the frame time.
+ *
+ * @retval     FSP_SUCCESS          Frame stream started.
+ * @retval     FSP_ERR_ASSERTION    One of the following invalid parameters passed:
+ *                                  - Pointer p_api_ctrl, p_stream, the trigger transfer instance or p_ring is NULL
+ *                                  - The instance is not a master or has no tx and rx transfer instances
+ *                                  - Frames are shorter than 2 bytes or the ring is larger than the repeat limit
+ * @retval     FSP_ERR_NOT_OPEN     The channel has not been opened. Open the channel first.
+ * @retval     FSP_ERR_IN_USE       A transfer or frame stream is already in progress.
+ * @retval     FSP_ERR_UNSUPPORTED  SCI_SPI_DTC_SUPPORT_ENABLE is set to 0.
+ *
+ * @return     See @ref RENESAS_ERROR_CODES or functions called by this function for other possible return codes. This
+ *             function calls:
+ *               - @ref transfer_api_t::reconfigure
+ *
+ * @note The transfer instances must be DTC instances, which chain in hardware.
+ * @note The ring is limited to 256 bytes, the DTC repeat counter limit.
+ * @note The application must consume frames before the ring wraps around to unread data. Overwritten frames are not
+ *       detected. A receive overflow stops the stream and is reported with SPI_EVENT_ERR_READ_OVERFLOW.
+ **********************************************************************************************************************/
+fsp_err_t R_SCI_SPI_FrameStreamStart (spi_ctrl_t * const p_api_ctrl, sci_spi_frame_stream_cfg_t const * const p_stream)
+{
+#if SCI_SPI_DTC_SUPPORT_ENABLE == 1
+    sci_spi_instance_ctrl_t * p_ctrl = (sci_spi_instance_ctrl_t *) p_api_ctrl;
+    fsp_err_t                 err    = FSP_SUCCESS;
+
+ #if SCI_SPI_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ERROR_RETURN(SCI_SPI_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+    FSP_ASSERT(NULL != p_stream);
+    FSP_ASSERT(NULL != p_stream->p_transfer_trigger);
+    FSP_ASSERT(NULL != p_stream->p_ring);
+    FSP_ASSERT(2U <= p_stream->frame_bytes);
+    FSP_ASSERT(0U < p_stream->num_frames);
+    FSP_ASSERT((p_stream->frame_bytes * p_stream->num_frames) <= SCI_SPI_PRV_DTC_MAX_REPEAT_TRANSFER);
+    FSP_ASSERT(SPI_MODE_MASTER == p_ctrl->p_cfg->operating_mode);
+    FSP_ASSERT(NULL != p_ctrl->p_cfg->p_transfer_tx);
+    FSP_ASSERT(NULL != p_ctrl->p_cfg->p_transfer_rx);
+ #endif
+
+    FSP_ERROR_RETURN(NULL == p_ctrl->p_stream, FSP_ERR_IN_USE);
+    FSP_ERROR_RETURN(0 == (p_ctrl->p_reg->SCR & (R_SCI0_SCR_RE_Msk | R_SCI0_SCR_TE_Msk)), FSP_ERR_IN_USE);
+
+    /* Dummy data sent if there is no tx frame. */
+    static uint8_t const tx_dummy = 0U;
+
+    uint8_t const * p_tx_frame = (NULL == p_stream->p_tx_frame) ? &tx_dummy : p_stream->p_tx_frame;
+
+    /* TE and RE stay set for the whole stream. The clock only runs while there is data in TDR, so the TXI is enabled
+     * at the start of a frame and disabled after the last byte of the frame is written. */
+    uint8_t scr = (uint8_t) (p_ctrl->p_reg->SCR & R_SCI0_SCR_CKE_Msk);
+    p_ctrl->stream_scr_idle = (uint8_t) (scr | R_SCI0_SCR_TE_Msk | R_SCI0_SCR_RE_Msk | R_SCI0_SCR_RIE_Msk);
+    p_ctrl->stream_scr_run  = (uint8_t) (p_ctrl->stream_scr_idle | R_SCI0_SCR_TIE_Msk);
+
+    /* Trigger event: enable the TXI, then write the first byte, which starts the frame. */
+    p_ctrl->stream_trigger[0].transfer_settings_word = SCI_SPI_PRV_DTC_STREAM_REG_SETTINGS;
+    p_ctrl->stream_trigger[0].chain_mode             = TRANSFER_CHAIN_MODE_EACH;
+    p_ctrl->stream_trigger[0].p_src                  = &p_ctrl->stream_scr_run;
+    p_ctrl->stream_trigger[0].p_dest                 = (void *) &p_ctrl->p_reg->SCR;
+    p_ctrl->stream_trigger[0].num_blocks             = 0U;
+    p_ctrl->stream_trigger[0].length                 = 1U;
+
+    p_ctrl->stream_trigger[1].transfer_settings_word = SCI_SPI_PRV_DTC_STREAM_REG_SETTINGS;
+    p_ctrl->stream_trigger[1].p_src                  = p_tx_frame;
+    p_ctrl->stream_trigger[1].p_dest                 = (void *) &p_ctrl->p_reg->TDR;
+    p_ctrl->stream_trigger[1].num_blocks             = 0U;
+    p_ctrl->stream_trigger[1].length                 = 1U;
+
+    /* TXI: write the rest of the frame. The end of each repeat disables the TXI until the next trigger event. */
+    p_ctrl->stream_tx[0].transfer_settings_word = SCI_SPI_PRV_DTC_STREAM_TX_SETTINGS;
+    p_ctrl->stream_tx[0].chain_mode             = TRANSFER_CHAIN_MODE_END;
+    p_ctrl->stream_tx[0].p_src                  = (NULL == p_stream->p_tx_frame) ? &tx_dummy : &p_tx_frame[1];
+    p_ctrl->stream_tx[0].p_dest                 = (void *) &p_ctrl->p_reg->TDR;
+    p_ctrl->stream_tx[0].num_blocks             = 0U;
+    p_ctrl->stream_tx[0].length                 = (uint16_t) (p_stream->frame_bytes - 1U);
+
+    if (NULL == p_stream->p_tx_frame)
+    {
+        p_ctrl->stream_tx[0].src_addr_mode = TRANSFER_ADDR_MODE_FIXED;
+    }
+
+    p_ctrl->stream_tx[1].transfer_settings_word = SCI_SPI_PRV_DTC_STREAM_REG_SETTINGS;
+    p_ctrl->stream_tx[1].p_src                  = &p_ctrl->stream_scr_idle;
+    p_ctrl->stream_tx[1].p_dest                 = (void *) &p_ctrl->p_reg->SCR;
+    p_ctrl->stream_tx[1].num_blocks             = 0U;
+    p_ctrl->stream_tx[1].length                 = 1U;
+
+    /* RXI: fill the ring continuously. */
+    p_ctrl->stream_rx.transfer_settings_word = SCI_SPI_PRV_DTC_STREAM_RX_SETTINGS;
+    p_ctrl->stream_rx.p_src                  = (void *) &p_ctrl->p_reg->RDR;
+    p_ctrl->stream_rx.p_dest                 = p_stream->p_ring;
+    p_ctrl->stream_rx.num_blocks             = 0U;
+    p_ctrl->stream_rx.length                 = (uint16_t) (p_stream->frame_bytes * p_stream->num_frames);
+
+    BSP_TRACE(FSP_IP_SCI, p_ctrl->p_cfg->channel, BSP_TRACE_EVENT_START, p_stream->num_frames);
+
+    p_ctrl->p_stream    = p_stream;
+    p_ctrl->stream_tail = 0U;
+
+    transfer_instance_t const * p_transfer_rx = p_ctrl->p_cfg->p_transfer_rx;
+    transfer_instance_t const * p_transfer_tx = p_ctrl->p_cfg->p_transfer_tx;
+    err = p_transfer_rx->p_api->reconfigure(p_transfer_rx->p_ctrl, &p_ctrl->stream_rx);
+
+    if (FSP_SUCCESS == err)
+    {
+        err = p_transfer_tx->p_api->reconfigure(p_transfer_tx->p_ctrl, &p_ctrl->stream_tx[0]);
+    }
+
+    if (FSP_SUCCESS == err)
+    {
+        /* Enable transmit and receive mode. TE and RE must be set at the same time. */
+        p_ctrl->p_reg->SCR = p_ctrl->stream_scr_idle;
+
+        err = p_stream->p_transfer_trigger->p_api->reconfigure(p_stream->p_transfer_trigger->p_ctrl,
+                                                              &p_ctrl->stream_trigger[0]);
+    }
+
+    if (FSP_SUCCESS != err)
+    {
+        (void) r_sci_spi_frame_stream_release(p_ctrl);
+    }
+
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+    return FSP_SUCCESS;
+#else
+    FSP_PARAMETER_NOT_USED(p_api_ctrl);
+    FSP_PARAMETER_NOT_USED(p_stream);
+
+    return FSP_ERR_UNSUPPORTED;
+#endif
+}
+
+/*******************************************************************************************************************//**
+ * Gets the write and read offsets of the frame stream ring.
+ *
+ * @retval     FSP_SUCCESS          Ring status stored in p_info.
+ * @retval     FSP_ERR_ASSERTION    Pointer p_api_ctrl or p_info is NULL.
+ * @retval     FSP_ERR_NOT_OPEN     The channel has not been opened. Open the channel first.
+ * @retval     FSP_ERR_NOT_ENABLED  No frame stream is active.
+ * @retval     FSP_ERR_UNSUPPORTED  SCI_SPI_DTC_SUPPORT_ENABLE is set to 0.
+ **********************************************************************************************************************/
+fsp_err_t R_SCI_SPI_FrameStreamInfoGet (spi_ctrl_t * const p_api_ctrl, sci_spi_frame_stream_info_t * const p_info)
+{
+#if SCI_SPI_DTC_SUPPORT_ENABLE == 1
+    sci_spi_instance_ctrl_t * p_ctrl = (sci_spi_instance_ctrl_t *) p_api_ctrl;
+
+ #if SCI_SPI_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ASSERT(NULL != p_info);
+    FSP_ERROR_RETURN(SCI_SPI_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+    FSP_ERROR_RETURN(NULL != p_ctrl->p_stream, FSP_ERR_NOT_ENABLED);
+ #endif
+
+    uint32_t ring_bytes = p_ctrl->p_stream->frame_bytes * p_ctrl->p_stream->num_frames;
+    uint32_t head       = r_sci_spi_frame_stream_head_get(p_ctrl);
+
+    p_info->head             = head;
+    p_info->tail             = p_ctrl->stream_tail;
+    p_info->frames_available = ((head + ring_bytes - p_ctrl->stream_tail) % ring_bytes) / p_ctrl->p_stream->frame_bytes;
+
+    return FSP_SUCCESS;
+#else
+    FSP_PARAMETER_NOT_USED(p_api_ctrl);
+    FSP_PARAMETER_NOT_USED(p_info);
+
+    return FSP_ERR_UNSUPPORTED;
+#endif
+}
+
+/*******************************************************************************************************************//**
+ * Releases frames that the application has read from the frame stream ring.
+ *
+ * @retval     FSP_SUCCESS          Read offset advanced.
+ * @retval     FSP_ERR_ASSERTION    Pointer p_api_ctrl is NULL or frames is larger than the number of unread frames.
+ * @retval     FSP_ERR_NOT_OPEN     The channel has not been opened. Open the channel first.
+ * @retval     FSP_ERR_NOT_ENABLED  No frame stream is active.
+ * @retval     FSP_ERR_UNSUPPORTED  SCI_SPI_DTC_SUPPORT_ENABLE is set to 0.
+ **********************************************************************************************************************/
+fsp_err_t R_SCI_SPI_FrameStreamConsume (spi_ctrl_t * const p_api_ctrl, uint32_t const frames)
+{
+#if SCI_SPI_DTC_SUPPORT_ENABLE == 1
+    sci_spi_instance_ctrl_t * p_ctrl = (sci_spi_instance_ctrl_t *) p_api_ctrl;
+
+ #if SCI_SPI_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ERROR_RETURN(SCI_SPI_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+    FSP_ERROR_RETURN(NULL != p_ctrl->p_stream, FSP_ERR_NOT_ENABLED);
+ #endif
+
+    uint32_t ring_bytes = p_ctrl->p_stream->frame_bytes * p_ctrl->p_stream->num_frames;
+
+ #if SCI_SPI_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(frames <=
+               (((r_sci_spi_frame_stream_head_get(p_ctrl) + ring_bytes - p_ctrl->stream_tail) % ring_bytes) /
+                p_ctrl->p_stream->frame_bytes));
+ #endif
+
+    p_ctrl->stream_tail = (p_ctrl->stream_tail + (frames * p_ctrl->p_stream->frame_bytes)) % ring_bytes;
+
+    return FSP_SUCCESS;
+#else
+    FSP_PARAMETER_NOT_USED(p_api_ctrl);
+    FSP_PARAMETER_NOT_USED(frames);
+
+    return FSP_ERR_UNSUPPORTED;
+#endif
+}
+
+/*******************************************************************************************************************//**
+ * Stops the frame stream. The trigger transfer instance is disabled and the tx and rx transfer instances are restored
+ * for use by R_SCI_SPI_Read, R_SCI_SPI_Write and R_SCI_SPI_WriteRead. A frame in progress is cut short.
+ *
+ * @retval     FSP_SUCCESS          Frame stream stopped.
+ * @retval     FSP_ERR_ASSERTION    Pointer p_api_ctrl is NULL.
+ * @retval     FSP_ERR_NOT_OPEN     The channel has not been opened. Open the channel first.
+ * @retval     FSP_ERR_NOT_ENABLED  No frame stream is active.
+ * @retval     FSP_ERR_UNSUPPORTED  SCI_SPI_DTC_SUPPORT_ENABLE is set to 0.
+ *
+ * @return     See @ref RENESAS_ERROR_CODES or functions called by this function for other possible return codes. This
+ *             function calls:
+ *               - @ref transfer_api_t::disable
+ *               - @ref transfer_api_t::reconfigure
+ **********************************************************************************************************************/
+fsp_err_t R_SCI_SPI_FrameStreamStop (spi_ctrl_t * const p_api_ctrl)
+{
+#if SCI_SPI_DTC_SUPPORT_ENABLE == 1
+    sci_spi_instance_ctrl_t * p_ctrl = (sci_spi_instance_ctrl_t *) p_api_ctrl;
+
+ #if SCI_SPI_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ERROR_RETURN(SCI_SPI_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+    FSP_ERROR_RETURN(NULL != p_ctrl->p_stream, FSP_ERR_NOT_ENABLED);
+ #endif
+
+    BSP_TRACE(FSP_IP_SCI, p_ctrl->p_cfg->channel, BSP_TRACE_EVENT_STOP, 0U);
+
+    return r_sci_spi_frame_stream_release(p_ctrl);
+#else
+    FSP_PARAMETER_NOT_USED(p_api_ctrl);
+
+    return FSP_ERR_UNSUPPORTED;
+#endif
+}
+
 /*******************************************************************************************************************//**
  * Disable the SCI channel and set the instance as not open. Implements @ref spi_api_t::close.
  *
@@ -404,6 +686,17 @@ fsp_err_t R_SCI_SPI_Close (spi_ctrl_t * const p_api_ctrl)
     FSP_ERROR_RETURN(SCI_SPI_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
 #endif
 
+    BSP_TRACE(FSP_IP_SCI, p_ctrl->p_cfg->channel, BSP_TRACE_EVENT_CLOSE, 0U);
+
+#if SCI_SPI_DTC_SUPPORT_ENABLE == 1
+    if (NULL != p_ctrl->p_stream)
+    {
+        /* Stop the trigger events from restarting the SCI. */
+        p_ctrl->p_stream->p_transfer_trigger->p_api->disable(p_ctrl->p_stream->p_transfer_trigger->p_ctrl);
+        p_ctrl->p_stream = NULL;
+    }
+#endif
+
     /* Clear the RE and TE bits in SCR. */
     p_ctrl->p_reg->SCR = 0;
 
@@ -738,6 +1031,15 @@ static fsp_err_t r_sci_spi_write_read_common (sci_spi_instance_ctrl_t * const p_
      * progress. Reference section 34.2.11 Serial Control Register (SCR) in the RA6M3 manual R01UH0886EJ0100. */
     FSP_ERROR_RETURN(0 == (p_ctrl->p_reg->SCR & (R_SCI0_SCR_RE_Msk | R_SCI0_SCR_TE_Msk)), FSP_ERR_IN_USE);
 
+    /* The transfer instances are owned by the frame stream until it is stopped. */
+    FSP_ERROR_RETURN(NULL == p_ctrl->p_stream, FSP_ERR_IN_USE);
+
+    BSP_TRACE(FSP_IP_SCI,
+              p_ctrl->p_cfg->channel,
+              (NULL == p_dest) ? BSP_TRACE_EVENT_WRITE :
+              ((NULL == p_src) ? BSP_TRACE_EVENT_READ : BSP_TRACE_EVENT_WRITE_READ),
+              length);
+
     /* Setup the control block. */
     p_ctrl->count    = length;
     p_ctrl->tx_count = 0U;
@@ -861,6 +1163,77 @@ static void r_sci_spi_transmit (sci_spi_instance_ctrl_t * p_ctrl)
     }
 }
 
+#if SCI_SPI_DTC_SUPPORT_ENABLE == 1
+
+/*******************************************************************************************************************//**
+ * Gets the offset in the frame stream ring where the rx transfer instance will write the next byte.
+ *
+ * @param[in]  p_ctrl             Pointer to the control block.
+ *
+ * @return     Write offset in the ring.
+ **********************************************************************************************************************/
+static uint32_t r_sci_spi_frame_stream_head_get (sci_spi_instance_ctrl_t * const p_ctrl)
+{
+    transfer_properties_t       properties    = {0U};
+    transfer_instance_t const * p_transfer_rx = p_ctrl->p_cfg->p_transfer_rx;
+    uint32_t ring_bytes = p_ctrl->p_stream->frame_bytes * p_ctrl->p_stream->num_frames;
+
+    (void) p_transfer_rx->p_api->infoGet(p_transfer_rx->p_ctrl, &properties);
+
+    /* The remaining count reads 0 when a 256 byte ring has just wrapped. */
+    return (ring_bytes - properties.transfer_length_remaining) % ring_bytes;
+}
+
+/*******************************************************************************************************************//**
+ * Ends the frame stream and hands the tx and rx transfer instances back to the transfer functions.
+ *
+ * @param[in]  p_ctrl             Pointer to the control block.
+ *
+ * @retval     FSP_SUCCESS        Frame stream ended.
+ *
+ * @return     See @ref RENESAS_ERROR_CODES or functions called by this function for other possible return codes. This
+ *             function calls:
+ *               - @ref transfer_api_t::disable
+ *               - @ref transfer_api_t::reconfigure
+ **********************************************************************************************************************/
+static fsp_err_t r_sci_spi_frame_stream_release (sci_spi_instance_ctrl_t * const p_ctrl)
+{
+    transfer_instance_t const * p_transfer_trigger = p_ctrl->p_stream->p_transfer_trigger;
+    transfer_instance_t const * p_transfer_rx      = p_ctrl->p_cfg->p_transfer_rx;
+    transfer_instance_t const * p_transfer_tx      = p_ctrl->p_cfg->p_transfer_tx;
+
+    /* Stop the trigger events first so they cannot restart the SCI. */
+    fsp_err_t err = p_transfer_trigger->p_api->disable(p_transfer_trigger->p_ctrl);
+
+    /* Disables receiver, transmitter and interrupts. */
+    p_ctrl->p_reg->SCR &= (uint8_t) R_SCI0_SCR_CKE_Msk;
+
+    /* Point the activation sources back at the configured transfer information. Write and WriteRead reconfigure the
+     * tx transfer for every transfer, but Read and WriteRead only reset the rx transfer. */
+    fsp_err_t rx_err = p_transfer_rx->p_api->reconfigure(p_transfer_rx->p_ctrl, p_transfer_rx->p_cfg->p_info);
+    if (FSP_SUCCESS == rx_err)
+    {
+        rx_err = p_transfer_rx->p_api->disable(p_transfer_rx->p_ctrl);
+    }
+
+    fsp_err_t tx_err = p_transfer_tx->p_api->reconfigure(p_transfer_tx->p_ctrl, p_transfer_tx->p_cfg->p_info);
+    if (FSP_SUCCESS == tx_err)
+    {
+        tx_err = p_transfer_tx->p_api->disable(p_transfer_tx->p_ctrl);
+    }
+
+    p_ctrl->p_stream = NULL;
+
+    if (FSP_SUCCESS == err)
+    {
+        err = (FSP_SUCCESS != rx_err) ? rx_err : tx_err;
+    }
+
+    return err;
+}
+
+#endif
+
 /*******************************************************************************************************************//**
  * Calls user callback.
  *
@@ -871,6 +1244,8 @@ static void r_sci_spi_call_callback (sci_spi_instance_ctrl_t * p_ctrl, spi_event
 {
     spi_callback_args_t args;
 
+    BSP_TRACE(FSP_IP_SCI, p_ctrl->p_cfg->channel, event, 0U);
+
     /* Store callback arguments in memory provided by user if available.  This allows callback arguments to be
      * stored in non-secure memory so they can be accessed by a non-secure callback function. */
     spi_callback_args_t * p_args = p_ctrl->p_callback_memory;
@@ -1025,6 +1400,14 @@ void sci_spi_eri_isr (void)
     IRQn_Type                 irq    = R_FSP_CurrentIrqGet();
     sci_spi_instance_ctrl_t * p_ctrl = (sci_spi_instance_ctrl_t *) R_FSP_IsrContextGet(irq);
 
+#if SCI_SPI_DTC_SUPPORT_ENABLE == 1
+    if (NULL != p_ctrl->p_stream)
+    {
+        /* Stop the trigger events from restarting the SCI. The stream stays allocated until it is stopped. */
+        p_ctrl->p_stream->p_transfer_trigger->p_api->disable(p_ctrl->p_stream->p_transfer_trigger->p_ctrl);
+    }
+#endif
+
     /* Disables receiver, transmitter and transmit end IRQ. */
     p_ctrl->p_reg->SCR &= (uint8_t) R_SCI0_SCR_CKE_Msk;
 
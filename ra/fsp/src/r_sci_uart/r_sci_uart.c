@@ -25,6 +25,15 @@
 #include "r_sci_uart.h"
 #include <string.h>
 
+/* Set SCI_UART_CFG_RS485_DE_TIMER_SUPPORT to 1 to support a GPT driving the RS-485 driver enable signal. */
+#ifndef SCI_UART_CFG_RS485_DE_TIMER_SUPPORT
+ #define SCI_UART_CFG_RS485_DE_TIMER_SUPPORT    0
+#endif
+
+#if SCI_UART_CFG_RS485_DE_TIMER_SUPPORT
+ #include "r_gpt.h"
+#endif
+
 /***********************************************************************************************************************
  * Macro definitions
  **********************************************************************************************************************/
@@ -35,6 +44,23 @@
  #define SCI_UART_CFG_TX_ENABLE                 1
 #endif
 
+/* Set SCI_UART_CFG_RAMFUNC_ENABLE to 1 to execute the interrupt handlers and the functions they call from RAM. */
+#ifndef SCI_UART_CFG_RAMFUNC_ENABLE
+ #define SCI_UART_CFG_RAMFUNC_ENABLE            0
+#endif
+
+#if SCI_UART_CFG_RAMFUNC_ENABLE
+ #define SCI_UART_PRV_RAMFUNC                   BSP_PLACE_IN_RAM
+#else
+ #define SCI_UART_PRV_RAMFUNC
+#endif
+
+/** Nanoseconds per second, used to convert the RS-485 driver enable times. */
+#define SCI_UART_PRV_NS_PER_SECOND              (1000000000ULL)
+
+/** The one-shot period must leave room for the compare match at count 0 before the cycle end releases the pin. */
+#define SCI_UART_PRV_RS485_DE_MIN_COUNTS        (2U)
+
 /** Number of divisors in the data table used for baud rate calculation. */
 #define SCI_UART_NUM_DIVISORS_ASYNC             (13U)
 
@@ -102,6 +128,9 @@
 
 #define SCI_UART_DTC_MAX_TRANSFER               (0x10000U)
 
+/** Transfers per repeat is limited by the DTC repeat counter. This limit is also within the DMAC repeat limit. */
+#define SCI_UART_DTC_MAX_REPEAT_TRANSFER        (0x100U)
+
 #define SCI_UART_FCR_TRIGGER_MASK               (0xF)
 #define SCI_UART_FCR_RSTRG_OFFSET               (12)
 #define SCI_UART_FCR_RTRG_OFFSET                (8)
@@ -181,10 +210,16 @@ static fsp_err_t r_sci_uart_transfer_open(sci_uart_instance_ctrl_t * const p_ctr
 
 static void r_sci_uart_transfer_close(sci_uart_instance_ctrl_t * p_ctrl);
 
+ #if (SCI_UART_CFG_RX_ENABLE)
+static uint32_t r_sci_uart_ring_buffer_head_get(sci_uart_instance_ctrl_t * const p_ctrl);
+static void     r_sci_uart_ring_buffer_release(sci_uart_instance_ctrl_t * const p_ctrl);
+
+ #endif
 #endif
 
 static void r_sci_uart_baud_set(R_SCI0_Type * p_sci_reg, baud_setting_t const * const p_baud_setting);
-static void r_sci_uart_call_callback(sci_uart_instance_ctrl_t * p_ctrl, uint32_t data, uart_event_t event);
+static void r_sci_uart_call_callback(sci_uart_instance_ctrl_t * p_ctrl, uint32_t data,
+                                     uart_event_t event) SCI_UART_PRV_RAMFUNC;
 
 #if SCI_UART_CFG_FIFO_SUPPORT
 static void r_sci_uart_fifo_cfg(sci_uart_instance_ctrl_t * const p_ctrl);
@@ -195,25 +230,30 @@ static void r_sci_irq_cfg(sci_uart_instance_ctrl_t * const p_ctrl, uint8_t const
 
 static void r_sci_irqs_cfg(sci_uart_instance_ctrl_t * const p_ctrl, uart_cfg_t const * const p_cfg);
 
+#if SCI_UART_CFG_RS485_DE_TIMER_SUPPORT
+static fsp_err_t r_sci_uart_rs485_de_open(sci_uart_rs485_de_cfg_t const * const p_de);
+
+#endif
+
 #if (SCI_UART_CFG_TX_ENABLE)
-void r_sci_uart_write_no_transfer(sci_uart_instance_ctrl_t * const p_ctrl);
+void r_sci_uart_write_no_transfer(sci_uart_instance_ctrl_t * const p_ctrl) SCI_UART_PRV_RAMFUNC;
 
 #endif
 
 #if (SCI_UART_CFG_RX_ENABLE)
-void r_sci_uart_rxi_read_no_transfer(sci_uart_instance_ctrl_t * const p_ctrl);
+void r_sci_uart_rxi_read_no_transfer(sci_uart_instance_ctrl_t * const p_ctrl) SCI_UART_PRV_RAMFUNC;
 
-void sci_uart_rxi_isr(void);
+void sci_uart_rxi_isr(void) SCI_UART_PRV_RAMFUNC;
 
-void r_sci_uart_read_data(sci_uart_instance_ctrl_t * const p_ctrl, uint32_t * const p_data);
+void r_sci_uart_read_data(sci_uart_instance_ctrl_t * const p_ctrl, uint32_t * const p_data) SCI_UART_PRV_RAMFUNC;
 
-void sci_uart_eri_isr(void);
+void sci_uart_eri_isr(void) SCI_UART_PRV_RAMFUNC;
 
 #endif
 
 #if (SCI_UART_CFG_TX_ENABLE)
-void sci_uart_txi_isr(void);
-void sci_uart_tei_isr(void);
+void sci_uart_txi_isr(void) SCI_UART_PRV_RAMFUNC;
+void sci_uart_tei_isr(void) SCI_UART_PRV_RAMFUNC;
 
 #endif
 
@@ -328,6 +368,18 @@ fsp_err_t R_SCI_UART_Open (uart_ctrl_t * const p_api_ctrl, uart_cfg_t const * co
     FSP_ASSERT(p_cfg->txi_irq >= 0);
     FSP_ASSERT(p_cfg->tei_irq >= 0);
     FSP_ASSERT(p_cfg->eri_irq >= 0);
+
+    sci_uart_rs485_de_cfg_t const * p_de = ((sci_uart_extended_cfg_t *) p_cfg->p_extend)->p_rs485_de;
+ #if SCI_UART_CFG_RS485_DE_TIMER_SUPPORT
+    if (NULL != p_de)
+    {
+        FSP_ASSERT(p_de->p_timer);
+        FSP_ASSERT(UART_MODE_RS485_HD == ((sci_uart_extended_cfg_t *) p_cfg->p_extend)->uart_mode);
+    }
+
+ #else
+    FSP_ASSERT(NULL == p_de);
+ #endif
 #endif
 
     p_ctrl->p_reg = ((R_SCI0_Type *) (R_SCI0_BASE + (SCI_REG_SIZE * p_cfg->channel)));
@@ -394,6 +446,12 @@ fsp_err_t R_SCI_UART_Open (uart_ctrl_t * const p_api_ctrl, uart_cfg_t const * co
     p_ctrl->p_rx_dest     = NULL;
     p_ctrl->rx_dest_bytes = 0;
 
+    p_ctrl->p_rx_ring           = NULL;
+    p_ctrl->rx_ring_bytes       = 0U;
+    p_ctrl->rx_ring_tail        = 0U;
+    p_ctrl->rx_ring_head_last   = 0U;
+    p_ctrl->rx_transfer_restore = 0U;
+
     sci_uart_extended_cfg_t * p_extend = (sci_uart_extended_cfg_t *) p_cfg->p_extend;
 
     uint32_t scr = ((uint8_t) p_extend->clock) & 0x3U;
@@ -452,6 +510,16 @@ fsp_err_t R_SCI_UART_Open (uart_ctrl_t * const p_api_ctrl, uart_cfg_t const * co
     }
 #endif
 
+#if SCI_UART_CFG_RS485_DE_TIMER_SUPPORT
+    if (NULL != p_extend->p_rs485_de)
+    {
+        fsp_err_t de_err = r_sci_uart_rs485_de_open(p_extend->p_rs485_de);
+        FSP_ERROR_RETURN(FSP_SUCCESS == de_err, de_err);
+    }
+#endif
+
+    BSP_TRACE(FSP_IP_SCI, p_cfg->channel, BSP_TRACE_EVENT_OPEN, 0U);
+
     p_ctrl->open = SCI_UART_OPEN;
 
     return FSP_SUCCESS;
@@ -476,6 +544,8 @@ fsp_err_t R_SCI_UART_Close (uart_ctrl_t * const p_api_ctrl)
     /* Mark the channel not open so other APIs cannot use it. */
     p_ctrl->open = 0U;
 
+    BSP_TRACE(FSP_IP_SCI, p_ctrl->p_cfg->channel, BSP_TRACE_EVENT_CLOSE, 0U);
+
     /* Disable interrupts, receiver, and transmitter. Disable baud clock output.*/
     p_ctrl->p_reg->SCR = 0U;
 
@@ -492,6 +562,17 @@ fsp_err_t R_SCI_UART_Close (uart_ctrl_t * const p_api_ctrl)
     R_BSP_IrqDisable(p_ctrl->p_cfg->tei_irq);
 #endif
 
+#if SCI_UART_CFG_RS485_DE_TIMER_SUPPORT
+    sci_uart_rs485_de_cfg_t const * p_de = ((sci_uart_extended_cfg_t *) p_ctrl->p_cfg->p_extend)->p_rs485_de;
+    if (NULL != p_de)
+    {
+        /* Stop the TEI event from starting the driver enable pulse and release the driver enable signal. */
+        p_de->p_timer->p_api->disable(p_de->p_timer->p_ctrl);
+        p_de->p_timer->p_api->stop(p_de->p_timer->p_ctrl);
+        R_GPT_OutputLevelSet(p_de->p_timer->p_ctrl, GPT_IO_PIN_GTIOCA, GPT_PIN_LEVEL_LOW);
+    }
+#endif
+
 #if SCI_UART_CFG_DTC_SUPPORTED
 
     /* Close the lower level transfer instances. */
@@ -512,12 +593,14 @@ fsp_err_t R_SCI_UART_Close (uart_ctrl_t * const p_api_ctrl)
  *                                       Number of transfers outside the max or min boundary when transfer instance used
  * @retval  FSP_ERR_INVALID_ARGUMENT     Destination address or data size is not valid for 9-bit mode.
  * @retval  FSP_ERR_NOT_OPEN             The control block has not been opened
- * @retval  FSP_ERR_IN_USE               A previous read operation is still in progress.
+ * @retval  FSP_ERR_IN_USE               A previous read operation is still in progress or ring buffer mode is
+ *                                       active.
  * @retval  FSP_ERR_UNSUPPORTED          SCI_UART_CFG_RX_ENABLE is set to 0
  *
  * @return                       See @ref RENESAS_ERROR_CODES or functions called by this function for other possible
  *                               return codes. This function calls:
  *                                   * @ref transfer_api_t::reset
+ *                                   * @ref transfer_api_t::reconfigure
  *
  * @note If 9-bit data length is specified at R_SCI_UART_Open call, p_dest must be aligned 16-bit boundary.
  **********************************************************************************************************************/
@@ -531,6 +614,7 @@ fsp_err_t R_SCI_UART_Read (uart_ctrl_t * const p_api_ctrl, uint8_t * const p_des
     err = r_sci_read_write_param_check(p_ctrl, p_dest, bytes);
     FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
     FSP_ERROR_RETURN(0U == p_ctrl->rx_dest_bytes, FSP_ERR_IN_USE);
+    FSP_ERROR_RETURN(0U == p_ctrl->rx_ring_bytes, FSP_ERR_IN_USE);
  #endif
 
  #if SCI_UART_CFG_DTC_SUPPORTED
@@ -544,13 +628,30 @@ fsp_err_t R_SCI_UART_Read (uart_ctrl_t * const p_api_ctrl, uint8_t * const p_des
         /* Check that the number of transfers is within the 16-bit limit. */
         FSP_ASSERT(size <= SCI_UART_DTC_MAX_TRANSFER);
   #endif
-        err =
-            p_ctrl->p_cfg->p_transfer_rx->p_api->reset(p_ctrl->p_cfg->p_transfer_rx->p_ctrl, NULL, (void *) p_dest,
-                                                       (uint16_t) size);
-        FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+        if (p_ctrl->rx_transfer_restore)
+        {
+            /* The transfer instance was last used in ring buffer mode. Reconfigure it for normal mode reception. */
+            transfer_info_t * p_info = p_ctrl->p_cfg->p_transfer_rx->p_cfg->p_info;
+            p_info->p_dest = (void *) p_dest;
+            p_info->length = (uint16_t) size;
+
+            err = p_ctrl->p_cfg->p_transfer_rx->p_api->reconfigure(p_ctrl->p_cfg->p_transfer_rx->p_ctrl, p_info);
+            FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+            p_ctrl->rx_transfer_restore = 0U;
+        }
+        else
+        {
+            err =
+                p_ctrl->p_cfg->p_transfer_rx->p_api->reset(p_ctrl->p_cfg->p_transfer_rx->p_ctrl, NULL,
+                                                           (void *) p_dest, (uint16_t) size);
+            FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+        }
     }
  #endif
 
+    BSP_TRACE(FSP_IP_SCI, p_ctrl->p_cfg->channel, BSP_TRACE_EVENT_READ, bytes);
+
     /* Save the destination address and size for use in rxi_isr. */
     p_ctrl->p_rx_dest     = p_dest;
     p_ctrl->rx_dest_bytes = bytes;
@@ -596,6 +697,25 @@ fsp_err_t R_SCI_UART_Write (uart_ctrl_t * const p_api_ctrl, uint8_t const * cons
     FSP_ERROR_RETURN(0U == p_ctrl->tx_src_bytes, FSP_ERR_IN_USE);
  #endif
 
+ #if SCI_UART_CFG_RS485_DE_TIMER_SUPPORT
+    sci_uart_rs485_de_cfg_t const * p_de = ((sci_uart_extended_cfg_t *) p_ctrl->p_cfg->p_extend)->p_rs485_de;
+    if (NULL != p_de)
+    {
+        /* Assert the driver enable signal. The timer is started by the TEI event at the end of the last stop bit and
+         * releases the signal after the deassertion time without CPU involvement. This fails while the release of
+         * the previous transmission is still pending. */
+        fsp_err_t de_err = R_GPT_OutputLevelSet(p_de->p_timer->p_ctrl, GPT_IO_PIN_GTIOCA, GPT_PIN_LEVEL_HIGH);
+        FSP_ERROR_RETURN(FSP_SUCCESS == de_err, de_err);
+
+        if (0U != p_de->assertion_time_ns)
+        {
+            R_BSP_SoftwareDelay((p_de->assertion_time_ns + 999U) / 1000U, BSP_DELAY_UNITS_MICROSECONDS);
+        }
+    }
+ #endif
+
+    BSP_TRACE(FSP_IP_SCI, p_ctrl->p_cfg->channel, BSP_TRACE_EVENT_WRITE, bytes);
+
     /* Transmit interrupts must be disabled to start with. */
     p_ctrl->p_reg->SCR &= (uint8_t) ~(SCI_SCR_TIE_MASK | SCI_SCR_TEIE_MASK);
 
@@ -828,6 +948,7 @@ fsp_err_t R_SCI_UART_InfoGet (uart_ctrl_t * const p_api_ctrl, uart_info_t * cons
  * Provides API to abort ongoing transfer. Transmission is aborted after the current character is transmitted.
  * Reception is still enabled after abort(). Any characters received after abort() and before the transfer
  * is reset in the next call to read(), will arrive via the callback function with event UART_EVENT_RX_CHAR.
+ * Aborting reception also stops ring buffer mode if it is active.
  * Implements @ref uart_api_t::communicationAbort
  *
  * @retval  FSP_SUCCESS                  UART transaction aborted successfully.
@@ -849,6 +970,8 @@ fsp_err_t R_SCI_UART_Abort (uart_ctrl_t * const p_api_ctrl, uart_dir_t communica
     FSP_ERROR_RETURN(SCI_UART_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
 #endif
 
+    BSP_TRACE(FSP_IP_SCI, p_ctrl->p_cfg->channel, BSP_TRACE_EVENT_STOP, communication_to_abort);
+
 #if (SCI_UART_CFG_TX_ENABLE)
     if (UART_DIR_TX & communication_to_abort)
     {
@@ -884,6 +1007,16 @@ fsp_err_t R_SCI_UART_Abort (uart_ctrl_t * const p_api_ctrl, uart_dir_t communica
         }
  #endif
 
+ #if SCI_UART_CFG_RS485_DE_TIMER_SUPPORT
+        sci_uart_rs485_de_cfg_t const * p_de = ((sci_uart_extended_cfg_t *) p_ctrl->p_cfg->p_extend)->p_rs485_de;
+        if (NULL != p_de)
+        {
+            /* The TEI event does not occur for an aborted transmission, so release the driver enable signal here. If
+             * the timer is already counting, it releases the signal itself. */
+            R_GPT_OutputLevelSet(p_de->p_timer->p_ctrl, GPT_IO_PIN_GTIOCA, GPT_PIN_LEVEL_LOW);
+        }
+ #endif
+
         FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
     }
 #endif
@@ -897,6 +1030,12 @@ fsp_err_t R_SCI_UART_Abort (uart_ctrl_t * const p_api_ctrl, uart_dir_t communica
         if (NULL != p_ctrl->p_cfg->p_transfer_rx)
         {
             err = p_ctrl->p_cfg->p_transfer_rx->p_api->disable(p_ctrl->p_cfg->p_transfer_rx->p_ctrl);
+
+            /* Aborting reception also ends ring buffer mode. */
+            if (0U != p_ctrl->rx_ring_bytes)
+            {
+                r_sci_uart_ring_buffer_release(p_ctrl);
+            }
         }
  #endif
  #if SCI_UART_CFG_FIFO_SUPPORT
@@ -916,6 +1055,193 @@ fsp_err_t R_SCI_UART_Abort (uart_ctrl_t * const p_api_ctrl, uart_dir_t communica
     return err;
 }
 
+/*******************************************************************************************************************//**
+ * Starts continuous reception into a circular buffer. The receive transfer instance is reconfigured in
+ * TRANSFER_MODE_REPEAT so the destination address returns to the start of p_buffer after the last byte is written.
+ * When the DTC is used, no interrupt is raised to the CPU for received data. Use R_SCI_UART_RingBufferInfoGet to find
+ * new data and R_SCI_UART_RingBufferConsume to release it.
+ *
+ * @retval  FSP_SUCCESS                  Ring buffer reception started.
+ * @retval  FSP_ERR_ASSERTION            Pointer to UART control block or buffer is NULL, no receive transfer instance
+ *                                       is configured, or the buffer is larger than the transfer repeat limit.
+ * @retval  FSP_ERR_INVALID_ARGUMENT     Buffer address or size is not valid for 9-bit mode.
+ * @retval  FSP_ERR_NOT_OPEN             The control block has not been opened.
+ * @retval  FSP_ERR_IN_USE               A read operation is in progress or ring buffer mode is already active.
+ * @retval  FSP_ERR_UNSUPPORTED          SCI_UART_CFG_RX_ENABLE or SCI_UART_CFG_DTC_SUPPORTED is set to 0.
+ *
+ * @return                       See @ref RENESAS_ERROR_CODES or functions called by this function for other possible
+ *                               return codes. This function calls:
+ *                                   * @ref transfer_api_t::reconfigure
+ *
+ * @note The application must consume data before the transfer instance wraps around to the unread data. Overwritten
+ *       data is not detected.
+ * @note When the DMAC is used, reception stops after transfer_info_t::num_blocks passes through the buffer (65536
+ *       passes if num_blocks is 0).
+ **********************************************************************************************************************/
+fsp_err_t R_SCI_UART_RingBufferStart (uart_ctrl_t * const p_api_ctrl, uint8_t * const p_buffer, uint32_t const bytes)
+{
+#if (SCI_UART_CFG_RX_ENABLE) && SCI_UART_CFG_DTC_SUPPORTED
+    sci_uart_instance_ctrl_t * p_ctrl = (sci_uart_instance_ctrl_t *) p_api_ctrl;
+    fsp_err_t err = FSP_SUCCESS;
+
+ #if (SCI_UART_CFG_PARAM_CHECKING_ENABLE)
+    err = r_sci_read_write_param_check(p_ctrl, p_buffer, bytes);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+    FSP_ASSERT(NULL != p_ctrl->p_cfg->p_transfer_rx);
+    FSP_ASSERT((bytes >> (p_ctrl->data_bytes - 1)) <= SCI_UART_DTC_MAX_REPEAT_TRANSFER);
+    FSP_ERROR_RETURN(0U == p_ctrl->rx_dest_bytes, FSP_ERR_IN_USE);
+    FSP_ERROR_RETURN(0U == p_ctrl->rx_ring_bytes, FSP_ERR_IN_USE);
+ #endif
+
+    transfer_instance_t const * p_transfer = p_ctrl->p_cfg->p_transfer_rx;
+    transfer_info_t           * p_info     = p_transfer->p_cfg->p_info;
+
+    /* Configure the receive transfer to fill the circular buffer continuously. */
+    p_info->mode        = TRANSFER_MODE_REPEAT;
+    p_info->repeat_area = TRANSFER_REPEAT_AREA_DESTINATION;
+    p_info->p_dest      = (void *) p_buffer;
+    p_info->length      = (uint16_t) (bytes >> (p_ctrl->data_bytes - 1));
+
+    /* Ring buffer state must be set before the transfer is enabled so the RXI ISR does not read received data. */
+    p_ctrl->p_rx_ring         = p_buffer;
+    p_ctrl->rx_ring_bytes     = bytes;
+    p_ctrl->rx_ring_tail      = 0U;
+    p_ctrl->rx_ring_head_last = 0U;
+
+    err = p_transfer->p_api->reconfigure(p_transfer->p_ctrl, p_info);
+    if (FSP_SUCCESS != err)
+    {
+        r_sci_uart_ring_buffer_release(p_ctrl);
+    }
+
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+    return FSP_SUCCESS;
+#else
+    FSP_PARAMETER_NOT_USED(p_api_ctrl);
+    FSP_PARAMETER_NOT_USED(p_buffer);
+    FSP_PARAMETER_NOT_USED(bytes);
+
+    return FSP_ERR_UNSUPPORTED;
+#endif
+}
+
+/*******************************************************************************************************************//**
+ * Gets the write and read offsets of the circular receive buffer.  The idle flag is set if no data was received since
+ * the previous call, so calling this function periodically (for example from a timer callback) detects the end of a
+ * burst of received data.
+ *
+ * @retval  FSP_SUCCESS                  Ring buffer status stored in p_info.
+ * @retval  FSP_ERR_ASSERTION            Pointer to UART control block or p_info is NULL.
+ * @retval  FSP_ERR_NOT_OPEN             The control block has not been opened.
+ * @retval  FSP_ERR_NOT_ENABLED          Ring buffer mode is not active.
+ * @retval  FSP_ERR_UNSUPPORTED          SCI_UART_CFG_RX_ENABLE or SCI_UART_CFG_DTC_SUPPORTED is set to 0.
+ **********************************************************************************************************************/
+fsp_err_t R_SCI_UART_RingBufferInfoGet (uart_ctrl_t * const p_api_ctrl, sci_uart_ring_buffer_info_t * const p_info)
+{
+#if (SCI_UART_CFG_RX_ENABLE) && SCI_UART_CFG_DTC_SUPPORTED
+    sci_uart_instance_ctrl_t * p_ctrl = (sci_uart_instance_ctrl_t *) p_api_ctrl;
+
+ #if (SCI_UART_CFG_PARAM_CHECKING_ENABLE)
+    FSP_ASSERT(p_ctrl);
+    FSP_ASSERT(p_info);
+    FSP_ERROR_RETURN(SCI_UART_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+    FSP_ERROR_RETURN(0U != p_ctrl->rx_ring_bytes, FSP_ERR_NOT_ENABLED);
+ #endif
+
+    uint32_t head = r_sci_uart_ring_buffer_head_get(p_ctrl);
+
+    p_info->head            = head;
+    p_info->tail            = p_ctrl->rx_ring_tail;
+    p_info->bytes_available = (head + p_ctrl->rx_ring_bytes - p_ctrl->rx_ring_tail) % p_ctrl->rx_ring_bytes;
+    p_info->idle            = (head == p_ctrl->rx_ring_head_last);
+
+    p_ctrl->rx_ring_head_last = head;
+
+    return FSP_SUCCESS;
+#else
+    FSP_PARAMETER_NOT_USED(p_api_ctrl);
+    FSP_PARAMETER_NOT_USED(p_info);
+
+    return FSP_ERR_UNSUPPORTED;
+#endif
+}
+
+/*******************************************************************************************************************//**
+ * Releases data that the application has read from the circular receive buffer.
+ *
+ * @retval  FSP_SUCCESS                  Read offset advanced.
+ * @retval  FSP_ERR_ASSERTION            Pointer to UART control block is NULL or bytes is larger than the number of
+ *                                       unread bytes.
+ * @retval  FSP_ERR_INVALID_ARGUMENT     Data size is not valid for 9-bit mode.
+ * @retval  FSP_ERR_NOT_OPEN             The control block has not been opened.
+ * @retval  FSP_ERR_NOT_ENABLED          Ring buffer mode is not active.
+ * @retval  FSP_ERR_UNSUPPORTED          SCI_UART_CFG_RX_ENABLE or SCI_UART_CFG_DTC_SUPPORTED is set to 0.
+ **********************************************************************************************************************/
+fsp_err_t R_SCI_UART_RingBufferConsume (uart_ctrl_t * const p_api_ctrl, uint32_t const bytes)
+{
+#if (SCI_UART_CFG_RX_ENABLE) && SCI_UART_CFG_DTC_SUPPORTED
+    sci_uart_instance_ctrl_t * p_ctrl = (sci_uart_instance_ctrl_t *) p_api_ctrl;
+
+ #if (SCI_UART_CFG_PARAM_CHECKING_ENABLE)
+    FSP_ASSERT(p_ctrl);
+    FSP_ERROR_RETURN(SCI_UART_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+    FSP_ERROR_RETURN(0U != p_ctrl->rx_ring_bytes, FSP_ERR_NOT_ENABLED);
+    FSP_ERROR_RETURN((2U != p_ctrl->data_bytes) || (0U == (bytes % 2U)), FSP_ERR_INVALID_ARGUMENT);
+    FSP_ASSERT(bytes <=
+               ((r_sci_uart_ring_buffer_head_get(p_ctrl) + p_ctrl->rx_ring_bytes - p_ctrl->rx_ring_tail) %
+                p_ctrl->rx_ring_bytes));
+ #endif
+
+    p_ctrl->rx_ring_tail = (p_ctrl->rx_ring_tail + bytes) % p_ctrl->rx_ring_bytes;
+
+    return FSP_SUCCESS;
+#else
+    FSP_PARAMETER_NOT_USED(p_api_ctrl);
+    FSP_PARAMETER_NOT_USED(bytes);
+
+    return FSP_ERR_UNSUPPORTED;
+#endif
+}
+
+/*******************************************************************************************************************//**
+ * Stops ring buffer reception. The receive transfer instance is reconfigured for normal mode on the next call to
+ * R_SCI_UART_Read. Characters received after this call arrive via the callback function with event
+ * UART_EVENT_RX_CHAR.
+ *
+ * @retval  FSP_SUCCESS                  Ring buffer reception stopped.
+ * @retval  FSP_ERR_ASSERTION            Pointer to UART control block is NULL.
+ * @retval  FSP_ERR_NOT_OPEN             The control block has not been opened.
+ * @retval  FSP_ERR_NOT_ENABLED          Ring buffer mode is not active.
+ * @retval  FSP_ERR_UNSUPPORTED          SCI_UART_CFG_RX_ENABLE or SCI_UART_CFG_DTC_SUPPORTED is set to 0.
+ *
+ * @return                       See @ref RENESAS_ERROR_CODES or functions called by this function for other possible
+ *                               return codes. This function calls:
+ *                                   * @ref transfer_api_t::disable
+ **********************************************************************************************************************/
+fsp_err_t R_SCI_UART_RingBufferStop (uart_ctrl_t * const p_api_ctrl)
+{
+#if (SCI_UART_CFG_RX_ENABLE) && SCI_UART_CFG_DTC_SUPPORTED
+    sci_uart_instance_ctrl_t * p_ctrl = (sci_uart_instance_ctrl_t *) p_api_ctrl;
+
+ #if (SCI_UART_CFG_PARAM_CHECKING_ENABLE)
+    FSP_ASSERT(p_ctrl);
+    FSP_ERROR_RETURN(SCI_UART_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+    FSP_ERROR_RETURN(0U != p_ctrl->rx_ring_bytes, FSP_ERR_NOT_ENABLED);
+ #endif
+
+    fsp_err_t err = p_ctrl->p_cfg->p_transfer_rx->p_api->disable(p_ctrl->p_cfg->p_transfer_rx->p_ctrl);
+
+    r_sci_uart_ring_buffer_release(p_ctrl);
+
+    return err;
+#else
+    FSP_PARAMETER_NOT_USED(p_api_ctrl);
+
+    return FSP_ERR_UNSUPPORTED;
+#endif
+}
+
 /*******************************************************************************************************************//**
  * Calculates baud rate register settings. Evaluates and determines the best possible settings set to the baud rate
  * related registers.
@@ -1454,6 +1780,87 @@ static void r_sci_uart_transfer_close (sci_uart_instance_ctrl_t * p_ctrl)
 
 #endif
 
+#if SCI_UART_CFG_RS485_DE_TIMER_SUPPORT
+
+/*******************************************************************************************************************//**
+ * Configures the timer that releases the RS-485 driver enable signal. The one-shot period is the deassertion time,
+ * rounded up so the signal is never released early. The hardware start source is enabled so the TEI event starts the
+ * timer through the ELC.
+ *
+ * @param[in]     p_de       Pointer to RS-485 driver enable configuration
+ *
+ * @retval        FSP_SUCCESS  Timer configured and driver enable signal released.
+ * @return        See @ref RENESAS_ERROR_CODES or functions called by this function for other possible return codes.
+ **********************************************************************************************************************/
+static fsp_err_t r_sci_uart_rs485_de_open (sci_uart_rs485_de_cfg_t const * const p_de)
+{
+    timer_instance_t const * p_timer = p_de->p_timer;
+    timer_info_t             info;
+
+    fsp_err_t err = p_timer->p_api->infoGet(p_timer->p_ctrl, &info);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+    uint64_t counts = ((uint64_t) p_de->deassertion_time_ns * info.clock_frequency + SCI_UART_PRV_NS_PER_SECOND - 1U) /
+                      SCI_UART_PRV_NS_PER_SECOND;
+
+    if (counts < SCI_UART_PRV_RS485_DE_MIN_COUNTS)
+    {
+        counts = SCI_UART_PRV_RS485_DE_MIN_COUNTS;
+    }
+
+    FSP_ERROR_RETURN(counts <= UINT32_MAX, FSP_ERR_INVALID_ARGUMENT);
+
+    err = p_timer->p_api->periodSet(p_timer->p_ctrl, (uint32_t) counts);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+    err = R_GPT_OutputLevelSet(p_timer->p_ctrl, GPT_IO_PIN_GTIOCA, GPT_PIN_LEVEL_LOW);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+    return p_timer->p_api->enable(p_timer->p_ctrl);
+}
+
+#endif
+
+#if SCI_UART_CFG_DTC_SUPPORTED && (SCI_UART_CFG_RX_ENABLE)
+
+/*******************************************************************************************************************//**
+ * Calculates the offset in the circular receive buffer where the transfer instance writes the next byte.
+ *
+ * @param[in]     p_ctrl     Pointer to UART instance control block
+ *
+ * @return        Write offset in bytes.
+ **********************************************************************************************************************/
+static uint32_t r_sci_uart_ring_buffer_head_get (sci_uart_instance_ctrl_t * const p_ctrl)
+{
+    transfer_instance_t const * p_transfer = p_ctrl->p_cfg->p_transfer_rx;
+    transfer_properties_t       properties = {0U};
+    uint32_t shift     = p_ctrl->data_bytes - 1U;
+    uint32_t transfers = p_ctrl->rx_ring_bytes >> shift;
+
+    p_transfer->p_api->infoGet(p_transfer->p_ctrl, &properties);
+
+    /* The remaining count is reloaded when the buffer wraps. A remaining count of 0 means a full repeat of
+     * SCI_UART_DTC_MAX_REPEAT_TRANSFER transfers is remaining. */
+    return ((transfers - properties.transfer_length_remaining) % transfers) << shift;
+}
+
+/*******************************************************************************************************************//**
+ * Ends ring buffer mode. The transfer settings are returned to normal mode and the transfer instance is reconfigured on
+ * the next read.
+ *
+ * @param[in]     p_ctrl     Pointer to UART instance control block
+ **********************************************************************************************************************/
+static void r_sci_uart_ring_buffer_release (sci_uart_instance_ctrl_t * const p_ctrl)
+{
+    p_ctrl->p_cfg->p_transfer_rx->p_cfg->p_info->mode = TRANSFER_MODE_NORMAL;
+
+    p_ctrl->rx_transfer_restore = 1U;
+    p_ctrl->p_rx_ring           = NULL;
+    p_ctrl->rx_ring_bytes       = 0U;
+}
+
+#endif
+
 /*******************************************************************************************************************//**
  * Changes baud rate based on predetermined register settings.
  *
@@ -1489,6 +1896,8 @@ static void r_sci_uart_call_callback (sci_uart_instance_ctrl_t * p_ctrl, uint32_
 {
     uart_callback_args_t args;
 
+    BSP_TRACE(FSP_IP_SCI, p_ctrl->p_cfg->channel, event, data);
+
     /* Store callback arguments in memory provided by user if available.  This allows callback arguments to be
      * stored in non-secure memory so they can be accessed by a non-secure callback function. */
     uart_callback_args_t * p_args = p_ctrl->p_callback_memory;
@@ -1653,7 +2062,12 @@ void sci_uart_rxi_isr (void)
     sci_uart_instance_ctrl_t * p_ctrl = (sci_uart_instance_ctrl_t *) R_FSP_IsrContextGet(irq);
 
  #if SCI_UART_CFG_DTC_SUPPORTED
-    if ((p_ctrl->p_cfg->p_transfer_rx == NULL) || (0 == p_ctrl->rx_dest_bytes))
+    if (0U != p_ctrl->rx_ring_bytes)
+    {
+        /* In ring buffer mode received data is stored in the circular buffer by the transfer instance. The receive
+         * data register must not be read here. */
+    }
+    else if ((p_ctrl->p_cfg->p_transfer_rx == NULL) || (0 == p_ctrl->rx_dest_bytes))
  #endif
     {
  #if (SCI_UART_CFG_FLOW_CONTROL_SUPPORT)
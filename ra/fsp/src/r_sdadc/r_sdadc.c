@@ -69,6 +69,10 @@
 
 #define SDADC_PRIV_8_BITS                     (8U)
 #define SDADC_PRIV_16_BITS                    (16U)
+#define SDADC_PRIV_SIGN_BIT_SHIFT             (23U)
+#define SDADC_PRIV_SCALE_SHIFT                (16U)
+#define SDADC_PRIV_FIR_SHIFT                  (15U)
+#define SDADC_PRIV_IIR_SHIFT                  (14U)
 
 #define SDADC_OPEN                            (0x53444144U)
 
@@ -106,6 +110,11 @@ static void r_sdadc_calibrate_end_restore(sdadc_instance_ctrl_t * const p_instan
 
 static void r_sdadc_disable_irq(IRQn_Type irq);
 
+static void    r_sdadc_buffer_process(sdadc_instance_ctrl_t * const p_instance_ctrl);
+static int32_t r_sdadc_filter(sdadc_filter_cfg_t const * const p_filter,
+                              sdadc_filter_state_t * const     p_state,
+                              int32_t                          input);
+
 void sdadc_adi_isr(void);
 void sdadc_scanend_isr(void);
 void sdadc_caliend_isr(void);
@@ -174,7 +183,8 @@ fsp_err_t R_SDADC_Open (adc_ctrl_t * p_ctrl, adc_cfg_t const * const p_cfg)
 #endif
 
     /* Set all p_instance_ctrl fields prior to using it in any functions. */
-    p_instance_ctrl->p_cfg = p_cfg;
+    p_instance_ctrl->p_cfg        = p_cfg;
+    p_instance_ctrl->p_buffer_cfg = NULL;
 
     /* Configure and enable interrupts. */
     err = r_sdadc_open_irq_cfg(p_instance_ctrl, p_cfg);
@@ -726,9 +736,7 @@ fsp_err_t R_SDADC_Close (adc_ctrl_t * p_ctrl)
     R_SDADC0->STC2 = 0U;
 
     /* Stop the input clock for the 24-bit sigma-delta A/D converter (SDADCCLK). */
-    R_BSP_RegisterProtectDisable(BSP_REG_PROTECT_CGC);
-    R_SYSTEM->SDADCCKCR = 0U;
-    R_BSP_RegisterProtectEnable(BSP_REG_PROTECT_CGC);
+    BSP_REG_PROTECT_WRITE(BSP_REG_PROTECT_CGC, R_SYSTEM->SDADCCKCR, 0U);
 
     /* Enter the module-stop state. */
     R_BSP_MODULE_STOP(FSP_IP_SDADC, 0U);
@@ -757,6 +765,180 @@ fsp_err_t R_SDADC_VersionGet (fsp_version_t * const p_version)
     return FSP_SUCCESS;
 }
 
+/*******************************************************************************************************************//**
+ * Starts conversions in buffer mode. The DTC (or DMAC) moves each conversion result into one half of a double buffer,
+ * so the CPU is interrupted once per buffer half instead of once per conversion. The results of the filled half are
+ * then sign-extended, scaled and filtered in one pass and adc_cfg_t::p_callback is replaced by
+ * sdadc_buffer_cfg_t::p_callback.
+ *
+ * @pre Call R_SDADC_ScanCfg first. Averaging must be enabled for all or none of the scanned channels.
+ *
+ * @retval  FSP_SUCCESS                Buffer mode started.
+ * @retval  FSP_ERR_ASSERTION          An input pointer was NULL or an input parameter was invalid.
+ * @retval  FSP_ERR_NOT_OPEN           Instance control block is not open.
+ * @retval  FSP_ERR_IN_USE             Buffer mode already started, or a conversion or calibration is in progress.
+ * @retval  FSP_ERR_INVALID_MODE       Only some of the scanned channels use averaging.
+ * @return                             See @ref RENESAS_ERROR_CODES or functions called by this function for other
+ *                                     possible return codes.
+ **********************************************************************************************************************/
+fsp_err_t R_SDADC_BufferStart (adc_ctrl_t * p_ctrl, sdadc_buffer_cfg_t const * const p_buffer_cfg)
+{
+    sdadc_instance_ctrl_t * p_instance_ctrl = (sdadc_instance_ctrl_t *) p_ctrl;
+    fsp_err_t               err             = FSP_SUCCESS;
+
+#if (1 == SDADC_CFG_PARAM_CHECKING_ENABLE)
+
+    /* Verify the pointers are not NULL and ensure the ADC unit is already open. */
+    FSP_ASSERT(NULL != p_instance_ctrl);
+    FSP_ASSERT(NULL != p_buffer_cfg);
+    FSP_ASSERT(NULL != p_buffer_cfg->p_transfer);
+    FSP_ASSERT(NULL != p_buffer_cfg->p_buffer);
+    FSP_ASSERT(NULL != p_buffer_cfg->p_data);
+    FSP_ASSERT(0U != p_buffer_cfg->num_samples);
+    if ((NULL != p_buffer_cfg->p_filter) && (SDADC_FILTER_NONE != p_buffer_cfg->p_filter->type))
+    {
+        FSP_ASSERT(NULL != p_buffer_cfg->p_filter->p_coefficients);
+        FSP_ASSERT(NULL != p_buffer_cfg->p_filter_state);
+        if (SDADC_FILTER_FIR == p_buffer_cfg->p_filter->type)
+        {
+            FSP_ASSERT((p_buffer_cfg->p_filter->num_taps > 0U) &&
+                       (p_buffer_cfg->p_filter->num_taps <= SDADC_FILTER_TAPS_MAX));
+        }
+    }
+
+    FSP_ERROR_RETURN(SDADC_OPEN == p_instance_ctrl->opened, FSP_ERR_NOT_OPEN);
+    FSP_ASSERT(0U != p_instance_ctrl->scan_mask);
+#endif
+    FSP_ERROR_RETURN(NULL == p_instance_ctrl->p_buffer_cfg, FSP_ERR_IN_USE);
+
+    /* Find the scanned channels with signed results and with averaging. */
+    sdadc_extended_cfg_t const * p_cfg_extend = (sdadc_extended_cfg_t *) p_instance_ctrl->p_cfg->p_extend;
+    uint32_t                     signed_mask  = 0U;
+    uint32_t                     average_mask = 0U;
+    for (uint32_t channel = 0U; channel < SDADC_MAX_NUM_CHANNELS; channel++)
+    {
+        if (0U != (p_instance_ctrl->scan_mask & (1U << channel)))
+        {
+            sdadc_channel_cfg_t const * p_channel_cfg = p_cfg_extend->p_channel_cfgs[channel];
+            if (SDADC_CHANNEL_INPUT_DIFFERENTIAL == p_channel_cfg->input)
+            {
+                signed_mask |= 1U << channel;
+            }
+
+            if (SDADC_CHANNEL_AVERAGE_NONE != p_channel_cfg->average)
+            {
+                average_mask |= 1U << channel;
+            }
+        }
+    }
+
+    /* The transfer reads a single result register, so all or none of the channels must be averaged. */
+    FSP_ERROR_RETURN((0U == average_mask) || (p_instance_ctrl->scan_mask == average_mask), FSP_ERR_INVALID_MODE);
+
+    if (NULL != p_buffer_cfg->p_filter_state)
+    {
+        for (uint32_t channel = 0U; channel < SDADC_MAX_NUM_CHANNELS; channel++)
+        {
+            for (uint32_t i = 0U; i < SDADC_FILTER_TAPS_MAX; i++)
+            {
+                p_buffer_cfg->p_filter_state[channel].history[i] = 0;
+            }
+
+            p_buffer_cfg->p_filter_state[channel].index = 0U;
+        }
+    }
+
+    /* One 32-bit result (including the channel number) per conversion end event. */
+    transfer_info_t * p_info = &p_instance_ctrl->buffer_info;
+    p_info->transfer_settings_word = 0U;
+
+    p_info->mode           = TRANSFER_MODE_NORMAL;
+    p_info->size           = TRANSFER_SIZE_4_BYTE;
+    p_info->src_addr_mode  = TRANSFER_ADDR_MODE_FIXED;
+    p_info->dest_addr_mode = TRANSFER_ADDR_MODE_INCREMENTED;
+    p_info->repeat_area    = TRANSFER_REPEAT_AREA_DESTINATION;
+    p_info->irq            = TRANSFER_IRQ_END;
+    p_info->chain_mode     = TRANSFER_CHAIN_MODE_DISABLED;
+    p_info->p_src          = (0U == average_mask) ? (void const *) &R_SDADC0->ADCR : (void const *) &R_SDADC0->ADAR;
+    p_info->p_dest         = p_buffer_cfg->p_buffer;
+    p_info->num_blocks     = 0U;
+    p_info->length         = p_buffer_cfg->num_samples;
+
+    transfer_instance_t const * p_transfer = p_buffer_cfg->p_transfer;
+    err = p_transfer->p_api->open(p_transfer->p_ctrl, p_transfer->p_cfg);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+    err = p_transfer->p_api->reconfigure(p_transfer->p_ctrl, p_info);
+    if (FSP_SUCCESS == err)
+    {
+        p_instance_ctrl->signed_mask  = signed_mask;
+        p_instance_ctrl->buffer_half  = 0U;
+        p_instance_ctrl->p_buffer_cfg = p_buffer_cfg;
+
+        err = R_SDADC_ScanStart(p_instance_ctrl);
+    }
+
+    if (FSP_SUCCESS != err)
+    {
+        p_instance_ctrl->p_buffer_cfg = NULL;
+        (void) p_transfer->p_api->close(p_transfer->p_ctrl);
+    }
+
+    return err;
+}
+
+/*******************************************************************************************************************//**
+ * Stops conversions started by R_SDADC_BufferStart and closes the transfer instance.
+ *
+ * @retval  FSP_SUCCESS                Buffer mode stopped.
+ * @retval  FSP_ERR_ASSERTION          An input pointer was NULL.
+ * @retval  FSP_ERR_NOT_OPEN           Instance control block is not open.
+ * @retval  FSP_ERR_NOT_ENABLED        Buffer mode is not started.
+ **********************************************************************************************************************/
+fsp_err_t R_SDADC_BufferStop (adc_ctrl_t * p_ctrl)
+{
+    sdadc_instance_ctrl_t * p_instance_ctrl = (sdadc_instance_ctrl_t *) p_ctrl;
+
+#if (1 == SDADC_CFG_PARAM_CHECKING_ENABLE)
+
+    /* Verify the pointers are not NULL and ensure the ADC unit is already open. */
+    FSP_ASSERT(NULL != p_instance_ctrl);
+    FSP_ERROR_RETURN(SDADC_OPEN == p_instance_ctrl->opened, FSP_ERR_NOT_OPEN);
+#endif
+    FSP_ERROR_RETURN(NULL != p_instance_ctrl->p_buffer_cfg, FSP_ERR_NOT_ENABLED);
+
+    (void) R_SDADC_ScanStop(p_instance_ctrl);
+
+    transfer_instance_t const * p_transfer = p_instance_ctrl->p_buffer_cfg->p_transfer;
+    (void) p_transfer->p_api->close(p_transfer->p_ctrl);
+
+    p_instance_ctrl->p_buffer_cfg = NULL;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Processes the filled buffer half when a DMAC is used in buffer mode. Call from the DMAC transfer end callback. With
+ * DTC, this is done by the conversion end interrupt.
+ *
+ * @retval  FSP_SUCCESS                Buffer half processed.
+ * @retval  FSP_ERR_ASSERTION          An input pointer was NULL.
+ * @retval  FSP_ERR_NOT_ENABLED        Buffer mode is not started.
+ **********************************************************************************************************************/
+fsp_err_t R_SDADC_BufferTransferEnd (adc_ctrl_t * p_ctrl)
+{
+    sdadc_instance_ctrl_t * p_instance_ctrl = (sdadc_instance_ctrl_t *) p_ctrl;
+
+#if (1 == SDADC_CFG_PARAM_CHECKING_ENABLE)
+    FSP_ASSERT(NULL != p_instance_ctrl);
+#endif
+    FSP_ERROR_RETURN(NULL != p_instance_ctrl->p_buffer_cfg, FSP_ERR_NOT_ENABLED);
+
+    r_sdadc_buffer_process(p_instance_ctrl);
+
+    return FSP_SUCCESS;
+}
+
 /*******************************************************************************************************************//**
  * @} (end addtogroup SDADC)
  **********************************************************************************************************************/
@@ -997,6 +1179,119 @@ static void r_sdadc_disable_irq (IRQn_Type irq)
     }
 }
 
+/*******************************************************************************************************************//**
+ * Restarts the transfer into the other buffer half, then sign-extends, scales and filters the filled half.
+ *
+ * @param[in]  p_instance_ctrl         Pointer to instance control block
+ **********************************************************************************************************************/
+static void r_sdadc_buffer_process (sdadc_instance_ctrl_t * const p_instance_ctrl)
+{
+    sdadc_buffer_cfg_t const  * p_buffer_cfg = p_instance_ctrl->p_buffer_cfg;
+    transfer_instance_t const * p_transfer   = p_buffer_cfg->p_transfer;
+    uint32_t                    num_samples  = p_buffer_cfg->num_samples;
+    uint32_t                    half         = p_instance_ctrl->buffer_half;
+    uint32_t const            * p_raw        = &p_buffer_cfg->p_buffer[half * num_samples];
+    bool filter = (NULL != p_buffer_cfg->p_filter) && (SDADC_FILTER_NONE != p_buffer_cfg->p_filter->type);
+
+    /* Restart the transfer first so no conversion is lost while this half is processed. */
+    p_instance_ctrl->buffer_half = half ^ 1U;
+    (void) p_transfer->p_api->reset(p_transfer->p_ctrl,
+                                    p_instance_ctrl->buffer_info.p_src,
+                                    &p_buffer_cfg->p_buffer[(half ^ 1U) * num_samples],
+                                    (uint16_t) num_samples);
+
+    for (uint32_t i = 0U; i < num_samples; i++)
+    {
+        uint32_t raw     = p_raw[i];
+        uint32_t channel = (uint32_t) SDADC_BUFFER_CHANNEL(raw);
+        int32_t  value   = 0;
+
+        if (channel < SDADC_MAX_NUM_CHANNELS)
+        {
+            /* Sign-extend the 24-bit result of differential channels without a branch. */
+            uint32_t sign = ((p_instance_ctrl->signed_mask >> channel) & 1U) << SDADC_PRIV_SIGN_BIT_SHIFT;
+            value = (int32_t) ((raw & R_SDADC0_ADCR_SDADCRD_Msk) ^ sign) - (int32_t) sign;
+
+            if (NULL != p_buffer_cfg->p_offset)
+            {
+                value -= p_buffer_cfg->p_offset[channel];
+            }
+
+            if (NULL != p_buffer_cfg->p_scale)
+            {
+                value = (int32_t) (((int64_t) value * p_buffer_cfg->p_scale[channel]) >> SDADC_PRIV_SCALE_SHIFT);
+            }
+
+            if (filter)
+            {
+                value = r_sdadc_filter(p_buffer_cfg->p_filter, &p_buffer_cfg->p_filter_state[channel], value);
+            }
+        }
+
+        p_buffer_cfg->p_data[i] = value;
+    }
+
+    if (NULL != p_buffer_cfg->p_callback)
+    {
+        sdadc_buffer_callback_args_t args;
+        args.p_raw       = p_raw;
+        args.p_data      = p_buffer_cfg->p_data;
+        args.num_samples = num_samples;
+        args.p_context   = p_buffer_cfg->p_context;
+        p_buffer_cfg->p_callback(&args);
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Applies the buffer mode post-filter to one result.
+ *
+ * @param[in]  p_filter                Filter configuration
+ * @param[in]  p_state                 Filter state of the channel
+ * @param[in]  input                   Scaled result
+ *
+ * @return     Filtered result
+ **********************************************************************************************************************/
+static int32_t r_sdadc_filter (sdadc_filter_cfg_t const * const p_filter,
+                               sdadc_filter_state_t * const     p_state,
+                               int32_t                          input)
+{
+    int16_t const * p_coef = p_filter->p_coefficients;
+    int32_t       * p_hist = p_state->history;
+    int64_t         acc    = 0;
+
+    if (SDADC_FILTER_FIR == p_filter->type)
+    {
+        uint32_t taps  = p_filter->num_taps;
+        uint32_t index = p_state->index;
+
+        p_hist[index] = input;
+
+        /* Newest input first, the delay line is circular. */
+        for (uint32_t k = 0U; k < taps; k++)
+        {
+            acc  += (int64_t) p_coef[k] * p_hist[index];
+            index = (0U == index) ? (taps - 1U) : (index - 1U);
+        }
+
+        p_state->index = (p_state->index + 1U) % taps;
+
+        return (int32_t) (acc >> SDADC_PRIV_FIR_SHIFT);
+    }
+
+    /* Biquad, direct form I: history holds x[n-1], x[n-2], y[n-1], y[n-2]. */
+    acc = ((int64_t) p_coef[0] * input) + ((int64_t) p_coef[1] * p_hist[0]) + ((int64_t) p_coef[2] * p_hist[1]) -
+          ((int64_t) p_coef[3] * p_hist[2]) - ((int64_t) p_coef[4] * p_hist[3]);
+
+    int32_t output = (int32_t) (acc >> SDADC_PRIV_IIR_SHIFT);
+
+    p_hist[1] = p_hist[0];
+    p_hist[0] = input;
+    p_hist[3] = p_hist[2];
+    p_hist[2] = output;
+
+    return output;
+}
+
 /*******************************************************************************************************************//**
  * Scan complete interrupt.
  **********************************************************************************************************************/
@@ -1039,6 +1334,17 @@ void sdadc_adi_isr (void)
     /* Clear the BSP IRQ Flag. */
     R_BSP_IrqStatusClear(irq);
 
+    /* In buffer mode the DTC requests this interrupt after the last transfer of a buffer half. */
+    if (NULL != p_instance_ctrl->p_buffer_cfg)
+    {
+        r_sdadc_buffer_process(p_instance_ctrl);
+
+        /* Restore context if RTOS is used */
+        FSP_CONTEXT_RESTORE;
+
+        return;
+    }
+
     /* Read the converted result. */
     uint32_t      result  = R_SDADC0->ADCR;
     adc_channel_t channel = (adc_channel_t) ((result >> 25) - 1U);
@@ -158,6 +158,7 @@
 #define SDHI_PRV_SDIO_INFO1_MASK_IRQ_DISABLE               (0xC006U)
 #define SDHI_PRV_SDIO_INFO1_IRQ_CLEAR                      (0xFFFF3FFEU)
 #define SDHI_PRV_SDIO_INFO1_TRANSFER_COMPLETE_MASK         (0xC000)
+#define SDHI_PRV_SDIO_INFO1_IOIRQ                          (1U << 0)
 #define SDHI_PRV_SD_INFO2_MASK_BREM_BWEM_MASK              (0x300U)
 #define SDHI_PRV_EMMC_BUS_WIDTH_INDEX                      (183U)
 #define SDHI_PRV_BYTES_PER_KILOBYTE                        (1024)
@@ -179,6 +180,11 @@
 #define SDHI_PRV_ACCESS_BIT                                (2U)
 #define SDHI_PRV_RESPONSE_BIT                              (0U)
 
+/* Progress of the ACMD23 or CMD23 sequence sent before a queued transfer. */
+#define SDHI_PRV_PRE_ERASE_NONE                            (0U)
+#define SDHI_PRV_PRE_ERASE_APP_CMD                         (1U)
+#define SDHI_PRV_PRE_ERASE_COUNT                           (2U)
+
 /***********************************************************************************************************************
  * Typedef definitions
  **********************************************************************************************************************/
@@ -293,6 +299,18 @@ static void r_sdhi_transfer_end(sdhi_instance_ctrl_t * const p_ctrl);
 
 static void r_sdhi_call_callback(sdhi_instance_ctrl_t * p_ctrl, sdmmc_callback_args_t * p_args);
 
+static fsp_err_t r_sdhi_request_start(sdhi_instance_ctrl_t * const p_ctrl);
+
+static void r_sdhi_request_command_send(sdhi_instance_ctrl_t * const p_ctrl);
+
+static fsp_err_t r_sdhi_request_segment_transfer(sdhi_instance_ctrl_t * const p_ctrl);
+
+static void r_sdhi_request_complete(sdhi_instance_ctrl_t * const p_ctrl, sdmmc_event_t event);
+
+static bool r_sdhi_request_is_io(sdhi_request_t const * const p_request);
+
+static bool r_sdhi_request_is_write(sdhi_request_t const * const p_request);
+
 void r_sdhi_transfer_callback(sdhi_instance_ctrl_t * p_ctrl);
 
 void sdhimmc_accs_isr(void);
@@ -421,6 +439,8 @@ fsp_err_t R_SDHI_Open (sdmmc_ctrl_t * const p_api_ctrl, sdmmc_cfg_t const * cons
     r_sdhi_irq_enable(p_cfg->sdio_irq, p_cfg->sdio_ipl, p_ctrl);
     r_sdhi_irq_enable(p_cfg->dma_req_irq, p_cfg->dma_req_ipl, p_ctrl);
 
+    BSP_TRACE(FSP_IP_SDHI, p_cfg->channel, BSP_TRACE_EVENT_OPEN, 0U);
+
     p_ctrl->initialized = false;
     p_ctrl->open        = SDHI_PRV_OPEN;
 
@@ -539,6 +559,8 @@ fsp_err_t R_SDHI_Read (sdmmc_ctrl_t * const p_api_ctrl,
         command = SDHI_PRV_CMD_READ_SINGLE_BLOCK;
     }
 
+    BSP_TRACE(FSP_IP_SDHI, p_ctrl->p_cfg->channel, BSP_TRACE_EVENT_READ, sector_count);
+
     r_sdhi_read_write_common(p_ctrl, sector_count, p_ctrl->p_cfg->block_size, command, argument);
 
     return FSP_SUCCESS;
@@ -602,6 +624,8 @@ fsp_err_t R_SDHI_Write (sdmmc_ctrl_t * const  p_api_ctrl,
         command = SDHI_PRV_CMD_WRITE_SINGLE_BLOCK;
     }
 
+    BSP_TRACE(FSP_IP_SDHI, p_ctrl->p_cfg->channel, BSP_TRACE_EVENT_WRITE, sector_count);
+
     /* Casting to uint16_t safe because block size verified in R_SDHI_Open */
     r_sdhi_read_write_common(p_ctrl, sector_count, p_ctrl->p_cfg->block_size, command, argument);
 
@@ -996,6 +1020,8 @@ fsp_err_t R_SDHI_Erase (sdmmc_ctrl_t * const p_api_ctrl, uint32_t const start_se
     err = r_sdhi_erase_error_check(p_ctrl, start_sector, sector_count);
     FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
 
+    BSP_TRACE(FSP_IP_SDHI, p_ctrl->p_cfg->channel, BSP_TRACE_EVENT_ERASE, sector_count);
+
     /*  SDHC, SDXC and eMMC high capacity media use block addressing. */
     if (true == p_ctrl->sector_addressing)
     {
@@ -1106,11 +1132,28 @@ fsp_err_t R_SDHI_Close (sdmmc_ctrl_t * const p_api_ctrl)
 
     p_ctrl->open = 0U;
 
+    BSP_TRACE(FSP_IP_SDHI, p_ctrl->p_cfg->channel, BSP_TRACE_EVENT_CLOSE, 0U);
+
     /* Disable SDHI interrupts. */
     r_sdhi_irq_disable(p_ctrl->p_cfg->access_irq);
     r_sdhi_irq_disable(p_ctrl->p_cfg->card_irq);
     r_sdhi_irq_disable(p_ctrl->p_cfg->sdio_irq);
 
+    /* Discard queued requests. */
+    if (NULL != p_ctrl->p_request_active)
+    {
+        p_ctrl->p_request_active->status = SDHI_REQUEST_STATUS_IDLE;
+        p_ctrl->p_request_active         = NULL;
+    }
+
+    while (NULL != p_ctrl->p_request_head)
+    {
+        p_ctrl->p_request_head->status = SDHI_REQUEST_STATUS_IDLE;
+        p_ctrl->p_request_head         = p_ctrl->p_request_head->p_next;
+    }
+
+    p_ctrl->p_request_tail = NULL;
+
     /* Put the card in idle state (CMD0). */
     r_sdhi_command_send_no_wait(p_ctrl, SDHI_PRV_CMD_GO_IDLE_STATE, 0);
 
@@ -1143,6 +1186,218 @@ fsp_err_t R_SDHI_VersionGet (fsp_version_t * const p_version)
     return err;
 }
 
+/*******************************************************************************************************************//**
+ * Queues a multi-sector read or write to an SD card or eMMC device, or a multi-block read or write to an SDIO card
+ * function.
+ *
+ * Requests are transferred in submission order. When a request completes, the access interrupt starts the next queued
+ * request before the callback is called, so there is no gap for the application to fill between commands. Each
+ * request is transferred with one CMD18 or CMD25, or with one block mode CMD53 for SDHI_REQUEST_OP_IO_READ and
+ * SDHI_REQUEST_OP_IO_WRITE. The transfer moves to the next buffer of the scatter list in the transfer interrupt when a
+ * segment is complete, while the card waits for the next block. That interrupt is the DTC transfer interrupt
+ * (sdmmc_cfg_t::dma_req_irq), so with DMAC each request must have a single segment.
+ *
+ * SDIO requests transfer blocks of sdmmc_cfg_t::block_size bytes to or from the register at
+ * sdhi_request_t::start_sector of function sdhi_request_t::io_function. Packets split across several buffers, such as
+ * a header and a payload, can be sent with one CMD53 by listing each buffer as a segment.
+ *
+ * If sdhi_request_t::pre_erase is set for a write to an SD card, ACMD23 (SET_WR_BLK_ERASE_COUNT) is sent with the
+ * total sector count before CMD25 so the card can pre-erase the sectors.
+ *
+ * A callback with the event SDMMC_EVENT_TRANSFER_COMPLETE or SDMMC_EVENT_TRANSFER_ERROR is called when each request
+ * ends, and the result is also stored in the request. After a transfer error, all queued requests are completed with
+ * SDMMC_EVENT_TRANSFER_ERROR. Other read, write and erase functions return FSP_ERR_DEVICE_BUSY while a queued request
+ * is in progress.
+ *
+ * @retval     FSP_SUCCESS                   Request queued. It is started immediately if the driver is idle.
+ * @retval     FSP_ERR_ASSERTION             NULL pointer, a segment buffer is not word aligned, a segment is empty,
+ *                                           the request is more than 0x10000 sectors or 511 SDIO blocks, or the
+ *                                           request is already queued.
+ * @retval     FSP_ERR_NOT_OPEN              Driver has not been initialized.
+ * @retval     FSP_ERR_CARD_NOT_INITIALIZED  Card was unplugged.
+ * @retval     FSP_ERR_UNSUPPORTED           A memory request was submitted to an SDIO device, an SDIO request was
+ *                                           submitted to a memory device, or a request with more than one segment
+ *                                           was submitted without the DTC transfer interrupt.
+ * @retval     FSP_ERR_CARD_WRITE_PROTECTED  SD card is Write Protected.
+ * @retval     FSP_ERR_DEVICE_BUSY           Driver is busy with an operation that was not queued.
+ * @return     See @ref RENESAS_ERROR_CODES or functions called by this function for other possible return codes. This
+ *             function calls:
+ *               * @ref transfer_api_t::reconfigure
+ **********************************************************************************************************************/
+fsp_err_t R_SDHI_RequestSubmit (sdmmc_ctrl_t * const p_api_ctrl, sdhi_request_t * const p_request)
+{
+    sdhi_instance_ctrl_t * p_ctrl = (sdhi_instance_ctrl_t *) p_api_ctrl;
+
+#if SDHI_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ASSERT(NULL != p_request);
+    FSP_ASSERT(NULL != p_request->p_segments);
+    FSP_ASSERT(0U != p_request->num_segments);
+    FSP_ERROR_RETURN(SDHI_PRV_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+    FSP_ASSERT((SDHI_REQUEST_STATUS_QUEUED != p_request->status) &&
+               (SDHI_REQUEST_STATUS_ACTIVE != p_request->status));
+
+    uint32_t sector_count = 0U;
+    for (uint32_t i = 0U; i < p_request->num_segments; i++)
+    {
+        /* The DMA writes segment buffers directly, so the unaligned access workaround can't be used. */
+        FSP_ASSERT(NULL != p_request->p_segments[i].p_buffer);
+        FSP_ASSERT(0U == ((uint32_t) p_request->p_segments[i].p_buffer & 0x3U));
+        FSP_ASSERT(0U != p_request->p_segments[i].sector_count);
+        sector_count += p_request->p_segments[i].sector_count;
+    }
+
+    if (r_sdhi_request_is_io(p_request))
+    {
+        /* All segments of an SDIO request are transferred with one CMD53. */
+        FSP_ASSERT(sector_count <= SDHI_PRV_SDIO_EXT_MAX_BLOCKS);
+    }
+    else
+    {
+        FSP_ASSERT(sector_count <= (UINT16_MAX + 1));
+    }
+#endif
+
+#if SDHI_CFG_SD_SUPPORT_ENABLE || SDHI_CFG_SDIO_SUPPORT_ENABLE
+
+    /* Verify the card has not been removed since the last card initialization. */
+    FSP_ERROR_RETURN(p_ctrl->initialized, FSP_ERR_CARD_NOT_INITIALIZED);
+#endif
+
+    /* SDIO requests are only supported on SDIO devices, and memory requests only on SD cards and eMMC devices. */
+    FSP_ERROR_RETURN(r_sdhi_request_is_io(p_request) == (SDMMC_CARD_TYPE_SDIO == p_ctrl->device.card_type),
+                     FSP_ERR_UNSUPPORTED);
+
+    /* The next segment is configured from the DTC transfer interrupt. DMAC has no such interrupt, so the request
+     * would stall after the first segment. */
+    FSP_ERROR_RETURN((1U == p_request->num_segments) || (p_ctrl->p_cfg->dma_req_irq >= 0), FSP_ERR_UNSUPPORTED);
+
+    if (SDHI_REQUEST_OP_WRITE == p_request->op)
+    {
+        /* Check for write protection */
+        FSP_ERROR_RETURN(!p_ctrl->device.write_protected, FSP_ERR_CARD_WRITE_PROTECTED);
+    }
+
+    fsp_err_t err = FSP_SUCCESS;
+
+    p_request->p_next = NULL;
+    p_request->event  = (sdmmc_event_t) 0U;
+
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+
+    /* Requests are only queued behind other queued requests. A direct read, write or erase must end first. */
+    bool idle = (NULL == p_ctrl->p_request_active);
+    if (idle &&
+        (SDHI_PRV_SD_INFO2_CBSY_SDD0MON_IDLE_VAL !=
+         (p_ctrl->p_reg->SD_INFO2 & SDHI_PRV_SD_INFO2_CBSY_SDD0MON_IDLE_MASK)))
+    {
+        FSP_CRITICAL_SECTION_EXIT;
+
+        return FSP_ERR_DEVICE_BUSY;
+    }
+
+    p_request->status = SDHI_REQUEST_STATUS_QUEUED;
+    if (NULL == p_ctrl->p_request_tail)
+    {
+        p_ctrl->p_request_head = p_request;
+    }
+    else
+    {
+        p_ctrl->p_request_tail->p_next = p_request;
+    }
+
+    p_ctrl->p_request_tail = p_request;
+
+    /* Start the request now if no request is active. Otherwise the access interrupt starts it when the requests
+     * ahead of it are complete. */
+    if (idle)
+    {
+        err = r_sdhi_request_start(p_ctrl);
+    }
+
+    FSP_CRITICAL_SECTION_EXIT;
+
+    return err;
+}
+
+/*******************************************************************************************************************//**
+ * Re-enables the SDIO card interrupt after it was serviced.
+ *
+ * If SDHI_CFG_SDIO_INT_ACKNOWLEDGE_ENABLE is set, the SDIO interrupt masks the card interrupt before the callback with
+ * the event SDMMC_EVENT_SDIO is called, so a card that holds its interrupt asserted does not interrupt again until the
+ * application has read and cleared the interrupt source, for example with R_SDHI_RequestSubmit(). Call this function
+ * afterwards to receive the next card interrupt. This function only writes a register and can be called from any
+ * context, including the callback.
+ *
+ * @retval     FSP_SUCCESS          Card interrupt re-enabled, or SDIO interrupts are disabled.
+ * @retval     FSP_ERR_NOT_OPEN     Driver has not been initialized.
+ * @retval     FSP_ERR_ASSERTION    NULL pointer.
+ * @retval     FSP_ERR_UNSUPPORTED  SDIO support disabled in SDHI_CFG_SDIO_SUPPORT_ENABLE.
+ **********************************************************************************************************************/
+fsp_err_t R_SDHI_IoIntAcknowledge (sdmmc_ctrl_t * const p_api_ctrl)
+{
+#if SDHI_CFG_SDIO_SUPPORT_ENABLE
+    sdhi_instance_ctrl_t * p_ctrl = (sdhi_instance_ctrl_t *) p_api_ctrl;
+
+ #if SDHI_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+
+    FSP_ERROR_RETURN(SDHI_PRV_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+ #endif
+
+    /* Leave the interrupt masked if it was disabled with R_SDHI_IoIntEnable(). The SDIO interrupt can't set the mask
+     * bit while it is set, so no critical section is needed. */
+    if (1U == p_ctrl->p_reg->SDIO_MODE)
+    {
+        p_ctrl->p_reg->SDIO_INFO1_MASK &= ~SDHI_PRV_SDIO_INFO1_IOIRQ;
+    }
+
+    return FSP_SUCCESS;
+#else
+    FSP_PARAMETER_NOT_USED(p_api_ctrl);
+
+    FSP_RETURN(FSP_ERR_UNSUPPORTED);
+#endif
+}
+
+/*******************************************************************************************************************//**
+ * Writes the content of the eMMC device cache to the flash (CMD6 FLUSH_CACHE).
+ *
+ * The cache is turned on by R_SDHI_MediaInit() if SDHI_CFG_EMMC_CACHE_ENABLE is set and the device reports a cache in
+ * EXT_CSD. Data in the cache is lost on power loss, so call this function before removing power and at points where
+ * written data must be durable. This function blocks until the device has finished flushing the cache.
+ *
+ * @retval     FSP_SUCCESS                   Cache flushed, or the cache is not enabled.
+ * @retval     FSP_ERR_ASSERTION             NULL pointer.
+ * @retval     FSP_ERR_NOT_OPEN              Driver has not been initialized.
+ * @retval     FSP_ERR_CARD_NOT_INITIALIZED  Card was unplugged.
+ * @retval     FSP_ERR_UNSUPPORTED           The device is not an eMMC device.
+ * @retval     FSP_ERR_RESPONSE              Device did not respond or responded with an error.
+ * @retval     FSP_ERR_DEVICE_BUSY           Driver is busy with a previous operation, or the flush did not finish
+ *                                           within the busy timeout.
+ **********************************************************************************************************************/
+fsp_err_t R_SDHI_CacheFlush (sdmmc_ctrl_t * const p_api_ctrl)
+{
+    sdhi_instance_ctrl_t * p_ctrl = (sdhi_instance_ctrl_t *) p_api_ctrl;
+
+    fsp_err_t err = r_sdhi_common_error_check(p_ctrl);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+    FSP_ERROR_RETURN(SDMMC_CARD_TYPE_MMC == p_ctrl->device.card_type, FSP_ERR_UNSUPPORTED);
+
+    if (p_ctrl->emmc_cache_enabled)
+    {
+        err = r_sdhi_command_send(p_ctrl, SDHI_PRV_EMMC_CMD_SWITCH_WBUSY, SDHI_PRV_EMMC_CACHE_FLUSH);
+        FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+        /* The device holds DAT0 low until the cache is written to the flash. */
+        err = r_sdhi_wait_for_device(p_ctrl);
+    }
+
+    return err;
+}
+
 /*******************************************************************************************************************//**
  * @} (end addtogroup SDMMC)
  **********************************************************************************************************************/
@@ -1272,6 +1527,9 @@ static fsp_err_t r_sdhi_common_error_check (sdhi_instance_ctrl_t * const p_ctrl)
                      (p_ctrl->p_reg->SD_INFO2 & SDHI_PRV_SD_INFO2_CBSY_SDD0MON_IDLE_MASK),
                      FSP_ERR_DEVICE_BUSY);
 
+    /* Queued requests own the bus until the queue is empty. */
+    FSP_ERROR_RETURN(NULL == p_ctrl->p_request_active, FSP_ERR_DEVICE_BUSY);
+
 #if SDHI_CFG_SD_SUPPORT_ENABLE || SDHI_CFG_SDIO_SUPPORT_ENABLE
 
     /* Verify the card has not been removed since the last card initialization. */
@@ -1341,15 +1599,39 @@ static void r_sdhi_access_irq_process (sdhi_instance_ctrl_t * p_ctrl, sdmmc_call
     /* Combine all flags in one 32 bit word. */
     flags.word = (info1 | (info2 << 16));
 
+#if SDHI_CFG_SD_SUPPORT_ENABLE || SDHI_CFG_EMMC_SUPPORT_ENABLE
+    if (flags.bit.response_end && (SDHI_PRV_PRE_ERASE_NONE != p_ctrl->request_pre_erase) &&
+        (0U == (flags.word & SDHI_PRV_ACCESS_ERROR_MASK)))
+    {
+        /* Continue the ACMD23 sequence before a queued SD write, or send the data command after CMD23 for a queued
+         * eMMC transfer. These responses are not reported to the application. */
+        if (SDHI_PRV_PRE_ERASE_APP_CMD == p_ctrl->request_pre_erase)
+        {
+            p_ctrl->request_pre_erase = SDHI_PRV_PRE_ERASE_COUNT;
+            r_sdhi_command_send_no_wait(p_ctrl,
+                                        SDHI_PRV_CMD_C_ACMD | SDHI_PRV_CMD_SET_WR_BLK_ERASE_COUNT,
+                                        p_ctrl->request_sector_count);
+        }
+        else
+        {
+            p_ctrl->request_pre_erase = SDHI_PRV_PRE_ERASE_NONE;
+            r_sdhi_request_command_send(p_ctrl);
+        }
+
+        return;
+    }
+#endif
+
     if (flags.bit.response_end)
     {
         p_args->event |= SDMMC_EVENT_RESPONSE;
 
         /* Check the R1 response. */
-        if (1U == p_ctrl->p_reg->SD_STOP_b.SEC)
+        if ((1U == p_ctrl->p_reg->SD_STOP_b.SEC) && (0U == p_ctrl->p_reg->SD_CMD_b.CMD12AT))
         {
             /* Get the R1 response for multiple block read and write from SD_RSP54 since the response in SD_RSP10 may
-             * have been overwritten by the response to CMD12. */
+             * have been overwritten by the response to CMD12. CMD12 is not sent after CMD53 or after a transfer with
+             * a block count set by CMD23. */
             p_args->response.status = p_ctrl->p_reg->SD_RSP54;
         }
         else
@@ -1409,6 +1691,23 @@ static void r_sdhi_access_irq_process (sdhi_instance_ctrl_t * p_ctrl, sdmmc_call
 
     /* Combine all events for each command because this flag is polled in some functions. */
     p_ctrl->sdhi_event.word |= flags.word;
+
+    if (NULL != p_ctrl->p_request_active)
+    {
+        if (p_args->event & SDMMC_EVENT_TRANSFER_ERROR)
+        {
+            r_sdhi_request_complete(p_ctrl, SDMMC_EVENT_TRANSFER_ERROR);
+        }
+        else if (p_args->event & SDMMC_EVENT_TRANSFER_COMPLETE)
+        {
+            /* Start the next queued request before the callback is called. */
+            r_sdhi_request_complete(p_ctrl, SDMMC_EVENT_TRANSFER_COMPLETE);
+        }
+        else
+        {
+            /* Response to the data command. The transfer is still in progress. */
+        }
+    }
 }
 
 /*******************************************************************************************************************//**
@@ -1665,6 +1964,7 @@ static fsp_err_t r_sdhi_bus_cfg (sdhi_instance_ctrl_t * const p_ctrl)
     uint32_t  rca;
     fsp_err_t err = r_sdhi_rca_get(p_ctrl, &rca);
     FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+    p_ctrl->rca = rca;
 
 #if SDHI_CFG_SDIO_SUPPORT_ENABLE
 
@@ -1729,6 +2029,22 @@ static fsp_err_t r_sdhi_bus_cfg (sdhi_instance_ctrl_t * const p_ctrl)
         /* Set bus width. */
         err = r_sdhi_bus_width_set(p_ctrl, rca);
         FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+ #if SDHI_CFG_EMMC_SUPPORT_ENABLE && SDHI_CFG_EMMC_CACHE_ENABLE
+        p_ctrl->emmc_cache_enabled = false;
+        if ((SDMMC_CARD_TYPE_MMC == p_ctrl->device.card_type) && (p_ctrl->emmc_cache_size > 0U))
+        {
+            /* Turn on the device cache (CMD6). Writes are acknowledged once they are in the cache, and
+             * R_SDHI_CacheFlush() commits them to the flash. */
+            err = r_sdhi_command_send(p_ctrl, SDHI_PRV_EMMC_CMD_SWITCH_WBUSY, SDHI_PRV_EMMC_CACHE_ON);
+            FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+            err = r_sdhi_wait_for_device(p_ctrl);
+            FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+            p_ctrl->emmc_cache_enabled = true;
+        }
+ #endif
 #endif
     }
 
@@ -2326,8 +2642,8 @@ static fsp_err_t r_sdhi_csd_save (sdhi_instance_ctrl_t * const p_ctrl,
  * @param[in]  rca                  Relative card address
  * @param[out] p_device_type        Pointer to store device type, which is used to determine if high speed is supported.
  *
- * @retval     FSP_SUCCESS          Device type obtained from eMMC extended CSD.  Sector count is also calculated here
- *                                  if it was not determined previously.
+ * @retval     FSP_SUCCESS          Device type and cache size obtained from eMMC extended CSD.  Sector count is also
+ *                                  calculated here if it was not determined previously.
  * @retval     FSP_ERR_RESPONSE     Device did not respond or responded with an error.
  **********************************************************************************************************************/
 static fsp_err_t r_sdhi_csd_extended_get (sdhi_instance_ctrl_t * const p_ctrl, uint32_t rca, uint8_t * p_device_type)
@@ -2346,6 +2662,13 @@ static fsp_err_t r_sdhi_csd_extended_get (sdhi_instance_ctrl_t * const p_ctrl, u
         p_ctrl->device.sector_count = p_ctrl->aligned_buff[SDHI_PRV_EMMC_EXT_CSD_SEC_COUNT_OFFSET / sizeof(uint32_t)];
     }
 
+    /* Store the cache size. It is 0 if the device has no cache. */
+    p_ctrl->emmc_cache_size = 0U;
+    for (uint32_t i = 0U; i < 4U; i++)
+    {
+        p_ctrl->emmc_cache_size |= (uint32_t) p_read_data_8[SDHI_PRV_EMMC_EXT_CSD_CACHE_SIZE_OFFSET + i] << (8U * i);
+    }
+
     return FSP_SUCCESS;
 }
 
@@ -2494,6 +2817,24 @@ static fsp_err_t r_sdhi_bus_width_set (sdhi_instance_ctrl_t * const p_ctrl, uint
  **********************************************************************************************************************/
 void r_sdhi_transfer_callback (sdhi_instance_ctrl_t * p_ctrl)
 {
+    sdhi_request_t const * p_request = p_ctrl->p_request_active;
+    if (NULL != p_request)
+    {
+        /* A segment of a queued request is complete. The card waits with the next block in the SD buffer until the
+         * transfer for the next segment is configured. */
+        if ((p_ctrl->request_segment + 1U) < p_request->num_segments)
+        {
+            p_ctrl->request_segment++;
+            if (FSP_SUCCESS != r_sdhi_request_segment_transfer(p_ctrl))
+            {
+                /* Stop the command. The access interrupt reports the error. */
+                p_ctrl->p_reg->SD_STOP_b.STP = 1U;
+            }
+        }
+
+        return;
+    }
+
 #if SDMMC_CFG_UNALIGNED_ACCESS_ENABLE
     if (p_ctrl->transfer_blocks_total != p_ctrl->transfer_block_current)
     {
@@ -2532,8 +2873,6 @@ void r_sdhi_transfer_callback (sdhi_instance_ctrl_t * p_ctrl)
         }
     }
 
-#else
-    FSP_PARAMETER_NOT_USED(p_ctrl);
 #endif
 }
 
@@ -2688,6 +3027,244 @@ static void r_sdhi_transfer_end (sdhi_instance_ctrl_t * const p_ctrl)
     p_ctrl->p_reg->SD_DMAEN = 0U;
 }
 
+/*******************************************************************************************************************//**
+ * Starts the request at the head of the queue. Called with the access interrupt masked.
+ *
+ * @param[in]  p_ctrl       Pointer to the instance control block.
+ *
+ * @retval     FSP_SUCCESS  Command sent, or no request queued.
+ * @return     See @ref RENESAS_ERROR_CODES or functions called by this function for other possible return codes. This
+ *             function calls:
+ *               * @ref transfer_api_t::reconfigure
+ **********************************************************************************************************************/
+static fsp_err_t r_sdhi_request_start (sdhi_instance_ctrl_t * const p_ctrl)
+{
+    sdhi_request_t * p_request = p_ctrl->p_request_head;
+    if (NULL == p_request)
+    {
+        return FSP_SUCCESS;
+    }
+
+    p_ctrl->p_request_head = p_request->p_next;
+    if (NULL == p_ctrl->p_request_head)
+    {
+        p_ctrl->p_request_tail = NULL;
+    }
+
+    p_ctrl->p_request_active     = p_request;
+    p_ctrl->request_segment      = 0U;
+    p_ctrl->request_sector_count = 0U;
+    p_request->status            = SDHI_REQUEST_STATUS_ACTIVE;
+
+    for (uint32_t i = 0U; i < p_request->num_segments; i++)
+    {
+        p_ctrl->request_sector_count += p_request->p_segments[i].sector_count;
+    }
+
+    /* Configure the transfer for the first segment. The transfer interrupt moves to the following segments. */
+    fsp_err_t err = r_sdhi_request_segment_transfer(p_ctrl);
+    if (FSP_SUCCESS != err)
+    {
+        r_sdhi_request_complete(p_ctrl, SDMMC_EVENT_TRANSFER_ERROR);
+
+        return err;
+    }
+
+#if SDHI_CFG_SD_SUPPORT_ENABLE
+    if ((SDHI_REQUEST_OP_WRITE == p_request->op) && p_request->pre_erase &&
+        (SDMMC_CARD_TYPE_SD == p_ctrl->device.card_type))
+    {
+        /* Send CMD55 here. The access interrupt sends ACMD23 and then CMD25 after each response. */
+        p_ctrl->request_pre_erase = SDHI_PRV_PRE_ERASE_APP_CMD;
+        r_sdhi_command_send_no_wait(p_ctrl, SDHI_PRV_CMD_APP_CMD, p_ctrl->rca << 16);
+
+        return FSP_SUCCESS;
+    }
+#endif
+
+#if SDHI_CFG_EMMC_SUPPORT_ENABLE
+    if ((SDMMC_CARD_TYPE_MMC == p_ctrl->device.card_type) && (p_ctrl->request_sector_count > 1U))
+    {
+        /* Send CMD23 with the block count so the device knows the length of the transfer in advance and CMD12 is not
+         * needed. The access interrupt sends CMD18 or CMD25 after the response. */
+        uint32_t argument = p_ctrl->request_sector_count;
+        if ((SDHI_REQUEST_OP_WRITE == p_request->op) && p_request->reliable_write)
+        {
+            argument |= SDHI_PRV_EMMC_SET_BLOCK_COUNT_RELIABLE_WRITE;
+        }
+
+        p_ctrl->request_pre_erase = SDHI_PRV_PRE_ERASE_COUNT;
+        r_sdhi_command_send_no_wait(p_ctrl, SDHI_PRV_EMMC_CMD_SET_BLOCK_COUNT, argument);
+
+        return FSP_SUCCESS;
+    }
+#endif
+
+    r_sdhi_request_command_send(p_ctrl);
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Sends the multi-block read or write command for the active request.
+ *
+ * @param[in]  p_ctrl       Pointer to the instance control block.
+ **********************************************************************************************************************/
+static void r_sdhi_request_command_send (sdhi_instance_ctrl_t * const p_ctrl)
+{
+    sdhi_request_t * p_request = p_ctrl->p_request_active;
+
+#if SDHI_CFG_SDIO_SUPPORT_ENABLE
+    if (r_sdhi_request_is_io(p_request))
+    {
+        uint32_t io_command = SDHI_PRV_CMD_IO_READ_EXT_SINGLE_BLOCK;
+        if (SDHI_REQUEST_OP_IO_WRITE == p_request->op)
+        {
+            io_command = SDHI_PRV_CMD_IO_WRITE_EXT_SINGLE_BLOCK;
+        }
+
+        if (p_ctrl->request_sector_count > 1U)
+        {
+            io_command |= SDHI_PRV_CMD_IO_EXT_MULTI_BLOCK;
+        }
+
+        sdmmc_priv_sdio_arg_t io_argument = {0U};
+        io_argument.cmd_53_arg.count            = (p_ctrl->request_sector_count & SDHI_PRV_SDIO_CMD52_CMD53_COUNT_MASK);
+        io_argument.cmd_53_arg.function_number  = (p_request->io_function & SDHI_PRV_SDIO_CMD52_CMD53_FUNCTION_MASK);
+        io_argument.cmd_53_arg.block_mode       = SDMMC_IO_MODE_TRANSFER_BLOCK;
+        io_argument.cmd_53_arg.op_code          = p_request->io_address_mode;
+        io_argument.cmd_53_arg.register_address = (p_request->start_sector & SDHI_PRV_SDIO_CMD52_CMD53_ADDRESS_MASK);
+        io_argument.cmd_53_arg.rw_flag          = (SDHI_REQUEST_OP_IO_WRITE == p_request->op) ? 1U : 0U;
+        r_sdhi_read_write_common(p_ctrl,
+                                 p_ctrl->request_sector_count,
+                                 p_ctrl->p_cfg->block_size,
+                                 io_command,
+                                 io_argument.arg);
+
+        return;
+    }
+#endif
+
+    uint32_t argument = p_request->start_sector;
+    if (!p_ctrl->sector_addressing)
+    {
+        /* Standard capacity SD cards and some eMMC devices use byte addressing. */
+        argument *= p_ctrl->p_cfg->block_size;
+    }
+
+    uint32_t command;
+#if SDHI_CFG_EMMC_SUPPORT_ENABLE
+    if ((SDMMC_CARD_TYPE_MMC == p_ctrl->device.card_type) && (p_ctrl->request_sector_count > 1U))
+    {
+        /* The block count was set with CMD23, so CMD12 must not be sent automatically. */
+        command = (SDHI_REQUEST_OP_WRITE == p_request->op) ?
+                  SDHI_PRV_EMMC_CMD_WRITE_MULTIPLE_PREDEFINED : SDHI_PRV_EMMC_CMD_READ_MULTIPLE_PREDEFINED;
+    }
+    else
+#endif
+    if (SDHI_REQUEST_OP_WRITE == p_request->op)
+    {
+        command = (p_ctrl->request_sector_count > 1U) ?
+                  SDHI_PRV_CMD_WRITE_MULTIPLE_BLOCK : SDHI_PRV_CMD_WRITE_SINGLE_BLOCK;
+    }
+    else
+    {
+        command = (p_ctrl->request_sector_count > 1U) ?
+                  SDHI_PRV_CMD_READ_MULTIPLE_BLOCK : SDHI_PRV_CMD_READ_SINGLE_BLOCK;
+    }
+
+    r_sdhi_read_write_common(p_ctrl, p_ctrl->request_sector_count, p_ctrl->p_cfg->block_size, command, argument);
+}
+
+/*******************************************************************************************************************//**
+ * Configures the transfer driver for the current segment of the active request.
+ *
+ * @param[in]  p_ctrl       Pointer to the instance control block.
+ *
+ * @retval     FSP_SUCCESS  Transfer configured.
+ * @return     See @ref RENESAS_ERROR_CODES or functions called by this function for other possible return codes. This
+ *             function calls:
+ *               * @ref transfer_api_t::reconfigure
+ **********************************************************************************************************************/
+static fsp_err_t r_sdhi_request_segment_transfer (sdhi_instance_ctrl_t * const p_ctrl)
+{
+    sdhi_request_t const * p_request = p_ctrl->p_request_active;
+    sdhi_segment_t const * p_segment = &p_request->p_segments[p_ctrl->request_segment];
+
+    if (r_sdhi_request_is_write(p_request))
+    {
+        return r_sdhi_transfer_write(p_ctrl, p_segment->sector_count, p_ctrl->p_cfg->block_size, p_segment->p_buffer);
+    }
+
+    return r_sdhi_transfer_read(p_ctrl, p_segment->sector_count, p_ctrl->p_cfg->block_size, p_segment->p_buffer);
+}
+
+/*******************************************************************************************************************//**
+ * Completes the active request and starts the next one. After an error, all queued requests are completed with the
+ * error.
+ *
+ * @param[in]  p_ctrl       Pointer to the instance control block.
+ * @param[in]  event        SDMMC_EVENT_TRANSFER_COMPLETE or SDMMC_EVENT_TRANSFER_ERROR
+ **********************************************************************************************************************/
+static void r_sdhi_request_complete (sdhi_instance_ctrl_t * const p_ctrl, sdmmc_event_t event)
+{
+    sdhi_request_t * p_request = p_ctrl->p_request_active;
+
+    p_ctrl->p_request_active  = NULL;
+    p_ctrl->request_pre_erase = SDHI_PRV_PRE_ERASE_NONE;
+
+    if (NULL != p_request)
+    {
+        p_request->event  = event;
+        p_request->status = SDHI_REQUEST_STATUS_COMPLETE;
+    }
+
+    if (SDMMC_EVENT_TRANSFER_ERROR == event)
+    {
+        /* The card state is unknown after an error. Don't start the queued requests. */
+        while (NULL != p_ctrl->p_request_head)
+        {
+            p_request              = p_ctrl->p_request_head;
+            p_ctrl->p_request_head = p_request->p_next;
+            p_request->event       = SDMMC_EVENT_TRANSFER_ERROR;
+            p_request->status      = SDHI_REQUEST_STATUS_COMPLETE;
+        }
+
+        p_ctrl->p_request_tail = NULL;
+    }
+    else
+    {
+        /* Errors starting the next request are reported in that request. */
+        (void) r_sdhi_request_start(p_ctrl);
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Checks whether a request transfers SDIO blocks with CMD53.
+ *
+ * @param[in]  p_request    Pointer to the request.
+ *
+ * @retval     true         SDHI_REQUEST_OP_IO_READ or SDHI_REQUEST_OP_IO_WRITE.
+ * @retval     false        SD or eMMC sector request.
+ **********************************************************************************************************************/
+static bool r_sdhi_request_is_io (sdhi_request_t const * const p_request)
+{
+    return (SDHI_REQUEST_OP_IO_READ == p_request->op) || (SDHI_REQUEST_OP_IO_WRITE == p_request->op);
+}
+
+/*******************************************************************************************************************//**
+ * Checks whether a request writes to the device.
+ *
+ * @param[in]  p_request    Pointer to the request.
+ *
+ * @retval     true         SDHI_REQUEST_OP_WRITE or SDHI_REQUEST_OP_IO_WRITE.
+ * @retval     false        Read request.
+ **********************************************************************************************************************/
+static bool r_sdhi_request_is_write (sdhi_request_t const * const p_request)
+{
+    return (SDHI_REQUEST_OP_WRITE == p_request->op) || (SDHI_REQUEST_OP_IO_WRITE == p_request->op);
+}
+
 /*******************************************************************************************************************//**
  * Calls user callback
  *
@@ -2696,6 +3273,8 @@ static void r_sdhi_transfer_end (sdhi_instance_ctrl_t * const p_ctrl)
  **********************************************************************************************************************/
 static void r_sdhi_call_callback (sdhi_instance_ctrl_t * p_ctrl, sdmmc_callback_args_t * p_args)
 {
+    BSP_TRACE(FSP_IP_SDHI, p_ctrl->p_cfg->channel, p_args->event, 0U);
+
     /* Call user callback if provided, if an event was determined, and if the driver is initialized. */
     if (NULL != p_ctrl->p_callback)
     {
@@ -2869,6 +3448,13 @@ void sdhimmc_sdio_isr (void)
     {
         /* I/O interrupt requested by device. */
         args.event |= SDMMC_EVENT_SDIO;
+
+#if SDHI_CFG_SDIO_INT_ACKNOWLEDGE_ENABLE
+
+        /* The card holds the interrupt until its source is cleared. Mask it until the application has serviced the
+         * card and called R_SDHI_IoIntAcknowledge(). */
+        p_ctrl->p_reg->SDIO_INFO1_MASK |= SDHI_PRV_SDIO_INFO1_IOIRQ;
+#endif
     }
 
     /* Call user callback */
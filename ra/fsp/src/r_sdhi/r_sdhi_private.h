@@ -48,6 +48,7 @@ FSP_HEADER
 #define SDHI_PRV_CMD_SET_BLOCKLEN                       (16U)
 #define SDHI_PRV_CMD_READ_SINGLE_BLOCK                  (17U)
 #define SDHI_PRV_CMD_READ_MULTIPLE_BLOCK                (18U)
+#define SDHI_PRV_CMD_SET_WR_BLK_ERASE_COUNT             (23U)
 #define SDHI_PRV_CMD_WRITE_SINGLE_BLOCK                 (24U)
 #define SDHI_PRV_CMD_WRITE_MULTIPLE_BLOCK               (25U)
 #define SDHI_PRV_CMD_ERASE_WR_BLK_START                 (32U)
@@ -95,9 +96,12 @@ FSP_HEADER
 #define SDHI_PRV_EMMC_EXT_CSD_SIZE                      (512U)
 
 /* Offsets */
+#define SDHI_PRV_EMMC_EXT_CSD_FLUSH_CACHE_OFFSET        (32U)
+#define SDHI_PRV_EMMC_EXT_CSD_CACHE_CTRL_OFFSET         (33U)
 #define SDHI_PRV_EMMC_EXT_CSD_HS_TIMING_OFFSET          (185U)
 #define SDHI_PRV_EMMC_EXT_CSD_DEVICE_TYPE_OFFSET        (196U)
 #define SDHI_PRV_EMMC_EXT_CSD_SEC_COUNT_OFFSET          (212U)
+#define SDHI_PRV_EMMC_EXT_CSD_CACHE_SIZE_OFFSET         (249U)
 
 /* Commands */
 #define SDHI_PRV_EMMC_SWITCH_ACCESS_WRITE_BYTE          (3U)
@@ -105,6 +109,13 @@ FSP_HEADER
 #define SDHI_PRV_EMMC_HIGH_SPEED_MODE                   (((SDHI_PRV_EMMC_SWITCH_ACCESS_WRITE_BYTE << 24U) |  \
                                                           (SDHI_PRV_EMMC_EXT_CSD_HS_TIMING_OFFSET << 16U)) | \
                                                          (SDHI_PRV_EMMC_HIGH_SPEED_52_MHZ_BIT << 8U))
+#define SDHI_PRV_EMMC_CACHE_ON                          (((SDHI_PRV_EMMC_SWITCH_ACCESS_WRITE_BYTE << 24U) |   \
+                                                          (SDHI_PRV_EMMC_EXT_CSD_CACHE_CTRL_OFFSET << 16U)) | \
+                                                         (1U << 8U))
+#define SDHI_PRV_EMMC_CACHE_FLUSH                       (((SDHI_PRV_EMMC_SWITCH_ACCESS_WRITE_BYTE << 24U) |    \
+                                                          (SDHI_PRV_EMMC_EXT_CSD_FLUSH_CACHE_OFFSET << 16U)) | \
+                                                         (1U << 8U))
+#define SDHI_PRV_EMMC_SET_BLOCK_COUNT_RELIABLE_WRITE    (1U << 31U)
 
 #define SDHI_PRV_SD_SWITCH_STATUS_SIZE                  (64U)
 #define SDHI_PRV_SD_SWITCH_HIGH_SPEED_RESPONSE          (13U)
@@ -115,6 +126,9 @@ FSP_HEADER
 #define SDHI_PRV_EMMC_SEND_OP_COND                      (0x701U)
 #define SDHI_PRV_EMMC_CMD_SWITCH_WBUSY                  (0x506U)      /* eMMC CMD6 switch command "with response busy" */
 #define SDHI_PRV_EMMC_CMD_SEND_EXT_CSD                  (0x1C08U)     /* CMD 8, read data */
+#define SDHI_PRV_EMMC_CMD_SET_BLOCK_COUNT               (0x0417U)     /* CMD 23, R1 response */
+#define SDHI_PRV_EMMC_CMD_READ_MULTIPLE_PREDEFINED      (0x7C12U)     /* CMD 18, read data, no automatic CMD12 */
+#define SDHI_PRV_EMMC_CMD_WRITE_MULTIPLE_PREDEFINED     (0x6C19U)     /* CMD 25, write data, no automatic CMD12 */
 #define SDHI_PRV_EMMC_DEFAULT_CLOCK_RATE                (26000000U)   /* 26 MHz */
 #define SDHI_PRV_EMMC_HIGH_SPEED_CLOCK_RATE             (52000000U)   /* 52 MHz */
 #define SDHI_PRV_SD_HIGH_SPEED_MODE_SWITCH              (0x80FFFFF1U) /* set SD high speed */
@@ -40,6 +40,23 @@
 #define SLCDC_PRV_VLCD_CONTRAST_OFFSET      (4)
 #define SLCDC_PRV_CONTRAST_MAX_4BIAS        (SLCDC_CONTRAST_6)
 
+/* Shadow buffer DTC settings. Each activation copies one block of segment data, and the block area returns to the
+ * first segment register after every block. */
+#define SLCDC_PRV_DTC_DISPLAY_SETTINGS      ((TRANSFER_MODE_BLOCK << 30U) | (TRANSFER_SIZE_1_BYTE << 28U) |         \
+                                             (TRANSFER_ADDR_MODE_INCREMENTED << 26U) | (TRANSFER_IRQ_END << 21U) | \
+                                             (TRANSFER_REPEAT_AREA_DESTINATION << 20U) |                         \
+                                             (TRANSFER_ADDR_MODE_INCREMENTED << 18U))
+
+/* Single word writes that restore the display transfer at the end of a sequence. Repeat mode never ends. */
+#define SLCDC_PRV_DTC_RELOAD_SETTINGS       ((TRANSFER_MODE_REPEAT << 30U) | (TRANSFER_SIZE_4_BYTE << 28U) | \
+                                             (TRANSFER_ADDR_MODE_FIXED << 26U) | (TRANSFER_IRQ_END << 21U) | \
+                                             (TRANSFER_REPEAT_AREA_SOURCE << 20U) |                        \
+                                             (TRANSFER_ADDR_MODE_FIXED << 18U))
+
+#define SLCDC_PRV_DTC_CRAH_OFFSET           (8U)
+#define SLCDC_PRV_DTC_LENGTH_OFFSET         (16U)
+#define SLCDC_PRV_DTC_NUM_BLOCKS_MASK       (0xFFFFU)
+
 /***********************************************************************************************************************
  * Private function prototypes
  **********************************************************************************************************************/
@@ -50,6 +67,14 @@ static fsp_err_t r_slcdc_check_display_mode(slcdc_cfg_t const * const p_cfg);
 #endif
 
 static fsp_err_t r_slcdc_clock_operation(slcdc_cfg_t const * const p_cfg);
+static bool      r_slcdc_shadow_overlaps(slcdc_instance_ctrl_t * const p_instance_ctrl,
+                                         uint32_t                      start_segment,
+                                         uint32_t                      segment_count);
+static fsp_err_t r_slcdc_shadow_sync(slcdc_instance_ctrl_t * const p_instance_ctrl);
+static void      r_slcdc_shadow_source_set(slcdc_instance_ctrl_t * const p_instance_ctrl,
+                                           uint8_t const * const         p_src,
+                                           uint16_t                      num_frames);
+static uint32_t r_slcdc_shadow_counter_get(uint8_t segment_count, uint16_t num_frames);
 
 /***********************************************************************************************************************
  * Private global variables
@@ -152,7 +177,8 @@ fsp_err_t R_SLCDC_Open (slcdc_ctrl_t * const p_ctrl, slcdc_cfg_t const * const p
 #endif
 
     /* Save a pointer to the config block */
-    p_instance_ctrl->p_cfg = p_cfg;
+    p_instance_ctrl->p_cfg    = p_cfg;
+    p_instance_ctrl->p_shadow = NULL;
 
     /* Set module state to open */
     p_instance_ctrl->open = SLCDC_OPEN;
@@ -167,6 +193,7 @@ fsp_err_t R_SLCDC_Open (slcdc_ctrl_t * const p_ctrl, slcdc_cfg_t const * const p
  * @retval  FSP_ERR_ASSERTION                Pointer to the control block or data is NULL.
  * @retval  FSP_ERR_INVALID_ARGUMENT         Segment index is (or will be) out of range.
  * @retval  FSP_ERR_NOT_OPEN                 Device is not opened or initialized.
+ * @retval  FSP_ERR_IN_USE                   A segment is mirrored by the shadow buffer.
  **********************************************************************************************************************/
 fsp_err_t R_SLCDC_Write (slcdc_ctrl_t * const p_ctrl,
                          uint8_t const        start_segment,
@@ -187,11 +214,11 @@ fsp_err_t R_SLCDC_Write (slcdc_ctrl_t * const p_ctrl,
     {
         return FSP_ERR_INVALID_ARGUMENT;
     }
-
-#else
-    FSP_PARAMETER_NOT_USED(p_instance_ctrl);
 #endif
 
+    /* Segments mirrored by the shadow buffer are written by the DTC until R_SLCDC_ShadowStop() is called */
+    FSP_ERROR_RETURN(!r_slcdc_shadow_overlaps(p_instance_ctrl, start_segment, segment_count), FSP_ERR_IN_USE);
+
     /* Display data is stored in the LCD segment data register array */
     for (uint8_t seg = start_segment; (seg - start_segment) < segment_count; seg++)
     {
@@ -209,6 +236,7 @@ fsp_err_t R_SLCDC_Write (slcdc_ctrl_t * const p_ctrl,
  * @retval  FSP_ERR_ASSERTION                Pointer to the control block structure is NULL.
  * @retval  FSP_ERR_INVALID_ARGUMENT         Invalid parameter in the argument.
  * @retval  FSP_ERR_NOT_OPEN                 Device is not opened or initialized
+ * @retval  FSP_ERR_IN_USE                   The segment is mirrored by the shadow buffer.
  **********************************************************************************************************************/
 fsp_err_t R_SLCDC_Modify (slcdc_ctrl_t * const p_ctrl,
                           uint8_t const        segment,
@@ -225,11 +253,11 @@ fsp_err_t R_SLCDC_Modify (slcdc_ctrl_t * const p_ctrl,
     {
         return FSP_ERR_INVALID_ARGUMENT;
     }
-
-#else
-    FSP_PARAMETER_NOT_USED(p_instance_ctrl);
 #endif
 
+    /* Segments mirrored by the shadow buffer are written by the DTC until R_SLCDC_ShadowStop() is called */
+    FSP_ERROR_RETURN(!r_slcdc_shadow_overlaps(p_instance_ctrl, segment, 1U), FSP_ERR_IN_USE);
+
     /* Mask and write data to segment */
     R_SLCDC->SEG[segment] = (R_SLCDC->SEG[segment] & (uint8_t) (~(data_mask))) | data;
 
@@ -392,6 +420,277 @@ fsp_err_t R_SLCDC_SetDisplayArea (slcdc_ctrl_t * const p_ctrl, slcdc_display_are
     return FSP_SUCCESS;
 }
 
+/*******************************************************************************************************************//**
+ * Starts double-buffered display updates. The display image of segments start_segment to
+ * start_segment + segment_count - 1 is kept in RAM, and each activation of the shadow transfer instance copies the
+ * committed image to the segment data registers in a single DTC block transfer, so a partially staged image is
+ * never displayed and no CPU interrupt is raised.
+ *
+ * Stage changes with R_SLCDC_ShadowWrite() and R_SLCDC_ShadowModify(), then display them at the next activation with
+ * R_SLCDC_ShadowCommit(). R_SLCDC_AnimationStart() displays a table of images instead, one per activation, looping
+ * until the next commit. Blinking between the A- and B-pattern bits of the image still runs in hardware with
+ * R_SLCDC_SetDisplayArea(SLCDC_DISP_BLINK).
+ *
+ * The SLCDC has no frame interrupt, so the copy is synchronized with the RTC periodic interrupt (which also times
+ * blinking) or a timer. To keep animating while the CPU is in Software Standby, enable DTC in Snooze mode and set
+ * the trigger event as a Snooze request.
+ *
+ * @retval  FSP_SUCCESS                      Shadow buffer started with the image currently displayed.
+ * @retval  FSP_ERR_ASSERTION                A pointer is NULL, the buffers are the same or the segment range is
+ *                                           invalid.
+ * @retval  FSP_ERR_NOT_OPEN                 Device is not opened or initialized.
+ * @retval  FSP_ERR_IN_USE                   The shadow buffer is already started.
+ * @return  See @ref RENESAS_ERROR_CODES or functions called by this function for other possible return codes. This
+ *          function calls:
+ *            - @ref transfer_api_t::reconfigure
+ *
+ * @note The transfer instance must be a DTC instance, which chains in hardware.
+ **********************************************************************************************************************/
+fsp_err_t R_SLCDC_ShadowStart (slcdc_ctrl_t * const p_ctrl, slcdc_shadow_cfg_t const * const p_shadow_cfg)
+{
+    slcdc_instance_ctrl_t * p_instance_ctrl = (slcdc_instance_ctrl_t *) p_ctrl;
+
+#if (SLCDC_CFG_PARAM_CHECKING_ENABLE)
+    FSP_ASSERT(p_instance_ctrl);
+    FSP_ASSERT(p_shadow_cfg);
+    FSP_ASSERT(p_shadow_cfg->p_transfer);
+    FSP_ASSERT(p_shadow_cfg->p_buffer[0]);
+    FSP_ASSERT(p_shadow_cfg->p_buffer[1]);
+    FSP_ASSERT(p_shadow_cfg->p_buffer[0] != p_shadow_cfg->p_buffer[1]);
+    FSP_ASSERT(0U != p_shadow_cfg->segment_count);
+    FSP_ASSERT(BSP_FEATURE_SLCDC_MAX_NUM_SEG >= (p_shadow_cfg->start_segment + p_shadow_cfg->segment_count));
+    FSP_ERROR_RETURN(SLCDC_CLOSED != p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+
+    FSP_ERROR_RETURN(NULL == p_instance_ctrl->p_shadow, FSP_ERR_IN_USE);
+
+    uint8_t volatile * p_seg = &R_SLCDC->SEG[p_shadow_cfg->start_segment];
+
+    /* Start from the image currently displayed */
+    for (uint32_t i = 0U; i < p_shadow_cfg->segment_count; i++)
+    {
+        p_shadow_cfg->p_buffer[0][i] = p_seg[i];
+        p_shadow_cfg->p_buffer[1][i] = p_seg[i];
+    }
+
+    p_instance_ctrl->p_shadow_front    = p_shadow_cfg->p_buffer[0];
+    p_instance_ctrl->p_shadow_back     = p_shadow_cfg->p_buffer[1];
+    p_instance_ctrl->p_shadow_busy     = NULL;
+    p_instance_ctrl->shadow_busy_bytes = 0U;
+    p_instance_ctrl->shadow_back_stale = false;
+    p_instance_ctrl->shadow_reload[0]  = (uint32_t) p_instance_ctrl->p_shadow_front;
+    p_instance_ctrl->shadow_reload[1]  = r_slcdc_shadow_counter_get(p_shadow_cfg->segment_count, 1U);
+
+    /* Copy one image per activation. When the sequence ends, restore the source and block count. */
+    transfer_info_t * p_info = p_instance_ctrl->shadow_info;
+    p_info[0].transfer_settings_word = SLCDC_PRV_DTC_DISPLAY_SETTINGS;
+    p_info[0].chain_mode             = TRANSFER_CHAIN_MODE_END;
+    p_info[0].p_src                  = p_instance_ctrl->p_shadow_front;
+    p_info[0].p_dest                 = (void *) p_seg;
+    p_info[0].num_blocks             = 1U;
+    p_info[0].length                 = p_shadow_cfg->segment_count;
+
+    p_info[1].transfer_settings_word = SLCDC_PRV_DTC_RELOAD_SETTINGS;
+    p_info[1].chain_mode             = TRANSFER_CHAIN_MODE_EACH;
+    p_info[1].p_src                  = (void const *) &p_instance_ctrl->shadow_reload[0];
+    p_info[1].p_dest                 = (void *) &p_info[0].p_src;
+    p_info[1].num_blocks             = 0U;
+    p_info[1].length                 = 1U;
+
+    p_info[2].transfer_settings_word = SLCDC_PRV_DTC_RELOAD_SETTINGS;
+    p_info[2].p_src                  = (void const *) &p_instance_ctrl->shadow_reload[1];
+    p_info[2].p_dest                 = (void *) &p_info[0].num_blocks;
+    p_info[2].num_blocks             = 0U;
+    p_info[2].length                 = 1U;
+
+    fsp_err_t err = p_shadow_cfg->p_transfer->p_api->reconfigure(p_shadow_cfg->p_transfer->p_ctrl, p_info);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+    p_instance_ctrl->p_shadow = p_shadow_cfg;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Writes a sequence of display data to the staged image. The data is displayed after R_SLCDC_ShadowCommit().
+ *
+ * @retval  FSP_SUCCESS                      Data was staged successfully.
+ * @retval  FSP_ERR_ASSERTION                Pointer to the control block or data is NULL.
+ * @retval  FSP_ERR_INVALID_ARGUMENT         A segment is not mirrored by the shadow buffer.
+ * @retval  FSP_ERR_NOT_OPEN                 Device is not opened or initialized.
+ * @retval  FSP_ERR_NOT_ENABLED              The shadow buffer is not started.
+ * @retval  FSP_ERR_IN_USE                   The previous commit has not been displayed yet. Retry after the next
+ *                                           activation of the shadow transfer instance.
+ **********************************************************************************************************************/
+fsp_err_t R_SLCDC_ShadowWrite (slcdc_ctrl_t * const p_ctrl,
+                               uint8_t const        start_segment,
+                               uint8_t const      * p_data,
+                               uint8_t const        segment_count)
+{
+    slcdc_instance_ctrl_t * p_instance_ctrl = (slcdc_instance_ctrl_t *) p_ctrl;
+
+#if (SLCDC_CFG_PARAM_CHECKING_ENABLE)
+    FSP_ASSERT(p_instance_ctrl);
+    FSP_ASSERT(p_data);
+    FSP_ERROR_RETURN(SLCDC_CLOSED != p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+
+    slcdc_shadow_cfg_t const * p_shadow = p_instance_ctrl->p_shadow;
+    FSP_ERROR_RETURN(NULL != p_shadow, FSP_ERR_NOT_ENABLED);
+    FSP_ERROR_RETURN((start_segment >= p_shadow->start_segment) &&
+                     ((start_segment + segment_count) <= (p_shadow->start_segment + p_shadow->segment_count)),
+                     FSP_ERR_INVALID_ARGUMENT);
+
+    fsp_err_t err = r_slcdc_shadow_sync(p_instance_ctrl);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+    memcpy(&p_instance_ctrl->p_shadow_back[start_segment - p_shadow->start_segment], p_data, segment_count);
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Modifies a single segment of the staged image based on a mask and the desired data. The data is displayed after
+ * R_SLCDC_ShadowCommit().
+ *
+ * @retval  FSP_SUCCESS                      Data was staged successfully.
+ * @retval  FSP_ERR_ASSERTION                Pointer to the control block structure is NULL.
+ * @retval  FSP_ERR_INVALID_ARGUMENT         The segment is not mirrored by the shadow buffer.
+ * @retval  FSP_ERR_NOT_OPEN                 Device is not opened or initialized.
+ * @retval  FSP_ERR_NOT_ENABLED              The shadow buffer is not started.
+ * @retval  FSP_ERR_IN_USE                   The previous commit has not been displayed yet. Retry after the next
+ *                                           activation of the shadow transfer instance.
+ **********************************************************************************************************************/
+fsp_err_t R_SLCDC_ShadowModify (slcdc_ctrl_t * const p_ctrl,
+                                uint8_t const        segment,
+                                uint8_t const        data,
+                                uint8_t const        data_mask)
+{
+    slcdc_instance_ctrl_t * p_instance_ctrl = (slcdc_instance_ctrl_t *) p_ctrl;
+
+#if (SLCDC_CFG_PARAM_CHECKING_ENABLE)
+    FSP_ASSERT(p_instance_ctrl);
+    FSP_ERROR_RETURN(SLCDC_CLOSED != p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+
+    slcdc_shadow_cfg_t const * p_shadow = p_instance_ctrl->p_shadow;
+    FSP_ERROR_RETURN(NULL != p_shadow, FSP_ERR_NOT_ENABLED);
+    FSP_ERROR_RETURN((segment >= p_shadow->start_segment) &&
+                     (segment < (p_shadow->start_segment + p_shadow->segment_count)),
+                     FSP_ERR_INVALID_ARGUMENT);
+
+    fsp_err_t err = r_slcdc_shadow_sync(p_instance_ctrl);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+    /* Mask and write data to the staged segment */
+    uint8_t * p_seg = &p_instance_ctrl->p_shadow_back[segment - p_shadow->start_segment];
+    *p_seg = (uint8_t) ((*p_seg & (uint8_t) (~(data_mask))) | data);
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Displays the staged image at the next activation of the shadow transfer instance. If an animation is running, it
+ * stops after its current frame. The staged image is kept so that the next changes can be made on top of it.
+ *
+ * @retval  FSP_SUCCESS                      Image committed.
+ * @retval  FSP_ERR_ASSERTION                Pointer to the control block structure is NULL.
+ * @retval  FSP_ERR_NOT_OPEN                 Device is not opened or initialized.
+ * @retval  FSP_ERR_NOT_ENABLED              The shadow buffer is not started.
+ * @retval  FSP_ERR_IN_USE                   The previous commit has not been displayed yet. Retry after the next
+ *                                           activation of the shadow transfer instance.
+ **********************************************************************************************************************/
+fsp_err_t R_SLCDC_ShadowCommit (slcdc_ctrl_t * const p_ctrl)
+{
+    slcdc_instance_ctrl_t * p_instance_ctrl = (slcdc_instance_ctrl_t *) p_ctrl;
+
+#if (SLCDC_CFG_PARAM_CHECKING_ENABLE)
+    FSP_ASSERT(p_instance_ctrl);
+    FSP_ERROR_RETURN(SLCDC_CLOSED != p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+
+    FSP_ERROR_RETURN(NULL != p_instance_ctrl->p_shadow, FSP_ERR_NOT_ENABLED);
+
+    fsp_err_t err = r_slcdc_shadow_sync(p_instance_ctrl);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+    /* Swap the buffers. The old front buffer becomes the staging buffer once the DTC stops reading it. */
+    uint8_t * p_front = p_instance_ctrl->p_shadow_back;
+    p_instance_ctrl->p_shadow_back     = p_instance_ctrl->p_shadow_front;
+    p_instance_ctrl->p_shadow_front    = p_front;
+    p_instance_ctrl->shadow_back_stale = true;
+
+    r_slcdc_shadow_source_set(p_instance_ctrl, p_front, 1U);
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Displays a table of images, one per activation of the shadow transfer instance, and loops until
+ * R_SLCDC_ShadowCommit() is called. Each image is segment_count bytes of segment data in the shadow buffer format.
+ * The table may be in flash and must stay valid until the next commit has been displayed.
+ *
+ * @retval  FSP_SUCCESS                      Animation started.
+ * @retval  FSP_ERR_ASSERTION                Pointer to the control block structure or the table is NULL, or
+ *                                           num_frames is 0.
+ * @retval  FSP_ERR_NOT_OPEN                 Device is not opened or initialized.
+ * @retval  FSP_ERR_NOT_ENABLED              The shadow buffer is not started.
+ * @retval  FSP_ERR_IN_USE                   The previous commit has not been displayed yet. Retry after the next
+ *                                           activation of the shadow transfer instance.
+ **********************************************************************************************************************/
+fsp_err_t R_SLCDC_AnimationStart (slcdc_ctrl_t * const p_ctrl, uint8_t const * const p_frames, uint16_t const num_frames)
+{
+    slcdc_instance_ctrl_t * p_instance_ctrl = (slcdc_instance_ctrl_t *) p_ctrl;
+
+#if (SLCDC_CFG_PARAM_CHECKING_ENABLE)
+    FSP_ASSERT(p_instance_ctrl);
+    FSP_ASSERT(p_frames);
+    FSP_ASSERT(0U != num_frames);
+    FSP_ERROR_RETURN(SLCDC_CLOSED != p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+
+    FSP_ERROR_RETURN(NULL != p_instance_ctrl->p_shadow, FSP_ERR_NOT_ENABLED);
+
+    fsp_err_t err = r_slcdc_shadow_sync(p_instance_ctrl);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+    r_slcdc_shadow_source_set(p_instance_ctrl, p_frames, num_frames);
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Stops double-buffered display updates. The segment data registers keep the image last displayed and can be
+ * written with R_SLCDC_Write() and R_SLCDC_Modify() again.
+ *
+ * @retval  FSP_SUCCESS                      Shadow buffer stopped.
+ * @retval  FSP_ERR_ASSERTION                Pointer to the control block structure is NULL.
+ * @retval  FSP_ERR_NOT_OPEN                 Device is not opened or initialized.
+ * @retval  FSP_ERR_NOT_ENABLED              The shadow buffer is not started.
+ * @return  See @ref RENESAS_ERROR_CODES or functions called by this function for other possible return codes. This
+ *          function calls:
+ *            - @ref transfer_api_t::disable
+ **********************************************************************************************************************/
+fsp_err_t R_SLCDC_ShadowStop (slcdc_ctrl_t * const p_ctrl)
+{
+    slcdc_instance_ctrl_t * p_instance_ctrl = (slcdc_instance_ctrl_t *) p_ctrl;
+
+#if (SLCDC_CFG_PARAM_CHECKING_ENABLE)
+    FSP_ASSERT(p_instance_ctrl);
+    FSP_ERROR_RETURN(SLCDC_CLOSED != p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+
+    slcdc_shadow_cfg_t const * p_shadow = p_instance_ctrl->p_shadow;
+    FSP_ERROR_RETURN(NULL != p_shadow, FSP_ERR_NOT_ENABLED);
+
+    fsp_err_t err = p_shadow->p_transfer->p_api->disable(p_shadow->p_transfer->p_ctrl);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+    p_instance_ctrl->p_shadow = NULL;
+
+    return FSP_SUCCESS;
+}
+
 /*******************************************************************************************************************//**
  * Closes the SLCDC driver. Implements slcdc_api_t::close.
  *
@@ -408,6 +707,13 @@ fsp_err_t R_SLCDC_Close (slcdc_ctrl_t * const p_ctrl)
     FSP_ERROR_RETURN(SLCDC_CLOSED != p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
 #endif
 
+    /* Stop the shadow buffer updates */
+    if (NULL != p_instance_ctrl->p_shadow)
+    {
+        p_instance_ctrl->p_shadow->p_transfer->p_api->disable(p_instance_ctrl->p_shadow->p_transfer->p_ctrl);
+        p_instance_ctrl->p_shadow = NULL;
+    }
+
     /* Stop SLCDC output */
     R_SLCDC->LCDM1 = (uint8_t) (R_SLCDC->LCDM1 & (~(SLCDC_PRV_LCDM1_SCOC_LCDON)));
 
@@ -466,6 +772,107 @@ fsp_err_t R_SLCDC_VersionGet (fsp_version_t * const p_version)
  * Private Functions
  **********************************************************************************************************************/
 
+/*******************************************************************************************************************//**
+ * Checks whether a range of segments is mirrored by the shadow buffer.
+ *
+ * @param[in]  p_instance_ctrl         Pointer to the control block.
+ * @param[in]  start_segment           First segment of the range.
+ * @param[in]  segment_count           Number of segments in the range.
+ *
+ * @retval     true                    At least one segment is mirrored.
+ * @retval     false                   The shadow buffer is not started or no segment is mirrored.
+ **********************************************************************************************************************/
+static bool r_slcdc_shadow_overlaps (slcdc_instance_ctrl_t * const p_instance_ctrl,
+                                     uint32_t                      start_segment,
+                                     uint32_t                      segment_count)
+{
+    slcdc_shadow_cfg_t const * p_shadow = p_instance_ctrl->p_shadow;
+
+    return (NULL != p_shadow) && (start_segment < (p_shadow->start_segment + p_shadow->segment_count)) &&
+           ((start_segment + segment_count) > p_shadow->start_segment);
+}
+
+/*******************************************************************************************************************//**
+ * Checks whether the DTC has moved on from the source replaced by the last commit or animation, and refreshes the
+ * staging buffer from the committed image once it has.
+ *
+ * @param[in]  p_instance_ctrl         Pointer to the control block.
+ *
+ * @retval     FSP_SUCCESS             The staging buffer and the sequence can be changed.
+ * @retval     FSP_ERR_IN_USE          The DTC may still read the previous source.
+ **********************************************************************************************************************/
+static fsp_err_t r_slcdc_shadow_sync (slcdc_instance_ctrl_t * const p_instance_ctrl)
+{
+    if (NULL != p_instance_ctrl->p_shadow_busy)
+    {
+        /* The source pointer written back by the DTC stays inside the previous source until the sequence using it
+         * ends and the chain restores the new source. */
+        uintptr_t src  = (uintptr_t) p_instance_ctrl->shadow_info[0].p_src;
+        uintptr_t busy = (uintptr_t) p_instance_ctrl->p_shadow_busy;
+        FSP_ERROR_RETURN((src < busy) || (src >= (busy + p_instance_ctrl->shadow_busy_bytes)), FSP_ERR_IN_USE);
+
+        p_instance_ctrl->p_shadow_busy = NULL;
+    }
+
+    if (p_instance_ctrl->shadow_back_stale)
+    {
+        /* Continue staging from the committed image */
+        memcpy(p_instance_ctrl->p_shadow_back, p_instance_ctrl->p_shadow_front,
+               p_instance_ctrl->p_shadow->segment_count);
+        p_instance_ctrl->shadow_back_stale = false;
+    }
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Sets the sequence of images that the DTC displays from the end of the current sequence on.
+ *
+ * @param[in]  p_instance_ctrl         Pointer to the control block.
+ * @param[in]  p_src                   First image of the sequence.
+ * @param[in]  num_frames              Number of images in the sequence.
+ **********************************************************************************************************************/
+static void r_slcdc_shadow_source_set (slcdc_instance_ctrl_t * const p_instance_ctrl,
+                                       uint8_t const * const         p_src,
+                                       uint16_t                      num_frames)
+{
+    uint8_t  segment_count = p_instance_ctrl->p_shadow->segment_count;
+    uint32_t counter       = r_slcdc_shadow_counter_get(segment_count, num_frames);
+    uint32_t old_frames    = p_instance_ctrl->shadow_reload[1] & SLCDC_PRV_DTC_NUM_BLOCKS_MASK;
+
+    p_instance_ctrl->p_shadow_busy     = (uint8_t const *) p_instance_ctrl->shadow_reload[0];
+    p_instance_ctrl->shadow_busy_bytes = old_frames * segment_count;
+
+    /* The DTC may restore the sequence between the two writes. Write the smaller frame count with the old source, or
+     * the new source with the smaller frame count, first, so that a mixed sequence never reads past either table. */
+    if (num_frames < old_frames)
+    {
+        p_instance_ctrl->shadow_reload[1] = counter;
+        p_instance_ctrl->shadow_reload[0] = (uint32_t) p_src;
+    }
+    else
+    {
+        p_instance_ctrl->shadow_reload[0] = (uint32_t) p_src;
+        p_instance_ctrl->shadow_reload[1] = counter;
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Computes the counter word (CRA and CRB) of the display transfer for a sequence.
+ *
+ * @param[in]  segment_count           Block size in bytes.
+ * @param[in]  num_frames              Number of blocks.
+ *
+ * @return     Value of the last word of transfer_info_t.
+ **********************************************************************************************************************/
+static uint32_t r_slcdc_shadow_counter_get (uint8_t segment_count, uint16_t num_frames)
+{
+    /* In block mode, CRAH holds the block size that CRAL is reloaded with after every block. */
+    uint32_t length = ((uint32_t) segment_count << SLCDC_PRV_DTC_CRAH_OFFSET) | segment_count;
+
+    return (length << SLCDC_PRV_DTC_LENGTH_OFFSET) | num_frames;
+}
+
 #if SLCDC_CFG_PARAM_CHECKING_ENABLE
 
 /*******************************************************************************************************************//**
@@ -50,6 +50,17 @@
                                          (TRANSFER_IRQ_END << TRANSFER_SETTINGS_IRQ_BITS) |                    \
                                          (TRANSFER_ADDR_MODE_FIXED << TRANSFER_SETTINGS_DEST_ADDR_BITS))
 
+/* Set SPI_CFG_RAMFUNC_ENABLE to 1 to execute the interrupt handlers and the data register accesses from RAM. */
+#ifndef SPI_CFG_RAMFUNC_ENABLE
+ #define SPI_CFG_RAMFUNC_ENABLE         (0)
+#endif
+
+#if SPI_CFG_RAMFUNC_ENABLE
+ #define SPI_PRV_RAMFUNC                BSP_PLACE_IN_RAM
+#else
+ #define SPI_PRV_RAMFUNC
+#endif
+
 #define SPI_CLK_N_DIV_MULTIPLIER        (512U)                              ///< Maximum divider for N=0
 #define SPI_CLK_MAX_DIV                 (4096U)                             ///< Maximum SPI CLK divider
 #define SPI_CLK_MIN_DIV                 (2U)                                ///< Minimum SPI CLK divider
@@ -108,17 +119,27 @@ static fsp_err_t r_spi_write_read_common(spi_ctrl_t * const    p_api_ctrl,
                                          uint32_t const        length,
                                          spi_bit_width_t const bit_width);
 
-static void r_spi_receive(spi_instance_ctrl_t * p_ctrl);
-static void r_spi_transmit(spi_instance_ctrl_t * p_ctrl);
-static void r_spi_call_callback(spi_instance_ctrl_t * p_ctrl, spi_event_t event);
+static fsp_err_t r_spi_transfer_setup(spi_instance_ctrl_t * p_ctrl,
+                                      void const          * p_src,
+                                      void                * p_dest,
+                                      uint32_t const        length,
+                                      spi_bit_width_t const bit_width,
+                                      bool                  primed);
+static void      r_spi_ssl_config(spi_instance_ctrl_t * p_ctrl, spi_ssl_select_t ssl_select);
+static fsp_err_t r_spi_queue_segment_start(spi_instance_ctrl_t * p_ctrl, bool ssl_asserted);
+static void      r_spi_queue_end(spi_instance_ctrl_t * p_ctrl);
+
+static void r_spi_receive(spi_instance_ctrl_t * p_ctrl) SPI_PRV_RAMFUNC;
+static void r_spi_transmit(spi_instance_ctrl_t * p_ctrl) SPI_PRV_RAMFUNC;
+static void r_spi_call_callback(spi_instance_ctrl_t * p_ctrl, spi_event_t event) SPI_PRV_RAMFUNC;
 
 /***********************************************************************************************************************
  * ISR prototypes
  **********************************************************************************************************************/
-void spi_rxi_isr(void);
-void spi_txi_isr(void);
-void spi_tei_isr(void);
-void spi_eri_isr(void);
+void spi_rxi_isr(void) SPI_PRV_RAMFUNC;
+void spi_txi_isr(void) SPI_PRV_RAMFUNC;
+void spi_tei_isr(void) SPI_PRV_RAMFUNC;
+void spi_eri_isr(void) SPI_PRV_RAMFUNC;
 
 /***********************************************************************************************************************
  * Private global variables
@@ -241,12 +262,18 @@ fsp_err_t R_SPI_Open (spi_ctrl_t * p_api_ctrl, spi_cfg_t const * const p_cfg)
 
     p_ctrl->p_regs = SPI_REG(p_ctrl->p_cfg->channel);
 
+    p_ctrl->p_queue      = NULL;
+    p_ctrl->queue_length = 0U;
+    p_ctrl->queue_index  = 0U;
+
     /* Configure hardware registers according to the r_spi_api configuration structure. */
     r_spi_hw_config(p_ctrl);
 
     /* Enable interrupts in NVIC. */
     r_spi_nvic_config(p_ctrl);
 
+    BSP_TRACE(FSP_IP_SPI, p_cfg->channel, BSP_TRACE_EVENT_OPEN, 0U);
+
     p_ctrl->open = SPI_OPEN;
 
     return err;
@@ -370,6 +397,89 @@ fsp_err_t R_SPI_CallbackSet (spi_ctrl_t * const          p_api_ctrl,
     return FSP_SUCCESS;
 }
 
+/*******************************************************************************************************************//**
+ * Starts a queue of transactions that are run back-to-back. Each transaction selects its own buffers, length, bit width
+ * and slave select line. The next transaction is started from the transfer end interrupt without returning to the
+ * application, and SPI_EVENT_TRANSFER_COMPLETE is signalled once after the last transaction.
+ *
+ * If a transaction ends with SPI_TRANSACTION_SSL_KEEP, the SPI remains enabled so the slave select line stays asserted
+ * and the first data frame of the next transaction is written from the interrupt.
+ *
+ * @retval  FSP_SUCCESS                   Transaction queue started.
+ * @retval  FSP_ERR_ASSERTION             A required pointer is NULL, a transaction has no buffers or a length of
+ *                                        zero, a transaction following SPI_TRANSACTION_SSL_KEEP changes the bit width
+ *                                        or slave select line, or the last transaction ends with
+ *                                        SPI_TRANSACTION_SSL_KEEP.
+ * @retval  FSP_ERR_NOT_OPEN              The channel has not been opened. Open the channel first.
+ * @retval  FSP_ERR_UNSUPPORTED           SPI_TRANSACTION_SSL_KEEP is used outside 4-wire master mode or SSL level keep
+ *                                        is not available on this MCU.
+ * @retval  FSP_ERR_IN_USE                A transfer is already in progress.
+ * @return                                See @ref RENESAS_ERROR_CODES for other possible return codes. This function
+ *                                        internally calls @ref transfer_api_t::reconfigure.
+ *
+ * @note The transaction array must remain valid until SPI_EVENT_TRANSFER_COMPLETE is signalled.
+ **********************************************************************************************************************/
+fsp_err_t R_SPI_TransactionQueueStart (spi_ctrl_t * const              p_api_ctrl,
+                                       spi_transaction_t const * const p_transactions,
+                                       uint32_t const                  num_transactions)
+{
+    spi_instance_ctrl_t * p_ctrl = (spi_instance_ctrl_t *) p_api_ctrl;
+
+#if SPI_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ERROR_RETURN(SPI_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+    FSP_ASSERT(NULL != p_transactions);
+    FSP_ASSERT(0U != num_transactions);
+
+    for (uint32_t i = 0U; i < num_transactions; i++)
+    {
+        FSP_ASSERT(p_transactions[i].p_src || p_transactions[i].p_dest);
+        FSP_ASSERT(0U != p_transactions[i].length);
+        if (p_ctrl->p_cfg->p_transfer_tx || p_ctrl->p_cfg->p_transfer_rx)
+        {
+            FSP_ASSERT(p_transactions[i].length <= SPI_DTC_MAX_TRANSFER);
+        }
+
+        if (SPI_TRANSACTION_SSL_KEEP == p_transactions[i].ssl_end)
+        {
+ #if BSP_FEATURE_SPI_HAS_SSL_LEVEL_KEEP == 1
+            spi_extended_cfg_t * p_extend = (spi_extended_cfg_t *) p_ctrl->p_cfg->p_extend;
+            FSP_ERROR_RETURN((SPI_MODE_MASTER == p_ctrl->p_cfg->operating_mode) &&
+                             (SPI_SSL_MODE_SPI == p_extend->spi_clksyn),
+                             FSP_ERR_UNSUPPORTED);
+ #else
+
+            /* The slave select line cannot be held asserted between transfers without SSL level keep. */
+            return FSP_ERR_UNSUPPORTED;
+ #endif
+
+            /* The slave select line must be released at the end of the queue. */
+            FSP_ASSERT(i + 1U < num_transactions);
+
+            /* The command register is not modified while the slave select line is held asserted. */
+            FSP_ASSERT(p_transactions[i].bit_width == p_transactions[i + 1U].bit_width);
+            FSP_ASSERT(p_transactions[i].ssl_select == p_transactions[i + 1U].ssl_select);
+        }
+    }
+#endif
+
+    FSP_ERROR_RETURN(0 == (p_ctrl->p_regs->SPCR & R_SPI0_SPCR_SPE_Msk), FSP_ERR_IN_USE);
+
+    BSP_TRACE(FSP_IP_SPI, p_ctrl->p_cfg->channel, BSP_TRACE_EVENT_START, num_transactions);
+
+    p_ctrl->p_queue      = p_transactions;
+    p_ctrl->queue_length = num_transactions;
+    p_ctrl->queue_index  = 0U;
+
+    fsp_err_t err = r_spi_queue_segment_start(p_ctrl, false);
+    if (FSP_SUCCESS != err)
+    {
+        r_spi_queue_end(p_ctrl);
+    }
+
+    return err;
+}
+
 /*******************************************************************************************************************//**
  * This function manages the closing of a channel by the following task. Implements @ref spi_api_t::close.
  *
@@ -391,7 +501,10 @@ fsp_err_t R_SPI_Close (spi_ctrl_t * const p_api_ctrl)
     FSP_ERROR_RETURN(SPI_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
 #endif
 
-    p_ctrl->open = 0;
+    p_ctrl->open    = 0;
+    p_ctrl->p_queue = NULL;
+
+    BSP_TRACE(FSP_IP_SPI, p_ctrl->p_cfg->channel, BSP_TRACE_EVENT_CLOSE, 0U);
 
 #if SPI_DTC_SUPPORT_ENABLE == 1
     if (NULL != p_ctrl->p_cfg->p_transfer_rx)
@@ -864,6 +977,47 @@ static fsp_err_t r_spi_write_read_common (spi_ctrl_t * const    p_api_ctrl,
 
     FSP_ERROR_RETURN(0 == (p_ctrl->p_regs->SPCR & R_SPI0_SPCR_SPE_Msk), FSP_ERR_IN_USE);
 
+    BSP_TRACE(FSP_IP_SPI,
+              p_ctrl->p_cfg->channel,
+              (NULL == p_dest) ? BSP_TRACE_EVENT_WRITE :
+              ((NULL == p_src) ? BSP_TRACE_EVENT_READ : BSP_TRACE_EVENT_WRITE_READ),
+              length);
+
+    fsp_err_t err = r_spi_transfer_setup(p_ctrl, p_src, p_dest, length, bit_width, false);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+    r_spi_bit_width_config(p_ctrl);
+    r_spi_start_transfer(p_ctrl);
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Configures the driver state and the transfer instances for a SPI transfer.
+ *
+ * @param[in]  p_ctrl            pointer to control structure.
+ * @param      p_src             Buffer to transmit data from.
+ * @param      p_dest            Buffer to store received data in.
+ * @param[in]  length            Number of transfers
+ * @param[in]  bit_width         Data frame size (8-Bit, 16-Bit, 32-Bit)
+ * @param[in]  primed            True if the first data frame is written by the CPU. The transmit transfer instance
+ *                               is then configured for the remaining data frames.
+ *
+ * @retval     FSP_SUCCESS       Transfer was configured successfully.
+ * @return                       See @ref RENESAS_ERROR_CODES for other possible return codes. This function internally
+ *                               calls @ref transfer_api_t::reconfigure.
+ **********************************************************************************************************************/
+static fsp_err_t r_spi_transfer_setup (spi_instance_ctrl_t * p_ctrl,
+                                       void const          * p_src,
+                                       void                * p_dest,
+                                       uint32_t const        length,
+                                       spi_bit_width_t const bit_width,
+                                       bool                  primed)
+{
+#if SPI_DTC_SUPPORT_ENABLE == 0
+    FSP_PARAMETER_NOT_USED(primed);
+#endif
+
     p_ctrl->p_tx_data = p_src;
     p_ctrl->p_rx_data = p_dest;
     p_ctrl->tx_count  = 0;
@@ -901,11 +1055,15 @@ static fsp_err_t r_spi_write_read_common (spi_ctrl_t * const    p_api_ctrl,
         /* When the txi interrupt is called, all transfers will be finished. */
         p_ctrl->tx_count = length;
 
+        /* When the first data frame is written by the CPU, the transmit DMA instance sends the remaining frames. */
+        uint32_t tx_offset = primed ? 1U : 0U;
+
         /* Configure the transmit DMA instance. */
         p_ctrl->p_cfg->p_transfer_tx->p_cfg->p_info->size          = (transfer_size_t) ((uint32_t) bit_width >> 1U);
         p_ctrl->p_cfg->p_transfer_tx->p_cfg->p_info->src_addr_mode = TRANSFER_ADDR_MODE_INCREMENTED;
-        p_ctrl->p_cfg->p_transfer_tx->p_cfg->p_info->length        = (uint16_t) length;
-        p_ctrl->p_cfg->p_transfer_tx->p_cfg->p_info->p_src         = p_src;
+        p_ctrl->p_cfg->p_transfer_tx->p_cfg->p_info->length        = (uint16_t) (length - tx_offset);
+        p_ctrl->p_cfg->p_transfer_tx->p_cfg->p_info->p_src         =
+            (uint8_t const *) p_src + (tx_offset << ((uint32_t) bit_width >> 1U));
 
         if (NULL == p_src)
         {
@@ -914,19 +1072,107 @@ static fsp_err_t r_spi_write_read_common (spi_ctrl_t * const    p_api_ctrl,
             p_ctrl->p_cfg->p_transfer_tx->p_cfg->p_info->p_src         = &dummy_tx;
         }
 
-        fsp_err_t err = p_ctrl->p_cfg->p_transfer_tx->p_api->reconfigure(p_ctrl->p_cfg->p_transfer_tx->p_ctrl,
-                                                                         p_ctrl->p_cfg->p_transfer_tx->p_cfg->p_info);
+        /* A single primed data frame does not need the transmit DMA instance. */
+        if (length > tx_offset)
+        {
+            transfer_instance_t const * p_transfer_tx = p_ctrl->p_cfg->p_transfer_tx;
+            fsp_err_t err = p_transfer_tx->p_api->reconfigure(p_transfer_tx->p_ctrl, p_transfer_tx->p_cfg->p_info);
 
-        FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+            FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+        }
     }
 #endif
 
-    r_spi_bit_width_config(p_ctrl);
-    r_spi_start_transfer(p_ctrl);
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Selects the slave select line and its polarity. Must be called while the SPI is disabled.
+ *
+ * @param[in]  p_ctrl          pointer to control structure.
+ * @param[in]  ssl_select      Slave select line to use for the next transfer.
+ **********************************************************************************************************************/
+static void r_spi_ssl_config (spi_instance_ctrl_t * p_ctrl, spi_ssl_select_t ssl_select)
+{
+    spi_extended_cfg_t * p_extend = ((spi_extended_cfg_t *) p_ctrl->p_cfg->p_extend);
+    uint32_t             spcmd0   = p_ctrl->p_regs->SPCMD[0];
+
+    spcmd0 &= ~R_SPI0_SPCMD0_SSLA_Msk;
+    spcmd0 |= (uint32_t) ssl_select << R_SPI0_SPCMD0_SSLA_Pos;
+
+    p_ctrl->p_regs->SSLP     = (uint8_t) ((uint32_t) p_extend->ssl_polarity << ssl_select);
+    p_ctrl->p_regs->SPCMD[0] = (uint16_t) spcmd0;
+}
+
+/*******************************************************************************************************************//**
+ * Starts the transaction at the current queue index.
+ *
+ * @param[in]  p_ctrl          pointer to control structure.
+ * @param[in]  ssl_asserted    True if the previous transaction kept the slave select line asserted. The SPI is still
+ *                             enabled in this case, so the first data frame is written here to start the transfer.
+ *
+ * @retval     FSP_SUCCESS     Transaction was started successfully.
+ * @return                     See @ref RENESAS_ERROR_CODES for other possible return codes. This function internally
+ *                             calls @ref transfer_api_t::reconfigure.
+ **********************************************************************************************************************/
+static fsp_err_t r_spi_queue_segment_start (spi_instance_ctrl_t * p_ctrl, bool ssl_asserted)
+{
+    spi_transaction_t const * p_transaction = &p_ctrl->p_queue[p_ctrl->queue_index];
+
+    fsp_err_t err = r_spi_transfer_setup(p_ctrl,
+                                         p_transaction->p_src,
+                                         p_transaction->p_dest,
+                                         p_transaction->length,
+                                         p_transaction->bit_width,
+                                         ssl_asserted);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+    if (!ssl_asserted)
+    {
+        r_spi_ssl_config(p_ctrl, p_transaction->ssl_select);
+        r_spi_bit_width_config(p_ctrl);
+        r_spi_start_transfer(p_ctrl);
+    }
+    else
+    {
+        /* Setting SPE again does not generate a transmit buffer empty event, so write the first data frame here. */
+        uint32_t tx_count = p_ctrl->tx_count;
+        p_ctrl->tx_count = 0U;
+        r_spi_transmit(p_ctrl);
+
+        /* If the transmit transfer instance sends the remaining frames, all transfers are accounted for. */
+        if (tx_count == p_ctrl->count)
+        {
+            p_ctrl->tx_count = tx_count;
+        }
+
+        spi_extended_cfg_t * p_extend = ((spi_extended_cfg_t *) p_ctrl->p_cfg->p_extend);
+        if ((SPI_COMMUNICATION_TRANSMIT_ONLY == p_extend->spi_comm) && (p_ctrl->tx_count == p_ctrl->count) &&
+            (NULL == p_ctrl->p_cfg->p_transfer_tx))
+        {
+            /* No transmit buffer empty interrupt will enable the transfer end ISR for a single data frame. */
+            R_BSP_IrqEnable(p_ctrl->p_cfg->tei_irq);
+        }
+    }
 
     return FSP_SUCCESS;
 }
 
+/*******************************************************************************************************************//**
+ * Ends the transaction queue and restores the slave select line from the configuration.
+ *
+ * @param[in]  p_ctrl          pointer to control structure.
+ **********************************************************************************************************************/
+static void r_spi_queue_end (spi_instance_ctrl_t * p_ctrl)
+{
+    if (NULL != p_ctrl->p_queue)
+    {
+        p_ctrl->p_queue = NULL;
+
+        r_spi_ssl_config(p_ctrl, ((spi_extended_cfg_t *) p_ctrl->p_cfg->p_extend)->ssl_select);
+    }
+}
+
 /*******************************************************************************************************************//**
  * Copy configured bit width from the SPI data register to the current rx data location.
  * If the receive buffer is NULL, just read the SPI data register.
@@ -1015,6 +1261,8 @@ static void r_spi_call_callback (spi_instance_ctrl_t * p_ctrl, spi_event_t event
 {
     spi_callback_args_t args;
 
+    BSP_TRACE(FSP_IP_SPI, p_ctrl->p_cfg->channel, event, 0U);
+
     /* Store callback arguments in memory provided by user if available.  This allows callback arguments to be
      * stored in non-secure memory so they can be accessed by a non-secure callback function. */
     spi_callback_args_t * p_args = p_ctrl->p_callback_memory;
@@ -1157,11 +1405,40 @@ void spi_tei_isr (void)
     {
         R_BSP_IrqDisable(irq);
 
-        /* Disable the SPI Transfer. */
-        p_ctrl->p_regs->SPCR_b.SPE = 0;
+        spi_event_t event = SPI_EVENT_TRANSFER_COMPLETE;
+        bool        done  = true;
 
-        /* Signal that a transfer has completed. */
-        r_spi_call_callback(p_ctrl, SPI_EVENT_TRANSFER_COMPLETE);
+        if ((NULL != p_ctrl->p_queue) && (p_ctrl->queue_index + 1U < p_ctrl->queue_length))
+        {
+            /* Start the next queued transaction without returning to the application. */
+            bool ssl_asserted = (SPI_TRANSACTION_SSL_KEEP == p_ctrl->p_queue[p_ctrl->queue_index].ssl_end);
+            if (!ssl_asserted)
+            {
+                /* Disable the SPI Transfer. This negates the slave select line. */
+                p_ctrl->p_regs->SPCR_b.SPE = 0;
+            }
+
+            p_ctrl->queue_index++;
+            if (FSP_SUCCESS == r_spi_queue_segment_start(p_ctrl, ssl_asserted))
+            {
+                done = false;
+            }
+            else
+            {
+                event = SPI_EVENT_TRANSFER_ABORTED;
+            }
+        }
+
+        if (done)
+        {
+            /* Disable the SPI Transfer. */
+            p_ctrl->p_regs->SPCR_b.SPE = 0;
+
+            r_spi_queue_end(p_ctrl);
+
+            /* Signal that a transfer has completed. */
+            r_spi_call_callback(p_ctrl, event);
+        }
     }
 
     /* Restore context if RTOS is used */
@@ -1188,6 +1465,9 @@ void spi_eri_isr (void)
     /* Clear the status register. */
     p_ctrl->p_regs->SPSR = 0;
 
+    /* An error ends the transaction queue. */
+    r_spi_queue_end(p_ctrl);
+
     /* Check if the error is a Parity Error. */
     if (R_SPI0_SPSR_PERF_Msk & status)
     {
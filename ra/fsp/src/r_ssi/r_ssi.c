@@ -74,6 +74,13 @@
 /* "SSI" in ASCII, used to determine if driver is open. */
 #define SSI_PRV_OPEN                       (0x535349U)
 
+/* Maximum number of periods in an audio stream ring, one bit per period in the ownership masks. */
+#define SSI_PRV_STREAM_PERIODS_MAX         (32U)
+
+/* Scaling and time constant of the rate tracking filter. */
+#define SSI_PRV_STREAM_TICKS_SHIFT         (4U)
+#define SSI_PRV_PPM                        (1000000)
+
 /***********************************************************************************************************************
  * Typedef definitions
  **********************************************************************************************************************/
@@ -137,6 +144,14 @@ static void r_ssi_stop_sub(ssi_instance_ctrl_t * const p_instance_ctrl);
 /* Start subroutines */
 static fsp_err_t r_ssi_start(ssi_instance_ctrl_t * const p_instance_ctrl, ssi_dir_t dir);
 
+/* Audio streaming subroutines */
+static void     r_ssi_stream_links_configure(ssi_instance_ctrl_t * const    p_instance_ctrl,
+                                             ssi_stream_cfg_t const * const p_stream_cfg,
+                                             ssi_stream_dir_t               dir);
+static void     r_ssi_stream_end(ssi_instance_ctrl_t * const p_instance_ctrl);
+static void     r_ssi_stream_rate_update(ssi_instance_ctrl_t * const p_instance_ctrl);
+static uint32_t r_ssi_stream_periods_count(uint32_t mask);
+
 /* Read and write subroutines. */
 fsp_err_t r_ssi_tx_load_fifo(ssi_instance_ctrl_t * const p_instance_ctrl, void const * const p_src,
                              uint32_t const bytes);
@@ -329,6 +344,10 @@ fsp_err_t R_SSI_Open (i2s_ctrl_t * const p_ctrl, i2s_cfg_t const * const p_cfg)
     p_instance_ctrl->p_reg->SSISCR = ssiscr;
     p_instance_ctrl->p_reg->SSIOFR = ssiofr;
 
+    p_instance_ctrl->p_stream_cfg = NULL;
+
+    BSP_TRACE(FSP_IP_SSI, p_cfg->channel, BSP_TRACE_EVENT_OPEN, 0U);
+
     /* Initialization complete. */
     p_instance_ctrl->open = SSI_PRV_OPEN;
 
@@ -368,6 +387,8 @@ fsp_err_t R_SSI_Write (i2s_ctrl_t * const p_ctrl, void const * const p_src, uint
     FSP_ASSERT(0U == (bytes % (2U << p_instance_ctrl->fifo_access_size)));
 #endif
 
+    BSP_TRACE(FSP_IP_SSI, p_instance_ctrl->p_cfg->channel, BSP_TRACE_EVENT_WRITE, bytes);
+
     /* If a transfer instance is provided for write, reset the transfer. Otherwise store data to transmit in the
      * transmit interrupt. */
     fsp_err_t err = r_ssi_tx_load_fifo(p_instance_ctrl, p_src, bytes);
@@ -418,6 +439,8 @@ fsp_err_t R_SSI_Read (i2s_ctrl_t * const p_ctrl, void * const p_dest, uint32_t c
     FSP_ASSERT(0U == (bytes % (2U << p_instance_ctrl->fifo_access_size)));
 #endif
 
+    BSP_TRACE(FSP_IP_SSI, p_instance_ctrl->p_cfg->channel, BSP_TRACE_EVENT_READ, bytes);
+
     /* If a transfer instance is provided for read, reset the transfer. Otherwise store data to receive in the receive
      * interrupt. */
     fsp_err_t err = r_ssi_rx_unload_fifo(p_instance_ctrl, p_dest, bytes);
@@ -473,6 +496,8 @@ fsp_err_t R_SSI_WriteRead (i2s_ctrl_t * const p_ctrl,
     FSP_ASSERT(0U == (bytes % (2U << p_instance_ctrl->fifo_access_size)));
 #endif
 
+    BSP_TRACE(FSP_IP_SSI, p_instance_ctrl->p_cfg->channel, BSP_TRACE_EVENT_WRITE_READ, bytes);
+
     /* If a transfer instance is provided for write, reset the transfer. Reset the transmit FIFO first since the
      * transmit FIFO will underflow before the receive FIFO overflows during full duplex communication. */
     fsp_err_t err = r_ssi_tx_load_fifo(p_instance_ctrl, p_src, bytes);
@@ -517,6 +542,8 @@ fsp_err_t R_SSI_Stop (i2s_ctrl_t * const p_ctrl)
     FSP_ERROR_RETURN(SSI_PRV_OPEN == p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
 #endif
 
+    BSP_TRACE(FSP_IP_SSI, p_instance_ctrl->p_cfg->channel, BSP_TRACE_EVENT_STOP, 0U);
+
     /* Stop is complete after an I2S_EVENT_IDLE interrupt. */
     r_ssi_stop_sub(p_instance_ctrl);
 
@@ -589,6 +616,8 @@ fsp_err_t R_SSI_Close (i2s_ctrl_t * const p_ctrl)
 
     p_instance_ctrl->open = 0U;
 
+    BSP_TRACE(FSP_IP_SSI, p_instance_ctrl->p_cfg->channel, BSP_TRACE_EVENT_CLOSE, 0U);
+
     /* Stop SSIE. */
     p_instance_ctrl->p_reg->SSICR  = 0U;
     p_instance_ctrl->p_reg->SSIFCR = 0U;
@@ -605,6 +634,12 @@ fsp_err_t R_SSI_Close (i2s_ctrl_t * const p_ctrl)
         R_BSP_IrqDisable(p_instance_ctrl->p_cfg->txi_irq);
     }
 
+    /* Close the stream transfers if the channel is closed while streaming. */
+    if (NULL != p_instance_ctrl->p_stream_cfg)
+    {
+        r_ssi_stream_end(p_instance_ctrl);
+    }
+
 #if SSI_CFG_DTC_ENABLE
 
     /* If transfer is used, disable transfer when stop is requested. */
@@ -694,6 +729,331 @@ fsp_err_t R_SSI_CallbackSet (i2s_ctrl_t * const          p_api_ctrl,
     return FSP_SUCCESS;
 }
 
+/*******************************************************************************************************************//**
+ * Starts full duplex (or single direction) audio streaming from rings of period buffers. Each ring is served by a
+ * looped DMAC chain with one link per period, so the SSI runs continuously while the application refills transmit
+ * periods and consumes receive periods as they complete.
+ *
+ * The transmit ring must be filled before the stream starts. At the end of each period the stream callback is called
+ * with the period that completed; the application then owns that period until it calls
+ * R_SSI_StreamPeriodRelease. A period the DMAC reaches while still owned by the application is counted as an
+ * underrun (transmit) or overrun (receive).
+ *
+ * The CPU transmit and receive interrupts are disabled while streaming. A FIFO error stops the SSI as in
+ * @ref i2s_api_t::write; call R_SSI_StreamStop before starting a new stream.
+ *
+ * @retval FSP_SUCCESS                 Streaming started.
+ * @retval FSP_ERR_ASSERTION           A required pointer is NULL or the stream configuration is invalid.
+ * @retval FSP_ERR_NOT_OPEN            The channel is not opened.
+ * @retval FSP_ERR_IN_USE              A stream is already running or the SSI is not idle.
+ * @return                             See @ref RENESAS_ERROR_CODES or functions called by this function for other
+ *                                     possible return codes. This function calls:
+ *                                         * @ref transfer_api_t::open
+ *                                         * @ref transfer_api_t::reconfigure
+ **********************************************************************************************************************/
+fsp_err_t R_SSI_StreamStart (i2s_ctrl_t * const p_ctrl, ssi_stream_cfg_t const * const p_stream_cfg)
+{
+    ssi_instance_ctrl_t * p_instance_ctrl = (ssi_instance_ctrl_t *) p_ctrl;
+
+#if SSI_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_instance_ctrl);
+    FSP_ERROR_RETURN(SSI_PRV_OPEN == p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
+    FSP_ASSERT(NULL != p_stream_cfg);
+    FSP_ASSERT((NULL != p_stream_cfg->p_transfer_tx) || (NULL != p_stream_cfg->p_transfer_rx));
+    FSP_ASSERT((NULL == p_stream_cfg->p_transfer_tx) || (NULL != p_stream_cfg->p_tx_buffer));
+    FSP_ASSERT((NULL == p_stream_cfg->p_transfer_rx) || (NULL != p_stream_cfg->p_rx_buffer));
+    FSP_ASSERT((p_stream_cfg->num_periods >= 2U) && (p_stream_cfg->num_periods <= SSI_PRV_STREAM_PERIODS_MAX));
+    FSP_ASSERT(0U != p_stream_cfg->period_frames);
+    FSP_ASSERT((NULL == p_stream_cfg->p_timestamp) || (0U != p_stream_cfg->sample_rate_hz));
+#endif
+
+    FSP_ERROR_RETURN(NULL == p_instance_ctrl->p_stream_cfg, FSP_ERR_IN_USE);
+
+    transfer_instance_t const * p_transfer[2] = {p_stream_cfg->p_transfer_tx, p_stream_cfg->p_transfer_rx};
+    uint32_t dir = 0U;
+    fsp_err_t err = FSP_SUCCESS;
+
+    /* Build the DMAC chain of each ring and load its first period. */
+    for (uint32_t i = 0U; (i < 2U) && (FSP_SUCCESS == err); i++)
+    {
+        if (NULL != p_transfer[i])
+        {
+            r_ssi_stream_links_configure(p_instance_ctrl, p_stream_cfg, (ssi_stream_dir_t) i);
+
+            err = p_transfer[i]->p_api->open(p_transfer[i]->p_ctrl, p_transfer[i]->p_cfg);
+            if (FSP_SUCCESS == err)
+            {
+                err = p_transfer[i]->p_api->reconfigure(p_transfer[i]->p_ctrl, p_transfer[i]->p_cfg->p_info);
+                if (FSP_SUCCESS != err)
+                {
+                    (void) p_transfer[i]->p_api->close(p_transfer[i]->p_ctrl);
+                }
+            }
+
+            /* If the receive ring failed, close the transmit ring opened before it. */
+            if ((FSP_SUCCESS != err) && (SSI_STREAM_DIR_RX == i) && (NULL != p_transfer[SSI_STREAM_DIR_TX]))
+            {
+                (void) p_transfer[SSI_STREAM_DIR_TX]->p_api->close(p_transfer[SSI_STREAM_DIR_TX]->p_ctrl);
+            }
+
+            dir |= (SSI_STREAM_DIR_TX == i) ? (uint32_t) SSI_DIR_TX : (uint32_t) SSI_DIR_RX;
+        }
+    }
+
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+    /* The SSI transmit and receive interrupts activate the DMAC, so they must not be serviced by the CPU. */
+    if (p_instance_ctrl->p_cfg->txi_irq >= 0)
+    {
+        R_BSP_IrqDisable(p_instance_ctrl->p_cfg->txi_irq);
+    }
+
+    if (p_instance_ctrl->p_cfg->rxi_irq >= 0)
+    {
+        R_BSP_IrqDisable(p_instance_ctrl->p_cfg->rxi_irq);
+    }
+
+    p_instance_ctrl->stream_app[SSI_STREAM_DIR_TX] = 0U;
+    p_instance_ctrl->stream_app[SSI_STREAM_DIR_RX] = 0U;
+    p_instance_ctrl->tx_underruns                  = 0U;
+    p_instance_ctrl->rx_overruns                   = 0U;
+    p_instance_ctrl->stream_ticks                  = 0U;
+    p_instance_ctrl->rate_error_ppm                = 0;
+    p_instance_ctrl->stream_timestamp              = 0U;
+
+    if (NULL != p_stream_cfg->p_timestamp)
+    {
+        timer_status_t status;
+        if (FSP_SUCCESS == p_stream_cfg->p_timestamp->p_api->statusGet(p_stream_cfg->p_timestamp->p_ctrl, &status))
+        {
+            p_instance_ctrl->stream_timestamp = status.counter;
+        }
+    }
+
+    p_instance_ctrl->p_stream_cfg = p_stream_cfg;
+
+    err = r_ssi_start(p_instance_ctrl, (ssi_dir_t) dir);
+    if (FSP_SUCCESS != err)
+    {
+        r_ssi_stream_end(p_instance_ctrl);
+    }
+
+    return err;
+}
+
+/*******************************************************************************************************************//**
+ * Stops audio streaming started by R_SSI_StreamStart and closes the stream transfers. The SSI stops after the current
+ * frame, and the I2S_EVENT_IDLE callback is called when it is idle.
+ *
+ * @retval FSP_SUCCESS                 Streaming stopped.
+ * @retval FSP_ERR_ASSERTION           The pointer to p_ctrl was null.
+ * @retval FSP_ERR_NOT_OPEN            The channel is not opened.
+ * @retval FSP_ERR_NOT_ENABLED         No stream is running.
+ **********************************************************************************************************************/
+fsp_err_t R_SSI_StreamStop (i2s_ctrl_t * const p_ctrl)
+{
+    ssi_instance_ctrl_t * p_instance_ctrl = (ssi_instance_ctrl_t *) p_ctrl;
+
+#if SSI_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_instance_ctrl);
+    FSP_ERROR_RETURN(SSI_PRV_OPEN == p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+
+    FSP_ERROR_RETURN(NULL != p_instance_ctrl->p_stream_cfg, FSP_ERR_NOT_ENABLED);
+
+    r_ssi_stop_sub(p_instance_ctrl);
+    r_ssi_stream_end(p_instance_ctrl);
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Handles the end of a stream period. Must be called from the callback of the stream DMAC instances with
+ * transfer_callback_args_t::p_info, in the interrupt context of the DMAC.
+ *
+ * The completed period is handed to the application and the stream callback is called. If the period the DMAC
+ * moved on to is still held by the application, an underrun or overrun is counted.
+ *
+ * @retval FSP_SUCCESS                 Period handled.
+ * @retval FSP_ERR_ASSERTION           A required pointer is NULL.
+ * @retval FSP_ERR_NOT_OPEN            The channel is not opened.
+ * @retval FSP_ERR_NOT_ENABLED         No stream is running.
+ * @retval FSP_ERR_INVALID_ARGUMENT    p_info is not a link of either stream ring.
+ **********************************************************************************************************************/
+fsp_err_t R_SSI_StreamTransferEnd (i2s_ctrl_t * const p_ctrl, transfer_info_t const * const p_info)
+{
+    ssi_instance_ctrl_t * p_instance_ctrl = (ssi_instance_ctrl_t *) p_ctrl;
+
+#if SSI_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_instance_ctrl);
+    FSP_ERROR_RETURN(SSI_PRV_OPEN == p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
+    FSP_ASSERT(NULL != p_info);
+#endif
+
+    ssi_stream_cfg_t const * p_stream_cfg = p_instance_ctrl->p_stream_cfg;
+    FSP_ERROR_RETURN(NULL != p_stream_cfg, FSP_ERR_NOT_ENABLED);
+
+    /* Find the ring and period of the completed link. */
+    transfer_instance_t const * p_transfer[2] = {p_stream_cfg->p_transfer_tx, p_stream_cfg->p_transfer_rx};
+    uint32_t dir    = 2U;
+    uint32_t period = 0U;
+    for (uint32_t i = 0U; i < 2U; i++)
+    {
+        if (NULL != p_transfer[i])
+        {
+            transfer_info_t const * p_links = p_transfer[i]->p_cfg->p_info;
+            if ((p_info >= p_links) && (p_info < &p_links[p_stream_cfg->num_periods]))
+            {
+                dir    = i;
+                period = (uint32_t) (p_info - p_links);
+            }
+        }
+    }
+
+    FSP_ERROR_RETURN(dir < 2U, FSP_ERR_INVALID_ARGUMENT);
+
+    /* The DMAC has already moved on to the next period. If the application still holds it, the transmit ring plays
+     * stale data or the receive ring overwrites data that was not consumed. */
+    uint32_t next = (period + 1U) % p_stream_cfg->num_periods;
+    if (0U != (p_instance_ctrl->stream_app[dir] & (1U << next)))
+    {
+        if (SSI_STREAM_DIR_TX == dir)
+        {
+            p_instance_ctrl->tx_underruns++;
+        }
+        else
+        {
+            p_instance_ctrl->rx_overruns++;
+        }
+    }
+
+    p_instance_ctrl->stream_app[dir] |= 1U << period;
+
+    /* Both rings run from the same bit clock, so the rate is tracked on one of them (receive if it is used). */
+    if ((NULL != p_stream_cfg->p_timestamp) &&
+        ((SSI_STREAM_DIR_RX == dir) || (NULL == p_stream_cfg->p_transfer_rx)))
+    {
+        r_ssi_stream_rate_update(p_instance_ctrl);
+    }
+
+    if (NULL != p_stream_cfg->p_callback)
+    {
+        uint32_t period_bytes = ((uint32_t) p_stream_cfg->period_frames * SSI_PRV_I2S_CHANNELS) <<
+                                p_instance_ctrl->fifo_access_size;
+        uint8_t * p_ring = (SSI_STREAM_DIR_TX == dir) ? p_stream_cfg->p_tx_buffer : p_stream_cfg->p_rx_buffer;
+
+        ssi_stream_callback_args_t args;
+        args.dir            = (ssi_stream_dir_t) dir;
+        args.period         = period;
+        args.p_buffer       = &p_ring[period * period_bytes];
+        args.frames         = p_stream_cfg->period_frames;
+        args.rate_error_ppm = p_instance_ctrl->rate_error_ppm;
+        args.p_context      = p_stream_cfg->p_context;
+        p_stream_cfg->p_callback(&args);
+    }
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Returns a period handed to the application back to the DMAC, after a transmit period has been refilled or a
+ * receive period has been consumed.
+ *
+ * @retval FSP_SUCCESS                 Period released.
+ * @retval FSP_ERR_ASSERTION           The pointer to p_ctrl was null or dir is invalid.
+ * @retval FSP_ERR_NOT_OPEN            The channel is not opened.
+ * @retval FSP_ERR_NOT_ENABLED         No stream is running.
+ * @retval FSP_ERR_INVALID_ARGUMENT    period is not in the ring.
+ **********************************************************************************************************************/
+fsp_err_t R_SSI_StreamPeriodRelease (i2s_ctrl_t * const p_ctrl, ssi_stream_dir_t dir, uint32_t period)
+{
+    ssi_instance_ctrl_t * p_instance_ctrl = (ssi_instance_ctrl_t *) p_ctrl;
+
+#if SSI_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_instance_ctrl);
+    FSP_ERROR_RETURN(SSI_PRV_OPEN == p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
+    FSP_ASSERT((SSI_STREAM_DIR_TX == dir) || (SSI_STREAM_DIR_RX == dir));
+#endif
+
+    ssi_stream_cfg_t const * p_stream_cfg = p_instance_ctrl->p_stream_cfg;
+    FSP_ERROR_RETURN(NULL != p_stream_cfg, FSP_ERR_NOT_ENABLED);
+    FSP_ERROR_RETURN(period < p_stream_cfg->num_periods, FSP_ERR_INVALID_ARGUMENT);
+
+    /* The DMAC callback updates the same mask. */
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+    p_instance_ctrl->stream_app[dir] &= ~(1U << period);
+    FSP_CRITICAL_SECTION_EXIT;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Gets the underrun and overrun counts, the latency of each ring and the measured sample rate error of the stream.
+ *
+ * The transmit latency is the number of frames queued ahead of the application: the rest of the period being
+ * played plus the released periods after it. The receive latency is the number of frames received and not released.
+ *
+ * @retval FSP_SUCCESS                 Status stored in p_status.
+ * @retval FSP_ERR_ASSERTION           A required pointer is NULL.
+ * @retval FSP_ERR_NOT_OPEN            The channel is not opened.
+ * @retval FSP_ERR_NOT_ENABLED         No stream is running.
+ * @return                             See @ref RENESAS_ERROR_CODES or functions called by this function for other
+ *                                     possible return codes. This function calls:
+ *                                         * @ref transfer_api_t::infoGet
+ **********************************************************************************************************************/
+fsp_err_t R_SSI_StreamStatusGet (i2s_ctrl_t * const p_ctrl, ssi_stream_status_t * const p_status)
+{
+    ssi_instance_ctrl_t * p_instance_ctrl = (ssi_instance_ctrl_t *) p_ctrl;
+
+#if SSI_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_instance_ctrl);
+    FSP_ERROR_RETURN(SSI_PRV_OPEN == p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
+    FSP_ASSERT(NULL != p_status);
+#endif
+
+    ssi_stream_cfg_t const * p_stream_cfg = p_instance_ctrl->p_stream_cfg;
+    FSP_ERROR_RETURN(NULL != p_stream_cfg, FSP_ERR_NOT_ENABLED);
+
+    transfer_properties_t properties;
+    fsp_err_t             err;
+
+    p_status->tx_latency_frames = 0U;
+    p_status->rx_latency_frames = 0U;
+
+    if (NULL != p_stream_cfg->p_transfer_tx)
+    {
+        err = p_stream_cfg->p_transfer_tx->p_api->infoGet(p_stream_cfg->p_transfer_tx->p_ctrl, &properties);
+        FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+        /* Periods not held by the application are queued, including the one being played. */
+        uint32_t queued = p_stream_cfg->num_periods -
+                          r_ssi_stream_periods_count(p_instance_ctrl->stream_app[SSI_STREAM_DIR_TX]);
+        if (queued > 0U)
+        {
+            p_status->tx_latency_frames = ((queued - 1U) * p_stream_cfg->period_frames) +
+                                          properties.block_count_remaining;
+        }
+    }
+
+    if (NULL != p_stream_cfg->p_transfer_rx)
+    {
+        err = p_stream_cfg->p_transfer_rx->p_api->infoGet(p_stream_cfg->p_transfer_rx->p_ctrl, &properties);
+        FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+        /* Held periods plus the part of the current period already received. */
+        p_status->rx_latency_frames =
+            (r_ssi_stream_periods_count(p_instance_ctrl->stream_app[SSI_STREAM_DIR_RX]) *
+             p_stream_cfg->period_frames) + (p_stream_cfg->period_frames - properties.block_count_remaining);
+    }
+
+    p_status->tx_underruns   = p_instance_ctrl->tx_underruns;
+    p_status->rx_overruns    = p_instance_ctrl->rx_overruns;
+    p_status->rate_error_ppm = p_instance_ctrl->rate_error_ppm;
+
+    return FSP_SUCCESS;
+}
+
 /*******************************************************************************************************************//**
  * @} (end addtogroup R_SSI)
  **********************************************************************************************************************/
@@ -1162,6 +1522,8 @@ static void r_ssi_call_callback (ssi_instance_ctrl_t * p_ctrl, i2s_event_t event
 {
     i2s_callback_args_t args;
 
+    BSP_TRACE(FSP_IP_SSI, p_ctrl->p_cfg->channel, event, 0U);
+
     /* Store callback arguments in memory provided by user if available.  This allows callback arguments to be
      * stored in non-secure memory so they can be accessed by a non-secure callback function. */
     i2s_callback_args_t * p_args = p_ctrl->p_callback_memory;
@@ -1274,6 +1636,163 @@ void ssi_rxi_isr (void)
     FSP_CONTEXT_RESTORE
 }
 
+/*******************************************************************************************************************//**
+ * Builds the DMAC chain of a stream ring, one block mode link per period. Each block is one stereo frame, and the
+ * last link ends the chain so the DMAC loops back to the first period.
+ *
+ * @param[in] p_instance_ctrl          Pointer to the control block.
+ * @param[in] p_stream_cfg             Stream configuration.
+ * @param[in] dir                      Ring to configure.
+ **********************************************************************************************************************/
+static void r_ssi_stream_links_configure (ssi_instance_ctrl_t * const    p_instance_ctrl,
+                                          ssi_stream_cfg_t const * const p_stream_cfg,
+                                          ssi_stream_dir_t               dir)
+{
+    transfer_instance_t const * p_transfer = (SSI_STREAM_DIR_TX == dir) ?
+                                             p_stream_cfg->p_transfer_tx : p_stream_cfg->p_transfer_rx;
+    uint8_t * p_ring = (SSI_STREAM_DIR_TX == dir) ? p_stream_cfg->p_tx_buffer : p_stream_cfg->p_rx_buffer;
+    uint32_t period_bytes = ((uint32_t) p_stream_cfg->period_frames * SSI_PRV_I2S_CHANNELS) <<
+                            p_instance_ctrl->fifo_access_size;
+
+    transfer_info_t * p_links = p_transfer->p_cfg->p_info;
+    for (uint32_t i = 0U; i < p_stream_cfg->num_periods; i++)
+    {
+        transfer_info_t * p_link = &p_links[i];
+
+        p_link->transfer_settings_word = 0U;
+        p_link->mode                   = TRANSFER_MODE_BLOCK;
+        p_link->size                   = p_instance_ctrl->fifo_access_size;
+
+        /* In a DMAC chain, TRANSFER_IRQ_EACH notifies at the end of each link, once per period. */
+        p_link->irq        = TRANSFER_IRQ_EACH;
+        p_link->chain_mode = ((i + 1U) < p_stream_cfg->num_periods) ?
+                             TRANSFER_CHAIN_MODE_END : TRANSFER_CHAIN_MODE_DISABLED;
+        p_link->length     = SSI_PRV_TRANSFER_BLOCK_SIZE;
+        p_link->num_blocks = p_stream_cfg->period_frames;
+
+        if (SSI_STREAM_DIR_TX == dir)
+        {
+            p_link->src_addr_mode  = TRANSFER_ADDR_MODE_INCREMENTED;
+            p_link->dest_addr_mode = TRANSFER_ADDR_MODE_FIXED;
+            p_link->repeat_area    = TRANSFER_REPEAT_AREA_DESTINATION;
+            p_link->p_src          = &p_ring[i * period_bytes];
+            p_link->p_dest         = (void *) &p_instance_ctrl->p_reg->SSIFTDR;
+        }
+        else
+        {
+            p_link->src_addr_mode  = TRANSFER_ADDR_MODE_FIXED;
+            p_link->dest_addr_mode = TRANSFER_ADDR_MODE_INCREMENTED;
+            p_link->repeat_area    = TRANSFER_REPEAT_AREA_SOURCE;
+            p_link->p_src          = (void const *) &p_instance_ctrl->p_reg->SSIFRDR;
+            p_link->p_dest         = &p_ring[i * period_bytes];
+        }
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Closes the stream transfers and hands the SSI transmit and receive interrupts back to the CPU.
+ *
+ * @param[in] p_instance_ctrl          Pointer to the control block.
+ **********************************************************************************************************************/
+static void r_ssi_stream_end (ssi_instance_ctrl_t * const p_instance_ctrl)
+{
+    ssi_stream_cfg_t const * p_stream_cfg = p_instance_ctrl->p_stream_cfg;
+
+    if (NULL != p_stream_cfg->p_transfer_tx)
+    {
+        (void) p_stream_cfg->p_transfer_tx->p_api->close(p_stream_cfg->p_transfer_tx->p_ctrl);
+    }
+
+    if (NULL != p_stream_cfg->p_transfer_rx)
+    {
+        (void) p_stream_cfg->p_transfer_rx->p_api->close(p_stream_cfg->p_transfer_rx->p_ctrl);
+    }
+
+    p_instance_ctrl->p_stream_cfg = NULL;
+
+    if (SSI_PRV_OPEN == p_instance_ctrl->open)
+    {
+        if (p_instance_ctrl->p_cfg->txi_irq >= 0)
+        {
+            R_BSP_IrqEnable(p_instance_ctrl->p_cfg->txi_irq);
+        }
+
+        if (p_instance_ctrl->p_cfg->rxi_irq >= 0)
+        {
+            R_BSP_IrqEnable(p_instance_ctrl->p_cfg->rxi_irq);
+        }
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Measures the period length on the stream timer and updates the sample rate error. The timer must count up. The
+ * period length is low pass filtered over about 16 periods to reject interrupt latency jitter.
+ *
+ * @param[in] p_instance_ctrl          Pointer to the control block.
+ **********************************************************************************************************************/
+static void r_ssi_stream_rate_update (ssi_instance_ctrl_t * const p_instance_ctrl)
+{
+    ssi_stream_cfg_t const * p_stream_cfg = p_instance_ctrl->p_stream_cfg;
+    timer_instance_t const * p_timer      = p_stream_cfg->p_timestamp;
+    timer_status_t           status;
+    timer_info_t             info;
+
+    if ((FSP_SUCCESS != p_timer->p_api->statusGet(p_timer->p_ctrl, &status)) ||
+        (FSP_SUCCESS != p_timer->p_api->infoGet(p_timer->p_ctrl, &info)))
+    {
+        return;
+    }
+
+    /* Account for the timer wrapping at the end of its period. */
+    uint32_t delta = status.counter - p_instance_ctrl->stream_timestamp;
+    if (status.counter < p_instance_ctrl->stream_timestamp)
+    {
+        delta += info.period_counts;
+    }
+
+    p_instance_ctrl->stream_timestamp = status.counter;
+
+    /* Seed the filter with the first period. */
+    if (0U == p_instance_ctrl->stream_ticks)
+    {
+        p_instance_ctrl->stream_ticks = delta << SSI_PRV_STREAM_TICKS_SHIFT;
+    }
+    else
+    {
+        p_instance_ctrl->stream_ticks += delta - (p_instance_ctrl->stream_ticks >> SSI_PRV_STREAM_TICKS_SHIFT);
+    }
+
+    if (0U != p_instance_ctrl->stream_ticks)
+    {
+        /* Timer counts per period at the nominal sample rate, scaled like the filter. */
+        int64_t expected = (int64_t) ((((uint64_t) info.clock_frequency * p_stream_cfg->period_frames) <<
+                                       SSI_PRV_STREAM_TICKS_SHIFT) / p_stream_cfg->sample_rate_hz);
+        int64_t measured = (int64_t) p_instance_ctrl->stream_ticks;
+
+        /* Shorter periods than expected mean the interface runs fast. */
+        p_instance_ctrl->rate_error_ppm = (int32_t) (((expected - measured) * SSI_PRV_PPM) / measured);
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Counts the periods set in an ownership mask.
+ *
+ * @param[in] mask                     One bit per period.
+ *
+ * @return Number of bits set.
+ **********************************************************************************************************************/
+static uint32_t r_ssi_stream_periods_count (uint32_t mask)
+{
+    uint32_t count = 0U;
+    while (0U != mask)
+    {
+        mask &= mask - 1U;
+        count++;
+    }
+
+    return count;
+}
+
 /*******************************************************************************************************************//**
  * Error and idle ISR.
  *
@@ -1293,6 +1812,14 @@ void ssi_int_isr (void)
     /* Clear all flags in SSISR. These bits can only be cleared after reading them as 1.  Reference section 41.4.2
      * "Status Register (SSISR)" of the RA6M3 manual R01UH0886EJ0100. */
     uint32_t iirq_flag = p_instance_ctrl->p_reg->SSISR_b.IIRQ;
+
+    if (NULL != p_instance_ctrl->p_stream_cfg)
+    {
+        /* Count FIFO errors of the stream. */
+        p_instance_ctrl->tx_underruns += p_instance_ctrl->p_reg->SSISR_b.TUIRQ;
+        p_instance_ctrl->rx_overruns  += p_instance_ctrl->p_reg->SSISR_b.ROIRQ;
+    }
+
     p_instance_ctrl->p_reg->SSISR = 0U;
 
     if (1U == iirq_flag)
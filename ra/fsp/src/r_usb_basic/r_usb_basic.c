@@ -33,6 +33,10 @@
 #include "src/hw/inc/r_usb_bitdefine.h"
 #include "src/hw/inc/r_usb_reg_access.h"
 
+#if ((USB_CFG_DTC == USB_CFG_ENABLE) || (USB_CFG_DMA == USB_CFG_ENABLE))
+ #include "src/hw/inc/r_usb_dmac.h"
+#endif                                 /* ((USB_CFG_DTC == USB_CFG_ENABLE) || (USB_CFG_DMA == USB_CFG_ENABLE)) */
+
 #if defined(USB_CFG_HCDC_USE)
  #include "r_usb_hcdc_api.h"
 #endif                                 /* defined(USB_CFG_HCDC_USE) */
@@ -259,6 +263,47 @@ fsp_err_t R_USB_EventGet (usb_ctrl_t * const p_api_ctrl, usb_status_t * event)
     return result;
 }                                      /* End of function R_USB_EventGet() */
 
+/**************************************************************************//**
+ * @brief Checks whether R_USB_EventGet() has work to do. (OS-less Only)
+ *
+ * Work is pending while an event has not been read by R_USB_EventGet(), while the driver holds queued task messages
+ * or interrupts, or while a driver wait is counting down. When no work is pending, nothing changes until the next USB
+ * interrupt, so the application can sleep (for example with __WFI()) instead of calling R_USB_EventGet() in a loop.
+ * This is most effective with USB_CFG_EVENT_DRIVEN enabled, where each R_USB_EventGet() call handles all queued work.
+ *
+ * @retval FSP_SUCCESS        Success.
+ * @retval FSP_ERR_ASSERTION  Parameter is NULL error.
+ * @retval FSP_ERR_USB_FAILED If called in the RTOS environment, an error is returned.
+ ******************************************************************************/
+fsp_err_t R_USB_EventPending (usb_ctrl_t * const p_api_ctrl, bool * p_pending)
+{
+    FSP_PARAMETER_NOT_USED(p_api_ctrl);
+#if (BSP_CFG_RTOS == 0)
+ #if USB_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(p_pending)
+ #endif                                /* USB_CFG_PARAM_CHECKING_ENABLE */
+
+    bool pending = (g_usb_cstd_event.write_pointer != g_usb_cstd_event.read_pointer);
+ #if ((USB_CFG_MODE & USB_CFG_HOST) == USB_CFG_HOST)
+    pending = pending || (USB_TRUE == usb_cstd_sche_pending());
+ #endif                                /* (USB_CFG_MODE & USB_CFG_HOST) == USB_CFG_HOST */
+ #if ((USB_CFG_MODE & USB_CFG_PERI) == USB_CFG_PERI)
+    pending = pending || (g_usb_pstd_usb_int.wp != g_usb_pstd_usb_int.rp);
+ #endif                                /* (USB_CFG_MODE & USB_CFG_PERI) == USB_CFG_PERI */
+ #if (USB_CFG_DMA == USB_CFG_ENABLE)
+    pending = pending || (USB_TRUE == usb_cstd_dma_pending());
+ #endif                                /* (USB_CFG_DMA == USB_CFG_ENABLE) */
+
+    *p_pending = pending;
+
+    return FSP_SUCCESS;
+#else                                  /* (BSP_CFG_RTOS == 0) */
+    FSP_PARAMETER_NOT_USED(p_pending);
+
+    return FSP_ERR_USB_FAILED;
+#endif                                 /* (BSP_CFG_RTOS == 0) */
+}                                      /* End of function R_USB_EventPending() */
+
 /**************************************************************************//**
  * @brief Register a callback function to be called upon completion of a
  * USB related event. (RTOS only)
@@ -265,6 +265,56 @@
 #define USB_CFG_ENABLE                         (1U)
 #define USB_CFG_DISABLE                        (0U)
 
+/* Transfers queued per pipe behind the one in progress (peripheral mode without RTOS). A queued transfer is started
+ * from the completion of the previous one, before its callback is called. 0 disables the queue, in which case a
+ * transfer requested while the pipe is busy fails with USB_QOVR. */
+#ifndef USB_CFG_PIPE_QUEUE_DEPTH
+ #define USB_CFG_PIPE_QUEUE_DEPTH              (0U)
+#endif
+
+/* Event-driven task processing without RTOS. When enabled, each R_USB_EventGet() call runs the driver tasks until
+ * every message and interrupt posted so far has been handled, instead of handling one per call. The application can
+ * then sleep until the next USB interrupt whenever R_USB_EventPending() reports no work. */
+#ifndef USB_CFG_EVENT_DRIVEN
+ #define USB_CFG_EVENT_DRIVEN                  (USB_CFG_DISABLE)
+#endif
+
+/* Upper bound of task passes per R_USB_EventGet() call in event-driven mode */
+#define USB_EVENT_DRIVEN_PASS_MAX              (64U)
+
+/* FIFO arbitration between the interfaces of a composite peripheral (e.g. CDC+MSC). When enabled, the D0FIFO
+ * (receive) and D1FIFO (send) DMA ports are granted to a bulk pipe for one transfer at a time instead of being fixed
+ * to PIPE1/PIPE2. A pipe only takes a port that is free and not wanted by a busy pipe of a higher priority interface;
+ * otherwise its transfer runs on CFIFO, so neither interface waits for the other. On USBHS each bulk pipe also gets
+ * its own region of the pipe buffer memory, sized per interface. Priority 0 keeps an interface on CFIFO. */
+#ifndef USB_CFG_FIFO_ARBITER
+ #define USB_CFG_FIFO_ARBITER                  (USB_CFG_DISABLE)
+#endif
+
+#ifndef USB_CFG_PCDC_FIFO_PRIORITY
+ #define USB_CFG_PCDC_FIFO_PRIORITY            (1U)
+#endif
+
+#ifndef USB_CFG_PMSC_FIFO_PRIORITY
+ #define USB_CFG_PMSC_FIFO_PRIORITY            (1U)
+#endif
+
+/* Pipe buffer bytes per bulk pipe of each interface with the FIFO arbiter on USBHS: 1024 or 2048 */
+#ifndef USB_CFG_PCDC_FIFO_BUF_SIZE
+ #define USB_CFG_PCDC_FIFO_BUF_SIZE            (1024U)
+#endif
+
+#ifndef USB_CFG_PMSC_FIFO_BUF_SIZE
+ #define USB_CFG_PMSC_FIFO_BUF_SIZE            (1024U)
+#endif
+
+/* Enumeration descriptor cache (host mode). Each entry keeps the device and configuration descriptors of a device
+ * that completed enumeration. When a device returns the same 18-byte device descriptor (VID, PID, release and
+ * string indexes), its configuration descriptor is taken from the cache instead of being read again. 0 disables it. */
+#ifndef USB_CFG_HOST_DESC_CACHE_NUM
+ #define USB_CFG_HOST_DESC_CACHE_NUM           (0U)
+#endif
+
 #define USB_CFG_IP0                            (0)
 #define USB_CFG_IP1                            (1)
 #define USB_CFG_MULTI                          (2)
@@ -263,6 +263,10 @@ void     usb_pstd_receive_start(uint16_t pipe);
 void     usb_pstd_fifo_to_buf(uint16_t pipe, uint16_t useport, usb_utr_t * p_utr);
 uint16_t usb_pstd_read_data(uint16_t pipe, uint16_t pipemode, usb_utr_t * p_utr);
 void     usb_pstd_data_end(uint16_t pipe, uint16_t status, usb_utr_t * p_utr);
+void     usb_pstd_pipe_queue_next(uint16_t pipe);
+void     usb_pstd_pipe_queue_flush(uint16_t pipe, uint16_t status, usb_utr_t * p_utr);
+void     usb_pstd_pipe_queue_init(void);
+void     usb_pstd_iso_sof(uint8_t usb_ip);
 
 uint8_t usb_pstd_set_pipe_table(uint8_t * descriptor, usb_utr_t * p_utr, uint8_t class_info);
 void    usb_pstd_clr_pipe_table(uint8_t usb_ip);
@@ -317,6 +321,9 @@ uint16_t usb_hstd_get_device_address(usb_utr_t * ptr, uint16_t pipe);
 #if (USB_CFG_MODE & USB_CFG_PERI) == USB_CFG_PERI
 uint16_t usb_pstd_epadr2pipe(uint16_t Dir_Ep, usb_utr_t * p_utr);
 uint16_t usb_pstd_pipe2fport(usb_utr_t * p_utr, uint16_t pipe);
+void     usb_pstd_fifo_port_claim(usb_utr_t * p_utr, uint16_t pipe);
+void     usb_pstd_fifo_port_release(uint16_t pipe);
+void     usb_pstd_fifo_port_init(void);
 uint16_t usb_pstd_hi_speed_enable(usb_utr_t * p_utr);
 void     usb_pstd_dummy_function(usb_utr_t * ptr, uint16_t data1, uint16_t data2);
 void     usb_pstd_dummy_trn(usb_setup_t * preq, uint16_t ctsq, usb_utr_t * p_utr);
@@ -522,6 +529,8 @@ void      usb_cstd_sche_init(void);
 fsp_err_t usb_cstd_check(usb_er_t err);
 uint8_t   usb_cstd_check_schedule(void);
 void      usb_cstd_scheduler(void);
+void      usb_cstd_sche_next(void);
+uint8_t   usb_cstd_sche_pending(void);
 void      usb_cstd_set_task_pri(uint8_t tasknum, uint8_t pri);
 
 #endif                                 /* (USB_CFG_MODE & USB_CFG_HOST) == USB_CFG_HOST */
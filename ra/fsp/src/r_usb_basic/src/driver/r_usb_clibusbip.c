@@ -566,7 +566,15 @@ void usb_cstd_usb_task (void)
     do
     {
         usb_cstd_scheduler();                        /* Scheduler */
+   #if (USB_CFG_EVENT_DRIVEN == USB_CFG_ENABLE)
+
+        /* Run the tasks for every queued message. The bound keeps a task that re-posts itself from stalling the
+         * caller. */
+        for (uint16_t pass = 0U; (pass < USB_EVENT_DRIVEN_PASS_MAX) && (USB_FLGSET == usb_cstd_check_schedule());
+             pass++)
+   #else                                             /* (USB_CFG_EVENT_DRIVEN == USB_CFG_ENABLE) */
         if (USB_FLGSET == usb_cstd_check_schedule()) /* Check for any task processing requests flags. */
+   #endif                                            /* (USB_CFG_EVENT_DRIVEN == USB_CFG_ENABLE) */
         {
             /** Use only in non-OS. In RTOS, the kernel will schedule these tasks, no polling. **/
             usb_hstd_hcd_task((void *) 0);           /* HCD Task */
@@ -575,6 +583,9 @@ void usb_cstd_usb_task (void)
             usb_hhub_task((usb_vp_int_t) 0);         /* HUB Task */
    #endif /* USB_CFG_HUB == USB_CFG_ENABLE */
             usb_class_task();
+   #if (USB_CFG_EVENT_DRIVEN == USB_CFG_ENABLE)
+            usb_cstd_sche_next();
+   #endif                                            /* (USB_CFG_EVENT_DRIVEN == USB_CFG_ENABLE) */
         }
     }
     /* WAIT_LOOP */
@@ -583,7 +594,13 @@ void usb_cstd_usb_task (void)
   #else                                          /* defined(USB_CFG_HMSC_USE) */
     usb_cstd_scheduler();                        /* Scheduler */
 
+   #if (USB_CFG_EVENT_DRIVEN == USB_CFG_ENABLE)
+
+    /* Run the tasks for every queued message. The bound keeps a task that re-posts itself from stalling the caller. */
+    for (uint16_t pass = 0U; (pass < USB_EVENT_DRIVEN_PASS_MAX) && (USB_FLGSET == usb_cstd_check_schedule()); pass++)
+   #else                                         /* (USB_CFG_EVENT_DRIVEN == USB_CFG_ENABLE) */
     if (USB_FLGSET == usb_cstd_check_schedule()) /* Check for any task processing requests flags. */
+   #endif                                        /* (USB_CFG_EVENT_DRIVEN == USB_CFG_ENABLE) */
     {
         /** Use only in non-OS. In RTOS, the kernel will schedule these tasks, no polling. **/
         usb_hstd_hcd_task((void *) 0);           /* HCD Task */
@@ -594,6 +611,9 @@ void usb_cstd_usb_task (void)
    #if defined(USB_CFG_HCDC_USE) || defined(USB_CFG_HHID_USE) || defined(USB_CFG_HVND_USE)
         usb_class_task();
    #endif /* defined(USB_CFG_HCDC_USE) || defined(USB_CFG_HHID_USE) || defined(USB_CFG_HVND_USE) */
+   #if (USB_CFG_EVENT_DRIVEN == USB_CFG_ENABLE)
+        usb_cstd_sche_next();
+   #endif                                        /* (USB_CFG_EVENT_DRIVEN == USB_CFG_ENABLE) */
     }
   #endif                               /* defined(USB_CFG_HMSC_USE) */
  #endif                                /*( (USB_CFG_MODE & USB_CFG_HOST) == USB_CFG_HOST )*/
@@ -56,6 +56,13 @@
 /* HUB down port */
 #define USB_HUBDOWNPORT                 (4U)    /* HUB down port (MAX15) */
 
+/* Port timing (USB 2.0 section 7.1.7.3 and 11.5) */
+#define USB_HUB_ATTACH_DEBOUNCE_MS      (100U)  /* TATTDB: connect debounce before the port reset */
+#define USB_HUB_RESET_WAIT_MS           (30U)   /* First status poll after SetPortFeature(PORT_RESET), TDRST <= 20ms */
+#define USB_HUB_RESET_POLL_MS           (10U)   /* Status poll interval while the reset is in progress */
+#define USB_HUB_RESET_RECOVERY_MS       (10U)   /* TRSTRCY: reset recovery before the first request to the device */
+#define USB_HUB_PWR_ON_2_PWR_GOOD       (5U)    /* bPwrOn2PwrGood offset in the hub descriptor, 2ms units */
+
 /******************************************************************************
  Typedef definitions
  ******************************************************************************/
@@ -88,6 +95,8 @@ static void usb_hhub_init_down_port (usb_utr_t *ptr, uint16_t hubaddr, usb_clsin
 static void usb_hhub_new_connect (usb_utr_t *ptr, uint16_t hubaddr, uint16_t portnum, usb_clsinfo_t *mess);
 static uint16_t usb_hhub_port_attach (uint16_t hubaddr, uint16_t portnum, usb_clsinfo_t *mess);
 static void usb_hhub_port_reset (usb_utr_t *ptr, uint16_t hubaddr, uint16_t portnum, usb_clsinfo_t *mess);
+static void usb_hhub_power_on_wait (usb_utr_t *ptr, uint16_t hubaddr);
+static void usb_hhub_debounce_wait (usb_utr_t *ptr, uint16_t hubaddr, uint16_t portnum);
 
 #if (BSP_CFG_RTOS == 0)
 static void usb_hhub_enumeration (usb_clsinfo_t *mess);
@@ -123,6 +132,9 @@ uint16_t g_usb_shhub_down_port[USB_NUM_USBIP][USB_MAXDEVADDR + 1U];
 /* Down port remote wake up */
 uint16_t g_usb_shhub_remote[USB_NUM_USBIP][USB_MAXDEVADDR + 1U];
 
+/* Down ports whose connect debounce already elapsed during the power-on wait of the hub */
+static uint16_t g_usb_shhub_debounced[USB_NUM_USBIP][USB_MAXDEVADDR + 1U];
+
 /* Up-hubaddr, up-hubport, portnum, pipenum */
 usb_hub_info_t g_usb_shhub_info_data[USB_NUM_USBIP][USB_MAXDEVADDR + 1U];
 uint16_t g_usb_shhub_number[USB_NUM_USBIP];
@@ -306,6 +318,7 @@ void usb_hhub_close (usb_utr_t *ptr, uint16_t hubaddr, uint16_t data2)
 
     g_usb_shhub_down_port[ptr->ip][hubaddr] = 0;
     g_usb_shhub_remote[ptr->ip][hubaddr] = 0;
+    g_usb_shhub_debounced[ptr->ip][hubaddr] = 0;
     usb_hstd_clr_pipe_table (ptr->ip, hubaddr);
 }
 /******************************************************************************
@@ -1046,8 +1059,8 @@ static void usb_hhub_init_down_port (usb_utr_t *ptr, uint16_t hubaddr, usb_clsin
         }
     }
 
-    /* Delay */
-    usb_cpu_delay_xms((uint16_t)20);
+    /* Power good and connect debounce, once for all down ports */
+    usb_hhub_power_on_wait(ptr, hubaddr);
 
     /* Check HUB's all down-ports */
     /* WAIT_LOOP */
@@ -1075,6 +1088,9 @@ static void usb_hhub_init_down_port (usb_utr_t *ptr, uint16_t hubaddr, usb_clsin
         }
     }
 
+    /* Later connections are debounced one by one */
+    g_usb_shhub_debounced[ptr->ip][hubaddr] = 0;
+
     /* Port check end */
     usb_hhub_trans_start(ptr, hubaddr, (uint32_t) 1, &g_usb_hhub_data[ptr->ip][hubaddr][0],
             &usb_hhub_trans_complete); /* Get Hub and Port Status Change Bitmap */
@@ -1165,6 +1181,8 @@ static void usb_hhub_init_down_port (usb_utr_t *ptr, uint16_t hubaddr, usb_clsin
                 {
                     if (g_usb_shhub_init_port[ptr->ip] > g_usb_shhub_info_data[ptr->ip][hubaddr].port_num)
                     {
+                        /* Power good and connect debounce, once for all down ports */
+                        usb_hhub_power_on_wait(ptr, hubaddr);
                         g_usb_shhub_init_seq[ptr->ip] = USB_SEQ_0; /* Sequence Clear */
                         g_usb_shhub_init_port[ptr->ip] = USB_HUB_P1; /* Port Clear */
                         g_usb_shhub_info[ptr->ip] = USB_MSG_CLS_INIT;
@@ -1738,6 +1756,9 @@ static void usb_hhub_event (usb_clsinfo_t *mess)
                 g_usb_shhub_event_seq[ptr->ip] = USB_SEQ_0; /* Sequence Clear */
                 g_usb_shhub_process[ptr->ip] = USB_NULL;
                 g_usb_shhub_info[ptr->ip] = USB_NULL;
+
+                /* Later connections are debounced one by one */
+                g_usb_shhub_debounced[ptr->ip][hubaddr] = 0;
             }
             else
             {
@@ -1775,16 +1796,16 @@ static void usb_hhub_port_reset (usb_utr_t *ptr, uint16_t hubaddr, uint16_t port
     uint32_t port_status;
 
     /* Hub port SetFeature */
-    usb_cpu_delay_xms((uint16_t) 100);
+    usb_hhub_debounce_wait(ptr, hubaddr, portnum);
     retval = usb_hhub_port_set_feature(ptr, hubaddr, portnum, (uint16_t) USB_HUB_PORT_RESET,
                                         class_trans_result);
     if (USB_OK == retval)
     {
-        usb_cpu_delay_xms((uint16_t) 50);
+        usb_cpu_delay_xms((uint16_t) (USB_HUB_RESET_WAIT_MS - USB_HUB_RESET_POLL_MS));
         /* WAIT_LOOP */
         do
         {
-            usb_cpu_delay_xms((uint16_t) 10);
+            usb_cpu_delay_xms((uint16_t) USB_HUB_RESET_POLL_MS);
             /* Get Status */
             usb_hhub_get_port_information(ptr, hubaddr, portnum, class_trans_result);
 
@@ -1797,7 +1818,7 @@ static void usb_hhub_port_reset (usb_utr_t *ptr, uint16_t hubaddr, uint16_t port
     }
 
     /* Hub port ClearFeature */
-    usb_cpu_delay_xms((uint16_t) 20);
+    usb_cpu_delay_xms((uint16_t) USB_HUB_RESET_RECOVERY_MS);
 
     usb_hhub_port_clr_feature(ptr, hubaddr, portnum, (uint16_t) USB_HUB_C_PORT_RESET,
                                 class_trans_result);
@@ -1825,7 +1846,7 @@ static void usb_hhub_port_reset (usb_utr_t *ptr, uint16_t hubaddr, uint16_t port
             case USB_SEQ_0 :
 
                 /* Hub port SetFeature */
-                usb_cpu_delay_xms((uint16_t) 100);
+                usb_hhub_debounce_wait(ptr, hubaddr, portnum);
                 retval = usb_hhub_port_set_feature(ptr, hubaddr, portnum, (uint16_t) USB_HUB_PORT_RESET,
                         usb_hhub_class_request_complete);
 
@@ -1844,7 +1865,7 @@ static void usb_hhub_port_reset (usb_utr_t *ptr, uint16_t hubaddr, uint16_t port
                 retval = usb_hhub_request_result(mess->result);
                 if (USB_OK == retval)
                 {
-                    usb_cpu_delay_xms((uint16_t) 60);
+                    usb_cpu_delay_xms((uint16_t) USB_HUB_RESET_WAIT_MS);
 
                     /* Get Status */
                     retval = usb_hhub_get_port_information(ptr, hubaddr, portnum, usb_hhub_class_request_complete);
@@ -1874,12 +1895,12 @@ static void usb_hhub_port_reset (usb_utr_t *ptr, uint16_t hubaddr, uint16_t port
                     if (USB_BIT_C_PORT_RESET != (port_status & USB_BIT_C_PORT_RESET))
                     {
                         g_usb_shhub_reset_seq[ptr->ip] = USB_SEQ_0;
-                        usb_hhub_specified_path_wait(mess, (uint16_t) 10);
+                        usb_hhub_specified_path_wait(mess, (uint16_t) USB_HUB_RESET_POLL_MS);
                     }
                     else
                     {
                         /* Hub port ClearFeature */
-                        usb_cpu_delay_xms((uint16_t) 20);
+                        usb_cpu_delay_xms((uint16_t) USB_HUB_RESET_RECOVERY_MS);
 
                         retval = usb_hhub_port_clr_feature(ptr, hubaddr, portnum, (uint16_t) USB_HUB_C_PORT_RESET,
                                 usb_hhub_class_request_complete);
@@ -1925,6 +1946,52 @@ static void usb_hhub_port_reset (usb_utr_t *ptr, uint16_t hubaddr, uint16_t port
  End of function usb_hhub_port_reset
  ******************************************************************************/
 
+/******************************************************************************
+ Function Name   : usb_hhub_power_on_wait
+ Description     : Wait for the down port power to become good plus one connect debounce, then mark every down
+                 : port as debounced. Devices connected at hub power-on are reset without a debounce of their own,
+                 : so the waits of all ports overlap.
+ Arguments       : usb_utr_t *ptr       : Pointer to usb_utr_t structure.
+                 : uint16_t hubaddr     : hub address
+ Return value    : none
+ ******************************************************************************/
+static void usb_hhub_power_on_wait (usb_utr_t *ptr, uint16_t hubaddr)
+{
+    uint16_t portnum;
+
+    usb_cpu_delay_xms((uint16_t) (((uint16_t) g_usb_hhub_descriptor[ptr->ip][USB_HUB_PWR_ON_2_PWR_GOOD] * 2U) +
+            USB_HUB_ATTACH_DEBOUNCE_MS));
+
+    g_usb_shhub_debounced[ptr->ip][hubaddr] = 0;
+    /* WAIT_LOOP */
+    for (portnum = USB_HUB_P1; portnum <= g_usb_shhub_info_data[ptr->ip][hubaddr].port_num; portnum++)
+    {
+        g_usb_shhub_debounced[ptr->ip][hubaddr] |= USB_BITSET(portnum);
+    }
+}
+/******************************************************************************
+ End of function usb_hhub_power_on_wait
+ ******************************************************************************/
+
+/******************************************************************************
+ Function Name   : usb_hhub_debounce_wait
+ Description     : Connect debounce before the reset of a down port, unless it elapsed in usb_hhub_power_on_wait
+ Arguments       : usb_utr_t *ptr       : Pointer to usb_utr_t structure.
+                 : uint16_t hubaddr     : hub address
+                 : uint16_t portnum     : down port number
+ Return value    : none
+ ******************************************************************************/
+static void usb_hhub_debounce_wait (usb_utr_t *ptr, uint16_t hubaddr, uint16_t portnum)
+{
+    if (0 == (g_usb_shhub_debounced[ptr->ip][hubaddr] & USB_BITSET(portnum)))
+    {
+        usb_cpu_delay_xms((uint16_t) USB_HUB_ATTACH_DEBOUNCE_MS);
+    }
+}
+/******************************************************************************
+ End of function usb_hhub_debounce_wait
+ ******************************************************************************/
+
 /******************************************************************************
  Function Name   : usb_hhub_check_class
  Description     : HUB Class driver check
@@ -41,6 +41,22 @@
  #define USB_VALUE_40H     (0x40)
  #define USB_VALUE_100     (100)
  #define USB_VALUE_3000    (3000)
+ #define USB_DEV_DESC_LEN  (18U)       /* Device descriptor length */
+
+/*******************************************************************************
+ * Typedef definitions
+ ******************************************************************************/
+ #if USB_CFG_HOST_DESC_CACHE_NUM > 0
+
+/* Descriptor cache entry */
+typedef struct st_usb_hstd_desc_cache
+{
+    uint8_t  device[USB_DEV_DESC_LEN]; /* Device descriptor, the lookup key */
+    uint16_t config_len;               /* wTotalLength of config, 0 when the entry is free */
+    uint16_t stamp;                    /* Last use, for replacement of the least recently used entry */
+    uint8_t  config[USB_CONFIGSIZE];   /* Configuration descriptor */
+} usb_hstd_desc_cache_t;
+ #endif                                /* USB_CFG_HOST_DESC_CACHE_NUM > 0 */
 
 /******************************************************************************
  * Private global variables and functions
@@ -78,6 +94,16 @@ static uint16_t usb_hstd_chk_remote(usb_utr_t * ptr);
 
 static void usb_hstd_mgr_rel_mpl(usb_utr_t * ptr, uint16_t n);
 
+ #if USB_CFG_HOST_DESC_CACHE_NUM > 0
+static usb_hstd_desc_cache_t usb_shstd_desc_cache[USB_CFG_HOST_DESC_CACHE_NUM];
+static uint16_t              usb_shstd_desc_cache_stamp;
+static uint16_t              usb_shstd_desc_cache_hit[USB_NUM_USBIP];
+
+static uint16_t usb_hstd_desc_cache_find(usb_utr_t * ptr);
+static void     usb_hstd_desc_cache_store(usb_utr_t * ptr);
+
+ #endif                                /* USB_CFG_HOST_DESC_CACHE_NUM > 0 */
+
 /******************************************************************************
  * Exported global variables (to be accessed by other files)
  ******************************************************************************/
@@ -207,6 +233,15 @@ static uint16_t usb_hstd_enumeration (usb_utr_t * ptr)
                 /* Receive Device Descriptor(18) */
                 case 2:
                 {
+ #if USB_CFG_HOST_DESC_CACHE_NUM > 0
+
+                    /* A known device skips the Configuration Descriptor(9) and (xx) requests */
+                    usb_shstd_desc_cache_hit[ptr->ip] = usb_hstd_desc_cache_find(ptr);
+                    if (USB_YES == usb_shstd_desc_cache_hit[ptr->ip])
+                    {
+                        g_usb_hstd_enum_seq[ptr->ip]++;
+                    }
+ #endif                                /* USB_CFG_HOST_DESC_CACHE_NUM > 0 */
                     break;
                 }
 
@@ -259,6 +294,13 @@ static uint16_t usb_hstd_enumeration (usb_utr_t * ptr)
                     g_usb_disp_param_set[ptr->ip] = USB_OFF;
  #endif                                /* USB_CFG_COMPLIANCE == USB_CFG_ENABLE */
 
+ #if USB_CFG_HOST_DESC_CACHE_NUM > 0
+                    if (USB_YES != usb_shstd_desc_cache_hit[ptr->ip])
+                    {
+                        usb_hstd_desc_cache_store(ptr);
+                    }
+ #endif                                /* USB_CFG_HOST_DESC_CACHE_NUM > 0 */
+
                     flg = 0U;
 
                     /* WAIT_LOOP */
@@ -408,6 +450,21 @@ static uint16_t usb_hstd_enumeration (usb_utr_t * ptr)
                         break;
                     }
 
+                    case 4:
+                    {
+ #if USB_CFG_HOST_DESC_CACHE_NUM > 0
+                        if (USB_YES == usb_shstd_desc_cache_hit[ptr->ip])
+                        {
+                            /* Configuration descriptor restored from the cache, complete the step without a
+                             * transfer */
+                            usb_hstd_mgr_snd_mbx(ptr, USB_MSG_MGR_SUBMITRESULT, USB_PIPE0, USB_CTRL_END);
+                            break;
+                        }
+ #endif                                /* USB_CFG_HOST_DESC_CACHE_NUM > 0 */
+                        (*g_usb_hstd_enumaration_process[4])(ptr, g_usb_hstd_device_addr[ptr->ip], (uint16_t) 4);
+                        break;
+                    }
+
                     case 6:
                     {
                         descriptor_table = (uint8_t *) g_usb_hstd_config_descriptor[ptr->ip];
@@ -475,6 +532,90 @@ static uint16_t usb_hstd_enumeration (usb_utr_t * ptr)
  * End of function usb_hstd_enumeration
  ******************************************************************************/
 
+ #if USB_CFG_HOST_DESC_CACHE_NUM > 0
+
+/******************************************************************************
+ * Function Name   : usb_hstd_desc_cache_find
+ * Description     : Look the received device descriptor up in the descriptor cache. On a hit the cached
+ *                 : configuration descriptor is copied to g_usb_hstd_config_descriptor.
+ * Arguments       : usb_utr_t    *ptr        : Pointer to usb_utr_t structure.
+ * Return          : uint16_t                 : USB_YES on a hit, USB_NO otherwise
+ ******************************************************************************/
+static uint16_t usb_hstd_desc_cache_find (usb_utr_t * ptr)
+{
+    usb_hstd_desc_cache_t * p_entry;
+    uint16_t                i;
+
+    /* WAIT_LOOP */
+    for (i = 0U; i < USB_CFG_HOST_DESC_CACHE_NUM; i++)
+    {
+        p_entry = &usb_shstd_desc_cache[i];
+        if ((0U != p_entry->config_len) &&
+            (0 == memcmp(p_entry->device, g_usb_hstd_device_descriptor[ptr->ip], USB_DEV_DESC_LEN)))
+        {
+            memcpy(g_usb_hstd_config_descriptor[ptr->ip], p_entry->config, p_entry->config_len);
+            p_entry->stamp = ++usb_shstd_desc_cache_stamp;
+
+            return USB_YES;
+        }
+    }
+
+    return USB_NO;
+}
+
+/******************************************************************************
+ * End of function usb_hstd_desc_cache_find
+ ******************************************************************************/
+
+/******************************************************************************
+ * Function Name   : usb_hstd_desc_cache_store
+ * Description     : Store the device and configuration descriptors of the device being enumerated, replacing
+ *                 : the least recently used entry when the cache is full.
+ * Arguments       : usb_utr_t    *ptr        : Pointer to usb_utr_t structure.
+ * Return          : none
+ ******************************************************************************/
+static void usb_hstd_desc_cache_store (usb_utr_t * ptr)
+{
+    usb_hstd_desc_cache_t * p_entry = &usb_shstd_desc_cache[0];
+    uint8_t               * p_config = (uint8_t *) g_usb_hstd_config_descriptor[ptr->ip];
+    uint16_t                length;
+    uint16_t                i;
+
+    length = (uint16_t) (((uint16_t) p_config[3] << 8) + (uint16_t) p_config[2]);
+
+    /* A configuration descriptor truncated to USB_CONFIGSIZE is not cached */
+    if ((0U == length) || (USB_CONFIGSIZE < length))
+    {
+        return;
+    }
+
+    /* WAIT_LOOP */
+    for (i = 0U; i < USB_CFG_HOST_DESC_CACHE_NUM; i++)
+    {
+        if (0U == usb_shstd_desc_cache[i].config_len)
+        {
+            p_entry = &usb_shstd_desc_cache[i];
+            break;
+        }
+
+        if ((uint16_t) (usb_shstd_desc_cache_stamp - usb_shstd_desc_cache[i].stamp) >
+            (uint16_t) (usb_shstd_desc_cache_stamp - p_entry->stamp))
+        {
+            p_entry = &usb_shstd_desc_cache[i];
+        }
+    }
+
+    memcpy(p_entry->device, g_usb_hstd_device_descriptor[ptr->ip], USB_DEV_DESC_LEN);
+    memcpy(p_entry->config, p_config, length);
+    p_entry->config_len = length;
+    p_entry->stamp      = ++usb_shstd_desc_cache_stamp;
+}
+
+/******************************************************************************
+ * End of function usb_hstd_desc_cache_store
+ ******************************************************************************/
+ #endif                                /* USB_CFG_HOST_DESC_CACHE_NUM > 0 */
+
 /******************************************************************************
  * Function Name   : usb_hstd_enumeration_err
  * Description     : Output error information when enumeration error occurred.
@@ -412,12 +412,33 @@ void usb_cstd_sche_init (void)
  ******************************************************************************/
 void usb_cstd_scheduler (void)
 {
-    uint8_t usb_pri;                   /* Priority Counter */
-    uint8_t usb_read;                  /* Priority Table read pointer */
-
     /* wait msg */
     usb_cstd_wait_scheduler();
 
+    usb_cstd_sche_next();
+
+  #if ((USB_CFG_DTC == USB_CFG_ENABLE) || (USB_CFG_DMA == USB_CFG_ENABLE))
+    usb_cstd_dma_driver();             /* USB DMA driver */
+  #endif /* ((USB_CFG_DTC == USB_CFG_ENABLE) || (USB_CFG_DMA == USB_CFG_ENABLE)) */
+}
+
+/******************************************************************************
+ * End of function usb_cstd_scheduler
+ ******************************************************************************/
+
+/******************************************************************************
+ * Function Name   : usb_cstd_sche_next
+ * Description     : Select the highest priority message for the tasks to run.
+ *               : Unlike usb_cstd_scheduler, the wait requests are not counted
+ *               : down, so it can be called repeatedly within one pass.
+ * Argument        : none
+ * Return          : none
+ ******************************************************************************/
+void usb_cstd_sche_next (void)
+{
+    uint8_t usb_pri;                   /* Priority Counter */
+    uint8_t usb_read;                  /* Priority Table read pointer */
+
     /* Priority Table reading */
     usb_pri = USB_CNTCLR;
 
@@ -447,14 +468,51 @@ void usb_cstd_scheduler (void)
             usb_pri++;
         }
     }
+}
 
-  #if ((USB_CFG_DTC == USB_CFG_ENABLE) || (USB_CFG_DMA == USB_CFG_ENABLE))
-    usb_cstd_dma_driver();             /* USB DMA driver */
-  #endif /* ((USB_CFG_DTC == USB_CFG_ENABLE) || (USB_CFG_DMA == USB_CFG_ENABLE)) */
+/******************************************************************************
+ * End of function usb_cstd_sche_next
+ ******************************************************************************/
+
+/******************************************************************************
+ * Function Name   : usb_cstd_sche_pending
+ * Description     : Check whether the scheduler holds queued messages or wait
+ *               : requests.
+ * Argument        : none
+ * Return          : uint8_t   : USB_TRUE if there is work left
+ ******************************************************************************/
+uint8_t usb_cstd_sche_pending (void)
+{
+    uint8_t i;
+    uint8_t j;
+
+    /* WAIT_LOOP */
+    for (i = 0; i < USB_PRIMAX; i++)
+    {
+        if (usb_scheduler_pri_r[i] != usb_scheduler_pri_w[i])
+        {
+            return USB_TRUE;
+        }
+    }
+
+    /* WAIT_LOOP */
+    for (i = 0; i < USB_IDMAX; i++)
+    {
+        /* WAIT_LOOP */
+        for (j = 0; j < USB_WAIT_EVENT_MAX; j++)
+        {
+            if (0 != usb_scheduler_wait_counter[i][j])
+            {
+                return USB_TRUE;
+            }
+        }
+    }
+
+    return USB_FALSE;
 }
 
 /******************************************************************************
- * End of function usb_cstd_scheduler
+ * End of function usb_cstd_sche_pending
  ******************************************************************************/
 
 /******************************************************************************
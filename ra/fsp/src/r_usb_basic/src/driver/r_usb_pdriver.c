@@ -49,6 +49,14 @@ static void usb_pstd_interrupt(uint16_t type, uint16_t status, usb_cfg_t * p_cfg
 
  #endif /*(BSP_CFG_RTOS == 2)*/
 
+ #if ((BSP_CFG_RTOS == 0) && (USB_CFG_PIPE_QUEUE_DEPTH > 0U))
+
+/* Transfers waiting for their pipe, oldest first */
+static usb_utr_t * g_usb_pstd_pipe_queue[USB_MAX_PIPE_NO + 1U][USB_CFG_PIPE_QUEUE_DEPTH];
+static uint8_t     g_usb_pstd_pipe_queue_head[USB_MAX_PIPE_NO + 1U];
+static uint8_t     g_usb_pstd_pipe_queue_count[USB_MAX_PIPE_NO + 1U];
+ #endif                                /* ((BSP_CFG_RTOS == 0) && (USB_CFG_PIPE_QUEUE_DEPTH > 0U)) */
+
 /******************************************************************************
  * Exported global variables (to be accessed by other files)
  ******************************************************************************/
@@ -167,7 +175,7 @@ static void usb_pstd_interrupt (uint16_t type, uint16_t status, usb_cfg_t * p_cf
         /* SOF */
         case USB_INT_SOFR:
         {
-            /* User program */
+            usb_pstd_iso_sof(utr.ip);
             break;
         }
 
@@ -439,7 +447,7 @@ static void usb_pstd_interrupt (usb_utr_t * p_mess)
         /* SOF */
         case USB_INT_SOFR:
         {
-            /* User program */
+            usb_pstd_iso_sof(p_mess->ip);
             break;
         }
 
@@ -644,7 +652,13 @@ static void usb_pstd_interrupt (usb_utr_t * p_mess)
 void usb_pstd_pcd_task (void)
 {
  #if (BSP_CFG_RTOS == 0)
+  #if (USB_CFG_EVENT_DRIVEN == USB_CFG_ENABLE)
+
+    /* Handle every interrupt queued since the last call */
+    while (g_usb_pstd_usb_int.wp != g_usb_pstd_usb_int.rp)
+  #else                                /* (USB_CFG_EVENT_DRIVEN == USB_CFG_ENABLE) */
     if (g_usb_pstd_usb_int.wp != g_usb_pstd_usb_int.rp)
+  #endif                               /* (USB_CFG_EVENT_DRIVEN == USB_CFG_ENABLE) */
     {
         /* Pop Interrupt info */
         usb_pstd_interrupt(g_usb_pstd_usb_int.buf[g_usb_pstd_usb_int.rp].type,
@@ -779,6 +793,124 @@ usb_er_t usb_pstd_set_submitutr (usb_utr_t * utrmsg)
  * End of function usb_pstd_set_submitutr
  ******************************************************************************/
 
+ #if (BSP_CFG_RTOS == 0)
+
+/******************************************************************************
+ * Function Name   : usb_pstd_pipe_queue_next
+ * Description     : Start the oldest transfer queued for a pipe that has just
+ *               : become free.
+ * Arguments       : uint16_t pipe     : Pipe number.
+ * Return value    : none
+ ******************************************************************************/
+void usb_pstd_pipe_queue_next (uint16_t pipe)
+{
+  #if (USB_CFG_PIPE_QUEUE_DEPTH > 0U)
+    usb_utr_t * p_next = USB_NULL;
+
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+    if ((USB_NULL == g_p_usb_pstd_pipe[pipe]) && (0U != g_usb_pstd_pipe_queue_count[pipe]))
+    {
+        p_next = g_usb_pstd_pipe_queue[pipe][g_usb_pstd_pipe_queue_head[pipe]];
+        g_usb_pstd_pipe_queue_head[pipe] =
+            (uint8_t) ((g_usb_pstd_pipe_queue_head[pipe] + 1U) % USB_CFG_PIPE_QUEUE_DEPTH);
+        g_usb_pstd_pipe_queue_count[pipe]--;
+
+        /* Claim the pipe before leaving the critical section */
+        g_p_usb_pstd_pipe[pipe] = p_next;
+    }
+
+    FSP_CRITICAL_SECTION_EXIT;
+
+    if (USB_NULL != p_next)
+    {
+        usb_pstd_set_submitutr(p_next);
+    }
+
+  #else                                /* (USB_CFG_PIPE_QUEUE_DEPTH > 0U) */
+    FSP_PARAMETER_NOT_USED(pipe);
+  #endif                               /* (USB_CFG_PIPE_QUEUE_DEPTH > 0U) */
+}
+
+/******************************************************************************
+ * End of function usb_pstd_pipe_queue_next
+ ******************************************************************************/
+
+/******************************************************************************
+ * Function Name   : usb_pstd_pipe_queue_flush
+ * Description     : Complete every transfer queued for a pipe with the given
+ *               : status, without starting it.
+ * Arguments       : uint16_t pipe     : Pipe number.
+ *               : uint16_t status   : Transfer status reported to the callbacks.
+ *               : usb_utr_t *p_utr  : Pointer to usb_utr_t structure.
+ * Return value    : none
+ ******************************************************************************/
+void usb_pstd_pipe_queue_flush (uint16_t pipe, uint16_t status, usb_utr_t * p_utr)
+{
+  #if (USB_CFG_PIPE_QUEUE_DEPTH > 0U)
+    usb_utr_t * p_queued;
+
+    do
+    {
+        p_queued = USB_NULL;
+
+        FSP_CRITICAL_SECTION_DEFINE;
+        FSP_CRITICAL_SECTION_ENTER;
+        if (0U != g_usb_pstd_pipe_queue_count[pipe])
+        {
+            p_queued = g_usb_pstd_pipe_queue[pipe][g_usb_pstd_pipe_queue_head[pipe]];
+            g_usb_pstd_pipe_queue_head[pipe] =
+                (uint8_t) ((g_usb_pstd_pipe_queue_head[pipe] + 1U) % USB_CFG_PIPE_QUEUE_DEPTH);
+            g_usb_pstd_pipe_queue_count[pipe]--;
+        }
+
+        FSP_CRITICAL_SECTION_EXIT;
+
+        if ((USB_NULL != p_queued) && (USB_NULL != p_queued->complete))
+        {
+            /* Nothing was transferred, so tranlen keeps the requested size */
+            p_queued->status  = status;
+            p_queued->pipectr = hw_usb_read_pipectr(p_utr, pipe);
+            p_queued->keyword = pipe;
+            ((usb_cb_t) p_queued->complete)(p_queued, USB_NULL, USB_NULL);
+        }
+    } while (USB_NULL != p_queued);
+
+  #else                                /* (USB_CFG_PIPE_QUEUE_DEPTH > 0U) */
+    FSP_PARAMETER_NOT_USED(pipe);
+    FSP_PARAMETER_NOT_USED(status);
+    FSP_PARAMETER_NOT_USED(p_utr);
+  #endif                               /* (USB_CFG_PIPE_QUEUE_DEPTH > 0U) */
+}
+
+/******************************************************************************
+ * End of function usb_pstd_pipe_queue_flush
+ ******************************************************************************/
+
+/******************************************************************************
+ * Function Name   : usb_pstd_pipe_queue_init
+ * Description     : Discard the transfers queued for every pipe.
+ * Arguments       : none
+ * Return value    : none
+ ******************************************************************************/
+void usb_pstd_pipe_queue_init (void)
+{
+  #if (USB_CFG_PIPE_QUEUE_DEPTH > 0U)
+    uint16_t pipe;
+
+    for (pipe = 0U; pipe <= USB_MAX_PIPE_NO; pipe++)
+    {
+        g_usb_pstd_pipe_queue_head[pipe]  = 0U;
+        g_usb_pstd_pipe_queue_count[pipe] = 0U;
+    }
+  #endif                               /* (USB_CFG_PIPE_QUEUE_DEPTH > 0U) */
+}
+
+/******************************************************************************
+ * End of function usb_pstd_pipe_queue_init
+ ******************************************************************************/
+ #endif                                /* (BSP_CFG_RTOS == 0) */
+
 /******************************************************************************
  * Function Name   : usb_pstd_clr_alt
  * Description     : Zero-clear the alternate table (buffer).
@@ -1303,6 +1435,48 @@ usb_er_t usb_pstd_transfer_start (usb_utr_t * ptr)
     }
 
   #if (BSP_CFG_RTOS == 0)
+
+    /* Check state (Configured) */
+    if (USB_TRUE != usb_pstd_chk_configured(ptr))
+    {
+        USB_PRINTF0("### usb_pstd_transfer_start not configured\n");
+
+        return USB_ERROR;
+    }
+
+   #if (USB_CFG_PIPE_QUEUE_DEPTH > 0U)
+    if (USB_TYPFIELD_ISO != usb_cstd_get_pipe_type(ptr, pipenum))
+    {
+        uint8_t tail;
+
+        /* Queue the transfer behind the one in progress; it is started when the pipe is released */
+        FSP_CRITICAL_SECTION_DEFINE;
+        FSP_CRITICAL_SECTION_ENTER;
+        if (USB_NULL != g_p_usb_pstd_pipe[pipenum])
+        {
+            if (USB_CFG_PIPE_QUEUE_DEPTH <= g_usb_pstd_pipe_queue_count[pipenum])
+            {
+                FSP_CRITICAL_SECTION_EXIT;
+                USB_PRINTF1("### usb_pstd_transfer_start queue full %d\n", pipenum);
+
+                return USB_QOVR;
+            }
+
+            tail = (uint8_t) ((g_usb_pstd_pipe_queue_head[pipenum] + g_usb_pstd_pipe_queue_count[pipenum]) %
+                              USB_CFG_PIPE_QUEUE_DEPTH);
+            g_usb_pstd_pipe_queue[pipenum][tail] = ptr;
+            g_usb_pstd_pipe_queue_count[pipenum]++;
+            FSP_CRITICAL_SECTION_EXIT;
+
+            return USB_OK;
+        }
+
+        /* Claim the pipe before leaving the critical section */
+        g_p_usb_pstd_pipe[pipenum] = ptr;
+        FSP_CRITICAL_SECTION_EXIT;
+    }
+
+   #else                               /* (USB_CFG_PIPE_QUEUE_DEPTH > 0U) */
     if (USB_NULL != g_p_usb_pstd_pipe[pipenum])
     {
         /* Get PIPE TYPE */
@@ -1313,14 +1487,7 @@ usb_er_t usb_pstd_transfer_start (usb_utr_t * ptr)
             return USB_QOVR;
         }
     }
-
-    /* Check state (Configured) */
-    if (USB_TRUE != usb_pstd_chk_configured(ptr))
-    {
-        USB_PRINTF0("### usb_pstd_transfer_start not configured\n");
-
-        return USB_ERROR;
-    }
+   #endif                              /* (USB_CFG_PIPE_QUEUE_DEPTH > 0U) */
 
     err = usb_pstd_set_submitutr(ptr);
   #else                                /* BSP_CFG_RTOS == 0 */
@@ -0,0 +1,382 @@
+/***********************************************************************************************************************
+ * Copyright [2020] Renesas Electronics Corporation and/or its affiliates.  All Rights Reserved.
+ *
+ * This software and documentation are supplied by Renesas Electronics America Inc. and may only be used with products
+ * of Renesas Electronics Corp. and its affiliates ("Renesas").  No other uses are authorized.  Renesas products are
+ * sold pursuant to Renesas terms and conditions of sale.  Purchasers are solely responsible for the selection and use
+ * of Renesas products and Renesas assumes no liability.  No license, express or implied, to any intellectual property
+ * right is granted by Renesas. This software is protected under all applicable laws, including copyright laws. Renesas
+ * reserves the right to change or discontinue this software and/or this documentation. THE SOFTWARE AND DOCUMENTATION
+ * IS DELIVERED TO YOU "AS IS," AND RENESAS MAKES NO REPRESENTATIONS OR WARRANTIES, AND TO THE FULLEST EXTENT
+ * PERMISSIBLE UNDER APPLICABLE LAW, DISCLAIMS ALL WARRANTIES, WHETHER EXPLICITLY OR IMPLICITLY, INCLUDING WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, AND NONINFRINGEMENT, WITH RESPECT TO THE SOFTWARE OR
+ * DOCUMENTATION.  RENESAS SHALL HAVE NO LIABILITY ARISING OUT OF ANY SECURITY VULNERABILITY OR BREACH.  TO THE MAXIMUM
+ * EXTENT PERMITTED BY LAW, IN NO EVENT WILL RENESAS BE LIABLE TO YOU IN CONNECTION WITH THE SOFTWARE OR DOCUMENTATION
+ * (OR ANY PERSON OR ENTITY CLAIMING RIGHTS DERIVED FROM YOU) FOR ANY LOSS, DAMAGES, OR CLAIMS WHATSOEVER, INCLUDING,
+ * WITHOUT LIMITATION, ANY DIRECT, CONSEQUENTIAL, SPECIAL, INDIRECT, PUNITIVE, OR INCIDENTAL DAMAGES; ANY LOST PROFITS,
+ * OTHER ECONOMIC DAMAGE, PROPERTY DAMAGE, OR PERSONAL INJURY; AND EVEN IF RENESAS HAS BEEN ADVISED OF THE POSSIBILITY
+ * OF SUCH LOSS, DAMAGES, CLAIMS OR COSTS.
+ **********************************************************************************************************************/
+
+/******************************************************************************
+ * Includes   <System Includes> , "Project Includes"
+ ******************************************************************************/
+#include <r_usb_basic.h>
+#include <r_usb_basic_api.h>
+#include <string.h>
+#include "inc/r_usb_typedef.h"
+#include "inc/r_usb_extern.h"
+#include "inc/r_usb_basic_define.h"
+#include "../hw/inc/r_usb_bitdefine.h"
+#include "../hw/inc/r_usb_reg_access.h"
+
+#if ((USB_CFG_MODE & USB_CFG_PERI) == USB_CFG_PERI)
+
+/******************************************************************************
+ * Macro definitions
+ ******************************************************************************/
+ #define USB_ISO_STREAM_OPEN    (0x5049534FUL) /* "PISO" */
+ #define USB_ISO_STREAM_NUM     ((USB_ISO_PIPE_END - USB_ISO_PIPE_START) + 1U)
+
+/******************************************************************************
+ * Typedef definitions
+ ******************************************************************************/
+
+/* Isochronous stream state. One buffer is in flight per frame; the transfer for the next buffer is started from the
+ * completion of the previous one, so the pipe is armed for every frame while the application works on the other
+ * buffers. */
+typedef struct st_usb_iso_stream
+{
+    uint32_t                     open;
+    usb_iso_stream_cfg_t const * p_cfg;
+    usb_utr_t                    utr;
+    uint32_t                     size[USB_CFG_ISO_STREAM_BUFFER_NUM_MAX]; /* Bytes to send from each IN buffer */
+    uint8_t                      current;                                /* Buffer in flight */
+    uint8_t                      dir_in;                                 /* Stream sends to the host */
+    uint8_t                      busy;                                   /* Transfer in flight */
+} usb_iso_stream_t;
+
+/******************************************************************************
+ * Private global variables and functions
+ ******************************************************************************/
+static usb_iso_stream_t g_usb_iso_stream[USB_ISO_STREAM_NUM];
+
+static void usb_piso_start(usb_iso_stream_t * p_stream);
+static void usb_piso_complete(usb_utr_t * mess, uint16_t data1, uint16_t data2);
+static void usb_piso_callback(usb_iso_stream_t * p_stream, usb_iso_stream_event_t event, uint8_t index);
+static bool usb_piso_any_open(uint8_t usb_ip);
+
+/*******************************************************************************************************************//**
+ * @addtogroup USB
+ * @{
+ **********************************************************************************************************************/
+
+/**************************************************************************//**
+ * @brief Start an isochronous stream on a peripheral isochronous pipe.
+ *
+ * The pipe is armed with the buffers of p_cfg in turn, one buffer per frame. The next transfer is started from the
+ * completion of the previous one, before the application is notified, so no frame is missed while the application
+ * handles a buffer. With USB_CFG_DBLB enabled the pipe FIFO is also double buffered in hardware.
+ *
+ * For an OUT pipe each received buffer is reported with USB_ISO_STREAM_EVENT_OUT_COMPLETE and is armed again after
+ * buffer_num - 1 further frames. For an IN pipe USB_ISO_STREAM_EVENT_IN_REQUEST asks the application to fill a buffer
+ * for a coming frame; it is raised for every buffer before the stream starts and again each time a buffer is sent.
+ *
+ * USB_ISO_STREAM_EVENT_SOF is reported on every start of frame while a stream is open, so that a sampling source such
+ * as r_ssi or r_adc can be kept in step with the host frame clock.
+ *
+ * @retval FSP_SUCCESS           Stream started.
+ * @retval FSP_ERR_ASSERTION     Parameter is NULL.
+ * @retval FSP_ERR_USB_PARAMETER Invalid pipe or buffer configuration.
+ * @retval FSP_ERR_ALREADY_OPEN  A stream is already open on the pipe.
+ * @retval FSP_ERR_USB_FAILED    The device is not configured.
+ ******************************************************************************/
+fsp_err_t R_USB_IsoStreamOpen (usb_ctrl_t * const p_api_ctrl, usb_iso_stream_cfg_t const * const p_cfg)
+{
+    usb_instance_ctrl_t * p_ctrl = (usb_instance_ctrl_t *) p_api_ctrl;
+    usb_iso_stream_t    * p_stream;
+    usb_info_t            info;
+
+ #if USB_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(p_ctrl);
+    FSP_ASSERT(p_cfg);
+    FSP_ASSERT(p_cfg->p_buffer);
+    FSP_ASSERT(p_cfg->p_callback);
+    FSP_ERROR_RETURN((USB_ISO_PIPE_START <= p_cfg->pipe) && (USB_ISO_PIPE_END >= p_cfg->pipe), FSP_ERR_USB_PARAMETER);
+    FSP_ERROR_RETURN(2U <= p_cfg->buffer_num, FSP_ERR_USB_PARAMETER);
+    FSP_ERROR_RETURN(USB_CFG_ISO_STREAM_BUFFER_NUM_MAX >= p_cfg->buffer_num, FSP_ERR_USB_PARAMETER);
+    FSP_ERROR_RETURN(0U != p_cfg->buffer_size, FSP_ERR_USB_PARAMETER);
+    FSP_ERROR_RETURN(0U == (p_cfg->buffer_size & 0x03U), FSP_ERR_USB_PARAMETER);
+    FSP_ERROR_RETURN(0U == ((uint32_t) p_cfg->p_buffer & 0x03U), FSP_ERR_USB_PARAMETER);
+ #endif                                /* USB_CFG_PARAM_CHECKING_ENABLE */
+
+    p_stream = &g_usb_iso_stream[p_cfg->pipe - USB_ISO_PIPE_START];
+    FSP_ERROR_RETURN(USB_ISO_STREAM_OPEN != p_stream->open, FSP_ERR_ALREADY_OPEN);
+
+    (void) R_USB_InfoGet(p_ctrl, &info, p_ctrl->device_address);
+    FSP_ERROR_RETURN(USB_STATUS_CONFIGURED == info.device_status, FSP_ERR_USB_FAILED);
+
+    memset(p_stream, 0, sizeof(usb_iso_stream_t));
+    p_stream->p_cfg        = p_cfg;
+    p_stream->utr.ip       = p_ctrl->module_number;
+    p_stream->utr.keyword  = p_cfg->pipe;
+    p_stream->utr.complete = (usb_cb_t) usb_piso_complete;
+ #if ((USB_CFG_DTC == USB_CFG_ENABLE) || (USB_CFG_DMA == USB_CFG_ENABLE))
+    p_stream->utr.p_transfer_tx = p_ctrl->p_transfer_tx;
+    p_stream->utr.p_transfer_rx = p_ctrl->p_transfer_rx;
+ #endif                                /* ((USB_CFG_DTC == USB_CFG_ENABLE) || (USB_CFG_DMA == USB_CFG_ENABLE)) */
+
+    FSP_ERROR_RETURN(USB_TYPFIELD_ISO == usb_cstd_get_pipe_type(&p_stream->utr, p_cfg->pipe), FSP_ERR_USB_PARAMETER);
+    FSP_ERROR_RETURN(p_cfg->buffer_size <= usb_cstd_get_maxpacket_size(&p_stream->utr, p_cfg->pipe),
+                     FSP_ERR_USB_PARAMETER);
+
+    p_stream->dir_in = (USB_DIR_P_IN == usb_cstd_get_pipe_dir(&p_stream->utr, p_cfg->pipe)) ? USB_TRUE : USB_FALSE;
+    p_stream->open   = USB_ISO_STREAM_OPEN;
+
+    if (USB_TRUE == p_stream->dir_in)
+    {
+        for (uint8_t i = 0U; i < p_cfg->buffer_num; i++)
+        {
+            usb_piso_callback(p_stream, USB_ISO_STREAM_EVENT_IN_REQUEST, i);
+        }
+    }
+
+    hw_usb_pset_enb_sofe(p_ctrl->module_number);
+
+    usb_piso_start(p_stream);
+
+    return FSP_SUCCESS;
+}
+
+/**************************************************************************//**
+ * @brief Stop an isochronous stream. The transfer in flight is terminated and no further events are reported.
+ *
+ * @retval FSP_SUCCESS           Stream stopped.
+ * @retval FSP_ERR_ASSERTION     Parameter is NULL.
+ * @retval FSP_ERR_USB_PARAMETER Invalid pipe number.
+ * @retval FSP_ERR_NOT_OPEN      No stream is open on the pipe.
+ ******************************************************************************/
+fsp_err_t R_USB_IsoStreamClose (usb_ctrl_t * const p_api_ctrl, uint8_t pipe_number)
+{
+    usb_instance_ctrl_t * p_ctrl = (usb_instance_ctrl_t *) p_api_ctrl;
+    usb_iso_stream_t    * p_stream;
+
+ #if USB_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(p_ctrl);
+    FSP_ERROR_RETURN((USB_ISO_PIPE_START <= pipe_number) && (USB_ISO_PIPE_END >= pipe_number), FSP_ERR_USB_PARAMETER);
+ #endif                                /* USB_CFG_PARAM_CHECKING_ENABLE */
+
+    p_stream = &g_usb_iso_stream[pipe_number - USB_ISO_PIPE_START];
+    FSP_ERROR_RETURN(USB_ISO_STREAM_OPEN == p_stream->open, FSP_ERR_NOT_OPEN);
+
+    /* Completion of the terminated transfer is not reported once the stream is closed */
+    p_stream->open = 0U;
+
+    if (USB_TRUE == p_stream->busy)
+    {
+        (void) usb_pstd_transfer_end(&p_stream->utr, pipe_number);
+    }
+
+    if (!usb_piso_any_open(p_ctrl->module_number))
+    {
+        hw_usb_pclear_enb_sofe(p_ctrl->module_number);
+    }
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @} (end addtogroup USB)
+ **********************************************************************************************************************/
+
+/******************************************************************************
+ * Function Name   : usb_pstd_iso_sof
+ * Description     : Report the start of frame to the open isochronous streams
+ * Arguments       : uint8_t usb_ip : USB module number
+ * Return value    : none
+ ******************************************************************************/
+void usb_pstd_iso_sof (uint8_t usb_ip)
+{
+    for (uint8_t i = 0U; i < USB_ISO_STREAM_NUM; i++)
+    {
+        usb_iso_stream_t * p_stream = &g_usb_iso_stream[i];
+
+        if ((USB_ISO_STREAM_OPEN == p_stream->open) && (usb_ip == p_stream->utr.ip))
+        {
+            usb_piso_callback(p_stream, USB_ISO_STREAM_EVENT_SOF, p_stream->current);
+        }
+    }
+}
+
+/******************************************************************************
+ * End of function usb_pstd_iso_sof
+ ******************************************************************************/
+
+/******************************************************************************
+ * Function Name   : usb_piso_start
+ * Description     : Arm the isochronous pipe with the current buffer
+ * Arguments       : usb_iso_stream_t *p_stream : Stream
+ * Return value    : none
+ ******************************************************************************/
+static void usb_piso_start (usb_iso_stream_t * p_stream)
+{
+    usb_iso_stream_cfg_t const * p_cfg = p_stream->p_cfg;
+
+    p_stream->utr.p_tranadr = &p_cfg->p_buffer[p_stream->current * p_cfg->buffer_size];
+    if (USB_TRUE == p_stream->dir_in)
+    {
+        p_stream->utr.tranlen = p_stream->size[p_stream->current];
+    }
+    else
+    {
+        p_stream->utr.tranlen      = p_cfg->buffer_size;
+        p_stream->utr.read_req_len = p_cfg->buffer_size;
+    }
+
+    p_stream->busy = USB_TRUE;
+    if (USB_OK != usb_pstd_transfer_start(&p_stream->utr))
+    {
+        p_stream->busy = USB_FALSE;
+        usb_piso_callback(p_stream, USB_ISO_STREAM_EVENT_STOPPED, p_stream->current);
+    }
+}
+
+/******************************************************************************
+ * End of function usb_piso_start
+ ******************************************************************************/
+
+/******************************************************************************
+ * Function Name   : usb_piso_complete
+ * Description     : Isochronous transfer completion. Arms the pipe with the next buffer and hands the completed one
+ *                 : to the application.
+ * Arguments       : usb_utr_t    *mess   : Pointer to usb_utr_t structure
+ *               : uint16_t     data1   : Not used
+ *               : uint16_t     data2   : Not used
+ * Return value    : none
+ ******************************************************************************/
+static void usb_piso_complete (usb_utr_t * mess, uint16_t data1, uint16_t data2)
+{
+    usb_iso_stream_t * p_stream;
+    uint8_t            done;
+
+    FSP_PARAMETER_NOT_USED(data1);
+    FSP_PARAMETER_NOT_USED(data2);
+
+    if ((USB_ISO_PIPE_START > mess->keyword) || (USB_ISO_PIPE_END < mess->keyword))
+    {
+        return;
+    }
+
+    p_stream = &g_usb_iso_stream[mess->keyword - USB_ISO_PIPE_START];
+    if (USB_ISO_STREAM_OPEN != p_stream->open)
+    {
+        return;
+    }
+
+    p_stream->busy = USB_FALSE;
+    done           = p_stream->current;
+
+    if ((USB_TRUE != g_usb_peri_connected) ||
+        ((USB_DATA_NONE != mess->status) && (USB_DATA_OK != mess->status) && (USB_DATA_SHT != mess->status)))
+    {
+        usb_piso_callback(p_stream, USB_ISO_STREAM_EVENT_STOPPED, done);
+
+        return;
+    }
+
+    if (USB_TRUE != p_stream->dir_in)
+    {
+        p_stream->size[done] = mess->read_req_len - mess->tranlen;
+    }
+
+    /* Re-arm before the application sees the buffer */
+    p_stream->current = (uint8_t) ((done + 1U) % p_stream->p_cfg->buffer_num);
+    usb_piso_start(p_stream);
+
+    if (USB_TRUE == p_stream->dir_in)
+    {
+        usb_piso_callback(p_stream, USB_ISO_STREAM_EVENT_IN_COMPLETE, done);
+        usb_piso_callback(p_stream, USB_ISO_STREAM_EVENT_IN_REQUEST, done);
+    }
+    else
+    {
+        usb_piso_callback(p_stream, USB_ISO_STREAM_EVENT_OUT_COMPLETE, done);
+    }
+}
+
+/******************************************************************************
+ * End of function usb_piso_complete
+ ******************************************************************************/
+
+/******************************************************************************
+ * Function Name   : usb_piso_callback
+ * Description     : Call the stream callback for one buffer
+ * Arguments       : usb_iso_stream_t       *p_stream : Stream
+ *               : usb_iso_stream_event_t event      : Event
+ *               : uint8_t                index      : Buffer the event refers to
+ * Return value    : none
+ ******************************************************************************/
+static void usb_piso_callback (usb_iso_stream_t * p_stream, usb_iso_stream_event_t event, uint8_t index)
+{
+    usb_iso_stream_cfg_t const   * p_cfg = p_stream->p_cfg;
+    usb_iso_stream_callback_args_t args;
+
+    args.event     = event;
+    args.pipe      = p_cfg->pipe;
+    args.frame     = 0U;
+    args.p_buffer  = &p_cfg->p_buffer[index * p_cfg->buffer_size];
+    args.size      = p_stream->size[index];
+    args.p_context = p_cfg->p_context;
+
+    if (USB_ISO_STREAM_EVENT_SOF == event)
+    {
+        args.frame = (uint16_t) (hw_usb_read_frmnum(&p_stream->utr) & USB_FRNM);
+    }
+    else if (USB_ISO_STREAM_EVENT_IN_REQUEST == event)
+    {
+        args.size = p_cfg->buffer_size;
+    }
+    else
+    {
+        /* Nothing to prepare */
+    }
+
+    p_cfg->p_callback(&args);
+
+    if (USB_ISO_STREAM_EVENT_IN_REQUEST == event)
+    {
+        p_stream->size[index] = (args.size < p_cfg->buffer_size) ? args.size : p_cfg->buffer_size;
+    }
+}
+
+/******************************************************************************
+ * End of function usb_piso_callback
+ ******************************************************************************/
+
+/******************************************************************************
+ * Function Name   : usb_piso_any_open
+ * Description     : Check whether a stream is open on a USB module
+ * Arguments       : uint8_t usb_ip : USB module number
+ * Return value    : true if a stream is open
+ ******************************************************************************/
+static bool usb_piso_any_open (uint8_t usb_ip)
+{
+    for (uint8_t i = 0U; i < USB_ISO_STREAM_NUM; i++)
+    {
+        if ((USB_ISO_STREAM_OPEN == g_usb_iso_stream[i].open) && (usb_ip == g_usb_iso_stream[i].utr.ip))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/******************************************************************************
+ * End of function usb_piso_any_open
+ ******************************************************************************/
+#endif                                 /* (USB_CFG_MODE & USB_CFG_PERI) == USB_CFG_REPI */
+
+/******************************************************************************
+ * End  Of File
+ ******************************************************************************/
@@ -49,6 +49,58 @@
 
 #if ((USB_CFG_MODE & USB_CFG_PERI) == USB_CFG_PERI)
 
+ #if (USB_CFG_FIFO_ARBITER == USB_CFG_ENABLE)
+
+/* Pipe buffer layout of the FIFO arbiter on USBHS, in 64-byte blocks. Blocks 0-7 are used by PIPE0 and PIPE6-9. */
+  #define USB_PSTD_BUF_BULK_START    (8U)
+  #define USB_PSTD_BUF_BULK_END      (128U)
+
+  #if defined(USB_CFG_PCDC_USE)
+   #define USB_PSTD_BUF_PCDC_BLOCKS     (USB_CFG_PCDC_FIFO_BUF_SIZE / 64U)
+   #if (USB_NULL != USB_CFG_PCDC_BULK_IN2)
+    #define USB_PSTD_BUF_PCDC2_BLOCKS    (USB_PSTD_BUF_PCDC_BLOCKS)
+   #else
+    #define USB_PSTD_BUF_PCDC2_BLOCKS    (0U)
+   #endif
+  #else
+   #define USB_PSTD_BUF_PCDC_BLOCKS     (0U)
+   #define USB_PSTD_BUF_PCDC2_BLOCKS    (0U)
+  #endif                               /* defined(USB_CFG_PCDC_USE) */
+
+  #if defined(USB_CFG_PMSC_USE)
+   #define USB_PSTD_BUF_PMSC_BLOCKS     (USB_CFG_PMSC_FIFO_BUF_SIZE / 64U)
+  #else
+   #define USB_PSTD_BUF_PMSC_BLOCKS     (0U)
+  #endif                               /* defined(USB_CFG_PMSC_USE) */
+
+  #define USB_PSTD_BUF_PCDC_IN       (USB_PSTD_BUF_BULK_START)
+  #define USB_PSTD_BUF_PCDC_OUT      (USB_PSTD_BUF_PCDC_IN + USB_PSTD_BUF_PCDC_BLOCKS)
+  #define USB_PSTD_BUF_PCDC2_IN      (USB_PSTD_BUF_PCDC_OUT + USB_PSTD_BUF_PCDC_BLOCKS)
+  #define USB_PSTD_BUF_PCDC2_OUT     (USB_PSTD_BUF_PCDC2_IN + USB_PSTD_BUF_PCDC2_BLOCKS)
+  #define USB_PSTD_BUF_PMSC_IN       (USB_PSTD_BUF_PCDC2_OUT + USB_PSTD_BUF_PCDC2_BLOCKS)
+  #define USB_PSTD_BUF_PMSC_OUT      (USB_PSTD_BUF_PMSC_IN + USB_PSTD_BUF_PMSC_BLOCKS)
+
+  #if defined(BSP_MCU_GROUP_RA6M3)
+   #if ((USB_CFG_PCDC_FIFO_BUF_SIZE != 1024U) && (USB_CFG_PCDC_FIFO_BUF_SIZE != 2048U)) || \
+    ((USB_CFG_PMSC_FIFO_BUF_SIZE != 1024U) && (USB_CFG_PMSC_FIFO_BUF_SIZE != 2048U))
+    #error "USB_CFG_PCDC_FIFO_BUF_SIZE and USB_CFG_PMSC_FIFO_BUF_SIZE must be 1024 or 2048"
+   #endif
+   #if ((USB_PSTD_BUF_PMSC_OUT + USB_PSTD_BUF_PMSC_BLOCKS) > USB_PSTD_BUF_BULK_END)
+    #error "The bulk pipe buffers of the composite interfaces do not fit in the USBHS pipe buffer memory"
+   #endif
+  #endif                               /* defined(BSP_MCU_GROUP_RA6M3) */
+
+  #if ((USB_CFG_DTC == USB_CFG_ENABLE) || (USB_CFG_DMA == USB_CFG_ENABLE))
+   #define USB_PSTD_FIFO_PORT_D0    (0U)
+   #define USB_PSTD_FIFO_PORT_D1    (1U)
+
+static uint16_t g_usb_pstd_fifo_port[USB_MAX_PIPE_NO + 1U]; /* FIFO port of the transfer in progress on each pipe */
+static uint16_t g_usb_pstd_fifo_owner[2];                   /* Pipe holding D0FIFO/D1FIFO, USB_NULL when free */
+
+static uint8_t usb_pstd_fifo_priority(uint16_t pipe);
+  #endif /* ((USB_CFG_DTC == USB_CFG_ENABLE) || (USB_CFG_DMA == USB_CFG_ENABLE)) */
+ #endif                                /* (USB_CFG_FIFO_ARBITER == USB_CFG_ENABLE) */
+
 /******************************************************************************
  * Renesas Abstracted Host Lib IP functions
  ******************************************************************************/
@@ -102,7 +154,7 @@ uint16_t usb_pstd_epadr2pipe (uint16_t dir_ep, usb_utr_t * p_utr)
 uint16_t usb_pstd_pipe2fport (usb_utr_t * p_utr, uint16_t pipe)
 {
     uint16_t fifo_mode = USB_CUSE;
- #if ((USB_CFG_DTC == USB_CFG_ENABLE) || (USB_CFG_DMA == USB_CFG_ENABLE))
+ #if (USB_CFG_FIFO_ARBITER != USB_CFG_ENABLE) && ((USB_CFG_DTC == USB_CFG_ENABLE) || (USB_CFG_DMA == USB_CFG_ENABLE))
     uint16_t usb_dir;
  #endif
 
@@ -111,7 +163,12 @@ uint16_t usb_pstd_pipe2fport (usb_utr_t * p_utr, uint16_t pipe)
         return USB_NULL;               /* Error */
     }
 
- #if ((USB_CFG_DTC == USB_CFG_ENABLE) || (USB_CFG_DMA == USB_CFG_ENABLE))
+ #if (USB_CFG_FIFO_ARBITER == USB_CFG_ENABLE) && ((USB_CFG_DTC == USB_CFG_ENABLE) || (USB_CFG_DMA == USB_CFG_ENABLE))
+    FSP_PARAMETER_NOT_USED(*p_utr);
+
+    /* The port was chosen by usb_pstd_fifo_port_claim() when the transfer started */
+    fifo_mode = g_usb_pstd_fifo_port[pipe];
+ #elif ((USB_CFG_DTC == USB_CFG_ENABLE) || (USB_CFG_DMA == USB_CFG_ENABLE))
     if ((0 != p_utr->p_transfer_tx) || (0 != p_utr->p_transfer_rx))
     {
         if ((USB_PIPE1 == pipe) || (USB_PIPE2 == pipe))
@@ -140,6 +197,196 @@ uint16_t usb_pstd_pipe2fport (usb_utr_t * p_utr, uint16_t pipe)
  * End of function usb_pstd_pipe2fport
  ******************************************************************************/
 
+/******************************************************************************
+ * Function Name   : usb_pstd_fifo_port_claim
+ * Description     : Choose the FIFO port of the transfer starting on the pipe. With the FIFO arbiter, a bulk pipe
+ *                 : takes the DxFIFO port of its direction if the port is free and no busy pipe of the same
+ *                 : direction has a higher priority; otherwise the transfer uses CFIFO.
+ * Arguments       : usb_utr_t *p_utr : Pointer to usb_utr_t structure
+ *                 : uint16_t pipe    : Pipe number
+ * Return value    : none
+ ******************************************************************************/
+void usb_pstd_fifo_port_claim (usb_utr_t * p_utr, uint16_t pipe)
+{
+ #if (USB_CFG_FIFO_ARBITER == USB_CFG_ENABLE) && ((USB_CFG_DTC == USB_CFG_ENABLE) || (USB_CFG_DMA == USB_CFG_ENABLE))
+    uint16_t port = USB_CUSE;
+    uint16_t slot;
+    uint16_t dir;
+    uint16_t i;
+    uint8_t  priority;
+
+    if (USB_MAX_PIPE_NO < pipe)
+    {
+        return;                        /* Error */
+    }
+
+    priority = usb_pstd_fifo_priority(pipe);
+
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+
+    if ((0U != priority) && ((0 != p_utr->p_transfer_tx) || (0 != p_utr->p_transfer_rx)))
+    {
+        hw_usb_write_pipesel(p_utr, pipe);
+        dir  = (uint16_t) (hw_usb_read_pipecfg(p_utr) & USB_DIRFIELD);
+        port = (0U == dir) ? USB_D0USE : USB_D1USE;
+        slot = (0U == dir) ? USB_PSTD_FIFO_PORT_D0 : USB_PSTD_FIFO_PORT_D1;
+
+        if ((USB_NULL != g_usb_pstd_fifo_owner[slot]) && (pipe != g_usb_pstd_fifo_owner[slot]))
+        {
+            port = USB_CUSE;
+        }
+
+        /* Leave the port to a busy pipe of a higher priority interface, so that its next transfer gets it */
+        /* WAIT_LOOP */
+        for (i = USB_BULK_PIPE_START; (USB_CUSE != port) && (i <= USB_BULK_PIPE_END); i++)
+        {
+            if ((i != pipe) && (USB_NULL != g_p_usb_pstd_pipe[i]) && (priority < usb_pstd_fifo_priority(i)))
+            {
+                hw_usb_write_pipesel(p_utr, i);
+                if (dir == (uint16_t) (hw_usb_read_pipecfg(p_utr) & USB_DIRFIELD))
+                {
+                    port = USB_CUSE;
+                }
+            }
+        }
+
+        if (USB_CUSE != port)
+        {
+            g_usb_pstd_fifo_owner[slot] = pipe;
+        }
+    }
+
+    g_usb_pstd_fifo_port[pipe] = port;
+
+    FSP_CRITICAL_SECTION_EXIT;
+ #else
+    FSP_PARAMETER_NOT_USED(*p_utr);
+    FSP_PARAMETER_NOT_USED(pipe);
+ #endif
+}
+
+/******************************************************************************
+ * End of function usb_pstd_fifo_port_claim
+ ******************************************************************************/
+
+/******************************************************************************
+ * Function Name   : usb_pstd_fifo_port_release
+ * Description     : Release the DxFIFO port held by the pipe at the end of its transfer.
+ * Arguments       : uint16_t pipe    : Pipe number
+ * Return value    : none
+ ******************************************************************************/
+void usb_pstd_fifo_port_release (uint16_t pipe)
+{
+ #if (USB_CFG_FIFO_ARBITER == USB_CFG_ENABLE) && ((USB_CFG_DTC == USB_CFG_ENABLE) || (USB_CFG_DMA == USB_CFG_ENABLE))
+    if (USB_MAX_PIPE_NO < pipe)
+    {
+        return;                        /* Error */
+    }
+
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+    if (pipe == g_usb_pstd_fifo_owner[USB_PSTD_FIFO_PORT_D0])
+    {
+        g_usb_pstd_fifo_owner[USB_PSTD_FIFO_PORT_D0] = USB_NULL;
+    }
+
+    if (pipe == g_usb_pstd_fifo_owner[USB_PSTD_FIFO_PORT_D1])
+    {
+        g_usb_pstd_fifo_owner[USB_PSTD_FIFO_PORT_D1] = USB_NULL;
+    }
+
+    g_usb_pstd_fifo_port[pipe] = USB_CUSE;
+    FSP_CRITICAL_SECTION_EXIT;
+ #else
+    FSP_PARAMETER_NOT_USED(pipe);
+ #endif
+}
+
+/******************************************************************************
+ * End of function usb_pstd_fifo_port_release
+ ******************************************************************************/
+
+/******************************************************************************
+ * Function Name   : usb_pstd_fifo_port_init
+ * Description     : Mark every FIFO port free.
+ * Arguments       : none
+ * Return value    : none
+ ******************************************************************************/
+void usb_pstd_fifo_port_init (void)
+{
+ #if (USB_CFG_FIFO_ARBITER == USB_CFG_ENABLE) && ((USB_CFG_DTC == USB_CFG_ENABLE) || (USB_CFG_DMA == USB_CFG_ENABLE))
+    uint16_t i;
+
+    /* WAIT_LOOP */
+    for (i = 0U; i <= USB_MAX_PIPE_NO; i++)
+    {
+        g_usb_pstd_fifo_port[i] = USB_CUSE;
+    }
+
+    g_usb_pstd_fifo_owner[USB_PSTD_FIFO_PORT_D0] = USB_NULL;
+    g_usb_pstd_fifo_owner[USB_PSTD_FIFO_PORT_D1] = USB_NULL;
+ #endif
+}
+
+/******************************************************************************
+ * End of function usb_pstd_fifo_port_init
+ ******************************************************************************/
+
+ #if (USB_CFG_FIFO_ARBITER == USB_CFG_ENABLE) && ((USB_CFG_DTC == USB_CFG_ENABLE) || (USB_CFG_DMA == USB_CFG_ENABLE))
+
+/******************************************************************************
+ * Function Name   : usb_pstd_fifo_priority
+ * Description     : DxFIFO priority of the interface owning the pipe. Pipes of other classes keep the fixed
+ *                 : PIPE1/PIPE2 assignment.
+ * Arguments       : uint16_t pipe    : Pipe number
+ * Return value    : uint8_t          : Priority, 0 for CFIFO only
+ ******************************************************************************/
+static uint8_t usb_pstd_fifo_priority (uint16_t pipe)
+{
+    uint8_t priority;
+
+    switch (pipe)
+    {
+  #if defined(USB_CFG_PCDC_USE)
+        case USB_CFG_PCDC_BULK_IN:
+        case USB_CFG_PCDC_BULK_OUT:
+   #if (USB_NULL != USB_CFG_PCDC_BULK_IN2)
+        case USB_CFG_PCDC_BULK_IN2:
+   #endif                              /* (USB_NULL != USB_CFG_PCDC_BULK_IN2) */
+   #if (USB_NULL != USB_CFG_PCDC_BULK_OUT2)
+        case USB_CFG_PCDC_BULK_OUT2:
+   #endif                              /* (USB_NULL != USB_CFG_PCDC_BULK_OUT2) */
+        {
+            priority = (uint8_t) USB_CFG_PCDC_FIFO_PRIORITY;
+            break;
+        }
+  #endif                               /* defined(USB_CFG_PCDC_USE) */
+
+  #if defined(USB_CFG_PMSC_USE)
+        case USB_CFG_PMSC_BULK_IN:
+        case USB_CFG_PMSC_BULK_OUT:
+        {
+            priority = (uint8_t) USB_CFG_PMSC_FIFO_PRIORITY;
+            break;
+        }
+  #endif                               /* defined(USB_CFG_PMSC_USE) */
+
+        default:
+        {
+            priority = ((USB_PIPE1 == pipe) || (USB_PIPE2 == pipe)) ? 1U : 0U;
+            break;
+        }
+    }
+
+    return priority;
+}
+
+/******************************************************************************
+ * End of function usb_pstd_fifo_priority
+ ******************************************************************************/
+ #endif                                /* USB_CFG_FIFO_ARBITER && (USB_CFG_DTC || USB_CFG_DMA) */
+
 /******************************************************************************
  * Function Name   : usb_pstd_hi_speed_enable
  * Description     : Check if set to Hi-speed.
@@ -214,6 +461,7 @@ void usb_pstd_send_start (uint16_t pipe)
     hw_usb_clear_sts_brdy(pp, pipe);
 
     /* Pipe number to FIFO port select */
+    usb_pstd_fifo_port_claim(pp, pipe);
     useport = usb_pstd_pipe2fport(pp, pipe);
 
     /* Check use FIFO access */
@@ -457,6 +705,7 @@ void usb_pstd_receive_start (uint16_t pipe)
     gp_usb_pstd_data[pipe] = (uint8_t *) pp->p_tranadr;
 
     /* Pipe number to FIFO port select */
+    usb_pstd_fifo_port_claim(pp, pipe);
     useport = usb_pstd_pipe2fport(pp, pipe);
 
     /* Check use FIFO access */
@@ -762,20 +1011,34 @@ void usb_pstd_data_end (uint16_t pipe, uint16_t status, usb_utr_t * p_utr)
         }
     }
 
+    usb_pstd_fifo_port_release(pipe);
+
     /* Call Back */
     if (USB_NULL != g_p_usb_pstd_pipe[pipe])
     {
+ #if (BSP_CFG_RTOS == 0)
+        usb_utr_t * p_done = g_p_usb_pstd_pipe[pipe];
+ #endif                                /* (BSP_CFG_RTOS == 0) */
+
         /* Transfer information set */
         g_p_usb_pstd_pipe[pipe]->tranlen = g_usb_pstd_data_cnt[pipe];
         g_p_usb_pstd_pipe[pipe]->status  = status;
         g_p_usb_pstd_pipe[pipe]->pipectr = hw_usb_read_pipectr(p_utr, pipe);
         g_p_usb_pstd_pipe[pipe]->keyword = pipe;
-        ((usb_cb_t) g_p_usb_pstd_pipe[pipe]->complete)(g_p_usb_pstd_pipe[pipe], USB_NULL, USB_NULL);
  #if (BSP_CFG_RTOS == 2)
+        ((usb_cb_t) g_p_usb_pstd_pipe[pipe]->complete)(g_p_usb_pstd_pipe[pipe], USB_NULL, USB_NULL);
         vPortFree(g_p_usb_pstd_pipe[pipe]);
         g_p_usb_pstd_pipe[pipe] = (usb_utr_t *) USB_NULL;
         usb_cstd_pipe_msg_re_forward(USB_IP0, pipe); /* Get PIPE Transfer wait que and Message send to PCD */
+ #elif (BSP_CFG_RTOS == 0)
+
+        /* Release the pipe and start the next queued transfer before the callback, so the pipe is not left idle
+         * while the class driver handles the completion. The callback may also request its next transfer. */
+        g_p_usb_pstd_pipe[pipe] = (usb_utr_t *) USB_NULL;
+        usb_pstd_pipe_queue_next(pipe);
+        ((usb_cb_t) p_done->complete)(p_done, USB_NULL, USB_NULL);
  #else  /* (BSP_CFG_RTOS == 2) */
+        ((usb_cb_t) g_p_usb_pstd_pipe[pipe]->complete)(g_p_usb_pstd_pipe[pipe], USB_NULL, USB_NULL);
         g_p_usb_pstd_pipe[pipe] = (usb_utr_t *) USB_NULL;
  #endif /* (BSP_CFG_RTOS == 2) */
     }
@@ -1454,9 +1717,11 @@ uint16_t usb_pstd_get_pipe_buf_value (uint16_t pipe_no)
   #if defined(USB_CFG_PCDC_USE)
         case USB_CFG_PCDC_BULK_IN:
         {
-   #if USB_CFG_DTC == USB_CFG_ENABLE
+   #if (USB_CFG_FIFO_ARBITER == USB_CFG_ENABLE)
+            pipe_buf = (USB_BUF_SIZE(USB_CFG_PCDC_FIFO_BUF_SIZE) | USB_BUF_NUMB(USB_PSTD_BUF_PCDC_IN));
+   #elif USB_CFG_DTC == USB_CFG_ENABLE
             pipe_buf = (USB_BUF_SIZE(1024U) | USB_BUF_NUMB(8U));
-   #else                               /* USB_CFG_DTC == USB_CFG_ENABLE */
+   #else                               /* (USB_CFG_FIFO_ARBITER == USB_CFG_ENABLE) */
             pipe_buf = (USB_BUF_SIZE(2048U) | USB_BUF_NUMB(8U));
    #endif                              /* USB_CFG_DTC == USB_CFG_ENABLE */
             break;
@@ -1464,21 +1729,43 @@ uint16_t usb_pstd_get_pipe_buf_value (uint16_t pipe_no)
 
         case USB_CFG_PCDC_BULK_OUT:
         {
-   #if USB_CFG_DTC == USB_CFG_ENABLE
+   #if (USB_CFG_FIFO_ARBITER == USB_CFG_ENABLE)
+            pipe_buf = (USB_BUF_SIZE(USB_CFG_PCDC_FIFO_BUF_SIZE) | USB_BUF_NUMB(USB_PSTD_BUF_PCDC_OUT));
+   #elif USB_CFG_DTC == USB_CFG_ENABLE
             pipe_buf = (USB_BUF_SIZE(1024U) | USB_BUF_NUMB(36U));
-   #else                               /* USB_CFG_DTC == USB_CFG_ENABLE */
+   #else                               /* (USB_CFG_FIFO_ARBITER == USB_CFG_ENABLE) */
             pipe_buf = (USB_BUF_SIZE(2048U) | USB_BUF_NUMB(72U));
    #endif                              /* USB_CFG_DTC == USB_CFG_ENABLE */
             break;
         }
+
+   #if (USB_CFG_FIFO_ARBITER == USB_CFG_ENABLE)
+    #if (USB_NULL != USB_CFG_PCDC_BULK_IN2)
+        case USB_CFG_PCDC_BULK_IN2:
+        {
+            pipe_buf = (USB_BUF_SIZE(USB_CFG_PCDC_FIFO_BUF_SIZE) | USB_BUF_NUMB(USB_PSTD_BUF_PCDC2_IN));
+            break;
+        }
+    #endif                             /* (USB_NULL != USB_CFG_PCDC_BULK_IN2) */
+
+    #if (USB_NULL != USB_CFG_PCDC_BULK_OUT2)
+        case USB_CFG_PCDC_BULK_OUT2:
+        {
+            pipe_buf = (USB_BUF_SIZE(USB_CFG_PCDC_FIFO_BUF_SIZE) | USB_BUF_NUMB(USB_PSTD_BUF_PCDC2_OUT));
+            break;
+        }
+    #endif                             /* (USB_NULL != USB_CFG_PCDC_BULK_OUT2) */
+   #endif                              /* (USB_CFG_FIFO_ARBITER == USB_CFG_ENABLE) */
   #endif /* defined(USB_CFG_PCDC_USE) */
 
   #if defined(USB_CFG_PMSC_USE)
         case USB_CFG_PMSC_BULK_IN:
         {
-   #if USB_CFG_DTC == USB_CFG_ENABLE
+   #if (USB_CFG_FIFO_ARBITER == USB_CFG_ENABLE)
+            pipe_buf = (USB_BUF_SIZE(USB_CFG_PMSC_FIFO_BUF_SIZE) | USB_BUF_NUMB(USB_PSTD_BUF_PMSC_IN));
+   #elif USB_CFG_DTC == USB_CFG_ENABLE
             pipe_buf = (USB_BUF_SIZE(1024U) | USB_BUF_NUMB(8U));
-   #else                               /* USB_CFG_DTC == USB_CFG_ENABLE */
+   #else                               /* (USB_CFG_FIFO_ARBITER == USB_CFG_ENABLE) */
             pipe_buf = (USB_BUF_SIZE(2048U) | USB_BUF_NUMB(8U));
    #endif                              /* USB_CFG_DTC == USB_CFG_ENABLE */
             break;
@@ -1486,9 +1773,11 @@ uint16_t usb_pstd_get_pipe_buf_value (uint16_t pipe_no)
 
         case USB_CFG_PMSC_BULK_OUT:
         {
-   #if USB_CFG_DTC == USB_CFG_ENABLE
+   #if (USB_CFG_FIFO_ARBITER == USB_CFG_ENABLE)
+            pipe_buf = (USB_BUF_SIZE(USB_CFG_PMSC_FIFO_BUF_SIZE) | USB_BUF_NUMB(USB_PSTD_BUF_PMSC_OUT));
+   #elif USB_CFG_DTC == USB_CFG_ENABLE
             pipe_buf = (USB_BUF_SIZE(1024U) | USB_BUF_NUMB(36U));
-   #else                               /* USB_CFG_DTC == USB_CFG_ENABLE */
+   #else                               /* (USB_CFG_FIFO_ARBITER == USB_CFG_ENABLE) */
             pipe_buf = (USB_BUF_SIZE(2048U) | USB_BUF_NUMB(72U));
    #endif                              /* USB_CFG_DTC == USB_CFG_ENABLE */
             break;
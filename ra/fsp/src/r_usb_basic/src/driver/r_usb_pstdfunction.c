@@ -190,6 +190,11 @@ void usb_pdriver_init (usb_instance_ctrl_t * ctrl, usb_cfg_t const * const cfg)
         g_p_usb_pstd_pipe[i]     = (usb_utr_t *) USB_NULL;
     }
 
+ #if (BSP_CFG_RTOS == 0)
+    usb_pstd_pipe_queue_init();
+ #endif                                /* (BSP_CFG_RTOS == 0) */
+    usb_pstd_fifo_port_init();
+
     g_usb_pstd_config_num    = 0;         /* Configuration number */
     g_usb_pstd_remote_wakeup = USB_FALSE; /* Remote wake up enable flag */
 
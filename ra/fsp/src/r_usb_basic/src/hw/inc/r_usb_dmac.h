@@ -55,6 +55,7 @@ extern uint16_t g_usb_cstd_dma_fifo[USB_NUM_USBIP][USB_DMA_USE_CH_MAX]; /* DMA0
 extern uint16_t g_usb_cstd_dma_pipe[USB_NUM_USBIP][USB_DMA_USE_CH_MAX]; /* DMA0 and DMA1 pipe number */
 
 void     usb_cstd_dma_driver(void);
+uint8_t  usb_cstd_dma_pending(void);
 uint16_t usb_cstd_dma_get_crtb(usb_utr_t * p_utr);
 uint16_t usb_cstd_dma_get_ir_vect(usb_utr_t * ptr, uint16_t use_port);
 void     usb_cstd_dma_clear_ir(usb_utr_t * ptr, uint16_t use_port);
@@ -134,6 +134,10 @@ void     hw_usb_write_fifo32(usb_utr_t * ptr, uint16_t pipemode, uint32_t data);
 uint16_t hw_usb_read_fifo16(usb_utr_t * ptr, uint16_t pipemode);
 void     hw_usb_write_fifo16(usb_utr_t * ptr, uint16_t pipemode, uint16_t data);
 void     hw_usb_write_fifo8(usb_utr_t * ptr, uint16_t pipemode, uint8_t data);
+void     hw_usb_write_fifo16_burst(usb_utr_t * ptr, uint16_t pipemode, uint8_t const * p_data, uint16_t count);
+void     hw_usb_read_fifo16_burst(usb_utr_t * ptr, uint16_t pipemode, uint8_t * p_data, uint16_t count);
+void     hw_usb_write_fifo32_burst(usb_utr_t * ptr, uint16_t pipemode, uint8_t const * p_data, uint16_t count);
+void     hw_usb_read_fifo32_burst(usb_utr_t * ptr, uint16_t pipemode, uint8_t * p_data, uint16_t count);
 
 /************************************/
 /*  CFIFOSEL, D0FIFOSEL, D1FIFOSEL  */
@@ -166,6 +170,8 @@ void     hw_usb_clear_enb_sofe(usb_utr_t * ptr);
 #if ((USB_CFG_MODE & USB_CFG_PERI) == USB_CFG_PERI)
 void hw_usb_pset_enb_rsme(uint8_t usb_ip);
 void hw_usb_pclear_enb_rsme(uint8_t usb_ip);
+void hw_usb_pset_enb_sofe(uint8_t usb_ip);
+void hw_usb_pclear_enb_sofe(uint8_t usb_ip);
 
 #endif                                 /* (USB_CFG_MODE & USB_CFG_PERI) == USB_CFG_REPI */
 
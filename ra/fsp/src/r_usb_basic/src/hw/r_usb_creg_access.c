@@ -22,6 +22,8 @@
  * Includes   <System Includes> , "Project Includes"
  ******************************************************************************/
 
+#include <string.h>
+
 #include <r_usb_basic.h>
 #include <r_usb_basic_api.h>
 #include <r_usb_basic_cfg.h>
@@ -41,6 +43,12 @@
  ******************************************************************************/
 static void * hw_usb_get_fifosel_adr(usb_utr_t * ptr, uint16_t pipemode);
 static void * hw_usb_get_fifoctr_adr(usb_utr_t * ptr, uint16_t pipemode);
+static volatile uint16_t * hw_usb_get_fifo16_adr(usb_utr_t * ptr, uint16_t pipemode);
+
+#if defined(BSP_MCU_GROUP_RA6M3)
+static volatile uint32_t * hw_usb_get_fifo32_adr(usb_utr_t * ptr, uint16_t pipemode);
+
+#endif                                 /* defined(BSP_MCU_GROUP_RA6M3) */
 
 /******************************************************************************
  * Function Name   : hw_usb_read_syscfg
@@ -1187,6 +1195,431 @@ void hw_usb_write_fifo8 (usb_utr_t * ptr, uint16_t pipemode, uint8_t data)
  * End of function hw_usb_write_fifo8
  ******************************************************************************/
 
+/******************************************************************************
+ * Function Name   : hw_usb_write_fifo16_burst
+ * Description     : Writes a buffer to the specified pipemode's FIFO register,
+ *               : 16-bits wide. The FIFO port address is resolved once, then the
+ *               : buffer is copied two bytes per access.
+ * Arguments       : usb_utr_t *ptr      : Pointer to usb_utr_t structure.
+ *               : uint16_t  pipemode  : CUSE/D0DMA/D1DMA
+ *               : uint8_t   *p_data   : Data to write. No alignment required.
+ *               : uint16_t  count     : Number of 16-bit accesses.
+ * Return value    : none
+ ******************************************************************************/
+void hw_usb_write_fifo16_burst (usb_utr_t * ptr, uint16_t pipemode, uint8_t const * p_data, uint16_t count)
+{
+    volatile uint16_t * p_fifo = hw_usb_get_fifo16_adr(ptr, pipemode);
+    uint16_t            data;
+
+    if (NULL == p_fifo)
+    {
+        USB_DEBUG_HOOK(USB_DEBUG_HOOK_STD | USB_DEBUG_HOOK_CODE8);
+
+        return;
+    }
+
+    if (0U == ((uint32_t) p_data & 1U))
+    {
+        uint16_t const * p_half = (uint16_t const *) p_data;
+
+        /* WAIT_LOOP */
+        for ( ; count >= 4U; count -= 4U)
+        {
+            *p_fifo = p_half[0];
+            *p_fifo = p_half[1];
+            *p_fifo = p_half[2];
+            *p_fifo = p_half[3];
+            p_half += 4;
+        }
+
+        /* WAIT_LOOP */
+        for ( ; 0U != count; count--)
+        {
+            *p_fifo = *p_half;
+            p_half++;
+        }
+    }
+    else
+    {
+        /* WAIT_LOOP */
+        for ( ; 0U != count; count--)
+        {
+            memcpy(&data, p_data, sizeof(data));
+            *p_fifo = data;
+            p_data += sizeof(uint16_t);
+        }
+    }
+}
+
+/******************************************************************************
+ * End of function hw_usb_write_fifo16_burst
+ ******************************************************************************/
+
+/******************************************************************************
+ * Function Name   : hw_usb_read_fifo16_burst
+ * Description     : Reads the specified pipemode's FIFO register, 16-bits wide,
+ *               : into a buffer. The FIFO port address is resolved once.
+ * Arguments       : usb_utr_t *ptr      : Pointer to usb_utr_t structure.
+ *               : uint16_t  pipemode  : CUSE/D0DMA/D1DMA
+ *               : uint8_t   *p_data   : Buffer to store the data. No alignment required.
+ *               : uint16_t  count     : Number of 16-bit accesses.
+ * Return value    : none
+ ******************************************************************************/
+void hw_usb_read_fifo16_burst (usb_utr_t * ptr, uint16_t pipemode, uint8_t * p_data, uint16_t count)
+{
+    volatile uint16_t * p_fifo = hw_usb_get_fifo16_adr(ptr, pipemode);
+    uint16_t            data;
+
+    if (NULL == p_fifo)
+    {
+        USB_DEBUG_HOOK(USB_DEBUG_HOOK_STD | USB_DEBUG_HOOK_CODE5);
+
+        return;
+    }
+
+    if (0U == ((uint32_t) p_data & 1U))
+    {
+        uint16_t * p_half = (uint16_t *) p_data;
+
+        /* WAIT_LOOP */
+        for ( ; count >= 4U; count -= 4U)
+        {
+            p_half[0] = *p_fifo;
+            p_half[1] = *p_fifo;
+            p_half[2] = *p_fifo;
+            p_half[3] = *p_fifo;
+            p_half   += 4;
+        }
+
+        /* WAIT_LOOP */
+        for ( ; 0U != count; count--)
+        {
+            *p_half = *p_fifo;
+            p_half++;
+        }
+    }
+    else
+    {
+        /* WAIT_LOOP */
+        for ( ; 0U != count; count--)
+        {
+            data = *p_fifo;
+            memcpy(p_data, &data, sizeof(data));
+            p_data += sizeof(uint16_t);
+        }
+    }
+}
+
+/******************************************************************************
+ * End of function hw_usb_read_fifo16_burst
+ ******************************************************************************/
+
+#if defined(BSP_MCU_GROUP_RA6M3)
+
+/******************************************************************************
+ * Function Name   : hw_usb_write_fifo32_burst
+ * Description     : Writes a buffer to the specified pipemode's FIFO register,
+ *               : 32-bits wide. The FIFO port address is resolved once. Word
+ *               : aligned buffers are loaded four words at a time (LDM).
+ * Arguments       : usb_utr_t *ptr      : Pointer to usb_utr_t structure.
+ *               : uint16_t  pipemode  : CUSE/D0DMA/D1DMA
+ *               : uint8_t   *p_data   : Data to write. No alignment required.
+ *               : uint16_t  count     : Number of 32-bit accesses.
+ * Return value    : none
+ ******************************************************************************/
+void hw_usb_write_fifo32_burst (usb_utr_t * ptr, uint16_t pipemode, uint8_t const * p_data, uint16_t count)
+{
+    volatile uint32_t * p_fifo = hw_usb_get_fifo32_adr(ptr, pipemode);
+    uint32_t            data;
+
+    if (NULL == p_fifo)
+    {
+        USB_DEBUG_HOOK(USB_DEBUG_HOOK_STD | USB_DEBUG_HOOK_CODE3);
+
+        return;
+    }
+
+    if (0U == ((uint32_t) p_data & 3U))
+    {
+        uint32_t const * p_word = (uint32_t const *) p_data;
+
+        /* WAIT_LOOP */
+        for ( ; count >= 4U; count -= 4U)
+        {
+            uint32_t data0 = p_word[0];
+            uint32_t data1 = p_word[1];
+            uint32_t data2 = p_word[2];
+            uint32_t data3 = p_word[3];
+
+            *p_fifo = data0;
+            *p_fifo = data1;
+            *p_fifo = data2;
+            *p_fifo = data3;
+            p_word += 4;
+        }
+
+        /* WAIT_LOOP */
+        for ( ; 0U != count; count--)
+        {
+            *p_fifo = *p_word;
+            p_word++;
+        }
+    }
+    else
+    {
+        /* WAIT_LOOP */
+        for ( ; 0U != count; count--)
+        {
+            memcpy(&data, p_data, sizeof(data));
+            *p_fifo = data;
+            p_data += sizeof(uint32_t);
+        }
+    }
+}
+
+/******************************************************************************
+ * End of function hw_usb_write_fifo32_burst
+ ******************************************************************************/
+
+/******************************************************************************
+ * Function Name   : hw_usb_read_fifo32_burst
+ * Description     : Reads the specified pipemode's FIFO register, 32-bits wide,
+ *               : into a buffer. The FIFO port address is resolved once. Word
+ *               : aligned buffers are stored four words at a time (STM).
+ * Arguments       : usb_utr_t *ptr      : Pointer to usb_utr_t structure.
+ *               : uint16_t  pipemode  : CUSE/D0DMA/D1DMA
+ *               : uint8_t   *p_data   : Buffer to store the data. No alignment required.
+ *               : uint16_t  count     : Number of 32-bit accesses.
+ * Return value    : none
+ ******************************************************************************/
+void hw_usb_read_fifo32_burst (usb_utr_t * ptr, uint16_t pipemode, uint8_t * p_data, uint16_t count)
+{
+    volatile uint32_t * p_fifo = hw_usb_get_fifo32_adr(ptr, pipemode);
+    uint32_t            data;
+
+    if (NULL == p_fifo)
+    {
+        USB_DEBUG_HOOK(USB_DEBUG_HOOK_STD | USB_DEBUG_HOOK_CODE2);
+
+        return;
+    }
+
+    if (0U == ((uint32_t) p_data & 3U))
+    {
+        uint32_t * p_word = (uint32_t *) p_data;
+
+        /* WAIT_LOOP */
+        for ( ; count >= 4U; count -= 4U)
+        {
+            uint32_t data0 = *p_fifo;
+            uint32_t data1 = *p_fifo;
+            uint32_t data2 = *p_fifo;
+            uint32_t data3 = *p_fifo;
+
+            p_word[0] = data0;
+            p_word[1] = data1;
+            p_word[2] = data2;
+            p_word[3] = data3;
+            p_word   += 4;
+        }
+
+        /* WAIT_LOOP */
+        for ( ; 0U != count; count--)
+        {
+            *p_word = *p_fifo;
+            p_word++;
+        }
+    }
+    else
+    {
+        /* WAIT_LOOP */
+        for ( ; 0U != count; count--)
+        {
+            data = *p_fifo;
+            memcpy(p_data, &data, sizeof(data));
+            p_data += sizeof(uint32_t);
+        }
+    }
+}
+
+/******************************************************************************
+ * End of function hw_usb_read_fifo32_burst
+ ******************************************************************************/
+#endif                                 /* defined(BSP_MCU_GROUP_RA6M3) */
+
+/******************************************************************************
+ * Function Name   : hw_usb_get_fifo16_adr
+ * Description     : Returns the *address* of the 16-bit FIFO port register
+ *               : corresponding to specified PIPEMODE.
+ * Arguments       : usb_utr_t *ptr      : Pointer to usb_utr_t structure.
+ *               : uint16_t  pipemode  : CUSE/D0DMA/D1DMA
+ * Return value    : FIFO port address, NULL if pipemode is invalid.
+ ******************************************************************************/
+static volatile uint16_t * hw_usb_get_fifo16_adr (usb_utr_t * ptr, uint16_t pipemode)
+{
+    volatile uint16_t * p_reg = NULL;
+    uint16_t            ip    = 0;
+
+    if (g_usb_usbmode[ptr->ip] == USB_MODE_PERI)
+    {
+#if ((USB_CFG_MODE & USB_CFG_PERI) == USB_CFG_PERI)
+        if (USB_CFG_IP1 == ptr->ip)
+        {
+            ip = USB_IP1;
+        }
+        else
+        {
+            ip = USB_IP0;
+        }
+#endif                                 /* (USB_CFG_MODE & USB_CFG_PERI) == USB_CFG_REPI */
+    }
+    else
+    {
+#if ((USB_CFG_MODE & USB_CFG_HOST) == USB_CFG_HOST)
+        ip = ptr->ip;
+#endif                                 /* (USB_CFG_MODE & USB_CFG_HOST) == USB_CFG_HOST */
+    }
+
+    if (USB_IP0 == ip)
+    {
+        switch (pipemode)
+        {
+            case USB_CUSE:
+            {
+                p_reg = &USB0_CFIFO16;
+                break;
+            }
+
+            case USB_D0USE:
+            {
+                p_reg = &USB0_D0FIFO16;
+                break;
+            }
+
+            case USB_D1USE:
+            {
+                p_reg = &USB0_D1FIFO16;
+                break;
+            }
+
+            default:
+            {
+                break;
+            }
+        }
+    }
+
+#if USB_NUM_USBIP == 2
+    else if (USB_IP1 == ip)
+    {
+        switch (pipemode)
+        {
+            case USB_CUSE:
+            {
+                p_reg = &USB1_CFIFO16;
+                break;
+            }
+
+            case USB_D0USE:
+            {
+                p_reg = &USB1_D0FIFO16;
+                break;
+            }
+
+            case USB_D1USE:
+            {
+                p_reg = &USB1_D1FIFO16;
+                break;
+            }
+
+            default:
+            {
+                break;
+            }
+        }
+    }
+#endif                                 /* USB_NUM_USBIP == 2 */
+    else
+    {
+        /* None */
+    }
+
+    return p_reg;
+}
+
+/******************************************************************************
+ * End of function hw_usb_get_fifo16_adr
+ ******************************************************************************/
+
+#if defined(BSP_MCU_GROUP_RA6M3)
+
+/******************************************************************************
+ * Function Name   : hw_usb_get_fifo32_adr
+ * Description     : Returns the *address* of the 32-bit FIFO port register
+ *               : corresponding to specified PIPEMODE. Only USBHS has 32-bit
+ *               : FIFO ports.
+ * Arguments       : usb_utr_t *ptr      : Pointer to usb_utr_t structure.
+ *               : uint16_t  pipemode  : CUSE/D0DMA/D1DMA
+ * Return value    : FIFO port address, NULL if pipemode is invalid.
+ ******************************************************************************/
+static volatile uint32_t * hw_usb_get_fifo32_adr (usb_utr_t * ptr, uint16_t pipemode)
+{
+    volatile uint32_t * p_reg = NULL;
+    uint16_t            ip    = USB_IP0;
+
+    if (g_usb_usbmode[ptr->ip] == USB_MODE_PERI)
+    {
+ #if ((USB_CFG_MODE & USB_CFG_PERI) == USB_CFG_PERI)
+        if (USB_CFG_IP1 == ptr->ip)
+        {
+            ip = USB_IP1;
+        }
+ #endif                                /* (USB_CFG_MODE & USB_CFG_PERI) == USB_CFG_REPI */
+    }
+    else
+    {
+ #if ((USB_CFG_MODE & USB_CFG_HOST) == USB_CFG_HOST)
+        ip = ptr->ip;
+ #endif                                /* (USB_CFG_MODE & USB_CFG_HOST) == USB_CFG_HOST */
+    }
+
+    if (USB_IP1 == ip)
+    {
+        switch (pipemode)
+        {
+            case USB_CUSE:
+            {
+                p_reg = &USB1_CFIFO32;
+                break;
+            }
+
+            case USB_D0USE:
+            {
+                p_reg = &USB1_D0FIFO32;
+                break;
+            }
+
+            case USB_D1USE:
+            {
+                p_reg = &USB1_D1FIFO32;
+                break;
+            }
+
+            default:
+            {
+                break;
+            }
+        }
+    }
+
+    return p_reg;
+}
+
+/******************************************************************************
+ * End of function hw_usb_get_fifo32_adr
+ ******************************************************************************/
+#endif                                 /* defined(BSP_MCU_GROUP_RA6M3) */
+
 /******************************************************************************
  * Function Name   : hw_usb_get_fifosel_adr
  * Description     : Returns the *address* of the FIFOSEL register corresponding to
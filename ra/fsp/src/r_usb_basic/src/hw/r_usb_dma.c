@@ -403,6 +403,21 @@ void usb_cstd_dma_driver (void)
 /******************************************************************************
  * End of function usb_cstd_dma_driver
  ******************************************************************************/
+
+/******************************************************************************
+ * Function Name   : usb_cstd_dma_pending
+ * Description     : Check whether a DMA transfer completion waits to be processed.
+ * Arguments       : none
+ * Return value    : uint8_t : USB_TRUE if usb_cstd_dma_driver has work left
+ ******************************************************************************/
+uint8_t usb_cstd_dma_pending (void)
+{
+    return (gs_usb_cstd_dma_int.wp != gs_usb_cstd_dma_int.rp) ? USB_TRUE : USB_FALSE;
+}
+
+/******************************************************************************
+ * End of function usb_cstd_dma_pending
+ ******************************************************************************/
  #endif                                /* BSP_CFG_RTOS_USED == 0 */
 
 /******************************************************************************
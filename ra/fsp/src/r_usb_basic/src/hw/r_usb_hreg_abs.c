@@ -21,6 +21,8 @@
 /******************************************************************************
  * Includes   <System Includes> , "Project Includes"
  ******************************************************************************/
+#include <string.h>
+
 #include <r_usb_basic.h>
 #include <r_usb_basic_api.h>
 
@@ -672,15 +674,12 @@ uint8_t * usb_hstd_write_fifo (usb_utr_t * ptr, uint16_t count, uint16_t pipemod
  #if defined(BSP_MCU_GROUP_RA6M3)
     if (USB_IP0 == ptr->ip)
     {
-        /* WAIT_LOOP */
-        for (even = (uint16_t) (count >> 1); (0 != even); --even)
-        {
-            /* 16bit access */
-            hw_usb_write_fifo16(ptr, pipemode, *((uint16_t *) write_p));
+        /* 16bit FIFO access */
+        even = (uint16_t) (count >> 1);
+        hw_usb_write_fifo16_burst(ptr, pipemode, write_p, even);
 
-            /* Renewal write pointer */
-            write_p += sizeof(uint16_t);
-        }
+        /* Renewal write pointer */
+        write_p += (even * sizeof(uint16_t));
 
         if ((count & (uint16_t) 0x0001U) != 0U)
         {
@@ -701,15 +700,12 @@ uint8_t * usb_hstd_write_fifo (usb_utr_t * ptr, uint16_t count, uint16_t pipemod
     }
     else if (USB_IP1 == ptr->ip)
     {
-        /* WAIT_LOOP */
-        for (even = (uint16_t) (count >> 2); (0 != even); --even)
-        {
-            /* 16bit access */
-            hw_usb_write_fifo32(ptr, pipemode, *((uint32_t *) write_p));
+        /* 32bit FIFO access */
+        even = (uint16_t) (count >> 2);
+        hw_usb_write_fifo32_burst(ptr, pipemode, write_p, even);
 
-            /* Renewal write pointer */
-            write_p += sizeof(uint32_t);
-        }
+        /* Renewal write pointer */
+        write_p += (even * sizeof(uint32_t));
 
         odd = count % 4;
         if ((odd & (uint16_t) 0x0002U) != 0U)
@@ -747,15 +743,12 @@ uint8_t * usb_hstd_write_fifo (usb_utr_t * ptr, uint16_t count, uint16_t pipemod
         /* Non */
     }
  #else                                 /* defined(BSP_MCU_GROUP_RA6M3) */
-    /* WAIT_LOOP */
-    for (even = (uint16_t) (count >> 1); (0 != even); --even)
-    {
-        /* 16bit access */
-        hw_usb_write_fifo16(ptr, pipemode, *((uint16_t *) write_p));
+    /* 16bit FIFO access */
+    even = (uint16_t) (count >> 1);
+    hw_usb_write_fifo16_burst(ptr, pipemode, write_p, even);
 
-        /* Renewal write pointer */
-        write_p += sizeof(uint16_t);
-    }
+    /* Renewal write pointer */
+    write_p += (even * sizeof(uint16_t));
 
     if ((count & (uint16_t) 0x0001U) != 0U)
     {
@@ -807,15 +800,12 @@ uint8_t * usb_hstd_read_fifo (usb_utr_t * ptr, uint16_t count, uint16_t pipemode
  #if defined(BSP_MCU_GROUP_RA6M3)
     if (USB_IP0 == ptr->ip)
     {
-        /* WAIT_LOOP */
-        for (even = (uint16_t) (count >> 1); (0 != even); --even)
-        {
-            /* 16bit FIFO access */
-            *(uint16_t *) read_p = hw_usb_read_fifo16(ptr, pipemode);
+        /* 16bit FIFO access */
+        even = (uint16_t) (count >> 1);
+        hw_usb_read_fifo16_burst(ptr, pipemode, read_p, even);
 
-            /* Renewal read pointer */
-            read_p += sizeof(uint16_t);
-        }
+        /* Renewal read pointer */
+        read_p += (even * sizeof(uint16_t));
 
         if ((count & (uint16_t) 0x0001) != 0)
         {
@@ -835,15 +825,12 @@ uint8_t * usb_hstd_read_fifo (usb_utr_t * ptr, uint16_t count, uint16_t pipemode
     }
     else if (USB_IP1 == ptr->ip)
     {
-        /* WAIT_LOOP */
-        for (even = (uint16_t) (count >> 2); (0 != even); --even)
-        {
-            /* 32bit FIFO access */
-            *(uint32_t *) read_p = hw_usb_read_fifo32(ptr, pipemode);
+        /* 32bit FIFO access */
+        even = (uint16_t) (count >> 2);
+        hw_usb_read_fifo32_burst(ptr, pipemode, read_p, even);
 
-            /* Renewal read pointer */
-            read_p += sizeof(uint32_t);
-        }
+        /* Renewal read pointer */
+        read_p += (even * sizeof(uint32_t));
 
         odd = count % 4;
         if (count < 4)
@@ -859,16 +846,11 @@ uint8_t * usb_hstd_read_fifo (usb_utr_t * ptr, uint16_t count, uint16_t pipemode
             /* Condition compilation by the difference of the little endian */
   #if USB_CFG_ENDIAN == USB_CFG_LITTLE
 
-            /* WAIT_LOOP */
-            do
-            {
-                *read_p            = (uint8_t) (odd_byte_data_temp & USB_VALUE_000000FFH);
-                odd_byte_data_temp = odd_byte_data_temp >> 8;
+            /* Store the remaining bytes of the last word with one copy. */
+            memcpy(read_p, &odd_byte_data_temp, odd);
 
-                /* Renewal read pointer */
-                read_p += sizeof(uint8_t);
-                odd--;
-            } while (odd != 0);
+            /* Renewal read pointer */
+            read_p += odd;
   #else                                /* USB_CFG_ENDIAN == USB_CFG_LITTLE */
             /* WAIT_LOOP */
             for (i = 0; i < odd; i++)
@@ -886,15 +868,12 @@ uint8_t * usb_hstd_read_fifo (usb_utr_t * ptr, uint16_t count, uint16_t pipemode
         /* None */
     }
  #else                                 /* defined(BSP_MCU_GROUP_RA6M3) */
-    /* WAIT_LOOP */
-    for (even = (uint16_t) (count >> 1); (0 != even); --even)
-    {
-        /* 16bit FIFO access */
-        *(uint16_t *) read_p = hw_usb_read_fifo16(ptr, pipemode);
+    /* 16bit FIFO access */
+    even = (uint16_t) (count >> 1);
+    hw_usb_read_fifo16_burst(ptr, pipemode, read_p, even);
 
-        /* Renewal read pointer */
-        read_p += sizeof(uint16_t);
-    }
+    /* Renewal read pointer */
+    read_p += (even * sizeof(uint16_t));
 
     if ((count & (uint16_t) 0x0001) != 0)
     {
@@ -21,6 +21,8 @@
 /******************************************************************************
  * Includes   <System Includes> , "Project Includes"
  ******************************************************************************/
+#include <string.h>
+
 #include <r_usb_basic.h>
 #include <r_usb_basic_api.h>
 
@@ -505,15 +507,12 @@ uint8_t * usb_pstd_write_fifo (uint16_t count, uint16_t pipemode, uint8_t * writ
 
     if ((USB_CFG_IP0 == p_utr->ip) || (0 == hs_flag))
     {
-        /* WAIT_LOOP */
-        for (even = (uint16_t) (count >> 1); (0 != even); --even)
-        {
-            /* 16bit access */
-            hw_usb_write_fifo16(p_utr, pipemode, *((uint16_t *) write_p));
+        /* 16bit FIFO access */
+        even = (uint16_t) (count >> 1);
+        hw_usb_write_fifo16_burst(p_utr, pipemode, write_p, even);
 
-            /* Renewal write pointer */
-            write_p += sizeof(uint16_t);
-        }
+        /* Renewal write pointer */
+        write_p += (even * sizeof(uint16_t));
 
         if ((count & (uint16_t) 0x0001U) != 0U)
         {
@@ -536,15 +535,12 @@ uint8_t * usb_pstd_write_fifo (uint16_t count, uint16_t pipemode, uint8_t * writ
  #if defined(BSP_MCU_GROUP_RA6M3)
     else
     {
-        /* WAIT_LOOP */
-        for (even = (uint16_t) (count >> 2); (even != 0); --even)
-        {
-            /* 32bit access */
-            hw_usb_write_fifo32(p_utr, pipemode, *((uint32_t *) write_p));
+        /* 32bit FIFO access */
+        even = (uint16_t) (count >> 2);
+        hw_usb_write_fifo32_burst(p_utr, pipemode, write_p, even);
 
-            /* Renewal write pointer */
-            write_p += sizeof(uint32_t);
-        }
+        /* Renewal write pointer */
+        write_p += (even * sizeof(uint32_t));
 
         odd = count % 4;
         if ((odd & (uint16_t) 0x0002U) != 0U)
@@ -609,15 +605,12 @@ uint8_t * usb_pstd_read_fifo (uint16_t count, uint16_t pipemode, uint8_t * read_
 
     if ((USB_CFG_IP0 == p_utr->ip) || (0 == hs_flag))
     {
-        /* WAIT_LOOP */
-        for (even = (uint16_t) (count >> 1); (0 != even); --even)
-        {
-            /* 16bit FIFO access */
-            *(uint16_t *) read_p = hw_usb_read_fifo16(p_utr, pipemode);
+        /* 16bit FIFO access */
+        even = (uint16_t) (count >> 1);
+        hw_usb_read_fifo16_burst(p_utr, pipemode, read_p, even);
 
-            /* Renewal read pointer */
-            read_p += sizeof(uint16_t);
-        }
+        /* Renewal read pointer */
+        read_p += (even * sizeof(uint16_t));
 
         if ((count & (uint16_t) 0x0001) != 0)
         {
@@ -639,15 +632,12 @@ uint8_t * usb_pstd_read_fifo (uint16_t count, uint16_t pipemode, uint8_t * read_
  #if defined(BSP_MCU_GROUP_RA6M3)
     else
     {
-        /* WAIT_LOOP */
-        for (even = (uint16_t) (count >> 2); (even != 0); --even)
-        {
-            /* 32bit FIFO access */
-            *(uint32_t *) read_p = hw_usb_read_fifo32(p_utr, pipemode);
+        /* 32bit FIFO access */
+        even = (uint16_t) (count >> 2);
+        hw_usb_read_fifo32_burst(p_utr, pipemode, read_p, even);
 
-            /* Renewal read pointer */
-            read_p += sizeof(uint32_t);
-        }
+        /* Renewal read pointer */
+        read_p += (even * sizeof(uint32_t));
 
         odd = count % 4;
         if (count < 4)
@@ -663,16 +653,11 @@ uint8_t * usb_pstd_read_fifo (uint16_t count, uint16_t pipemode, uint8_t * read_
             /* Condition compilation by the difference of the endian */
   #if USB_CFG_ENDIAN == USB_CFG_LITTLE
 
-            /* WAIT_LOOP */
-            do
-            {
-                *read_p            = (uint8_t) (odd_byte_data_temp & USB_VAL_FFH);
-                odd_byte_data_temp = odd_byte_data_temp >> 8;
+            /* Store the remaining bytes of the last word with one copy. */
+            memcpy(read_p, &odd_byte_data_temp, odd);
 
-                /* Renewal read pointer */
-                read_p += sizeof(uint8_t);
-                odd--;
-            } while (odd != 0);
+            /* Renewal read pointer */
+            read_p += odd;
   #else                                /* USB_CFG_ENDIAN == USB_CFG_LITTLE */
             /* WAIT_LOOP */
             for (i = 0; i < odd; i++)
@@ -755,6 +740,8 @@ void usb_pstd_forced_termination (uint16_t pipe, uint16_t status, usb_utr_t * p_
     /* FIFO buffer SPLIT transaction initialized */
     hw_usb_set_csclr(p_utr, pipe);
 
+    usb_pstd_fifo_port_release(pipe);
+
     /* Call Back */
     if (USB_NULL != g_p_usb_pstd_pipe[pipe])
     {
@@ -763,18 +750,32 @@ void usb_pstd_forced_termination (uint16_t pipe, uint16_t status, usb_utr_t * p_
         g_p_usb_pstd_pipe[pipe]->status  = status;
         g_p_usb_pstd_pipe[pipe]->pipectr = hw_usb_read_pipectr(p_utr, pipe);
 
+ #if (BSP_CFG_RTOS == 0)
+        usb_utr_t * p_done = g_p_usb_pstd_pipe[pipe];
+
+        /* Release the pipe first so that the callback can request a new transfer */
+        g_p_usb_pstd_pipe[pipe] = (usb_utr_t *) USB_NULL;
+        if (USB_NULL != (p_done->complete))
+        {
+            (p_done->complete)(p_done, USB_NULL, USB_NULL);
+        }
+
+        /* Transfers queued behind the terminated one are terminated with it */
+        usb_pstd_pipe_queue_flush(pipe, status, p_utr);
+ #else                                 /* (BSP_CFG_RTOS == 0) */
         if (USB_NULL != (g_p_usb_pstd_pipe[pipe]->complete))
         {
             (g_p_usb_pstd_pipe[pipe]->complete)(g_p_usb_pstd_pipe[pipe], USB_NULL, USB_NULL);
         }
 
- #if (BSP_CFG_RTOS == 2)
+  #if (BSP_CFG_RTOS == 2)
         vPortFree(g_p_usb_pstd_pipe[pipe]);
         g_p_usb_pstd_pipe[pipe] = (usb_utr_t *) USB_NULL;
         usb_cstd_pipe_msg_re_forward(USB_IP0, pipe);
- #else                                 /* (BSP_CFG_RTOS == 2) */
+  #else                                /* (BSP_CFG_RTOS == 2) */
         g_p_usb_pstd_pipe[pipe] = (usb_utr_t *) USB_NULL;
- #endif /* (BSP_CFG_RTOS == 2) */
+  #endif /* (BSP_CFG_RTOS == 2) */
+ #endif                                /* (BSP_CFG_RTOS == 0) */
     }
 }
 
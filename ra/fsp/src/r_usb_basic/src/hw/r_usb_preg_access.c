@@ -146,6 +146,50 @@ void hw_usb_pclear_enb_rsme (uint8_t usb_ip)
  * End of function hw_usb_pclear_enb_rsme
  ******************************************************************************/
 
+/******************************************************************************
+ * Function Name   : hw_usb_pset_enb_sofe
+ * Description     : Enable interrupt from Frame Number Update
+ * Arguments       : none
+ * Return value    : none
+ ******************************************************************************/
+void hw_usb_pset_enb_sofe (uint8_t usb_ip)
+{
+    if (USB_CFG_IP0 == usb_ip)
+    {
+        USB_M0->INTENB0 |= USB_SOFE;
+    }
+    else
+    {
+        USB_M1->INTENB0 |= USB_SOFE;
+    }
+}
+
+/******************************************************************************
+ * End of function hw_usb_pset_enb_sofe
+ ******************************************************************************/
+
+/******************************************************************************
+ * Function Name   : hw_usb_pclear_enb_sofe
+ * Description     : Disable interrupt from Frame Number Update
+ * Arguments       : none
+ * Return value    : none
+ ******************************************************************************/
+void hw_usb_pclear_enb_sofe (uint8_t usb_ip)
+{
+    if (USB_CFG_IP0 == usb_ip)
+    {
+        USB_M0->INTENB0 = (uint16_t) (USB_M0->INTENB0 & (~USB_SOFE));
+    }
+    else
+    {
+        USB_M1->INTENB0 = (uint16_t) (USB_M1->INTENB0 & (~USB_SOFE));
+    }
+}
+
+/******************************************************************************
+ * End of function hw_usb_pclear_enb_sofe
+ ******************************************************************************/
+
 /******************************************************************************
  * Function Name   : hw_usb_pclear_sts_resm
  * Description     : Clear interrupt status of RESUME.
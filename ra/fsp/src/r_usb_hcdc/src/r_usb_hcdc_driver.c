@@ -29,9 +29,31 @@
 #include "../../../r_usb_basic/src/driver/inc/r_usb_extern.h"
 #include "../../../r_usb_basic/src/hw/inc/r_usb_bitdefine.h"
 #include "r_usb_hcdc_api.h"
+#include "r_usb_hcdc.h"
 #include "inc/r_usb_hcdc.h"
 
-#define USB_VALUE_32    (32)
+#define USB_VALUE_32            (32)
+#define USB_HCDC_STREAM_OPEN    (0x48434453UL) /* "HCDS" */
+
+/******************************************************************************
+ * Typedef definitions
+ ******************************************************************************/
+
+/* Streaming receive state. The bulk IN pipe has one transfer in flight; the next one is started from the completion
+ * callback of the previous one, before the application is notified, so the pipe stays armed as long as buffers are
+ * available. */
+typedef struct st_usb_hcdc_stream
+{
+    uint32_t                      open;
+    usb_hcdc_stream_cfg_t const * p_cfg;
+    usb_utr_t                     rx_utr;
+    uint16_t                      devadr;     /* Address of the streaming device */
+    uint8_t                       rx_next;    /* Next receive buffer to arm */
+    uint8_t                       rx_release; /* Next receive buffer expected by R_USB_HCDC_StreamRelease() */
+    uint8_t                       rx_held;    /* Receive buffers filled and not yet released */
+    uint8_t                       rx_busy;    /* Bulk IN transfer in flight */
+    uint8_t                       rx_paused;  /* RX_PAUSED reported and RX_RESUMED not yet */
+} usb_hcdc_stream_t;
 
 /******************************************************************************
  * Private global variables and functions
@@ -46,6 +68,12 @@ static void usb_hcdc_check_result(usb_utr_t * mess, uint16_t data1, uint16_t dat
 #endif  /* (BSP_CFG_RTOS == 2) */
 static void usb_hcdc_init(usb_utr_t * ptr, uint16_t data1, uint16_t data2);
 
+static usb_hcdc_stream_t g_usb_hcdc_stream;
+
+static void usb_hcdc_stream_rx_start(void);
+static void usb_hcdc_stream_read_complete(usb_utr_t * mess, uint16_t data1, uint16_t data2);
+static void usb_hcdc_stream_callback(usb_hcdc_stream_event_t event, uint8_t * p_buffer, uint32_t size);
+
 /******************************************************************************
  * Exported global variables (to be accessed by other files)
  ******************************************************************************/
@@ -437,6 +465,15 @@ void usb_hcdc_detach (usb_utr_t * ptr, uint16_t devadr, uint16_t data2)
     usb_instance_ctrl_t ctrl;
 
     (void) data2;
+
+    /* The pipe table is cleared below, so the stream transfer will not complete */
+    if ((USB_HCDC_STREAM_OPEN == g_usb_hcdc_stream.open) && (ptr->ip == g_usb_hcdc_stream.rx_utr.ip) &&
+        (devadr == g_usb_hcdc_stream.devadr))
+    {
+        g_usb_hcdc_stream.open = 0U;
+        usb_hcdc_stream_callback(USB_HCDC_STREAM_EVENT_STOPPED, NULL, 0U);
+    }
+
     usb_hstd_clr_pipe_table(ptr->ip, devadr);
     ctrl.module_number  = ptr->ip;           /* Module number setting */
     ctrl.device_address = (uint8_t) devadr;
@@ -891,6 +928,292 @@ uint16_t usb_hcdc_get_string_info (usb_utr_t * mess, uint16_t addr, uint16_t str
 
 #endif /* (BSP_CFG_RTOS == 2) */
 
+/*******************************************************************************************************************//**
+ * @addtogroup USB_HCDC
+ * @{
+ **********************************************************************************************************************/
+
+/**************************************************************************//**
+ * @brief Start streaming receive on the CDC data interface of a configured device.
+ *
+ * The bulk IN pipe is kept armed with the receive buffers of p_cfg in turn. The next transfer is started from the
+ * completion of the previous one, before the application is notified, so the device is only NAKed while every
+ * buffer is held by the application. Each buffer is reported when it is full or when the device ends the transfer
+ * with a short packet. When every buffer is held, USB_HCDC_STREAM_EVENT_RX_PAUSED is reported and the device is
+ * NAKed until a buffer is released, which lets an application pass the back pressure on, for example by dropping
+ * RTS with a SET_CONTROL_LINE_STATE request.
+ *
+ * p_ctrl->device_address selects the device. R_USB_Read() must not be used on the CDC data interface while
+ * streaming receive is open; R_USB_Write() and the class requests may be used as usual.
+ *
+ * @retval FSP_SUCCESS           Streaming receive started.
+ * @retval FSP_ERR_ASSERTION     Parameter is NULL.
+ * @retval FSP_ERR_USB_PARAMETER Invalid receive buffer configuration.
+ * @retval FSP_ERR_ALREADY_OPEN  Streaming receive is already open.
+ * @retval FSP_ERR_USB_FAILED    The device is not configured.
+ ******************************************************************************/
+fsp_err_t R_USB_HCDC_StreamOpen (usb_ctrl_t * const p_api_ctrl, usb_hcdc_stream_cfg_t const * const p_cfg)
+{
+    usb_instance_ctrl_t * p_ctrl = (usb_instance_ctrl_t *) p_api_ctrl;
+    usb_info_t            info;
+
+#if USB_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(p_ctrl);
+    FSP_ASSERT(p_cfg);
+    FSP_ASSERT(p_cfg->p_rx_buffer);
+    FSP_ASSERT(p_cfg->p_callback);
+    FSP_ERROR_RETURN(2U <= p_cfg->rx_buffer_num, FSP_ERR_USB_PARAMETER);
+    FSP_ERROR_RETURN(0U != p_cfg->rx_buffer_size, FSP_ERR_USB_PARAMETER);
+    FSP_ERROR_RETURN(0U == (p_cfg->rx_buffer_size & 0x03U), FSP_ERR_USB_PARAMETER);
+    FSP_ERROR_RETURN(0U == ((uint32_t) p_cfg->p_rx_buffer & 0x03U), FSP_ERR_USB_PARAMETER);
+#endif                                 /* USB_CFG_PARAM_CHECKING_ENABLE */
+
+    FSP_ERROR_RETURN(USB_HCDC_STREAM_OPEN != g_usb_hcdc_stream.open, FSP_ERR_ALREADY_OPEN);
+
+    p_ctrl->type = USB_CLASS_HCDC;
+    (void) R_USB_InfoGet(p_ctrl, &info, p_ctrl->device_address);
+    FSP_ERROR_RETURN(USB_STATUS_CONFIGURED == info.device_status, FSP_ERR_USB_FAILED);
+
+    memset(&g_usb_hcdc_stream, 0, sizeof(g_usb_hcdc_stream));
+    g_usb_hcdc_stream.p_cfg  = p_cfg;
+    g_usb_hcdc_stream.devadr = p_ctrl->device_address;
+
+    g_usb_hcdc_stream.rx_utr.ip       = p_ctrl->module_number;
+    g_usb_hcdc_stream.rx_utr.ipp      = usb_hstd_get_usb_ip_adr(p_ctrl->module_number);
+    g_usb_hcdc_stream.rx_utr.keyword  = USB_CFG_HCDC_BULK_IN;
+    g_usb_hcdc_stream.rx_utr.p_setup  = 0;
+    g_usb_hcdc_stream.rx_utr.segment  = USB_TRAN_END;
+    g_usb_hcdc_stream.rx_utr.complete = (usb_cb_t) usb_hcdc_stream_read_complete;
+#if (USB_CFG_DMA == USB_CFG_ENABLE)
+    g_usb_hcdc_stream.rx_utr.p_transfer_tx = p_ctrl->p_transfer_tx;
+    g_usb_hcdc_stream.rx_utr.p_transfer_rx = p_ctrl->p_transfer_rx;
+#endif                                 /* (USB_CFG_DMA == USB_CFG_ENABLE) */
+
+    g_usb_hcdc_stream.open = USB_HCDC_STREAM_OPEN;
+
+    usb_hcdc_stream_rx_start();
+
+    return FSP_SUCCESS;
+}
+
+/**************************************************************************//**
+ * @brief Return a receive buffer reported by USB_HCDC_STREAM_EVENT_RX_COMPLETE to the driver.
+ *
+ * Buffers must be released in the order they were reported. If the bulk IN pipe was parked because every receive
+ * buffer was held by the application, it is armed again and USB_HCDC_STREAM_EVENT_RX_RESUMED is reported. This
+ * function may be called from the streaming receive callback.
+ *
+ * @retval FSP_SUCCESS           Buffer released.
+ * @retval FSP_ERR_ASSERTION     Parameter is NULL.
+ * @retval FSP_ERR_USB_PARAMETER p_buf is not the oldest buffer held by the application.
+ * @retval FSP_ERR_NOT_OPEN      Streaming receive is not open.
+ ******************************************************************************/
+fsp_err_t R_USB_HCDC_StreamRelease (usb_ctrl_t * const p_api_ctrl, uint8_t * const p_buf)
+{
+    usb_hcdc_stream_cfg_t const * p_cfg = g_usb_hcdc_stream.p_cfg;
+
+#if USB_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(p_api_ctrl);
+    FSP_ASSERT(p_buf);
+#else
+    FSP_PARAMETER_NOT_USED(p_api_ctrl);
+#endif                                 /* USB_CFG_PARAM_CHECKING_ENABLE */
+
+    FSP_ERROR_RETURN(USB_HCDC_STREAM_OPEN == g_usb_hcdc_stream.open, FSP_ERR_NOT_OPEN);
+
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+    if ((0U == g_usb_hcdc_stream.rx_held) ||
+        (p_buf != &p_cfg->p_rx_buffer[g_usb_hcdc_stream.rx_release * p_cfg->rx_buffer_size]))
+    {
+        FSP_CRITICAL_SECTION_EXIT;
+
+        return FSP_ERR_USB_PARAMETER;
+    }
+
+    g_usb_hcdc_stream.rx_release = (uint8_t) ((g_usb_hcdc_stream.rx_release + 1U) % p_cfg->rx_buffer_num);
+    g_usb_hcdc_stream.rx_held--;
+    FSP_CRITICAL_SECTION_EXIT;
+
+    usb_hcdc_stream_rx_start();
+
+    return FSP_SUCCESS;
+}
+
+/**************************************************************************//**
+ * @brief Stop streaming receive. The transfer in flight is terminated and its data is dropped.
+ *
+ * @retval FSP_SUCCESS           Streaming receive stopped.
+ * @retval FSP_ERR_ASSERTION     Parameter is NULL.
+ * @retval FSP_ERR_NOT_OPEN      Streaming receive is not open.
+ ******************************************************************************/
+fsp_err_t R_USB_HCDC_StreamClose (usb_ctrl_t * const p_api_ctrl)
+{
+    usb_utr_t utr;
+
+#if USB_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(p_api_ctrl);
+#else
+    FSP_PARAMETER_NOT_USED(p_api_ctrl);
+#endif                                 /* USB_CFG_PARAM_CHECKING_ENABLE */
+
+    FSP_ERROR_RETURN(USB_HCDC_STREAM_OPEN == g_usb_hcdc_stream.open, FSP_ERR_NOT_OPEN);
+
+    /* The completion of the terminated transfer is not reported once the stream is closed */
+    g_usb_hcdc_stream.open = 0U;
+
+    if (USB_TRUE == g_usb_hcdc_stream.rx_busy)
+    {
+        utr.ip  = g_usb_hcdc_stream.rx_utr.ip;
+        utr.ipp = g_usb_hcdc_stream.rx_utr.ipp;
+        (void) usb_hstd_transfer_end(&utr, USB_CFG_HCDC_BULK_IN, (uint16_t) USB_DATA_STOP);
+    }
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @} (end addtogroup USB_HCDC)
+ **********************************************************************************************************************/
+
+/******************************************************************************
+ * Function Name   : usb_hcdc_stream_rx_start
+ * Description     : Arm the bulk IN pipe with the next free receive buffer, or report RX_PAUSED/RX_RESUMED when
+ *                 : the flow state changes
+ * Argument        : none
+ * Return          : none
+ ******************************************************************************/
+static void usb_hcdc_stream_rx_start (void)
+{
+    usb_hcdc_stream_cfg_t const * p_cfg = g_usb_hcdc_stream.p_cfg;
+    uint8_t                     * p_buf;
+    uint8_t                       was_paused;
+
+    /* Claim the pipe; the transfer itself is started outside the critical section */
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+    if ((USB_HCDC_STREAM_OPEN != g_usb_hcdc_stream.open) || (USB_TRUE == g_usb_hcdc_stream.rx_busy))
+    {
+        FSP_CRITICAL_SECTION_EXIT;
+
+        return;
+    }
+
+    if (p_cfg->rx_buffer_num <= g_usb_hcdc_stream.rx_held)
+    {
+        was_paused                  = g_usb_hcdc_stream.rx_paused;
+        g_usb_hcdc_stream.rx_paused = USB_TRUE;
+        FSP_CRITICAL_SECTION_EXIT;
+
+        if (USB_TRUE != was_paused)
+        {
+            usb_hcdc_stream_callback(USB_HCDC_STREAM_EVENT_RX_PAUSED, NULL, 0U);
+        }
+
+        return;
+    }
+
+    was_paused                  = g_usb_hcdc_stream.rx_paused;
+    g_usb_hcdc_stream.rx_paused = USB_FALSE;
+    g_usb_hcdc_stream.rx_busy   = USB_TRUE;
+    FSP_CRITICAL_SECTION_EXIT;
+
+    p_buf = &p_cfg->p_rx_buffer[g_usb_hcdc_stream.rx_next * p_cfg->rx_buffer_size];
+    g_usb_hcdc_stream.rx_utr.p_tranadr    = p_buf;
+    g_usb_hcdc_stream.rx_utr.tranlen      = p_cfg->rx_buffer_size;
+    g_usb_hcdc_stream.rx_utr.read_req_len = p_cfg->rx_buffer_size;
+
+    if (USB_OK != usb_hstd_transfer_start(&g_usb_hcdc_stream.rx_utr))
+    {
+        g_usb_hcdc_stream.rx_busy = USB_FALSE;
+        usb_hcdc_stream_callback(USB_HCDC_STREAM_EVENT_STOPPED, p_buf, 0U);
+
+        return;
+    }
+
+    if (USB_TRUE == was_paused)
+    {
+        usb_hcdc_stream_callback(USB_HCDC_STREAM_EVENT_RX_RESUMED, NULL, 0U);
+    }
+}
+
+/******************************************************************************
+ * End of function usb_hcdc_stream_rx_start
+ ******************************************************************************/
+
+/******************************************************************************
+ * Function Name   : usb_hcdc_stream_read_complete
+ * Description     : Bulk IN completion in streaming receive. Arms the pipe with the next buffer and hands the
+ *                 : filled one to the application.
+ * Argument        : usb_utr_t    *mess   : Pointer to usb_utr_t structure.
+ *               : uint16_t     data1   : Not used
+ *               : uint16_t     data2   : Not used
+ * Return          : none
+ ******************************************************************************/
+static void usb_hcdc_stream_read_complete (usb_utr_t * mess, uint16_t data1, uint16_t data2)
+{
+    usb_hcdc_stream_cfg_t const * p_cfg = g_usb_hcdc_stream.p_cfg;
+    uint8_t                     * p_buf;
+
+    (void) data1;
+    (void) data2;
+
+    if (USB_HCDC_STREAM_OPEN != g_usb_hcdc_stream.open)
+    {
+        return;
+    }
+
+    p_buf = &p_cfg->p_rx_buffer[g_usb_hcdc_stream.rx_next * p_cfg->rx_buffer_size];
+
+    if ((USB_DATA_OK != mess->status) && (USB_DATA_SHT != mess->status))
+    {
+        g_usb_hcdc_stream.rx_busy = USB_FALSE;
+        usb_hcdc_stream_callback(USB_HCDC_STREAM_EVENT_STOPPED, p_buf, 0U);
+
+        return;
+    }
+
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+    g_usb_hcdc_stream.rx_next = (uint8_t) ((g_usb_hcdc_stream.rx_next + 1U) % p_cfg->rx_buffer_num);
+    g_usb_hcdc_stream.rx_held++;
+    g_usb_hcdc_stream.rx_busy = USB_FALSE;
+    FSP_CRITICAL_SECTION_EXIT;
+
+    /* Re-arm before the application sees the data */
+    usb_hcdc_stream_rx_start();
+
+    usb_hcdc_stream_callback(USB_HCDC_STREAM_EVENT_RX_COMPLETE, p_buf, mess->read_req_len - mess->tranlen);
+}
+
+/******************************************************************************
+ * End of function usb_hcdc_stream_read_complete
+ ******************************************************************************/
+
+/******************************************************************************
+ * Function Name   : usb_hcdc_stream_callback
+ * Description     : Call the streaming receive callback
+ * Argument        : usb_hcdc_stream_event_t event   : Event
+ *               : uint8_t                 *p_buffer : Buffer the event refers to
+ *               : uint32_t                size      : Bytes received
+ * Return          : none
+ ******************************************************************************/
+static void usb_hcdc_stream_callback (usb_hcdc_stream_event_t event, uint8_t * p_buffer, uint32_t size)
+{
+    usb_hcdc_stream_callback_args_t args;
+
+    args.event     = event;
+    args.p_buffer  = p_buffer;
+    args.size      = size;
+    args.p_context = g_usb_hcdc_stream.p_cfg->p_context;
+
+    g_usb_hcdc_stream.p_cfg->p_callback(&args);
+}
+
+/******************************************************************************
+ * End of function usb_hcdc_stream_callback
+ ******************************************************************************/
+
 /******************************************************************************
  * End  Of File
  ******************************************************************************/
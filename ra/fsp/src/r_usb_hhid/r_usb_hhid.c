@@ -22,15 +22,51 @@
  * Includes   <System Includes> , "Project Includes"
  ******************************************************************************/
 
+#include <string.h>
+
 #include "r_usb_basic.h"
 #include "../r_usb_basic/src/driver/inc/r_usb_typedef.h"
 #include "../r_usb_basic/src/driver/inc/r_usb_extern.h"
 #include "../r_usb_basic/src/hw/inc/r_usb_reg_access.h"
+#include "../r_usb_basic/src/hw/inc/r_usb_bitdefine.h"
 
 #include "r_usb_hhid_api.h"
 #include "r_usb_hhid.h"
 #include "src/inc/r_usb_hhid_driver.h"
 
+/******************************************************************************
+ * Macro definitions
+ ******************************************************************************/
+#define USB_HHID_REPORT_RING_OPEN    (0x48484952UL) /* "HHIR" */
+
+/******************************************************************************
+ * Typedef definitions
+ ******************************************************************************/
+
+/* Report ring state. The ring is single producer, single consumer: the interrupt IN completion is the only writer of
+ * head and R_USB_HHID_ReportRingRead() the only writer of tail. The entry at head is never visible to the reader, so
+ * the pipe is always armed into it and re-armed from the completion of the previous report. */
+typedef struct st_usb_hhid_report_ring
+{
+    uint32_t                           open;
+    usb_hhid_report_ring_cfg_t const * p_cfg;
+    usb_utr_t                          utr;
+    volatile uint16_t                  head;    /* Entry being received into */
+    volatile uint16_t                  tail;    /* Oldest entry not yet read */
+    uint32_t                           dropped; /* Reports dropped because the ring was full */
+    uint16_t                           size;    /* Interrupt IN max packet size */
+    uint16_t                           pipe;
+} usb_hhid_report_ring_t;
+
+/******************************************************************************
+ * Private global variables and functions
+ ******************************************************************************/
+static usb_hhid_report_ring_t g_usb_hhid_report_ring[USB_NUM_USBIP];
+
+static void usb_hhid_report_ring_start(usb_hhid_report_ring_t * p_ring);
+static void usb_hhid_report_ring_complete(usb_utr_t * mess, uint16_t data1, uint16_t data2);
+static void usb_hhid_report_ring_callback(usb_hhid_report_ring_t * p_ring, usb_hhid_report_ring_event_t event);
+
 /*******************************************************************************************************************//**
  * @addtogroup USB_HHID USB_HHID
  * @{
@@ -163,6 +199,308 @@ fsp_err_t R_USB_HHID_MaxPacketSizeGet (usb_ctrl_t * const p_api_ctrl,
  * End of function R_USB_HHID_MaxPacketSizeGet
  ******************************************************************************/
 
+/*************************************************************************//**
+ * @brief Start receiving reports from the interrupt IN pipe of a HID device into a report ring.
+ *
+ * The pipe stays armed: each transfer is started from the completion of the previous one, without waiting for the
+ * application. Every report is stored with its length and a timestamp. The application drains any number of queued
+ * reports with R_USB_HHID_ReportRingRead(). When the ring is full, new reports are dropped and counted.
+ *
+ * R_USB_Read() must not be used on the interrupt IN pipe of the device while the report ring is open.
+ *
+ * @retval FSP_SUCCESS           Success.
+ * @retval FSP_ERR_ASSERTION     Parameter Null pointer error.
+ * @retval FSP_ERR_USB_PARAMETER Parameter error.
+ * @retval FSP_ERR_ALREADY_OPEN  The report ring of this USB module is already open.
+ * @retval FSP_ERR_USB_FAILED    The device is not configured or has no interrupt IN pipe.
+ ******************************************************************************/
+fsp_err_t R_USB_HHID_ReportRingOpen (usb_ctrl_t * const p_api_ctrl, usb_hhid_report_ring_cfg_t const * const p_cfg)
+{
+    fsp_err_t                err;
+    usb_info_t               info;
+    uint16_t                 pipe_bit_map;
+    usb_hhid_report_ring_t * p_ring;
+
+    usb_instance_ctrl_t * p_ctrl = (usb_instance_ctrl_t *) p_api_ctrl;
+
+#if USB_CFG_PARAM_CHECKING_ENABLE == BSP_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(p_ctrl);
+    FSP_ASSERT(p_cfg);
+    FSP_ASSERT(p_cfg->p_reports);
+
+    /* Argument Checking */
+    FSP_ERROR_RETURN(!((USB_IP0 != p_ctrl->module_number) && (USB_IP1 != p_ctrl->module_number)),
+                     FSP_ERR_USB_PARAMETER);
+
+    FSP_ERROR_RETURN(2U <= p_cfg->num_reports, FSP_ERR_USB_PARAMETER);
+
+    FSP_ERROR_RETURN(0U == ((uint32_t) p_cfg->p_reports & 0x03U), FSP_ERR_USB_PARAMETER);
+
+    FSP_ERROR_RETURN(0 != p_cfg->device_address, FSP_ERR_USB_PARAMETER);
+
+    FSP_ERROR_RETURN(USB_ADDRESS5 >= p_cfg->device_address, FSP_ERR_USB_PARAMETER);
+
+ #if defined(BSP_MCU_GROUP_RA2A1)
+    FSP_ASSERT(USB_IP1 != p_ctrl->module_number);
+ #endif                                /* defined(BSP_MCU_GROUP_RA2A1) */
+#endif /* USB_CFG_PARAM_CHECKING_ENABLE == BSP_CFG_PARAM_CHECKING_ENABLE */
+
+    p_ring = &g_usb_hhid_report_ring[p_ctrl->module_number];
+    FSP_ERROR_RETURN(USB_HHID_REPORT_RING_OPEN != p_ring->open, FSP_ERR_ALREADY_OPEN);
+
+    err = R_USB_InfoGet(p_ctrl, &info, p_cfg->device_address);
+    FSP_ERROR_RETURN(!((FSP_SUCCESS != err) || (USB_STATUS_CONFIGURED != info.device_status)), FSP_ERR_USB_FAILED);
+
+    memset(p_ring, 0, sizeof(usb_hhid_report_ring_t));
+
+    p_ring->pipe = usb_hstd_get_pipe_no(p_ctrl->module_number,
+                                        p_cfg->device_address,
+                                        USB_CLASS_INTERNAL_HHID,
+                                        USB_EP_INT,
+                                        USB_PIPE_DIR_IN);
+
+    err = R_USB_UsedPipesGet(p_ctrl, &pipe_bit_map, p_cfg->device_address);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, FSP_ERR_USB_FAILED);
+
+    FSP_ERROR_RETURN(!(0 == ((1 << p_ring->pipe) & pipe_bit_map)), FSP_ERR_USB_FAILED);
+
+    p_ring->utr.ip  = p_ctrl->module_number;
+    p_ring->utr.ipp = usb_hstd_get_usb_ip_adr(p_ring->utr.ip);
+
+    p_ring->size = usb_cstd_get_maxpacket_size(&p_ring->utr, p_ring->pipe);
+    FSP_ERROR_RETURN(USB_CFG_HHID_REPORT_SIZE_MAX >= p_ring->size, FSP_ERR_USB_PARAMETER);
+
+    p_ring->utr.keyword  = p_ring->pipe;
+    p_ring->utr.complete = (usb_cb_t) usb_hhid_report_ring_complete;
+    p_ring->utr.segment  = USB_TRAN_END;
+#if (USB_CFG_DMA == USB_CFG_ENABLE)
+    p_ring->utr.p_transfer_tx = 0;
+    p_ring->utr.p_transfer_rx = 0;
+#endif                                 /* (USB_CFG_DMA == USB_CFG_ENABLE) */
+
+    p_ring->p_cfg = p_cfg;
+    p_ring->open  = USB_HHID_REPORT_RING_OPEN;
+
+    usb_hhid_report_ring_start(p_ring);
+
+    return FSP_SUCCESS;
+}
+
+/******************************************************************************
+ * End of function R_USB_HHID_ReportRingOpen
+ ******************************************************************************/
+
+/*************************************************************************//**
+ * @brief Copy up to max_reports queued reports, oldest first, and release their ring entries.
+ *
+ * The reports copied in one call are released together. The pipe is never stopped while the application drains the
+ * ring. Returns FSP_SUCCESS with *p_count set to 0 when the ring is empty.
+ *
+ * @retval FSP_SUCCESS           Success.
+ * @retval FSP_ERR_ASSERTION     Parameter Null pointer error.
+ * @retval FSP_ERR_NOT_OPEN      The report ring is not open.
+ ******************************************************************************/
+fsp_err_t R_USB_HHID_ReportRingRead (usb_ctrl_t * const        p_api_ctrl,
+                                     usb_hhid_report_t * const p_dest,
+                                     uint16_t                  max_reports,
+                                     uint16_t * const          p_count)
+{
+    usb_hhid_report_ring_t * p_ring;
+    uint16_t                 tail;
+    uint16_t                 head;
+    uint16_t                 count = 0U;
+
+    usb_instance_ctrl_t * p_ctrl = (usb_instance_ctrl_t *) p_api_ctrl;
+
+#if USB_CFG_PARAM_CHECKING_ENABLE == BSP_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(p_ctrl);
+    FSP_ASSERT(p_dest);
+    FSP_ASSERT(p_count);
+
+    /* Argument Checking */
+    FSP_ERROR_RETURN(!((USB_IP0 != p_ctrl->module_number) && (USB_IP1 != p_ctrl->module_number)),
+                     FSP_ERR_USB_PARAMETER);
+#endif /* USB_CFG_PARAM_CHECKING_ENABLE == BSP_CFG_PARAM_CHECKING_ENABLE */
+
+    p_ring = &g_usb_hhid_report_ring[p_ctrl->module_number];
+    FSP_ERROR_RETURN(USB_HHID_REPORT_RING_OPEN == p_ring->open, FSP_ERR_NOT_OPEN);
+
+    /* Only the completion moves head; reading it once bounds this batch */
+    tail = p_ring->tail;
+    head = p_ring->head;
+    while ((tail != head) && (count < max_reports))
+    {
+        p_dest[count] = p_ring->p_cfg->p_reports[tail];
+        tail          = (uint16_t) ((tail + 1U) % p_ring->p_cfg->num_reports);
+        count++;
+    }
+
+    p_ring->tail = tail;
+    *p_count     = count;
+
+    return FSP_SUCCESS;
+}
+
+/******************************************************************************
+ * End of function R_USB_HHID_ReportRingRead
+ ******************************************************************************/
+
+/*************************************************************************//**
+ * @brief Stop the report ring. The transfer in flight is terminated and queued reports are discarded.
+ *
+ * @retval FSP_SUCCESS           Success.
+ * @retval FSP_ERR_ASSERTION     Parameter Null pointer error.
+ * @retval FSP_ERR_NOT_OPEN      The report ring is not open.
+ ******************************************************************************/
+fsp_err_t R_USB_HHID_ReportRingClose (usb_ctrl_t * const p_api_ctrl)
+{
+    usb_hhid_report_ring_t * p_ring;
+
+    usb_instance_ctrl_t * p_ctrl = (usb_instance_ctrl_t *) p_api_ctrl;
+
+#if USB_CFG_PARAM_CHECKING_ENABLE == BSP_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(p_ctrl);
+
+    /* Argument Checking */
+    FSP_ERROR_RETURN(!((USB_IP0 != p_ctrl->module_number) && (USB_IP1 != p_ctrl->module_number)),
+                     FSP_ERR_USB_PARAMETER);
+#endif /* USB_CFG_PARAM_CHECKING_ENABLE == BSP_CFG_PARAM_CHECKING_ENABLE */
+
+    p_ring = &g_usb_hhid_report_ring[p_ctrl->module_number];
+    FSP_ERROR_RETURN(USB_HHID_REPORT_RING_OPEN == p_ring->open, FSP_ERR_NOT_OPEN);
+
+    /* The completion of the terminated transfer is ignored once the ring is closed */
+    p_ring->open = 0U;
+
+    (void) usb_hstd_transfer_end(&p_ring->utr, p_ring->pipe, (uint16_t) USB_DATA_STOP);
+
+    return FSP_SUCCESS;
+}
+
+/******************************************************************************
+ * End of function R_USB_HHID_ReportRingClose
+ ******************************************************************************/
+
 /*******************************************************************************************************************//**
  * @} (end addtogroup USB_HHID)
  **********************************************************************************************************************/
+
+/******************************************************************************
+ * Function Name   : usb_hhid_report_ring_start
+ * Description     : Arm the interrupt IN pipe into the head entry of the report ring
+ * Arguments       : usb_hhid_report_ring_t *p_ring : Report ring
+ * Return value    : none
+ ******************************************************************************/
+static void usb_hhid_report_ring_start (usb_hhid_report_ring_t * p_ring)
+{
+    p_ring->utr.p_tranadr    = p_ring->p_cfg->p_reports[p_ring->head].data;
+    p_ring->utr.tranlen      = p_ring->size;
+    p_ring->utr.read_req_len = p_ring->size;
+
+    if (USB_OK != usb_hstd_transfer_start(&p_ring->utr))
+    {
+        usb_hhid_report_ring_callback(p_ring, USB_HHID_REPORT_RING_EVENT_STOPPED);
+    }
+}
+
+/******************************************************************************
+ * End of function usb_hhid_report_ring_start
+ ******************************************************************************/
+
+/******************************************************************************
+ * Function Name   : usb_hhid_report_ring_complete
+ * Description     : Interrupt IN completion of the report ring. Publishes the received report and re-arms the pipe.
+ * Arguments       : usb_utr_t    *mess   : Pointer to usb_utr_t structure.
+ *                 : uint16_t     data1   : Not used
+ *                 : uint16_t     data2   : Not used
+ * Return value    : none
+ ******************************************************************************/
+static void usb_hhid_report_ring_complete (usb_utr_t * mess, uint16_t data1, uint16_t data2)
+{
+    usb_hhid_report_ring_t * p_ring = &g_usb_hhid_report_ring[mess->ip];
+    usb_hhid_report_t      * p_report;
+    uint16_t                 next;
+    uint16_t                 tail;
+
+    FSP_PARAMETER_NOT_USED(data1);
+    FSP_PARAMETER_NOT_USED(data2);
+
+    if (USB_HHID_REPORT_RING_OPEN != p_ring->open)
+    {
+        return;
+    }
+
+    if ((USB_DATA_OK != mess->status) && (USB_DATA_SHT != mess->status))
+    {
+        usb_hhid_report_ring_callback(p_ring, USB_HHID_REPORT_RING_EVENT_STOPPED);
+
+        return;
+    }
+
+    p_report = &p_ring->p_cfg->p_reports[p_ring->head];
+    if (NULL != p_ring->p_cfg->p_timestamp_get)
+    {
+        p_report->timestamp = p_ring->p_cfg->p_timestamp_get();
+    }
+    else
+    {
+        p_report->timestamp = (uint32_t) (hw_usb_read_frmnum(mess) & USB_FRNM);
+    }
+
+    p_report->length         = (uint16_t) (mess->read_req_len - mess->tranlen);
+    p_report->device_address = p_ring->p_cfg->device_address;
+
+    next = (uint16_t) ((p_ring->head + 1U) % p_ring->p_cfg->num_reports);
+    tail = p_ring->tail;
+    if (next == tail)
+    {
+        /* Ring full: keep receiving into the same entry */
+        p_ring->dropped++;
+        usb_hhid_report_ring_start(p_ring);
+        usb_hhid_report_ring_callback(p_ring, USB_HHID_REPORT_RING_EVENT_OVERFLOW);
+
+        return;
+    }
+
+    /* Publish the entry only after it is complete */
+    __DMB();
+    p_ring->head = next;
+
+    /* Re-arm before the application is notified */
+    usb_hhid_report_ring_start(p_ring);
+
+    if (p_ring->head == ((uint16_t) ((tail + 1U) % p_ring->p_cfg->num_reports)))
+    {
+        usb_hhid_report_ring_callback(p_ring, USB_HHID_REPORT_RING_EVENT_RECEIVED);
+    }
+}
+
+/******************************************************************************
+ * End of function usb_hhid_report_ring_complete
+ ******************************************************************************/
+
+/******************************************************************************
+ * Function Name   : usb_hhid_report_ring_callback
+ * Description     : Notify the application of a report ring event, if it registered a callback
+ * Arguments       : usb_hhid_report_ring_t       *p_ring : Report ring
+ *                 : usb_hhid_report_ring_event_t event   : Event
+ * Return value    : none
+ ******************************************************************************/
+static void usb_hhid_report_ring_callback (usb_hhid_report_ring_t * p_ring, usb_hhid_report_ring_event_t event)
+{
+    usb_hhid_report_ring_callback_args_t args;
+
+    if (NULL == p_ring->p_cfg->p_callback)
+    {
+        return;
+    }
+
+    args.event     = event;
+    args.dropped   = p_ring->dropped;
+    args.p_context = p_ring->p_cfg->p_context;
+    p_ring->p_cfg->p_callback(&args);
+}
+
+/******************************************************************************
+ * End of function usb_hhid_report_ring_callback
+ ******************************************************************************/
@@ -22,6 +22,7 @@
  * Includes   <System Includes> , "Project Includes"
  ******************************************************************************/
 
+#include <string.h>
 #include <r_usb_basic.h>
 #include <r_usb_basic_api.h>
 #include "r_usb_basic_cfg.h"
@@ -29,6 +30,7 @@
 #include "../../r_usb_basic/src/driver/inc/r_usb_typedef.h"
 #include "../../r_usb_basic/src/driver/inc/r_usb_extern.h"
 #include "r_usb_pcdc_api.h"
+#include "r_usb_pcdc.h"
 #include "../../r_usb_basic/src/hw/inc/r_usb_bitdefine.h"
 
 #ifdef USB_CFG_PCDC_USE
@@ -36,10 +38,47 @@
 /******************************************************************************
  * Macro definitions
  ******************************************************************************/
+ #define USB_PCDC_STREAM_OPEN    (0x50434453UL) /* "PCDS" */
+
+/******************************************************************************
+ * Typedef definitions
+ ******************************************************************************/
+
+/* Transmit queue entry */
+typedef struct st_usb_pcdc_stream_tx
+{
+    uint8_t const * p_buf;
+    uint32_t        size;
+} usb_pcdc_stream_tx_t;
+
+/* Streaming mode state. Each bulk pipe has one transfer in flight; the next one is started from the completion
+ * callback of the previous one so that the pipe stays armed as long as buffers are available. */
+typedef struct st_usb_pcdc_stream
+{
+    uint32_t                      open;
+    usb_pcdc_stream_cfg_t const * p_cfg;
+    usb_utr_t                     rx_utr;
+    usb_utr_t                     tx_utr;
+    usb_pcdc_stream_tx_t          tx_queue[USB_CFG_PCDC_STREAM_TX_QUEUE_DEPTH];
+    uint8_t                       tx_head;    /* Oldest queued buffer, in flight while tx_busy is set */
+    uint8_t                       tx_count;   /* Queued buffers */
+    uint8_t                       tx_busy;    /* Bulk IN transfer in flight */
+    uint8_t                       rx_next;    /* Next receive buffer to arm */
+    uint8_t                       rx_release; /* Next receive buffer expected by R_USB_PCDC_StreamRelease() */
+    uint8_t                       rx_held;    /* Receive buffers filled and not yet released */
+    uint8_t                       rx_busy;    /* Bulk OUT transfer in flight */
+} usb_pcdc_stream_t;
 
 /******************************************************************************
  * Private global variables and functions
  ******************************************************************************/
+static usb_pcdc_stream_t g_usb_pcdc_stream;
+
+static void usb_pcdc_stream_rx_start(void);
+static void usb_pcdc_stream_tx_start(void);
+static void usb_pcdc_stream_read_complete(usb_utr_t * mess, uint16_t data1, uint16_t data2);
+static void usb_pcdc_stream_write_complete(usb_utr_t * mess, uint16_t data1, uint16_t data2);
+static void usb_pcdc_stream_callback(usb_pcdc_stream_event_t event, uint8_t * p_buffer, uint32_t size);
 
 /******************************************************************************
  * Exported global variables
@@ -182,6 +221,399 @@ void usb_pcdc_write_complete (usb_utr_t * mess, uint16_t data1, uint16_t data2)
 /******************************************************************************
  * End of function usb_pcdc_write_complete
  ******************************************************************************/
+
+/*******************************************************************************************************************//**
+ * @addtogroup USB_PCDC USB_PCDC
+ * @{
+ **********************************************************************************************************************/
+
+/**************************************************************************//**
+ * @brief Start streaming mode on the CDC data interface.
+ *
+ * The bulk OUT pipe is kept armed with the receive buffers of p_cfg in turn, and buffers queued with
+ * R_USB_PCDC_StreamWrite() are sent back to back on the bulk IN pipe. The next transfer is started from the
+ * completion of the previous one, so the pipes do not wait for the application. When the CDC bulk pipes are PIPE1
+ * and PIPE2 and USB_CFG_DMA is enabled, the transfers use the D0FIFO/D1FIFO DMA channels of usb_cfg_t.
+ *
+ * R_USB_Read() and R_USB_Write() must not be used on the CDC data interface while streaming mode is open.
+ *
+ * @retval FSP_SUCCESS           Streaming mode started.
+ * @retval FSP_ERR_ASSERTION     Parameter is NULL.
+ * @retval FSP_ERR_USB_PARAMETER Invalid receive buffer configuration.
+ * @retval FSP_ERR_ALREADY_OPEN  Streaming mode is already open.
+ * @retval FSP_ERR_USB_FAILED    The device is not configured.
+ ******************************************************************************/
+fsp_err_t R_USB_PCDC_StreamOpen (usb_ctrl_t * const p_api_ctrl, usb_pcdc_stream_cfg_t const * const p_cfg)
+{
+    usb_instance_ctrl_t * p_ctrl = (usb_instance_ctrl_t *) p_api_ctrl;
+    usb_info_t            info;
+
+ #if USB_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(p_ctrl);
+    FSP_ASSERT(p_cfg);
+    FSP_ASSERT(p_cfg->p_rx_buffer);
+    FSP_ASSERT(p_cfg->p_callback);
+    FSP_ERROR_RETURN(2U <= p_cfg->rx_buffer_num, FSP_ERR_USB_PARAMETER);
+    FSP_ERROR_RETURN(0U != p_cfg->rx_buffer_size, FSP_ERR_USB_PARAMETER);
+    FSP_ERROR_RETURN(0U == (p_cfg->rx_buffer_size & 0x03U), FSP_ERR_USB_PARAMETER);
+    FSP_ERROR_RETURN(0U == ((uint32_t) p_cfg->p_rx_buffer & 0x03U), FSP_ERR_USB_PARAMETER);
+ #endif                                /* USB_CFG_PARAM_CHECKING_ENABLE */
+
+    FSP_ERROR_RETURN(USB_PCDC_STREAM_OPEN != g_usb_pcdc_stream.open, FSP_ERR_ALREADY_OPEN);
+
+    p_ctrl->type = USB_CLASS_PCDC;
+    (void) R_USB_InfoGet(p_ctrl, &info, p_ctrl->device_address);
+    FSP_ERROR_RETURN(USB_STATUS_CONFIGURED == info.device_status, FSP_ERR_USB_FAILED);
+
+    memset(&g_usb_pcdc_stream, 0, sizeof(g_usb_pcdc_stream));
+    g_usb_pcdc_stream.p_cfg = p_cfg;
+
+    g_usb_pcdc_stream.rx_utr.ip       = p_ctrl->module_number;
+    g_usb_pcdc_stream.rx_utr.keyword  = USB_CFG_PCDC_BULK_OUT;
+    g_usb_pcdc_stream.rx_utr.complete = (usb_cb_t) usb_pcdc_stream_read_complete;
+    g_usb_pcdc_stream.tx_utr.ip       = p_ctrl->module_number;
+    g_usb_pcdc_stream.tx_utr.keyword  = USB_CFG_PCDC_BULK_IN;
+    g_usb_pcdc_stream.tx_utr.complete = (usb_cb_t) usb_pcdc_stream_write_complete;
+ #if (USB_CFG_DMA == USB_CFG_ENABLE)
+    g_usb_pcdc_stream.rx_utr.p_transfer_tx = p_ctrl->p_transfer_tx;
+    g_usb_pcdc_stream.rx_utr.p_transfer_rx = p_ctrl->p_transfer_rx;
+    g_usb_pcdc_stream.tx_utr.p_transfer_tx = p_ctrl->p_transfer_tx;
+    g_usb_pcdc_stream.tx_utr.p_transfer_rx = p_ctrl->p_transfer_rx;
+ #endif                                /* (USB_CFG_DMA == USB_CFG_ENABLE) */
+
+    g_usb_pcdc_stream.open = USB_PCDC_STREAM_OPEN;
+
+    usb_pcdc_stream_rx_start();
+
+    return FSP_SUCCESS;
+}
+
+/**************************************************************************//**
+ * @brief Queue a buffer for transmission in streaming mode.
+ *
+ * The buffer must stay valid until USB_PCDC_STREAM_EVENT_TX_COMPLETE is reported for it. Buffers are sent in the
+ * order they are queued. This function may be called from the streaming mode callback.
+ *
+ * @retval FSP_SUCCESS           Buffer queued.
+ * @retval FSP_ERR_ASSERTION     Parameter is NULL.
+ * @retval FSP_ERR_USB_PARAMETER The buffer is not 4-byte aligned.
+ * @retval FSP_ERR_NOT_OPEN      Streaming mode is not open.
+ * @retval FSP_ERR_USB_BUSY      The transmit queue is full.
+ ******************************************************************************/
+fsp_err_t R_USB_PCDC_StreamWrite (usb_ctrl_t * const p_api_ctrl, uint8_t const * const p_buf, uint32_t size)
+{
+    uint8_t tail;
+
+ #if USB_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(p_api_ctrl);
+    FSP_ASSERT(p_buf);
+    FSP_ERROR_RETURN(0U == ((uint32_t) p_buf & 0x03U), FSP_ERR_USB_PARAMETER);
+ #else
+    FSP_PARAMETER_NOT_USED(p_api_ctrl);
+ #endif                                /* USB_CFG_PARAM_CHECKING_ENABLE */
+
+    FSP_ERROR_RETURN(USB_PCDC_STREAM_OPEN == g_usb_pcdc_stream.open, FSP_ERR_NOT_OPEN);
+
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+    if (USB_CFG_PCDC_STREAM_TX_QUEUE_DEPTH <= g_usb_pcdc_stream.tx_count)
+    {
+        FSP_CRITICAL_SECTION_EXIT;
+
+        return FSP_ERR_USB_BUSY;
+    }
+
+    tail = (uint8_t) ((g_usb_pcdc_stream.tx_head + g_usb_pcdc_stream.tx_count) % USB_CFG_PCDC_STREAM_TX_QUEUE_DEPTH);
+    g_usb_pcdc_stream.tx_queue[tail].p_buf = p_buf;
+    g_usb_pcdc_stream.tx_queue[tail].size  = size;
+    g_usb_pcdc_stream.tx_count++;
+    FSP_CRITICAL_SECTION_EXIT;
+
+    usb_pcdc_stream_tx_start();
+
+    return FSP_SUCCESS;
+}
+
+/**************************************************************************//**
+ * @brief Return a receive buffer reported by USB_PCDC_STREAM_EVENT_RX_COMPLETE to the driver.
+ *
+ * Buffers must be released in the order they were reported. If the bulk OUT pipe was idle because every receive
+ * buffer was held by the application, it is armed again. This function may be called from the streaming mode
+ * callback.
+ *
+ * @retval FSP_SUCCESS           Buffer released.
+ * @retval FSP_ERR_ASSERTION     Parameter is NULL.
+ * @retval FSP_ERR_USB_PARAMETER p_buf is not the oldest buffer held by the application.
+ * @retval FSP_ERR_NOT_OPEN      Streaming mode is not open.
+ ******************************************************************************/
+fsp_err_t R_USB_PCDC_StreamRelease (usb_ctrl_t * const p_api_ctrl, uint8_t * const p_buf)
+{
+    usb_pcdc_stream_cfg_t const * p_cfg = g_usb_pcdc_stream.p_cfg;
+
+ #if USB_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(p_api_ctrl);
+    FSP_ASSERT(p_buf);
+ #else
+    FSP_PARAMETER_NOT_USED(p_api_ctrl);
+ #endif                                /* USB_CFG_PARAM_CHECKING_ENABLE */
+
+    FSP_ERROR_RETURN(USB_PCDC_STREAM_OPEN == g_usb_pcdc_stream.open, FSP_ERR_NOT_OPEN);
+
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+    if ((0U == g_usb_pcdc_stream.rx_held) ||
+        (p_buf != &p_cfg->p_rx_buffer[g_usb_pcdc_stream.rx_release * p_cfg->rx_buffer_size]))
+    {
+        FSP_CRITICAL_SECTION_EXIT;
+
+        return FSP_ERR_USB_PARAMETER;
+    }
+
+    g_usb_pcdc_stream.rx_release = (uint8_t) ((g_usb_pcdc_stream.rx_release + 1U) % p_cfg->rx_buffer_num);
+    g_usb_pcdc_stream.rx_held--;
+    FSP_CRITICAL_SECTION_EXIT;
+
+    usb_pcdc_stream_rx_start();
+
+    return FSP_SUCCESS;
+}
+
+/**************************************************************************//**
+ * @brief Stop streaming mode. Transfers in flight are terminated and queued transmit buffers are dropped.
+ *
+ * @retval FSP_SUCCESS           Streaming mode stopped.
+ * @retval FSP_ERR_ASSERTION     Parameter is NULL.
+ * @retval FSP_ERR_NOT_OPEN      Streaming mode is not open.
+ ******************************************************************************/
+fsp_err_t R_USB_PCDC_StreamClose (usb_ctrl_t * const p_api_ctrl)
+{
+    usb_instance_ctrl_t * p_ctrl = (usb_instance_ctrl_t *) p_api_ctrl;
+    usb_utr_t             utr;
+
+ #if USB_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(p_ctrl);
+ #endif                                /* USB_CFG_PARAM_CHECKING_ENABLE */
+
+    FSP_ERROR_RETURN(USB_PCDC_STREAM_OPEN == g_usb_pcdc_stream.open, FSP_ERR_NOT_OPEN);
+
+    /* Completions of the terminated transfers are not reported once the stream is closed */
+    g_usb_pcdc_stream.open = 0U;
+
+    utr.ip = p_ctrl->module_number;
+    if (USB_TRUE == g_usb_pcdc_stream.rx_busy)
+    {
+        (void) usb_pstd_transfer_end(&utr, USB_CFG_PCDC_BULK_OUT);
+    }
+
+    if (USB_TRUE == g_usb_pcdc_stream.tx_busy)
+    {
+        (void) usb_pstd_transfer_end(&utr, USB_CFG_PCDC_BULK_IN);
+    }
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @} (end addtogroup USB_PCDC)
+ **********************************************************************************************************************/
+
+/******************************************************************************
+ * Function Name   : usb_pcdc_stream_rx_start
+ * Description     : Arm the bulk OUT pipe with the next free receive buffer
+ * Arguments       : none
+ * Return          : none
+ ******************************************************************************/
+static void usb_pcdc_stream_rx_start (void)
+{
+    usb_pcdc_stream_cfg_t const * p_cfg = g_usb_pcdc_stream.p_cfg;
+    uint8_t                     * p_buf;
+
+    /* Claim the pipe; the transfer itself is started outside the critical section */
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+    if ((USB_PCDC_STREAM_OPEN != g_usb_pcdc_stream.open) || (USB_TRUE == g_usb_pcdc_stream.rx_busy) ||
+        (p_cfg->rx_buffer_num <= g_usb_pcdc_stream.rx_held))
+    {
+        FSP_CRITICAL_SECTION_EXIT;
+
+        return;
+    }
+
+    g_usb_pcdc_stream.rx_busy = USB_TRUE;
+    FSP_CRITICAL_SECTION_EXIT;
+
+    p_buf = &p_cfg->p_rx_buffer[g_usb_pcdc_stream.rx_next * p_cfg->rx_buffer_size];
+    g_usb_pcdc_stream.rx_utr.p_tranadr    = p_buf;
+    g_usb_pcdc_stream.rx_utr.tranlen      = p_cfg->rx_buffer_size;
+    g_usb_pcdc_stream.rx_utr.read_req_len = p_cfg->rx_buffer_size;
+
+    if (USB_OK != usb_pstd_transfer_start(&g_usb_pcdc_stream.rx_utr))
+    {
+        g_usb_pcdc_stream.rx_busy = USB_FALSE;
+        usb_pcdc_stream_callback(USB_PCDC_STREAM_EVENT_STOPPED, p_buf, 0U);
+    }
+}
+
+/******************************************************************************
+ * End of function usb_pcdc_stream_rx_start
+ ******************************************************************************/
+
+/******************************************************************************
+ * Function Name   : usb_pcdc_stream_tx_start
+ * Description     : Start sending the oldest queued transmit buffer
+ * Arguments       : none
+ * Return          : none
+ ******************************************************************************/
+static void usb_pcdc_stream_tx_start (void)
+{
+    usb_pcdc_stream_tx_t * p_tx;
+
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+    if ((USB_PCDC_STREAM_OPEN != g_usb_pcdc_stream.open) || (USB_TRUE == g_usb_pcdc_stream.tx_busy) ||
+        (0U == g_usb_pcdc_stream.tx_count))
+    {
+        FSP_CRITICAL_SECTION_EXIT;
+
+        return;
+    }
+
+    g_usb_pcdc_stream.tx_busy = USB_TRUE;
+    FSP_CRITICAL_SECTION_EXIT;
+
+    p_tx = &g_usb_pcdc_stream.tx_queue[g_usb_pcdc_stream.tx_head];
+    g_usb_pcdc_stream.tx_utr.p_tranadr = p_tx->p_buf;
+    g_usb_pcdc_stream.tx_utr.tranlen   = p_tx->size;
+
+    if (USB_OK != usb_pstd_transfer_start(&g_usb_pcdc_stream.tx_utr))
+    {
+        g_usb_pcdc_stream.tx_busy = USB_FALSE;
+        usb_pcdc_stream_callback(USB_PCDC_STREAM_EVENT_STOPPED, (uint8_t *) p_tx->p_buf, 0U);
+    }
+}
+
+/******************************************************************************
+ * End of function usb_pcdc_stream_tx_start
+ ******************************************************************************/
+
+/******************************************************************************
+ * Function Name   : usb_pcdc_stream_read_complete
+ * Description     : Bulk OUT completion in streaming mode. Hands the filled buffer to the application and arms the
+ *                 : pipe with the next one.
+ * Arguments       : usb_utr_t    *mess   : Pointer to usb_utr_t structure
+ *               : uint16_t     data1   : Not used
+ *               : uint16_t     data2   : Not used
+ * Return          : none
+ ******************************************************************************/
+static void usb_pcdc_stream_read_complete (usb_utr_t * mess, uint16_t data1, uint16_t data2)
+{
+    usb_pcdc_stream_cfg_t const * p_cfg = g_usb_pcdc_stream.p_cfg;
+    uint8_t                     * p_buf;
+
+    FSP_PARAMETER_NOT_USED(data1);
+    FSP_PARAMETER_NOT_USED(data2);
+
+    if (USB_PCDC_STREAM_OPEN != g_usb_pcdc_stream.open)
+    {
+        return;
+    }
+
+    p_buf = &p_cfg->p_rx_buffer[g_usb_pcdc_stream.rx_next * p_cfg->rx_buffer_size];
+
+    if ((USB_TRUE != g_usb_peri_connected) || ((USB_DATA_OK != mess->status) && (USB_DATA_SHT != mess->status)))
+    {
+        g_usb_pcdc_stream.rx_busy = USB_FALSE;
+        usb_pcdc_stream_callback(USB_PCDC_STREAM_EVENT_STOPPED, p_buf, 0U);
+
+        return;
+    }
+
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+    g_usb_pcdc_stream.rx_next = (uint8_t) ((g_usb_pcdc_stream.rx_next + 1U) % p_cfg->rx_buffer_num);
+    g_usb_pcdc_stream.rx_held++;
+    g_usb_pcdc_stream.rx_busy = USB_FALSE;
+    FSP_CRITICAL_SECTION_EXIT;
+
+    /* Re-arm before the application sees the data */
+    usb_pcdc_stream_rx_start();
+
+    usb_pcdc_stream_callback(USB_PCDC_STREAM_EVENT_RX_COMPLETE, p_buf, mess->read_req_len - mess->tranlen);
+}
+
+/******************************************************************************
+ * End of function usb_pcdc_stream_read_complete
+ ******************************************************************************/
+
+/******************************************************************************
+ * Function Name   : usb_pcdc_stream_write_complete
+ * Description     : Bulk IN completion in streaming mode. Starts the next queued buffer and reports the sent one.
+ * Arguments       : usb_utr_t    *mess   : Pointer to usb_utr_t structure
+ *               : uint16_t     data1   : Not used
+ *               : uint16_t     data2   : Not used
+ * Return          : none
+ ******************************************************************************/
+static void usb_pcdc_stream_write_complete (usb_utr_t * mess, uint16_t data1, uint16_t data2)
+{
+    usb_pcdc_stream_tx_t tx;
+
+    FSP_PARAMETER_NOT_USED(data1);
+    FSP_PARAMETER_NOT_USED(data2);
+
+    if (USB_PCDC_STREAM_OPEN != g_usb_pcdc_stream.open)
+    {
+        return;
+    }
+
+    tx = g_usb_pcdc_stream.tx_queue[g_usb_pcdc_stream.tx_head];
+
+    if ((USB_TRUE != g_usb_peri_connected) || (USB_DATA_NONE != mess->status))
+    {
+        g_usb_pcdc_stream.tx_busy = USB_FALSE;
+        usb_pcdc_stream_callback(USB_PCDC_STREAM_EVENT_STOPPED, (uint8_t *) tx.p_buf, 0U);
+
+        return;
+    }
+
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+    g_usb_pcdc_stream.tx_head = (uint8_t) ((g_usb_pcdc_stream.tx_head + 1U) % USB_CFG_PCDC_STREAM_TX_QUEUE_DEPTH);
+    g_usb_pcdc_stream.tx_count--;
+    g_usb_pcdc_stream.tx_busy = USB_FALSE;
+    FSP_CRITICAL_SECTION_EXIT;
+
+    usb_pcdc_stream_tx_start();
+
+    usb_pcdc_stream_callback(USB_PCDC_STREAM_EVENT_TX_COMPLETE, (uint8_t *) tx.p_buf, tx.size);
+}
+
+/******************************************************************************
+ * End of function usb_pcdc_stream_write_complete
+ ******************************************************************************/
+
+/******************************************************************************
+ * Function Name   : usb_pcdc_stream_callback
+ * Description     : Call the streaming mode callback
+ * Arguments       : usb_pcdc_stream_event_t event   : Event
+ *               : uint8_t                 *p_buffer : Buffer the event refers to
+ *               : uint32_t                size      : Bytes received or sent
+ * Return          : none
+ ******************************************************************************/
+static void usb_pcdc_stream_callback (usb_pcdc_stream_event_t event, uint8_t * p_buffer, uint32_t size)
+{
+    usb_pcdc_stream_callback_args_t args;
+
+    args.event     = event;
+    args.p_buffer  = p_buffer;
+    args.size      = size;
+    args.p_context = g_usb_pcdc_stream.p_cfg->p_context;
+
+    g_usb_pcdc_stream.p_cfg->p_callback(&args);
+}
+
+/******************************************************************************
+ * End of function usb_pcdc_stream_callback
+ ******************************************************************************/
 #endif                                 /* USB_CFG_PCDC_USE */
 
 /******************************************************************************
@@ -39,6 +39,16 @@
  */
 #define USB_ATAPI_SHT_RESPONSE    1
 
+/* Media buffering for READ10 and WRITE10 (USB_CFG_ENABLE/USB_CFG_DISABLE)
+ *
+ * When enabled, two media buffers of USB_CFG_PMSC_TRANS_COUNT blocks are used in turn. The media read of the next
+ * window runs while the current window is sent on the bulk IN pipe, and the media write of a window runs while the
+ * next window is received on the bulk OUT pipe. This doubles the size of the media buffer.
+ */
+#ifndef USB_CFG_PMSC_DOUBLE_BUFFER
+ #define USB_CFG_PMSC_DOUBLE_BUFFER    (USB_CFG_DISABLE)
+#endif
+
 /***********************************************************************************************************************
  * Typedef definitions
  ***********************************************************************************************************************/
@@ -121,14 +121,33 @@ fsp_err_t r_usb_pmsc_media_close(void);
  */
 fsp_err_t r_usb_pmsc_media_read(uint8_t * const p_rbuffer,           /* Pointer to read data buffer */
                                 uint32_t const  start_block,         /* Start block number */
-                                uint8_t const   block_count);        /* Number of blocks to read */
+                                uint32_t const  block_count);        /* Number of blocks to read */
+
+/* The r_usb_pmsc_media_read_start() function starts a read like R_USB_media_read() but returns without waiting for it
+ * to complete. Call r_usb_pmsc_media_wait() before using the buffer.
+ */
+fsp_err_t r_usb_pmsc_media_read_start(uint8_t * const p_rbuffer,     /* Pointer to read data buffer */
+                                      uint32_t const  start_block,   /* Start block number */
+                                      uint32_t const  block_count);  /* Number of blocks to read */
 
 /* The R_USB_media_write() function writes one or more blocks of data to the selected media device from a source buffer
  * provided by the caller.
  */
 fsp_err_t r_usb_pmsc_media_write(uint8_t const * const p_wbuffer,    /* Pointer to write data buffer */
                                  uint32_t const        start_block,  /* Start block number */
-                                 uint8_t const         block_count); /* Number of blocks to write */
+                                 uint32_t const        block_count); /* Number of blocks to write */
+
+/* The r_usb_pmsc_media_write_start() function starts a write like R_USB_media_write() but returns without waiting for
+ * it to complete. Call r_usb_pmsc_media_wait() before reusing the buffer.
+ */
+fsp_err_t r_usb_pmsc_media_write_start(uint8_t const * const p_wbuffer,    /* Pointer to write data buffer */
+                                       uint32_t const        start_block,  /* Start block number */
+                                       uint32_t const        block_count); /* Number of blocks to write */
+
+/* The r_usb_pmsc_media_wait() function waits for the operation started by r_usb_pmsc_media_read_start() or
+ * r_usb_pmsc_media_write_start() to complete.
+ */
+void r_usb_pmsc_media_wait(void);
 
 /* The R_USB_media_ioctl() function provides a generalized means to pass special command
  * and control instructions to the media driver, and for the driver to return information.
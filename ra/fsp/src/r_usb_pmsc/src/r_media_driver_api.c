@@ -161,7 +161,36 @@ fsp_err_t r_usb_pmsc_media_close (void)
  *                    Number of blocks to read.
  * @retval FSP_SUCCESS Success
  ***********************************************************************************************************************/
-fsp_err_t r_usb_pmsc_media_read (uint8_t * const p_rbuffer, uint32_t const start_block, uint8_t const block_count)
+fsp_err_t r_usb_pmsc_media_read (uint8_t * const p_rbuffer, uint32_t const start_block, uint32_t const block_count)
+{
+    fsp_err_t err_code;
+
+    err_code = r_usb_pmsc_media_read_start(p_rbuffer, start_block, block_count);
+    if (err_code == FSP_SUCCESS)
+    {
+        r_usb_pmsc_media_wait();
+    }
+
+    return err_code;
+}                                      /* End of function R_USB_media_read() */
+
+/***********************************************************************************************************************
+ * Function Name: r_usb_pmsc_media_read_start
+ * Description  : This function starts reading data from a specified location of the storage medium and returns
+ *                without waiting for the read to complete. r_usb_pmsc_media_wait() must be called before the buffer
+ *                is used or another media operation is started.
+ * Arguments    : p_rbuffer -
+ *                    Pointer to the read data buffer.
+ *              : start_block -
+ *                    Start block number.
+ *              : block_count -
+ *                    Number of blocks to read.
+ * Return value : result -
+ *                    FSP_SUCCESS:         The read was started.
+ *                    Other:               The read was not started and r_usb_pmsc_media_wait() must not be called.
+ ***********************************************************************************************************************/
+fsp_err_t r_usb_pmsc_media_read_start (uint8_t * const p_rbuffer, uint32_t const start_block,
+                                       uint32_t const block_count)
 {
     fsp_err_t               err_code;
     rm_block_media_status_t status;
@@ -174,18 +203,15 @@ fsp_err_t r_usb_pmsc_media_read (uint8_t * const p_rbuffer, uint32_t const start
                                                         p_rbuffer,
                                                         start_block,
                                                         block_count);
-        if (err_code == FSP_SUCCESS)
-        {
-            r_usb_pmsc_block_media_operation_event();
-        }
     }
     else
     {
         g_status_busy = true;
+        err_code      = FSP_ERR_USB_FAILED;
     }
 
     return err_code;
-}                                      /* End of function R_USB_media_read() */
+}                                      /* End of function r_usb_pmsc_media_read_start() */
 
 /********************************************************************************************************************//**
  * Function Name: r_usb_pmsc_media_write
@@ -199,7 +225,36 @@ fsp_err_t r_usb_pmsc_media_read (uint8_t * const p_rbuffer, uint32_t const start
  * @retval FSP_SUCCESS Success
  ***********************************************************************************************************************/
 fsp_err_t r_usb_pmsc_media_write (uint8_t const * const p_wbuffer, uint32_t const start_block,
-                                  uint8_t const block_count)
+                                  uint32_t const block_count)
+{
+    fsp_err_t err_code;
+
+    err_code = r_usb_pmsc_media_write_start(p_wbuffer, start_block, block_count);
+    if (err_code == FSP_SUCCESS)
+    {
+        r_usb_pmsc_media_wait();
+    }
+
+    return err_code;
+}                                      /* End of function R_USB_media_write() */
+
+/***********************************************************************************************************************
+ * Function Name: r_usb_pmsc_media_write_start
+ * Description  : This function starts writing data to a specified location of the storage medium and returns
+ *                without waiting for the write to complete. r_usb_pmsc_media_wait() must be called before the buffer
+ *                is reused or another media operation is started.
+ * Arguments    : p_wbuffer -
+ *                    Pointer to the write data buffer.
+ *              : start_block -
+ *                    Start block number.
+ *              : block_count -
+ *                    Number of blocks to write.
+ * Return value : result -
+ *                    FSP_SUCCESS:         The write was started.
+ *                    Other:               The write was not started and r_usb_pmsc_media_wait() must not be called.
+ ***********************************************************************************************************************/
+fsp_err_t r_usb_pmsc_media_write_start (uint8_t const * const p_wbuffer, uint32_t const start_block,
+                                        uint32_t const block_count)
 {
     fsp_err_t               err_code;
     rm_block_media_status_t status;
@@ -212,19 +267,28 @@ fsp_err_t r_usb_pmsc_media_write (uint8_t const * const p_wbuffer, uint32_t cons
             gp_block_media_instance->p_api->write(gp_block_media_instance->p_ctrl,
                                                   p_wbuffer,
                                                   start_block,
-                                                  (uint32_t) block_count);
-        if (err_code == FSP_SUCCESS)
-        {
-            r_usb_pmsc_block_media_operation_event();
-        }
+                                                  block_count);
     }
     else
     {
         g_status_busy = true;
+        err_code      = FSP_ERR_USB_FAILED;
     }
 
     return err_code;
-}                                      /* End of function R_USB_media_write() */
+}                                      /* End of function r_usb_pmsc_media_write_start() */
+
+/***********************************************************************************************************************
+ * Function Name: r_usb_pmsc_media_wait
+ * Description  : This function waits for the read or write started by r_usb_pmsc_media_read_start() or
+ *                r_usb_pmsc_media_write_start() to complete.
+ * Arguments    : none
+ * Return value : none
+ ***********************************************************************************************************************/
+void r_usb_pmsc_media_wait (void)
+{
+    r_usb_pmsc_block_media_operation_event();
+}                                      /* End of function r_usb_pmsc_media_wait() */
 
 /***********************************************************************************************************************
  * Function Name: r_usb_pmsc_media_ioctl
@@ -47,16 +47,29 @@
 #define USB_VALUE_32                       (32)
 #define USB_VALUE_ALL_PAGE_LENGTH          (0x24)
 
+#if (USB_CFG_PMSC_DOUBLE_BUFFER == USB_CFG_ENABLE)
+ #define USB_ATAPI_MEDIA_BUFFER_NUM         (2U)
+#else                                  /* USB_CFG_PMSC_DOUBLE_BUFFER == USB_CFG_ENABLE */
+ #define USB_ATAPI_MEDIA_BUFFER_NUM         (1U)
+#endif                                 /* USB_CFG_PMSC_DOUBLE_BUFFER == USB_CFG_ENABLE */
+#define USB_ATAPI_MEDIA_BUFFER_SIZE        (USB_ATAPI_BLOCK_UNIT * USB_CFG_PMSC_TRANS_COUNT)
+
 /***********************************************************************************************************************
  * Private global variables and functions
  ***********************************************************************************************************************/
 static void pmsc_atapi_get_read_data(uint32_t * size, uint8_t ** buff);
 static void pmsc_atapi_get_mode_sense10_data(uint8_t page_code, uint32_t * size, uint8_t ** buff);
+static void pmsc_atapi_media_read_start(void);
+static void pmsc_atapi_media_sync(void);
 
 static uint8_t          g_usb_atapi_is_data_stage = USB_FALSE; /* Data SetUp Flag */
-static uint8_t          g_usb_pmsc_media_buffer[USB_ATAPI_BLOCK_UNIT * USB_CFG_PMSC_TRANS_COUNT];
+static uint8_t          g_usb_pmsc_media_buffer[USB_ATAPI_MEDIA_BUFFER_NUM][USB_ATAPI_MEDIA_BUFFER_SIZE];
 static usb_pmsc_cdb_t * g_usb_atapi_cbwcb;                     /* CBWCB pointer */
 static uint32_t         g_usb_atapi_cur_lba;                   /* the current Logical Block Address */
+static uint32_t         g_usb_atapi_remain_blocks;             /* Blocks of READ10 not yet requested from the media */
+static uint32_t         g_usb_atapi_media_blocks;              /* Blocks of the last media read started */
+static uint8_t          g_usb_atapi_buffer_index;              /* Media buffer used by the current window */
+static uint8_t          g_usb_atapi_media_pending = USB_FALSE; /* A media operation is in progress */
 
 extern usb_utr_t g_usb_pmsc_utr;
 
@@ -527,24 +540,33 @@ static void pmsc_atapi_get_read_data (uint32_t * size, uint8_t ** buff)
                                       ((uint32_t) g_usb_atapi_cbwcb->s_usb_ptn4569.ul_logical_block1 << 16) |
                                       ((uint32_t) g_usb_atapi_cbwcb->s_usb_ptn4569.ul_logical_block2 << 8) |
                                       ((uint32_t) g_usb_atapi_cbwcb->s_usb_ptn4569.ul_logical_block3);
-            }
 
-            /* Calculate the number of logical blocks to read */
-            if (g_usb_pmsc_message.ul_size < (USB_ATAPI_BLOCK_UNIT * USB_CFG_PMSC_TRANS_COUNT))
-            {
-                trans_block = g_usb_pmsc_message.ul_size / USB_ATAPI_BLOCK_UNIT;
+                pmsc_atapi_media_sync();
+                g_usb_atapi_remain_blocks = g_usb_pmsc_message.ul_size / USB_ATAPI_BLOCK_UNIT;
+                g_usb_atapi_buffer_index  = 0U;
             }
-            else
+
+            /* Read this window unless it was prefetched while the previous window was sent */
+            if (USB_FALSE == g_usb_atapi_media_pending)
             {
-                trans_block = USB_CFG_PMSC_TRANS_COUNT;
+                pmsc_atapi_media_read_start();
             }
 
-            r_usb_pmsc_media_read(&g_usb_pmsc_media_buffer[0], g_usb_atapi_cur_lba, (uint8_t) trans_block);
-
-            g_usb_atapi_cur_lba += trans_block;
+            trans_block = g_usb_atapi_media_blocks;
+            pmsc_atapi_media_sync();
 
             *size = (USB_ATAPI_BLOCK_UNIT * trans_block);
-            *buff = &g_usb_pmsc_media_buffer[0];
+            *buff = &g_usb_pmsc_media_buffer[g_usb_atapi_buffer_index][0];
+
+#if (USB_ATAPI_MEDIA_BUFFER_NUM > 1U)
+
+            /* Prefetch the next window into the other buffer while this one is sent to the host */
+            g_usb_atapi_buffer_index = (uint8_t) ((g_usb_atapi_buffer_index + 1U) % USB_ATAPI_MEDIA_BUFFER_NUM);
+            if (0UL != g_usb_atapi_remain_blocks)
+            {
+                pmsc_atapi_media_read_start();
+            }
+#endif                                 /* USB_ATAPI_MEDIA_BUFFER_NUM > 1U */
 
             break;
         }
@@ -763,6 +785,7 @@ void pmsc_atapi_command_processing (uint8_t * cbw, uint16_t usb_result, usb_cb_t
                 else
                 {
                     /* Previous Transfer Fail */
+                    pmsc_atapi_media_sync();
                     status = (uint16_t) USB_PMSC_CMD_FAILED;
                     g_usb_atapi_is_data_stage = USB_FALSE;
                 }
@@ -785,13 +808,15 @@ void pmsc_atapi_command_processing (uint8_t * cbw, uint16_t usb_result, usb_cb_t
                                           ((uint32_t) g_usb_atapi_cbwcb->s_usb_ptn4569.ul_logical_block3);
 
                     /* Retrieve the location and size of the write buffer. */
-                    this_transfer_size = g_usb_pmsc_message.ul_size;
-                    p_atapi_rw_buff    = &g_usb_pmsc_media_buffer[0];
+                    pmsc_atapi_media_sync();
+                    g_usb_atapi_buffer_index = 0U;
+                    this_transfer_size       = g_usb_pmsc_message.ul_size;
+                    p_atapi_rw_buff          = &g_usb_pmsc_media_buffer[0][0];
 
-                    if (this_transfer_size > (USB_ATAPI_BLOCK_UNIT * USB_CFG_PMSC_TRANS_COUNT))
+                    if (this_transfer_size > USB_ATAPI_MEDIA_BUFFER_SIZE)
                     {
                         /* Divide Size for WRITE10 & WRITE_AND_VERIFY*/
-                        this_transfer_size = (USB_ATAPI_BLOCK_UNIT * USB_CFG_PMSC_TRANS_COUNT);
+                        this_transfer_size = USB_ATAPI_MEDIA_BUFFER_SIZE;
                     }
 
                     real_data_count           = 0UL;
@@ -807,18 +832,33 @@ void pmsc_atapi_command_processing (uint8_t * cbw, uint16_t usb_result, usb_cb_t
             {
                 if (USB_DATA_OK == usb_result) /* Previous Transfer OK */
                 {
-                    p_atapi_rw_buff = &g_usb_pmsc_media_buffer[0];
-
                     trans_block = this_transfer_size / USB_ATAPI_BLOCK_UNIT;
                     if (0 != (this_transfer_size % USB_ATAPI_BLOCK_UNIT))
                     {
                         trans_block++;
                     }
 
-                    /* Write will be limited to max one block at a time */
-                    r_usb_pmsc_media_write(&g_usb_pmsc_media_buffer[0], g_usb_atapi_cur_lba, (uint8_t) trans_block);
+                    /* Only one media operation at a time: finish writing the previous window first */
+                    pmsc_atapi_media_sync();
+                    if (FSP_SUCCESS ==
+                        r_usb_pmsc_media_write_start(&g_usb_pmsc_media_buffer[g_usb_atapi_buffer_index][0],
+                                                     g_usb_atapi_cur_lba,
+                                                     trans_block))
+                    {
+                        g_usb_atapi_media_pending = USB_TRUE;
+                    }
+
                     g_usb_atapi_cur_lba += trans_block;
 
+#if (USB_ATAPI_MEDIA_BUFFER_NUM > 1U)
+
+                    /* Receive the next window into the other buffer while this one is written */
+                    g_usb_atapi_buffer_index = (uint8_t) ((g_usb_atapi_buffer_index + 1U) % USB_ATAPI_MEDIA_BUFFER_NUM);
+#else                                  /* USB_ATAPI_MEDIA_BUFFER_NUM > 1U */
+                    pmsc_atapi_media_sync();
+#endif                                 /* USB_ATAPI_MEDIA_BUFFER_NUM > 1U */
+                    p_atapi_rw_buff = &g_usb_pmsc_media_buffer[g_usb_atapi_buffer_index][0];
+
                     /* Update the count of data transferred so far. */
                     real_data_count = real_data_count + this_transfer_size;
 
@@ -835,7 +875,9 @@ void pmsc_atapi_command_processing (uint8_t * cbw, uint16_t usb_result, usb_cb_t
                     }
                     else
                     {
-                        /* All data in Device recieved */
+                        /* All data in Device recieved; report the status once it is on the media */
+                        pmsc_atapi_media_sync();
+
                         if (g_usb_pmsc_dtl == g_usb_pmsc_message.ul_size)
                         {
                             /* case 12 */
@@ -854,6 +896,7 @@ void pmsc_atapi_command_processing (uint8_t * cbw, uint16_t usb_result, usb_cb_t
                 else
                 {
                     /* Previous Transfer Fail */
+                    pmsc_atapi_media_sync();
                     status = (uint16_t) USB_PMSC_CMD_FAILED;
                     g_usb_atapi_is_data_stage = USB_FALSE;
                 }
@@ -993,11 +1036,58 @@ static void pmsc_atapi_get_mode_sense10_data (uint8_t page_code, uint32_t * size
  ***********************************************************************************************************************/
 void pmsc_atapi_init (void)
 {
-    memset((void *) &g_usb_pmsc_media_buffer, 0, (USB_ATAPI_BLOCK_UNIT * USB_CFG_PMSC_TRANS_COUNT));
-    g_usb_atapi_cbwcb   = USB_NULL;
-    g_usb_atapi_cur_lba = 0;
+    memset((void *) &g_usb_pmsc_media_buffer, 0, sizeof(g_usb_pmsc_media_buffer));
+    g_usb_atapi_cbwcb         = USB_NULL;
+    g_usb_atapi_cur_lba       = 0;
+    g_usb_atapi_remain_blocks = 0;
+    g_usb_atapi_media_blocks  = 0;
+    g_usb_atapi_buffer_index  = 0U;
+    g_usb_atapi_media_pending = USB_FALSE;
 }                                      /* End of function pmsc_atapi_init() */
 
+/***********************************************************************************************************************
+ * Function Name: pmsc_atapi_media_read_start
+ * Description  : Start reading the next window of READ10 into the current media buffer
+ * Arguments    : none
+ * Return value : none
+ ***********************************************************************************************************************/
+static void pmsc_atapi_media_read_start (void)
+{
+    uint32_t trans_block = g_usb_atapi_remain_blocks;
+
+    if (trans_block > USB_CFG_PMSC_TRANS_COUNT)
+    {
+        trans_block = USB_CFG_PMSC_TRANS_COUNT;
+    }
+
+    if (FSP_SUCCESS ==
+        r_usb_pmsc_media_read_start(&g_usb_pmsc_media_buffer[g_usb_atapi_buffer_index][0],
+                                    g_usb_atapi_cur_lba,
+                                    trans_block))
+    {
+        g_usb_atapi_media_pending = USB_TRUE;
+    }
+
+    g_usb_atapi_media_blocks   = trans_block;
+    g_usb_atapi_cur_lba       += trans_block;
+    g_usb_atapi_remain_blocks -= trans_block;
+}                                      /* End of function pmsc_atapi_media_read_start() */
+
+/***********************************************************************************************************************
+ * Function Name: pmsc_atapi_media_sync
+ * Description  : Wait for the media operation in progress, if any
+ * Arguments    : none
+ * Return value : none
+ ***********************************************************************************************************************/
+static void pmsc_atapi_media_sync (void)
+{
+    if (USB_TRUE == g_usb_atapi_media_pending)
+    {
+        r_usb_pmsc_media_wait();
+        g_usb_atapi_media_pending = USB_FALSE;
+    }
+}                                      /* End of function pmsc_atapi_media_sync() */
+
 /***********************************************************************************************************************
  * End Of File
  ***********************************************************************************************************************/
@@ -0,0 +1,653 @@
+/***********************************************************************************************************************
+ * Copyright [2020] Renesas Electronics Corporation and/or its affiliates.  All Rights Reserved.
+ *
+ * This software and documentation are supplied by Renesas Electronics America Inc. and may only be used with products
+ * of Renesas Electronics Corp. and its affiliates ("Renesas").  No other uses are authorized.  Renesas products are
+ * sold pursuant to Renesas terms and conditions of sale.  Purchasers are solely responsible for the selection and use
+ * of Renesas products and Renesas assumes no liability.  No license, express or implied, to any intellectual property
+ * right is granted by Renesas. This software is protected under all applicable laws, including copyright laws. Renesas
+ * reserves the right to change or discontinue this software and/or this documentation. THE SOFTWARE AND DOCUMENTATION
+ * IS DELIVERED TO YOU "AS IS," AND RENESAS MAKES NO REPRESENTATIONS OR WARRANTIES, AND TO THE FULLEST EXTENT
+ * PERMISSIBLE UNDER APPLICABLE LAW, DISCLAIMS ALL WARRANTIES, WHETHER EXPLICITLY OR IMPLICITLY, INCLUDING WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, AND NONINFRINGEMENT, WITH RESPECT TO THE SOFTWARE OR
+ * DOCUMENTATION.  RENESAS SHALL HAVE NO LIABILITY ARISING OUT OF ANY SECURITY VULNERABILITY OR BREACH.  TO THE MAXIMUM
+ * EXTENT PERMITTED BY LAW, IN NO EVENT WILL RENESAS BE LIABLE TO YOU IN CONNECTION WITH THE SOFTWARE OR DOCUMENTATION
+ * (OR ANY PERSON OR ENTITY CLAIMING RIGHTS DERIVED FROM YOU) FOR ANY LOSS, DAMAGES, OR CLAIMS WHATSOEVER, INCLUDING,
+ * WITHOUT LIMITATION, ANY DIRECT, CONSEQUENTIAL, SPECIAL, INDIRECT, PUNITIVE, OR INCIDENTAL DAMAGES; ANY LOST PROFITS,
+ * OTHER ECONOMIC DAMAGE, PROPERTY DAMAGE, OR PERSONAL INJURY; AND EVEN IF RENESAS HAS BEEN ADVISED OF THE POSSIBILITY
+ * OF SUCH LOSS, DAMAGES, CLAIMS OR COSTS.
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Includes
+ **********************************************************************************************************************/
+#include "rm_aio_block_media.h"
+
+/***********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+
+/* "AIOB" in ASCII. */
+#define RM_AIO_BLOCK_MEDIA_OPEN    (0x41494F42U)
+
+/***********************************************************************************************************************
+ * Private function prototypes
+ **********************************************************************************************************************/
+static void               rm_aio_block_media_start(rm_aio_block_media_instance_ctrl_t * const p_ctrl);
+static fsp_err_t          rm_aio_block_media_issue(rm_aio_block_media_instance_ctrl_t * const p_ctrl,
+                                                   rm_aio_request_t * const                   p_request);
+static rm_aio_request_t * rm_aio_block_media_finish(rm_aio_block_media_instance_ctrl_t * const p_ctrl,
+                                                    fsp_err_t                                  result);
+static void               rm_aio_block_media_post(rm_aio_block_media_instance_ctrl_t * const p_ctrl,
+                                                  rm_aio_request_t * const                   p_chain);
+static void               rm_aio_block_media_media_done(rm_aio_block_media_instance_ctrl_t * const p_ctrl,
+                                                        fsp_err_t                                  result);
+static void               rm_aio_block_media_status_poll(rm_aio_block_media_instance_ctrl_t * const p_ctrl);
+static void               rm_aio_block_media_callback(rm_block_media_callback_args_t * p_args);
+static void               rm_aio_block_media_timer_callback(timer_callback_args_t * p_args);
+
+/***********************************************************************************************************************
+ * Private global variables
+ **********************************************************************************************************************/
+
+/** Version data structure. */
+static const fsp_version_t g_rm_aio_block_media_version =
+{
+    .api_version_minor  = RM_AIO_API_VERSION_MINOR,
+    .api_version_major  = RM_AIO_API_VERSION_MAJOR,
+    .code_version_major = RM_AIO_BLOCK_MEDIA_CODE_VERSION_MAJOR,
+    .code_version_minor = RM_AIO_BLOCK_MEDIA_CODE_VERSION_MINOR
+};
+
+/***********************************************************************************************************************
+ * Global variables
+ **********************************************************************************************************************/
+
+/** Asynchronous I/O on block media implementation of the asynchronous I/O interface. */
+const rm_aio_api_t g_rm_aio_on_block_media =
+{
+    .open           = RM_AIO_BLOCK_MEDIA_Open,
+    .submit         = RM_AIO_BLOCK_MEDIA_Submit,
+    .completionGet  = RM_AIO_BLOCK_MEDIA_CompletionGet,
+    .completionWait = RM_AIO_BLOCK_MEDIA_CompletionWait,
+    .statusGet      = RM_AIO_BLOCK_MEDIA_StatusGet,
+    .close          = RM_AIO_BLOCK_MEDIA_Close,
+    .versionGet     = RM_AIO_BLOCK_MEDIA_VersionGet,
+};
+
+/*******************************************************************************************************************//**
+ * @addtogroup RM_AIO_BLOCK_MEDIA
+ * @{
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Functions
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * Takes over the callbacks of the block media and timer instances and starts accepting requests. Implements
+ * @ref rm_aio_api_t::open.
+ *
+ * @retval     FSP_SUCCESS                    Module is available and is now open.
+ * @retval     FSP_ERR_ASSERTION              An input parameter is invalid.
+ * @retval     FSP_ERR_ALREADY_OPEN           Module has already been opened with this instance of the control
+ *                                            structure.
+ * @return See @ref RENESAS_ERROR_CODES or functions called by this function for other possible return codes.
+ *         This function calls:
+ *             * @ref rm_block_media_api_t::callbackSet
+ *             * @ref timer_api_t::callbackSet
+ **********************************************************************************************************************/
+fsp_err_t RM_AIO_BLOCK_MEDIA_Open (rm_aio_ctrl_t * const p_api_ctrl, rm_aio_cfg_t const * const p_cfg)
+{
+    rm_aio_block_media_instance_ctrl_t * p_ctrl = (rm_aio_block_media_instance_ctrl_t *) p_api_ctrl;
+
+#if RM_AIO_BLOCK_MEDIA_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ASSERT(NULL != p_cfg);
+    FSP_ASSERT(NULL != p_cfg->p_extend);
+    FSP_ASSERT(NULL != ((rm_aio_block_media_extended_cfg_t const *) p_cfg->p_extend)->p_block_media);
+    FSP_ERROR_RETURN(RM_AIO_BLOCK_MEDIA_OPEN != p_ctrl->open, FSP_ERR_ALREADY_OPEN);
+#endif
+
+    rm_aio_block_media_extended_cfg_t const * p_extend = (rm_aio_block_media_extended_cfg_t const *) p_cfg->p_extend;
+
+    p_ctrl->p_cfg          = p_cfg;
+    p_ctrl->p_extend       = p_extend;
+    p_ctrl->p_pending_head = NULL;
+    p_ctrl->p_pending_tail = NULL;
+    p_ctrl->p_chain        = NULL;
+    p_ctrl->p_active       = NULL;
+    p_ctrl->issued         = false;
+    p_ctrl->poll_status    = false;
+    p_ctrl->stale          = false;
+    p_ctrl->starting       = false;
+    p_ctrl->tick           = 0U;
+    p_ctrl->start_tick     = 0U;
+    p_ctrl->submitted      = 0U;
+    R_BSP_QueueInit(&p_ctrl->completions, p_ctrl->p_completion_buffer, p_ctrl->completion_sequence,
+                    sizeof(rm_aio_request_t *), RM_AIO_BLOCK_MEDIA_CFG_QUEUE_LENGTH);
+
+    rm_block_media_instance_t const * p_block_media = p_extend->p_block_media;
+    fsp_err_t err = p_block_media->p_api->callbackSet(p_block_media->p_ctrl, rm_aio_block_media_callback, p_ctrl,
+                                                      &p_ctrl->block_media_args);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+    if (NULL != p_extend->p_timer)
+    {
+        err = p_extend->p_timer->p_api->callbackSet(p_extend->p_timer->p_ctrl, rm_aio_block_media_timer_callback,
+                                                    p_ctrl, &p_ctrl->timer_args);
+        FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+    }
+
+    p_ctrl->open = RM_AIO_BLOCK_MEDIA_OPEN;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Queues a request or a chain of requests behind the ones already submitted and starts it if the media is idle.
+ * Implements @ref rm_aio_api_t::submit.
+ *
+ * With a block media implementation that blocks until its operations complete, the requests run before this function
+ * returns.
+ *
+ * @retval     FSP_SUCCESS                    The chain is queued.
+ * @retval     FSP_ERR_ASSERTION              An input parameter is invalid.
+ * @retval     FSP_ERR_NOT_OPEN               The instance control structure is not opened.
+ * @retval     FSP_ERR_QUEUE_FULL             RM_AIO_BLOCK_MEDIA_CFG_QUEUE_LENGTH chains are already outstanding.
+ *                                            Collect completions first.
+ **********************************************************************************************************************/
+fsp_err_t RM_AIO_BLOCK_MEDIA_Submit (rm_aio_ctrl_t * const p_api_ctrl, rm_aio_request_t * const p_request)
+{
+    rm_aio_block_media_instance_ctrl_t * p_ctrl = (rm_aio_block_media_instance_ctrl_t *) p_api_ctrl;
+
+#if RM_AIO_BLOCK_MEDIA_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ASSERT(NULL != p_request);
+    FSP_ERROR_RETURN(RM_AIO_BLOCK_MEDIA_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+
+    for (rm_aio_request_t * p_link = p_request; NULL != p_link; p_link = p_link->p_next)
+    {
+        FSP_ASSERT(p_link->op <= RM_AIO_OP_ERASE);
+        FSP_ASSERT((RM_AIO_OP_ERASE == p_link->op) || (NULL != p_link->p_buffer));
+    }
+#endif
+
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+    bool full = (p_ctrl->submitted >= RM_AIO_BLOCK_MEDIA_CFG_QUEUE_LENGTH);
+    if (!full)
+    {
+        /* Mark the chain only once it is accepted, so a rejected chain keeps its previous results. */
+        for (rm_aio_request_t * p_link = p_request; NULL != p_link; p_link = p_link->p_next)
+        {
+            p_link->result = FSP_ERR_IN_USE;
+        }
+
+        p_request->p_queue_next = NULL;
+        p_ctrl->submitted++;
+        if (NULL == p_ctrl->p_pending_head)
+        {
+            p_ctrl->p_pending_head = p_request;
+        }
+        else
+        {
+            p_ctrl->p_pending_tail->p_queue_next = p_request;
+        }
+
+        p_ctrl->p_pending_tail = p_request;
+    }
+
+    FSP_CRITICAL_SECTION_EXIT;
+
+    FSP_ERROR_RETURN(!full, FSP_ERR_QUEUE_FULL);
+
+    rm_aio_block_media_start(p_ctrl);
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Returns the oldest completed chain without waiting. Implements @ref rm_aio_api_t::completionGet.
+ *
+ * The result of each request of the chain is in rm_aio_request_t::result: FSP_SUCCESS, the error returned or reported
+ * by the block media instance, FSP_ERR_TIMEOUT if the request timed out, or FSP_ERR_ABORTED if an earlier request of
+ * the chain failed.
+ *
+ * @retval     FSP_SUCCESS                    A completed chain is stored in pp_request.
+ * @retval     FSP_ERR_ASSERTION              An input parameter is invalid.
+ * @retval     FSP_ERR_NOT_OPEN               The instance control structure is not opened.
+ * @retval     FSP_ERR_QUEUE_EMPTY            No chain has completed.
+ **********************************************************************************************************************/
+fsp_err_t RM_AIO_BLOCK_MEDIA_CompletionGet (rm_aio_ctrl_t * const p_api_ctrl, rm_aio_request_t ** const pp_request)
+{
+    rm_aio_block_media_instance_ctrl_t * p_ctrl = (rm_aio_block_media_instance_ctrl_t *) p_api_ctrl;
+
+#if RM_AIO_BLOCK_MEDIA_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ASSERT(NULL != pp_request);
+    FSP_ERROR_RETURN(RM_AIO_BLOCK_MEDIA_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+
+    /* Without a timer, erase completion is polled here. */
+    if (NULL == p_ctrl->p_extend->p_timer)
+    {
+        rm_aio_block_media_status_poll(p_ctrl);
+    }
+
+    FSP_ERROR_RETURN(R_BSP_QueueMpscPop(&p_ctrl->completions, pp_request), FSP_ERR_QUEUE_EMPTY);
+
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+    p_ctrl->submitted--;
+    FSP_CRITICAL_SECTION_EXIT;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Waits for a completed chain, checking the completion queue every millisecond. Implements
+ * @ref rm_aio_api_t::completionWait.
+ *
+ * With an RTOS, prefer waiting on a semaphore given by rm_aio_cfg_t::p_callback and calling
+ * RM_AIO_BLOCK_MEDIA_CompletionGet.
+ *
+ * @retval     FSP_SUCCESS                    A completed chain is stored in pp_request.
+ * @retval     FSP_ERR_ASSERTION              An input parameter is invalid.
+ * @retval     FSP_ERR_NOT_OPEN               The instance control structure is not opened.
+ * @retval     FSP_ERR_TIMEOUT                No chain completed within timeout_ms.
+ **********************************************************************************************************************/
+fsp_err_t RM_AIO_BLOCK_MEDIA_CompletionWait (rm_aio_ctrl_t * const     p_api_ctrl,
+                                             rm_aio_request_t ** const pp_request,
+                                             uint32_t const            timeout_ms)
+{
+    for (uint32_t elapsed_ms = 0U; ; elapsed_ms++)
+    {
+        fsp_err_t err = RM_AIO_BLOCK_MEDIA_CompletionGet(p_api_ctrl, pp_request);
+        if (FSP_ERR_QUEUE_EMPTY != err)
+        {
+            return err;
+        }
+
+        FSP_ERROR_RETURN(elapsed_ms < timeout_ms, FSP_ERR_TIMEOUT);
+
+        R_BSP_SoftwareDelay(1U, BSP_DELAY_UNITS_MILLISECONDS);
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Gets the number of outstanding chains. Implements @ref rm_aio_api_t::statusGet.
+ *
+ * @retval     FSP_SUCCESS                    Status stored.
+ * @retval     FSP_ERR_ASSERTION              An input parameter is invalid.
+ * @retval     FSP_ERR_NOT_OPEN               The instance control structure is not opened.
+ **********************************************************************************************************************/
+fsp_err_t RM_AIO_BLOCK_MEDIA_StatusGet (rm_aio_ctrl_t * const p_api_ctrl, rm_aio_status_t * const p_status)
+{
+    rm_aio_block_media_instance_ctrl_t * p_ctrl = (rm_aio_block_media_instance_ctrl_t *) p_api_ctrl;
+
+#if RM_AIO_BLOCK_MEDIA_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ASSERT(NULL != p_status);
+    FSP_ERROR_RETURN(RM_AIO_BLOCK_MEDIA_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+
+    p_status->submitted = p_ctrl->submitted;
+    p_status->active    = (NULL != p_ctrl->p_active) || p_ctrl->stale;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Gives the block media and timer instances back their configured callbacks. Completed chains not collected yet are
+ * discarded. Implements @ref rm_aio_api_t::close.
+ *
+ * @retval     FSP_SUCCESS                    Module is closed.
+ * @retval     FSP_ERR_ASSERTION              p_ctrl is NULL.
+ * @retval     FSP_ERR_NOT_OPEN               The instance control structure is not opened.
+ * @retval     FSP_ERR_IN_USE                 Requests are still waiting or running.
+ **********************************************************************************************************************/
+fsp_err_t RM_AIO_BLOCK_MEDIA_Close (rm_aio_ctrl_t * const p_api_ctrl)
+{
+    rm_aio_block_media_instance_ctrl_t * p_ctrl = (rm_aio_block_media_instance_ctrl_t *) p_api_ctrl;
+
+#if RM_AIO_BLOCK_MEDIA_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ERROR_RETURN(RM_AIO_BLOCK_MEDIA_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+
+    FSP_ERROR_RETURN((NULL == p_ctrl->p_active) && (NULL == p_ctrl->p_pending_head) && !p_ctrl->stale,
+                     FSP_ERR_IN_USE);
+
+    p_ctrl->open = 0U;
+
+    rm_block_media_instance_t const * p_block_media = p_ctrl->p_extend->p_block_media;
+    (void) p_block_media->p_api->callbackSet(p_block_media->p_ctrl, p_block_media->p_cfg->p_callback,
+                                             p_block_media->p_cfg->p_context, NULL);
+
+    timer_instance_t const * p_timer = p_ctrl->p_extend->p_timer;
+    if (NULL != p_timer)
+    {
+        (void) p_timer->p_api->callbackSet(p_timer->p_ctrl, p_timer->p_cfg->p_callback, p_timer->p_cfg->p_context,
+                                           NULL);
+    }
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Gets the version of this module. Implements @ref rm_aio_api_t::versionGet.
+ *
+ * @retval     FSP_SUCCESS                    Version stored.
+ * @retval     FSP_ERR_ASSERTION              p_version is NULL.
+ **********************************************************************************************************************/
+fsp_err_t RM_AIO_BLOCK_MEDIA_VersionGet (fsp_version_t * const p_version)
+{
+#if RM_AIO_BLOCK_MEDIA_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_version);
+#endif
+
+    p_version->version_id = g_rm_aio_block_media_version.version_id;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @} (end addtogroup RM_AIO_BLOCK_MEDIA)
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Private Functions
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * Starts the next request on the media until one is running or none is left. Called from the submitting task and
+ * from the completion callbacks. Block media implementations that complete synchronously call back from inside
+ * rm_aio_block_media_issue(); the nested call returns immediately and this loop starts the next request, so chains
+ * do not recurse.
+ *
+ * @param[in]  p_ctrl                  Instance control block.
+ **********************************************************************************************************************/
+static void rm_aio_block_media_start (rm_aio_block_media_instance_ctrl_t * const p_ctrl)
+{
+    FSP_CRITICAL_SECTION_DEFINE;
+    bool more;
+
+    do
+    {
+        if (p_ctrl->starting)
+        {
+            return;
+        }
+
+        p_ctrl->starting = true;
+
+        for ( ; ; )
+        {
+            rm_aio_request_t * p_request = NULL;
+
+            FSP_CRITICAL_SECTION_ENTER;
+            if (!p_ctrl->stale)
+            {
+                if ((NULL == p_ctrl->p_active) && (NULL != p_ctrl->p_pending_head))
+                {
+                    p_ctrl->p_chain        = p_ctrl->p_pending_head;
+                    p_ctrl->p_active       = p_ctrl->p_pending_head;
+                    p_ctrl->issued         = false;
+                    p_ctrl->p_pending_head = p_ctrl->p_pending_head->p_queue_next;
+                }
+
+                if ((NULL != p_ctrl->p_active) && !p_ctrl->issued)
+                {
+                    p_ctrl->issued      = true;
+                    p_ctrl->poll_status = false;
+                    p_ctrl->start_tick  = p_ctrl->tick;
+                    p_request           = p_ctrl->p_active;
+                }
+            }
+
+            FSP_CRITICAL_SECTION_EXIT;
+
+            if (NULL == p_request)
+            {
+                break;
+            }
+
+            fsp_err_t err = rm_aio_block_media_issue(p_ctrl, p_request);
+            if (FSP_SUCCESS != err)
+            {
+                rm_aio_request_t * p_chain = NULL;
+
+                FSP_CRITICAL_SECTION_ENTER;
+                if (p_request == p_ctrl->p_active)
+                {
+                    p_chain = rm_aio_block_media_finish(p_ctrl, err);
+                }
+
+                FSP_CRITICAL_SECTION_EXIT;
+
+                rm_aio_block_media_post(p_ctrl, p_chain);
+            }
+        }
+
+        p_ctrl->starting = false;
+
+        /* A completion that arrived after the loop ended but before starting was cleared did not start anything. */
+        FSP_CRITICAL_SECTION_ENTER;
+        more = !p_ctrl->stale &&
+               (((NULL == p_ctrl->p_active) && (NULL != p_ctrl->p_pending_head)) ||
+                ((NULL != p_ctrl->p_active) && !p_ctrl->issued));
+        FSP_CRITICAL_SECTION_EXIT;
+    } while (more);
+}
+
+/*******************************************************************************************************************//**
+ * Starts a request on the block media instance.
+ *
+ * @param[in]  p_ctrl                  Instance control block.
+ * @param[in]  p_request               Request to start.
+ *
+ * @return See @ref RENESAS_ERROR_CODES or functions called by this function for other possible return codes.
+ *         This function calls:
+ *             * @ref rm_block_media_api_t::read
+ *             * @ref rm_block_media_api_t::write
+ *             * @ref rm_block_media_api_t::erase
+ **********************************************************************************************************************/
+static fsp_err_t rm_aio_block_media_issue (rm_aio_block_media_instance_ctrl_t * const p_ctrl,
+                                           rm_aio_request_t * const                   p_request)
+{
+    rm_block_media_instance_t const * p_block_media = p_ctrl->p_extend->p_block_media;
+
+    if (RM_AIO_OP_READ == p_request->op)
+    {
+        return p_block_media->p_api->read(p_block_media->p_ctrl, p_request->p_buffer, p_request->address,
+                                          p_request->length);
+    }
+
+    if (RM_AIO_OP_WRITE == p_request->op)
+    {
+        return p_block_media->p_api->write(p_block_media->p_ctrl, p_request->p_buffer, p_request->address,
+                                           p_request->length);
+    }
+
+    return p_block_media->p_api->erase(p_block_media->p_ctrl, p_request->address, p_request->length);
+}
+
+/*******************************************************************************************************************//**
+ * Records the result of the active request and moves to the next request of the chain, if it succeeded. Must be
+ * called in a critical section.
+ *
+ * @param[in]  p_ctrl                  Instance control block.
+ * @param[in]  result                  Result of the active request.
+ *
+ * @return     The chain to post to the completion queue if it is complete, otherwise NULL.
+ **********************************************************************************************************************/
+static rm_aio_request_t * rm_aio_block_media_finish (rm_aio_block_media_instance_ctrl_t * const p_ctrl,
+                                                     fsp_err_t                                  result)
+{
+    rm_aio_request_t * p_request = p_ctrl->p_active;
+    rm_aio_request_t * p_next    = (FSP_SUCCESS == result) ? p_request->p_next : NULL;
+
+    p_request->result   = result;
+    p_ctrl->p_active    = p_next;
+    p_ctrl->issued      = false;
+    p_ctrl->poll_status = false;
+
+    if (NULL != p_next)
+    {
+        return NULL;
+    }
+
+    for (rm_aio_request_t * p_link = p_request->p_next; NULL != p_link; p_link = p_link->p_next)
+    {
+        p_link->result = FSP_ERR_ABORTED;
+    }
+
+    rm_aio_request_t * p_chain = p_ctrl->p_chain;
+    p_ctrl->p_chain = NULL;
+
+    return p_chain;
+}
+
+/*******************************************************************************************************************//**
+ * Posts a completed chain to the completion queue and calls the user callback. There is always room: Submit limits
+ * the outstanding chains to the queue length.
+ *
+ * @param[in]  p_ctrl                  Instance control block.
+ * @param[in]  p_chain                 Completed chain, or NULL to do nothing.
+ **********************************************************************************************************************/
+static void rm_aio_block_media_post (rm_aio_block_media_instance_ctrl_t * const p_ctrl,
+                                     rm_aio_request_t * const                   p_chain)
+{
+    if (NULL == p_chain)
+    {
+        return;
+    }
+
+    (void) R_BSP_QueueMpscPush(&p_ctrl->completions, &p_chain);
+
+    if (NULL != p_ctrl->p_cfg->p_callback)
+    {
+        rm_aio_callback_args_t args;
+        args.p_request = p_chain;
+        args.p_context = p_ctrl->p_cfg->p_context;
+        p_ctrl->p_cfg->p_callback(&args);
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Handles the end of an operation on the media: completes the active request, or only frees the media if the
+ * operation had already timed out, then starts the next request.
+ *
+ * @param[in]  p_ctrl                  Instance control block.
+ * @param[in]  result                  Result of the operation.
+ **********************************************************************************************************************/
+static void rm_aio_block_media_media_done (rm_aio_block_media_instance_ctrl_t * const p_ctrl, fsp_err_t result)
+{
+    rm_aio_request_t * p_chain = NULL;
+
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+    if (p_ctrl->stale)
+    {
+        p_ctrl->stale       = false;
+        p_ctrl->poll_status = false;
+    }
+    else if ((NULL != p_ctrl->p_active) && p_ctrl->issued)
+    {
+        p_chain = rm_aio_block_media_finish(p_ctrl, result);
+    }
+    else
+    {
+        /* Not an operation started by this module. */
+    }
+
+    FSP_CRITICAL_SECTION_EXIT;
+
+    rm_aio_block_media_post(p_ctrl, p_chain);
+    rm_aio_block_media_start(p_ctrl);
+}
+
+/*******************************************************************************************************************//**
+ * Completes an erase the block media instance asked to poll for, or frees the media from an operation that timed
+ * out, once the media is no longer busy. A timed out operation may never call back, so it is polled until it ends.
+ *
+ * @param[in]  p_ctrl                  Instance control block.
+ **********************************************************************************************************************/
+static void rm_aio_block_media_status_poll (rm_aio_block_media_instance_ctrl_t * const p_ctrl)
+{
+    if (p_ctrl->poll_status || p_ctrl->stale)
+    {
+        rm_block_media_instance_t const * p_block_media = p_ctrl->p_extend->p_block_media;
+        rm_block_media_status_t           status;
+
+        if ((FSP_SUCCESS == p_block_media->p_api->statusGet(p_block_media->p_ctrl, &status)) && !status.busy)
+        {
+            p_ctrl->poll_status = false;
+            rm_aio_block_media_media_done(p_ctrl, FSP_SUCCESS);
+        }
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Block media callback. Completes the active request when its operation ends.
+ *
+ * @param[in]  p_args                  Block media callback arguments.
+ **********************************************************************************************************************/
+static void rm_aio_block_media_callback (rm_block_media_callback_args_t * p_args)
+{
+    rm_aio_block_media_instance_ctrl_t * p_ctrl = (rm_aio_block_media_instance_ctrl_t *) p_args->p_context;
+
+    if (RM_BLOCK_MEDIA_EVENT_ERROR & p_args->event)
+    {
+        rm_aio_block_media_media_done(p_ctrl, FSP_ERR_ABORTED);
+    }
+    else if (RM_BLOCK_MEDIA_EVENT_OPERATION_COMPLETE & p_args->event)
+    {
+        rm_aio_block_media_media_done(p_ctrl, FSP_SUCCESS);
+    }
+    else if (RM_BLOCK_MEDIA_EVENT_POLL_STATUS & p_args->event)
+    {
+        p_ctrl->poll_status = true;
+    }
+    else
+    {
+        /* Media insertion and removal events are not used. */
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Timer callback. Advances the tick, times out the active request and polls for erase completion.
+ *
+ * @param[in]  p_args                  Timer callback arguments.
+ **********************************************************************************************************************/
+static void rm_aio_block_media_timer_callback (timer_callback_args_t * p_args)
+{
+    rm_aio_block_media_instance_ctrl_t * p_ctrl = (rm_aio_block_media_instance_ctrl_t *) p_args->p_context;
+
+    if (TIMER_EVENT_CYCLE_END != p_args->event)
+    {
+        return;
+    }
+
+    rm_aio_request_t * p_chain = NULL;
+
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+    p_ctrl->tick++;
+
+    rm_aio_request_t * p_request = p_ctrl->p_active;
+    if ((NULL != p_request) && p_ctrl->issued && (0U != p_request->timeout) &&
+        ((p_ctrl->tick - p_ctrl->start_tick) >= p_request->timeout))
+    {
+        /* The operation cannot be cancelled. Nothing else starts on the media until it ends. */
+        p_ctrl->stale = true;
+        p_chain       = rm_aio_block_media_finish(p_ctrl, FSP_ERR_TIMEOUT);
+    }
+
+    FSP_CRITICAL_SECTION_EXIT;
+
+    rm_aio_block_media_post(p_ctrl, p_chain);
+
+    rm_aio_block_media_status_poll(p_ctrl);
+}
@@ -129,6 +129,17 @@ static const PKCS_CONTROL_BLOCK pkcs_control_block_data_mirror BSP_PLACE_IN_SECT
     },                                 // NOLINT(readability-magic-numbers)
 };
 
+/* RAM index of the objects stored in data flash. Values are read in place from the memory mapped data flash, so
+ * lookups after PKCS11_PAL_Initialize() do not touch the flash driver or recheck the hash. */
+typedef struct st_pkcs11_pal_object_index
+{
+    uint8_t const * pucData;           /* NULL when the object is not stored */
+    uint32_t        ulDataSize;
+} pkcs11_pal_object_index_t;
+
+static pkcs11_pal_object_index_t g_pkcs11_pal_object_index[PKCS_OBJECT_HANDLES_NUM];
+
+static void     prvObjectIndexBuild(void);
 static uint32_t update_dataflash_data_from_image(flash_ctrl_t * const p_flash_ctrl);
 static uint32_t update_dataflash_data_mirror_from_image(flash_ctrl_t * const p_flash_ctrl);
 static uint32_t check_dataflash_area(uint32_t retry_counter, flash_ctrl_t * const p_flash_ctrl);
@@ -185,6 +196,23 @@ const flash_cfg_t fsp_flash_cfg =
  */
 CK_RV PKCS11_PAL_Initialize ()
 {
+    flash_hp_instance_ctrl_t fsp_flash_ctrl = {0};
+
+    fsp_err = R_FLASH_HP_Open(&fsp_flash_ctrl, &fsp_flash_cfg);
+    if (FSP_SUCCESS != fsp_err)
+    {
+        return CKR_GENERAL_ERROR;
+    }
+
+    /* Check the hash once and recover the main or mirror block if needed. A broken data flash leaves the index
+     * empty, and PKCS11_PAL_SaveObject() reports the error. */
+    if (0 == check_dataflash_area(0, &fsp_flash_ctrl))
+    {
+        prvObjectIndexBuild();
+    }
+
+    R_FLASH_HP_Close(&fsp_flash_ctrl);
+
     return CKR_OK;
 }
 
@@ -323,6 +351,16 @@ CK_OBJECT_HANDLE PKCS11_PAL_SaveObject (CK_ATTRIBUTE_PTR pxLabel, uint8_t * pucD
         {
             // Nothing to do
         }
+
+        /* Objects may have moved in data flash. Do not index a partially written main block. */
+        if (eInvalidHandle != xHandle)
+        {
+            prvObjectIndexBuild();
+        }
+        else
+        {
+            memset(g_pkcs11_pal_object_index, 0, sizeof(g_pkcs11_pal_object_index));
+        }
     }
 
     R_FLASH_HP_Close(&fsp_flash_ctrl);
@@ -355,10 +393,12 @@ CK_OBJECT_HANDLE PKCS11_PAL_FindObject (uint8_t * pxLabel, uint8_t usLength)
     {
         if (!strcmp((char *) &object_handle_dictionary[i], (char *) pxLabel))
         {
-            if (pkcs_control_block_data_image.data.pkcs_data[i].status == PKCS_DATA_STATUS_REGISTERED)
+            if (NULL != g_pkcs11_pal_object_index[i].pucData)
             {
                 xHandle = (CK_OBJECT_HANDLE) i;
             }
+
+            break;
         }
     }
 
@@ -370,10 +410,9 @@ CK_OBJECT_HANDLE PKCS11_PAL_FindObject (uint8_t * pxLabel, uint8_t usLength)
  *
  * Port-specific file access for cryptographic information.
  *
- * This call dynamically allocates the buffer which object value
- * data is copied into.  PKCS11_PAL_GetObjectValueCleanup()
- * should be called after each use to free the dynamically allocated
- * buffer.
+ * The object value is not copied; ppucData points into the memory
+ * mapped data flash. PKCS11_PAL_GetObjectValueCleanup() should still
+ * be called after each use.
  *
  * @sa PKCS11_PAL_GetObjectValueCleanup
  *
@@ -401,13 +440,12 @@ CK_RV PKCS11_PAL_GetObjectValue (CK_OBJECT_HANDLE xHandle,
         xHandleStorage = eAwsDevicePrivateKey;
     }
 
-    if (xHandle != eInvalidHandle)
+    if ((xHandle != eInvalidHandle) && (xHandle < PKCS_OBJECT_HANDLES_NUM) &&
+        (NULL != g_pkcs11_pal_object_index[xHandleStorage].pucData))
     {
-        *ppucData =
-            &pkcs_control_block_data_image.data.local_storage[pkcs_control_block_data_image.data.pkcs_data[
-                                                                  xHandleStorage].
-                                                              local_storage_index];
-        *pulDataSize = pkcs_control_block_data_image.data.pkcs_data[xHandleStorage].ulDataSize;
+        /* The value is returned in place. It stays valid until the object is saved again. */
+        *ppucData    = (uint8_t *) g_pkcs11_pal_object_index[xHandleStorage].pucData;
+        *pulDataSize = g_pkcs11_pal_object_index[xHandleStorage].ulDataSize;
 
         if (xHandle == eAwsDevicePrivateKey)
         {
@@ -439,6 +477,30 @@ void PKCS11_PAL_GetObjectValueCleanup (uint8_t * pucBuffer, uint32_t ulBufferSiz
     FSP_PARAMETER_NOT_USED(ulBufferSize);
 }
 
+/*******************************************************************************************************************//**
+ * This function is used to rebuild the RAM object index from the main data flash block.
+ **********************************************************************************************************************/
+static void prvObjectIndexBuild (void)
+{
+    for (uint32_t i = 1; i < PKCS_OBJECT_HANDLES_NUM; i++)
+    {
+        PKCS_DATA const * p_pkcs_data = &pkcs_control_block_data.data.pkcs_data[i];
+
+        g_pkcs11_pal_object_index[i].pucData    = NULL;
+        g_pkcs11_pal_object_index[i].ulDataSize = 0;
+
+        if ((p_pkcs_data->status == PKCS_DATA_STATUS_REGISTERED) &&
+            (p_pkcs_data->ulDataSize <= sizeof(pkcs_control_block_data.data.local_storage)) &&
+            (p_pkcs_data->local_storage_index <=
+             sizeof(pkcs_control_block_data.data.local_storage) - p_pkcs_data->ulDataSize))
+        {
+            g_pkcs11_pal_object_index[i].pucData =
+                &pkcs_control_block_data.data.local_storage[p_pkcs_data->local_storage_index];
+            g_pkcs11_pal_object_index[i].ulDataSize = p_pkcs_data->ulDataSize;
+        }
+    }
+}
+
 /*******************************************************************************************************************//**
  * This function is used to update the main block with data from provided RAM context.
  * @retval
@@ -0,0 +1,44 @@
+/*
+ * FreeRTOS PKCS #11 V2.0.3
+ * Copyright (C) 2020 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://aws.amazon.com/freertos
+ * http://www.FreeRTOS.org
+ */
+
+#ifndef RM_AWS_PKCS11_PAL_LITTLEFS_H
+#define RM_AWS_PKCS11_PAL_LITTLEFS_H
+
+#include "iot_pkcs11.h"
+
+/*
+ *  @brief Keep an object in the RAM object cache.
+ *  @note  A pinned object is never evicted. It is read from storage on its next
+ *         PKCS11_PAL_GetObjectValue() call and served from RAM afterwards.
+ *         Unpinning makes the object eligible for LRU eviction again.
+ */
+extern CK_RV RM_AWS_PKCS11_PAL_LITTLEFS_CachePin(CK_OBJECT_HANDLE xHandle, CK_BBOOL xPin);
+
+/*
+ *  @brief Drop every object that is not in use from the RAM object cache.
+ */
+extern void RM_AWS_PKCS11_PAL_LITTLEFS_CacheFlush(void);
+
+#endif                                 /* RM_AWS_PKCS11_PAL_LITTLEFS_H */
@@ -47,6 +47,12 @@
 #include <string.h>
 
 #include "lfs.h"
+#include "rm_aws_pkcs11_pal_littlefs.h"
+
+/* Number of object values kept in RAM after they are read from littlefs. 0 disables the cache. */
+#ifndef RM_AWS_PKCS11_PAL_LITTLEFS_CFG_CACHE_ENTRIES
+ #define RM_AWS_PKCS11_PAL_LITTLEFS_CFG_CACHE_ENTRIES    (0)
+#endif
 
 extern lfs_t RM_STDIO_LITTLEFS_CFG_LFS;
 
@@ -80,6 +86,166 @@ uint8_t g_object_handle_dictionary[pkcs11configMAX_NUM_OBJECTS][pkcs11configMAX_
 #endif
 };
 
+#if RM_AWS_PKCS11_PAL_LITTLEFS_CFG_CACHE_ENTRIES > 0
+
+/* Object value held in RAM. Buffers handed out by PKCS11_PAL_GetObjectValue() point into the cache, so an entry
+ * is only released once every reader has called PKCS11_PAL_GetObjectValueCleanup(). */
+typedef struct st_pkcs11_pal_cache_entry
+{
+    CK_OBJECT_HANDLE xHandle;          /* eInvalidHandle when the entry is free */
+    CK_BYTE_PTR      pucData;
+    CK_ULONG         ulDataSize;
+    uint32_t         ulLastUse;        /* Value of ulCacheClock when the entry was last read */
+    uint32_t         ulReaders;        /* Buffers handed out and not yet cleaned up */
+    CK_BBOOL         xStale;           /* Object was rewritten while buffers were handed out */
+} pkcs11_pal_cache_entry_t;
+
+static pkcs11_pal_cache_entry_t g_pkcs11_pal_cache[RM_AWS_PKCS11_PAL_LITTLEFS_CFG_CACHE_ENTRIES];
+static uint32_t                 g_pkcs11_pal_cache_clock = 0;
+
+/* Incremented each time an object is saved, so a value read from storage before the save is not cached after it */
+static uint32_t g_pkcs11_pal_cache_generation[pkcs11configMAX_NUM_OBJECTS];
+#endif
+static CK_BBOOL g_pkcs11_pal_cache_pinned[pkcs11configMAX_NUM_OBJECTS];
+
+/* RAM index of the objects present in littlefs, so PKCS11_PAL_FindObject() only reaches storage the first time
+ * an object is looked up and after it is saved. */
+typedef enum e_pkcs11_pal_object_state
+{
+    PKCS11_PAL_OBJECT_STATE_UNKNOWN = 0,
+    PKCS11_PAL_OBJECT_STATE_STORED,
+    PKCS11_PAL_OBJECT_STATE_ABSENT,
+} pkcs11_pal_object_state_t;
+
+static volatile pkcs11_pal_object_state_t g_pkcs11_pal_object_state[pkcs11configMAX_NUM_OBJECTS];
+
+#if RM_AWS_PKCS11_PAL_LITTLEFS_CFG_CACHE_ENTRIES > 0
+
+/* Find the cache entry holding the current value of an object. Must be called with the scheduler suspended. */
+static pkcs11_pal_cache_entry_t * prvCacheFind (CK_OBJECT_HANDLE xHandle)
+{
+    for (uint32_t i = 0; i < RM_AWS_PKCS11_PAL_LITTLEFS_CFG_CACHE_ENTRIES; i++)
+    {
+        if ((g_pkcs11_pal_cache[i].xHandle == xHandle) && (CK_FALSE == g_pkcs11_pal_cache[i].xStale))
+        {
+            return &g_pkcs11_pal_cache[i];
+        }
+    }
+
+    return NULL;
+}
+
+/* Find the cache entry owning a buffer handed out by PKCS11_PAL_GetObjectValue(). Must be called with the
+ * scheduler suspended. */
+static pkcs11_pal_cache_entry_t * prvCacheFindBuffer (CK_BYTE_PTR pucData)
+{
+    for (uint32_t i = 0; i < RM_AWS_PKCS11_PAL_LITTLEFS_CFG_CACHE_ENTRIES; i++)
+    {
+        if ((g_pkcs11_pal_cache[i].xHandle != eInvalidHandle) && (g_pkcs11_pal_cache[i].pucData == pucData))
+        {
+            return &g_pkcs11_pal_cache[i];
+        }
+    }
+
+    return NULL;
+}
+
+/* Detach an entry and return the buffer the caller must free, or NULL if readers still hold it. Must be called with
+ * the scheduler suspended. */
+static CK_BYTE_PTR prvCacheRelease (pkcs11_pal_cache_entry_t * pxEntry)
+{
+    CK_BYTE_PTR pucData = NULL;
+
+    if (0U == pxEntry->ulReaders)
+    {
+        pucData          = pxEntry->pucData;
+        pxEntry->xHandle = eInvalidHandle;
+        pxEntry->pucData = NULL;
+        pxEntry->xStale  = CK_FALSE;
+    }
+    else
+    {
+        /* Freed by the last PKCS11_PAL_GetObjectValueCleanup() call */
+        pxEntry->xStale = CK_TRUE;
+    }
+
+    return pucData;
+}
+
+/* Take ownership of a freshly read object value. Uses a free entry or evicts the least recently used entry that is
+ * neither pinned nor in use. ulGeneration is the object generation captured before the value was read; the value is
+ * not cached if the object was saved since. Returns the buffer the caller must free (an evicted value, or pucData
+ * itself if the value could not be cached). */
+static CK_BYTE_PTR prvCacheInsert (CK_OBJECT_HANDLE xHandle,
+                                   CK_BYTE_PTR      pucData,
+                                   CK_ULONG         ulDataSize,
+                                   uint32_t         ulGeneration)
+{
+    pkcs11_pal_cache_entry_t * pxVictim   = NULL;
+    CK_BYTE_PTR                pucEvicted = pucData;
+
+    vTaskSuspendAll();
+
+    for (uint32_t i = 0; i < RM_AWS_PKCS11_PAL_LITTLEFS_CFG_CACHE_ENTRIES; i++)
+    {
+        pkcs11_pal_cache_entry_t * pxEntry = &g_pkcs11_pal_cache[i];
+
+        if (eInvalidHandle == pxEntry->xHandle)
+        {
+            pxVictim = pxEntry;
+            break;
+        }
+
+        if ((0U == pxEntry->ulReaders) && (CK_FALSE == g_pkcs11_pal_cache_pinned[pxEntry->xHandle]) &&
+            ((NULL == pxVictim) || ((g_pkcs11_pal_cache_clock - pxEntry->ulLastUse) >
+                                    (g_pkcs11_pal_cache_clock - pxVictim->ulLastUse))))
+        {
+            pxVictim = pxEntry;
+        }
+    }
+
+    /* Another task may have cached the object, or saved a new value, while it was being read */
+    if ((NULL != pxVictim) && (NULL == prvCacheFind(xHandle)) &&
+        (ulGeneration == g_pkcs11_pal_cache_generation[xHandle]))
+    {
+        pucEvicted          = pxVictim->pucData;
+        pxVictim->xHandle    = xHandle;
+        pxVictim->pucData    = pucData;
+        pxVictim->ulDataSize = ulDataSize;
+        pxVictim->ulLastUse  = g_pkcs11_pal_cache_clock++;
+        pxVictim->ulReaders  = 1U;
+        pxVictim->xStale     = CK_FALSE;
+    }
+
+    (void) xTaskResumeAll();
+
+    return pucEvicted;
+}
+
+/* Drop the cached value of an object. If xNewGeneration is set, values read before this call are no longer cached. */
+static void prvCacheInvalidate (CK_OBJECT_HANDLE xHandle, CK_BBOOL xNewGeneration)
+{
+    CK_BYTE_PTR pucStale = NULL;
+
+    vTaskSuspendAll();
+    if (CK_TRUE == xNewGeneration)
+    {
+        g_pkcs11_pal_cache_generation[xHandle]++;
+    }
+
+    pkcs11_pal_cache_entry_t * pxEntry = prvCacheFind(xHandle);
+    if (NULL != pxEntry)
+    {
+        pucStale = prvCacheRelease(pxEntry);
+    }
+
+    (void) xTaskResumeAll();
+
+    vPortFree(pucStale);
+}
+
+#endif
+
 /*
  *  @brief Initialize the PAL.
  */
@@ -117,32 +283,47 @@ CK_OBJECT_HANDLE PKCS11_PAL_SaveObject (CK_ATTRIBUTE_PTR pxLabel, CK_BYTE_PTR pu
         return eInvalidHandle;
     }
 
-    lfs_file_t file;
+#if RM_AWS_PKCS11_PAL_LITTLEFS_CFG_CACHE_ENTRIES > 0
 
-    volatile int lfs_err = lfs_remove(&RM_STDIO_LITTLEFS_CFG_LFS, pxLabel->pValue);
+    /* The cached value no longer matches storage */
+    prvCacheInvalidate(xHandle, CK_FALSE);
+#endif
 
-    if ((LFS_ERR_NOENT != lfs_err) && (LFS_ERR_OK != lfs_err))
-    {
-        return eInvalidHandle;
-    }
+    /* Storage is only known again once the new value is written */
+    g_pkcs11_pal_object_state[xHandle] = PKCS11_PAL_OBJECT_STATE_UNKNOWN;
 
-    lfs_err = lfs_file_open(&RM_STDIO_LITTLEFS_CFG_LFS, &file, pxLabel->pValue, LFS_O_WRONLY | LFS_O_CREAT);
+    lfs_file_t       file;
+    CK_OBJECT_HANDLE xReturn = eInvalidHandle;
+
+    volatile int lfs_err = lfs_remove(&RM_STDIO_LITTLEFS_CFG_LFS, pxLabel->pValue);
 
-    if (LFS_ERR_OK != lfs_err)
+    if ((LFS_ERR_NOENT == lfs_err) || (LFS_ERR_OK == lfs_err))
     {
-        return eInvalidHandle;
-    }
+        lfs_err = lfs_file_open(&RM_STDIO_LITTLEFS_CFG_LFS, &file, pxLabel->pValue, LFS_O_WRONLY | LFS_O_CREAT);
 
-    lfs_err = lfs_file_write(&RM_STDIO_LITTLEFS_CFG_LFS, &file, pucData, ulDataSize);
+        if (LFS_ERR_OK == lfs_err)
+        {
+            lfs_err = lfs_file_write(&RM_STDIO_LITTLEFS_CFG_LFS, &file, pucData, ulDataSize);
 
-    if (lfs_err < 0)
-    {
-        xHandle = eInvalidHandle;
+            if (lfs_err >= 0)
+            {
+                xReturn = xHandle;
+            }
+
+            if ((LFS_ERR_OK == lfs_file_close(&RM_STDIO_LITTLEFS_CFG_LFS, &file)) && (eInvalidHandle != xReturn))
+            {
+                g_pkcs11_pal_object_state[xHandle] = PKCS11_PAL_OBJECT_STATE_STORED;
+            }
+        }
     }
 
-    lfs_file_close(&RM_STDIO_LITTLEFS_CFG_LFS, &file);
+#if RM_AWS_PKCS11_PAL_LITTLEFS_CFG_CACHE_ENTRIES > 0
 
-    return xHandle;
+    /* A reader that read the previous value during the write may have cached it, or may still try to */
+    prvCacheInvalidate(xHandle, CK_TRUE);
+#endif
+
+    return xReturn;
 }
 
 /**
@@ -170,16 +351,33 @@ CK_OBJECT_HANDLE PKCS11_PAL_FindObject (CK_BYTE_PTR pxLabel, CK_ULONG usLength)
     {
         if (!strcmp((char *) &g_object_handle_dictionary[i], (char *) pxLabel))
         {
-            lfs_file_t file;
-
-            int lfs_err = lfs_file_open(&RM_STDIO_LITTLEFS_CFG_LFS, &file, (char *) pxLabel, LFS_O_RDONLY);
-
-            if (LFS_ERR_OK == lfs_err)
+            if (PKCS11_PAL_OBJECT_STATE_UNKNOWN == g_pkcs11_pal_object_state[i])
             {
-                lfs_file_close(&RM_STDIO_LITTLEFS_CFG_LFS, &file);
+                /* Checking the directory entry avoids allocating a file cache buffer */
+                struct lfs_info info;
+
+                int lfs_err = lfs_stat(&RM_STDIO_LITTLEFS_CFG_LFS, (char *) pxLabel, &info);
+
+                if (LFS_ERR_OK == lfs_err)
+                {
+                    g_pkcs11_pal_object_state[i] = PKCS11_PAL_OBJECT_STATE_STORED;
+                }
+                else if (LFS_ERR_NOENT == lfs_err)
+                {
+                    g_pkcs11_pal_object_state[i] = PKCS11_PAL_OBJECT_STATE_ABSENT;
+                }
+                else
+                {
+                    /* Try storage again on the next lookup */
+                }
+            }
 
+            if (PKCS11_PAL_OBJECT_STATE_STORED == g_pkcs11_pal_object_state[i])
+            {
                 xHandle = (CK_OBJECT_HANDLE) i;
             }
+
+            break;
         }
     }
 
@@ -218,48 +416,76 @@ CK_RV PKCS11_PAL_GetObjectValue (CK_OBJECT_HANDLE xHandle,
     CK_RV            xReturn        = CKR_FUNCTION_FAILED;
     CK_OBJECT_HANDLE xHandleStorage = xHandle;
 
-    if (xHandle != eInvalidHandle)
+    if (xHandle == eInvalidHandle)
     {
-        lfs_file_t file;
+        return xReturn;
+    }
 
-        int lfs_ret =
-            lfs_file_open(&RM_STDIO_LITTLEFS_CFG_LFS,
-                          &file,
-                          (char *) g_object_handle_dictionary[xHandleStorage],
-                          LFS_O_RDONLY);
+    *pIsPrivate = (xHandle == eAwsDevicePrivateKey) ? CK_TRUE : CK_FALSE;
 
-        if (LFS_ERR_OK != lfs_ret)
-        {
-            return eInvalidHandle;
-        }
+#if RM_AWS_PKCS11_PAL_LITTLEFS_CFG_CACHE_ENTRIES > 0
+    vTaskSuspendAll();
+    uint32_t                   ulGeneration = g_pkcs11_pal_cache_generation[xHandle];
+    pkcs11_pal_cache_entry_t * pxEntry      = prvCacheFind(xHandle);
+    if (NULL != pxEntry)
+    {
+        pxEntry->ulReaders++;
+        pxEntry->ulLastUse = g_pkcs11_pal_cache_clock++;
+        *ppucData          = pxEntry->pucData;
+        *pulDataSize       = pxEntry->ulDataSize;
+        xReturn            = CKR_OK;
+    }
 
-        lfs_ret = lfs_file_size(&RM_STDIO_LITTLEFS_CFG_LFS, &file);
+    (void) xTaskResumeAll();
 
-        *ppucData = pvPortMalloc((size_t) lfs_ret);
+    if (CKR_OK == xReturn)
+    {
+        return xReturn;
+    }
+#endif
 
-        if ((lfs_ret >= 0) && (NULL != *ppucData))
-        {
-            lfs_ret = lfs_file_read(&RM_STDIO_LITTLEFS_CFG_LFS, &file, *ppucData, (lfs_size_t) lfs_ret);
+    lfs_file_t file;
 
-            if (lfs_ret >= 0)
-            {
-                *pulDataSize = (uint32_t) lfs_ret;
+    int lfs_ret =
+        lfs_file_open(&RM_STDIO_LITTLEFS_CFG_LFS,
+                      &file,
+                      (char *) g_object_handle_dictionary[xHandleStorage],
+                      LFS_O_RDONLY);
 
-                xReturn = CKR_OK;
-            }
+    if (LFS_ERR_OK != lfs_ret)
+    {
+        return eInvalidHandle;
+    }
 
-            if (xHandle == eAwsDevicePrivateKey)
-            {
-                *pIsPrivate = CK_TRUE;
-            }
-            else
-            {
-                *pIsPrivate = CK_FALSE;
-            }
+    lfs_ret = lfs_file_size(&RM_STDIO_LITTLEFS_CFG_LFS, &file);
+
+    *ppucData = pvPortMalloc((size_t) lfs_ret);
+
+    if ((lfs_ret >= 0) && (NULL != *ppucData))
+    {
+        lfs_ret = lfs_file_read(&RM_STDIO_LITTLEFS_CFG_LFS, &file, *ppucData, (lfs_size_t) lfs_ret);
+
+        if (lfs_ret >= 0)
+        {
+            *pulDataSize = (uint32_t) lfs_ret;
+
+            xReturn = CKR_OK;
         }
+    }
+
+    lfs_file_close(&RM_STDIO_LITTLEFS_CFG_LFS, &file);
 
-        lfs_file_close(&RM_STDIO_LITTLEFS_CFG_LFS, &file);
+#if RM_AWS_PKCS11_PAL_LITTLEFS_CFG_CACHE_ENTRIES > 0
+    if (CKR_OK == xReturn)
+    {
+        /* Keep the value for the next reader; the buffer is released through the cache from now on */
+        CK_BYTE_PTR pucEvicted = prvCacheInsert(xHandle, *ppucData, *pulDataSize, ulGeneration);
+        if (pucEvicted != *ppucData)
+        {
+            vPortFree(pucEvicted);
+        }
     }
+#endif
 
     return xReturn;
 }
@@ -277,7 +503,63 @@ void PKCS11_PAL_GetObjectValueCleanup (CK_BYTE_PTR pucData, CK_ULONG ulDataSize)
     /* Avoid compiler warnings about unused variables. */
     FSP_PARAMETER_NOT_USED(ulDataSize);
 
+#if RM_AWS_PKCS11_PAL_LITTLEFS_CFG_CACHE_ENTRIES > 0
+    vTaskSuspendAll();
+    pkcs11_pal_cache_entry_t * pxEntry = prvCacheFindBuffer(pucData);
+    if (NULL != pxEntry)
+    {
+        /* Cached buffers are only freed once they are stale and unused */
+        pxEntry->ulReaders--;
+        pucData = (CK_TRUE == pxEntry->xStale) ? prvCacheRelease(pxEntry) : NULL;
+    }
+
+    (void) xTaskResumeAll();
+#endif
+
     vPortFree(pucData);
 }
 
+/**
+ * @brief Pin or unpin an object in the RAM object cache.
+ *
+ * @param[in] xHandle       Handle of the object.
+ * @param[in] xPin          CK_TRUE to keep the object cached, CK_FALSE to allow its eviction.
+ *
+ * @return CKR_OK if successful, CKR_KEY_HANDLE_INVALID if the handle is not valid.
+ */
+CK_RV RM_AWS_PKCS11_PAL_LITTLEFS_CachePin (CK_OBJECT_HANDLE xHandle, CK_BBOOL xPin)
+{
+    if ((eInvalidHandle == xHandle) || (xHandle >= pkcs11configMAX_NUM_OBJECTS))
+    {
+        return CKR_KEY_HANDLE_INVALID;
+    }
+
+    g_pkcs11_pal_cache_pinned[xHandle] = xPin;
+
+    return CKR_OK;
+}
+
+/**
+ * @brief Drop every cached object value that is not currently handed out, pinned or not.
+ */
+void RM_AWS_PKCS11_PAL_LITTLEFS_CacheFlush (void)
+{
+#if RM_AWS_PKCS11_PAL_LITTLEFS_CFG_CACHE_ENTRIES > 0
+    for (uint32_t i = 0; i < RM_AWS_PKCS11_PAL_LITTLEFS_CFG_CACHE_ENTRIES; i++)
+    {
+        CK_BYTE_PTR pucData = NULL;
+
+        vTaskSuspendAll();
+        if ((eInvalidHandle != g_pkcs11_pal_cache[i].xHandle) && (0U == g_pkcs11_pal_cache[i].ulReaders))
+        {
+            pucData = prvCacheRelease(&g_pkcs11_pal_cache[i]);
+        }
+
+        (void) xTaskResumeAll();
+
+        vPortFree(pucData);
+    }
+#endif
+}
+
 /*-----------------------------------------------------------*/
@@ -0,0 +1,41 @@
+/*
+ * FreeRTOS PKCS #11 V2.0.3
+ * Copyright (C) 2020 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://aws.amazon.com/freertos
+ * http://www.FreeRTOS.org
+ */
+
+#ifndef RM_AWS_PKCS11_PAL_VEE_H
+#define RM_AWS_PKCS11_PAL_VEE_H
+
+#include "iot_pkcs11.h"
+
+/*
+ *  @brief Compact the Virtual EEPROM holding the PKCS #11 objects.
+ *  @note  Call periodically from a low priority task. A refresh is started or
+ *         continued once the free space in the active segment drops below
+ *         RM_AWS_PKCS11_PAL_VEE_CFG_COMPACT_THRESHOLD, so that saving an object
+ *         rarely has to wait for a refresh. With a stepped refresh, each call
+ *         moves the configured number of records.
+ */
+extern CK_RV RM_AWS_PKCS11_PAL_VEE_Compact(void);
+
+#endif                                 /* RM_AWS_PKCS11_PAL_VEE_H */
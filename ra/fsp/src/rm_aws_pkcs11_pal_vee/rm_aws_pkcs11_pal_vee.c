@@ -0,0 +1,444 @@
+/*
+ * FreeRTOS PKCS #11 V2.0.3
+ * Copyright (C) 2020 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://aws.amazon.com/freertos
+ * http://www.FreeRTOS.org
+ */
+
+/* FreeRTOS Includes. */
+#if defined(__ARMCC_VERSION)
+ #pragma GCC diagnostic push
+ #pragma GCC diagnostic ignored "-Wmacro-redefined"
+#endif
+
+#include "iot_pkcs11.h"
+
+#if defined(__ARMCC_VERSION)
+ #pragma GCC diagnostic pop
+#endif
+
+#include "iot_pkcs11_config.h"
+#include "iot_pkcs11_pal.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include "semphr.h"
+
+/* C runtime includes. */
+#include <stdio.h>
+#include <string.h>
+
+#include "rm_vee_api.h"
+#include "rm_aws_pkcs11_pal_vee.h"
+
+/* Virtual EEPROM instance dedicated to the PKCS #11 objects. It must be opened by the application before
+ * PKCS11_PAL_Initialize() is called, and its record_max_id must be at least pkcs11configMAX_NUM_OBJECTS - 1. */
+#ifndef RM_AWS_PKCS11_PAL_VEE_CFG_INSTANCE
+ #define RM_AWS_PKCS11_PAL_VEE_CFG_INSTANCE    g_vee
+#endif
+
+/* Free space in the active segment below which RM_AWS_PKCS11_PAL_VEE_Compact() starts a refresh. */
+#ifndef RM_AWS_PKCS11_PAL_VEE_CFG_COMPACT_THRESHOLD
+ #define RM_AWS_PKCS11_PAL_VEE_CFG_COMPACT_THRESHOLD    (4096U)
+#endif
+
+/* Ticks to wait for a Virtual EEPROM operation or for readers to release object values. */
+#ifndef RM_AWS_PKCS11_PAL_VEE_CFG_TIMEOUT_TICKS
+ #define RM_AWS_PKCS11_PAL_VEE_CFG_TIMEOUT_TICKS    (portMAX_DELAY)
+#endif
+
+/* Records hold the object length followed by the object padded to the data flash write size. */
+#define PKCS11_PAL_VEE_WRITE_SIZE    (4U)
+
+extern const rm_vee_instance_t RM_AWS_PKCS11_PAL_VEE_CFG_INSTANCE;
+
+enum eObjectHandles
+{
+    eInvalidHandle       = 0,          /* According to PKCS #11 spec, 0 is never a valid object handle. */
+    eAwsDevicePrivateKey = 1,
+    eAwsDevicePublicKey,
+    eAwsDeviceCertificate,
+    eAwsCodeSigningKey,
+#if pkcs11configMAX_NUM_OBJECTS >= 6
+    eAwsRootCertificate,
+#endif
+#if pkcs11configMAX_NUM_OBJECTS >= 7
+    eAwsJitpCertificate,
+#endif
+};
+
+static const uint8_t g_object_handle_dictionary[pkcs11configMAX_NUM_OBJECTS][pkcs11configMAX_LABEL_LENGTH + 1] =
+{
+    "",
+    pkcs11configLABEL_DEVICE_PRIVATE_KEY_FOR_TLS,
+    pkcs11configLABEL_DEVICE_PUBLIC_KEY_FOR_TLS,
+    pkcs11configLABEL_DEVICE_CERTIFICATE_FOR_TLS,
+    pkcs11configLABEL_CODE_VERIFICATION_KEY,
+#if pkcs11configMAX_NUM_OBJECTS >= 6
+    pkcs11configLABEL_ROOT_CERTIFICATE,
+#endif
+#if pkcs11configMAX_NUM_OBJECTS >= 7
+    pkcs11configLABEL_JITP_CERTIFICATE,
+#endif
+};
+
+/* Serializes access to the Virtual EEPROM */
+static StaticSemaphore_t g_pkcs11_pal_vee_mutex_memory;
+static SemaphoreHandle_t g_pkcs11_pal_vee_mutex = NULL;
+
+/* Given by the Virtual EEPROM callback when an operation completes */
+static StaticSemaphore_t g_pkcs11_pal_vee_done_memory;
+static SemaphoreHandle_t g_pkcs11_pal_vee_done = NULL;
+
+/* Object values handed out in place and not yet cleaned up. Data flash cannot be read while it is written, so
+ * writes and refreshes wait until every reader is done. */
+static uint32_t g_pkcs11_pal_vee_readers = 0;
+
+static void rm_aws_pkcs11_pal_vee_callback(rm_vee_callback_args_t * p_args);
+
+/* Virtual EEPROM callback. Called from the flash interrupt when an operation completes. */
+static void rm_aws_pkcs11_pal_vee_callback (rm_vee_callback_args_t * p_args)
+{
+    FSP_PARAMETER_NOT_USED(p_args);
+
+    BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+    xSemaphoreGiveFromISR(g_pkcs11_pal_vee_done, &xHigherPriorityTaskWoken);
+    portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
+}
+
+/* Take the Virtual EEPROM once no object value is handed out. Returns pdFALSE on timeout. */
+static BaseType_t prvVeeTakeForWrite (void)
+{
+    TickType_t xStart = xTaskGetTickCount();
+
+    for ( ; ; )
+    {
+        if (pdTRUE != xSemaphoreTake(g_pkcs11_pal_vee_mutex, RM_AWS_PKCS11_PAL_VEE_CFG_TIMEOUT_TICKS))
+        {
+            return pdFALSE;
+        }
+
+        if (0U == g_pkcs11_pal_vee_readers)
+        {
+            return pdTRUE;
+        }
+
+        (void) xSemaphoreGive(g_pkcs11_pal_vee_mutex);
+
+        if ((portMAX_DELAY != RM_AWS_PKCS11_PAL_VEE_CFG_TIMEOUT_TICKS) &&
+            ((xTaskGetTickCount() - xStart) >= RM_AWS_PKCS11_PAL_VEE_CFG_TIMEOUT_TICKS))
+        {
+            return pdFALSE;
+        }
+
+        vTaskDelay(1);
+    }
+}
+
+/* Wait for the operation started by a Virtual EEPROM call to complete. Must be called with the mutex held. */
+static fsp_err_t prvVeeWait (fsp_err_t err)
+{
+    rm_vee_status_t status;
+
+    if ((FSP_SUCCESS != err) && (FSP_ERR_IN_USE != err))
+    {
+        return err;
+    }
+
+    if (pdTRUE != xSemaphoreTake(g_pkcs11_pal_vee_done, RM_AWS_PKCS11_PAL_VEE_CFG_TIMEOUT_TICKS))
+    {
+        return FSP_ERR_TIMEOUT;
+    }
+
+    (void) RM_AWS_PKCS11_PAL_VEE_CFG_INSTANCE.p_api->statusGet(RM_AWS_PKCS11_PAL_VEE_CFG_INSTANCE.p_ctrl, &status);
+    if ((RM_VEE_STATE_OVERFLOW == status.state) || (RM_VEE_STATE_HARDWARE_FAIL == status.state))
+    {
+        return FSP_ERR_PE_FAILURE;
+    }
+
+    return err;
+}
+
+/*
+ *  @brief Initialize the PAL.
+ */
+CK_RV PKCS11_PAL_Initialize ()
+{
+    if (NULL == g_pkcs11_pal_vee_mutex)
+    {
+        g_pkcs11_pal_vee_mutex = xSemaphoreCreateMutexStatic(&g_pkcs11_pal_vee_mutex_memory);
+        g_pkcs11_pal_vee_done  = xSemaphoreCreateBinaryStatic(&g_pkcs11_pal_vee_done_memory);
+    }
+
+    fsp_err_t err = RM_AWS_PKCS11_PAL_VEE_CFG_INSTANCE.p_api->callbackSet(RM_AWS_PKCS11_PAL_VEE_CFG_INSTANCE.p_ctrl,
+                                                                          rm_aws_pkcs11_pal_vee_callback,
+                                                                          NULL,
+                                                                          NULL);
+
+    return (FSP_SUCCESS == err) ? CKR_OK : CKR_GENERAL_ERROR;
+}
+
+/**
+ * @brief Writes a file to local storage.
+ *
+ * Port-specific file write for cryptographic information.
+ *
+ * The object is appended to the Virtual EEPROM as a new record. The
+ * previous value stays valid until the record is completely written,
+ * and only the records still in use are moved when the Virtual EEPROM
+ * is refreshed.
+ *
+ * @param[in] pxLabel       Label of the object to be saved.
+ * @param[in] pucData       Data buffer to be written to file
+ * @param[in] ulDataSize    Size (in bytes) of data to be saved.
+ *
+ * @return The file handle of the object that was stored.
+ */
+CK_OBJECT_HANDLE PKCS11_PAL_SaveObject (CK_ATTRIBUTE_PTR pxLabel, CK_BYTE_PTR pucData, CK_ULONG ulDataSize)
+{
+    CK_OBJECT_HANDLE xHandle = eInvalidHandle;
+
+    /* search specified label value from g_object_handle_dictionary */
+    for (uint32_t i = 1; i < pkcs11configMAX_NUM_OBJECTS; i++)
+    {
+        if (!strcmp((char *) &g_object_handle_dictionary[i], pxLabel->pValue))
+        {
+            xHandle = i;
+        }
+    }
+
+    if (eInvalidHandle == xHandle)
+    {
+        return eInvalidHandle;
+    }
+
+    uint32_t   ulRecordSize = (uint32_t) sizeof(uint32_t) +
+                              ((ulDataSize + PKCS11_PAL_VEE_WRITE_SIZE - 1U) & ~(PKCS11_PAL_VEE_WRITE_SIZE - 1U));
+    uint32_t * pulRecord    = pvPortMalloc(ulRecordSize);
+
+    if (NULL == pulRecord)
+    {
+        return eInvalidHandle;
+    }
+
+    memset(pulRecord, 0, ulRecordSize);
+    pulRecord[0] = (uint32_t) ulDataSize;
+    memcpy(&pulRecord[1], pucData, ulDataSize);
+
+    if (pdTRUE == prvVeeTakeForWrite())
+    {
+        fsp_err_t err;
+
+        do
+        {
+            (void) xSemaphoreTake(g_pkcs11_pal_vee_done, 0);
+
+            /* FSP_ERR_IN_USE means a paused refresh had to be completed first, so write again once it is done. */
+            err = RM_AWS_PKCS11_PAL_VEE_CFG_INSTANCE.p_api->recordWrite(RM_AWS_PKCS11_PAL_VEE_CFG_INSTANCE.p_ctrl,
+                                                                        (uint32_t) xHandle,
+                                                                        (uint8_t *) pulRecord,
+                                                                        ulRecordSize);
+            err = prvVeeWait(err);
+        } while (FSP_ERR_IN_USE == err);
+
+        (void) xSemaphoreGive(g_pkcs11_pal_vee_mutex);
+
+        if (FSP_SUCCESS != err)
+        {
+            xHandle = eInvalidHandle;
+        }
+    }
+    else
+    {
+        xHandle = eInvalidHandle;
+    }
+
+    vPortFree(pulRecord);
+
+    return xHandle;
+}
+
+/**
+ * @brief Translates a PKCS #11 label into an object handle.
+ *
+ * Port-specific object handle retrieval.
+ *
+ *
+ * @param[in] pxLabel        Pointer to the label of the object
+ *                           who's handle should be found.
+ * @param[in] usLength       The length of the label, in bytes.
+ *
+ * @return The object handle if operation was successful.
+ * Returns eInvalidHandle if unsuccessful.
+ */
+CK_OBJECT_HANDLE PKCS11_PAL_FindObject (CK_BYTE_PTR pxLabel, CK_ULONG usLength)
+{
+    /* Avoid compiler warnings about unused variables. */
+    FSP_PARAMETER_NOT_USED(usLength);
+
+    CK_OBJECT_HANDLE xHandle = eInvalidHandle;
+
+    for (uint32_t i = 1; i < pkcs11configMAX_NUM_OBJECTS; i++)
+    {
+        if (!strcmp((char *) &g_object_handle_dictionary[i], (char *) pxLabel))
+        {
+            uint8_t * p_record;
+            uint32_t  num_bytes;
+
+            /* The Virtual EEPROM keeps the location of every record in RAM */
+            (void) xSemaphoreTake(g_pkcs11_pal_vee_mutex, portMAX_DELAY);
+            fsp_err_t err = RM_AWS_PKCS11_PAL_VEE_CFG_INSTANCE.p_api->recordPtrGet(
+                RM_AWS_PKCS11_PAL_VEE_CFG_INSTANCE.p_ctrl,
+                i,
+                &p_record,
+                &num_bytes);
+            (void) xSemaphoreGive(g_pkcs11_pal_vee_mutex);
+
+            if (FSP_SUCCESS == err)
+            {
+                xHandle = (CK_OBJECT_HANDLE) i;
+            }
+
+            break;
+        }
+    }
+
+    return xHandle;
+}
+
+/**
+ * @brief Gets the value of an object in storage, by handle.
+ *
+ * Port-specific file access for cryptographic information.
+ *
+ * The object value is not copied; ppucData points into the memory
+ * mapped data flash. PKCS11_PAL_GetObjectValueCleanup() must be called
+ * after each use, and objects are not saved or compacted until every
+ * value handed out has been cleaned up.
+ *
+ * @sa PKCS11_PAL_GetObjectValueCleanup
+ *
+ * @param[in]  xHandle      Handle of the file to be read.
+ * @param[out] ppucData     Pointer to buffer for file data.
+ * @param[out] pulDataSize  Size (in bytes) of data located in file.
+ * @param[out] pIsPrivate   Boolean indicating if value is private (CK_TRUE)
+ *                          or exportable (CK_FALSE)
+ *
+ * @return CKR_OK if operation was successful.  CKR_KEY_HANDLE_INVALID if
+ * no such object handle was found, CKR_DEVICE_MEMORY if memory for
+ * buffer could not be allocated, CKR_FUNCTION_FAILED for device driver
+ * error.
+ */
+CK_RV PKCS11_PAL_GetObjectValue (CK_OBJECT_HANDLE xHandle,
+                                 CK_BYTE_PTR    * ppucData,
+                                 CK_ULONG_PTR     pulDataSize,
+                                 CK_BBOOL       * pIsPrivate)
+{
+    CK_RV xReturn = CKR_FUNCTION_FAILED;
+
+    if ((xHandle == eInvalidHandle) || (xHandle >= pkcs11configMAX_NUM_OBJECTS))
+    {
+        return CKR_KEY_HANDLE_INVALID;
+    }
+
+    *pIsPrivate = (xHandle == eAwsDevicePrivateKey) ? CK_TRUE : CK_FALSE;
+
+    uint32_t * pulRecord;
+    uint32_t   num_bytes;
+
+    (void) xSemaphoreTake(g_pkcs11_pal_vee_mutex, portMAX_DELAY);
+    fsp_err_t err = RM_AWS_PKCS11_PAL_VEE_CFG_INSTANCE.p_api->recordPtrGet(RM_AWS_PKCS11_PAL_VEE_CFG_INSTANCE.p_ctrl,
+                                                                           (uint32_t) xHandle,
+                                                                           (uint8_t **) &pulRecord,
+                                                                           &num_bytes);
+    if ((FSP_SUCCESS == err) && (num_bytes >= sizeof(uint32_t)) && (pulRecord[0] <= num_bytes - sizeof(uint32_t)))
+    {
+        g_pkcs11_pal_vee_readers++;
+
+        *ppucData    = (CK_BYTE_PTR) &pulRecord[1];
+        *pulDataSize = pulRecord[0];
+        xReturn      = CKR_OK;
+    }
+
+    (void) xSemaphoreGive(g_pkcs11_pal_vee_mutex);
+
+    return xReturn;
+}
+
+/**
+ * @brief Cleanup after PKCS11_GetObjectValue().
+ *
+ * @param[in] pucData       The buffer to free.
+ *                          (*ppucData from PKCS11_PAL_GetObjectValue())
+ * @param[in] ulDataSize    The length of the buffer to free.
+ *                          (*pulDataSize from PKCS11_PAL_GetObjectValue())
+ */
+void PKCS11_PAL_GetObjectValueCleanup (CK_BYTE_PTR pucData, CK_ULONG ulDataSize)
+{
+    /* Avoid compiler warnings about unused variables. */
+    FSP_PARAMETER_NOT_USED(ulDataSize);
+
+    if (NULL != pucData)
+    {
+        (void) xSemaphoreTake(g_pkcs11_pal_vee_mutex, portMAX_DELAY);
+        if (g_pkcs11_pal_vee_readers > 0U)
+        {
+            g_pkcs11_pal_vee_readers--;
+        }
+
+        (void) xSemaphoreGive(g_pkcs11_pal_vee_mutex);
+    }
+}
+
+/**
+ * @brief Start or continue a refresh of the Virtual EEPROM when it is running low on space.
+ *
+ * @return CKR_OK if successful or no refresh was needed, CKR_FUNCTION_FAILED if the refresh failed or objects are
+ * still in use after RM_AWS_PKCS11_PAL_VEE_CFG_TIMEOUT_TICKS.
+ */
+CK_RV RM_AWS_PKCS11_PAL_VEE_Compact (void)
+{
+    rm_vee_status_t status;
+    fsp_err_t       err = FSP_SUCCESS;
+
+    if (pdTRUE != prvVeeTakeForWrite())
+    {
+        return CKR_FUNCTION_FAILED;
+    }
+
+    (void) RM_AWS_PKCS11_PAL_VEE_CFG_INSTANCE.p_api->statusGet(RM_AWS_PKCS11_PAL_VEE_CFG_INSTANCE.p_ctrl, &status);
+
+    /* A paused stepped refresh also reports RM_VEE_STATE_REFRESH */
+    if ((RM_VEE_STATE_REFRESH == status.state) ||
+        ((RM_VEE_STATE_READY == status.state) &&
+         (status.space_available < RM_AWS_PKCS11_PAL_VEE_CFG_COMPACT_THRESHOLD)))
+    {
+        (void) xSemaphoreTake(g_pkcs11_pal_vee_done, 0);
+        err = RM_AWS_PKCS11_PAL_VEE_CFG_INSTANCE.p_api->refresh(RM_AWS_PKCS11_PAL_VEE_CFG_INSTANCE.p_ctrl);
+        err = (FSP_ERR_IN_USE == err) ? FSP_SUCCESS : prvVeeWait(err);
+    }
+
+    (void) xSemaphoreGive(g_pkcs11_pal_vee_mutex);
+
+    return (FSP_SUCCESS == err) ? CKR_OK : CKR_FUNCTION_FAILED;
+}
+
+/*-----------------------------------------------------------*/
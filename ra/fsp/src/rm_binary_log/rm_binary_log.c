@@ -0,0 +1,474 @@
+/***********************************************************************************************************************
+ * Copyright [2020] Renesas Electronics Corporation and/or its affiliates.  All Rights Reserved.
+ *
+ * This software and documentation are supplied by Renesas Electronics America Inc. and may only be used with products
+ * of Renesas Electronics Corp. and its affiliates ("Renesas").  No other uses are authorized.  Renesas products are
+ * sold pursuant to Renesas terms and conditions of sale.  Purchasers are solely responsible for the selection and use
+ * of Renesas products and Renesas assumes no liability.  No license, express or implied, to any intellectual property
+ * right is granted by Renesas. This software is protected under all applicable laws, including copyright laws. Renesas
+ * reserves the right to change or discontinue this software and/or this documentation. THE SOFTWARE AND DOCUMENTATION
+ * IS DELIVERED TO YOU "AS IS," AND RENESAS MAKES NO REPRESENTATIONS OR WARRANTIES, AND TO THE FULLEST EXTENT
+ * PERMISSIBLE UNDER APPLICABLE LAW, DISCLAIMS ALL WARRANTIES, WHETHER EXPLICITLY OR IMPLICITLY, INCLUDING WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, AND NONINFRINGEMENT, WITH RESPECT TO THE SOFTWARE OR
+ * DOCUMENTATION.  RENESAS SHALL HAVE NO LIABILITY ARISING OUT OF ANY SECURITY VULNERABILITY OR BREACH.  TO THE MAXIMUM
+ * EXTENT PERMITTED BY LAW, IN NO EVENT WILL RENESAS BE LIABLE TO YOU IN CONNECTION WITH THE SOFTWARE OR DOCUMENTATION
+ * (OR ANY PERSON OR ENTITY CLAIMING RIGHTS DERIVED FROM YOU) FOR ANY LOSS, DAMAGES, OR CLAIMS WHATSOEVER, INCLUDING,
+ * WITHOUT LIMITATION, ANY DIRECT, CONSEQUENTIAL, SPECIAL, INDIRECT, PUNITIVE, OR INCIDENTAL DAMAGES; ANY LOST PROFITS,
+ * OTHER ECONOMIC DAMAGE, PROPERTY DAMAGE, OR PERSONAL INJURY; AND EVEN IF RENESAS HAS BEEN ADVISED OF THE POSSIBILITY
+ * OF SUCH LOSS, DAMAGES, CLAIMS OR COSTS.
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Includes
+ **********************************************************************************************************************/
+#include "rm_binary_log.h"
+
+#ifndef RM_BINARY_LOG_CFG_TIMESTAMP
+ #error "RM_BINARY_LOG_CFG_TIMESTAMP() must be defined on MCUs without the DWT cycle counter."
+#endif
+
+/***********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+
+/* "BLOG" in ASCII. */
+#define RM_BINARY_LOG_OPEN                  (0x424C4F47U)
+
+/* Record layout: header, format ID and timestamp, followed by the arguments. The header holds a sync nibble, the
+ * number of arguments and the low 16 bits of the word position of the record, so the host can find record boundaries
+ * and detect lost data. The header is written last and a cleared word is never a valid header, so a record is known
+ * to be complete once its header is valid. */
+#define RM_BINARY_LOG_PRV_RECORD_WORDS      (3U)
+#define RM_BINARY_LOG_PRV_HEADER_SYNC       (0xA0000000U)
+#define RM_BINARY_LOG_PRV_HEADER_SYNC_MASK  (0xF0FF0000U)
+#define RM_BINARY_LOG_PRV_HEADER_ARGS_POS   (24U)
+#define RM_BINARY_LOG_PRV_HEADER_ARGS_MASK  (0xFU)
+#define RM_BINARY_LOG_PRV_HEADER_TAG_MASK   (0xFFFFU)
+
+#define RM_BINARY_LOG_PRV_BUFFER_WORDS_MIN  (16U)
+#define RM_BINARY_LOG_PRV_BUFFER_WORDS_MAX  (32768U)
+
+/* Records are reserved with LDREX/STREX on Cortex-M4 and Cortex-M33, and in a short interrupt masked section on
+ * other cores. */
+#if (4U == __CORTEX_M) || (33U == __CORTEX_M)
+ #define RM_BINARY_LOG_PRV_EXCLUSIVE_ACCESS (1)
+#else
+ #define RM_BINARY_LOG_PRV_EXCLUSIVE_ACCESS (0)
+#endif
+
+#if RM_BINARY_LOG_CFG_ARGS_MAX > RM_BINARY_LOG_PRV_HEADER_ARGS_MASK
+ #error "RM_BINARY_LOG_CFG_ARGS_MAX must not be larger than 15."
+#endif
+
+/***********************************************************************************************************************
+ * Private function prototypes
+ **********************************************************************************************************************/
+static bool rm_binary_log_record(rm_binary_log_instance_ctrl_t * const p_ctrl,
+                                 uint32_t                              fmt_id,
+                                 uint32_t const * const                p_args,
+                                 uint32_t                              num_args);
+static void      rm_binary_log_add(uint32_t volatile * const p_counter, uint32_t value);
+static fsp_err_t rm_binary_log_segment_start(rm_binary_log_instance_ctrl_t * const p_ctrl);
+static void      rm_binary_log_uart_callback(uart_callback_args_t * p_args);
+
+/***********************************************************************************************************************
+ * Private global variables
+ **********************************************************************************************************************/
+
+/** Version data structure. */
+static const fsp_version_t g_rm_binary_log_version =
+{
+    .api_version_minor  = RM_BINARY_LOG_CODE_VERSION_MINOR,
+    .api_version_major  = RM_BINARY_LOG_CODE_VERSION_MAJOR,
+    .code_version_major = RM_BINARY_LOG_CODE_VERSION_MAJOR,
+    .code_version_minor = RM_BINARY_LOG_CODE_VERSION_MINOR
+};
+
+/*******************************************************************************************************************//**
+ * @addtogroup RM_BINARY_LOG
+ * @{
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Functions
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * Clears the record buffer and takes over the callback of the UART.
+ *
+ * @retval     FSP_SUCCESS                    Module is available and is now open.
+ * @retval     FSP_ERR_ASSERTION              An input parameter is invalid.
+ * @retval     FSP_ERR_ALREADY_OPEN           Module has already been opened with this instance of the control
+ *                                            structure.
+ * @return See @ref RENESAS_ERROR_CODES or functions called by this function for other possible return codes.
+ *         This function calls:
+ *             * @ref uart_api_t::callbackSet
+ **********************************************************************************************************************/
+fsp_err_t RM_BINARY_LOG_Open (rm_binary_log_instance_ctrl_t * const p_ctrl, rm_binary_log_cfg_t const * const p_cfg)
+{
+#if RM_BINARY_LOG_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ASSERT(NULL != p_cfg);
+    FSP_ASSERT(NULL != p_cfg->p_uart);
+    FSP_ASSERT(NULL != p_cfg->p_buffer);
+    FSP_ASSERT(0U == (p_cfg->buffer_words & (p_cfg->buffer_words - 1U)));
+    FSP_ASSERT(p_cfg->buffer_words >= RM_BINARY_LOG_PRV_BUFFER_WORDS_MIN);
+    FSP_ASSERT(p_cfg->buffer_words <= RM_BINARY_LOG_PRV_BUFFER_WORDS_MAX);
+    FSP_ERROR_RETURN(RM_BINARY_LOG_OPEN != p_ctrl->open, FSP_ERR_ALREADY_OPEN);
+#endif
+
+    p_ctrl->p_cfg            = p_cfg;
+    p_ctrl->p_ring           = p_cfg->p_buffer;
+    p_ctrl->mask             = p_cfg->buffer_words - 1U;
+    p_ctrl->head             = 0U;
+    p_ctrl->tail             = 0U;
+    p_ctrl->scan             = 0U;
+    p_ctrl->tx_words         = 0U;
+    p_ctrl->dropped          = 0U;
+    p_ctrl->dropped_reported = 0U;
+
+    /* A cleared word is not a valid record header. */
+    for (uint32_t i = 0U; i < p_cfg->buffer_words; i++)
+    {
+        p_ctrl->p_ring[i] = 0U;
+    }
+
+    /* Start the cycle counter in case it is the timestamp. */
+    R_BSP_CycleCounterStart();
+
+    uart_instance_t const * p_uart = p_cfg->p_uart;
+    fsp_err_t               err    =
+        p_uart->p_api->callbackSet(p_uart->p_ctrl, rm_binary_log_uart_callback, p_ctrl, &p_ctrl->uart_args);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+    p_ctrl->open = RM_BINARY_LOG_OPEN;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Stores a log record. Normally called through RM_BINARY_LOG(). The record is reserved without masking interrupts on
+ * cores with exclusive access, so this function may be called from any context. If the buffer is full, the record is
+ * dropped and counted; the count is sent in a record with format ID RM_BINARY_LOG_FMT_ID_DROPPED once there is room.
+ *
+ * @param[in]  p_ctrl      Pointer to the control structure.
+ * @param[in]  p_fmt       Format string, placed in section RM_BINARY_LOG_FMT_SECTION.
+ * @param[in]  p_args      Arguments of the format string.
+ * @param[in]  num_args    Number of arguments, no more than RM_BINARY_LOG_CFG_ARGS_MAX.
+ **********************************************************************************************************************/
+void RM_BINARY_LOG_Write (rm_binary_log_instance_ctrl_t * const p_ctrl,
+                          char const * const                    p_fmt,
+                          uint32_t const * const                p_args,
+                          uint32_t                              num_args)
+{
+#if RM_BINARY_LOG_CFG_PARAM_CHECKING_ENABLE
+    if ((NULL == p_ctrl) || (RM_BINARY_LOG_OPEN != p_ctrl->open) || (num_args > RM_BINARY_LOG_CFG_ARGS_MAX))
+    {
+        return;
+    }
+#endif
+
+    if (!rm_binary_log_record(p_ctrl, (uint32_t) p_fmt, p_args, num_args))
+    {
+        rm_binary_log_add(&p_ctrl->dropped, 1U);
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Starts sending the stored records if the UART is idle. Segments are sent directly from the record buffer, and each
+ * completed segment starts the next one from the UART callback, so this function only needs to be called when new
+ * records may be waiting on an idle UART, e.g. periodically from a low priority task.
+ *
+ * @retval     FSP_SUCCESS                    Records are being sent, or there is nothing to send.
+ * @retval     FSP_ERR_ASSERTION              p_ctrl is NULL.
+ * @retval     FSP_ERR_NOT_OPEN               Module is not open.
+ * @return See @ref RENESAS_ERROR_CODES or functions called by this function for other possible return codes.
+ *         This function calls:
+ *             * @ref uart_api_t::write
+ **********************************************************************************************************************/
+fsp_err_t RM_BINARY_LOG_Drain (rm_binary_log_instance_ctrl_t * const p_ctrl)
+{
+#if RM_BINARY_LOG_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ERROR_RETURN(RM_BINARY_LOG_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+
+    return rm_binary_log_segment_start(p_ctrl);
+}
+
+/*******************************************************************************************************************//**
+ * Gets the number of bytes waiting to be sent and the number of records dropped.
+ *
+ * @retval     FSP_SUCCESS                    Status stored in p_status.
+ * @retval     FSP_ERR_ASSERTION              An input parameter is NULL.
+ * @retval     FSP_ERR_NOT_OPEN               Module is not open.
+ **********************************************************************************************************************/
+fsp_err_t RM_BINARY_LOG_StatusGet (rm_binary_log_instance_ctrl_t * const p_ctrl,
+                                  rm_binary_log_status_t * const        p_status)
+{
+#if RM_BINARY_LOG_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ASSERT(NULL != p_status);
+    FSP_ERROR_RETURN(RM_BINARY_LOG_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+
+    p_status->pending_bytes = (p_ctrl->head - p_ctrl->tail) * sizeof(uint32_t);
+    p_status->dropped       = p_ctrl->dropped_reported + p_ctrl->dropped;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Aborts the segment being sent and restores the callback of the UART configuration. Records not sent are lost.
+ *
+ * @retval     FSP_SUCCESS                    Module closed.
+ * @retval     FSP_ERR_ASSERTION              p_ctrl is NULL.
+ * @retval     FSP_ERR_NOT_OPEN               Module is not open.
+ **********************************************************************************************************************/
+fsp_err_t RM_BINARY_LOG_Close (rm_binary_log_instance_ctrl_t * const p_ctrl)
+{
+#if RM_BINARY_LOG_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ERROR_RETURN(RM_BINARY_LOG_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+
+    p_ctrl->open = 0U;
+
+    uart_instance_t const * p_uart = p_ctrl->p_cfg->p_uart;
+    (void) p_uart->p_api->communicationAbort(p_uart->p_ctrl, UART_DIR_TX);
+    (void) p_uart->p_api->callbackSet(p_uart->p_ctrl, p_uart->p_cfg->p_callback, p_uart->p_cfg->p_context, NULL);
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Gets the version of this module.
+ *
+ * @retval     FSP_SUCCESS                    Version stored in p_version.
+ * @retval     FSP_ERR_ASSERTION              p_version is NULL.
+ **********************************************************************************************************************/
+fsp_err_t RM_BINARY_LOG_VersionGet (fsp_version_t * const p_version)
+{
+#if RM_BINARY_LOG_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_version);
+#endif
+
+    p_version->version_id = g_rm_binary_log_version.version_id;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @} (end addtogroup RM_BINARY_LOG)
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Private Functions
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * Reserves room for a record and stores it. Room is only reserved outside the words between the tail and the head,
+ * so records are never written to a segment the UART is sending.
+ *
+ * @param[in]  p_ctrl      Pointer to the control structure.
+ * @param[in]  fmt_id      Address of the format string, or RM_BINARY_LOG_FMT_ID_DROPPED.
+ * @param[in]  p_args      Arguments of the format string.
+ * @param[in]  num_args    Number of arguments.
+ *
+ * @retval     true        The record was stored.
+ * @retval     false       The buffer is full.
+ **********************************************************************************************************************/
+static bool rm_binary_log_record (rm_binary_log_instance_ctrl_t * const p_ctrl,
+                                  uint32_t                              fmt_id,
+                                  uint32_t const * const                p_args,
+                                  uint32_t                              num_args)
+{
+    uint32_t words = RM_BINARY_LOG_PRV_RECORD_WORDS + num_args;
+    uint32_t head;
+
+#if RM_BINARY_LOG_PRV_EXCLUSIVE_ACCESS
+    do
+    {
+        head = __LDREXW(&p_ctrl->head);
+        if ((head - p_ctrl->tail) + words > (p_ctrl->mask + 1U))
+        {
+            __CLREX();
+
+            return false;
+        }
+    } while (0U != __STREXW(head + words, &p_ctrl->head));
+
+#else
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+    head = p_ctrl->head;
+    bool full = (head - p_ctrl->tail) + words > (p_ctrl->mask + 1U);
+    if (!full)
+    {
+        p_ctrl->head = head + words;
+    }
+
+    FSP_CRITICAL_SECTION_EXIT;
+    if (full)
+    {
+        return false;
+    }
+#endif
+
+    uint32_t volatile * p_ring = p_ctrl->p_ring;
+    uint32_t            mask   = p_ctrl->mask;
+
+    p_ring[(head + 1U) & mask] = fmt_id;
+    p_ring[(head + 2U) & mask] = RM_BINARY_LOG_CFG_TIMESTAMP();
+    for (uint32_t i = 0U; i < num_args; i++)
+    {
+        p_ring[(head + RM_BINARY_LOG_PRV_RECORD_WORDS + i) & mask] = p_args[i];
+    }
+
+    /* Writing the header completes the record. */
+    p_ring[head & mask] = RM_BINARY_LOG_PRV_HEADER_SYNC | (num_args << RM_BINARY_LOG_PRV_HEADER_ARGS_POS) |
+                          (head & RM_BINARY_LOG_PRV_HEADER_TAG_MASK);
+
+    return true;
+}
+
+/*******************************************************************************************************************//**
+ * Adds a value to a counter that records are dropped into from any context.
+ *
+ * @param[in]  p_counter   Counter to update.
+ * @param[in]  value       Value to add, modulo 2^32.
+ **********************************************************************************************************************/
+static void rm_binary_log_add (uint32_t volatile * const p_counter, uint32_t value)
+{
+#if RM_BINARY_LOG_PRV_EXCLUSIVE_ACCESS
+    uint32_t count;
+    do
+    {
+        count = __LDREXW(p_counter);
+    } while (0U != __STREXW(count + value, p_counter));
+
+#else
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+    *p_counter += value;
+    FSP_CRITICAL_SECTION_EXIT;
+#endif
+}
+
+/*******************************************************************************************************************//**
+ * Starts sending the next segment if the UART is idle. A segment holds the complete records following the tail, up to
+ * RM_BINARY_LOG_CFG_SEGMENT_MAX_BYTES and the end of the buffer. Called from the drain and from the UART callback.
+ *
+ * @param[in]  p_ctrl      Pointer to the control structure.
+ *
+ * @retval     FSP_SUCCESS                    A segment is being sent, or there is nothing to send.
+ * @return See @ref RENESAS_ERROR_CODES or functions called by this function for other possible return codes.
+ **********************************************************************************************************************/
+static fsp_err_t rm_binary_log_segment_start (rm_binary_log_instance_ctrl_t * const p_ctrl)
+{
+    fsp_err_t err = FSP_SUCCESS;
+
+    /* The drain and the UART callback may both start a segment. */
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+
+    if (0U == p_ctrl->tx_words)
+    {
+        /* Report the records dropped so far. */
+        uint32_t dropped = p_ctrl->dropped;
+        if ((0U != dropped) && rm_binary_log_record(p_ctrl, RM_BINARY_LOG_FMT_ID_DROPPED, &dropped, 1U))
+        {
+            rm_binary_log_add(&p_ctrl->dropped, 0U - dropped);
+            p_ctrl->dropped_reported += dropped;
+        }
+
+        /* Find the complete records following the previously checked ones. Records reserved by an interrupted
+         * context still have a cleared header and end the search. */
+        uint32_t volatile * p_ring = p_ctrl->p_ring;
+        uint32_t            tail   = p_ctrl->tail;
+        uint32_t            scan   = p_ctrl->scan;
+        uint32_t            head   = p_ctrl->head;
+        uint32_t            limit  = (p_ctrl->mask + 1U) - (tail & p_ctrl->mask);
+        if (limit > (RM_BINARY_LOG_CFG_SEGMENT_MAX_BYTES / sizeof(uint32_t)))
+        {
+            limit = RM_BINARY_LOG_CFG_SEGMENT_MAX_BYTES / sizeof(uint32_t);
+        }
+
+        while ((scan != head) && ((scan - tail) < limit))
+        {
+            uint32_t header = p_ring[scan & p_ctrl->mask];
+            if ((header & (RM_BINARY_LOG_PRV_HEADER_SYNC_MASK | RM_BINARY_LOG_PRV_HEADER_TAG_MASK)) !=
+                (RM_BINARY_LOG_PRV_HEADER_SYNC | (scan & RM_BINARY_LOG_PRV_HEADER_TAG_MASK)))
+            {
+                break;
+            }
+
+            scan += RM_BINARY_LOG_PRV_RECORD_WORDS +
+                    ((header >> RM_BINARY_LOG_PRV_HEADER_ARGS_POS) & RM_BINARY_LOG_PRV_HEADER_ARGS_MASK);
+        }
+
+        p_ctrl->scan = scan;
+
+        /* A record may be split across segments. */
+        uint32_t words = scan - tail;
+        if (words > limit)
+        {
+            words = limit;
+        }
+
+        if (0U != words)
+        {
+            p_ctrl->tx_words = words;
+
+            uart_instance_t const * p_uart = p_ctrl->p_cfg->p_uart;
+            err = p_uart->p_api->write(p_uart->p_ctrl, (uint8_t const *) &p_ring[tail & p_ctrl->mask],
+                                       words * sizeof(uint32_t));
+            if (FSP_SUCCESS != err)
+            {
+                p_ctrl->tx_words = 0U;
+            }
+        }
+    }
+
+    FSP_CRITICAL_SECTION_EXIT;
+
+    return err;
+}
+
+/*******************************************************************************************************************//**
+ * Releases a sent segment and starts the next one. Other UART events are forwarded to the callback of the UART
+ * configuration.
+ *
+ * @param[in]  p_args      UART callback arguments.
+ **********************************************************************************************************************/
+static void rm_binary_log_uart_callback (uart_callback_args_t * p_args)
+{
+    rm_binary_log_instance_ctrl_t * p_ctrl = (rm_binary_log_instance_ctrl_t *) p_args->p_context;
+
+    if (UART_EVENT_TX_COMPLETE == p_args->event)
+    {
+        /* Clear the sent words before releasing them, so stale headers are never taken for complete records. */
+        uint32_t volatile * p_ring = p_ctrl->p_ring;
+        uint32_t            tail   = p_ctrl->tail;
+        uint32_t            words  = p_ctrl->tx_words;
+        for (uint32_t i = 0U; i < words; i++)
+        {
+            p_ring[(tail + i) & p_ctrl->mask] = 0U;
+        }
+
+        p_ctrl->tail     = tail + words;
+        p_ctrl->tx_words = 0U;
+
+        (void) rm_binary_log_segment_start(p_ctrl);
+    }
+    else
+    {
+        uart_cfg_t const * p_uart_cfg = p_ctrl->p_cfg->p_uart->p_cfg;
+        if (NULL != p_uart_cfg->p_callback)
+        {
+            uart_callback_args_t args = *p_args;
+            args.p_context = p_uart_cfg->p_context;
+            p_uart_cfg->p_callback(&args);
+        }
+    }
+}
@@ -0,0 +1,221 @@
+#!/usr/bin/env python3
+#
+# Copyright [2020] Renesas Electronics Corporation and/or its affiliates.  All Rights Reserved.
+#
+# This software and documentation are supplied by Renesas Electronics America Inc. and may only be used with products
+# of Renesas Electronics Corp. and its affiliates ("Renesas").  No other uses are authorized.  Renesas products are
+# sold pursuant to Renesas terms and conditions of sale.  Purchasers are solely responsible for the selection and use
+# of Renesas products and Renesas assumes no liability.  No license, express or implied, to any intellectual property
+# right is granted by Renesas. This software is protected under all applicable laws, including copyright laws. Renesas
+# reserves the right to change or discontinue this software and/or this documentation. THE SOFTWARE AND DOCUMENTATION
+# IS DELIVERED TO YOU "AS IS," AND RENESAS MAKES NO REPRESENTATIONS OR WARRANTIES, AND TO THE FULLEST EXTENT
+# PERMISSIBLE UNDER APPLICABLE LAW, DISCLAIMS ALL WARRANTIES, WHETHER EXPLICITLY OR IMPLICITLY, INCLUDING WARRANTIES
+# OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, AND NONINFRINGEMENT, WITH RESPECT TO THE SOFTWARE OR
+# DOCUMENTATION.  RENESAS SHALL HAVE NO LIABILITY ARISING OUT OF ANY SECURITY VULNERABILITY OR BREACH.  TO THE MAXIMUM
+# EXTENT PERMITTED BY LAW, IN NO EVENT WILL RENESAS BE LIABLE TO YOU IN CONNECTION WITH THE SOFTWARE OR DOCUMENTATION
+# (OR ANY PERSON OR ENTITY CLAIMING RIGHTS DERIVED FROM IT) FOR ANY DAMAGES, INCLUDING WITHOUT LIMITATION, ANY DIRECT,
+# CONSEQUENTIAL, SPECIAL, INDIRECT, PUNITIVE, OR INCIDENTAL DAMAGES; ANY LOST PROFITS, OTHER ECONOMIC DAMAGE,
+# PROPERTY DAMAGE, OR PERSONAL INJURY; AND EVEN IF RENESAS HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGES.
+#
+"""Host decoder of the RM_BINARY_LOG() records.
+
+Reads the record stream sent by rm_binary_log, from a capture file or live from a serial port, looks the format
+strings up in the ELF file of the firmware and prints one formatted line per record.
+
+Examples:
+    rm_binary_log_decode.py firmware.elf uart_capture.bin --clock 120000000
+    rm_binary_log_decode.py firmware.elf --serial /dev/ttyUSB0 --baud 921600
+"""
+
+import argparse
+import re
+import struct
+import sys
+
+FMT_SECTION = ".rm_binary_log_fmt"
+FMT_ID_DROPPED = 0
+RECORD_WORDS = 3
+HEADER_SYNC = 0xA0000000
+HEADER_SYNC_MASK = 0xF0FF0000
+TAG_MASK = 0xFFFF
+SHF_ALLOC = 0x2
+SHT_NOBITS = 8
+
+# printf conversion: flags, width, precision, length modifier and conversion.
+CONVERSION = re.compile(r"%([-+ #0]*)(\d+|\*)?(?:\.(\d+|\*))?(hh|h|ll|l|j|z|t|L)?([diouxXeEfFgGaAcsp%])")
+
+
+class Elf:
+    """Sections of a little endian ELF32 file, enough to read strings by address."""
+
+    def __init__(self, path):
+        data = open(path, "rb").read()
+        if data[:4] != b"\x7fELF" or data[4] != 1 or data[5] != 1:
+            sys.exit("%s is not a little endian ELF32 file" % path)
+        shoff, = struct.unpack_from("<I", data, 0x20)
+        shentsize, shnum, shstrndx = struct.unpack_from("<HHH", data, 0x2E)
+        headers = [struct.unpack_from("<IIIIIIIIII", data, shoff + i * shentsize) for i in range(shnum)]
+        names = headers[shstrndx][4]
+        self.sections = []
+        self.formats = None
+        for name, kind, flags, addr, offset, size, _, _, _, _ in headers:
+            name = data[names + name:data.index(b"\0", names + name)].decode()
+            contents = data[offset:offset + size] if SHT_NOBITS != kind else bytes(size)
+            if FMT_SECTION == name:
+                self.formats = (addr, contents)
+            elif flags & SHF_ALLOC:
+                self.sections.append((addr, contents))
+        if self.formats is None:
+            sys.exit("%s has no %s section, is rm_binary_log linked in?" % (path, FMT_SECTION))
+
+    def format_string(self, address):
+        addr, contents = self.formats
+        if not 0 <= address - addr < len(contents):
+            return None
+        return self._string(contents, address - addr)
+
+    def string(self, address):
+        for addr, contents in self.sections + [self.formats]:
+            if 0 <= address - addr < len(contents):
+                return self._string(contents, address - addr)
+        return "<0x%08x>" % address
+
+    @staticmethod
+    def _string(contents, offset):
+        end = contents.find(b"\0", offset)
+        return contents[offset:end if end >= 0 else len(contents)].decode("utf-8", "replace")
+
+
+def format_record(elf, fmt, args):
+    """Formats the arguments the way printf would on the target, where every argument is one 32-bit word."""
+    words = iter(args)
+
+    def next_word():
+        return next(words, 0)
+
+    def convert(match):
+        flags, width, precision, _, conversion = match.groups()
+        if "%" == conversion:
+            return "%"
+        if "*" == width:
+            width = str(struct.unpack("<i", struct.pack("<I", next_word()))[0])
+        if "*" == precision:
+            precision = str(next_word())
+        word = next_word()
+        if conversion in "di":
+            value = struct.unpack("<i", struct.pack("<I", word))[0]
+        elif conversion in "eEfFgGaA":
+            value = struct.unpack("<f", struct.pack("<I", word))[0]
+            conversion = "e" if conversion in "aA" else conversion
+        elif "c" == conversion:
+            value = chr(word & 0xFF)
+        elif "s" == conversion:
+            value = elf.string(word)
+        elif "p" == conversion:
+            value, conversion, flags = word, "x", flags + "#"
+        else:
+            value = word
+        spec = "%" + flags + (width or "") + ("." + precision if precision is not None else "")
+        return (spec + ("d" if "u" == conversion else conversion)) % value
+
+    return CONVERSION.sub(convert, fmt)
+
+
+def read_words(stream, pending=b""):
+    """Yields the 32-bit words of a byte stream, starting with the bytes already read."""
+    while True:
+        chunk = stream.read(4096)
+        if not chunk and len(pending) < 4:
+            return
+        pending += chunk
+        count = len(pending) // 4
+        for word in struct.unpack_from("<%dI" % count, pending):
+            yield word
+        pending = pending[count * 4:]
+
+
+def is_header(word):
+    return (word & HEADER_SYNC_MASK) == HEADER_SYNC
+
+
+def align_stream(stream):
+    """Finds the byte offset of the first word in a capture that may start in the middle of a word, and yields the
+    words from there."""
+    start = stream.read(1024)
+    counts = [sum(1 for _ in read_records(iter(struct.unpack_from("<%dI" % ((len(start) - offset) // 4), start,
+                                                                   offset)), quiet=True))
+              for offset in range(4)]
+    offset = counts.index(max(counts))
+    return read_words(stream, start[offset:])
+
+
+def read_records(words, quiet=False):
+    """Yields (tag, format ID, timestamp, arguments) per record. A capture may start in the middle of the stream, so
+    records are only trusted once two consecutive headers agree on the position of the second one."""
+    window = []
+    expected = None
+    for word in words:
+        window.append(word)
+        while window:
+            header = window[0]
+            if not is_header(header) or (expected is not None and (header & TAG_MASK) != expected):
+                if expected is not None and not quiet:
+                    print("--- stream discontinuity ---")
+                expected = None
+                window.pop(0)
+                continue
+            length = RECORD_WORDS + ((header >> 24) & 0xF)
+            if expected is None:
+                # Not synchronized yet: confirm with the header of the following record.
+                if len(window) <= length:
+                    break
+                following = window[length]
+                if not is_header(following) or (following & TAG_MASK) != ((header + length) & TAG_MASK):
+                    window.pop(0)
+                    continue
+            elif len(window) < length:
+                break
+            yield header & TAG_MASK, window[1], window[2], window[RECORD_WORDS:length]
+            expected = (header + length) & TAG_MASK
+            del window[:length]
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("elf", help="ELF file of the firmware")
+    parser.add_argument("file", nargs="?", help="capture file, - for stdin")
+    parser.add_argument("--serial", help="serial port to read live records from")
+    parser.add_argument("--baud", type=int, default=115200, help="serial port baud rate")
+    parser.add_argument("--clock", type=float, default=0.0, help="timestamp clock in Hz, to print times in us")
+    args = parser.parse_args()
+
+    elf = Elf(args.elf)
+    if args.serial:
+        import serial
+
+        stream = serial.Serial(args.serial, args.baud)
+    elif args.file and "-" != args.file:
+        stream = open(args.file, "rb")
+    else:
+        stream = sys.stdin.buffer
+
+    previous = None
+    for tag, fmt_id, timestamp, values in read_records(align_stream(stream)):
+        delta = 0 if previous is None else (timestamp - previous) % (1 << 32)
+        previous = timestamp
+        if args.clock:
+            stamp = "%12.3f %+10.3f" % (timestamp * 1e6 / args.clock, delta * 1e6 / args.clock)
+        else:
+            stamp = "%12u %+10u" % (timestamp, delta)
+        if FMT_ID_DROPPED == fmt_id:
+            print("%s  --- %u records dropped ---" % (stamp, values[0] if values else 0))
+            continue
+        fmt = elf.format_string(fmt_id)
+        if fmt is None:
+            print("%s  <unknown format 0x%08x> %s" % (stamp, fmt_id, " ".join("0x%08x" % v for v in values)))
+        else:
+            print("%s  %s" % (stamp, format_record(elf, fmt, values).rstrip("\n")), flush=True)
+
+
+if __name__ == "__main__":
+    main()
@@ -282,14 +282,62 @@
 #define BLE_ABS_TIMER_DEFAULT_TIMEOUT_MS                       (1000)
 #define BLE_ABS_TIMER_METRIC_PREFIX                            (1000)
 
+/** Marks the unused end of the notification queue before a value that was wrapped to its start. */
+#define BLE_ABS_NOTIFICATION_WRAP                              (0xFFFFU)
+
+/** Link layer figures used to estimate the link throughput. */
+#define BLE_ABS_THROUGHPUT_T_IFS_US                            (150U)
+#define BLE_ABS_THROUGHPUT_PDU_OVERHEAD                        (9U) /* Access address, header and CRC. */
+#define BLE_ABS_THROUGHPUT_L2CAP_HEADER                        (4U)
+#define BLE_ABS_THROUGHPUT_ATT_HEADER                          (3U)
+#define BLE_ABS_THROUGHPUT_DEFAULT_TX_OCTETS                   (27U)
+#define BLE_ABS_THROUGHPUT_MIN_TX_OCTETS                       (0x1BU)
+#define BLE_ABS_THROUGHPUT_MAX_TX_OCTETS                       (0xFBU)
+#define BLE_ABS_THROUGHPUT_CONN_INTV_US                        (1250U)
+
 /***********************************************************************************************************************
  * Local Typedef definitions
  **********************************************************************************************************************/
 
+/** Header of a value in the notification queue, followed by the value padded to 2 bytes. */
+typedef struct st_ble_abs_notification_entry
+{
+    uint16_t conn_hdl;                 ///< Connection handle, or BLE_ABS_NOTIFICATION_WRAP.
+    uint16_t attr_hdl;                 ///< Attribute handle.
+    uint16_t value_len;                ///< Value length.
+    uint16_t stream;                   ///< Non-zero if the value may be packed with neighbouring values.
+} ble_abs_notification_entry_t;
+
+/** Tuning procedures of the throughput profile, run in this order. */
+typedef enum e_ble_abs_throughput_step
+{
+    BLE_ABS_THROUGHPUT_STEP_START = 0, ///< Link established.
+    BLE_ABS_THROUGHPUT_STEP_PHY   = 1, ///< Waiting for the PHY update.
+    BLE_ABS_THROUGHPUT_STEP_DLE   = 2, ///< Waiting for the data length update request to complete.
+    BLE_ABS_THROUGHPUT_STEP_CONN  = 3, ///< Waiting for the connection parameter update.
+    BLE_ABS_THROUGHPUT_STEP_DONE  = 4, ///< All procedures completed or the link is not tuned.
+} ble_abs_throughput_step_t;
+
 /***********************************************************************************************************************
  * Private global variables and functions
  **********************************************************************************************************************/
 static fsp_err_t ble_abs_set_pairing_parameter(ble_abs_pairing_parameter_t * p_pairing_parameter);
+static ble_abs_notification_entry_t * ble_abs_notification_peek(ble_abs_instance_ctrl_t * const p_instance_ctrl,
+                                                                uint32_t                      * p_offset,
+                                                                uint32_t                      * p_used);
+static void ble_abs_notification_flush(ble_abs_instance_ctrl_t * const p_instance_ctrl);
+static void ble_abs_notification_event(ble_abs_instance_ctrl_t * const p_instance_ctrl,
+                                       ble_abs_notification_event_t    event,
+                                       ble_abs_notification_entry_t  * p_entry);
+static ble_abs_throughput_link_t * ble_abs_throughput_link_get(ble_abs_instance_ctrl_t * const p_instance_ctrl,
+                                                               uint16_t                        conn_hdl);
+static uint32_t ble_abs_throughput_estimate(ble_abs_throughput_link_t const * p_link, uint16_t mtu);
+static void     ble_abs_throughput_next(ble_abs_instance_ctrl_t * const p_instance_ctrl,
+                                        ble_abs_throughput_link_t     * p_link);
+static void ble_abs_throughput_handler(ble_abs_instance_ctrl_t * const p_instance_ctrl,
+                                       uint16_t                        event_type,
+                                       ble_status_t                    event_result,
+                                       st_ble_evt_data_t             * p_event_data);
 static fsp_err_t ble_abs_convert_legacy_advertising_parameter(
     ble_abs_legacy_advertising_parameter_t * p_legacy_advertising_parameter,
     st_ble_gap_adv_param_t                 * p_gap_advertising_parameter);
@@ -558,6 +606,13 @@ fsp_err_t RM_BLE_ABS_Open (ble_abs_ctrl_t * const p_ctrl, ble_abs_cfg_t const *
     (*p_instance_ctrl).privacy_mode                 = BLE_GAP_NET_PRIV_MODE;
     (*p_instance_ctrl).set_privacy_status           = 0;
     (*p_instance_ctrl).p_cfg = p_cfg;
+    (*p_instance_ctrl).p_notification_cfg = NULL;
+    (*p_instance_ctrl).p_throughput_cfg   = NULL;
+
+    for (uint32_t i = 0U; i < BLE_ABS_THROUGHPUT_LINK_MAX; i++)
+    {
+        p_instance_ctrl->throughput_links[i].conn_hdl = BLE_GAP_INVALID_CONN_HDL;
+    }
 
     R_BLE_Open();
 
@@ -1360,10 +1415,639 @@ fsp_err_t RM_BLE_ABS_StartAuthentication (ble_abs_ctrl_t * const p_ctrl, uint16_
     return FSP_SUCCESS;
 }                                      /* End of function RM_BLE_ABS_StartAuthentication() */
 
+/*******************************************************************************************************************//**
+ * Start the notification queue. Values passed to RM_BLE_ABS_NotificationSend() are copied into the queue and sent
+ * with R_BLE_GATTS_Notification() as long as the host stack has transmit buffers, so the controller always holds
+ * several packets and sends them in the same connection event. Consecutive stream values of the same attribute are
+ * packed into one notification of up to the negotiated ATT_MTU minus 3 bytes.
+ *
+ * The queue is drained when the BLE_VS_EVENT_TX_FLOW_STATE_CHG event reports free transmit buffers, so the TxFlow
+ * event notification is started by this function.
+ *
+ * @retval FSP_SUCCESS                                 Operation succeeded.
+ * @retval FSP_ERR_ASSERTION                           p_ctrl or p_queue_cfg is specified as NULL.
+ * @retval FSP_ERR_NOT_OPEN                            Control block not open.
+ * @retval FSP_ERR_ALREADY_OPEN                        The notification queue is already open.
+ * @retval FSP_ERR_INVALID_ARGUMENT                    The queue buffer is misaligned or too small for one value.
+ **********************************************************************************************************************/
+fsp_err_t RM_BLE_ABS_NotificationQueueOpen (ble_abs_ctrl_t * const                         p_ctrl,
+                                            ble_abs_notification_queue_cfg_t const * const p_queue_cfg)
+{
+    ble_abs_instance_ctrl_t * p_instance_ctrl = (ble_abs_instance_ctrl_t *) p_ctrl;
+
+#if BLE_ABS_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(p_instance_ctrl);
+    FSP_ASSERT(p_queue_cfg);
+    FSP_ASSERT(p_queue_cfg->p_buffer);
+    FSP_ERROR_RETURN(BLE_ABS_OPEN == p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
+    FSP_ERROR_RETURN(NULL == p_instance_ctrl->p_notification_cfg, FSP_ERR_ALREADY_OPEN);
+    FSP_ERROR_RETURN((0U == ((uint32_t) p_queue_cfg->p_buffer & 1U)) && (0U == (p_queue_cfg->buffer_size & 1U)) &&
+                     (p_queue_cfg->buffer_size >= (sizeof(ble_abs_notification_entry_t) + 2U)),
+                     FSP_ERR_INVALID_ARGUMENT);
+#endif
+
+    p_instance_ctrl->notification_head     = 0U;
+    p_instance_ctrl->notification_tail     = 0U;
+    p_instance_ctrl->notification_used     = 0U;
+    p_instance_ctrl->notification_blocked  = false;
+    p_instance_ctrl->notification_flow_off = false;
+    p_instance_ctrl->p_notification_cfg    = p_queue_cfg;
+
+    R_BLE_VS_StartTxFlowEvtNtf();
+
+    return FSP_SUCCESS;
+}                                      /* End of function RM_BLE_ABS_NotificationQueueOpen() */
+
+/*******************************************************************************************************************//**
+ * Queue a notification and send queued notifications while the host stack has transmit buffers.
+ * Set stream to true for values of a data stream that may be concatenated with the previous and next value of the same
+ * attribute into one notification, for example sensor samples.
+ *
+ * A full queue is not an error of the connection: the value is refused with FSP_ERR_BLE_ABS_NOT_FOUND and
+ * BLE_ABS_NOTIFICATION_EVENT_READY is reported once low_water_mark bytes are free again. p_free_bytes can be used
+ * to throttle the producer before the queue fills up.
+ *
+ * @retval FSP_SUCCESS                                 The value was queued.
+ * @retval FSP_ERR_ASSERTION                           p_ctrl, p_ntf_data or its value is specified as NULL.
+ * @retval FSP_ERR_NOT_OPEN                            Control block or notification queue not open.
+ * @retval FSP_ERR_INVALID_ARGUMENT                    The value is empty or longer than
+ *                                                     BLE_ABS_NOTIFICATION_VALUE_MAX.
+ * @retval FSP_ERR_BLE_ABS_NOT_FOUND                   No free space in the queue, wait for
+ *                                                     BLE_ABS_NOTIFICATION_EVENT_READY.
+ **********************************************************************************************************************/
+fsp_err_t RM_BLE_ABS_NotificationSend (ble_abs_ctrl_t * const                     p_ctrl,
+                                       uint16_t                                   conn_hdl,
+                                       st_ble_gatt_hdl_value_pair_t const * const p_ntf_data,
+                                       bool                                       stream,
+                                       uint32_t * const                           p_free_bytes)
+{
+    ble_abs_instance_ctrl_t * p_instance_ctrl = (ble_abs_instance_ctrl_t *) p_ctrl;
+
+#if BLE_ABS_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(p_instance_ctrl);
+    FSP_ASSERT(p_ntf_data);
+    FSP_ASSERT(p_ntf_data->value.p_value);
+    FSP_ERROR_RETURN(BLE_ABS_OPEN == p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
+    FSP_ERROR_RETURN(NULL != p_instance_ctrl->p_notification_cfg, FSP_ERR_NOT_OPEN);
+    FSP_ERROR_RETURN((0U != p_ntf_data->value.value_len) &&
+                     (p_ntf_data->value.value_len <= BLE_ABS_NOTIFICATION_VALUE_MAX),
+                     FSP_ERR_INVALID_ARGUMENT);
+#endif
+
+    ble_abs_notification_queue_cfg_t const * p_queue_cfg = p_instance_ctrl->p_notification_cfg;
+    uint32_t size = sizeof(ble_abs_notification_entry_t) + ((p_ntf_data->value.value_len + 1U) & ~1U);
+    uint32_t tail = p_instance_ctrl->notification_tail;
+    uint32_t head = p_instance_ctrl->notification_head;
+    uint32_t wrap = 0U;
+
+    /* Values are stored contiguously. If the end of the buffer is too short the value is wrapped to the start. */
+    bool fits;
+    if ((0U == p_instance_ctrl->notification_used) || (tail > head))
+    {
+        uint32_t end = p_queue_cfg->buffer_size - tail;
+        fits = (end >= size);
+        if (!fits && (head >= size))
+        {
+            fits = true;
+            wrap = end;
+        }
+    }
+    else
+    {
+        fits = ((head - tail) >= size);
+    }
+
+    if (!fits)
+    {
+        p_instance_ctrl->notification_blocked = true;
+    }
+    else
+    {
+        if (0U != wrap)
+        {
+            if (wrap >= sizeof(ble_abs_notification_entry_t))
+            {
+                ((ble_abs_notification_entry_t *) &p_queue_cfg->p_buffer[tail])->conn_hdl = BLE_ABS_NOTIFICATION_WRAP;
+            }
+
+            p_instance_ctrl->notification_used += wrap;
+            tail = 0U;
+        }
+
+        ble_abs_notification_entry_t * p_entry = (ble_abs_notification_entry_t *) &p_queue_cfg->p_buffer[tail];
+        p_entry->conn_hdl  = conn_hdl;
+        p_entry->attr_hdl  = p_ntf_data->attr_hdl;
+        p_entry->value_len = p_ntf_data->value.value_len;
+        p_entry->stream    = stream ? 1U : 0U;
+        memcpy(p_entry + 1, p_ntf_data->value.p_value, p_ntf_data->value.value_len);
+
+        tail += size;
+        p_instance_ctrl->notification_tail  = (tail == p_queue_cfg->buffer_size) ? 0U : tail;
+        p_instance_ctrl->notification_used += size;
+    }
+
+    ble_abs_notification_flush(p_instance_ctrl);
+
+    if (NULL != p_free_bytes)
+    {
+        *p_free_bytes = p_queue_cfg->buffer_size - p_instance_ctrl->notification_used;
+    }
+
+    FSP_ERROR_RETURN(fits, FSP_ERR_BLE_ABS_NOT_FOUND);
+
+    return FSP_SUCCESS;
+}                                      /* End of function RM_BLE_ABS_NotificationSend() */
+
+/*******************************************************************************************************************//**
+ * Send queued notifications while the host stack has transmit buffers. The queue is also drained by
+ * RM_BLE_ABS_NotificationSend() and when transmit buffers become free, so this is only needed to retry after a host
+ * stack request failed without a TxFlow event.
+ *
+ * @retval FSP_SUCCESS                                 Operation succeeded.
+ * @retval FSP_ERR_ASSERTION                           p_ctrl is specified as NULL.
+ * @retval FSP_ERR_NOT_OPEN                            Control block or notification queue not open.
+ **********************************************************************************************************************/
+fsp_err_t RM_BLE_ABS_NotificationFlush (ble_abs_ctrl_t * const p_ctrl)
+{
+    ble_abs_instance_ctrl_t * p_instance_ctrl = (ble_abs_instance_ctrl_t *) p_ctrl;
+
+#if BLE_ABS_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(p_instance_ctrl);
+    FSP_ERROR_RETURN(BLE_ABS_OPEN == p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
+    FSP_ERROR_RETURN(NULL != p_instance_ctrl->p_notification_cfg, FSP_ERR_NOT_OPEN);
+#endif
+
+    p_instance_ctrl->notification_flow_off = false;
+    ble_abs_notification_flush(p_instance_ctrl);
+
+    return FSP_SUCCESS;
+}                                      /* End of function RM_BLE_ABS_NotificationFlush() */
+
+/*******************************************************************************************************************//**
+ * Stop the notification queue and discard the values that were not sent.
+ *
+ * @retval FSP_SUCCESS                                 Operation succeeded.
+ * @retval FSP_ERR_ASSERTION                           p_ctrl is specified as NULL.
+ * @retval FSP_ERR_NOT_OPEN                            Control block or notification queue not open.
+ **********************************************************************************************************************/
+fsp_err_t RM_BLE_ABS_NotificationQueueClose (ble_abs_ctrl_t * const p_ctrl)
+{
+    ble_abs_instance_ctrl_t * p_instance_ctrl = (ble_abs_instance_ctrl_t *) p_ctrl;
+
+#if BLE_ABS_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(p_instance_ctrl);
+    FSP_ERROR_RETURN(BLE_ABS_OPEN == p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
+    FSP_ERROR_RETURN(NULL != p_instance_ctrl->p_notification_cfg, FSP_ERR_NOT_OPEN);
+#endif
+
+    R_BLE_VS_StopTxFlowEvtNtf();
+
+    p_instance_ctrl->p_notification_cfg = NULL;
+    p_instance_ctrl->notification_used  = 0U;
+
+    return FSP_SUCCESS;
+}                                      /* End of function RM_BLE_ABS_NotificationQueueClose() */
+
+/*******************************************************************************************************************//**
+ * Set the throughput profile applied to links established afterwards. When a link is established, the PHY update
+ * (R_BLE_GAP_SetPhy()), data length update (R_BLE_GAP_SetDataLen()) and connection parameter update
+ * (R_BLE_GAP_UpdConn()) procedures are run one after another, and the profile callback reports the resulting link
+ * parameters and estimated throughput. A procedure is skipped when its profile field is 0 or the request fails.
+ * The ATT_MTU exchange is left to the GATT client. Pass NULL to stop tuning new links.
+ *
+ * @retval FSP_SUCCESS                                 Operation succeeded.
+ * @retval FSP_ERR_ASSERTION                           p_ctrl is specified as NULL.
+ * @retval FSP_ERR_NOT_OPEN                            Control block not open.
+ * @retval FSP_ERR_INVALID_ARGUMENT                    tx_octets or the connection interval range is out of range.
+ **********************************************************************************************************************/
+fsp_err_t RM_BLE_ABS_ThroughputProfileSet (ble_abs_ctrl_t * const                 p_ctrl,
+                                           ble_abs_throughput_cfg_t const * const p_throughput_cfg)
+{
+    ble_abs_instance_ctrl_t * p_instance_ctrl = (ble_abs_instance_ctrl_t *) p_ctrl;
+
+#if BLE_ABS_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(p_instance_ctrl);
+    FSP_ERROR_RETURN(BLE_ABS_OPEN == p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
+    if (NULL != p_throughput_cfg)
+    {
+        FSP_ERROR_RETURN((0U == p_throughput_cfg->tx_octets) ||
+                         ((BLE_ABS_THROUGHPUT_MIN_TX_OCTETS <= p_throughput_cfg->tx_octets) &&
+                          (BLE_ABS_THROUGHPUT_MAX_TX_OCTETS >= p_throughput_cfg->tx_octets)),
+                         FSP_ERR_INVALID_ARGUMENT);
+        FSP_ERROR_RETURN((0U == p_throughput_cfg->conn_intv_min) ||
+                         (p_throughput_cfg->conn_intv_min <= p_throughput_cfg->conn_intv_max),
+                         FSP_ERR_INVALID_ARGUMENT);
+    }
+#endif
+
+    p_instance_ctrl->p_throughput_cfg = p_throughput_cfg;
+
+    return FSP_SUCCESS;
+}                                      /* End of function RM_BLE_ABS_ThroughputProfileSet() */
+
+/*******************************************************************************************************************//**
+ * Get the estimated notification throughput of a link from its current PHY, transmission packet size, connection
+ * interval and ATT_MTU. The estimate assumes the controller fills each connection event with data packets, each
+ * acknowledged by an empty packet, so it is an upper bound of what the link can carry.
+ *
+ * @retval FSP_SUCCESS                                 Operation succeeded.
+ * @retval FSP_ERR_ASSERTION                           p_ctrl or p_throughput_bps is specified as NULL.
+ * @retval FSP_ERR_NOT_OPEN                            Control block not open.
+ * @retval FSP_ERR_BLE_ABS_NOT_FOUND                   No link with conn_hdl is tracked.
+ **********************************************************************************************************************/
+fsp_err_t RM_BLE_ABS_ThroughputGet (ble_abs_ctrl_t * const p_ctrl, uint16_t conn_hdl, uint32_t * const p_throughput_bps)
+{
+    ble_abs_instance_ctrl_t * p_instance_ctrl = (ble_abs_instance_ctrl_t *) p_ctrl;
+
+#if BLE_ABS_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(p_instance_ctrl);
+    FSP_ASSERT(p_throughput_bps);
+    FSP_ERROR_RETURN(BLE_ABS_OPEN == p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+
+    ble_abs_throughput_link_t * p_link = ble_abs_throughput_link_get(p_instance_ctrl, conn_hdl);
+    FSP_ERROR_RETURN(NULL != p_link, FSP_ERR_BLE_ABS_NOT_FOUND);
+
+    uint16_t mtu = BLE_GATT_DEFAULT_MTU;
+    R_BLE_GATT_GetMtu(conn_hdl, &mtu);
+
+    *p_throughput_bps = ble_abs_throughput_estimate(p_link, mtu);
+
+    return FSP_SUCCESS;
+}                                      /* End of function RM_BLE_ABS_ThroughputGet() */
+
 /************************************************
  *   static function definitions                *
  ***********************************************/
 
+/*******************************************************************************************************************//**
+ * Get the queued value at an offset of the notification queue, skipping the padding before a wrapped value.
+ *
+ * @param[in]     p_instance_ctrl  Pointer to the control structure.
+ * @param[in,out] p_offset         Offset of the value, updated if it was wrapped.
+ * @param[in,out] p_used           Queued bytes from the offset on, reduced by the skipped padding.
+ *
+ * @return Queued value, or NULL if no value is left.
+ **********************************************************************************************************************/
+static ble_abs_notification_entry_t * ble_abs_notification_peek (ble_abs_instance_ctrl_t * const p_instance_ctrl,
+                                                                 uint32_t                      * p_offset,
+                                                                 uint32_t                      * p_used)
+{
+    ble_abs_notification_queue_cfg_t const * p_queue_cfg = p_instance_ctrl->p_notification_cfg;
+
+    if (0U == *p_used)
+    {
+        return NULL;
+    }
+
+    uint32_t end = p_queue_cfg->buffer_size - *p_offset;
+    if ((end < sizeof(ble_abs_notification_entry_t)) ||
+        (BLE_ABS_NOTIFICATION_WRAP == ((ble_abs_notification_entry_t *) &p_queue_cfg->p_buffer[*p_offset])->conn_hdl))
+    {
+        *p_used  -= end;
+        *p_offset = 0U;
+    }
+
+    return (ble_abs_notification_entry_t *) &p_queue_cfg->p_buffer[*p_offset];
+}                                      /* End of function ble_abs_notification_peek() */
+
+/*******************************************************************************************************************//**
+ * Send queued values until the queue is empty or the host stack runs out of transmit buffers.
+ **********************************************************************************************************************/
+static void ble_abs_notification_flush (ble_abs_instance_ctrl_t * const p_instance_ctrl)
+{
+    ble_abs_notification_queue_cfg_t const * p_queue_cfg = p_instance_ctrl->p_notification_cfg;
+
+    while (!p_instance_ctrl->notification_flow_off)
+    {
+        uint32_t                       offset  = p_instance_ctrl->notification_head;
+        uint32_t                       used    = p_instance_ctrl->notification_used;
+        ble_abs_notification_entry_t * p_entry = ble_abs_notification_peek(p_instance_ctrl, &offset, &used);
+        if (NULL == p_entry)
+        {
+            break;
+        }
+
+        st_ble_gatt_hdl_value_pair_t ntf_data;
+        ntf_data.attr_hdl        = p_entry->attr_hdl;
+        ntf_data.value.value_len = p_entry->value_len;
+        ntf_data.value.p_value   = (uint8_t *) (p_entry + 1);
+
+        uint32_t size = sizeof(ble_abs_notification_entry_t) + ((p_entry->value_len + 1U) & ~1U);
+        offset += size;
+        used   -= size;
+
+        if (0U != p_entry->stream)
+        {
+            uint16_t mtu = BLE_GATT_DEFAULT_MTU;
+            (void) R_BLE_GATT_GetMtu(p_entry->conn_hdl, &mtu);
+            uint32_t value_max = ((uint32_t) mtu - 3U < BLE_ABS_NOTIFICATION_VALUE_MAX) ?
+                                 ((uint32_t) mtu - 3U) : BLE_ABS_NOTIFICATION_VALUE_MAX;
+
+            /* Pack the following stream values of the same attribute while they fit in one notification. */
+            ble_abs_notification_entry_t * p_next = ble_abs_notification_peek(p_instance_ctrl, &offset, &used);
+            if ((NULL != p_next) && (0U != p_next->stream) && (p_next->conn_hdl == p_entry->conn_hdl) &&
+                (p_next->attr_hdl == p_entry->attr_hdl) &&
+                ((uint32_t) p_entry->value_len + p_next->value_len <= value_max))
+            {
+                memcpy(p_instance_ctrl->notification_value, p_entry + 1, p_entry->value_len);
+                ntf_data.value.p_value = p_instance_ctrl->notification_value;
+
+                while ((NULL != p_next) && (0U != p_next->stream) && (p_next->conn_hdl == p_entry->conn_hdl) &&
+                       (p_next->attr_hdl == p_entry->attr_hdl) &&
+                       ((uint32_t) ntf_data.value.value_len + p_next->value_len <= value_max))
+                {
+                    memcpy(&p_instance_ctrl->notification_value[ntf_data.value.value_len],
+                           p_next + 1,
+                           p_next->value_len);
+                    ntf_data.value.value_len = (uint16_t) (ntf_data.value.value_len + p_next->value_len);
+
+                    size    = sizeof(ble_abs_notification_entry_t) + ((p_next->value_len + 1U) & ~1U);
+                    offset += size;
+                    used   -= size;
+                    p_next  = ble_abs_notification_peek(p_instance_ctrl, &offset, &used);
+                }
+            }
+        }
+
+        ble_status_t status = R_BLE_GATTS_Notification(p_entry->conn_hdl, &ntf_data);
+        if (BLE_ERR_MEM_ALLOC_FAILED == status)
+        {
+            /* Retried when the TxFlow event reports free transmit buffers. */
+            break;
+        }
+
+        if (BLE_SUCCESS != status)
+        {
+            ble_abs_notification_event(p_instance_ctrl, BLE_ABS_NOTIFICATION_EVENT_DROPPED, p_entry);
+        }
+
+        p_instance_ctrl->notification_head = (offset == p_queue_cfg->buffer_size) ? 0U : offset;
+        p_instance_ctrl->notification_used = used;
+    }
+
+    if (0U == p_instance_ctrl->notification_used)
+    {
+        p_instance_ctrl->notification_head = 0U;
+        p_instance_ctrl->notification_tail = 0U;
+    }
+
+    if (p_instance_ctrl->notification_blocked &&
+        ((p_queue_cfg->buffer_size - p_instance_ctrl->notification_used) >= p_queue_cfg->low_water_mark))
+    {
+        p_instance_ctrl->notification_blocked = false;
+        ble_abs_notification_event(p_instance_ctrl, BLE_ABS_NOTIFICATION_EVENT_READY, NULL);
+    }
+}                                      /* End of function ble_abs_notification_flush() */
+
+/*******************************************************************************************************************//**
+ * Report a notification queue event to the queue callback.
+ **********************************************************************************************************************/
+static void ble_abs_notification_event (ble_abs_instance_ctrl_t * const p_instance_ctrl,
+                                        ble_abs_notification_event_t    event,
+                                        ble_abs_notification_entry_t  * p_entry)
+{
+    ble_abs_notification_queue_cfg_t const * p_queue_cfg = p_instance_ctrl->p_notification_cfg;
+
+    if (NULL != p_queue_cfg->p_callback)
+    {
+        ble_abs_notification_callback_args_t args;
+
+        args.event      = event;
+        args.conn_hdl   = (NULL != p_entry) ? p_entry->conn_hdl : BLE_GAP_INVALID_CONN_HDL;
+        args.attr_hdl   = (NULL != p_entry) ? p_entry->attr_hdl : 0U;
+        args.free_bytes = p_queue_cfg->buffer_size - p_instance_ctrl->notification_used;
+        args.p_context  = p_queue_cfg->p_context;
+        p_queue_cfg->p_callback(&args);
+    }
+}                                      /* End of function ble_abs_notification_event() */
+
+/*******************************************************************************************************************//**
+ * Find the throughput profile state of a link.
+ **********************************************************************************************************************/
+static ble_abs_throughput_link_t * ble_abs_throughput_link_get (ble_abs_instance_ctrl_t * const p_instance_ctrl,
+                                                                uint16_t                        conn_hdl)
+{
+    for (uint32_t i = 0U; i < BLE_ABS_THROUGHPUT_LINK_MAX; i++)
+    {
+        if (conn_hdl == p_instance_ctrl->throughput_links[i].conn_hdl)
+        {
+            return &p_instance_ctrl->throughput_links[i];
+        }
+    }
+
+    return NULL;
+}                                      /* End of function ble_abs_throughput_link_get() */
+
+/*******************************************************************************************************************//**
+ * Estimate the notification throughput of a link in bits per second.
+ **********************************************************************************************************************/
+static uint32_t ble_abs_throughput_estimate (ble_abs_throughput_link_t const * p_link, uint16_t mtu)
+{
+    /* Bit time in ns and preamble length of 1M, 2M and Coded (S=8) PHY. */
+    uint32_t bit_ns   = 1000U;
+    uint32_t preamble = 1U;
+    if (BLE_GAP_SET_PHYS_HOST_PREF_2M == p_link->tx_phy)
+    {
+        bit_ns   = 500U;
+        preamble = 2U;
+    }
+    else if (BLE_GAP_SET_PHYS_HOST_PREF_2M < p_link->tx_phy)
+    {
+        bit_ns = 8000U;
+    }
+
+    /* One data packet, acknowledged by an empty packet. */
+    uint32_t data_us  = ((preamble + BLE_ABS_THROUGHPUT_PDU_OVERHEAD + p_link->tx_octets) * 8U * bit_ns) / 1000U;
+    uint32_t empty_us = ((preamble + BLE_ABS_THROUGHPUT_PDU_OVERHEAD) * 8U * bit_ns) / 1000U;
+    uint32_t cycle_us = data_us + BLE_ABS_THROUGHPUT_T_IFS_US + empty_us + BLE_ABS_THROUGHPUT_T_IFS_US;
+
+    uint32_t interval_us = (uint32_t) p_link->conn_intv * BLE_ABS_THROUGHPUT_CONN_INTV_US;
+    uint32_t packets     = interval_us / cycle_us;
+    if (0U == packets)
+    {
+        packets = 1U;
+    }
+
+    /* Each notification carries ATT_MTU - 3 bytes and is fragmented into packets with its L2CAP header. */
+    uint32_t packets_per_value = (mtu + BLE_ABS_THROUGHPUT_L2CAP_HEADER + p_link->tx_octets - 1U) /
+                                 p_link->tx_octets;
+    uint64_t bits = ((uint64_t) packets * (mtu - BLE_ABS_THROUGHPUT_ATT_HEADER) * 8U) / packets_per_value;
+
+    return (0U != interval_us) ? (uint32_t) ((bits * 1000000U) / interval_us) : 0U;
+}                                      /* End of function ble_abs_throughput_estimate() */
+
+/*******************************************************************************************************************//**
+ * Start the next tuning procedure of a link, skipping the procedures that are disabled or cannot be requested, and
+ * report the result to the profile callback when all procedures have completed.
+ **********************************************************************************************************************/
+static void ble_abs_throughput_next (ble_abs_instance_ctrl_t * const p_instance_ctrl,
+                                     ble_abs_throughput_link_t     * p_link)
+{
+    ble_abs_throughput_cfg_t const * p_throughput_cfg = p_instance_ctrl->p_throughput_cfg;
+    ble_status_t                     retval           = BLE_ERR_UNSUPPORTED;
+
+    if (NULL == p_throughput_cfg)
+    {
+        p_link->step = BLE_ABS_THROUGHPUT_STEP_DONE;
+
+        return;
+    }
+
+    while ((BLE_SUCCESS != retval) && (BLE_ABS_THROUGHPUT_STEP_DONE != p_link->step))
+    {
+        p_link->step++;
+
+        if ((BLE_ABS_THROUGHPUT_STEP_PHY == p_link->step) && (0U != p_throughput_cfg->phys))
+        {
+            st_ble_gap_set_phy_param_t phy_param =
+            {
+                .tx_phys     = p_throughput_cfg->phys,
+                .rx_phys     = p_throughput_cfg->phys,
+                .phy_options = BLE_GAP_SET_PHYS_OP_HOST_NO_PREF,
+            };
+            retval = R_BLE_GAP_SetPhy(p_link->conn_hdl, &phy_param);
+        }
+        else if ((BLE_ABS_THROUGHPUT_STEP_DLE == p_link->step) && (0U != p_throughput_cfg->tx_octets))
+        {
+            retval = R_BLE_GAP_SetDataLen(p_link->conn_hdl, p_throughput_cfg->tx_octets, p_throughput_cfg->tx_time);
+        }
+        else if ((BLE_ABS_THROUGHPUT_STEP_CONN == p_link->step) && (0U != p_throughput_cfg->conn_intv_max))
+        {
+            st_ble_gap_conn_param_t conn_param =
+            {
+                .conn_intv_min = p_throughput_cfg->conn_intv_min,
+                .conn_intv_max = p_throughput_cfg->conn_intv_max,
+                .conn_latency  = p_throughput_cfg->conn_latency,
+                .sup_to        = p_throughput_cfg->sup_to,
+                .min_ce_length = BLE_ABS_GAP_CONNECTION_CE_LENGTH,
+                .max_ce_length = BLE_ABS_GAP_CONNECTION_CE_LENGTH,
+            };
+            retval = R_BLE_GAP_UpdConn(p_link->conn_hdl, BLE_GAP_CONN_UPD_MODE_REQ, BLE_GAP_CONN_UPD_ACCEPT,
+                                       &conn_param);
+        }
+        else
+        {
+            /* Procedure disabled by the profile. */
+        }
+    }
+
+    if ((BLE_ABS_THROUGHPUT_STEP_DONE == p_link->step) && (NULL != p_throughput_cfg->p_callback))
+    {
+        ble_abs_throughput_callback_args_t args;
+        uint16_t mtu = BLE_GATT_DEFAULT_MTU;
+
+        R_BLE_GATT_GetMtu(p_link->conn_hdl, &mtu);
+
+        args.conn_hdl       = p_link->conn_hdl;
+        args.tx_phy         = p_link->tx_phy;
+        args.tx_octets      = p_link->tx_octets;
+        args.conn_intv      = p_link->conn_intv;
+        args.mtu            = mtu;
+        args.throughput_bps = ble_abs_throughput_estimate(p_link, mtu);
+        args.p_context      = p_throughput_cfg->p_context;
+        p_throughput_cfg->p_callback(&args);
+    }
+}                                      /* End of function ble_abs_throughput_next() */
+
+/*******************************************************************************************************************//**
+ * Track the link parameters and advance the throughput profile on GAP events.
+ **********************************************************************************************************************/
+static void ble_abs_throughput_handler (ble_abs_instance_ctrl_t * const p_instance_ctrl,
+                                        uint16_t                        event_type,
+                                        ble_status_t                    event_result,
+                                        st_ble_evt_data_t             * p_event_data)
+{
+    /* Every event handled here starts with the connection handle. */
+    uint16_t                    conn_hdl = ((st_ble_gap_conn_hdl_evt_t *) p_event_data->p_param)->conn_hdl;
+    ble_abs_throughput_link_t * p_link;
+
+    if (BLE_GAP_EVENT_CONN_IND == event_type)
+    {
+        p_link = ble_abs_throughput_link_get(p_instance_ctrl, BLE_GAP_INVALID_CONN_HDL);
+        if ((BLE_SUCCESS == event_result) && (NULL != p_link))
+        {
+            p_link->conn_hdl  = conn_hdl;
+            p_link->step      = BLE_ABS_THROUGHPUT_STEP_START;
+            p_link->tx_phy    = BLE_GAP_SET_PHYS_HOST_PREF_1M;
+            p_link->tx_octets = BLE_ABS_THROUGHPUT_DEFAULT_TX_OCTETS;
+            p_link->conn_intv = ((st_ble_gap_conn_evt_t *) p_event_data->p_param)->conn_intv;
+            ble_abs_throughput_next(p_instance_ctrl, p_link);
+        }
+
+        return;
+    }
+
+    p_link = ble_abs_throughput_link_get(p_instance_ctrl, conn_hdl);
+    if ((NULL == p_link) || (BLE_GAP_INVALID_CONN_HDL == conn_hdl))
+    {
+        return;
+    }
+
+    ble_abs_throughput_step_t completed = BLE_ABS_THROUGHPUT_STEP_DONE;
+
+    switch (event_type)
+    {
+        case BLE_GAP_EVENT_DISCONN_IND:
+        {
+            p_link->conn_hdl = BLE_GAP_INVALID_CONN_HDL;
+            break;
+        }
+
+        case BLE_GAP_EVENT_PHY_UPD:
+        {
+            /* The PHY may change the transmission packet size, so the data length update follows it. */
+            if (BLE_SUCCESS == event_result)
+            {
+                p_link->tx_phy = ((st_ble_gap_phy_upd_evt_t *) p_event_data->p_param)->tx_phy;
+            }
+
+            completed = BLE_ABS_THROUGHPUT_STEP_PHY;
+            break;
+        }
+
+        case BLE_GAP_EVENT_PHY_SET_COMP:
+        {
+            completed = (BLE_SUCCESS != event_result) ? BLE_ABS_THROUGHPUT_STEP_PHY : BLE_ABS_THROUGHPUT_STEP_DONE;
+            break;
+        }
+
+        case BLE_GAP_EVENT_DATA_LEN_CHG:
+        {
+            p_link->tx_octets = ((st_ble_gap_data_len_chg_evt_t *) p_event_data->p_param)->tx_octets;
+            break;
+        }
+
+        case BLE_GAP_EVENT_SET_DATA_LEN_COMP:
+        {
+            /* BLE_GAP_EVENT_DATA_LEN_CHG only follows when the length actually changes. */
+            completed = BLE_ABS_THROUGHPUT_STEP_DLE;
+            break;
+        }
+
+        case BLE_GAP_EVENT_CONN_PARAM_UPD_COMP:
+        {
+            if (BLE_SUCCESS == event_result)
+            {
+                p_link->conn_intv = ((st_ble_gap_conn_upd_evt_t *) p_event_data->p_param)->conn_intv;
+            }
+
+            completed = BLE_ABS_THROUGHPUT_STEP_CONN;
+            break;
+        }
+
+        default:
+        {
+            break;
+        }
+    }
+
+    if ((BLE_ABS_THROUGHPUT_STEP_DONE != completed) && (completed == p_link->step))
+    {
+        ble_abs_throughput_next(p_instance_ctrl, p_link);
+    }
+}                                      /* End of function ble_abs_throughput_handler() */
+
 /*******************************************************************************************************************//**
  * Set Abstraction API connection parameters to GAP connection parameters.
  **********************************************************************************************************************/
@@ -2934,6 +3618,18 @@ static void ble_abs_gap_callback (uint16_t event_type, ble_status_t event_result
         case BLE_GAP_EVENT_CONN_IND:
         {
             ble_abs_connection_indication_handler(p_instance_ctrl);
+            ble_abs_throughput_handler(p_instance_ctrl, event_type, event_result, p_event_data);
+            break;
+        }
+
+        case BLE_GAP_EVENT_DISCONN_IND:
+        case BLE_GAP_EVENT_PHY_UPD:
+        case BLE_GAP_EVENT_PHY_SET_COMP:
+        case BLE_GAP_EVENT_DATA_LEN_CHG:
+        case BLE_GAP_EVENT_SET_DATA_LEN_COMP:
+        case BLE_GAP_EVENT_CONN_PARAM_UPD_COMP:
+        {
+            ble_abs_throughput_handler(p_instance_ctrl, event_type, event_result, p_event_data);
             break;
         }
 
@@ -3069,6 +3765,20 @@ static void ble_abs_vendor_specific_callback (uint16_t               event_type,
             break;
         }
 
+        case BLE_VS_EVENT_TX_FLOW_STATE_CHG:
+        {
+            if (NULL != p_instance_ctrl->p_notification_cfg)
+            {
+                st_ble_vs_tx_flow_chg_evt_t * p_flow = (st_ble_vs_tx_flow_chg_evt_t *) p_event_data->p_param;
+
+                /* Stop handing notifications to the host stack at the low water mark and resume at the high one. */
+                p_instance_ctrl->notification_flow_off = (BLE_VS_TX_FLOW_CTL_OFF == p_flow->state);
+                ble_abs_notification_flush(p_instance_ctrl);
+            }
+
+            break;
+        }
+
         default:
         {
             break;
@@ -0,0 +1,416 @@
+/***********************************************************************************************************************
+ * Copyright [2020] Renesas Electronics Corporation and/or its affiliates.  All Rights Reserved.
+ *
+ * This software and documentation are supplied by Renesas Electronics America Inc. and may only be used with products
+ * of Renesas Electronics Corp. and its affiliates ("Renesas").  No other uses are authorized.  Renesas products are
+ * sold pursuant to Renesas terms and conditions of sale.  Purchasers are solely responsible for the selection and use
+ * of Renesas products and Renesas assumes no liability.  No license, express or implied, to any intellectual property
+ * right is granted by Renesas. This software is protected under all applicable laws, including copyright laws. Renesas
+ * reserves the right to change or discontinue this software and/or this documentation. THE SOFTWARE AND DOCUMENTATION
+ * IS DELIVERED TO YOU "AS IS," AND RENESAS MAKES NO REPRESENTATIONS OR WARRANTIES, AND TO THE FULLEST EXTENT
+ * PERMISSIBLE UNDER APPLICABLE LAW, DISCLAIMS ALL WARRANTIES, WHETHER EXPLICITLY OR IMPLICITLY, INCLUDING WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, AND NONINFRINGEMENT, WITH RESPECT TO THE SOFTWARE OR
+ * DOCUMENTATION.  RENESAS SHALL HAVE NO LIABILITY ARISING OUT OF ANY SECURITY VULNERABILITY OR BREACH.  TO THE MAXIMUM
+ * EXTENT PERMITTED BY LAW, IN NO EVENT WILL RENESAS BE LIABLE TO YOU IN CONNECTION WITH THE SOFTWARE OR DOCUMENTATION
+ * (OR ANY PERSON OR ENTITY CLAIMING RIGHTS DERIVED FROM YOU) FOR ANY LOSS, DAMAGES, OR CLAIMS WHATSOEVER, INCLUDING,
+ * WITHOUT LIMITATION, ANY DIRECT, CONSEQUENTIAL, SPECIAL, INDIRECT, PUNITIVE, OR INCIDENTAL DAMAGES; ANY LOST PROFITS,
+ * OTHER ECONOMIC DAMAGE, PROPERTY DAMAGE, OR PERSONAL INJURY; AND EVEN IF RENESAS HAS BEEN ADVISED OF THE POSSIBILITY
+ * OF SUCH LOSS, DAMAGES, CLAIMS OR COSTS.
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Includes
+ **********************************************************************************************************************/
+#include <string.h>
+#include "rm_block_media_cache.h"
+
+/***********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+#define RM_BLOCK_MEDIA_CACHE_PRV_MISS          (UINT32_MAX)
+#define RM_BLOCK_MEDIA_CACHE_PRV_SWAP_WORDS    (16U)
+
+/***********************************************************************************************************************
+ * Private function prototypes
+ **********************************************************************************************************************/
+static uint32_t  rm_block_media_cache_find(rm_block_media_cache_t * const p_cache, uint32_t sector);
+static void      rm_block_media_cache_swap(rm_block_media_cache_t * const p_cache, uint32_t a, uint32_t b);
+static fsp_err_t rm_block_media_cache_run_flush(rm_block_media_cache_t * const p_cache, uint32_t index);
+static fsp_err_t rm_block_media_cache_alloc(rm_block_media_cache_t * const p_cache, uint32_t * p_index);
+
+/***********************************************************************************************************************
+ * Functions
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * Sets up a sector cache. Called from the open function of a block media module.
+ *
+ * @param[out] p_cache                 Cache to set up
+ * @param[in]  p_ctrl                  Control block of the block media module, passed to p_transfer
+ * @param[in]  p_transfer              Reads or writes sectors of the device
+ * @param[in]  p_entries               Array of num_sectors entries
+ * @param[in]  p_buffer                num_sectors * sector size bytes, 4-byte aligned
+ * @param[in]  num_sectors             Number of sectors in the cache, 0 to disable the cache
+ **********************************************************************************************************************/
+void rm_block_media_cache_open (rm_block_media_cache_t * const       p_cache,
+                                rm_block_media_ctrl_t * const        p_ctrl,
+                                rm_block_media_cache_transfer_t      p_transfer,
+                                rm_block_media_cache_entry_t * const p_entries,
+                                uint8_t * const                      p_buffer,
+                                uint32_t                             num_sectors)
+{
+    p_cache->p_ctrl            = p_ctrl;
+    p_cache->p_transfer        = p_transfer;
+    p_cache->p_entries         = p_entries;
+    p_cache->p_buffer          = p_buffer;
+    p_cache->num_sectors       = num_sectors;
+    p_cache->sector_size_bytes = 0U;
+    p_cache->tick              = 0U;
+}
+
+/*******************************************************************************************************************//**
+ * Drops all cached sectors, including data not written yet. Called when the media is initialized, since cached
+ * sectors may belong to a different device.
+ *
+ * @param[in]  p_cache                 Cache
+ * @param[in]  sector_size_bytes       Sector size of the device
+ **********************************************************************************************************************/
+void rm_block_media_cache_invalidate (rm_block_media_cache_t * const p_cache, uint32_t sector_size_bytes)
+{
+    for (uint32_t i = 0U; i < p_cache->num_sectors; i++)
+    {
+        p_cache->p_entries[i].valid = false;
+        p_cache->p_entries[i].dirty = false;
+    }
+
+    p_cache->sector_size_bytes = sector_size_bytes;
+    p_cache->tick              = 0U;
+}
+
+/*******************************************************************************************************************//**
+ * Drops cached sectors in a range, including data not written yet. Called before the range is erased.
+ *
+ * @param[in]  p_cache                 Cache
+ * @param[in]  sector                  First sector of the range
+ * @param[in]  num_sectors             Number of sectors in the range
+ **********************************************************************************************************************/
+void rm_block_media_cache_discard (rm_block_media_cache_t * const p_cache, uint32_t sector, uint32_t num_sectors)
+{
+    for (uint32_t i = 0U; i < p_cache->num_sectors; i++)
+    {
+        rm_block_media_cache_entry_t * p_entry = &p_cache->p_entries[i];
+        if (p_entry->valid && (p_entry->sector >= sector) && ((p_entry->sector - sector) < num_sectors))
+        {
+            p_entry->valid = false;
+            p_entry->dirty = false;
+        }
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Reads sectors through the cache. Cached sectors are copied from the cache. Missing sectors are read from the device
+ * in runs. Single sector reads, which are typical for file system tables, are added to the cache.
+ *
+ * @param[in]  p_cache                 Cache
+ * @param[out] p_dest                  Destination buffer
+ * @param[in]  sector                  First sector to read
+ * @param[in]  num_sectors             Number of sectors to read
+ *
+ * @retval     FSP_SUCCESS             Data read.
+ * @return See @ref RENESAS_ERROR_CODES or the transfer function of the block media module for other possible return
+ *         codes.
+ **********************************************************************************************************************/
+fsp_err_t rm_block_media_cache_read (rm_block_media_cache_t * const p_cache,
+                                     uint8_t * const                p_dest,
+                                     uint32_t                       sector,
+                                     uint32_t                       num_sectors)
+{
+    uint32_t  size = p_cache->sector_size_bytes;
+    fsp_err_t err;
+
+    uint32_t i = 0U;
+    while (i < num_sectors)
+    {
+        uint32_t k = rm_block_media_cache_find(p_cache, sector + i);
+        if (RM_BLOCK_MEDIA_CACHE_PRV_MISS != k)
+        {
+            memcpy(&p_dest[i * size], &p_cache->p_buffer[k * size], size);
+            p_cache->p_entries[k].last_use = p_cache->tick++;
+            i++;
+            continue;
+        }
+
+        /* Read the missing sectors up to the next cached sector directly into the destination. */
+        uint32_t count = 1U;
+        while (((i + count) < num_sectors) &&
+               (RM_BLOCK_MEDIA_CACHE_PRV_MISS == rm_block_media_cache_find(p_cache, sector + i + count)))
+        {
+            count++;
+        }
+
+        err = p_cache->p_transfer(p_cache->p_ctrl, false, &p_dest[i * size], sector + i, count);
+        FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+        i += count;
+    }
+
+    if (1U == num_sectors)
+    {
+        if (RM_BLOCK_MEDIA_CACHE_PRV_MISS == rm_block_media_cache_find(p_cache, sector))
+        {
+            uint32_t k;
+            err = rm_block_media_cache_alloc(p_cache, &k);
+            FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+            memcpy(&p_cache->p_buffer[k * size], p_dest, size);
+            p_cache->p_entries[k].sector   = sector;
+            p_cache->p_entries[k].valid    = true;
+            p_cache->p_entries[k].dirty    = false;
+            p_cache->p_entries[k].last_use = p_cache->tick++;
+        }
+    }
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Writes sectors through the cache. Writes of up to half the cache size are stored as dirty sectors. Larger writes go
+ * directly to the device and update any cached copies.
+ *
+ * @param[in]  p_cache                 Cache
+ * @param[in]  p_src                   Source data
+ * @param[in]  sector                  First sector to write
+ * @param[in]  num_sectors             Number of sectors to write
+ *
+ * @retval     FSP_SUCCESS             Data written to the cache or the device.
+ * @return See @ref RENESAS_ERROR_CODES or the transfer function of the block media module for other possible return
+ *         codes.
+ **********************************************************************************************************************/
+fsp_err_t rm_block_media_cache_write (rm_block_media_cache_t * const p_cache,
+                                      uint8_t const * const          p_src,
+                                      uint32_t                       sector,
+                                      uint32_t                       num_sectors)
+{
+    rm_block_media_cache_entry_t * p_entries = p_cache->p_entries;
+    uint32_t  size          = p_cache->sector_size_bytes;
+    bool      write_through = (num_sectors > (p_cache->num_sectors / 2U));
+    fsp_err_t err;
+
+    if (write_through)
+    {
+        err = p_cache->p_transfer(p_cache->p_ctrl, true, (uint8_t *) p_src, sector, num_sectors);
+        FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+    }
+
+    for (uint32_t i = 0U; i < num_sectors; i++)
+    {
+        uint32_t k = rm_block_media_cache_find(p_cache, sector + i);
+        if (RM_BLOCK_MEDIA_CACHE_PRV_MISS == k)
+        {
+            if (write_through)
+            {
+                continue;
+            }
+
+            err = rm_block_media_cache_alloc(p_cache, &k);
+            FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+            p_entries[k].sector = sector + i;
+            p_entries[k].valid  = true;
+        }
+
+        memcpy(&p_cache->p_buffer[k * size], &p_src[i * size], size);
+        p_entries[k].dirty    = !write_through;
+        p_entries[k].last_use = p_cache->tick++;
+    }
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Writes all dirty sectors in the cache to the device. Consecutive dirty sectors are written with one transfer.
+ *
+ * @param[in]  p_cache                 Cache
+ *
+ * @retval     FSP_SUCCESS             No dirty sectors remain, or the cache is disabled.
+ * @return See @ref RENESAS_ERROR_CODES or the transfer function of the block media module for other possible return
+ *         codes.
+ **********************************************************************************************************************/
+fsp_err_t rm_block_media_cache_sync (rm_block_media_cache_t * const p_cache)
+{
+    for (uint32_t i = 0U; i < p_cache->num_sectors; i++)
+    {
+        /* The flush only marks entries clean, so entries before i stay clean. Entries swapped into i are checked
+         * again. */
+        while (p_cache->p_entries[i].valid && p_cache->p_entries[i].dirty)
+        {
+            fsp_err_t err = rm_block_media_cache_run_flush(p_cache, i);
+            FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+        }
+    }
+
+    return FSP_SUCCESS;
+}
+
+/***********************************************************************************************************************
+ * Private Functions
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * Finds a sector in the cache.
+ *
+ * @param[in]  p_cache                 Cache
+ * @param[in]  sector                  Sector to find
+ *
+ * @return     Index of the cache entry, or RM_BLOCK_MEDIA_CACHE_PRV_MISS.
+ **********************************************************************************************************************/
+static uint32_t rm_block_media_cache_find (rm_block_media_cache_t * const p_cache, uint32_t sector)
+{
+    for (uint32_t i = 0U; i < p_cache->num_sectors; i++)
+    {
+        if (p_cache->p_entries[i].valid && (sector == p_cache->p_entries[i].sector))
+        {
+            return i;
+        }
+    }
+
+    return RM_BLOCK_MEDIA_CACHE_PRV_MISS;
+}
+
+/*******************************************************************************************************************//**
+ * Swaps two cache entries and their sector data.
+ *
+ * @param[in]  p_cache                 Cache
+ * @param[in]  a                       Index of the first entry
+ * @param[in]  b                       Index of the second entry
+ **********************************************************************************************************************/
+static void rm_block_media_cache_swap (rm_block_media_cache_t * const p_cache, uint32_t a, uint32_t b)
+{
+    rm_block_media_cache_entry_t entry = p_cache->p_entries[a];
+    p_cache->p_entries[a] = p_cache->p_entries[b];
+    p_cache->p_entries[b] = entry;
+
+    uint8_t * p_a = &p_cache->p_buffer[a * p_cache->sector_size_bytes];
+    uint8_t * p_b = &p_cache->p_buffer[b * p_cache->sector_size_bytes];
+    uint32_t  tmp[RM_BLOCK_MEDIA_CACHE_PRV_SWAP_WORDS];
+    for (uint32_t offset = 0U; offset < p_cache->sector_size_bytes; offset += sizeof(tmp))
+    {
+        memcpy(tmp, &p_a[offset], sizeof(tmp));
+        memcpy(&p_a[offset], &p_b[offset], sizeof(tmp));
+        memcpy(&p_b[offset], tmp, sizeof(tmp));
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Writes the run of consecutive dirty sectors that contains a cache entry with one transfer. The entries of the run
+ * are first moved next to each other in the cache buffer.
+ *
+ * @param[in]  p_cache                 Cache
+ * @param[in]  index                   Index of a dirty cache entry
+ *
+ * @retval     FSP_SUCCESS             The run is written and marked clean.
+ * @return See @ref RENESAS_ERROR_CODES or the transfer function of the block media module for other possible return
+ *         codes.
+ **********************************************************************************************************************/
+static fsp_err_t rm_block_media_cache_run_flush (rm_block_media_cache_t * const p_cache, uint32_t index)
+{
+    rm_block_media_cache_entry_t * p_entries = p_cache->p_entries;
+
+    /* Find the first sector of the run. */
+    uint32_t first = p_entries[index].sector;
+    while (first > 0U)
+    {
+        uint32_t k = rm_block_media_cache_find(p_cache, first - 1U);
+        if ((RM_BLOCK_MEDIA_CACHE_PRV_MISS == k) || !p_entries[k].dirty)
+        {
+            break;
+        }
+
+        first--;
+    }
+
+    /* Count the sectors in the run. */
+    uint32_t count = 0U;
+    while (count < p_cache->num_sectors)
+    {
+        uint32_t k = rm_block_media_cache_find(p_cache, first + count);
+        if ((RM_BLOCK_MEDIA_CACHE_PRV_MISS == k) || !p_entries[k].dirty)
+        {
+            break;
+        }
+
+        count++;
+    }
+
+    /* Move the run to consecutive entries so it can be written from the cache buffer in one transfer. */
+    uint32_t base = rm_block_media_cache_find(p_cache, first);
+    if ((base + count) > p_cache->num_sectors)
+    {
+        base = p_cache->num_sectors - count;
+    }
+
+    for (uint32_t i = 0U; i < count; i++)
+    {
+        uint32_t k = rm_block_media_cache_find(p_cache, first + i);
+        if (k != (base + i))
+        {
+            rm_block_media_cache_swap(p_cache, k, base + i);
+        }
+    }
+
+    uint8_t * p_run = &p_cache->p_buffer[base * p_cache->sector_size_bytes];
+    fsp_err_t err   = p_cache->p_transfer(p_cache->p_ctrl, true, p_run, first, count);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+    for (uint32_t i = 0U; i < count; i++)
+    {
+        p_entries[base + i].dirty = false;
+    }
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Gets a free cache entry, evicting the least recently used entry if the cache is full.
+ *
+ * @param[in]  p_cache                 Cache
+ * @param[out] p_index                 Index of the free entry
+ *
+ * @retval     FSP_SUCCESS             Entry is free.
+ * @return See @ref RENESAS_ERROR_CODES or the transfer function of the block media module for other possible return
+ *         codes.
+ **********************************************************************************************************************/
+static fsp_err_t rm_block_media_cache_alloc (rm_block_media_cache_t * const p_cache, uint32_t * p_index)
+{
+    rm_block_media_cache_entry_t * p_entries = p_cache->p_entries;
+
+    uint32_t lru = 0U;
+    for (uint32_t i = 0U; i < p_cache->num_sectors; i++)
+    {
+        if (!p_entries[i].valid)
+        {
+            *p_index = i;
+
+            return FSP_SUCCESS;
+        }
+
+        uint32_t age = p_cache->tick - p_entries[i].last_use;
+        if (age > (p_cache->tick - p_entries[lru].last_use))
+        {
+            lru = i;
+        }
+    }
+
+    if (p_entries[lru].dirty)
+    {
+        /* Write the victim together with its dirty neighbors. The flush can move the victim. */
+        uint32_t  sector = p_entries[lru].sector;
+        fsp_err_t err    = rm_block_media_cache_run_flush(p_cache, lru);
+        FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+        lru = rm_block_media_cache_find(p_cache, sector);
+    }
+
+    p_entries[lru].valid = false;
+    *p_index             = lru;
+
+    return FSP_SUCCESS;
+}
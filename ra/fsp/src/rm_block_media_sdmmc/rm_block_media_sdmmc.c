@@ -33,6 +33,20 @@
 
 #define RM_BLOCK_MEDIA_SDMMC_PRV_SD_R1_ERRORS    (0xFDF98008U)
 
+/* Compile-time binding of the SD/MMC instance. Define RM_BLOCK_MEDIA_SDMMC_CFG_SDMMC_BINDING as R_SDHI_ to call the
+ * SD/MMC driver directly instead of through its p_api table on the read, write, erase and status paths. Every SD/MMC
+ * instance used with this module must then be of the bound driver. */
+#ifdef RM_BLOCK_MEDIA_SDMMC_CFG_SDMMC_BINDING
+ #ifndef RM_BLOCK_MEDIA_SDMMC_CFG_SDMMC_BINDING_HEADER
+  #define RM_BLOCK_MEDIA_SDMMC_CFG_SDMMC_BINDING_HEADER    "r_sdhi.h"
+ #endif
+ #include RM_BLOCK_MEDIA_SDMMC_CFG_SDMMC_BINDING_HEADER
+ #define RM_BLOCK_MEDIA_SDMMC_PRV_SDMMC_API(p_instance, member, function)    \
+    FSP_API_DIRECT(RM_BLOCK_MEDIA_SDMMC_CFG_SDMMC_BINDING, function)
+#else
+ #define RM_BLOCK_MEDIA_SDMMC_PRV_SDMMC_API(p_instance, member, function)    ((p_instance)->p_api->member)
+#endif
+
 /***********************************************************************************************************************
  * Typedef definitions
  **********************************************************************************************************************/
@@ -49,6 +63,16 @@ typedef BSP_CMSE_NONSECURE_CALL void (*volatile rm_block_media_sdmmc_prv_ns_call
  **********************************************************************************************************************/
 void rm_block_media_sdmmc_callback(sdmmc_callback_args_t * p_args);
 
+static void rm_block_media_sdmmc_user_callback(rm_block_media_sdmmc_instance_ctrl_t * p_instance_ctrl,
+                                               rm_block_media_callback_args_t       * p_args);
+static fsp_err_t rm_block_media_sdmmc_cache_transfer(rm_block_media_ctrl_t * const p_ctrl,
+                                                     bool                          write,
+                                                     uint8_t                     * p_buffer,
+                                                     uint32_t                      sector,
+                                                     uint32_t                      num_sectors);
+static void rm_block_media_sdmmc_cache_complete(rm_block_media_sdmmc_instance_ctrl_t * p_instance_ctrl,
+                                                fsp_err_t                              err);
+
 /***********************************************************************************************************************
  * Private global variables
  **********************************************************************************************************************/
@@ -117,10 +141,19 @@ fsp_err_t RM_BLOCK_MEDIA_SDMMC_Open (rm_block_media_ctrl_t * const p_ctrl, rm_bl
 #if RM_BLOCK_MEDIA_SDMMC_CFG_PARAM_CHECKING_ENABLE
     FSP_ASSERT(NULL != p_extended_cfg);
     FSP_ASSERT(NULL != p_extended_cfg->p_sdmmc);
+    FSP_ASSERT((0U == p_extended_cfg->cache_num_sectors) ||
+               ((NULL != p_extended_cfg->p_cache_entries) && (NULL != p_extended_cfg->p_cache_buffer)));
     FSP_ERROR_RETURN(RM_BLOCK_MEDIA_SDMMC_OPEN != p_instance_ctrl->open, FSP_ERR_ALREADY_OPEN);
 #endif
     p_instance_ctrl->p_cfg = p_cfg;
 
+    rm_block_media_cache_open(&p_instance_ctrl->cache,
+                              p_instance_ctrl,
+                              rm_block_media_sdmmc_cache_transfer,
+                              p_extended_cfg->p_cache_entries,
+                              p_extended_cfg->p_cache_buffer,
+                              p_extended_cfg->cache_num_sectors);
+
     /* Open the underlying driver. */
     sdmmc_instance_t * p_sdmmc = (sdmmc_instance_t *) p_extended_cfg->p_sdmmc;
     fsp_err_t          err     = p_sdmmc->p_api->open(p_sdmmc->p_ctrl, p_sdmmc->p_cfg);
@@ -174,7 +207,11 @@ fsp_err_t RM_BLOCK_MEDIA_SDMMC_MediaInit (rm_block_media_ctrl_t * const p_ctrl)
     p_instance_ctrl->sector_count      = device.sector_count;
     p_instance_ctrl->sector_size_bytes = device.sector_size_bytes;
     p_instance_ctrl->write_protected   = device.write_protected;
-    p_instance_ctrl->initialized       = true;
+
+    /* Cached sectors may belong to a different card. */
+    rm_block_media_cache_invalidate(&p_instance_ctrl->cache, device.sector_size_bytes);
+
+    p_instance_ctrl->initialized = true;
 
     return FSP_SUCCESS;
 }
@@ -185,10 +222,14 @@ fsp_err_t RM_BLOCK_MEDIA_SDMMC_MediaInit (rm_block_media_ctrl_t * const p_ctrl)
  *
  * This function blocks until the data is read into the destination buffer.
  *
+ * If the sector cache is enabled, cached sectors are copied from the cache and the callback is called before this
+ * function returns.
+ *
  * @retval     FSP_SUCCESS                   Data read successfully.
  * @retval     FSP_ERR_ASSERTION             An input parameter is invalid.
  * @retval     FSP_ERR_NOT_OPEN              Module is not open.
  * @retval     FSP_ERR_NOT_INITIALIZED       Module has not been initialized.
+ * @retval     FSP_ERR_READ_FAILED           Sectors could not be read into the sector cache.
  *
  * @return See @ref RENESAS_ERROR_CODES or functions called by this function for other possible return codes.
  *         This function calls:
@@ -212,8 +253,22 @@ fsp_err_t RM_BLOCK_MEDIA_SDMMC_Read (rm_block_media_ctrl_t * const p_ctrl,
         (rm_block_media_sdmmc_extended_cfg_t *) p_instance_ctrl->p_cfg->p_extend;
     sdmmc_instance_t * p_sdmmc = (sdmmc_instance_t *) p_extended_cfg->p_sdmmc;
 
+    fsp_err_t err;
+
+    if (0U != p_extended_cfg->cache_num_sectors)
+    {
+        err = rm_block_media_cache_read(&p_instance_ctrl->cache, p_dest_address, block_address, num_blocks);
+        rm_block_media_sdmmc_cache_complete(p_instance_ctrl, err);
+        FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+        return FSP_SUCCESS;
+    }
+
     /* Call the underlying driver. */
-    fsp_err_t err = p_sdmmc->p_api->read(p_sdmmc->p_ctrl, p_dest_address, block_address, num_blocks);
+    err = RM_BLOCK_MEDIA_SDMMC_PRV_SDMMC_API(p_sdmmc, read, Read) (p_sdmmc->p_ctrl,
+                                                                   p_dest_address,
+                                                                   block_address,
+                                                                   num_blocks);
     FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
 
     return FSP_SUCCESS;
@@ -225,10 +280,15 @@ fsp_err_t RM_BLOCK_MEDIA_SDMMC_Read (rm_block_media_ctrl_t * const p_ctrl,
  *
  * This function blocks until the write operation completes.
  *
+ * If the sector cache is enabled, writes of up to half the cache size are stored in the cache and written to the
+ * device when they are evicted or when RM_BLOCK_MEDIA_SDMMC_CacheSync() is called. The callback is called before
+ * this function returns.
+ *
  * @retval     FSP_SUCCESS                   Write finished successfully.
  * @retval     FSP_ERR_ASSERTION             An input parameter is invalid.
  * @retval     FSP_ERR_NOT_OPEN              Module is not open.
  * @retval     FSP_ERR_NOT_INITIALIZED       Module has not been initialized.
+ * @retval     FSP_ERR_CARD_WRITE_PROTECTED  The cache is enabled and the device is write protected.
  *
  * @return See @ref RENESAS_ERROR_CODES or functions called by this function for other possible return codes.
  *         This function calls:
@@ -252,8 +312,25 @@ fsp_err_t RM_BLOCK_MEDIA_SDMMC_Write (rm_block_media_ctrl_t * const p_ctrl,
         (rm_block_media_sdmmc_extended_cfg_t *) p_instance_ctrl->p_cfg->p_extend;
     sdmmc_instance_t * p_sdmmc = (sdmmc_instance_t *) p_extended_cfg->p_sdmmc;
 
+    fsp_err_t err;
+
+    if (0U != p_extended_cfg->cache_num_sectors)
+    {
+        /* Report write protection now rather than when the sectors are evicted. */
+        FSP_ERROR_RETURN(!p_instance_ctrl->write_protected, FSP_ERR_CARD_WRITE_PROTECTED);
+
+        err = rm_block_media_cache_write(&p_instance_ctrl->cache, p_src_address, block_address, num_blocks);
+        rm_block_media_sdmmc_cache_complete(p_instance_ctrl, err);
+        FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+        return FSP_SUCCESS;
+    }
+
     /* Call the underlying driver. */
-    fsp_err_t err = p_sdmmc->p_api->write(p_sdmmc->p_ctrl, p_src_address, block_address, num_blocks);
+    err = RM_BLOCK_MEDIA_SDMMC_PRV_SDMMC_API(p_sdmmc, write, Write) (p_sdmmc->p_ctrl,
+                                                                     p_src_address,
+                                                                     block_address,
+                                                                     num_blocks);
     FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
 
     return FSP_SUCCESS;
@@ -290,8 +367,13 @@ fsp_err_t RM_BLOCK_MEDIA_SDMMC_Erase (rm_block_media_ctrl_t * const p_ctrl,
         (rm_block_media_sdmmc_extended_cfg_t *) p_instance_ctrl->p_cfg->p_extend;
     sdmmc_instance_t * p_sdmmc = (sdmmc_instance_t *) p_extended_cfg->p_sdmmc;
 
+    /* Erased sectors replace any cached data, including data not written yet. */
+    rm_block_media_cache_discard(&p_instance_ctrl->cache, block_address, num_blocks);
+
     /* Call the underlying driver. */
-    fsp_err_t err = p_sdmmc->p_api->erase(p_sdmmc->p_ctrl, block_address, num_blocks);
+    fsp_err_t err = RM_BLOCK_MEDIA_SDMMC_PRV_SDMMC_API(p_sdmmc, erase, Erase) (p_sdmmc->p_ctrl,
+                                                                               block_address,
+                                                                               num_blocks);
     FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
 
     return FSP_SUCCESS;
@@ -372,7 +454,7 @@ fsp_err_t RM_BLOCK_MEDIA_SDMMC_StatusGet (rm_block_media_ctrl_t * const   p_api_
 
     /* Call the underlying driver. */
     sdmmc_status_t status;
-    fsp_err_t      err = p_sdmmc->p_api->statusGet(p_sdmmc->p_ctrl, &status);
+    fsp_err_t      err = RM_BLOCK_MEDIA_SDMMC_PRV_SDMMC_API(p_sdmmc, statusGet, StatusGet) (p_sdmmc->p_ctrl, &status);
     FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
 
     p_status->media_inserted = status.card_inserted;
@@ -412,6 +494,8 @@ fsp_err_t RM_BLOCK_MEDIA_SDMMC_InfoGet (rm_block_media_ctrl_t * const p_ctrl, rm
 /*******************************************************************************************************************//**
  * Closes an open SD/MMC device.  Implements @ref rm_block_media_api_t::close().
  *
+ * Dirty sectors in the cache are written to the device before it is closed.
+ *
  * @retval     FSP_SUCCESS                   Successful close.
  * @retval     FSP_ERR_ASSERTION             An input parameter is invalid.
  * @retval     FSP_ERR_NOT_OPEN              Module is not open.
@@ -425,11 +509,17 @@ fsp_err_t RM_BLOCK_MEDIA_SDMMC_Close (rm_block_media_ctrl_t * const p_ctrl)
     FSP_ERROR_RETURN(RM_BLOCK_MEDIA_SDMMC_OPEN == p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
 #endif
 
-    p_instance_ctrl->open = 0U;
-
     rm_block_media_sdmmc_extended_cfg_t * p_extended_cfg =
         (rm_block_media_sdmmc_extended_cfg_t *) p_instance_ctrl->p_cfg->p_extend;
 
+    /* Write cached sectors before closing. The data is lost if the card was removed. */
+    if (p_instance_ctrl->initialized && (0U != p_extended_cfg->cache_num_sectors))
+    {
+        (void) rm_block_media_cache_sync(&p_instance_ctrl->cache);
+    }
+
+    p_instance_ctrl->open = 0U;
+
     /* Call the underlying driver. */
     sdmmc_instance_t * p_sdmmc = (sdmmc_instance_t *) p_extended_cfg->p_sdmmc;
     p_sdmmc->p_api->close(p_sdmmc->p_ctrl);
@@ -457,6 +547,34 @@ fsp_err_t RM_BLOCK_MEDIA_SDMMC_VersionGet (fsp_version_t * const p_version)
     return err;
 }
 
+/*******************************************************************************************************************//**
+ * Writes all dirty sectors in the sector cache to the device. Consecutive dirty sectors are written with one
+ * multi-block write. Call this before the media is removed or power is lost, for example after closing files.
+ *
+ * This function blocks until all writes complete.
+ *
+ * @retval     FSP_SUCCESS                   No dirty sectors remain, or the cache is disabled.
+ * @retval     FSP_ERR_ASSERTION             An input parameter is invalid.
+ * @retval     FSP_ERR_NOT_OPEN              Module is not open.
+ * @retval     FSP_ERR_NOT_INITIALIZED       Module has not been initialized.
+ *
+ * @return See @ref RENESAS_ERROR_CODES or functions called by this function for other possible return codes.
+ *         This function calls:
+ *             * @ref sdmmc_api_t::write
+ **********************************************************************************************************************/
+fsp_err_t RM_BLOCK_MEDIA_SDMMC_CacheSync (rm_block_media_ctrl_t * const p_ctrl)
+{
+    rm_block_media_sdmmc_instance_ctrl_t * p_instance_ctrl = (rm_block_media_sdmmc_instance_ctrl_t *) p_ctrl;
+
+#if RM_BLOCK_MEDIA_SDMMC_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_instance_ctrl);
+    FSP_ERROR_RETURN(RM_BLOCK_MEDIA_SDMMC_OPEN == p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
+    FSP_ERROR_RETURN(p_instance_ctrl->initialized, FSP_ERR_NOT_INITIALIZED);
+#endif
+
+    return rm_block_media_cache_sync(&p_instance_ctrl->cache);
+}
+
 /*******************************************************************************************************************//**
  * @} (end addtogroup RM_BLOCK_MEDIA_SDMMC)
  **********************************************************************************************************************/
@@ -532,36 +650,143 @@ void rm_block_media_sdmmc_callback (sdmmc_callback_args_t * p_args)
         args.event |= RM_BLOCK_MEDIA_EVENT_MEDIA_INSERTED;
     }
 
+    if (p_instance_ctrl->cache_transfer_pending)
+    {
+        /* Completion of a transfer started by the sector cache is not passed to the user. */
+        if (RM_BLOCK_MEDIA_EVENT_ERROR & args.event)
+        {
+            p_instance_ctrl->cache_transfer_error = true;
+        }
+
+        if ((SDMMC_EVENT_TRANSFER_COMPLETE | SDMMC_EVENT_TRANSFER_ERROR) & p_args->event)
+        {
+            p_instance_ctrl->cache_transfer_pending = false;
+        }
+
+        args.event &= ~(RM_BLOCK_MEDIA_EVENT_OPERATION_COMPLETE | RM_BLOCK_MEDIA_EVENT_ERROR);
+    }
+
     if (args.event)
     {
-        if (NULL != p_instance_ctrl->p_callback)
+        rm_block_media_sdmmc_user_callback(p_instance_ctrl, &args);
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Calls the user callback, using callback memory if it was provided.
+ *
+ * @param[in] p_instance_ctrl          Pointer to instance control block
+ * @param[in] p_args                   Pointer to callback arguments
+ **********************************************************************************************************************/
+static void rm_block_media_sdmmc_user_callback (rm_block_media_sdmmc_instance_ctrl_t * p_instance_ctrl,
+                                                rm_block_media_callback_args_t       * p_args)
+{
+    if (NULL != p_instance_ctrl->p_callback)
+    {
+        rm_block_media_callback_args_t args_stacked;
+
+        /* Store callback arguments in memory provided by user if available.  This allows callback arguments to be
+         * stored in non-secure memory so they can be accessed by a non-secure callback function. */
+        rm_block_media_callback_args_t * p_args_memory = p_instance_ctrl->p_callback_memory;
+        if (NULL == p_args_memory)
+        {
+            /* Use provided args struct on stack */
+            p_args_memory = p_args;
+        }
+        else
+        {
+            /* Save current arguments on the stack in case this is a nested interrupt. */
+            args_stacked = *p_args_memory;
+
+            /* Copy the stacked args to callback memory */
+            *p_args_memory = *p_args;
+        }
+
+        rm_block_media_sdmmc_call_callback(p_instance_ctrl, p_args_memory);
+
+        if (NULL != p_instance_ctrl->p_callback_memory)
         {
-            rm_block_media_callback_args_t args_stacked;
-
-            /* Store callback arguments in memory provided by user if available.  This allows callback arguments to be
-             * stored in non-secure memory so they can be accessed by a non-secure callback function. */
-            rm_block_media_callback_args_t * p_args_memory = p_instance_ctrl->p_callback_memory;
-            if (NULL == p_args_memory)
-            {
-                /* Use provided args struct on stack */
-                p_args_memory = &args;
-            }
-            else
-            {
-                /* Save current arguments on the stack in case this is a nested interrupt. */
-                args_stacked = *p_args_memory;
-
-                /* Copy the stacked args to callback memory */
-                *p_args_memory = args;
-            }
-
-            rm_block_media_sdmmc_call_callback(p_instance_ctrl, p_args_memory);
-
-            if (NULL != p_instance_ctrl->p_callback_memory)
-            {
-                /* Restore callback memory in case this is a nested interrupt. */
-                *p_instance_ctrl->p_callback_memory = args_stacked;
-            }
+            /* Restore callback memory in case this is a nested interrupt. */
+            *p_instance_ctrl->p_callback_memory = args_stacked;
         }
     }
 }
+
+/*******************************************************************************************************************//**
+ * Reads or writes sectors for the cache and waits for the SDMMC callback.
+ *
+ * @param[in]  p_ctrl                  Pointer to instance control block
+ * @param[in]  write                   True to write, false to read
+ * @param[in]  p_buffer                Sector data
+ * @param[in]  sector                  First sector to transfer
+ * @param[in]  num_sectors             Number of sectors to transfer
+ *
+ * @retval     FSP_SUCCESS             Transfer complete.
+ * @retval     FSP_ERR_WRITE_FAILED    The write reported an error.
+ * @retval     FSP_ERR_READ_FAILED     The read reported an error.
+ * @return See @ref RENESAS_ERROR_CODES or functions called by this function for other possible return codes.
+ *         This function calls:
+ *             * @ref sdmmc_api_t::read
+ *             * @ref sdmmc_api_t::write
+ **********************************************************************************************************************/
+static fsp_err_t rm_block_media_sdmmc_cache_transfer (rm_block_media_ctrl_t * const p_ctrl,
+                                                      bool                          write,
+                                                      uint8_t                     * p_buffer,
+                                                      uint32_t                      sector,
+                                                      uint32_t                      num_sectors)
+{
+    rm_block_media_sdmmc_instance_ctrl_t * p_instance_ctrl = (rm_block_media_sdmmc_instance_ctrl_t *) p_ctrl;
+    rm_block_media_sdmmc_extended_cfg_t  * p_extended_cfg  =
+        (rm_block_media_sdmmc_extended_cfg_t *) p_instance_ctrl->p_cfg->p_extend;
+    sdmmc_instance_t * p_sdmmc = (sdmmc_instance_t *) p_extended_cfg->p_sdmmc;
+
+    p_instance_ctrl->cache_transfer_error   = false;
+    p_instance_ctrl->cache_transfer_pending = true;
+
+    fsp_err_t err;
+    if (write)
+    {
+        err = RM_BLOCK_MEDIA_SDMMC_PRV_SDMMC_API(p_sdmmc, write, Write) (p_sdmmc->p_ctrl,
+                                                                         p_buffer,
+                                                                         sector,
+                                                                         num_sectors);
+    }
+    else
+    {
+        err = RM_BLOCK_MEDIA_SDMMC_PRV_SDMMC_API(p_sdmmc, read, Read) (p_sdmmc->p_ctrl, p_buffer, sector, num_sectors);
+    }
+
+    if (FSP_SUCCESS != err)
+    {
+        p_instance_ctrl->cache_transfer_pending = false;
+
+        return err;
+    }
+
+    /* The SDMMC driver reports completion or an error for every transfer, including a data timeout if the card is
+     * removed. */
+    while (p_instance_ctrl->cache_transfer_pending)
+    {
+        /* Wait for the SDMMC callback. */
+    }
+
+    FSP_ERROR_RETURN(!p_instance_ctrl->cache_transfer_error, write ? FSP_ERR_WRITE_FAILED : FSP_ERR_READ_FAILED);
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Reports completion of a cached read or write to the user.
+ *
+ * @param[in] p_instance_ctrl          Pointer to instance control block
+ * @param[in] err                      Result of the operation
+ **********************************************************************************************************************/
+static void rm_block_media_sdmmc_cache_complete (rm_block_media_sdmmc_instance_ctrl_t * p_instance_ctrl,
+                                                 fsp_err_t                              err)
+{
+    rm_block_media_callback_args_t args;
+    memset(&args, 0U, sizeof(rm_block_media_callback_args_t));
+    args.p_context = p_instance_ctrl->p_context;
+    args.event     = (FSP_SUCCESS == err) ? RM_BLOCK_MEDIA_EVENT_OPERATION_COMPLETE : RM_BLOCK_MEDIA_EVENT_ERROR;
+    rm_block_media_sdmmc_user_callback(p_instance_ctrl, &args);
+}
@@ -50,6 +50,32 @@ void rm_block_media_usb_callback(usb_event_info_t * p_usb_event_info, usb_hdl_t
 
 #endif
 
+static fsp_err_t rm_block_media_usb_transfer(rm_block_media_usb_instance_ctrl_t * p_instance_ctrl,
+                                             bool                                 write,
+                                             uint8_t                            * p_buffer,
+                                             uint32_t                             sector,
+                                             uint32_t                             num_sectors);
+static fsp_err_t rm_block_media_usb_cache_transfer(rm_block_media_ctrl_t * const p_ctrl,
+                                                   bool                          write,
+                                                   uint8_t                     * p_buffer,
+                                                   uint32_t                      sector,
+                                                   uint32_t                      num_sectors);
+static fsp_err_t rm_block_media_usb_sync(rm_block_media_usb_instance_ctrl_t * p_instance_ctrl);
+static void rm_block_media_usb_cache_complete(rm_block_media_usb_instance_ctrl_t * p_instance_ctrl, fsp_err_t err);
+static fsp_err_t rm_block_media_usb_read_ahead(rm_block_media_usb_instance_ctrl_t * p_instance_ctrl,
+                                               uint8_t                            * p_dest,
+                                               uint32_t                             sector,
+                                               uint32_t                             num_sectors,
+                                               bool                                 sequential);
+static void rm_block_media_usb_read_ahead_invalidate(rm_block_media_usb_instance_ctrl_t * p_instance_ctrl,
+                                                     uint32_t                             sector,
+                                                     uint32_t                             num_sectors);
+static fsp_err_t rm_block_media_usb_write_gather(rm_block_media_usb_instance_ctrl_t * p_instance_ctrl,
+                                                 uint8_t const                      * p_src,
+                                                 uint32_t                             sector,
+                                                 uint32_t                             num_sectors);
+static fsp_err_t rm_block_media_usb_write_flush(rm_block_media_usb_instance_ctrl_t * p_instance_ctrl);
+
 /***********************************************************************************************************************
  * Private global variables
  **********************************************************************************************************************/
@@ -117,12 +143,21 @@ fsp_err_t RM_BLOCK_MEDIA_USB_Open (rm_block_media_ctrl_t * const p_ctrl, rm_bloc
 #if RM_BLOCK_MEDIA_USB_CFG_PARAM_CHECKING_ENABLE
     FSP_ASSERT(NULL != p_extended_cfg);
     FSP_ASSERT(NULL != p_extended_cfg->p_usb);
+    FSP_ASSERT((0U == p_extended_cfg->cache_num_sectors) ||
+               ((NULL != p_extended_cfg->p_cache_entries) && (NULL != p_extended_cfg->p_cache_buffer)));
 #endif
 
     FSP_ERROR_RETURN(RM_BLOCK_MEDIA_USB_OPEN != p_instance_ctrl->open, FSP_ERR_ALREADY_OPEN);
 
     p_instance_ctrl->p_cfg = p_cfg;
 
+    rm_block_media_cache_open(&p_instance_ctrl->cache,
+                              p_instance_ctrl,
+                              rm_block_media_usb_cache_transfer,
+                              p_extended_cfg->p_cache_entries,
+                              p_extended_cfg->p_cache_buffer,
+                              p_extended_cfg->cache_num_sectors);
+
     /* Open the underlying driver. */
     usb_instance_t * p_usb_instance = (usb_instance_t *) p_extended_cfg->p_usb;
 
@@ -184,7 +219,13 @@ fsp_err_t RM_BLOCK_MEDIA_USB_MediaInit (rm_block_media_ctrl_t * const p_ctrl)
     p_instance_ctrl->sector_count      = __REV(*(uint32_t *) &p_instance_ctrl->p_read_buffer[0]) + 1;
     p_instance_ctrl->sector_size_bytes = __REV(*(uint32_t *) &p_instance_ctrl->p_read_buffer[4]);
 
-    p_instance_ctrl->initialized = true;
+    /* Cached sectors may belong to a different device. */
+    rm_block_media_cache_invalidate(&p_instance_ctrl->cache, p_instance_ctrl->sector_size_bytes);
+
+    p_instance_ctrl->read_next        = 0U;
+    p_instance_ctrl->read_ahead_count = 0U;
+    p_instance_ctrl->write_count      = 0U;
+    p_instance_ctrl->initialized      = true;
 
     return FSP_SUCCESS;
 }
@@ -192,7 +233,9 @@ fsp_err_t RM_BLOCK_MEDIA_USB_MediaInit (rm_block_media_ctrl_t * const p_ctrl)
 /*******************************************************************************************************************//**
  * Reads data from an USB device. Implements @ref rm_block_media_api_t::read().
  *
- * This function blocks until the data is read into the destination buffer.
+ * This function blocks until the data is read into the destination buffer. If the sector cache is enabled, cached
+ * sectors are copied from the cache. If read-ahead is enabled, a read shorter than read_ahead_sectors that continues
+ * the previous read fetches read_ahead_sectors sectors, and the following reads are served from them.
  *
  * @retval     FSP_SUCCESS                   Data read successfully.
  * @retval     FSP_ERR_ASSERTION             An input parameter is invalid.
@@ -224,14 +267,27 @@ fsp_err_t RM_BLOCK_MEDIA_USB_Read (rm_block_media_ctrl_t * const p_ctrl,
     FSP_ASSERT(NULL != p_extended_cfg->p_usb);
 #endif
 
-    usb_instance_t * p_usb = (usb_instance_t *) p_extended_cfg->p_usb;
+    fsp_err_t err;
 
-    /* Call the underlying driver. */
-    uint8_t   p_drive;
-    fsp_err_t err = R_USB_HMSC_DriveNumberGet(p_usb->p_ctrl, &p_drive, p_instance_ctrl->device_address);
-    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+    /* Device reads of a read that continues the previous one go through the read-ahead buffer. */
+    p_instance_ctrl->read_sequential = (block_address == p_instance_ctrl->read_next);
+    p_instance_ctrl->read_next       = block_address + num_blocks;
+
+    if (0U != p_extended_cfg->cache_num_sectors)
+    {
+        err = rm_block_media_cache_read(&p_instance_ctrl->cache, p_dest_address, block_address, num_blocks);
+        rm_block_media_usb_cache_complete(p_instance_ctrl, err);
+        FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
 
-    err = R_USB_HMSC_StorageReadSector(p_drive, p_dest_address, block_address, (uint16_t) num_blocks);
+        return FSP_SUCCESS;
+    }
+
+    /* Call the underlying driver. */
+    err = rm_block_media_usb_read_ahead(p_instance_ctrl,
+                                        p_dest_address,
+                                        block_address,
+                                        num_blocks,
+                                        p_instance_ctrl->read_sequential);
     FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
 
     rm_block_media_callback_args_t args;
@@ -246,7 +302,13 @@ fsp_err_t RM_BLOCK_MEDIA_USB_Read (rm_block_media_ctrl_t * const p_ctrl,
 /*******************************************************************************************************************//**
  * Writes data to an USB device. Implements @ref rm_block_media_api_t::write().
  *
- * This function blocks until the write operation completes.
+ * This function blocks until the write operation completes. If the sector cache is enabled, writes of up to half the
+ * cache size are stored in the cache and written to the device when they are evicted or when
+ * RM_BLOCK_MEDIA_USB_CacheSync() is called. If write gathering is enabled, writes shorter than write_buffer_sectors are
+ * collected in the write buffer while each one continues the previous one, and the collected sectors are written with
+ * one multi-sector write when the buffer is full, when a write does not continue them, when a read or erase touches
+ * them, or when RM_BLOCK_MEDIA_USB_CacheSync() is called. An error writing gathered sectors is returned by the call that
+ * writes them.
  *
  * @retval     FSP_SUCCESS                   Write finished successfully.
  * @retval     FSP_ERR_ASSERTION             An input parameter is invalid.
@@ -278,14 +340,19 @@ fsp_err_t RM_BLOCK_MEDIA_USB_Write (rm_block_media_ctrl_t * const p_ctrl,
     FSP_ASSERT(NULL != p_extended_cfg->p_usb);
 #endif
 
-    usb_instance_t * p_usb = (usb_instance_t *) p_extended_cfg->p_usb;
+    fsp_err_t err;
 
-    /* Call the underlying driver. */
-    uint8_t   p_drive;
-    fsp_err_t err = R_USB_HMSC_DriveNumberGet(p_usb->p_ctrl, &p_drive, p_instance_ctrl->device_address);
-    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+    if (0U != p_extended_cfg->cache_num_sectors)
+    {
+        err = rm_block_media_cache_write(&p_instance_ctrl->cache, p_src_address, block_address, num_blocks);
+        rm_block_media_usb_cache_complete(p_instance_ctrl, err);
+        FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+        return FSP_SUCCESS;
+    }
 
-    err = R_USB_HMSC_StorageWriteSector(p_drive, p_src_address, block_address, (uint16_t) num_blocks);
+    /* Call the underlying driver. */
+    err = rm_block_media_usb_write_gather(p_instance_ctrl, p_src_address, block_address, num_blocks);
     FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
 
     rm_block_media_callback_args_t args;
@@ -336,6 +403,20 @@ fsp_err_t RM_BLOCK_MEDIA_USB_Erase (rm_block_media_ctrl_t * const p_ctrl,
     uint8_t   p_drive;
     fsp_err_t err = R_USB_HMSC_DriveNumberGet(p_usb->p_ctrl, &p_drive, p_instance_ctrl->device_address);
     FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+    /* Erased sectors replace any cached data, including data not written yet. */
+    rm_block_media_cache_discard(&p_instance_ctrl->cache, block_address, num_blocks);
+
+    rm_block_media_usb_read_ahead_invalidate(p_instance_ctrl, block_address, num_blocks);
+
+    /* Gathered sectors written after the erase would replace the erased data. */
+    if ((block_address < (p_instance_ctrl->write_first + p_instance_ctrl->write_count)) &&
+        (p_instance_ctrl->write_first < (block_address + num_blocks)))
+    {
+        err = rm_block_media_usb_write_flush(p_instance_ctrl);
+        FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+    }
+
     for (uint32_t i = 0; i < num_blocks; i++)
     {
         err = R_USB_HMSC_StorageWriteSector(p_drive, &g_block_media_usb_erase_data[0], block_address + i, 1U);
@@ -450,6 +531,8 @@ fsp_err_t RM_BLOCK_MEDIA_USB_InfoGet (rm_block_media_ctrl_t * const p_ctrl, rm_b
 /*******************************************************************************************************************//**
  * Closes an open USB device.  Implements @ref rm_block_media_api_t::close().
  *
+ * Dirty sectors in the cache and gathered writes are written to the device before it is closed.
+ *
  * @retval     FSP_SUCCESS                   Successful close.
  * @retval     FSP_ERR_ASSERTION             An input parameter is invalid.
  * @retval     FSP_ERR_NOT_OPEN              Module is not open.
@@ -475,6 +558,13 @@ fsp_err_t RM_BLOCK_MEDIA_USB_Close (rm_block_media_ctrl_t * const p_ctrl)
 
     usb_instance_t * p_usb = (usb_instance_t *) p_extended_cfg->p_usb;
 
+    /* Write cached sectors before closing. The data is lost if the device was removed. */
+    if (p_instance_ctrl->initialized &&
+        ((0U != p_extended_cfg->cache_num_sectors) || (0U != p_extended_cfg->write_buffer_sectors)))
+    {
+        (void) rm_block_media_usb_sync(p_instance_ctrl);
+    }
+
     /* Event group delete */
     vEventGroupDelete(p_instance_ctrl->event_group);
 
@@ -507,6 +597,33 @@ fsp_err_t RM_BLOCK_MEDIA_USB_VersionGet (fsp_version_t * const p_version)
     return err;
 }
 
+/*******************************************************************************************************************//**
+ * Writes all dirty sectors in the sector cache and all gathered writes to the device. Consecutive dirty sectors are
+ * written with one multi-sector write. Call this before the media is removed or power is lost, for example after
+ * closing files.
+ *
+ * This function blocks until all writes complete.
+ *
+ * @retval     FSP_SUCCESS                   No dirty sectors remain, or the cache and write gathering are disabled.
+ * @retval     FSP_ERR_ASSERTION             An input parameter is invalid.
+ * @retval     FSP_ERR_NOT_OPEN              Module is not open.
+ * @retval     FSP_ERR_NOT_INITIALIZED       Module has not been initialized.
+ *
+ * @return See @ref RENESAS_ERROR_CODES or functions called by this function for other possible return codes.
+ **********************************************************************************************************************/
+fsp_err_t RM_BLOCK_MEDIA_USB_CacheSync (rm_block_media_ctrl_t * const p_ctrl)
+{
+    rm_block_media_usb_instance_ctrl_t * p_instance_ctrl = (rm_block_media_usb_instance_ctrl_t *) p_ctrl;
+
+#if RM_BLOCK_MEDIA_USB_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_instance_ctrl);
+    FSP_ERROR_RETURN(RM_BLOCK_MEDIA_USB_OPEN == p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
+    FSP_ERROR_RETURN(p_instance_ctrl->initialized, FSP_ERR_NOT_INITIALIZED);
+#endif
+
+    return rm_block_media_usb_sync(p_instance_ctrl);
+}
+
 /*******************************************************************************************************************//**
  * @} (end addtogroup RM_BLOCK_MEDIA_USB)
  **********************************************************************************************************************/
@@ -581,3 +698,304 @@ void rm_block_media_usb_callback (usb_event_info_t * p_usb_event_info, usb_hdl_t
 }
 
 #endif
+
+/*******************************************************************************************************************//**
+ * Reads or writes sectors of the device.
+ *
+ * @param[in]  p_instance_ctrl         Pointer to instance control block
+ * @param[in]  write                   True to write, false to read
+ * @param[in]  p_buffer                Sector data
+ * @param[in]  sector                  First sector to transfer
+ * @param[in]  num_sectors             Number of sectors to transfer
+ *
+ * @retval     FSP_SUCCESS             Transfer complete.
+ * @return See @ref RENESAS_ERROR_CODES or functions called by this function for other possible return codes.
+ *         This function calls:
+ *             * @ref R_USB_HMSC_DriveNumberGet
+ *             * @ref R_USB_HMSC_StorageReadSector
+ *             * @ref R_USB_HMSC_StorageWriteSector
+ **********************************************************************************************************************/
+static fsp_err_t rm_block_media_usb_transfer (rm_block_media_usb_instance_ctrl_t * p_instance_ctrl,
+                                              bool                                 write,
+                                              uint8_t                            * p_buffer,
+                                              uint32_t                             sector,
+                                              uint32_t                             num_sectors)
+{
+    rm_block_media_usb_extended_cfg_t * p_extended_cfg =
+        (rm_block_media_usb_extended_cfg_t *) p_instance_ctrl->p_cfg->p_extend;
+    usb_instance_t * p_usb = (usb_instance_t *) p_extended_cfg->p_usb;
+
+    uint8_t   p_drive;
+    fsp_err_t err = R_USB_HMSC_DriveNumberGet(p_usb->p_ctrl, &p_drive, p_instance_ctrl->device_address);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+    if (write)
+    {
+        rm_block_media_usb_read_ahead_invalidate(p_instance_ctrl, sector, num_sectors);
+        err = R_USB_HMSC_StorageWriteSector(p_drive, p_buffer, sector, (uint16_t) num_sectors);
+    }
+    else
+    {
+        /* Gathered sectors are newer than the device. */
+        if ((sector < (p_instance_ctrl->write_first + p_instance_ctrl->write_count)) &&
+            (p_instance_ctrl->write_first < (sector + num_sectors)))
+        {
+            err = rm_block_media_usb_write_flush(p_instance_ctrl);
+            FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+        }
+
+        err = R_USB_HMSC_StorageReadSector(p_drive, p_buffer, sector, (uint16_t) num_sectors);
+    }
+
+    return err;
+}
+
+/*******************************************************************************************************************//**
+ * Reads or writes sectors for the cache. Reads go through the read-ahead buffer and writes through the write buffer.
+ *
+ * @param[in]  p_ctrl                  Pointer to instance control block
+ * @param[in]  write                   True to write, false to read
+ * @param[in]  p_buffer                Sector data
+ * @param[in]  sector                  First sector to transfer
+ * @param[in]  num_sectors             Number of sectors to transfer
+ *
+ * @retval     FSP_SUCCESS             Transfer complete.
+ * @return See @ref RENESAS_ERROR_CODES or functions called by this function for other possible return codes.
+ *         This function calls:
+ *             * @ref R_USB_HMSC_StorageReadSector
+ *             * @ref R_USB_HMSC_StorageWriteSector
+ **********************************************************************************************************************/
+static fsp_err_t rm_block_media_usb_cache_transfer (rm_block_media_ctrl_t * const p_ctrl,
+                                                    bool                          write,
+                                                    uint8_t                     * p_buffer,
+                                                    uint32_t                      sector,
+                                                    uint32_t                      num_sectors)
+{
+    rm_block_media_usb_instance_ctrl_t * p_instance_ctrl = (rm_block_media_usb_instance_ctrl_t *) p_ctrl;
+
+    if (write)
+    {
+        return rm_block_media_usb_write_gather(p_instance_ctrl, p_buffer, sector, num_sectors);
+    }
+
+    return rm_block_media_usb_read_ahead(p_instance_ctrl,
+                                         p_buffer,
+                                         sector,
+                                         num_sectors,
+                                         p_instance_ctrl->read_sequential);
+}
+
+/*******************************************************************************************************************//**
+ * Writes all dirty sectors in the cache and the write buffer to the device.
+ *
+ * @param[in]  p_instance_ctrl         Pointer to instance control block
+ *
+ * @retval     FSP_SUCCESS             No dirty sectors remain.
+ * @return See @ref RENESAS_ERROR_CODES or functions called by this function for other possible return codes.
+ *         This function calls:
+ *             * @ref R_USB_HMSC_StorageWriteSector
+ **********************************************************************************************************************/
+static fsp_err_t rm_block_media_usb_sync (rm_block_media_usb_instance_ctrl_t * p_instance_ctrl)
+{
+    fsp_err_t err = rm_block_media_cache_sync(&p_instance_ctrl->cache);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+    return rm_block_media_usb_write_flush(p_instance_ctrl);
+}
+
+/*******************************************************************************************************************//**
+ * Reports completion of a cached read or write to the user.
+ *
+ * @param[in] p_instance_ctrl          Pointer to instance control block
+ * @param[in] err                      Result of the operation
+ **********************************************************************************************************************/
+static void rm_block_media_usb_cache_complete (rm_block_media_usb_instance_ctrl_t * p_instance_ctrl, fsp_err_t err)
+{
+    rm_block_media_callback_args_t args;
+    memset(&args, 0U, sizeof(rm_block_media_callback_args_t));
+    args.p_context = p_instance_ctrl->p_cfg->p_context;
+    args.event     = (FSP_SUCCESS == err) ? RM_BLOCK_MEDIA_EVENT_OPERATION_COMPLETE : RM_BLOCK_MEDIA_EVENT_ERROR;
+    p_instance_ctrl->p_cfg->p_callback(&args);
+}
+
+/*******************************************************************************************************************//**
+ * Reads sectors from the device through the read-ahead buffer. Sectors in the buffer are copied from it. When a
+ * sequential read misses the buffer and is shorter than the buffer, the buffer is refilled starting at the missing
+ * sector with one multi-block read. Other reads go directly to the destination.
+ *
+ * @param[in]  p_instance_ctrl         Pointer to instance control block
+ * @param[out] p_dest                  Destination buffer
+ * @param[in]  sector                  First sector to read
+ * @param[in]  num_sectors             Number of sectors to read
+ * @param[in]  sequential              True if the read continues the previous read
+ *
+ * @retval     FSP_SUCCESS             Data read.
+ * @return See @ref RENESAS_ERROR_CODES or functions called by this function for other possible return codes.
+ *         This function calls:
+ *             * @ref R_USB_HMSC_StorageReadSector
+ **********************************************************************************************************************/
+static fsp_err_t rm_block_media_usb_read_ahead (rm_block_media_usb_instance_ctrl_t * p_instance_ctrl,
+                                                uint8_t                            * p_dest,
+                                                uint32_t                             sector,
+                                                uint32_t                             num_sectors,
+                                                bool                                 sequential)
+{
+    rm_block_media_usb_extended_cfg_t * p_extended_cfg =
+        (rm_block_media_usb_extended_cfg_t *) p_instance_ctrl->p_cfg->p_extend;
+    uint32_t  size = p_instance_ctrl->sector_size_bytes;
+    fsp_err_t err;
+
+    uint32_t i = 0U;
+    while (i < num_sectors)
+    {
+        uint32_t first  = p_instance_ctrl->read_ahead_first;
+        uint32_t offset = (sector + i) - first;
+        if (((sector + i) >= first) && (offset < p_instance_ctrl->read_ahead_count))
+        {
+            uint32_t count = p_instance_ctrl->read_ahead_count - offset;
+            if (count > (num_sectors - i))
+            {
+                count = num_sectors - i;
+            }
+
+            memcpy(&p_dest[i * size], &p_extended_cfg->p_read_ahead_buffer[offset * size], count * size);
+            i += count;
+            continue;
+        }
+
+        uint32_t remaining = num_sectors - i;
+        if (!sequential || (remaining >= p_extended_cfg->read_ahead_sectors) ||
+            ((sector + i + p_extended_cfg->read_ahead_sectors) > p_instance_ctrl->sector_count))
+        {
+            /* Long, random or end of device reads are not worth buffering. */
+            return rm_block_media_usb_transfer(p_instance_ctrl, false, &p_dest[i * size], sector + i, remaining);
+        }
+
+        p_instance_ctrl->read_ahead_count = 0U;
+        err = rm_block_media_usb_transfer(p_instance_ctrl,
+                                          false,
+                                          p_extended_cfg->p_read_ahead_buffer,
+                                          sector + i,
+                                          p_extended_cfg->read_ahead_sectors);
+        FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+        p_instance_ctrl->read_ahead_first = sector + i;
+        p_instance_ctrl->read_ahead_count = p_extended_cfg->read_ahead_sectors;
+    }
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Discards the read-ahead buffer if it holds any of the sectors about to be written.
+ *
+ * @param[in]  p_instance_ctrl         Pointer to instance control block
+ * @param[in]  sector                  First sector written
+ * @param[in]  num_sectors             Number of sectors written
+ **********************************************************************************************************************/
+static void rm_block_media_usb_read_ahead_invalidate (rm_block_media_usb_instance_ctrl_t * p_instance_ctrl,
+                                                      uint32_t                             sector,
+                                                      uint32_t                             num_sectors)
+{
+    if ((sector < (p_instance_ctrl->read_ahead_first + p_instance_ctrl->read_ahead_count)) &&
+        (p_instance_ctrl->read_ahead_first < (sector + num_sectors)))
+    {
+        p_instance_ctrl->read_ahead_count = 0U;
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Writes sectors through the write buffer. A write that continues the sectors in the buffer is appended to them, and a
+ * write inside them replaces their data. Otherwise the buffer is written to the device first. Writes that do not fit in
+ * the buffer go directly to the device. The buffer is written with one multi-block write when it is full.
+ *
+ * @param[in]  p_instance_ctrl         Pointer to instance control block
+ * @param[in]  p_src                   Source data
+ * @param[in]  sector                  First sector to write
+ * @param[in]  num_sectors             Number of sectors to write
+ *
+ * @retval     FSP_SUCCESS             Data written to the write buffer or the device.
+ * @return See @ref RENESAS_ERROR_CODES or functions called by this function for other possible return codes.
+ *         This function calls:
+ *             * @ref R_USB_HMSC_StorageWriteSector
+ **********************************************************************************************************************/
+static fsp_err_t rm_block_media_usb_write_gather (rm_block_media_usb_instance_ctrl_t * p_instance_ctrl,
+                                                  uint8_t const                      * p_src,
+                                                  uint32_t                             sector,
+                                                  uint32_t                             num_sectors)
+{
+    rm_block_media_usb_extended_cfg_t * p_extended_cfg =
+        (rm_block_media_usb_extended_cfg_t *) p_instance_ctrl->p_cfg->p_extend;
+    uint32_t  size  = p_instance_ctrl->sector_size_bytes;
+    uint32_t  first = p_instance_ctrl->write_first;
+    uint32_t  count = p_instance_ctrl->write_count;
+    fsp_err_t err;
+
+    if ((count > 0U) && (sector >= first) && ((sector + num_sectors) <= (first + count)))
+    {
+        /* Rewrites of buffered sectors, typical for file system tables, only update the buffer. */
+        rm_block_media_usb_read_ahead_invalidate(p_instance_ctrl, sector, num_sectors);
+        memcpy(&p_extended_cfg->p_write_buffer[(sector - first) * size], p_src, num_sectors * size);
+
+        return FSP_SUCCESS;
+    }
+
+    if ((count > 0U) &&
+        ((sector != (first + count)) || ((count + num_sectors) > p_extended_cfg->write_buffer_sectors)))
+    {
+        err = rm_block_media_usb_write_flush(p_instance_ctrl);
+        FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+    }
+
+    if (num_sectors >= p_extended_cfg->write_buffer_sectors)
+    {
+        /* Long writes are not worth buffering. */
+        return rm_block_media_usb_transfer(p_instance_ctrl, true, (uint8_t *) p_src, sector, num_sectors);
+    }
+
+    if (0U == p_instance_ctrl->write_count)
+    {
+        p_instance_ctrl->write_first = sector;
+    }
+
+    rm_block_media_usb_read_ahead_invalidate(p_instance_ctrl, sector, num_sectors);
+    memcpy(&p_extended_cfg->p_write_buffer[p_instance_ctrl->write_count * size], p_src, num_sectors * size);
+    p_instance_ctrl->write_count += num_sectors;
+
+    if (p_instance_ctrl->write_count == p_extended_cfg->write_buffer_sectors)
+    {
+        return rm_block_media_usb_write_flush(p_instance_ctrl);
+    }
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Writes the sectors in the write buffer to the device with one multi-block write.
+ *
+ * @param[in]  p_instance_ctrl         Pointer to instance control block
+ *
+ * @retval     FSP_SUCCESS             The write buffer is empty.
+ * @return See @ref RENESAS_ERROR_CODES or functions called by this function for other possible return codes.
+ *         This function calls:
+ *             * @ref R_USB_HMSC_StorageWriteSector
+ **********************************************************************************************************************/
+static fsp_err_t rm_block_media_usb_write_flush (rm_block_media_usb_instance_ctrl_t * p_instance_ctrl)
+{
+    rm_block_media_usb_extended_cfg_t * p_extended_cfg =
+        (rm_block_media_usb_extended_cfg_t *) p_instance_ctrl->p_cfg->p_extend;
+    uint32_t count = p_instance_ctrl->write_count;
+
+    if (0U == count)
+    {
+        return FSP_SUCCESS;
+    }
+
+    /* The buffer is emptied even if the write fails so a removed device does not block later writes. */
+    p_instance_ctrl->write_count = 0U;
+
+    return rm_block_media_usb_transfer(p_instance_ctrl,
+                                       true,
+                                       p_extended_cfg->p_write_buffer,
+                                       p_instance_ctrl->write_first,
+                                       count);
+}
@@ -0,0 +1,318 @@
+/***********************************************************************************************************************
+ * Copyright [2020] Renesas Electronics Corporation and/or its affiliates.  All Rights Reserved.
+ *
+ * This software and documentation are supplied by Renesas Electronics America Inc. and may only be used with products
+ * of Renesas Electronics Corp. and its affiliates ("Renesas").  No other uses are authorized.  Renesas products are
+ * sold pursuant to Renesas terms and conditions of sale.  Purchasers are solely responsible for the selection and use
+ * of Renesas products and Renesas assumes no liability.  No license, express or implied, to any intellectual property
+ * right is granted by Renesas. This software is protected under all applicable laws, including copyright laws. Renesas
+ * reserves the right to change or discontinue this software and/or this documentation. THE SOFTWARE AND DOCUMENTATION
+ * IS DELIVERED TO YOU "AS IS," AND RENESAS MAKES NO REPRESENTATIONS OR WARRANTIES, AND TO THE FULLEST EXTENT
+ * PERMISSIBLE UNDER APPLICABLE LAW, DISCLAIMS ALL WARRANTIES, WHETHER EXPLICITLY OR IMPLICITLY, INCLUDING WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, AND NONINFRINGEMENT, WITH RESPECT TO THE SOFTWARE OR
+ * DOCUMENTATION.  RENESAS SHALL HAVE NO LIABILITY ARISING OUT OF ANY SECURITY VULNERABILITY OR BREACH.  TO THE MAXIMUM
+ * EXTENT PERMITTED BY LAW, IN NO EVENT WILL RENESAS BE LIABLE TO YOU IN CONNECTION WITH THE SOFTWARE OR DOCUMENTATION
+ * (OR ANY PERSON OR ENTITY CLAIMING RIGHTS DERIVED FROM YOU) FOR ANY LOSS, DAMAGES, OR CLAIMS WHATSOEVER, INCLUDING,
+ * WITHOUT LIMITATION, ANY DIRECT, CONSEQUENTIAL, SPECIAL, INDIRECT, PUNITIVE, OR INCIDENTAL DAMAGES; ANY LOST PROFITS,
+ * OTHER ECONOMIC DAMAGE, PROPERTY DAMAGE, OR PERSONAL INJURY; AND EVEN IF RENESAS HAS BEEN ADVISED OF THE POSSIBILITY
+ * OF SUCH LOSS, DAMAGES, CLAIMS OR COSTS.
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Includes
+ **********************************************************************************************************************/
+#include <string.h>
+#include "rm_callback_defer.h"
+
+/***********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+
+/* "CBDF" in ASCII. */
+#define RM_CALLBACK_DEFER_OPEN    (0x43424446U)
+
+/***********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+
+/* Queued event. Coalesced events keep their arguments in the client instead. */
+typedef struct st_rm_callback_defer_event
+{
+    rm_callback_defer_client_t * p_client;
+    uint32_t                     args[(RM_CALLBACK_DEFER_CFG_ARGS_MAX_BYTES + 3U) / 4U];
+} rm_callback_defer_event_t;
+
+/***********************************************************************************************************************
+ * Private function prototypes
+ **********************************************************************************************************************/
+static void rm_callback_defer_task(void * pvParameters);
+static void rm_callback_defer_queues_delete(rm_callback_defer_instance_ctrl_t * const p_ctrl);
+
+/***********************************************************************************************************************
+ * Private global variables
+ **********************************************************************************************************************/
+
+/** Version data structure. */
+static const fsp_version_t g_rm_callback_defer_version =
+{
+    .api_version_minor  = RM_CALLBACK_DEFER_CODE_VERSION_MINOR,
+    .api_version_major  = RM_CALLBACK_DEFER_CODE_VERSION_MAJOR,
+    .code_version_major = RM_CALLBACK_DEFER_CODE_VERSION_MAJOR,
+    .code_version_minor = RM_CALLBACK_DEFER_CODE_VERSION_MINOR
+};
+
+/*******************************************************************************************************************//**
+ * @addtogroup RM_CALLBACK_DEFER
+ * @{
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Functions
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * Creates the deferred-work queues and the worker task that calls the callbacks of the clients defined with
+ * RM_CALLBACK_DEFER_CLIENT_DEFINE. Driver ISRs of the clients must have a priority that is allowed to call FreeRTOS
+ * FromISR functions (configMAX_SYSCALL_INTERRUPT_PRIORITY). Control ISRs that keep calling their callbacks directly,
+ * such as GPT or ADC, are not affected by the work done in the deferred callbacks.
+ *
+ * @retval     FSP_SUCCESS                    Module is open and the worker task is created.
+ * @retval     FSP_ERR_ASSERTION              An input parameter is invalid.
+ * @retval     FSP_ERR_ALREADY_OPEN           Module has already been opened with this instance of the control
+ *                                            structure.
+ * @retval     FSP_ERR_OUT_OF_MEMORY          The FreeRTOS heap cannot hold the queues or the worker task.
+ **********************************************************************************************************************/
+fsp_err_t RM_CALLBACK_DEFER_Open (rm_callback_defer_instance_ctrl_t * const p_ctrl,
+                                  rm_callback_defer_cfg_t const * const     p_cfg)
+{
+#if RM_CALLBACK_DEFER_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ASSERT(NULL != p_cfg);
+    FSP_ASSERT(0U != p_cfg->stack_words);
+    FSP_ERROR_RETURN(RM_CALLBACK_DEFER_OPEN != p_ctrl->open, FSP_ERR_ALREADY_OPEN);
+#endif
+
+    p_ctrl->p_cfg = p_cfg;
+    p_ctrl->task  = NULL;
+
+    for (uint32_t i = 0U; i < RM_CALLBACK_DEFER_CFG_PRIORITIES; i++)
+    {
+        p_ctrl->queue[i] = NULL;
+        if (0U != p_cfg->queue_length[i])
+        {
+            p_ctrl->queue[i] = xQueueCreate((UBaseType_t) p_cfg->queue_length[i], sizeof(rm_callback_defer_event_t));
+            if (NULL == p_ctrl->queue[i])
+            {
+                rm_callback_defer_queues_delete(p_ctrl);
+
+                return FSP_ERR_OUT_OF_MEMORY;
+            }
+        }
+    }
+
+    /* Mark the instance open first, the worker task may run as soon as it is created. */
+    p_ctrl->open = RM_CALLBACK_DEFER_OPEN;
+
+    if (pdPASS !=
+        xTaskCreate(rm_callback_defer_task, p_cfg->p_name, (configSTACK_DEPTH_TYPE) p_cfg->stack_words, p_ctrl,
+                    p_cfg->task_priority, &p_ctrl->task))
+    {
+        p_ctrl->open = 0U;
+        rm_callback_defer_queues_delete(p_ctrl);
+
+        return FSP_ERR_OUT_OF_MEMORY;
+    }
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Queues a driver callback for the worker task. Called from the callback defined by RM_CALLBACK_DEFER_CLIENT_DEFINE,
+ * in the driver ISR. Events are dropped and counted if the instance is not open, or if the queue of the client
+ * priority is full or disabled.
+ *
+ * @param[in]  p_client             Client posting the event.
+ * @param[in]  p_args               Driver callback arguments, copied before returning.
+ **********************************************************************************************************************/
+void RM_CALLBACK_DEFER_Post (rm_callback_defer_client_t * const p_client, void const * const p_args)
+{
+    rm_callback_defer_instance_ctrl_t * p_ctrl = p_client->p_ctrl;
+    rm_callback_defer_event_t           event;
+    BaseType_t woken = pdFALSE;
+
+    p_client->status.posted++;
+
+    if ((RM_CALLBACK_DEFER_OPEN != p_ctrl->open) || (p_client->priority >= RM_CALLBACK_DEFER_CFG_PRIORITIES) ||
+        (NULL == p_ctrl->queue[p_client->priority]))
+    {
+        p_client->status.dropped++;
+
+        return;
+    }
+
+    event.p_client = p_client;
+
+    if (p_client->coalesce)
+    {
+        FSP_CRITICAL_SECTION_DEFINE;
+        FSP_CRITICAL_SECTION_ENTER;
+        memcpy(p_client->latest, p_args, p_client->args_size);
+        bool pending = p_client->pending;
+        p_client->pending = true;
+        FSP_CRITICAL_SECTION_EXIT;
+
+        if (pending)
+        {
+            p_client->status.coalesced++;
+
+            return;
+        }
+    }
+    else
+    {
+        memcpy(event.args, p_args, p_client->args_size);
+    }
+
+    if (pdPASS != xQueueSendFromISR(p_ctrl->queue[p_client->priority], &event, &woken))
+    {
+        p_client->pending = false;
+        p_client->status.dropped++;
+
+        return;
+    }
+
+    vTaskNotifyGiveFromISR(p_ctrl->task, &woken);
+    portYIELD_FROM_ISR(woken);
+}
+
+/*******************************************************************************************************************//**
+ * Gets the event counters of a client.
+ *
+ * @param[in]  p_client             Client defined with RM_CALLBACK_DEFER_CLIENT_DEFINE, name ## _client.
+ * @param[out] p_status             Event counters.
+ *
+ * @retval     FSP_SUCCESS                    Counters stored.
+ * @retval     FSP_ERR_ASSERTION              An input parameter is invalid.
+ **********************************************************************************************************************/
+fsp_err_t RM_CALLBACK_DEFER_StatusGet (rm_callback_defer_client_t * const        p_client,
+                                       rm_callback_defer_client_status_t * const p_status)
+{
+#if RM_CALLBACK_DEFER_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_client);
+    FSP_ASSERT(NULL != p_status);
+#endif
+
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+    *p_status = p_client->status;
+    FSP_CRITICAL_SECTION_EXIT;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Deletes the worker task and the queues. Events still queued are discarded. Set the callbacks of the clients back to
+ * direct callbacks first, events posted afterwards are dropped.
+ *
+ * @retval     FSP_SUCCESS                    Module is closed.
+ * @retval     FSP_ERR_ASSERTION              p_ctrl is NULL.
+ * @retval     FSP_ERR_NOT_OPEN               The instance control structure is not opened.
+ **********************************************************************************************************************/
+fsp_err_t RM_CALLBACK_DEFER_Close (rm_callback_defer_instance_ctrl_t * const p_ctrl)
+{
+#if RM_CALLBACK_DEFER_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ERROR_RETURN(RM_CALLBACK_DEFER_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+
+    p_ctrl->open = 0U;
+
+    vTaskDelete(p_ctrl->task);
+    p_ctrl->task = NULL;
+
+    rm_callback_defer_queues_delete(p_ctrl);
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Gets the version of this module.
+ *
+ * @retval     FSP_SUCCESS                    Version stored.
+ * @retval     FSP_ERR_ASSERTION              p_version is NULL.
+ **********************************************************************************************************************/
+fsp_err_t RM_CALLBACK_DEFER_VersionGet (fsp_version_t * const p_version)
+{
+#if RM_CALLBACK_DEFER_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_version);
+#endif
+
+    p_version->version_id = g_rm_callback_defer_version.version_id;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @} (end addtogroup RM_CALLBACK_DEFER)
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Private Functions
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * Worker task. Each event posted gives one notification, and each notification serves one event from the highest
+ * priority queue that is not empty, so a burst of low priority events does not delay a high priority one by more than
+ * the callback already running.
+ *
+ * @param[in]  pvParameters         Instance control structure.
+ **********************************************************************************************************************/
+static void rm_callback_defer_task (void * pvParameters)
+{
+    rm_callback_defer_instance_ctrl_t * p_ctrl = (rm_callback_defer_instance_ctrl_t *) pvParameters;
+    rm_callback_defer_event_t           event;
+
+    for ( ; ; )
+    {
+        (void) ulTaskNotifyTake(pdFALSE, portMAX_DELAY);
+
+        for (uint32_t i = 0U; i < RM_CALLBACK_DEFER_CFG_PRIORITIES; i++)
+        {
+            if ((NULL != p_ctrl->queue[i]) && (pdPASS == xQueueReceive(p_ctrl->queue[i], &event, 0)))
+            {
+                rm_callback_defer_client_t * p_client = event.p_client;
+
+                if (p_client->coalesce)
+                {
+                    /* Take the latest arguments and let the next event queue again. */
+                    FSP_CRITICAL_SECTION_DEFINE;
+                    FSP_CRITICAL_SECTION_ENTER;
+                    memcpy(event.args, p_client->latest, p_client->args_size);
+                    p_client->pending = false;
+                    FSP_CRITICAL_SECTION_EXIT;
+                }
+
+                p_client->p_dispatch(event.args);
+
+                break;
+            }
+        }
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Deletes the queues that were created.
+ *
+ * @param[in]  p_ctrl               Instance control structure.
+ **********************************************************************************************************************/
+static void rm_callback_defer_queues_delete (rm_callback_defer_instance_ctrl_t * const p_ctrl)
+{
+    for (uint32_t i = 0U; i < RM_CALLBACK_DEFER_CFG_PRIORITIES; i++)
+    {
+        if (NULL != p_ctrl->queue[i])
+        {
+            vQueueDelete(p_ctrl->queue[i]);
+            p_ctrl->queue[i] = NULL;
+        }
+    }
+}
@@ -0,0 +1,610 @@
+/***********************************************************************************************************************
+ * Copyright [2020] Renesas Electronics Corporation and/or its affiliates.  All Rights Reserved.
+ *
+ * This software and documentation are supplied by Renesas Electronics America Inc. and may only be used with products
+ * of Renesas Electronics Corp. and its affiliates ("Renesas").  No other uses are authorized.  Renesas products are
+ * sold pursuant to Renesas terms and conditions of sale.  Purchasers are solely responsible for the selection and use
+ * of Renesas products and Renesas assumes no liability.  No license, express or implied, to any intellectual property
+ * right is granted by Renesas. This software is protected under all applicable laws, including copyright laws. Renesas
+ * reserves the right to change or discontinue this software and/or this documentation. THE SOFTWARE AND DOCUMENTATION
+ * IS DELIVERED TO YOU "AS IS," AND RENESAS MAKES NO REPRESENTATIONS OR WARRANTIES, AND TO THE FULLEST EXTENT
+ * PERMISSIBLE UNDER APPLICABLE LAW, DISCLAIMS ALL WARRANTIES, WHETHER EXPLICITLY OR IMPLICITLY, INCLUDING WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, AND NONINFRINGEMENT, WITH RESPECT TO THE SOFTWARE OR
+ * DOCUMENTATION.  RENESAS SHALL HAVE NO LIABILITY ARISING OUT OF ANY SECURITY VULNERABILITY OR BREACH.  TO THE MAXIMUM
+ * EXTENT PERMITTED BY LAW, IN NO EVENT WILL RENESAS BE LIABLE TO YOU IN CONNECTION WITH THE SOFTWARE OR DOCUMENTATION
+ * (OR ANY PERSON OR ENTITY CLAIMING RIGHTS DERIVED FROM YOU) FOR ANY LOSS, DAMAGES, OR CLAIMS WHATSOEVER, INCLUDING,
+ * WITHOUT LIMITATION, ANY DIRECT, CONSEQUENTIAL, SPECIAL, INDIRECT, PUNITIVE, OR INCIDENTAL DAMAGES; ANY LOST PROFITS,
+ * OTHER ECONOMIC DAMAGE, PROPERTY DAMAGE, OR PERSONAL INJURY; AND EVEN IF RENESAS HAS BEEN ADVISED OF THE POSSIBILITY
+ * OF SUCH LOSS, DAMAGES, CLAIMS OR COSTS.
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Includes
+ **********************************************************************************************************************/
+#include <string.h>
+#include "rm_drw_benchmark.h"
+
+/***********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+#define RM_DRW_BENCHMARK_US_PER_S               (1000000U)
+#define RM_DRW_BENCHMARK_PERMILLE               (1000U)
+#define RM_DRW_BENCHMARK_FRAME_RATE_DEFAULT     (60U)
+
+/* D/AVE 2D points and widths have 4 fractional bits, texture coordinates 16. */
+#define RM_DRW_BENCHMARK_POINT_SHIFT            (4U)
+#define RM_DRW_BENCHMARK_TEXEL_SHIFT            (16U)
+
+/* Strides that spread the primitives of a frame over the frame buffer without a visible pattern. */
+#define RM_DRW_BENCHMARK_STRIDE_X               (97U)
+#define RM_DRW_BENCHMARK_STRIDE_Y               (61U)
+
+#define RM_DRW_BENCHMARK_ALPHA_OPAQUE           (0xFFU)
+#define RM_DRW_BENCHMARK_ALPHA_HALF             (0x80U)
+#define RM_DRW_BENCHMARK_COLOR                  (0x3080F0U)
+
+/* Render buffer entries allocated up front and per extension. */
+#define RM_DRW_BENCHMARK_RBUFFER_INITIAL        (1024U)
+#define RM_DRW_BENCHMARK_RBUFFER_STEP           (1024U)
+
+/***********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+
+/* State of a benchmark run. */
+typedef struct st_rm_drw_benchmark_ctx
+{
+    rm_drw_benchmark_cfg_t const * p_cfg;
+    d2_renderbuffer              * p_rbuffer; // Render buffer the frames are recorded in
+    bsp_cycle_counter_get_t        p_cycles_get;
+    uint32_t cycles_per_us;
+    uint32_t frame_cycles;             // Frame period the budgets are given for
+    bool     perf_valid;               // D/AVE 2D has performance counters
+    rm_drw_benchmark_result_t result;
+} rm_drw_benchmark_ctx_t;
+
+/***********************************************************************************************************************
+ * Private function prototypes
+ **********************************************************************************************************************/
+static void      rm_drw_benchmark_test_run(rm_drw_benchmark_ctx_t * p_ctx);
+static fsp_err_t rm_drw_benchmark_frames_run(rm_drw_benchmark_ctx_t * p_ctx);
+static fsp_err_t rm_drw_benchmark_state_set(rm_drw_benchmark_ctx_t * p_ctx);
+static fsp_err_t rm_drw_benchmark_primitive(rm_drw_benchmark_ctx_t * p_ctx, uint32_t index);
+static uint32_t  rm_drw_benchmark_pixels(rm_drw_benchmark_test_t const * p_test);
+static uint32_t  rm_drw_benchmark_isqrt(uint32_t value);
+static bool      rm_drw_benchmark_op_uses_source(rm_drw_benchmark_op_t op);
+
+/***********************************************************************************************************************
+ * Private global variables
+ **********************************************************************************************************************/
+static const char * const g_drw_benchmark_op_names[] =
+{
+    [RM_DRW_BENCHMARK_OP_FILL]              = "fill",
+    [RM_DRW_BENCHMARK_OP_BLIT]              = "blit",
+    [RM_DRW_BENCHMARK_OP_TEXTURED_TRIANGLE] = "textri",
+    [RM_DRW_BENCHMARK_OP_AA_TRIANGLE]       = "aa-tri",
+    [RM_DRW_BENCHMARK_OP_AA_CIRCLE]         = "aa-circle",
+    [RM_DRW_BENCHMARK_OP_AA_LINE]           = "aa-line",
+};
+
+static const char * const g_drw_benchmark_blend_names[] =
+{
+    [RM_DRW_BENCHMARK_BLEND_OPAQUE]       = "opaque",
+    [RM_DRW_BENCHMARK_BLEND_SRC_ALPHA]    = "src-a",
+    [RM_DRW_BENCHMARK_BLEND_GLOBAL_ALPHA] = "glob-a",
+};
+
+/*******************************************************************************************************************//**
+ * @addtogroup RM_DRW_BENCHMARK
+ * @{
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Functions
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * Runs every test on every target, and every test that reads a source once per source, and passes each measurement
+ * to p_cfg->p_callback. The rows printed with RM_DRW_BENCHMARK_Format() give the cost of each effect as a share of
+ * the frame period and the number of such primitives that fit in one frame.
+ *
+ * Each frame is recorded into a render buffer and then executed alone on the D/AVE 2D, so the render time is the
+ * execution time of the display list and the record time is the CPU time spent issuing the d2 commands. The first
+ * D/AVE 2D performance counter counts active D/AVE 2D cycles and the second counts p_cfg->perf_event, e.g.
+ * d2_pc_texreadmisses to see the texture cache behaviour of a source.
+ *
+ * Placing the same image in SRAM, SDRAM and QSPI flash as separate sources, and the frame buffers in SRAM and SDRAM
+ * as separate targets, gives the cost of each memory. Keep the GLCDC scanning out the layers the application will use
+ * while the benchmark runs, so the results include the display bandwidth.
+ *
+ * The benchmark renders with its own D/AVE 2D context and render buffer and restores the selected context; the frame
+ * buffer must be set again with d2_framebuffer() afterwards. The contents of the targets are destroyed. This function
+ * blocks and must not be called from an interrupt.
+ *
+ * @retval FSP_SUCCESS                    All measurements were reported.
+ * @retval FSP_ERR_ASSERTION              A required pointer is NULL or no tests or targets were given.
+ * @retval FSP_ERR_UNSUPPORTED            No cycle counter, see R_BSP_CycleCounterSelect().
+ * @retval FSP_ERR_INVALID_HW_CONDITION   D/AVE 2D returned an error while setting up.
+ **********************************************************************************************************************/
+fsp_err_t RM_DRW_BENCHMARK_Run (rm_drw_benchmark_cfg_t const * const p_cfg)
+{
+    rm_drw_benchmark_ctx_t ctx;
+    fsp_err_t              err;
+
+#if BSP_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(p_cfg);
+    FSP_ASSERT(p_cfg->p_d2);
+    FSP_ASSERT(p_cfg->p_tests);
+    FSP_ASSERT(p_cfg->num_tests);
+    FSP_ASSERT(p_cfg->p_targets);
+    FSP_ASSERT(p_cfg->num_targets);
+    FSP_ASSERT(p_cfg->p_sources || (0U == p_cfg->num_sources));
+    FSP_ASSERT(p_cfg->p_callback);
+#endif
+
+    d2_device * p_d2 = p_cfg->p_d2;
+
+    memset(&ctx, 0, sizeof(ctx));
+    err = R_BSP_CycleCounterSelect(p_cfg->p_cycles_get, &ctx.p_cycles_get);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+    uint32_t frame_rate = (0U != p_cfg->frame_rate_hz) ? p_cfg->frame_rate_hz : RM_DRW_BENCHMARK_FRAME_RATE_DEFAULT;
+    ctx.p_cfg         = p_cfg;
+    ctx.cycles_per_us = SystemCoreClock / RM_DRW_BENCHMARK_US_PER_S;
+    ctx.frame_cycles  = SystemCoreClock / frame_rate;
+    ctx.perf_valid    = (0U != (d2_getrevisionhw(p_d2) & D2FB_PERFCOUNT));
+
+    /* The counters can only be reconfigured while the D/AVE 2D is idle. */
+    if (ctx.perf_valid)
+    {
+        FSP_ERROR_RETURN(D2_OK == d2_setperfcountevent(p_d2, 0U, d2_pc_davecycles), FSP_ERR_INVALID_HW_CONDITION);
+        FSP_ERROR_RETURN(D2_OK == d2_setperfcountevent(p_d2, 1U, p_cfg->perf_event), FSP_ERR_INVALID_HW_CONDITION);
+    }
+
+    d2_context * p_previous = d2_getcontext(p_d2, d2_context_selected);
+    d2_context * p_context  = d2_newcontext(p_d2);
+    FSP_ERROR_RETURN(NULL != p_context, FSP_ERR_INVALID_HW_CONDITION);
+    ctx.p_rbuffer = d2_newrenderbuffer(p_d2, RM_DRW_BENCHMARK_RBUFFER_INITIAL, RM_DRW_BENCHMARK_RBUFFER_STEP);
+    if (NULL == ctx.p_rbuffer)
+    {
+        (void) d2_freecontext(p_d2, p_context);
+
+        return FSP_ERR_INVALID_HW_CONDITION;
+    }
+
+    (void) d2_selectcontext(p_d2, p_context);
+
+    for (uint32_t t = 0U; t < p_cfg->num_targets; t++)
+    {
+        for (uint32_t i = 0U; i < p_cfg->num_tests; i++)
+        {
+            ctx.result.p_target = &p_cfg->p_targets[t];
+            ctx.result.p_test   = &p_cfg->p_tests[i];
+
+            if (rm_drw_benchmark_op_uses_source(p_cfg->p_tests[i].op))
+            {
+                for (uint32_t s = 0U; s < p_cfg->num_sources; s++)
+                {
+                    ctx.result.p_source = &p_cfg->p_sources[s];
+                    rm_drw_benchmark_test_run(&ctx);
+                }
+            }
+            else
+            {
+                ctx.result.p_source = NULL;
+                rm_drw_benchmark_test_run(&ctx);
+            }
+        }
+    }
+
+    /* Return the device to the render buffer used by d2_startframe() and to the context of the application. */
+    (void) d2_selectrenderbuffer(p_d2, d2_getrenderbuffer(p_d2, 0));
+    (void) d2_freerenderbuffer(p_d2, ctx.p_rbuffer);
+    (void) d2_selectcontext(p_d2, p_previous);
+    (void) d2_freecontext(p_d2, p_context);
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Formats a measurement as one report row, or the column headings if p_result is NULL. Print the headings once,
+ * then one row per result.
+ *
+ * @return Row length as returned by R_BSP_ReportRowFormat().
+ **********************************************************************************************************************/
+int32_t RM_DRW_BENCHMARK_Format (rm_drw_benchmark_result_t const * const p_result,
+                                 char * const                             p_line,
+                                 uint32_t                                 line_size)
+{
+    if (NULL == p_result)
+    {
+        return R_BSP_ReportRowFormat(p_line, line_size, 0,
+                                     "%-14s %-9s %-6s %-8s %-16s %3s %9s %8s %8s %8s %8s %6s %7s %10s %10s",
+                                     "test", "op", "blend", "target", "source", "err", "px/frame", "rec_us", "gpu_us",
+                                     "max_us", "Mpx/s", "frame%", "n/frame", "d2 cycles", "perf");
+    }
+
+    rm_drw_benchmark_test_t const * p_test = p_result->p_test;
+
+    return R_BSP_ReportRowFormat(p_line, line_size, 0,
+                                 "%-14s %-9s %-6s %-8s %-16s %3d %9u %8u %8u %8u %4u.%03u %4u.%u %7u %10u %10u",
+                                 p_test->p_name, g_drw_benchmark_op_names[p_test->op],
+                                 g_drw_benchmark_blend_names[p_test->blend], p_result->p_target->p_name,
+                                 (NULL != p_result->p_source) ? p_result->p_source->p_name : "-",
+                                 (int) p_result->status, (unsigned) p_result->pixels, (unsigned) p_result->record_us,
+                                 (unsigned) p_result->render_us, (unsigned) p_result->render_max_us,
+                                 (unsigned) (p_result->kpixels_per_s / 1000U),
+                                 (unsigned) (p_result->kpixels_per_s % 1000U),
+                                 (unsigned) (p_result->frame_permille / 10U),
+                                 (unsigned) (p_result->frame_permille % 10U),
+                                 (unsigned) p_result->count_per_frame, (unsigned) p_result->dave_cycles,
+                                 (unsigned) p_result->perf_count);
+}
+
+/*******************************************************************************************************************//**
+ * @} (end addtogroup RM_DRW_BENCHMARK)
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Private Functions
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * Runs the test, target and source selected in the result and reports it.
+ **********************************************************************************************************************/
+static void rm_drw_benchmark_test_run (rm_drw_benchmark_ctx_t * p_ctx)
+{
+    rm_drw_benchmark_result_t       * p_result = &p_ctx->result;
+    rm_drw_benchmark_test_t const   * p_test   = p_result->p_test;
+    rm_drw_benchmark_target_t const * p_target = p_result->p_target;
+    rm_drw_benchmark_source_t const * p_source = p_result->p_source;
+
+    memset(p_result, 0, sizeof(rm_drw_benchmark_result_t));
+    p_result->p_test     = p_test;
+    p_result->p_target   = p_target;
+    p_result->p_source   = p_source;
+    p_result->perf_valid = p_ctx->perf_valid;
+    p_result->p_context  = p_ctx->p_cfg->p_context;
+    p_result->pixels     = rm_drw_benchmark_pixels(p_test);
+
+    /* Every primitive must fit in the frame buffer, and a circle needs its diameter in both directions. */
+    uint32_t height = (RM_DRW_BENCHMARK_OP_AA_CIRCLE == p_test->op) ? p_test->width : p_test->height;
+    if ((0U == p_test->width) || (0U == height) || (p_test->width > p_target->width) || (height > p_target->height))
+    {
+        p_result->status = FSP_ERR_INVALID_SIZE;
+    }
+    else
+    {
+        p_result->status = rm_drw_benchmark_frames_run(p_ctx);
+    }
+
+    p_ctx->p_cfg->p_callback(p_result);
+}
+
+/*******************************************************************************************************************//**
+ * Records and executes the frames of the current test and calculates the result.
+ *
+ * @retval FSP_SUCCESS                    All frames were rendered.
+ * @retval FSP_ERR_INVALID_HW_CONDITION   D/AVE 2D returned an error.
+ **********************************************************************************************************************/
+static fsp_err_t rm_drw_benchmark_frames_run (rm_drw_benchmark_ctx_t * p_ctx)
+{
+    rm_drw_benchmark_result_t     * p_result = &p_ctx->result;
+    rm_drw_benchmark_test_t const * p_test   = p_result->p_test;
+    d2_device                     * p_d2     = p_ctx->p_cfg->p_d2;
+    uint64_t record_cycles = 0U;
+    uint64_t render_cycles = 0U;
+    uint32_t render_max    = 0U;
+    uint64_t dave_cycles   = 0U;
+    uint64_t perf_count    = 0U;
+
+    for (uint32_t f = 0U; f < p_test->frames; f++)
+    {
+        /* The state is recorded in each frame, outside of the time measured, as a frame is executed alone. */
+        FSP_ERROR_RETURN(D2_OK == d2_selectrenderbuffer(p_d2, p_ctx->p_rbuffer), FSP_ERR_INVALID_HW_CONDITION);
+        fsp_err_t err = rm_drw_benchmark_state_set(p_ctx);
+        FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+        uint32_t start = p_ctx->p_cycles_get();
+        for (uint32_t i = 0U; i < p_test->count; i++)
+        {
+            err = rm_drw_benchmark_primitive(p_ctx, (f * p_test->count) + i);
+            FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+        }
+
+        record_cycles += p_ctx->p_cycles_get() - start;
+
+        if (p_ctx->perf_valid)
+        {
+            (void) d2_setperfcountvalue(p_d2, 0U, 0);
+            (void) d2_setperfcountvalue(p_d2, 1U, 0);
+        }
+
+        start = p_ctx->p_cycles_get();
+        FSP_ERROR_RETURN(D2_OK == d2_executerenderbuffer(p_d2, p_ctx->p_rbuffer, 0U), FSP_ERR_INVALID_HW_CONDITION);
+        FSP_ERROR_RETURN(D2_OK == d2_flushframe(p_d2), FSP_ERR_INVALID_HW_CONDITION);
+        uint32_t render = p_ctx->p_cycles_get() - start;
+
+        render_cycles += render;
+        render_max     = (render > render_max) ? render : render_max;
+
+        if (p_ctx->perf_valid)
+        {
+            dave_cycles += (uint32_t) d2_getperfcountvalue(p_d2, 0U);
+            perf_count  += (uint32_t) d2_getperfcountvalue(p_d2, 1U);
+        }
+
+        p_result->frames++;
+    }
+
+    if (p_result->frames > 0U)
+    {
+        uint64_t frames = p_result->frames;
+        p_result->record_us     = (uint32_t) (record_cycles / (frames * p_ctx->cycles_per_us));
+        p_result->render_us     = (uint32_t) (render_cycles / (frames * p_ctx->cycles_per_us));
+        p_result->render_max_us = render_max / p_ctx->cycles_per_us;
+        p_result->dave_cycles   = (uint32_t) (dave_cycles / frames);
+        p_result->perf_count    = (uint32_t) (perf_count / frames);
+
+        if (render_cycles > 0U)
+        {
+            p_result->kpixels_per_s = (uint32_t) (((uint64_t) p_result->pixels * frames * (SystemCoreClock / 1000U)) /
+                                                  render_cycles);
+            p_result->frame_permille = (uint32_t) ((render_cycles * RM_DRW_BENCHMARK_PERMILLE) /
+                                                   (frames * p_ctx->frame_cycles));
+            p_result->count_per_frame = (uint32_t) (((uint64_t) p_test->count * frames * p_ctx->frame_cycles) /
+                                                    render_cycles);
+        }
+    }
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Records the frame buffer, blending and source state of the current test.
+ *
+ * @retval FSP_SUCCESS                    State recorded.
+ * @retval FSP_ERR_INVALID_HW_CONDITION   D/AVE 2D returned an error, e.g. for a source format it does not support.
+ **********************************************************************************************************************/
+static fsp_err_t rm_drw_benchmark_state_set (rm_drw_benchmark_ctx_t * p_ctx)
+{
+    rm_drw_benchmark_test_t const   * p_test   = p_ctx->result.p_test;
+    rm_drw_benchmark_target_t const * p_target = p_ctx->result.p_target;
+    rm_drw_benchmark_source_t const * p_source = p_ctx->result.p_source;
+    d2_device * p_d2 = p_ctx->p_cfg->p_d2;
+    d2_s32      err  = d2_framebuffer(p_d2,
+                                      p_target->p_buffer,
+                                      (d2_s32) p_target->pitch,
+                                      p_target->width,
+                                      p_target->height,
+                                      (d2_s32) p_target->format);
+
+    bool opaque = (RM_DRW_BENCHMARK_BLEND_OPAQUE == p_test->blend);
+    bool aa     = (p_test->op >= RM_DRW_BENCHMARK_OP_AA_TRIANGLE);
+
+    if (D2_OK == err)
+    {
+        err = opaque ? d2_setblendmode(p_d2, d2_bm_one, d2_bm_zero) :
+              d2_setblendmode(p_d2, d2_bm_alpha, d2_bm_one_minus_alpha);
+    }
+
+    if (D2_OK == err)
+    {
+        err = d2_setalpha(p_d2, (RM_DRW_BENCHMARK_BLEND_GLOBAL_ALPHA == p_test->blend) ?
+                          RM_DRW_BENCHMARK_ALPHA_HALF : RM_DRW_BENCHMARK_ALPHA_OPAQUE);
+    }
+
+    if (D2_OK == err)
+    {
+        err = d2_setantialiasing(p_d2, aa ? 1 : 0);
+    }
+
+    if (D2_OK == err)
+    {
+        err = d2_setcolor(p_d2, 0, RM_DRW_BENCHMARK_COLOR);
+    }
+
+    if (D2_OK == err)
+    {
+        err = d2_setfillmode(p_d2, (RM_DRW_BENCHMARK_OP_TEXTURED_TRIANGLE == p_test->op) ? d2_fm_texture : d2_fm_color);
+    }
+
+    if ((D2_OK == err) && (NULL != p_source))
+    {
+        if (RM_DRW_BENCHMARK_OP_BLIT == p_test->op)
+        {
+            err = d2_setblitsrc(p_d2, (void *) p_source->p_data, (d2_s32) p_source->pitch, (d2_s32) p_source->width,
+                                (d2_s32) p_source->height, p_source->format);
+        }
+        else
+        {
+            err = d2_settexture(p_d2, (void *) p_source->p_data, (d2_s32) p_source->pitch, (d2_s32) p_source->width,
+                                (d2_s32) p_source->height, p_source->format);
+            if (D2_OK == err)
+            {
+                err = d2_settexturemode(p_d2, p_test->texture_mode);
+            }
+        }
+
+        if ((D2_OK == err) && (NULL != p_source->p_clut))
+        {
+            err = d2_settexclut(p_d2, (d2_color *) p_source->p_clut);
+        }
+    }
+
+    return (D2_OK == err) ? FSP_SUCCESS : FSP_ERR_INVALID_HW_CONDITION;
+}
+
+/*******************************************************************************************************************//**
+ * Records one primitive of the current test.
+ *
+ * @param[in]  p_ctx                      Benchmark state.
+ * @param[in]  index                      Index of the primitive in the test, selects its position.
+ *
+ * @retval FSP_SUCCESS                    Primitive recorded.
+ * @retval FSP_ERR_INVALID_HW_CONDITION   D/AVE 2D returned an error.
+ **********************************************************************************************************************/
+static fsp_err_t rm_drw_benchmark_primitive (rm_drw_benchmark_ctx_t * p_ctx, uint32_t index)
+{
+    rm_drw_benchmark_test_t const   * p_test   = p_ctx->result.p_test;
+    rm_drw_benchmark_target_t const * p_target = p_ctx->result.p_target;
+    rm_drw_benchmark_source_t const * p_source = p_ctx->result.p_source;
+    d2_device * p_d2 = p_ctx->p_cfg->p_d2;
+
+    uint32_t height = (RM_DRW_BENCHMARK_OP_AA_CIRCLE == p_test->op) ? p_test->width : p_test->height;
+    uint32_t x      = (index * RM_DRW_BENCHMARK_STRIDE_X) % (p_target->width - p_test->width + 1U);
+    uint32_t y      = (index * RM_DRW_BENCHMARK_STRIDE_Y) % (p_target->height - height + 1U);
+    d2_point x0     = (d2_point) (x << RM_DRW_BENCHMARK_POINT_SHIFT);
+    d2_point y0     = (d2_point) (y << RM_DRW_BENCHMARK_POINT_SHIFT);
+    d2_point w      = (d2_point) (p_test->width << RM_DRW_BENCHMARK_POINT_SHIFT);
+    d2_point h      = (d2_point) (height << RM_DRW_BENCHMARK_POINT_SHIFT);
+    d2_s32   err    = D2_OK;
+
+    switch (p_test->op)
+    {
+        case RM_DRW_BENCHMARK_OP_FILL:
+        {
+            err = d2_renderbox(p_d2, x0, y0, w, h);
+            break;
+        }
+
+        case RM_DRW_BENCHMARK_OP_BLIT:
+        {
+            d2_u32 flags = p_test->texture_mode;
+            if (RM_DRW_BENCHMARK_BLEND_GLOBAL_ALPHA == p_test->blend)
+            {
+                flags |= d2_bf_usealpha;
+            }
+
+            err = d2_blitcopy(p_d2, (d2_s32) p_source->width, (d2_s32) p_source->height, 0U, 0U, w, h, x0, y0, flags);
+            break;
+        }
+
+        case RM_DRW_BENCHMARK_OP_TEXTURED_TRIANGLE:
+        {
+            /* Map the whole source onto the bounding box of the triangle. */
+            d2_s32 dxu = (d2_s32) ((p_source->width << RM_DRW_BENCHMARK_TEXEL_SHIFT) / p_test->width);
+            d2_s32 dyv = (d2_s32) ((p_source->height << RM_DRW_BENCHMARK_TEXEL_SHIFT) / p_test->height);
+            err = d2_settexturemapping(p_d2, x0, y0, 0, 0, dxu, 0, 0, dyv);
+            if (D2_OK == err)
+            {
+                err = d2_rendertri(p_d2, x0, y0, (d2_point) (x0 + w), y0, x0, (d2_point) (y0 + h), 0U);
+            }
+
+            break;
+        }
+
+        case RM_DRW_BENCHMARK_OP_AA_TRIANGLE:
+        {
+            /* Subpixel vertices, so that every edge is antialiased. */
+            err = d2_rendertri(p_d2, (d2_point) (x0 + 5), (d2_point) (y0 + 3), (d2_point) (x0 + w - 7), y0,
+                               (d2_point) (x0 + (w / 2)), (d2_point) (y0 + h - 1), 0U);
+            break;
+        }
+
+        case RM_DRW_BENCHMARK_OP_AA_CIRCLE:
+        {
+            err = d2_rendercircle(p_d2, (d2_point) (x0 + (w / 2)), (d2_point) (y0 + (w / 2)), (d2_width) (w / 2), 0);
+            break;
+        }
+
+        case RM_DRW_BENCHMARK_OP_AA_LINE:
+        {
+            err = d2_renderline(p_d2, x0, y0, (d2_point) (x0 + w), (d2_point) (y0 + h),
+                                (d2_width) (p_test->line_width << RM_DRW_BENCHMARK_POINT_SHIFT), d2_le_exclude_none);
+            break;
+        }
+
+        default:
+        {
+            break;
+        }
+    }
+
+    return (D2_OK == err) ? FSP_SUCCESS : FSP_ERR_INVALID_HW_CONDITION;
+}
+
+/*******************************************************************************************************************//**
+ * Returns the number of pixels covered by the primitives of one frame of a test.
+ *
+ * @param[in]  p_test                     Test to calculate the coverage of.
+ **********************************************************************************************************************/
+static uint32_t rm_drw_benchmark_pixels (rm_drw_benchmark_test_t const * p_test)
+{
+    uint32_t w      = p_test->width;
+    uint32_t h      = p_test->height;
+    uint32_t pixels = w * h;
+
+    switch (p_test->op)
+    {
+        case RM_DRW_BENCHMARK_OP_TEXTURED_TRIANGLE:
+        case RM_DRW_BENCHMARK_OP_AA_TRIANGLE:
+        {
+            pixels = (w * h) / 2U;
+            break;
+        }
+
+        case RM_DRW_BENCHMARK_OP_AA_CIRCLE:
+        {
+            /* pi / 4 * d^2, with pi as 355 / 113. */
+            pixels = (w * w * 355U) / (4U * 113U);
+            break;
+        }
+
+        case RM_DRW_BENCHMARK_OP_AA_LINE:
+        {
+            pixels = rm_drw_benchmark_isqrt((w * w) + (h * h)) * p_test->line_width;
+            break;
+        }
+
+        default:
+        {
+            break;
+        }
+    }
+
+    return pixels * p_test->count;
+}
+
+/*******************************************************************************************************************//**
+ * Returns the integer square root of a value.
+ *
+ * @param[in]  value                      Value to take the square root of.
+ **********************************************************************************************************************/
+static uint32_t rm_drw_benchmark_isqrt (uint32_t value)
+{
+    uint32_t root = 0U;
+    uint32_t bit  = 1UL << 30;
+
+    while (bit > value)
+    {
+        bit >>= 2U;
+    }
+
+    while (0U != bit)
+    {
+        if (value >= root + bit)
+        {
+            value -= root + bit;
+            root   = (root >> 1U) + bit;
+        }
+        else
+        {
+            root >>= 1U;
+        }
+
+        bit >>= 2U;
+    }
+
+    return root;
+}
+
+/*******************************************************************************************************************//**
+ * Returns true if the primitive reads a source image.
+ *
+ * @param[in]  op                         Primitive of the test.
+ **********************************************************************************************************************/
+static bool rm_drw_benchmark_op_uses_source (rm_drw_benchmark_op_t op)
+{
+    return (RM_DRW_BENCHMARK_OP_BLIT == op) || (RM_DRW_BENCHMARK_OP_TEXTURED_TRIANGLE == op);
+}
@@ -0,0 +1,158 @@
+/***********************************************************************************************************************
+ * Copyright [2020] Renesas Electronics Corporation and/or its affiliates.  All Rights Reserved.
+ *
+ * This software and documentation are supplied by Renesas Electronics America Inc. and may only be used with products
+ * of Renesas Electronics Corp. and its affiliates ("Renesas").  No other uses are authorized.  Renesas products are
+ * sold pursuant to Renesas terms and conditions of sale.  Purchasers are solely responsible for the selection and use
+ * of Renesas products and Renesas assumes no liability.  No license, express or implied, to any intellectual property
+ * right is granted by Renesas. This software is protected under all applicable laws, including copyright laws. Renesas
+ * reserves the right to change or discontinue this software and/or this documentation. THE SOFTWARE AND DOCUMENTATION
+ * IS DELIVERED TO YOU "AS IS," AND RENESAS MAKES NO REPRESENTATIONS OR WARRANTIES, AND TO THE FULLEST EXTENT
+ * PERMISSIBLE UNDER APPLICABLE LAW, DISCLAIMS ALL WARRANTIES, WHETHER EXPLICITLY OR IMPLICITLY, INCLUDING WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, AND NONINFRINGEMENT, WITH RESPECT TO THE SOFTWARE OR
+ * DOCUMENTATION.  RENESAS SHALL HAVE NO LIABILITY ARISING OUT OF ANY SECURITY VULNERABILITY OR BREACH.  TO THE MAXIMUM
+ * EXTENT PERMITTED BY LAW, IN NO EVENT WILL RENESAS BE LIABLE TO YOU IN CONNECTION WITH THE SOFTWARE OR DOCUMENTATION
+ * (OR ANY PERSON OR ENTITY CLAIMING RIGHTS DERIVED FROM YOU) FOR ANY LOSS, DAMAGES, OR CLAIMS WHATSOEVER, INCLUDING,
+ * WITHOUT LIMITATION, ANY DIRECT, CONSEQUENTIAL, SPECIAL, INDIRECT, PUNITIVE, OR INCIDENTAL DAMAGES; ANY LOST PROFITS,
+ * OTHER ECONOMIC DAMAGE, PROPERTY DAMAGE, OR PERSONAL INJURY; AND EVEN IF RENESAS HAS BEEN ADVISED OF THE POSSIBILITY
+ * OF SUCH LOSS, DAMAGES, CLAIMS OR COSTS.
+ **********************************************************************************************************************/
+
+#ifndef RM_DRW_BENCHMARK_H
+ #define RM_DRW_BENCHMARK_H
+
+/***********************************************************************************************************************
+ * Includes
+ **********************************************************************************************************************/
+ #include "bsp_api.h"
+ #include "dave_driver.h"
+
+/** Common macro for FSP header files. There is also a corresponding FSP_FOOTER macro at the end of this file. */
+FSP_HEADER
+
+/*******************************************************************************************************************//**
+ * @addtogroup RM_DRW_BENCHMARK
+ * @{
+ **********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+
+/** Primitive drawn by a test. */
+typedef enum e_rm_drw_benchmark_op
+{
+    RM_DRW_BENCHMARK_OP_FILL,               ///< Solid d2_renderbox() of width x height
+    RM_DRW_BENCHMARK_OP_BLIT,               ///< d2_blitcopy() of the whole source to width x height
+    RM_DRW_BENCHMARK_OP_TEXTURED_TRIANGLE,  ///< d2_rendertri() with legs of width and height, mapped with the source
+    RM_DRW_BENCHMARK_OP_AA_TRIANGLE,        ///< Antialiased solid d2_rendertri() with subpixel vertices
+    RM_DRW_BENCHMARK_OP_AA_CIRCLE,          ///< Antialiased solid d2_rendercircle() of diameter width
+    RM_DRW_BENCHMARK_OP_AA_LINE,            ///< Antialiased d2_renderline() across width x height, line_width wide
+} rm_drw_benchmark_op_t;
+
+/** Blending of the primitive with the frame buffer. */
+typedef enum e_rm_drw_benchmark_blend
+{
+    RM_DRW_BENCHMARK_BLEND_OPAQUE,         ///< Source replaces the destination
+    RM_DRW_BENCHMARK_BLEND_SRC_ALPHA,      ///< Blended with the source alpha, solid shapes blend their edges only
+    RM_DRW_BENCHMARK_BLEND_GLOBAL_ALPHA,   ///< Blended with the source alpha scaled by a global alpha of 50%
+} rm_drw_benchmark_blend_t;
+
+/** One effect to measure. */
+typedef struct st_rm_drw_benchmark_test
+{
+    char const             * p_name;   ///< Name reported with the result
+    rm_drw_benchmark_op_t    op;       ///< Primitive drawn
+    rm_drw_benchmark_blend_t blend;    ///< Blending
+    uint32_t texture_mode;             ///< d2_tm_* flags for textures and blits, e.g. d2_tm_filter for scaled sources
+    uint16_t width;                    ///< Width of each primitive in pixels
+    uint16_t height;                   ///< Height of each primitive in pixels
+    uint16_t line_width;               ///< Line width in pixels (AA_LINE)
+    uint16_t count;                    ///< Primitives per frame, spread over the frame buffer
+    uint16_t frames;                   ///< Frames rendered, the measurement is averaged over them
+} rm_drw_benchmark_test_t;
+
+/** Frame buffer rendered to. */
+typedef struct st_rm_drw_benchmark_target
+{
+    char const * p_name;               ///< Name reported with the result, e.g. the memory it is placed in
+    void       * p_buffer;             ///< Frame buffer
+    uint32_t     pitch;                ///< Pitch in pixels
+    uint32_t     width;                ///< Width in pixels
+    uint32_t     height;               ///< Height in pixels
+    d2_u32       format;               ///< d2_mode_* frame buffer format
+} rm_drw_benchmark_target_t;
+
+/** Image read by BLIT and TEXTURED_TRIANGLE tests. */
+typedef struct st_rm_drw_benchmark_source
+{
+    char const     * p_name;           ///< Name reported with the result, e.g. "argb8888 sdram"
+    void const     * p_data;           ///< Image data, placed in the memory to measure (SRAM, SDRAM, QSPI, ...)
+    uint32_t         pitch;            ///< Pitch in pixels
+    uint32_t         width;            ///< Width in pixels
+    uint32_t         height;           ///< Height in pixels
+    d2_u32           format;           ///< d2_mode_* format, with d2_mode_rle for RLE and d2_mode_clut for CLUT images
+    d2_color const * p_clut;           ///< Color lookup table of d2_mode_clut images, NULL otherwise
+} rm_drw_benchmark_source_t;
+
+/** Measurement of one test on one target, with one source if the test reads one. */
+typedef struct st_rm_drw_benchmark_result
+{
+    rm_drw_benchmark_test_t const   * p_test;   ///< Test measured
+    rm_drw_benchmark_target_t const * p_target; ///< Frame buffer rendered to
+    rm_drw_benchmark_source_t const * p_source; ///< Source read, NULL for solid primitives
+    fsp_err_t status;                  ///< FSP_SUCCESS, or the error that stopped the test
+    uint32_t  frames;                  ///< Frames rendered
+    uint32_t  pixels;                  ///< Pixels covered per frame
+    uint32_t  record_us;               ///< Average CPU time to record the display list of one frame
+    uint32_t  render_us;               ///< Average D/AVE 2D time to execute one frame
+    uint32_t  render_max_us;           ///< Longest D/AVE 2D time of one frame
+    uint32_t  kpixels_per_s;           ///< Fill rate over render_us, in thousands of pixels per second
+    uint32_t  frame_permille;          ///< render_us as a share of the frame period
+    uint32_t  count_per_frame;         ///< Primitives of this kind that fit in one frame period
+    bool      perf_valid;              ///< True if the D/AVE 2D has performance counters
+    uint32_t  dave_cycles;             ///< Average D/AVE 2D active cycles per frame
+    uint32_t  perf_count;              ///< Average count of perf_event per frame
+    void const * p_context;            ///< User defined context passed in the configuration
+} rm_drw_benchmark_result_t;
+
+/** Benchmark configuration. */
+typedef struct st_rm_drw_benchmark_cfg
+{
+    d2_device * p_d2;                                 ///< Opened and initialized D/AVE 2D device, idle
+    rm_drw_benchmark_test_t const * p_tests;          ///< Tests to run
+    uint32_t num_tests;                               ///< Number of entries in p_tests
+    rm_drw_benchmark_target_t const * p_targets;      ///< Frame buffers to render to
+    uint32_t num_targets;                             ///< Number of entries in p_targets
+    rm_drw_benchmark_source_t const * p_sources;      ///< Sources for BLIT and TEXTURED_TRIANGLE tests
+    uint32_t num_sources;                             ///< Number of entries in p_sources
+
+    uint32_t frame_rate_hz;            ///< Display refresh rate the budgets are given for, 0 for 60 Hz
+    d2_u32   perf_event;               ///< d2_pc_* event counted by the second performance counter
+    bsp_cycle_counter_get_t p_cycles_get; ///< Cycle counter, NULL to use the DWT cycle counter
+
+    /** Called with each measurement. */
+    void (* p_callback)(rm_drw_benchmark_result_t const * p_result);
+    void const * p_context;            ///< Placeholder for user data, passed back in each result
+} rm_drw_benchmark_cfg_t;
+
+/**********************************************************************************************************************
+ * Public Function Prototypes
+ **********************************************************************************************************************/
+fsp_err_t RM_DRW_BENCHMARK_Run(rm_drw_benchmark_cfg_t const * const p_cfg);
+int32_t   RM_DRW_BENCHMARK_Format(rm_drw_benchmark_result_t const * const p_result,
+                                  char * const                             p_line,
+                                  uint32_t                                 line_size);
+
+/*******************************************************************************************************************//**
+ * @} (end addtogroup RM_DRW_BENCHMARK)
+ **********************************************************************************************************************/
+
+/** Common macro for FSP header files. There is also a corresponding FSP_HEADER macro at the top of this file. */
+FSP_FOOTER
+
+#endif                                 /* RM_DRW_BENCHMARK_H */
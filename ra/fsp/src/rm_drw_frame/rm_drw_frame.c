@@ -0,0 +1,754 @@
+/***********************************************************************************************************************
+ * Copyright [2020] Renesas Electronics Corporation and/or its affiliates.  All Rights Reserved.
+ *
+ * This software and documentation are supplied by Renesas Electronics America Inc. and may only be used with products
+ * of Renesas Electronics Corp. and its affiliates ("Renesas").  No other uses are authorized.  Renesas products are
+ * sold pursuant to Renesas terms and conditions of sale.  Purchasers are solely responsible for the selection and use
+ * of Renesas products and Renesas assumes no liability.  No license, express or implied, to any intellectual property
+ * right is granted by Renesas. This software is protected under all applicable laws, including copyright laws. Renesas
+ * reserves the right to change or discontinue this software and/or this documentation. THE SOFTWARE AND DOCUMENTATION
+ * IS DELIVERED TO YOU "AS IS," AND RENESAS MAKES NO REPRESENTATIONS OR WARRANTIES, AND TO THE FULLEST EXTENT
+ * PERMISSIBLE UNDER APPLICABLE LAW, DISCLAIMS ALL WARRANTIES, WHETHER EXPLICITLY OR IMPLICITLY, INCLUDING WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, AND NONINFRINGEMENT, WITH RESPECT TO THE SOFTWARE OR
+ * DOCUMENTATION.  RENESAS SHALL HAVE NO LIABILITY ARISING OUT OF ANY SECURITY VULNERABILITY OR BREACH.  TO THE MAXIMUM
+ * EXTENT PERMITTED BY LAW, IN NO EVENT WILL RENESAS BE LIABLE TO YOU IN CONNECTION WITH THE SOFTWARE OR DOCUMENTATION
+ * (OR ANY PERSON OR ENTITY CLAIMING RIGHTS DERIVED FROM YOU) FOR ANY LOSS, DAMAGES, OR CLAIMS WHATSOEVER, INCLUDING,
+ * WITHOUT LIMITATION, ANY DIRECT, CONSEQUENTIAL, SPECIAL, INDIRECT, PUNITIVE, OR INCIDENTAL DAMAGES; ANY LOST PROFITS,
+ * OTHER ECONOMIC DAMAGE, PROPERTY DAMAGE, OR PERSONAL INJURY; AND EVEN IF RENESAS HAS BEEN ADVISED OF THE POSSIBILITY
+ * OF SUCH LOSS, DAMAGES, CLAIMS OR COSTS.
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Includes
+ **********************************************************************************************************************/
+#include <string.h>                    // memset()
+#include "rm_drw_frame.h"
+#include "rm_drw_frame_cfg.h"
+
+/***********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+
+/* "DRWF" in ASCII. */
+#define RM_DRW_FRAME_OPEN            (0x44525746U)
+
+/* Buffer index meaning "no buffer". */
+#define RM_DRW_FRAME_PRV_NONE        (0xFFU)
+
+#define RM_DRW_FRAME_PRV_BUFFER_MIN  (2U)
+
+/***********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Private function prototypes
+ **********************************************************************************************************************/
+static uint32_t  rm_drw_frame_timestamp(rm_drw_frame_instance_ctrl_t * p_ctrl);
+static uint8_t   rm_drw_frame_buffer_acquire(rm_drw_frame_instance_ctrl_t * p_ctrl);
+static fsp_err_t rm_drw_frame_submit(rm_drw_frame_instance_ctrl_t * p_ctrl, bool frame_end);
+static uint8_t   rm_drw_frame_tiles(rm_drw_frame_instance_ctrl_t * p_ctrl, uint8_t level);
+static d2_s32    rm_drw_frame_tile_clip(rm_drw_frame_instance_ctrl_t * p_ctrl);
+static void      rm_drw_frame_vblank(rm_drw_frame_instance_ctrl_t * p_ctrl);
+static void      rm_drw_frame_underflow(rm_drw_frame_instance_ctrl_t * p_ctrl, uint32_t layer);
+static void      rm_drw_frame_throttle_update(rm_drw_frame_instance_ctrl_t * p_ctrl);
+
+/***********************************************************************************************************************
+ * Private global variables
+ **********************************************************************************************************************/
+
+/** Version data structure. */
+static const fsp_version_t g_rm_drw_frame_version =
+{
+    .api_version_minor  = RM_DRW_FRAME_CODE_VERSION_MINOR,
+    .api_version_major  = RM_DRW_FRAME_CODE_VERSION_MAJOR,
+    .code_version_major = RM_DRW_FRAME_CODE_VERSION_MAJOR,
+    .code_version_minor = RM_DRW_FRAME_CODE_VERSION_MINOR
+};
+
+/*******************************************************************************************************************//**
+ * @addtogroup RM_DRW_FRAME
+ * @{
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Functions
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * Opens the frame scheduler.
+ *
+ * The scheduler cycles the configured frame buffers between the D/AVE 2D and the display:
+ * - RM_DRW_FRAME_Begin selects a free frame buffer as D/AVE 2D render target.
+ * - RM_DRW_FRAME_End closes the display list of the frame and starts it on the D/AVE 2D immediately
+ *   (d2_endframe/d2_startframe), so recording of the next frame overlaps with rendering of this one.
+ * - A rendered frame is passed to the display from the line detection interrupt only, so the frame buffer address
+ *   changes during vertical blank. If a newer frame completes before the queued one was displayed, the queued frame
+ *   is dropped and its buffer is reused.
+ *
+ * The scheduler also accounts for external memory bandwidth: the configured D/AVE 2D performance counters are totalled
+ * per frame and display underflows are counted per layer together with an estimate of the line they occurred on. With
+ * rm_drw_frame_cfg_t::tiles_max above 1, underflows make the scheduler split frames into horizontal bands that are
+ * executed one after the other (see RM_DRW_FRAME_TileNext), and finally disable the other graphics layer.
+ *
+ * The display and the D/AVE 2D device must be opened and the D/AVE 2D must be idle before calling this function. The
+ * first frame buffer should be the one the display layer is currently showing.
+ *
+ * @retval     FSP_SUCCESS                    Scheduler is open.
+ * @retval     FSP_ERR_ASSERTION              An input parameter is invalid.
+ * @retval     FSP_ERR_ALREADY_OPEN           Module has already been opened with this instance of the control
+ *                                            structure.
+ * @retval     FSP_ERR_INVALID_ARGUMENT       Unsupported number of frame buffers.
+ * @retval     FSP_ERR_INVALID_HW_CONDITION   D/AVE 2D returned an error.
+ **********************************************************************************************************************/
+fsp_err_t RM_DRW_FRAME_Open (rm_drw_frame_instance_ctrl_t * const p_ctrl, rm_drw_frame_cfg_t const * const p_cfg)
+{
+#if RM_DRW_FRAME_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ASSERT(NULL != p_cfg);
+    FSP_ASSERT(NULL != p_cfg->p_display);
+    FSP_ASSERT(NULL != p_cfg->p_d2_handle);
+    FSP_ASSERT(NULL != p_cfg->pp_buffers);
+    FSP_ERROR_RETURN(RM_DRW_FRAME_OPEN != p_ctrl->open, FSP_ERR_ALREADY_OPEN);
+    FSP_ERROR_RETURN((p_cfg->num_buffers >= RM_DRW_FRAME_PRV_BUFFER_MIN) &&
+                     (p_cfg->num_buffers <= RM_DRW_FRAME_BUFFER_MAX),
+                     FSP_ERR_INVALID_ARGUMENT);
+#endif
+
+    p_ctrl->p_cfg        = p_cfg;
+    p_ctrl->displayed    = 0U;
+    p_ctrl->flip_pending = RM_DRW_FRAME_PRV_NONE;
+    p_ctrl->queued       = RM_DRW_FRAME_PRV_NONE;
+    p_ctrl->rendering    = RM_DRW_FRAME_PRV_NONE;
+    p_ctrl->recording    = RM_DRW_FRAME_PRV_NONE;
+    p_ctrl->begin_time   = 0U;
+    p_ctrl->render_time  = 0U;
+
+    for (uint32_t i = 0U; i < RM_DRW_FRAME_BUFFER_MAX; i++)
+    {
+        p_ctrl->queue_time[i] = 0U;
+    }
+
+    p_ctrl->tile_count       = 1U;
+    p_ctrl->tile_index       = 0U;
+    p_ctrl->throttle_level   = 0U;
+    p_ctrl->frame_underflows = 0U;
+    p_ctrl->calm_frames      = 0U;
+    p_ctrl->vblank_time      = 0U;
+    p_ctrl->frame_period     = 0U;
+
+    memset(&p_ctrl->perf_count[0], 0, sizeof(p_ctrl->perf_count));
+    memset(&p_ctrl->statistics, 0, sizeof(p_ctrl->statistics));
+    p_ctrl->statistics.tiles = 1U;
+
+    /* One throttle level per doubling of the band count, plus one for disabling the other layer. */
+    uint8_t throttle_max = 0U;
+    for (uint32_t tiles = 1U; tiles < p_cfg->tiles_max; tiles <<= 1)
+    {
+        throttle_max++;
+    }
+
+    if (NULL != p_cfg->p_other_layer_buffer)
+    {
+        throttle_max++;
+    }
+
+    p_ctrl->throttle_max = throttle_max;
+
+    /* The performance counters can only be configured while the D/AVE 2D is idle. */
+    for (uint32_t i = 0U; i < RM_DRW_FRAME_PERF_COUNTERS; i++)
+    {
+        if (d2_pc_disable != p_cfg->perf_events[i])
+        {
+            FSP_ERROR_RETURN(D2_OK == d2_setperfcountevent(p_cfg->p_d2_handle, i, p_cfg->perf_events[i]),
+                             FSP_ERR_INVALID_HW_CONDITION);
+            (void) d2_setperfcountvalue(p_cfg->p_d2_handle, i, 0);
+        }
+    }
+
+    /* Open the render buffer the first frame is recorded to. */
+    FSP_ERROR_RETURN(D2_OK == d2_startframe(p_cfg->p_d2_handle), FSP_ERR_INVALID_HW_CONDITION);
+
+    p_ctrl->open = RM_DRW_FRAME_OPEN;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Starts recording a frame. A free frame buffer is set as D/AVE 2D framebuffer and returned; all following d2_*
+ * render commands until RM_DRW_FRAME_End draw into it. If the scheduler throttles rendering, the cliprect is set to
+ * the first band and the frame must be drawn once per band (see RM_DRW_FRAME_TileNext).
+ *
+ * @retval     FSP_SUCCESS                    Frame buffer selected.
+ * @retval     FSP_ERR_ASSERTION              An input parameter is invalid.
+ * @retval     FSP_ERR_NOT_OPEN               The instance control structure is not opened.
+ * @retval     FSP_ERR_INVALID_STATE          RM_DRW_FRAME_Begin was called twice without RM_DRW_FRAME_End.
+ * @retval     FSP_ERR_IN_USE                 All frame buffers are in use by the display. Retry after the next
+ *                                            vertical blank (see rm_drw_frame_cfg_t::p_callback).
+ * @retval     FSP_ERR_INVALID_HW_CONDITION   D/AVE 2D returned an error.
+ **********************************************************************************************************************/
+fsp_err_t RM_DRW_FRAME_Begin (rm_drw_frame_instance_ctrl_t * const p_ctrl, uint8_t ** const pp_framebuffer)
+{
+#if RM_DRW_FRAME_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ASSERT(NULL != pp_framebuffer);
+    FSP_ERROR_RETURN(RM_DRW_FRAME_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+    FSP_ERROR_RETURN(RM_DRW_FRAME_PRV_NONE == p_ctrl->recording, FSP_ERR_INVALID_STATE);
+
+    rm_drw_frame_cfg_t const * p_cfg   = p_ctrl->p_cfg;
+    display_input_cfg_t const * p_input = &p_cfg->p_display->p_cfg->input[p_cfg->layer];
+
+    uint8_t index = rm_drw_frame_buffer_acquire(p_ctrl);
+    FSP_ERROR_RETURN(RM_DRW_FRAME_PRV_NONE != index, FSP_ERR_IN_USE);
+
+    uint8_t * p_buffer = p_cfg->pp_buffers[index];
+
+    /* Both the display input stride and the D/AVE 2D pitch are in pixels. */
+    d2_s32 d2_err = d2_framebuffer(p_cfg->p_d2_handle,
+                                   p_buffer,
+                                   (d2_s32) p_input->hstride,
+                                   p_input->hsize,
+                                   p_input->vsize,
+                                   p_cfg->d2_format);
+    FSP_ERROR_RETURN(D2_OK == d2_err, FSP_ERR_INVALID_HW_CONDITION);
+
+    /* Latch the band count for this frame. */
+    p_ctrl->tile_count = rm_drw_frame_tiles(p_ctrl, p_ctrl->throttle_level);
+    p_ctrl->tile_index = 0U;
+    if (p_ctrl->tile_count > 1U)
+    {
+        FSP_ERROR_RETURN(D2_OK == rm_drw_frame_tile_clip(p_ctrl), FSP_ERR_INVALID_HW_CONDITION);
+    }
+
+    p_ctrl->recording  = index;
+    p_ctrl->begin_time = rm_drw_frame_timestamp(p_ctrl);
+
+    *pp_framebuffer = p_buffer;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Advances to the next band of a throttled frame. The band just drawn is started on the D/AVE 2D once the display
+ * list executing before it is complete, and the cliprect is set to the next band. Bands are thus executed one after
+ * the other with the D/AVE 2D idle while the CPU records the next band, which limits the memory bandwidth the D/AVE 2D
+ * takes from the display. Draw the whole frame again after each call that sets *p_more:
+ *
+ * @code
+ * RM_DRW_FRAME_Begin(&g_frame_ctrl, &p_framebuffer);
+ * do
+ * {
+ *     draw_scene();
+ *     RM_DRW_FRAME_TileNext(&g_frame_ctrl, &more);
+ * } while (more);
+ * RM_DRW_FRAME_End(&g_frame_ctrl);
+ * @endcode
+ *
+ * Frames that are not throttled consist of a single band, so *p_more is always false for them. Render commands must not
+ * change the cliprect while frames are throttled.
+ *
+ * @retval     FSP_SUCCESS                    *p_more is set.
+ * @retval     FSP_ERR_ASSERTION              An input parameter is invalid.
+ * @retval     FSP_ERR_NOT_OPEN               The instance control structure is not opened.
+ * @retval     FSP_ERR_INVALID_STATE          RM_DRW_FRAME_Begin was not called.
+ * @retval     FSP_ERR_INVALID_HW_CONDITION   D/AVE 2D returned an error.
+ **********************************************************************************************************************/
+fsp_err_t RM_DRW_FRAME_TileNext (rm_drw_frame_instance_ctrl_t * const p_ctrl, bool * const p_more)
+{
+#if RM_DRW_FRAME_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ASSERT(NULL != p_more);
+    FSP_ERROR_RETURN(RM_DRW_FRAME_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+    FSP_ERROR_RETURN(RM_DRW_FRAME_PRV_NONE != p_ctrl->recording, FSP_ERR_INVALID_STATE);
+
+    *p_more = false;
+
+    if ((p_ctrl->tile_index + 1U) < p_ctrl->tile_count)
+    {
+        fsp_err_t err = rm_drw_frame_submit(p_ctrl, false);
+        FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+        p_ctrl->tile_index++;
+        FSP_ERROR_RETURN(D2_OK == rm_drw_frame_tile_clip(p_ctrl), FSP_ERR_INVALID_HW_CONDITION);
+
+        *p_more = true;
+    }
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Ends recording of the current frame and starts it on the D/AVE 2D. Waits until the previous frame is rendered
+ * completely and queues that frame for display at the next vertical blank.
+ *
+ * @retval     FSP_SUCCESS                    Frame submitted.
+ * @retval     FSP_ERR_ASSERTION              An input parameter is invalid.
+ * @retval     FSP_ERR_NOT_OPEN               The instance control structure is not opened.
+ * @retval     FSP_ERR_INVALID_STATE          RM_DRW_FRAME_Begin was not called.
+ * @retval     FSP_ERR_INVALID_HW_CONDITION   D/AVE 2D returned an error.
+ **********************************************************************************************************************/
+fsp_err_t RM_DRW_FRAME_End (rm_drw_frame_instance_ctrl_t * const p_ctrl)
+{
+#if RM_DRW_FRAME_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ERROR_RETURN(RM_DRW_FRAME_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+    FSP_ERROR_RETURN(RM_DRW_FRAME_PRV_NONE != p_ctrl->recording, FSP_ERR_INVALID_STATE);
+
+    return rm_drw_frame_submit(p_ctrl, true);
+}
+
+/*******************************************************************************************************************//**
+ * Gets the frame statistics.
+ *
+ * @retval     FSP_SUCCESS                    Statistics copied.
+ * @retval     FSP_ERR_ASSERTION              An input parameter is invalid.
+ * @retval     FSP_ERR_NOT_OPEN               The instance control structure is not opened.
+ **********************************************************************************************************************/
+fsp_err_t RM_DRW_FRAME_StatisticsGet (rm_drw_frame_instance_ctrl_t * const p_ctrl,
+                                      rm_drw_frame_statistics_t * const    p_statistics)
+{
+#if RM_DRW_FRAME_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ASSERT(NULL != p_statistics);
+    FSP_ERROR_RETURN(RM_DRW_FRAME_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+
+    /* The display interrupt updates the statistics. */
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+    *p_statistics = p_ctrl->statistics;
+    FSP_CRITICAL_SECTION_EXIT;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Closes the frame scheduler. Waits until the D/AVE 2D is idle. The frame buffer currently scanned out is left on the
+ * display.
+ *
+ * @retval     FSP_SUCCESS                    Scheduler closed.
+ * @retval     FSP_ERR_ASSERTION              An input parameter is invalid.
+ * @retval     FSP_ERR_NOT_OPEN               The instance control structure is not opened.
+ **********************************************************************************************************************/
+fsp_err_t RM_DRW_FRAME_Close (rm_drw_frame_instance_ctrl_t * const p_ctrl)
+{
+#if RM_DRW_FRAME_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ERROR_RETURN(RM_DRW_FRAME_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+
+    /* Stop scheduling from the display interrupt before touching the D/AVE 2D. */
+    p_ctrl->open = 0U;
+
+    d2_device * p_d2_handle = p_ctrl->p_cfg->p_d2_handle;
+    (void) d2_endframe(p_d2_handle);
+    (void) d2_flushframe(p_d2_handle);
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Returns the version of the firmware and API.
+ *
+ * @retval     FSP_SUCCESS        Function executed successfully.
+ * @retval     FSP_ERR_ASSERTION  Null Pointer.
+ **********************************************************************************************************************/
+fsp_err_t RM_DRW_FRAME_VersionGet (fsp_version_t * const p_version)
+{
+#if RM_DRW_FRAME_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_version);
+#endif
+
+    p_version->version_id = g_rm_drw_frame_version.version_id;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Display callback. Set as callback of the display instance with the scheduler control structure as context, or call
+ * it from the application's display callback with the same arguments.
+ *
+ * On DISPLAY_EVENT_LINE_DETECTION the frame buffer passed to the display at the previous vertical blank is now being
+ * scanned out, so the buffer shown before is released. A queued frame is then passed to the display, so it is
+ * latched at the next vertical sync, and the throttle level is updated. DISPLAY_EVENT_GR1_UNDERFLOW and
+ * DISPLAY_EVENT_GR2_UNDERFLOW are counted.
+ *
+ * @param[in]  p_args   Display callback arguments. p_context must point to the scheduler control structure.
+ **********************************************************************************************************************/
+void rm_drw_frame_display_callback (display_callback_args_t * p_args)
+{
+    rm_drw_frame_instance_ctrl_t * p_ctrl = (rm_drw_frame_instance_ctrl_t *) p_args->p_context;
+
+    if ((NULL == p_ctrl) || (RM_DRW_FRAME_OPEN != p_ctrl->open))
+    {
+        return;
+    }
+
+    switch (p_args->event)
+    {
+        case DISPLAY_EVENT_LINE_DETECTION:
+        {
+            rm_drw_frame_vblank(p_ctrl);
+            break;
+        }
+
+        case DISPLAY_EVENT_GR1_UNDERFLOW:
+        {
+            rm_drw_frame_underflow(p_ctrl, 0U);
+            break;
+        }
+
+        case DISPLAY_EVENT_GR2_UNDERFLOW:
+        {
+            rm_drw_frame_underflow(p_ctrl, 1U);
+            break;
+        }
+
+        default:
+        {
+            break;
+        }
+    }
+}
+
+/*******************************************************************************************************************//**
+ * @} (end addtogroup RM_DRW_FRAME)
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Private Functions
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * Reads the configured timestamp source.
+ *
+ * @param[in]  p_ctrl   Pointer to the control structure.
+ *
+ * @return Current timestamp, or 0 if no timestamp source is configured.
+ **********************************************************************************************************************/
+static uint32_t rm_drw_frame_timestamp (rm_drw_frame_instance_ctrl_t * p_ctrl)
+{
+    uint32_t now = 0U;
+
+    if (NULL != p_ctrl->p_cfg->p_timestamp_get)
+    {
+        now = p_ctrl->p_cfg->p_timestamp_get();
+    }
+
+    return now;
+}
+
+/*******************************************************************************************************************//**
+ * Finds a frame buffer that is neither displayed, waiting for display nor rendered. If there is none, a queued frame
+ * that has not reached the display yet is dropped and its buffer is reused.
+ *
+ * @param[in]  p_ctrl   Pointer to the control structure.
+ *
+ * @return Index of the buffer, or RM_DRW_FRAME_PRV_NONE if all buffers are in use by the display.
+ **********************************************************************************************************************/
+static uint8_t rm_drw_frame_buffer_acquire (rm_drw_frame_instance_ctrl_t * p_ctrl)
+{
+    uint8_t index = RM_DRW_FRAME_PRV_NONE;
+
+    /* The display interrupt moves buffers between queued, flip_pending and displayed. */
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+
+    for (uint8_t i = 0U; (i < p_ctrl->p_cfg->num_buffers) && (RM_DRW_FRAME_PRV_NONE == index); i++)
+    {
+        if ((i != p_ctrl->displayed) && (i != p_ctrl->flip_pending) && (i != p_ctrl->queued) &&
+            (i != p_ctrl->rendering))
+        {
+            index = i;
+        }
+    }
+
+    if ((RM_DRW_FRAME_PRV_NONE == index) && (RM_DRW_FRAME_PRV_NONE != p_ctrl->queued))
+    {
+        index          = p_ctrl->queued;
+        p_ctrl->queued = RM_DRW_FRAME_PRV_NONE;
+        p_ctrl->statistics.frames_dropped++;
+    }
+
+    FSP_CRITICAL_SECTION_EXIT;
+
+    return index;
+}
+
+/*******************************************************************************************************************//**
+ * Closes the display list just recorded and starts it on the D/AVE 2D after the display list executing before is
+ * complete. A frame whose last display list completed is queued for display.
+ *
+ * @param[in]  p_ctrl     Pointer to the control structure.
+ * @param[in]  frame_end  The display list is the last one of the recording frame.
+ *
+ * @retval     FSP_SUCCESS                    Display list started.
+ * @retval     FSP_ERR_INVALID_HW_CONDITION   D/AVE 2D returned an error.
+ **********************************************************************************************************************/
+static fsp_err_t rm_drw_frame_submit (rm_drw_frame_instance_ctrl_t * p_ctrl, bool frame_end)
+{
+    rm_drw_frame_cfg_t const * p_cfg       = p_ctrl->p_cfg;
+    d2_device                * p_d2_handle = p_cfg->p_d2_handle;
+
+    /* Close the display list just recorded and wait until the previous display list is executed. */
+    FSP_ERROR_RETURN(D2_OK == d2_endframe(p_d2_handle), FSP_ERR_INVALID_HW_CONDITION);
+
+    /* The D/AVE 2D is idle now, collect the performance counters of the completed display list. */
+    for (uint32_t i = 0U; i < RM_DRW_FRAME_PERF_COUNTERS; i++)
+    {
+        if (d2_pc_disable != p_cfg->perf_events[i])
+        {
+            p_ctrl->perf_count[i] += (uint32_t) d2_getperfcountvalue(p_d2_handle, i);
+            (void) d2_setperfcountvalue(p_d2_handle, i, 0);
+        }
+    }
+
+    if (RM_DRW_FRAME_PRV_NONE != p_ctrl->rendering)
+    {
+        uint32_t now         = rm_drw_frame_timestamp(p_ctrl);
+        uint32_t render_time = now - p_ctrl->render_time;
+
+        p_ctrl->statistics.render_time_last = render_time;
+        if (render_time > p_ctrl->statistics.render_time_max)
+        {
+            p_ctrl->statistics.render_time_max = render_time;
+        }
+
+        for (uint32_t i = 0U; i < RM_DRW_FRAME_PERF_COUNTERS; i++)
+        {
+            p_ctrl->statistics.perf_count_last[i] = p_ctrl->perf_count[i];
+            if (p_ctrl->perf_count[i] > p_ctrl->statistics.perf_count_max[i])
+            {
+                p_ctrl->statistics.perf_count_max[i] = p_ctrl->perf_count[i];
+            }
+
+            p_ctrl->perf_count[i] = 0U;
+        }
+
+        p_ctrl->statistics.frames_rendered++;
+        p_ctrl->queue_time[p_ctrl->rendering] = now;
+
+        /* Queue the rendered frame, replacing a frame that has not reached the display yet. */
+        FSP_CRITICAL_SECTION_DEFINE;
+        FSP_CRITICAL_SECTION_ENTER;
+        if (RM_DRW_FRAME_PRV_NONE != p_ctrl->queued)
+        {
+            p_ctrl->statistics.frames_dropped++;
+        }
+
+        p_ctrl->queued = p_ctrl->rendering;
+        FSP_CRITICAL_SECTION_EXIT;
+
+        p_ctrl->rendering = RM_DRW_FRAME_PRV_NONE;
+    }
+
+    if (frame_end)
+    {
+        p_ctrl->rendering   = p_ctrl->recording;
+        p_ctrl->render_time = p_ctrl->begin_time;
+        p_ctrl->recording   = RM_DRW_FRAME_PRV_NONE;
+    }
+
+    /* Start the display list right away and open the render buffer for the next one. */
+    FSP_ERROR_RETURN(D2_OK == d2_startframe(p_d2_handle), FSP_ERR_INVALID_HW_CONDITION);
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Gets the number of bands frames are rendered in at a throttle level.
+ *
+ * @param[in]  p_ctrl   Pointer to the control structure.
+ * @param[in]  level    Throttle level.
+ *
+ * @return Number of bands, 1 if frames are not throttled.
+ **********************************************************************************************************************/
+static uint8_t rm_drw_frame_tiles (rm_drw_frame_instance_ctrl_t * p_ctrl, uint8_t level)
+{
+    uint32_t tiles_max = p_ctrl->p_cfg->tiles_max;
+    uint32_t tiles     = 1U;
+
+    for (uint8_t i = 0U; (i < level) && (tiles < tiles_max); i++)
+    {
+        tiles <<= 1;
+    }
+
+    if ((tiles_max > 1U) && (tiles > tiles_max))
+    {
+        tiles = tiles_max;
+    }
+
+    return (uint8_t) tiles;
+}
+
+/*******************************************************************************************************************//**
+ * Sets the D/AVE 2D cliprect to the band being recorded.
+ *
+ * @param[in]  p_ctrl   Pointer to the control structure.
+ *
+ * @return D/AVE 2D error code.
+ **********************************************************************************************************************/
+static d2_s32 rm_drw_frame_tile_clip (rm_drw_frame_instance_ctrl_t * p_ctrl)
+{
+    rm_drw_frame_cfg_t const  * p_cfg   = p_ctrl->p_cfg;
+    display_input_cfg_t const * p_input = &p_cfg->p_display->p_cfg->input[p_cfg->layer];
+
+    uint32_t band = ((uint32_t) p_input->vsize + p_ctrl->tile_count - 1U) / p_ctrl->tile_count;
+    uint32_t ymin = band * p_ctrl->tile_index;
+    uint32_t ymax = ymin + band - 1U;
+    if (ymax >= p_input->vsize)
+    {
+        ymax = (uint32_t) p_input->vsize - 1U;
+    }
+
+    return d2_cliprect(p_cfg->p_d2_handle, 0, (d2_border) ymin, (d2_border) (p_input->hsize - 1U), (d2_border) ymax);
+}
+
+/*******************************************************************************************************************//**
+ * Handles the line detection interrupt: flips to a queued frame and updates the throttle level.
+ *
+ * @param[in]  p_ctrl   Pointer to the control structure.
+ **********************************************************************************************************************/
+static void rm_drw_frame_vblank (rm_drw_frame_instance_ctrl_t * p_ctrl)
+{
+    rm_drw_frame_cfg_t const * p_cfg = p_ctrl->p_cfg;
+    rm_drw_frame_event_t       event = RM_DRW_FRAME_EVENT_FRAME_REPEATED;
+    uint32_t                   now   = rm_drw_frame_timestamp(p_ctrl);
+
+    /* Measure the frame period for the underflow line estimate. */
+    if (0U != p_ctrl->vblank_time)
+    {
+        p_ctrl->frame_period = now - p_ctrl->vblank_time;
+    }
+
+    p_ctrl->vblank_time = now;
+
+    if (RM_DRW_FRAME_PRV_NONE != p_ctrl->flip_pending)
+    {
+        uint32_t latency = now - p_ctrl->queue_time[p_ctrl->flip_pending];
+
+        p_ctrl->displayed    = p_ctrl->flip_pending;
+        p_ctrl->flip_pending = RM_DRW_FRAME_PRV_NONE;
+
+        p_ctrl->statistics.frames_displayed++;
+        p_ctrl->statistics.scanout_latency_last = latency;
+        if (latency > p_ctrl->statistics.scanout_latency_max)
+        {
+            p_ctrl->statistics.scanout_latency_max = latency;
+        }
+
+        event = RM_DRW_FRAME_EVENT_FRAME_DISPLAYED;
+    }
+    else
+    {
+        p_ctrl->statistics.frames_repeated++;
+    }
+
+    if (RM_DRW_FRAME_PRV_NONE != p_ctrl->queued)
+    {
+        /* The display rejects the change while a previous register update is still pending; retry next time. */
+        fsp_err_t err = p_cfg->p_display->p_api->bufferChange(p_cfg->p_display->p_ctrl,
+                                                               p_cfg->pp_buffers[p_ctrl->queued],
+                                                               p_cfg->layer);
+        if (FSP_SUCCESS == err)
+        {
+            p_ctrl->flip_pending = p_ctrl->queued;
+            p_ctrl->queued       = RM_DRW_FRAME_PRV_NONE;
+        }
+    }
+
+    rm_drw_frame_throttle_update(p_ctrl);
+
+    if (NULL != p_cfg->p_callback)
+    {
+        rm_drw_frame_callback_args_t args;
+        args.event     = event;
+        args.p_context = p_cfg->p_context;
+        p_cfg->p_callback(&args);
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Records a display underflow.
+ *
+ * @param[in]  p_ctrl   Pointer to the control structure.
+ * @param[in]  layer    Graphics layer index (0: layer 1, 1: layer 2).
+ **********************************************************************************************************************/
+static void rm_drw_frame_underflow (rm_drw_frame_instance_ctrl_t * p_ctrl, uint32_t layer)
+{
+    p_ctrl->statistics.underflows[layer]++;
+    p_ctrl->frame_underflows++;
+
+    /* The GLCDC has no line counter; estimate the line from the time since the line detection interrupt. */
+    if (0U != p_ctrl->frame_period)
+    {
+        uint32_t total_lines = p_ctrl->p_cfg->p_display->p_cfg->output.vtiming.total_cyc;
+        uint32_t elapsed     = rm_drw_frame_timestamp(p_ctrl) - p_ctrl->vblank_time;
+
+        p_ctrl->statistics.underflow_line_last[layer] =
+            (uint32_t) (((uint64_t) elapsed * total_lines) / p_ctrl->frame_period);
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Raises the throttle level after a frame with underflows and lowers it after rm_drw_frame_cfg_t::recovery_frames
+ * frames without. The highest level disables the other graphics layer if rm_drw_frame_cfg_t::p_other_layer_buffer is
+ * set.
+ *
+ * @param[in]  p_ctrl   Pointer to the control structure.
+ **********************************************************************************************************************/
+static void rm_drw_frame_throttle_update (rm_drw_frame_instance_ctrl_t * p_ctrl)
+{
+    rm_drw_frame_cfg_t const * p_cfg = p_ctrl->p_cfg;
+    uint8_t                    level = p_ctrl->throttle_level;
+
+    if (0U != p_ctrl->frame_underflows)
+    {
+        if (level < p_ctrl->throttle_max)
+        {
+            level++;
+        }
+
+        p_ctrl->calm_frames = 0U;
+    }
+    else if (level > 0U)
+    {
+        p_ctrl->calm_frames++;
+        if (p_ctrl->calm_frames >= p_cfg->recovery_frames)
+        {
+            level--;
+            p_ctrl->calm_frames = 0U;
+        }
+    }
+    else
+    {
+        /* Not throttled. */
+    }
+
+    p_ctrl->frame_underflows = 0U;
+    p_ctrl->throttle_level   = level;
+
+    p_ctrl->statistics.throttle_level = level;
+    p_ctrl->statistics.tiles          = rm_drw_frame_tiles(p_ctrl, level);
+
+    if (NULL != p_cfg->p_other_layer_buffer)
+    {
+        bool disable = (level == p_ctrl->throttle_max);
+
+        if (disable != p_ctrl->statistics.other_layer_disabled)
+        {
+            /* A NULL buffer makes the layer transparent and stops its memory reads. */
+            display_frame_layer_t other  = (DISPLAY_FRAME_LAYER_1 == p_cfg->layer) ?
+                                           DISPLAY_FRAME_LAYER_2 : DISPLAY_FRAME_LAYER_1;
+            uint8_t             * p_buff = disable ? NULL : p_cfg->p_other_layer_buffer;
+
+            if (FSP_SUCCESS == p_cfg->p_display->p_api->bufferChange(p_cfg->p_display->p_ctrl, p_buff, other))
+            {
+                p_ctrl->statistics.other_layer_disabled = disable;
+            }
+        }
+    }
+}
@@ -58,4 +58,19 @@ void GUI_X_Config (void)
     GUI_SetDefaultFont(GUI_FONT_6X8);
 }
 
+/*********************************************************************
+ *
+ *       GUICONF_IsHeapAddr
+ *
+ * Purpose:
+ *   Returns 1 if the given address is part of the memory assigned to
+ *   emWin. Such data (e.g. memory devices) may be reused as soon as a
+ *   drawing function returns.
+ */
+int GUICONF_IsHeapAddr (const void * p)
+{
+    return ((const uint8_t *) p >= (const uint8_t *) aMemory) &&
+           ((const uint8_t *) p < ((const uint8_t *) aMemory + sizeof(aMemory)));
+}
+
 /*************************** End of file ****************************/
@@ -27,6 +27,14 @@
 
 #define EMWIN_OS_PRV_SYSTICK_HZ    (1000U)
 
+#if EMWIN_LCD_USE_DAVE && (EMWIN_LCD_BITS_PER_PIXEL > 8)
+extern void LCDCONF_FlushDave2D(void);
+
+ #define EMWIN_OS_PRV_FLUSH_DAVE()    LCDCONF_FlushDave2D()
+#else
+ #define EMWIN_OS_PRV_FLUSH_DAVE()
+#endif
+
 /*********************************************************************
  *
  *       Static data
@@ -98,6 +106,11 @@ void GUI_X_Delay (int Period)
  */
 void GUI_X_ExecIdle (void)
 {
+    //
+    // Execute D/AVE 2D operations batched during the last GUI_Exec() cycle
+    //
+    EMWIN_OS_PRV_FLUSH_DAVE();
+
 #if EMWIN_CFG_RTOS == 2                // FreeRTOS
     vTaskDelay(pdMS_TO_TICKS(1));
 #endif
@@ -129,6 +142,11 @@ void GUI_X_InitOS (void)
 
 void GUI_X_Unlock (void)
 {
+    //
+    // Drawing done by the locking task has to be complete before another task can access the display
+    //
+    EMWIN_OS_PRV_FLUSH_DAVE();
+
 #if EMWIN_CFG_RTOS == 2                // FreeRTOS
     xSemaphoreGive(_Semaphore);
 #endif
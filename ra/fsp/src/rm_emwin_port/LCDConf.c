@@ -44,6 +44,9 @@
 #ifndef   EMWIN_LCD_DISPLAY_DRIVER
  #error No display driver defined!
 #endif
+#ifndef   EMWIN_LCD_DAVE_BATCH_SIZE    // Max. D/AVE 2D operations per render buffer execution, 1 disables batching
+ #define EMWIN_LCD_DAVE_BATCH_SIZE    (64)
+#endif
 
 /*********************************************************************
  *
@@ -100,9 +103,15 @@ static uint32_t          _WriteBufferIndex;
 static d2_renderbuffer * renderbuffer;
 
 //
-// Array for swapped nibble data
+// Batching: number of operations written to the render buffer but not yet executed
+//
+static uint32_t _BatchOps;
+
+//
+// Array for swapped nibble data, glyphs of one batch are stored one after the other
 //
-static uint8_t glyph_mirror[EMWIN_LCD_AA_FONT_CONV_BUFFER_SIZE];
+static uint8_t  glyph_mirror[EMWIN_LCD_AA_FONT_CONV_BUFFER_SIZE] __attribute__((aligned(4)));
+static uint32_t _GlyphOffset;
 
 //
 // Array for speeding up nibble conversion for A4 bitmaps
@@ -163,6 +172,8 @@ void * LCDCONF_GetBufferAddr(void);
 static uint32_t _GetD2Mode(void);
 void            LCDCONF_DisableDave2D(void);
 void            LCDCONF_EnableDave2D(void);
+void            LCDCONF_FlushDave2D(void);
+extern int      GUICONF_IsHeapAddr(const void * p);
 
  #if EMWIN_JPEG_USE_HW
 extern void JPEG_X_Init(JPEG_X_CONTEXT * pContext);
@@ -356,6 +367,61 @@ static uint32_t _GetD2Mode (void)
     return r;
 }
 
+/*********************************************************************
+ *
+ *       _D2Flush
+ *
+ * Purpose:
+ *   Executes the operations collected in the render buffer and waits
+ *   for D/AVE 2D to finish. Must be called before the CPU accesses
+ *   memory written by pending operations.
+ */
+static void _D2Flush (void)
+{
+    if (_BatchOps)
+    {
+        d2_executerenderbuffer(*_d2_handle_emwin, renderbuffer, 0);
+        d2_flushframe(*_d2_handle_emwin);
+        _BatchOps    = 0;
+        _GlyphOffset = 0;
+    }
+}
+
+/*********************************************************************
+ *
+ *       _D2Begin
+ *
+ * Purpose:
+ *   Selects the render buffer for the following render operations.
+ *   Selecting resets the render buffer, so this is only done for the
+ *   first operation of a batch.
+ */
+static void _D2Begin (void)
+{
+    if (0 == _BatchOps)
+    {
+        d2_selectrenderbuffer(*_d2_handle_emwin, renderbuffer);
+    }
+}
+
+/*********************************************************************
+ *
+ *       _D2End
+ *
+ * Purpose:
+ *   Adds the operation to the current batch. The batch is executed
+ *   right away if Sync is set (the operation reads or writes memory
+ *   that emWin reuses after returning) or if it is full.
+ */
+static void _D2End (int Sync)
+{
+    _BatchOps++;
+    if (Sync || (_BatchOps >= (uint32_t) EMWIN_LCD_DAVE_BATCH_SIZE))
+    {
+        _D2Flush();
+    }
+}
+
 /*********************************************************************
  *
  *       _LCD_FillRect
@@ -379,7 +445,7 @@ static void _LCD_FillRect (int32_t LayerIndex, int32_t x0, int32_t y0, int32_t x
                    EMWIN_LCD_XSIZE_PHYS,
                    EMWIN_LCD_YSIZE_PHYS,
                    (d2_s32) Mode);
-    d2_selectrenderbuffer(*_d2_handle_emwin, renderbuffer);
+    _D2Begin();
     d2_setcolor(*_d2_handle_emwin, 0, GUI_Index2Color((int) PixelIndex));
     d2_setalpha(*_d2_handle_emwin, GUI_GetAlpha());
     pRect = GUI__GetClipRect();
@@ -390,10 +456,9 @@ static void _LCD_FillRect (int32_t LayerIndex, int32_t x0, int32_t y0, int32_t x
                  (d2_width) (ySize << 4));
 
     //
-    // Execute render operations
+    // Add render operations to the batch
     //
-    d2_executerenderbuffer(*_d2_handle_emwin, renderbuffer, 0);
-    d2_flushframe(*_d2_handle_emwin);
+    _D2End(0);
     d2_setalpha(*_d2_handle_emwin, UINT8_MAX);
 }
 
@@ -424,7 +489,7 @@ static void _DrawMemdevAlpha (void       * pDst,
     //
     // Generate render operations
     //
-    d2_selectrenderbuffer(*_d2_handle_emwin, renderbuffer);
+    _D2Begin();
     d2_setblitsrc(*_d2_handle_emwin, (void *) pSrc, (d2_s32) PitchSrc, xSize, ySize, d2_mode_argb8888);
     d2_blitcopy(*_d2_handle_emwin,
                 xSize,
@@ -440,8 +505,7 @@ static void _DrawMemdevAlpha (void       * pDst,
     //
     // Execute render operations
     //
-    d2_executerenderbuffer(*_d2_handle_emwin, renderbuffer, 0);
-    d2_flushframe(*_d2_handle_emwin);
+    _D2End(1);
 
     //
     // Restore frame buffer
@@ -474,16 +538,15 @@ static void _DrawBitmapAlpha (int LayerIndex, int x, int y, const void * p, int
                    EMWIN_LCD_XSIZE_PHYS,
                    EMWIN_LCD_YSIZE_PHYS,
                    (d2_s32) Mode);
-    d2_selectrenderbuffer(*_d2_handle_emwin, renderbuffer);
+    _D2Begin();
     d2_setblitsrc(*_d2_handle_emwin, (void *) p, BytesPerLine / 4, xSize, ySize, d2_mode_argb8888);
     d2_blitcopy(*_d2_handle_emwin, xSize, ySize, 0, 0, (d2_width) (xSize << 4), (d2_width) (ySize << 4),
                 (d2_point) (x << 4), (d2_point) (y << 4), d2_bf_usealpha);
 
     //
-    // Execute render operations
+    // Add render operations to the batch, execute right away if emWin may reuse the source
     //
-    d2_executerenderbuffer(*_d2_handle_emwin, renderbuffer, 0);
-    d2_flushframe(*_d2_handle_emwin);
+    _D2End(GUICONF_IsHeapAddr(p));
 }
 
 /*********************************************************************
@@ -509,16 +572,15 @@ static void _DrawBitmap16bpp (int LayerIndex, int x, int y, const void * p, int
                    EMWIN_LCD_XSIZE_PHYS,
                    EMWIN_LCD_YSIZE_PHYS,
                    (d2_s32) Mode);
-    d2_selectrenderbuffer(*_d2_handle_emwin, renderbuffer);
+    _D2Begin();
     d2_setblitsrc(*_d2_handle_emwin, (void *) p, BytesPerLine / 2, xSize, ySize, ModeSrc);
     d2_blitcopy(*_d2_handle_emwin, xSize, ySize, 0, 0, (d2_width) (xSize << 4), (d2_width) (ySize << 4),
                 (d2_point) (x << 4), (d2_point) (y << 4), 0);
 
     //
-    // Execute render operations
+    // Add render operations to the batch, execute right away if emWin may reuse the source
     //
-    d2_executerenderbuffer(*_d2_handle_emwin, renderbuffer, 0);
-    d2_flushframe(*_d2_handle_emwin);
+    _D2End(GUICONF_IsHeapAddr(p));
 }
 
 /*********************************************************************
@@ -586,7 +648,7 @@ static void _DrawBitmap8bpp (int                    LayerIndex,
                    EMWIN_LCD_XSIZE_PHYS,
                    EMWIN_LCD_YSIZE_PHYS,
                    (d2_s32) Mode);
-    d2_selectrenderbuffer(*_d2_handle_emwin, renderbuffer);
+    _D2Begin();
     pRect = GUI_GetClipRect();
     d2_cliprect(*_d2_handle_emwin, pRect->x0, pRect->y0, pRect->x1, pRect->y1);
     d2_setblitsrc(*_d2_handle_emwin, (void *) p, BytesPerLine, xSize, ySize, ModeSrc);
@@ -596,10 +658,9 @@ static void _DrawBitmap8bpp (int                    LayerIndex,
                 (d2_point) (x << 4), (d2_point) (y << 4), 0);
 
     //
-    // Execute render operations
+    // Add render operations to the batch, execute right away if emWin may reuse the source
     //
-    d2_executerenderbuffer(*_d2_handle_emwin, renderbuffer, 0);
-    d2_flushframe(*_d2_handle_emwin);
+    _D2End(GUICONF_IsHeapAddr(p));
 }
 
 /*********************************************************************
@@ -629,10 +690,18 @@ static int _DrawChar4bpp (int LayerIndex, int x, int y, U8 const * p, int xSize,
         return 1;
     }
 
+    //
+    // Glyphs of pending operations are still read by D/AVE 2D, execute them if the buffer is full
+    //
+    if ((_GlyphOffset + NumBytes) > sizeof(glyph_mirror))
+    {
+        _D2Flush();
+    }
+
     //
     // Swap nibbles
     //
-    pWR = (uint8_t *) glyph_mirror;
+    pWR = &glyph_mirror[_GlyphOffset];
     pRD = (uint8_t *) p;
     for (uint32_t i = 0; i < NumBytes; i++)
     {
@@ -647,7 +716,7 @@ static int _DrawChar4bpp (int LayerIndex, int x, int y, U8 const * p, int xSize,
                    EMWIN_LCD_XSIZE_PHYS,
                    EMWIN_LCD_YSIZE_PHYS,
                    (d2_s32) Mode);
-    d2_selectrenderbuffer(*_d2_handle_emwin, renderbuffer);
+    _D2Begin();
 
     Color = GUI_GetColor();
     d2_setcolor(*_d2_handle_emwin, 0, Color);
@@ -666,7 +735,7 @@ static int _DrawChar4bpp (int LayerIndex, int x, int y, U8 const * p, int xSize,
 
     /* Set texture buffer in D2 driver and assign CLUT */
     d2_settexclut_format(*_d2_handle_emwin, d2_mode_i4);
-    d2_settexture(*_d2_handle_emwin, (void *) glyph_mirror, BytesPerLine * 2, xSize, ySize, d2_mode_i4 | d2_mode_clut);
+    d2_settexture(*_d2_handle_emwin, (void *) pWR, BytesPerLine * 2, xSize, ySize, d2_mode_i4 | d2_mode_clut);
     d2_settexclut(*_d2_handle_emwin, (d2_color *) clut_i4);
 
     /* Set texture mapping for the following:
@@ -695,10 +764,10 @@ static int _DrawChar4bpp (int LayerIndex, int x, int y, U8 const * p, int xSize,
                        (d2_width) (ySize << 4));
 
     //
-    // Execute render operations
+    // Add render operations to the batch
     //
-    d2_executerenderbuffer(*_d2_handle_emwin, renderbuffer, 0);
-    d2_flushframe(*_d2_handle_emwin);
+    _GlyphOffset += (NumBytes + 3U) & ~3U;
+    _D2End(0);
 
     /* Revert fill mode */
     d2_setfillmode(*_d2_handle_emwin, prevfillmode);
@@ -728,6 +797,11 @@ void LCDCONF_DrawJPEG (int32_t      LayerIndex,
     Mode    = _GetD2Mode();
     ModeSrc = ((BytesPerLine / xSize) == 2) ? d2_mode_rgb565 : d2_mode_argb8888;
 
+    //
+    // The JPEG output is executed on its own, flush the pending batch first
+    //
+    _D2Flush();
+
     //
     // Generate render operations
     //
@@ -805,7 +879,7 @@ static int32_t _CircleAA (int32_t x0, int32_t y0, int32_t r, int32_t w)
                    EMWIN_LCD_XSIZE_PHYS,
                    EMWIN_LCD_YSIZE_PHYS,
                    (d2_s32) Mode);
-    d2_selectrenderbuffer(*_d2_handle_emwin, renderbuffer);
+    _D2Begin();
     Color = GUI_GetColor();
     d2_setcolor(*_d2_handle_emwin, 0, Color);
     pRect = GUI__GetClipRect();
@@ -817,14 +891,9 @@ static int32_t _CircleAA (int32_t x0, int32_t y0, int32_t r, int32_t w)
                           (d2_width) (w << 4));
 
     //
-    // Execute render operations
+    // Add render operations to the batch
     //
-    d2_executerenderbuffer(*_d2_handle_emwin, renderbuffer, 0);
-    d2_flushframe(*_d2_handle_emwin);
-    while (d2_commandspending(*_d2_handle_emwin))
-    {
-        /* Do nothing */
-    }
+    _D2End(0);
 
     return ret;
 }
@@ -888,7 +957,7 @@ static int _FillPolygonAA (const GUI_POINT * pPoints, int NumPoints, int x0, int
                        EMWIN_LCD_XSIZE_PHYS,
                        EMWIN_LCD_YSIZE_PHYS,
                        (d2_s32) Mode);
-        d2_selectrenderbuffer(*_d2_handle_emwin, renderbuffer);
+        _D2Begin();
         Color = GUI_GetColor();
         d2_setcolor(*_d2_handle_emwin, 0, Color);
         pRect = GUI__GetClipRect();
@@ -896,10 +965,9 @@ static int _FillPolygonAA (const GUI_POINT * pPoints, int NumPoints, int x0, int
         ret = d2_renderpolygon(*_d2_handle_emwin, pData, (d2_u32) NumPoints, d2_le_closed);
 
         //
-        // Execute render operations
+        // Add render operations to the batch
         //
-        d2_executerenderbuffer(*_d2_handle_emwin, renderbuffer, 0);
-        d2_flushframe(*_d2_handle_emwin);
+        _D2End(0);
         EMWIN_FREE(pData);
     }
 
@@ -943,7 +1011,7 @@ static int _DrawPolyOutlineAA (const GUI_POINT * pPoints, int NumPoints, int Thi
                        EMWIN_LCD_XSIZE_PHYS,
                        EMWIN_LCD_YSIZE_PHYS,
                        (d2_s32) Mode);
-        d2_selectrenderbuffer(*_d2_handle_emwin, renderbuffer);
+        _D2Begin();
         Color = GUI_GetColor();
         d2_setcolor(*_d2_handle_emwin, 0, Color);
         pRect = GUI__GetClipRect();
@@ -954,10 +1022,9 @@ static int _DrawPolyOutlineAA (const GUI_POINT * pPoints, int NumPoints, int Thi
         d2_selectrendermode(*_d2_handle_emwin, d2_rm_solid);
 
         //
-        // Execute render operations
+        // Add render operations to the batch
         //
-        d2_executerenderbuffer(*_d2_handle_emwin, renderbuffer, 0);
-        d2_flushframe(*_d2_handle_emwin);
+        _D2End(0);
         EMWIN_FREE(pData);
     }
 
@@ -988,7 +1055,7 @@ static int _DrawLineAA (int x0, int y0, int x1, int y1)
                    EMWIN_LCD_XSIZE_PHYS,
                    EMWIN_LCD_YSIZE_PHYS,
                    (d2_s32) Mode);
-    d2_selectrenderbuffer(*_d2_handle_emwin, renderbuffer);
+    _D2Begin();
     Color = GUI_GetColor();
     d2_setcolor(*_d2_handle_emwin, 0, Color);
     pRect = GUI__GetClipRect();
@@ -998,10 +1065,9 @@ static int _DrawLineAA (int x0, int y0, int x1, int y1)
                       (d2_point) (y1 << 4), (d2_width) (PenSize << 4), d2_le_exclude_none);
 
     //
-    // Execute render operations
+    // Add render operations to the batch
     //
-    d2_executerenderbuffer(*_d2_handle_emwin, renderbuffer, 0);
-    d2_flushframe(*_d2_handle_emwin);
+    _D2End(0);
 
     return ret;
 }
@@ -1049,7 +1115,7 @@ static int _DrawArcAA (int x0, int y0, int rx, int ry, long a0, long a1)
                    EMWIN_LCD_XSIZE_PHYS,
                    EMWIN_LCD_YSIZE_PHYS,
                    (d2_s32) Mode);
-    d2_selectrenderbuffer(*_d2_handle_emwin, renderbuffer);
+    _D2Begin();
     Color = GUI_GetColor();
     d2_setcolor(*_d2_handle_emwin, 0, Color);
     pRect = GUI__GetClipRect();
@@ -1066,10 +1132,9 @@ static int _DrawArcAA (int x0, int y0, int rx, int ry, long a0, long a1)
                          0);
 
     //
-    // Execute render operations
+    // Add render operations to the batch
     //
-    d2_executerenderbuffer(*_d2_handle_emwin, renderbuffer, 0);
-    d2_flushframe(*_d2_handle_emwin);
+    _D2End(0);
 
     return ret;
 }
@@ -1099,20 +1164,153 @@ static void _CopyBuffer (int LayerIndex, int IndexSrc, int IndexDst)
                    EMWIN_LCD_XSIZE_PHYS,
                    EMWIN_LCD_YSIZE_PHYS,
                    (d2_s32) Mode);
-    d2_selectrenderbuffer(*_d2_handle_emwin, renderbuffer);
+    _D2Begin();
     d2_setblitsrc(*_d2_handle_emwin, pSrc, EMWIN_LCD_XSTRIDE_PHYS, EMWIN_LCD_XSIZE_PHYS, EMWIN_LCD_YSIZE_PHYS, Mode);
     d2_blitcopy(*_d2_handle_emwin, EMWIN_LCD_XSIZE_PHYS, EMWIN_LCD_YSIZE_PHYS, 0, 0,
                 (d2_width) (EMWIN_LCD_XSIZE_PHYS << 4), (d2_width) (EMWIN_LCD_YSIZE_PHYS << 4), 0, 0, 0);
 
     //
-    // Execute blit
+    // Add render operations to the batch
     //
-    d2_executerenderbuffer(*_d2_handle_emwin, renderbuffer, 0);
-    d2_flushframe(*_d2_handle_emwin);
+    _D2End(0);
 
     _WriteBufferIndex = (uint32_t) IndexDst;
 }
 
+/*********************************************************************
+ *
+ *       Batch device
+ *
+ * Purpose:
+ *   Device linked on top of the display driver. Drawing operations
+ *   done by the CPU are passed on to the driver after the pending
+ *   D/AVE 2D batch was executed, so that they are applied in order.
+ *   Operations which end up in the D/AVE 2D functions above are passed
+ *   on directly.
+ */
+static void _BatchDrawBitmap (GUI_DEVICE           * pDevice,
+                              int                    x0,
+                              int                    y0,
+                              int                    xSize,
+                              int                    ySize,
+                              int                    BitsPerPixel,
+                              int                    BytesPerLine,
+                              const U8             * pData,
+                              int                    Diff,
+                              const LCD_PIXELINDEX * pTrans)
+{
+    //
+    // Only 8bpp and 16bpp bitmaps without pixel offset are drawn by _DrawBitmap8bpp() and _DrawBitmap16bpp()
+    //
+    if (((BitsPerPixel != 8) && (BitsPerPixel != 16)) || Diff)
+    {
+        _D2Flush();
+    }
+
+    pDevice = pDevice->pNext;
+    pDevice->pDeviceAPI->pfDrawBitmap(pDevice, x0, y0, xSize, ySize, BitsPerPixel, BytesPerLine, pData, Diff, pTrans);
+}
+
+static void _BatchDrawHLine (GUI_DEVICE * pDevice, int x0, int y, int x1)
+{
+    _D2Flush();
+    pDevice = pDevice->pNext;
+    pDevice->pDeviceAPI->pfDrawHLine(pDevice, x0, y, x1);
+}
+
+static void _BatchDrawVLine (GUI_DEVICE * pDevice, int x, int y0, int y1)
+{
+    _D2Flush();
+    pDevice = pDevice->pNext;
+    pDevice->pDeviceAPI->pfDrawVLine(pDevice, x, y0, y1);
+}
+
+static void _BatchFillRect (GUI_DEVICE * pDevice, int x0, int y0, int x1, int y1)
+{
+    //
+    // XOR fills are done by the CPU
+    //
+    if (GUI_GetDrawMode() & GUI_DM_XOR)
+    {
+        _D2Flush();
+    }
+
+    pDevice = pDevice->pNext;
+    pDevice->pDeviceAPI->pfFillRect(pDevice, x0, y0, x1, y1);
+}
+
+static LCD_PIXELINDEX _BatchGetPixelIndex (GUI_DEVICE * pDevice, int x, int y)
+{
+    _D2Flush();
+    pDevice = pDevice->pNext;
+
+    return pDevice->pDeviceAPI->pfGetPixelIndex(pDevice, x, y);
+}
+
+static void _BatchSetPixelIndex (GUI_DEVICE * pDevice, int x, int y, LCD_PIXELINDEX PixelIndex)
+{
+    _D2Flush();
+    pDevice = pDevice->pNext;
+    pDevice->pDeviceAPI->pfSetPixelIndex(pDevice, x, y, PixelIndex);
+}
+
+static void _BatchXorPixel (GUI_DEVICE * pDevice, int x, int y)
+{
+    _D2Flush();
+    pDevice = pDevice->pNext;
+    pDevice->pDeviceAPI->pfXorPixel(pDevice, x, y);
+}
+
+static void _BatchSetOrg (GUI_DEVICE * pDevice, int x, int y)
+{
+    pDevice = pDevice->pNext;
+    pDevice->pDeviceAPI->pfSetOrg(pDevice, x, y);
+}
+
+static void (* _BatchGetDevFunc(GUI_DEVICE ** ppDevice, int Index))(void)
+{
+    *ppDevice = (*ppDevice)->pNext;
+
+    return (*ppDevice)->pDeviceAPI->pfGetDevFunc(ppDevice, Index);
+}
+
+static I32 _BatchGetDevProp (GUI_DEVICE * pDevice, int Index)
+{
+    pDevice = pDevice->pNext;
+
+    return pDevice->pDeviceAPI->pfGetDevProp(pDevice, Index);
+}
+
+static void * _BatchGetDevData (GUI_DEVICE * pDevice, int Index)
+{
+    pDevice = pDevice->pNext;
+
+    return pDevice->pDeviceAPI->pfGetDevData(pDevice, Index);
+}
+
+static void _BatchGetRect (GUI_DEVICE * pDevice, LCD_RECT * pRect)
+{
+    pDevice = pDevice->pNext;
+    pDevice->pDeviceAPI->pfGetRect(pDevice, pRect);
+}
+
+static const GUI_DEVICE_API _BatchDeviceAPI =
+{
+    DEVICE_CLASS_DRIVER_MODIFIER,
+    _BatchDrawBitmap,
+    _BatchDrawHLine,
+    _BatchDrawVLine,
+    _BatchFillRect,
+    _BatchGetPixelIndex,
+    _BatchSetPixelIndex,
+    _BatchXorPixel,
+    _BatchSetOrg,
+    _BatchGetDevFunc,
+    _BatchGetDevProp,
+    _BatchGetDevData,
+    _BatchGetRect,
+};
+
 /*********************************************************************
  *
  *       Public code
@@ -1120,6 +1318,21 @@ static void _CopyBuffer (int LayerIndex, int IndexSrc, int IndexDst)
  **********************************************************************
  */
 
+/*********************************************************************
+ *
+ *       LCDCONF_FlushDave2D
+ *
+ * Purpose:
+ *   Executes all pending D/AVE 2D operations. Called when emWin releases
+ *   its lock (GUI_X_Unlock()), when it is idle (GUI_X_ExecIdle()) and
+ *   before a buffer is shown. Bitmap data outside the emWin heap passed
+ *   to emWin must not be changed before one of these points.
+ */
+void LCDCONF_FlushDave2D (void)
+{
+    _D2Flush();
+}
+
 /*********************************************************************
  *
  *       LCDCONF_EnableDave2D
@@ -1228,6 +1441,14 @@ void LCD_X_Config (void)
 #if EMWIN_LCD_USE_DAVE
     renderbuffer = d2_newrenderbuffer(*_d2_handle_emwin, 20, 20);
     LCDCONF_EnableDave2D();
+
+ #if (EMWIN_LCD_BITS_PER_PIXEL > 8)
+
+    //
+    // Keep CPU drawing in order with batched D/AVE 2D operations
+    //
+    GUI_DEVICE_CreateAndLink(&_BatchDeviceAPI, EMWIN_LCD_COLOR_CONVERSION, 0, 0);
+ #endif
 #endif
 }
 
@@ -1292,6 +1513,9 @@ int LCD_X_DisplayDriver (unsigned LayerIndex, unsigned Cmd, void * pData)
 
             p = (LCD_X_SHOWBUFFER_INFO *) pData;
 #if (EMWIN_LCD_NUM_FRAMEBUFFERS > 1)
+ #if EMWIN_LCD_USE_DAVE && (EMWIN_LCD_BITS_PER_PIXEL > 8)
+            _D2Flush();
+ #endif
             _SwitchBuffersOnVSYNC(p->Index);
  #if (EMWIN_LCD_NUM_FRAMEBUFFERS > 2)
             _PendingBuffer = p->Index;
@@ -82,10 +82,164 @@ The masks below are used when calling Group Event functions. */
 /* This is not a real lock: it is a bit (or semaphore) will will be given
 each time when a sector buffer is released. */
 #define FF_BUF_LOCK_EVENT_BITS    ( ( const EventBits_t ) FF_BUF_LOCK )
+
+/* When ffconfigFINE_GRAINED_LOCKING is set, tasks waiting for the directory
+lock, the FAT lock or a sector buffer queue up in FIFO order and each release
+wakes exactly one of them, instead of waking every waiter and letting them
+race for the event bit. A lock is handed directly to the next waiter, so its
+event bit stays clear while ownership changes. */
+#ifndef ffconfigFINE_GRAINED_LOCKING
+	#define ffconfigFINE_GRAINED_LOCKING    0
+#endif
+
+#if( ffconfigFINE_GRAINED_LOCKING != 0 )
+	#if( configSUPPORT_STATIC_ALLOCATION != 1 )
+		#error ffconfigFINE_GRAINED_LOCKING requires configSUPPORT_STATIC_ALLOCATION to be set to 1 in FreeRTOSConfig.h
+	#endif
+
+/* A task waiting for a lock or a buffer. It lives on the stack of the
+waiting task. */
+typedef struct xFF_LOCK_WAITER
+{
+	struct xFF_LOCK_WAITER *pxNext;
+	FF_IOManager_t *pxIOManager;
+	EventBits_t xBits;					/* The lock or buffer bit waited for. */
+	SemaphoreHandle_t xSemaphore;		/* Given when the lock or buffer is handed over. */
+	StaticSemaphore_t xSemaphoreBuffer;
+} FF_LockWaiter_t;
+
+/* All waiting tasks, oldest first. Only accessed with the scheduler suspended. */
+static FF_LockWaiter_t *pxLockWaiters = NULL;
+
+static void prvWaiterAdd( FF_LockWaiter_t *pxWaiter, FF_IOManager_t *pxIOManager, EventBits_t xBits );
+static FF_LockWaiter_t *prvWaiterTakeFirst( FF_IOManager_t *pxIOManager, EventBits_t xBits );
+static BaseType_t prvWaiterRemove( FF_LockWaiter_t *pxWaiter );
+static void prvLockTake( FF_IOManager_t *pxIOManager, EventBits_t xBits );
+static void prvLockGive( FF_IOManager_t *pxIOManager, EventBits_t xBits );
+#endif /* ffconfigFINE_GRAINED_LOCKING */
 #endif
 
 /*-----------------------------------------------------------*/
 
+#if( 2 == BSP_CFG_RTOS ) && ( ffconfigFINE_GRAINED_LOCKING != 0 )
+static void prvWaiterAdd( FF_LockWaiter_t *pxWaiter, FF_IOManager_t *pxIOManager, EventBits_t xBits )
+{
+FF_LockWaiter_t **ppxLast = &pxLockWaiters;
+
+	/* Called with the scheduler suspended. */
+	pxWaiter->pxNext = NULL;
+	pxWaiter->pxIOManager = pxIOManager;
+	pxWaiter->xBits = xBits;
+	pxWaiter->xSemaphore = xSemaphoreCreateBinaryStatic( &( pxWaiter->xSemaphoreBuffer ) );
+
+	while( *ppxLast != NULL )
+	{
+		ppxLast = &( ( *ppxLast )->pxNext );
+	}
+
+	*ppxLast = pxWaiter;
+}
+/*-----------------------------------------------------------*/
+
+static FF_LockWaiter_t *prvWaiterTakeFirst( FF_IOManager_t *pxIOManager, EventBits_t xBits )
+{
+FF_LockWaiter_t **ppxWaiter = &pxLockWaiters;
+FF_LockWaiter_t *pxWaiter = NULL;
+
+	/* Called with the scheduler suspended. */
+	while( *ppxWaiter != NULL )
+	{
+		if( ( ( *ppxWaiter )->pxIOManager == pxIOManager ) && ( ( *ppxWaiter )->xBits == xBits ) )
+		{
+			pxWaiter = *ppxWaiter;
+			*ppxWaiter = pxWaiter->pxNext;
+			break;
+		}
+
+		ppxWaiter = &( ( *ppxWaiter )->pxNext );
+	}
+
+	return pxWaiter;
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvWaiterRemove( FF_LockWaiter_t *pxWaiter )
+{
+FF_LockWaiter_t **ppxWaiter = &pxLockWaiters;
+BaseType_t xRemoved = pdFALSE;
+
+	/* Called with the scheduler suspended. Returns pdFALSE if the waiter was
+	already taken off the list by a release. */
+	while( *ppxWaiter != NULL )
+	{
+		if( *ppxWaiter == pxWaiter )
+		{
+			*ppxWaiter = pxWaiter->pxNext;
+			xRemoved = pdTRUE;
+			break;
+		}
+
+		ppxWaiter = &( ( *ppxWaiter )->pxNext );
+	}
+
+	return xRemoved;
+}
+/*-----------------------------------------------------------*/
+
+static void prvLockTake( FF_IOManager_t *pxIOManager, EventBits_t xBits )
+{
+FF_LockWaiter_t xWaiter;
+EventBits_t xPrevious;
+
+	vTaskSuspendAll();
+	{
+		/* Atomic test and clear: take the lock if it is free, otherwise
+		queue up behind the tasks already waiting for it. */
+		xPrevious = xEventGroupClearBits( pxIOManager->xEventGroup, xBits );
+		if( ( xPrevious & xBits ) == 0 )
+		{
+			prvWaiterAdd( &xWaiter, pxIOManager, xBits );
+		}
+	}
+	( void ) xTaskResumeAll();
+
+	if( ( xPrevious & xBits ) == 0 )
+	{
+		/* The releasing task hands the lock over by giving the semaphore. */
+		( void ) xSemaphoreTake( xWaiter.xSemaphore, portMAX_DELAY );
+		vSemaphoreDelete( xWaiter.xSemaphore );
+	}
+}
+/*-----------------------------------------------------------*/
+
+static void prvLockGive( FF_IOManager_t *pxIOManager, EventBits_t xBits )
+{
+FF_LockWaiter_t *pxWaiter;
+
+	vTaskSuspendAll();
+	{
+		pxWaiter = prvWaiterTakeFirst( pxIOManager, xBits );
+		if( pxWaiter == NULL )
+		{
+			/* Nobody is waiting: mark the lock or buffer as available. No task
+			blocks on the event group in this mode, so this cannot unblock a
+			task while the scheduler is suspended. */
+			xEventGroupSetBits( pxIOManager->xEventGroup, xBits );
+		}
+	}
+	( void ) xTaskResumeAll();
+
+	if( pxWaiter != NULL )
+	{
+		/* Wake only the oldest waiter. */
+		xSemaphoreGive( pxWaiter->xSemaphore );
+	}
+}
+/*-----------------------------------------------------------*/
+#endif /* ffconfigFINE_GRAINED_LOCKING */
+
+/*-----------------------------------------------------------*/
+
 BaseType_t FF_TrySemaphore( void *pxSemaphore, uint32_t ulTime_ms )
 {
 #if 2 == BSP_CFG_RTOS
@@ -174,7 +328,9 @@ BaseType_t xResult;
 
 void FF_LockDirectory( FF_IOManager_t *pxIOManager )
 {
-#if 2 == BSP_CFG_RTOS
+#if( 2 == BSP_CFG_RTOS ) && ( ffconfigFINE_GRAINED_LOCKING != 0 )
+	prvLockTake( pxIOManager, FF_DIR_LOCK_EVENT_BITS );
+#elif 2 == BSP_CFG_RTOS
 	EventBits_t xBits;
 
 	for( ;; )
@@ -208,7 +364,11 @@ void FF_UnlockDirectory( FF_IOManager_t *pxIOManager )
 {
 #if 2 == BSP_CFG_RTOS
 	configASSERT( ( xEventGroupGetBits( pxIOManager->xEventGroup ) & FF_DIR_LOCK_EVENT_BITS ) == 0 );
-	xEventGroupSetBits( pxIOManager->xEventGroup, FF_DIR_LOCK_EVENT_BITS );
+	#if( ffconfigFINE_GRAINED_LOCKING != 0 )
+		prvLockGive( pxIOManager, FF_DIR_LOCK_EVENT_BITS );
+	#else
+		xEventGroupSetBits( pxIOManager->xEventGroup, FF_DIR_LOCK_EVENT_BITS );
+	#endif
 #else
 	FSP_PARAMETER_NOT_USED(pxIOManager);
 #endif
@@ -270,6 +430,13 @@ EventBits_t xBits;
 
 	configASSERT( FF_Has_Lock( pxIOManager, FF_FAT_LOCK ) == pdFALSE );
 
+	#if( ffconfigFINE_GRAINED_LOCKING != 0 )
+	{
+		( void ) xBits;
+		prvLockTake( pxIOManager, FF_FAT_LOCK_EVENT_BITS );
+		pxIOManager->pvFATLockHandle = xTaskGetCurrentTaskHandle();
+	}
+	#else
 	for( ;; )
 	{
 		/* Called when a task want to make changes to the FAT area.
@@ -292,6 +459,7 @@ EventBits_t xBits;
 			break;
 		}
 	}
+	#endif /* ffconfigFINE_GRAINED_LOCKING */
 #else
 	FSP_PARAMETER_NOT_USED(pxIOManager);
 #endif
@@ -303,7 +471,11 @@ void FF_UnlockFAT( FF_IOManager_t *pxIOManager )
 #if 2 == BSP_CFG_RTOS
 	configASSERT( ( xEventGroupGetBits( pxIOManager->xEventGroup ) & FF_FAT_LOCK_EVENT_BITS ) == 0 );
 	pxIOManager->pvFATLockHandle = NULL;
-	xEventGroupSetBits( pxIOManager->xEventGroup, FF_FAT_LOCK_EVENT_BITS );
+	#if( ffconfigFINE_GRAINED_LOCKING != 0 )
+		prvLockGive( pxIOManager, FF_FAT_LOCK_EVENT_BITS );
+	#else
+		xEventGroupSetBits( pxIOManager->xEventGroup, FF_FAT_LOCK_EVENT_BITS );
+	#endif
 #else
 	FSP_PARAMETER_NOT_USED(pxIOManager);
 #endif
@@ -312,7 +484,50 @@ void FF_UnlockFAT( FF_IOManager_t *pxIOManager )
 
 BaseType_t FF_BufferWait( FF_IOManager_t *pxIOManager, uint32_t xWaitMS )
 {
-#if 2 == BSP_CFG_RTOS
+#if( 2 == BSP_CFG_RTOS ) && ( ffconfigFINE_GRAINED_LOCKING != 0 )
+FF_LockWaiter_t xWaiter;
+EventBits_t xBits;
+BaseType_t xReturn;
+
+	vTaskSuspendAll();
+	{
+		/* A buffer released while nobody was waiting leaves the bit set. */
+		xBits = xEventGroupClearBits( pxIOManager->xEventGroup, FF_BUF_LOCK_EVENT_BITS );
+		if( ( xBits & FF_BUF_LOCK_EVENT_BITS ) == 0 )
+		{
+			prvWaiterAdd( &xWaiter, pxIOManager, FF_BUF_LOCK_EVENT_BITS );
+		}
+	}
+	( void ) xTaskResumeAll();
+
+	if( ( xBits & FF_BUF_LOCK_EVENT_BITS ) != 0 )
+	{
+		return pdTRUE;
+	}
+
+	xReturn = xSemaphoreTake( xWaiter.xSemaphore, pdMS_TO_TICKS( xWaitMS ) );
+	if( xReturn == pdFALSE )
+	{
+		vTaskSuspendAll();
+		{
+			if( prvWaiterRemove( &xWaiter ) == pdFALSE )
+			{
+				/* A release picked this task just as the wait timed out. */
+				xReturn = pdTRUE;
+			}
+		}
+		( void ) xTaskResumeAll();
+
+		if( xReturn != pdFALSE )
+		{
+			( void ) xSemaphoreTake( xWaiter.xSemaphore, portMAX_DELAY );
+		}
+	}
+
+	vSemaphoreDelete( xWaiter.xSemaphore );
+
+	return xReturn;
+#elif 2 == BSP_CFG_RTOS
 EventBits_t xBits;
 BaseType_t xReturn;
 
@@ -344,8 +559,13 @@ BaseType_t xReturn;
 void FF_BufferProceed( FF_IOManager_t *pxIOManager )
 {
 #if 2 == BSP_CFG_RTOS
-	/* Wake-up all tasks that are waiting for a sector buffer to become available. */
-	xEventGroupSetBits( pxIOManager->xEventGroup, FF_BUF_LOCK_EVENT_BITS );
+	#if( ffconfigFINE_GRAINED_LOCKING != 0 )
+		/* Wake-up the task that has waited longest for a sector buffer. */
+		prvLockGive( pxIOManager, FF_BUF_LOCK_EVENT_BITS );
+	#else
+		/* Wake-up all tasks that are waiting for a sector buffer to become available. */
+		xEventGroupSetBits( pxIOManager->xEventGroup, FF_BUF_LOCK_EVENT_BITS );
+	#endif
 #else
 	FSP_PARAMETER_NOT_USED(pxIOManager);
 #endif
@@ -59,9 +59,42 @@
 
 #define RM_FREERTOS_PLUS_FAT_MIN_SECTOR_SIZE_BYTES    (512)
 
+/* Block media DMA requires word aligned buffers for direct transfers. */
+#define RM_FREERTOS_PLUS_FAT_PRV_ALIGN_MASK           (3U)
+
 /** "FFAT" in ASCII, used to determine if channel is open. */
 #define RM_FREERTOS_PLUS_FAT_OPEN                     (0x70706584ULL)
 
+/* "LOGH" in ASCII, marks a log checkpoint header. */
+#define RM_FREERTOS_PLUS_FAT_PRV_LOG_MAGIC            (0x4C4F4748U)
+
+/* Two ping-pong checkpoint headers precede the log data. */
+#define RM_FREERTOS_PLUS_FAT_PRV_LOG_HEADER_SECTORS   (2U)
+
+/* Compile-time binding of the block media instance. Define RM_FREERTOS_PLUS_FAT_CFG_BLOCK_MEDIA_BINDING as
+ * RM_BLOCK_MEDIA_SDMMC_ or RM_BLOCK_MEDIA_USB_, and RM_FREERTOS_PLUS_FAT_CFG_BLOCK_MEDIA_BINDING_HEADER as the header
+ * of that module, to call the block media directly instead of through its p_api table on the sector read, write and
+ * status paths. Every block media instance used with this module must then be of the bound module. */
+#ifdef RM_FREERTOS_PLUS_FAT_CFG_BLOCK_MEDIA_BINDING
+ #ifndef RM_FREERTOS_PLUS_FAT_CFG_BLOCK_MEDIA_BINDING_HEADER
+  #error "RM_FREERTOS_PLUS_FAT_CFG_BLOCK_MEDIA_BINDING_HEADER must name the header of the bound block media module."
+ #endif
+ #include RM_FREERTOS_PLUS_FAT_CFG_BLOCK_MEDIA_BINDING_HEADER
+ #define RM_FREERTOS_PLUS_FAT_PRV_BLOCK_MEDIA_API(p_instance, member, function)    \
+    FSP_API_DIRECT(RM_FREERTOS_PLUS_FAT_CFG_BLOCK_MEDIA_BINDING, function)
+#else
+ #define RM_FREERTOS_PLUS_FAT_PRV_BLOCK_MEDIA_API(p_instance, member, function)    ((p_instance)->p_api->member)
+#endif
+
+/* Checkpoint header stored at the start of a log file sector. */
+typedef struct st_rm_freertos_plus_fat_log_header
+{
+    uint32_t magic;
+    uint32_t sequence;
+    uint32_t length;
+    uint32_t check;
+} rm_freertos_plus_fat_log_header_t;
+
 int32_t rm_freertos_plus_fat_read(uint8_t * p_data, uint32_t sector, uint32_t num_sectors, FF_Disk_t * p_disk);
 int32_t rm_freertos_plus_fat_write(uint8_t * p_data, uint32_t sector, uint32_t num_sectors,
                                    FF_Disk_t * p_disk);
@@ -69,6 +102,30 @@ void             rm_freertos_plus_fat_memory_callback(rm_block_media_callback_ar
 static fsp_err_t rm_freertos_plus_fat_wait_event(rm_freertos_plus_fat_instance_ctrl_t * p_instance_ctrl,
                                                  uint32_t                               timeout);
 static fsp_err_t rm_freertos_plus_fat_wait_for_device(rm_freertos_plus_fat_instance_ctrl_t * p_instance_ctrl);
+static fsp_err_t rm_freertos_plus_fat_event_check(rm_freertos_plus_fat_instance_ctrl_t * p_instance_ctrl);
+static fsp_err_t rm_freertos_plus_fat_sync_read(rm_freertos_plus_fat_instance_ctrl_t * p_instance_ctrl,
+                                                uint8_t                              * p_data,
+                                                uint32_t                               sector,
+                                                uint32_t                               num_sectors);
+static fsp_err_t rm_freertos_plus_fat_sync_write(rm_freertos_plus_fat_instance_ctrl_t * p_instance_ctrl,
+                                                 uint8_t const                        * p_data,
+                                                 uint32_t                               sector,
+                                                 uint32_t                               num_sectors);
+static fsp_err_t rm_freertos_plus_fat_overlapped_read(rm_freertos_plus_fat_instance_ctrl_t * p_instance_ctrl,
+                                                      uint8_t                              * p_data,
+                                                      uint32_t                               sector,
+                                                      uint32_t                               num_sectors,
+                                                      FF_Disk_t                            * p_disk);
+static void      rm_freertos_plus_fat_read_ahead_start(rm_freertos_plus_fat_instance_ctrl_t * p_instance_ctrl,
+                                                       uint32_t                               sector,
+                                                       FF_Disk_t                            * p_disk);
+static fsp_err_t rm_freertos_plus_fat_read_ahead_finish(rm_freertos_plus_fat_instance_ctrl_t * p_instance_ctrl);
+static fsp_err_t rm_freertos_plus_fat_log_sectors_write(rm_freertos_plus_fat_instance_ctrl_t * p_instance_ctrl,
+                                                        rm_freertos_plus_fat_log_t           * p_log,
+                                                        uint8_t const                        * p_data,
+                                                        uint32_t                               sector,
+                                                        uint32_t                               num_sectors);
+static bool rm_freertos_plus_fat_log_header_parse(uint8_t const * p_sector, uint32_t * p_sequence, uint32_t * p_length);
 
 const fsp_version_t g_rm_freertos_plus_fat_version =
 {
@@ -143,8 +200,12 @@ fsp_err_t RM_FREERTOS_PLUS_FAT_Open (rm_freertos_plus_fat_ctrl_t * const      p_
     FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
 
     /* Initialize control structure. */
-    p_instance_ctrl->p_cfg = p_cfg;
-    p_instance_ctrl->open  = RM_FREERTOS_PLUS_FAT_OPEN;
+    p_instance_ctrl->p_cfg              = p_cfg;
+    p_instance_ctrl->sector_size        = RM_FREERTOS_PLUS_FAT_MIN_SECTOR_SIZE_BYTES;
+    p_instance_ctrl->next_sector        = 0U;
+    p_instance_ctrl->read_ahead_valid   = false;
+    p_instance_ctrl->read_ahead_pending = false;
+    p_instance_ctrl->open               = RM_FREERTOS_PLUS_FAT_OPEN;
 
     return FSP_SUCCESS;
 }
@@ -181,7 +242,11 @@ fsp_err_t RM_FREERTOS_PLUS_FAT_MediaInit (rm_freertos_plus_fat_ctrl_t * const
     fsp_err =
         p_instance_ctrl->p_cfg->p_block_media->p_api->infoGet(p_instance_ctrl->p_cfg->p_block_media->p_ctrl, &info);
     FSP_ERROR_RETURN(FSP_SUCCESS == fsp_err, fsp_err);
-    p_instance_ctrl->reentrant = info.reentrant;
+    p_instance_ctrl->reentrant   = info.reentrant;
+    p_instance_ctrl->sector_size = info.sector_size_bytes;
+
+    /* The media may have changed, so discard read-ahead data. */
+    p_instance_ctrl->read_ahead_valid = false;
 
     if (NULL != p_device)
     {
@@ -341,6 +406,9 @@ fsp_err_t RM_FREERTOS_PLUS_FAT_Close (rm_freertos_plus_fat_ctrl_t * const p_ctrl
     FSP_ERROR_RETURN(RM_FREERTOS_PLUS_FAT_OPEN == p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
 #endif
 
+    /* Let a read-ahead request in flight complete before the media is closed. */
+    (void) rm_freertos_plus_fat_read_ahead_finish(p_instance_ctrl);
+
     p_instance_ctrl->open = 0;
     p_instance_ctrl->p_cfg->p_block_media->p_api->close(p_instance_ctrl->p_cfg->p_block_media->p_ctrl);
 #if 2 == BSP_CFG_RTOS
@@ -369,6 +437,357 @@ fsp_err_t RM_FREERTOS_PLUS_FAT_VersionGet (fsp_version_t * const p_version)
     return FSP_SUCCESS;
 }
 
+/*******************************************************************************************************************//**
+ * Creates a log file whose clusters are allocated as one contiguous run, then opens it with
+ * RM_FREERTOS_PLUS_FAT_LogOpen. An existing file at p_path is truncated. The file is written once with zeros so its
+ * clusters are allocated and its directory entry records the full size. Later log data is written directly to the
+ * clusters without updating the FAT or the directory entry.
+ *
+ * The volume must have enough unfragmented free space, otherwise the allocated clusters may not be contiguous and
+ * FSP_ERR_UNSUPPORTED is returned.
+ *
+ * @param[in]  p_ctrl                  Pointer to control structure.
+ * @param[in]  p_log                   Log with p_disk, p_buffer and buffer_size_bytes set.
+ * @param[in]  p_path                  Path of the log file.
+ * @param[in]  size_bytes              Bytes of log data to reserve.
+ *
+ * @retval     FSP_SUCCESS             Log file created and opened.
+ * @retval     FSP_ERR_ASSERTION       An input parameter is invalid.
+ * @retval     FSP_ERR_NOT_OPEN        Module has not been initialized.
+ * @retval     FSP_ERR_WRITE_FAILED    The file could not be created or filled.
+ * @return See @ref RENESAS_ERROR_CODES or functions called by this function for other possible return codes.
+ *         This function calls:
+ *             * @ref RM_FREERTOS_PLUS_FAT_LogOpen
+ **********************************************************************************************************************/
+fsp_err_t RM_FREERTOS_PLUS_FAT_LogCreate (rm_freertos_plus_fat_ctrl_t * const p_ctrl,
+                                          rm_freertos_plus_fat_log_t * const  p_log,
+                                          char const * const                  p_path,
+                                          uint32_t const                      size_bytes)
+{
+    rm_freertos_plus_fat_instance_ctrl_t * p_instance_ctrl = (rm_freertos_plus_fat_instance_ctrl_t *) p_ctrl;
+
+#if RM_FREERTOS_PLUS_FAT_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_instance_ctrl);
+    FSP_ASSERT(NULL != p_log);
+    FSP_ASSERT(NULL != p_log->p_disk);
+    FSP_ASSERT(NULL != p_log->p_buffer);
+    FSP_ASSERT(NULL != p_path);
+    FSP_ASSERT(0U != size_bytes);
+    FSP_ERROR_RETURN(RM_FREERTOS_PLUS_FAT_OPEN == p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
+    FSP_ASSERT(0U == p_log->buffer_size_bytes % p_instance_ctrl->sector_size);
+    FSP_ASSERT(p_log->buffer_size_bytes >= 2U * p_instance_ctrl->sector_size);
+#endif
+
+    uint32_t sector_size = p_instance_ctrl->sector_size;
+
+    /* Round the reservation up to whole sectors and add the checkpoint headers. */
+    uint32_t remaining = ((size_bytes + sector_size - 1U) / sector_size + RM_FREERTOS_PLUS_FAT_PRV_LOG_HEADER_SECTORS) *
+                         sector_size;
+
+    FF_Error_t xFFError = FF_ERR_NONE;
+    FF_FILE  * p_file   = FF_Open(p_log->p_disk->pxIOManager,
+                                  p_path,
+                                  (uint8_t) (FF_MODE_WRITE | FF_MODE_CREATE | FF_MODE_TRUNCATE),
+                                  &xFFError);
+    FSP_ERROR_RETURN(NULL != p_file, FSP_ERR_WRITE_FAILED);
+
+    /* Zero filled headers carry no valid checkpoint, so the new log starts empty. Whole sector writes are passed
+     * straight to the media by FreeRTOS+FAT. */
+    memset(p_log->p_buffer, 0, p_log->buffer_size_bytes);
+    while (remaining > 0U)
+    {
+        uint32_t chunk = (remaining < p_log->buffer_size_bytes) ? remaining : p_log->buffer_size_bytes;
+        if ((int32_t) chunk != FF_Write(p_file, 1U, chunk, p_log->p_buffer))
+        {
+            break;
+        }
+
+        remaining -= chunk;
+    }
+
+    xFFError = FF_Close(p_file);
+    FSP_ERROR_RETURN((0U == remaining) && !FF_isERR(xFFError), FSP_ERR_WRITE_FAILED);
+
+    xFFError = FF_FlushCache(p_log->p_disk->pxIOManager);
+    FSP_ERROR_RETURN(!FF_isERR(xFFError), FSP_ERR_WRITE_FAILED);
+
+    return RM_FREERTOS_PLUS_FAT_LogOpen(p_ctrl, p_log, p_path);
+}
+
+/*******************************************************************************************************************//**
+ * Opens a log file created by RM_FREERTOS_PLUS_FAT_LogCreate and recovers its length from the newest valid
+ * checkpoint header. Data appended after the last checkpoint before a reset or power loss is discarded.
+ *
+ * The log file must not be opened through FreeRTOS+FAT while the log is open. Log data bypasses the FreeRTOS+FAT
+ * sector cache.
+ *
+ * @param[in]  p_ctrl                  Pointer to control structure.
+ * @param[in]  p_log                   Log with p_disk, p_buffer and buffer_size_bytes set.
+ * @param[in]  p_path                  Path of the log file.
+ *
+ * @retval     FSP_SUCCESS             Log file opened.
+ * @retval     FSP_ERR_ASSERTION       An input parameter is invalid.
+ * @retval     FSP_ERR_NOT_OPEN        Module has not been initialized.
+ * @retval     FSP_ERR_NOT_FOUND       The file could not be opened.
+ * @retval     FSP_ERR_UNSUPPORTED     The file clusters are not contiguous, the file is too small, or the FAT
+ *                                     sector size differs from the media sector size.
+ * @return See @ref RENESAS_ERROR_CODES or functions called by this function for other possible return codes.
+ *         This function calls:
+ *             * @ref rm_block_media_api_t::read
+ **********************************************************************************************************************/
+fsp_err_t RM_FREERTOS_PLUS_FAT_LogOpen (rm_freertos_plus_fat_ctrl_t * const p_ctrl,
+                                        rm_freertos_plus_fat_log_t * const  p_log,
+                                        char const * const                  p_path)
+{
+    rm_freertos_plus_fat_instance_ctrl_t * p_instance_ctrl = (rm_freertos_plus_fat_instance_ctrl_t *) p_ctrl;
+
+#if RM_FREERTOS_PLUS_FAT_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_instance_ctrl);
+    FSP_ASSERT(NULL != p_log);
+    FSP_ASSERT(NULL != p_log->p_disk);
+    FSP_ASSERT(NULL != p_log->p_buffer);
+    FSP_ASSERT(NULL != p_path);
+    FSP_ERROR_RETURN(RM_FREERTOS_PLUS_FAT_OPEN == p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
+    FSP_ASSERT(0U == p_log->buffer_size_bytes % p_instance_ctrl->sector_size);
+    FSP_ASSERT(p_log->buffer_size_bytes >= 2U * p_instance_ctrl->sector_size);
+#endif
+
+    FF_IOManager_t * p_iomanager = p_log->p_disk->pxIOManager;
+    uint32_t         sector_size = p_instance_ctrl->sector_size;
+
+    /* Cluster LBAs are only media sectors when the partition uses the media sector size. */
+    FSP_ERROR_RETURN((sector_size == p_iomanager->usSectorSize) &&
+                     (sector_size == p_iomanager->xPartition.usBlkSize),
+                     FSP_ERR_UNSUPPORTED);
+
+    FF_Error_t xFFError = FF_ERR_NONE;
+    FF_FILE  * p_file   = FF_Open(p_iomanager, p_path, FF_MODE_READ, &xFFError);
+    FSP_ERROR_RETURN(NULL != p_file, FSP_ERR_NOT_FOUND);
+
+    uint32_t cluster       = p_file->ulObjectCluster;
+    uint32_t file_sectors  = p_file->ulFileSize / sector_size;
+    uint32_t cluster_bytes = p_iomanager->xPartition.ulSectorsPerCluster * sector_size;
+    uint32_t clusters      = (p_file->ulFileSize + cluster_bytes - 1U) / cluster_bytes;
+    (void) FF_Close(p_file);
+
+    FSP_ERROR_RETURN(file_sectors > RM_FREERTOS_PLUS_FAT_PRV_LOG_HEADER_SECTORS, FSP_ERR_UNSUPPORTED);
+
+    /* Direct sector writes are only possible when the whole cluster chain is one contiguous run. */
+    xFFError = FF_ERR_NONE;
+    FF_LockFAT(p_iomanager);
+    uint32_t sequential = FF_GetSequentialClusters(p_iomanager, cluster, clusters - 1U, &xFFError);
+    FF_UnlockFAT(p_iomanager);
+    FSP_ERROR_RETURN(!FF_isERR(xFFError) && (clusters - 1U == sequential), FSP_ERR_UNSUPPORTED);
+
+    p_log->header_sector = FF_Cluster2LBA(p_iomanager, cluster);
+    p_log->data_sectors  = file_sectors - RM_FREERTOS_PLUS_FAT_PRV_LOG_HEADER_SECTORS;
+    p_log->length        = 0U;
+    p_log->sequence      = 0U;
+
+    uint8_t * p_scratch  = p_log->p_buffer + p_log->buffer_size_bytes - sector_size;
+    uint32_t  max_length = p_log->data_sectors * sector_size;
+    bool      found      = false;
+    fsp_err_t err        = FSP_SUCCESS;
+
+    /* Recover from the newest valid header. A header torn by power loss fails its check and the other header is
+     * used instead. */
+    FF_PendSemaphore(p_iomanager->pvSemaphore);
+
+    /* Only one request can be in flight on the block media. */
+    (void) rm_freertos_plus_fat_read_ahead_finish(p_instance_ctrl);
+    for (uint32_t i = 0U; (i < RM_FREERTOS_PLUS_FAT_PRV_LOG_HEADER_SECTORS) && (FSP_SUCCESS == err); i++)
+    {
+        uint32_t sequence = 0U;
+        uint32_t length   = 0U;
+
+        err = rm_freertos_plus_fat_sync_read(p_instance_ctrl, p_scratch, p_log->header_sector + i, 1U);
+        if ((FSP_SUCCESS == err) && rm_freertos_plus_fat_log_header_parse(p_scratch, &sequence, &length) &&
+            (length <= max_length) && (!found || ((int32_t) (sequence - p_log->sequence) > 0)))
+        {
+            found           = true;
+            p_log->sequence = sequence;
+            p_log->length   = length;
+        }
+    }
+
+    p_log->buffer_sector = p_log->length / sector_size;
+    p_log->buffer_used   = p_log->length % sector_size;
+
+    /* Reload the partial last sector so appended data follows it. */
+    if ((FSP_SUCCESS == err) && (0U != p_log->buffer_used))
+    {
+        err = rm_freertos_plus_fat_sync_read(p_instance_ctrl,
+                                             p_log->p_buffer,
+                                             p_log->header_sector + RM_FREERTOS_PLUS_FAT_PRV_LOG_HEADER_SECTORS +
+                                             p_log->buffer_sector,
+                                             1U);
+    }
+
+    FF_ReleaseSemaphore(p_iomanager->pvSemaphore);
+
+    return err;
+}
+
+/*******************************************************************************************************************//**
+ * Appends data to a log. Data is collected in the log buffer and streamed to the media in multi-block writes of
+ * buffer_size_bytes minus one sector. Appended data is only recovered after a reset once
+ * RM_FREERTOS_PLUS_FAT_LogCheckpoint or RM_FREERTOS_PLUS_FAT_LogClose has been called.
+ *
+ * @param[in]  p_ctrl                  Pointer to control structure.
+ * @param[in]  p_log                   Log opened with RM_FREERTOS_PLUS_FAT_LogOpen.
+ * @param[in]  p_data                  Data to append.
+ * @param[in]  bytes                   Number of bytes to append.
+ *
+ * @retval     FSP_SUCCESS                 Data appended.
+ * @retval     FSP_ERR_ASSERTION           An input parameter is invalid.
+ * @retval     FSP_ERR_NOT_OPEN            Module has not been initialized.
+ * @retval     FSP_ERR_INSUFFICIENT_SPACE  The data does not fit in the space reserved for the log.
+ * @return See @ref RENESAS_ERROR_CODES or functions called by this function for other possible return codes. If
+ *         the media write fails, the data appended so far stays in the buffer and the write is retried by the next
+ *         call to RM_FREERTOS_PLUS_FAT_LogWrite or RM_FREERTOS_PLUS_FAT_LogCheckpoint.
+ *         This function calls:
+ *             * @ref rm_block_media_api_t::write
+ **********************************************************************************************************************/
+fsp_err_t RM_FREERTOS_PLUS_FAT_LogWrite (rm_freertos_plus_fat_ctrl_t * const p_ctrl,
+                                         rm_freertos_plus_fat_log_t * const  p_log,
+                                         uint8_t const * const               p_data,
+                                         uint32_t const                      bytes)
+{
+    rm_freertos_plus_fat_instance_ctrl_t * p_instance_ctrl = (rm_freertos_plus_fat_instance_ctrl_t *) p_ctrl;
+
+#if RM_FREERTOS_PLUS_FAT_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_instance_ctrl);
+    FSP_ASSERT(NULL != p_log);
+    FSP_ASSERT(NULL != p_data);
+    FSP_ERROR_RETURN(RM_FREERTOS_PLUS_FAT_OPEN == p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+
+    uint32_t sector_size = p_instance_ctrl->sector_size;
+    uint32_t capacity    = p_log->buffer_size_bytes - sector_size;
+
+    FSP_ERROR_RETURN(bytes <= p_log->data_sectors * sector_size - p_log->length, FSP_ERR_INSUFFICIENT_SPACE);
+
+    uint8_t const * p_src     = p_data;
+    uint32_t        remaining = bytes;
+    do
+    {
+        /* Stream each full buffer to the media as a single multi-block write. */
+        if (capacity == p_log->buffer_used)
+        {
+            fsp_err_t err = rm_freertos_plus_fat_log_sectors_write(p_instance_ctrl,
+                                                                   p_log,
+                                                                   p_log->p_buffer,
+                                                                   p_log->buffer_sector,
+                                                                   capacity / sector_size);
+            FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+            p_log->buffer_sector += capacity / sector_size;
+            p_log->buffer_used    = 0U;
+        }
+
+        uint32_t copy = capacity - p_log->buffer_used;
+        copy = (remaining < copy) ? remaining : copy;
+        memcpy(p_log->p_buffer + p_log->buffer_used, p_src, copy);
+        p_log->buffer_used += copy;
+        p_log->length      += copy;
+        p_src              += copy;
+        remaining          -= copy;
+    } while (remaining > 0U);
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Writes buffered log data to the media, then records the log length in the older of the two checkpoint headers.
+ * All data appended before the checkpoint is recovered by RM_FREERTOS_PLUS_FAT_LogOpen after a reset or power loss.
+ * The FAT and the directory entry are not modified.
+ *
+ * @param[in]  p_ctrl                  Pointer to control structure.
+ * @param[in]  p_log                   Log opened with RM_FREERTOS_PLUS_FAT_LogOpen.
+ *
+ * @retval     FSP_SUCCESS             Checkpoint written.
+ * @retval     FSP_ERR_ASSERTION       An input parameter is invalid.
+ * @retval     FSP_ERR_NOT_OPEN        Module has not been initialized.
+ * @return See @ref RENESAS_ERROR_CODES or functions called by this function for other possible return codes.
+ *         This function calls:
+ *             * @ref rm_block_media_api_t::write
+ **********************************************************************************************************************/
+fsp_err_t RM_FREERTOS_PLUS_FAT_LogCheckpoint (rm_freertos_plus_fat_ctrl_t * const p_ctrl,
+                                              rm_freertos_plus_fat_log_t * const  p_log)
+{
+    rm_freertos_plus_fat_instance_ctrl_t * p_instance_ctrl = (rm_freertos_plus_fat_instance_ctrl_t *) p_ctrl;
+
+#if RM_FREERTOS_PLUS_FAT_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_instance_ctrl);
+    FSP_ASSERT(NULL != p_log);
+    FSP_ERROR_RETURN(RM_FREERTOS_PLUS_FAT_OPEN == p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+
+    uint32_t  sector_size = p_instance_ctrl->sector_size;
+    uint32_t  full        = p_log->buffer_used / sector_size;
+    uint32_t  tail        = p_log->buffer_used % sector_size;
+    fsp_err_t err         = FSP_SUCCESS;
+
+    /* Write the buffered sectors including the partial last sector. The partial sector is written again by later
+     * checkpoints until it is filled. */
+    if (0U != p_log->buffer_used)
+    {
+        err = rm_freertos_plus_fat_log_sectors_write(p_instance_ctrl,
+                                                     p_log,
+                                                     p_log->p_buffer,
+                                                     p_log->buffer_sector,
+                                                     full + ((0U != tail) ? 1U : 0U));
+        FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+        /* Keep only the partial sector so later writes stay sector aligned. */
+        memmove(p_log->p_buffer, p_log->p_buffer + (full * sector_size), tail);
+        p_log->buffer_sector += full;
+        p_log->buffer_used    = tail;
+    }
+
+    /* Overwrite the older header so a torn header write leaves the previous checkpoint intact. */
+    uint8_t * p_scratch = p_log->p_buffer + p_log->buffer_size_bytes - sector_size;
+    memset(p_scratch, 0, sector_size);
+
+    rm_freertos_plus_fat_log_header_t header;
+    header.magic    = RM_FREERTOS_PLUS_FAT_PRV_LOG_MAGIC;
+    header.sequence = p_log->sequence + 1U;
+    header.length   = p_log->length;
+    header.check    = ~(header.magic ^ header.sequence ^ header.length);
+    memcpy(p_scratch, &header, sizeof(header));
+
+    uint32_t header_sector = p_log->header_sector + (header.sequence % RM_FREERTOS_PLUS_FAT_PRV_LOG_HEADER_SECTORS);
+
+    FF_PendSemaphore(p_log->p_disk->pxIOManager->pvSemaphore);
+    err = rm_freertos_plus_fat_sync_write(p_instance_ctrl, p_scratch, header_sector, 1U);
+    FF_ReleaseSemaphore(p_log->p_disk->pxIOManager->pvSemaphore);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+    p_log->sequence = header.sequence;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Writes a final checkpoint for a log. The log must be opened with RM_FREERTOS_PLUS_FAT_LogOpen before it is
+ * written again.
+ *
+ * @param[in]  p_ctrl                  Pointer to control structure.
+ * @param[in]  p_log                   Log opened with RM_FREERTOS_PLUS_FAT_LogOpen.
+ *
+ * @retval     FSP_SUCCESS             Log closed.
+ * @retval     FSP_ERR_ASSERTION       An input parameter is invalid.
+ * @retval     FSP_ERR_NOT_OPEN        Module has not been initialized.
+ * @return See @ref RENESAS_ERROR_CODES or functions called by this function for other possible return codes.
+ *         This function calls:
+ *             * @ref RM_FREERTOS_PLUS_FAT_LogCheckpoint
+ **********************************************************************************************************************/
+fsp_err_t RM_FREERTOS_PLUS_FAT_LogClose (rm_freertos_plus_fat_ctrl_t * const p_ctrl,
+                                         rm_freertos_plus_fat_log_t * const  p_log)
+{
+    return RM_FREERTOS_PLUS_FAT_LogCheckpoint(p_ctrl, p_log);
+}
+
 /*******************************************************************************************************************//**
  * @} (end addtogroup FREERTOS_PLUS_FAT)
  **********************************************************************************************************************/
@@ -390,23 +809,13 @@ int32_t rm_freertos_plus_fat_read (uint8_t * p_data, uint32_t sector, uint32_t n
 
     rm_freertos_plus_fat_instance_ctrl_t * p_instance_ctrl = (rm_freertos_plus_fat_instance_ctrl_t *) p_disk->pvTag;
 
-#if 2 == BSP_CFG_RTOS
-
-    /* Store the handle of the calling task. */
-    p_instance_ctrl->current_task = xTaskGetCurrentTaskHandle();
-#else
-    p_instance_ctrl->event_ready = false;
-#endif
-
-    p_instance_ctrl->last_event = (rm_block_media_event_t) 0;
-
-    err = p_instance_ctrl->p_cfg->p_block_media->p_api->read(p_instance_ctrl->p_cfg->p_block_media->p_ctrl,
-                                                             p_data,
-                                                             sector,
-                                                             num_sectors);
-    if (FSP_SUCCESS == err)
+    if (NULL != p_instance_ctrl->p_cfg->p_read_ahead_buffer)
     {
-        err = rm_freertos_plus_fat_wait_event(p_instance_ctrl, RM_FREERTOS_PLUS_FAT_READ_TIMEOUT_TICKS);
+        err = rm_freertos_plus_fat_overlapped_read(p_instance_ctrl, p_data, sector, num_sectors, p_disk);
+    }
+    else
+    {
+        err = rm_freertos_plus_fat_sync_read(p_instance_ctrl, p_data, sector, num_sectors);
     }
 
     if (FSP_SUCCESS != err)
@@ -436,25 +845,7 @@ int32_t rm_freertos_plus_fat_write (uint8_t * p_data, uint32_t sector, uint32_t
 
     rm_freertos_plus_fat_instance_ctrl_t * p_instance_ctrl = (rm_freertos_plus_fat_instance_ctrl_t *) p_disk->pvTag;
 
-#if 2 == BSP_CFG_RTOS
-
-    /* Store the handle of the calling task. */
-    p_instance_ctrl->current_task = xTaskGetCurrentTaskHandle();
-#else
-    p_instance_ctrl->event_ready = false;
-#endif
-
-    p_instance_ctrl->last_event = (rm_block_media_event_t) 0;
-
-    err = p_instance_ctrl->p_cfg->p_block_media->p_api->write(p_instance_ctrl->p_cfg->p_block_media->p_ctrl,
-                                                              p_data,
-                                                              sector,
-                                                              num_sectors);
-    if (FSP_SUCCESS == err)
-    {
-        err = rm_freertos_plus_fat_wait_event(p_instance_ctrl, RM_FREERTOS_PLUS_FAT_WRITE_TIMEOUT_TICKS);
-    }
-
+    err = rm_freertos_plus_fat_sync_write(p_instance_ctrl, p_data, sector, num_sectors);
     if (FSP_SUCCESS != err)
     {
         return FF_ERR_IOMAN_DRIVER_FATAL_ERROR;
@@ -547,6 +938,19 @@ static fsp_err_t rm_freertos_plus_fat_wait_event (rm_freertos_plus_fat_instance_
     FSP_PARAMETER_NOT_USED(timeout);
 #endif
 
+    return rm_freertos_plus_fat_event_check(p_instance_ctrl);
+}
+
+/*******************************************************************************************************************//**
+ * Checks the events reported by a completed block media request.
+ *
+ * @param[in] p_instance_ctrl          Pointer to instance control structure.
+ *
+ * @retval     FSP_SUCCESS             Request completed successfully and the device is no longer busy.
+ * @retval     FSP_ERR_INTERNAL        Error reported by lower layer driver callback.
+ **********************************************************************************************************************/
+static fsp_err_t rm_freertos_plus_fat_event_check (rm_freertos_plus_fat_instance_ctrl_t * p_instance_ctrl)
+{
     FSP_ERROR_RETURN(0U == (RM_BLOCK_MEDIA_EVENT_ERROR & p_instance_ctrl->last_event), FSP_ERR_INTERNAL);
 
     if (RM_BLOCK_MEDIA_EVENT_POLL_STATUS & p_instance_ctrl->last_event)
@@ -557,6 +961,295 @@ static fsp_err_t rm_freertos_plus_fat_wait_event (rm_freertos_plus_fat_instance_
     return FSP_SUCCESS;
 }
 
+/*******************************************************************************************************************//**
+ * Reads sectors from the block media device and waits for the read to complete.
+ *
+ * @param[in] p_instance_ctrl          Pointer to instance control structure.
+ * @param[in] p_data                   Buffer to store read data.
+ * @param[in] sector                   Sector to read from.
+ * @param[in] num_sectors              Number of sectors to read.
+ *
+ * @retval     FSP_SUCCESS             Read is complete.
+ * @return See @ref RENESAS_ERROR_CODES or functions called by this function for other possible return codes.
+ *         This function calls:
+ *             * @ref rm_block_media_api_t::read
+ **********************************************************************************************************************/
+static fsp_err_t rm_freertos_plus_fat_sync_read (rm_freertos_plus_fat_instance_ctrl_t * p_instance_ctrl,
+                                                 uint8_t                              * p_data,
+                                                 uint32_t                               sector,
+                                                 uint32_t                               num_sectors)
+{
+#if 2 == BSP_CFG_RTOS
+
+    /* Store the handle of the calling task. */
+    p_instance_ctrl->current_task = xTaskGetCurrentTaskHandle();
+#else
+    p_instance_ctrl->event_ready = false;
+#endif
+
+    p_instance_ctrl->last_event = (rm_block_media_event_t) 0;
+
+    rm_block_media_instance_t const * p_block_media = p_instance_ctrl->p_cfg->p_block_media;
+
+    fsp_err_t err = RM_FREERTOS_PLUS_FAT_PRV_BLOCK_MEDIA_API(p_block_media, read, Read) (p_block_media->p_ctrl,
+                                                                                         p_data,
+                                                                                         sector,
+                                                                                         num_sectors);
+    if (FSP_SUCCESS == err)
+    {
+        err = rm_freertos_plus_fat_wait_event(p_instance_ctrl, RM_FREERTOS_PLUS_FAT_READ_TIMEOUT_TICKS);
+    }
+
+    return err;
+}
+
+/*******************************************************************************************************************//**
+ * Writes sectors to the block media device and waits for the write to complete.
+ *
+ * @param[in] p_instance_ctrl          Pointer to instance control structure.
+ * @param[in] p_data                   Data to write.
+ * @param[in] sector                   Sector to write to.
+ * @param[in] num_sectors              Number of sectors to write.
+ *
+ * @retval     FSP_SUCCESS             Write is complete.
+ * @return See @ref RENESAS_ERROR_CODES or functions called by this function for other possible return codes.
+ *         This function calls:
+ *             * @ref rm_block_media_api_t::write
+ **********************************************************************************************************************/
+static fsp_err_t rm_freertos_plus_fat_sync_write (rm_freertos_plus_fat_instance_ctrl_t * p_instance_ctrl,
+                                                  uint8_t const                        * p_data,
+                                                  uint32_t                               sector,
+                                                  uint32_t                               num_sectors)
+{
+    /* Only one request can be in flight, and the written sectors may be in the read-ahead buffer. A failed
+     * read-ahead only discards the speculative data. */
+    (void) rm_freertos_plus_fat_read_ahead_finish(p_instance_ctrl);
+    p_instance_ctrl->read_ahead_valid = false;
+
+#if 2 == BSP_CFG_RTOS
+
+    /* Store the handle of the calling task. */
+    p_instance_ctrl->current_task = xTaskGetCurrentTaskHandle();
+#else
+    p_instance_ctrl->event_ready = false;
+#endif
+
+    p_instance_ctrl->last_event = (rm_block_media_event_t) 0;
+
+    rm_block_media_instance_t const * p_block_media = p_instance_ctrl->p_cfg->p_block_media;
+
+    fsp_err_t err = RM_FREERTOS_PLUS_FAT_PRV_BLOCK_MEDIA_API(p_block_media, write, Write) (p_block_media->p_ctrl,
+                                                                                           p_data,
+                                                                                           sector,
+                                                                                           num_sectors);
+    if (FSP_SUCCESS == err)
+    {
+        err = rm_freertos_plus_fat_wait_event(p_instance_ctrl, RM_FREERTOS_PLUS_FAT_WRITE_TIMEOUT_TICKS);
+    }
+
+    return err;
+}
+
+/*******************************************************************************************************************//**
+ * Reads sectors with the read-ahead buffer.
+ *
+ * Sectors already in (or being read into) the read-ahead buffer are copied from it. The rest is read directly into
+ * the caller's buffer if it is word aligned, otherwise it is staged through the read-ahead buffer. If the access is
+ * sequential, the sectors following the request are then read ahead, so the media works on the next request while
+ * FreeRTOS+FAT consumes this one.
+ *
+ * @param[in] p_instance_ctrl          Pointer to instance control structure.
+ * @param[in] p_data                   Buffer to store read data.
+ * @param[in] sector                   Sector to read from.
+ * @param[in] num_sectors              Number of sectors to read.
+ * @param[in] p_disk                   Pointer to FreeRTOS+FAT disk structure.
+ *
+ * @retval     FSP_SUCCESS             Read is complete.
+ * @return See @ref RENESAS_ERROR_CODES or functions called by this function for other possible return codes.
+ *         This function calls:
+ *             * @ref rm_block_media_api_t::read
+ **********************************************************************************************************************/
+static fsp_err_t rm_freertos_plus_fat_overlapped_read (rm_freertos_plus_fat_instance_ctrl_t * p_instance_ctrl,
+                                                       uint8_t                              * p_data,
+                                                       uint32_t                               sector,
+                                                       uint32_t                               num_sectors,
+                                                       FF_Disk_t                            * p_disk)
+{
+    uint8_t * p_buffer    = p_instance_ctrl->p_cfg->p_read_ahead_buffer;
+    uint32_t  sector_size = p_instance_ctrl->sector_size;
+    uint32_t  max_sectors = p_instance_ctrl->p_cfg->read_ahead_size_bytes / sector_size;
+    bool      sequential  = (sector == p_instance_ctrl->next_sector);
+
+    /* Wait for the request in flight. The media serves one request at a time. A failed read-ahead only discards the
+     * speculative data. */
+    (void) rm_freertos_plus_fat_read_ahead_finish(p_instance_ctrl);
+
+    fsp_err_t err = FSP_SUCCESS;
+
+    /* Copy the head of the request from the read-ahead buffer if it is there. */
+    if (p_instance_ctrl->read_ahead_valid && (sector >= p_instance_ctrl->read_ahead_sector) &&
+        (sector < (p_instance_ctrl->read_ahead_sector + p_instance_ctrl->read_ahead_count)))
+    {
+        uint32_t offset = sector - p_instance_ctrl->read_ahead_sector;
+        uint32_t count  = p_instance_ctrl->read_ahead_count - offset;
+        if (count > num_sectors)
+        {
+            count = num_sectors;
+        }
+
+        memcpy(p_data, &p_buffer[offset * sector_size], count * sector_size);
+        p_data      += count * sector_size;
+        sector      += count;
+        num_sectors -= count;
+
+        /* Hits continue a sequential stream even if FreeRTOS+FAT skipped ahead within the buffer. */
+        sequential = true;
+    }
+
+    if (num_sectors > 0U)
+    {
+        if (0U == ((uint32_t) p_data & RM_FREERTOS_PLUS_FAT_PRV_ALIGN_MASK))
+        {
+            /* Direct path: aligned requests are transferred to the caller's buffer without copying. */
+            err = rm_freertos_plus_fat_sync_read(p_instance_ctrl, p_data, sector, num_sectors);
+            sector += num_sectors;
+        }
+        else
+        {
+            /* Unaligned requests are staged through the read-ahead buffer. */
+            p_instance_ctrl->read_ahead_valid = false;
+            while ((num_sectors > 0U) && (FSP_SUCCESS == err))
+            {
+                uint32_t count = (num_sectors < max_sectors) ? num_sectors : max_sectors;
+                err = rm_freertos_plus_fat_sync_read(p_instance_ctrl, p_buffer, sector, count);
+                FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+                memcpy(p_data, p_buffer, count * sector_size);
+                p_data      += count * sector_size;
+                sector      += count;
+                num_sectors -= count;
+            }
+        }
+
+        FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+    }
+
+    p_instance_ctrl->next_sector = sector;
+
+    /* Keep the next sectors of a sequential stream in flight unless they are already buffered. */
+    bool buffered = p_instance_ctrl->read_ahead_valid && (sector >= p_instance_ctrl->read_ahead_sector) &&
+                    (sector < (p_instance_ctrl->read_ahead_sector + p_instance_ctrl->read_ahead_count));
+    if (sequential && !buffered)
+    {
+        rm_freertos_plus_fat_read_ahead_start(p_instance_ctrl, sector, p_disk);
+    }
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Starts reading sectors into the read-ahead buffer without waiting for the read to complete. If the read cannot be
+ * started, the read-ahead buffer is left empty.
+ *
+ * @param[in] p_instance_ctrl          Pointer to instance control structure.
+ * @param[in] sector                   First sector to read.
+ * @param[in] p_disk                   Pointer to FreeRTOS+FAT disk structure.
+ **********************************************************************************************************************/
+static void rm_freertos_plus_fat_read_ahead_start (rm_freertos_plus_fat_instance_ctrl_t * p_instance_ctrl,
+                                                   uint32_t                               sector,
+                                                   FF_Disk_t                            * p_disk)
+{
+    uint32_t count = p_instance_ctrl->p_cfg->read_ahead_size_bytes / p_instance_ctrl->sector_size;
+
+    p_instance_ctrl->read_ahead_valid = false;
+
+    /* Do not read past the end of the media. */
+    if (sector >= p_disk->ulNumberOfSectors)
+    {
+        return;
+    }
+
+    if (count > (p_disk->ulNumberOfSectors - sector))
+    {
+        count = p_disk->ulNumberOfSectors - sector;
+    }
+
+#if 2 == BSP_CFG_RTOS
+
+    /* No task waits yet. The task that needs the data registers itself in rm_freertos_plus_fat_read_ahead_finish. */
+    p_instance_ctrl->current_task = NULL;
+#else
+    p_instance_ctrl->event_ready = false;
+#endif
+
+    p_instance_ctrl->last_event = (rm_block_media_event_t) 0;
+
+    rm_block_media_instance_t const * p_block_media = p_instance_ctrl->p_cfg->p_block_media;
+
+    fsp_err_t err = RM_FREERTOS_PLUS_FAT_PRV_BLOCK_MEDIA_API(p_block_media, read, Read) (
+        p_block_media->p_ctrl,
+        p_instance_ctrl->p_cfg->p_read_ahead_buffer,
+        sector,
+        count);
+    if (FSP_SUCCESS == err)
+    {
+        p_instance_ctrl->read_ahead_sector  = sector;
+        p_instance_ctrl->read_ahead_count   = count;
+        p_instance_ctrl->read_ahead_pending = true;
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Waits for the read-ahead request in flight, if any, to complete.
+ *
+ * @param[in] p_instance_ctrl          Pointer to instance control structure.
+ *
+ * @retval     FSP_SUCCESS             No request in flight, or the read-ahead data is now valid.
+ * @retval     FSP_ERR_TIMEOUT         Timeout occurred waiting for device.
+ * @retval     FSP_ERR_INTERNAL        Error reported by lower layer driver callback.
+ **********************************************************************************************************************/
+static fsp_err_t rm_freertos_plus_fat_read_ahead_finish (rm_freertos_plus_fat_instance_ctrl_t * p_instance_ctrl)
+{
+    if (!p_instance_ctrl->read_ahead_pending)
+    {
+        return FSP_SUCCESS;
+    }
+
+    p_instance_ctrl->read_ahead_pending = false;
+
+    fsp_err_t err;
+
+#if 2 == BSP_CFG_RTOS
+
+    /* Register this task for the completion notification unless the read has already completed. */
+    bool complete;
+    taskENTER_CRITICAL();
+    complete = (0U != p_instance_ctrl->last_event);
+    if (!complete)
+    {
+        p_instance_ctrl->current_task = xTaskGetCurrentTaskHandle();
+    }
+
+    taskEXIT_CRITICAL();
+
+    if (complete)
+    {
+        err = rm_freertos_plus_fat_event_check(p_instance_ctrl);
+    }
+    else
+    {
+        err = rm_freertos_plus_fat_wait_event(p_instance_ctrl, RM_FREERTOS_PLUS_FAT_READ_TIMEOUT_TICKS);
+    }
+
+#else
+    err = rm_freertos_plus_fat_wait_event(p_instance_ctrl, RM_FREERTOS_PLUS_FAT_READ_TIMEOUT_TICKS);
+#endif
+
+    p_instance_ctrl->read_ahead_valid = (FSP_SUCCESS == err);
+
+    return err;
+}
+
 /*******************************************************************************************************************//**
  * Waits for SD/MMC device to release the BUSY signal on DAT0.
  *
@@ -570,7 +1263,9 @@ static fsp_err_t rm_freertos_plus_fat_wait_for_device (rm_freertos_plus_fat_inst
     rm_block_media_status_t                 status;
     do
     {
-        fsp_err_t err = p_block_media->p_api->statusGet(p_block_media->p_ctrl, &status);
+        fsp_err_t err = RM_FREERTOS_PLUS_FAT_PRV_BLOCK_MEDIA_API(p_block_media, statusGet, StatusGet) (
+            p_block_media->p_ctrl,
+            &status);
         FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
         if (!status.busy)
         {
@@ -586,3 +1281,54 @@ static fsp_err_t rm_freertos_plus_fat_wait_for_device (rm_freertos_plus_fat_inst
 
     return FSP_SUCCESS;
 }
+
+/*******************************************************************************************************************//**
+ * Writes log data sectors while holding the FreeRTOS+FAT I/O manager lock.
+ *
+ * @param[in] p_instance_ctrl          Pointer to instance control structure.
+ * @param[in] p_log                    Pointer to the log.
+ * @param[in] p_data                   Data to write.
+ * @param[in] sector                   Log data sector to write to.
+ * @param[in] num_sectors              Number of sectors to write.
+ *
+ * @retval     FSP_SUCCESS             Write is complete.
+ * @return See @ref RENESAS_ERROR_CODES or functions called by this function for other possible return codes.
+ *         This function calls:
+ *             * @ref rm_block_media_api_t::write
+ **********************************************************************************************************************/
+static fsp_err_t rm_freertos_plus_fat_log_sectors_write (rm_freertos_plus_fat_instance_ctrl_t * p_instance_ctrl,
+                                                         rm_freertos_plus_fat_log_t           * p_log,
+                                                         uint8_t const                        * p_data,
+                                                         uint32_t                               sector,
+                                                         uint32_t                               num_sectors)
+{
+    uint32_t first_sector = p_log->header_sector + RM_FREERTOS_PLUS_FAT_PRV_LOG_HEADER_SECTORS + sector;
+
+    FF_PendSemaphore(p_log->p_disk->pxIOManager->pvSemaphore);
+    fsp_err_t err = rm_freertos_plus_fat_sync_write(p_instance_ctrl, p_data, first_sector, num_sectors);
+    FF_ReleaseSemaphore(p_log->p_disk->pxIOManager->pvSemaphore);
+
+    return err;
+}
+
+/*******************************************************************************************************************//**
+ * Validates a log checkpoint header.
+ *
+ * @param[in]  p_sector                Sector holding the header.
+ * @param[out] p_sequence              Sequence number of the header.
+ * @param[out] p_length                Log length recorded in the header.
+ *
+ * @retval     true                    The header is valid.
+ * @retval     false                   The header is blank or corrupted.
+ **********************************************************************************************************************/
+static bool rm_freertos_plus_fat_log_header_parse (uint8_t const * p_sector, uint32_t * p_sequence, uint32_t * p_length)
+{
+    rm_freertos_plus_fat_log_header_t header;
+    memcpy(&header, p_sector, sizeof(header));
+
+    *p_sequence = header.sequence;
+    *p_length   = header.length;
+
+    return (RM_FREERTOS_PLUS_FAT_PRV_LOG_MAGIC == header.magic) &&
+           (header.check == ~(header.magic ^ header.sequence ^ header.length));
+}
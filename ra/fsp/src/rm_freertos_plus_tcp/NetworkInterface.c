@@ -29,6 +29,7 @@
 
 /* Standard libraries includes. */
 #include <stdlib.h>
+#include <string.h>
 
 #if defined(__IAR_SYSTEMS_ICC__)
  #pragma diag_suppress=Pe1644
@@ -46,6 +47,8 @@
 
 /* Renesas includes. */
 #include "r_ether.h"
+#include "r_ether_phy.h"
+#include "r_external_irq_api.h"
 
 /***********************************************************************************************************************
  * Macro definitions
@@ -66,18 +69,150 @@
 
 #define ETHER_EDMAC_INTERRUPT_FACTOR_RECEPTION    (0x01070000)
 #define ETHER_LINK_STATUS_CHECK_INTERVAL          (1000)
+#define ETHER_LINK_ESTABLISH_RETRY_INTERVAL       (10)
 
 #define UNSIGNED_SHORT_RANDOM_NUMBER_MASK         (0xFFFFUL)
 
+#define ETHER_EDMAC_INTERRUPT_FACTOR_FR           (1UL << 18)
+#define ETHER_EDMAC_INTERRUPT_FACTOR_TX_COMPLETE  ((1UL << 30) | (1UL << 21))
+
+/* The EDMAC reads transmit buffers with 32-byte alignment in zero copy mode. */
+#define ETHER_TX_BUFFER_ALIGNMENT_MASK            (0x1FUL)
+
+/* Number of transmitted buffers fetched from the driver per call in zero copy mode. */
+#define ETHER_TX_RECLAIM_BATCH_SIZE               (8U)
+
+/* Offsets and values used by the driver-side IPv4/TCP/UDP/ICMP checksum calculation. */
+#define ETHER_FRAME_TYPE_OFFSET                   (12U)
+#define ETHER_FRAME_HEADER_SIZE                   (14U)
+#define ETHER_FRAME_TYPE_IPV4                     (0x0800U)
+#define ETHER_FRAME_TYPE_PTP                      (0x88F7U)
+#define IPV4_HEADER_MIN_SIZE                      (20U)
+#define IPV4_TOTAL_LENGTH_OFFSET                  (2U)
+#define IPV4_FRAGMENT_OFFSET                      (6U)
+#define IPV4_FRAGMENT_MASK                        (0x3FFFU)
+#define IPV4_PROTOCOL_OFFSET                      (9U)
+#define IPV4_CHECKSUM_OFFSET                      (10U)
+#define IPV4_SOURCE_ADDRESS_OFFSET                (12U)
+#define IPV4_ADDRESS_PAIR_SIZE                    (8U)
+#define IPV4_PROTOCOL_ICMP                        (1U)
+#define IPV4_PROTOCOL_TCP                         (6U)
+#define IPV4_PROTOCOL_UDP                         (17U)
+#define ICMP_CHECKSUM_OFFSET                      (2U)
+#define TCP_CHECKSUM_OFFSET                       (16U)
+#define TCP_HEADER_MIN_SIZE                       (20U)
+#define UDP_CHECKSUM_OFFSET                       (6U)
+#define UDP_HEADER_SIZE                           (8U)
+#define ICMP_HEADER_MIN_SIZE                      (4U)
+#define IPV4_IDENTIFICATION_OFFSET                (4U)
+#define IPV4_HEADER_MAX_SIZE                      (60U)
+#define TCP_SEQUENCE_OFFSET                       (4U)
+#define TCP_FLAGS_OFFSET                          (12U)
+#define TCP_HEADER_MAX_SIZE                       (60U)
+#define TCP_FLAG_FIN                              (0x01U)
+#define TCP_FLAG_PSH                              (0x08U)
+
+/* When set to 1 uxNetworkInterfaceOutputLargeSend() is available. It takes one TCP payload larger than the MSS together
+ * with the Ethernet, IPv4 and TCP headers of its first segment, and sends it as MSS-sized segments without passing each
+ * segment through the stack. */
+#ifndef ETHER_LARGE_SEND_ENABLE
+ #define ETHER_LARGE_SEND_ENABLE                  (0)
+#endif
+
+/* When set to a non-zero value the receive path runs in polling mode. The EDMAC frame receive (FR) interrupt is
+ * masked as soon as it fires, and the receive task drains up to this many frames per pass and hands them to the IP
+ * task as one batch. The interrupt is re-enabled once the receive descriptors are empty. */
+#ifndef ETHER_RX_POLLING_BATCH_SIZE
+ #define ETHER_RX_POLLING_BATCH_SIZE              (0U)
+#endif
+
+/* In zero copy mode the network buffer itself is transmitted and is returned to the stack by the receive task once
+ * the EDMAC is done with it. With ether_cfg_t::tx_complete_interval set, only every tx_complete_interval-th frame
+ * raises an interrupt, so the buffers come back in batches. Frames sent after the last interrupt are reclaimed at
+ * most this many milliseconds later. Zero copy mode needs 32-byte aligned network buffers, such as the ones of the
+ * static network buffer pool below. */
+#ifndef ETHER_TX_RECLAIM_TIMEOUT_MS
+ #define ETHER_TX_RECLAIM_TIMEOUT_MS              (10U)
+#endif
+
+/* When set to 1 vNetworkInterfaceAllocateRAMToBuffers hands out a static network buffer pool, as needed when
+ * FreeRTOS+TCP is built with BufferAllocation_1.c. The pool is sized from ipconfigNUM_NETWORK_BUFFER_DESCRIPTORS and
+ * placed with ETHER_BUFFER_PLACE_IN_SECTION, in the same SRAM bank as the EDMAC buffers. When ipBUFFER_PADDING is a
+ * multiple of 4, every frame starts on a 32-byte boundary so the buffers can be transmitted in zero copy mode. */
+#ifndef ETHER_NETWORK_BUFFER_POOL_ENABLE
+ #define ETHER_NETWORK_BUFFER_POOL_ENABLE         (0)
+#endif
+
+/* Offset of the Ethernet frame in a pool buffer. FreeRTOS+TCP keeps a pointer to the descriptor ipBUFFER_PADDING bytes
+ * before the frame, and only accepts it when it is 4-byte aligned. */
+#if ((ipBUFFER_PADDING % 4U) == 0U)
+ #define ETHER_NETWORK_BUFFER_PADDING             ETHER_BUFFER_SIZE(ipBUFFER_PADDING)
+#else
+ #define ETHER_NETWORK_BUFFER_PADDING             (ipBUFFER_PADDING)
+#endif
+#define ETHER_NETWORK_BUFFER_SIZE                 ETHER_BUFFER_SIZE(ETHER_NETWORK_BUFFER_PADDING + \
+                                                                    ipTOTAL_ETHERNET_FRAME_SIZE)
+
+/* When set to 1 the CPU copies between network buffers and EDMAC buffers are timed with the DWT cycle counter. Every
+ * ETHER_MEMORY_BENCHMARK_REPORT_FRAMES received frames the receive task prints, through FreeRTOS_printf, the cycles
+ * spent on the copies since the last report next to the cycles the same amount of data took to copy before the EDMAC
+ * was started. The difference is the cost of bus contention with the EDMAC and the other bus masters for the chosen
+ * memory placement. The measured cycles include the per-frame driver overhead. */
+#ifndef ETHER_MEMORY_BENCHMARK_ENABLE
+ #define ETHER_MEMORY_BENCHMARK_ENABLE            (0)
+#endif
+
+#ifndef ETHER_MEMORY_BENCHMARK_REPORT_FRAMES
+ #define ETHER_MEMORY_BENCHMARK_REPORT_FRAMES     (1000U)
+#endif
+
+#if (ETHER_MEMORY_BENCHMARK_ENABLE) && !(BSP_FEATURE_DWT_CYCCNT)
+ #error "ETHER_MEMORY_BENCHMARK_ENABLE needs the DWT cycle counter."
+#endif
+
+/***********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+#if (ETHER_MEMORY_BENCHMARK_ENABLE)
+
+/* Copy statistics of one direction. Each counter is only written by the task that owns the direction. */
+typedef struct xETHER_MEMORY_BENCHMARK
+{
+    uint32_t ulFrames;
+    uint32_t ulBytes;
+    uint32_t ulCycles;
+} EtherMemoryBenchmark_t;
+#endif
+
 /***********************************************************************************************************************
  * Exported global variables (to be accessed by other files)
  **********************************************************************************************************************/
 extern ether_instance_t * gp_freertos_ether;
 
+/* When ETHER_PHY_CFG_LINK_INTERRUPT_ENABLE is set to 1 the link status task no longer polls the PHY-LSI every
+ * ETHER_LINK_STATUS_CHECK_INTERVAL. The PHY-LSI INT pin is connected to the external IRQ instance provided by the
+ * application here, with vEtherPhyIrqCallback as its callback, and the link status is only read over MDIO when the
+ * PHY-LSI reports a link change. */
+#if (ETHER_PHY_CFG_LINK_INTERRUPT_ENABLE)
+extern external_irq_instance_t const * gp_freertos_ether_phy_irq;
+#endif
+
 /***********************************************************************************************************************
  * Private global variables
  **********************************************************************************************************************/
-static TaskHandle_t xRxHanderTaskHandle = NULL;
+static TaskHandle_t xRxHanderTaskHandle   = NULL;
+static TaskHandle_t xLinkStatusTaskHandle = NULL;
+
+#if (ETHER_NETWORK_BUFFER_POOL_ENABLE)
+static uint8_t ucNetworkBuffers[ipconfigNUM_NETWORK_BUFFER_DESCRIPTORS][ETHER_NETWORK_BUFFER_SIZE]
+ETHER_BUFFER_PLACE_IN_SECTION;
+#endif
+
+#if (ETHER_MEMORY_BENCHMARK_ENABLE)
+static EtherMemoryBenchmark_t xRxBenchmark;
+static EtherMemoryBenchmark_t xTxBenchmark;
+static uint32_t               ulBenchmarkReferenceCycles = 0U;
+#endif
 
 /***********************************************************************************************************************
  * Exported global function
@@ -88,10 +223,72 @@ static TaskHandle_t xRxHanderTaskHandle = NULL;
  **********************************************************************************************************************/
 void vEtherISRCallback(ether_callback_args_t * p_args);
 
+#if (ETHER_PHY_CFG_LINK_INTERRUPT_ENABLE)
+void vEtherPhyIrqCallback(external_irq_callback_args_t * p_args);
+#endif
+
+/* When the ETHER instance has software transmit queues (ether_extended_cfg_t in ether_cfg_t::p_extend), this hook is
+ * called for every outgoing frame. Returning pdTRUE queues the frame with *pxPriority, e.g. chosen from
+ * pxNetworkBuffer->usPort or usBoundPort for the sockets of a control application. Returning pdFALSE lets the driver
+ * classify the frame by its VLAN priority code point. The default puts PTP frames in the high priority queue. */
+BaseType_t xApplicationEtherTxPriorityGet(NetworkBufferDescriptor_t const * pxNetworkBuffer,
+                                          ether_tx_priority_t             * pxPriority);
+
+#if (ETHER_LARGE_SEND_ENABLE)
+
+/* Segment a TCP payload of any length into frames of at most uxMSS payload bytes and queue them for transmission.
+ * pucHeaders holds the Ethernet, IPv4 and TCP headers of the first segment, as the stack would build them. For each
+ * segment the sequence number, the IP identification and total length, and the checksums are updated; PSH and FIN are
+ * only kept on the last segment. Returns the number of payload bytes queued, which is less than uxPayloadLength when
+ * the transmit descriptors or network buffers run out. The caller retransmits the rest as usual. Must not run
+ * concurrently with xNetworkInterfaceOutput(), e.g. call it from the IP task. */
+size_t uxNetworkInterfaceOutputLargeSend(uint8_t const * pucHeaders,
+                                         size_t          uxHeaderLength,
+                                         uint8_t const * pucPayload,
+                                         size_t          uxPayloadLength,
+                                         size_t          uxMSS);
+
+#endif
+
 /***********************************************************************************************************************
  * Prototype declaration of private functions
  **********************************************************************************************************************/
 static BaseType_t prvNetworkInterfaceInput(void);
+static fsp_err_t  prvEtherRead(uint8_t * pucBuffer, uint32_t * pulBytesReceived);
+static BaseType_t prvNetworkInterfaceOutputZeroCopy(NetworkBufferDescriptor_t * pxNetworkBuffer,
+                                                    BaseType_t                  xReleaseAfterSend);
+static fsp_err_t  prvEtherWriteZeroCopy(NetworkBufferDescriptor_t * pxNetworkBuffer);
+static uint32_t   prvTxBufferReclaim(void);
+
+#if (ipconfigDRIVER_INCLUDED_TX_IP_CHECKSUM != 0) || (ipconfigDRIVER_INCLUDED_RX_IP_CHECKSUM != 0) || \
+    (ETHER_LARGE_SEND_ENABLE)
+static uint64_t   prvChecksumAccumulate(uint64_t ullSum, uint8_t const * pucData, size_t uxLength);
+static uint16_t   prvChecksumFold(uint64_t ullSum);
+
+#endif
+#if (ipconfigDRIVER_INCLUDED_TX_IP_CHECKSUM != 0) || (ipconfigDRIVER_INCLUDED_RX_IP_CHECKSUM != 0)
+static BaseType_t prvProcessIPChecksums(uint8_t * pucEthernetBuffer, size_t uxLength, BaseType_t xOutgoing);
+
+#endif
+#if (ETHER_LARGE_SEND_ENABLE)
+static BaseType_t prvLargeSendSegmentOutput(uint8_t const * pucHeader,
+                                            size_t          uxHeaderLength,
+                                            uint8_t const * pucPayload,
+                                            size_t          uxPayloadLength);
+
+#endif
+
+#if (ETHER_RX_POLLING_BATCH_SIZE > 0U)
+static BaseType_t prvNetworkInterfaceInputBatch(void);
+static void       prvRxInterruptEnable(uint32_t ulEnable);
+
+#endif
+#if (ETHER_MEMORY_BENCHMARK_ENABLE)
+static void prvBenchmarkCalibrate(void);
+static void prvBenchmarkRecord(EtherMemoryBenchmark_t * pxBenchmark, uint32_t ulStartCycles, uint32_t ulBytes);
+static void prvBenchmarkReport(void);
+
+#endif
 static void       prvRXHandlerTask(void * pvParameters);
 static void       prvCheckLinkStatusTask(void * pvParameters);
 
@@ -103,14 +300,11 @@ BaseType_t xNetworkInterfaceInitialise (void)
     fsp_err_t  err;
     BaseType_t xReturn = pdFAIL;
 
-    if (ETHER_ZEROCOPY_ENABLE == gp_freertos_ether->p_cfg->zerocopy)
-    {
-        /*NOTE:Currently does not support zero copy mode*/
-        while (1)
-        {
-            ;
-        }
-    }
+#if (ETHER_MEMORY_BENCHMARK_ENABLE)
+
+    /* Measure the copy cost while the EDMAC is still stopped. */
+    prvBenchmarkCalibrate();
+#endif
 
     err = gp_freertos_ether->p_api->open(gp_freertos_ether->p_ctrl, gp_freertos_ether->p_cfg);
 
@@ -138,9 +332,32 @@ BaseType_t xNetworkInterfaceInitialise (void)
                               configMINIMAL_STACK_SIZE,
                               NULL,
                               configMAX_PRIORITIES,
-                              NULL);
+                              &xLinkStatusTaskHandle);
     }
 
+#if (ETHER_PHY_CFG_LINK_INTERRUPT_ENABLE)
+    if (pdFALSE != xReturn)
+    {
+        err = gp_freertos_ether_phy_irq->p_api->open(gp_freertos_ether_phy_irq->p_ctrl,
+                                                     gp_freertos_ether_phy_irq->p_cfg);
+
+        if ((FSP_SUCCESS == err) || (FSP_ERR_ALREADY_OPEN == err))
+        {
+            err = gp_freertos_ether_phy_irq->p_api->enable(gp_freertos_ether_phy_irq->p_ctrl);
+        }
+
+        if (FSP_SUCCESS != err)
+        {
+            xReturn = pdFAIL;
+        }
+        else
+        {
+            /* A link change between the link process above and enabling the IRQ produced no edge. Check once. */
+            xTaskNotifyGive(xLinkStatusTaskHandle);
+        }
+    }
+#endif
+
     return xReturn;
 }
 
@@ -148,20 +365,45 @@ BaseType_t xNetworkInterfaceOutput (NetworkBufferDescriptor_t * const pxNetworkB
 {
     fsp_err_t  err;
     BaseType_t xReturn = pdPASS;
+#if (ETHER_MEMORY_BENCHMARK_ENABLE)
+    uint32_t ulStartCycles;
+#endif
 
     /* Simple network interfaces (as opposed to more efficient zero copy network
      * interfaces) just use Ethernet peripheral driver library functions to copy
      * data from the FreeRTOS+TCP buffer into the peripheral driver's own buffer.*/
 
+#if (ipconfigDRIVER_INCLUDED_TX_IP_CHECKSUM != 0)
+
+    /* The stack leaves the IP and protocol checksums to the driver. Fill them in before any padding is added. */
+    (void) prvProcessIPChecksums(pxNetworkBuffer->pucEthernetBuffer, pxNetworkBuffer->xDataLength, pdTRUE);
+#endif
+
     if (MINIMUM_ETHERNET_FRAME_SIZE > pxNetworkBuffer->xDataLength)
     {
         pxNetworkBuffer->xDataLength = MINIMUM_ETHERNET_FRAME_SIZE;
     }
 
+    if (ETHER_ZEROCOPY_ENABLE == gp_freertos_ether->p_cfg->zerocopy)
+    {
+        return prvNetworkInterfaceOutputZeroCopy(pxNetworkBuffer, xReleaseAfterSend);
+    }
+
+#if (ETHER_MEMORY_BENCHMARK_ENABLE)
+    ulStartCycles = DWT->CYCCNT;
+#endif
+
     err = gp_freertos_ether->p_api->write(gp_freertos_ether->p_ctrl,
                                           pxNetworkBuffer->pucEthernetBuffer,
                                           pxNetworkBuffer->xDataLength);
 
+#if (ETHER_MEMORY_BENCHMARK_ENABLE)
+    if (FSP_SUCCESS == err)
+    {
+        prvBenchmarkRecord(&xTxBenchmark, ulStartCycles, (uint32_t) pxNetworkBuffer->xDataLength);
+    }
+#endif
+
     if (FSP_SUCCESS == err)
     {
         xReturn = pdPASS;
@@ -186,18 +428,157 @@ BaseType_t xNetworkInterfaceOutput (NetworkBufferDescriptor_t * const pxNetworkB
     return xReturn;
 }
 
+#if (ETHER_LARGE_SEND_ENABLE)
+
+size_t uxNetworkInterfaceOutputLargeSend (uint8_t const * pucHeaders,
+                                          size_t          uxHeaderLength,
+                                          uint8_t const * pucPayload,
+                                          size_t          uxPayloadLength,
+                                          size_t          uxMSS)
+{
+    uint32_t  ulHeader[(ETHER_FRAME_HEADER_SIZE + IPV4_HEADER_MAX_SIZE + TCP_HEADER_MAX_SIZE + 3U) / 4U];
+    uint8_t * pucHeader   = (uint8_t *) ulHeader;
+    uint8_t * pucIPHeader = &pucHeader[ETHER_FRAME_HEADER_SIZE];
+    uint8_t * pucTCPHeader;
+    size_t    uxIPHeaderLength;
+    size_t    uxTCPHeaderLength;
+    size_t    uxSegmentLength;
+    size_t    uxOffset = 0U;
+    uint64_t  ullIPSum;
+    uint64_t  ullTCPSum;
+    uint64_t  ullSum;
+    uint32_t  ulSequence;
+    uint32_t  ulValue;
+    uint16_t  usIdentification;
+    uint16_t  usValue;
+    uint16_t  usChecksum;
+    uint8_t   ucFlags;
+
+    if ((uxHeaderLength < (ETHER_FRAME_HEADER_SIZE + IPV4_HEADER_MIN_SIZE + TCP_HEADER_MIN_SIZE)) ||
+        (uxHeaderLength > sizeof(ulHeader)) || (0U == uxMSS) || ((uxHeaderLength + uxMSS) > ipTOTAL_ETHERNET_FRAME_SIZE))
+    {
+        return 0U;
+    }
+
+    memcpy(pucHeader, pucHeaders, uxHeaderLength);
+
+    /* Only IPv4 TCP templates are segmented, and the template must end where the TCP header ends. */
+    memcpy(&usValue, &pucHeader[ETHER_FRAME_TYPE_OFFSET], sizeof(usValue));
+    uxIPHeaderLength = (size_t) (pucIPHeader[0] & 0x0FU) * 4U;
+    if ((FreeRTOS_ntohs(usValue) != ETHER_FRAME_TYPE_IPV4) || (IPV4_PROTOCOL_TCP != pucIPHeader[IPV4_PROTOCOL_OFFSET]) ||
+        (uxIPHeaderLength < IPV4_HEADER_MIN_SIZE) ||
+        ((ETHER_FRAME_HEADER_SIZE + uxIPHeaderLength + TCP_HEADER_MIN_SIZE) > uxHeaderLength))
+    {
+        return 0U;
+    }
+
+    pucTCPHeader      = &pucIPHeader[uxIPHeaderLength];
+    uxTCPHeaderLength = (size_t) (pucTCPHeader[TCP_FLAGS_OFFSET] >> 4) * 4U;
+    if ((ETHER_FRAME_HEADER_SIZE + uxIPHeaderLength + uxTCPHeaderLength) != uxHeaderLength)
+    {
+        return 0U;
+    }
+
+    memcpy(&ulSequence, &pucTCPHeader[TCP_SEQUENCE_OFFSET], sizeof(ulSequence));
+    ulSequence = FreeRTOS_ntohl(ulSequence);
+    memcpy(&usIdentification, &pucIPHeader[IPV4_IDENTIFICATION_OFFSET], sizeof(usIdentification));
+    usIdentification = FreeRTOS_ntohs(usIdentification);
+    ucFlags          = pucTCPHeader[TCP_FLAGS_OFFSET + 1U];
+
+    /* Sum the header fields that are the same in every segment once. The fields that change are zero while they are
+     * summed, and only they are added for each segment. The data offset shares a 16-bit word with the flags, so the
+     * whole word is added per segment. */
+    memset(&pucIPHeader[IPV4_TOTAL_LENGTH_OFFSET], 0, sizeof(usValue));
+    memset(&pucIPHeader[IPV4_IDENTIFICATION_OFFSET], 0, sizeof(usValue));
+    memset(&pucIPHeader[IPV4_CHECKSUM_OFFSET], 0, sizeof(usValue));
+    memset(&pucTCPHeader[TCP_SEQUENCE_OFFSET], 0, sizeof(ulValue));
+    memset(&pucTCPHeader[TCP_FLAGS_OFFSET], 0, sizeof(usValue));
+    memset(&pucTCPHeader[TCP_CHECKSUM_OFFSET], 0, sizeof(usValue));
+
+    ullIPSum  = prvChecksumAccumulate(0ULL, pucIPHeader, uxIPHeaderLength);
+    ullTCPSum = prvChecksumAccumulate(0ULL, &pucIPHeader[IPV4_SOURCE_ADDRESS_OFFSET], IPV4_ADDRESS_PAIR_SIZE);
+    ullTCPSum = prvChecksumAccumulate(ullTCPSum, pucTCPHeader, uxTCPHeaderLength);
+    ullTCPSum += FreeRTOS_htons((uint16_t) IPV4_PROTOCOL_TCP);
+
+    pucTCPHeader[TCP_FLAGS_OFFSET] = (uint8_t) ((uxTCPHeaderLength / 4U) << 4);
+
+    while (uxOffset < uxPayloadLength)
+    {
+        uxSegmentLength = uxPayloadLength - uxOffset;
+        if (uxSegmentLength > uxMSS)
+        {
+            uxSegmentLength = uxMSS;
+        }
+
+        /* IPv4 header. */
+        usValue = FreeRTOS_htons((uint16_t) (uxIPHeaderLength + uxTCPHeaderLength + uxSegmentLength));
+        memcpy(&pucIPHeader[IPV4_TOTAL_LENGTH_OFFSET], &usValue, sizeof(usValue));
+        ullSum  = ullIPSum + usValue;
+        usValue = FreeRTOS_htons(usIdentification);
+        memcpy(&pucIPHeader[IPV4_IDENTIFICATION_OFFSET], &usValue, sizeof(usValue));
+        ullSum    += usValue;
+        usChecksum = (uint16_t) ~prvChecksumFold(ullSum);
+        memcpy(&pucIPHeader[IPV4_CHECKSUM_OFFSET], &usChecksum, sizeof(usChecksum));
+
+        /* TCP header. Only the last segment pushes the data or closes the connection. */
+        ulValue = FreeRTOS_htonl(ulSequence + (uint32_t) uxOffset);
+        memcpy(&pucTCPHeader[TCP_SEQUENCE_OFFSET], &ulValue, sizeof(ulValue));
+        pucTCPHeader[TCP_FLAGS_OFFSET + 1U] = ((uxOffset + uxSegmentLength) < uxPayloadLength) ?
+                                              (uint8_t) (ucFlags & ~(TCP_FLAG_PSH | TCP_FLAG_FIN)) : ucFlags;
+        memcpy(&usValue, &pucTCPHeader[TCP_FLAGS_OFFSET], sizeof(usValue));
+        ullSum     = ullTCPSum + ulValue + usValue;
+        ullSum    += FreeRTOS_htons((uint16_t) (uxTCPHeaderLength + uxSegmentLength));
+        ullSum     = prvChecksumAccumulate(ullSum, &pucPayload[uxOffset], uxSegmentLength);
+        usChecksum = (uint16_t) ~prvChecksumFold(ullSum);
+        memcpy(&pucTCPHeader[TCP_CHECKSUM_OFFSET], &usChecksum, sizeof(usChecksum));
+
+        if (pdFAIL == prvLargeSendSegmentOutput(pucHeader, uxHeaderLength, &pucPayload[uxOffset], uxSegmentLength))
+        {
+            break;
+        }
+
+        uxOffset += uxSegmentLength;
+        usIdentification++;
+    }
+
+    return uxOffset;
+}
+
+#endif
+
 void vNetworkInterfaceAllocateRAMToBuffers (
     NetworkBufferDescriptor_t pxNetworkBuffers[ipconfigNUM_NETWORK_BUFFER_DESCRIPTORS])
 {
+#if (ETHER_NETWORK_BUFFER_POOL_ENABLE)
+    uint8_t * pucFrame;
+
+    for (uint32_t i = 0U; i < ipconfigNUM_NETWORK_BUFFER_DESCRIPTORS; i++)
+    {
+        pucFrame = &ucNetworkBuffers[i][ETHER_NETWORK_BUFFER_PADDING];
+        pxNetworkBuffers[i].pucEthernetBuffer = pucFrame;
+
+        /* Store the pointer back to the descriptor where pxPacketBuffer_to_NetworkBuffer looks for it. */
+        *((NetworkBufferDescriptor_t **) (pucFrame - ipBUFFER_PADDING)) = &pxNetworkBuffers[i];
+    }
+#else
+
     /* Remove compiler warning about unused parameter. */
     (void) pxNetworkBuffers;
+#endif
 }
 
 BaseType_t xGetPhyLinkStatus (void)
 {
     BaseType_t xReturn = pdPASS;
 
+#if (ETHER_PHY_CFG_LINK_INTERRUPT_ENABLE)
+
+    /* The link status task keeps the link state up to date, so no MDIO access is needed here. */
+    if (ETHER_LINK_ESTABLISH_STATUS_UP ==
+        ((ether_instance_ctrl_t *) gp_freertos_ether->p_ctrl)->link_establish_status)
+#else
     if (FSP_SUCCESS == gp_freertos_ether->p_api->linkProcess(gp_freertos_ether->p_ctrl))
+#endif
     {
         xReturn = pdPASS;
     }
@@ -214,11 +595,27 @@ BaseType_t xGetPhyLinkStatus (void)
  **********************************************************************************************************************/
 void vEtherISRCallback (ether_callback_args_t * p_args) {
     BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+    uint32_t   ulWakeFactors            = ETHER_EDMAC_INTERRUPT_FACTOR_RECEPTION;
+
+    /* In zero copy mode the receive task also returns transmitted buffers to the stack. */
+    if (ETHER_ZEROCOPY_ENABLE == gp_freertos_ether->p_cfg->zerocopy)
+    {
+        ulWakeFactors |= ETHER_EDMAC_INTERRUPT_FACTOR_TX_COMPLETE;
+    }
 
     /* If EDMAC FR (Frame Receive Event) or FDE (Receive Descriptor Empty Event)
      * interrupt occurs, wake up xRxHanderTask. */
-    if (p_args->status_eesr & ETHER_EDMAC_INTERRUPT_FACTOR_RECEPTION)
+    if (p_args->status_eesr & ulWakeFactors)
     {
+#if (ETHER_RX_POLLING_BATCH_SIZE > 0U)
+
+        /* Mask further frame receive interrupts until the receive task has drained the descriptors. */
+        if (p_args->status_eesr & ETHER_EDMAC_INTERRUPT_FACTOR_FR)
+        {
+            prvRxInterruptEnable(0U);
+        }
+#endif
+
         if (xRxHanderTaskHandle != NULL)
         {
             vTaskNotifyGiveFromISR(xRxHanderTaskHandle, &xHigherPriorityTaskWoken);
@@ -232,6 +629,28 @@ void vEtherISRCallback (ether_callback_args_t * p_args) {
     }
 }
 
+#if (ETHER_PHY_CFG_LINK_INTERRUPT_ENABLE)
+void vEtherPhyIrqCallback (external_irq_callback_args_t * p_args) {
+    BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+    /* Remove compiler warning about unused parameter. */
+    (void) p_args;
+
+    /* The link state kept by the PHY driver is stale now. */
+    gp_freertos_ether->p_cfg->p_ether_phy_instance->p_api->linkStateInvalidate(
+        gp_freertos_ether->p_cfg->p_ether_phy_instance->p_ctrl);
+
+    /* The PHY-LSI INT pin was asserted by a link-up or link-down event. Wake up the link status task. */
+    if (xLinkStatusTaskHandle != NULL)
+    {
+        vTaskNotifyGiveFromISR(xLinkStatusTaskHandle, &xHigherPriorityTaskWoken);
+    }
+
+    portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
+}
+
+#endif
+
 /***********************************************************************************************************************
  * private functions
  **********************************************************************************************************************/
@@ -250,11 +669,23 @@ static BaseType_t prvNetworkInterfaceInput (void) {
 
     if (NULL != pxBufferDescriptor)
     {
-        err = gp_freertos_ether->p_api->read(gp_freertos_ether->p_ctrl,
-                                             (void *) pxBufferDescriptor->pucEthernetBuffer,
-                                             &xBytesReceived);
+        err = prvEtherRead(pxBufferDescriptor->pucEthernetBuffer, &xBytesReceived);
         pxBufferDescriptor->xDataLength = (size_t) xBytesReceived;
 
+#if (ipconfigDRIVER_INCLUDED_RX_IP_CHECKSUM != 0)
+
+        /* The stack relies on the driver to drop frames with a bad IP or protocol checksum. The frame is consumed,
+         * so report success to keep draining the receive descriptors. */
+        if ((FSP_SUCCESS == err) &&
+            (pdPASS != prvProcessIPChecksums(pxBufferDescriptor->pucEthernetBuffer, xBytesReceived, pdFALSE)))
+        {
+            vReleaseNetworkBufferAndDescriptor(pxBufferDescriptor);
+            iptraceETHERNET_RX_EVENT_LOST();
+
+            return pdPASS;
+        }
+#endif
+
         /* When driver received any data. */
         if ((FSP_SUCCESS == err) || (FSP_ERR_ETHER_ERROR_NO_DATA == err))
         {
@@ -289,8 +720,655 @@ static BaseType_t prvNetworkInterfaceInput (void) {
     return xResult;
 }
 
+/* Read one frame into the network buffer. In zero copy mode the driver hands out its own receive buffer, which is
+ * copied into the network buffer and given back to the EDMAC right away. */
+static fsp_err_t prvEtherRead (uint8_t * pucBuffer, uint32_t * pulBytesReceived) {
+    fsp_err_t err;
+    uint8_t * pucReceived = NULL;
+#if (ETHER_MEMORY_BENCHMARK_ENABLE)
+    uint32_t ulStartCycles = DWT->CYCCNT;
+#endif
+
+    if (ETHER_ZEROCOPY_DISABLE == gp_freertos_ether->p_cfg->zerocopy)
+    {
+        err = gp_freertos_ether->p_api->read(gp_freertos_ether->p_ctrl, (void *) pucBuffer, pulBytesReceived);
+    }
+    else
+    {
+        err = gp_freertos_ether->p_api->read(gp_freertos_ether->p_ctrl, (void *) &pucReceived, pulBytesReceived);
+
+        if (FSP_SUCCESS == err)
+        {
+            memcpy(pucBuffer, pucReceived, *pulBytesReceived);
+            err = gp_freertos_ether->p_api->bufferRelease(gp_freertos_ether->p_ctrl);
+        }
+    }
+
+#if (ETHER_MEMORY_BENCHMARK_ENABLE)
+    if (FSP_SUCCESS == err)
+    {
+        prvBenchmarkRecord(&xRxBenchmark, ulStartCycles, *pulBytesReceived);
+    }
+#endif
+
+    return err;
+}
+
+/* Queue the network buffer itself for transmission. The buffer is returned to the stack by prvTxBufferReclaim once
+ * the frame has been sent. A buffer that stays owned by the stack is duplicated first. */
+static BaseType_t prvNetworkInterfaceOutputZeroCopy (NetworkBufferDescriptor_t * pxNetworkBuffer,
+                                                     BaseType_t                  xReleaseAfterSend) {
+    ether_instance_ctrl_t * p_ether_ctrl = (ether_instance_ctrl_t *) gp_freertos_ether->p_ctrl;
+    fsp_err_t               err          = FSP_ERR_INVALID_POINTER;
+    uint32_t                ulPending;
+
+    if (pdFALSE == xReleaseAfterSend)
+    {
+        pxNetworkBuffer = pxDuplicateNetworkBufferWithDescriptor(pxNetworkBuffer, pxNetworkBuffer->xDataLength);
+
+        if (NULL == pxNetworkBuffer)
+        {
+            return pdFAIL;
+        }
+    }
+
+    ulPending = p_ether_ctrl->tx_write_count - p_ether_ctrl->tx_reclaim_count;
+
+    /* The buffer is found again from its frame address when it is reclaimed. */
+    if ((0U == ((uint32_t) pxNetworkBuffer->pucEthernetBuffer & ETHER_TX_BUFFER_ALIGNMENT_MASK)) &&
+        (pxNetworkBuffer == pxPacketBuffer_to_NetworkBuffer(pxNetworkBuffer->pucEthernetBuffer)))
+    {
+        err = prvEtherWriteZeroCopy(pxNetworkBuffer);
+
+        /* The descriptors are held by frames sent since the last write-back complete interrupt. Reclaim them here
+         * instead of waiting for the receive task. */
+        if ((FSP_ERR_ETHER_ERROR_TRANSMIT_BUFFER_FULL == err) && (0U != prvTxBufferReclaim()))
+        {
+            ulPending = p_ether_ctrl->tx_write_count - p_ether_ctrl->tx_reclaim_count;
+            err       = prvEtherWriteZeroCopy(pxNetworkBuffer);
+        }
+    }
+
+    if (FSP_SUCCESS != err)
+    {
+        /* The EDMAC does not own the buffer, so it goes back to the stack right away. */
+        vReleaseNetworkBufferAndDescriptor(pxNetworkBuffer);
+
+        return pdFAIL;
+    }
+
+    /* Call the standard trace macro to log the send event. */
+    iptraceNETWORK_INTERFACE_TRANSMIT();
+
+    /* Wake the receive task when nothing else was in flight, so it starts the reclaim timeout. */
+    if ((0U == ulPending) && (NULL != xRxHanderTaskHandle))
+    {
+        xTaskNotifyGive(xRxHanderTaskHandle);
+    }
+
+    return pdPASS;
+}
+
+/* Hand a frame to the driver in zero copy mode. With software transmit queues the receive task moves queued frames to
+ * the transmit descriptors when it reclaims buffers, so the write runs in a critical section like the reclaim. */
+static fsp_err_t prvEtherWriteZeroCopy (NetworkBufferDescriptor_t * pxNetworkBuffer) {
+    fsp_err_t           err;
+    ether_tx_priority_t xPriority;
+    BaseType_t          xTagged;
+
+    if (NULL == gp_freertos_ether->p_cfg->p_extend)
+    {
+        return gp_freertos_ether->p_api->write(gp_freertos_ether->p_ctrl,
+                                               pxNetworkBuffer->pucEthernetBuffer,
+                                               pxNetworkBuffer->xDataLength);
+    }
+
+    xTagged = xApplicationEtherTxPriorityGet(pxNetworkBuffer, &xPriority);
+
+    taskENTER_CRITICAL();
+    if (pdFALSE != xTagged)
+    {
+        err = gp_freertos_ether->p_api->priorityWrite(gp_freertos_ether->p_ctrl,
+                                                      pxNetworkBuffer->pucEthernetBuffer,
+                                                      pxNetworkBuffer->xDataLength,
+                                                      xPriority);
+    }
+    else
+    {
+        err = gp_freertos_ether->p_api->write(gp_freertos_ether->p_ctrl,
+                                              pxNetworkBuffer->pucEthernetBuffer,
+                                              pxNetworkBuffer->xDataLength);
+    }
+
+    taskEXIT_CRITICAL();
+
+    return err;
+}
+
+#if (ETHER_LARGE_SEND_ENABLE)
+
+/* Queue one segment built by uxNetworkInterfaceOutputLargeSend(). In the non zero copy mode the driver gathers the
+ * header and the payload straight into a transmit descriptor buffer. In zero copy mode the segment is assembled in a
+ * network buffer of its own, which the EDMAC transmits directly. */
+static BaseType_t prvLargeSendSegmentOutput (uint8_t const * pucHeader,
+                                             size_t          uxHeaderLength,
+                                             uint8_t const * pucPayload,
+                                             size_t          uxPayloadLength) {
+    static uint8_t const        ucPadding[MINIMUM_ETHERNET_FRAME_SIZE] = {0U};
+    ether_buffer_fragment_t     xFragments[3];
+    NetworkBufferDescriptor_t * pxNetworkBuffer;
+    size_t    uxLength    = uxHeaderLength + uxPayloadLength;
+    size_t    uxPadding   = (uxLength < MINIMUM_ETHERNET_FRAME_SIZE) ? (MINIMUM_ETHERNET_FRAME_SIZE - uxLength) : 0U;
+    uint32_t  ulFragments = 2U;
+    fsp_err_t err;
+
+    if (ETHER_ZEROCOPY_ENABLE == gp_freertos_ether->p_cfg->zerocopy)
+    {
+        pxNetworkBuffer = pxGetNetworkBufferWithDescriptor(uxLength + uxPadding, 0);
+
+        if (NULL == pxNetworkBuffer)
+        {
+            return pdFAIL;
+        }
+
+        memcpy(pxNetworkBuffer->pucEthernetBuffer, pucHeader, uxHeaderLength);
+        memcpy(&pxNetworkBuffer->pucEthernetBuffer[uxHeaderLength], pucPayload, uxPayloadLength);
+        memset(&pxNetworkBuffer->pucEthernetBuffer[uxLength], 0, uxPadding);
+        pxNetworkBuffer->xDataLength = uxLength + uxPadding;
+
+        return prvNetworkInterfaceOutputZeroCopy(pxNetworkBuffer, pdTRUE);
+    }
+
+    xFragments[0].p_buffer = (void *) pucHeader;
+    xFragments[0].length   = (uint32_t) uxHeaderLength;
+    xFragments[1].p_buffer = (void *) pucPayload;
+    xFragments[1].length   = (uint32_t) uxPayloadLength;
+
+    if (0U != uxPadding)
+    {
+        xFragments[2].p_buffer = (void *) ucPadding;
+        xFragments[2].length   = (uint32_t) uxPadding;
+        ulFragments            = 3U;
+    }
+
+    err = gp_freertos_ether->p_api->writeGather(gp_freertos_ether->p_ctrl, xFragments, ulFragments);
+
+    if (FSP_SUCCESS != err)
+    {
+        return pdFAIL;
+    }
+
+    /* Call the standard trace macro to log the send event. */
+    iptraceNETWORK_INTERFACE_TRANSMIT();
+
+    return pdPASS;
+}
+
+#endif
+
+/* Return the buffers of transmitted frames to the stack. The driver is only accessed inside a critical section
+ * because both the IP task and the receive task reclaim buffers. Returns the number of buffers released. */
+static uint32_t prvTxBufferReclaim (void) {
+    void   * pvBuffers[ETHER_TX_RECLAIM_BATCH_SIZE];
+    uint32_t ulBuffers;
+    uint32_t ulReleased = 0U;
+    uint32_t i;
+
+    do
+    {
+        ulBuffers = 0U;
+
+        taskENTER_CRITICAL();
+        (void) gp_freertos_ether->p_api->txBufferReclaim(gp_freertos_ether->p_ctrl,
+                                                         pvBuffers,
+                                                         ETHER_TX_RECLAIM_BATCH_SIZE,
+                                                         &ulBuffers);
+        taskEXIT_CRITICAL();
+
+        for (i = 0U; i < ulBuffers; i++)
+        {
+            vReleaseNetworkBufferAndDescriptor(pxPacketBuffer_to_NetworkBuffer(pvBuffers[i]));
+        }
+
+        ulReleased += ulBuffers;
+    } while (ETHER_TX_RECLAIM_BATCH_SIZE == ulBuffers);
+
+    return ulReleased;
+}
+
+#if (ETHER_MEMORY_BENCHMARK_ENABLE)
+
+/* Time a maximum size frame copy between two network buffers while no other Ethernet traffic is running. */
+static void prvBenchmarkCalibrate (void) {
+    NetworkBufferDescriptor_t * pxSource;
+    NetworkBufferDescriptor_t * pxDestination;
+    uint32_t ulStartCycles;
+
+    /* The interface is initialized again after a network down event. Keep the first reference. */
+    if (0U != ulBenchmarkReferenceCycles)
+    {
+        return;
+    }
+
+    R_BSP_CycleCounterStart();
+
+    pxSource      = pxGetNetworkBufferWithDescriptor((size_t) MAXIMUM_ETHERNET_FRAME_SIZE, 0);
+    pxDestination = pxGetNetworkBufferWithDescriptor((size_t) MAXIMUM_ETHERNET_FRAME_SIZE, 0);
+
+    if ((NULL != pxSource) && (NULL != pxDestination))
+    {
+        ulStartCycles = DWT->CYCCNT;
+        memcpy(pxDestination->pucEthernetBuffer, pxSource->pucEthernetBuffer, MAXIMUM_ETHERNET_FRAME_SIZE);
+        ulBenchmarkReferenceCycles = DWT->CYCCNT - ulStartCycles;
+    }
+
+    if (NULL != pxSource)
+    {
+        vReleaseNetworkBufferAndDescriptor(pxSource);
+    }
+
+    if (NULL != pxDestination)
+    {
+        vReleaseNetworkBufferAndDescriptor(pxDestination);
+    }
+}
+
+/* Account one frame copy that started at ulStartCycles. */
+static void prvBenchmarkRecord (EtherMemoryBenchmark_t * pxBenchmark, uint32_t ulStartCycles, uint32_t ulBytes) {
+    pxBenchmark->ulCycles += DWT->CYCCNT - ulStartCycles;
+    pxBenchmark->ulBytes  += ulBytes;
+    pxBenchmark->ulFrames++;
+}
+
+/* Print the copy cost once ETHER_MEMORY_BENCHMARK_REPORT_FRAMES frames were received since the last report. The
+ * reference is the calibration copy scaled to the bytes copied. */
+static void prvBenchmarkReport (void) {
+    static EtherMemoryBenchmark_t xRxLast;
+    static EtherMemoryBenchmark_t xTxLast;
+    EtherMemoryBenchmark_t        xRx = xRxBenchmark;
+    EtherMemoryBenchmark_t        xTx = xTxBenchmark;
+    uint32_t ulRxBytes = xRx.ulBytes - xRxLast.ulBytes;
+    uint32_t ulTxBytes = xTx.ulBytes - xTxLast.ulBytes;
+
+    if ((xRx.ulFrames - xRxLast.ulFrames) < ETHER_MEMORY_BENCHMARK_REPORT_FRAMES)
+    {
+        return;
+    }
+
+    FreeRTOS_printf(("Ether RX: %u frames, %u bytes, %u cycles, %u reference cycles\n",
+                     (unsigned) (xRx.ulFrames - xRxLast.ulFrames),
+                     (unsigned) ulRxBytes,
+                     (unsigned) (xRx.ulCycles - xRxLast.ulCycles),
+                     (unsigned) (((uint64_t) ulRxBytes * ulBenchmarkReferenceCycles) / MAXIMUM_ETHERNET_FRAME_SIZE)));
+    FreeRTOS_printf(("Ether TX: %u frames, %u bytes, %u cycles, %u reference cycles\n",
+                     (unsigned) (xTx.ulFrames - xTxLast.ulFrames),
+                     (unsigned) ulTxBytes,
+                     (unsigned) (xTx.ulCycles - xTxLast.ulCycles),
+                     (unsigned) (((uint64_t) ulTxBytes * ulBenchmarkReferenceCycles) / MAXIMUM_ETHERNET_FRAME_SIZE)));
+
+    xRxLast = xRx;
+    xTxLast = xTx;
+}
+
+#endif
+
+#if (ETHER_RX_POLLING_BATCH_SIZE > 0U)
+
+/* Drain up to ETHER_RX_POLLING_BATCH_SIZE frames and pass them to the IP task. When ipconfigUSE_LINKED_RX_MESSAGES is
+ * enabled the frames are linked through pxNextBuffer and sent as a single eNetworkRxEvent. Returns pdTRUE when the
+ * batch was full, meaning more frames may still be waiting in the receive descriptors. */
+static BaseType_t prvNetworkInterfaceInputBatch (void) {
+    fsp_err_t                   err = FSP_SUCCESS;
+    IPStackEvent_t              xRxEvent;
+    NetworkBufferDescriptor_t * pxBufferDescriptor;
+    uint32_t xBytesReceived = 0;
+    uint32_t ulFrames       = 0U;
+ #if (ipconfigUSE_LINKED_RX_MESSAGES != 0)
+    NetworkBufferDescriptor_t * pxHead = NULL;
+    NetworkBufferDescriptor_t * pxTail = NULL;
+ #endif
+
+    while ((ulFrames < ETHER_RX_POLLING_BATCH_SIZE) && (FSP_SUCCESS == err))
+    {
+        pxBufferDescriptor = pxGetNetworkBufferWithDescriptor((size_t) MAXIMUM_ETHERNET_FRAME_SIZE, 0);
+
+        if (NULL == pxBufferDescriptor)
+        {
+            break;
+        }
+
+        err = prvEtherRead(pxBufferDescriptor->pucEthernetBuffer, &xBytesReceived);
+
+        /* A filtered multicast frame has already been released by the driver. Keep draining. */
+        if (FSP_ERR_ETHER_ERROR_FILTERING == err)
+        {
+            vReleaseNetworkBufferAndDescriptor(pxBufferDescriptor);
+            err = FSP_SUCCESS;
+            ulFrames++;
+            continue;
+        }
+
+        if (FSP_SUCCESS != err)
+        {
+            vReleaseNetworkBufferAndDescriptor(pxBufferDescriptor);
+            break;
+        }
+
+        ulFrames++;
+        pxBufferDescriptor->xDataLength = (size_t) xBytesReceived;
+
+ #if (ipconfigDRIVER_INCLUDED_RX_IP_CHECKSUM != 0)
+        if (pdPASS != prvProcessIPChecksums(pxBufferDescriptor->pucEthernetBuffer, xBytesReceived, pdFALSE))
+        {
+            vReleaseNetworkBufferAndDescriptor(pxBufferDescriptor);
+            continue;
+        }
+ #endif
+
+        if (eConsiderFrameForProcessing(pxBufferDescriptor->pucEthernetBuffer) != eProcessBuffer)
+        {
+            vReleaseNetworkBufferAndDescriptor(pxBufferDescriptor);
+            continue;
+        }
+
+ #if (ipconfigUSE_LINKED_RX_MESSAGES != 0)
+        pxBufferDescriptor->pxNextBuffer = NULL;
+
+        if (NULL == pxHead)
+        {
+            pxHead = pxBufferDescriptor;
+        }
+        else
+        {
+            pxTail->pxNextBuffer = pxBufferDescriptor;
+        }
+
+        pxTail = pxBufferDescriptor;
+ #else
+        xRxEvent.eEventType = eNetworkRxEvent;
+        xRxEvent.pvData     = (void *) pxBufferDescriptor;
+
+        if (pdPASS == xSendEventStructToIPTask(&xRxEvent, 0))
+        {
+            iptraceNETWORK_INTERFACE_RECEIVE();
+        }
+        else
+        {
+            vReleaseNetworkBufferAndDescriptor(pxBufferDescriptor);
+            iptraceETHERNET_RX_EVENT_LOST();
+        }
+ #endif
+    }
+
+ #if (ipconfigUSE_LINKED_RX_MESSAGES != 0)
+    if (NULL != pxHead)
+    {
+        /* Send the whole chain to the TCP/IP stack with one event. */
+        xRxEvent.eEventType = eNetworkRxEvent;
+        xRxEvent.pvData     = (void *) pxHead;
+
+        if (pdPASS == xSendEventStructToIPTask(&xRxEvent, 0))
+        {
+            iptraceNETWORK_INTERFACE_RECEIVE();
+        }
+        else
+        {
+            /* The chain could not be sent to the IP task so every buffer in it must be released. */
+            while (NULL != pxHead)
+            {
+                pxBufferDescriptor = pxHead;
+                pxHead             = pxHead->pxNextBuffer;
+                vReleaseNetworkBufferAndDescriptor(pxBufferDescriptor);
+                iptraceETHERNET_RX_EVENT_LOST();
+            }
+        }
+    }
+ #endif
+
+    return (ulFrames >= ETHER_RX_POLLING_BATCH_SIZE) ? pdTRUE : pdFALSE;
+}
+
+/* Mask or unmask the EDMAC frame receive interrupt. */
+static void prvRxInterruptEnable (uint32_t ulEnable) {
+    R_ETHERC_EDMAC_Type * p_reg_edmac =
+        (R_ETHERC_EDMAC_Type *) ((ether_instance_ctrl_t *) gp_freertos_ether->p_ctrl)->p_reg_edmac;
+
+    p_reg_edmac->EESIPR_b.FRIP = ulEnable & 1U;
+}
+
+#endif
+
+#if (ipconfigDRIVER_INCLUDED_TX_IP_CHECKSUM != 0) || (ipconfigDRIVER_INCLUDED_RX_IP_CHECKSUM != 0) || \
+    (ETHER_LARGE_SEND_ENABLE)
+
+/* Add a block of data to a ones-complement sum. The data is summed as native 32-bit words into a 64-bit accumulator so
+ * the carries are kept and folded only once at the end (RFC 1071). This compiles to an LDM/ADDS/ADCS sequence on
+ * Cortex-M4 and Cortex-M33. Unaligned leading bytes are handled separately so the word loop never performs an
+ * unaligned access, which keeps the routine usable on Cortex-M23. */
+static uint64_t prvChecksumAccumulate (uint64_t ullSum, uint8_t const * pucData, size_t uxLength) {
+    uint32_t const * pulData;
+    uint16_t         usHalfWord;
+
+    if (0U != ((uint32_t) pucData & 1U))
+    {
+        /* Odd start address: sum byte pairs in the order they appear in memory. */
+        while (uxLength > 1U)
+        {
+            memcpy(&usHalfWord, pucData, sizeof(usHalfWord));
+            ullSum   += usHalfWord;
+            pucData  += 2U;
+            uxLength -= 2U;
+        }
+    }
+    else
+    {
+        if ((0U != ((uint32_t) pucData & 2U)) && (uxLength > 1U))
+        {
+            ullSum   += *((uint16_t const *) pucData);
+            pucData  += 2U;
+            uxLength -= 2U;
+        }
+
+        pulData = (uint32_t const *) pucData;
+
+        while (uxLength >= 16U)
+        {
+            ullSum   += pulData[0];
+            ullSum   += pulData[1];
+            ullSum   += pulData[2];
+            ullSum   += pulData[3];
+            pulData  += 4U;
+            uxLength -= 16U;
+        }
+
+        while (uxLength >= 4U)
+        {
+            ullSum   += *pulData++;
+            uxLength -= 4U;
+        }
+
+        pucData = (uint8_t const *) pulData;
+
+        if (uxLength > 1U)
+        {
+            ullSum   += *((uint16_t const *) pucData);
+            pucData  += 2U;
+            uxLength -= 2U;
+        }
+    }
+
+    if (0U != uxLength)
+    {
+        /* A trailing byte is padded with zero on the right in network order. */
+        usHalfWord = 0U;
+        memcpy(&usHalfWord, pucData, 1U);
+        ullSum += usHalfWord;
+    }
+
+    return ullSum;
+}
+
+/* Fold a 64-bit accumulator down to a 16-bit ones-complement sum. */
+static uint16_t prvChecksumFold (uint64_t ullSum) {
+    ullSum = (ullSum & 0xFFFFFFFFULL) + (ullSum >> 32);
+    ullSum = (ullSum & 0xFFFFFFFFULL) + (ullSum >> 32);
+    ullSum = (ullSum & 0xFFFFULL) + (ullSum >> 16);
+    ullSum = (ullSum & 0xFFFFULL) + (ullSum >> 16);
+    ullSum = (ullSum & 0xFFFFULL) + (ullSum >> 16);
+
+    return (uint16_t) ullSum;
+}
+
+#endif
+
+#if (ipconfigDRIVER_INCLUDED_TX_IP_CHECKSUM != 0) || (ipconfigDRIVER_INCLUDED_RX_IP_CHECKSUM != 0)
+
+/* Generate (xOutgoing == pdTRUE) or verify (xOutgoing == pdFALSE) the IPv4 header checksum and the ICMP, TCP or UDP
+ * checksum of a frame. Frames that are not IPv4, and IP fragments, are passed through untouched. Returns pdFAIL only
+ * when a received frame has a bad checksum or a malformed header. */
+static BaseType_t prvProcessIPChecksums (uint8_t * pucEthernetBuffer, size_t uxLength, BaseType_t xOutgoing) {
+    uint8_t * pucIPHeader = &pucEthernetBuffer[ETHER_FRAME_HEADER_SIZE];
+    uint8_t * pucProtocolHeader;
+    uint16_t  usValue;
+    uint16_t  usChecksum;
+    size_t    uxIPHeaderLength;
+    size_t    uxIPTotalLength;
+    size_t    uxProtocolLength;
+    size_t    uxChecksumOffset;
+    size_t    uxMinimumLength;
+    uint8_t   ucProtocol;
+    uint64_t  ullSum;
+
+    if (uxLength < (ETHER_FRAME_HEADER_SIZE + IPV4_HEADER_MIN_SIZE))
+    {
+        return pdPASS;
+    }
+
+    memcpy(&usValue, &pucEthernetBuffer[ETHER_FRAME_TYPE_OFFSET], sizeof(usValue));
+    if (FreeRTOS_ntohs(usValue) != ETHER_FRAME_TYPE_IPV4)
+    {
+        return pdPASS;
+    }
+
+    uxIPHeaderLength = (size_t) (pucIPHeader[0] & 0x0FU) * 4U;
+    memcpy(&usValue, &pucIPHeader[IPV4_TOTAL_LENGTH_OFFSET], sizeof(usValue));
+    uxIPTotalLength = FreeRTOS_ntohs(usValue);
+
+    if ((uxIPHeaderLength < IPV4_HEADER_MIN_SIZE) || (uxIPTotalLength < uxIPHeaderLength) ||
+        ((ETHER_FRAME_HEADER_SIZE + uxIPTotalLength) > uxLength))
+    {
+        return (pdTRUE == xOutgoing) ? pdPASS : pdFAIL;
+    }
+
+    /* IPv4 header checksum. */
+    if (pdTRUE == xOutgoing)
+    {
+        memset(&pucIPHeader[IPV4_CHECKSUM_OFFSET], 0, sizeof(usChecksum));
+        usChecksum = (uint16_t) ~prvChecksumFold(prvChecksumAccumulate(0ULL, pucIPHeader, uxIPHeaderLength));
+        memcpy(&pucIPHeader[IPV4_CHECKSUM_OFFSET], &usChecksum, sizeof(usChecksum));
+    }
+    else if (0xFFFFU != prvChecksumFold(prvChecksumAccumulate(0ULL, pucIPHeader, uxIPHeaderLength)))
+    {
+        return pdFAIL;
+    }
+    else
+    {
+        /* IP header checksum is good. */
+    }
+
+    /* Protocol checksums cannot be checked on individual fragments. */
+    memcpy(&usValue, &pucIPHeader[IPV4_FRAGMENT_OFFSET], sizeof(usValue));
+    if (0U != (FreeRTOS_ntohs(usValue) & IPV4_FRAGMENT_MASK))
+    {
+        return pdPASS;
+    }
+
+    ucProtocol        = pucIPHeader[IPV4_PROTOCOL_OFFSET];
+    pucProtocolHeader = &pucIPHeader[uxIPHeaderLength];
+    uxProtocolLength  = uxIPTotalLength - uxIPHeaderLength;
+    ullSum            = 0ULL;
+
+    switch (ucProtocol)
+    {
+        case IPV4_PROTOCOL_TCP:
+        {
+            uxChecksumOffset = TCP_CHECKSUM_OFFSET;
+            uxMinimumLength  = TCP_HEADER_MIN_SIZE;
+            break;
+        }
+
+        case IPV4_PROTOCOL_UDP:
+        {
+            uxChecksumOffset = UDP_CHECKSUM_OFFSET;
+            uxMinimumLength  = UDP_HEADER_SIZE;
+            break;
+        }
+
+        case IPV4_PROTOCOL_ICMP:
+        {
+            uxChecksumOffset = ICMP_CHECKSUM_OFFSET;
+            uxMinimumLength  = ICMP_HEADER_MIN_SIZE;
+            break;
+        }
+
+        default:
+        {
+            return pdPASS;
+        }
+    }
+
+    if (uxProtocolLength < uxMinimumLength)
+    {
+        return (pdTRUE == xOutgoing) ? pdPASS : pdFAIL;
+    }
+
+    if (IPV4_PROTOCOL_ICMP != ucProtocol)
+    {
+        /* Pseudo header: source and destination address, protocol and protocol length. The constant fields are
+         * byte swapped so they line up with the native-order words read from the frame. */
+        ullSum = prvChecksumAccumulate(ullSum, &pucIPHeader[IPV4_SOURCE_ADDRESS_OFFSET], IPV4_ADDRESS_PAIR_SIZE);
+        ullSum += FreeRTOS_htons((uint16_t) ucProtocol);
+        ullSum += FreeRTOS_htons((uint16_t) uxProtocolLength);
+    }
+
+    if (pdTRUE == xOutgoing)
+    {
+        memset(&pucProtocolHeader[uxChecksumOffset], 0, sizeof(usChecksum));
+        usChecksum = (uint16_t) ~prvChecksumFold(prvChecksumAccumulate(ullSum, pucProtocolHeader, uxProtocolLength));
+
+        /* A computed UDP checksum of zero is transmitted as all ones (RFC 768). */
+        if ((IPV4_PROTOCOL_UDP == ucProtocol) && (0U == usChecksum))
+        {
+            usChecksum = 0xFFFFU;
+        }
+
+        memcpy(&pucProtocolHeader[uxChecksumOffset], &usChecksum, sizeof(usChecksum));
+    }
+    else
+    {
+        memcpy(&usChecksum, &pucProtocolHeader[uxChecksumOffset], sizeof(usChecksum));
+
+        /* A received UDP checksum of zero means the sender did not compute one. */
+        if ((IPV4_PROTOCOL_UDP == ucProtocol) && (0U == usChecksum))
+        {
+            return pdPASS;
+        }
+
+        if (0xFFFFU != prvChecksumFold(prvChecksumAccumulate(ullSum, pucProtocolHeader, uxProtocolLength)))
+        {
+            return pdFAIL;
+        }
+    }
+
+    return pdPASS;
+}
+
+#endif
+
 static void prvRXHandlerTask (void * pvParameters) {
-    BaseType_t xResult = pdFALSE;
+    BaseType_t              xResult      = pdFALSE;
+    TickType_t              xWaitTime    = portMAX_DELAY;
+    ether_instance_ctrl_t * p_ether_ctrl = (ether_instance_ctrl_t *) gp_freertos_ether->p_ctrl;
 
     /* Avoid compiler warning about unreferenced parameter. */
     (void) pvParameters;
@@ -299,23 +1377,70 @@ static void prvRXHandlerTask (void * pvParameters) {
     {
         /* Wait for the Ethernet MAC interrupt to indicate that another packet
          * has been received.  */
-        ulTaskNotifyTake(pdFALSE, portMAX_DELAY);
+        ulTaskNotifyTake(pdFALSE, xWaitTime);
 
+        if (ETHER_ZEROCOPY_ENABLE == gp_freertos_ether->p_cfg->zerocopy)
+        {
+            /* Return the buffers of transmitted frames, then keep waking up until every queued frame is back. */
+            (void) prvTxBufferReclaim();
+
+            xWaitTime = (p_ether_ctrl->tx_write_count != p_ether_ctrl->tx_reclaim_count) ?
+                        pdMS_TO_TICKS(ETHER_TX_RECLAIM_TIMEOUT_MS) : portMAX_DELAY;
+        }
+
+#if (ETHER_RX_POLLING_BATCH_SIZE > 0U)
+
+        /* Keep polling while full batches are being received, then re-enable the frame receive interrupt. A frame
+         * that arrives in between leaves EESR.FR set, so the interrupt fires again as soon as it is unmasked. */
+        do
+        {
+            xResult = prvNetworkInterfaceInputBatch();
+        } while (pdFALSE != xResult);
+
+        prvRxInterruptEnable(1U);
+#else
         do
         {
             xResult = prvNetworkInterfaceInput();
         } while (pdFAIL != xResult);
+#endif
+
+#if (ETHER_MEMORY_BENCHMARK_ENABLE)
+        prvBenchmarkReport();
+#endif
     }
 }
 
 static void prvCheckLinkStatusTask (void * pvParameters) {
+#if (ETHER_PHY_CFG_LINK_INTERRUPT_ENABLE)
+    TickType_t xWaitTime = portMAX_DELAY;
+#endif
+
     /* Remove compiler warning about unused parameter. */
     (void) pvParameters;
 
     for ( ; ; )
     {
+#if (ETHER_PHY_CFG_LINK_INTERRUPT_ENABLE)
+
+        /* Sleep until the PHY-LSI signals a link change. */
+        ulTaskNotifyTake(pdTRUE, xWaitTime);
+        gp_freertos_ether->p_api->linkProcess(gp_freertos_ether->p_ctrl);
+
+        /* The link is up but auto-negotiation has not completed yet. The PHY-LSI raises no further interrupt for
+         * this, so retry at a short interval until the link is established and the IP stack can start DHCP. */
+        if (ETHER_LINK_CHANGE_LINK_UP == ((ether_instance_ctrl_t *) gp_freertos_ether->p_ctrl)->link_change)
+        {
+            xWaitTime = pdMS_TO_TICKS(ETHER_LINK_ESTABLISH_RETRY_INTERVAL);
+        }
+        else
+        {
+            xWaitTime = portMAX_DELAY;
+        }
+#else
         vTaskDelay(ETHER_LINK_STATUS_CHECK_INTERVAL);
         gp_freertos_ether->p_api->linkProcess(gp_freertos_ether->p_ctrl);
+#endif
     }
 }
 
@@ -358,3 +1483,21 @@ BSP_WEAK_REFERENCE uint32_t ulApplicationGetNextSequenceNumber (uint32_t ulSourc
 
     return ulResult;
 }
+
+BSP_WEAK_REFERENCE BaseType_t xApplicationEtherTxPriorityGet (NetworkBufferDescriptor_t const * pxNetworkBuffer,
+                                                              ether_tx_priority_t             * pxPriority)
+{
+    uint8_t const * pucFrame = pxNetworkBuffer->pucEthernetBuffer;
+    uint16_t        usFrameType;
+
+    usFrameType = (uint16_t) ((pucFrame[ETHER_FRAME_TYPE_OFFSET] << 8) | pucFrame[ETHER_FRAME_TYPE_OFFSET + 1U]);
+
+    if (ETHER_FRAME_TYPE_PTP == usFrameType)
+    {
+        *pxPriority = ETHER_TX_PRIORITY_HIGH;
+
+        return pdTRUE;
+    }
+
+    return pdFALSE;
+}
@@ -0,0 +1,915 @@
+/***********************************************************************************************************************
+ * Copyright [2020] Renesas Electronics Corporation and/or its affiliates.  All Rights Reserved.
+ *
+ * This software and documentation are supplied by Renesas Electronics America Inc. and may only be used with products
+ * of Renesas Electronics Corp. and its affiliates ("Renesas").  No other uses are authorized.  Renesas products are
+ * sold pursuant to Renesas terms and conditions of sale.  Purchasers are solely responsible for the selection and use
+ * of Renesas products and Renesas assumes no liability.  No license, express or implied, to any intellectual property
+ * right is granted by Renesas. This software is protected under all applicable laws, including copyright laws. Renesas
+ * reserves the right to change or discontinue this software and/or this documentation. THE SOFTWARE AND DOCUMENTATION
+ * IS DELIVERED TO YOU "AS IS," AND RENESAS MAKES NO REPRESENTATIONS OR WARRANTIES, AND TO THE FULLEST EXTENT
+ * PERMISSIBLE UNDER APPLICABLE LAW, DISCLAIMS ALL WARRANTIES, WHETHER EXPLICITLY OR IMPLICITLY, INCLUDING WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, AND NONINFRINGEMENT, WITH RESPECT TO THE SOFTWARE OR
+ * DOCUMENTATION.  RENESAS SHALL HAVE NO LIABILITY ARISING OUT OF ANY SECURITY VULNERABILITY OR BREACH.  TO THE MAXIMUM
+ * EXTENT PERMITTED BY LAW, IN NO EVENT WILL RENESAS BE LIABLE TO YOU IN CONNECTION WITH THE SOFTWARE OR DOCUMENTATION
+ * (OR ANY PERSON OR ENTITY CLAIMING RIGHTS DERIVED FROM YOU) FOR ANY LOSS, DAMAGES, OR CLAIMS WHATSOEVER, INCLUDING,
+ * WITHOUT LIMITATION, ANY DIRECT, CONSEQUENTIAL, SPECIAL, INDIRECT, PUNITIVE, OR INCIDENTAL DAMAGES; ANY LOST PROFITS,
+ * OTHER ECONOMIC DAMAGE, PROPERTY DAMAGE, OR PERSONAL INJURY; AND EVEN IF RENESAS HAS BEEN ADVISED OF THE POSSIBILITY
+ * OF SUCH LOSS, DAMAGES, CLAIMS OR COSTS.
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Includes
+ **********************************************************************************************************************/
+#include <string.h>
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "semphr.h"
+
+/* FreeRTOS+TCP includes. */
+#include "FreeRTOS_IP.h"
+#include "FreeRTOS_Sockets.h"
+
+/* Renesas includes. */
+#include "r_ether.h"
+#include "rm_freertos_plus_tcp_benchmark.h"
+
+/***********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+
+/* Smallest work buffer: an iperf2 UDP server report with room to spare. */
+#define RM_FREERTOS_PLUS_TCP_BENCHMARK_BUFFER_MIN          (64U)
+
+/* iperf2 UDP datagrams start with a 12 byte datagram header followed by a 24 byte client header. */
+#define RM_FREERTOS_PLUS_TCP_BENCHMARK_UDP_PAYLOAD_MIN     (36U)
+
+/* The iperf2 UDP client repeats its final datagram until the server report arrives. */
+#define RM_FREERTOS_PLUS_TCP_BENCHMARK_UDP_FIN_RETRIES     (10U)
+#define RM_FREERTOS_PLUS_TCP_BENCHMARK_UDP_FIN_WAIT_MS     (250U)
+
+/* Flag of a version 1 iperf2 server report. */
+#define RM_FREERTOS_PLUS_TCP_BENCHMARK_HEADER_VERSION1     (0x80000000UL)
+
+#define RM_FREERTOS_PLUS_TCP_BENCHMARK_US_PER_S            (1000000U)
+#define RM_FREERTOS_PLUS_TCP_BENCHMARK_US_PER_MS           (1000U)
+#define RM_FREERTOS_PLUS_TCP_BENCHMARK_JITTER_GAIN         (16)
+#define RM_FREERTOS_PLUS_TCP_BENCHMARK_PERMILLE            (1000U)
+#define RM_FREERTOS_PLUS_TCP_BENCHMARK_CPU_LOAD_UNKNOWN    (0xFFFFFFFFU)
+
+/* The idle task run time is only available with run time statistics. */
+#if (configGENERATE_RUN_TIME_STATS == 1) && (INCLUDE_xTaskGetIdleTaskHandle == 1) && \
+    defined(portGET_RUN_TIME_COUNTER_VALUE)
+ #define RM_FREERTOS_PLUS_TCP_BENCHMARK_CPU_LOAD_SUPPORTED (1)
+#else
+ #define RM_FREERTOS_PLUS_TCP_BENCHMARK_CPU_LOAD_SUPPORTED (0)
+#endif
+
+/***********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+
+/* iperf2 UDP datagram header, in network byte order. */
+typedef struct st_rm_freertos_plus_tcp_benchmark_udp_header
+{
+    int32_t  id;                       // Sequence number, negated in the final datagram
+    uint32_t tv_sec;                   // Send time
+    uint32_t tv_usec;
+} rm_freertos_plus_tcp_benchmark_udp_header_t;
+
+/* iperf2 UDP server report, sent after the datagram header in reply to the final datagram, in network byte order. */
+typedef struct st_rm_freertos_plus_tcp_benchmark_server_report
+{
+    int32_t flags;
+    int32_t total_len1;                // Bytes received, upper 32 bits
+    int32_t total_len2;                // Bytes received, lower 32 bits
+    int32_t stop_sec;                  // Transfer time
+    int32_t stop_usec;
+    int32_t error_cnt;                 // Datagrams lost
+    int32_t outorder_cnt;              // Datagrams received out of order
+    int32_t datagrams;                 // Datagrams sent, from the last sequence number
+    int32_t jitter1;                   // Jitter, seconds
+    int32_t jitter2;                   // Jitter, microseconds
+} rm_freertos_plus_tcp_benchmark_server_report_t;
+
+/* State of one benchmark run. */
+typedef struct st_rm_freertos_plus_tcp_benchmark_ctx
+{
+    rm_freertos_plus_tcp_benchmark_cfg_t const * p_cfg;
+    rm_freertos_plus_tcp_benchmark_result_t      result;
+    bsp_cycle_counter_get_t                      p_cycles_get;
+    uint32_t cycles_per_us;
+    uint32_t last_cycles;              // Cycle counter at the last time read
+    uint64_t cycles;                   // Cycle counter extended to 64 bits
+    uint32_t idle_run_time;            // Idle task run time at the start of the test
+    uint32_t total_run_time;           // Run time counter at the start of the test
+} rm_freertos_plus_tcp_benchmark_ctx_t;
+
+/***********************************************************************************************************************
+ * Private function prototypes
+ **********************************************************************************************************************/
+static uint64_t  rm_freertos_plus_tcp_benchmark_us_get(rm_freertos_plus_tcp_benchmark_ctx_t * p_ctx);
+static void      rm_freertos_plus_tcp_benchmark_cpu_start(rm_freertos_plus_tcp_benchmark_ctx_t * p_ctx);
+static void      rm_freertos_plus_tcp_benchmark_cpu_stop(rm_freertos_plus_tcp_benchmark_ctx_t * p_ctx);
+static void      rm_freertos_plus_tcp_benchmark_report(rm_freertos_plus_tcp_benchmark_ctx_t * p_ctx, fsp_err_t status);
+static fsp_err_t rm_freertos_plus_tcp_benchmark_tcp_server(rm_freertos_plus_tcp_benchmark_ctx_t * p_ctx);
+static fsp_err_t rm_freertos_plus_tcp_benchmark_tcp_client(rm_freertos_plus_tcp_benchmark_ctx_t * p_ctx);
+static fsp_err_t rm_freertos_plus_tcp_benchmark_udp_server(rm_freertos_plus_tcp_benchmark_ctx_t * p_ctx);
+static fsp_err_t rm_freertos_plus_tcp_benchmark_udp_client(rm_freertos_plus_tcp_benchmark_ctx_t * p_ctx);
+static fsp_err_t rm_freertos_plus_tcp_benchmark_ping(rm_freertos_plus_tcp_benchmark_ctx_t * p_ctx);
+static void      rm_freertos_plus_tcp_benchmark_udp_report_send(rm_freertos_plus_tcp_benchmark_ctx_t * p_ctx,
+                                                                 Socket_t                               socket,
+                                                                 struct freertos_sockaddr const       * p_address,
+                                                                 uint64_t                               jitter_us);
+static void      rm_freertos_plus_tcp_benchmark_address_set(struct freertos_sockaddr * p_address,
+                                                            uint32_t                   ip_address,
+                                                            uint16_t                   port);
+
+/***********************************************************************************************************************
+ * Private global variables
+ **********************************************************************************************************************/
+
+/* The Ethernet instance used by NetworkInterface.c, provided by the application. */
+extern ether_instance_t * gp_freertos_ether;
+
+#if (ipconfigSUPPORT_OUTGOING_PINGS == 1)
+
+/* Echo reply handed over by RM_FREERTOS_PLUS_TCP_BenchmarkPingReply(). */
+static SemaphoreHandle_t   gp_benchmark_ping_semaphore = NULL;
+static StaticSemaphore_t   g_benchmark_ping_semaphore_memory;
+static volatile bsp_cycle_counter_get_t gp_benchmark_ping_cycles_get = NULL;
+static volatile uint32_t   g_benchmark_ping_cycles;
+static volatile uint16_t   g_benchmark_ping_identifier;
+#endif
+
+static const char * const g_benchmark_test_names[] =
+{
+    [RM_FREERTOS_PLUS_TCP_BENCHMARK_TCP_SERVER] = "tcp-rx",
+    [RM_FREERTOS_PLUS_TCP_BENCHMARK_TCP_CLIENT] = "tcp-tx",
+    [RM_FREERTOS_PLUS_TCP_BENCHMARK_UDP_SERVER] = "udp-rx",
+    [RM_FREERTOS_PLUS_TCP_BENCHMARK_UDP_CLIENT] = "udp-tx",
+    [RM_FREERTOS_PLUS_TCP_BENCHMARK_PING]       = "ping",
+};
+
+/*******************************************************************************************************************//**
+ * @addtogroup RM_FREERTOS_PLUS_TCP_BENCHMARK
+ * @{
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Functions
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * Runs one network benchmark and passes the measurement to p_cfg->p_callback. Every result carries the Ethernet
+ * configuration it was measured with (descriptor counts, zero copy, transmit complete interval, network buffer count
+ * and EDMAC buffer address), so results from differently built images can be printed side by side with
+ * RM_FREERTOS_PLUS_TCP_BenchmarkFormat() as a configuration matrix.
+ *
+ * The TCP and UDP tests speak the iperf 2 protocol, so the peer is a stock iperf 2 on a host:
+ * - TCP server: accepts one connection on the iperf port and counts the bytes received until the client closes it.
+ * - TCP client: sends payload_bytes blocks for duration_ms. The iperf client header is sent as zeros, which asks the
+ *   server for a plain one-way test.
+ * - UDP server: counts lost and reordered datagrams and the RFC 1889 jitter, and answers the final datagram with an
+ *   iperf server report so the host prints the same figures.
+ * - UDP client: sends payload_bytes datagrams at udp_rate_kbps for duration_ms and reads back the server report.
+ * - Ping: sends ping_count echo requests and records the round trip times in a histogram. The application must call
+ *   RM_FREERTOS_PLUS_TCP_BenchmarkPingReply() from vApplicationPingReplyHook().
+ *
+ * The CPU load is derived from the idle task run time, so it covers the whole system while the test runs. Run the
+ * benchmark from a task with a priority below the IP task so that it does not starve the stack.
+ *
+ * This function blocks until the test ends and must not be called from an interrupt.
+ *
+ * @retval FSP_SUCCESS                  The test completed and the measurement was reported.
+ * @retval FSP_ERR_ASSERTION            A required pointer is NULL or a setting needed by the test is 0.
+ * @retval FSP_ERR_INVALID_SIZE         The work buffer is too small or the UDP payload is shorter than the iperf
+ *                                      headers.
+ * @retval FSP_ERR_UNSUPPORTED          No cycle counter (see R_BSP_CycleCounterSelect()), or the ping test was
+ *                                      selected without ipconfigSUPPORT_OUTGOING_PINGS.
+ * @retval FSP_ERR_OUT_OF_MEMORY        A socket could not be created.
+ * @retval FSP_ERR_IN_USE               The iperf port is already bound.
+ * @retval FSP_ERR_TIMEOUT              The peer did not connect, answer or finish within timeout_ms. The partial
+ *                                      measurement is reported.
+ * @retval FSP_ERR_ABORTED              The connection was lost. The partial measurement is reported.
+ **********************************************************************************************************************/
+fsp_err_t RM_FREERTOS_PLUS_TCP_BenchmarkRun (rm_freertos_plus_tcp_benchmark_cfg_t const * const p_cfg)
+{
+    rm_freertos_plus_tcp_benchmark_ctx_t ctx = {0};
+    fsp_err_t err = FSP_SUCCESS;
+
+#if BSP_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(p_cfg);
+    FSP_ASSERT(p_cfg->p_buffer);
+    FSP_ASSERT(p_cfg->p_callback);
+    FSP_ASSERT(p_cfg->payload_bytes);
+    FSP_ASSERT(p_cfg->timeout_ms);
+    FSP_ASSERT((RM_FREERTOS_PLUS_TCP_BENCHMARK_TCP_CLIENT != p_cfg->test) || p_cfg->duration_ms);
+    FSP_ASSERT((RM_FREERTOS_PLUS_TCP_BENCHMARK_UDP_CLIENT != p_cfg->test) ||
+               (p_cfg->duration_ms && p_cfg->udp_rate_kbps));
+    FSP_ASSERT((RM_FREERTOS_PLUS_TCP_BENCHMARK_PING != p_cfg->test) || p_cfg->ping_count);
+    FSP_ASSERT(p_cfg->test <= RM_FREERTOS_PLUS_TCP_BENCHMARK_PING);
+#endif
+
+    FSP_ERROR_RETURN(p_cfg->buffer_size >= RM_FREERTOS_PLUS_TCP_BENCHMARK_BUFFER_MIN, FSP_ERR_INVALID_SIZE);
+    FSP_ERROR_RETURN(p_cfg->buffer_size >= p_cfg->payload_bytes, FSP_ERR_INVALID_SIZE);
+    FSP_ERROR_RETURN((RM_FREERTOS_PLUS_TCP_BENCHMARK_UDP_CLIENT != p_cfg->test) ||
+                     (p_cfg->payload_bytes >= RM_FREERTOS_PLUS_TCP_BENCHMARK_UDP_PAYLOAD_MIN),
+                     FSP_ERR_INVALID_SIZE);
+
+    err = R_BSP_CycleCounterSelect(p_cfg->p_cycles_get, &ctx.p_cycles_get);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+#if (ipconfigSUPPORT_OUTGOING_PINGS != 1)
+    FSP_ERROR_RETURN(RM_FREERTOS_PLUS_TCP_BENCHMARK_PING != p_cfg->test, FSP_ERR_UNSUPPORTED);
+#endif
+
+    ctx.p_cfg         = p_cfg;
+    ctx.cycles_per_us = SystemCoreClock / RM_FREERTOS_PLUS_TCP_BENCHMARK_US_PER_S;
+    ctx.last_cycles   = ctx.p_cycles_get();
+    ctx.result.test   = p_cfg->test;
+
+    rm_freertos_plus_tcp_benchmark_cpu_start(&ctx);
+
+    switch (p_cfg->test)
+    {
+        case RM_FREERTOS_PLUS_TCP_BENCHMARK_TCP_SERVER:
+        {
+            err = rm_freertos_plus_tcp_benchmark_tcp_server(&ctx);
+            break;
+        }
+
+        case RM_FREERTOS_PLUS_TCP_BENCHMARK_TCP_CLIENT:
+        {
+            err = rm_freertos_plus_tcp_benchmark_tcp_client(&ctx);
+            break;
+        }
+
+        case RM_FREERTOS_PLUS_TCP_BENCHMARK_UDP_SERVER:
+        {
+            err = rm_freertos_plus_tcp_benchmark_udp_server(&ctx);
+            break;
+        }
+
+        case RM_FREERTOS_PLUS_TCP_BENCHMARK_UDP_CLIENT:
+        {
+            err = rm_freertos_plus_tcp_benchmark_udp_client(&ctx);
+            break;
+        }
+
+        default:
+        {
+            err = rm_freertos_plus_tcp_benchmark_ping(&ctx);
+            break;
+        }
+    }
+
+    rm_freertos_plus_tcp_benchmark_cpu_stop(&ctx);
+
+    /* Sockets that could not be set up yield no measurement. */
+    FSP_ERROR_RETURN((FSP_ERR_OUT_OF_MEMORY != err) && (FSP_ERR_IN_USE != err), err);
+
+    rm_freertos_plus_tcp_benchmark_report(&ctx, err);
+
+    return err;
+}
+
+/*******************************************************************************************************************//**
+ * Formats a measurement as one row of the configuration matrix, or the column headings if p_result is NULL. Print
+ * the headings once, then one row per result, for example with FreeRTOS_printf().
+ *
+ * @return Row length as returned by R_BSP_ReportRowFormat().
+ **********************************************************************************************************************/
+int32_t RM_FREERTOS_PLUS_TCP_BenchmarkFormat (rm_freertos_plus_tcp_benchmark_result_t const * const p_result,
+                                              char * const                                          p_line,
+                                              uint32_t                                              line_size)
+{
+    int32_t written;
+
+    if (NULL == p_result)
+    {
+        return R_BSP_ReportRowFormat(p_line,
+                                     line_size,
+                                     0,
+                                     "%-6s %3s %3s %3s %4s %2s %5s %10s %8s %12s %7s %7s %6s %5s "
+                                     "%7s %6s %5s %8s %8s %8s",
+                                     "test", "err", "txd", "rxd", "txci", "zc", "nbuf", "etherbuf", "kbit/s",
+                                     "bytes", "ms", "dgrams", "lost", "ooo", "jit_us", "cpu%", "pings", "min_us",
+                                     "avg_us", "max_us");
+    }
+
+    char cpu[8] = "n/a";
+    if (RM_FREERTOS_PLUS_TCP_BENCHMARK_CPU_LOAD_UNKNOWN != p_result->cpu_load_permille)
+    {
+        (void) R_BSP_ReportRowFormat(cpu, sizeof(cpu), 0, "%u.%u", (unsigned) (p_result->cpu_load_permille / 10U),
+                                     (unsigned) (p_result->cpu_load_permille % 10U));
+    }
+
+    written = R_BSP_ReportRowFormat(p_line,
+                                    line_size,
+                                    0,
+                                    "%-6s %3d %3u %3u %4u %2u %5u 0x%08x %8u %12llu %7u %7u %6u %5u %7u %6s "
+                                    "%5u %8u %8u %8u",
+                                    g_benchmark_test_names[p_result->test], (int) p_result->status,
+                                    (unsigned) p_result->num_tx_descriptors, (unsigned) p_result->num_rx_descriptors,
+                                    (unsigned) p_result->tx_complete_interval, (unsigned) p_result->zerocopy,
+                                    (unsigned) p_result->network_buffers, (unsigned) p_result->ether_buffer_address,
+                                    (unsigned) p_result->throughput_kbps, (unsigned long long) p_result->bytes,
+                                    (unsigned) p_result->duration_ms, (unsigned) p_result->datagrams,
+                                    (unsigned) p_result->lost, (unsigned) p_result->out_of_order,
+                                    (unsigned) p_result->jitter_us, cpu, (unsigned) p_result->pings_received,
+                                    (unsigned) p_result->rtt_min_us, (unsigned) p_result->rtt_average_us,
+                                    (unsigned) p_result->rtt_max_us);
+
+    /* Ping rows end with the round trip time histogram. */
+    for (uint32_t i = 0U;
+         (RM_FREERTOS_PLUS_TCP_BENCHMARK_PING == p_result->test) && (i < RM_FREERTOS_PLUS_TCP_BENCHMARK_HISTOGRAM_BINS);
+         i++)
+    {
+        written = R_BSP_ReportRowFormat(p_line, line_size, written, "%s%u", (0U == i) ? " hist=" : "/",
+                                        (unsigned) p_result->rtt_histogram[i]);
+    }
+
+    return written;
+}
+
+#if (ipconfigSUPPORT_OUTGOING_PINGS == 1)
+
+/*******************************************************************************************************************//**
+ * Hands an echo reply to the ping test. Call it from vApplicationPingReplyHook().
+ *
+ * @param[in]  eStatus       Reply status passed to vApplicationPingReplyHook().
+ * @param[in]  usIdentifier  Sequence number passed to vApplicationPingReplyHook().
+ **********************************************************************************************************************/
+void RM_FREERTOS_PLUS_TCP_BenchmarkPingReply (ePingReplyStatus_t eStatus, uint16_t usIdentifier)
+{
+    bsp_cycle_counter_get_t p_cycles_get = gp_benchmark_ping_cycles_get;
+
+    if ((eSuccess == eStatus) && (NULL != p_cycles_get))
+    {
+        g_benchmark_ping_cycles     = p_cycles_get();
+        g_benchmark_ping_identifier = usIdentifier;
+        (void) xSemaphoreGive(gp_benchmark_ping_semaphore);
+    }
+}
+
+#endif
+
+/*******************************************************************************************************************//**
+ * @} (end addtogroup RM_FREERTOS_PLUS_TCP_BENCHMARK)
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Private Functions
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * Reads the microsecond clock of a run. The cycle counter is extended to 64 bits, so it must be read at least once
+ * per counter period (21 s at 200 MHz) while microsecond timestamps are in use.
+ **********************************************************************************************************************/
+static uint64_t rm_freertos_plus_tcp_benchmark_us_get (rm_freertos_plus_tcp_benchmark_ctx_t * p_ctx)
+{
+    uint32_t cycles = p_ctx->p_cycles_get();
+
+    p_ctx->cycles     += cycles - p_ctx->last_cycles;
+    p_ctx->last_cycles = cycles;
+
+    return p_ctx->cycles / p_ctx->cycles_per_us;
+}
+
+/*******************************************************************************************************************//**
+ * Records the idle task run time at the start of a test.
+ **********************************************************************************************************************/
+static void rm_freertos_plus_tcp_benchmark_cpu_start (rm_freertos_plus_tcp_benchmark_ctx_t * p_ctx)
+{
+#if RM_FREERTOS_PLUS_TCP_BENCHMARK_CPU_LOAD_SUPPORTED
+    p_ctx->idle_run_time  = (uint32_t) ulTaskGetIdleRunTimeCounter();
+    p_ctx->total_run_time = (uint32_t) portGET_RUN_TIME_COUNTER_VALUE();
+#else
+    FSP_PARAMETER_NOT_USED(p_ctx);
+#endif
+}
+
+/*******************************************************************************************************************//**
+ * Derives the CPU load of a test from the share of the run time that the idle task did not get.
+ **********************************************************************************************************************/
+static void rm_freertos_plus_tcp_benchmark_cpu_stop (rm_freertos_plus_tcp_benchmark_ctx_t * p_ctx)
+{
+    p_ctx->result.cpu_load_permille = RM_FREERTOS_PLUS_TCP_BENCHMARK_CPU_LOAD_UNKNOWN;
+
+#if RM_FREERTOS_PLUS_TCP_BENCHMARK_CPU_LOAD_SUPPORTED
+    uint32_t idle  = (uint32_t) ulTaskGetIdleRunTimeCounter() - p_ctx->idle_run_time;
+    uint32_t total = (uint32_t) portGET_RUN_TIME_COUNTER_VALUE() - p_ctx->total_run_time;
+
+    if (0U != total)
+    {
+        uint64_t idle_permille = ((uint64_t) idle * RM_FREERTOS_PLUS_TCP_BENCHMARK_PERMILLE) / total;
+        idle_permille = (idle_permille > RM_FREERTOS_PLUS_TCP_BENCHMARK_PERMILLE) ?
+                        RM_FREERTOS_PLUS_TCP_BENCHMARK_PERMILLE : idle_permille;
+        p_ctx->result.cpu_load_permille = RM_FREERTOS_PLUS_TCP_BENCHMARK_PERMILLE - (uint32_t) idle_permille;
+    }
+#endif
+}
+
+/*******************************************************************************************************************//**
+ * Adds the configuration matrix and the throughput to a measurement and passes it to the user callback.
+ **********************************************************************************************************************/
+static void rm_freertos_plus_tcp_benchmark_report (rm_freertos_plus_tcp_benchmark_ctx_t * p_ctx, fsp_err_t status)
+{
+    rm_freertos_plus_tcp_benchmark_result_t * p_result = &p_ctx->result;
+
+    p_result->status          = status;
+    p_result->network_buffers = ipconfigNUM_NETWORK_BUFFER_DESCRIPTORS;
+    p_result->p_context       = p_ctx->p_cfg->p_context;
+
+    if ((NULL != gp_freertos_ether) && (NULL != gp_freertos_ether->p_cfg))
+    {
+        ether_cfg_t const * p_ether_cfg = gp_freertos_ether->p_cfg;
+
+        p_result->num_tx_descriptors   = p_ether_cfg->num_tx_descriptors;
+        p_result->num_rx_descriptors   = p_ether_cfg->num_rx_descriptors;
+        p_result->tx_complete_interval = p_ether_cfg->tx_complete_interval;
+        p_result->zerocopy             = (ETHER_ZEROCOPY_ENABLE == p_ether_cfg->zerocopy);
+        p_result->ether_buffer_address = (NULL != p_ether_cfg->pp_ether_buffers) ?
+                                         (uint32_t) p_ether_cfg->pp_ether_buffers[0] : 0U;
+    }
+
+    if (0U != p_result->duration_ms)
+    {
+        p_result->throughput_kbps = (uint32_t) ((p_result->bytes * 8U) / p_result->duration_ms);
+    }
+
+    p_ctx->p_cfg->p_callback(p_result);
+}
+
+/*******************************************************************************************************************//**
+ * Fills in an IPv4 socket address.
+ **********************************************************************************************************************/
+static void rm_freertos_plus_tcp_benchmark_address_set (struct freertos_sockaddr * p_address,
+                                                        uint32_t                   ip_address,
+                                                        uint16_t                   port)
+{
+    memset(p_address, 0, sizeof(*p_address));
+    p_address->sin_len    = (uint8_t) sizeof(*p_address);
+    p_address->sin_family = FREERTOS_AF_INET;
+    p_address->sin_port   = FreeRTOS_htons((0U == port) ? RM_FREERTOS_PLUS_TCP_BENCHMARK_IPERF_PORT : port);
+    p_address->sin_addr   = ip_address;
+}
+
+/*******************************************************************************************************************//**
+ * Receives one iperf2 TCP stream. The transfer time runs from the accepted connection to the last byte received.
+ **********************************************************************************************************************/
+static fsp_err_t rm_freertos_plus_tcp_benchmark_tcp_server (rm_freertos_plus_tcp_benchmark_ctx_t * p_ctx)
+{
+    rm_freertos_plus_tcp_benchmark_cfg_t const * p_cfg = p_ctx->p_cfg;
+    struct freertos_sockaddr address;
+    socklen_t  address_length = sizeof(address);
+    TickType_t timeout        = pdMS_TO_TICKS(p_cfg->timeout_ms);
+    fsp_err_t  err            = FSP_SUCCESS;
+
+    Socket_t listener = FreeRTOS_socket(FREERTOS_AF_INET, FREERTOS_SOCK_STREAM, FREERTOS_IPPROTO_TCP);
+    FSP_ERROR_RETURN(FREERTOS_INVALID_SOCKET != listener, FSP_ERR_OUT_OF_MEMORY);
+
+    (void) FreeRTOS_setsockopt(listener, 0, FREERTOS_SO_RCVTIMEO, &timeout, sizeof(timeout));
+    rm_freertos_plus_tcp_benchmark_address_set(&address, 0U, p_cfg->port);
+
+    if (0 != FreeRTOS_bind(listener, &address, address_length))
+    {
+        err = FSP_ERR_IN_USE;
+    }
+    else
+    {
+        (void) FreeRTOS_listen(listener, 1);
+
+        Socket_t connection = FreeRTOS_accept(listener, &address, &address_length);
+        if ((NULL == connection) || (FREERTOS_INVALID_SOCKET == connection))
+        {
+            err = FSP_ERR_TIMEOUT;
+        }
+        else
+        {
+            (void) FreeRTOS_setsockopt(connection, 0, FREERTOS_SO_RCVTIMEO, &timeout, sizeof(timeout));
+
+            TickType_t start = xTaskGetTickCount();
+            TickType_t end   = start;
+
+            for ( ; ; )
+            {
+                BaseType_t received = FreeRTOS_recv(connection, p_cfg->p_buffer, p_cfg->buffer_size, 0);
+
+                if (received > 0)
+                {
+                    p_ctx->result.bytes += (uint64_t) received;
+                    end                  = xTaskGetTickCount();
+                }
+                else
+                {
+                    /* 0 is a receive timeout, a negative value the end of the connection. */
+                    err = (0 == received) ? FSP_ERR_TIMEOUT : FSP_SUCCESS;
+                    break;
+                }
+            }
+
+            p_ctx->result.duration_ms = (uint32_t) ((end - start) * portTICK_PERIOD_MS);
+
+            (void) FreeRTOS_shutdown(connection, FREERTOS_SHUT_RDWR);
+            (void) FreeRTOS_closesocket(connection);
+        }
+    }
+
+    (void) FreeRTOS_closesocket(listener);
+
+    return err;
+}
+
+/*******************************************************************************************************************//**
+ * Sends one iperf2 TCP stream for the configured time, then waits for the server to close the connection.
+ **********************************************************************************************************************/
+static fsp_err_t rm_freertos_plus_tcp_benchmark_tcp_client (rm_freertos_plus_tcp_benchmark_ctx_t * p_ctx)
+{
+    rm_freertos_plus_tcp_benchmark_cfg_t const * p_cfg = p_ctx->p_cfg;
+    struct freertos_sockaddr address;
+    TickType_t timeout  = pdMS_TO_TICKS(p_cfg->timeout_ms);
+    TickType_t duration = pdMS_TO_TICKS(p_cfg->duration_ms);
+    fsp_err_t  err      = FSP_SUCCESS;
+
+    Socket_t connection = FreeRTOS_socket(FREERTOS_AF_INET, FREERTOS_SOCK_STREAM, FREERTOS_IPPROTO_TCP);
+    FSP_ERROR_RETURN(FREERTOS_INVALID_SOCKET != connection, FSP_ERR_OUT_OF_MEMORY);
+
+    (void) FreeRTOS_setsockopt(connection, 0, FREERTOS_SO_RCVTIMEO, &timeout, sizeof(timeout));
+    (void) FreeRTOS_setsockopt(connection, 0, FREERTOS_SO_SNDTIMEO, &timeout, sizeof(timeout));
+    rm_freertos_plus_tcp_benchmark_address_set(&address, p_cfg->remote_address, p_cfg->port);
+
+    if (0 != FreeRTOS_connect(connection, &address, sizeof(address)))
+    {
+        err = FSP_ERR_TIMEOUT;
+    }
+    else
+    {
+        /* A zero iperf client header asks for a one-way test. */
+        memset(p_cfg->p_buffer, 0, p_cfg->payload_bytes);
+
+        TickType_t start = xTaskGetTickCount();
+
+        while ((xTaskGetTickCount() - start) < duration)
+        {
+            BaseType_t sent = FreeRTOS_send(connection, p_cfg->p_buffer, p_cfg->payload_bytes, 0);
+
+            if (sent <= 0)
+            {
+                /* 0 is a send timeout, a negative value the end of the connection. */
+                err = (0 == sent) ? FSP_ERR_TIMEOUT : FSP_ERR_ABORTED;
+                break;
+            }
+
+            p_ctx->result.bytes += (uint64_t) sent;
+        }
+
+        p_ctx->result.duration_ms = (uint32_t) ((xTaskGetTickCount() - start) * portTICK_PERIOD_MS);
+
+        /* Wait until the server has received everything and closes its side. */
+        (void) FreeRTOS_shutdown(connection, FREERTOS_SHUT_RDWR);
+        while (FreeRTOS_recv(connection, p_cfg->p_buffer, p_cfg->buffer_size, 0) > 0)
+        {
+            /* Discard data sent by the server. */
+        }
+    }
+
+    (void) FreeRTOS_closesocket(connection);
+
+    return err;
+}
+
+/*******************************************************************************************************************//**
+ * Receives one iperf2 UDP stream and answers its final datagram with a server report.
+ **********************************************************************************************************************/
+static fsp_err_t rm_freertos_plus_tcp_benchmark_udp_server (rm_freertos_plus_tcp_benchmark_ctx_t * p_ctx)
+{
+    rm_freertos_plus_tcp_benchmark_cfg_t const * p_cfg    = p_ctx->p_cfg;
+    rm_freertos_plus_tcp_benchmark_result_t    * p_result = &p_ctx->result;
+    struct freertos_sockaddr address;
+    socklen_t  address_length = sizeof(address);
+    TickType_t timeout        = pdMS_TO_TICKS(p_cfg->timeout_ms);
+    TickType_t start          = 0U;
+    TickType_t end            = 0U;
+    uint32_t   expected_id    = 0U;
+    int64_t    last_transit   = 0;
+    int64_t    jitter         = 0;     // Jitter in microseconds, scaled by the jitter gain
+    fsp_err_t  err            = FSP_ERR_TIMEOUT;
+
+    Socket_t socket = FreeRTOS_socket(FREERTOS_AF_INET, FREERTOS_SOCK_DGRAM, FREERTOS_IPPROTO_UDP);
+    FSP_ERROR_RETURN(FREERTOS_INVALID_SOCKET != socket, FSP_ERR_OUT_OF_MEMORY);
+
+    (void) FreeRTOS_setsockopt(socket, 0, FREERTOS_SO_RCVTIMEO, &timeout, sizeof(timeout));
+    rm_freertos_plus_tcp_benchmark_address_set(&address, 0U, p_cfg->port);
+
+    if (0 != FreeRTOS_bind(socket, &address, address_length))
+    {
+        (void) FreeRTOS_closesocket(socket);
+
+        return FSP_ERR_IN_USE;
+    }
+
+    for ( ; ; )
+    {
+        int32_t received = FreeRTOS_recvfrom(socket, p_cfg->p_buffer, p_cfg->buffer_size, 0, &address,
+                                             &address_length);
+        if (received <= 0)
+        {
+            /* The stream stopped without a final datagram, or never started. */
+            break;
+        }
+
+        if ((uint32_t) received < sizeof(rm_freertos_plus_tcp_benchmark_udp_header_t))
+        {
+            continue;
+        }
+
+        uint64_t now_us = rm_freertos_plus_tcp_benchmark_us_get(p_ctx);
+        rm_freertos_plus_tcp_benchmark_udp_header_t header;
+        memcpy(&header, p_cfg->p_buffer, sizeof(header));
+        int32_t id = (int32_t) FreeRTOS_ntohl((uint32_t) header.id);
+
+        if (0U == p_result->datagrams)
+        {
+            start = xTaskGetTickCount();
+        }
+
+        if (id < 0)
+        {
+            /* Final datagram: the client repeats it until it gets the report. */
+            p_result->duration_ms = (uint32_t) ((end - start) * portTICK_PERIOD_MS);
+            p_result->lost        = (p_result->lost > p_result->out_of_order) ?
+                                    (p_result->lost - p_result->out_of_order) : 0U;
+            rm_freertos_plus_tcp_benchmark_udp_report_send(p_ctx, socket, &address,
+                                                           (uint64_t) (jitter / RM_FREERTOS_PLUS_TCP_BENCHMARK_JITTER_GAIN));
+            err = FSP_SUCCESS;
+            break;
+        }
+
+        end = xTaskGetTickCount();
+        p_result->datagrams++;
+        p_result->bytes += (uint64_t) received;
+
+        /* RFC 1889 jitter. The clocks of the two ends are not synchronized, so only the transit time differences
+         * are meaningful. */
+        uint64_t sent_us = ((uint64_t) FreeRTOS_ntohl(header.tv_sec) * RM_FREERTOS_PLUS_TCP_BENCHMARK_US_PER_S) +
+                           FreeRTOS_ntohl(header.tv_usec);
+        int64_t transit = (int64_t) (now_us - sent_us);
+        if (p_result->datagrams > 1U)
+        {
+            int64_t delta = transit - last_transit;
+            delta   = (delta < 0) ? -delta : delta;
+            jitter += delta - (jitter / RM_FREERTOS_PLUS_TCP_BENCHMARK_JITTER_GAIN);
+        }
+
+        last_transit = transit;
+
+        if ((uint32_t) id >= expected_id)
+        {
+            p_result->lost += (uint32_t) id - expected_id;
+            expected_id     = (uint32_t) id + 1U;
+        }
+        else
+        {
+            p_result->out_of_order++;
+        }
+    }
+
+    p_result->jitter_us = (uint32_t) (jitter / RM_FREERTOS_PLUS_TCP_BENCHMARK_JITTER_GAIN);
+
+    if ((FSP_SUCCESS != err) && (0U != p_result->datagrams))
+    {
+        p_result->duration_ms = (uint32_t) ((end - start) * portTICK_PERIOD_MS);
+    }
+
+    (void) FreeRTOS_closesocket(socket);
+
+    return err;
+}
+
+/*******************************************************************************************************************//**
+ * Answers the final datagrams of an iperf2 UDP client with the server report, until the client stops repeating them.
+ **********************************************************************************************************************/
+static void rm_freertos_plus_tcp_benchmark_udp_report_send (rm_freertos_plus_tcp_benchmark_ctx_t * p_ctx,
+                                                             Socket_t                               socket,
+                                                             struct freertos_sockaddr const       * p_address,
+                                                             uint64_t                               jitter_us)
+{
+    rm_freertos_plus_tcp_benchmark_cfg_t const    * p_cfg    = p_ctx->p_cfg;
+    rm_freertos_plus_tcp_benchmark_result_t const * p_result = &p_ctx->result;
+    rm_freertos_plus_tcp_benchmark_server_report_t  report;
+    struct freertos_sockaddr address        = *p_address;
+    socklen_t                address_length = sizeof(address);
+    TickType_t               linger         = pdMS_TO_TICKS(RM_FREERTOS_PLUS_TCP_BENCHMARK_UDP_FIN_WAIT_MS);
+
+    report.flags        = (int32_t) FreeRTOS_htonl(RM_FREERTOS_PLUS_TCP_BENCHMARK_HEADER_VERSION1);
+    report.total_len1   = (int32_t) FreeRTOS_htonl((uint32_t) (p_result->bytes >> 32));
+    report.total_len2   = (int32_t) FreeRTOS_htonl((uint32_t) p_result->bytes);
+    report.stop_sec     = (int32_t) FreeRTOS_htonl(p_result->duration_ms / RM_FREERTOS_PLUS_TCP_BENCHMARK_US_PER_MS);
+    report.stop_usec    = (int32_t) FreeRTOS_htonl((p_result->duration_ms % RM_FREERTOS_PLUS_TCP_BENCHMARK_US_PER_MS) *
+                                                   RM_FREERTOS_PLUS_TCP_BENCHMARK_US_PER_MS);
+    report.error_cnt    = (int32_t) FreeRTOS_htonl(p_result->lost);
+    report.outorder_cnt = (int32_t) FreeRTOS_htonl(p_result->out_of_order);
+    report.datagrams    = (int32_t) FreeRTOS_htonl(p_result->datagrams + p_result->lost);
+    report.jitter1      = (int32_t) FreeRTOS_htonl((uint32_t) (jitter_us / RM_FREERTOS_PLUS_TCP_BENCHMARK_US_PER_S));
+    report.jitter2      = (int32_t) FreeRTOS_htonl((uint32_t) (jitter_us % RM_FREERTOS_PLUS_TCP_BENCHMARK_US_PER_S));
+
+    (void) FreeRTOS_setsockopt(socket, 0, FREERTOS_SO_RCVTIMEO, &linger, sizeof(linger));
+
+    for (uint32_t i = 0U; i < RM_FREERTOS_PLUS_TCP_BENCHMARK_UDP_FIN_RETRIES; i++)
+    {
+        /* The report follows the datagram header of the final datagram, still in the buffer. */
+        memcpy(&p_cfg->p_buffer[sizeof(rm_freertos_plus_tcp_benchmark_udp_header_t)], &report, sizeof(report));
+        (void) FreeRTOS_sendto(socket, p_cfg->p_buffer,
+                               sizeof(rm_freertos_plus_tcp_benchmark_udp_header_t) + sizeof(report), 0, &address,
+                               sizeof(address));
+
+        /* Stop once the client has gone quiet. */
+        if (FreeRTOS_recvfrom(socket, p_cfg->p_buffer, p_cfg->buffer_size, 0, &address, &address_length) <
+            (int32_t) sizeof(rm_freertos_plus_tcp_benchmark_udp_header_t))
+        {
+            break;
+        }
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Sends one iperf2 UDP stream at the configured rate and reads back the server report.
+ **********************************************************************************************************************/
+static fsp_err_t rm_freertos_plus_tcp_benchmark_udp_client (rm_freertos_plus_tcp_benchmark_ctx_t * p_ctx)
+{
+    rm_freertos_plus_tcp_benchmark_cfg_t const * p_cfg    = p_ctx->p_cfg;
+    rm_freertos_plus_tcp_benchmark_result_t    * p_result = &p_ctx->result;
+    struct freertos_sockaddr address;
+    socklen_t  address_length = sizeof(address);
+    TickType_t fin_wait       = pdMS_TO_TICKS(RM_FREERTOS_PLUS_TCP_BENCHMARK_UDP_FIN_WAIT_MS);
+    TickType_t duration       = pdMS_TO_TICKS(p_cfg->duration_ms);
+    fsp_err_t  err            = FSP_ERR_TIMEOUT;
+    rm_freertos_plus_tcp_benchmark_udp_header_t header;
+
+    /* Time between datagrams for the configured payload rate. */
+    uint64_t interval_us = ((uint64_t) p_cfg->payload_bytes * 8U * RM_FREERTOS_PLUS_TCP_BENCHMARK_US_PER_MS) /
+                           p_cfg->udp_rate_kbps;
+    uint64_t tick_us = (uint64_t) portTICK_PERIOD_MS * RM_FREERTOS_PLUS_TCP_BENCHMARK_US_PER_MS;
+
+    Socket_t socket = FreeRTOS_socket(FREERTOS_AF_INET, FREERTOS_SOCK_DGRAM, FREERTOS_IPPROTO_UDP);
+    FSP_ERROR_RETURN(FREERTOS_INVALID_SOCKET != socket, FSP_ERR_OUT_OF_MEMORY);
+
+    (void) FreeRTOS_setsockopt(socket, 0, FREERTOS_SO_RCVTIMEO, &fin_wait, sizeof(fin_wait));
+    rm_freertos_plus_tcp_benchmark_address_set(&address, p_cfg->remote_address, p_cfg->port);
+
+    /* A zero iperf client header asks for a one-way test. */
+    memset(p_cfg->p_buffer, 0, p_cfg->payload_bytes);
+
+    TickType_t start   = xTaskGetTickCount();
+    uint64_t   next_us = rm_freertos_plus_tcp_benchmark_us_get(p_ctx);
+    int32_t    id      = 0;
+
+    while ((xTaskGetTickCount() - start) < duration)
+    {
+        uint64_t now_us = rm_freertos_plus_tcp_benchmark_us_get(p_ctx);
+
+        if (now_us < next_us)
+        {
+            /* Sleep through whole ticks and yield for the rest, so the pacing does not count as CPU load. */
+            if ((next_us - now_us) >= tick_us)
+            {
+                vTaskDelay((TickType_t) ((next_us - now_us) / tick_us));
+            }
+            else
+            {
+                taskYIELD();
+            }
+
+            continue;
+        }
+
+        header.id      = (int32_t) FreeRTOS_htonl((uint32_t) id);
+        header.tv_sec  = FreeRTOS_htonl((uint32_t) (now_us / RM_FREERTOS_PLUS_TCP_BENCHMARK_US_PER_S));
+        header.tv_usec = FreeRTOS_htonl((uint32_t) (now_us % RM_FREERTOS_PLUS_TCP_BENCHMARK_US_PER_S));
+        memcpy(p_cfg->p_buffer, &header, sizeof(header));
+
+        /* 0 means that no network buffer was free. Retry the same datagram. */
+        if (FreeRTOS_sendto(socket, p_cfg->p_buffer, p_cfg->payload_bytes, 0, &address, sizeof(address)) > 0)
+        {
+            id++;
+            p_result->bytes += p_cfg->payload_bytes;
+            next_us         += interval_us;
+        }
+    }
+
+    p_result->duration_ms = (uint32_t) ((xTaskGetTickCount() - start) * portTICK_PERIOD_MS);
+    p_result->datagrams   = (uint32_t) id;
+
+    /* Repeat the final datagram until the server report arrives. */
+    for (uint32_t i = 0U; (i < RM_FREERTOS_PLUS_TCP_BENCHMARK_UDP_FIN_RETRIES) && (FSP_SUCCESS != err); i++)
+    {
+        uint64_t now_us = rm_freertos_plus_tcp_benchmark_us_get(p_ctx);
+        header.id      = (int32_t) FreeRTOS_htonl((uint32_t) -id);
+        header.tv_sec  = FreeRTOS_htonl((uint32_t) (now_us / RM_FREERTOS_PLUS_TCP_BENCHMARK_US_PER_S));
+        header.tv_usec = FreeRTOS_htonl((uint32_t) (now_us % RM_FREERTOS_PLUS_TCP_BENCHMARK_US_PER_S));
+        memcpy(p_cfg->p_buffer, &header, sizeof(header));
+        (void) FreeRTOS_sendto(socket, p_cfg->p_buffer, p_cfg->payload_bytes, 0, &address, sizeof(address));
+
+        int32_t received = FreeRTOS_recvfrom(socket, p_cfg->p_buffer, p_cfg->buffer_size, 0, &address,
+                                             &address_length);
+        if (received >= (int32_t) (sizeof(header) + sizeof(rm_freertos_plus_tcp_benchmark_server_report_t)))
+        {
+            rm_freertos_plus_tcp_benchmark_server_report_t report;
+            memcpy(&report, &p_cfg->p_buffer[sizeof(header)], sizeof(report));
+
+            if (0U != (FreeRTOS_ntohl((uint32_t) report.flags) & RM_FREERTOS_PLUS_TCP_BENCHMARK_HEADER_VERSION1))
+            {
+                p_result->lost         = FreeRTOS_ntohl((uint32_t) report.error_cnt);
+                p_result->out_of_order = FreeRTOS_ntohl((uint32_t) report.outorder_cnt);
+                p_result->jitter_us    = (FreeRTOS_ntohl((uint32_t) report.jitter1) *
+                                          RM_FREERTOS_PLUS_TCP_BENCHMARK_US_PER_S) +
+                                         FreeRTOS_ntohl((uint32_t) report.jitter2);
+                err = FSP_SUCCESS;
+            }
+        }
+    }
+
+    (void) FreeRTOS_closesocket(socket);
+
+    return err;
+}
+
+/*******************************************************************************************************************//**
+ * Measures ICMP echo round trip times. The reply time is taken in the IP task when the reply is processed.
+ **********************************************************************************************************************/
+static fsp_err_t rm_freertos_plus_tcp_benchmark_ping (rm_freertos_plus_tcp_benchmark_ctx_t * p_ctx)
+{
+#if (ipconfigSUPPORT_OUTGOING_PINGS == 1)
+    rm_freertos_plus_tcp_benchmark_cfg_t const * p_cfg    = p_ctx->p_cfg;
+    rm_freertos_plus_tcp_benchmark_result_t    * p_result = &p_ctx->result;
+    TickType_t timeout = pdMS_TO_TICKS(p_cfg->timeout_ms);
+    uint64_t   rtt_sum = 0U;
+
+    if (NULL == gp_benchmark_ping_semaphore)
+    {
+        gp_benchmark_ping_semaphore = xSemaphoreCreateBinaryStatic(&g_benchmark_ping_semaphore_memory);
+    }
+
+    gp_benchmark_ping_cycles_get = p_ctx->p_cycles_get;
+    p_result->rtt_min_us         = UINT32_MAX;
+
+    for (uint32_t i = 0U; i < p_cfg->ping_count; i++)
+    {
+        /* Drop a late reply to the previous request. */
+        (void) xSemaphoreTake(gp_benchmark_ping_semaphore, 0U);
+
+        uint32_t   start_cycles = p_ctx->p_cycles_get();
+        BaseType_t sequence     = FreeRTOS_SendPingRequest(p_cfg->remote_address, p_cfg->payload_bytes, timeout);
+
+        if (pdFAIL != sequence)
+        {
+            p_result->pings_sent++;
+
+            while (pdTRUE == xSemaphoreTake(gp_benchmark_ping_semaphore, timeout))
+            {
+                if ((uint16_t) sequence == g_benchmark_ping_identifier)
+                {
+                    uint32_t rtt_us = (g_benchmark_ping_cycles - start_cycles) / p_ctx->cycles_per_us;
+                    uint32_t bin    = 0U;
+
+                    while ((bin < (RM_FREERTOS_PLUS_TCP_BENCHMARK_HISTOGRAM_BINS - 1U)) &&
+                           (rtt_us >= (RM_FREERTOS_PLUS_TCP_BENCHMARK_HISTOGRAM_BASE_US << bin)))
+                    {
+                        bin++;
+                    }
+
+                    p_result->rtt_histogram[bin]++;
+                    p_result->pings_received++;
+                    p_result->rtt_min_us = (rtt_us < p_result->rtt_min_us) ? rtt_us : p_result->rtt_min_us;
+                    p_result->rtt_max_us = (rtt_us > p_result->rtt_max_us) ? rtt_us : p_result->rtt_max_us;
+                    rtt_sum             += rtt_us;
+                    break;
+                }
+            }
+        }
+
+        vTaskDelay(pdMS_TO_TICKS(p_cfg->ping_interval_ms));
+    }
+
+    gp_benchmark_ping_cycles_get = NULL;
+
+    if (0U == p_result->pings_received)
+    {
+        p_result->rtt_min_us = 0U;
+
+        return FSP_ERR_TIMEOUT;
+    }
+
+    p_result->rtt_average_us = (uint32_t) (rtt_sum / p_result->pings_received);
+
+    return (p_result->pings_received == p_cfg->ping_count) ? FSP_SUCCESS : FSP_ERR_TIMEOUT;
+#else
+    FSP_PARAMETER_NOT_USED(p_ctx);
+
+    return FSP_ERR_UNSUPPORTED;
+#endif
+}
@@ -0,0 +1,142 @@
+/***********************************************************************************************************************
+ * Copyright [2020] Renesas Electronics Corporation and/or its affiliates.  All Rights Reserved.
+ *
+ * This software and documentation are supplied by Renesas Electronics America Inc. and may only be used with products
+ * of Renesas Electronics Corp. and its affiliates ("Renesas").  No other uses are authorized.  Renesas products are
+ * sold pursuant to Renesas terms and conditions of sale.  Purchasers are solely responsible for the selection and use
+ * of Renesas products and Renesas assumes no liability.  No license, express or implied, to any intellectual property
+ * right is granted by Renesas. This software is protected under all applicable laws, including copyright laws. Renesas
+ * reserves the right to change or discontinue this software and/or this documentation. THE SOFTWARE AND DOCUMENTATION
+ * IS DELIVERED TO YOU "AS IS," AND RENESAS MAKES NO REPRESENTATIONS OR WARRANTIES, AND TO THE FULLEST EXTENT
+ * PERMISSIBLE UNDER APPLICABLE LAW, DISCLAIMS ALL WARRANTIES, WHETHER EXPLICITLY OR IMPLICITLY, INCLUDING WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, AND NONINFRINGEMENT, WITH RESPECT TO THE SOFTWARE OR
+ * DOCUMENTATION.  RENESAS SHALL HAVE NO LIABILITY ARISING OUT OF ANY SECURITY VULNERABILITY OR BREACH.  TO THE MAXIMUM
+ * EXTENT PERMITTED BY LAW, IN NO EVENT WILL RENESAS BE LIABLE TO YOU IN CONNECTION WITH THE SOFTWARE OR DOCUMENTATION
+ * (OR ANY PERSON OR ENTITY CLAIMING RIGHTS DERIVED FROM YOU) FOR ANY LOSS, DAMAGES, OR CLAIMS WHATSOEVER, INCLUDING,
+ * WITHOUT LIMITATION, ANY DIRECT, CONSEQUENTIAL, SPECIAL, INDIRECT, PUNITIVE, OR INCIDENTAL DAMAGES; ANY LOST PROFITS,
+ * OTHER ECONOMIC DAMAGE, PROPERTY DAMAGE, OR PERSONAL INJURY; AND EVEN IF RENESAS HAS BEEN ADVISED OF THE POSSIBILITY
+ * OF SUCH LOSS, DAMAGES, CLAIMS OR COSTS.
+ **********************************************************************************************************************/
+
+#ifndef RM_FREERTOS_PLUS_TCP_BENCHMARK_H
+#define RM_FREERTOS_PLUS_TCP_BENCHMARK_H
+
+#include "bsp_api.h"
+
+/* FreeRTOS+TCP includes. */
+#include "FreeRTOS.h"
+#include "FreeRTOS_IP.h"
+
+/** Common macro for FSP header files. There is also a corresponding FSP_FOOTER macro at the end of this file. */
+FSP_HEADER
+
+/*******************************************************************************************************************//**
+ * @addtogroup RM_FREERTOS_PLUS_TCP_BENCHMARK
+ * @{
+ **********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+
+/** Default iperf2 port, used when rm_freertos_plus_tcp_benchmark_cfg_t::port is 0. */
+#define RM_FREERTOS_PLUS_TCP_BENCHMARK_IPERF_PORT         (5001U)
+
+/** Number of round trip time histogram bins. Bin i counts round trips shorter than
+ * RM_FREERTOS_PLUS_TCP_BENCHMARK_HISTOGRAM_BASE_US << i; the last bin counts all longer round trips. */
+#define RM_FREERTOS_PLUS_TCP_BENCHMARK_HISTOGRAM_BINS     (10U)
+#define RM_FREERTOS_PLUS_TCP_BENCHMARK_HISTOGRAM_BASE_US  (100U)
+
+/**********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+
+/** Tests run by RM_FREERTOS_PLUS_TCP_BenchmarkRun(). The client and server tests interoperate with iperf 2 on a host. */
+typedef enum e_rm_freertos_plus_tcp_benchmark_test
+{
+    RM_FREERTOS_PLUS_TCP_BENCHMARK_TCP_SERVER, ///< Receive from an iperf2 TCP client: iperf -c <board>
+    RM_FREERTOS_PLUS_TCP_BENCHMARK_TCP_CLIENT, ///< Send to an iperf2 TCP server: iperf -s
+    RM_FREERTOS_PLUS_TCP_BENCHMARK_UDP_SERVER, ///< Receive from an iperf2 UDP client: iperf -u -c <board> -b <rate>
+    RM_FREERTOS_PLUS_TCP_BENCHMARK_UDP_CLIENT, ///< Send at a fixed rate to an iperf2 UDP server: iperf -u -s
+    RM_FREERTOS_PLUS_TCP_BENCHMARK_PING,       ///< ICMP echo round trip times, needs ipconfigSUPPORT_OUTGOING_PINGS
+} rm_freertos_plus_tcp_benchmark_test_t;
+
+/** Measurement of one test, together with the Ethernet configuration it was measured with. */
+typedef struct st_rm_freertos_plus_tcp_benchmark_result
+{
+    rm_freertos_plus_tcp_benchmark_test_t test; ///< Test run
+    fsp_err_t status;                          ///< FSP_SUCCESS, or the error that stopped the test early
+
+    /* Throughput tests */
+    uint64_t bytes;                            ///< Payload bytes sent or received
+    uint32_t duration_ms;                      ///< Time from the start to the end of the transfer
+    uint32_t throughput_kbps;                  ///< Payload throughput in kbit/s
+    uint32_t datagrams;                        ///< UDP datagrams sent or received
+    uint32_t lost;                             ///< UDP datagrams lost, as counted by the receiver
+    uint32_t out_of_order;                     ///< UDP datagrams received out of order, as counted by the receiver
+    uint32_t jitter_us;                        ///< UDP jitter (RFC 1889), as measured by the receiver
+
+    /* Ping test */
+    uint32_t pings_sent;                       ///< Echo requests sent
+    uint32_t pings_received;                   ///< Echo replies received in time
+    uint32_t rtt_min_us;                       ///< Shortest round trip
+    uint32_t rtt_max_us;                       ///< Longest round trip
+    uint32_t rtt_average_us;                   ///< Average round trip
+    uint32_t rtt_histogram[RM_FREERTOS_PLUS_TCP_BENCHMARK_HISTOGRAM_BINS]; ///< Round trip time histogram
+
+    /** CPU load during the test in 0.1 % units, from the idle task run time. 0xFFFFFFFF if FreeRTOS is built without
+     * configGENERATE_RUN_TIME_STATS. */
+    uint32_t cpu_load_permille;
+
+    /* Configuration matrix */
+    uint8_t      num_tx_descriptors;           ///< ether_cfg_t::num_tx_descriptors
+    uint8_t      num_rx_descriptors;           ///< ether_cfg_t::num_rx_descriptors
+    uint8_t      tx_complete_interval;         ///< ether_cfg_t::tx_complete_interval
+    bool         zerocopy;                     ///< ether_cfg_t::zerocopy is enabled
+    uint32_t     network_buffers;              ///< ipconfigNUM_NETWORK_BUFFER_DESCRIPTORS
+    uint32_t     ether_buffer_address;         ///< Address of the first EDMAC buffer, which shows its SRAM bank
+    void const * p_context;                    ///< User defined context passed in the configuration
+} rm_freertos_plus_tcp_benchmark_result_t;
+
+/** Benchmark configuration. */
+typedef struct st_rm_freertos_plus_tcp_benchmark_cfg
+{
+    rm_freertos_plus_tcp_benchmark_test_t test; ///< Test to run
+    uint32_t remote_address;                   ///< Peer IPv4 address in network byte order, for client and ping tests
+    uint16_t port;                             ///< iperf2 port, 0 for RM_FREERTOS_PLUS_TCP_BENCHMARK_IPERF_PORT
+    uint32_t duration_ms;                      ///< Client transfer time
+    uint32_t timeout_ms;                       ///< Longest wait for the peer before the test ends
+    uint32_t udp_rate_kbps;                    ///< Payload rate of the UDP client
+    uint16_t payload_bytes;                    ///< TCP send size, UDP datagram payload (at least 36) or ping size
+    uint32_t ping_count;                       ///< Echo requests sent by the ping test
+    uint32_t ping_interval_ms;                 ///< Time between echo requests
+    uint8_t * p_buffer;                        ///< Work buffer of at least payload_bytes (and 64) bytes, word aligned
+    uint32_t  buffer_size;                     ///< Size of p_buffer in bytes
+    bsp_cycle_counter_get_t p_cycles_get;      ///< Cycle counter, NULL to use the DWT cycle counter
+
+    /** Called with the measurement. */
+    void (* p_callback)(rm_freertos_plus_tcp_benchmark_result_t const * p_result);
+    void const * p_context;                    ///< Placeholder for user data, passed back in the result
+} rm_freertos_plus_tcp_benchmark_cfg_t;
+
+/**********************************************************************************************************************
+ * Public Function Prototypes
+ **********************************************************************************************************************/
+fsp_err_t RM_FREERTOS_PLUS_TCP_BenchmarkRun(rm_freertos_plus_tcp_benchmark_cfg_t const * const p_cfg);
+int32_t   RM_FREERTOS_PLUS_TCP_BenchmarkFormat(rm_freertos_plus_tcp_benchmark_result_t const * const p_result,
+                                               char * const                                          p_line,
+                                               uint32_t                                              line_size);
+
+#if (ipconfigSUPPORT_OUTGOING_PINGS == 1)
+void RM_FREERTOS_PLUS_TCP_BenchmarkPingReply(ePingReplyStatus_t eStatus, uint16_t usIdentifier);
+
+#endif
+
+/*******************************************************************************************************************//**
+ * @} (end addtogroup RM_FREERTOS_PLUS_TCP_BENCHMARK)
+ **********************************************************************************************************************/
+
+/** Common macro for FSP header files. There is also a corresponding FSP_HEADER macro at the top of this file. */
+FSP_FOOTER
+
+#endif                                 /* RM_FREERTOS_PLUS_TCP_BENCHMARK_H */
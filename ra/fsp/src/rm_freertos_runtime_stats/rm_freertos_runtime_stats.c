@@ -0,0 +1,380 @@
+/***********************************************************************************************************************
+ * Copyright [2020] Renesas Electronics Corporation and/or its affiliates.  All Rights Reserved.
+ *
+ * This software and documentation are supplied by Renesas Electronics America Inc. and may only be used with products
+ * of Renesas Electronics Corp. and its affiliates ("Renesas").  No other uses are authorized.  Renesas products are
+ * sold pursuant to Renesas terms and conditions of sale.  Purchasers are solely responsible for the selection and use
+ * of Renesas products and Renesas assumes no liability.  No license, express or implied, to any intellectual property
+ * right is granted by Renesas. This software is protected under all applicable laws, including copyright laws. Renesas
+ * reserves the right to change or discontinue this software and/or this documentation. THE SOFTWARE AND DOCUMENTATION
+ * IS DELIVERED TO YOU "AS IS," AND RENESAS MAKES NO REPRESENTATIONS OR WARRANTIES, AND TO THE FULLEST EXTENT
+ * PERMISSIBLE UNDER APPLICABLE LAW, DISCLAIMS ALL WARRANTIES, WHETHER EXPLICITLY OR IMPLICITLY, INCLUDING WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, AND NONINFRINGEMENT, WITH RESPECT TO THE SOFTWARE OR
+ * DOCUMENTATION.  RENESAS SHALL HAVE NO LIABILITY ARISING OUT OF ANY SECURITY VULNERABILITY OR BREACH.  TO THE MAXIMUM
+ * EXTENT PERMITTED BY LAW, IN NO EVENT WILL RENESAS BE LIABLE TO YOU IN CONNECTION WITH THE SOFTWARE OR DOCUMENTATION
+ * (OR ANY PERSON OR ENTITY CLAIMING RIGHTS DERIVED FROM YOU) FOR ANY LOSS, DAMAGES, OR CLAIMS WHATSOEVER, INCLUDING,
+ * WITHOUT LIMITATION, ANY DIRECT, CONSEQUENTIAL, SPECIAL, INDIRECT, PUNITIVE, OR INCIDENTAL DAMAGES; ANY LOST PROFITS,
+ * OTHER ECONOMIC DAMAGE, PROPERTY DAMAGE, OR PERSONAL INJURY; AND EVEN IF RENESAS HAS BEEN ADVISED OF THE POSSIBILITY
+ * OF SUCH LOSS, DAMAGES, CLAIMS OR COSTS.
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Includes
+ **********************************************************************************************************************/
+#include "rm_freertos_runtime_stats.h"
+
+/***********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+
+/* "RTST" in ASCII. */
+#define RM_FREERTOS_RUNTIME_STATS_OPEN        (0x52545354U)
+
+#define RM_FREERTOS_RUNTIME_STATS_PERMILLE    (1000U)
+
+/***********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Private function prototypes
+ **********************************************************************************************************************/
+static uint32_t rm_freertos_runtime_stats_permille(uint32_t part, uint32_t whole);
+static void     rm_freertos_runtime_stats_sort(TaskStatus_t * p_status, uint32_t count);
+static void     rm_freertos_runtime_stats_timer_callback(timer_callback_args_t * p_args);
+
+/***********************************************************************************************************************
+ * Private global variables
+ **********************************************************************************************************************/
+
+/** Version data structure. */
+static const fsp_version_t g_rm_freertos_runtime_stats_version =
+{
+    .api_version_minor  = RM_FREERTOS_RUNTIME_STATS_CODE_VERSION_MINOR,
+    .api_version_major  = RM_FREERTOS_RUNTIME_STATS_CODE_VERSION_MAJOR,
+    .code_version_major = RM_FREERTOS_RUNTIME_STATS_CODE_VERSION_MAJOR,
+    .code_version_minor = RM_FREERTOS_RUNTIME_STATS_CODE_VERSION_MINOR
+};
+
+/* Instance read by portGET_RUN_TIME_COUNTER_VALUE(). */
+static rm_freertos_runtime_stats_instance_ctrl_t * gp_rm_freertos_runtime_stats_ctrl = NULL;
+
+/*******************************************************************************************************************//**
+ * @addtogroup RM_FREERTOS_RUNTIME_STATS
+ * @{
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Functions
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * Opens and starts the timer that times the FreeRTOS run time statistics. Call it before vTaskStartScheduler() and
+ * set the following in FreeRTOSConfig.h:
+ *
+ * @code
+ * #define configGENERATE_RUN_TIME_STATS              1
+ * #define configUSE_TRACE_FACILITY                   1
+ * #define INCLUDE_xTaskGetIdleTaskHandle             1   // Optional, for the CPU load
+ * #define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS()
+ * #define portGET_RUN_TIME_COUNTER_VALUE()           RM_FREERTOS_RUNTIME_STATS_CounterGet()
+ * @endcode
+ *
+ * The run time counter extends the timer count with the number of cycle end interrupts, so it wraps after 2^32 counts
+ * whatever the timer period.
+ *
+ * @retval     FSP_SUCCESS                    Module is open and the timer is running.
+ * @retval     FSP_ERR_ASSERTION              An input parameter is invalid.
+ * @retval     FSP_ERR_ALREADY_OPEN           Module has already been opened with this instance of the control
+ *                                            structure.
+ * @return                                    See @ref RENESAS_ERROR_CODES or functions called by this function for
+ *                                            other possible return codes. This function calls:
+ *                                            * timer_api_t::open
+ *                                            * timer_api_t::callbackSet
+ *                                            * timer_api_t::infoGet
+ *                                            * timer_api_t::start
+ **********************************************************************************************************************/
+fsp_err_t RM_FREERTOS_RUNTIME_STATS_Open (rm_freertos_runtime_stats_instance_ctrl_t * const p_ctrl,
+                                          rm_freertos_runtime_stats_cfg_t const * const     p_cfg)
+{
+#if RM_FREERTOS_RUNTIME_STATS_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ASSERT(NULL != p_cfg);
+    FSP_ASSERT(NULL != p_cfg->p_timer);
+    FSP_ASSERT(NULL != p_cfg->p_status);
+    FSP_ASSERT(NULL != p_cfg->p_tasks);
+    FSP_ASSERT(0U != p_cfg->num_tasks);
+    FSP_ERROR_RETURN(RM_FREERTOS_RUNTIME_STATS_OPEN != p_ctrl->open, FSP_ERR_ALREADY_OPEN);
+#endif
+
+    timer_instance_t const * p_timer = p_cfg->p_timer;
+    timer_info_t             info;
+
+    fsp_err_t err = p_timer->p_api->open(p_timer->p_ctrl, p_timer->p_cfg);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+    err = p_timer->p_api->callbackSet(p_timer->p_ctrl, rm_freertos_runtime_stats_timer_callback, p_ctrl, NULL);
+    if (FSP_SUCCESS == err)
+    {
+        err = p_timer->p_api->infoGet(p_timer->p_ctrl, &info);
+    }
+
+    if (FSP_SUCCESS == err)
+    {
+        p_ctrl->p_cfg          = p_cfg;
+        p_ctrl->period_counts  = info.period_counts;
+        p_ctrl->count_down     = (TIMER_DIRECTION_DOWN == info.count_direction);
+        p_ctrl->overflows      = 0U;
+        p_ctrl->last_total     = 0U;
+        p_ctrl->last_num_tasks = 0U;
+
+        err = p_timer->p_api->start(p_timer->p_ctrl);
+    }
+
+    if (FSP_SUCCESS != err)
+    {
+        (void) p_timer->p_api->close(p_timer->p_ctrl);
+
+        return err;
+    }
+
+    p_ctrl->open                      = RM_FREERTOS_RUNTIME_STATS_OPEN;
+    gp_rm_freertos_runtime_stats_ctrl = p_ctrl;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Gets the run time counter, for portGET_RUN_TIME_COUNTER_VALUE(). FreeRTOS calls it on every context switch, possibly
+ * with the timer interrupt masked, so a cycle end that is still pending is accounted here.
+ *
+ * @return Run time counts since RM_FREERTOS_RUNTIME_STATS_Open, or 0 if the module is not open.
+ **********************************************************************************************************************/
+uint32_t RM_FREERTOS_RUNTIME_STATS_CounterGet (void)
+{
+    rm_freertos_runtime_stats_instance_ctrl_t * p_ctrl = gp_rm_freertos_runtime_stats_ctrl;
+
+    if (NULL == p_ctrl)
+    {
+        return 0U;
+    }
+
+    timer_instance_t const * p_timer = p_ctrl->p_cfg->p_timer;
+    timer_status_t           status;
+    uint32_t                 overflows;
+
+    /* Read the counter again if the cycle end interrupt ran in between. */
+    do
+    {
+        overflows = p_ctrl->overflows;
+        (void) p_timer->p_api->statusGet(p_timer->p_ctrl, &status);
+    } while (overflows != p_ctrl->overflows);
+
+    /* A period of 0 stands for 2^32 counts, for which period_counts - 1 is the maximum count as well. */
+    uint32_t counts = p_ctrl->count_down ? ((p_ctrl->period_counts - 1U) - status.counter) : status.counter;
+
+    /* A counter that wrapped while the interrupt is pending reads low. */
+    IRQn_Type irq = p_timer->p_cfg->cycle_end_irq;
+    if ((irq >= 0) && (0U != NVIC_GetPendingIRQ(irq)) && (counts < ((p_ctrl->period_counts - 1U) / 2U)))
+    {
+        overflows++;
+    }
+
+    return (overflows * p_ctrl->period_counts) + counts;
+}
+
+/*******************************************************************************************************************//**
+ * Gets the run time share, priority and stack high-water mark of every task. The load of each task, and the CPU load
+ * derived from the idle task, cover the interval since the previous call, so call it periodically, e.g. once a second
+ * from a monitor task. The tasks are identified by their task number, so tasks renumbered with vTaskSetTaskNumber()
+ * must keep unique, increasing numbers.
+ *
+ * @param[in]  p_ctrl               Pointer to the control structure.
+ * @param[out] p_usage              Summary of the interval. The tasks are written to
+ *                                  rm_freertos_runtime_stats_cfg_t::p_tasks.
+ *
+ * @retval     FSP_SUCCESS                    Usage stored.
+ * @retval     FSP_ERR_ASSERTION              An input parameter is invalid.
+ * @retval     FSP_ERR_NOT_OPEN               The instance control structure is not opened.
+ * @retval     FSP_ERR_OVERFLOW               More tasks exist than rm_freertos_runtime_stats_cfg_t::num_tasks.
+ **********************************************************************************************************************/
+fsp_err_t RM_FREERTOS_RUNTIME_STATS_TaskUsageGet (rm_freertos_runtime_stats_instance_ctrl_t * const p_ctrl,
+                                                  rm_freertos_runtime_stats_usage_t * const         p_usage)
+{
+#if RM_FREERTOS_RUNTIME_STATS_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ASSERT(NULL != p_usage);
+    FSP_ERROR_RETURN(RM_FREERTOS_RUNTIME_STATS_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+
+    rm_freertos_runtime_stats_cfg_t const * p_cfg   = p_ctrl->p_cfg;
+    rm_freertos_runtime_stats_task_t      * p_tasks = p_cfg->p_tasks;
+    TaskStatus_t * p_status = p_cfg->p_status;
+    uint32_t       total    = 0U;
+
+    /* uxTaskGetSystemState() returns 0 when the buffer cannot hold every task. */
+    uint32_t count = (uint32_t) uxTaskGetSystemState(p_status, (UBaseType_t) p_cfg->num_tasks, &total);
+    FSP_ERROR_RETURN(0U != count, FSP_ERR_OVERFLOW);
+
+    rm_freertos_runtime_stats_sort(p_status, count);
+
+    uint32_t interval = total - p_ctrl->last_total;
+    uint32_t idle     = RM_FREERTOS_RUNTIME_STATS_LOAD_UNKNOWN;
+#if INCLUDE_xTaskGetIdleTaskHandle
+    TaskHandle_t idle_task = xTaskGetIdleTaskHandle();
+#endif
+
+    /* Both lists are sorted by task number and new tasks get higher numbers than existing ones, so the entry of a task
+     * in the previous list is never before its entry in the new one, and the new list can be written in place. */
+    uint32_t prev = 0U;
+    for (uint32_t i = 0U; i < count; i++)
+    {
+        TaskStatus_t * p_task = &p_status[i];
+        uint32_t       delta  = (uint32_t) p_task->ulRunTimeCounter;
+
+        while ((prev < p_ctrl->last_num_tasks) && (p_tasks[prev].task_number < p_task->xTaskNumber))
+        {
+            prev++;
+        }
+
+        if ((prev < p_ctrl->last_num_tasks) && (p_tasks[prev].task_number == p_task->xTaskNumber) &&
+            (p_tasks[prev].task == p_task->xHandle))
+        {
+            delta -= p_tasks[prev].run_time;
+            prev++;
+        }
+
+        p_tasks[i].task                 = p_task->xHandle;
+        p_tasks[i].p_name               = p_task->pcTaskName;
+        p_tasks[i].task_number          = p_task->xTaskNumber;
+        p_tasks[i].priority             = p_task->uxCurrentPriority;
+        p_tasks[i].run_time             = (uint32_t) p_task->ulRunTimeCounter;
+        p_tasks[i].load_permille        = rm_freertos_runtime_stats_permille(delta, interval);
+        p_tasks[i].total_permille       = rm_freertos_runtime_stats_permille(p_tasks[i].run_time, total);
+        p_tasks[i].stack_free_min_bytes = (uint32_t) p_task->usStackHighWaterMark * sizeof(StackType_t);
+
+#if INCLUDE_xTaskGetIdleTaskHandle
+        if (p_task->xHandle == idle_task)
+        {
+            idle = p_tasks[i].load_permille;
+        }
+#endif
+    }
+
+    p_ctrl->last_total     = total;
+    p_ctrl->last_num_tasks = count;
+
+    p_usage->num_tasks         = count;
+    p_usage->interval_counts   = interval;
+    p_usage->cpu_load_permille = (RM_FREERTOS_RUNTIME_STATS_LOAD_UNKNOWN == idle) ?
+                                 RM_FREERTOS_RUNTIME_STATS_LOAD_UNKNOWN : (RM_FREERTOS_RUNTIME_STATS_PERMILLE - idle);
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Stops the run time counter and closes the timer. RM_FREERTOS_RUNTIME_STATS_CounterGet returns 0 afterwards.
+ *
+ * @retval     FSP_SUCCESS                    Module is closed.
+ * @retval     FSP_ERR_ASSERTION              p_ctrl is NULL.
+ * @retval     FSP_ERR_NOT_OPEN               The instance control structure is not opened.
+ **********************************************************************************************************************/
+fsp_err_t RM_FREERTOS_RUNTIME_STATS_Close (rm_freertos_runtime_stats_instance_ctrl_t * const p_ctrl)
+{
+#if RM_FREERTOS_RUNTIME_STATS_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ERROR_RETURN(RM_FREERTOS_RUNTIME_STATS_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+
+    timer_instance_t const * p_timer = p_ctrl->p_cfg->p_timer;
+
+    if (gp_rm_freertos_runtime_stats_ctrl == p_ctrl)
+    {
+        gp_rm_freertos_runtime_stats_ctrl = NULL;
+    }
+
+    (void) p_timer->p_api->close(p_timer->p_ctrl);
+
+    p_ctrl->open = 0U;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Gets the version of this module.
+ *
+ * @retval     FSP_SUCCESS                    Version stored in p_version.
+ * @retval     FSP_ERR_ASSERTION              p_version is NULL.
+ **********************************************************************************************************************/
+fsp_err_t RM_FREERTOS_RUNTIME_STATS_VersionGet (fsp_version_t * const p_version)
+{
+#if RM_FREERTOS_RUNTIME_STATS_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_version);
+#endif
+
+    p_version->version_id = g_rm_freertos_runtime_stats_version.version_id;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @} (end addtogroup RM_FREERTOS_RUNTIME_STATS)
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * Computes a share in permille, limited to 1000.
+ *
+ * @param[in]  part     Part of the whole.
+ * @param[in]  whole    Whole, 0 gives a share of 0.
+ **********************************************************************************************************************/
+static uint32_t rm_freertos_runtime_stats_permille (uint32_t part, uint32_t whole)
+{
+    if (0U == whole)
+    {
+        return 0U;
+    }
+
+    uint64_t permille = ((uint64_t) part * RM_FREERTOS_RUNTIME_STATS_PERMILLE) / whole;
+
+    return (permille > RM_FREERTOS_RUNTIME_STATS_PERMILLE) ? RM_FREERTOS_RUNTIME_STATS_PERMILLE : (uint32_t) permille;
+}
+
+/*******************************************************************************************************************//**
+ * Sorts the task states by task number. uxTaskGetSystemState() lists them by state and priority, which changes
+ * between calls. Insertion sort suits the small, usually nearly sorted lists.
+ *
+ * @param[in,out]  p_status   Task states.
+ * @param[in]      count      Number of task states.
+ **********************************************************************************************************************/
+static void rm_freertos_runtime_stats_sort (TaskStatus_t * p_status, uint32_t count)
+{
+    for (uint32_t i = 1U; i < count; i++)
+    {
+        TaskStatus_t task = p_status[i];
+        uint32_t     j    = i;
+
+        while ((j > 0U) && (p_status[j - 1U].xTaskNumber > task.xTaskNumber))
+        {
+            p_status[j] = p_status[j - 1U];
+            j--;
+        }
+
+        p_status[j] = task;
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Timer cycle end callback, extends the timer count.
+ *
+ * @param[in]  p_args   Timer callback arguments. p_context points to the control structure.
+ **********************************************************************************************************************/
+static void rm_freertos_runtime_stats_timer_callback (timer_callback_args_t * p_args)
+{
+    rm_freertos_runtime_stats_instance_ctrl_t * p_ctrl =
+        (rm_freertos_runtime_stats_instance_ctrl_t *) p_args->p_context;
+
+    if (TIMER_EVENT_CYCLE_END == p_args->event)
+    {
+        p_ctrl->overflows++;
+    }
+}
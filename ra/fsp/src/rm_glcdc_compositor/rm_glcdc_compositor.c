@@ -0,0 +1,593 @@
+/***********************************************************************************************************************
+ * Copyright [2020] Renesas Electronics Corporation and/or its affiliates.  All Rights Reserved.
+ *
+ * This software and documentation are supplied by Renesas Electronics America Inc. and may only be used with products
+ * of Renesas Electronics Corp. and its affiliates ("Renesas").  No other uses are authorized.  Renesas products are
+ * sold pursuant to Renesas terms and conditions of sale.  Purchasers are solely responsible for the selection and use
+ * of Renesas products and Renesas assumes no liability.  No license, express or implied, to any intellectual property
+ * right is granted by Renesas. This software is protected under all applicable laws, including copyright laws. Renesas
+ * reserves the right to change or discontinue this software and/or this documentation. THE SOFTWARE AND DOCUMENTATION
+ * IS DELIVERED TO YOU "AS IS," AND RENESAS MAKES NO REPRESENTATIONS OR WARRANTIES, AND TO THE FULLEST EXTENT
+ * PERMISSIBLE UNDER APPLICABLE LAW, DISCLAIMS ALL WARRANTIES, WHETHER EXPLICITLY OR IMPLICITLY, INCLUDING WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, AND NONINFRINGEMENT, WITH RESPECT TO THE SOFTWARE OR
+ * DOCUMENTATION.  RENESAS SHALL HAVE NO LIABILITY ARISING OUT OF ANY SECURITY VULNERABILITY OR BREACH.  TO THE MAXIMUM
+ * EXTENT PERMITTED BY LAW, IN NO EVENT WILL RENESAS BE LIABLE TO YOU IN CONNECTION WITH THE SOFTWARE OR DOCUMENTATION
+ * (OR ANY PERSON OR ENTITY CLAIMING RIGHTS DERIVED FROM YOU) FOR ANY LOSS, DAMAGES, OR CLAIMS WHATSOEVER, INCLUDING,
+ * WITHOUT LIMITATION, ANY DIRECT, CONSEQUENTIAL, SPECIAL, INDIRECT, PUNITIVE, OR INCIDENTAL DAMAGES; ANY LOST PROFITS,
+ * OTHER ECONOMIC DAMAGE, PROPERTY DAMAGE, OR PERSONAL INJURY; AND EVEN IF RENESAS HAS BEEN ADVISED OF THE POSSIBILITY
+ * OF SUCH LOSS, DAMAGES, CLAIMS OR COSTS.
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Includes
+ **********************************************************************************************************************/
+#include <string.h>                    // memset()
+#include "rm_glcdc_compositor.h"
+#include "rm_glcdc_compositor_cfg.h"
+
+/***********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+
+/* "GCMP" in ASCII. */
+#define RM_GLCDC_COMPOSITOR_OPEN         (0x47434D50U)
+
+/* Alpha range ramped by a GLCDC fade. */
+#define RM_GLCDC_COMPOSITOR_PRV_ALPHA_MAX    (255U)
+
+/***********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Private function prototypes
+ **********************************************************************************************************************/
+static void rm_glcdc_compositor_vblank(rm_glcdc_compositor_instance_ctrl_t * p_ctrl, display_frame_layer_t layer);
+static void rm_glcdc_compositor_layer_write(rm_glcdc_compositor_instance_ctrl_t * p_ctrl, display_frame_layer_t layer);
+static void rm_glcdc_compositor_event(rm_glcdc_compositor_instance_ctrl_t * p_ctrl,
+                                      display_frame_layer_t                 layer,
+                                      rm_glcdc_compositor_event_t           event);
+static uint8_t rm_glcdc_compositor_back(rm_glcdc_compositor_instance_ctrl_t * p_ctrl, display_frame_layer_t layer);
+
+/***********************************************************************************************************************
+ * Private global variables
+ **********************************************************************************************************************/
+
+/** Version data structure. */
+static const fsp_version_t g_rm_glcdc_compositor_version =
+{
+    .api_version_minor  = RM_GLCDC_COMPOSITOR_CODE_VERSION_MINOR,
+    .api_version_major  = RM_GLCDC_COMPOSITOR_CODE_VERSION_MAJOR,
+    .code_version_major = RM_GLCDC_COMPOSITOR_CODE_VERSION_MAJOR,
+    .code_version_minor = RM_GLCDC_COMPOSITOR_CODE_VERSION_MINOR
+};
+
+/*******************************************************************************************************************//**
+ * @addtogroup RM_GLCDC_COMPOSITOR
+ * @{
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Functions
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * Opens the compositor.
+ *
+ * The compositor keeps static content, such as a background and overlay panels, on the two GLCDC graphics layers and
+ * lets the GLCDC blend them during scanout instead of redrawing a full frame:
+ * - Content is rendered by rm_glcdc_compositor_cfg_t::p_render from RM_GLCDC_COMPOSITOR_Update only after
+ *   RM_GLCDC_COMPOSITOR_ContentInvalidate was called for the layer.
+ * - Slides (RM_GLCDC_COMPOSITOR_Move) and fades (RM_GLCDC_COMPOSITOR_Fade) only rewrite the layer settings with the
+ *   display layerChange API from the line detection interrupt. A fade is ramped by the GLCDC itself. A faded out layer
+ *   is disabled, so its buffer is no longer read.
+ *
+ * The display must be opened and started. Each layer is shown at its configured position after its content was
+ * rendered for the first time.
+ *
+ * @retval     FSP_SUCCESS                    Compositor is open.
+ * @retval     FSP_ERR_ASSERTION              An input parameter is invalid.
+ * @retval     FSP_ERR_ALREADY_OPEN           Module has already been opened with this instance of the control
+ *                                            structure.
+ **********************************************************************************************************************/
+fsp_err_t RM_GLCDC_COMPOSITOR_Open (rm_glcdc_compositor_instance_ctrl_t * const p_ctrl,
+                                    rm_glcdc_compositor_cfg_t const * const     p_cfg)
+{
+#if RM_GLCDC_COMPOSITOR_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ASSERT(NULL != p_cfg);
+    FSP_ASSERT(NULL != p_cfg->p_display);
+    FSP_ASSERT(NULL != p_cfg->p_render);
+    FSP_ERROR_RETURN(RM_GLCDC_COMPOSITOR_OPEN != p_ctrl->open, FSP_ERR_ALREADY_OPEN);
+    for (uint32_t i = 0U; i < RM_GLCDC_COMPOSITOR_LAYER_NUM; i++)
+    {
+        /* A second buffer alone is meaningless. */
+        FSP_ASSERT((NULL != p_cfg->layer[i].p_buffers[0]) || (NULL == p_cfg->layer[i].p_buffers[1]));
+    }
+#endif
+
+    p_ctrl->p_cfg = p_cfg;
+
+    memset(&p_ctrl->layer[0], 0, sizeof(p_ctrl->layer));
+    memset(&p_ctrl->statistics, 0, sizeof(p_ctrl->statistics));
+
+    for (uint32_t i = 0U; i < RM_GLCDC_COMPOSITOR_LAYER_NUM; i++)
+    {
+        rm_glcdc_compositor_layer_t * p_layer = &p_ctrl->layer[i];
+
+        p_layer->position     = p_cfg->layer[i].position;
+        p_layer->visible      = p_cfg->layer[i].visible;
+        p_layer->fade_request = DISPLAY_FADE_CONTROL_NONE;
+        p_layer->fading       = DISPLAY_FADE_CONTROL_NONE;
+
+        /* The first render also writes the layer settings. */
+        p_layer->dirty = (NULL != p_cfg->layer[i].p_buffers[0]);
+    }
+
+    p_ctrl->open = RM_GLCDC_COMPOSITOR_OPEN;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Marks the content of a layer as changed. It is rendered again by the next RM_GLCDC_COMPOSITOR_Update.
+ *
+ * @retval     FSP_SUCCESS                    Content marked.
+ * @retval     FSP_ERR_ASSERTION              An input parameter is invalid.
+ * @retval     FSP_ERR_NOT_OPEN               The instance control structure is not opened.
+ * @retval     FSP_ERR_INVALID_ARGUMENT       The layer has no content buffer.
+ **********************************************************************************************************************/
+fsp_err_t RM_GLCDC_COMPOSITOR_ContentInvalidate (rm_glcdc_compositor_instance_ctrl_t * const p_ctrl,
+                                                 display_frame_layer_t                       layer)
+{
+#if RM_GLCDC_COMPOSITOR_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ASSERT(RM_GLCDC_COMPOSITOR_LAYER_NUM > (uint32_t) layer);
+    FSP_ERROR_RETURN(RM_GLCDC_COMPOSITOR_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+    FSP_ERROR_RETURN(NULL != p_ctrl->p_cfg->layer[layer].p_buffers[0], FSP_ERR_INVALID_ARGUMENT);
+
+    p_ctrl->layer[layer].dirty = true;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Renders the content of each layer that was marked with RM_GLCDC_COMPOSITOR_ContentInvalidate. Layers without a
+ * change are not rendered. A double buffered layer is rendered into the buffer not on the display, which is swapped in
+ * at the next vertical blank. Its content cannot be rendered again until the swap is complete
+ * (RM_GLCDC_COMPOSITOR_EVENT_BUFFER_RELEASED); such a layer stays marked and is rendered by a later call.
+ *
+ * Call this function from the thread that owns the renderer, e.g. after each vertical blank callback.
+ *
+ * @retval     FSP_SUCCESS                    Changed layers are rendered or stay marked.
+ * @retval     FSP_ERR_ASSERTION              An input parameter is invalid.
+ * @retval     FSP_ERR_NOT_OPEN               The instance control structure is not opened.
+ **********************************************************************************************************************/
+fsp_err_t RM_GLCDC_COMPOSITOR_Update (rm_glcdc_compositor_instance_ctrl_t * const p_ctrl)
+{
+#if RM_GLCDC_COMPOSITOR_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ERROR_RETURN(RM_GLCDC_COMPOSITOR_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+
+    rm_glcdc_compositor_cfg_t const * p_cfg = p_ctrl->p_cfg;
+    rm_glcdc_compositor_render_args_t args;
+
+    for (uint32_t i = 0U; i < RM_GLCDC_COMPOSITOR_LAYER_NUM; i++)
+    {
+        display_frame_layer_t         layer   = (display_frame_layer_t) i;
+        rm_glcdc_compositor_layer_t * p_layer = &p_ctrl->layer[i];
+
+        /* Skip unchanged layers and layers whose buffers are both held by the display. */
+        if (!p_layer->dirty || p_layer->flip_pending || p_layer->releasing)
+        {
+            continue;
+        }
+
+        /* Clear the mark first, so a change during rendering is rendered again. */
+        p_layer->dirty = false;
+
+        args.layer     = layer;
+        args.p_buffer  = p_cfg->layer[i].p_buffers[rm_glcdc_compositor_back(p_ctrl, layer)];
+        args.p_context = p_cfg->p_context;
+        p_cfg->p_render(&args);
+
+        p_ctrl->statistics.renders[i]++;
+
+        /* Show the buffer at the next vertical blank. */
+        p_layer->flip_pending = true;
+    }
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Slides a layer from its current position to a new one. The position is advanced each vertical blank, so the layer
+ * reaches the target after the given number of frames; 0 moves it at the next vertical blank. The layer may be
+ * partially or fully outside the display, e.g. to slide a panel in from an edge. A new move replaces a slide in
+ * progress and starts where it was. A slide is paused while the layer fades.
+ *
+ * @retval     FSP_SUCCESS                    Slide started.
+ * @retval     FSP_ERR_ASSERTION              An input parameter is invalid.
+ * @retval     FSP_ERR_NOT_OPEN               The instance control structure is not opened.
+ **********************************************************************************************************************/
+fsp_err_t RM_GLCDC_COMPOSITOR_Move (rm_glcdc_compositor_instance_ctrl_t * const p_ctrl,
+                                    display_frame_layer_t                       layer,
+                                    display_coordinate_t                        target,
+                                    uint16_t                                    frames)
+{
+#if RM_GLCDC_COMPOSITOR_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ASSERT(RM_GLCDC_COMPOSITOR_LAYER_NUM > (uint32_t) layer);
+    FSP_ERROR_RETURN(RM_GLCDC_COMPOSITOR_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+
+    rm_glcdc_compositor_layer_t * p_layer = &p_ctrl->layer[layer];
+
+    /* The display interrupt advances the slide. */
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+    p_layer->move_start  = p_layer->position;
+    p_layer->move_target = target;
+    p_layer->move_frames = frames;
+    p_layer->move_frame  = 0U;
+    p_layer->move_done   = false;
+    p_layer->moving      = true;
+    FSP_CRITICAL_SECTION_EXIT;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Fades a layer in or out over about the given number of frames. The fade is started at the next vertical blank and
+ * the GLCDC ramps the alpha value itself. Fading in shows a hidden layer; a layer that has faded out is hidden and its
+ * buffer is no longer read. With 0 frames the layer is shown or hidden at the next vertical blank without a fade.
+ *
+ * The GLCDC restarts the alpha ramp whenever the layer settings are written, so slides and content swaps of the layer
+ * wait until a fade is complete.
+ *
+ * @retval     FSP_SUCCESS                    Fade requested.
+ * @retval     FSP_ERR_ASSERTION              An input parameter is invalid.
+ * @retval     FSP_ERR_NOT_OPEN               The instance control structure is not opened.
+ * @retval     FSP_ERR_INVALID_ARGUMENT       fade is not DISPLAY_FADE_CONTROL_FADEIN or DISPLAY_FADE_CONTROL_FADEOUT.
+ **********************************************************************************************************************/
+fsp_err_t RM_GLCDC_COMPOSITOR_Fade (rm_glcdc_compositor_instance_ctrl_t * const p_ctrl,
+                                    display_frame_layer_t                       layer,
+                                    display_fade_control_t                      fade,
+                                    uint16_t                                    frames)
+{
+#if RM_GLCDC_COMPOSITOR_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ASSERT(RM_GLCDC_COMPOSITOR_LAYER_NUM > (uint32_t) layer);
+    FSP_ERROR_RETURN(RM_GLCDC_COMPOSITOR_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+    FSP_ERROR_RETURN((DISPLAY_FADE_CONTROL_FADEIN == fade) || (DISPLAY_FADE_CONTROL_FADEOUT == fade),
+                     FSP_ERR_INVALID_ARGUMENT);
+
+    rm_glcdc_compositor_layer_t * p_layer = &p_ctrl->layer[layer];
+
+    /* The alpha value changes by the fade speed each frame. */
+    uint32_t speed = 0U;
+    if (0U != frames)
+    {
+        speed = (RM_GLCDC_COMPOSITOR_PRV_ALPHA_MAX + frames - 1U) / frames;
+    }
+
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+    if (0U == speed)
+    {
+        p_layer->fade_request = DISPLAY_FADE_CONTROL_NONE;
+        p_layer->visible      = (DISPLAY_FADE_CONTROL_FADEIN == fade);
+        p_layer->update       = true;
+    }
+    else
+    {
+        p_layer->fade_request = fade;
+        p_layer->fade_speed   = (uint8_t) speed;
+    }
+
+    FSP_CRITICAL_SECTION_EXIT;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Gets the compositor statistics.
+ *
+ * @retval     FSP_SUCCESS                    Statistics copied.
+ * @retval     FSP_ERR_ASSERTION              An input parameter is invalid.
+ * @retval     FSP_ERR_NOT_OPEN               The instance control structure is not opened.
+ **********************************************************************************************************************/
+fsp_err_t RM_GLCDC_COMPOSITOR_StatisticsGet (rm_glcdc_compositor_instance_ctrl_t * const p_ctrl,
+                                             rm_glcdc_compositor_statistics_t * const    p_statistics)
+{
+#if RM_GLCDC_COMPOSITOR_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ASSERT(NULL != p_statistics);
+    FSP_ERROR_RETURN(RM_GLCDC_COMPOSITOR_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+
+    /* The display interrupt updates the statistics. */
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+    *p_statistics = p_ctrl->statistics;
+    FSP_CRITICAL_SECTION_EXIT;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Closes the compositor. The layers are left on the display as they are.
+ *
+ * @retval     FSP_SUCCESS                    Compositor closed.
+ * @retval     FSP_ERR_ASSERTION              An input parameter is invalid.
+ * @retval     FSP_ERR_NOT_OPEN               The instance control structure is not opened.
+ **********************************************************************************************************************/
+fsp_err_t RM_GLCDC_COMPOSITOR_Close (rm_glcdc_compositor_instance_ctrl_t * const p_ctrl)
+{
+#if RM_GLCDC_COMPOSITOR_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ERROR_RETURN(RM_GLCDC_COMPOSITOR_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+
+    /* Stop compositing from the display interrupt. */
+    p_ctrl->open = 0U;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Returns the version of the firmware and API.
+ *
+ * @retval     FSP_SUCCESS        Function executed successfully.
+ * @retval     FSP_ERR_ASSERTION  Null Pointer.
+ **********************************************************************************************************************/
+fsp_err_t RM_GLCDC_COMPOSITOR_VersionGet (fsp_version_t * const p_version)
+{
+#if RM_GLCDC_COMPOSITOR_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_version);
+#endif
+
+    p_version->version_id = g_rm_glcdc_compositor_version.version_id;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Display callback. Set as callback of the display instance with the compositor control structure as context, or call
+ * it from the application's display callback with the same arguments.
+ *
+ * On DISPLAY_EVENT_LINE_DETECTION each layer is advanced by one frame: a running fade is checked for completion, the
+ * slide position is stepped, and rendered content, position, visibility and a requested fade are written with one
+ * layerChange call. The settings are latched by the GLCDC at the next vertical sync. If the display is still busy
+ * latching earlier settings, they are written at the following vertical blank.
+ *
+ * @param[in]  p_args   Display callback arguments. p_context must point to the compositor control structure.
+ **********************************************************************************************************************/
+void rm_glcdc_compositor_display_callback (display_callback_args_t * p_args)
+{
+    rm_glcdc_compositor_instance_ctrl_t * p_ctrl = (rm_glcdc_compositor_instance_ctrl_t *) p_args->p_context;
+
+    if ((NULL == p_ctrl) || (RM_GLCDC_COMPOSITOR_OPEN != p_ctrl->open))
+    {
+        return;
+    }
+
+    if (DISPLAY_EVENT_LINE_DETECTION == p_args->event)
+    {
+        for (uint32_t i = 0U; i < RM_GLCDC_COMPOSITOR_LAYER_NUM; i++)
+        {
+            if (NULL != p_ctrl->p_cfg->layer[i].p_buffers[0])
+            {
+                rm_glcdc_compositor_vblank(p_ctrl, (display_frame_layer_t) i);
+            }
+        }
+    }
+}
+
+/*******************************************************************************************************************//**
+ * @} (end addtogroup RM_GLCDC_COMPOSITOR)
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Private Functions
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * Advances one layer by one frame at vertical blank.
+ *
+ * @param[in]  p_ctrl   Pointer to the control structure.
+ * @param[in]  layer    Layer to advance.
+ **********************************************************************************************************************/
+static void rm_glcdc_compositor_vblank (rm_glcdc_compositor_instance_ctrl_t * p_ctrl, display_frame_layer_t layer)
+{
+    rm_glcdc_compositor_layer_t * p_layer = &p_ctrl->layer[layer];
+
+    /* The buffer replaced at the previous vertical blank is no longer scanned out. */
+    if (p_layer->releasing)
+    {
+        p_layer->releasing = false;
+        rm_glcdc_compositor_event(p_ctrl, layer, RM_GLCDC_COMPOSITOR_EVENT_BUFFER_RELEASED);
+    }
+
+    if (DISPLAY_FADE_CONTROL_NONE != p_layer->fading)
+    {
+        display_status_t status;
+        (void) p_ctrl->p_cfg->p_display->p_api->statusGet(p_ctrl->p_cfg->p_display->p_ctrl, &status);
+
+        /* Writing the layer settings would restart the alpha ramp, so leave the layer alone until it is complete. */
+        if (DISPLAY_FADE_STATUS_NOT_UNDERWAY != status.fade_status[layer])
+        {
+            return;
+        }
+
+        /* A layer that has faded out is disabled so that its buffer is no longer read. */
+        if (DISPLAY_FADE_CONTROL_FADEOUT == p_layer->fading)
+        {
+            p_layer->visible = false;
+            p_layer->update  = true;
+        }
+
+        p_layer->fading = DISPLAY_FADE_CONTROL_NONE;
+        rm_glcdc_compositor_event(p_ctrl, layer, RM_GLCDC_COMPOSITOR_EVENT_FADE_COMPLETE);
+    }
+
+    if (p_layer->moving)
+    {
+        if (p_layer->move_frame < p_layer->move_frames)
+        {
+            p_layer->move_frame++;
+        }
+
+        int32_t frame  = (int32_t) p_layer->move_frame;
+        int32_t frames = (int32_t) p_layer->move_frames;
+        if (frame == frames)
+        {
+            p_layer->position  = p_layer->move_target;
+            p_layer->moving    = false;
+            p_layer->move_done = true;
+        }
+        else
+        {
+            int32_t dx = (int32_t) p_layer->move_target.x - (int32_t) p_layer->move_start.x;
+            int32_t dy = (int32_t) p_layer->move_target.y - (int32_t) p_layer->move_start.y;
+            p_layer->position.x = (int16_t) (p_layer->move_start.x + ((dx * frame) / frames));
+            p_layer->position.y = (int16_t) (p_layer->move_start.y + ((dy * frame) / frames));
+        }
+
+        p_layer->update = true;
+    }
+
+    /* A fade in waits for the first content of the layer. */
+    bool has_content = p_layer->flip_pending || (0U != p_ctrl->statistics.renders[layer]);
+    if (p_layer->flip_pending || (DISPLAY_FADE_CONTROL_FADEOUT == p_layer->fade_request) ||
+        ((DISPLAY_FADE_CONTROL_FADEIN == p_layer->fade_request) && has_content))
+    {
+        p_layer->update = true;
+    }
+
+    if (p_layer->update)
+    {
+        rm_glcdc_compositor_layer_write(p_ctrl, layer);
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Writes the settings of one layer to the display with a single layerChange call.
+ *
+ * @param[in]  p_ctrl   Pointer to the control structure.
+ * @param[in]  layer    Layer to write.
+ **********************************************************************************************************************/
+static void rm_glcdc_compositor_layer_write (rm_glcdc_compositor_instance_ctrl_t * p_ctrl, display_frame_layer_t layer)
+{
+    rm_glcdc_compositor_layer_t * p_layer   = &p_ctrl->layer[layer];
+    display_instance_t const    * p_display = p_ctrl->p_cfg->p_display;
+    display_fade_control_t        fade      = p_layer->fade_request;
+    uint8_t front = p_layer->flip_pending ? rm_glcdc_compositor_back(p_ctrl, layer) : p_layer->front;
+    display_runtime_cfg_t runtime_cfg;
+
+    /* A layer is only shown once it has content. Fading out a hidden layer needs no fade. */
+    bool visible = (p_layer->visible || (DISPLAY_FADE_CONTROL_FADEIN == fade)) &&
+                   (p_layer->flip_pending || (0U != p_ctrl->statistics.renders[layer]));
+    if (!visible)
+    {
+        fade = DISPLAY_FADE_CONTROL_NONE;
+    }
+
+    runtime_cfg.input              = p_display->p_cfg->input[layer];
+    runtime_cfg.input.p_base       = visible ? (uint32_t *) p_ctrl->p_cfg->layer[layer].p_buffers[front] : NULL;
+    runtime_cfg.layer              = p_display->p_cfg->layer[layer];
+    runtime_cfg.layer.coordinate   = p_layer->position;
+    runtime_cfg.layer.fade_control = fade;
+    runtime_cfg.layer.fade_speed   = p_layer->fade_speed;
+
+    if (FSP_SUCCESS != p_display->p_api->layerChange(p_display->p_ctrl, &runtime_cfg, layer))
+    {
+        /* The display is still latching earlier settings. Try again at the next vertical blank. */
+        p_ctrl->statistics.layer_change_retries++;
+
+        return;
+    }
+
+    p_ctrl->statistics.layer_changes++;
+    p_layer->update = false;
+
+    if (p_layer->flip_pending)
+    {
+        p_layer->flip_pending = false;
+
+        /* With two buffers the old one is scanned out until the new address latches. */
+        if (p_layer->front != front)
+        {
+            p_layer->front     = front;
+            p_layer->releasing = visible;
+        }
+
+        if (!p_layer->releasing)
+        {
+            rm_glcdc_compositor_event(p_ctrl, layer, RM_GLCDC_COMPOSITOR_EVENT_BUFFER_RELEASED);
+        }
+    }
+
+    if ((DISPLAY_FADE_CONTROL_NONE != p_layer->fade_request) &&
+        ((DISPLAY_FADE_CONTROL_FADEIN != p_layer->fade_request) || visible))
+    {
+        p_layer->fade_request = DISPLAY_FADE_CONTROL_NONE;
+        p_layer->fading       = fade;
+        p_layer->visible      = visible;
+
+        if (DISPLAY_FADE_CONTROL_NONE == fade)
+        {
+            rm_glcdc_compositor_event(p_ctrl, layer, RM_GLCDC_COMPOSITOR_EVENT_FADE_COMPLETE);
+        }
+    }
+
+    if (p_layer->move_done)
+    {
+        p_layer->move_done = false;
+        rm_glcdc_compositor_event(p_ctrl, layer, RM_GLCDC_COMPOSITOR_EVENT_MOVE_COMPLETE);
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Calls the user callback, if configured.
+ *
+ * @param[in]  p_ctrl   Pointer to the control structure.
+ * @param[in]  layer    Layer the event is for.
+ * @param[in]  event    Event to report.
+ **********************************************************************************************************************/
+static void rm_glcdc_compositor_event (rm_glcdc_compositor_instance_ctrl_t * p_ctrl,
+                                       display_frame_layer_t                 layer,
+                                       rm_glcdc_compositor_event_t           event)
+{
+    if (NULL != p_ctrl->p_cfg->p_callback)
+    {
+        rm_glcdc_compositor_callback_args_t args;
+        args.event     = event;
+        args.layer     = layer;
+        args.p_context = p_ctrl->p_cfg->p_context;
+        p_ctrl->p_cfg->p_callback(&args);
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Selects the buffer new content of a layer is rendered into.
+ *
+ * @param[in]  p_ctrl   Pointer to the control structure.
+ * @param[in]  layer    Layer to render.
+ *
+ * @return Index of the buffer not on the display, or of the only buffer if the layer is single buffered.
+ **********************************************************************************************************************/
+static uint8_t rm_glcdc_compositor_back (rm_glcdc_compositor_instance_ctrl_t * p_ctrl, display_frame_layer_t layer)
+{
+    uint8_t back = p_ctrl->layer[layer].front;
+
+    if (NULL != p_ctrl->p_cfg->layer[layer].p_buffers[1])
+    {
+        back ^= 1U;
+    }
+
+    return back;
+}
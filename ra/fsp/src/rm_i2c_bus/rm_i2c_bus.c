@@ -0,0 +1,734 @@
+/***********************************************************************************************************************
+ * Copyright [2020] Renesas Electronics Corporation and/or its affiliates.  All Rights Reserved.
+ *
+ * This software and documentation are supplied by Renesas Electronics America Inc. and may only be used with products
+ * of Renesas Electronics Corp. and its affiliates ("Renesas").  No other uses are authorized.  Renesas products are
+ * sold pursuant to Renesas terms and conditions of sale.  Purchasers are solely responsible for the selection and use
+ * of Renesas products and Renesas assumes no liability.  No license, express or implied, to any intellectual property
+ * right is granted by Renesas. This software is protected under all applicable laws, including copyright laws. Renesas
+ * reserves the right to change or discontinue this software and/or this documentation. THE SOFTWARE AND DOCUMENTATION
+ * IS DELIVERED TO YOU "AS IS," AND RENESAS MAKES NO REPRESENTATIONS OR WARRANTIES, AND TO THE FULLEST EXTENT
+ * PERMISSIBLE UNDER APPLICABLE LAW, DISCLAIMS ALL WARRANTIES, WHETHER EXPLICITLY OR IMPLICITLY, INCLUDING WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, AND NONINFRINGEMENT, WITH RESPECT TO THE SOFTWARE OR
+ * DOCUMENTATION.  RENESAS SHALL HAVE NO LIABILITY ARISING OUT OF ANY SECURITY VULNERABILITY OR BREACH.  TO THE MAXIMUM
+ * EXTENT PERMITTED BY LAW, IN NO EVENT WILL RENESAS BE LIABLE TO YOU IN CONNECTION WITH THE SOFTWARE OR DOCUMENTATION
+ * (OR ANY PERSON OR ENTITY CLAIMING RIGHTS DERIVED FROM YOU) FOR ANY LOSS, DAMAGES, OR CLAIMS WHATSOEVER, INCLUDING,
+ * WITHOUT LIMITATION, ANY DIRECT, CONSEQUENTIAL, SPECIAL, INDIRECT, PUNITIVE, OR INCIDENTAL DAMAGES; ANY LOST PROFITS,
+ * OTHER ECONOMIC DAMAGE, PROPERTY DAMAGE, OR PERSONAL INJURY; AND EVEN IF RENESAS HAS BEEN ADVISED OF THE POSSIBILITY
+ * OF SUCH LOSS, DAMAGES, CLAIMS OR COSTS.
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Includes
+ **********************************************************************************************************************/
+#include "rm_i2c_bus.h"
+#include "rm_i2c_bus_cfg.h"
+
+/***********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+
+/* "I2CB" in ASCII. */
+#define RM_I2C_BUS_OPEN    (0x49324342U)
+
+/***********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Private function prototypes
+ **********************************************************************************************************************/
+static void      rm_i2c_bus_enqueue(rm_i2c_bus_instance_ctrl_t * p_ctrl, rm_i2c_bus_transaction_t * p_transaction,
+                                    bool front);
+static bool      rm_i2c_bus_dequeue(rm_i2c_bus_instance_ctrl_t * p_ctrl, rm_i2c_bus_transaction_t * p_transaction);
+static bool      rm_i2c_bus_merge_reserve(rm_i2c_bus_instance_ctrl_t * p_ctrl, rm_i2c_bus_transaction_t * p_transaction);
+static bool      rm_i2c_bus_next(rm_i2c_bus_instance_ctrl_t * p_ctrl);
+static fsp_err_t rm_i2c_bus_phase_start(rm_i2c_bus_instance_ctrl_t * p_ctrl, rm_i2c_bus_transaction_t * p_transaction);
+static void      rm_i2c_bus_run(rm_i2c_bus_instance_ctrl_t * p_ctrl);
+static void      rm_i2c_bus_finish(rm_i2c_bus_instance_ctrl_t * p_ctrl, fsp_err_t result);
+static void      rm_i2c_bus_notify(rm_i2c_bus_transaction_t * p_transaction, fsp_err_t result);
+void             rm_i2c_bus_callback(i2c_master_callback_args_t * p_args);
+
+/***********************************************************************************************************************
+ * Private global variables
+ **********************************************************************************************************************/
+
+/** Version data structure. */
+static const fsp_version_t g_rm_i2c_bus_version =
+{
+    .api_version_minor  = RM_I2C_BUS_CODE_VERSION_MINOR,
+    .api_version_major  = RM_I2C_BUS_CODE_VERSION_MAJOR,
+    .code_version_major = RM_I2C_BUS_CODE_VERSION_MAJOR,
+    .code_version_minor = RM_I2C_BUS_CODE_VERSION_MINOR
+};
+
+/* Source of transactions without write data, which send the address only. */
+static uint8_t g_rm_i2c_bus_no_data = 0U;
+
+/*******************************************************************************************************************//**
+ * @addtogroup RM_I2C_BUS
+ * @{
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Functions
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * Opens the bus manager and the I2C master instance it schedules.
+ *
+ * Tasks share the bus by submitting transactions to this module instead of calling the I2C driver. Transactions wait
+ * in a queue sorted by priority and run back to back from the I2C interrupt, so the bus never idles while a task
+ * waits to be scheduled. Transactions to the device that is on the bus are chained with a repeated START instead of a
+ * STOP and a new START, up to rm_i2c_bus_cfg_t::merge_max in a row, as long as no transaction of higher priority is
+ * queued.
+ *
+ * @retval     FSP_SUCCESS                    Module is open.
+ * @retval     FSP_ERR_ASSERTION              An input parameter is invalid.
+ * @retval     FSP_ERR_ALREADY_OPEN           Module has already been opened with this instance of the control
+ *                                            structure.
+ * @return                                    See @ref RENESAS_ERROR_CODES or functions called by this function for
+ *                                            other possible return codes. This function calls:
+ *                                            * i2c_master_api_t::open
+ *                                            * i2c_master_api_t::callbackSet
+ **********************************************************************************************************************/
+fsp_err_t RM_I2C_BUS_Open (rm_i2c_bus_instance_ctrl_t * const p_ctrl, rm_i2c_bus_cfg_t const * const p_cfg)
+{
+#if RM_I2C_BUS_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ASSERT(NULL != p_cfg);
+    FSP_ASSERT(NULL != p_cfg->p_i2c);
+    FSP_ERROR_RETURN(RM_I2C_BUS_OPEN != p_ctrl->open, FSP_ERR_ALREADY_OPEN);
+#endif
+
+    i2c_master_instance_t const * p_i2c = p_cfg->p_i2c;
+
+    fsp_err_t err = p_i2c->p_api->open(p_i2c->p_ctrl, p_i2c->p_cfg);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+    err = p_i2c->p_api->callbackSet(p_i2c->p_ctrl, rm_i2c_bus_callback, p_ctrl, NULL);
+    if (FSP_SUCCESS != err)
+    {
+        (void) p_i2c->p_api->close(p_i2c->p_ctrl);
+
+        return err;
+    }
+
+    p_ctrl->p_cfg     = p_cfg;
+    p_ctrl->p_head    = NULL;
+    p_ctrl->p_active  = NULL;
+    p_ctrl->p_merged  = NULL;
+    p_ctrl->restart   = false;
+    p_ctrl->merged    = 0U;
+    p_ctrl->slave     = p_i2c->p_cfg->slave;
+    p_ctrl->addr_mode = p_i2c->p_cfg->addr_mode;
+    p_ctrl->open      = RM_I2C_BUS_OPEN;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Queues a transaction and starts it if the bus is free. The transaction is done when its callback is called or when
+ * RM_I2C_BUS_TransactionWait returns. This function may be called from the callback of another transaction.
+ *
+ * @retval     FSP_SUCCESS                    Transaction queued.
+ * @retval     FSP_ERR_ASSERTION              An input parameter is invalid.
+ * @retval     FSP_ERR_NOT_OPEN               The instance control structure is not opened.
+ * @retval     FSP_ERR_IN_USE                 The transaction is already queued or on the bus.
+ **********************************************************************************************************************/
+fsp_err_t RM_I2C_BUS_TransactionSubmit (rm_i2c_bus_instance_ctrl_t * const p_ctrl,
+                                        rm_i2c_bus_transaction_t * const   p_transaction)
+{
+#if RM_I2C_BUS_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ASSERT(NULL != p_transaction);
+    FSP_ASSERT((NULL != p_transaction->p_write) || (0U == p_transaction->write_bytes));
+    FSP_ASSERT((NULL != p_transaction->p_read) || (0U == p_transaction->read_bytes));
+    FSP_ERROR_RETURN(RM_I2C_BUS_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+
+    bool in_use = (RM_I2C_BUS_STATE_QUEUED == p_transaction->state) ||
+                  (RM_I2C_BUS_STATE_ACTIVE == p_transaction->state);
+    if (!in_use)
+    {
+#if BSP_CFG_RTOS == 2
+        p_transaction->p_task = NULL;
+#endif
+        p_transaction->result = FSP_SUCCESS;
+        rm_i2c_bus_enqueue(p_ctrl, p_transaction, false);
+    }
+
+    FSP_CRITICAL_SECTION_EXIT;
+
+    FSP_ERROR_RETURN(!in_use, FSP_ERR_IN_USE);
+
+    if (rm_i2c_bus_next(p_ctrl))
+    {
+        rm_i2c_bus_run(p_ctrl);
+    }
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Waits for a submitted transaction to be done. With FreeRTOS the calling task blocks until the I2C interrupt
+ * completes the transaction; without an RTOS this function polls. Do not call it from an interrupt or a transaction
+ * callback.
+ *
+ * A transaction that is not done in time is removed from the queue, or aborted with the bus if it is already on the
+ * bus, and its callback is called with FSP_ERR_TIMEOUT.
+ *
+ * @param[in]  p_ctrl                         Pointer to the instance control structure.
+ * @param[in]  p_transaction                  Transaction passed to RM_I2C_BUS_TransactionSubmit.
+ * @param[in]  timeout_ms                     Time to wait in milliseconds, or RM_I2C_BUS_WAIT_FOREVER.
+ *
+ * @retval     FSP_SUCCESS                    Transaction completed.
+ * @retval     FSP_ERR_ASSERTION              An input parameter is invalid.
+ * @retval     FSP_ERR_NOT_OPEN               The instance control structure is not opened.
+ * @retval     FSP_ERR_NOT_ENABLED            The transaction was never submitted.
+ * @retval     FSP_ERR_TIMEOUT                The transaction did not complete in time and was cancelled.
+ * @retval     FSP_ERR_ABORTED                The slave did not acknowledge or the bus was lost.
+ * @return                                    See @ref RENESAS_ERROR_CODES or functions called by this function for
+ *                                            other possible return codes. This function calls:
+ *                                            * i2c_master_api_t::read
+ *                                            * i2c_master_api_t::write
+ *                                            * i2c_master_api_t::slaveAddressSet
+ **********************************************************************************************************************/
+fsp_err_t RM_I2C_BUS_TransactionWait (rm_i2c_bus_instance_ctrl_t * const p_ctrl,
+                                      rm_i2c_bus_transaction_t * const   p_transaction,
+                                      uint32_t                           timeout_ms)
+{
+#if RM_I2C_BUS_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ASSERT(NULL != p_transaction);
+    FSP_ERROR_RETURN(RM_I2C_BUS_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+    FSP_ERROR_RETURN(RM_I2C_BUS_STATE_IDLE != p_transaction->state, FSP_ERR_NOT_ENABLED);
+
+#if BSP_CFG_RTOS == 2
+
+    /* Register the task before checking the state; a completion that comes in between leaves a notification
+     * pending, so ulTaskNotifyTake returns at once. */
+    p_transaction->p_task = xTaskGetCurrentTaskHandle();
+
+    TickType_t const start   = xTaskGetTickCount();
+    TickType_t const timeout = (RM_I2C_BUS_WAIT_FOREVER == timeout_ms) ? portMAX_DELAY : pdMS_TO_TICKS(timeout_ms);
+    while (RM_I2C_BUS_STATE_DONE != p_transaction->state)
+    {
+        TickType_t elapsed = xTaskGetTickCount() - start;
+        if ((portMAX_DELAY != timeout) && (elapsed >= timeout))
+        {
+            break;
+        }
+
+        /* Stale notifications only cause another pass through the loop. */
+        (void) ulTaskNotifyTake(pdTRUE, (portMAX_DELAY == timeout) ? portMAX_DELAY : (timeout - elapsed));
+    }
+
+    p_transaction->p_task = NULL;
+#else
+    uint32_t remaining_us = 0U;
+    while ((RM_I2C_BUS_STATE_DONE != p_transaction->state) && ((0U != timeout_ms) || (0U != remaining_us)))
+    {
+        if (0U == remaining_us)
+        {
+            remaining_us = 1000U;
+            if (RM_I2C_BUS_WAIT_FOREVER != timeout_ms)
+            {
+                timeout_ms--;
+            }
+        }
+
+        R_BSP_SoftwareDelay(1U, BSP_DELAY_UNITS_MICROSECONDS);
+        remaining_us--;
+    }
+#endif
+
+    if (RM_I2C_BUS_STATE_DONE != p_transaction->state)
+    {
+        bool cancelled = false;
+        bool on_bus    = false;
+
+        FSP_CRITICAL_SECTION_DEFINE;
+        FSP_CRITICAL_SECTION_ENTER;
+
+        if (rm_i2c_bus_dequeue(p_ctrl, p_transaction))
+        {
+            cancelled = true;
+        }
+        else if (p_ctrl->p_merged == p_transaction)
+        {
+            /* The transaction on the bus releases the bus when it finds no chained transaction. */
+            p_ctrl->p_merged = NULL;
+            cancelled        = true;
+        }
+        else if (p_ctrl->p_active == p_transaction)
+        {
+            /* Abort with interrupts disabled so no other transaction can start on the bus in between. Late events
+             * of the aborted transfer are ignored as there is no active transaction. */
+            i2c_master_instance_t const * p_i2c = p_ctrl->p_cfg->p_i2c;
+            (void) p_i2c->p_api->abort(p_i2c->p_ctrl);
+
+            p_ctrl->p_active = NULL;
+            if (NULL != p_ctrl->p_merged)
+            {
+                rm_i2c_bus_enqueue(p_ctrl, p_ctrl->p_merged, true);
+                p_ctrl->p_merged = NULL;
+            }
+
+            p_ctrl->restart = false;
+            cancelled       = true;
+            on_bus          = true;
+        }
+        else
+        {
+            /* The transaction completed in the meantime. */
+        }
+
+        FSP_CRITICAL_SECTION_EXIT;
+
+        if (cancelled)
+        {
+            rm_i2c_bus_notify(p_transaction, FSP_ERR_TIMEOUT);
+        }
+
+        if (on_bus && rm_i2c_bus_next(p_ctrl))
+        {
+            rm_i2c_bus_run(p_ctrl);
+        }
+    }
+
+    return p_transaction->result;
+}
+
+/*******************************************************************************************************************//**
+ * Aborts the transaction on the bus, finishes all queued transactions with FSP_ERR_ABORTED and closes the I2C master
+ * instance.
+ *
+ * @retval     FSP_SUCCESS                    Module closed.
+ * @retval     FSP_ERR_ASSERTION              An input parameter is invalid.
+ * @retval     FSP_ERR_NOT_OPEN               The instance control structure is not opened.
+ **********************************************************************************************************************/
+fsp_err_t RM_I2C_BUS_Close (rm_i2c_bus_instance_ctrl_t * const p_ctrl)
+{
+#if RM_I2C_BUS_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ERROR_RETURN(RM_I2C_BUS_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+
+    i2c_master_instance_t const * p_i2c = p_ctrl->p_cfg->p_i2c;
+
+    p_ctrl->open = 0U;
+
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+
+    rm_i2c_bus_transaction_t * p_active = p_ctrl->p_active;
+    rm_i2c_bus_transaction_t * p_merged = p_ctrl->p_merged;
+    rm_i2c_bus_transaction_t * p_queue  = p_ctrl->p_head;
+    p_ctrl->p_active = NULL;
+    p_ctrl->p_merged = NULL;
+    p_ctrl->p_head   = NULL;
+
+    FSP_CRITICAL_SECTION_EXIT;
+
+    (void) p_i2c->p_api->abort(p_i2c->p_ctrl);
+    (void) p_i2c->p_api->close(p_i2c->p_ctrl);
+
+    if (NULL != p_active)
+    {
+        rm_i2c_bus_notify(p_active, FSP_ERR_ABORTED);
+    }
+
+    if (NULL != p_merged)
+    {
+        rm_i2c_bus_notify(p_merged, FSP_ERR_ABORTED);
+    }
+
+    while (NULL != p_queue)
+    {
+        rm_i2c_bus_transaction_t * p_transaction = p_queue;
+        p_queue = p_queue->p_next;
+        rm_i2c_bus_notify(p_transaction, FSP_ERR_ABORTED);
+    }
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Gets the version of this module.
+ *
+ * @retval     FSP_SUCCESS                    Version stored in p_version.
+ * @retval     FSP_ERR_ASSERTION              p_version was NULL.
+ **********************************************************************************************************************/
+fsp_err_t RM_I2C_BUS_VersionGet (fsp_version_t * const p_version)
+{
+#if RM_I2C_BUS_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_version);
+#endif
+
+    p_version->version_id = g_rm_i2c_bus_version.version_id;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @} (end addtogroup RM_I2C_BUS)
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Private Functions
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * Inserts a transaction into the queue by priority. Must be called with interrupts disabled.
+ *
+ * @param[in]  p_ctrl          Pointer to the instance control structure.
+ * @param[in]  p_transaction   Transaction to insert.
+ * @param[in]  front           Insert before the transactions of equal priority instead of after them.
+ **********************************************************************************************************************/
+static void rm_i2c_bus_enqueue (rm_i2c_bus_instance_ctrl_t * p_ctrl, rm_i2c_bus_transaction_t * p_transaction,
+                                bool front)
+{
+    rm_i2c_bus_transaction_t ** pp_link = &p_ctrl->p_head;
+
+    while ((NULL != *pp_link) &&
+           (((*pp_link)->priority < p_transaction->priority) ||
+            (!front && ((*pp_link)->priority == p_transaction->priority))))
+    {
+        pp_link = &(*pp_link)->p_next;
+    }
+
+    p_transaction->p_next = *pp_link;
+    p_transaction->state  = RM_I2C_BUS_STATE_QUEUED;
+    *pp_link              = p_transaction;
+}
+
+/*******************************************************************************************************************//**
+ * Removes a transaction from the queue. Must be called with interrupts disabled.
+ *
+ * @param[in]  p_ctrl          Pointer to the instance control structure.
+ * @param[in]  p_transaction   Transaction to remove.
+ *
+ * @retval     true            The transaction was queued and is removed.
+ * @retval     false           The transaction is not in the queue.
+ **********************************************************************************************************************/
+static bool rm_i2c_bus_dequeue (rm_i2c_bus_instance_ctrl_t * p_ctrl, rm_i2c_bus_transaction_t * p_transaction)
+{
+    rm_i2c_bus_transaction_t ** pp_link = &p_ctrl->p_head;
+
+    while ((NULL != *pp_link) && (*pp_link != p_transaction))
+    {
+        pp_link = &(*pp_link)->p_next;
+    }
+
+    if (NULL == *pp_link)
+    {
+        return false;
+    }
+
+    *pp_link              = p_transaction->p_next;
+    p_transaction->p_next = NULL;
+
+    return true;
+}
+
+/*******************************************************************************************************************//**
+ * Looks for a queued transaction to the same device to chain after the last phase of a transaction. Only the
+ * transactions at the priority of the head of the queue are considered, so chaining never delays a transaction of
+ * higher priority. The chained transaction is removed from the queue and kept in p_ctrl->p_merged.
+ *
+ * @param[in]  p_ctrl          Pointer to the instance control structure.
+ * @param[in]  p_transaction   Transaction whose last phase is about to start.
+ *
+ * @retval     true            A transaction is chained, the last phase must end with a repeated START.
+ * @retval     false           The last phase ends with a STOP condition.
+ **********************************************************************************************************************/
+static bool rm_i2c_bus_merge_reserve (rm_i2c_bus_instance_ctrl_t * p_ctrl, rm_i2c_bus_transaction_t * p_transaction)
+{
+    if (p_ctrl->merged >= p_ctrl->p_cfg->merge_max)
+    {
+        return false;
+    }
+
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+
+    rm_i2c_bus_transaction_t ** pp_link = &p_ctrl->p_head;
+    if (NULL != *pp_link)
+    {
+        uint8_t priority = (*pp_link)->priority;
+
+        while ((NULL != *pp_link) && ((*pp_link)->priority == priority) &&
+               (((*pp_link)->slave != p_transaction->slave) || ((*pp_link)->addr_mode != p_transaction->addr_mode)))
+        {
+            pp_link = &(*pp_link)->p_next;
+        }
+
+        if ((NULL != *pp_link) && ((*pp_link)->priority == priority))
+        {
+            p_ctrl->p_merged         = *pp_link;
+            *pp_link                 = p_ctrl->p_merged->p_next;
+            p_ctrl->p_merged->p_next = NULL;
+            p_ctrl->p_merged->state  = RM_I2C_BUS_STATE_ACTIVE;
+        }
+    }
+
+    FSP_CRITICAL_SECTION_EXIT;
+
+    return NULL != p_ctrl->p_merged;
+}
+
+/*******************************************************************************************************************//**
+ * Makes the head of the queue the active transaction if the bus is free.
+ *
+ * @param[in]  p_ctrl          Pointer to the instance control structure.
+ *
+ * @retval     true            A transaction became active, start it with rm_i2c_bus_run.
+ * @retval     false           The bus is busy or the queue is empty.
+ **********************************************************************************************************************/
+static bool rm_i2c_bus_next (rm_i2c_bus_instance_ctrl_t * p_ctrl)
+{
+    rm_i2c_bus_transaction_t * p_transaction = NULL;
+
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+
+    if ((NULL == p_ctrl->p_active) && (NULL != p_ctrl->p_head))
+    {
+        p_transaction             = p_ctrl->p_head;
+        p_ctrl->p_head            = p_transaction->p_next;
+        p_transaction->p_next     = NULL;
+        p_transaction->state      = RM_I2C_BUS_STATE_ACTIVE;
+        p_transaction->read_phase = (0U == p_transaction->write_bytes) && (0U != p_transaction->read_bytes);
+        p_ctrl->p_active          = p_transaction;
+        p_ctrl->merged            = 0U;
+    }
+
+    FSP_CRITICAL_SECTION_EXIT;
+
+    return NULL != p_transaction;
+}
+
+/*******************************************************************************************************************//**
+ * Starts the current phase of a transaction on the I2C driver.
+ *
+ * @param[in]  p_ctrl          Pointer to the instance control structure.
+ * @param[in]  p_transaction   Active transaction.
+ *
+ * @return     See @ref RENESAS_ERROR_CODES or functions called by this function for other possible return codes. This
+ *             function calls:
+ *             * i2c_master_api_t::slaveAddressSet
+ *             * i2c_master_api_t::read
+ *             * i2c_master_api_t::write
+ **********************************************************************************************************************/
+static fsp_err_t rm_i2c_bus_phase_start (rm_i2c_bus_instance_ctrl_t * p_ctrl, rm_i2c_bus_transaction_t * p_transaction)
+{
+    i2c_master_instance_t const * p_i2c = p_ctrl->p_cfg->p_i2c;
+    fsp_err_t                     err   = FSP_SUCCESS;
+
+    /* Chained transactions and the read phase go to the device already set, so this only runs after a STOP. */
+    if ((p_transaction->slave != p_ctrl->slave) || (p_transaction->addr_mode != p_ctrl->addr_mode))
+    {
+        err = p_i2c->p_api->slaveAddressSet(p_i2c->p_ctrl, p_transaction->slave, p_transaction->addr_mode);
+        FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+        p_ctrl->slave     = p_transaction->slave;
+        p_ctrl->addr_mode = p_transaction->addr_mode;
+    }
+
+    /* A write followed by a read keeps the bus with a repeated START. The last phase keeps it only if another
+     * transaction to the same device is chained. */
+    bool restart = !p_transaction->read_phase && (0U != p_transaction->read_bytes);
+    if (!restart)
+    {
+        restart = rm_i2c_bus_merge_reserve(p_ctrl, p_transaction);
+    }
+
+    p_ctrl->restart = restart;
+
+    if (p_transaction->read_phase)
+    {
+        err = p_i2c->p_api->read(p_i2c->p_ctrl, p_transaction->p_read, p_transaction->read_bytes, restart);
+    }
+    else
+    {
+        uint8_t * p_src = (NULL != p_transaction->p_write) ? (uint8_t *) p_transaction->p_write : &g_rm_i2c_bus_no_data;
+        err = p_i2c->p_api->write(p_i2c->p_ctrl, p_src, p_transaction->write_bytes, restart);
+    }
+
+    return err;
+}
+
+/*******************************************************************************************************************//**
+ * Starts the current phase of the active transaction. If it cannot start, the bus is released, the transaction
+ * finishes with the error and the next queued transaction is started instead.
+ *
+ * @param[in]  p_ctrl          Pointer to the instance control structure.
+ **********************************************************************************************************************/
+static void rm_i2c_bus_run (rm_i2c_bus_instance_ctrl_t * p_ctrl)
+{
+    i2c_master_instance_t const * p_i2c = p_ctrl->p_cfg->p_i2c;
+    bool                          run   = true;
+
+    while (run)
+    {
+        fsp_err_t err = rm_i2c_bus_phase_start(p_ctrl, p_ctrl->p_active);
+        if (FSP_SUCCESS == err)
+        {
+            run = false;
+        }
+        else
+        {
+            (void) p_i2c->p_api->abort(p_i2c->p_ctrl);
+            rm_i2c_bus_finish(p_ctrl, err);
+            run = rm_i2c_bus_next(p_ctrl);
+        }
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Ends the active transaction with a result. A chained transaction goes back to the front of the queue.
+ *
+ * @param[in]  p_ctrl          Pointer to the instance control structure.
+ * @param[in]  result          Result of the transaction.
+ **********************************************************************************************************************/
+static void rm_i2c_bus_finish (rm_i2c_bus_instance_ctrl_t * p_ctrl, fsp_err_t result)
+{
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+
+    rm_i2c_bus_transaction_t * p_transaction = p_ctrl->p_active;
+    p_ctrl->p_active = NULL;
+    if (NULL != p_ctrl->p_merged)
+    {
+        rm_i2c_bus_enqueue(p_ctrl, p_ctrl->p_merged, true);
+        p_ctrl->p_merged = NULL;
+    }
+
+    p_ctrl->restart = false;
+
+    FSP_CRITICAL_SECTION_EXIT;
+
+    rm_i2c_bus_notify(p_transaction, result);
+}
+
+/*******************************************************************************************************************//**
+ * Marks a transaction done and informs the submitter through the callback or the waiting task.
+ *
+ * @param[in]  p_transaction   Transaction that is done.
+ * @param[in]  result          Result of the transaction.
+ **********************************************************************************************************************/
+static void rm_i2c_bus_notify (rm_i2c_bus_transaction_t * p_transaction, fsp_err_t result)
+{
+#if BSP_CFG_RTOS == 2
+    TaskHandle_t p_task = p_transaction->p_task;
+#endif
+
+    /* The submitter may reuse the transaction as soon as the state is done. */
+    p_transaction->result = result;
+    p_transaction->state  = RM_I2C_BUS_STATE_DONE;
+
+    if (NULL != p_transaction->p_callback)
+    {
+        rm_i2c_bus_callback_args_t args;
+
+        args.p_transaction = p_transaction;
+        args.result        = result;
+        args.p_context     = p_transaction->p_context;
+        p_transaction->p_callback(&args);
+    }
+
+#if BSP_CFG_RTOS == 2
+    if (NULL != p_task)
+    {
+        if (0U != __get_IPSR())
+        {
+            BaseType_t higher_priority_task_woken = pdFALSE;
+            vTaskNotifyGiveFromISR(p_task, &higher_priority_task_woken);
+            portYIELD_FROM_ISR(higher_priority_task_woken);
+        }
+        else
+        {
+            (void) xTaskNotifyGive(p_task);
+        }
+    }
+#endif
+}
+
+/*******************************************************************************************************************//**
+ * I2C master callback. Moves the active transaction to its next phase, or finishes it and starts the chained or the
+ * next queued transaction.
+ *
+ * @param[in]  p_args          I2C master callback arguments. p_context points to the control structure.
+ **********************************************************************************************************************/
+void rm_i2c_bus_callback (i2c_master_callback_args_t * p_args)
+{
+    rm_i2c_bus_instance_ctrl_t * p_ctrl        = (rm_i2c_bus_instance_ctrl_t *) p_args->p_context;
+    rm_i2c_bus_transaction_t   * p_transaction = p_ctrl->p_active;
+
+    /* Events of a transfer aborted by a timeout or by RM_I2C_BUS_Close are ignored. */
+    if (NULL == p_transaction)
+    {
+        return;
+    }
+
+    if (I2C_MASTER_EVENT_ABORTED == p_args->event)
+    {
+        /* The driver ended the transfer with a STOP condition. A chained transaction starts over from the queue. */
+        rm_i2c_bus_finish(p_ctrl, FSP_ERR_ABORTED);
+        if (rm_i2c_bus_next(p_ctrl))
+        {
+            rm_i2c_bus_run(p_ctrl);
+        }
+    }
+    else if (!p_transaction->read_phase && (0U != p_transaction->read_bytes))
+    {
+        /* The write phase ended with a repeated START, read from the same device. */
+        p_transaction->read_phase = true;
+        rm_i2c_bus_run(p_ctrl);
+    }
+    else
+    {
+        FSP_CRITICAL_SECTION_DEFINE;
+        FSP_CRITICAL_SECTION_ENTER;
+
+        rm_i2c_bus_transaction_t * p_merged = p_ctrl->p_merged;
+        bool                       release  = p_ctrl->restart && (NULL == p_merged);
+        p_ctrl->p_merged = NULL;
+        p_ctrl->p_active = p_merged;
+        p_ctrl->restart  = false;
+        if (NULL != p_merged)
+        {
+            p_merged->read_phase = (0U == p_merged->write_bytes) && (0U != p_merged->read_bytes);
+            p_ctrl->merged++;
+        }
+
+        FSP_CRITICAL_SECTION_EXIT;
+
+        /* Start the next transfer before calling back so the bus idles as briefly as possible. */
+        if (NULL != p_merged)
+        {
+            rm_i2c_bus_run(p_ctrl);
+        }
+        else
+        {
+            if (release)
+            {
+                /* The chained transaction timed out, end the repeated START with a STOP condition. */
+                i2c_master_instance_t const * p_i2c = p_ctrl->p_cfg->p_i2c;
+                (void) p_i2c->p_api->abort(p_i2c->p_ctrl);
+            }
+
+            if (rm_i2c_bus_next(p_ctrl))
+            {
+                rm_i2c_bus_run(p_ctrl);
+            }
+        }
+
+        rm_i2c_bus_notify(p_transaction, FSP_SUCCESS);
+    }
+}
@@ -0,0 +1,443 @@
+/***********************************************************************************************************************
+ * Copyright [2020] Renesas Electronics Corporation and/or its affiliates.  All Rights Reserved.
+ *
+ * This software and documentation are supplied by Renesas Electronics America Inc. and may only be used with products
+ * of Renesas Electronics Corp. and its affiliates ("Renesas").  No other uses are authorized.  Renesas products are
+ * sold pursuant to Renesas terms and conditions of sale.  Purchasers are solely responsible for the selection and use
+ * of Renesas products and Renesas assumes no liability.  No license, express or implied, to any intellectual property
+ * right is granted by Renesas. This software is protected under all applicable laws, including copyright laws. Renesas
+ * reserves the right to change or discontinue this software and/or this documentation. THE SOFTWARE AND DOCUMENTATION
+ * IS DELIVERED TO YOU "AS IS," AND RENESAS MAKES NO REPRESENTATIONS OR WARRANTIES, AND TO THE FULLEST EXTENT
+ * PERMISSIBLE UNDER APPLICABLE LAW, DISCLAIMS ALL WARRANTIES, WHETHER EXPLICITLY OR IMPLICITLY, INCLUDING WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, AND NONINFRINGEMENT, WITH RESPECT TO THE SOFTWARE OR
+ * DOCUMENTATION.  RENESAS SHALL HAVE NO LIABILITY ARISING OUT OF ANY SECURITY VULNERABILITY OR BREACH.  TO THE MAXIMUM
+ * EXTENT PERMITTED BY LAW, IN NO EVENT WILL RENESAS BE LIABLE TO YOU IN CONNECTION WITH THE SOFTWARE OR DOCUMENTATION
+ * (OR ANY PERSON OR ENTITY CLAIMING RIGHTS DERIVED FROM YOU) FOR ANY LOSS, DAMAGES, OR CLAIMS WHATSOEVER, INCLUDING,
+ * WITHOUT LIMITATION, ANY DIRECT, CONSEQUENTIAL, SPECIAL, INDIRECT, PUNITIVE, OR INCIDENTAL DAMAGES; ANY LOST PROFITS,
+ * OTHER ECONOMIC DAMAGE, PROPERTY DAMAGE, OR PERSONAL INJURY; AND EVEN IF RENESAS HAS BEEN ADVISED OF THE POSSIBILITY
+ * OF SUCH LOSS, DAMAGES, CLAIMS OR COSTS.
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Includes
+ **********************************************************************************************************************/
+#include <string.h>
+#include "rm_irq_latency.h"
+#if (BSP_CFG_RTOS == 2)
+ #include "FreeRTOS.h"
+ #include "task.h"
+#endif
+
+/***********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+#define RM_IRQ_LATENCY_NS_PER_S        (1000000000ULL)
+#define RM_IRQ_LATENCY_NS_PER_MS       (1000000ULL)
+
+/* GTCCR index of the GTCCRA capture register. */
+#define RM_IRQ_LATENCY_GTCCRA          (0U)
+
+/***********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+
+/* State of the scenario being measured, shared with the IRQ callback. */
+typedef struct st_rm_irq_latency_ctx
+{
+    R_GPT0_Type * p_capture_reg;        // Registers of the capture GPT
+    uint64_t      capture_period;       // Capture counter period in counts
+    uint64_t      capture_hz;           // Capture counter frequency
+    uint64_t      stimulus_counts;      // Stimulus period in capture counts
+    uint32_t      num_samples;          // Samples to take
+    uint32_t      bin_ns;               // Histogram bin width
+    uint32_t      last_capture;         // Capture of the previous edge
+    bool          have_capture;         // False until the first edge, which is discarded
+    uint64_t      entry_total_ns;       // Sum of the entry latencies
+    uint64_t      callback_total_ns;    // Sum of the callback latencies
+    volatile uint32_t        samples;   // Samples taken, polled by the foreground loop
+    rm_irq_latency_result_t result;
+} rm_irq_latency_ctx_t;
+
+/***********************************************************************************************************************
+ * Private function prototypes
+ **********************************************************************************************************************/
+static void      rm_irq_latency_irq_callback(external_irq_callback_args_t * p_args);
+static void      rm_irq_latency_stats_clear(rm_irq_latency_stats_t * p_stats);
+static void      rm_irq_latency_stats_record(rm_irq_latency_stats_t * p_stats,
+                                             uint64_t               * p_total_ns,
+                                             uint32_t                 bin_ns,
+                                             uint32_t                 ns);
+static void      rm_irq_latency_stats_finish(rm_irq_latency_stats_t * p_stats, uint64_t total_ns, uint32_t samples);
+static fsp_err_t rm_irq_latency_scenario_run(rm_irq_latency_cfg_t const      * p_cfg,
+                                             rm_irq_latency_ctx_t            * p_ctx,
+                                             rm_irq_latency_scenario_t const * p_scenario);
+static void      rm_irq_latency_load_run(rm_irq_latency_scenario_t const * p_scenario);
+static uint64_t  rm_irq_latency_counts_elapsed(rm_irq_latency_ctx_t * p_ctx, uint32_t from, uint32_t to);
+
+/*******************************************************************************************************************//**
+ * @addtogroup RM_IRQ_LATENCY
+ * @{
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Functions
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * Measures the interrupt latency of an external IRQ with a GPT loopback, for each scenario in p_cfg->p_scenarios.
+ *
+ * The stimulus GPT drives an edge on the loopback pin once per period. The capture GPT latches its counter on the same
+ * edge, and the callback installed on the external IRQ reads the counter again, so the callback latency is measured
+ * by the timer hardware independently of the CPU clock. When BSP_CFG_LATENCY_MEASURE_ENABLE is set, the DWT cycles
+ * spent between FSP_CONTEXT_SAVE and the callback are subtracted to give the entry latency as well.
+ *
+ * Each scenario runs a background load in the foreground loop while the samples are taken:
+ * - FREERTOS_CRITICAL and FSP_CRITICAL hold interrupts masked for load_us, which delays the IRQ only if its priority
+ *   is masked by the section. Set the scenario ipl to compare priorities above and below the masking level.
+ * - REGISTER_PROTECT nests R_BSP_RegisterProtectDisable() load_depth deep, holds for load_us and unwinds it.
+ *
+ * Build the application with BSP_CFG_RAM_VECTOR_TABLE_ENABLE set and cleared to compare flash and RAM vectors; the
+ * setting is reported with each result. Wiring the loopback is board specific: choose a GTIOCA pin, an IRQ pin and a
+ * GTIOCA capture pin that are free on the EK header, and connect the three.
+ *
+ * The GPTs and the external IRQ must be opened by the application; the external IRQ callback is restored when this
+ * function returns. This function blocks and must not be called from an interrupt.
+ *
+ * @retval FSP_SUCCESS                  All scenarios were run. The status of each one is in its result.
+ * @retval FSP_ERR_ASSERTION            A required pointer is NULL, or num_samples or histogram_bin_ns is 0.
+ * @return See @ref RENESAS_ERROR_CODES or functions called by this function for other possible return codes.
+ *         This function calls:
+ *             * @ref timer_api_t::infoGet
+ *             * @ref timer_api_t::start
+ *             * @ref external_irq_api_t::callbackSet
+ **********************************************************************************************************************/
+fsp_err_t RM_IRQ_LATENCY_Run (rm_irq_latency_cfg_t const * const p_cfg)
+{
+    rm_irq_latency_ctx_t ctx;
+    timer_info_t         stimulus_info;
+    timer_info_t         capture_info;
+
+#if BSP_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(p_cfg);
+    FSP_ASSERT(p_cfg->p_stimulus);
+    FSP_ASSERT(p_cfg->p_capture);
+    FSP_ASSERT(p_cfg->p_irq);
+    FSP_ASSERT(p_cfg->p_scenarios);
+    FSP_ASSERT(p_cfg->p_callback);
+    FSP_ASSERT(p_cfg->num_samples > 0U);
+    FSP_ASSERT(p_cfg->histogram_bin_ns > 0U);
+#endif
+
+    fsp_err_t err = p_cfg->p_stimulus->p_api->infoGet(p_cfg->p_stimulus->p_ctrl, &stimulus_info);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+    err = p_cfg->p_capture->p_api->infoGet(p_cfg->p_capture->p_ctrl, &capture_info);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+    memset(&ctx, 0, sizeof(ctx));
+    ctx.p_capture_reg = ((gpt_instance_ctrl_t *) p_cfg->p_capture->p_ctrl)->p_reg;
+    ctx.capture_hz    = capture_info.clock_frequency;
+
+    /* A period of 2^32 counts is reported as 0. */
+    ctx.capture_period  = (0U == capture_info.period_counts) ? (1ULL << 32) : capture_info.period_counts;
+    ctx.stimulus_counts = ((uint64_t) stimulus_info.period_counts * capture_info.clock_frequency) /
+                          stimulus_info.clock_frequency;
+    ctx.num_samples = p_cfg->num_samples;
+    ctx.bin_ns      = p_cfg->histogram_bin_ns;
+
+    err = p_cfg->p_capture->p_api->start(p_cfg->p_capture->p_ctrl);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+    err = p_cfg->p_irq->p_api->callbackSet(p_cfg->p_irq->p_ctrl, rm_irq_latency_irq_callback, &ctx, NULL);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+    for (uint32_t i = 0U; i < p_cfg->num_scenarios; i++)
+    {
+        rm_irq_latency_scenario_t const * p_scenario = &p_cfg->p_scenarios[i];
+
+        ctx.result.status = rm_irq_latency_scenario_run(p_cfg, &ctx, p_scenario);
+        p_cfg->p_callback(&ctx.result);
+    }
+
+    /* Give the external IRQ back to the callback it was opened with. */
+    if (NULL != p_cfg->p_irq->p_cfg->p_callback)
+    {
+        err = p_cfg->p_irq->p_api->callbackSet(p_cfg->p_irq->p_ctrl,
+                                               p_cfg->p_irq->p_cfg->p_callback,
+                                               p_cfg->p_irq->p_cfg->p_context,
+                                               NULL);
+    }
+
+    return err;
+}
+
+/*******************************************************************************************************************//**
+ * @} (end addtogroup RM_IRQ_LATENCY)
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * Runs one scenario and fills in its result, except the status.
+ *
+ * @param[in]  p_cfg                    Harness configuration.
+ * @param[in]  p_ctx                    Harness state.
+ * @param[in]  p_scenario               Scenario to run.
+ *
+ * @retval FSP_SUCCESS                  All samples were taken.
+ * @retval FSP_ERR_UNSUPPORTED          The FreeRTOS load was requested without FreeRTOS.
+ * @retval FSP_ERR_TIMEOUT              No edge was measured for p_cfg->timeout_ms.
+ * @return See @ref RENESAS_ERROR_CODES or functions called by this function for other possible return codes.
+ **********************************************************************************************************************/
+static fsp_err_t rm_irq_latency_scenario_run (rm_irq_latency_cfg_t const      * p_cfg,
+                                              rm_irq_latency_ctx_t            * p_ctx,
+                                              rm_irq_latency_scenario_t const * p_scenario)
+{
+    external_irq_instance_t const * p_irq = p_cfg->p_irq;
+
+    p_ctx->result.p_scenario  = p_scenario;
+    p_ctx->result.samples     = 0U;
+    p_ctx->result.overruns    = 0U;
+    p_ctx->result.ram_vectors = (0 != BSP_CFG_RAM_VECTOR_TABLE_ENABLE);
+    p_ctx->result.entry_valid = (0 != BSP_CFG_LATENCY_MEASURE_ENABLE);
+    p_ctx->result.p_context   = p_cfg->p_context;
+    rm_irq_latency_stats_clear(&p_ctx->result.entry);
+    rm_irq_latency_stats_clear(&p_ctx->result.callback);
+    p_ctx->entry_total_ns    = 0U;
+    p_ctx->callback_total_ns = 0U;
+    p_ctx->have_capture      = false;
+    p_ctx->samples           = 0U;
+
+#if (BSP_CFG_RTOS != 2)
+    FSP_ERROR_RETURN(RM_IRQ_LATENCY_LOAD_FREERTOS_CRITICAL != p_scenario->load, FSP_ERR_UNSUPPORTED);
+#endif
+
+    if (RM_IRQ_LATENCY_IPL_KEEP != p_scenario->ipl)
+    {
+        NVIC_SetPriority(p_irq->p_cfg->irq, p_scenario->ipl);
+    }
+
+    fsp_err_t err = p_cfg->p_stimulus->p_api->start(p_cfg->p_stimulus->p_ctrl);
+    if (FSP_SUCCESS == err)
+    {
+        err = p_irq->p_api->enable(p_irq->p_ctrl);
+    }
+
+    /* The foreground loop tracks the time since the last sample on the capture counter, so it does not depend on
+     * the load or on a system tick. */
+    uint64_t timeout_counts = (p_cfg->timeout_ms * RM_IRQ_LATENCY_NS_PER_MS * p_ctx->capture_hz) /
+                              RM_IRQ_LATENCY_NS_PER_S;
+    uint64_t idle_counts = 0U;
+    uint32_t last_count  = p_ctx->p_capture_reg->GTCNT;
+    uint32_t last_sample = 0U;
+
+    while ((FSP_SUCCESS == err) && (p_ctx->samples < p_ctx->num_samples))
+    {
+        rm_irq_latency_load_run(p_scenario);
+
+        uint32_t count   = p_ctx->p_capture_reg->GTCNT;
+        uint32_t samples = p_ctx->samples;
+        idle_counts = (samples != last_sample) ? 0U :
+                      idle_counts + rm_irq_latency_counts_elapsed(p_ctx, last_count, count);
+        last_count  = count;
+        last_sample = samples;
+
+        if ((p_cfg->timeout_ms > 0U) && (idle_counts > timeout_counts))
+        {
+            err = FSP_ERR_TIMEOUT;
+        }
+    }
+
+    p_irq->p_api->disable(p_irq->p_ctrl);
+    p_cfg->p_stimulus->p_api->stop(p_cfg->p_stimulus->p_ctrl);
+    NVIC_SetPriority(p_irq->p_cfg->irq, p_irq->p_cfg->ipl);
+
+    p_ctx->result.samples = p_ctx->samples;
+    rm_irq_latency_stats_finish(&p_ctx->result.entry, p_ctx->entry_total_ns, p_ctx->result.samples);
+    rm_irq_latency_stats_finish(&p_ctx->result.callback, p_ctx->callback_total_ns, p_ctx->result.samples);
+
+    return err;
+}
+
+/*******************************************************************************************************************//**
+ * Runs one section of the background load, followed by the gap of the scenario.
+ *
+ * @param[in]  p_scenario               Scenario being run.
+ **********************************************************************************************************************/
+static void rm_irq_latency_load_run (rm_irq_latency_scenario_t const * p_scenario)
+{
+    switch (p_scenario->load)
+    {
+#if (BSP_CFG_RTOS == 2)
+        case RM_IRQ_LATENCY_LOAD_FREERTOS_CRITICAL:
+        {
+            taskENTER_CRITICAL();
+            R_BSP_SoftwareDelay(p_scenario->load_us, BSP_DELAY_UNITS_MICROSECONDS);
+            taskEXIT_CRITICAL();
+            break;
+        }
+#endif
+
+        case RM_IRQ_LATENCY_LOAD_FSP_CRITICAL:
+        {
+            FSP_CRITICAL_SECTION_DEFINE;
+            FSP_CRITICAL_SECTION_ENTER;
+            R_BSP_SoftwareDelay(p_scenario->load_us, BSP_DELAY_UNITS_MICROSECONDS);
+            FSP_CRITICAL_SECTION_EXIT;
+            break;
+        }
+
+        case RM_IRQ_LATENCY_LOAD_REGISTER_PROTECT:
+        {
+            for (uint32_t i = 0U; i < p_scenario->load_depth; i++)
+            {
+                R_BSP_RegisterProtectDisable(BSP_REG_PROTECT_CGC);
+            }
+
+            R_BSP_SoftwareDelay(p_scenario->load_us, BSP_DELAY_UNITS_MICROSECONDS);
+
+            for (uint32_t i = 0U; i < p_scenario->load_depth; i++)
+            {
+                R_BSP_RegisterProtectEnable(BSP_REG_PROTECT_CGC);
+            }
+
+            break;
+        }
+
+        default:
+        {
+            break;
+        }
+    }
+
+    if (p_scenario->gap_us > 0U)
+    {
+        R_BSP_SoftwareDelay(p_scenario->gap_us, BSP_DELAY_UNITS_MICROSECONDS);
+    }
+}
+
+/*******************************************************************************************************************//**
+ * External IRQ callback. Reads the timestamps first, then records the latencies of the edge.
+ *
+ * @param[in]  p_args                   Callback arguments, with the harness state as context.
+ **********************************************************************************************************************/
+static void rm_irq_latency_irq_callback (external_irq_callback_args_t * p_args)
+{
+    rm_irq_latency_ctx_t * p_ctx = (rm_irq_latency_ctx_t *) p_args->p_context;
+
+    /* GTCCRA is read first, so an edge that arrives while the counter is read cannot replace the edge serviced. */
+    uint32_t capture = p_ctx->p_capture_reg->GTCCR[RM_IRQ_LATENCY_GTCCRA];
+    uint32_t count   = p_ctx->p_capture_reg->GTCNT;
+#if BSP_CFG_LATENCY_MEASURE_ENABLE
+    uint32_t cycles = DWT->CYCCNT;
+#endif
+
+    if (p_ctx->samples >= p_ctx->num_samples)
+    {
+        return;
+    }
+
+    /* The first edge may have been pending since before the scenario started. */
+    if (!p_ctx->have_capture)
+    {
+        p_ctx->have_capture = true;
+        p_ctx->last_capture = capture;
+
+        return;
+    }
+
+    /* More than one and a half stimulus periods since the previous edge means at least one edge was not serviced. */
+    uint64_t interval = rm_irq_latency_counts_elapsed(p_ctx, p_ctx->last_capture, capture);
+    p_ctx->last_capture = capture;
+    if ((interval * 2U) > (p_ctx->stimulus_counts * 3U))
+    {
+        p_ctx->result.overruns++;
+    }
+
+    uint32_t callback_ns = (uint32_t) ((rm_irq_latency_counts_elapsed(p_ctx, capture, count) *
+                                        RM_IRQ_LATENCY_NS_PER_S) / p_ctx->capture_hz);
+    rm_irq_latency_stats_record(&p_ctx->result.callback, &p_ctx->callback_total_ns, p_ctx->bin_ns, callback_ns);
+
+#if BSP_CFG_LATENCY_MEASURE_ENABLE
+    uint32_t entry_cycles = 0U;
+    (void) R_BSP_LatencyIsrEntryGet(R_FSP_CurrentIrqGet(), &entry_cycles);
+    uint32_t isr_ns = (uint32_t) (((uint64_t) (cycles - entry_cycles) * RM_IRQ_LATENCY_NS_PER_S) / SystemCoreClock);
+    uint32_t entry_ns = (callback_ns > isr_ns) ? (callback_ns - isr_ns) : 0U;
+    rm_irq_latency_stats_record(&p_ctx->result.entry, &p_ctx->entry_total_ns, p_ctx->bin_ns, entry_ns);
+#endif
+
+    p_ctx->samples++;
+}
+
+/*******************************************************************************************************************//**
+ * Returns the number of capture counts from one counter value to a later one, across one counter wrap at most.
+ *
+ * @param[in]  p_ctx                    Harness state.
+ * @param[in]  from                     Earlier counter value.
+ * @param[in]  to                       Later counter value.
+ **********************************************************************************************************************/
+static uint64_t rm_irq_latency_counts_elapsed (rm_irq_latency_ctx_t * p_ctx, uint32_t from, uint32_t to)
+{
+    return (to >= from) ? (uint64_t) (to - from) : (p_ctx->capture_period - from) + to;
+}
+
+/*******************************************************************************************************************//**
+ * Clears a latency statistics record.
+ *
+ * @param[in]  p_stats                  Statistics to clear.
+ **********************************************************************************************************************/
+static void rm_irq_latency_stats_clear (rm_irq_latency_stats_t * p_stats)
+{
+    memset(p_stats, 0, sizeof(rm_irq_latency_stats_t));
+    p_stats->min_ns = UINT32_MAX;
+}
+
+/*******************************************************************************************************************//**
+ * Adds a latency to a statistics record.
+ *
+ * @param[in]  p_stats                  Statistics to update.
+ * @param[in]  p_total_ns               Sum of the latencies recorded.
+ * @param[in]  bin_ns                   Histogram bin width.
+ * @param[in]  ns                       Latency to record.
+ **********************************************************************************************************************/
+static void rm_irq_latency_stats_record (rm_irq_latency_stats_t * p_stats,
+                                         uint64_t               * p_total_ns,
+                                         uint32_t                 bin_ns,
+                                         uint32_t                 ns)
+{
+    uint32_t bin = ns / bin_ns;
+    if (bin >= RM_IRQ_LATENCY_HISTOGRAM_BINS)
+    {
+        bin = RM_IRQ_LATENCY_HISTOGRAM_BINS - 1U;
+    }
+
+    p_stats->histogram[bin]++;
+    *p_total_ns += ns;
+
+    if (ns < p_stats->min_ns)
+    {
+        p_stats->min_ns = ns;
+    }
+
+    if (ns > p_stats->max_ns)
+    {
+        p_stats->max_ns = ns;
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Calculates the average and jitter of a statistics record.
+ *
+ * @param[in]  p_stats                  Statistics to complete.
+ * @param[in]  total_ns                 Sum of the latencies recorded.
+ * @param[in]  samples                  Number of latencies recorded.
+ **********************************************************************************************************************/
+static void rm_irq_latency_stats_finish (rm_irq_latency_stats_t * p_stats, uint64_t total_ns, uint32_t samples)
+{
+    if ((0U == samples) || (UINT32_MAX == p_stats->min_ns))
+    {
+        p_stats->min_ns = 0U;
+
+        return;
+    }
+
+    p_stats->average_ns = (uint32_t) (total_ns / samples);
+    p_stats->jitter_ns  = p_stats->max_ns - p_stats->min_ns;
+}
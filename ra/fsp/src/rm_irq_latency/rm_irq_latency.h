@@ -0,0 +1,134 @@
+/***********************************************************************************************************************
+ * Copyright [2020] Renesas Electronics Corporation and/or its affiliates.  All Rights Reserved.
+ *
+ * This software and documentation are supplied by Renesas Electronics America Inc. and may only be used with products
+ * of Renesas Electronics Corp. and its affiliates ("Renesas").  No other uses are authorized.  Renesas products are
+ * sold pursuant to Renesas terms and conditions of sale.  Purchasers are solely responsible for the selection and use
+ * of Renesas products and Renesas assumes no liability.  No license, express or implied, to any intellectual property
+ * right is granted by Renesas. This software is protected under all applicable laws, including copyright laws. Renesas
+ * reserves the right to change or discontinue this software and/or this documentation. THE SOFTWARE AND DOCUMENTATION
+ * IS DELIVERED TO YOU "AS IS," AND RENESAS MAKES NO REPRESENTATIONS OR WARRANTIES, AND TO THE FULLEST EXTENT
+ * PERMISSIBLE UNDER APPLICABLE LAW, DISCLAIMS ALL WARRANTIES, WHETHER EXPLICITLY OR IMPLICITLY, INCLUDING WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, AND NONINFRINGEMENT, WITH RESPECT TO THE SOFTWARE OR
+ * DOCUMENTATION.  RENESAS SHALL HAVE NO LIABILITY ARISING OUT OF ANY SECURITY VULNERABILITY OR BREACH.  TO THE MAXIMUM
+ * EXTENT PERMITTED BY LAW, IN NO EVENT WILL RENESAS BE LIABLE TO YOU IN CONNECTION WITH THE SOFTWARE OR DOCUMENTATION
+ * (OR ANY PERSON OR ENTITY CLAIMING RIGHTS DERIVED FROM YOU) FOR ANY LOSS, DAMAGES, OR CLAIMS WHATSOEVER, INCLUDING,
+ * WITHOUT LIMITATION, ANY DIRECT, CONSEQUENTIAL, SPECIAL, INDIRECT, PUNITIVE, OR INCIDENTAL DAMAGES; ANY LOST PROFITS,
+ * OTHER ECONOMIC DAMAGE, PROPERTY DAMAGE, OR PERSONAL INJURY; AND EVEN IF RENESAS HAS BEEN ADVISED OF THE POSSIBILITY
+ * OF SUCH LOSS, DAMAGES, CLAIMS OR COSTS.
+ **********************************************************************************************************************/
+
+#ifndef RM_IRQ_LATENCY_H
+ #define RM_IRQ_LATENCY_H
+
+/***********************************************************************************************************************
+ * Includes
+ **********************************************************************************************************************/
+ #include "bsp_api.h"
+ #include "r_external_irq_api.h"
+ #include "r_gpt.h"
+
+/** Common macro for FSP header files. There is also a corresponding FSP_FOOTER macro at the end of this file. */
+FSP_HEADER
+
+/*******************************************************************************************************************//**
+ * @addtogroup RM_IRQ_LATENCY
+ * @{
+ **********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+
+/** Number of bins in each latency histogram. The last bin counts every latency above the range of the others. */
+ #define RM_IRQ_LATENCY_HISTOGRAM_BINS    (16U)
+
+/** Scenario ipl that keeps the priority configured for the external IRQ. */
+ #define RM_IRQ_LATENCY_IPL_KEEP          (0xFFU)
+
+/**********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+
+/** Background load run by the foreground loop while the samples are taken. */
+typedef enum e_rm_irq_latency_load
+{
+    RM_IRQ_LATENCY_LOAD_NONE,                 ///< Spin on the sample count only
+    RM_IRQ_LATENCY_LOAD_FREERTOS_CRITICAL,    ///< taskENTER_CRITICAL() sections of load_us (FreeRTOS only)
+    RM_IRQ_LATENCY_LOAD_FSP_CRITICAL,         ///< FSP_CRITICAL_SECTION_ENTER sections of load_us
+    RM_IRQ_LATENCY_LOAD_REGISTER_PROTECT,     ///< R_BSP_RegisterProtectDisable() nested load_depth deep
+} rm_irq_latency_load_t;
+
+/** One measurement run. */
+typedef struct st_rm_irq_latency_scenario
+{
+    char const          * p_name;      ///< Name reported with the result
+    rm_irq_latency_load_t load;        ///< Background load
+    uint32_t              load_us;     ///< Length of each critical section, or time held at the deepest nest
+    uint32_t              gap_us;      ///< Time between two load sections
+    uint32_t              load_depth;  ///< Nesting depth for REGISTER_PROTECT
+    uint8_t               ipl;         ///< External IRQ priority for this run, or RM_IRQ_LATENCY_IPL_KEEP
+} rm_irq_latency_scenario_t;
+
+/** Latency statistics of one measurement point, in nanoseconds. */
+typedef struct st_rm_irq_latency_stats
+{
+    uint32_t min_ns;                   ///< Shortest latency
+    uint32_t max_ns;                   ///< Longest latency
+    uint32_t average_ns;               ///< Average latency
+    uint32_t jitter_ns;                ///< Peak to peak variation, max_ns - min_ns
+    uint32_t histogram[RM_IRQ_LATENCY_HISTOGRAM_BINS]; ///< Samples per bin of histogram_bin_ns
+} rm_irq_latency_stats_t;
+
+/** Result of one scenario. */
+typedef struct st_rm_irq_latency_result
+{
+    rm_irq_latency_scenario_t const * p_scenario; ///< Scenario measured
+    fsp_err_t status;                  ///< FSP_SUCCESS, or the error that stopped the scenario
+    uint32_t  samples;                 ///< Edges measured
+    uint32_t  overruns;                ///< Stimulus edges that were not serviced before the next one
+    bool      ram_vectors;             ///< True if the vector table and ISRs run from RAM
+    bool      entry_valid;             ///< True if entry was measured (BSP_CFG_LATENCY_MEASURE_ENABLE)
+    rm_irq_latency_stats_t entry;      ///< Stimulus edge to FSP_CONTEXT_SAVE in the ISR
+    rm_irq_latency_stats_t callback;   ///< Stimulus edge to the first instruction of the callback
+    void const * p_context;            ///< User defined context passed in the configuration
+} rm_irq_latency_result_t;
+
+/** Harness configuration. The stimulus output pin must be wired to both the external IRQ pin and the capture input
+ * pin of the board. */
+typedef struct st_rm_irq_latency_cfg
+{
+    /** Opened periodic GPT driving the loopback pin with its GTIOCA output. Its period must be longer than the worst
+     * latency expected. */
+    timer_instance_t const * p_stimulus;
+
+    /** Opened free running GPT that captures the rising edge of the loopback pin in GTCCRA. */
+    timer_instance_t const * p_capture;
+
+    /** Opened external IRQ on the rising edge of the loopback pin. Its callback is replaced while the harness runs. */
+    external_irq_instance_t const * p_irq;
+
+    rm_irq_latency_scenario_t const * p_scenarios; ///< Scenarios to run in order
+    uint32_t num_scenarios;                        ///< Number of scenarios
+    uint32_t num_samples;                          ///< Edges measured per scenario
+    uint32_t histogram_bin_ns;                     ///< Width of a histogram bin
+    uint32_t timeout_ms;                           ///< Longest time without a sample before a scenario is aborted
+
+    /** Called with the result of each scenario, required. */
+    void (* p_callback)(rm_irq_latency_result_t const * p_result);
+    void const * p_context;                        ///< Placeholder for user data, passed back in each result
+} rm_irq_latency_cfg_t;
+
+/**********************************************************************************************************************
+ * Public Function Prototypes
+ **********************************************************************************************************************/
+fsp_err_t RM_IRQ_LATENCY_Run(rm_irq_latency_cfg_t const * const p_cfg);
+
+/*******************************************************************************************************************//**
+ * @} (end addtogroup RM_IRQ_LATENCY)
+ **********************************************************************************************************************/
+
+/** Common macro for FSP header files. There is also a corresponding FSP_HEADER macro at the top of this file. */
+FSP_FOOTER
+
+#endif                                 /* RM_IRQ_LATENCY_H */
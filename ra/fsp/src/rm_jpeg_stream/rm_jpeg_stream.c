@@ -0,0 +1,673 @@
+/***********************************************************************************************************************
+ * Copyright [2020] Renesas Electronics Corporation and/or its affiliates.  All Rights Reserved.
+ *
+ * This software and documentation are supplied by Renesas Electronics America Inc. and may only be used with products
+ * of Renesas Electronics Corp. and its affiliates ("Renesas").  No other uses are authorized.  Renesas products are
+ * sold pursuant to Renesas terms and conditions of sale.  Purchasers are solely responsible for the selection and use
+ * of Renesas products and Renesas assumes no liability.  No license, express or implied, to any intellectual property
+ * right is granted by Renesas. This software is protected under all applicable laws, including copyright laws. Renesas
+ * reserves the right to change or discontinue this software and/or this documentation. THE SOFTWARE AND DOCUMENTATION
+ * IS DELIVERED TO YOU "AS IS," AND RENESAS MAKES NO REPRESENTATIONS OR WARRANTIES, AND TO THE FULLEST EXTENT
+ * PERMISSIBLE UNDER APPLICABLE LAW, DISCLAIMS ALL WARRANTIES, WHETHER EXPLICITLY OR IMPLICITLY, INCLUDING WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, AND NONINFRINGEMENT, WITH RESPECT TO THE SOFTWARE OR
+ * DOCUMENTATION.  RENESAS SHALL HAVE NO LIABILITY ARISING OUT OF ANY SECURITY VULNERABILITY OR BREACH.  TO THE MAXIMUM
+ * EXTENT PERMITTED BY LAW, IN NO EVENT WILL RENESAS BE LIABLE TO YOU IN CONNECTION WITH THE SOFTWARE OR DOCUMENTATION
+ * (OR ANY PERSON OR ENTITY CLAIMING RIGHTS DERIVED FROM YOU) FOR ANY LOSS, DAMAGES, OR CLAIMS WHATSOEVER, INCLUDING,
+ * WITHOUT LIMITATION, ANY DIRECT, CONSEQUENTIAL, SPECIAL, INDIRECT, PUNITIVE, OR INCIDENTAL DAMAGES; ANY LOST PROFITS,
+ * OTHER ECONOMIC DAMAGE, PROPERTY DAMAGE, OR PERSONAL INJURY; AND EVEN IF RENESAS HAS BEEN ADVISED OF THE POSSIBILITY
+ * OF SUCH LOSS, DAMAGES, CLAIMS OR COSTS.
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Includes
+ **********************************************************************************************************************/
+#include <string.h>                    // memset()
+#include "rm_jpeg_stream.h"
+#include "rm_jpeg_stream_cfg.h"
+
+/***********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+
+/* "JPGS" in ASCII. */
+#define RM_JPEG_STREAM_OPEN                  (0x4A504753U)
+
+#define RM_JPEG_STREAM_PRV_STRIP_MIN         (2U)
+#define RM_JPEG_STREAM_PRV_ALIGNMENT_8       (7U)
+#define RM_JPEG_STREAM_PRV_ALIGNMENT_16      (15U)
+#define RM_JPEG_STREAM_PRV_INPUT_CHUNKS      (2U)
+
+/***********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Private function prototypes
+ **********************************************************************************************************************/
+static uint8_t * rm_jpeg_stream_slot(rm_jpeg_stream_instance_ctrl_t * p_ctrl, uint32_t index);
+static uint8_t * rm_jpeg_stream_chunk(rm_jpeg_stream_instance_ctrl_t * p_ctrl, uint32_t index);
+static void      rm_jpeg_stream_chunk_fill(rm_jpeg_stream_instance_ctrl_t * p_ctrl, uint32_t index);
+static fsp_err_t rm_jpeg_stream_input_service(rm_jpeg_stream_instance_ctrl_t * p_ctrl);
+static void      rm_jpeg_stream_header(rm_jpeg_stream_instance_ctrl_t * p_ctrl);
+static void      rm_jpeg_stream_output_pause(rm_jpeg_stream_instance_ctrl_t * p_ctrl);
+static void      rm_jpeg_stream_input_pause(rm_jpeg_stream_instance_ctrl_t * p_ctrl);
+static void      rm_jpeg_stream_error(rm_jpeg_stream_instance_ctrl_t * p_ctrl, fsp_err_t err);
+static void      rm_jpeg_stream_event(rm_jpeg_stream_instance_ctrl_t * p_ctrl, rm_jpeg_stream_event_t event);
+
+/***********************************************************************************************************************
+ * Private global variables
+ **********************************************************************************************************************/
+
+/** Version data structure. */
+static const fsp_version_t g_rm_jpeg_stream_version =
+{
+    .api_version_minor  = RM_JPEG_STREAM_CODE_VERSION_MINOR,
+    .api_version_major  = RM_JPEG_STREAM_CODE_VERSION_MAJOR,
+    .code_version_major = RM_JPEG_STREAM_CODE_VERSION_MAJOR,
+    .code_version_minor = RM_JPEG_STREAM_CODE_VERSION_MINOR
+};
+
+/*******************************************************************************************************************//**
+ * @addtogroup RM_JPEG_STREAM
+ * @{
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Functions
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * Opens the strip decoder and the JPEG codec.
+ *
+ * The decoder streams a JPEG image through two small buffers instead of whole-image buffers:
+ * - The input is read in chunks through rm_jpeg_stream_cfg_t::p_input_read. The codec pauses after each chunk and is
+ *   resumed from the interrupt with the other chunk if it was refilled already, otherwise from the next call to
+ *   RM_JPEG_STREAM_StripGet.
+ * - The output is decoded strip by strip into a ring. The codec pauses after each strip and is resumed from the
+ *   interrupt with the next free slot of the ring, or from RM_JPEG_STREAM_StripRelease when the ring was full.
+ *
+ * A consumer, for example a D/AVE 2D blit into a GLCDC frame buffer or a format conversion, processes each strip while
+ * the codec decodes the following ones.
+ *
+ * @retval     FSP_SUCCESS                    Decoder is open.
+ * @retval     FSP_ERR_ASSERTION              An input parameter is invalid.
+ * @retval     FSP_ERR_ALREADY_OPEN           Module has already been opened with this instance of the control
+ *                                            structure.
+ * @retval     FSP_ERR_INVALID_ARGUMENT       Unsupported strip or input chunk geometry.
+ * @retval     FSP_ERR_INVALID_ALIGNMENT      The strip ring or the input buffer is not 8-byte aligned.
+ * @return                                    See @ref RENESAS_ERROR_CODES or functions called by this function for
+ *                                            other possible return codes. This function calls:
+ *                                            * jpeg_api_t::open
+ **********************************************************************************************************************/
+fsp_err_t RM_JPEG_STREAM_Open (rm_jpeg_stream_instance_ctrl_t * const p_ctrl, rm_jpeg_stream_cfg_t const * const p_cfg)
+{
+#if RM_JPEG_STREAM_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ASSERT(NULL != p_cfg);
+    FSP_ASSERT(NULL != p_cfg->p_jpeg);
+    FSP_ASSERT(NULL != p_cfg->p_ring);
+    FSP_ASSERT(NULL != p_cfg->p_input_buffer);
+    FSP_ASSERT(NULL != p_cfg->p_input_read);
+    FSP_ERROR_RETURN(RM_JPEG_STREAM_OPEN != p_ctrl->open, FSP_ERR_ALREADY_OPEN);
+    FSP_ERROR_RETURN((p_cfg->strip_count >= RM_JPEG_STREAM_PRV_STRIP_MIN) && (0U != p_cfg->strip_lines) &&
+                     (0U == (p_cfg->strip_lines & RM_JPEG_STREAM_PRV_ALIGNMENT_8)) && (0U != p_cfg->stride_pixels),
+                     FSP_ERR_INVALID_ARGUMENT);
+    FSP_ERROR_RETURN((0U != p_cfg->input_chunk_size) &&
+                     (0U == (p_cfg->input_chunk_size & RM_JPEG_STREAM_PRV_ALIGNMENT_8)) &&
+                     (p_cfg->input_chunk_size <= RM_JPEG_STREAM_INPUT_CHUNK_MAX),
+                     FSP_ERR_INVALID_ARGUMENT);
+    FSP_ERROR_RETURN(0U == ((uint32_t) p_cfg->p_ring & RM_JPEG_STREAM_PRV_ALIGNMENT_8), FSP_ERR_INVALID_ALIGNMENT);
+    FSP_ERROR_RETURN(0U == ((uint32_t) p_cfg->p_input_buffer & RM_JPEG_STREAM_PRV_ALIGNMENT_8),
+                     FSP_ERR_INVALID_ALIGNMENT);
+#endif
+
+    jpeg_instance_t const * p_jpeg = p_cfg->p_jpeg;
+
+    fsp_err_t err = p_jpeg->p_api->open(p_jpeg->p_ctrl, p_jpeg->p_cfg);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+    uint32_t bytes_per_pixel = (JPEG_DECODE_PIXEL_FORMAT_ARGB8888 == p_jpeg->p_cfg->pixel_format) ? 4U : 2U;
+
+    p_ctrl->p_cfg            = p_cfg;
+    p_ctrl->strip_bytes      = (uint32_t) p_cfg->strip_lines * p_cfg->stride_pixels * bytes_per_pixel;
+    p_ctrl->width            = 0U;
+    p_ctrl->height           = 0U;
+    p_ctrl->started          = false;
+    p_ctrl->decoding         = false;
+    p_ctrl->err              = FSP_SUCCESS;
+    p_ctrl->strip_read       = 0U;
+    p_ctrl->strips_ready     = 0U;
+    p_ctrl->strips_held      = 0U;
+    p_ctrl->strips_taken     = 0U;
+    p_ctrl->output_stalled   = false;
+    p_ctrl->input_active     = 0U;
+    p_ctrl->input_next_ready = false;
+    p_ctrl->input_stalled    = false;
+    p_ctrl->input_end        = false;
+
+    p_ctrl->open = RM_JPEG_STREAM_OPEN;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Starts decoding an image. Both input chunks are read through rm_jpeg_stream_cfg_t::p_input_read before the codec is
+ * started, so the header and the first strips decode without waiting for the application. All strips of the previous
+ * image must have been released, unless its decoding failed.
+ *
+ * @retval     FSP_SUCCESS                    Decoding started.
+ * @retval     FSP_ERR_ASSERTION              An input parameter is invalid.
+ * @retval     FSP_ERR_NOT_OPEN               The instance control structure is not opened.
+ * @retval     FSP_ERR_IN_USE                 The previous image is still being decoded or consumed.
+ * @return                                    See @ref RENESAS_ERROR_CODES or functions called by this function for
+ *                                            other possible return codes. This function calls:
+ *                                            * jpeg_api_t::close
+ *                                            * jpeg_api_t::open
+ *                                            * jpeg_api_t::horizontalStrideSet
+ *                                            * jpeg_api_t::outputBufferSet
+ *                                            * jpeg_api_t::inputBufferSet
+ **********************************************************************************************************************/
+fsp_err_t RM_JPEG_STREAM_DecodeStart (rm_jpeg_stream_instance_ctrl_t * const p_ctrl)
+{
+#if RM_JPEG_STREAM_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ERROR_RETURN(RM_JPEG_STREAM_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+
+    /* After an error the remaining strips are discarded. */
+    FSP_ERROR_RETURN(!p_ctrl->decoding && ((0U == p_ctrl->strips_ready) || (FSP_SUCCESS != p_ctrl->err)),
+                     FSP_ERR_IN_USE);
+
+    rm_jpeg_stream_cfg_t const * p_cfg  = p_ctrl->p_cfg;
+    jpeg_instance_t const      * p_jpeg = p_cfg->p_jpeg;
+    fsp_err_t                    err;
+
+    /* The codec only clears its decoded line count and error state when it is opened, so it is reopened for every
+     * image after the first. */
+    if (p_ctrl->started)
+    {
+        (void) p_jpeg->p_api->close(p_jpeg->p_ctrl);
+        err = p_jpeg->p_api->open(p_jpeg->p_ctrl, p_jpeg->p_cfg);
+        FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+    }
+
+    p_ctrl->started        = true;
+    p_ctrl->width          = 0U;
+    p_ctrl->height         = 0U;
+    p_ctrl->err            = FSP_SUCCESS;
+    p_ctrl->strip_read     = 0U;
+    p_ctrl->strips_ready   = 0U;
+    p_ctrl->strips_held    = 0U;
+    p_ctrl->strips_taken   = 0U;
+    p_ctrl->output_stalled = false;
+    p_ctrl->input_active   = 0U;
+    p_ctrl->input_stalled  = false;
+    p_ctrl->input_end      = false;
+
+    /* Set the output before the input, so the codec starts decoding from the image size interrupt by itself. */
+    err = p_jpeg->p_api->horizontalStrideSet(p_jpeg->p_ctrl, p_cfg->stride_pixels);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+    err = p_jpeg->p_api->outputBufferSet(p_jpeg->p_ctrl, rm_jpeg_stream_slot(p_ctrl, 0U), p_ctrl->strip_bytes);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+    rm_jpeg_stream_chunk_fill(p_ctrl, 0U);
+    rm_jpeg_stream_chunk_fill(p_ctrl, 1U);
+    p_ctrl->input_next_ready = true;
+
+    p_ctrl->decoding = true;
+
+    err = p_jpeg->p_api->inputBufferSet(p_jpeg->p_ctrl, rm_jpeg_stream_chunk(p_ctrl, 0U), p_cfg->input_chunk_size);
+    if (FSP_SUCCESS != err)
+    {
+        p_ctrl->decoding = false;
+    }
+
+    return err;
+}
+
+/*******************************************************************************************************************//**
+ * Returns the oldest decoded strip that was not returned yet. Strips stay valid until they are released with
+ * RM_JPEG_STREAM_StripRelease, in the order they were returned. Several strips may be held at the same time, the codec
+ * pauses when all slots of the ring are decoded and not released.
+ *
+ * Before looking for a strip, the input chunk the codec has finished is refilled. If the codec paused for input it is
+ * resumed, so this function must also be called after RM_JPEG_STREAM_EVENT_INPUT_NEEDED.
+ *
+ * @retval     FSP_SUCCESS                    *p_strip is set.
+ * @retval     FSP_ERR_ASSERTION              An input parameter is invalid.
+ * @retval     FSP_ERR_NOT_OPEN               The instance control structure is not opened.
+ * @retval     FSP_ERR_INSUFFICIENT_DATA      No strip is decoded yet. Retry after RM_JPEG_STREAM_EVENT_STRIP_READY.
+ * @retval     FSP_ERR_INVALID_STATE          No decode was started or all strips of the image were returned.
+ * @return                                    See @ref RENESAS_ERROR_CODES or functions called by this function for
+ *                                            other possible return codes, including FSP_ERR_JPEG_* errors of the codec.
+ *                                            This function calls:
+ *                                            * jpeg_api_t::inputBufferSet
+ **********************************************************************************************************************/
+fsp_err_t RM_JPEG_STREAM_StripGet (rm_jpeg_stream_instance_ctrl_t * const p_ctrl,
+                                   rm_jpeg_stream_strip_t * const         p_strip)
+{
+#if RM_JPEG_STREAM_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ASSERT(NULL != p_strip);
+    FSP_ERROR_RETURN(RM_JPEG_STREAM_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+
+    fsp_err_t err = rm_jpeg_stream_input_service(p_ctrl);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+    FSP_ERROR_RETURN(FSP_SUCCESS == p_ctrl->err, p_ctrl->err);
+
+    if (p_ctrl->strips_ready <= p_ctrl->strips_held)
+    {
+        return p_ctrl->decoding ? FSP_ERR_INSUFFICIENT_DATA : FSP_ERR_INVALID_STATE;
+    }
+
+    rm_jpeg_stream_cfg_t const * p_cfg = p_ctrl->p_cfg;
+    uint32_t line  = (uint32_t) p_ctrl->strips_taken * p_cfg->strip_lines;
+    uint32_t lines = (uint32_t) p_ctrl->height - line;
+
+    if (lines > p_cfg->strip_lines)
+    {
+        lines = p_cfg->strip_lines;
+    }
+
+    p_strip->p_data = rm_jpeg_stream_slot(p_ctrl, (uint32_t) p_ctrl->strip_read + p_ctrl->strips_held);
+    p_strip->line   = (uint16_t) line;
+    p_strip->lines  = (uint16_t) lines;
+    p_strip->width  = p_ctrl->width;
+    p_strip->height = p_ctrl->height;
+    p_strip->stride = p_cfg->stride_pixels;
+    p_strip->last   = (line + lines) >= p_ctrl->height;
+
+    p_ctrl->strips_held++;
+    p_ctrl->strips_taken++;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Releases the oldest strip returned by RM_JPEG_STREAM_StripGet, so its slot can be decoded into again. If the codec
+ * paused because the ring was full it is resumed with the released slot.
+ *
+ * @retval     FSP_SUCCESS                    Strip released.
+ * @retval     FSP_ERR_ASSERTION              An input parameter is invalid.
+ * @retval     FSP_ERR_NOT_OPEN               The instance control structure is not opened.
+ * @retval     FSP_ERR_INVALID_STATE          No strip is held.
+ * @return                                    See @ref RENESAS_ERROR_CODES or functions called by this function for
+ *                                            other possible return codes. This function calls:
+ *                                            * jpeg_api_t::outputBufferSet
+ **********************************************************************************************************************/
+fsp_err_t RM_JPEG_STREAM_StripRelease (rm_jpeg_stream_instance_ctrl_t * const p_ctrl)
+{
+#if RM_JPEG_STREAM_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ERROR_RETURN(RM_JPEG_STREAM_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+    FSP_ERROR_RETURN(0U != p_ctrl->strips_held, FSP_ERR_INVALID_STATE);
+
+    jpeg_instance_t const * p_jpeg = p_ctrl->p_cfg->p_jpeg;
+    fsp_err_t               err    = FSP_SUCCESS;
+
+    /* The interrupt updates strips_ready and output_stalled. */
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+
+    p_ctrl->strip_read = (uint8_t) ((p_ctrl->strip_read + 1U) % p_ctrl->p_cfg->strip_count);
+    p_ctrl->strips_ready--;
+    p_ctrl->strips_held--;
+
+    if (p_ctrl->output_stalled)
+    {
+        p_ctrl->output_stalled = false;
+        err = p_jpeg->p_api->outputBufferSet(p_jpeg->p_ctrl,
+                                             rm_jpeg_stream_slot(p_ctrl,
+                                                                 (uint32_t) p_ctrl->strip_read + p_ctrl->strips_ready),
+                                             p_ctrl->strip_bytes);
+    }
+
+    FSP_CRITICAL_SECTION_EXIT;
+
+    return err;
+}
+
+/*******************************************************************************************************************//**
+ * Stops decoding and closes the JPEG codec.
+ *
+ * @retval     FSP_SUCCESS                    Decoder closed.
+ * @retval     FSP_ERR_ASSERTION              An input parameter is invalid.
+ * @retval     FSP_ERR_NOT_OPEN               The instance control structure is not opened.
+ **********************************************************************************************************************/
+fsp_err_t RM_JPEG_STREAM_Close (rm_jpeg_stream_instance_ctrl_t * const p_ctrl)
+{
+#if RM_JPEG_STREAM_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ERROR_RETURN(RM_JPEG_STREAM_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+
+    jpeg_instance_t const * p_jpeg = p_ctrl->p_cfg->p_jpeg;
+
+    p_ctrl->decoding = false;
+    p_ctrl->open     = 0U;
+
+    (void) p_jpeg->p_api->close(p_jpeg->p_ctrl);
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Returns the version of this module.
+ *
+ * @retval     FSP_SUCCESS                    Version stored in p_version.
+ * @retval     FSP_ERR_ASSERTION              p_version is NULL.
+ **********************************************************************************************************************/
+fsp_err_t RM_JPEG_STREAM_VersionGet (fsp_version_t * const p_version)
+{
+#if RM_JPEG_STREAM_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_version);
+#endif
+
+    p_version->version_id = g_rm_jpeg_stream_version.version_id;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * JPEG decode callback. Set as decode callback of the JPEG instance with the strip decoder control structure as
+ * context, or call it from the application's decode callback with the same arguments.
+ *
+ * After the header is decoded the image size is checked against the ring. Each output pause completes a strip and
+ * resumes the codec with the next free slot, each input pause resumes it with the refilled input chunk. When no slot
+ * or chunk is available the codec stays paused until RM_JPEG_STREAM_StripRelease or RM_JPEG_STREAM_StripGet.
+ *
+ * @param[in]  p_args   JPEG callback arguments. p_context must point to the strip decoder control structure.
+ **********************************************************************************************************************/
+void rm_jpeg_stream_jpeg_callback (jpeg_callback_args_t * p_args)
+{
+    rm_jpeg_stream_instance_ctrl_t * p_ctrl = (rm_jpeg_stream_instance_ctrl_t *) p_args->p_context;
+
+    if ((NULL == p_ctrl) || (RM_JPEG_STREAM_OPEN != p_ctrl->open) || !p_ctrl->decoding)
+    {
+        return;
+    }
+
+    uint32_t status = (uint32_t) p_args->status;
+
+    if ((uint32_t) JPEG_STATUS_ERROR & status)
+    {
+        /* The codec returns its error code from every API call once it has stopped. */
+        uint32_t                lines  = 0U;
+        jpeg_instance_t const * p_jpeg = p_ctrl->p_cfg->p_jpeg;
+        fsp_err_t               err    = p_jpeg->p_api->linesDecodedGet(p_jpeg->p_ctrl, &lines);
+
+        rm_jpeg_stream_error(p_ctrl, (FSP_SUCCESS != err) ? err : FSP_ERR_JPEG_ERR);
+
+        return;
+    }
+
+    /* The image size status stays set for the rest of the image, the header is only handled once. */
+    if (((uint32_t) JPEG_STATUS_IMAGE_SIZE_READY & status) && (0U == p_ctrl->height))
+    {
+        rm_jpeg_stream_header(p_ctrl);
+
+        return;
+    }
+
+    if ((uint32_t) JPEG_STATUS_OPERATION_COMPLETE & status)
+    {
+        /* The last strip replaces the output pause. */
+        p_ctrl->strips_ready++;
+        p_ctrl->decoding = false;
+        rm_jpeg_stream_event(p_ctrl, RM_JPEG_STREAM_EVENT_STRIP_READY);
+
+        return;
+    }
+
+    if ((uint32_t) JPEG_STATUS_OUTPUT_PAUSE & status)
+    {
+        rm_jpeg_stream_output_pause(p_ctrl);
+    }
+
+    if ((uint32_t) JPEG_STATUS_INPUT_PAUSE & status)
+    {
+        rm_jpeg_stream_input_pause(p_ctrl);
+    }
+}
+
+/*******************************************************************************************************************//**
+ * @} (end addtogroup RM_JPEG_STREAM)
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Private Functions
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * Returns a slot of the strip ring.
+ *
+ * @param[in]  p_ctrl   Pointer to the control structure.
+ * @param[in]  index    Slot index, taken modulo the number of strips.
+ *
+ * @return     First line of the slot.
+ **********************************************************************************************************************/
+static uint8_t * rm_jpeg_stream_slot (rm_jpeg_stream_instance_ctrl_t * p_ctrl, uint32_t index)
+{
+    return p_ctrl->p_cfg->p_ring + ((index % p_ctrl->p_cfg->strip_count) * p_ctrl->strip_bytes);
+}
+
+/*******************************************************************************************************************//**
+ * Returns one of the two input chunks.
+ *
+ * @param[in]  p_ctrl   Pointer to the control structure.
+ * @param[in]  index    Chunk index, 0 or 1.
+ *
+ * @return     Start of the chunk.
+ **********************************************************************************************************************/
+static uint8_t * rm_jpeg_stream_chunk (rm_jpeg_stream_instance_ctrl_t * p_ctrl, uint32_t index)
+{
+    return p_ctrl->p_cfg->p_input_buffer + (index * p_ctrl->p_cfg->input_chunk_size);
+}
+
+/*******************************************************************************************************************//**
+ * Reads the next part of the stream into an input chunk. The codec always reads whole chunks, so the rest of the chunk
+ * is cleared after the end of the stream.
+ *
+ * @param[in]  p_ctrl   Pointer to the control structure.
+ * @param[in]  index    Chunk index, 0 or 1. The codec must not be reading this chunk.
+ **********************************************************************************************************************/
+static void rm_jpeg_stream_chunk_fill (rm_jpeg_stream_instance_ctrl_t * p_ctrl, uint32_t index)
+{
+    rm_jpeg_stream_cfg_t const * p_cfg   = p_ctrl->p_cfg;
+    uint8_t                    * p_chunk = rm_jpeg_stream_chunk(p_ctrl, index);
+    uint32_t                     filled  = 0U;
+
+    while (!p_ctrl->input_end && (filled < p_cfg->input_chunk_size))
+    {
+        uint32_t bytes = p_cfg->p_input_read(p_cfg->p_context, p_chunk + filled, p_cfg->input_chunk_size - filled);
+        if (0U == bytes)
+        {
+            p_ctrl->input_end = true;
+        }
+
+        filled += bytes;
+    }
+
+    memset(p_chunk + filled, 0, p_cfg->input_chunk_size - filled);
+}
+
+/*******************************************************************************************************************//**
+ * Refills the input chunk the codec has finished. If the codec paused for input meanwhile, it is resumed with the
+ * refilled chunk.
+ *
+ * @param[in]  p_ctrl   Pointer to the control structure.
+ *
+ * @retval     FSP_SUCCESS                    Input chunks are up to date.
+ * @return                                    Error returned by jpeg_api_t::inputBufferSet.
+ **********************************************************************************************************************/
+static fsp_err_t rm_jpeg_stream_input_service (rm_jpeg_stream_instance_ctrl_t * p_ctrl)
+{
+    fsp_err_t err = FSP_SUCCESS;
+
+    if (!p_ctrl->decoding || p_ctrl->input_next_ready)
+    {
+        return FSP_SUCCESS;
+    }
+
+    /* The codec reads the active chunk only, so the other one is refilled with interrupts enabled. */
+    rm_jpeg_stream_chunk_fill(p_ctrl, p_ctrl->input_active ^ 1U);
+
+    jpeg_instance_t const * p_jpeg = p_ctrl->p_cfg->p_jpeg;
+
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+
+    if (p_ctrl->input_stalled)
+    {
+        p_ctrl->input_stalled = false;
+        p_ctrl->input_active ^= 1U;
+        err = p_jpeg->p_api->inputBufferSet(p_jpeg->p_ctrl,
+                                            rm_jpeg_stream_chunk(p_ctrl, p_ctrl->input_active),
+                                            p_ctrl->p_cfg->input_chunk_size);
+    }
+    else
+    {
+        p_ctrl->input_next_ready = true;
+    }
+
+    FSP_CRITICAL_SECTION_EXIT;
+
+    return err;
+}
+
+/*******************************************************************************************************************//**
+ * Records the image size after the header was decoded and rejects images the ring cannot hold. The codec starts
+ * decoding into the first slot when this returns.
+ *
+ * @param[in]  p_ctrl   Pointer to the control structure.
+ **********************************************************************************************************************/
+static void rm_jpeg_stream_header (rm_jpeg_stream_instance_ctrl_t * p_ctrl)
+{
+    jpeg_instance_t const * p_jpeg      = p_ctrl->p_cfg->p_jpeg;
+    jpeg_color_space_t      color_space = JPEG_COLOR_SPACE_YCBCR444;
+    uint16_t                width       = 0U;
+    uint16_t                height      = 0U;
+
+    (void) p_jpeg->p_api->imageSizeGet(p_jpeg->p_ctrl, &width, &height);
+    (void) p_jpeg->p_api->pixelFormatGet(p_jpeg->p_ctrl, &color_space);
+
+    p_ctrl->width  = width;
+    p_ctrl->height = height;
+
+    if ((0U == height) || (width > p_ctrl->p_cfg->stride_pixels))
+    {
+        rm_jpeg_stream_error(p_ctrl, FSP_ERR_JPEG_UNSUPPORTED_IMAGE_SIZE);
+    }
+    /* The codec decodes 4:2:0 images in pairs of 8 line blocks. */
+    else if ((JPEG_COLOR_SPACE_YCBCR420 == color_space) &&
+             (0U != (p_ctrl->p_cfg->strip_lines & RM_JPEG_STREAM_PRV_ALIGNMENT_16)))
+    {
+        rm_jpeg_stream_error(p_ctrl, FSP_ERR_JPEG_BUFFERSIZE_NOT_ENOUGH);
+    }
+    else
+    {
+        /* Image accepted. */
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Completes the strip the codec paused after and resumes the codec with the next slot if it is free.
+ *
+ * @param[in]  p_ctrl   Pointer to the control structure.
+ **********************************************************************************************************************/
+static void rm_jpeg_stream_output_pause (rm_jpeg_stream_instance_ctrl_t * p_ctrl)
+{
+    jpeg_instance_t const * p_jpeg = p_ctrl->p_cfg->p_jpeg;
+
+    p_ctrl->strips_ready++;
+
+    if (p_ctrl->strips_ready < p_ctrl->p_cfg->strip_count)
+    {
+        fsp_err_t err = p_jpeg->p_api->outputBufferSet(p_jpeg->p_ctrl,
+                                                       rm_jpeg_stream_slot(p_ctrl,
+                                                                           (uint32_t) p_ctrl->strip_read +
+                                                                           p_ctrl->strips_ready),
+                                                       p_ctrl->strip_bytes);
+        if (FSP_SUCCESS != err)
+        {
+            rm_jpeg_stream_error(p_ctrl, err);
+
+            return;
+        }
+    }
+    else
+    {
+        p_ctrl->output_stalled = true;
+    }
+
+    rm_jpeg_stream_event(p_ctrl, RM_JPEG_STREAM_EVENT_STRIP_READY);
+}
+
+/*******************************************************************************************************************//**
+ * Resumes the codec with the other input chunk if it was refilled, otherwise leaves it paused until the application
+ * refills it.
+ *
+ * @param[in]  p_ctrl   Pointer to the control structure.
+ **********************************************************************************************************************/
+static void rm_jpeg_stream_input_pause (rm_jpeg_stream_instance_ctrl_t * p_ctrl)
+{
+    jpeg_instance_t const * p_jpeg = p_ctrl->p_cfg->p_jpeg;
+
+    if (p_ctrl->input_next_ready)
+    {
+        p_ctrl->input_next_ready = false;
+        p_ctrl->input_active    ^= 1U;
+
+        fsp_err_t err = p_jpeg->p_api->inputBufferSet(p_jpeg->p_ctrl,
+                                                      rm_jpeg_stream_chunk(p_ctrl, p_ctrl->input_active),
+                                                      p_ctrl->p_cfg->input_chunk_size);
+        if (FSP_SUCCESS != err)
+        {
+            rm_jpeg_stream_error(p_ctrl, err);
+        }
+    }
+    else
+    {
+        p_ctrl->input_stalled = true;
+        rm_jpeg_stream_event(p_ctrl, RM_JPEG_STREAM_EVENT_INPUT_NEEDED);
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Stops the current image after an error. Only the first error is kept.
+ *
+ * @param[in]  p_ctrl   Pointer to the control structure.
+ * @param[in]  err      Error code returned by RM_JPEG_STREAM_StripGet.
+ **********************************************************************************************************************/
+static void rm_jpeg_stream_error (rm_jpeg_stream_instance_ctrl_t * p_ctrl, fsp_err_t err)
+{
+    if (FSP_SUCCESS == p_ctrl->err)
+    {
+        p_ctrl->err = err;
+    }
+
+    p_ctrl->decoding = false;
+    rm_jpeg_stream_event(p_ctrl, RM_JPEG_STREAM_EVENT_ERROR);
+}
+
+/*******************************************************************************************************************//**
+ * Calls the user callback if one is configured.
+ *
+ * @param[in]  p_ctrl   Pointer to the control structure.
+ * @param[in]  event    Event to report.
+ **********************************************************************************************************************/
+static void rm_jpeg_stream_event (rm_jpeg_stream_instance_ctrl_t * p_ctrl, rm_jpeg_stream_event_t event)
+{
+    rm_jpeg_stream_cfg_t const * p_cfg = p_ctrl->p_cfg;
+
+    if (NULL != p_cfg->p_callback)
+    {
+        rm_jpeg_stream_callback_args_t args;
+
+        args.event     = event;
+        args.p_context = p_cfg->p_context;
+        p_cfg->p_callback(&args);
+    }
+}
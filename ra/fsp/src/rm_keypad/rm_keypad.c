@@ -0,0 +1,550 @@
+/***********************************************************************************************************************
+ * Copyright [2020] Renesas Electronics Corporation and/or its affiliates.  All Rights Reserved.
+ *
+ * This software and documentation are supplied by Renesas Electronics America Inc. and may only be used with products
+ * of Renesas Electronics Corp. and its affiliates ("Renesas").  No other uses are authorized.  Renesas products are
+ * sold pursuant to Renesas terms and conditions of sale.  Purchasers are solely responsible for the selection and use
+ * of Renesas products and Renesas assumes no liability.  No license, express or implied, to any intellectual property
+ * right is granted by Renesas. This software is protected under all applicable laws, including copyright laws. Renesas
+ * reserves the right to change or discontinue this software and/or this documentation. THE SOFTWARE AND DOCUMENTATION
+ * IS DELIVERED TO YOU "AS IS," AND RENESAS MAKES NO REPRESENTATIONS OR WARRANTIES, AND TO THE FULLEST EXTENT
+ * PERMISSIBLE UNDER APPLICABLE LAW, DISCLAIMS ALL WARRANTIES, WHETHER EXPLICITLY OR IMPLICITLY, INCLUDING WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, AND NONINFRINGEMENT, WITH RESPECT TO THE SOFTWARE OR
+ * DOCUMENTATION.  RENESAS SHALL HAVE NO LIABILITY ARISING OUT OF ANY SECURITY VULNERABILITY OR BREACH.  TO THE MAXIMUM
+ * EXTENT PERMITTED BY LAW, IN NO EVENT WILL RENESAS BE LIABLE TO YOU IN CONNECTION WITH THE SOFTWARE OR DOCUMENTATION
+ * (OR ANY PERSON OR ENTITY CLAIMING RIGHTS DERIVED FROM YOU) FOR ANY LOSS, DAMAGES, OR CLAIMS WHATSOEVER, INCLUDING,
+ * WITHOUT LIMITATION, ANY DIRECT, CONSEQUENTIAL, SPECIAL, INDIRECT, PUNITIVE, OR INCIDENTAL DAMAGES; ANY LOST PROFITS,
+ * OTHER ECONOMIC DAMAGE, PROPERTY DAMAGE, OR PERSONAL INJURY; AND EVEN IF RENESAS HAS BEEN ADVISED OF THE POSSIBILITY
+ * OF SUCH LOSS, DAMAGES, CLAIMS OR COSTS.
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Includes
+ **********************************************************************************************************************/
+#include "rm_keypad.h"
+#include "rm_keypad_cfg.h"
+
+/***********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+
+/* "KPAD" in ASCII. */
+#define RM_KEYPAD_OPEN    (0x4B504144U)
+
+/***********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Private function prototypes
+ **********************************************************************************************************************/
+static void rm_keypad_columns_write(rm_keypad_instance_ctrl_t * p_ctrl, bsp_io_level_t level);
+static void rm_keypad_rows_read(rm_keypad_instance_ctrl_t * p_ctrl, uint8_t * p_rows);
+static bool rm_keypad_ghosted(rm_keypad_instance_ctrl_t * p_ctrl);
+static void rm_keypad_commit(rm_keypad_instance_ctrl_t * p_ctrl);
+static void rm_keypad_event(rm_keypad_instance_ctrl_t * p_ctrl, uint8_t row, uint8_t column,
+                            rm_keypad_event_type_t type);
+static void rm_keypad_scan_start(rm_keypad_instance_ctrl_t * p_ctrl);
+static void rm_keypad_idle(rm_keypad_instance_ctrl_t * p_ctrl);
+static void rm_keypad_kint_callback(keymatrix_callback_args_t * p_args);
+static void rm_keypad_timer_callback(timer_callback_args_t * p_args);
+
+/***********************************************************************************************************************
+ * Private global variables
+ **********************************************************************************************************************/
+
+/** Version data structure. */
+static const fsp_version_t g_rm_keypad_version =
+{
+    .api_version_minor  = RM_KEYPAD_CODE_VERSION_MINOR,
+    .api_version_major  = RM_KEYPAD_CODE_VERSION_MAJOR,
+    .code_version_major = RM_KEYPAD_CODE_VERSION_MAJOR,
+    .code_version_minor = RM_KEYPAD_CODE_VERSION_MINOR
+};
+
+/*******************************************************************************************************************//**
+ * @addtogroup RM_KEYPAD
+ * @{
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Functions
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * Opens the key matrix engine, the KINT instance on the rows and the AGT that schedules the scans.
+ *
+ * While no key is held, all columns are driven low and only the KINT interrupt is enabled, so the MCU can stay in
+ * Software Standby mode until a key is pressed. A key press starts the AGT, which scans one column at a time every
+ * period. A change of the matrix is reported once it has been stable for the debounce time, and changes that
+ * cannot be resolved because of ghosting are ignored until the matrix is unambiguous again. Once every key is
+ * released, the AGT is stopped and the KINT interrupt is enabled again.
+ *
+ * @retval     FSP_SUCCESS                    Module is open.
+ * @retval     FSP_ERR_ASSERTION              An input parameter is invalid.
+ * @retval     FSP_ERR_ALREADY_OPEN           Module has already been opened with this instance of the control
+ *                                            structure.
+ * @return                                    See @ref RENESAS_ERROR_CODES or functions called by this function for
+ *                                            other possible return codes. This function calls:
+ *                                            * keymatrix_api_t::open
+ *                                            * keymatrix_api_t::callbackSet
+ *                                            * keymatrix_api_t::enable
+ *                                            * timer_api_t::open
+ *                                            * timer_api_t::callbackSet
+ *                                            * timer_api_t::infoGet
+ **********************************************************************************************************************/
+fsp_err_t RM_KEYPAD_Open (rm_keypad_instance_ctrl_t * const p_ctrl, rm_keypad_cfg_t const * const p_cfg)
+{
+#if RM_KEYPAD_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ASSERT(NULL != p_cfg);
+    FSP_ASSERT(NULL != p_cfg->p_kint);
+    FSP_ASSERT(NULL != p_cfg->p_timer);
+    FSP_ASSERT(NULL != p_cfg->p_ioport);
+    FSP_ASSERT(NULL != p_cfg->p_row_pins);
+    FSP_ASSERT(NULL != p_cfg->p_column_pins);
+    FSP_ASSERT(NULL != p_cfg->p_event_queue);
+    FSP_ASSERT(0U != p_cfg->event_queue_size);
+    FSP_ASSERT((0U != p_cfg->num_rows) && (p_cfg->num_rows <= RM_KEYPAD_MAX_ROWS));
+    FSP_ASSERT((0U != p_cfg->num_columns) && (p_cfg->num_columns <= RM_KEYPAD_MAX_COLUMNS));
+    FSP_ERROR_RETURN(RM_KEYPAD_OPEN != p_ctrl->open, FSP_ERR_ALREADY_OPEN);
+#endif
+
+    keymatrix_instance_t const * p_kint  = p_cfg->p_kint;
+    timer_instance_t const     * p_timer = p_cfg->p_timer;
+    timer_info_t                 info;
+
+    fsp_err_t err = p_kint->p_api->open(p_kint->p_ctrl, p_kint->p_cfg);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+    err = p_kint->p_api->callbackSet(p_kint->p_ctrl, rm_keypad_kint_callback, p_ctrl, NULL);
+    if (FSP_SUCCESS == err)
+    {
+        err = p_timer->p_api->open(p_timer->p_ctrl, p_timer->p_cfg);
+        if (FSP_SUCCESS == err)
+        {
+            err = p_timer->p_api->callbackSet(p_timer->p_ctrl, rm_keypad_timer_callback, p_ctrl, NULL);
+            if (FSP_SUCCESS == err)
+            {
+                err = p_timer->p_api->infoGet(p_timer->p_ctrl, &info);
+            }
+
+            if (FSP_SUCCESS != err)
+            {
+                (void) p_timer->p_api->close(p_timer->p_ctrl);
+            }
+        }
+    }
+
+    if (FSP_SUCCESS != err)
+    {
+        (void) p_kint->p_api->close(p_kint->p_ctrl);
+
+        return err;
+    }
+
+    /* Convert the debounce time to whole scan periods, at least one. */
+    uint64_t period_ms_scaled = (uint64_t) info.period_counts * 1000U;
+    uint64_t debounce_scans   = (((uint64_t) p_cfg->debounce_ms * info.clock_frequency) + period_ms_scaled - 1U) /
+                                period_ms_scaled;
+
+    p_ctrl->p_cfg          = p_cfg;
+    p_ctrl->debounce_scans = (0U == debounce_scans) ? 1U : (uint32_t) debounce_scans;
+    p_ctrl->stable_scans   = 0U;
+    p_ctrl->scanning       = false;
+    p_ctrl->queue_head     = 0U;
+    p_ctrl->queue_tail     = 0U;
+    p_ctrl->dropped_events = 0U;
+
+    for (uint32_t i = 0U; i < RM_KEYPAD_MAX_COLUMNS; i++)
+    {
+        p_ctrl->raw_state[i] = 0U;
+        p_ctrl->key_state[i] = 0U;
+    }
+
+    p_ctrl->open = RM_KEYPAD_OPEN;
+
+    /* Wait for the first key press. */
+    rm_keypad_idle(p_ctrl);
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Gets the oldest key event from the event queue. Events that did not fit in the queue are counted in the
+ * dropped_events member of the control structure.
+ *
+ * @retval     FSP_SUCCESS                    Event stored in p_event.
+ * @retval     FSP_ERR_ASSERTION              An input parameter is invalid.
+ * @retval     FSP_ERR_NOT_OPEN               The instance control structure is not opened.
+ * @retval     FSP_ERR_QUEUE_EMPTY            No key event is pending.
+ **********************************************************************************************************************/
+fsp_err_t RM_KEYPAD_EventGet (rm_keypad_instance_ctrl_t * const p_ctrl, rm_keypad_event_t * const p_event)
+{
+#if RM_KEYPAD_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ASSERT(NULL != p_event);
+    FSP_ERROR_RETURN(RM_KEYPAD_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+
+    uint32_t tail = p_ctrl->queue_tail;
+
+    FSP_ERROR_RETURN(p_ctrl->queue_head != tail, FSP_ERR_QUEUE_EMPTY);
+
+    *p_event = p_ctrl->p_cfg->p_event_queue[tail % p_ctrl->p_cfg->event_queue_size];
+
+    /* The slot is only handed back to the scan interrupt once the event has been copied. */
+    p_ctrl->queue_tail = tail + 1U;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Gets the debounced state of the matrix.
+ *
+ * @param[in]  p_ctrl        Pointer to the control structure.
+ * @param[out] p_row_masks   Array of num_columns entries. Bit n of entry m is set while the key on row n of column m
+ *                           is held.
+ *
+ * @retval     FSP_SUCCESS                    State stored in p_row_masks.
+ * @retval     FSP_ERR_ASSERTION              An input parameter is invalid.
+ * @retval     FSP_ERR_NOT_OPEN               The instance control structure is not opened.
+ **********************************************************************************************************************/
+fsp_err_t RM_KEYPAD_KeysGet (rm_keypad_instance_ctrl_t * const p_ctrl, uint8_t * const p_row_masks)
+{
+#if RM_KEYPAD_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ASSERT(NULL != p_row_masks);
+    FSP_ERROR_RETURN(RM_KEYPAD_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+
+    /* Copy the state in one piece, so it does not mix two scans. */
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+
+    for (uint32_t i = 0U; i < p_ctrl->p_cfg->num_columns; i++)
+    {
+        p_row_masks[i] = p_ctrl->key_state[i];
+    }
+
+    FSP_CRITICAL_SECTION_EXIT;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Stops scanning and closes the KINT and AGT instances.
+ *
+ * @retval     FSP_SUCCESS                    Module is closed.
+ * @retval     FSP_ERR_ASSERTION              An input parameter is invalid.
+ * @retval     FSP_ERR_NOT_OPEN               The instance control structure is not opened.
+ **********************************************************************************************************************/
+fsp_err_t RM_KEYPAD_Close (rm_keypad_instance_ctrl_t * const p_ctrl)
+{
+#if RM_KEYPAD_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ERROR_RETURN(RM_KEYPAD_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+
+    p_ctrl->open = 0U;
+
+    keymatrix_instance_t const * p_kint  = p_ctrl->p_cfg->p_kint;
+    timer_instance_t const     * p_timer = p_ctrl->p_cfg->p_timer;
+
+    (void) p_kint->p_api->close(p_kint->p_ctrl);
+    (void) p_timer->p_api->stop(p_timer->p_ctrl);
+    (void) p_timer->p_api->close(p_timer->p_ctrl);
+
+    /* Leave the columns floating. */
+    rm_keypad_columns_write(p_ctrl, BSP_IO_LEVEL_HIGH);
+    p_ctrl->scanning = false;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Gets the version of this module.
+ *
+ * @retval     FSP_SUCCESS                    Version stored in p_version.
+ * @retval     FSP_ERR_ASSERTION              p_version was NULL.
+ **********************************************************************************************************************/
+fsp_err_t RM_KEYPAD_VersionGet (fsp_version_t * const p_version)
+{
+#if RM_KEYPAD_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_version);
+#endif
+
+    p_version->version_id = g_rm_keypad_version.version_id;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @} (end addtogroup RM_KEYPAD)
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Private Functions
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * Drives all columns to the same level.
+ *
+ * @param[in]  p_ctrl   Pointer to the control structure.
+ * @param[in]  level    BSP_IO_LEVEL_LOW to make any key press pull its row low, BSP_IO_LEVEL_HIGH to float.
+ **********************************************************************************************************************/
+static void rm_keypad_columns_write (rm_keypad_instance_ctrl_t * p_ctrl, bsp_io_level_t level)
+{
+    rm_keypad_cfg_t const   * p_cfg    = p_ctrl->p_cfg;
+    ioport_instance_t const * p_ioport = p_cfg->p_ioport;
+
+    for (uint32_t i = 0U; i < p_cfg->num_columns; i++)
+    {
+        (void) p_ioport->p_api->pinWrite(p_ioport->p_ctrl, p_cfg->p_column_pins[i], level);
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Reads the rows that are pulled low.
+ *
+ * @param[in]  p_ctrl   Pointer to the control structure.
+ * @param[out] p_rows   Bit n is set when row n is low.
+ **********************************************************************************************************************/
+static void rm_keypad_rows_read (rm_keypad_instance_ctrl_t * p_ctrl, uint8_t * p_rows)
+{
+    rm_keypad_cfg_t const   * p_cfg    = p_ctrl->p_cfg;
+    ioport_instance_t const * p_ioport = p_cfg->p_ioport;
+    uint8_t                   rows     = 0U;
+    bsp_io_level_t            level;
+
+    for (uint32_t i = 0U; i < p_cfg->num_rows; i++)
+    {
+        if ((FSP_SUCCESS == p_ioport->p_api->pinRead(p_ioport->p_ctrl, p_cfg->p_row_pins[i], &level)) &&
+            (BSP_IO_LEVEL_LOW == level))
+        {
+            rows |= (uint8_t) (1U << i);
+        }
+    }
+
+    *p_rows = rows;
+}
+
+/*******************************************************************************************************************//**
+ * Checks whether the last scan may contain phantom keys. Without diodes, three keys on the corners of a rectangle also
+ * make the fourth corner read as pressed, so two columns that share two or more rows cannot be resolved.
+ *
+ * @param[in]  p_ctrl   Pointer to the control structure.
+ *
+ * @retval     true     The scan is ambiguous and must not be reported.
+ * @retval     false    Every key in the scan is real.
+ **********************************************************************************************************************/
+static bool rm_keypad_ghosted (rm_keypad_instance_ctrl_t * p_ctrl)
+{
+    uint32_t num_columns = p_ctrl->p_cfg->num_columns;
+
+    for (uint32_t i = 0U; i < num_columns; i++)
+    {
+        for (uint32_t j = i + 1U; j < num_columns; j++)
+        {
+            uint32_t shared = (uint32_t) (p_ctrl->raw_state[i] & p_ctrl->raw_state[j]);
+
+            /* More than one bit set. */
+            if (0U != (shared & (shared - 1U)))
+            {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+/*******************************************************************************************************************//**
+ * Reports the keys that changed between the debounced state and the last scan, then takes the scan as new state.
+ *
+ * @param[in]  p_ctrl   Pointer to the control structure.
+ **********************************************************************************************************************/
+static void rm_keypad_commit (rm_keypad_instance_ctrl_t * p_ctrl)
+{
+    for (uint32_t column = 0U; column < p_ctrl->p_cfg->num_columns; column++)
+    {
+        uint8_t changed = p_ctrl->raw_state[column] ^ p_ctrl->key_state[column];
+
+        for (uint32_t row = 0U; 0U != changed; row++)
+        {
+            if (0U != (changed & (1U << row)))
+            {
+                rm_keypad_event(p_ctrl, (uint8_t) row, (uint8_t) column,
+                                (0U != (p_ctrl->raw_state[column] & (1U << row))) ?
+                                RM_KEYPAD_EVENT_TYPE_PRESSED : RM_KEYPAD_EVENT_TYPE_RELEASED);
+                changed &= (uint8_t) ~(1U << row);
+            }
+        }
+
+        p_ctrl->key_state[column] = p_ctrl->raw_state[column];
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Queues a key event and calls the user callback if one is configured.
+ *
+ * @param[in]  p_ctrl   Pointer to the control structure.
+ * @param[in]  row      Row of the key.
+ * @param[in]  column   Column of the key.
+ * @param[in]  type     Pressed or released.
+ **********************************************************************************************************************/
+static void rm_keypad_event (rm_keypad_instance_ctrl_t * p_ctrl, uint8_t row, uint8_t column,
+                             rm_keypad_event_type_t type)
+{
+    rm_keypad_cfg_t const * p_cfg = p_ctrl->p_cfg;
+    rm_keypad_event_t       event;
+
+    event.row    = row;
+    event.column = column;
+    event.type   = type;
+
+    uint32_t head = p_ctrl->queue_head;
+    if ((head - p_ctrl->queue_tail) < p_cfg->event_queue_size)
+    {
+        p_cfg->p_event_queue[head % p_cfg->event_queue_size] = event;
+        p_ctrl->queue_head = head + 1U;
+    }
+    else
+    {
+        p_ctrl->dropped_events++;
+    }
+
+    if (NULL != p_cfg->p_callback)
+    {
+        rm_keypad_callback_args_t args;
+
+        args.event     = event;
+        args.p_context = p_cfg->p_context;
+        p_cfg->p_callback(&args);
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Hands the matrix from the KINT interrupt over to the AGT scan.
+ *
+ * @param[in]  p_ctrl   Pointer to the control structure.
+ **********************************************************************************************************************/
+static void rm_keypad_scan_start (rm_keypad_instance_ctrl_t * p_ctrl)
+{
+    keymatrix_instance_t const * p_kint  = p_ctrl->p_cfg->p_kint;
+    timer_instance_t const     * p_timer = p_ctrl->p_cfg->p_timer;
+
+    (void) p_kint->p_api->disable(p_kint->p_ctrl);
+
+    /* Columns float between scans, so a held key draws no current. */
+    rm_keypad_columns_write(p_ctrl, BSP_IO_LEVEL_HIGH);
+
+    p_ctrl->stable_scans = 0U;
+    p_ctrl->scanning     = true;
+
+    (void) p_timer->p_api->reset(p_timer->p_ctrl);
+    (void) p_timer->p_api->start(p_timer->p_ctrl);
+}
+
+/*******************************************************************************************************************//**
+ * Stops the AGT scan and waits for the next key press with the KINT interrupt.
+ *
+ * @param[in]  p_ctrl   Pointer to the control structure.
+ **********************************************************************************************************************/
+static void rm_keypad_idle (rm_keypad_instance_ctrl_t * p_ctrl)
+{
+    keymatrix_instance_t const * p_kint  = p_ctrl->p_cfg->p_kint;
+    timer_instance_t const     * p_timer = p_ctrl->p_cfg->p_timer;
+    uint8_t                      rows;
+
+    (void) p_timer->p_api->stop(p_timer->p_ctrl);
+    p_ctrl->scanning = false;
+
+    rm_keypad_columns_write(p_ctrl, BSP_IO_LEVEL_LOW);
+    (void) p_kint->p_api->enable(p_kint->p_ctrl);
+
+    /* A key pressed before the KINT interrupt was enabled produces no edge, so check the rows once more. */
+    rm_keypad_rows_read(p_ctrl, &rows);
+    if (0U != rows)
+    {
+        rm_keypad_scan_start(p_ctrl);
+    }
+}
+
+/*******************************************************************************************************************//**
+ * KINT callback, a key was pressed while the matrix was idle.
+ *
+ * @param[in]  p_args   KINT callback arguments. p_context points to the control structure.
+ **********************************************************************************************************************/
+static void rm_keypad_kint_callback (keymatrix_callback_args_t * p_args)
+{
+    rm_keypad_instance_ctrl_t * p_ctrl = (rm_keypad_instance_ctrl_t *) p_args->p_context;
+
+    if (!p_ctrl->scanning)
+    {
+        rm_keypad_scan_start(p_ctrl);
+    }
+}
+
+/*******************************************************************************************************************//**
+ * AGT underflow callback, scans the matrix one column at a time and debounces the result.
+ *
+ * @param[in]  p_args   Timer callback arguments. p_context points to the control structure.
+ **********************************************************************************************************************/
+static void rm_keypad_timer_callback (timer_callback_args_t * p_args)
+{
+    rm_keypad_instance_ctrl_t * p_ctrl   = (rm_keypad_instance_ctrl_t *) p_args->p_context;
+    rm_keypad_cfg_t const     * p_cfg    = p_ctrl->p_cfg;
+    ioport_instance_t const   * p_ioport = p_cfg->p_ioport;
+    bool    changed = false;
+    uint8_t pressed = 0U;
+    uint8_t rows;
+
+    if ((TIMER_EVENT_CYCLE_END != p_args->event) || !p_ctrl->scanning)
+    {
+        return;
+    }
+
+    for (uint32_t column = 0U; column < p_cfg->num_columns; column++)
+    {
+        (void) p_ioport->p_api->pinWrite(p_ioport->p_ctrl, p_cfg->p_column_pins[column], BSP_IO_LEVEL_LOW);
+
+        if (0U != p_cfg->settle_us)
+        {
+            R_BSP_SoftwareDelay(p_cfg->settle_us, BSP_DELAY_UNITS_MICROSECONDS);
+        }
+
+        rm_keypad_rows_read(p_ctrl, &rows);
+
+        (void) p_ioport->p_api->pinWrite(p_ioport->p_ctrl, p_cfg->p_column_pins[column], BSP_IO_LEVEL_HIGH);
+
+        changed                   |= (rows != p_ctrl->raw_state[column]);
+        pressed                   |= rows;
+        p_ctrl->raw_state[column]  = rows;
+    }
+
+    /* A change restarts the debounce time. */
+    if (changed)
+    {
+        p_ctrl->stable_scans = 0U;
+    }
+    else if (p_ctrl->stable_scans < p_ctrl->debounce_scans)
+    {
+        p_ctrl->stable_scans++;
+    }
+    else
+    {
+        /* The debounced state is up to date. */
+    }
+
+    if ((p_ctrl->stable_scans >= p_ctrl->debounce_scans) && !rm_keypad_ghosted(p_ctrl))
+    {
+        rm_keypad_commit(p_ctrl);
+
+        if (0U == pressed)
+        {
+            /* Every key is released, sleep until the next key press. */
+            rm_keypad_idle(p_ctrl);
+        }
+    }
+}
@@ -0,0 +1,615 @@
+/***********************************************************************************************************************
+ * Copyright [2020] Renesas Electronics Corporation and/or its affiliates.  All Rights Reserved.
+ *
+ * This software and documentation are supplied by Renesas Electronics America Inc. and may only be used with products
+ * of Renesas Electronics Corp. and its affiliates ("Renesas").  No other uses are authorized.  Renesas products are
+ * sold pursuant to Renesas terms and conditions of sale.  Purchasers are solely responsible for the selection and use
+ * of Renesas products and Renesas assumes no liability.  No license, express or implied, to any intellectual property
+ * right is granted by Renesas. This software is protected under all applicable laws, including copyright laws. Renesas
+ * reserves the right to change or discontinue this software and/or this documentation. THE SOFTWARE AND DOCUMENTATION
+ * IS DELIVERED TO YOU "AS IS," AND RENESAS MAKES NO REPRESENTATIONS OR WARRANTIES, AND TO THE FULLEST EXTENT
+ * PERMISSIBLE UNDER APPLICABLE LAW, DISCLAIMS ALL WARRANTIES, WHETHER EXPLICITLY OR IMPLICITLY, INCLUDING WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, AND NONINFRINGEMENT, WITH RESPECT TO THE SOFTWARE OR
+ * DOCUMENTATION.  RENESAS SHALL HAVE NO LIABILITY ARISING OUT OF ANY SECURITY VULNERABILITY OR BREACH.  TO THE MAXIMUM
+ * EXTENT PERMITTED BY LAW, IN NO EVENT WILL RENESAS BE LIABLE TO YOU IN CONNECTION WITH THE SOFTWARE OR DOCUMENTATION
+ * (OR ANY PERSON OR ENTITY CLAIMING RIGHTS DERIVED FROM YOU) FOR ANY LOSS, DAMAGES, OR CLAIMS WHATSOEVER, INCLUDING,
+ * WITHOUT LIMITATION, ANY DIRECT, CONSEQUENTIAL, SPECIAL, INDIRECT, PUNITIVE, OR INCIDENTAL DAMAGES; ANY LOST PROFITS,
+ * OTHER ECONOMIC DAMAGE, PROPERTY DAMAGE, OR PERSONAL INJURY; AND EVEN IF RENESAS HAS BEEN ADVISED OF THE POSSIBILITY
+ * OF SUCH LOSS, DAMAGES, CLAIMS OR COSTS.
+ **********************************************************************************************************************/
+
+/* FSP includes. */
+#include <string.h>
+#include "rm_littlefs_block_media.h"
+#include "rm_littlefs_block_media_cfg.h"
+
+#define RM_LITTLEFS_BLOCK_MEDIA_MINIMUM_BLOCK_SIZE    (104)
+
+#ifndef RM_LITTLEFS_BLOCK_MEDIA_SEMAPHORE_TIMEOUT
+ #define RM_LITTLEFS_BLOCK_MEDIA_SEMAPHORE_TIMEOUT    UINT32_MAX
+#endif
+
+/* Number of RTOS ticks to wait for a block media request to complete. */
+#ifndef RM_LITTLEFS_BLOCK_MEDIA_TIMEOUT_TICKS
+ #define RM_LITTLEFS_BLOCK_MEDIA_TIMEOUT_TICKS        (portMAX_DELAY)
+#endif
+
+/* Block media DMA requires word aligned buffers for direct transfers. */
+#define RM_LITTLEFS_BLOCK_MEDIA_PRV_ALIGN_MASK        (3U)
+
+/** "RLBM" in ASCII, used to determine if channel is open. */
+#define RM_LITTLEFS_BLOCK_MEDIA_OPEN                  (0x524C424DULL)
+
+static fsp_err_t rm_littlefs_block_media_transfer(rm_littlefs_block_media_instance_ctrl_t * p_instance_ctrl,
+                                                  uint8_t                                 * p_data,
+                                                  uint32_t                                  sector,
+                                                  uint32_t                                  num_sectors,
+                                                  bool                                      write);
+static fsp_err_t rm_littlefs_block_media_request(rm_littlefs_block_media_instance_ctrl_t * p_instance_ctrl,
+                                                 uint8_t                                 * p_data,
+                                                 uint32_t                                  sector,
+                                                 uint32_t                                  num_sectors,
+                                                 bool                                      write);
+static fsp_err_t rm_littlefs_block_media_wait(rm_littlefs_block_media_instance_ctrl_t * p_instance_ctrl);
+
+const fsp_version_t g_rm_littlefs_block_media_version =
+{
+    .api_version_major  = RM_LITTLEFS_API_VERSION_MAJOR,
+    .api_version_minor  = RM_LITTLEFS_API_VERSION_MINOR,
+    .code_version_major = RM_LITTLEFS_BLOCK_MEDIA_CODE_VERSION_MAJOR,
+    .code_version_minor = RM_LITTLEFS_BLOCK_MEDIA_CODE_VERSION_MINOR
+};
+
+/** LittleFS API mapping for LittleFS Port interface */
+const rm_littlefs_api_t g_rm_littlefs_on_block_media =
+{
+    .open       = RM_LITTLEFS_BLOCK_MEDIA_Open,
+    .close      = RM_LITTLEFS_BLOCK_MEDIA_Close,
+    .versionGet = RM_LITTLEFS_BLOCK_MEDIA_VersionGet,
+};
+
+/*******************************************************************************************************************//**
+ * @addtogroup RM_LITTLEFS_BLOCK_MEDIA
+ * @{
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * Opens the block media driver and initializes the media. The callback of the block media instance must be
+ * rm_littlefs_block_media_callback with this control block as its context. This function blocks until the media
+ * initialization is complete, so removable media must be inserted first.
+ *
+ * Implements @ref rm_littlefs_api_t::open().
+ *
+ * @retval     FSP_SUCCESS                Success.
+ * @retval     FSP_ERR_ASSERTION          An input parameter was invalid.
+ * @retval     FSP_ERR_ALREADY_OPEN       Module is already open.
+ * @retval     FSP_ERR_INVALID_SIZE       The littlefs geometry is not a multiple of the media sector size, or the
+ *                                        filesystem does not fit on the media.
+ * @retval     FSP_ERR_INTERNAL           Failed to create the semaphore.
+ *
+ * @return     See @ref RENESAS_ERROR_CODES or functions called by this function for other possible return codes. This
+ *             function calls:
+ *             * @ref rm_block_media_api_t::open
+ *             * @ref rm_block_media_api_t::mediaInit
+ *             * @ref rm_block_media_api_t::infoGet
+ **********************************************************************************************************************/
+fsp_err_t RM_LITTLEFS_BLOCK_MEDIA_Open (rm_littlefs_ctrl_t * const p_ctrl, rm_littlefs_cfg_t const * const p_cfg)
+{
+    rm_littlefs_block_media_instance_ctrl_t * p_instance_ctrl = (rm_littlefs_block_media_instance_ctrl_t *) p_ctrl;
+
+#if RM_LITTLEFS_BLOCK_MEDIA_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ASSERT(NULL != p_cfg);
+    FSP_ASSERT(NULL != p_cfg->p_lfs_cfg);
+    FSP_ASSERT(NULL != p_cfg->p_extend);
+    FSP_ASSERT(NULL != ((rm_littlefs_block_media_cfg_t *) p_cfg->p_extend)->p_block_media);
+    FSP_ASSERT(0U == ((uint32_t) ((rm_littlefs_block_media_cfg_t *) p_cfg->p_extend)->p_align_buffer &
+                      RM_LITTLEFS_BLOCK_MEDIA_PRV_ALIGN_MASK));
+
+    FSP_ERROR_RETURN(RM_LITTLEFS_BLOCK_MEDIA_OPEN != p_instance_ctrl->open, FSP_ERR_ALREADY_OPEN);
+    FSP_ERROR_RETURN(p_cfg->p_lfs_cfg->block_size >= RM_LITTLEFS_BLOCK_MEDIA_MINIMUM_BLOCK_SIZE, FSP_ERR_INVALID_SIZE);
+#endif
+
+    rm_littlefs_block_media_cfg_t const * p_extend      = (rm_littlefs_block_media_cfg_t *) p_cfg->p_extend;
+    rm_block_media_instance_t const     * p_block_media = p_extend->p_block_media;
+    struct lfs_config const             * p_lfs_cfg     = p_cfg->p_lfs_cfg;
+
+    p_instance_ctrl->p_cfg = p_cfg;
+
+    /* Open the underlying driver and identify the media. */
+    fsp_err_t err = p_block_media->p_api->open(p_block_media->p_ctrl, p_block_media->p_cfg);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+    rm_block_media_info_t info;
+    err = p_block_media->p_api->mediaInit(p_block_media->p_ctrl);
+    if (FSP_SUCCESS == err)
+    {
+        err = p_block_media->p_api->infoGet(p_block_media->p_ctrl, &info);
+    }
+
+    /* Every littlefs access must be whole sectors, and the filesystem must fit on the media. */
+    if ((FSP_SUCCESS == err) &&
+        ((0U == info.sector_size_bytes) ||
+         (0U != (p_lfs_cfg->read_size % info.sector_size_bytes)) ||
+         (0U != (p_lfs_cfg->prog_size % info.sector_size_bytes)) ||
+         (0U != (p_lfs_cfg->block_size % info.sector_size_bytes)) ||
+         ((uint64_t) p_extend->start_sector +
+          (((uint64_t) p_lfs_cfg->block_size / info.sector_size_bytes) * p_lfs_cfg->block_count) >
+          info.num_sectors)))
+    {
+        err = FSP_ERR_INVALID_SIZE;
+    }
+
+    if (FSP_SUCCESS != err)
+    {
+        p_block_media->p_api->close(p_block_media->p_ctrl);
+
+        return err;
+    }
+
+    p_instance_ctrl->sector_size       = info.sector_size_bytes;
+    p_instance_ctrl->sectors_per_block = p_lfs_cfg->block_size / info.sector_size_bytes;
+
+#if BSP_CFG_RTOS == 2
+    p_instance_ctrl->current_task = NULL;
+#endif
+
+#if LFS_THREAD_SAFE
+    p_instance_ctrl->xSemaphore = xSemaphoreCreateMutexStatic(&p_instance_ctrl->xMutexBuffer);
+
+    if (NULL == p_instance_ctrl->xSemaphore)
+    {
+        p_block_media->p_api->close(p_block_media->p_ctrl);
+
+        return FSP_ERR_INTERNAL;
+    }
+#endif
+
+    /* This module is now open. */
+    p_instance_ctrl->open = RM_LITTLEFS_BLOCK_MEDIA_OPEN;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Closes the lower level driver.
+ *
+ * Implements @ref rm_littlefs_api_t::close().
+ *
+ * @retval FSP_SUCCESS           Media device closed.
+ * @retval FSP_ERR_ASSERTION     An input parameter was invalid.
+ * @retval FSP_ERR_NOT_OPEN      Module not open.
+ *
+ * @return See @ref RENESAS_ERROR_CODES or functions called by this function for other possible return codes.
+ *         This function calls:
+ *             * @ref rm_block_media_api_t::close
+ **********************************************************************************************************************/
+fsp_err_t RM_LITTLEFS_BLOCK_MEDIA_Close (rm_littlefs_ctrl_t * const p_ctrl)
+{
+    rm_littlefs_block_media_instance_ctrl_t * p_instance_ctrl = (rm_littlefs_block_media_instance_ctrl_t *) p_ctrl;
+#if RM_LITTLEFS_BLOCK_MEDIA_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_instance_ctrl);
+    FSP_ERROR_RETURN(RM_LITTLEFS_BLOCK_MEDIA_OPEN == p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+
+    p_instance_ctrl->open = 0;
+
+    rm_littlefs_block_media_cfg_t const * p_extend =
+        (rm_littlefs_block_media_cfg_t *) p_instance_ctrl->p_cfg->p_extend;
+    rm_block_media_instance_t const * p_block_media = p_extend->p_block_media;
+
+    p_block_media->p_api->close(p_block_media->p_ctrl);
+
+#if LFS_THREAD_SAFE
+    vSemaphoreDelete(p_instance_ctrl->xSemaphore);
+#endif
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Returns the version of this module.
+ *
+ * Implements @ref rm_littlefs_api_t::versionGet().
+ *
+ * @retval FSP_SUCCESS        Success.
+ * @retval FSP_ERR_ASSERTION  Failed in acquiring version information.
+ **********************************************************************************************************************/
+fsp_err_t RM_LITTLEFS_BLOCK_MEDIA_VersionGet (fsp_version_t * const p_version)
+{
+#if RM_LITTLEFS_BLOCK_MEDIA_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_version);
+#endif
+
+    p_version->version_id = g_rm_littlefs_block_media_version.version_id;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @} (end addtogroup RM_LITTLEFS_BLOCK_MEDIA)
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * Reads whole sectors from the media. Negative error codes are propogated to the user.
+ *
+ * @param[in]  c           Pointer to the LittleFS config block.
+ * @param[in]  block       The block number
+ * @param[in]  off         Offset in bytes, a multiple of read_size
+ * @param[out] buffer      The buffer to copy data into
+ * @param[in]  size        The size in bytes, a multiple of read_size
+ *
+ * @retval     LFS_ERR_OK  Read is complete.
+ * @retval     LFS_ERR_IO  Lower layer is not open or failed to read the media.
+ **********************************************************************************************************************/
+int rm_littlefs_block_media_read (const struct lfs_config * c,
+                                  lfs_block_t               block,
+                                  lfs_off_t                 off,
+                                  void                    * buffer,
+                                  lfs_size_t                size)
+{
+    rm_littlefs_block_media_instance_ctrl_t * p_instance_ctrl = (rm_littlefs_block_media_instance_ctrl_t *) c->context;
+#if RM_LITTLEFS_BLOCK_MEDIA_CFG_PARAM_CHECKING_ENABLE
+    FSP_ERROR_RETURN(RM_LITTLEFS_BLOCK_MEDIA_OPEN == p_instance_ctrl->open, LFS_ERR_IO);
+#endif
+
+    rm_littlefs_block_media_cfg_t const * p_extend =
+        (rm_littlefs_block_media_cfg_t *) p_instance_ctrl->p_cfg->p_extend;
+    uint32_t sector = p_extend->start_sector + (block * p_instance_ctrl->sectors_per_block) +
+                      (off / p_instance_ctrl->sector_size);
+
+    fsp_err_t err = rm_littlefs_block_media_transfer(p_instance_ctrl,
+                                                     (uint8_t *) buffer,
+                                                     sector,
+                                                     size / p_instance_ctrl->sector_size,
+                                                     false);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, LFS_ERR_IO);
+
+    return LFS_ERR_OK;
+}
+
+/*******************************************************************************************************************//**
+ * Writes whole sectors to the media.
+ *
+ * @param[in]  c           Pointer to the LittleFS config block.
+ * @param[in]  block       The block number
+ * @param[in]  off         Offset in bytes, a multiple of prog_size
+ * @param[in]  buffer      The buffer containing data to be written.
+ * @param[in]  size        The size in bytes, a multiple of prog_size
+ *
+ * @retval     LFS_ERR_OK  Success.
+ * @retval     LFS_ERR_IO  Lower layer is not open or failed to write the media.
+ **********************************************************************************************************************/
+int rm_littlefs_block_media_write (const struct lfs_config * c,
+                                   lfs_block_t               block,
+                                   lfs_off_t                 off,
+                                   const void              * buffer,
+                                   lfs_size_t                size)
+{
+    rm_littlefs_block_media_instance_ctrl_t * p_instance_ctrl = (rm_littlefs_block_media_instance_ctrl_t *) c->context;
+#if RM_LITTLEFS_BLOCK_MEDIA_CFG_PARAM_CHECKING_ENABLE
+    FSP_ERROR_RETURN(RM_LITTLEFS_BLOCK_MEDIA_OPEN == p_instance_ctrl->open, LFS_ERR_IO);
+#endif
+
+    rm_littlefs_block_media_cfg_t const * p_extend =
+        (rm_littlefs_block_media_cfg_t *) p_instance_ctrl->p_cfg->p_extend;
+    uint32_t sector = p_extend->start_sector + (block * p_instance_ctrl->sectors_per_block) +
+                      (off / p_instance_ctrl->sector_size);
+
+    /* The buffer is only read. */
+    fsp_err_t err = rm_littlefs_block_media_transfer(p_instance_ctrl,
+                                                     (uint8_t *) buffer,
+                                                     sector,
+                                                     size / p_instance_ctrl->sector_size,
+                                                     true);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, LFS_ERR_IO);
+
+    return LFS_ERR_OK;
+}
+
+/*******************************************************************************************************************//**
+ * Erase the logical block. The media is only erased if rm_littlefs_block_media_cfg_t::erase_enable is set, since
+ * littlefs does not depend on the erased value and the media can be written without an erase.
+ *
+ * @param[in]  c           Pointer to the LittleFS config block.
+ * @param[in]  block       The logical block number
+ *
+ * @retval     LFS_ERR_OK  Success.
+ * @retval     LFS_ERR_IO  Lower layer is not open or failed to erase the media.
+ **********************************************************************************************************************/
+int rm_littlefs_block_media_erase (const struct lfs_config * c, lfs_block_t block)
+{
+    rm_littlefs_block_media_instance_ctrl_t * p_instance_ctrl = (rm_littlefs_block_media_instance_ctrl_t *) c->context;
+#if RM_LITTLEFS_BLOCK_MEDIA_CFG_PARAM_CHECKING_ENABLE
+    FSP_ERROR_RETURN(RM_LITTLEFS_BLOCK_MEDIA_OPEN == p_instance_ctrl->open, LFS_ERR_IO);
+#endif
+    rm_littlefs_block_media_cfg_t const * p_extend =
+        (rm_littlefs_block_media_cfg_t *) p_instance_ctrl->p_cfg->p_extend;
+
+    if (p_extend->erase_enable)
+    {
+        rm_block_media_instance_t const * p_block_media = p_extend->p_block_media;
+
+#if BSP_CFG_RTOS == 2
+        p_instance_ctrl->current_task = xTaskGetCurrentTaskHandle();
+#else
+        p_instance_ctrl->event_ready = false;
+#endif
+        p_instance_ctrl->last_event = (rm_block_media_event_t) 0;
+
+        /* Call the underlying driver. */
+        fsp_err_t err = p_block_media->p_api->erase(p_block_media->p_ctrl,
+                                                    p_extend->start_sector +
+                                                    (block * p_instance_ctrl->sectors_per_block),
+                                                    p_instance_ctrl->sectors_per_block);
+
+        /* Wait for the erase to complete. Erase failed. Return IO error. Negative error codes are propogated to the
+         * user. */
+        if (FSP_SUCCESS == err)
+        {
+            err = rm_littlefs_block_media_wait(p_instance_ctrl);
+        }
+
+        FSP_ERROR_RETURN(FSP_SUCCESS == err, LFS_ERR_IO);
+    }
+
+    return LFS_ERR_OK;
+}
+
+/*******************************************************************************************************************//**
+ * Locks the filesystem.
+ *
+ * @retval     LFS_ERR_OK  Success.
+ * @retval     LFS_ERR_IO  Lower layer is not open or failed to lock the media.
+ **********************************************************************************************************************/
+int rm_littlefs_block_media_lock (const struct lfs_config * c)
+{
+#if LFS_THREAD_SAFE
+    rm_littlefs_block_media_instance_ctrl_t * p_instance_ctrl = (rm_littlefs_block_media_instance_ctrl_t *) c->context;
+ #if RM_LITTLEFS_BLOCK_MEDIA_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_instance_ctrl);
+    FSP_ERROR_RETURN(RM_LITTLEFS_BLOCK_MEDIA_OPEN == p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
+ #endif
+    BaseType_t err = xSemaphoreTake(p_instance_ctrl->xSemaphore, RM_LITTLEFS_BLOCK_MEDIA_SEMAPHORE_TIMEOUT);
+
+    FSP_ERROR_RETURN(true == err, LFS_ERR_IO);
+
+    return LFS_ERR_OK;
+#else
+    FSP_PARAMETER_NOT_USED(c);
+
+    return LFS_ERR_IO;
+#endif
+}
+
+/*******************************************************************************************************************//**
+ * Unlocks the filesystem.
+ *
+ * @retval     LFS_ERR_OK  Success.
+ * @retval     LFS_ERR_IO  Lower layer is not open or failed to unlock the media.
+ **********************************************************************************************************************/
+int rm_littlefs_block_media_unlock (const struct lfs_config * c)
+{
+#if LFS_THREAD_SAFE
+    rm_littlefs_block_media_instance_ctrl_t * p_instance_ctrl = (rm_littlefs_block_media_instance_ctrl_t *) c->context;
+ #if RM_LITTLEFS_BLOCK_MEDIA_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_instance_ctrl);
+    FSP_ERROR_RETURN(RM_LITTLEFS_BLOCK_MEDIA_OPEN == p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
+ #endif
+    BaseType_t err = xSemaphoreGive(p_instance_ctrl->xSemaphore);
+
+    FSP_ERROR_RETURN(true == err, LFS_ERR_IO);
+
+    return LFS_ERR_OK;
+#else
+    FSP_PARAMETER_NOT_USED(c);
+
+    return LFS_ERR_IO;
+#endif
+}
+
+/*******************************************************************************************************************//**
+ * Stub function required by LittleFS. All calls wait for the block media request to complete (and for the media to
+ * be no longer busy after a write or erase).
+ * @param[in]  c           Pointer to the LittleFS config block.
+ * @retval     LFS_ERR_OK  Success.
+ **********************************************************************************************************************/
+int rm_littlefs_block_media_sync (const struct lfs_config * c)
+{
+    FSP_PARAMETER_NOT_USED(c);
+
+    return LFS_ERR_OK;
+}
+
+/*******************************************************************************************************************//**
+ * Block media callback. Wakes the thread waiting for the request in flight.
+ *
+ * @param[in] p_args     Pointer to block media callback structure.
+ **********************************************************************************************************************/
+void rm_littlefs_block_media_callback (rm_block_media_callback_args_t * p_args)
+{
+    rm_littlefs_block_media_instance_ctrl_t * p_instance_ctrl =
+        (rm_littlefs_block_media_instance_ctrl_t *) p_args->p_context;
+
+    if ((RM_BLOCK_MEDIA_EVENT_OPERATION_COMPLETE | RM_BLOCK_MEDIA_EVENT_POLL_STATUS |
+         RM_BLOCK_MEDIA_EVENT_ERROR) & p_args->event)
+    {
+        p_instance_ctrl->last_event |= p_args->event;
+
+#if BSP_CFG_RTOS == 2
+
+        /* Notify the task that the request is complete. */
+        if (NULL != p_instance_ctrl->current_task)
+        {
+            BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+            vTaskNotifyGiveFromISR(p_instance_ctrl->current_task, &xHigherPriorityTaskWoken);
+
+            /* No request in flight, so no task to notify. */
+            p_instance_ctrl->current_task = NULL;
+
+            portYIELD_FROM_ISR(xHigherPriorityTaskWoken);
+        }
+
+#else
+        p_instance_ctrl->event_ready = true;
+#endif
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Transfers whole sectors. Word aligned buffers are transferred with one request. Other buffers are staged one sector
+ * at a time through rm_littlefs_block_media_cfg_t::p_align_buffer.
+ *
+ * @param[in]     p_instance_ctrl  Pointer to instance control structure.
+ * @param[in,out] p_data           Data to write, or buffer to read into.
+ * @param[in]     sector           First sector.
+ * @param[in]     num_sectors      Number of sectors.
+ * @param[in]     write            True to write, false to read.
+ *
+ * @retval     FSP_SUCCESS             Transfer is complete.
+ * @retval     FSP_ERR_INVALID_ALIGNMENT  The buffer is not word aligned and there is no alignment buffer.
+ * @return See @ref RENESAS_ERROR_CODES or functions called by this function for other possible return codes.
+ **********************************************************************************************************************/
+static fsp_err_t rm_littlefs_block_media_transfer (rm_littlefs_block_media_instance_ctrl_t * p_instance_ctrl,
+                                                   uint8_t                                 * p_data,
+                                                   uint32_t                                  sector,
+                                                   uint32_t                                  num_sectors,
+                                                   bool                                      write)
+{
+    if (0U == ((uint32_t) p_data & RM_LITTLEFS_BLOCK_MEDIA_PRV_ALIGN_MASK))
+    {
+        return rm_littlefs_block_media_request(p_instance_ctrl, p_data, sector, num_sectors, write);
+    }
+
+    rm_littlefs_block_media_cfg_t const * p_extend =
+        (rm_littlefs_block_media_cfg_t *) p_instance_ctrl->p_cfg->p_extend;
+    uint8_t * p_align = p_extend->p_align_buffer;
+    FSP_ERROR_RETURN(NULL != p_align, FSP_ERR_INVALID_ALIGNMENT);
+
+    fsp_err_t err = FSP_SUCCESS;
+    for (uint32_t i = 0U; (i < num_sectors) && (FSP_SUCCESS == err); i++)
+    {
+        if (write)
+        {
+            memcpy(p_align, p_data, p_instance_ctrl->sector_size);
+            err = rm_littlefs_block_media_request(p_instance_ctrl, p_align, sector + i, 1U, true);
+        }
+        else
+        {
+            err = rm_littlefs_block_media_request(p_instance_ctrl, p_align, sector + i, 1U, false);
+            memcpy(p_data, p_align, p_instance_ctrl->sector_size);
+        }
+
+        p_data += p_instance_ctrl->sector_size;
+    }
+
+    return err;
+}
+
+/*******************************************************************************************************************//**
+ * Starts one block media read or write and waits for it to complete.
+ *
+ * @param[in]     p_instance_ctrl  Pointer to instance control structure.
+ * @param[in,out] p_data           Word aligned data to write, or buffer to read into.
+ * @param[in]     sector           First sector.
+ * @param[in]     num_sectors      Number of sectors.
+ * @param[in]     write            True to write, false to read.
+ *
+ * @retval     FSP_SUCCESS             Request is complete.
+ * @return See @ref RENESAS_ERROR_CODES or functions called by this function for other possible return codes.
+ *         This function calls:
+ *             * @ref rm_block_media_api_t::read
+ *             * @ref rm_block_media_api_t::write
+ **********************************************************************************************************************/
+static fsp_err_t rm_littlefs_block_media_request (rm_littlefs_block_media_instance_ctrl_t * p_instance_ctrl,
+                                                  uint8_t                                 * p_data,
+                                                  uint32_t                                  sector,
+                                                  uint32_t                                  num_sectors,
+                                                  bool                                      write)
+{
+    rm_littlefs_block_media_cfg_t const * p_extend =
+        (rm_littlefs_block_media_cfg_t *) p_instance_ctrl->p_cfg->p_extend;
+    rm_block_media_instance_t const * p_block_media = p_extend->p_block_media;
+    fsp_err_t err;
+
+#if BSP_CFG_RTOS == 2
+
+    /* Store the handle of the calling task. */
+    p_instance_ctrl->current_task = xTaskGetCurrentTaskHandle();
+#else
+    p_instance_ctrl->event_ready = false;
+#endif
+
+    p_instance_ctrl->last_event = (rm_block_media_event_t) 0;
+
+    if (write)
+    {
+        err = p_block_media->p_api->write(p_block_media->p_ctrl, p_data, sector, num_sectors);
+    }
+    else
+    {
+        err = p_block_media->p_api->read(p_block_media->p_ctrl, p_data, sector, num_sectors);
+    }
+
+    if (FSP_SUCCESS == err)
+    {
+        err = rm_littlefs_block_media_wait(p_instance_ctrl);
+    }
+
+    return err;
+}
+
+/*******************************************************************************************************************//**
+ * Waits for the block media request in flight to complete. When FreeRTOS is used the calling thread blocks on a task
+ * notification given by the block media callback, so the CPU is free during the transfer. If the media reports that
+ * the write or erase continues in the background, its status is polled until it is no longer busy, yielding between
+ * polls.
+ *
+ * @param[in]  p_instance_ctrl  Pointer to instance control structure.
+ *
+ * @retval     FSP_SUCCESS      The request is complete and the media is no longer busy.
+ * @retval     FSP_ERR_TIMEOUT  The request did not complete in RM_LITTLEFS_BLOCK_MEDIA_TIMEOUT_TICKS.
+ * @retval     FSP_ERR_INTERNAL The block media reported an error.
+ *
+ * @return     See @ref RENESAS_ERROR_CODES or functions called by this function for other possible return codes.
+ *             This function calls:
+ *             * @ref rm_block_media_api_t::statusGet
+ **********************************************************************************************************************/
+static fsp_err_t rm_littlefs_block_media_wait (rm_littlefs_block_media_instance_ctrl_t * p_instance_ctrl)
+{
+#if BSP_CFG_RTOS == 2
+
+    /* Clear the notification on take, so it acts as a binary semaphore. */
+    uint32_t ulNotificationValue = ulTaskNotifyTake(pdTRUE, RM_LITTLEFS_BLOCK_MEDIA_TIMEOUT_TICKS);
+    FSP_ERROR_RETURN(1U == ulNotificationValue, FSP_ERR_TIMEOUT);
+#else
+    while (!p_instance_ctrl->event_ready)
+    {
+        ;
+    }
+#endif
+
+    FSP_ERROR_RETURN(0U == (RM_BLOCK_MEDIA_EVENT_ERROR & p_instance_ctrl->last_event), FSP_ERR_INTERNAL);
+
+    if (RM_BLOCK_MEDIA_EVENT_POLL_STATUS & p_instance_ctrl->last_event)
+    {
+        rm_littlefs_block_media_cfg_t const * p_extend =
+            (rm_littlefs_block_media_cfg_t *) p_instance_ctrl->p_cfg->p_extend;
+        rm_block_media_instance_t const * p_block_media = p_extend->p_block_media;
+        rm_block_media_status_t           status;
+
+        fsp_err_t err = p_block_media->p_api->statusGet(p_block_media->p_ctrl, &status);
+        while ((FSP_SUCCESS == err) && status.busy)
+        {
+#if BSP_CFG_RTOS == 2
+            taskYIELD();
+#endif
+
+            err = p_block_media->p_api->statusGet(p_block_media->p_ctrl, &status);
+        }
+
+        return err;
+    }
+
+    return FSP_SUCCESS;
+}
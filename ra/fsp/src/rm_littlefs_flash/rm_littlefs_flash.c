@@ -46,6 +46,17 @@ static const uint32_t rm_littlefs_flash_data_start = RM_LITTLEFS_FLASH_DATA_STAR
 /** "RLFS" in ASCII, used to determine if channel is open. */
 #define RM_LITTLEFS_FLASH_OPEN           (0x524C4653ULL)
 
+/* Tag of a read cache entry that does not hold a block. */
+#define RM_LITTLEFS_FLASH_CACHE_TAG_INVALID    (UINT32_MAX)
+
+#define RM_LITTLEFS_FLASH_BITMAP_WORDS(blocks)    (((blocks) + 31U) / 32U)
+#define RM_LITTLEFS_FLASH_BITMAP_MASK(block)      (1U << ((block) % 32U))
+
+static uint8_t * rm_littlefs_flash_cache_find(rm_littlefs_flash_instance_ctrl_t * p_instance_ctrl, lfs_block_t block);
+static void      rm_littlefs_flash_cache_invalidate(rm_littlefs_flash_instance_ctrl_t * p_instance_ctrl,
+                                                    lfs_block_t                         block);
+static int rm_littlefs_flash_traverse_cb(void * p_data, lfs_block_t block);
+
 const fsp_version_t g_rm_littlefs_flash_version =
 {
     .api_version_major  = RM_LITTLEFS_API_VERSION_MAJOR,
@@ -104,11 +115,40 @@ fsp_err_t RM_LITTLEFS_FLASH_Open (rm_littlefs_ctrl_t * const p_ctrl, rm_littlefs
 
     FSP_ERROR_RETURN((p_cfg->p_lfs_cfg->block_size * p_cfg->p_lfs_cfg->block_count) <= BSP_DATA_FLASH_SIZE_BYTES,
                      FSP_ERR_INVALID_SIZE);
+
+    if (NULL != p_extend->p_cache)
+    {
+        FSP_ASSERT(NULL != p_extend->p_cache_tags);
+        FSP_ASSERT(0U != p_extend->cache_blocks);
+    }
+
+    if (NULL != p_extend->p_erased)
+    {
+        FSP_ASSERT(NULL != p_extend->p_in_use);
+    }
 #else
     rm_littlefs_flash_cfg_t const * p_extend = (rm_littlefs_flash_cfg_t *) p_cfg->p_extend;
 #endif
 
-    p_instance_ctrl->p_cfg = p_cfg;
+    p_instance_ctrl->p_cfg      = p_cfg;
+    p_instance_ctrl->cache_next = 0U;
+    p_instance_ctrl->generation = 0U;
+
+    /* The read cache starts empty. */
+    if (NULL != p_extend->p_cache)
+    {
+        for (uint32_t i = 0U; i < p_extend->cache_blocks; i++)
+        {
+            p_extend->p_cache_tags[i] = RM_LITTLEFS_FLASH_CACHE_TAG_INVALID;
+        }
+    }
+
+    /* No block is known to be erased until RM_LITTLEFS_FLASH_IdleErase has checked it. */
+    if (NULL != p_extend->p_erased)
+    {
+        memset(p_extend->p_erased, 0,
+               RM_LITTLEFS_FLASH_BITMAP_WORDS(p_cfg->p_lfs_cfg->block_count) * sizeof(uint32_t));
+    }
 
     /* Open the underlying driver. */
     flash_instance_t const * p_flash = p_extend->p_flash;
@@ -186,6 +226,102 @@ fsp_err_t RM_LITTLEFS_FLASH_VersionGet (fsp_version_t * const p_version)
     return FSP_SUCCESS;
 }
 
+/*******************************************************************************************************************//**
+ * Erases blocks that are not used by the filesystem so that a later allocation does not have to wait for the erase.
+ * Call this from an idle thread or the main loop while the filesystem is mounted. Blocks that are already blank are
+ * only blank checked. The erase requested by LittleFS is skipped for any block erased here until that block is written.
+ *
+ * If LittleFS writes or erases a block while the used blocks are being collected, this function returns without
+ * erasing so that a block allocated in the meantime is never erased. The next call will try again.
+ *
+ * @param[in]  p_ctrl          Pointer to the control structure.
+ * @param[in]  p_lfs           Pointer to the mounted LittleFS instance using this block device.
+ * @param[in]  max_blocks      Maximum number of blocks to erase or blank check in this call.
+ *
+ * @retval FSP_SUCCESS           Erase-ahead is complete for this call.
+ * @retval FSP_ERR_ASSERTION     An input parameter was invalid.
+ * @retval FSP_ERR_NOT_OPEN      Module not open.
+ * @retval FSP_ERR_UNSUPPORTED   Erase-ahead is not enabled in the configuration.
+ * @retval FSP_ERR_INTERNAL      LittleFS failed to traverse the filesystem.
+ *
+ * @return See @ref RENESAS_ERROR_CODES or functions called by this function for other possible return codes.
+ *         This function calls:
+ *             * @ref flash_api_t::blankCheck
+ *             * @ref flash_api_t::erase
+ **********************************************************************************************************************/
+fsp_err_t RM_LITTLEFS_FLASH_IdleErase (rm_littlefs_ctrl_t * const p_ctrl, lfs_t * const p_lfs, uint32_t max_blocks)
+{
+    rm_littlefs_flash_instance_ctrl_t * p_instance_ctrl = (rm_littlefs_flash_instance_ctrl_t *) p_ctrl;
+#if RM_LITTLEFS_FLASH_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_instance_ctrl);
+    FSP_ASSERT(NULL != p_lfs);
+    FSP_ERROR_RETURN(RM_LITTLEFS_FLASH_OPEN == p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+
+    rm_littlefs_flash_cfg_t const * p_extend  = (rm_littlefs_flash_cfg_t *) p_instance_ctrl->p_cfg->p_extend;
+    flash_instance_t const        * p_flash   = p_extend->p_flash;
+    struct lfs_config const       * p_lfs_cfg = p_instance_ctrl->p_cfg->p_lfs_cfg;
+
+    FSP_ERROR_RETURN(NULL != p_extend->p_erased, FSP_ERR_UNSUPPORTED);
+
+    /* Collect the blocks used by the filesystem, including blocks allocated by open files. */
+    memset(p_extend->p_in_use, 0, RM_LITTLEFS_FLASH_BITMAP_WORDS(p_lfs_cfg->block_count) * sizeof(uint32_t));
+    uint32_t generation = p_instance_ctrl->generation;
+    int      lfs_err    = lfs_fs_traverse(p_lfs, rm_littlefs_flash_traverse_cb, p_instance_ctrl);
+    FSP_ERROR_RETURN(lfs_err >= 0, FSP_ERR_INTERNAL);
+
+    fsp_err_t err = FSP_SUCCESS;
+    for (lfs_block_t block = 0U; (block < p_lfs_cfg->block_count) && (max_blocks > 0U) && (FSP_SUCCESS == err); block++)
+    {
+        uint32_t word = block / 32U;
+        uint32_t mask = RM_LITTLEFS_FLASH_BITMAP_MASK(block);
+
+        if ((p_extend->p_in_use[word] & mask) || (p_extend->p_erased[word] & mask))
+        {
+            continue;
+        }
+
+#if LFS_THREAD_SAFE
+        FSP_ERROR_RETURN(pdTRUE == xSemaphoreTake(p_instance_ctrl->xSemaphore, RM_LITTLEFS_FLASH_SEMAPHORE_TIMEOUT),
+                         FSP_ERR_INTERNAL);
+#endif
+
+        /* The block may have been allocated since the traversal if LittleFS has accessed the flash. */
+        if (generation != p_instance_ctrl->generation)
+        {
+            max_blocks = 0U;
+        }
+        else
+        {
+            uint32_t       address = rm_littlefs_flash_data_start + (p_lfs_cfg->block_size * block);
+            flash_result_t result  = FLASH_RESULT_NOT_BLANK;
+
+            err = p_flash->p_api->blankCheck(p_flash->p_ctrl, address, p_lfs_cfg->block_size, &result);
+
+            if ((FSP_SUCCESS == err) && (FLASH_RESULT_BLANK != result))
+            {
+                err = p_flash->p_api->erase(p_flash->p_ctrl,
+                                            address,
+                                            p_lfs_cfg->block_size / RM_LITTLEFS_FLASH_DATA_BLOCK_SIZE);
+                rm_littlefs_flash_cache_invalidate(p_instance_ctrl, block);
+            }
+
+            if (FSP_SUCCESS == err)
+            {
+                p_extend->p_erased[word] |= mask;
+            }
+
+            max_blocks--;
+        }
+
+#if LFS_THREAD_SAFE
+        xSemaphoreGive(p_instance_ctrl->xSemaphore);
+#endif
+    }
+
+    return err;
+}
+
 /*******************************************************************************************************************//**
  * @} (end addtogroup RM_LITTLEFS_FLASH)
  **********************************************************************************************************************/
@@ -213,10 +349,37 @@ int rm_littlefs_flash_read (const struct lfs_config * c,
     FSP_ERROR_RETURN(RM_LITTLEFS_FLASH_OPEN == p_instance_ctrl->open, LFS_ERR_IO);
 #endif
 
-    /* Read directly from the flash. */
-    memcpy(buffer,
-           (uint8_t *) (rm_littlefs_flash_data_start + (p_instance_ctrl->p_cfg->p_lfs_cfg->block_size * block) + off),
-           size);
+    rm_littlefs_flash_cfg_t const * p_extend = (rm_littlefs_flash_cfg_t *) p_instance_ctrl->p_cfg->p_extend;
+    uint8_t * p_src = NULL;
+
+    if (NULL != p_extend->p_cache)
+    {
+        /* Hold the whole block in the read cache so later reads of the same block do not access the flash. */
+        p_src = rm_littlefs_flash_cache_find(p_instance_ctrl, block);
+
+        if (NULL == p_src)
+        {
+            uint32_t entry = p_instance_ctrl->cache_next;
+            p_instance_ctrl->cache_next = (entry + 1U) % p_extend->cache_blocks;
+
+            p_src = &p_extend->p_cache[entry * p_instance_ctrl->p_cfg->p_lfs_cfg->block_size];
+            memcpy(p_src,
+                   (uint8_t *) (rm_littlefs_flash_data_start +
+                                (p_instance_ctrl->p_cfg->p_lfs_cfg->block_size * block)),
+                   p_instance_ctrl->p_cfg->p_lfs_cfg->block_size);
+            p_extend->p_cache_tags[entry] = block;
+        }
+
+        p_src += off;
+    }
+    else
+    {
+        /* Read directly from the flash. */
+        p_src =
+            (uint8_t *) (rm_littlefs_flash_data_start + (p_instance_ctrl->p_cfg->p_lfs_cfg->block_size * block) + off);
+    }
+
+    memcpy(buffer, p_src, size);
 
     return LFS_ERR_OK;
 }
@@ -255,8 +418,28 @@ int rm_littlefs_flash_write (const struct lfs_config * c,
                                (p_instance_ctrl->p_cfg->p_lfs_cfg->block_size * block) + off),
                               size);
 
+    p_instance_ctrl->generation++;
+
+    /* The block is no longer erased once it is written. */
+    if (NULL != p_extend->p_erased)
+    {
+        p_extend->p_erased[block / 32U] &= ~RM_LITTLEFS_FLASH_BITMAP_MASK(block);
+    }
+
     /* Write failed. Return IO error. Negative error codes are propogated to the user. */
-    FSP_ERROR_RETURN(FSP_SUCCESS == err, LFS_ERR_IO);
+    if (FSP_SUCCESS != err)
+    {
+        rm_littlefs_flash_cache_invalidate(p_instance_ctrl, block);
+
+        return LFS_ERR_IO;
+    }
+
+    /* Keep a cached copy of the block up to date. */
+    uint8_t * p_cached = rm_littlefs_flash_cache_find(p_instance_ctrl, block);
+    if (NULL != p_cached)
+    {
+        memcpy(p_cached + off, buffer, size);
+    }
 
     return LFS_ERR_OK;
 }
@@ -279,6 +462,17 @@ int rm_littlefs_flash_erase (const struct lfs_config * c, lfs_block_t block)
     rm_littlefs_flash_cfg_t const * p_extend = (rm_littlefs_flash_cfg_t *) p_instance_ctrl->p_cfg->p_extend;
     flash_instance_t const        * p_flash  = p_extend->p_flash;
 
+    p_instance_ctrl->generation++;
+
+    /* The block was erased ahead of time and has not been written since. */
+    uint32_t mask = RM_LITTLEFS_FLASH_BITMAP_MASK(block);
+    if ((NULL != p_extend->p_erased) && (p_extend->p_erased[block / 32U] & mask))
+    {
+        return LFS_ERR_OK;
+    }
+
+    rm_littlefs_flash_cache_invalidate(p_instance_ctrl, block);
+
     /* Call the underlying driver. */
     fsp_err_t err =
         p_flash->p_api->erase(p_flash->p_ctrl,
@@ -288,6 +482,11 @@ int rm_littlefs_flash_erase (const struct lfs_config * c, lfs_block_t block)
     /* Erase failed. Return IO error. Negative error codes are propogated to the user. */
     FSP_ERROR_RETURN(FSP_SUCCESS == err, LFS_ERR_IO);
 
+    if (NULL != p_extend->p_erased)
+    {
+        p_extend->p_erased[block / 32U] |= mask;
+    }
+
     return LFS_ERR_OK;
 }
 
@@ -358,3 +557,72 @@ int rm_littlefs_flash_sync (const struct lfs_config * c)
 
     return LFS_ERR_OK;
 }
+
+/*******************************************************************************************************************//**
+ * Finds a block in the read cache.
+ *
+ * @param[in]  p_instance_ctrl  Pointer to the control structure.
+ * @param[in]  block            The logical block number
+ *
+ * @return     Pointer to the cached copy of the block, or NULL if the block is not cached.
+ **********************************************************************************************************************/
+static uint8_t * rm_littlefs_flash_cache_find (rm_littlefs_flash_instance_ctrl_t * p_instance_ctrl, lfs_block_t block)
+{
+    rm_littlefs_flash_cfg_t const * p_extend = (rm_littlefs_flash_cfg_t *) p_instance_ctrl->p_cfg->p_extend;
+
+    if (NULL != p_extend->p_cache)
+    {
+        for (uint32_t i = 0U; i < p_extend->cache_blocks; i++)
+        {
+            if (block == p_extend->p_cache_tags[i])
+            {
+                return &p_extend->p_cache[i * p_instance_ctrl->p_cfg->p_lfs_cfg->block_size];
+            }
+        }
+    }
+
+    return NULL;
+}
+
+/*******************************************************************************************************************//**
+ * Removes a block from the read cache.
+ *
+ * @param[in]  p_instance_ctrl  Pointer to the control structure.
+ * @param[in]  block            The logical block number
+ **********************************************************************************************************************/
+static void rm_littlefs_flash_cache_invalidate (rm_littlefs_flash_instance_ctrl_t * p_instance_ctrl, lfs_block_t block)
+{
+    rm_littlefs_flash_cfg_t const * p_extend = (rm_littlefs_flash_cfg_t *) p_instance_ctrl->p_cfg->p_extend;
+
+    if (NULL != p_extend->p_cache)
+    {
+        for (uint32_t i = 0U; i < p_extend->cache_blocks; i++)
+        {
+            if (block == p_extend->p_cache_tags[i])
+            {
+                p_extend->p_cache_tags[i] = RM_LITTLEFS_FLASH_CACHE_TAG_INVALID;
+            }
+        }
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Called by lfs_fs_traverse for each block used by the filesystem.
+ *
+ * @param[in]  p_data      Pointer to the control structure.
+ * @param[in]  block       The logical block number
+ *
+ * @retval     LFS_ERR_OK  Continue the traversal.
+ **********************************************************************************************************************/
+static int rm_littlefs_flash_traverse_cb (void * p_data, lfs_block_t block)
+{
+    rm_littlefs_flash_instance_ctrl_t * p_instance_ctrl = (rm_littlefs_flash_instance_ctrl_t *) p_data;
+    rm_littlefs_flash_cfg_t const     * p_extend        = (rm_littlefs_flash_cfg_t *) p_instance_ctrl->p_cfg->p_extend;
+
+    if (block < p_instance_ctrl->p_cfg->p_lfs_cfg->block_count)
+    {
+        p_extend->p_in_use[block / 32U] |= RM_LITTLEFS_FLASH_BITMAP_MASK(block);
+    }
+
+    return LFS_ERR_OK;
+}
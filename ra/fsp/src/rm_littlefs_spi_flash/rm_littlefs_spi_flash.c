@@ -0,0 +1,427 @@
+/***********************************************************************************************************************
+ * Copyright [2020] Renesas Electronics Corporation and/or its affiliates.  All Rights Reserved.
+ *
+ * This software and documentation are supplied by Renesas Electronics America Inc. and may only be used with products
+ * of Renesas Electronics Corp. and its affiliates ("Renesas").  No other uses are authorized.  Renesas products are
+ * sold pursuant to Renesas terms and conditions of sale.  Purchasers are solely responsible for the selection and use
+ * of Renesas products and Renesas assumes no liability.  No license, express or implied, to any intellectual property
+ * right is granted by Renesas. This software is protected under all applicable laws, including copyright laws. Renesas
+ * reserves the right to change or discontinue this software and/or this documentation. THE SOFTWARE AND DOCUMENTATION
+ * IS DELIVERED TO YOU "AS IS," AND RENESAS MAKES NO REPRESENTATIONS OR WARRANTIES, AND TO THE FULLEST EXTENT
+ * PERMISSIBLE UNDER APPLICABLE LAW, DISCLAIMS ALL WARRANTIES, WHETHER EXPLICITLY OR IMPLICITLY, INCLUDING WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, AND NONINFRINGEMENT, WITH RESPECT TO THE SOFTWARE OR
+ * DOCUMENTATION.  RENESAS SHALL HAVE NO LIABILITY ARISING OUT OF ANY SECURITY VULNERABILITY OR BREACH.  TO THE MAXIMUM
+ * EXTENT PERMITTED BY LAW, IN NO EVENT WILL RENESAS BE LIABLE TO YOU IN CONNECTION WITH THE SOFTWARE OR DOCUMENTATION
+ * (OR ANY PERSON OR ENTITY CLAIMING RIGHTS DERIVED FROM YOU) FOR ANY LOSS, DAMAGES, OR CLAIMS WHATSOEVER, INCLUDING,
+ * WITHOUT LIMITATION, ANY DIRECT, CONSEQUENTIAL, SPECIAL, INDIRECT, PUNITIVE, OR INCIDENTAL DAMAGES; ANY LOST PROFITS,
+ * OTHER ECONOMIC DAMAGE, PROPERTY DAMAGE, OR PERSONAL INJURY; AND EVEN IF RENESAS HAS BEEN ADVISED OF THE POSSIBILITY
+ * OF SUCH LOSS, DAMAGES, CLAIMS OR COSTS.
+ **********************************************************************************************************************/
+
+/* FSP includes. */
+#include "rm_littlefs_spi_flash.h"
+#include "rm_littlefs_spi_flash_cfg.h"
+
+#define RM_LITTLEFS_SPI_FLASH_MINIMUM_BLOCK_SIZE    (104)
+
+#ifndef RM_LITTLEFS_SPI_FLASH_SEMAPHORE_TIMEOUT
+ #define RM_LITTLEFS_SPI_FLASH_SEMAPHORE_TIMEOUT    UINT32_MAX
+#endif
+
+/* Number of RTOS ticks to sleep between status polls while an erase is in progress. */
+#ifndef RM_LITTLEFS_SPI_FLASH_ERASE_POLL_TICKS
+ #define RM_LITTLEFS_SPI_FLASH_ERASE_POLL_TICKS     (1U)
+#endif
+
+/** "RLSF" in ASCII, used to determine if channel is open. */
+#define RM_LITTLEFS_SPI_FLASH_OPEN                  (0x524C5346ULL)
+
+static fsp_err_t rm_littlefs_spi_flash_wait(spi_flash_instance_t const * p_flash, bool erase);
+
+const fsp_version_t g_rm_littlefs_spi_flash_version =
+{
+    .api_version_major  = RM_LITTLEFS_API_VERSION_MAJOR,
+    .api_version_minor  = RM_LITTLEFS_API_VERSION_MINOR,
+    .code_version_major = RM_LITTLEFS_SPI_FLASH_CODE_VERSION_MAJOR,
+    .code_version_minor = RM_LITTLEFS_SPI_FLASH_CODE_VERSION_MINOR
+};
+
+/** LittleFS API mapping for LittleFS Port interface */
+const rm_littlefs_api_t g_rm_littlefs_on_spi_flash =
+{
+    .open       = RM_LITTLEFS_SPI_FLASH_Open,
+    .close      = RM_LITTLEFS_SPI_FLASH_Close,
+    .versionGet = RM_LITTLEFS_SPI_FLASH_VersionGet,
+};
+
+/*******************************************************************************************************************//**
+ * @addtogroup RM_LITTLEFS_SPI_FLASH
+ * @{
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * Opens the driver and initializes lower layer driver.
+ *
+ * Implements @ref rm_littlefs_api_t::open().
+ *
+ * @retval     FSP_SUCCESS                Success.
+ * @retval     FSP_ERR_ASSERTION          An input parameter was invalid.
+ * @retval     FSP_ERR_ALREADY_OPEN       Module is already open.
+ * @retval     FSP_ERR_INVALID_SIZE       The provided block size is not one of the erase sizes of the flash device.
+ * @retval     FSP_ERR_INTERNAL           Failed to create the semaphore.
+ *
+ * @return     See @ref RENESAS_ERROR_CODES or functions called by this function for other possible return codes. This
+ *             function calls:
+ *             * @ref spi_flash_api_t::open
+ **********************************************************************************************************************/
+fsp_err_t RM_LITTLEFS_SPI_FLASH_Open (rm_littlefs_ctrl_t * const p_ctrl, rm_littlefs_cfg_t const * const p_cfg)
+{
+    rm_littlefs_spi_flash_instance_ctrl_t * p_instance_ctrl = (rm_littlefs_spi_flash_instance_ctrl_t *) p_ctrl;
+
+#if RM_LITTLEFS_SPI_FLASH_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ASSERT(NULL != p_cfg);
+    FSP_ASSERT(NULL != p_cfg->p_lfs_cfg);
+    FSP_ASSERT(NULL != p_cfg->p_extend);
+
+    rm_littlefs_spi_flash_cfg_t const * p_extend = (rm_littlefs_spi_flash_cfg_t *) p_cfg->p_extend;
+    FSP_ASSERT(NULL != p_extend->p_flash);
+    FSP_ASSERT(0U != p_extend->p_flash->p_cfg->page_size_bytes);
+
+    FSP_ERROR_RETURN(RM_LITTLEFS_SPI_FLASH_OPEN != p_instance_ctrl->open, FSP_ERR_ALREADY_OPEN);
+    FSP_ERROR_RETURN(p_cfg->p_lfs_cfg->block_size >= RM_LITTLEFS_SPI_FLASH_MINIMUM_BLOCK_SIZE, FSP_ERR_INVALID_SIZE);
+
+    /* Each block is erased with a single erase command, so the block size must be one of the erase sizes. */
+    spi_flash_cfg_t const * p_flash_cfg   = p_extend->p_flash->p_cfg;
+    bool                    erase_matched = false;
+    for (uint32_t i = 0U; i < p_flash_cfg->erase_command_list_length; i++)
+    {
+        if (p_cfg->p_lfs_cfg->block_size == p_flash_cfg->p_erase_command_list[i].size)
+        {
+            erase_matched = true;
+        }
+    }
+
+    FSP_ERROR_RETURN(erase_matched, FSP_ERR_INVALID_SIZE);
+#else
+    rm_littlefs_spi_flash_cfg_t const * p_extend = (rm_littlefs_spi_flash_cfg_t *) p_cfg->p_extend;
+#endif
+
+    p_instance_ctrl->p_cfg = p_cfg;
+
+    /* Open the underlying driver. */
+    spi_flash_instance_t const * p_flash = p_extend->p_flash;
+    fsp_err_t                    err     = p_flash->p_api->open(p_flash->p_ctrl, p_flash->p_cfg);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+#if LFS_THREAD_SAFE
+    p_instance_ctrl->xSemaphore = xSemaphoreCreateMutexStatic(&p_instance_ctrl->xMutexBuffer);
+
+    if (NULL == p_instance_ctrl->xSemaphore)
+    {
+        p_flash->p_api->close(p_flash->p_ctrl);
+
+        return FSP_ERR_INTERNAL;
+    }
+#endif
+
+    /* This module is now open. */
+    p_instance_ctrl->open = RM_LITTLEFS_SPI_FLASH_OPEN;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Closes the lower level driver.
+ *
+ * Implements @ref rm_littlefs_api_t::close().
+ *
+ * @retval FSP_SUCCESS           Media device closed.
+ * @retval FSP_ERR_ASSERTION     An input parameter was invalid.
+ * @retval FSP_ERR_NOT_OPEN      Module not open.
+ *
+ * @return See @ref RENESAS_ERROR_CODES or functions called by this function for other possible return codes.
+ *         This function calls:
+ *             * @ref spi_flash_api_t::close
+ **********************************************************************************************************************/
+fsp_err_t RM_LITTLEFS_SPI_FLASH_Close (rm_littlefs_ctrl_t * const p_ctrl)
+{
+    rm_littlefs_spi_flash_instance_ctrl_t * p_instance_ctrl = (rm_littlefs_spi_flash_instance_ctrl_t *) p_ctrl;
+#if RM_LITTLEFS_SPI_FLASH_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_instance_ctrl);
+    FSP_ERROR_RETURN(RM_LITTLEFS_SPI_FLASH_OPEN == p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+
+    p_instance_ctrl->open = 0;
+
+    rm_littlefs_spi_flash_cfg_t const * p_extend = (rm_littlefs_spi_flash_cfg_t *) p_instance_ctrl->p_cfg->p_extend;
+    spi_flash_instance_t const        * p_flash  = p_extend->p_flash;
+
+    p_flash->p_api->close(p_flash->p_ctrl);
+
+#if LFS_THREAD_SAFE
+    vSemaphoreDelete(p_instance_ctrl->xSemaphore);
+#endif
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Returns the version of this module.
+ *
+ * Implements @ref rm_littlefs_api_t::versionGet().
+ *
+ * @retval FSP_SUCCESS        Success.
+ * @retval FSP_ERR_ASSERTION  Failed in acquiring version information.
+ **********************************************************************************************************************/
+fsp_err_t RM_LITTLEFS_SPI_FLASH_VersionGet (fsp_version_t * const p_version)
+{
+#if RM_LITTLEFS_SPI_FLASH_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_version);
+#endif
+
+    p_version->version_id = g_rm_littlefs_spi_flash_version.version_id;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @} (end addtogroup RM_LITTLEFS_SPI_FLASH)
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * Read from the memory mapped window of the flash device. Negative error codes are propogated to the user.
+ *
+ * @param[in]  c           Pointer to the LittleFS config block.
+ * @param[in]  block       The block number
+ * @param[in]  off         Offset in bytes
+ * @param[out] buffer      The buffer to copy data into
+ * @param[in]  size        The size in bytes
+ *
+ * @retval     LFS_ERR_OK  Read is complete.
+ * @retval     LFS_ERR_IO  Lower level driver is not open.
+ **********************************************************************************************************************/
+int rm_littlefs_spi_flash_read (const struct lfs_config * c,
+                                lfs_block_t               block,
+                                lfs_off_t                 off,
+                                void                    * buffer,
+                                lfs_size_t                size)
+{
+    rm_littlefs_spi_flash_instance_ctrl_t * p_instance_ctrl = (rm_littlefs_spi_flash_instance_ctrl_t *) c->context;
+#if RM_LITTLEFS_SPI_FLASH_CFG_PARAM_CHECKING_ENABLE
+    FSP_ERROR_RETURN(RM_LITTLEFS_SPI_FLASH_OPEN == p_instance_ctrl->open, LFS_ERR_IO);
+#endif
+
+    rm_littlefs_spi_flash_cfg_t const * p_extend = (rm_littlefs_spi_flash_cfg_t *) p_instance_ctrl->p_cfg->p_extend;
+
+    /* Read directly from the memory mapped window. Writes and erases wait for the device to be idle before returning,
+     * so the window is always readable here. */
+    memcpy(buffer,
+           (uint8_t *) (p_extend->base_address + (p_instance_ctrl->p_cfg->p_lfs_cfg->block_size * block) + off),
+           size);
+
+    return LFS_ERR_OK;
+}
+
+/*******************************************************************************************************************//**
+ * Writes requested bytes to flash. The data is programmed one page at a time.
+ *
+ * @param[in]  c           Pointer to the LittleFS config block.
+ * @param[in]  block       The block number
+ * @param[in]  off         Offset in bytes
+ * @param[in]  buffer      The buffer containing data to be written.
+ * @param[in]  size        The size in bytes
+ *
+ * @retval     LFS_ERR_OK  Success.
+ * @retval     LFS_ERR_IO  Lower layer is not open or failed to write the flash.
+ **********************************************************************************************************************/
+int rm_littlefs_spi_flash_write (const struct lfs_config * c,
+                                 lfs_block_t               block,
+                                 lfs_off_t                 off,
+                                 const void              * buffer,
+                                 lfs_size_t                size)
+{
+    rm_littlefs_spi_flash_instance_ctrl_t * p_instance_ctrl = (rm_littlefs_spi_flash_instance_ctrl_t *) c->context;
+#if RM_LITTLEFS_SPI_FLASH_CFG_PARAM_CHECKING_ENABLE
+    FSP_ERROR_RETURN(RM_LITTLEFS_SPI_FLASH_OPEN == p_instance_ctrl->open, LFS_ERR_IO);
+#endif
+
+    rm_littlefs_spi_flash_cfg_t const * p_extend = (rm_littlefs_spi_flash_cfg_t *) p_instance_ctrl->p_cfg->p_extend;
+    spi_flash_instance_t const        * p_flash  = p_extend->p_flash;
+    uint32_t        page_size = p_flash->p_cfg->page_size_bytes;
+    uint8_t const * p_src     = (uint8_t const *) buffer;
+    uint8_t       * p_dest    =
+        (uint8_t *) (p_extend->base_address + (p_instance_ctrl->p_cfg->p_lfs_cfg->block_size * block) + off);
+
+    while (size > 0U)
+    {
+        /* A page program cannot cross a page boundary. */
+        uint32_t bytes = page_size - ((uint32_t) p_dest % page_size);
+        if (bytes > size)
+        {
+            bytes = size;
+        }
+
+        /* Call the underlying driver. */
+        fsp_err_t err = p_flash->p_api->write(p_flash->p_ctrl, p_src, p_dest, bytes);
+
+        /* Wait for the page program to complete. Write failed. Return IO error. Negative error codes are propogated
+         * to the user. */
+        if (FSP_SUCCESS == err)
+        {
+            err = rm_littlefs_spi_flash_wait(p_flash, false);
+        }
+
+        FSP_ERROR_RETURN(FSP_SUCCESS == err, LFS_ERR_IO);
+
+        p_src  += bytes;
+        p_dest += bytes;
+        size   -= bytes;
+    }
+
+    return LFS_ERR_OK;
+}
+
+/*******************************************************************************************************************//**
+ * Erase the logical block. Each logical block is erased with a single erase command.
+ *
+ * @param[in]  c           Pointer to the LittleFS config block.
+ * @param[in]  block       The logical block number
+ *
+ * @retval     LFS_ERR_OK  Success.
+ * @retval     LFS_ERR_IO  Lower layer is not open or failed to erase the flash.
+ **********************************************************************************************************************/
+int rm_littlefs_spi_flash_erase (const struct lfs_config * c, lfs_block_t block)
+{
+    rm_littlefs_spi_flash_instance_ctrl_t * p_instance_ctrl = (rm_littlefs_spi_flash_instance_ctrl_t *) c->context;
+#if RM_LITTLEFS_SPI_FLASH_CFG_PARAM_CHECKING_ENABLE
+    FSP_ERROR_RETURN(RM_LITTLEFS_SPI_FLASH_OPEN == p_instance_ctrl->open, LFS_ERR_IO);
+#endif
+    rm_littlefs_spi_flash_cfg_t const * p_extend = (rm_littlefs_spi_flash_cfg_t *) p_instance_ctrl->p_cfg->p_extend;
+    spi_flash_instance_t const        * p_flash  = p_extend->p_flash;
+
+    /* Call the underlying driver. */
+    fsp_err_t err =
+        p_flash->p_api->erase(p_flash->p_ctrl,
+                              (uint8_t *) (p_extend->base_address +
+                                           (p_instance_ctrl->p_cfg->p_lfs_cfg->block_size * block)),
+                              p_instance_ctrl->p_cfg->p_lfs_cfg->block_size);
+
+    /* Wait for the erase to complete. Erase failed. Return IO error. Negative error codes are propogated to the
+     * user. */
+    if (FSP_SUCCESS == err)
+    {
+        err = rm_littlefs_spi_flash_wait(p_flash, true);
+    }
+
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, LFS_ERR_IO);
+
+    return LFS_ERR_OK;
+}
+
+/*******************************************************************************************************************//**
+ * Locks the filesystem.
+ *
+ * @retval     LFS_ERR_OK  Success.
+ * @retval     LFS_ERR_IO  Lower layer is not open or failed to lock the flash.
+ **********************************************************************************************************************/
+int rm_littlefs_spi_flash_lock (const struct lfs_config * c)
+{
+#if LFS_THREAD_SAFE
+    rm_littlefs_spi_flash_instance_ctrl_t * p_instance_ctrl = (rm_littlefs_spi_flash_instance_ctrl_t *) c->context;
+ #if RM_LITTLEFS_SPI_FLASH_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_instance_ctrl);
+    FSP_ERROR_RETURN(RM_LITTLEFS_SPI_FLASH_OPEN == p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
+ #endif
+    BaseType_t err = xSemaphoreTake(p_instance_ctrl->xSemaphore, RM_LITTLEFS_SPI_FLASH_SEMAPHORE_TIMEOUT);
+
+    FSP_ERROR_RETURN(true == err, LFS_ERR_IO);
+
+    return LFS_ERR_OK;
+#else
+    FSP_PARAMETER_NOT_USED(c);
+
+    return LFS_ERR_IO;
+#endif
+}
+
+/*******************************************************************************************************************//**
+ * Unlocks the filesystem.
+ *
+ * @retval     LFS_ERR_OK  Success.
+ * @retval     LFS_ERR_IO  Lower layer is not open or failed to unlock the flash.
+ **********************************************************************************************************************/
+int rm_littlefs_spi_flash_unlock (const struct lfs_config * c)
+{
+#if LFS_THREAD_SAFE
+    rm_littlefs_spi_flash_instance_ctrl_t * p_instance_ctrl = (rm_littlefs_spi_flash_instance_ctrl_t *) c->context;
+ #if RM_LITTLEFS_SPI_FLASH_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_instance_ctrl);
+    FSP_ERROR_RETURN(RM_LITTLEFS_SPI_FLASH_OPEN == p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
+ #endif
+    BaseType_t err = xSemaphoreGive(p_instance_ctrl->xSemaphore);
+
+    FSP_ERROR_RETURN(true == err, LFS_ERR_IO);
+
+    return LFS_ERR_OK;
+#else
+    FSP_PARAMETER_NOT_USED(c);
+
+    return LFS_ERR_IO;
+#endif
+}
+
+/*******************************************************************************************************************//**
+ * Stub function required by LittleFS. All calls wait for the lower layer write/erase to complete.
+ * @param[in]  c           Pointer to the LittleFS config block.
+ * @retval     LFS_ERR_OK  Success.
+ **********************************************************************************************************************/
+int rm_littlefs_spi_flash_sync (const struct lfs_config * c)
+{
+    FSP_PARAMETER_NOT_USED(c);
+
+    return LFS_ERR_OK;
+}
+
+/*******************************************************************************************************************//**
+ * Waits for a write or erase to complete. When FreeRTOS is used, the calling thread gives up the CPU between status
+ * polls: it yields while a page program is in progress and sleeps RM_LITTLEFS_SPI_FLASH_ERASE_POLL_TICKS ticks while an
+ * erase is in progress. This must be called from a thread when FreeRTOS is used.
+ *
+ * @param[in]  p_flash     Pointer to the lower level flash instance.
+ * @param[in]  erase       True if an erase is in progress, false for a page program.
+ *
+ * @retval     FSP_SUCCESS The device is idle.
+ *
+ * @return     See @ref RENESAS_ERROR_CODES or functions called by this function for other possible return codes.
+ *             This function calls:
+ *             * @ref spi_flash_api_t::statusGet
+ **********************************************************************************************************************/
+static fsp_err_t rm_littlefs_spi_flash_wait (spi_flash_instance_t const * p_flash, bool erase)
+{
+    spi_flash_status_t status;
+    fsp_err_t          err;
+
+#if BSP_CFG_RTOS != 2
+    FSP_PARAMETER_NOT_USED(erase);
+#endif
+
+    err = p_flash->p_api->statusGet(p_flash->p_ctrl, &status);
+    while ((FSP_SUCCESS == err) && status.write_in_progress)
+    {
+#if BSP_CFG_RTOS == 2
+        if (erase)
+        {
+            vTaskDelay(RM_LITTLEFS_SPI_FLASH_ERASE_POLL_TICKS);
+        }
+        else
+        {
+            taskYIELD();
+        }
+#endif
+
+        err = p_flash->p_api->statusGet(p_flash->p_ctrl, &status);
+    }
+
+    return err;
+}
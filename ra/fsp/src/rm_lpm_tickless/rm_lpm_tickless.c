@@ -0,0 +1,537 @@
+/***********************************************************************************************************************
+ * Copyright [2020] Renesas Electronics Corporation and/or its affiliates.  All Rights Reserved.
+ *
+ * This software and documentation are supplied by Renesas Electronics America Inc. and may only be used with products
+ * of Renesas Electronics Corp. and its affiliates ("Renesas").  No other uses are authorized.  Renesas products are
+ * sold pursuant to Renesas terms and conditions of sale.  Purchasers are solely responsible for the selection and use
+ * of Renesas products and Renesas assumes no liability.  No license, express or implied, to any intellectual property
+ * right is granted by Renesas. This software is protected under all applicable laws, including copyright laws. Renesas
+ * reserves the right to change or discontinue this software and/or this documentation. THE SOFTWARE AND DOCUMENTATION
+ * IS DELIVERED TO YOU "AS IS," AND RENESAS MAKES NO REPRESENTATIONS OR WARRANTIES, AND TO THE FULLEST EXTENT
+ * PERMISSIBLE UNDER APPLICABLE LAW, DISCLAIMS ALL WARRANTIES, WHETHER EXPLICITLY OR IMPLICITLY, INCLUDING WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, AND NONINFRINGEMENT, WITH RESPECT TO THE SOFTWARE OR
+ * DOCUMENTATION.  RENESAS SHALL HAVE NO LIABILITY ARISING OUT OF ANY SECURITY VULNERABILITY OR BREACH.  TO THE MAXIMUM
+ * EXTENT PERMITTED BY LAW, IN NO EVENT WILL RENESAS BE LIABLE TO YOU IN CONNECTION WITH THE SOFTWARE OR DOCUMENTATION
+ * (OR ANY PERSON OR ENTITY CLAIMING RIGHTS DERIVED FROM YOU) FOR ANY LOSS, DAMAGES, OR CLAIMS WHATSOEVER, INCLUDING,
+ * WITHOUT LIMITATION, ANY DIRECT, CONSEQUENTIAL, SPECIAL, INDIRECT, PUNITIVE, OR INCIDENTAL DAMAGES; ANY LOST PROFITS,
+ * OTHER ECONOMIC DAMAGE, PROPERTY DAMAGE, OR PERSONAL INJURY; AND EVEN IF RENESAS HAS BEEN ADVISED OF THE POSSIBILITY
+ * OF SUCH LOSS, DAMAGES, CLAIMS OR COSTS.
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Includes
+ **********************************************************************************************************************/
+#include "rm_lpm_tickless.h"
+#include "rm_lpm_tickless_cfg.h"
+#include "r_agt.h"
+#if RM_LPM_TICKLESS_CFG_RTOS_SUPPORT_ENABLE
+ #include "FreeRTOS.h"
+ #include "task.h"
+#endif
+
+/***********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+
+/* "LPMT" in ASCII. */
+#define RM_LPM_TICKLESS_OPEN    (0x4C504D54U)
+
+/***********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Private function prototypes
+ **********************************************************************************************************************/
+static rm_lpm_tickless_depth_t rm_lpm_tickless_depth_select(rm_lpm_tickless_instance_ctrl_t * p_ctrl, uint32_t ticks);
+static uint32_t                rm_lpm_tickless_counts_get(rm_lpm_tickless_instance_ctrl_t * p_ctrl, uint32_t ticks);
+static uint32_t                rm_lpm_tickless_ticks_get(rm_lpm_tickless_instance_ctrl_t * p_ctrl, uint32_t counts);
+static void                    rm_lpm_tickless_event(rm_lpm_tickless_instance_ctrl_t * p_ctrl,
+                                                     rm_lpm_tickless_event_t           event,
+                                                     rm_lpm_tickless_depth_t           depth,
+                                                     uint32_t                          elapsed_ticks);
+static void rm_lpm_tickless_timer_callback(timer_callback_args_t * p_args);
+
+/***********************************************************************************************************************
+ * Private global variables
+ **********************************************************************************************************************/
+
+/** Version data structure. */
+static const fsp_version_t g_rm_lpm_tickless_version =
+{
+    .api_version_minor  = RM_LPM_TICKLESS_CODE_VERSION_MINOR,
+    .api_version_major  = RM_LPM_TICKLESS_CODE_VERSION_MAJOR,
+    .code_version_major = RM_LPM_TICKLESS_CODE_VERSION_MAJOR,
+    .code_version_minor = RM_LPM_TICKLESS_CODE_VERSION_MINOR
+};
+
+#if RM_LPM_TICKLESS_CFG_RTOS_SUPPORT_ENABLE
+
+/* Instance used by the FreeRTOS idle hook. */
+static rm_lpm_tickless_instance_ctrl_t * gp_rm_lpm_tickless_rtos_ctrl = NULL;
+#endif
+
+/*******************************************************************************************************************//**
+ * @addtogroup RM_LPM_TICKLESS
+ * @{
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Functions
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * Opens the tickless idle module, the AGT used as low-power tick and the low power mode instance.
+ *
+ * RM_LPM_TICKLESS_Sleep selects the deepest idle depth that is allowed by the registered constraints and worth
+ * entering for the expected idle time, times the idle period with the AGT and returns the ticks that elapsed, so the
+ * RTOS tick count stays correct across Software Standby mode where the system tick stops. When
+ * RM_LPM_TICKLESS_CFG_RTOS_SUPPORT_ENABLE is set, the instance opened last is used by vPortSuppressTicksAndSleep()
+ * for FreeRTOS projects with configUSE_TICKLESS_IDLE set to 1.
+ *
+ * @retval     FSP_SUCCESS                    Module is open.
+ * @retval     FSP_ERR_ASSERTION              An input parameter is invalid.
+ * @retval     FSP_ERR_ALREADY_OPEN           Module has already been opened with this instance of the control
+ *                                            structure.
+ * @retval     FSP_ERR_INVALID_ARGUMENT       The AGT clock is slower than the tick rate.
+ * @return                                    See @ref RENESAS_ERROR_CODES or functions called by this function for
+ *                                            other possible return codes. This function calls:
+ *                                            * timer_api_t::open
+ *                                            * timer_api_t::callbackSet
+ *                                            * timer_api_t::infoGet
+ *                                            * lpm_api_t::open
+ **********************************************************************************************************************/
+fsp_err_t RM_LPM_TICKLESS_Open (rm_lpm_tickless_instance_ctrl_t * const p_ctrl,
+                                rm_lpm_tickless_cfg_t const * const     p_cfg)
+{
+#if RM_LPM_TICKLESS_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ASSERT(NULL != p_cfg);
+    FSP_ASSERT(NULL != p_cfg->p_lpm);
+    FSP_ASSERT(NULL != p_cfg->p_mode_cfg[RM_LPM_TICKLESS_DEPTH_SLEEP]);
+    FSP_ASSERT(NULL != p_cfg->p_timer);
+    FSP_ASSERT(0U != p_cfg->tick_rate_hz);
+    FSP_ERROR_RETURN(RM_LPM_TICKLESS_OPEN != p_ctrl->open, FSP_ERR_ALREADY_OPEN);
+#endif
+
+    timer_instance_t const * p_timer = p_cfg->p_timer;
+    lpm_instance_t const   * p_lpm   = p_cfg->p_lpm;
+    timer_info_t             info;
+
+    fsp_err_t err = p_timer->p_api->open(p_timer->p_ctrl, p_timer->p_cfg);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+    err = p_timer->p_api->callbackSet(p_timer->p_ctrl, rm_lpm_tickless_timer_callback, p_ctrl, NULL);
+    if (FSP_SUCCESS == err)
+    {
+        err = p_timer->p_api->infoGet(p_timer->p_ctrl, &info);
+    }
+
+    if ((FSP_SUCCESS == err) && (info.clock_frequency < p_cfg->tick_rate_hz))
+    {
+        err = FSP_ERR_INVALID_ARGUMENT;
+    }
+
+    if (FSP_SUCCESS == err)
+    {
+        err = p_lpm->p_api->open(p_lpm->p_ctrl, p_cfg->p_mode_cfg[RM_LPM_TICKLESS_DEPTH_SLEEP]);
+    }
+
+    if (FSP_SUCCESS != err)
+    {
+        (void) p_timer->p_api->close(p_timer->p_ctrl);
+
+        return err;
+    }
+
+    p_ctrl->p_cfg          = p_cfg;
+    p_ctrl->timer_hz       = info.clock_frequency;
+    p_ctrl->max_idle_ticks = (uint32_t) (((uint64_t) AGT_MAX_PERIOD * p_cfg->tick_rate_hz) / info.clock_frequency);
+    p_ctrl->fraction       = 0U;
+    p_ctrl->depth_applied  = RM_LPM_TICKLESS_DEPTH_SLEEP;
+    p_ctrl->timer_expired  = false;
+
+    for (uint32_t i = 0U; i < RM_LPM_TICKLESS_DEPTH_COUNT; i++)
+    {
+        p_ctrl->constraints[i] = 0U;
+    }
+
+    p_ctrl->open = RM_LPM_TICKLESS_OPEN;
+
+#if RM_LPM_TICKLESS_CFG_RTOS_SUPPORT_ENABLE
+    gp_rm_lpm_tickless_rtos_ctrl = p_ctrl;
+#endif
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Limits idle to the given depth or a shallower one until the constraint is released, for example
+ * RM_LPM_TICKLESS_DEPTH_SLEEP while a UART reception is active. Constraints are counted, so each call must be paired
+ * with RM_LPM_TICKLESS_ConstraintRelease. This function may be called from an interrupt.
+ *
+ * @retval     FSP_SUCCESS                    Constraint registered.
+ * @retval     FSP_ERR_ASSERTION              An input parameter is invalid.
+ * @retval     FSP_ERR_NOT_OPEN               The instance control structure is not opened.
+ * @retval     FSP_ERR_OVERFLOW               Too many constraints are registered on this depth.
+ **********************************************************************************************************************/
+fsp_err_t RM_LPM_TICKLESS_ConstraintSet (rm_lpm_tickless_instance_ctrl_t * const p_ctrl, rm_lpm_tickless_depth_t depth)
+{
+#if RM_LPM_TICKLESS_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ASSERT(depth < RM_LPM_TICKLESS_DEPTH_COUNT);
+    FSP_ERROR_RETURN(RM_LPM_TICKLESS_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+
+    fsp_err_t err = FSP_ERR_OVERFLOW;
+
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+
+    if (UINT8_MAX != p_ctrl->constraints[depth])
+    {
+        p_ctrl->constraints[depth]++;
+        err = FSP_SUCCESS;
+    }
+
+    FSP_CRITICAL_SECTION_EXIT;
+
+    return err;
+}
+
+/*******************************************************************************************************************//**
+ * Releases a constraint registered with RM_LPM_TICKLESS_ConstraintSet. This function may be called from an interrupt.
+ *
+ * @retval     FSP_SUCCESS                    Constraint released.
+ * @retval     FSP_ERR_ASSERTION              An input parameter is invalid.
+ * @retval     FSP_ERR_NOT_OPEN               The instance control structure is not opened.
+ * @retval     FSP_ERR_NOT_ENABLED            No constraint is registered on this depth.
+ **********************************************************************************************************************/
+fsp_err_t RM_LPM_TICKLESS_ConstraintRelease (rm_lpm_tickless_instance_ctrl_t * const p_ctrl,
+                                             rm_lpm_tickless_depth_t                 depth)
+{
+#if RM_LPM_TICKLESS_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ASSERT(depth < RM_LPM_TICKLESS_DEPTH_COUNT);
+    FSP_ERROR_RETURN(RM_LPM_TICKLESS_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+
+    fsp_err_t err = FSP_ERR_NOT_ENABLED;
+
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+
+    if (0U != p_ctrl->constraints[depth])
+    {
+        p_ctrl->constraints[depth]--;
+        err = FSP_SUCCESS;
+    }
+
+    FSP_CRITICAL_SECTION_EXIT;
+
+    return err;
+}
+
+/*******************************************************************************************************************//**
+ * Idles for up to expected_idle_ticks ticks in the deepest allowed depth and returns the ticks that elapsed.
+ *
+ * The idle period is limited to the longest period the AGT can time. The MCU wakes up when the AGT underflows or
+ * earlier on any other enabled interrupt or wake source, and the elapsed ticks are then taken from the AGT counter.
+ * Counts of a partial tick are kept and added to the next idle period, so no time is lost over many short wake-ups.
+ *
+ * Call this function with interrupts disabled through PRIMASK, after the system tick was stopped. Interrupts are
+ * enabled briefly after waking up so the interrupt that woke the MCU is serviced before the elapsed ticks are
+ * computed.
+ *
+ * @retval     FSP_SUCCESS                    The MCU idled, p_elapsed_ticks holds the elapsed ticks.
+ * @retval     FSP_ERR_ASSERTION              An input parameter is invalid.
+ * @retval     FSP_ERR_NOT_OPEN               The instance control structure is not opened.
+ * @return                                    See @ref RENESAS_ERROR_CODES or functions called by this function for
+ *                                            other possible return codes. This function calls:
+ *                                            * lpm_api_t::lowPowerReconfigure
+ *                                            * lpm_api_t::lowPowerModeEnter
+ *                                            * timer_api_t::periodSet
+ *                                            * timer_api_t::start
+ *                                            * timer_api_t::stop
+ *                                            * timer_api_t::statusGet
+ **********************************************************************************************************************/
+fsp_err_t RM_LPM_TICKLESS_Sleep (rm_lpm_tickless_instance_ctrl_t * const p_ctrl,
+                                 uint32_t                                expected_idle_ticks,
+                                 uint32_t * const                        p_elapsed_ticks)
+{
+#if RM_LPM_TICKLESS_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ASSERT(NULL != p_elapsed_ticks);
+    FSP_ASSERT(0U != expected_idle_ticks);
+    FSP_ERROR_RETURN(RM_LPM_TICKLESS_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+
+    rm_lpm_tickless_cfg_t const * p_cfg   = p_ctrl->p_cfg;
+    timer_instance_t const      * p_timer = p_cfg->p_timer;
+    lpm_instance_t const        * p_lpm   = p_cfg->p_lpm;
+    fsp_err_t                     err     = FSP_SUCCESS;
+
+    *p_elapsed_ticks = 0U;
+
+    uint32_t                ticks = (expected_idle_ticks < p_ctrl->max_idle_ticks) ? expected_idle_ticks :
+                                    p_ctrl->max_idle_ticks;
+    rm_lpm_tickless_depth_t depth = rm_lpm_tickless_depth_select(p_ctrl, ticks);
+
+    /* The LPM registers only hold one configuration, so it is only rewritten when the depth changes. */
+    if (depth != p_ctrl->depth_applied)
+    {
+        err = p_lpm->p_api->lowPowerReconfigure(p_lpm->p_ctrl, p_cfg->p_mode_cfg[depth]);
+        FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+        p_ctrl->depth_applied = depth;
+    }
+
+    uint32_t period = rm_lpm_tickless_counts_get(p_ctrl, ticks);
+
+    err = p_timer->p_api->periodSet(p_timer->p_ctrl, period);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+    rm_lpm_tickless_event(p_ctrl, RM_LPM_TICKLESS_EVENT_PRE_SLEEP, depth, 0U);
+
+    p_ctrl->timer_expired = false;
+    (void) p_timer->p_api->start(p_timer->p_ctrl);
+
+    err = p_lpm->p_api->lowPowerModeEnter(p_lpm->p_ctrl);
+
+    /* Freeze the counter, then let the wake-up interrupt run so an AGT underflow is recorded. */
+    (void) p_timer->p_api->stop(p_timer->p_ctrl);
+    __enable_irq();
+    __ISB();
+    __disable_irq();
+
+    timer_status_t status;
+    uint32_t       counts = period;
+    if (!p_ctrl->timer_expired && (FSP_SUCCESS == p_timer->p_api->statusGet(p_timer->p_ctrl, &status)))
+    {
+        /* The AGT counts down from period minus one. */
+        counts = (period - 1U) - status.counter;
+    }
+
+    *p_elapsed_ticks = rm_lpm_tickless_ticks_get(p_ctrl, counts);
+
+    rm_lpm_tickless_event(p_ctrl, RM_LPM_TICKLESS_EVENT_POST_SLEEP, depth, *p_elapsed_ticks);
+
+    return err;
+}
+
+/*******************************************************************************************************************//**
+ * Closes the module, the AGT and the low power mode instance.
+ *
+ * @retval     FSP_SUCCESS                    Module closed.
+ * @retval     FSP_ERR_ASSERTION              An input parameter is invalid.
+ * @retval     FSP_ERR_NOT_OPEN               The instance control structure is not opened.
+ **********************************************************************************************************************/
+fsp_err_t RM_LPM_TICKLESS_Close (rm_lpm_tickless_instance_ctrl_t * const p_ctrl)
+{
+#if RM_LPM_TICKLESS_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ERROR_RETURN(RM_LPM_TICKLESS_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+
+    p_ctrl->open = 0U;
+
+#if RM_LPM_TICKLESS_CFG_RTOS_SUPPORT_ENABLE
+    if (gp_rm_lpm_tickless_rtos_ctrl == p_ctrl)
+    {
+        gp_rm_lpm_tickless_rtos_ctrl = NULL;
+    }
+#endif
+
+    timer_instance_t const * p_timer = p_ctrl->p_cfg->p_timer;
+    lpm_instance_t const   * p_lpm   = p_ctrl->p_cfg->p_lpm;
+
+    (void) p_timer->p_api->stop(p_timer->p_ctrl);
+    (void) p_timer->p_api->close(p_timer->p_ctrl);
+    (void) p_lpm->p_api->close(p_lpm->p_ctrl);
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Gets the version of this module.
+ *
+ * @retval     FSP_SUCCESS                    Version stored in p_version.
+ * @retval     FSP_ERR_ASSERTION              p_version was NULL.
+ **********************************************************************************************************************/
+fsp_err_t RM_LPM_TICKLESS_VersionGet (fsp_version_t * const p_version)
+{
+#if RM_LPM_TICKLESS_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_version);
+#endif
+
+    p_version->version_id = g_rm_lpm_tickless_version.version_id;
+
+    return FSP_SUCCESS;
+}
+
+#if RM_LPM_TICKLESS_CFG_RTOS_SUPPORT_ENABLE
+
+/*******************************************************************************************************************//**
+ * FreeRTOS tickless idle hook, replaces the weak SysTick based implementation of the port. The SysTick is stopped
+ * while idle and restarted with a full period once the kernel tick count was stepped.
+ *
+ * @param[in]  xExpectedIdleTime   Ticks until the next task is due to unblock.
+ **********************************************************************************************************************/
+void vPortSuppressTicksAndSleep (TickType_t xExpectedIdleTime)
+{
+    rm_lpm_tickless_instance_ctrl_t * p_ctrl = gp_rm_lpm_tickless_rtos_ctrl;
+
+    if (NULL == p_ctrl)
+    {
+        return;
+    }
+
+    __disable_irq();
+    __DSB();
+    __ISB();
+
+    /* A context switch may have been requested or a task readied between the scheduler suspension and here. */
+    if (eAbortSleep == eTaskConfirmSleepModeStatus())
+    {
+        __enable_irq();
+
+        return;
+    }
+
+    SysTick->CTRL &= ~SysTick_CTRL_ENABLE_Msk;
+
+    uint32_t elapsed_ticks = 0U;
+    (void) RM_LPM_TICKLESS_Sleep(p_ctrl, (uint32_t) xExpectedIdleTime, &elapsed_ticks);
+
+    SysTick->VAL   = 0U;
+    SysTick->CTRL |= SysTick_CTRL_ENABLE_Msk;
+
+    if (elapsed_ticks >= (uint32_t) xExpectedIdleTime)
+    {
+        /* The last tick is processed by the SysTick handler so the task due at the end of the idle period unblocks. */
+        vTaskStepTick(xExpectedIdleTime - 1U);
+        SCB->ICSR = SCB_ICSR_PENDSTSET_Msk;
+    }
+    else
+    {
+        vTaskStepTick((TickType_t) elapsed_ticks);
+    }
+
+    __enable_irq();
+}
+
+#endif
+
+/*******************************************************************************************************************//**
+ * @} (end addtogroup RM_LPM_TICKLESS)
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Private Functions
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * Selects the deepest depth allowed by the constraints that is configured and worth entering.
+ *
+ * @param[in]  p_ctrl   Pointer to the control structure.
+ * @param[in]  ticks    Ticks the MCU idles at most.
+ *
+ * @return     Idle depth to enter.
+ **********************************************************************************************************************/
+static rm_lpm_tickless_depth_t rm_lpm_tickless_depth_select (rm_lpm_tickless_instance_ctrl_t * p_ctrl, uint32_t ticks)
+{
+    rm_lpm_tickless_cfg_t const * p_cfg = p_ctrl->p_cfg;
+    uint32_t                      depth = RM_LPM_TICKLESS_DEPTH_STANDBY;
+
+    /* The shallowest constrained depth limits the idle depth. */
+    for (uint32_t i = 0U; i < RM_LPM_TICKLESS_DEPTH_COUNT; i++)
+    {
+        if (0U != p_ctrl->constraints[i])
+        {
+            depth = i;
+            break;
+        }
+    }
+
+    while ((RM_LPM_TICKLESS_DEPTH_SLEEP != depth) &&
+           ((NULL == p_cfg->p_mode_cfg[depth]) || (ticks < p_cfg->min_idle_ticks[depth])))
+    {
+        depth--;
+    }
+
+    return (rm_lpm_tickless_depth_t) depth;
+}
+
+/*******************************************************************************************************************//**
+ * Converts an idle time to AGT counts, including the partial tick left from the previous idle period.
+ *
+ * @param[in]  p_ctrl   Pointer to the control structure.
+ * @param[in]  ticks    Idle time in ticks, at most max_idle_ticks.
+ *
+ * @return     AGT period in counts after which exactly ticks ticks have elapsed.
+ **********************************************************************************************************************/
+static uint32_t rm_lpm_tickless_counts_get (rm_lpm_tickless_instance_ctrl_t * p_ctrl, uint32_t ticks)
+{
+    uint64_t rate   = p_ctrl->p_cfg->tick_rate_hz;
+    uint64_t scaled = ((uint64_t) ticks * p_ctrl->timer_hz) - p_ctrl->fraction;
+
+    return (uint32_t) ((scaled + rate - 1U) / rate);
+}
+
+/*******************************************************************************************************************//**
+ * Converts elapsed AGT counts to ticks and keeps the partial tick for the next idle period.
+ *
+ * @param[in]  p_ctrl   Pointer to the control structure.
+ * @param[in]  counts   Elapsed AGT counts.
+ *
+ * @return     Elapsed ticks.
+ **********************************************************************************************************************/
+static uint32_t rm_lpm_tickless_ticks_get (rm_lpm_tickless_instance_ctrl_t * p_ctrl, uint32_t counts)
+{
+    uint64_t scaled = ((uint64_t) counts * p_ctrl->p_cfg->tick_rate_hz) + p_ctrl->fraction;
+
+    p_ctrl->fraction = (uint32_t) (scaled % p_ctrl->timer_hz);
+
+    return (uint32_t) (scaled / p_ctrl->timer_hz);
+}
+
+/*******************************************************************************************************************//**
+ * Calls the user callback if one is configured.
+ *
+ * @param[in]  p_ctrl          Pointer to the control structure.
+ * @param[in]  event           Event to report.
+ * @param[in]  depth           Idle depth.
+ * @param[in]  elapsed_ticks   Ticks spent idle.
+ **********************************************************************************************************************/
+static void rm_lpm_tickless_event (rm_lpm_tickless_instance_ctrl_t * p_ctrl,
+                                   rm_lpm_tickless_event_t           event,
+                                   rm_lpm_tickless_depth_t           depth,
+                                   uint32_t                          elapsed_ticks)
+{
+    rm_lpm_tickless_cfg_t const * p_cfg = p_ctrl->p_cfg;
+
+    if (NULL != p_cfg->p_callback)
+    {
+        rm_lpm_tickless_callback_args_t args;
+
+        args.event         = event;
+        args.depth         = depth;
+        args.elapsed_ticks = elapsed_ticks;
+        args.p_context     = p_cfg->p_context;
+        p_cfg->p_callback(&args);
+    }
+}
+
+/*******************************************************************************************************************//**
+ * AGT underflow callback, records that the idle period ran to its end.
+ *
+ * @param[in]  p_args   Timer callback arguments. p_context points to the control structure.
+ **********************************************************************************************************************/
+static void rm_lpm_tickless_timer_callback (timer_callback_args_t * p_args)
+{
+    rm_lpm_tickless_instance_ctrl_t * p_ctrl = (rm_lpm_tickless_instance_ctrl_t *) p_args->p_context;
+
+    if (TIMER_EVENT_CYCLE_END == p_args->event)
+    {
+        p_ctrl->timer_expired = true;
+    }
+}
@@ -0,0 +1,255 @@
+/**
+ * \file ssl_cache_vee.h
+ *
+ * \brief TLS session cache stored in Virtual EEPROM records and protected
+ *        with an SCE-wrapped AES key.
+ */
+
+/*
+ *  Copyright (C) 2006-2018, Arm Limited (or its affiliates), All Rights Reserved
+ *  SPDX-License-Identifier: Apache-2.0
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *  not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ *  WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  This file is part of Mbed TLS (https://tls.mbed.org)
+ */
+#ifndef MBEDTLS_SSL_CACHE_VEE_H
+#define MBEDTLS_SSL_CACHE_VEE_H
+
+#if !defined(MBEDTLS_CONFIG_FILE)
+#include "mbedtls/config.h"
+#else
+#include MBEDTLS_CONFIG_FILE
+#endif
+
+/*
+ * MBEDTLS_SSL_CACHE_VEE_C
+ *
+ * Define to enable the Virtual EEPROM session cache. Each cached session is
+ * serialized with mbedtls_ssl_session_save(), encrypted with AES-CTR under an
+ * SCE-wrapped key, authenticated with HMAC-SHA-256 and written as one
+ * rm_vee_flash record, so it survives deep software standby and resets. A
+ * resumed handshake skips the certificate verification and the asymmetric
+ * key exchange.
+ *
+ * The same cache serves both sides of a connection:
+ * - Servers register mbedtls_ssl_cache_vee_get() and
+ *   mbedtls_ssl_cache_vee_set() with mbedtls_ssl_conf_session_cache().
+ *   Entries are keyed by session ID.
+ * - Clients call mbedtls_ssl_cache_vee_save() after a handshake and
+ *   mbedtls_ssl_cache_vee_load() before the next one, keyed by any peer
+ *   identifier (e.g. the server host name). Session tickets are kept with
+ *   the session when MBEDTLS_SSL_SESSION_TICKETS is enabled.
+ *
+ * MBEDTLS_SSL_CACHE_VEE_SESSION_MAX_LEN
+ *
+ * Largest serialized session that can be cached, in bytes. A session keeps
+ * only the peer certificate digest unless MBEDTLS_SSL_KEEP_PEER_CERTIFICATE
+ * is enabled, in which case the whole peer certificate must fit. Sessions
+ * that do not fit are not cached. The cache context holds two buffers of
+ * this size.
+ */
+#if defined(MBEDTLS_SSL_CACHE_VEE_C)
+
+#if !defined(MBEDTLS_AES_ALT) || !defined(MBEDTLS_CIPHER_MODE_CTR) || !defined(MBEDTLS_SHA256_C)
+#error "MBEDTLS_SSL_CACHE_VEE_C requires MBEDTLS_AES_ALT, MBEDTLS_CIPHER_MODE_CTR and MBEDTLS_SHA256_C"
+#endif
+
+#include "mbedtls/ssl.h"
+#include "mbedtls/aes.h"
+
+#if defined(MBEDTLS_THREADING_C)
+#include "mbedtls/threading.h"
+#endif
+
+#include "rm_vee_api.h"
+
+#if !defined(MBEDTLS_SSL_CACHE_VEE_SESSION_MAX_LEN)
+#define MBEDTLS_SSL_CACHE_VEE_SESSION_MAX_LEN   512
+#endif
+
+/* Size of the record header: magic, sequence, length, key digest, counter block and tag. */
+#define MBEDTLS_SSL_CACHE_VEE_HEADER_LEN        ( 12 + 32 + 16 + 16 )
+
+/* Largest record written to the Virtual EEPROM. Records are padded to a multiple of 16 bytes. */
+#define MBEDTLS_SSL_CACHE_VEE_RECORD_MAX_LEN                                              \
+    ( ( MBEDTLS_SSL_CACHE_VEE_HEADER_LEN + MBEDTLS_SSL_CACHE_VEE_SESSION_MAX_LEN + 15 ) & ~15 )
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \brief          Virtual EEPROM session cache context.
+ */
+typedef struct mbedtls_ssl_cache_vee_context
+{
+    rm_vee_instance_t const *p_vee;     /*!< Virtual EEPROM holding the records */
+    uint32_t first_rec_id;              /*!< ID of the first cache record       */
+    uint32_t entries;                   /*!< Number of cache records            */
+    uint32_t sequence;                  /*!< Sequence of the next write         */
+#if defined(MBEDTLS_HAVE_TIME)
+    uint32_t timeout;                   /*!< Entry lifetime in seconds, 0 = no expiry */
+#endif
+    mbedtls_aes_context aes;            /*!< AES context keyed with the wrapped key */
+    unsigned char mac_key[32];          /*!< HMAC key derived from the wrapped key */
+    int (*f_rng)(void *, unsigned char *, size_t); /*!< RNG for the counter blocks */
+    void *p_rng;                        /*!< RNG context                        */
+    uint32_t record[MBEDTLS_SSL_CACHE_VEE_RECORD_MAX_LEN / 4];     /*!< Record being written */
+    unsigned char session[MBEDTLS_SSL_CACHE_VEE_SESSION_MAX_LEN];  /*!< Decrypted session    */
+#if defined(MBEDTLS_THREADING_C)
+    mbedtls_threading_mutex_t mutex;    /*!< Guards the context                 */
+#endif
+}
+mbedtls_ssl_cache_vee_context;
+
+/**
+ * \brief          Initialize a Virtual EEPROM session cache context.
+ *
+ * \param ctx      Cache context to initialize.
+ */
+void mbedtls_ssl_cache_vee_init( mbedtls_ssl_cache_vee_context *ctx );
+
+/**
+ * \brief          Bind the cache to a range of Virtual EEPROM records and
+ *                 key it.
+ *
+ * \param ctx          Cache context.
+ * \param p_vee        Opened Virtual EEPROM instance. Its callback is not
+ *                     used, so it may be shared with other users.
+ * \param first_rec_id ID of the first record used by the cache.
+ * \param entries      Number of records used by the cache, starting at
+ *                     first_rec_id.
+ * \param wrapped_key  SCE-wrapped AES key, e.g. one generated with
+ *                     PSA_KEY_LIFETIME_PERSISTENT_WRAPPED. It is bound to
+ *                     the device, so it may be stored next to the cache.
+ * \param keybits      Size of the AES key the wrapped key holds: 128, 192
+ *                     or 256.
+ * \param f_rng        RNG used to generate the counter blocks.
+ * \param p_rng        RNG context.
+ *
+ * \return         0 if successful, MBEDTLS_ERR_SSL_BAD_INPUT_DATA if a
+ *                 parameter is invalid, or an AES error code.
+ */
+int mbedtls_ssl_cache_vee_setup( mbedtls_ssl_cache_vee_context *ctx,
+                                 rm_vee_instance_t const *p_vee,
+                                 uint32_t first_rec_id,
+                                 uint32_t entries,
+                                 const unsigned char *wrapped_key,
+                                 unsigned int keybits,
+                                 int (*f_rng)(void *, unsigned char *, size_t),
+                                 void *p_rng );
+
+#if defined(MBEDTLS_HAVE_TIME)
+/**
+ * \brief          Set the lifetime of cached sessions. Sessions that
+ *                 started longer ago are not resumed.
+ *
+ * \param ctx      Cache context.
+ * \param timeout  Lifetime in seconds, 0 for no expiry (default).
+ */
+void mbedtls_ssl_cache_vee_set_timeout( mbedtls_ssl_cache_vee_context *ctx, uint32_t timeout );
+#endif /* MBEDTLS_HAVE_TIME */
+
+/**
+ * \brief          Cache get callback for mbedtls_ssl_conf_session_cache().
+ *                 Looks the session up by its session ID.
+ *
+ * \param data     Cache context.
+ * \param session  Session to restore. Its ID must be set.
+ *
+ * \return         0 if the session was restored, 1 otherwise.
+ */
+int mbedtls_ssl_cache_vee_get( void *data, mbedtls_ssl_session *session );
+
+/**
+ * \brief          Cache set callback for mbedtls_ssl_conf_session_cache().
+ *                 Stores the session under its session ID.
+ *
+ * \param data     Cache context.
+ * \param session  Session to store.
+ *
+ * \return         0 if the record write was started, or a specific error
+ *                 code (see mbedtls_ssl_cache_vee_save()).
+ */
+int mbedtls_ssl_cache_vee_set( void *data, const mbedtls_ssl_session *session );
+
+/**
+ * \brief          Store a session under an arbitrary key. The record write
+ *                 runs in the background; the session is not cached if a
+ *                 previous write has not completed yet.
+ *
+ * \param ctx      Cache context.
+ * \param key      Lookup key, e.g. the server host name.
+ * \param key_len  Length of the lookup key.
+ * \param session  Session to store, e.g. from mbedtls_ssl_get_session().
+ *
+ * \return         0 if the record write was started,
+ *                 MBEDTLS_ERR_SSL_BUFFER_TOO_SMALL if the session is larger
+ *                 than MBEDTLS_SSL_CACHE_VEE_SESSION_MAX_LEN,
+ *                 MBEDTLS_ERR_SSL_WANT_WRITE if the Virtual EEPROM is busy,
+ *                 MBEDTLS_ERR_SSL_INTERNAL_ERROR if the write failed, or
+ *                 another specific SSL, SHA-256 or AES error code.
+ */
+int mbedtls_ssl_cache_vee_save( mbedtls_ssl_cache_vee_context *ctx,
+                                const unsigned char *key,
+                                size_t key_len,
+                                const mbedtls_ssl_session *session );
+
+/**
+ * \brief          Restore the session stored under a key.
+ *
+ * \param ctx      Cache context.
+ * \param key      Lookup key passed to mbedtls_ssl_cache_vee_save().
+ * \param key_len  Length of the lookup key.
+ * \param session  Initialized session to restore into. Pass it to
+ *                 mbedtls_ssl_set_session() before the handshake.
+ *
+ * \return         0 if the session was restored, 1 if no valid, unexpired
+ *                 entry exists, or a specific SSL error code.
+ */
+int mbedtls_ssl_cache_vee_load( mbedtls_ssl_cache_vee_context *ctx,
+                                const unsigned char *key,
+                                size_t key_len,
+                                mbedtls_ssl_session *session );
+
+/**
+ * \brief          Forget the session stored under a key, e.g. after the
+ *                 peer refused to resume it.
+ *
+ * \param ctx      Cache context.
+ * \param key      Lookup key passed to mbedtls_ssl_cache_vee_save().
+ * \param key_len  Length of the lookup key.
+ *
+ * \return         0 if successful or no entry exists,
+ *                 MBEDTLS_ERR_SSL_WANT_WRITE if the Virtual EEPROM is busy,
+ *                 or MBEDTLS_ERR_SSL_INTERNAL_ERROR if the write failed.
+ */
+int mbedtls_ssl_cache_vee_remove( mbedtls_ssl_cache_vee_context *ctx,
+                                  const unsigned char *key,
+                                  size_t key_len );
+
+/**
+ * \brief          Free a cache context. The records are left in place.
+ *
+ * \param ctx      Cache context to free.
+ */
+void mbedtls_ssl_cache_vee_free( mbedtls_ssl_cache_vee_context *ctx );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MBEDTLS_SSL_CACHE_VEE_C */
+
+#endif /* MBEDTLS_SSL_CACHE_VEE_H */
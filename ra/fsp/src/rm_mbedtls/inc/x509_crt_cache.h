@@ -0,0 +1,97 @@
+/**
+ * \file x509_crt_cache.h
+ *
+ * \brief Parsed certificate chain cache and signature verification memo
+ *        for the X.509 certificate module.
+ */
+
+/*
+ *  Copyright (C) 2006-2018, Arm Limited (or its affiliates), All Rights Reserved
+ *  SPDX-License-Identifier: Apache-2.0
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *  not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ *  WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  This file is part of Mbed TLS (https://tls.mbed.org)
+ */
+#ifndef MBEDTLS_X509_CRT_CACHE_H
+#define MBEDTLS_X509_CRT_CACHE_H
+
+#include "mbedtls/x509_crt.h"
+
+/*
+ * MBEDTLS_X509_CRT_CACHE_ENTRIES
+ *
+ * Number of certificates held by the parsed chain cache. Each certificate is
+ * stored in a statically allocated node and references its DER encoding in
+ * place, so the input buffers must stay valid and unchanged (e.g. in flash)
+ * until mbedtls_x509_crt_cache_free() is called. Leave undefined to disable.
+ *
+ * MBEDTLS_X509_CRT_VERIFY_CACHE_ENTRIES
+ *
+ * Number of successful CA certificate signature checks remembered by
+ * mbedtls_x509_crt_verify(). An entry is keyed by the SHA-256 digest of the
+ * child certificate and its issuer's public key, so a repeated chain skips
+ * the public key operation for intermediates already validated. Leave
+ * undefined to disable.
+ */
+
+#if defined(MBEDTLS_X509_CRT_CACHE_ENTRIES) || defined(MBEDTLS_X509_CRT_VERIFY_CACHE_ENTRIES)
+
+#if !defined(MBEDTLS_SHA256_C)
+#error "MBEDTLS_X509_CRT_CACHE_ENTRIES and MBEDTLS_X509_CRT_VERIFY_CACHE_ENTRIES require MBEDTLS_SHA256_C"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * \brief          Initialize the certificate caches. Must be called before
+ *                 any other cache function or certificate verification.
+ */
+void mbedtls_x509_crt_cache_init( void );
+
+/**
+ * \brief          Release every cached chain and forget all memoised
+ *                 signature checks. Chains returned by
+ *                 mbedtls_x509_crt_cache_parse_der() become invalid.
+ */
+void mbedtls_x509_crt_cache_free( void );
+
+#if defined(MBEDTLS_X509_CRT_CACHE_ENTRIES)
+/**
+ * \brief          Parse one or more concatenated DER certificates without
+ *                 copying them, or return the chain parsed previously from
+ *                 identical data.
+ *
+ * \param buf      DER data. Must stay valid and unchanged until
+ *                 mbedtls_x509_crt_cache_free() is called.
+ * \param buflen   Size of the DER data.
+ * \param chain    Set to the cached chain on success. The chain is shared
+ *                 and must not be modified or freed by the caller.
+ *
+ * \return         0 if successful, MBEDTLS_ERR_X509_ALLOC_FAILED if the
+ *                 cache is full, or a specific X509 or PEM error code.
+ */
+int mbedtls_x509_crt_cache_parse_der( const unsigned char *buf,
+                                      size_t buflen,
+                                      mbedtls_x509_crt **chain );
+#endif /* MBEDTLS_X509_CRT_CACHE_ENTRIES */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MBEDTLS_X509_CRT_CACHE_ENTRIES || MBEDTLS_X509_CRT_VERIFY_CACHE_ENTRIES */
+
+#endif /* MBEDTLS_X509_CRT_CACHE_H */
@@ -0,0 +1,541 @@
+/*
+ *  TLS session cache stored in Virtual EEPROM records
+ *
+ *  Copyright (C) 2006-2015, ARM Limited, All Rights Reserved
+ *  SPDX-License-Identifier: Apache-2.0
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *  not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ *  WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *
+ *  This file is part of mbed TLS (https://tls.mbed.org)
+ */
+/*
+ *  Each entry is one record:
+ *
+ *      magic | sequence | length | SHA-256(key) | counter block | tag | E(session)
+ *
+ *  The session is serialized with mbedtls_ssl_session_save() and encrypted
+ *  with AES-CTR under the wrapped key, starting from a random counter block.
+ *  The tag is the HMAC-SHA-256 of everything before it and the ciphertext,
+ *  truncated to 16 bytes. The HMAC key is derived by encrypting two constant
+ *  blocks with the wrapped key, so it never exists outside the device either.
+ */
+
+#if !defined(MBEDTLS_CONFIG_FILE)
+#include "mbedtls/config.h"
+#else
+#include MBEDTLS_CONFIG_FILE
+#endif
+
+#include "ssl_cache_vee.h"
+
+#if defined(MBEDTLS_SSL_CACHE_VEE_C)
+
+#include "mbedtls/sha256.h"
+#include "mbedtls/platform_util.h"
+
+#include <string.h>
+
+#if defined(MBEDTLS_HAVE_TIME)
+#include "mbedtls/platform_time.h"
+#endif
+
+#define SSL_CACHE_VEE_MAGIC         0x31435353U    /* "SSC1" */
+#define SSL_CACHE_VEE_TAG_OFFSET    ( 12 + 32 + 16 )
+#define SSL_CACHE_VEE_TAG_LEN       16
+
+typedef struct
+{
+    uint32_t magic;
+    uint32_t sequence;
+    uint32_t length;
+    unsigned char key_hash[32];
+    unsigned char counter[16];
+    unsigned char tag[SSL_CACHE_VEE_TAG_LEN];
+}
+ssl_cache_vee_header;
+
+static int ssl_cache_vee_lock( mbedtls_ssl_cache_vee_context *ctx )
+{
+#if defined(MBEDTLS_THREADING_C)
+    if( mbedtls_mutex_lock( &ctx->mutex ) != 0 )
+        return( MBEDTLS_ERR_SSL_INTERNAL_ERROR );
+#else
+    (void) ctx;
+#endif
+    return( 0 );
+}
+
+static void ssl_cache_vee_unlock( mbedtls_ssl_cache_vee_context *ctx )
+{
+#if defined(MBEDTLS_THREADING_C)
+    (void) mbedtls_mutex_unlock( &ctx->mutex );
+#else
+    (void) ctx;
+#endif
+}
+
+/*
+ * HMAC-SHA-256( mac_key, hdr[0..tag) | ct ), truncated to the tag length.
+ * Written out over SHA-256 so that no MD context has to be allocated.
+ */
+static int ssl_cache_vee_tag( mbedtls_ssl_cache_vee_context *ctx,
+                              const unsigned char *hdr,
+                              const unsigned char *ct, size_t ct_len,
+                              unsigned char tag[SSL_CACHE_VEE_TAG_LEN] )
+{
+    int ret;
+    size_t i;
+    unsigned char pad[64];
+    unsigned char digest[32];
+    mbedtls_sha256_context sha256;
+
+    mbedtls_sha256_init( &sha256 );
+
+    memset( pad, 0x36, sizeof( pad ) );
+    for( i = 0; i < sizeof( ctx->mac_key ); i++ )
+        pad[i] ^= ctx->mac_key[i];
+
+    if( ( ret = mbedtls_sha256_starts_ret( &sha256, 0 ) ) != 0 ||
+        ( ret = mbedtls_sha256_update_ret( &sha256, pad, sizeof( pad ) ) ) != 0 ||
+        ( ret = mbedtls_sha256_update_ret( &sha256, hdr, SSL_CACHE_VEE_TAG_OFFSET ) ) != 0 ||
+        ( ret = mbedtls_sha256_update_ret( &sha256, ct, ct_len ) ) != 0 ||
+        ( ret = mbedtls_sha256_finish_ret( &sha256, digest ) ) != 0 )
+        goto cleanup;
+
+    for( i = 0; i < sizeof( pad ); i++ )
+        pad[i] ^= 0x36 ^ 0x5C;
+
+    if( ( ret = mbedtls_sha256_starts_ret( &sha256, 0 ) ) != 0 ||
+        ( ret = mbedtls_sha256_update_ret( &sha256, pad, sizeof( pad ) ) ) != 0 ||
+        ( ret = mbedtls_sha256_update_ret( &sha256, digest, sizeof( digest ) ) ) != 0 ||
+        ( ret = mbedtls_sha256_finish_ret( &sha256, digest ) ) != 0 )
+        goto cleanup;
+
+    memcpy( tag, digest, SSL_CACHE_VEE_TAG_LEN );
+
+cleanup:
+    mbedtls_sha256_free( &sha256 );
+    mbedtls_platform_zeroize( pad, sizeof( pad ) );
+    mbedtls_platform_zeroize( digest, sizeof( digest ) );
+
+    return( ret );
+}
+
+/* Constant time comparison of two tags. */
+static int ssl_cache_vee_tag_cmp( const unsigned char *a, const unsigned char *b )
+{
+    size_t i;
+    unsigned char diff = 0;
+
+    for( i = 0; i < SSL_CACHE_VEE_TAG_LEN; i++ )
+        diff |= a[i] ^ b[i];
+
+    return( diff );
+}
+
+/*
+ * Read the header of record slot. Returns 0 and points *ct at the ciphertext
+ * if the slot holds a well formed entry.
+ */
+static int ssl_cache_vee_header_get( mbedtls_ssl_cache_vee_context *ctx,
+                                     uint32_t slot,
+                                     ssl_cache_vee_header *hdr,
+                                     const unsigned char **ct )
+{
+    uint8_t *p_rec;
+    uint32_t rec_len;
+
+    if( ctx->p_vee->p_api->recordPtrGet( ctx->p_vee->p_ctrl, ctx->first_rec_id + slot,
+                                         &p_rec, &rec_len ) != FSP_SUCCESS )
+        return( -1 );
+
+    if( rec_len < sizeof( *hdr ) )
+        return( -1 );
+
+    /* Records are only aligned to the data flash write size */
+    memcpy( hdr, p_rec, sizeof( *hdr ) );
+
+    if( hdr->magic != SSL_CACHE_VEE_MAGIC ||
+        hdr->length > MBEDTLS_SSL_CACHE_VEE_SESSION_MAX_LEN ||
+        hdr->length > rec_len - sizeof( *hdr ) )
+        return( -1 );
+
+    *ct = p_rec + sizeof( *hdr );
+
+    return( 0 );
+}
+
+/*
+ * Find the slot holding key_hash. If there is none, *slot is set to the slot
+ * to replace: the first unused one, or else the least recently written.
+ * Returns 0 if the key was found.
+ */
+static int ssl_cache_vee_find( mbedtls_ssl_cache_vee_context *ctx,
+                               const unsigned char key_hash[32],
+                               uint32_t *slot,
+                               ssl_cache_vee_header *hdr,
+                               const unsigned char **ct )
+{
+    uint32_t i;
+    uint32_t oldest = UINT32_MAX;
+    int have_free = 0;
+
+    *slot = 0;
+
+    for( i = 0; i < ctx->entries; i++ )
+    {
+        if( ssl_cache_vee_header_get( ctx, i, hdr, ct ) != 0 )
+        {
+            if( have_free == 0 )
+            {
+                *slot = i;
+                have_free = 1;
+            }
+            continue;
+        }
+
+        if( memcmp( hdr->key_hash, key_hash, sizeof( hdr->key_hash ) ) == 0 )
+        {
+            *slot = i;
+            return( 0 );
+        }
+
+        /* Age relative to the next sequence number, so that wrap-around is harmless */
+        if( have_free == 0 && ( hdr->sequence - ctx->sequence ) < oldest )
+        {
+            oldest = hdr->sequence - ctx->sequence;
+            *slot = i;
+        }
+    }
+
+    return( -1 );
+}
+
+/*
+ * The Virtual EEPROM programs a record straight from ctx->record, so the
+ * buffer must not change until it is ready again. A refresh may be writing
+ * the last record too, so it counts as busy.
+ */
+static int ssl_cache_vee_ready( mbedtls_ssl_cache_vee_context *ctx )
+{
+    rm_vee_status_t status;
+
+    if( ctx->p_vee->p_api->statusGet( ctx->p_vee->p_ctrl, &status ) != FSP_SUCCESS )
+        return( MBEDTLS_ERR_SSL_INTERNAL_ERROR );
+
+    if( status.state == RM_VEE_STATE_READY )
+        return( 0 );
+
+    if( status.state == RM_VEE_STATE_BUSY || status.state == RM_VEE_STATE_REFRESH )
+        return( MBEDTLS_ERR_SSL_WANT_WRITE );
+
+    return( MBEDTLS_ERR_SSL_INTERNAL_ERROR );
+}
+
+/* Start writing ctx->record to a slot, padded to a multiple of 16 bytes. */
+static int ssl_cache_vee_write( mbedtls_ssl_cache_vee_context *ctx, uint32_t slot, size_t len )
+{
+    fsp_err_t err;
+
+    len = ( len + 15 ) & ~( (size_t) 15 );
+
+    err = ctx->p_vee->p_api->recordWrite( ctx->p_vee->p_ctrl, ctx->first_rec_id + slot,
+                                          (uint8_t const *) ctx->record, (uint32_t) len );
+    if( err == FSP_ERR_IN_USE )
+        return( MBEDTLS_ERR_SSL_WANT_WRITE );
+
+    return( err == FSP_SUCCESS ? 0 : MBEDTLS_ERR_SSL_INTERNAL_ERROR );
+}
+
+void mbedtls_ssl_cache_vee_init( mbedtls_ssl_cache_vee_context *ctx )
+{
+    memset( ctx, 0, sizeof( mbedtls_ssl_cache_vee_context ) );
+
+    mbedtls_aes_init( &ctx->aes );
+
+#if defined(MBEDTLS_THREADING_C)
+    mbedtls_mutex_init( &ctx->mutex );
+#endif
+}
+
+int mbedtls_ssl_cache_vee_setup( mbedtls_ssl_cache_vee_context *ctx,
+                                 rm_vee_instance_t const *p_vee,
+                                 uint32_t first_rec_id,
+                                 uint32_t entries,
+                                 const unsigned char *wrapped_key,
+                                 unsigned int keybits,
+                                 int (*f_rng)(void *, unsigned char *, size_t),
+                                 void *p_rng )
+{
+    int ret;
+    uint32_t i;
+    uint32_t newest = 0;
+    unsigned char block[16];
+    ssl_cache_vee_header hdr;
+    const unsigned char *ct;
+
+    if( ctx == NULL || p_vee == NULL || wrapped_key == NULL || f_rng == NULL || entries == 0 )
+        return( MBEDTLS_ERR_SSL_BAD_INPUT_DATA );
+
+    if( ( ret = ssl_cache_vee_lock( ctx ) ) != 0 )
+        return( ret );
+
+    ctx->p_vee = p_vee;
+    ctx->first_rec_id = first_rec_id;
+    ctx->entries = entries;
+    ctx->f_rng = f_rng;
+    ctx->p_rng = p_rng;
+
+    /* The vendor flag makes the SCE use the key as it is, without wrapping it again */
+    mbedtls_aes_free( &ctx->aes );
+    mbedtls_aes_init( &ctx->aes );
+    ctx->aes.vendor_ctx = (bool *) true;
+
+    if( ( ret = mbedtls_aes_setkey_enc( &ctx->aes, wrapped_key, keybits ) ) != 0 )
+        goto exit;
+
+    /* mac_key = E(K, "SSL-CACHE-VEE" | 0 | 0 | 1) | E(K, "SSL-CACHE-VEE" | 0 | 0 | 2) */
+    for( i = 0; i < sizeof( ctx->mac_key ) / sizeof( block ); i++ )
+    {
+        memset( block, 0, sizeof( block ) );
+        memcpy( block, "SSL-CACHE-VEE", 13 );
+        block[15] = (unsigned char) ( i + 1 );
+
+        if( ( ret = mbedtls_aes_crypt_ecb( &ctx->aes, MBEDTLS_AES_ENCRYPT, block,
+                                           &ctx->mac_key[i * sizeof( block )] ) ) != 0 )
+            goto exit;
+    }
+
+    /* Continue numbering after the newest entry that survived the reset */
+    for( i = 0; i < entries; i++ )
+    {
+        if( ssl_cache_vee_header_get( ctx, i, &hdr, &ct ) == 0 &&
+            ( newest == 0 || (int32_t) ( hdr.sequence - newest ) > 0 ) )
+            newest = hdr.sequence;
+    }
+
+    ctx->sequence = newest + 1;
+
+exit:
+    if( ret != 0 )
+        mbedtls_platform_zeroize( ctx->mac_key, sizeof( ctx->mac_key ) );
+
+    mbedtls_platform_zeroize( block, sizeof( block ) );
+    ssl_cache_vee_unlock( ctx );
+
+    return( ret );
+}
+
+#if defined(MBEDTLS_HAVE_TIME)
+void mbedtls_ssl_cache_vee_set_timeout( mbedtls_ssl_cache_vee_context *ctx, uint32_t timeout )
+{
+    ctx->timeout = timeout;
+}
+#endif /* MBEDTLS_HAVE_TIME */
+
+int mbedtls_ssl_cache_vee_save( mbedtls_ssl_cache_vee_context *ctx,
+                                const unsigned char *key,
+                                size_t key_len,
+                                const mbedtls_ssl_session *session )
+{
+    int ret;
+    size_t olen;
+    size_t nc_off = 0;
+    uint32_t slot;
+    unsigned char counter[16];
+    unsigned char stream_block[16];
+    ssl_cache_vee_header found;
+    const unsigned char *ct;
+    ssl_cache_vee_header *hdr = (ssl_cache_vee_header *) ctx->record;
+    unsigned char *data = (unsigned char *) ctx->record + sizeof( ssl_cache_vee_header );
+
+    if( ctx->p_vee == NULL || session == NULL )
+        return( MBEDTLS_ERR_SSL_BAD_INPUT_DATA );
+
+    if( ( ret = ssl_cache_vee_lock( ctx ) ) != 0 )
+        return( ret );
+
+    /* A previous record may still be programmed from ctx->record */
+    if( ( ret = ssl_cache_vee_ready( ctx ) ) != 0 )
+        goto exit;
+
+    if( ( ret = mbedtls_ssl_session_save( session, ctx->session,
+                                          sizeof( ctx->session ), &olen ) ) != 0 )
+        goto exit;
+
+    memset( ctx->record, 0, sizeof( ctx->record ) );
+    hdr->magic = SSL_CACHE_VEE_MAGIC;
+    hdr->sequence = ctx->sequence;
+    hdr->length = (uint32_t) olen;
+
+    if( ( ret = mbedtls_sha256_ret( key, key_len, hdr->key_hash, 0 ) ) != 0 ||
+        ( ret = ctx->f_rng( ctx->p_rng, hdr->counter, sizeof( hdr->counter ) ) ) != 0 )
+        goto exit;
+
+    memcpy( counter, hdr->counter, sizeof( counter ) );
+
+    if( ( ret = mbedtls_aes_crypt_ctr( &ctx->aes, olen, &nc_off, counter, stream_block,
+                                       ctx->session, data ) ) != 0 ||
+        ( ret = ssl_cache_vee_tag( ctx, (const unsigned char *) hdr, data, olen, hdr->tag ) ) != 0 )
+        goto exit;
+
+    (void) ssl_cache_vee_find( ctx, hdr->key_hash, &slot, &found, &ct );
+
+    if( ( ret = ssl_cache_vee_write( ctx, slot, sizeof( ssl_cache_vee_header ) + olen ) ) != 0 )
+        goto exit;
+
+    ctx->sequence++;
+
+exit:
+    mbedtls_platform_zeroize( ctx->session, sizeof( ctx->session ) );
+    mbedtls_platform_zeroize( stream_block, sizeof( stream_block ) );
+    ssl_cache_vee_unlock( ctx );
+
+    return( ret );
+}
+
+int mbedtls_ssl_cache_vee_load( mbedtls_ssl_cache_vee_context *ctx,
+                                const unsigned char *key,
+                                size_t key_len,
+                                mbedtls_ssl_session *session )
+{
+    int ret;
+    size_t nc_off = 0;
+    uint32_t slot;
+    unsigned char key_hash[32];
+    unsigned char tag[SSL_CACHE_VEE_TAG_LEN];
+    unsigned char stream_block[16];
+    ssl_cache_vee_header hdr;
+    const unsigned char *ct;
+
+    if( ctx->p_vee == NULL || session == NULL )
+        return( MBEDTLS_ERR_SSL_BAD_INPUT_DATA );
+
+    if( ( ret = mbedtls_sha256_ret( key, key_len, key_hash, 0 ) ) != 0 )
+        return( ret );
+
+    if( ( ret = ssl_cache_vee_lock( ctx ) ) != 0 )
+        return( ret );
+
+    if( ssl_cache_vee_find( ctx, key_hash, &slot, &hdr, &ct ) != 0 )
+    {
+        ret = 1;
+        goto exit;
+    }
+
+    /* The ciphertext is authenticated in place, so flash corruption or a
+     * record from another device is rejected before anything is decrypted */
+    if( ( ret = ssl_cache_vee_tag( ctx, (const unsigned char *) &hdr, ct, hdr.length, tag ) ) != 0 )
+        goto exit;
+
+    if( ssl_cache_vee_tag_cmp( tag, hdr.tag ) != 0 )
+    {
+        ret = 1;
+        goto exit;
+    }
+
+    if( ( ret = mbedtls_aes_crypt_ctr( &ctx->aes, hdr.length, &nc_off, hdr.counter, stream_block,
+                                       ct, ctx->session ) ) != 0 )
+        goto exit;
+
+    if( ( ret = mbedtls_ssl_session_load( session, ctx->session, hdr.length ) ) != 0 )
+        goto exit;
+
+#if defined(MBEDTLS_HAVE_TIME)
+    if( ctx->timeout != 0 &&
+        mbedtls_time( NULL ) - session->start > (mbedtls_time_t) ctx->timeout )
+    {
+        mbedtls_ssl_session_free( session );
+        ret = 1;
+        goto exit;
+    }
+#endif
+
+exit:
+    mbedtls_platform_zeroize( ctx->session, sizeof( ctx->session ) );
+    mbedtls_platform_zeroize( stream_block, sizeof( stream_block ) );
+    ssl_cache_vee_unlock( ctx );
+
+    return( ret );
+}
+
+int mbedtls_ssl_cache_vee_remove( mbedtls_ssl_cache_vee_context *ctx,
+                                  const unsigned char *key,
+                                  size_t key_len )
+{
+    int ret;
+    uint32_t slot;
+    unsigned char key_hash[32];
+    ssl_cache_vee_header hdr;
+    const unsigned char *ct;
+
+    if( ctx->p_vee == NULL )
+        return( MBEDTLS_ERR_SSL_BAD_INPUT_DATA );
+
+    if( ( ret = mbedtls_sha256_ret( key, key_len, key_hash, 0 ) ) != 0 )
+        return( ret );
+
+    if( ( ret = ssl_cache_vee_lock( ctx ) ) != 0 )
+        return( ret );
+
+    if( ssl_cache_vee_find( ctx, key_hash, &slot, &hdr, &ct ) != 0 )
+        goto exit;
+
+    if( ( ret = ssl_cache_vee_ready( ctx ) ) != 0 )
+        goto exit;
+
+    /* The Virtual EEPROM cannot delete a record, so overwrite it with one that has no magic */
+    memset( ctx->record, 0, 16 );
+    ret = ssl_cache_vee_write( ctx, slot, 16 );
+
+exit:
+    ssl_cache_vee_unlock( ctx );
+
+    return( ret );
+}
+
+int mbedtls_ssl_cache_vee_get( void *data, mbedtls_ssl_session *session )
+{
+    mbedtls_ssl_cache_vee_context *ctx = (mbedtls_ssl_cache_vee_context *) data;
+
+    if( ctx == NULL || session == NULL || session->id_len == 0 )
+        return( 1 );
+
+    return( mbedtls_ssl_cache_vee_load( ctx, session->id, session->id_len, session ) == 0 ? 0 : 1 );
+}
+
+int mbedtls_ssl_cache_vee_set( void *data, const mbedtls_ssl_session *session )
+{
+    mbedtls_ssl_cache_vee_context *ctx = (mbedtls_ssl_cache_vee_context *) data;
+
+    if( ctx == NULL || session == NULL || session->id_len == 0 )
+        return( MBEDTLS_ERR_SSL_BAD_INPUT_DATA );
+
+    return( mbedtls_ssl_cache_vee_save( ctx, session->id, session->id_len, session ) );
+}
+
+void mbedtls_ssl_cache_vee_free( mbedtls_ssl_cache_vee_context *ctx )
+{
+    if( ctx == NULL )
+        return;
+
+    mbedtls_aes_free( &ctx->aes );
+
+#if defined(MBEDTLS_THREADING_C)
+    mbedtls_mutex_free( &ctx->mutex );
+#endif
+
+    mbedtls_platform_zeroize( ctx, sizeof( mbedtls_ssl_cache_vee_context ) );
+}
+
+#endif /* MBEDTLS_SSL_CACHE_VEE_C */
@@ -68,6 +68,12 @@
 #include "mbedtls/threading.h"
 #endif
 
+#include "x509_crt_cache.h"
+
+#if defined(MBEDTLS_X509_CRT_CACHE_ENTRIES) || defined(MBEDTLS_X509_CRT_VERIFY_CACHE_ENTRIES)
+#include "mbedtls/sha256.h"
+#endif
+
 #if defined(_WIN32) && !defined(EFIX64) && !defined(EFI32)
 #include <windows.h>
 #else
@@ -1378,6 +1384,293 @@ int mbedtls_x509_crt_parse_der( mbedtls_x509_crt *chain,
     return( mbedtls_x509_crt_parse_der_internal( chain, buf, buflen, 1 ) );
 }
 
+#if defined(MBEDTLS_X509_CRT_CACHE_ENTRIES) || defined(MBEDTLS_X509_CRT_VERIFY_CACHE_ENTRIES)
+
+#define X509_CRT_CACHE_DIGEST_LEN    32
+
+#if defined(MBEDTLS_THREADING_C)
+static mbedtls_threading_mutex_t x509_crt_cache_mutex;
+#endif
+static int x509_crt_cache_ready = 0;
+
+#if defined(MBEDTLS_X509_CRT_CACHE_ENTRIES)
+/*
+ * Cached chain: digest of the DER data it was parsed from and its first node
+ */
+typedef struct {
+    unsigned char digest[X509_CRT_CACHE_DIGEST_LEN];
+    mbedtls_x509_crt *chain;
+} x509_crt_cache_chain;
+
+static mbedtls_x509_crt x509_crt_cache_nodes[MBEDTLS_X509_CRT_CACHE_ENTRIES];
+static unsigned char x509_crt_cache_node_used[MBEDTLS_X509_CRT_CACHE_ENTRIES];
+static x509_crt_cache_chain x509_crt_cache_chains[MBEDTLS_X509_CRT_CACHE_ENTRIES];
+#endif /* MBEDTLS_X509_CRT_CACHE_ENTRIES */
+
+#if defined(MBEDTLS_X509_CRT_VERIFY_CACHE_ENTRIES)
+static unsigned char x509_crt_verify_cache[MBEDTLS_X509_CRT_VERIFY_CACHE_ENTRIES][X509_CRT_CACHE_DIGEST_LEN];
+static size_t x509_crt_verify_cache_count = 0;
+static size_t x509_crt_verify_cache_next = 0;
+#endif /* MBEDTLS_X509_CRT_VERIFY_CACHE_ENTRIES */
+
+static int x509_crt_cache_lock( void )
+{
+    if( x509_crt_cache_ready == 0 )
+        return( -1 );
+
+#if defined(MBEDTLS_THREADING_C)
+    if( mbedtls_mutex_lock( &x509_crt_cache_mutex ) != 0 )
+        return( -1 );
+#endif
+
+    return( 0 );
+}
+
+static void x509_crt_cache_unlock( void )
+{
+#if defined(MBEDTLS_THREADING_C)
+    (void) mbedtls_mutex_unlock( &x509_crt_cache_mutex );
+#endif
+}
+
+#if defined(MBEDTLS_X509_CRT_CACHE_ENTRIES)
+/*
+ * Release the nodes of a cached chain. Nodes belong to the static pool, so
+ * each one is unlinked and freed as a single-element chain.
+ */
+static void x509_crt_cache_release( mbedtls_x509_crt *crt )
+{
+    mbedtls_x509_crt *next;
+
+    while( crt != NULL )
+    {
+        next = crt->next;
+        crt->next = NULL;
+        mbedtls_x509_crt_free( crt );
+        x509_crt_cache_node_used[crt - x509_crt_cache_nodes] = 0;
+        crt = next;
+    }
+}
+
+static mbedtls_x509_crt *x509_crt_cache_node_alloc( void )
+{
+    size_t i;
+
+    for( i = 0; i < MBEDTLS_X509_CRT_CACHE_ENTRIES; i++ )
+    {
+        if( x509_crt_cache_node_used[i] == 0 )
+        {
+            x509_crt_cache_node_used[i] = 1;
+            mbedtls_x509_crt_init( &x509_crt_cache_nodes[i] );
+            return( &x509_crt_cache_nodes[i] );
+        }
+    }
+
+    return( NULL );
+}
+#endif /* MBEDTLS_X509_CRT_CACHE_ENTRIES */
+
+void mbedtls_x509_crt_cache_init( void )
+{
+#if defined(MBEDTLS_THREADING_C)
+    if( x509_crt_cache_ready == 0 )
+        mbedtls_mutex_init( &x509_crt_cache_mutex );
+#endif
+
+#if defined(MBEDTLS_X509_CRT_CACHE_ENTRIES)
+    memset( x509_crt_cache_node_used, 0, sizeof( x509_crt_cache_node_used ) );
+    memset( x509_crt_cache_chains, 0, sizeof( x509_crt_cache_chains ) );
+#endif
+#if defined(MBEDTLS_X509_CRT_VERIFY_CACHE_ENTRIES)
+    x509_crt_verify_cache_count = 0;
+    x509_crt_verify_cache_next = 0;
+#endif
+
+    x509_crt_cache_ready = 1;
+}
+
+void mbedtls_x509_crt_cache_free( void )
+{
+#if defined(MBEDTLS_X509_CRT_CACHE_ENTRIES)
+    size_t i;
+#endif
+
+    if( x509_crt_cache_lock() != 0 )
+        return;
+
+#if defined(MBEDTLS_X509_CRT_CACHE_ENTRIES)
+    for( i = 0; i < MBEDTLS_X509_CRT_CACHE_ENTRIES; i++ )
+        x509_crt_cache_release( x509_crt_cache_chains[i].chain );
+
+    memset( x509_crt_cache_chains, 0, sizeof( x509_crt_cache_chains ) );
+#endif
+#if defined(MBEDTLS_X509_CRT_VERIFY_CACHE_ENTRIES)
+    mbedtls_platform_zeroize( x509_crt_verify_cache, sizeof( x509_crt_verify_cache ) );
+    x509_crt_verify_cache_count = 0;
+    x509_crt_verify_cache_next = 0;
+#endif
+
+    x509_crt_cache_ready = 0;
+    x509_crt_cache_unlock();
+
+#if defined(MBEDTLS_THREADING_C)
+    mbedtls_mutex_free( &x509_crt_cache_mutex );
+#endif
+}
+
+#if defined(MBEDTLS_X509_CRT_CACHE_ENTRIES)
+int mbedtls_x509_crt_cache_parse_der( const unsigned char *buf,
+                                      size_t buflen,
+                                      mbedtls_x509_crt **chain )
+{
+    int ret;
+    size_t i;
+    unsigned char digest[X509_CRT_CACHE_DIGEST_LEN];
+    x509_crt_cache_chain *slot = NULL;
+    mbedtls_x509_crt *head = NULL, *prev = NULL, *crt;
+
+    if( buf == NULL || buflen == 0 || chain == NULL )
+        return( MBEDTLS_ERR_X509_BAD_INPUT_DATA );
+
+    if( ( ret = mbedtls_sha256_ret( buf, buflen, digest, 0 ) ) != 0 )
+        return( ret );
+
+    if( x509_crt_cache_lock() != 0 )
+        return( MBEDTLS_ERR_X509_BAD_INPUT_DATA );
+
+    for( i = 0; i < MBEDTLS_X509_CRT_CACHE_ENTRIES; i++ )
+    {
+        if( x509_crt_cache_chains[i].chain == NULL )
+        {
+            if( slot == NULL )
+                slot = &x509_crt_cache_chains[i];
+        }
+        else if( memcmp( x509_crt_cache_chains[i].digest, digest,
+                         sizeof( digest ) ) == 0 )
+        {
+            *chain = x509_crt_cache_chains[i].chain;
+            x509_crt_cache_unlock();
+            return( 0 );
+        }
+    }
+
+    ret = MBEDTLS_ERR_X509_ALLOC_FAILED;
+
+    /*
+     * Parse each certificate in place into its own pool node; the raw field
+     * of every node points into buf.
+     */
+    while( slot != NULL && buflen > 0 )
+    {
+        if( ( crt = x509_crt_cache_node_alloc() ) == NULL )
+        {
+            ret = MBEDTLS_ERR_X509_ALLOC_FAILED;
+            break;
+        }
+
+        if( head == NULL )
+            head = crt;
+        else
+            prev->next = crt;
+
+        if( ( ret = x509_crt_parse_der_core( crt, buf, buflen, 0 ) ) != 0 )
+            break;
+
+        buf += crt->raw.len;
+        buflen -= crt->raw.len;
+        prev = crt;
+    }
+
+    if( ret == 0 )
+    {
+        memcpy( slot->digest, digest, sizeof( digest ) );
+        slot->chain = head;
+        *chain = head;
+    }
+    else
+    {
+        x509_crt_cache_release( head );
+    }
+
+    x509_crt_cache_unlock();
+
+    return( ret );
+}
+#endif /* MBEDTLS_X509_CRT_CACHE_ENTRIES */
+
+#if defined(MBEDTLS_X509_CRT_VERIFY_CACHE_ENTRIES)
+/*
+ * Memo key for a signature check: the child certificate as a whole (so any
+ * change to the signed data or the signature misses) and the issuer's key
+ */
+static int x509_crt_verify_cache_key( const mbedtls_x509_crt *child,
+                                      const mbedtls_x509_crt *parent,
+                                      unsigned char digest[X509_CRT_CACHE_DIGEST_LEN] )
+{
+    int ret;
+    mbedtls_sha256_context sha256;
+
+    mbedtls_sha256_init( &sha256 );
+
+    if( ( ret = mbedtls_sha256_starts_ret( &sha256, 0 ) ) != 0 ||
+        ( ret = mbedtls_sha256_update_ret( &sha256, child->raw.p,
+                                           child->raw.len ) ) != 0 ||
+        ( ret = mbedtls_sha256_update_ret( &sha256, parent->pk_raw.p,
+                                           parent->pk_raw.len ) ) != 0 ||
+        ( ret = mbedtls_sha256_finish_ret( &sha256, digest ) ) != 0 )
+    {
+        mbedtls_sha256_free( &sha256 );
+        return( ret );
+    }
+
+    mbedtls_sha256_free( &sha256 );
+
+    return( 0 );
+}
+
+static int x509_crt_verify_cache_find( const unsigned char digest[X509_CRT_CACHE_DIGEST_LEN] )
+{
+    size_t i;
+    int found = 0;
+
+    if( x509_crt_cache_lock() != 0 )
+        return( 0 );
+
+    for( i = 0; i < x509_crt_verify_cache_count; i++ )
+    {
+        if( memcmp( x509_crt_verify_cache[i], digest,
+                    X509_CRT_CACHE_DIGEST_LEN ) == 0 )
+        {
+            found = 1;
+            break;
+        }
+    }
+
+    x509_crt_cache_unlock();
+
+    return( found );
+}
+
+static void x509_crt_verify_cache_add( const unsigned char digest[X509_CRT_CACHE_DIGEST_LEN] )
+{
+    if( x509_crt_cache_lock() != 0 )
+        return;
+
+    memcpy( x509_crt_verify_cache[x509_crt_verify_cache_next], digest,
+            X509_CRT_CACHE_DIGEST_LEN );
+
+    x509_crt_verify_cache_next = ( x509_crt_verify_cache_next + 1 ) %
+                                 MBEDTLS_X509_CRT_VERIFY_CACHE_ENTRIES;
+
+    if( x509_crt_verify_cache_count < MBEDTLS_X509_CRT_VERIFY_CACHE_ENTRIES )
+        x509_crt_verify_cache_count++;
+
+    x509_crt_cache_unlock();
+}
+#endif /* MBEDTLS_X509_CRT_VERIFY_CACHE_ENTRIES */
+
+#endif /* MBEDTLS_X509_CRT_CACHE_ENTRIES || MBEDTLS_X509_CRT_VERIFY_CACHE_ENTRIES */
+
 /*
  * Parse one or more PEM certificates from a buffer and add them to the chained
  * list
@@ -2402,8 +2695,31 @@ static int x509_crt_check_signature( const mbedtls_x509_crt *child,
 {
     unsigned char hash[MBEDTLS_MD_MAX_SIZE];
     size_t hash_len;
+#if defined(MBEDTLS_X509_CRT_VERIFY_CACHE_ENTRIES)
+    int ret;
+    int memo = 0;
+    unsigned char memo_key[X509_CRT_CACHE_DIGEST_LEN];
+#endif
 #if !defined(MBEDTLS_USE_PSA_CRYPTO)
     const mbedtls_md_info_t *md_info;
+#else
+    psa_hash_operation_t hash_operation = PSA_HASH_OPERATION_INIT;
+    psa_algorithm_t hash_alg = mbedtls_psa_translate_md( child->sig_md );
+#endif
+
+#if defined(MBEDTLS_X509_CRT_VERIFY_CACHE_ENTRIES)
+    /* Only CA certificates are memoised: leaf certificates rarely repeat */
+    if( rs_ctx == NULL && child->ca_istrue != 0 &&
+        x509_crt_verify_cache_key( child, parent, memo_key ) == 0 )
+    {
+        if( x509_crt_verify_cache_find( memo_key ) != 0 )
+            return( 0 );
+
+        memo = 1;
+    }
+#endif
+
+#if !defined(MBEDTLS_USE_PSA_CRYPTO)
     md_info = mbedtls_md_info_from_type( child->sig_md );
     hash_len = mbedtls_md_get_size( md_info );
 
@@ -2411,9 +2727,6 @@ static int x509_crt_check_signature( const mbedtls_x509_crt *child,
     if( mbedtls_md( md_info, child->tbs.p, child->tbs.len, hash ) != 0 )
         return( -1 );
 #else
-    psa_hash_operation_t hash_operation = PSA_HASH_OPERATION_INIT;
-    psa_algorithm_t hash_alg = mbedtls_psa_translate_md( child->sig_md );
-
     if( psa_hash_setup( &hash_operation, hash_alg ) != PSA_SUCCESS )
         return( -1 );
 
@@ -2444,9 +2757,20 @@ static int x509_crt_check_signature( const mbedtls_x509_crt *child,
     (void) rs_ctx;
 #endif
 
+#if defined(MBEDTLS_X509_CRT_VERIFY_CACHE_ENTRIES)
+    ret = mbedtls_pk_verify_ext( child->sig_pk, child->sig_opts, &parent->pk,
+                child->sig_md, hash, hash_len,
+                child->sig.p, child->sig.len );
+
+    if( ret == 0 && memo != 0 )
+        x509_crt_verify_cache_add( memo_key );
+
+    return( ret );
+#else
     return( mbedtls_pk_verify_ext( child->sig_pk, child->sig_opts, &parent->pk,
                 child->sig_md, hash, hash_len,
                 child->sig.p, child->sig.len ) );
+#endif
 }
 
 /*
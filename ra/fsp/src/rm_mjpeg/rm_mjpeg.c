@@ -0,0 +1,978 @@
+/***********************************************************************************************************************
+ * Copyright [2020] Renesas Electronics Corporation and/or its affiliates.  All Rights Reserved.
+ *
+ * This software and documentation are supplied by Renesas Electronics America Inc. and may only be used with products
+ * of Renesas Electronics Corp. and its affiliates ("Renesas").  No other uses are authorized.  Renesas products are
+ * sold pursuant to Renesas terms and conditions of sale.  Purchasers are solely responsible for the selection and use
+ * of Renesas products and Renesas assumes no liability.  No license, express or implied, to any intellectual property
+ * right is granted by Renesas. This software is protected under all applicable laws, including copyright laws. Renesas
+ * reserves the right to change or discontinue this software and/or this documentation. THE SOFTWARE AND DOCUMENTATION
+ * IS DELIVERED TO YOU "AS IS," AND RENESAS MAKES NO REPRESENTATIONS OR WARRANTIES, AND TO THE FULLEST EXTENT
+ * PERMISSIBLE UNDER APPLICABLE LAW, DISCLAIMS ALL WARRANTIES, WHETHER EXPLICITLY OR IMPLICITLY, INCLUDING WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, AND NONINFRINGEMENT, WITH RESPECT TO THE SOFTWARE OR
+ * DOCUMENTATION.  RENESAS SHALL HAVE NO LIABILITY ARISING OUT OF ANY SECURITY VULNERABILITY OR BREACH.  TO THE MAXIMUM
+ * EXTENT PERMITTED BY LAW, IN NO EVENT WILL RENESAS BE LIABLE TO YOU IN CONNECTION WITH THE SOFTWARE OR DOCUMENTATION
+ * (OR ANY PERSON OR ENTITY CLAIMING RIGHTS DERIVED FROM YOU) FOR ANY LOSS, DAMAGES, OR CLAIMS WHATSOEVER, INCLUDING,
+ * WITHOUT LIMITATION, ANY DIRECT, CONSEQUENTIAL, SPECIAL, INDIRECT, PUNITIVE, OR INCIDENTAL DAMAGES; ANY LOST PROFITS,
+ * OTHER ECONOMIC DAMAGE, PROPERTY DAMAGE, OR PERSONAL INJURY; AND EVEN IF RENESAS HAS BEEN ADVISED OF THE POSSIBILITY
+ * OF SUCH LOSS, DAMAGES, CLAIMS OR COSTS.
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Includes
+ **********************************************************************************************************************/
+#include <string.h>                    // memset()
+#include "rm_mjpeg.h"
+#include "rm_mjpeg_cfg.h"
+
+/***********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+
+/* "MJPG" in ASCII. */
+#define RM_MJPEG_OPEN                        (0x4D4A5047U)
+
+/* RIFF chunk IDs, stored little endian in the file. */
+#define RM_MJPEG_PRV_FOURCC(a, b, c, d)      ((uint32_t) (a) | ((uint32_t) (b) << 8) | ((uint32_t) (c) << 16) | \
+                                              ((uint32_t) (d) << 24))
+#define RM_MJPEG_PRV_FOURCC_RIFF             RM_MJPEG_PRV_FOURCC('R', 'I', 'F', 'F')
+#define RM_MJPEG_PRV_FOURCC_AVI              RM_MJPEG_PRV_FOURCC('A', 'V', 'I', ' ')
+#define RM_MJPEG_PRV_FOURCC_LIST             RM_MJPEG_PRV_FOURCC('L', 'I', 'S', 'T')
+#define RM_MJPEG_PRV_FOURCC_HDRL             RM_MJPEG_PRV_FOURCC('h', 'd', 'r', 'l')
+#define RM_MJPEG_PRV_FOURCC_AVIH             RM_MJPEG_PRV_FOURCC('a', 'v', 'i', 'h')
+#define RM_MJPEG_PRV_FOURCC_STRL             RM_MJPEG_PRV_FOURCC('s', 't', 'r', 'l')
+#define RM_MJPEG_PRV_FOURCC_STRH             RM_MJPEG_PRV_FOURCC('s', 't', 'r', 'h')
+#define RM_MJPEG_PRV_FOURCC_VIDS             RM_MJPEG_PRV_FOURCC('v', 'i', 'd', 's')
+#define RM_MJPEG_PRV_FOURCC_MOVI             RM_MJPEG_PRV_FOURCC('m', 'o', 'v', 'i')
+#define RM_MJPEG_PRV_FOURCC_REC              RM_MJPEG_PRV_FOURCC('r', 'e', 'c', ' ')
+
+/* Video chunks in the movi list are "##dc" (compressed) or "##db" (uncompressed), ## being the stream number. */
+#define RM_MJPEG_PRV_TWOCC_DC                (0x63640000U)
+#define RM_MJPEG_PRV_TWOCC_DB                (0x62640000U)
+#define RM_MJPEG_PRV_TWOCC_MASK              (0xFFFF0000U)
+#define RM_MJPEG_PRV_STREAMS_MAX             (100U)
+
+/* Chunk header: ID and size, followed by the list type for LIST chunks. */
+#define RM_MJPEG_PRV_CHUNK_HEADER_SIZE       (8U)
+#define RM_MJPEG_PRV_LIST_HEADER_SIZE        (12U)
+
+/* Words of the main AVI header (AVIMAINHEADER) used by the player. */
+#define RM_MJPEG_PRV_AVIH_WORDS              (10U)
+#define RM_MJPEG_PRV_AVIH_US_PER_FRAME       (0U)
+#define RM_MJPEG_PRV_AVIH_TOTAL_FRAMES       (4U)
+#define RM_MJPEG_PRV_AVIH_WIDTH              (8U)
+#define RM_MJPEG_PRV_AVIH_HEIGHT             (9U)
+
+#define RM_MJPEG_PRV_ALIGNMENT_8             (7U)
+
+/* Frame queue entry size marking a frame that repeats the previous one. */
+#define RM_MJPEG_PRV_REPEAT                  (0U)
+
+/* Zero data fed to the codec when it pauses for input after the end of a frame. */
+#define RM_MJPEG_PRV_PAD_SIZE                (64U)
+
+#define RM_MJPEG_PRV_US_PER_SECOND           (1000000ULL)
+#define RM_MJPEG_PRV_FPS_SCALE               (100ULL)
+
+/* Decode states. */
+#define RM_MJPEG_PRV_DECODE_IDLE             (0U)
+#define RM_MJPEG_PRV_DECODE_BUSY             (1U)
+#define RM_MJPEG_PRV_DECODE_DONE             (2U)
+#define RM_MJPEG_PRV_DECODE_FAILED           (3U)
+
+/***********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Private function prototypes
+ **********************************************************************************************************************/
+static fsp_err_t rm_mjpeg_avi_parse(rm_mjpeg_instance_ctrl_t * p_ctrl);
+static fsp_err_t rm_mjpeg_hdrl_parse(rm_mjpeg_instance_ctrl_t * p_ctrl, uint32_t pos, uint32_t end);
+static fsp_err_t rm_mjpeg_queue_fill(rm_mjpeg_instance_ctrl_t * p_ctrl);
+static fsp_err_t rm_mjpeg_queue_frame(rm_mjpeg_instance_ctrl_t * p_ctrl, uint32_t pos, uint32_t size, bool * p_full);
+static void      rm_mjpeg_queue_release(rm_mjpeg_instance_ctrl_t * p_ctrl);
+static bool      rm_mjpeg_video_chunk(rm_mjpeg_instance_ctrl_t * p_ctrl, uint32_t id);
+static uint64_t  rm_mjpeg_clock_us(rm_mjpeg_instance_ctrl_t * p_ctrl);
+static bool      rm_mjpeg_frame_late(rm_mjpeg_instance_ctrl_t * p_ctrl, uint32_t frame);
+static fsp_err_t rm_mjpeg_decode_start(rm_mjpeg_instance_ctrl_t * p_ctrl);
+static fsp_err_t rm_mjpeg_present(rm_mjpeg_instance_ctrl_t * p_ctrl);
+static void      rm_mjpeg_decode_end(rm_mjpeg_instance_ctrl_t * p_ctrl, uint8_t state);
+static void      rm_mjpeg_event(rm_mjpeg_instance_ctrl_t * p_ctrl, rm_mjpeg_event_t event);
+
+/***********************************************************************************************************************
+ * Private global variables
+ **********************************************************************************************************************/
+
+/** Version data structure. */
+static const fsp_version_t g_rm_mjpeg_version =
+{
+    .api_version_minor  = RM_MJPEG_CODE_VERSION_MINOR,
+    .api_version_major  = RM_MJPEG_CODE_VERSION_MAJOR,
+    .code_version_major = RM_MJPEG_CODE_VERSION_MAJOR,
+    .code_version_minor = RM_MJPEG_CODE_VERSION_MINOR
+};
+
+/** Input padding for the codec. */
+static uint8_t g_rm_mjpeg_pad[RM_MJPEG_PRV_PAD_SIZE] BSP_ALIGN_VARIABLE(8);
+
+/*******************************************************************************************************************//**
+ * @addtogroup RM_MJPEG
+ * @{
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Functions
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * Opens the Motion-JPEG player, reads the AVI headers and opens the JPEG codec.
+ *
+ * Playback is a pipeline driven by RM_MJPEG_Process:
+ * - Compressed frames are read ahead from the movi list of the file into the frame queue.
+ * - The oldest queued frame is decoded by the JPEG codec into a decode buffer, completion is reported by the JPEG
+ *   interrupt. Frame N+1 is decoded while the D/AVE 2D converts frame N.
+ * - A decoded frame is blitted by the D/AVE 2D into a frame buffer of the frame scheduler, converting it to the frame
+ *   buffer format and scaling it to the destination rectangle, and is passed to the display at the vertical blank
+ *   it is due.
+ *
+ * The playback clock counts vertical blanks, so frames are paced by the display. Frames that are already one frame
+ * period late when the decoder is free are dropped without decoding.
+ *
+ * @retval     FSP_SUCCESS                    Player is open.
+ * @retval     FSP_ERR_ASSERTION              An input parameter is invalid.
+ * @retval     FSP_ERR_ALREADY_OPEN           Module has already been opened with this instance of the control
+ *                                            structure.
+ * @retval     FSP_ERR_INVALID_ALIGNMENT      The frame queue is not 8-byte aligned.
+ * @retval     FSP_ERR_UNSUPPORTED            The file is not an AVI file with a video stream.
+ * @return                                    See @ref RENESAS_ERROR_CODES or functions called by this function for
+ *                                            other possible return codes. This function calls:
+ *                                            * rm_mjpeg_cfg_t::p_read
+ *                                            * jpeg_api_t::open
+ **********************************************************************************************************************/
+fsp_err_t RM_MJPEG_Open (rm_mjpeg_instance_ctrl_t * const p_ctrl, rm_mjpeg_cfg_t const * const p_cfg)
+{
+#if RM_MJPEG_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ASSERT(NULL != p_cfg);
+    FSP_ASSERT(NULL != p_cfg->p_read);
+    FSP_ASSERT(NULL != p_cfg->p_jpeg);
+    FSP_ASSERT(NULL != p_cfg->p_frame);
+    FSP_ASSERT(NULL != p_cfg->p_queue);
+    FSP_ASSERT(0U != p_cfg->display_frame_us);
+    for (uint32_t i = 0U; i < RM_MJPEG_DECODE_BUFFERS; i++)
+    {
+        FSP_ASSERT(NULL != p_cfg->p_decode_buffers[i]);
+    }
+
+    FSP_ERROR_RETURN(RM_MJPEG_OPEN != p_ctrl->open, FSP_ERR_ALREADY_OPEN);
+    FSP_ERROR_RETURN(0U == ((uint32_t) p_cfg->p_queue & RM_MJPEG_PRV_ALIGNMENT_8), FSP_ERR_INVALID_ALIGNMENT);
+#endif
+
+    p_ctrl->p_cfg = p_cfg;
+
+    memset(&p_ctrl->info, 0, sizeof(p_ctrl->info));
+    memset(&p_ctrl->statistics, 0, sizeof(p_ctrl->statistics));
+
+    fsp_err_t err = rm_mjpeg_avi_parse(p_ctrl);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+    /* Pace by the display if the file does not declare a frame rate. */
+    if (0U == p_ctrl->info.frame_period_us)
+    {
+        p_ctrl->info.frame_period_us = p_cfg->display_frame_us;
+    }
+
+    jpeg_instance_t const * p_jpeg = p_cfg->p_jpeg;
+    err = p_jpeg->p_api->open(p_jpeg->p_ctrl, p_jpeg->p_cfg);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+    p_ctrl->movi_pos      = p_ctrl->movi_start;
+    p_ctrl->source_end    = false;
+    p_ctrl->frames_queued = 0U;
+    p_ctrl->wrap_frame    = UINT32_MAX;
+    p_ctrl->queue_head    = 0U;
+    p_ctrl->queue_count   = 0U;
+    p_ctrl->queue_write   = 0U;
+    p_ctrl->decode_state  = RM_MJPEG_PRV_DECODE_IDLE;
+    p_ctrl->decode_buffer = 0U;
+    p_ctrl->decode_frame  = 0U;
+    p_ctrl->decode_queued = false;
+    p_ctrl->codec_used    = false;
+    p_ctrl->started       = false;
+    p_ctrl->vsyncs        = 0U;
+
+    p_ctrl->open = RM_MJPEG_OPEN;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Returns the stream information read from the AVI headers.
+ *
+ * @retval     FSP_SUCCESS                    Information copied.
+ * @retval     FSP_ERR_ASSERTION              An input parameter is invalid.
+ * @retval     FSP_ERR_NOT_OPEN               The instance control structure is not opened.
+ **********************************************************************************************************************/
+fsp_err_t RM_MJPEG_InfoGet (rm_mjpeg_instance_ctrl_t * const p_ctrl, rm_mjpeg_info_t * const p_info)
+{
+#if RM_MJPEG_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ASSERT(NULL != p_info);
+    FSP_ERROR_RETURN(RM_MJPEG_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+
+    *p_info = p_ctrl->info;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Advances playback. The first call starts the playback clock. Call this function from the playback task whenever
+ * the callback reports an event, or periodically; it never waits for the hardware:
+ * - A decoded frame that is due at the next vertical blank is converted and presented.
+ * - If the decoder is free, late frames are dropped and decoding of the next queued frame is started.
+ * - The frame queue is refilled from the source.
+ *
+ * @retval     FSP_SUCCESS                    Playback advanced, *p_end is set.
+ * @retval     FSP_ERR_ASSERTION              An input parameter is invalid.
+ * @retval     FSP_ERR_NOT_OPEN               The instance control structure is not opened.
+ * @return                                    See @ref RENESAS_ERROR_CODES or functions called by this function for
+ *                                            other possible return codes. This function calls:
+ *                                            * rm_mjpeg_cfg_t::p_read
+ *                                            * jpeg_api_t::close
+ *                                            * jpeg_api_t::open
+ *                                            * jpeg_api_t::horizontalStrideSet
+ *                                            * jpeg_api_t::outputBufferSet
+ *                                            * jpeg_api_t::inputBufferSet
+ *                                            * RM_DRW_FRAME_Begin
+ *                                            * RM_DRW_FRAME_TileNext
+ *                                            * RM_DRW_FRAME_End
+ **********************************************************************************************************************/
+fsp_err_t RM_MJPEG_Process (rm_mjpeg_instance_ctrl_t * const p_ctrl, bool * const p_end)
+{
+#if RM_MJPEG_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ASSERT(NULL != p_end);
+    FSP_ERROR_RETURN(RM_MJPEG_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+
+    fsp_err_t err = FSP_SUCCESS;
+
+    if (!p_ctrl->started)
+    {
+        p_ctrl->vsyncs  = 0U;
+        p_ctrl->started = true;
+    }
+
+    /* The frame queue is only modified here, so the decoded frame is released once the codec has ended. */
+    if (p_ctrl->decode_queued && (RM_MJPEG_PRV_DECODE_BUSY != p_ctrl->decode_state))
+    {
+        rm_mjpeg_queue_release(p_ctrl);
+        p_ctrl->decode_queued = false;
+    }
+
+    /* Present the decoded frame when it is due at the next vertical blank. */
+    if (RM_MJPEG_PRV_DECODE_DONE == p_ctrl->decode_state)
+    {
+        uint64_t due_us = (uint64_t) p_ctrl->decode_frame * p_ctrl->info.frame_period_us;
+        if ((rm_mjpeg_clock_us(p_ctrl) + p_ctrl->p_cfg->display_frame_us) >= due_us)
+        {
+            err = rm_mjpeg_present(p_ctrl);
+
+            /* All frame buffers are in use until the next vertical blank. */
+            if (FSP_ERR_IN_USE == err)
+            {
+                err = FSP_SUCCESS;
+            }
+
+            FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+        }
+    }
+    else if (RM_MJPEG_PRV_DECODE_FAILED == p_ctrl->decode_state)
+    {
+        p_ctrl->statistics.frames_dropped++;
+        p_ctrl->decode_state = RM_MJPEG_PRV_DECODE_IDLE;
+    }
+    else
+    {
+        /* Decoder busy or idle. */
+    }
+
+    if (RM_MJPEG_PRV_DECODE_IDLE == p_ctrl->decode_state)
+    {
+        err = rm_mjpeg_queue_fill(p_ctrl);
+        FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+        /* Skip late frames as long as a newer frame is available to show instead. */
+        while ((p_ctrl->queue_count > 1U) && rm_mjpeg_frame_late(p_ctrl, p_ctrl->queue[p_ctrl->queue_head].frame))
+        {
+            rm_mjpeg_queue_release(p_ctrl);
+            p_ctrl->statistics.frames_dropped++;
+        }
+
+        if (0U != p_ctrl->queue_count)
+        {
+            err = rm_mjpeg_decode_start(p_ctrl);
+            FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+        }
+    }
+
+    /* Read ahead while the codec works. */
+    err = rm_mjpeg_queue_fill(p_ctrl);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+    *p_end = p_ctrl->source_end && (0U == p_ctrl->queue_count) &&
+             (RM_MJPEG_PRV_DECODE_IDLE == p_ctrl->decode_state);
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Returns the playback statistics.
+ *
+ * @retval     FSP_SUCCESS                    Statistics copied.
+ * @retval     FSP_ERR_ASSERTION              An input parameter is invalid.
+ * @retval     FSP_ERR_NOT_OPEN               The instance control structure is not opened.
+ **********************************************************************************************************************/
+fsp_err_t RM_MJPEG_StatisticsGet (rm_mjpeg_instance_ctrl_t * const p_ctrl, rm_mjpeg_statistics_t * const p_statistics)
+{
+#if RM_MJPEG_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ASSERT(NULL != p_statistics);
+    FSP_ERROR_RETURN(RM_MJPEG_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+
+    *p_statistics = p_ctrl->statistics;
+
+    uint64_t elapsed_us = rm_mjpeg_clock_us(p_ctrl);
+    if (0U != elapsed_us)
+    {
+        p_statistics->fps_x100 = (uint32_t) (((uint64_t) p_ctrl->statistics.frames_presented *
+                                              RM_MJPEG_PRV_FPS_SCALE * RM_MJPEG_PRV_US_PER_SECOND) / elapsed_us);
+    }
+
+    p_statistics->queue_frames = p_ctrl->queue_count;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Stops playback and closes the JPEG codec. The frame scheduler stays open.
+ *
+ * @retval     FSP_SUCCESS                    Player closed.
+ * @retval     FSP_ERR_ASSERTION              An input parameter is invalid.
+ * @retval     FSP_ERR_NOT_OPEN               The instance control structure is not opened.
+ **********************************************************************************************************************/
+fsp_err_t RM_MJPEG_Close (rm_mjpeg_instance_ctrl_t * const p_ctrl)
+{
+#if RM_MJPEG_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ERROR_RETURN(RM_MJPEG_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+
+    jpeg_instance_t const * p_jpeg = p_ctrl->p_cfg->p_jpeg;
+
+    p_ctrl->open = 0U;
+
+    (void) p_jpeg->p_api->close(p_jpeg->p_ctrl);
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Returns the version of this module.
+ *
+ * @retval     FSP_SUCCESS                    Version stored in p_version.
+ * @retval     FSP_ERR_ASSERTION              p_version is NULL.
+ **********************************************************************************************************************/
+fsp_err_t RM_MJPEG_VersionGet (fsp_version_t * const p_version)
+{
+#if RM_MJPEG_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_version);
+#endif
+
+    p_version->version_id = g_rm_mjpeg_version.version_id;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * JPEG decode callback. Set as decode callback of the JPEG instance with the player control structure as context.
+ *
+ * Completion or failure of the frame ends the decode. When the header is decoded the frame size is checked against
+ * the decode buffer. An input pause after the end of the frame data is answered with padding, so the codec can flush
+ * its last lines.
+ *
+ * @param[in]  p_args   JPEG callback arguments. p_context must point to the player control structure.
+ **********************************************************************************************************************/
+void rm_mjpeg_jpeg_callback (jpeg_callback_args_t * p_args)
+{
+    rm_mjpeg_instance_ctrl_t * p_ctrl = (rm_mjpeg_instance_ctrl_t *) p_args->p_context;
+
+    if ((NULL == p_ctrl) || (RM_MJPEG_OPEN != p_ctrl->open) || (RM_MJPEG_PRV_DECODE_BUSY != p_ctrl->decode_state))
+    {
+        return;
+    }
+
+    rm_mjpeg_cfg_t const  * p_cfg  = p_ctrl->p_cfg;
+    jpeg_instance_t const * p_jpeg = p_cfg->p_jpeg;
+    uint32_t                status = (uint32_t) p_args->status;
+
+    if ((uint32_t) JPEG_STATUS_ERROR & status)
+    {
+        p_ctrl->statistics.decode_errors++;
+        rm_mjpeg_decode_end(p_ctrl, RM_MJPEG_PRV_DECODE_FAILED);
+    }
+    else if ((uint32_t) JPEG_STATUS_OPERATION_COMPLETE & status)
+    {
+        p_ctrl->statistics.frames_decoded++;
+        rm_mjpeg_decode_end(p_ctrl, RM_MJPEG_PRV_DECODE_DONE);
+    }
+    /* The whole frame fits the decode buffer, so an output pause means the frame is larger than the buffer. */
+    else if ((uint32_t) JPEG_STATUS_OUTPUT_PAUSE & status)
+    {
+        rm_mjpeg_decode_end(p_ctrl, RM_MJPEG_PRV_DECODE_FAILED);
+    }
+    else if ((uint32_t) JPEG_STATUS_INPUT_PAUSE & status)
+    {
+        (void) p_jpeg->p_api->inputBufferSet(p_jpeg->p_ctrl, &g_rm_mjpeg_pad[0], RM_MJPEG_PRV_PAD_SIZE);
+    }
+    else if ((uint32_t) JPEG_STATUS_IMAGE_SIZE_READY & status)
+    {
+        uint16_t width  = 0U;
+        uint16_t height = 0U;
+        (void) p_jpeg->p_api->imageSizeGet(p_jpeg->p_ctrl, &width, &height);
+
+        uint32_t bytes_per_pixel = (JPEG_DECODE_PIXEL_FORMAT_ARGB8888 == p_jpeg->p_cfg->pixel_format) ? 4U : 2U;
+
+        if ((width > p_cfg->decode_stride) ||
+            (((uint32_t) height * p_cfg->decode_stride * bytes_per_pixel) > p_cfg->decode_buffer_size))
+        {
+            rm_mjpeg_decode_end(p_ctrl, RM_MJPEG_PRV_DECODE_FAILED);
+        }
+        else
+        {
+            p_ctrl->info.width  = width;
+            p_ctrl->info.height = height;
+        }
+    }
+    else
+    {
+        /* No action required. */
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Frame scheduler callback. Set as callback of the frame scheduler with the player control structure as context. Each
+ * call is a vertical blank and advances the playback clock.
+ *
+ * @param[in]  p_args   Frame scheduler callback arguments. p_context must point to the player control structure.
+ **********************************************************************************************************************/
+void rm_mjpeg_frame_callback (rm_drw_frame_callback_args_t * p_args)
+{
+    rm_mjpeg_instance_ctrl_t * p_ctrl = (rm_mjpeg_instance_ctrl_t *) p_args->p_context;
+
+    if ((NULL == p_ctrl) || (RM_MJPEG_OPEN != p_ctrl->open))
+    {
+        return;
+    }
+
+    p_ctrl->vsyncs++;
+    rm_mjpeg_event(p_ctrl, RM_MJPEG_EVENT_VSYNC);
+}
+
+/*******************************************************************************************************************//**
+ * @} (end addtogroup RM_MJPEG)
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Private Functions
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * Walks the top level chunks of the RIFF file, reads the hdrl list and locates the movi list.
+ *
+ * @param[in]  p_ctrl   Pointer to the control structure.
+ *
+ * @retval     FSP_SUCCESS                    Headers read.
+ * @retval     FSP_ERR_UNSUPPORTED            The file is not an AVI file with a video stream.
+ * @return                                    Error returned by rm_mjpeg_cfg_t::p_read.
+ **********************************************************************************************************************/
+static fsp_err_t rm_mjpeg_avi_parse (rm_mjpeg_instance_ctrl_t * p_ctrl)
+{
+    rm_mjpeg_cfg_t const * p_cfg = p_ctrl->p_cfg;
+    uint32_t               header[3];
+
+    fsp_err_t err = p_cfg->p_read(p_cfg->p_context, 0U, &header[0], RM_MJPEG_PRV_LIST_HEADER_SIZE);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+    FSP_ERROR_RETURN((RM_MJPEG_PRV_FOURCC_RIFF == header[0]) && (RM_MJPEG_PRV_FOURCC_AVI == header[2]),
+                     FSP_ERR_UNSUPPORTED);
+
+    uint32_t end = header[1] + RM_MJPEG_PRV_CHUNK_HEADER_SIZE;
+    uint32_t pos = RM_MJPEG_PRV_LIST_HEADER_SIZE;
+
+    p_ctrl->video_stream = RM_MJPEG_PRV_STREAMS_MAX;
+    p_ctrl->movi_start   = 0U;
+    p_ctrl->movi_end     = 0U;
+
+    while ((pos + RM_MJPEG_PRV_LIST_HEADER_SIZE) <= end)
+    {
+        err = p_cfg->p_read(p_cfg->p_context, pos, &header[0], RM_MJPEG_PRV_LIST_HEADER_SIZE);
+        FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+        uint32_t chunk_end = pos + RM_MJPEG_PRV_CHUNK_HEADER_SIZE + header[1];
+
+        if (RM_MJPEG_PRV_FOURCC_LIST == header[0])
+        {
+            if (RM_MJPEG_PRV_FOURCC_HDRL == header[2])
+            {
+                err = rm_mjpeg_hdrl_parse(p_ctrl, pos + RM_MJPEG_PRV_LIST_HEADER_SIZE, chunk_end);
+                FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+            }
+            else if (RM_MJPEG_PRV_FOURCC_MOVI == header[2])
+            {
+                p_ctrl->movi_start = pos + RM_MJPEG_PRV_LIST_HEADER_SIZE;
+                p_ctrl->movi_end   = chunk_end;
+            }
+            else
+            {
+                /* Other lists (INFO, ...) are not needed for playback. */
+            }
+        }
+
+        /* Chunks are padded to an even size. */
+        pos = chunk_end + (header[1] & 1U);
+    }
+
+    FSP_ERROR_RETURN((0U != p_ctrl->movi_start) && (RM_MJPEG_PRV_STREAMS_MAX > p_ctrl->video_stream),
+                     FSP_ERR_UNSUPPORTED);
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Reads the main AVI header and finds the first video stream in the hdrl list.
+ *
+ * @param[in]  p_ctrl   Pointer to the control structure.
+ * @param[in]  pos      Offset of the first chunk in the hdrl list.
+ * @param[in]  end      Offset after the hdrl list.
+ *
+ * @retval     FSP_SUCCESS                    Header list read.
+ * @return                                    Error returned by rm_mjpeg_cfg_t::p_read.
+ **********************************************************************************************************************/
+static fsp_err_t rm_mjpeg_hdrl_parse (rm_mjpeg_instance_ctrl_t * p_ctrl, uint32_t pos, uint32_t end)
+{
+    rm_mjpeg_cfg_t const * p_cfg  = p_ctrl->p_cfg;
+    uint32_t               stream = 0U;
+    uint32_t               header[3];
+    fsp_err_t              err;
+
+    while ((pos + RM_MJPEG_PRV_LIST_HEADER_SIZE) <= end)
+    {
+        err = p_cfg->p_read(p_cfg->p_context, pos, &header[0], RM_MJPEG_PRV_LIST_HEADER_SIZE);
+        FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+        if (RM_MJPEG_PRV_FOURCC_AVIH == header[0])
+        {
+            uint32_t avih[RM_MJPEG_PRV_AVIH_WORDS];
+
+            err = p_cfg->p_read(p_cfg->p_context, pos + RM_MJPEG_PRV_CHUNK_HEADER_SIZE, &avih[0], sizeof(avih));
+            FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+            p_ctrl->info.frame_period_us = avih[RM_MJPEG_PRV_AVIH_US_PER_FRAME];
+            p_ctrl->info.frame_count     = avih[RM_MJPEG_PRV_AVIH_TOTAL_FRAMES];
+            p_ctrl->info.width           = (uint16_t) avih[RM_MJPEG_PRV_AVIH_WIDTH];
+            p_ctrl->info.height          = (uint16_t) avih[RM_MJPEG_PRV_AVIH_HEIGHT];
+        }
+        else if ((RM_MJPEG_PRV_FOURCC_LIST == header[0]) && (RM_MJPEG_PRV_FOURCC_STRL == header[2]))
+        {
+            /* The stream header is the first chunk of the stream list, its first word is the stream type. */
+            uint32_t strh[3];
+
+            err = p_cfg->p_read(p_cfg->p_context, pos + RM_MJPEG_PRV_LIST_HEADER_SIZE, &strh[0], sizeof(strh));
+            FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+            if ((RM_MJPEG_PRV_FOURCC_STRH == strh[0]) && (RM_MJPEG_PRV_FOURCC_VIDS == strh[2]) &&
+                (RM_MJPEG_PRV_STREAMS_MAX == p_ctrl->video_stream))
+            {
+                p_ctrl->video_stream = stream;
+            }
+
+            stream++;
+        }
+        else
+        {
+            /* Other header chunks are not needed for playback. */
+        }
+
+        pos += RM_MJPEG_PRV_CHUNK_HEADER_SIZE + header[1] + (header[1] & 1U);
+    }
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Reads frames from the movi list into the frame queue until the queue is full or the end of the file is reached.
+ * Audio, JUNK and index chunks are skipped.
+ *
+ * @param[in]  p_ctrl   Pointer to the control structure.
+ *
+ * @retval     FSP_SUCCESS                    Frame queue refilled.
+ * @return                                    Error returned by rm_mjpeg_cfg_t::p_read.
+ **********************************************************************************************************************/
+static fsp_err_t rm_mjpeg_queue_fill (rm_mjpeg_instance_ctrl_t * p_ctrl)
+{
+    rm_mjpeg_cfg_t const * p_cfg = p_ctrl->p_cfg;
+    bool                   full  = false;
+    uint32_t               header[3];
+    fsp_err_t              err;
+
+    while (!full && !p_ctrl->source_end && (p_ctrl->queue_count < RM_MJPEG_QUEUE_MAX))
+    {
+        if ((p_ctrl->movi_pos + RM_MJPEG_PRV_CHUNK_HEADER_SIZE) > p_ctrl->movi_end)
+        {
+            /* Stop looping if the last pass did not find a frame. */
+            if (p_cfg->loop && (p_ctrl->frames_queued != p_ctrl->wrap_frame))
+            {
+                p_ctrl->movi_pos   = p_ctrl->movi_start;
+                p_ctrl->wrap_frame = p_ctrl->frames_queued;
+            }
+            else
+            {
+                p_ctrl->source_end = true;
+            }
+
+            continue;
+        }
+
+        err = p_cfg->p_read(p_cfg->p_context, p_ctrl->movi_pos, &header[0], RM_MJPEG_PRV_LIST_HEADER_SIZE);
+        FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+        uint32_t next = p_ctrl->movi_pos + RM_MJPEG_PRV_CHUNK_HEADER_SIZE + header[1] + (header[1] & 1U);
+
+        if (RM_MJPEG_PRV_FOURCC_LIST == header[0])
+        {
+            /* Descend into rec lists, which group the chunks of one frame interval. */
+            if (RM_MJPEG_PRV_FOURCC_REC == header[2])
+            {
+                next = p_ctrl->movi_pos + RM_MJPEG_PRV_LIST_HEADER_SIZE;
+            }
+        }
+        else if (rm_mjpeg_video_chunk(p_ctrl, header[0]))
+        {
+            err = rm_mjpeg_queue_frame(p_ctrl, p_ctrl->movi_pos + RM_MJPEG_PRV_CHUNK_HEADER_SIZE, header[1], &full);
+            FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+            /* Retry this chunk when the queue has space again. */
+            if (full)
+            {
+                continue;
+            }
+        }
+        else
+        {
+            /* Not a video chunk. */
+        }
+
+        p_ctrl->movi_pos = next;
+    }
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Reads one compressed frame into the frame queue. Frames are stored contiguously, so the codec can read them in one
+ * pass; a frame that does not fit before the end of the queue buffer is stored at its start.
+ *
+ * @param[in]  p_ctrl   Pointer to the control structure.
+ * @param[in]  pos      Offset of the frame data in the file.
+ * @param[in]  size     Size of the frame data.
+ * @param[out] p_full   Set if the frame must wait for queued frames to be released.
+ *
+ * @retval     FSP_SUCCESS                    Frame queued, dropped or *p_full set.
+ * @return                                    Error returned by rm_mjpeg_cfg_t::p_read.
+ **********************************************************************************************************************/
+static fsp_err_t rm_mjpeg_queue_frame (rm_mjpeg_instance_ctrl_t * p_ctrl, uint32_t pos, uint32_t size, bool * p_full)
+{
+    rm_mjpeg_cfg_t const * p_cfg   = p_ctrl->p_cfg;
+    uint32_t               aligned = (size + RM_MJPEG_PRV_ALIGNMENT_8) & ~RM_MJPEG_PRV_ALIGNMENT_8;
+    uint32_t               offset  = p_ctrl->queue_write;
+
+    if (aligned > p_cfg->queue_size)
+    {
+        /* The frame never fits. */
+        p_ctrl->frames_queued++;
+        p_ctrl->statistics.frames_dropped++;
+
+        return FSP_SUCCESS;
+    }
+
+    if (0U != aligned)
+    {
+        if (0U == p_ctrl->queue_count)
+        {
+            offset = 0U;
+        }
+        else
+        {
+            uint32_t head = p_ctrl->queue[p_ctrl->queue_head].offset;
+
+            /* Free space is [queue_write, head) if the queue wrapped, else [queue_write, end) and [0, head). */
+            if (offset < head)
+            {
+                *p_full = ((offset + aligned) > head);
+            }
+            else if ((offset + aligned) > p_cfg->queue_size)
+            {
+                offset  = 0U;
+                *p_full = (aligned > head);
+            }
+            else
+            {
+                /* Fits before the end of the queue buffer. */
+            }
+        }
+
+        if (*p_full)
+        {
+            return FSP_SUCCESS;
+        }
+
+        uint8_t * p_data = p_cfg->p_queue + offset;
+        fsp_err_t err    = p_cfg->p_read(p_cfg->p_context, pos, p_data, size);
+        FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+        memset(p_data + size, 0, aligned - size);
+    }
+
+    uint32_t index = (uint32_t) (p_ctrl->queue_head + p_ctrl->queue_count) % RM_MJPEG_QUEUE_MAX;
+
+    /* Empty frames repeat the previous one and use no queue space. */
+    if (0U != aligned)
+    {
+        p_ctrl->queue_write = offset + aligned;
+    }
+
+    p_ctrl->queue[index].offset = offset;
+    p_ctrl->queue[index].size   = aligned;
+    p_ctrl->queue[index].frame  = p_ctrl->frames_queued;
+
+    p_ctrl->queue_count++;
+    p_ctrl->frames_queued++;
+    p_ctrl->statistics.frames_read++;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Removes the oldest frame from the frame queue.
+ *
+ * @param[in]  p_ctrl   Pointer to the control structure.
+ **********************************************************************************************************************/
+static void rm_mjpeg_queue_release (rm_mjpeg_instance_ctrl_t * p_ctrl)
+{
+    p_ctrl->queue_head = (uint8_t) ((p_ctrl->queue_head + 1U) % RM_MJPEG_QUEUE_MAX);
+    p_ctrl->queue_count--;
+}
+
+/*******************************************************************************************************************//**
+ * Checks whether a movi chunk belongs to the video stream.
+ *
+ * @param[in]  p_ctrl   Pointer to the control structure.
+ * @param[in]  id       Chunk ID.
+ *
+ * @retval     true                           The chunk is a frame of the video stream.
+ * @retval     false                          The chunk belongs to another stream or is not a stream chunk.
+ **********************************************************************************************************************/
+static bool rm_mjpeg_video_chunk (rm_mjpeg_instance_ctrl_t * p_ctrl, uint32_t id)
+{
+    uint32_t stream = RM_MJPEG_PRV_FOURCC('0' + (p_ctrl->video_stream / 10U), '0' + (p_ctrl->video_stream % 10U), 0, 0);
+    uint32_t type   = id & RM_MJPEG_PRV_TWOCC_MASK;
+
+    return (stream == (id & ~RM_MJPEG_PRV_TWOCC_MASK)) &&
+           ((RM_MJPEG_PRV_TWOCC_DC == type) || (RM_MJPEG_PRV_TWOCC_DB == type));
+}
+
+/*******************************************************************************************************************//**
+ * Returns the playback clock.
+ *
+ * @param[in]  p_ctrl   Pointer to the control structure.
+ *
+ * @return     Microseconds since playback started, in steps of the display refresh period.
+ **********************************************************************************************************************/
+static uint64_t rm_mjpeg_clock_us (rm_mjpeg_instance_ctrl_t * p_ctrl)
+{
+    return (uint64_t) p_ctrl->vsyncs * p_ctrl->p_cfg->display_frame_us;
+}
+
+/*******************************************************************************************************************//**
+ * Checks whether a frame is more than one frame period late.
+ *
+ * @param[in]  p_ctrl   Pointer to the control structure.
+ * @param[in]  frame    Frame number.
+ *
+ * @retval     true                           The next frame is due already.
+ * @retval     false                          The frame can still be shown in time.
+ **********************************************************************************************************************/
+static bool rm_mjpeg_frame_late (rm_mjpeg_instance_ctrl_t * p_ctrl, uint32_t frame)
+{
+    uint64_t next_due_us = ((uint64_t) frame + 1U) * p_ctrl->info.frame_period_us;
+
+    return rm_mjpeg_clock_us(p_ctrl) >= next_due_us;
+}
+
+/*******************************************************************************************************************//**
+ * Starts decoding the oldest queued frame into the next decode buffer. The decode buffer was last used by the frame
+ * presented before the previous one; RM_DRW_FRAME_End of the previous frame waited until the D/AVE 2D finished it.
+ *
+ * @param[in]  p_ctrl   Pointer to the control structure.
+ *
+ * @retval     FSP_SUCCESS                    Decoding started, or an empty frame was taken as repeat.
+ * @return                                    Error returned by the JPEG codec.
+ **********************************************************************************************************************/
+static fsp_err_t rm_mjpeg_decode_start (rm_mjpeg_instance_ctrl_t * p_ctrl)
+{
+    rm_mjpeg_cfg_t const   * p_cfg   = p_ctrl->p_cfg;
+    jpeg_instance_t const  * p_jpeg  = p_cfg->p_jpeg;
+    rm_mjpeg_queue_entry_t * p_entry = &p_ctrl->queue[p_ctrl->queue_head];
+    fsp_err_t                err;
+
+    /* The previous frame stays on the display. */
+    if (RM_MJPEG_PRV_REPEAT == p_entry->size)
+    {
+        rm_mjpeg_queue_release(p_ctrl);
+
+        return FSP_SUCCESS;
+    }
+
+    /* The codec only clears its decoded line count and error state when it is opened. */
+    if (p_ctrl->codec_used)
+    {
+        (void) p_jpeg->p_api->close(p_jpeg->p_ctrl);
+        err = p_jpeg->p_api->open(p_jpeg->p_ctrl, p_jpeg->p_cfg);
+        FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+    }
+
+    p_ctrl->codec_used    = true;
+    p_ctrl->decode_queued = true;
+    p_ctrl->decode_buffer = (uint8_t) ((p_ctrl->decode_buffer + 1U) % RM_MJPEG_DECODE_BUFFERS);
+    p_ctrl->decode_frame  = p_entry->frame;
+
+    err = p_jpeg->p_api->horizontalStrideSet(p_jpeg->p_ctrl, p_cfg->decode_stride);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+    err = p_jpeg->p_api->outputBufferSet(p_jpeg->p_ctrl,
+                                         p_cfg->p_decode_buffers[p_ctrl->decode_buffer],
+                                         p_cfg->decode_buffer_size);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+    p_ctrl->decode_state = RM_MJPEG_PRV_DECODE_BUSY;
+
+    /* The output is set first, so the codec starts decoding from the image size interrupt by itself. */
+    err = p_jpeg->p_api->inputBufferSet(p_jpeg->p_ctrl, p_cfg->p_queue + p_entry->offset, p_entry->size);
+    if (FSP_SUCCESS != err)
+    {
+        rm_mjpeg_decode_end(p_ctrl, RM_MJPEG_PRV_DECODE_FAILED);
+    }
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Converts the decoded frame into a frame buffer with the D/AVE 2D and passes it to the frame scheduler.
+ *
+ * @param[in]  p_ctrl   Pointer to the control structure.
+ *
+ * @retval     FSP_SUCCESS                    Frame presented.
+ * @retval     FSP_ERR_IN_USE                 No frame buffer is free, retry after the next vertical blank.
+ * @retval     FSP_ERR_INVALID_HW_CONDITION   D/AVE 2D returned an error.
+ * @return                                    Error returned by the frame scheduler.
+ **********************************************************************************************************************/
+static fsp_err_t rm_mjpeg_present (rm_mjpeg_instance_ctrl_t * p_ctrl)
+{
+    rm_mjpeg_cfg_t const * p_cfg      = p_ctrl->p_cfg;
+    d2_device            * p_d2       = p_cfg->p_frame->p_cfg->p_d2_handle;
+    uint8_t              * p_buffer   = NULL;
+    bool                   more       = false;
+    d2_u32                 format     = (JPEG_DECODE_PIXEL_FORMAT_ARGB8888 == p_cfg->p_jpeg->p_cfg->pixel_format) ?
+                                        d2_mode_argb8888 : d2_mode_rgb565;
+    d2_s32                 width      = (d2_s32) p_ctrl->info.width;
+    d2_s32                 height     = (d2_s32) p_ctrl->info.height;
+    d2_s32                 dst_width  = (0U != p_cfg->width) ? (d2_s32) p_cfg->width : width;
+    d2_s32                 dst_height = (0U != p_cfg->height) ? (d2_s32) p_cfg->height : height;
+    d2_u32                 flags      = ((dst_width != width) || (dst_height != height)) ? d2_bf_filter : 0U;
+
+    fsp_err_t err = RM_DRW_FRAME_Begin(p_cfg->p_frame, &p_buffer);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+    d2_s32 d2_err = d2_setblitsrc(p_d2,
+                                  p_cfg->p_decode_buffers[p_ctrl->decode_buffer],
+                                  (d2_s32) p_cfg->decode_stride,
+                                  width,
+                                  height,
+                                  format);
+
+    do
+    {
+        if (D2_OK == d2_err)
+        {
+            d2_err = d2_blitcopy(p_d2,
+                                 width,
+                                 height,
+                                 0,
+                                 0,
+                                 (d2_width) (dst_width << 4),
+                                 (d2_width) (dst_height << 4),
+                                 (d2_point) (p_cfg->x << 4),
+                                 (d2_point) (p_cfg->y << 4),
+                                 flags);
+        }
+
+        err = RM_DRW_FRAME_TileNext(p_cfg->p_frame, &more);
+    } while ((FSP_SUCCESS == err) && more);
+
+    /* End the frame even after an error, so the frame scheduler stays usable. */
+    fsp_err_t end_err = RM_DRW_FRAME_End(p_cfg->p_frame);
+
+    p_ctrl->decode_state = RM_MJPEG_PRV_DECODE_IDLE;
+    p_ctrl->statistics.frames_presented++;
+
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+    FSP_ERROR_RETURN(FSP_SUCCESS == end_err, end_err);
+    FSP_ERROR_RETURN(D2_OK == d2_err, FSP_ERR_INVALID_HW_CONDITION);
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Ends decoding of the current frame. The codec has finished reading the frame data, RM_MJPEG_Process releases it from
+ * the frame queue.
+ *
+ * @param[in]  p_ctrl   Pointer to the control structure.
+ * @param[in]  state    RM_MJPEG_PRV_DECODE_DONE or RM_MJPEG_PRV_DECODE_FAILED.
+ **********************************************************************************************************************/
+static void rm_mjpeg_decode_end (rm_mjpeg_instance_ctrl_t * p_ctrl, uint8_t state)
+{
+    p_ctrl->decode_state = state;
+    rm_mjpeg_event(p_ctrl, RM_MJPEG_EVENT_FRAME_DECODED);
+}
+
+/*******************************************************************************************************************//**
+ * Calls the user callback if one is configured.
+ *
+ * @param[in]  p_ctrl   Pointer to the control structure.
+ * @param[in]  event    Event to report.
+ **********************************************************************************************************************/
+static void rm_mjpeg_event (rm_mjpeg_instance_ctrl_t * p_ctrl, rm_mjpeg_event_t event)
+{
+    rm_mjpeg_cfg_t const * p_cfg = p_ctrl->p_cfg;
+
+    if (NULL != p_cfg->p_callback)
+    {
+        rm_mjpeg_callback_args_t args;
+
+        args.event     = event;
+        args.p_context = p_cfg->p_context;
+        p_cfg->p_callback(&args);
+    }
+}
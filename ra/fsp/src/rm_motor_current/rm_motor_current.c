@@ -47,6 +47,94 @@
  #define    MOTOR_CURRENT_ERROR_RETURN(a, err)    FSP_ERROR_RETURN((a), (err))
 #endif
 
+/* Select the fixed-point (Q15 per-unit) current loop, for devices without an FPU */
+#ifndef MOTOR_CURRENT_CFG_FIXED_POINT_ENABLE
+ #define MOTOR_CURRENT_CFG_FIXED_POINT_ENABLE    (0)
+#endif
+
+#define     MOTOR_CURRENT_FIX_ONE               (32768.0F)                        /* 1.0 in Q15 */
+#define     MOTOR_CURRENT_FIX_MAX               (32767L)                          /* Q15 maximum */
+#define     MOTOR_CURRENT_FIX_Q30_MAX           (0x3FFFFFFFL)                     /* Q30 maximum */
+#define     MOTOR_CURRENT_FIX_Q30_SHIFT         (15)                              /* Q30 => Q15 */
+#define     MOTOR_CURRENT_FIX_GAIN_EXP_MIN      (-30)                             /* Smaller gains are zero */
+#define     MOTOR_CURRENT_FIX_GAIN_EXP_MAX      (15)                              /* Larger gains saturate */
+#define     MOTOR_CURRENT_FIX_ANGLE_SCALE       (65536.0F / MOTOR_CURRENT_TWOPI) /* rad => 16-bit angle */
+#define     MOTOR_CURRENT_FIX_QUARTER           (0x4000U)                         /* 90 degrees */
+#define     MOTOR_CURRENT_FIX_HALF              (0x8000U)                         /* 180 degrees */
+#define     MOTOR_CURRENT_FIX_SIN_SHIFT         (7U)                              /* Angle bits per table step */
+#define     MOTOR_CURRENT_FIX_SIN_STEPS         (128U)                            /* Table steps per quadrant */
+#define     MOTOR_CURRENT_FIX_SPEED_HEADROOM    (2.0F)                            /* Speed base / base EMF speed */
+#define     MOTOR_CURRENT_FIX_SQRT_3_2_Q14      (20066L)                          /* sqrt(3/2) in Q14 */
+#define     MOTOR_CURRENT_FIX_1_SQRT_2          (23170L)                          /* 1/sqrt(2) in Q15 */
+#define     MOTOR_CURRENT_FIX_SQRT_2_3          (26755L)                          /* sqrt(2/3) in Q15 */
+#define     MOTOR_CURRENT_FIX_1_SQRT_6          (13377L)                          /* 1/sqrt(6) in Q15 */
+
+/* Use the CMSIS-DSP Park transforms (arm_math.h must be available in the project) */
+#ifndef MOTOR_CURRENT_CFG_CMSIS_DSP_ENABLE
+ #define MOTOR_CURRENT_CFG_CMSIS_DSP_ENABLE     (0)
+#endif
+
+#if MOTOR_CURRENT_CFG_CMSIS_DSP_ENABLE
+ #include "arm_math.h"
+#endif
+
+/* Execute the current control cycle from RAM */
+#ifndef MOTOR_CURRENT_CFG_RAMFUNC_ENABLE
+ #define MOTOR_CURRENT_CFG_RAMFUNC_ENABLE       (0)
+#endif
+
+#if MOTOR_CURRENT_CFG_RAMFUNC_ENABLE
+ #define MOTOR_CURRENT_PRV_RAMFUNC              BSP_PLACE_IN_RAM
+#else
+ #define MOTOR_CURRENT_PRV_RAMFUNC
+#endif
+
+/* Measure the CPU cycles of each current control cycle and angle/speed estimation with the DWT cycle counter */
+#ifndef MOTOR_CURRENT_CFG_BENCHMARK_ENABLE
+ #define MOTOR_CURRENT_CFG_BENCHMARK_ENABLE     (0)
+#endif
+
+#if MOTOR_CURRENT_CFG_BENCHMARK_ENABLE && !BSP_FEATURE_DWT_CYCCNT
+ #error "MOTOR_CURRENT_CFG_BENCHMARK_ENABLE requires the DWT cycle counter, which is not available on this MCU."
+#endif
+
+/* Run the angle/speed estimation at a divided rate from a lower priority software interrupt */
+#ifndef MOTOR_CURRENT_CFG_MULTI_RATE_ENABLE
+ #define MOTOR_CURRENT_CFG_MULTI_RATE_ENABLE    (0)
+#endif
+
+/* Compile-time binding of the current control cycle. Define MOTOR_CURRENT_CFG_DRIVER_BINDING as RM_MOTOR_DRIVER_ and
+ * MOTOR_CURRENT_CFG_ANGLE_BINDING as RM_MOTOR_ESTIMATE_ to call the driver and angle modules directly instead of
+ * through their p_api tables. Every instance used with this module must then be of the bound module. */
+#ifdef MOTOR_CURRENT_CFG_DRIVER_BINDING
+ #ifndef MOTOR_CURRENT_CFG_DRIVER_BINDING_HEADER
+  #define MOTOR_CURRENT_CFG_DRIVER_BINDING_HEADER    "rm_motor_driver.h"
+ #endif
+ #include MOTOR_CURRENT_CFG_DRIVER_BINDING_HEADER
+ #define MOTOR_CURRENT_PRV_DRIVER_API(p_instance, member, function)    \
+    FSP_API_DIRECT(MOTOR_CURRENT_CFG_DRIVER_BINDING, function)
+#else
+ #define MOTOR_CURRENT_PRV_DRIVER_API(p_instance, member, function)    ((p_instance)->p_api->member)
+#endif
+
+#ifdef MOTOR_CURRENT_CFG_ANGLE_BINDING
+ #ifndef MOTOR_CURRENT_CFG_ANGLE_BINDING_HEADER
+  #define MOTOR_CURRENT_CFG_ANGLE_BINDING_HEADER     "rm_motor_estimate.h"
+ #endif
+ #include MOTOR_CURRENT_CFG_ANGLE_BINDING_HEADER
+ #define MOTOR_CURRENT_PRV_ANGLE_API(p_instance, member, function)    \
+    FSP_API_DIRECT(MOTOR_CURRENT_CFG_ANGLE_BINDING, function)
+#else
+ #define MOTOR_CURRENT_PRV_ANGLE_API(p_instance, member, function)     ((p_instance)->p_api->member)
+#endif
+
+#define     MOTOR_CURRENT_SINCOS_STEPS          (512U)                            /* Table steps per turn */
+#define     MOTOR_CURRENT_SINCOS_QUARTER        (MOTOR_CURRENT_SINCOS_STEPS / 4U) /* cos offset */
+#define     MOTOR_CURRENT_SINCOS_SCALE          ((float) MOTOR_CURRENT_SINCOS_STEPS / MOTOR_CURRENT_TWOPI)
+#define     MOTOR_CURRENT_SQRT_3_2              (1.22474487F)                     /* Sqrt(3/2) */
+#define     MOTOR_CURRENT_SQRT_2_3              (0.81649658F)                     /* Sqrt(2/3) */
+#define     MOTOR_CURRENT_1_SQRT_6              (0.40824829F)                     /* 1/Sqrt(6) */
+
 /***********************************************************************************************************************
  * Typedef definitions
  **********************************************************************************************************************/
@@ -59,22 +147,60 @@
 /* A/D conversion finish interrupt routine */
 /*******************************************/
 /* Process from "A/D conversion" to "PWM Moduration" */
-void rm_motor_current_cyclic(motor_driver_callback_args_t * p_args);
+void rm_motor_current_cyclic(motor_driver_callback_args_t * p_args) MOTOR_CURRENT_PRV_RAMFUNC;
 
 /* Process to get rotor angle and speed information from angle module */
-static void motor_current_angle_cyclic(motor_current_instance_t * p_instance);
+static void motor_current_angle_cyclic(motor_current_instance_t * p_instance) MOTOR_CURRENT_PRV_RAMFUNC;
+
+#if MOTOR_CURRENT_CFG_MULTI_RATE_ENABLE
+
+/* Rotor angle update and estimation request at a divided rate */
+static void motor_current_multi_rate_cyclic(motor_current_instance_ctrl_t * p_ctrl) MOTOR_CURRENT_PRV_RAMFUNC;
+
+#endif
 
 /* static functions */
-static void  motor_current_reset(motor_current_instance_ctrl_t * p_ctrl);
-static float motor_current_limit_abs(float f4_value, float f4_limit_value);
-static void  motor_current_pi_calculation(motor_current_instance_ctrl_t * p_ctrl);
-static float motor_current_pi_control(motor_current_pi_params_t * pi_ctrl);
+static void motor_current_reset(motor_current_instance_ctrl_t * p_ctrl);
+
+#if MOTOR_CURRENT_CFG_FIXED_POINT_ENABLE
+static void    motor_current_fixed_init(motor_current_instance_ctrl_t            * p_ctrl,
+                                        const motor_current_extended_cfg_t * const p_extended_cfg);
+static void    motor_current_fixed_current(motor_current_instance_ctrl_t * p_ctrl) MOTOR_CURRENT_PRV_RAMFUNC;
+static void    motor_current_fixed_voltage(motor_current_instance_ctrl_t * p_ctrl,
+                                           float                         * p_f4_iuvw_ref) MOTOR_CURRENT_PRV_RAMFUNC;
+static int16_t motor_current_fixed_sin(uint16_t u2_angle) MOTOR_CURRENT_PRV_RAMFUNC;
+static void    motor_current_fixed_uvw_dq(uint16_t        u2_angle,
+                                          const int16_t * p_s2_uvw,
+                                          int16_t       * p_s2_dq) MOTOR_CURRENT_PRV_RAMFUNC;
+static void    motor_current_fixed_dq_uvw(uint16_t        u2_angle,
+                                          const int16_t * p_s2_dq,
+                                          int16_t       * p_s2_uvw) MOTOR_CURRENT_PRV_RAMFUNC;
+
+#else
+static float motor_current_limit_abs(float f4_value, float f4_limit_value) MOTOR_CURRENT_PRV_RAMFUNC;
+static void  motor_current_pi_calculation(motor_current_instance_ctrl_t * p_ctrl) MOTOR_CURRENT_PRV_RAMFUNC;
+static float motor_current_pi_control(motor_current_pi_params_t * pi_ctrl) MOTOR_CURRENT_PRV_RAMFUNC;
 static void  motor_current_decoupling(motor_current_instance_ctrl_t         * p_ctrl,
                                       float                                   f_speed_rad,
-                                      const motor_current_motor_parameter_t * p_mtr);
-static void motor_current_voltage_limit(motor_current_instance_ctrl_t * p_ctrl);
-static void motor_current_transform_uvw_dq_abs(const float f_angle, const float * f_uvw, float * f_dq);
-static void motor_current_transform_dq_uvw_abs(const float f_angle, const float * f_dq, float * f_uvw);
+                                      const motor_current_motor_parameter_t * p_mtr) MOTOR_CURRENT_PRV_RAMFUNC;
+static void motor_current_voltage_limit(motor_current_instance_ctrl_t * p_ctrl) MOTOR_CURRENT_PRV_RAMFUNC;
+static void motor_current_transform_uvw_dq_abs(const float   f_angle,
+                                               const float * f_uvw,
+                                               float       * f_dq) MOTOR_CURRENT_PRV_RAMFUNC;
+static void motor_current_transform_dq_uvw_abs(const float   f_angle,
+                                               const float * f_dq,
+                                               float       * f_uvw) MOTOR_CURRENT_PRV_RAMFUNC;
+static void motor_current_sin_cos(float f_angle, float * p_f4_sin, float * p_f4_cos) MOTOR_CURRENT_PRV_RAMFUNC;
+static void motor_current_fast_uvw_dq(float         f4_sin,
+                                      float         f4_cos,
+                                      const float * f_uvw,
+                                      float       * f_dq) MOTOR_CURRENT_PRV_RAMFUNC;
+static void motor_current_fast_dq_uvw(float         f4_sin,
+                                      float         f4_cos,
+                                      const float * f_dq,
+                                      float       * f_uvw) MOTOR_CURRENT_PRV_RAMFUNC;
+
+#endif
 
 /***********************************************************************************************************************
  * Private global variables
@@ -89,6 +215,122 @@ static const fsp_version_t g_motor_current_version =
     .code_version_minor = MOTOR_CURRENT_CODE_VERSION_MINOR
 };
 
+#if MOTOR_CURRENT_CFG_FIXED_POINT_ENABLE
+
+/* Quarter-wave sine table in Q15, sin(i * (pi / 2) / 128) */
+static const int16_t g_motor_current_sin_table[MOTOR_CURRENT_FIX_SIN_STEPS + 1U] =
+{
+    0,     402,   804,   1206,  1608,  2009,  2411,  2811,  3212,  3612,
+    4011,  4410,  4808,  5205,  5602,  5998,  6393,  6787,  7180,  7571,
+    7962,  8351,  8740,  9127,  9512,  9896,  10279, 10660, 11039, 11417,
+    11793, 12167, 12540, 12910, 13279, 13646, 14010, 14373, 14733, 15091,
+    15447, 15800, 16151, 16500, 16846, 17190, 17531, 17869, 18205, 18538,
+    18868, 19195, 19520, 19841, 20160, 20475, 20788, 21097, 21403, 21706,
+    22006, 22302, 22595, 22884, 23170, 23453, 23732, 24008, 24279, 24548,
+    24812, 25073, 25330, 25583, 25833, 26078, 26320, 26557, 26791, 27020,
+    27246, 27467, 27684, 27897, 28106, 28311, 28511, 28707, 28899, 29086,
+    29269, 29448, 29622, 29792, 29957, 30118, 30274, 30425, 30572, 30715,
+    30853, 30986, 31114, 31238, 31357, 31471, 31581, 31686, 31786, 31881,
+    31972, 32058, 32138, 32214, 32286, 32352, 32413, 32470, 32522, 32568,
+    32610, 32647, 32679, 32706, 32729, 32746, 32758, 32766, 32767
+};
+#endif
+
+#if (0 == MOTOR_CURRENT_CFG_FIXED_POINT_ENABLE)
+
+/* sin() over one turn in MOTOR_CURRENT_SINCOS_STEPS steps, the last entry repeats the first for interpolation */
+static const float g_motor_current_sincos_table[MOTOR_CURRENT_SINCOS_STEPS + 1U] =
+{
+    0.00000000F, 0.01227154F, 0.02454123F, 0.03680722F, 0.04906767F, 0.06132074F,
+    0.07356456F, 0.08579731F, 0.09801714F, 0.11022221F, 0.12241068F, 0.13458071F,
+    0.14673047F, 0.15885814F, 0.17096189F, 0.18303989F, 0.19509032F, 0.20711138F,
+    0.21910124F, 0.23105811F, 0.24298018F, 0.25486566F, 0.26671276F, 0.27851969F,
+    0.29028468F, 0.30200595F, 0.31368174F, 0.32531029F, 0.33688985F, 0.34841868F,
+    0.35989504F, 0.37131719F, 0.38268343F, 0.39399204F, 0.40524131F, 0.41642956F,
+    0.42755509F, 0.43861624F, 0.44961133F, 0.46053871F, 0.47139674F, 0.48218377F,
+    0.49289819F, 0.50353838F, 0.51410274F, 0.52458968F, 0.53499762F, 0.54532499F,
+    0.55557023F, 0.56573181F, 0.57580819F, 0.58579786F, 0.59569930F, 0.60551104F,
+    0.61523159F, 0.62485949F, 0.63439328F, 0.64383154F, 0.65317284F, 0.66241578F,
+    0.67155895F, 0.68060100F, 0.68954054F, 0.69837625F, 0.70710678F, 0.71573083F,
+    0.72424708F, 0.73265427F, 0.74095113F, 0.74913639F, 0.75720885F, 0.76516727F,
+    0.77301045F, 0.78073723F, 0.78834643F, 0.79583690F, 0.80320753F, 0.81045720F,
+    0.81758481F, 0.82458930F, 0.83146961F, 0.83822471F, 0.84485357F, 0.85135519F,
+    0.85772861F, 0.86397286F, 0.87008699F, 0.87607009F, 0.88192126F, 0.88763962F,
+    0.89322430F, 0.89867447F, 0.90398929F, 0.90916798F, 0.91420976F, 0.91911385F,
+    0.92387953F, 0.92850608F, 0.93299280F, 0.93733901F, 0.94154407F, 0.94560733F,
+    0.94952818F, 0.95330604F, 0.95694034F, 0.96043052F, 0.96377607F, 0.96697647F,
+    0.97003125F, 0.97293995F, 0.97570213F, 0.97831737F, 0.98078528F, 0.98310549F,
+    0.98527764F, 0.98730142F, 0.98917651F, 0.99090264F, 0.99247953F, 0.99390697F,
+    0.99518473F, 0.99631261F, 0.99729046F, 0.99811811F, 0.99879546F, 0.99932238F,
+    0.99969882F, 0.99992470F, 1.00000000F, 0.99992470F, 0.99969882F, 0.99932238F,
+    0.99879546F, 0.99811811F, 0.99729046F, 0.99631261F, 0.99518473F, 0.99390697F,
+    0.99247953F, 0.99090264F, 0.98917651F, 0.98730142F, 0.98527764F, 0.98310549F,
+    0.98078528F, 0.97831737F, 0.97570213F, 0.97293995F, 0.97003125F, 0.96697647F,
+    0.96377607F, 0.96043052F, 0.95694034F, 0.95330604F, 0.94952818F, 0.94560733F,
+    0.94154407F, 0.93733901F, 0.93299280F, 0.92850608F, 0.92387953F, 0.91911385F,
+    0.91420976F, 0.90916798F, 0.90398929F, 0.89867447F, 0.89322430F, 0.88763962F,
+    0.88192126F, 0.87607009F, 0.87008699F, 0.86397286F, 0.85772861F, 0.85135519F,
+    0.84485357F, 0.83822471F, 0.83146961F, 0.82458930F, 0.81758481F, 0.81045720F,
+    0.80320753F, 0.79583690F, 0.78834643F, 0.78073723F, 0.77301045F, 0.76516727F,
+    0.75720885F, 0.74913639F, 0.74095113F, 0.73265427F, 0.72424708F, 0.71573083F,
+    0.70710678F, 0.69837625F, 0.68954054F, 0.68060100F, 0.67155895F, 0.66241578F,
+    0.65317284F, 0.64383154F, 0.63439328F, 0.62485949F, 0.61523159F, 0.60551104F,
+    0.59569930F, 0.58579786F, 0.57580819F, 0.56573181F, 0.55557023F, 0.54532499F,
+    0.53499762F, 0.52458968F, 0.51410274F, 0.50353838F, 0.49289819F, 0.48218377F,
+    0.47139674F, 0.46053871F, 0.44961133F, 0.43861624F, 0.42755509F, 0.41642956F,
+    0.40524131F, 0.39399204F, 0.38268343F, 0.37131719F, 0.35989504F, 0.34841868F,
+    0.33688985F, 0.32531029F, 0.31368174F, 0.30200595F, 0.29028468F, 0.27851969F,
+    0.26671276F, 0.25486566F, 0.24298018F, 0.23105811F, 0.21910124F, 0.20711138F,
+    0.19509032F, 0.18303989F, 0.17096189F, 0.15885814F, 0.14673047F, 0.13458071F,
+    0.12241068F, 0.11022221F, 0.09801714F, 0.08579731F, 0.07356456F, 0.06132074F,
+    0.04906767F, 0.03680722F, 0.02454123F, 0.01227154F, 0.00000000F, -0.01227154F,
+    -0.02454123F, -0.03680722F, -0.04906767F, -0.06132074F, -0.07356456F, -0.08579731F,
+    -0.09801714F, -0.11022221F, -0.12241068F, -0.13458071F, -0.14673047F, -0.15885814F,
+    -0.17096189F, -0.18303989F, -0.19509032F, -0.20711138F, -0.21910124F, -0.23105811F,
+    -0.24298018F, -0.25486566F, -0.26671276F, -0.27851969F, -0.29028468F, -0.30200595F,
+    -0.31368174F, -0.32531029F, -0.33688985F, -0.34841868F, -0.35989504F, -0.37131719F,
+    -0.38268343F, -0.39399204F, -0.40524131F, -0.41642956F, -0.42755509F, -0.43861624F,
+    -0.44961133F, -0.46053871F, -0.47139674F, -0.48218377F, -0.49289819F, -0.50353838F,
+    -0.51410274F, -0.52458968F, -0.53499762F, -0.54532499F, -0.55557023F, -0.56573181F,
+    -0.57580819F, -0.58579786F, -0.59569930F, -0.60551104F, -0.61523159F, -0.62485949F,
+    -0.63439328F, -0.64383154F, -0.65317284F, -0.66241578F, -0.67155895F, -0.68060100F,
+    -0.68954054F, -0.69837625F, -0.70710678F, -0.71573083F, -0.72424708F, -0.73265427F,
+    -0.74095113F, -0.74913639F, -0.75720885F, -0.76516727F, -0.77301045F, -0.78073723F,
+    -0.78834643F, -0.79583690F, -0.80320753F, -0.81045720F, -0.81758481F, -0.82458930F,
+    -0.83146961F, -0.83822471F, -0.84485357F, -0.85135519F, -0.85772861F, -0.86397286F,
+    -0.87008699F, -0.87607009F, -0.88192126F, -0.88763962F, -0.89322430F, -0.89867447F,
+    -0.90398929F, -0.90916798F, -0.91420976F, -0.91911385F, -0.92387953F, -0.92850608F,
+    -0.93299280F, -0.93733901F, -0.94154407F, -0.94560733F, -0.94952818F, -0.95330604F,
+    -0.95694034F, -0.96043052F, -0.96377607F, -0.96697647F, -0.97003125F, -0.97293995F,
+    -0.97570213F, -0.97831737F, -0.98078528F, -0.98310549F, -0.98527764F, -0.98730142F,
+    -0.98917651F, -0.99090264F, -0.99247953F, -0.99390697F, -0.99518473F, -0.99631261F,
+    -0.99729046F, -0.99811811F, -0.99879546F, -0.99932238F, -0.99969882F, -0.99992470F,
+    -1.00000000F, -0.99992470F, -0.99969882F, -0.99932238F, -0.99879546F, -0.99811811F,
+    -0.99729046F, -0.99631261F, -0.99518473F, -0.99390697F, -0.99247953F, -0.99090264F,
+    -0.98917651F, -0.98730142F, -0.98527764F, -0.98310549F, -0.98078528F, -0.97831737F,
+    -0.97570213F, -0.97293995F, -0.97003125F, -0.96697647F, -0.96377607F, -0.96043052F,
+    -0.95694034F, -0.95330604F, -0.94952818F, -0.94560733F, -0.94154407F, -0.93733901F,
+    -0.93299280F, -0.92850608F, -0.92387953F, -0.91911385F, -0.91420976F, -0.90916798F,
+    -0.90398929F, -0.89867447F, -0.89322430F, -0.88763962F, -0.88192126F, -0.87607009F,
+    -0.87008699F, -0.86397286F, -0.85772861F, -0.85135519F, -0.84485357F, -0.83822471F,
+    -0.83146961F, -0.82458930F, -0.81758481F, -0.81045720F, -0.80320753F, -0.79583690F,
+    -0.78834643F, -0.78073723F, -0.77301045F, -0.76516727F, -0.75720885F, -0.74913639F,
+    -0.74095113F, -0.73265427F, -0.72424708F, -0.71573083F, -0.70710678F, -0.69837625F,
+    -0.68954054F, -0.68060100F, -0.67155895F, -0.66241578F, -0.65317284F, -0.64383154F,
+    -0.63439328F, -0.62485949F, -0.61523159F, -0.60551104F, -0.59569930F, -0.58579786F,
+    -0.57580819F, -0.56573181F, -0.55557023F, -0.54532499F, -0.53499762F, -0.52458968F,
+    -0.51410274F, -0.50353838F, -0.49289819F, -0.48218377F, -0.47139674F, -0.46053871F,
+    -0.44961133F, -0.43861624F, -0.42755509F, -0.41642956F, -0.40524131F, -0.39399204F,
+    -0.38268343F, -0.37131719F, -0.35989504F, -0.34841868F, -0.33688985F, -0.32531029F,
+    -0.31368174F, -0.30200595F, -0.29028468F, -0.27851969F, -0.26671276F, -0.25486566F,
+    -0.24298018F, -0.23105811F, -0.21910124F, -0.20711138F, -0.19509032F, -0.18303989F,
+    -0.17096189F, -0.15885814F, -0.14673047F, -0.13458071F, -0.12241068F, -0.11022221F,
+    -0.09801714F, -0.08579731F, -0.07356456F, -0.06132074F, -0.04906767F, -0.03680722F,
+    -0.02454123F, -0.01227154F, 0.00000000F
+};
+
+#endif
+
 /***********************************************************************************************************************
  * Global variables
  **********************************************************************************************************************/
@@ -144,6 +386,16 @@ fsp_err_t RM_MOTOR_CURRENT_Open (motor_current_ctrl_t * const p_ctrl, motor_curr
     check_period = p_extended_cfg->f_current_ctrl_period * MOTOR_CURRENT_DIV_KHZ;
 
     MOTOR_CURRENT_ERROR_RETURN(check_period >= 0.0F, FSP_ERR_INVALID_ARGUMENT);
+ #if MOTOR_CURRENT_CFG_FIXED_POINT_ENABLE
+    MOTOR_CURRENT_ERROR_RETURN(p_extended_cfg->f_current_base > 0.0F, FSP_ERR_INVALID_ARGUMENT);
+    MOTOR_CURRENT_ERROR_RETURN(p_extended_cfg->f_voltage_base > 0.0F, FSP_ERR_INVALID_ARGUMENT);
+ #endif
+ #if MOTOR_CURRENT_CFG_MULTI_RATE_ENABLE
+    if (p_extended_cfg->u1_angle_divisor > 1U)
+    {
+        MOTOR_CURRENT_ERROR_RETURN(p_extended_cfg->angle_irq >= 0, FSP_ERR_INVALID_ARGUMENT);
+    }
+ #endif
 #endif
 
     p_instance_ctrl->p_driver_instance = p_cfg->p_motor_driver_instance;
@@ -153,8 +405,29 @@ fsp_err_t RM_MOTOR_CURRENT_Open (motor_current_ctrl_t * const p_ctrl, motor_curr
 
     p_instance_ctrl->p_cfg = p_cfg;
 
+    R_BSP_LatencyStatsClear(&p_instance_ctrl->st_cycles);
+    R_BSP_LatencyStatsClear(&p_instance_ctrl->st_angle_cycles);
+#if MOTOR_CURRENT_CFG_BENCHMARK_ENABLE
+    R_BSP_CycleCounterStart();
+#endif
+
     motor_current_reset(p_instance_ctrl);
 
+#if MOTOR_CURRENT_CFG_MULTI_RATE_ENABLE
+    p_instance_ctrl->st_multi_rate.u4_input_sequence  = 0U;
+    p_instance_ctrl->st_multi_rate.u4_input_taken     = 0U;
+    p_instance_ctrl->st_multi_rate.u4_output_sequence = 0U;
+    p_instance_ctrl->st_multi_rate.u4_output_applied  = 0U;
+    p_instance_ctrl->st_multi_rate.u4_overruns        = 0U;
+    p_instance_ctrl->st_multi_rate.f_period           = p_extended_cfg->f_current_ctrl_period * MOTOR_CURRENT_DIV_KHZ;
+
+    /* The estimation is pended by software from the current control cycle, so the interrupt needs no event link. */
+    if ((p_extended_cfg->u1_angle_divisor > 1U) && (p_instance_ctrl->p_angle_instance != NULL))
+    {
+        R_BSP_IrqCfgEnable(p_extended_cfg->angle_irq, p_extended_cfg->angle_ipl, p_instance_ctrl);
+    }
+#endif
+
     p_instance_ctrl->st_pi_id.f_ilimit = p_extended_cfg->f_ilimit;
     p_instance_ctrl->st_pi_iq.f_ilimit = p_extended_cfg->f_ilimit;
 
@@ -164,6 +437,10 @@ fsp_err_t RM_MOTOR_CURRENT_Open (motor_current_ctrl_t * const p_ctrl, motor_curr
                                   &(p_instance_ctrl->st_pi_iq),
                                   p_extended_cfg->f_current_ctrl_period * MOTOR_CURRENT_DIV_KHZ);
 
+#if MOTOR_CURRENT_CFG_FIXED_POINT_ENABLE
+    motor_current_fixed_init(p_instance_ctrl, p_extended_cfg);
+#endif
+
     p_instance_ctrl->st_vcomp.f_comp_v[0]             = p_extended_cfg->f_comp_v[0];
     p_instance_ctrl->st_vcomp.f_comp_v[1]             = p_extended_cfg->f_comp_v[1];
     p_instance_ctrl->st_vcomp.f_comp_v[2]             = p_extended_cfg->f_comp_v[2];
@@ -213,6 +490,17 @@ fsp_err_t RM_MOTOR_CURRENT_Close (motor_current_ctrl_t * const p_ctrl)
     FSP_ASSERT(p_instance_ctrl);
     MOTOR_CURRENT_ERROR_RETURN(MOTOR_CURRENT_OPEN == p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
 #endif
+
+#if MOTOR_CURRENT_CFG_MULTI_RATE_ENABLE
+    motor_current_extended_cfg_t * p_extended_cfg =
+        (motor_current_extended_cfg_t *) p_instance_ctrl->p_cfg->p_extend;
+    if (p_extended_cfg->u1_angle_divisor > 1U)
+    {
+        R_BSP_IrqDisable(p_extended_cfg->angle_irq);
+        R_FSP_IsrContextSet(p_extended_cfg->angle_irq, NULL);
+    }
+#endif
+
     motor_current_reset(p_instance_ctrl);
 
     rm_motor_voltage_error_compensation_init(&(p_instance_ctrl->st_vcomp));
@@ -455,9 +743,26 @@ fsp_err_t RM_MOTOR_CURRENT_CurrentGet (motor_current_ctrl_t * const p_ctrl, floa
     MOTOR_CURRENT_ERROR_RETURN(p_iq != NULL, FSP_ERR_INVALID_ARGUMENT);
 #endif
 
-    motor_current_transform_uvw_dq_abs(p_instance_ctrl->f_rotor_angle,
-                                       &(p_instance_ctrl->f_iu_ad),
-                                       &(p_instance_ctrl->f_id_ad));
+#if MOTOR_CURRENT_CFG_FIXED_POINT_ENABLE
+    motor_current_fixed_current(p_instance_ctrl);
+#else
+    motor_current_extended_cfg_t * p_extended_cfg =
+        (motor_current_extended_cfg_t *) p_instance_ctrl->p_cfg->p_extend;
+    float f4_sin;
+    float f4_cos;
+
+    if (MOTOR_CURRENT_TRANSFORM_SELECT_TABLE == p_extended_cfg->transform_select)
+    {
+        motor_current_sin_cos(p_instance_ctrl->f_rotor_angle, &f4_sin, &f4_cos);
+        motor_current_fast_uvw_dq(f4_sin, f4_cos, &(p_instance_ctrl->f_iu_ad), &(p_instance_ctrl->f_id_ad));
+    }
+    else
+    {
+        motor_current_transform_uvw_dq_abs(p_instance_ctrl->f_rotor_angle,
+                                           &(p_instance_ctrl->f_iu_ad),
+                                           &(p_instance_ctrl->f_id_ad));
+    }
+#endif
 
     *p_id = p_instance_ctrl->f_id_ad;
     *p_iq = p_instance_ctrl->f_iq_ad;
@@ -486,6 +791,15 @@ fsp_err_t RM_MOTOR_CURRENT_PhaseVoltageGet (motor_current_ctrl_t * const
     MOTOR_CURRENT_ERROR_RETURN(p_voltage != NULL, FSP_ERR_INVALID_ARGUMENT);
 #endif
 
+#if MOTOR_CURRENT_CFG_FIXED_POINT_ENABLE
+
+    /*===========================================================*/
+    /*     Current control and coordinate transformation (Q15)   */
+    /*===========================================================*/
+    motor_current_fixed_voltage(p_instance_ctrl, &(f4_iuvw_ref[0]));
+    p_voltage->vd_reference = p_instance_ctrl->f_vd_ref;
+    p_voltage->vq_reference = p_instance_ctrl->f_vq_ref;
+#else
     motor_current_extended_cfg_t * p_extended_cfg =
         (motor_current_extended_cfg_t *) p_instance_ctrl->p_cfg->p_extend;
 
@@ -506,17 +820,40 @@ fsp_err_t RM_MOTOR_CURRENT_PhaseVoltageGet (motor_current_ctrl_t * const
     p_voltage->vd_reference = p_instance_ctrl->f_vd_ref;
     p_voltage->vq_reference = p_instance_ctrl->f_vq_ref;
 
-    /*=================================================*/
-    /*    Coordinate transformation (dq->uvw)          */
-    /*=================================================*/
-    motor_current_transform_dq_uvw_abs(p_instance_ctrl->f_rotor_angle,
-                                       &(p_instance_ctrl->f_vd_ref),
-                                       &(p_instance_ctrl->f_refu));
-
-    /*====================================*/
-    /*     Voltage error compensation     */
-    /*====================================*/
-    motor_current_transform_dq_uvw_abs(p_instance_ctrl->f_rotor_angle, &(p_instance_ctrl->f_id_ref), &(f4_iuvw_ref[0]));
+    if (MOTOR_CURRENT_TRANSFORM_SELECT_TABLE == p_extended_cfg->transform_select)
+    {
+        /* One table lookup serves both transforms of this cycle */
+        float f4_sin;
+        float f4_cos;
+        motor_current_sin_cos(p_instance_ctrl->f_rotor_angle, &f4_sin, &f4_cos);
+
+        /*=================================================*/
+        /*    Coordinate transformation (dq->uvw)          */
+        /*=================================================*/
+        motor_current_fast_dq_uvw(f4_sin, f4_cos, &(p_instance_ctrl->f_vd_ref), &(p_instance_ctrl->f_refu));
+
+        /*====================================*/
+        /*     Voltage error compensation     */
+        /*====================================*/
+        motor_current_fast_dq_uvw(f4_sin, f4_cos, &(p_instance_ctrl->f_id_ref), &(f4_iuvw_ref[0]));
+    }
+    else
+    {
+        /*=================================================*/
+        /*    Coordinate transformation (dq->uvw)          */
+        /*=================================================*/
+        motor_current_transform_dq_uvw_abs(p_instance_ctrl->f_rotor_angle,
+                                           &(p_instance_ctrl->f_vd_ref),
+                                           &(p_instance_ctrl->f_refu));
+
+        /*====================================*/
+        /*     Voltage error compensation     */
+        /*====================================*/
+        motor_current_transform_dq_uvw_abs(p_instance_ctrl->f_rotor_angle,
+                                           &(p_instance_ctrl->f_id_ref),
+                                           &(f4_iuvw_ref[0]));
+    }
+#endif
 
     rm_motor_voltage_error_compensation_main(&(p_instance_ctrl->st_vcomp),
                                              &(p_instance_ctrl->f_refu),
@@ -561,6 +898,10 @@ fsp_err_t RM_MOTOR_CURRENT_ParameterUpdate (motor_current_ctrl_t * const      p_
                                   &(p_instance_ctrl->st_pi_iq),
                                   p_extended_cfg->f_current_ctrl_period * MOTOR_CURRENT_DIV_KHZ);
 
+#if MOTOR_CURRENT_CFG_FIXED_POINT_ENABLE
+    motor_current_fixed_init(p_instance_ctrl, p_extended_cfg);
+#endif
+
     rm_motor_voltage_error_compensation_init(&(p_instance_ctrl->st_vcomp));
 
     return err;
@@ -636,8 +977,13 @@ void rm_motor_current_cyclic (motor_driver_callback_args_t * p_args)
         /* Current Control Timing */
         case MOTOR_DRIVER_EVENT_CURRENT:
         {
+#if MOTOR_CURRENT_CFG_BENCHMARK_ENABLE
+            uint32_t u4_start = DWT->CYCCNT;
+#endif
+
             /* Get A/D coverted data */
-            p_driver_instance->p_api->currentGet(p_driver_instance->p_ctrl, &temp_drv_crnt_get);
+            MOTOR_CURRENT_PRV_DRIVER_API(p_driver_instance, currentGet, CurrentGet) (p_driver_instance->p_ctrl,
+                                                                                     &temp_drv_crnt_get);
             f_iu_ad  = temp_drv_crnt_get.iu;
             f_iw_ad  = temp_drv_crnt_get.iw;
             f_vdc_ad = temp_drv_crnt_get.vdc;
@@ -651,8 +997,9 @@ void rm_motor_current_cyclic (motor_driver_callback_args_t * p_args)
             if (MOTOR_CURRENT_FLG_SET == p_instance_ctrl->u1_active)
             {
                 /* Measure current offset values */
-                p_driver_instance->p_api->flagCurrentOffsetGet(p_driver_instance->p_ctrl,
-                                                               &(p_instance_ctrl->u1_flag_crnt_offset));
+                MOTOR_CURRENT_PRV_DRIVER_API(p_driver_instance, flagCurrentOffsetGet, FlagCurrentOffsetGet) (
+                    p_driver_instance->p_ctrl,
+                    &(p_instance_ctrl->u1_flag_crnt_offset));
 
                 /* After current offset was measured */
                 if (MOTOR_CURRENT_FLG_SET == p_instance_ctrl->u1_flag_crnt_offset)
@@ -683,7 +1030,16 @@ void rm_motor_current_cyclic (motor_driver_callback_args_t * p_args)
                     /*==============================*/
                     /*     Angle & speed process    */
                     /*==============================*/
-                    motor_current_angle_cyclic(p_instance);
+#if MOTOR_CURRENT_CFG_MULTI_RATE_ENABLE
+                    if (((motor_current_extended_cfg_t *) p_instance->p_cfg->p_extend)->u1_angle_divisor > 1U)
+                    {
+                        motor_current_multi_rate_cyclic(p_instance_ctrl);
+                    }
+                    else
+#endif
+                    {
+                        motor_current_angle_cyclic(p_instance);
+                    }
 
                     p_instance->p_api->speedPhaseSet(p_instance_ctrl,
                                                      p_instance_ctrl->f_speed_rad,
@@ -705,10 +1061,18 @@ void rm_motor_current_cyclic (motor_driver_callback_args_t * p_args)
                     /*===============================*/
                     /*    Space vector modulation    */
                     /*===============================*/
-                    p_driver_instance->p_api->phaseVoltageSet(p_driver_instance->p_ctrl, f_ref[0], f_ref[1], f_ref[2]);
+                    MOTOR_CURRENT_PRV_DRIVER_API(p_driver_instance, phaseVoltageSet, PhaseVoltageSet) (
+                        p_driver_instance->p_ctrl,
+                        f_ref[0],
+                        f_ref[1],
+                        f_ref[2]);
                 }
             }
 
+#if MOTOR_CURRENT_CFG_BENCHMARK_ENABLE
+            R_BSP_LatencyStatsRecord(&p_instance_ctrl->st_cycles, DWT->CYCCNT - u4_start);
+#endif
+
             break;
         }
 
@@ -745,24 +1109,183 @@ static void motor_current_angle_cyclic (motor_current_instance_t * p_instance)
     motor_angle_instance_t const  * p_angle = p_ctrl->p_angle_instance;
     motor_angle_current_t           temp_current;
     motor_angle_voltage_reference_t temp_vol_ref;
+#if MOTOR_CURRENT_CFG_BENCHMARK_ENABLE
+    uint32_t u4_start = DWT->CYCCNT;
+#endif
 
     temp_current.id = p_ctrl->f_id_ad;
     temp_current.iq = p_ctrl->f_iq_ad;
     temp_vol_ref.vd = p_ctrl->f_vd_ref;
     temp_vol_ref.vq = p_ctrl->f_vq_ref;
 
-    p_angle->p_api->flagPiCtrlSet(p_angle->p_ctrl, p_ctrl->st_input.u1_flag_pi);
-    p_angle->p_api->speedSet(p_angle->p_ctrl,
-                             p_ctrl->st_input.f_ref_speed_rad_ctrl,
-                             p_ctrl->st_input.f_damp_comp_speed);
-    p_angle->p_api->currentSet(p_angle->p_ctrl, &temp_current, &temp_vol_ref);
-    p_angle->p_api->angleSpeedGet(p_angle->p_ctrl,
-                                  &(p_ctrl->f_rotor_angle),
-                                  &(p_ctrl->f_speed_rad),
-                                  &(p_ctrl->f_phase_err));
-    p_angle->p_api->estimatedComponentGet(p_angle->p_ctrl, &(p_ctrl->f_ed), &(p_ctrl->f_eq));
+    MOTOR_CURRENT_PRV_ANGLE_API(p_angle, flagPiCtrlSet, FlagPiCtrlSet) (p_angle->p_ctrl, p_ctrl->st_input.u1_flag_pi);
+    MOTOR_CURRENT_PRV_ANGLE_API(p_angle, speedSet, SpeedSet) (p_angle->p_ctrl,
+                                                              p_ctrl->st_input.f_ref_speed_rad_ctrl,
+                                                              p_ctrl->st_input.f_damp_comp_speed);
+    MOTOR_CURRENT_PRV_ANGLE_API(p_angle, currentSet, CurrentSet) (p_angle->p_ctrl, &temp_current, &temp_vol_ref);
+    MOTOR_CURRENT_PRV_ANGLE_API(p_angle, angleSpeedGet, AngleSpeedGet) (p_angle->p_ctrl,
+                                                                        &(p_ctrl->f_rotor_angle),
+                                                                        &(p_ctrl->f_speed_rad),
+                                                                        &(p_ctrl->f_phase_err));
+    MOTOR_CURRENT_PRV_ANGLE_API(p_angle, estimatedComponentGet, EstimatedComponentGet) (p_angle->p_ctrl,
+                                                                                        &(p_ctrl->f_ed),
+                                                                                        &(p_ctrl->f_eq));
+
+#if MOTOR_CURRENT_CFG_BENCHMARK_ENABLE
+    R_BSP_LatencyStatsRecord(&p_ctrl->st_angle_cycles, DWT->CYCCNT - u4_start);
+#endif
 }                                      /* End of function motor_current_angle_cyclic */
 
+#if MOTOR_CURRENT_CFG_MULTI_RATE_ENABLE
+
+/***********************************************************************************************************************
+ * Function Name : motor_current_multi_rate_cyclic
+ * Description   : Advances the rotor angle every current control cycle, applies the newest estimation and publishes
+ *                 the estimator input every u1_angle_divisor cycles
+ * Arguments     : p_ctrl - The pointer to current control module control instance
+ * Return Value  : None
+ **********************************************************************************************************************/
+static void motor_current_multi_rate_cyclic (motor_current_instance_ctrl_t * p_ctrl)
+{
+    motor_current_multi_rate_t   * p_rate         = &(p_ctrl->st_multi_rate);
+    motor_current_extended_cfg_t * p_extended_cfg = (motor_current_extended_cfg_t *) p_ctrl->p_cfg->p_extend;
+
+    p_rate->u4_cycle++;
+
+    /* The estimation has the lower priority, so an output is never written while it is read here. */
+    uint32_t u4_sequence = p_rate->u4_output_sequence;
+    if (u4_sequence != p_rate->u4_output_applied)
+    {
+        motor_current_angle_output_t const * p_output = &(p_rate->st_output[u4_sequence & 1U]);
+
+        /* Bring the estimated angle forward from the cycle it was estimated for */
+        p_ctrl->f_speed_rad   = p_output->f_speed_rad;
+        p_ctrl->f_phase_err   = p_output->f_phase_err;
+        p_ctrl->f_ed          = p_output->f_ed;
+        p_ctrl->f_eq          = p_output->f_eq;
+        p_ctrl->f_rotor_angle = p_output->f_rotor_angle +
+                                (p_output->f_speed_rad * p_rate->f_period *
+                                 (float) (p_rate->u4_cycle - p_output->u4_cycle));
+        p_rate->u4_output_applied = u4_sequence;
+    }
+    else
+    {
+        p_ctrl->f_rotor_angle += p_ctrl->f_speed_rad * p_rate->f_period;
+    }
+
+    if (p_ctrl->f_rotor_angle >= MOTOR_CURRENT_TWOPI)
+    {
+        p_ctrl->f_rotor_angle -= MOTOR_CURRENT_TWOPI;
+    }
+    else if (p_ctrl->f_rotor_angle < 0.0F)
+    {
+        p_ctrl->f_rotor_angle += MOTOR_CURRENT_TWOPI;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+
+    if (0U == (p_rate->u4_cycle % p_extended_cfg->u1_angle_divisor))
+    {
+        u4_sequence = p_rate->u4_input_sequence;
+        if (u4_sequence != p_rate->u4_input_taken)
+        {
+            p_rate->u4_overruns++;
+        }
+
+        /* Fill the buffer not being read, then publish it */
+        u4_sequence++;
+        motor_current_angle_input_t * p_input = &(p_rate->st_input[u4_sequence & 1U]);
+        p_input->current.id           = p_ctrl->f_id_ad;
+        p_input->current.iq           = p_ctrl->f_iq_ad;
+        p_input->voltage.vd           = p_ctrl->f_vd_ref;
+        p_input->voltage.vq           = p_ctrl->f_vq_ref;
+        p_input->f_ref_speed_rad_ctrl = p_ctrl->st_input.f_ref_speed_rad_ctrl;
+        p_input->f_damp_comp_speed    = p_ctrl->st_input.f_damp_comp_speed;
+        p_input->u1_flag_pi           = p_ctrl->st_input.u1_flag_pi;
+        p_input->u4_cycle             = p_rate->u4_cycle;
+        __DMB();
+        p_rate->u4_input_sequence = u4_sequence;
+
+        NVIC_SetPendingIRQ(p_extended_cfg->angle_irq);
+    }
+}                                      /* End of function motor_current_multi_rate_cyclic */
+
+#endif
+
+#if MOTOR_CURRENT_CFG_MULTI_RATE_ENABLE
+
+/*******************************************************************************************************************//**
+ * Angle/speed estimation of the multi-rate execution. Installed on the vector of angle_irq, it runs at angle_ipl below
+ * the A/D interrupt and is pended every u1_angle_divisor current control cycles.
+ **********************************************************************************************************************/
+void rm_motor_current_angle_isr (void)
+{
+    /* Save context if RTOS is used */
+    FSP_CONTEXT_SAVE
+
+    motor_current_instance_ctrl_t * p_ctrl =
+        (motor_current_instance_ctrl_t *) R_FSP_IsrContextGet(R_FSP_CurrentIrqGet());
+
+    if (NULL != p_ctrl)
+    {
+        motor_current_multi_rate_t    * p_rate  = &(p_ctrl->st_multi_rate);
+        motor_angle_instance_t const  * p_angle = p_ctrl->p_angle_instance;
+        motor_current_angle_input_t     input;
+        motor_current_angle_output_t  * p_output;
+        uint32_t u4_sequence;
+
+        /* The current control cycle can publish while the input is copied. Start over if it did. */
+        do
+        {
+            u4_sequence = p_rate->u4_input_sequence;
+            input       = p_rate->st_input[u4_sequence & 1U];
+            __DMB();
+        } while (u4_sequence != p_rate->u4_input_sequence);
+
+        if (u4_sequence != p_rate->u4_input_taken)
+        {
+            p_rate->u4_input_taken = u4_sequence;
+
+#if MOTOR_CURRENT_CFG_BENCHMARK_ENABLE
+            uint32_t u4_start = DWT->CYCCNT;
+#endif
+
+            MOTOR_CURRENT_PRV_ANGLE_API(p_angle, flagPiCtrlSet, FlagPiCtrlSet) (p_angle->p_ctrl, input.u1_flag_pi);
+            MOTOR_CURRENT_PRV_ANGLE_API(p_angle, speedSet, SpeedSet) (p_angle->p_ctrl,
+                                                                      input.f_ref_speed_rad_ctrl,
+                                                                      input.f_damp_comp_speed);
+            MOTOR_CURRENT_PRV_ANGLE_API(p_angle, currentSet, CurrentSet) (p_angle->p_ctrl,
+                                                                          &input.current,
+                                                                          &input.voltage);
+
+            /* Fill the buffer not being read, then publish it */
+            u4_sequence = p_rate->u4_output_sequence + 1U;
+            p_output    = &(p_rate->st_output[u4_sequence & 1U]);
+            MOTOR_CURRENT_PRV_ANGLE_API(p_angle, angleSpeedGet, AngleSpeedGet) (p_angle->p_ctrl,
+                                                                                &(p_output->f_rotor_angle),
+                                                                                &(p_output->f_speed_rad),
+                                                                                &(p_output->f_phase_err));
+            MOTOR_CURRENT_PRV_ANGLE_API(p_angle, estimatedComponentGet, EstimatedComponentGet) (p_angle->p_ctrl,
+                                                                                                &(p_output->f_ed),
+                                                                                                &(p_output->f_eq));
+            p_output->u4_cycle = input.u4_cycle;
+            __DMB();
+            p_rate->u4_output_sequence = u4_sequence;
+
+#if MOTOR_CURRENT_CFG_BENCHMARK_ENABLE
+            R_BSP_LatencyStatsRecord(&p_ctrl->st_angle_cycles, DWT->CYCCNT - u4_start);
+#endif
+        }
+    }
+
+    /* Restore context if RTOS is used */
+    FSP_CONTEXT_RESTORE
+}
+
+#endif
+
 /***********************************************************************************************************************
  * Function Name : motor_current_reset
  * Description   : Resets FOC current control module
@@ -790,9 +1313,21 @@ static void motor_current_reset (motor_current_instance_ctrl_t * p_ctrl)
     p_ctrl->st_pi_id.f_refi = 0.0F;
     p_ctrl->st_pi_iq.f_refi = 0.0F;
 
+    p_ctrl->st_fixed.s4_refi_d = 0;
+    p_ctrl->st_fixed.s4_refi_q = 0;
+    p_ctrl->st_fixed.s2_id     = 0;
+    p_ctrl->st_fixed.s2_iq     = 0;
+
     p_ctrl->u1_flag_crnt_offset = MOTOR_CURRENT_FLG_CLR;
+
+    /* Drop the estimation exchanged before the reset */
+    p_ctrl->st_multi_rate.u4_cycle          = 0U;
+    p_ctrl->st_multi_rate.u4_input_taken    = p_ctrl->st_multi_rate.u4_input_sequence;
+    p_ctrl->st_multi_rate.u4_output_applied = p_ctrl->st_multi_rate.u4_output_sequence;
 }                                      /* End of function motor_current_reset */
 
+#if (0 == MOTOR_CURRENT_CFG_FIXED_POINT_ENABLE)
+
 /***********************************************************************************************************************
  * Function Name : motor_current_limit_abs
  * Description   : Limit with absolute value
@@ -982,3 +1517,519 @@ static void motor_current_transform_dq_uvw_abs (const float f_angle, const float
     f4_output_q = (f4_sin_div_sqrt3 - f4_cos) * f4_input_q;
     f_uvw[2]    = (f4_output_d + f4_output_q) * (1.0F / MOTOR_CURRENT_SQRT_2);
 }                                      /* End of function motor_current_transform_dq_uvw_abs */
+
+/***********************************************************************************************************************
+ * Function Name : motor_current_sin_cos
+ * Description   : sin/cos by table with linear interpolation (error below 2.0e-5)
+ * Arguments     : f_angle  - rotor angle [rad]
+ *                 p_f4_sin - where to store sin(f_angle)
+ *                 p_f4_cos - where to store cos(f_angle)
+ * Return Value  : None
+ **********************************************************************************************************************/
+static void motor_current_sin_cos (float f_angle, float * p_f4_sin, float * p_f4_cos)
+{
+    float    f4_index = f_angle * MOTOR_CURRENT_SINCOS_SCALE;
+    int32_t  s4_index = (int32_t) f4_index;
+    uint32_t u4_sin;
+    uint32_t u4_cos;
+    float    f4_frac;
+
+    /* Round towards minus infinity so that the fraction is always positive */
+    if (f4_index < (float) s4_index)
+    {
+        s4_index--;
+    }
+
+    f4_frac = f4_index - (float) s4_index;
+    u4_sin  = (uint32_t) s4_index & (MOTOR_CURRENT_SINCOS_STEPS - 1U);
+    u4_cos  = (u4_sin + MOTOR_CURRENT_SINCOS_QUARTER) & (MOTOR_CURRENT_SINCOS_STEPS - 1U);
+
+    *p_f4_sin = g_motor_current_sincos_table[u4_sin] +
+                (f4_frac * (g_motor_current_sincos_table[u4_sin + 1U] - g_motor_current_sincos_table[u4_sin]));
+    *p_f4_cos = g_motor_current_sincos_table[u4_cos] +
+                (f4_frac * (g_motor_current_sincos_table[u4_cos + 1U] - g_motor_current_sincos_table[u4_cos]));
+}                                      /* End of function motor_current_sin_cos */
+
+/***********************************************************************************************************************
+ * Function Name : motor_current_fast_uvw_dq
+ * Description   : Coordinate transform UVW to dq (absolute transform) with precalculated sin/cos
+ * Arguments     : f4_sin   - sin(rotor angle)
+ *                 f4_cos   - cos(rotor angle)
+ *                 f_uvw    - the pointer to the UVW-phase array in [U,V,W] format
+ *                 f_dq     - where to store the [d,q] formated array on dq coordinates
+ * Return Value  : None
+ **********************************************************************************************************************/
+static void motor_current_fast_uvw_dq (float f4_sin, float f4_cos, const float * f_uvw, float * f_dq)
+{
+    /* Clarke transform */
+    float f4_alpha = MOTOR_CURRENT_SQRT_3_2 * f_uvw[0];
+    float f4_beta  = (f_uvw[1] - f_uvw[2]) * (1.0F / MOTOR_CURRENT_SQRT_2);
+
+    /* Park transform */
+#if MOTOR_CURRENT_CFG_CMSIS_DSP_ENABLE
+    arm_park_f32(f4_alpha, f4_beta, &(f_dq[0]), &(f_dq[1]), f4_sin, f4_cos);
+#else
+    f_dq[0] = (f4_alpha * f4_cos) + (f4_beta * f4_sin);
+    f_dq[1] = (f4_beta * f4_cos) - (f4_alpha * f4_sin);
+#endif
+}                                      /* End of function motor_current_fast_uvw_dq */
+
+/***********************************************************************************************************************
+ * Function Name : motor_current_fast_dq_uvw
+ * Description   : Coordinate transform dq to UVW 3-phase (absolute transform) with precalculated sin/cos
+ * Arguments     : f4_sin   - sin(rotor angle)
+ *                 f4_cos   - cos(rotor angle)
+ *                 f_dq     - the pointer to the dq-axis value array in [D,Q] format
+ *                 f_uvw    - where to store the [U,V,W] formated 3-phase quantities array
+ * Return Value  : None
+ **********************************************************************************************************************/
+static void motor_current_fast_dq_uvw (float f4_sin, float f4_cos, const float * f_dq, float * f_uvw)
+{
+    float f4_alpha;
+    float f4_beta;
+    float f4_alpha_vw;
+    float f4_beta_vw;
+
+    /* Inverse Park transform */
+#if MOTOR_CURRENT_CFG_CMSIS_DSP_ENABLE
+    arm_inv_park_f32(f_dq[0], f_dq[1], &f4_alpha, &f4_beta, f4_sin, f4_cos);
+#else
+    f4_alpha = (f_dq[0] * f4_cos) - (f_dq[1] * f4_sin);
+    f4_beta  = (f_dq[0] * f4_sin) + (f_dq[1] * f4_cos);
+#endif
+
+    /* Inverse Clarke transform */
+    f4_alpha_vw = f4_alpha * MOTOR_CURRENT_1_SQRT_6;
+    f4_beta_vw  = f4_beta * (1.0F / MOTOR_CURRENT_SQRT_2);
+    f_uvw[0]    = f4_alpha * MOTOR_CURRENT_SQRT_2_3;
+    f_uvw[1]    = f4_beta_vw - f4_alpha_vw;
+    f_uvw[2]    = -(f4_beta_vw + f4_alpha_vw);
+}                                      /* End of function motor_current_fast_dq_uvw */
+
+#endif
+
+#if MOTOR_CURRENT_CFG_FIXED_POINT_ENABLE
+
+/***********************************************************************************************************************
+ * Function Name : motor_current_fixed_gain
+ * Description   : Converts a gain to the fixed-point mantissa/exponent format
+ * Arguments     : f4_value - Gain
+ * Return Value  : Fixed-point gain
+ **********************************************************************************************************************/
+static motor_current_fixed_gain_t motor_current_fixed_gain (float f4_value)
+{
+    motor_current_fixed_gain_t gain;
+    int   exp    = 0;
+    float f4_mant = frexpf(f4_value, &exp); /* f4_value = f4_mant * 2^exp, 0.5 <= |f4_mant| < 1 */
+
+    if ((0.0F == f4_value) || (exp < MOTOR_CURRENT_FIX_GAIN_EXP_MIN))
+    {
+        gain.s2_mant = 0;
+        gain.s1_exp  = 0;
+    }
+    else if (exp > MOTOR_CURRENT_FIX_GAIN_EXP_MAX)
+    {
+        gain.s2_mant = (f4_value > 0.0F) ? (int16_t) MOTOR_CURRENT_FIX_MAX : (int16_t) -MOTOR_CURRENT_FIX_MAX;
+        gain.s1_exp  = MOTOR_CURRENT_FIX_GAIN_EXP_MAX;
+    }
+    else
+    {
+        gain.s2_mant = (int16_t) (f4_mant * MOTOR_CURRENT_FIX_ONE);
+        gain.s1_exp  = (int8_t) exp;
+    }
+
+    return gain;
+}                                      /* End of function motor_current_fixed_gain */
+
+/***********************************************************************************************************************
+ * Function Name : motor_current_fixed_init
+ * Description   : Calculates the per-unit bases and gains of the fixed-point current loop
+ * Arguments     : p_ctrl         - The pointer to the FOC current control instance
+ *                 p_extended_cfg - The pointer to the extended configuration
+ * Return Value  : None
+ **********************************************************************************************************************/
+static void motor_current_fixed_init (motor_current_instance_ctrl_t            * p_ctrl,
+                                      const motor_current_extended_cfg_t * const p_extended_cfg)
+{
+    motor_current_fixed_t                 * p_fixed = &(p_ctrl->st_fixed);
+    const motor_current_motor_parameter_t * p_mtr   = p_extended_cfg->p_motor_parameter;
+    float f4_i_base = p_extended_cfg->f_current_base;
+    float f4_v_base = p_extended_cfg->f_voltage_base;
+    float f4_w_base = 0.0F;
+    float f4_ilimit;
+
+    /* The speed base is a multiple of the speed at which the magnet flux induces the base voltage */
+    if (p_mtr->f4_mtr_m > 0.0F)
+    {
+        f4_w_base = (MOTOR_CURRENT_FIX_SPEED_HEADROOM * f4_v_base) / p_mtr->f4_mtr_m;
+    }
+
+    p_fixed->f_i_to_pu = MOTOR_CURRENT_FIX_ONE / f4_i_base;
+    p_fixed->f_v_to_pu = MOTOR_CURRENT_FIX_ONE / f4_v_base;
+    p_fixed->f_w_to_pu = (f4_w_base > 0.0F) ? (MOTOR_CURRENT_FIX_ONE / f4_w_base) : 0.0F;
+    p_fixed->f_pu_to_i = f4_i_base / MOTOR_CURRENT_FIX_ONE;
+    p_fixed->f_pu_to_v = f4_v_base / MOTOR_CURRENT_FIX_ONE;
+
+    /* PI gains [V/A] and decoupling gains [V/A/(rad/s)], [V/(rad/s)] in per-unit */
+    p_fixed->kp = motor_current_fixed_gain((p_ctrl->st_pi_id.f_kp * f4_i_base) / f4_v_base);
+    p_fixed->ki = motor_current_fixed_gain((p_ctrl->st_pi_id.f_ki * f4_i_base) / f4_v_base);
+    p_fixed->ld = motor_current_fixed_gain((p_mtr->f4_mtr_ld * f4_w_base * f4_i_base) / f4_v_base);
+    p_fixed->lq = motor_current_fixed_gain((p_mtr->f4_mtr_lq * f4_w_base * f4_i_base) / f4_v_base);
+    p_fixed->m  = motor_current_fixed_gain((p_mtr->f4_mtr_m * f4_w_base) / f4_v_base);
+
+    /* Integral limit in Q30 */
+    f4_ilimit = p_ctrl->st_pi_id.f_ilimit / f4_v_base;
+    if (f4_ilimit >= 1.0F)
+    {
+        p_fixed->s4_ilimit = MOTOR_CURRENT_FIX_Q30_MAX;
+    }
+    else
+    {
+        p_fixed->s4_ilimit = (int32_t) (f4_ilimit * MOTOR_CURRENT_FIX_ONE) << MOTOR_CURRENT_FIX_Q30_SHIFT;
+    }
+}                                      /* End of function motor_current_fixed_init */
+
+/***********************************************************************************************************************
+ * Function Name : motor_current_fixed_sat
+ * Description   : Saturates a value to the Q15 range
+ * Arguments     : s4_value - Value
+ * Return Value  : Saturated value
+ **********************************************************************************************************************/
+static inline int16_t motor_current_fixed_sat (int32_t s4_value)
+{
+    if (s4_value > MOTOR_CURRENT_FIX_MAX)
+    {
+        s4_value = MOTOR_CURRENT_FIX_MAX;
+    }
+    else if (s4_value < -MOTOR_CURRENT_FIX_MAX)
+    {
+        s4_value = -MOTOR_CURRENT_FIX_MAX;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+
+    return (int16_t) s4_value;
+}                                      /* End of function motor_current_fixed_sat */
+
+/***********************************************************************************************************************
+ * Function Name : motor_current_fixed_from_float
+ * Description   : Converts a physical value to Q15 per-unit
+ * Arguments     : f4_value - Physical value
+ *                 f4_to_pu - 32768 / base value
+ * Return Value  : Saturated Q15 value
+ **********************************************************************************************************************/
+static inline int16_t motor_current_fixed_from_float (float f4_value, float f4_to_pu)
+{
+    return motor_current_fixed_sat((int32_t) (f4_value * f4_to_pu));
+}                                      /* End of function motor_current_fixed_from_float */
+
+/***********************************************************************************************************************
+ * Function Name : motor_current_fixed_shift
+ * Description   : Arithmetic shift with saturation to the Q30 range
+ * Arguments     : s4_value - Value (within the Q30 range)
+ *                 s4_shift - Left shift count, right shift when negative
+ * Return Value  : Shifted value
+ **********************************************************************************************************************/
+static inline int32_t motor_current_fixed_shift (int32_t s4_value, int32_t s4_shift)
+{
+    int32_t s4_limit;
+
+    if (s4_shift >= 0)
+    {
+        s4_limit = MOTOR_CURRENT_FIX_Q30_MAX >> s4_shift;
+        if (s4_value > s4_limit)
+        {
+            s4_value = MOTOR_CURRENT_FIX_Q30_MAX;
+        }
+        else if (s4_value < -s4_limit)
+        {
+            s4_value = -MOTOR_CURRENT_FIX_Q30_MAX;
+        }
+        else
+        {
+            s4_value = s4_value * (int32_t) (1L << s4_shift);
+        }
+    }
+    else
+    {
+        s4_value = (s4_shift < -30) ? 0 : (s4_value >> (-s4_shift));
+    }
+
+    return s4_value;
+}                                      /* End of function motor_current_fixed_shift */
+
+/***********************************************************************************************************************
+ * Function Name : motor_current_fixed_mul
+ * Description   : Multiplies a Q15 value by a fixed-point gain
+ * Arguments     : s2_value - Q15 value
+ *                 gain     - Gain
+ * Return Value  : Q15 result (not saturated to the Q15 range)
+ **********************************************************************************************************************/
+static inline int32_t motor_current_fixed_mul (int16_t s2_value, motor_current_fixed_gain_t gain)
+{
+    return motor_current_fixed_shift((int32_t) s2_value * gain.s2_mant, gain.s1_exp - MOTOR_CURRENT_FIX_Q30_SHIFT);
+}                                      /* End of function motor_current_fixed_mul */
+
+/***********************************************************************************************************************
+ * Function Name : motor_current_fixed_pi
+ * Description   : Fixed-point PI control
+ * Arguments     : p_fixed   - The pointer to the fixed-point state
+ *                 s4_err    - Error (Q15)
+ *                 p_s4_refi - The pointer to the integral term (Q30)
+ * Return Value  : PI control output value (Q15, not saturated)
+ **********************************************************************************************************************/
+static int32_t motor_current_fixed_pi (motor_current_fixed_t const * p_fixed, int32_t s4_err, int32_t * p_s4_refi)
+{
+    int16_t s2_err = motor_current_fixed_sat(s4_err);
+    int32_t s4_refi;
+
+    /* Integral part with limit */
+    s4_refi = *p_s4_refi + motor_current_fixed_shift((int32_t) s2_err * p_fixed->ki.s2_mant, p_fixed->ki.s1_exp);
+    if (s4_refi > p_fixed->s4_ilimit)
+    {
+        s4_refi = p_fixed->s4_ilimit;
+    }
+    else if (s4_refi < -p_fixed->s4_ilimit)
+    {
+        s4_refi = -p_fixed->s4_ilimit;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+
+    *p_s4_refi = s4_refi;
+
+    /* Proportional part + integral part */
+    return motor_current_fixed_mul(s2_err, p_fixed->kp) + (s4_refi >> MOTOR_CURRENT_FIX_Q30_SHIFT);
+}                                      /* End of function motor_current_fixed_pi */
+
+/***********************************************************************************************************************
+ * Function Name : motor_current_fixed_sqrt
+ * Description   : Integer square root
+ * Arguments     : u4_value - Value
+ * Return Value  : floor(sqrt(u4_value))
+ **********************************************************************************************************************/
+static uint32_t motor_current_fixed_sqrt (uint32_t u4_value)
+{
+    uint32_t u4_root = 0U;
+    uint32_t u4_bit  = 1UL << 30;
+
+    while (u4_bit > u4_value)
+    {
+        u4_bit >>= 2;
+    }
+
+    while (0U != u4_bit)
+    {
+        if (u4_value >= (u4_root + u4_bit))
+        {
+            u4_value -= u4_root + u4_bit;
+            u4_root   = (u4_root >> 1) + u4_bit;
+        }
+        else
+        {
+            u4_root >>= 1;
+        }
+
+        u4_bit >>= 2;
+    }
+
+    return u4_root;
+}                                      /* End of function motor_current_fixed_sqrt */
+
+/***********************************************************************************************************************
+ * Function Name : motor_current_fixed_sin
+ * Description   : Sine by quarter-wave table with linear interpolation (error below 1 LSB of Q15)
+ * Arguments     : u2_angle - Angle (0x10000 = 2pi)
+ * Return Value  : Sine in Q15
+ **********************************************************************************************************************/
+static int16_t motor_current_fixed_sin (uint16_t u2_angle)
+{
+    uint32_t u4_x = u2_angle & (MOTOR_CURRENT_FIX_QUARTER - 1U);
+    uint32_t u4_index;
+    int32_t  s4_sin;
+
+    /* Mirror the second and fourth quadrants onto the first */
+    if (0U != (u2_angle & MOTOR_CURRENT_FIX_QUARTER))
+    {
+        u4_x = MOTOR_CURRENT_FIX_QUARTER - u4_x;
+    }
+
+    u4_index = u4_x >> MOTOR_CURRENT_FIX_SIN_SHIFT;
+    s4_sin   = g_motor_current_sin_table[u4_index];
+    if (u4_index < MOTOR_CURRENT_FIX_SIN_STEPS)
+    {
+        s4_sin += ((g_motor_current_sin_table[u4_index + 1U] - s4_sin) *
+                   (int32_t) (u4_x & ((1U << MOTOR_CURRENT_FIX_SIN_SHIFT) - 1U))) >> MOTOR_CURRENT_FIX_SIN_SHIFT;
+    }
+
+    /* The third and fourth quadrants are negative */
+    return (int16_t) ((0U != (u2_angle & MOTOR_CURRENT_FIX_HALF)) ? -s4_sin : s4_sin);
+}                                      /* End of function motor_current_fixed_sin */
+
+/***********************************************************************************************************************
+ * Function Name : motor_current_fixed_angle
+ * Description   : Converts a rotor angle to the 16-bit angle format
+ * Arguments     : f4_angle - Rotor angle [rad]
+ * Return Value  : Angle (0x10000 = 2pi)
+ **********************************************************************************************************************/
+static inline uint16_t motor_current_fixed_angle (float f4_angle)
+{
+    return (uint16_t) (int32_t) (f4_angle * MOTOR_CURRENT_FIX_ANGLE_SCALE);
+}                                      /* End of function motor_current_fixed_angle */
+
+/***********************************************************************************************************************
+ * Function Name : motor_current_fixed_uvw_dq
+ * Description   : Coordinate transform UVW to dq (absolute transform) in Q15
+ * Arguments     : u2_angle - Rotor angle (0x10000 = 2pi)
+ *                 p_s2_uvw - The pointer to the UVW-phase array in [U,V,W] format
+ *                 p_s2_dq  - Where to store the [d,q] formated array on dq coordinates
+ * Return Value  : None
+ **********************************************************************************************************************/
+static void motor_current_fixed_uvw_dq (uint16_t u2_angle, const int16_t * p_s2_uvw, int16_t * p_s2_dq)
+{
+    int32_t s4_sin = motor_current_fixed_sin(u2_angle);
+    int32_t s4_cos = motor_current_fixed_sin((uint16_t) (u2_angle + MOTOR_CURRENT_FIX_QUARTER));
+
+    /* sqrt(3/2) * U and (V - W) / sqrt(2) */
+    int32_t s4_u       = ((int32_t) p_s2_uvw[0] * MOTOR_CURRENT_FIX_SQRT_3_2_Q14) >> 14;
+    int32_t s4_v_sub_w = (((int32_t) p_s2_uvw[1] - p_s2_uvw[2]) * MOTOR_CURRENT_FIX_1_SQRT_2) >> 15;
+
+    p_s2_dq[0] = motor_current_fixed_sat(((s4_cos * s4_u) >> 15) + ((s4_sin * s4_v_sub_w) >> 15));
+    p_s2_dq[1] = motor_current_fixed_sat(((s4_cos * s4_v_sub_w) >> 15) - ((s4_sin * s4_u) >> 15));
+}                                      /* End of function motor_current_fixed_uvw_dq */
+
+/***********************************************************************************************************************
+ * Function Name : motor_current_fixed_dq_uvw
+ * Description   : Coordinate transform dq to UVW 3-phase (absolute transform) in Q15
+ * Arguments     : u2_angle - Rotor angle (0x10000 = 2pi)
+ *                 p_s2_dq  - The pointer to the dq-axis value array in [D,Q] format
+ *                 p_s2_uvw - Where to store the [U,V,W] formated 3-phase quantities array
+ * Return Value  : None
+ **********************************************************************************************************************/
+static void motor_current_fixed_dq_uvw (uint16_t u2_angle, const int16_t * p_s2_dq, int16_t * p_s2_uvw)
+{
+    int32_t s4_sin = motor_current_fixed_sin(u2_angle);
+    int32_t s4_cos = motor_current_fixed_sin((uint16_t) (u2_angle + MOTOR_CURRENT_FIX_QUARTER));
+
+    /* Alpha/beta components */
+    int32_t s4_alpha = ((s4_cos * p_s2_dq[0]) >> 15) - ((s4_sin * p_s2_dq[1]) >> 15);
+    int32_t s4_beta  = ((s4_sin * p_s2_dq[0]) >> 15) + ((s4_cos * p_s2_dq[1]) >> 15);
+
+    /* U = sqrt(2/3) * alpha, V/W = -alpha / sqrt(6) +/- beta / sqrt(2) */
+    int32_t s4_alpha_vw = (s4_alpha * MOTOR_CURRENT_FIX_1_SQRT_6) >> 15;
+    int32_t s4_beta_vw  = (s4_beta * MOTOR_CURRENT_FIX_1_SQRT_2) >> 15;
+
+    p_s2_uvw[0] = motor_current_fixed_sat((s4_alpha * MOTOR_CURRENT_FIX_SQRT_2_3) >> 15);
+    p_s2_uvw[1] = motor_current_fixed_sat(s4_beta_vw - s4_alpha_vw);
+    p_s2_uvw[2] = motor_current_fixed_sat(-s4_beta_vw - s4_alpha_vw);
+}                                      /* End of function motor_current_fixed_dq_uvw */
+
+/***********************************************************************************************************************
+ * Function Name : motor_current_fixed_current
+ * Description   : Calculates the d/q-axis current from the phase currents in fixed point
+ * Arguments     : p_ctrl - The pointer to the FOC current control instance
+ * Return Value  : None
+ **********************************************************************************************************************/
+static void motor_current_fixed_current (motor_current_instance_ctrl_t * p_ctrl)
+{
+    motor_current_fixed_t * p_fixed = &(p_ctrl->st_fixed);
+    int16_t                 s2_uvw[3];
+    int16_t                 s2_dq[2];
+
+    s2_uvw[0] = motor_current_fixed_from_float(p_ctrl->f_iu_ad, p_fixed->f_i_to_pu);
+    s2_uvw[1] = motor_current_fixed_from_float(p_ctrl->f_iv_ad, p_fixed->f_i_to_pu);
+    s2_uvw[2] = motor_current_fixed_from_float(p_ctrl->f_iw_ad, p_fixed->f_i_to_pu);
+
+    motor_current_fixed_uvw_dq(motor_current_fixed_angle(p_ctrl->f_rotor_angle), &(s2_uvw[0]), &(s2_dq[0]));
+
+    p_fixed->s2_id  = s2_dq[0];
+    p_fixed->s2_iq  = s2_dq[1];
+    p_ctrl->f_id_ad = (float) s2_dq[0] * p_fixed->f_pu_to_i;
+    p_ctrl->f_iq_ad = (float) s2_dq[1] * p_fixed->f_pu_to_i;
+}                                      /* End of function motor_current_fixed_current */
+
+/***********************************************************************************************************************
+ * Function Name : motor_current_fixed_voltage
+ * Description   : Current PI control, decoupling control, voltage limit and dq->UVW transform in fixed point
+ * Arguments     : p_ctrl        - The pointer to the FOC current control instance
+ *                 p_f4_iuvw_ref - Where to store the UVW current reference (for voltage error compensation)
+ * Return Value  : None
+ **********************************************************************************************************************/
+static void motor_current_fixed_voltage (motor_current_instance_ctrl_t * p_ctrl, float * p_f4_iuvw_ref)
+{
+    motor_current_fixed_t * p_fixed = &(p_ctrl->st_fixed);
+    uint16_t                u2_angle = motor_current_fixed_angle(p_ctrl->f_rotor_angle);
+    int16_t                 s2_speed = motor_current_fixed_from_float(p_ctrl->f_speed_rad, p_fixed->f_w_to_pu);
+    int16_t                 s2_va_max = motor_current_fixed_from_float(p_ctrl->f_va_max, p_fixed->f_v_to_pu);
+    int16_t                 s2_idq_ref[2];
+    int16_t                 s2_vdq[2];
+    int16_t                 s2_uvw[3];
+    int32_t                 s4_vd;
+    int32_t                 s4_vq;
+
+    s2_idq_ref[0] = motor_current_fixed_from_float(p_ctrl->f_id_ref, p_fixed->f_i_to_pu);
+    s2_idq_ref[1] = motor_current_fixed_from_float(p_ctrl->f_iq_ref, p_fixed->f_i_to_pu);
+
+    /* Current PI control */
+    s4_vd = motor_current_fixed_pi(p_fixed, (int32_t) s2_idq_ref[0] - p_fixed->s2_id, &(p_fixed->s4_refi_d));
+    s4_vq = motor_current_fixed_pi(p_fixed, (int32_t) s2_idq_ref[1] - p_fixed->s2_iq, &(p_fixed->s4_refi_q));
+
+    /* Decoupling control: Vd - Speed * Lq * Iq, Vq + Speed * (Ld * Id + Flux) */
+    s4_vd -= motor_current_fixed_mul((int16_t) (((int32_t) s2_speed * p_fixed->s2_iq) >> 15), p_fixed->lq);
+    s4_vq += motor_current_fixed_mul((int16_t) (((int32_t) s2_speed * p_fixed->s2_id) >> 15), p_fixed->ld);
+    s4_vq += motor_current_fixed_mul(s2_speed, p_fixed->m);
+
+    /* Limit voltage vector, d-axis voltage has higher priority than q-axis voltage */
+    if (s4_vd > s2_va_max)
+    {
+        s4_vd = s2_va_max;
+        s4_vq = 0;
+    }
+    else if (s4_vd < -s2_va_max)
+    {
+        s4_vd = -s2_va_max;
+        s4_vq = 0;
+    }
+    else
+    {
+        int32_t s4_vq_lim = (int32_t) motor_current_fixed_sqrt((uint32_t) ((s2_va_max * s2_va_max) - (s4_vd * s4_vd)));
+        if (s4_vq > s4_vq_lim)
+        {
+            s4_vq = s4_vq_lim;
+        }
+        else if (s4_vq < -s4_vq_lim)
+        {
+            s4_vq = -s4_vq_lim;
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+
+    s2_vdq[0]        = motor_current_fixed_sat(s4_vd);
+    s2_vdq[1]        = motor_current_fixed_sat(s4_vq);
+    p_ctrl->f_vd_ref = (float) s2_vdq[0] * p_fixed->f_pu_to_v;
+    p_ctrl->f_vq_ref = (float) s2_vdq[1] * p_fixed->f_pu_to_v;
+
+    /* Coordinate transformation (dq->uvw) */
+    motor_current_fixed_dq_uvw(u2_angle, &(s2_vdq[0]), &(s2_uvw[0]));
+    p_ctrl->f_refu = (float) s2_uvw[0] * p_fixed->f_pu_to_v;
+    p_ctrl->f_refv = (float) s2_uvw[1] * p_fixed->f_pu_to_v;
+    p_ctrl->f_refw = (float) s2_uvw[2] * p_fixed->f_pu_to_v;
+
+    /* The UVW current reference is only needed by the voltage error compensation */
+    if (MOTOR_CURRENT_VOLTAGE_COMPENSATION_SELECT_ENABLE == p_ctrl->st_vcomp.u1_volt_err_comp_enable)
+    {
+        motor_current_fixed_dq_uvw(u2_angle, &(s2_idq_ref[0]), &(s2_uvw[0]));
+        p_f4_iuvw_ref[0] = (float) s2_uvw[0] * p_fixed->f_pu_to_i;
+        p_f4_iuvw_ref[1] = (float) s2_uvw[1] * p_fixed->f_pu_to_i;
+        p_f4_iuvw_ref[2] = (float) s2_uvw[2] * p_fixed->f_pu_to_i;
+    }
+}                                      /* End of function motor_current_fixed_voltage */
+
+#endif
@@ -24,6 +24,7 @@
 #include <math.h>
 #include <stdint.h>
 #include "rm_motor_driver.h"
+#include "r_dmac.h"
 #include "bsp_api.h"
 #include "bsp_cfg.h"
 
@@ -56,6 +57,36 @@
  #define MOTOR_DRIVER_METHOD                 (MOTOR_DRIVER_METHOD_SVPWM)
 #endif
 
+/* Fixed point (Q15 duty) modulation for devices without FPU */
+#ifndef MOTOR_DRIVER_CFG_FIXED_POINT_ENABLE
+ #define MOTOR_DRIVER_CFG_FIXED_POINT_ENABLE (0)
+#endif
+
+#define MOTOR_DRIVER_FIX_ONE                 (32768.0F) /* 1.0 in Q15 */
+#define MOTOR_DRIVER_FIX_MAX                 (32767L)   /* Maximum value of Q15 */
+#define MOTOR_DRIVER_FIX_LIMIT               (65536.0F) /* Input limit before conversion to integer */
+#define MOTOR_DRIVER_FIX_SHIFT               (15)
+
+/* Execute the current control cycle (ADC scan end to PWM duty update) from RAM */
+#ifndef MOTOR_DRIVER_CFG_RAMFUNC_ENABLE
+ #define MOTOR_DRIVER_CFG_RAMFUNC_ENABLE     (0)
+#endif
+
+#if MOTOR_DRIVER_CFG_RAMFUNC_ENABLE
+ #define MOTOR_DRIVER_PRV_RAMFUNC            BSP_PLACE_IN_RAM
+#else
+ #define MOTOR_DRIVER_PRV_RAMFUNC
+#endif
+
+/* Measure the CPU cycles of each cyclic process with the DWT cycle counter */
+#ifndef MOTOR_DRIVER_CFG_BENCHMARK_ENABLE
+ #define MOTOR_DRIVER_CFG_BENCHMARK_ENABLE   (0)
+#endif
+
+#if MOTOR_DRIVER_CFG_BENCHMARK_ENABLE && !BSP_FEATURE_DWT_CYCCNT
+ #error "MOTOR_DRIVER_CFG_BENCHMARK_ENABLE requires the DWT cycle counter, which is not available on this MCU."
+#endif
+
 /*
  * Vamax in this module is calculated by the following equation
  *   SVPWM :  Vdc * (MOD_VDC_TO_VAMAX_MULT) * (Max duty - Min duty) * (MOD_SVPWM_MULT)
@@ -76,22 +107,44 @@
 /***********************************************************************************************************************
  * Private function prototypes
  **********************************************************************************************************************/
-void rm_motor_driver_cyclic(adc_callback_args_t * p_args);
+void rm_motor_driver_cyclic(adc_callback_args_t * p_args) MOTOR_DRIVER_PRV_RAMFUNC;
+void rm_motor_driver_buffer_ready(dmac_callback_args_t * p_args) MOTOR_DRIVER_PRV_RAMFUNC;
+
+static void rm_motor_driver_cyclic_process(motor_driver_instance_ctrl_t * p_ctrl) MOTOR_DRIVER_PRV_RAMFUNC;
+static void rm_motor_driver_adc_transfer_open(motor_driver_instance_ctrl_t * p_ctrl);
+static void rm_motor_driver_buffer_swap(motor_driver_instance_ctrl_t * p_ctrl) MOTOR_DRIVER_PRV_RAMFUNC;
 
 static void rm_motor_driver_reset(motor_driver_instance_ctrl_t * p_ctrl);
 static void rm_motor_driver_set_uvw_duty(motor_driver_instance_ctrl_t * p_ctrl,
                                          float                          f_duty_u,
                                          float                          f_duty_v,
-                                         float                          f_duty_w);
-static void rm_motor_driver_current_get(motor_driver_instance_ctrl_t * p_ctrl);
-static void rm_motor_driver_modulation(motor_driver_instance_ctrl_t * p_ctrl);
+                                         float                          f_duty_w) MOTOR_DRIVER_PRV_RAMFUNC;
+static void rm_motor_driver_current_get(motor_driver_instance_ctrl_t * p_ctrl) MOTOR_DRIVER_PRV_RAMFUNC;
+static void rm_motor_driver_modulation(motor_driver_instance_ctrl_t * p_ctrl) MOTOR_DRIVER_PRV_RAMFUNC;
 
 /* Modulation functions */
-static void  rm_motor_driver_mod_run(motor_driver_modulation_t * p_mod, const float * p_f4_v_in, float * p_f4_duty_out);
+#if (0 == MOTOR_DRIVER_CFG_FIXED_POINT_ENABLE)
+static void rm_motor_driver_mod_run(motor_driver_modulation_t * p_mod,
+                                    const float               * p_f4_v_in,
+                                    float                     * p_f4_duty_out) MOTOR_DRIVER_PRV_RAMFUNC;
+static void rm_motor_driver_mod_svpwm(const float * p_f4_v_in, float * p_f4_v_out) MOTOR_DRIVER_PRV_RAMFUNC;
+static void rm_motor_driver_mod_svpwm_branchless(const float * p_f4_v_in, float * p_f4_v_out) MOTOR_DRIVER_PRV_RAMFUNC;
+
+#endif
 static void  rm_motor_driver_mod_set_max_duty(motor_driver_modulation_t * p_mod, float f4_max_duty);
 static void  rm_motor_driver_mod_set_min_duty(motor_driver_modulation_t * p_mod, float f4_min_duty);
 static float rm_motor_driver_mod_get_vamax(motor_driver_modulation_t * p_mod);
 
+#if MOTOR_DRIVER_CFG_FIXED_POINT_ENABLE
+static void rm_motor_driver_mod_fixed_update(motor_driver_modulation_t * p_mod);
+static void rm_motor_driver_mod_run_fixed(motor_driver_modulation_t * p_mod,
+                                          const int32_t             * p_s4_v_in,
+                                          int16_t                   * p_s2_duty_out) MOTOR_DRIVER_PRV_RAMFUNC;
+static void rm_motor_driver_set_uvw_duty_fixed(motor_driver_instance_ctrl_t * p_ctrl,
+                                               const int16_t                * p_s2_duty) MOTOR_DRIVER_PRV_RAMFUNC;
+
+#endif
+
 /***********************************************************************************************************************
  * Private global variables
  **********************************************************************************************************************/
@@ -154,8 +207,23 @@ fsp_err_t RM_MOTOR_DRIVER_Open (motor_driver_ctrl_t * const p_ctrl, motor_driver
 
     FSP_ERROR_RETURN(MOTOR_DRIVER_OPEN != p_instance_ctrl->open, FSP_ERR_ALREADY_OPEN);
 
+#if MOTOR_DRIVER_CFG_PARAM_CHECKING_ENABLE
+    if (NULL != p_extended_cfg->p_adc_transfer)
+    {
+        FSP_ASSERT(NULL != p_cfg->p_adc_instance);
+        FSP_ASSERT(p_cfg->iu_ad_ch >= p_extended_cfg->adc_transfer_first_ch);
+        FSP_ASSERT(p_cfg->iw_ad_ch >= p_extended_cfg->adc_transfer_first_ch);
+        FSP_ASSERT(p_cfg->vdc_ad_ch >= p_extended_cfg->adc_transfer_first_ch);
+    }
+#endif
+
     p_instance_ctrl->p_cfg = p_cfg;
 
+    R_BSP_LatencyStatsClear(&p_instance_ctrl->st_cycles);
+#if MOTOR_DRIVER_CFG_BENCHMARK_ENABLE
+    R_BSP_CycleCounterStart();
+#endif
+
     p_instance_ctrl->u2_carrier_base =
         (uint16_t) (p_extended_cfg->u2_pwm_timer_freq * MOTOR_DRIVER_KHZ_TRANS /
                     p_extended_cfg->u2_pwm_carrier_freq / (uint16_t) MOTOR_DRIVER_MULTIPLE_2);
@@ -177,6 +245,11 @@ fsp_err_t RM_MOTOR_DRIVER_Open (motor_driver_ctrl_t * const p_ctrl, motor_driver
                                                   rm_motor_driver_cyclic,
                                                   p_instance_ctrl,
                                                   &(p_instance_ctrl->adc_callback_args));
+        if (NULL != p_extended_cfg->p_adc_transfer)
+        {
+            rm_motor_driver_adc_transfer_open(p_instance_ctrl);
+        }
+
         p_cfg->p_adc_instance->p_api->scanStart(p_cfg->p_adc_instance->p_ctrl);
     }
 
@@ -214,7 +287,8 @@ fsp_err_t RM_MOTOR_DRIVER_Close (motor_driver_ctrl_t * const p_ctrl)
     MOTOR_DRIVER_ERROR_RETURN(MOTOR_DRIVER_OPEN == p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
 #endif
 
-    motor_driver_cfg_t * p_cfg = (motor_driver_cfg_t *) p_instance_ctrl->p_cfg;
+    motor_driver_cfg_t          * p_cfg          = (motor_driver_cfg_t *) p_instance_ctrl->p_cfg;
+    motor_driver_extended_cfg_t * p_extended_cfg = (motor_driver_extended_cfg_t *) p_cfg->p_extend;
 
     rm_motor_driver_reset(p_instance_ctrl);
 
@@ -224,6 +298,12 @@ fsp_err_t RM_MOTOR_DRIVER_Close (motor_driver_ctrl_t * const p_ctrl)
         p_cfg->p_adc_instance->p_api->close(p_cfg->p_adc_instance->p_ctrl);
     }
 
+    /* Close A/D result transfer */
+    if (p_extended_cfg->p_adc_transfer != NULL)
+    {
+        p_extended_cfg->p_adc_transfer->p_api->close(p_extended_cfg->p_adc_transfer->p_ctrl);
+    }
+
     /* Close GPT Three Phase Module */
     if (p_cfg->p_three_phase_instance != NULL)
     {
@@ -533,12 +613,25 @@ static void rm_motor_driver_current_get (motor_driver_instance_ctrl_t * p_ctrl)
     motor_driver_extended_cfg_t * p_extend_cfg = (motor_driver_extended_cfg_t *) p_cfg->p_extend;
 
     /* Read A/D converted data */
-    if (p_cfg->p_adc_instance != NULL)
+    if (p_extend_cfg->p_adc_transfer != NULL)
+    {
+        /* Already transferred to the buffer by DTC/DMAC */
+        uint16_t const * p_u2_buffer = &(p_ctrl->u2_adc_buffer[p_ctrl->u1_adc_buffer_ready][0]);
+
+        u2_addata[0] = p_u2_buffer[p_ctrl->u1_iu_index];
+        u2_addata[1] = p_u2_buffer[p_ctrl->u1_iw_index];
+        u2_addata[2] = p_u2_buffer[p_ctrl->u1_vdc_index];
+    }
+    else if (p_cfg->p_adc_instance != NULL)
     {
         p_cfg->p_adc_instance->p_api->read(p_cfg->p_adc_instance->p_ctrl, p_cfg->iu_ad_ch, &u2_addata[0]);
         p_cfg->p_adc_instance->p_api->read(p_cfg->p_adc_instance->p_ctrl, p_cfg->iw_ad_ch, &u2_addata[1]);
         p_cfg->p_adc_instance->p_api->read(p_cfg->p_adc_instance->p_ctrl, p_cfg->vdc_ad_ch, &u2_addata[2]);
     }
+    else
+    {
+        /* Do nothing */
+    }
 
     f_addata[0] = (float) u2_addata[0];
     f_addata[1] = (float) u2_addata[1];
@@ -552,6 +645,100 @@ static void rm_motor_driver_current_get (motor_driver_instance_ctrl_t * p_ctrl)
                        p_extend_cfg->f_ad_voltage_conversion;
 }                                      /* End of function rm_motor_driver_current_get */
 
+/***********************************************************************************************************************
+ * Function Name : rm_motor_driver_adc_transfer_open
+ * Description   : Opens the transfer of the A/D result registers into the ping-pong buffer
+ * Arguments     : p_ctrl - The pointer to the motor driver module instance
+ * Return Value  : None
+ **********************************************************************************************************************/
+static void rm_motor_driver_adc_transfer_open (motor_driver_instance_ctrl_t * p_ctrl)
+{
+    motor_driver_cfg_t const    * p_cfg        = p_ctrl->p_cfg;
+    motor_driver_extended_cfg_t * p_extend_cfg = (motor_driver_extended_cfg_t *) p_cfg->p_extend;
+    transfer_instance_t const   * p_transfer   = p_extend_cfg->p_adc_transfer;
+    transfer_info_t             * p_info       = &(p_ctrl->adc_transfer_info);
+    adc_info_t adc_info;
+
+    p_ctrl->u1_iu_index  = (uint8_t) (p_cfg->iu_ad_ch - p_extend_cfg->adc_transfer_first_ch);
+    p_ctrl->u1_iw_index  = (uint8_t) (p_cfg->iw_ad_ch - p_extend_cfg->adc_transfer_first_ch);
+    p_ctrl->u1_vdc_index = (uint8_t) (p_cfg->vdc_ad_ch - p_extend_cfg->adc_transfer_first_ch);
+
+    /* All result registers of the scan are moved as one block, the source is rewound after each block */
+    p_cfg->p_adc_instance->p_api->infoGet(p_cfg->p_adc_instance->p_ctrl, &adc_info);
+    if (adc_info.length > MOTOR_DRIVER_ADC_BUFFER_MAX)
+    {
+        adc_info.length = MOTOR_DRIVER_ADC_BUFFER_MAX;
+    }
+
+    *p_info                = *(p_transfer->p_cfg->p_info);
+    p_info->mode           = TRANSFER_MODE_BLOCK;
+    p_info->size           = TRANSFER_SIZE_2_BYTE;
+    p_info->src_addr_mode  = TRANSFER_ADDR_MODE_INCREMENTED;
+    p_info->dest_addr_mode = TRANSFER_ADDR_MODE_INCREMENTED;
+    p_info->repeat_area    = TRANSFER_REPEAT_AREA_SOURCE;
+    p_info->irq            = TRANSFER_IRQ_END;
+    p_info->chain_mode     = TRANSFER_CHAIN_MODE_DISABLED;
+    p_info->p_src          = (void const *) adc_info.p_address;
+    p_info->p_dest         = &(p_ctrl->u2_adc_buffer[0][0]);
+    p_info->num_blocks     = 1U;
+    p_info->length         = (uint16_t) adc_info.length;
+
+    /* The first transfer fills buffer 0 */
+    p_ctrl->u1_adc_buffer_ready = 1U;
+
+    p_transfer->p_api->open(p_transfer->p_ctrl, p_transfer->p_cfg);
+    p_transfer->p_api->reconfigure(p_transfer->p_ctrl, p_info);
+}                                      /* End of function rm_motor_driver_adc_transfer_open */
+
+/***********************************************************************************************************************
+ * Function Name : rm_motor_driver_buffer_swap
+ * Description   : Selects the buffer filled by the last transfer and rearms the transfer into the other buffer
+ * Arguments     : p_ctrl - The pointer to the motor driver module instance
+ * Return Value  : None
+ **********************************************************************************************************************/
+static void rm_motor_driver_buffer_swap (motor_driver_instance_ctrl_t * p_ctrl)
+{
+    transfer_instance_t const * p_transfer =
+        ((motor_driver_extended_cfg_t *) p_ctrl->p_cfg->p_extend)->p_adc_transfer;
+    uint8_t u1_ready = p_ctrl->u1_adc_buffer_ready ^ 1U;
+
+    p_ctrl->u1_adc_buffer_ready = u1_ready;
+
+    /* The next scan is transferred while the current one is processed */
+    p_transfer->p_api->reset(p_transfer->p_ctrl,
+                             p_ctrl->adc_transfer_info.p_src,
+                             &(p_ctrl->u2_adc_buffer[u1_ready ^ 1U][0]),
+                             1U);
+}                                      /* End of function rm_motor_driver_buffer_swap */
+
+#if MOTOR_DRIVER_CFG_FIXED_POINT_ENABLE
+
+/***********************************************************************************************************************
+ * Function Name : rm_motor_driver_fixed_from_float
+ * Description   : Converts a normalized value to integer with limit
+ * Arguments     : f4_value - Normalized value (1.0 = 32768)
+ * Return Value  : Integer value
+ **********************************************************************************************************************/
+static inline int32_t rm_motor_driver_fixed_from_float (float f4_value)
+{
+    if (f4_value > MOTOR_DRIVER_FIX_LIMIT)
+    {
+        f4_value = MOTOR_DRIVER_FIX_LIMIT;
+    }
+    else if (f4_value < -MOTOR_DRIVER_FIX_LIMIT)
+    {
+        f4_value = -MOTOR_DRIVER_FIX_LIMIT;
+    }
+    else
+    {
+        /* Do nothing */
+    }
+
+    return (int32_t) f4_value;
+}                                      /* End of function rm_motor_driver_fixed_from_float */
+
+#endif
+
 /***********************************************************************************************************************
  * Function Name : rm_motor_driver_modulation
  * Description   : Perform PWM modulation
@@ -560,11 +747,30 @@ static void rm_motor_driver_current_get (motor_driver_instance_ctrl_t * p_ctrl)
  **********************************************************************************************************************/
 static void rm_motor_driver_modulation (motor_driver_instance_ctrl_t * p_ctrl)
 {
+#if MOTOR_DRIVER_CFG_FIXED_POINT_ENABLE
+    int32_t s4_v_in[3];
+    int16_t s2_duty[3];
+    float   f4_to_pu;
+#else
     float f_v_in[3]    = {0.0F};
     float f_mod_out[3] = {0.0F};
+#endif
 
     p_ctrl->st_modulation.f4_vdc       = p_ctrl->f_vdc_ad;
     p_ctrl->st_modulation.f4_1_div_vdc = 1.0F / p_ctrl->f_vdc_ad;
+
+#if MOTOR_DRIVER_CFG_FIXED_POINT_ENABLE
+
+    /* Normalize the voltage references by Vdc into Q15 duty (the only floating point operations) */
+    f4_to_pu   = MOTOR_DRIVER_FIX_ONE * p_ctrl->st_modulation.f4_1_div_vdc;
+    s4_v_in[0] = rm_motor_driver_fixed_from_float(p_ctrl->f_refu * f4_to_pu);
+    s4_v_in[1] = rm_motor_driver_fixed_from_float(p_ctrl->f_refv * f4_to_pu);
+    s4_v_in[2] = rm_motor_driver_fixed_from_float(p_ctrl->f_refw * f4_to_pu);
+
+    rm_motor_driver_mod_run_fixed(&(p_ctrl->st_modulation), &(s4_v_in[0]), &(s2_duty[0]));
+
+    rm_motor_driver_set_uvw_duty_fixed(p_ctrl, &(s2_duty[0]));
+#else
     f_v_in[0] = p_ctrl->f_refu;
     f_v_in[1] = p_ctrl->f_refv;
     f_v_in[2] = p_ctrl->f_refw;
@@ -572,8 +778,11 @@ static void rm_motor_driver_modulation (motor_driver_instance_ctrl_t * p_ctrl)
     rm_motor_driver_mod_run(&(p_ctrl->st_modulation), &(f_v_in[0]), &(f_mod_out[0]));
 
     rm_motor_driver_set_uvw_duty(p_ctrl, f_mod_out[0], f_mod_out[1], f_mod_out[2]);
+#endif
 }                                      /* End of function rm_motor_driver_modulation */
 
+#if (0 == MOTOR_DRIVER_CFG_FIXED_POINT_ENABLE)
+
 /***********************************************************************************************************************
  * Function Name: rm_motor_driver_mod_svpwm
  * Description  : Space vector modulation
@@ -620,6 +829,33 @@ static void rm_motor_driver_mod_svpwm (const float * p_f4_v_in, float * p_f4_v_o
     p_f4_v_out[2] = p_f4_v_in[2] - f4_v_com;
 }                                      /* End of function rm_motor_driver_mod_svpwm() */
 
+/***********************************************************************************************************************
+ * Function Name: rm_motor_driver_mod_svpwm_branchless
+ * Description  : Space vector modulation, using max(a,b) = (a + b + |a - b|)/2 and min(a,b) = (a + b - |a - b|)/2
+ *                so that the common mode calculation has no data dependent branches
+ * Arguments    : p_f4_v_in -
+ *                    Input data, in an array [Vu,Vv,Vw]
+ *                p_f4_v_out -
+ *                    Where to store output data, in an array [Vu,Vv,Vw]
+ * Return Value : None
+ ***********************************************************************************************************************/
+static void rm_motor_driver_mod_svpwm_branchless (const float * p_f4_v_in, float * p_f4_v_out)
+{
+    float f4_sum_uv  = p_f4_v_in[0] + p_f4_v_in[1];
+    float f4_diff_uv = fabsf(p_f4_v_in[0] - p_f4_v_in[1]);
+    float f4_max_uv  = (f4_sum_uv + f4_diff_uv) * MOTOR_DRIVER_DEF_HALF;
+    float f4_min_uv  = (f4_sum_uv - f4_diff_uv) * MOTOR_DRIVER_DEF_HALF;
+    float f4_v_max   = ((f4_max_uv + p_f4_v_in[2]) + fabsf(f4_max_uv - p_f4_v_in[2])) * MOTOR_DRIVER_DEF_HALF;
+    float f4_v_min   = ((f4_min_uv + p_f4_v_in[2]) - fabsf(f4_min_uv - p_f4_v_in[2])) * MOTOR_DRIVER_DEF_HALF;
+
+    /* Vcom = (Vmin + Vmax)/2 */
+    float f4_v_com = (f4_v_max + f4_v_min) * MOTOR_DRIVER_DEF_HALF;
+
+    p_f4_v_out[0] = p_f4_v_in[0] - f4_v_com;
+    p_f4_v_out[1] = p_f4_v_in[1] - f4_v_com;
+    p_f4_v_out[2] = p_f4_v_in[2] - f4_v_com;
+}                                      /* End of function rm_motor_driver_mod_svpwm_branchless() */
+
 /***********************************************************************************************************************
  * Function Name: rm_motor_driver_mod_limit
  * Description  : Limits the duty cycle, and detect saturation (if function enabled)
@@ -722,7 +958,14 @@ static void rm_motor_driver_mod_run (motor_driver_modulation_t * p_mod, const fl
     }
 
 #if (MOTOR_DRIVER_METHOD == MOTOR_DRIVER_METHOD_SVPWM)
-    rm_motor_driver_mod_svpwm(p_f4_v_in, f4_v_out);
+    if (MOTOR_DRIVER_SVPWM_SELECT_BRANCHLESS == p_mod->svpwm_select)
+    {
+        rm_motor_driver_mod_svpwm_branchless(p_f4_v_in, f4_v_out);
+    }
+    else
+    {
+        rm_motor_driver_mod_svpwm(p_f4_v_in, f4_v_out);
+    }
 #else
     f4_v_out[0] = p_f4_v_in[0];
     f4_v_out[1] = p_f4_v_in[1];
@@ -736,6 +979,8 @@ static void rm_motor_driver_mod_run (motor_driver_modulation_t * p_mod, const fl
     rm_motor_driver_mod_limit(p_mod, p_f4_duty_out);
 }                                      /* End of function rm_motor_driver_mod_run() */
 
+#endif
+
 /***********************************************************************************************************************
  * Function Name: rm_motor_driver_mod_set_max_duty
  * Description  : Sets the maximum duty cycle
@@ -751,6 +996,9 @@ static void rm_motor_driver_mod_set_max_duty (motor_driver_modulation_t * p_mod,
     {
         p_mod->f4_max_duty     = f4_max_duty;
         p_mod->f4_neutral_duty = (p_mod->f4_max_duty + p_mod->f4_min_duty) * MOTOR_DRIVER_DEF_HALF;
+#if MOTOR_DRIVER_CFG_FIXED_POINT_ENABLE
+        rm_motor_driver_mod_fixed_update(p_mod);
+#endif
     }
 }                                      /* End of function rm_motor_driver_mod_set_max_duty() */
 
@@ -769,6 +1017,9 @@ static void rm_motor_driver_mod_set_min_duty (motor_driver_modulation_t * p_mod,
     {
         p_mod->f4_min_duty     = f4_min_duty;
         p_mod->f4_neutral_duty = (p_mod->f4_max_duty + p_mod->f4_min_duty) * MOTOR_DRIVER_DEF_HALF;
+#if MOTOR_DRIVER_CFG_FIXED_POINT_ENABLE
+        rm_motor_driver_mod_fixed_update(p_mod);
+#endif
     }
 }                                      /* End of function rm_motor_driver_mod_set_min_duty() */
 
@@ -812,9 +1063,46 @@ static float rm_motor_driver_mod_get_vamax (motor_driver_modulation_t * p_mod)
  * Return Value  : None
  **********************************************************************************************************************/
 void rm_motor_driver_cyclic (adc_callback_args_t * p_args)
+{
+    motor_driver_instance_ctrl_t * p_instance   = (motor_driver_instance_ctrl_t *) p_args->p_context;
+    motor_driver_extended_cfg_t  * p_extend_cfg = (motor_driver_extended_cfg_t *) p_instance->p_cfg->p_extend;
+
+    /* With DTC the A/D results are already in the buffer when the scan end interrupt is forwarded to the CPU */
+    if (NULL != p_extend_cfg->p_adc_transfer)
+    {
+        rm_motor_driver_buffer_swap(p_instance);
+    }
+
+    rm_motor_driver_cyclic_process(p_instance);
+}                                      /* End of function rm_motor_driver_cyclic */
+
+/***********************************************************************************************************************
+ * Function Name : rm_motor_driver_buffer_ready
+ * Description   : Cyclic process for driver accsess (Call at DMAC transfer end interrupt of the A/D results, the
+ *                 A/D scan end interrupt must be disabled in this case)
+ * Arguments     : p_args - The pointer to arguments of transfer end intterupt callback
+ * Return Value  : None
+ **********************************************************************************************************************/
+void rm_motor_driver_buffer_ready (dmac_callback_args_t * p_args)
 {
     motor_driver_instance_ctrl_t * p_instance = (motor_driver_instance_ctrl_t *) p_args->p_context;
-    motor_driver_callback_args_t   temp_args_t;
+
+    rm_motor_driver_buffer_swap(p_instance);
+    rm_motor_driver_cyclic_process(p_instance);
+}                                      /* End of function rm_motor_driver_buffer_ready */
+
+/***********************************************************************************************************************
+ * Function Name : rm_motor_driver_cyclic_process
+ * Description   : Current control and modulation process of a carrier period
+ * Arguments     : p_instance - The pointer to the motor driver module instance
+ * Return Value  : None
+ **********************************************************************************************************************/
+static void rm_motor_driver_cyclic_process (motor_driver_instance_ctrl_t * p_instance)
+{
+    motor_driver_callback_args_t temp_args_t;
+#if MOTOR_DRIVER_CFG_BENCHMARK_ENABLE
+    uint32_t u4_start = DWT->CYCCNT;
+#endif
 
     /* Get A/D converted data (Phase Current & Main Line Voltage) */
     rm_motor_driver_current_get(p_instance);
@@ -848,4 +1136,131 @@ void rm_motor_driver_cyclic (adc_callback_args_t * p_args)
         temp_args_t.p_context = p_instance->p_cfg->p_context;
         (p_instance->p_cfg->p_callback)(&temp_args_t);
     }
-}
+
+#if MOTOR_DRIVER_CFG_BENCHMARK_ENABLE
+    R_BSP_LatencyStatsRecord(&p_instance->st_cycles, DWT->CYCCNT - u4_start);
+#endif
+}                                      /* End of function rm_motor_driver_cyclic_process */
+
+#if MOTOR_DRIVER_CFG_FIXED_POINT_ENABLE
+
+/***********************************************************************************************************************
+ * Function Name: rm_motor_driver_mod_fixed_update
+ * Description  : Updates the Q15 copies of the duty cycle limits
+ * Arguments    : p_mod -
+ *                    Pointer to the modulation data structure
+ * Return Value : None
+ ***********************************************************************************************************************/
+static void rm_motor_driver_mod_fixed_update (motor_driver_modulation_t * p_mod)
+{
+    int32_t s4_max_duty = (int32_t) (p_mod->f4_max_duty * MOTOR_DRIVER_FIX_ONE);
+    int32_t s4_min_duty = (int32_t) (p_mod->f4_min_duty * MOTOR_DRIVER_FIX_ONE);
+
+    /* 1.0 is not representable in Q15 */
+    p_mod->s2_max_duty     = (int16_t) ((s4_max_duty > MOTOR_DRIVER_FIX_MAX) ? MOTOR_DRIVER_FIX_MAX : s4_max_duty);
+    p_mod->s2_min_duty     = (int16_t) ((s4_min_duty > MOTOR_DRIVER_FIX_MAX) ? MOTOR_DRIVER_FIX_MAX : s4_min_duty);
+    p_mod->s2_neutral_duty = (int16_t) (((int32_t) p_mod->s2_max_duty + p_mod->s2_min_duty) >> 1);
+}                                      /* End of function rm_motor_driver_mod_fixed_update() */
+
+/***********************************************************************************************************************
+ * Function Name: rm_motor_driver_mod_run_fixed
+ * Description  : Calculates Q15 duty cycle from input 3-phase voltage normalized by Vdc (bipolar)
+ * Arguments    : p_mod -
+ *                    Pointer to the modulation data structure
+ *              : p_s4_v_in -
+ *                    Pointer to the 3-phase input voltage (Vdc = 32768)
+ *              : p_s2_duty_out -
+ *                    Where to store the 3-phase output duty cycle (Q15)
+ * Return Value : None
+ ***********************************************************************************************************************/
+static void rm_motor_driver_mod_run_fixed (motor_driver_modulation_t * p_mod,
+                                           const int32_t             * p_s4_v_in,
+                                           int16_t                   * p_s2_duty_out)
+{
+    int32_t  s4_v_com = 0;
+    int32_t  s4_duty;
+    uint32_t i;
+
+#if (MOTOR_DRIVER_METHOD == MOTOR_DRIVER_METHOD_SVPWM)
+    int32_t s4_v_max = p_s4_v_in[0];
+    int32_t s4_v_min = p_s4_v_in[0];
+
+    /* Vcom = (Vmin + Vmax)/2 */
+    for (i = 1U; i < 3U; i++)
+    {
+        if (p_s4_v_in[i] > s4_v_max)
+        {
+            s4_v_max = p_s4_v_in[i];
+        }
+        else if (p_s4_v_in[i] < s4_v_min)
+        {
+            s4_v_min = p_s4_v_in[i];
+        }
+        else
+        {
+            /* Do nothing */
+        }
+    }
+
+    s4_v_com = (s4_v_max + s4_v_min) >> 1;
+#endif
+
+    for (i = 0U; i < 3U; i++)
+    {
+        s4_duty = (p_s4_v_in[i] - s4_v_com) + p_mod->s2_neutral_duty;
+
+        /* Limits the duty cycle, and detect saturation (if function enabled) */
+        if (s4_duty > p_mod->s2_max_duty)
+        {
+            s4_duty = p_mod->s2_max_duty;
+#if (MOD_DETECT_SATURATION == 1)
+            p_mod->u1_sat_flag |= (uint8_t) (MOTOR_DRIVER_SATFLAG_BITU << i);
+#endif
+        }
+        else if (s4_duty < p_mod->s2_min_duty)
+        {
+            s4_duty = p_mod->s2_min_duty;
+#if (MOD_DETECT_SATURATION == 1)
+            p_mod->u1_sat_flag |= (uint8_t) (MOTOR_DRIVER_SATFLAG_BITU << i);
+#endif
+        }
+        else
+        {
+            /* Clear correspond saturation flag bit */
+#if (MOD_DETECT_SATURATION == 1)
+            p_mod->u1_sat_flag &= (uint8_t) (~(MOTOR_DRIVER_SATFLAG_BITU << i));
+#endif
+        }
+
+        p_s2_duty_out[i] = (int16_t) s4_duty;
+    }
+}                                      /* End of function rm_motor_driver_mod_run_fixed() */
+
+/***********************************************************************************************************************
+ * Function Name : rm_motor_driver_set_uvw_duty_fixed
+ * Description   : PWM duty setting from Q15 duty cycle
+ * Arguments     : p_ctrl - The pointer to the motor driver module instance
+ *                 p_s2_duty - The duty cycle of Phase-U/V/W (Q15, 0 - 32767)
+ * Return Value  : None
+ **********************************************************************************************************************/
+static void rm_motor_driver_set_uvw_duty_fixed (motor_driver_instance_ctrl_t * p_ctrl, const int16_t * p_s2_duty)
+{
+    three_phase_instance_t const * p_three_phase = p_ctrl->p_cfg->p_three_phase_instance;
+    three_phase_duty_cycle_t       temp_duty;
+    uint32_t u4_temp_base  = p_ctrl->u2_carrier_base;
+    uint32_t u4_temp_deadt = (uint32_t) p_ctrl->u2_deadtime_count >> 1;
+    uint32_t i;
+
+    for (i = 0U; i < 3U; i++)
+    {
+        temp_duty.duty[i] = (u4_temp_base - ((u4_temp_base * (uint32_t) p_s2_duty[i]) >> MOTOR_DRIVER_FIX_SHIFT)) +
+                            u4_temp_deadt;
+    }
+
+    if (p_three_phase != NULL)
+    {
+        p_three_phase->p_api->dutyCycleSet(p_three_phase->p_ctrl, &temp_duty);
+    }
+}                                      /* End of function rm_motor_driver_set_uvw_duty_fixed */
+
+#endif
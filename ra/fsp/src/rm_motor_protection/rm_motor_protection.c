@@ -0,0 +1,386 @@
+/***********************************************************************************************************************
+ * Copyright [2020] Renesas Electronics Corporation and/or its affiliates.  All Rights Reserved.
+ *
+ * This software and documentation are supplied by Renesas Electronics America Inc. and may only be used with products
+ * of Renesas Electronics Corp. and its affiliates ("Renesas").  No other uses are authorized.  Renesas products are
+ * sold pursuant to Renesas terms and conditions of sale.  Purchasers are solely responsible for the selection and use
+ * of Renesas products and Renesas assumes no liability.  No license, express or implied, to any intellectual property
+ * right is granted by Renesas. This software is protected under all applicable laws, including copyright laws. Renesas
+ * reserves the right to change or discontinue this software and/or this documentation. THE SOFTWARE AND DOCUMENTATION
+ * IS DELIVERED TO YOU "AS IS," AND RENESAS MAKES NO REPRESENTATIONS OR WARRANTIES, AND TO THE FULLEST EXTENT
+ * PERMISSIBLE UNDER APPLICABLE LAW, DISCLAIMS ALL WARRANTIES, WHETHER EXPLICITLY OR IMPLICITLY, INCLUDING WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, AND NONINFRINGEMENT, WITH RESPECT TO THE SOFTWARE OR
+ * DOCUMENTATION.  RENESAS SHALL HAVE NO LIABILITY ARISING OUT OF ANY SECURITY VULNERABILITY OR BREACH.  TO THE MAXIMUM
+ * EXTENT PERMITTED BY LAW, IN NO EVENT WILL RENESAS BE LIABLE TO YOU IN CONNECTION WITH THE SOFTWARE OR DOCUMENTATION
+ * (OR ANY PERSON OR ENTITY CLAIMING RIGHTS DERIVED FROM YOU) FOR ANY LOSS, DAMAGES, OR CLAIMS WHATSOEVER, INCLUDING,
+ * WITHOUT LIMITATION, ANY DIRECT, CONSEQUENTIAL, SPECIAL, INDIRECT, PUNITIVE, OR INCIDENTAL DAMAGES; ANY LOST PROFITS,
+ * OTHER ECONOMIC DAMAGE, PROPERTY DAMAGE, OR PERSONAL INJURY; AND EVEN IF RENESAS HAS BEEN ADVISED OF THE POSSIBILITY
+ * OF SUCH LOSS, DAMAGES, CLAIMS OR COSTS.
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Includes
+ **********************************************************************************************************************/
+#include <stdint.h>
+#include "rm_motor_protection.h"
+#include "bsp_api.h"
+#include "bsp_cfg.h"
+
+/***********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+
+#define MOTOR_PROTECTION_OPEN      (0X4D505254L)
+
+#define MOTOR_PROTECTION_DAC_MAX   (0xFFFFU)
+
+#ifndef MOTOR_PROTECTION_ERROR_RETURN
+ #define MOTOR_PROTECTION_ERROR_RETURN(a, err)    FSP_ERROR_RETURN((a), (err))
+#endif
+
+/***********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Private function prototypes
+ **********************************************************************************************************************/
+static uint32_t rm_motor_protection_comparators_get(motor_protection_cfg_t const * p_cfg);
+
+/***********************************************************************************************************************
+ * Private global variables
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * @addtogroup MOTOR_PROTECTION
+ * @{
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Functions
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * @brief Arms the hardware overcurrent trip. Each comparator reference is set to the trip current through its DAC,
+ * the comparator outputs are enabled after their stabilization time and the POEG status is cleared. From then on an
+ * overcurrent disables the GPT outputs through the POEG without software involvement, and the POEG interrupt only
+ * records the fault.
+ *
+ * The POEG, the comparators and the DACs must be open, and the DACs started.
+ *
+ * @retval FSP_SUCCESS              Protection armed.
+ * @retval FSP_ERR_ASSERTION        Null pointer.
+ * @retval FSP_ERR_ALREADY_OPEN     Module is already open.
+ * @retval FSP_ERR_INVALID_ARGUMENT Configuration parameter error.
+ * @retval FSP_ERR_TIMEOUT          The POEG status did not clear, e.g. the overcurrent is present.
+ * @return See @ref RENESAS_ERROR_CODES or functions called by this function for other possible return codes.
+ *         This function calls:
+ *             * @ref dac_api_t::write
+ *             * @ref comparator_api_t::infoGet
+ *             * @ref comparator_api_t::outputEnable
+ *             * @ref poeg_api_t::callbackSet
+ *             * @ref poeg_api_t::reset
+ *             * @ref poeg_api_t::statusGet
+ **********************************************************************************************************************/
+fsp_err_t RM_MOTOR_PROTECTION_Open (motor_protection_instance_ctrl_t * const p_ctrl,
+                                    motor_protection_cfg_t const * const     p_cfg)
+{
+#if MOTOR_PROTECTION_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ASSERT(NULL != p_cfg);
+    FSP_ASSERT(NULL != p_cfg->p_poeg);
+    MOTOR_PROTECTION_ERROR_RETURN(MOTOR_PROTECTION_OPEN != p_ctrl->open, FSP_ERR_ALREADY_OPEN);
+    MOTOR_PROTECTION_ERROR_RETURN((p_cfg->u1_comparator_num > 0U) &&
+                                  (p_cfg->u1_comparator_num <= MOTOR_PROTECTION_COMPARATOR_MAX),
+                                  FSP_ERR_INVALID_ARGUMENT);
+    for (uint32_t i = 0U; i < p_cfg->u1_comparator_num; i++)
+    {
+        FSP_ASSERT(NULL != p_cfg->p_comparator[i]);
+    }
+
+    MOTOR_PROTECTION_ERROR_RETURN(p_cfg->f_overcurrent_limit > 0.0F, FSP_ERR_INVALID_ARGUMENT);
+    MOTOR_PROTECTION_ERROR_RETURN(p_cfg->p_poeg->p_cfg->irq >= 0, FSP_ERR_INVALID_ARGUMENT);
+#endif
+
+    fsp_err_t err = FSP_SUCCESS;
+
+    p_ctrl->p_cfg = p_cfg;
+    memset(&p_ctrl->status, 0, sizeof(p_ctrl->status));
+    memset(&p_ctrl->fault_log[0], 0, sizeof(p_ctrl->fault_log));
+
+    /* Set the trip thresholds. */
+    float f_code = (float) p_cfg->u2_dac_offset + (p_cfg->f_overcurrent_limit * p_cfg->f_dac_counts_per_ampere);
+    f_code = (f_code < (float) MOTOR_PROTECTION_DAC_MAX) ? f_code : (float) MOTOR_PROTECTION_DAC_MAX;
+    uint16_t u2_code = (uint16_t) ((f_code > 0.0F) ? f_code : 0.0F);
+
+    uint32_t u4_wait_us = 0U;
+    for (uint32_t i = 0U; i < p_cfg->u1_comparator_num; i++)
+    {
+        dac_instance_t const * p_dac = p_cfg->p_threshold_dac[i];
+        if (NULL != p_dac)
+        {
+            err = p_dac->p_api->write(p_dac->p_ctrl, u2_code);
+            MOTOR_PROTECTION_ERROR_RETURN(FSP_SUCCESS == err, err);
+        }
+
+        comparator_info_t info;
+        err = p_cfg->p_comparator[i]->p_api->infoGet(p_cfg->p_comparator[i]->p_ctrl, &info);
+        MOTOR_PROTECTION_ERROR_RETURN(FSP_SUCCESS == err, err);
+        u4_wait_us = (info.min_stabilization_wait_us > u4_wait_us) ? info.min_stabilization_wait_us : u4_wait_us;
+    }
+
+    /* The comparators must settle on the new reference before their output may request an output disable. */
+    R_BSP_SoftwareDelay(u4_wait_us, BSP_DELAY_UNITS_MICROSECONDS);
+
+    for (uint32_t i = 0U; i < p_cfg->u1_comparator_num; i++)
+    {
+        err = p_cfg->p_comparator[i]->p_api->outputEnable(p_cfg->p_comparator[i]->p_ctrl);
+        MOTOR_PROTECTION_ERROR_RETURN(FSP_SUCCESS == err, err);
+    }
+
+    poeg_instance_t const * p_poeg = p_cfg->p_poeg;
+    err = p_poeg->p_api->callbackSet(p_poeg->p_ctrl, rm_motor_protection_poeg_callback, p_ctrl, NULL);
+    MOTOR_PROTECTION_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+    p_ctrl->open = MOTOR_PROTECTION_OPEN;
+
+    /* Clear requests latched while the comparators settled. */
+    p_ctrl->status.tripped = true;
+    err = RM_MOTOR_PROTECTION_Rearm(p_ctrl);
+    p_ctrl->status.u4_rearm_num = 0U;
+
+    return err;
+}
+
+/*******************************************************************************************************************//**
+ * @brief Stops recording faults. The comparators and the POEG keep disabling the outputs on an overcurrent.
+ *
+ * @retval FSP_SUCCESS              Successfully closed.
+ * @retval FSP_ERR_ASSERTION        Null pointer.
+ * @retval FSP_ERR_NOT_OPEN         Module is not open.
+ **********************************************************************************************************************/
+fsp_err_t RM_MOTOR_PROTECTION_Close (motor_protection_instance_ctrl_t * const p_ctrl)
+{
+#if MOTOR_PROTECTION_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    MOTOR_PROTECTION_ERROR_RETURN(MOTOR_PROTECTION_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+
+    p_ctrl->open = 0U;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @brief Re-enables the GPT outputs after a trip. The motor is reset first, so it restarts from the stopped state on
+ * its next run request. The outputs stay disabled while any comparator still detects overcurrent. Otherwise the POEG
+ * status is cleared up to u4_rearm_retries times, as a request that is still active latches again immediately.
+ *
+ * @retval FSP_SUCCESS              Outputs re-enabled and the trip is armed again.
+ * @retval FSP_ERR_ASSERTION        Null pointer.
+ * @retval FSP_ERR_NOT_OPEN         Module is not open.
+ * @retval FSP_ERR_IN_USE           A comparator still detects overcurrent.
+ * @retval FSP_ERR_TIMEOUT          The POEG status did not clear.
+ * @return See @ref RENESAS_ERROR_CODES or functions called by this function for other possible return codes.
+ *         This function calls:
+ *             * @ref motor_api_t::reset
+ *             * @ref poeg_api_t::reset
+ *             * @ref poeg_api_t::statusGet
+ **********************************************************************************************************************/
+fsp_err_t RM_MOTOR_PROTECTION_Rearm (motor_protection_instance_ctrl_t * const p_ctrl)
+{
+#if MOTOR_PROTECTION_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    MOTOR_PROTECTION_ERROR_RETURN(MOTOR_PROTECTION_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+
+    motor_protection_cfg_t const * p_cfg  = p_ctrl->p_cfg;
+    poeg_instance_t const        * p_poeg = p_cfg->p_poeg;
+    poeg_status_t                  status = {POEG_STATE_NO_DISABLE_REQUEST};
+    fsp_err_t err;
+
+    MOTOR_PROTECTION_ERROR_RETURN(0U == rm_motor_protection_comparators_get(p_cfg), FSP_ERR_IN_USE);
+
+    if (NULL != p_cfg->p_motor)
+    {
+        err = p_cfg->p_motor->p_api->reset(p_cfg->p_motor->p_ctrl);
+        MOTOR_PROTECTION_ERROR_RETURN(FSP_SUCCESS == err, err);
+    }
+
+    uint32_t u4_tries = 0U;
+    do
+    {
+        err = p_poeg->p_api->reset(p_poeg->p_ctrl);
+        MOTOR_PROTECTION_ERROR_RETURN(FSP_SUCCESS == err, err);
+        err = p_poeg->p_api->statusGet(p_poeg->p_ctrl, &status);
+        MOTOR_PROTECTION_ERROR_RETURN(FSP_SUCCESS == err, err);
+        u4_tries++;
+    } while ((0U != (status.state & ~POEG_STATE_PIN_DISABLE_REQUEST_ACTIVE)) && (u4_tries <= p_cfg->u4_rearm_retries));
+
+    if (0U != (status.state & ~POEG_STATE_PIN_DISABLE_REQUEST_ACTIVE))
+    {
+        p_ctrl->status.u4_rearm_failure_num++;
+
+        return FSP_ERR_TIMEOUT;
+    }
+
+    p_ctrl->status.tripped = false;
+    p_ctrl->status.u4_rearm_num++;
+
+    /* The POEG interrupt was disabled at the trip. */
+    R_BSP_IrqEnable(p_poeg->p_cfg->irq);
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @brief Gets the protection status and fault statistics.
+ *
+ * @retval FSP_SUCCESS              Status copied.
+ * @retval FSP_ERR_ASSERTION        Null pointer.
+ * @retval FSP_ERR_NOT_OPEN         Module is not open.
+ **********************************************************************************************************************/
+fsp_err_t RM_MOTOR_PROTECTION_StatusGet (motor_protection_instance_ctrl_t * const p_ctrl,
+                                         motor_protection_status_t * const        p_status)
+{
+#if MOTOR_PROTECTION_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ASSERT(NULL != p_status);
+    MOTOR_PROTECTION_ERROR_RETURN(MOTOR_PROTECTION_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+
+    /* The POEG interrupt updates the status. */
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+    *p_status = p_ctrl->status;
+    FSP_CRITICAL_SECTION_EXIT;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @brief Gets a fault from the fault log. The log keeps the latest MOTOR_PROTECTION_FAULT_LOG_NUM faults.
+ *
+ * @param[in]  p_ctrl       Pointer to the control structure
+ * @param[in]  u4_index     0 for the latest fault, 1 for the one before, and so on
+ * @param[out] p_fault      Fault record
+ *
+ * @retval FSP_SUCCESS              Fault copied.
+ * @retval FSP_ERR_ASSERTION        Null pointer.
+ * @retval FSP_ERR_NOT_OPEN         Module is not open.
+ * @retval FSP_ERR_INVALID_ARGUMENT The log holds no fault at u4_index.
+ **********************************************************************************************************************/
+fsp_err_t RM_MOTOR_PROTECTION_FaultGet (motor_protection_instance_ctrl_t * const p_ctrl,
+                                        uint32_t                                 u4_index,
+                                        motor_protection_fault_t * const         p_fault)
+{
+#if MOTOR_PROTECTION_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ASSERT(NULL != p_fault);
+    MOTOR_PROTECTION_ERROR_RETURN(MOTOR_PROTECTION_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+
+    fsp_err_t err = FSP_ERR_INVALID_ARGUMENT;
+
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+    uint32_t u4_num = p_ctrl->status.u4_fault_num;
+    if ((u4_index < u4_num) && (u4_index < MOTOR_PROTECTION_FAULT_LOG_NUM))
+    {
+        *p_fault = p_ctrl->fault_log[(u4_num - 1U - u4_index) & (MOTOR_PROTECTION_FAULT_LOG_NUM - 1U)];
+        err      = FSP_SUCCESS;
+    }
+
+    FSP_CRITICAL_SECTION_EXIT;
+
+    return err;
+}
+
+/*******************************************************************************************************************//**
+ * @brief POEG callback, installed by RM_MOTOR_PROTECTION_Open. The outputs are already disabled by the hardware when
+ * it runs. Records the timestamp, the cause and the trip latency, notifies the motor and the user, and disables the
+ * POEG interrupt until the re-arm, as it stays requested while the POEG status is set.
+ *
+ * @param[in]  p_args       POEG callback arguments, p_context is the control structure
+ **********************************************************************************************************************/
+void rm_motor_protection_poeg_callback (poeg_callback_args_t * p_args)
+{
+    motor_protection_instance_ctrl_t * p_ctrl = (motor_protection_instance_ctrl_t *) p_args->p_context;
+    motor_protection_cfg_t const     * p_cfg  = p_ctrl->p_cfg;
+
+    /* Timestamp first to keep it close to the trip. */
+    uint32_t u4_timestamp = (NULL != p_cfg->p_timestamp) ? *p_cfg->p_timestamp : 0U;
+
+    R_BSP_IrqDisable(p_cfg->p_poeg->p_cfg->irq);
+
+    if (MOTOR_PROTECTION_OPEN != p_ctrl->open)
+    {
+        return;
+    }
+
+    motor_protection_fault_t * p_fault =
+        &p_ctrl->fault_log[p_ctrl->status.u4_fault_num & (MOTOR_PROTECTION_FAULT_LOG_NUM - 1U)];
+
+    poeg_status_t status = {POEG_STATE_NO_DISABLE_REQUEST};
+    (void) p_cfg->p_poeg->p_api->statusGet(p_cfg->p_poeg->p_ctrl, &status);
+
+    p_fault->state          = status.state;
+    p_fault->u4_comparators = rm_motor_protection_comparators_get(p_cfg);
+    p_fault->u4_timestamp   = u4_timestamp;
+    p_fault->u4_latency     = (NULL != p_cfg->p_trip_capture) ? (u4_timestamp - *p_cfg->p_trip_capture) : 0U;
+
+    if (p_fault->u4_latency > p_ctrl->status.u4_latency_max)
+    {
+        p_ctrl->status.u4_latency_max = p_fault->u4_latency;
+    }
+
+    p_ctrl->status.u4_fault_num++;
+    p_ctrl->status.tripped = true;
+
+    /* Let the motor stop its control loop. The outputs are already off. */
+    if ((NULL != p_cfg->p_motor) &&
+        (0U != (status.state & (POEG_STATE_GPT_OR_COMPARATOR_DISABLE_REQUEST | POEG_STATE_PIN_DISABLE_REQUEST))))
+    {
+        (void) p_cfg->p_motor->p_api->errorSet(p_cfg->p_motor->p_ctrl, MOTOR_ERROR_OVER_CURRENT_HW);
+    }
+
+    if (NULL != p_cfg->p_callback)
+    {
+        motor_protection_callback_args_t args;
+        args.p_context = p_cfg->p_context;
+        args.p_fault   = p_fault;
+        p_cfg->p_callback(&args);
+    }
+}
+
+/*******************************************************************************************************************//**
+ * @} (end addtogroup MOTOR_PROTECTION)
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Private Functions
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * Reads the outputs of the comparators.
+ *
+ * @param[in]  p_cfg        Pointer to the configuration
+ *
+ * @return Bit n set if comparator n detects overcurrent.
+ **********************************************************************************************************************/
+static uint32_t rm_motor_protection_comparators_get (motor_protection_cfg_t const * p_cfg)
+{
+    uint32_t u4_comparators = 0U;
+
+    for (uint32_t i = 0U; i < p_cfg->u1_comparator_num; i++)
+    {
+        comparator_status_t status = {COMPARATOR_STATE_OUTPUT_LOW};
+        (void) p_cfg->p_comparator[i]->p_api->statusGet(p_cfg->p_comparator[i]->p_ctrl, &status);
+        if (COMPARATOR_STATE_OUTPUT_HIGH == status.state)
+        {
+            u4_comparators |= 1U << i;
+        }
+    }
+
+    return u4_comparators;
+}
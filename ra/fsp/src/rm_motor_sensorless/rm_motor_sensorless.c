@@ -23,6 +23,8 @@
  **********************************************************************************************************************/
 #include <math.h>
 #include "rm_motor_sensorless.h"
+#include "rm_motor_driver.h"
+#include "r_gpt_three_phase.h"
 #include "bsp_api.h"
 #include "bsp_cfg.h"
 
@@ -31,6 +33,7 @@
  **********************************************************************************************************************/
 
 #define MOTOR_SENSORLESS_OPEN                                  (0X4D4F544ULL)
+#define MOTOR_SENSORLESS_MULTI_AXIS_OPEN                       (0X4D4D4158ULL)
 
 #define MOTOR_SENSORLESS_RAD2RPM                               (30.0F / 3.14159265359F)
 
@@ -64,6 +67,11 @@
 void rm_motor_sensorless_current_callback(motor_current_callback_args_t * p_args);
 void rm_motor_sensorless_speed_callback(motor_speed_callback_args_t * p_args);
 
+/* Multi-axis coordination */
+void        rm_motor_driver_cyclic(adc_callback_args_t * p_args);
+void        rm_motor_sensorless_multi_axis_adc_callback(adc_callback_args_t * p_args);
+static void rm_motor_sensorless_latency_update(motor_sensorless_instance_ctrl_t * p_ctrl);
+
 static uint16_t rm_motor_sensorless_error_check(motor_sensorless_instance_ctrl_t * p_ctrl,
                                                 float                              f_iu,
                                                 float                              f_iv,
@@ -218,6 +226,8 @@ fsp_err_t RM_MOTOR_SENSORLESS_Open (motor_ctrl_t * const p_ctrl, motor_cfg_t con
     rm_motor_sensorless_init_speed_input(&(p_instance_ctrl->st_speed_input));
     rm_motor_sensorless_init_speed_output(&(p_instance_ctrl->st_speed_output));
 
+    p_instance_ctrl->p_latency_timer = NULL;
+
     /* Mark driver as open */
     p_instance_ctrl->open = MOTOR_SENSORLESS_OPEN;
 
@@ -623,6 +633,300 @@ fsp_err_t RM_MOTOR_SENSORLESS_VersionGet (fsp_version_t * const p_version)
     return FSP_SUCCESS;
 }
 
+/*******************************************************************************************************************//**
+ * Coordinates several rm_motor_sensorless axes running on one MCU so that their current control interrupts do not
+ * collide. The PWM carrier of axis n is delayed by n / u1_axis_num of the carrier period, and all carriers are then
+ * restarted with a single start register write so the stagger is kept. The scan configuration of each axis is applied
+ * with R_ADC_ScanCfg, so two axes can share an A/D unit using group A and group B (each triggered by its own carrier).
+ * The A/D scan end events are dispatched to the motor driver of the axis selected by
+ * motor_sensorless_axis_cfg_t::adc_event. The latency of the current control loop of each axis is measured from then
+ * on, see RM_MOTOR_SENSORLESS_LatencyGet.
+ *
+ * All axes must be opened and stopped. The 3-phase PWM timers must be in triangle-wave mode with the A/D conversion
+ * triggered at the trough.
+ *
+ * @retval FSP_SUCCESS              Axes successfully staggered and restarted.
+ * @retval FSP_ERR_ASSERTION        Null pointer.
+ * @retval FSP_ERR_ALREADY_OPEN     Coordinator is already open.
+ * @retval FSP_ERR_NOT_OPEN         An axis is not open.
+ * @retval FSP_ERR_INVALID_ARGUMENT Configuration parameter error.
+ * @return                          See @ref RENESAS_ERROR_CODES or functions called by this function for other
+ *                                  possible return codes.
+ **********************************************************************************************************************/
+fsp_err_t RM_MOTOR_SENSORLESS_MultiAxisOpen (motor_sensorless_multi_axis_ctrl_t * const      p_ctrl,
+                                             motor_sensorless_multi_axis_cfg_t const * const p_cfg)
+{
+    fsp_err_t err = FSP_SUCCESS;
+    uint32_t  i;
+
+#if MOTOR_SENSORLESS_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ASSERT(NULL != p_cfg);
+    FSP_ASSERT(NULL != p_cfg->p_axis);
+    MOTOR_SENSORLESS_ERROR_RETURN(MOTOR_SENSORLESS_MULTI_AXIS_OPEN != p_ctrl->open, FSP_ERR_ALREADY_OPEN);
+    MOTOR_SENSORLESS_ERROR_RETURN((p_cfg->u1_axis_num > 0U) && (p_cfg->u1_axis_num <= MOTOR_SENSORLESS_MULTI_AXIS_MAX),
+                                  FSP_ERR_INVALID_ARGUMENT);
+
+    for (i = 0U; i < p_cfg->u1_axis_num; i++)
+    {
+        FSP_ASSERT(NULL != p_cfg->p_axis[i].p_motor);
+        motor_sensorless_instance_ctrl_t * p_axis_ctrl =
+            (motor_sensorless_instance_ctrl_t *) p_cfg->p_axis[i].p_motor->p_ctrl;
+        MOTOR_SENSORLESS_ERROR_RETURN(MOTOR_SENSORLESS_OPEN == p_axis_ctrl->open, FSP_ERR_NOT_OPEN);
+
+        motor_driver_instance_t const * p_driver =
+            p_axis_ctrl->p_cfg->p_motor_current_instance->p_cfg->p_motor_driver_instance;
+        FSP_ASSERT(NULL != p_driver);
+        MOTOR_SENSORLESS_ERROR_RETURN(NULL != p_driver->p_cfg->p_three_phase_instance, FSP_ERR_INVALID_ARGUMENT);
+        MOTOR_SENSORLESS_ERROR_RETURN(NULL != p_driver->p_cfg->p_adc_instance, FSP_ERR_INVALID_ARGUMENT);
+    }
+#endif
+
+    uint32_t                 sync_channel_mask = 0U;
+    uint32_t                 carrier_counts;
+    timer_info_t             timer_info;
+    timer_instance_t const * p_timer;
+
+    p_ctrl->p_cfg = p_cfg;
+
+    /* Stop all carriers so the A/D triggers stop while the axes are reconfigured */
+    for (i = 0U; i < p_cfg->u1_axis_num; i++)
+    {
+        motor_sensorless_instance_ctrl_t * p_axis_ctrl =
+            (motor_sensorless_instance_ctrl_t *) p_cfg->p_axis[i].p_motor->p_ctrl;
+        p_ctrl->p_driver[i] = p_axis_ctrl->p_cfg->p_motor_current_instance->p_cfg->p_motor_driver_instance;
+
+        three_phase_instance_t const * p_three_phase = p_ctrl->p_driver[i]->p_cfg->p_three_phase_instance;
+        err = p_three_phase->p_api->stop(p_three_phase->p_ctrl);
+        FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+    }
+
+    for (i = 0U; i < p_cfg->u1_axis_num; i++)
+    {
+        motor_sensorless_instance_ctrl_t * p_axis_ctrl =
+            (motor_sensorless_instance_ctrl_t *) p_cfg->p_axis[i].p_motor->p_ctrl;
+        three_phase_instance_t const * p_three_phase = p_ctrl->p_driver[i]->p_cfg->p_three_phase_instance;
+        adc_instance_t const         * p_adc         = p_ctrl->p_driver[i]->p_cfg->p_adc_instance;
+
+        /* Interleave the A/D scans (e.g. group A for one axis and group B for another axis on the same unit) */
+        if (NULL != p_cfg->p_axis[i].p_adc_channel_cfg)
+        {
+            p_adc->p_api->scanStop(p_adc->p_ctrl);
+            err = p_adc->p_api->scanCfg(p_adc->p_ctrl, p_cfg->p_axis[i].p_adc_channel_cfg);
+            FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+            p_adc->p_api->scanStart(p_adc->p_ctrl);
+        }
+
+        err = p_adc->p_api->callbackSet(p_adc->p_ctrl, rm_motor_sensorless_multi_axis_adc_callback, p_ctrl, NULL);
+        FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+        /* Delay the carrier by i / u1_axis_num period (one triangle-wave period is 2 * GTPR counts) */
+        p_timer = p_three_phase->p_cfg->p_timer_instance[THREE_PHASE_CHANNEL_U];
+        p_timer->p_api->infoGet(p_timer->p_ctrl, &timer_info);
+        carrier_counts = timer_info.period_counts << 1;
+        err            = R_GPT_THREE_PHASE_PhaseSet(p_three_phase->p_ctrl, (carrier_counts * i) / p_cfg->u1_axis_num);
+        FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+        /* Start latency measurement */
+        p_axis_ctrl->st_latency.u4_latency_last   = 0U;
+        p_axis_ctrl->st_latency.u4_latency_max    = 0U;
+        p_axis_ctrl->st_latency.u4_carrier_counts = carrier_counts;
+        p_axis_ctrl->p_latency_timer              = p_timer;
+
+        if (i > 0U)
+        {
+            sync_channel_mask |= p_three_phase->p_cfg->channel_mask;
+        }
+    }
+
+    /* Restart all carriers at once to keep the stagger */
+    err = R_GPT_THREE_PHASE_SyncStart(p_ctrl->p_driver[0]->p_cfg->p_three_phase_instance->p_ctrl, sync_channel_mask);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+    p_ctrl->open = MOTOR_SENSORLESS_MULTI_AXIS_OPEN;
+
+    return err;
+}
+
+/*******************************************************************************************************************//**
+ * Stops the latency measurement and gives the A/D scan end interrupts back to the motor driver of each axis. The
+ * carriers keep running with their current phase.
+ *
+ * @retval FSP_SUCCESS              Successfully closed.
+ * @retval FSP_ERR_ASSERTION        Null pointer.
+ * @retval FSP_ERR_NOT_OPEN         Coordinator is not open.
+ **********************************************************************************************************************/
+fsp_err_t RM_MOTOR_SENSORLESS_MultiAxisClose (motor_sensorless_multi_axis_ctrl_t * const p_ctrl)
+{
+#if MOTOR_SENSORLESS_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    MOTOR_SENSORLESS_ERROR_RETURN(MOTOR_SENSORLESS_MULTI_AXIS_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+
+    for (uint32_t i = 0U; i < p_ctrl->p_cfg->u1_axis_num; i++)
+    {
+        motor_sensorless_instance_ctrl_t * p_axis_ctrl =
+            (motor_sensorless_instance_ctrl_t *) p_ctrl->p_cfg->p_axis[i].p_motor->p_ctrl;
+        adc_instance_t const * p_adc = p_ctrl->p_driver[i]->p_cfg->p_adc_instance;
+
+        p_axis_ctrl->p_latency_timer = NULL;
+        p_adc->p_api->callbackSet(p_adc->p_ctrl, rm_motor_driver_cyclic, p_ctrl->p_driver[i]->p_ctrl, NULL);
+    }
+
+    p_ctrl->open = 0U;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Gets the current control loop latency of an axis of a multi-axis coordinator.
+ *
+ * @retval FSP_SUCCESS              Successful data get.
+ * @retval FSP_ERR_ASSERTION        Null pointer.
+ * @retval FSP_ERR_NOT_OPEN         Module is not open.
+ * @retval FSP_ERR_INVALID_ARGUMENT The axis does not belong to an open coordinator.
+ **********************************************************************************************************************/
+fsp_err_t RM_MOTOR_SENSORLESS_LatencyGet (motor_ctrl_t * const p_ctrl, motor_sensorless_latency_t * const p_latency)
+{
+    motor_sensorless_instance_ctrl_t * p_instance_ctrl = (motor_sensorless_instance_ctrl_t *) p_ctrl;
+
+#if MOTOR_SENSORLESS_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_instance_ctrl);
+    FSP_ASSERT(NULL != p_latency);
+    MOTOR_SENSORLESS_ERROR_RETURN(MOTOR_SENSORLESS_OPEN == p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
+    MOTOR_SENSORLESS_ERROR_RETURN(NULL != p_instance_ctrl->p_latency_timer, FSP_ERR_INVALID_ARGUMENT);
+#endif
+
+    *p_latency = p_instance_ctrl->st_latency;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Restarts the worst-case latency measurement of an axis of a multi-axis coordinator.
+ *
+ * @retval FSP_SUCCESS              Successfully reset.
+ * @retval FSP_ERR_ASSERTION        Null pointer.
+ * @retval FSP_ERR_NOT_OPEN         Module is not open.
+ **********************************************************************************************************************/
+fsp_err_t RM_MOTOR_SENSORLESS_LatencyReset (motor_ctrl_t * const p_ctrl)
+{
+    motor_sensorless_instance_ctrl_t * p_instance_ctrl = (motor_sensorless_instance_ctrl_t *) p_ctrl;
+
+#if MOTOR_SENSORLESS_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_instance_ctrl);
+    MOTOR_SENSORLESS_ERROR_RETURN(MOTOR_SENSORLESS_OPEN == p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+
+    p_instance_ctrl->st_latency.u4_latency_max = 0U;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Gets the CPU cycles of the current control, angle/speed estimation, driver and speed control loops of an axis, and
+ * the average CPU load they cause at the configured control periods.
+ *
+ * @retval FSP_SUCCESS              Successful data get.
+ * @retval FSP_ERR_ASSERTION        Null pointer.
+ * @retval FSP_ERR_NOT_OPEN         Module is not open.
+ * @retval FSP_ERR_INVALID_ARGUMENT The axis has no current or speed control module.
+ **********************************************************************************************************************/
+fsp_err_t RM_MOTOR_SENSORLESS_BenchmarkGet (motor_ctrl_t * const                 p_ctrl,
+                                            motor_sensorless_benchmark_t * const p_benchmark)
+{
+    motor_sensorless_instance_ctrl_t * p_instance_ctrl = (motor_sensorless_instance_ctrl_t *) p_ctrl;
+
+#if MOTOR_SENSORLESS_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_instance_ctrl);
+    FSP_ASSERT(NULL != p_benchmark);
+    MOTOR_SENSORLESS_ERROR_RETURN(MOTOR_SENSORLESS_OPEN == p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
+    MOTOR_SENSORLESS_ERROR_RETURN(NULL != p_instance_ctrl->p_cfg->p_motor_current_instance, FSP_ERR_INVALID_ARGUMENT);
+    MOTOR_SENSORLESS_ERROR_RETURN(NULL != p_instance_ctrl->p_cfg->p_motor_speed_instance, FSP_ERR_INVALID_ARGUMENT);
+#endif
+
+    motor_current_instance_t const * p_current = p_instance_ctrl->p_cfg->p_motor_current_instance;
+    motor_speed_instance_t const   * p_speed   = p_instance_ctrl->p_cfg->p_motor_speed_instance;
+
+    motor_current_instance_ctrl_t * p_current_ctrl = (motor_current_instance_ctrl_t *) p_current->p_ctrl;
+    motor_speed_instance_ctrl_t   * p_speed_ctrl   = (motor_speed_instance_ctrl_t *) p_speed->p_ctrl;
+    motor_driver_instance_ctrl_t  * p_driver_ctrl  =
+        (motor_driver_instance_ctrl_t *) p_current->p_cfg->p_motor_driver_instance->p_ctrl;
+
+    motor_current_extended_cfg_t const * p_current_extend =
+        (motor_current_extended_cfg_t const *) p_current->p_cfg->p_extend;
+    motor_speed_extended_cfg_t const * p_speed_extend = (motor_speed_extended_cfg_t const *) p_speed->p_cfg->p_extend;
+
+    /* Take a consistent copy, the stats are updated from the control interrupts */
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+    p_benchmark->st_driver   = p_driver_ctrl->st_cycles;
+    p_benchmark->st_current  = p_current_ctrl->st_cycles;
+    p_benchmark->st_estimate = p_current_ctrl->st_angle_cycles;
+    p_benchmark->st_speed    = p_speed_ctrl->st_cycles;
+    FSP_CRITICAL_SECTION_EXIT;
+
+    bsp_latency_stats_t * p_stats[] =
+    {
+        &p_benchmark->st_driver, &p_benchmark->st_current, &p_benchmark->st_estimate, &p_benchmark->st_speed
+    };
+    for (uint32_t i = 0U; i < (sizeof(p_stats) / sizeof(p_stats[0])); i++)
+    {
+        p_stats[i]->average = (p_stats[i]->count > 0U) ? (uint32_t) (p_stats[i]->total / p_stats[i]->count) : 0U;
+    }
+
+    /* The control periods are configured in microseconds */
+    p_benchmark->f_current_hz = (p_current_extend->f_current_ctrl_period > 0.0F) ?
+                                (1000000.0F / p_current_extend->f_current_ctrl_period) : 0.0F;
+    p_benchmark->f_speed_hz = (p_speed_extend->f_speed_ctrl_period > 0.0F) ?
+                              (1000000.0F / p_speed_extend->f_speed_ctrl_period) : 0.0F;
+
+    /* The driver cyclic process contains the current control, so it is not counted twice */
+    float f_cycles_per_second = ((float) p_benchmark->st_driver.average * p_benchmark->f_current_hz) +
+                                ((float) p_benchmark->st_speed.average * p_benchmark->f_speed_hz);
+    p_benchmark->f_cpu_load = (f_cycles_per_second * 100.0F) / (float) SystemCoreClock;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Restarts the CPU cycle measurement of the control loops of an axis.
+ *
+ * @retval FSP_SUCCESS              Successfully reset.
+ * @retval FSP_ERR_ASSERTION        Null pointer.
+ * @retval FSP_ERR_NOT_OPEN         Module is not open.
+ * @retval FSP_ERR_INVALID_ARGUMENT The axis has no current or speed control module.
+ **********************************************************************************************************************/
+fsp_err_t RM_MOTOR_SENSORLESS_BenchmarkReset (motor_ctrl_t * const p_ctrl)
+{
+    motor_sensorless_instance_ctrl_t * p_instance_ctrl = (motor_sensorless_instance_ctrl_t *) p_ctrl;
+
+#if MOTOR_SENSORLESS_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_instance_ctrl);
+    MOTOR_SENSORLESS_ERROR_RETURN(MOTOR_SENSORLESS_OPEN == p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
+    MOTOR_SENSORLESS_ERROR_RETURN(NULL != p_instance_ctrl->p_cfg->p_motor_current_instance, FSP_ERR_INVALID_ARGUMENT);
+    MOTOR_SENSORLESS_ERROR_RETURN(NULL != p_instance_ctrl->p_cfg->p_motor_speed_instance, FSP_ERR_INVALID_ARGUMENT);
+#endif
+
+    motor_current_instance_t const * p_current = p_instance_ctrl->p_cfg->p_motor_current_instance;
+
+    motor_current_instance_ctrl_t * p_current_ctrl = (motor_current_instance_ctrl_t *) p_current->p_ctrl;
+    motor_speed_instance_ctrl_t   * p_speed_ctrl   =
+        (motor_speed_instance_ctrl_t *) p_instance_ctrl->p_cfg->p_motor_speed_instance->p_ctrl;
+    motor_driver_instance_ctrl_t * p_driver_ctrl =
+        (motor_driver_instance_ctrl_t *) p_current->p_cfg->p_motor_driver_instance->p_ctrl;
+
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+    R_BSP_LatencyStatsClear(&p_driver_ctrl->st_cycles);
+    R_BSP_LatencyStatsClear(&p_current_ctrl->st_cycles);
+    R_BSP_LatencyStatsClear(&p_current_ctrl->st_angle_cycles);
+    R_BSP_LatencyStatsClear(&p_speed_ctrl->st_cycles);
+    FSP_CRITICAL_SECTION_EXIT;
+
+    return FSP_SUCCESS;
+}
+
 /*******************************************************************************************************************//**
  * @} (end addtogroup MOTOR_SENSORLESS)
  **********************************************************************************************************************/
@@ -956,7 +1260,12 @@ static uint16_t rm_motor_sensorless_error_check (motor_sensorless_instance_ctrl_
     /*==================================*/
     /*     Over current error check     */
     /*==================================*/
-    u2_error_flags |= rm_motor_check_over_current_error(f_iu, f_iv, f_iw, p_extended_cfg->f_overcurrent_limit);
+
+    /* A limit of 0 leaves over-current detection to the hardware trip (rm_motor_protection). */
+    if (p_extended_cfg->f_overcurrent_limit > 0.0F)
+    {
+        u2_error_flags |= rm_motor_check_over_current_error(f_iu, f_iv, f_iw, p_extended_cfg->f_overcurrent_limit);
+    }
 
     /*==================================*/
     /*     Over voltage error check     */
@@ -1087,6 +1396,11 @@ void rm_motor_sensorless_current_callback (motor_current_callback_args_t * p_arg
 
         case MOTOR_CURRENT_EVENT_BACKWARD:
         {
+            if (NULL != p_ctrl->p_latency_timer)
+            {
+                rm_motor_sensorless_latency_update(p_ctrl);
+            }
+
             /* Invoke the callback function if it is set. */
             if (NULL != p_extend->p_callback)
             {
@@ -1158,3 +1472,48 @@ void rm_motor_sensorless_speed_callback (motor_speed_callback_args_t * p_args)
         }
     }
 }                                      /* End of function rm_motor_sensorless_speed_callback() */
+
+/***********************************************************************************************************************
+ * Function Name : rm_motor_sensorless_multi_axis_adc_callback
+ * Description   : A/D scan end callback of a multi-axis coordinator, calls the motor driver of the axis
+ * Arguments     : p_args - A/D callback argument, p_context is the coordinator
+ * Return Value  : None
+ **********************************************************************************************************************/
+void rm_motor_sensorless_multi_axis_adc_callback (adc_callback_args_t * p_args)
+{
+    motor_sensorless_multi_axis_ctrl_t * p_ctrl = (motor_sensorless_multi_axis_ctrl_t *) p_args->p_context;
+    adc_callback_args_t                  temp_args_t;
+
+    for (uint32_t i = 0U; i < p_ctrl->p_cfg->u1_axis_num; i++)
+    {
+        motor_driver_instance_t const * p_driver = p_ctrl->p_driver[i];
+
+        if ((p_args->event == p_ctrl->p_cfg->p_axis[i].adc_event) &&
+            (p_args->unit == p_driver->p_cfg->p_adc_instance->p_cfg->unit))
+        {
+            temp_args_t           = *p_args;
+            temp_args_t.p_context = p_driver->p_ctrl;
+            rm_motor_driver_cyclic(&temp_args_t);
+        }
+    }
+}                                      /* End of function rm_motor_sensorless_multi_axis_adc_callback() */
+
+/***********************************************************************************************************************
+ * Function Name : rm_motor_sensorless_latency_update
+ * Description   : Measures the current control latency. The carrier counts up from the trough (A/D trigger), so the
+ *                 counter value is the time elapsed since the trigger while it is below half a carrier period.
+ * Arguments     : p_ctrl - Pointer to Sensorless Motor control structure
+ * Return Value  : None
+ **********************************************************************************************************************/
+static void rm_motor_sensorless_latency_update (motor_sensorless_instance_ctrl_t * p_ctrl)
+{
+    timer_status_t status;
+
+    p_ctrl->p_latency_timer->p_api->statusGet(p_ctrl->p_latency_timer->p_ctrl, &status);
+
+    p_ctrl->st_latency.u4_latency_last = status.counter;
+    if (status.counter > p_ctrl->st_latency.u4_latency_max)
+    {
+        p_ctrl->st_latency.u4_latency_max = status.counter;
+    }
+}                                      /* End of function rm_motor_sensorless_latency_update() */
@@ -61,6 +61,26 @@
 #define     MOTOR_SPEED_IQ_AUTO_ADJ           (2)
 #define     MOTOR_SPEED_IQ_DOWN               (3)
 
+/* Execute the speed control cycle from RAM */
+#ifndef MOTOR_SPEED_CFG_RAMFUNC_ENABLE
+ #define MOTOR_SPEED_CFG_RAMFUNC_ENABLE       (0)
+#endif
+
+#if MOTOR_SPEED_CFG_RAMFUNC_ENABLE
+ #define MOTOR_SPEED_PRV_RAMFUNC              BSP_PLACE_IN_RAM
+#else
+ #define MOTOR_SPEED_PRV_RAMFUNC
+#endif
+
+/* Measure the CPU cycles of each speed control cycle with the DWT cycle counter */
+#ifndef MOTOR_SPEED_CFG_BENCHMARK_ENABLE
+ #define MOTOR_SPEED_CFG_BENCHMARK_ENABLE     (0)
+#endif
+
+#if MOTOR_SPEED_CFG_BENCHMARK_ENABLE && !BSP_FEATURE_DWT_CYCCNT
+ #error "MOTOR_SPEED_CFG_BENCHMARK_ENABLE requires the DWT cycle counter, which is not available on this MCU."
+#endif
+
 #ifndef MOTOR_SPEED_ERROR_RETURN
 
  #define    MOTOR_SPEED_ERROR_RETURN(a, err)    FSP_ERROR_RETURN((a), (err))
@@ -73,15 +93,15 @@
 /***********************************************************************************************************************
  * Private function prototypes
  **********************************************************************************************************************/
-void rm_motor_speed_cyclic(timer_callback_args_t * p_args);
+void rm_motor_speed_cyclic(timer_callback_args_t * p_args) MOTOR_SPEED_PRV_RAMFUNC;
 
 static void  rm_motor_speed_set_param_ref_speed(motor_speed_instance_ctrl_t * p_ctrl, float f_ref_speed_rpm);
-static float rm_motor_speed_speed_rate_limit(motor_speed_instance_ctrl_t * p_ctrl);
-static float rm_motor_speed_set_iq_ref(motor_speed_instance_ctrl_t * p_ctrl);
-static float rm_motor_speed_set_id_ref(motor_speed_instance_ctrl_t * p_ctrl);
-static float rm_motor_speed_speed_pi(motor_speed_instance_ctrl_t * p_ctrl, float f_speed_rad);
-static float rm_motor_speed_set_speed_ref(motor_speed_instance_ctrl_t * p_ctrl);
-static float rm_motor_speed_pi_control(motor_speed_pi_params_t * pi_ctrl);
+static float rm_motor_speed_speed_rate_limit(motor_speed_instance_ctrl_t * p_ctrl) MOTOR_SPEED_PRV_RAMFUNC;
+static float rm_motor_speed_set_iq_ref(motor_speed_instance_ctrl_t * p_ctrl) MOTOR_SPEED_PRV_RAMFUNC;
+static float rm_motor_speed_set_id_ref(motor_speed_instance_ctrl_t * p_ctrl) MOTOR_SPEED_PRV_RAMFUNC;
+static float rm_motor_speed_speed_pi(motor_speed_instance_ctrl_t * p_ctrl, float f_speed_rad) MOTOR_SPEED_PRV_RAMFUNC;
+static float rm_motor_speed_set_speed_ref(motor_speed_instance_ctrl_t * p_ctrl) MOTOR_SPEED_PRV_RAMFUNC;
+static float rm_motor_speed_pi_control(motor_speed_pi_params_t * pi_ctrl) MOTOR_SPEED_PRV_RAMFUNC;
 static void  rm_motor_speed_first_order_lpf_init(motor_speed_lpf_t * st_lpf);
 static void  rm_motor_speed_first_order_lpf_gain_calc(motor_speed_lpf_t * st_lpf, float f_omega, float f_ctrl_period);
 
@@ -154,6 +174,11 @@ fsp_err_t RM_MOTOR_SPEED_Open (motor_speed_ctrl_t * const p_ctrl, motor_speed_cf
 
     p_instance_ctrl->p_cfg = p_cfg;
 
+    R_BSP_LatencyStatsClear(&p_instance_ctrl->st_cycles);
+#if MOTOR_SPEED_CFG_BENCHMARK_ENABLE
+    R_BSP_CycleCounterStart();
+#endif
+
     p_instance_ctrl->u1_active                 = MOTOR_SPEED_FLG_CLR;
     p_instance_ctrl->u1_state_speed_ref        = MOTOR_SPEED_SPEED_ZERO_CONST;
     p_instance_ctrl->st_input.u1_flag_get_iref = MOTOR_SPEED_FLG_CLR;
@@ -557,6 +582,9 @@ void rm_motor_speed_cyclic (timer_callback_args_t * p_args)
     motor_speed_instance_t      * p_instance      = (motor_speed_instance_t *) p_args->p_context;
     motor_speed_instance_ctrl_t * p_instance_ctrl = (motor_speed_instance_ctrl_t *) p_instance->p_ctrl;
     motor_speed_callback_args_t   temp_args_t;
+#if MOTOR_SPEED_CFG_BENCHMARK_ENABLE
+    uint32_t u4_start = DWT->CYCCNT;
+#endif
 
     /* Invoke the callback function if it is set. */
     if (NULL != p_instance->p_cfg->p_callback)
@@ -591,6 +619,10 @@ void rm_motor_speed_cyclic (timer_callback_args_t * p_args)
         temp_args_t.p_context = p_instance->p_cfg->p_context;
         (p_instance->p_cfg->p_callback)(&temp_args_t);
     }
+
+#if MOTOR_SPEED_CFG_BENCHMARK_ENABLE
+    R_BSP_LatencyStatsRecord(&p_instance_ctrl->st_cycles, DWT->CYCCNT - u4_start);
+#endif
 }
 
 /***********************************************************************************************************************
@@ -0,0 +1,403 @@
+/***********************************************************************************************************************
+ * Copyright [2020] Renesas Electronics Corporation and/or its affiliates.  All Rights Reserved.
+ *
+ * This software and documentation are supplied by Renesas Electronics America Inc. and may only be used with products
+ * of Renesas Electronics Corp. and its affiliates ("Renesas").  No other uses are authorized.  Renesas products are
+ * sold pursuant to Renesas terms and conditions of sale.  Purchasers are solely responsible for the selection and use
+ * of Renesas products and Renesas assumes no liability.  No license, express or implied, to any intellectual property
+ * right is granted by Renesas. This software is protected under all applicable laws, including copyright laws. Renesas
+ * reserves the right to change or discontinue this software and/or this documentation. THE SOFTWARE AND DOCUMENTATION
+ * IS DELIVERED TO YOU "AS IS," AND RENESAS MAKES NO REPRESENTATIONS OR WARRANTIES, AND TO THE FULLEST EXTENT
+ * PERMISSIBLE UNDER APPLICABLE LAW, DISCLAIMS ALL WARRANTIES, WHETHER EXPLICITLY OR IMPLICITLY, INCLUDING WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, AND NONINFRINGEMENT, WITH RESPECT TO THE SOFTWARE OR
+ * DOCUMENTATION.  RENESAS SHALL HAVE NO LIABILITY ARISING OUT OF ANY SECURITY VULNERABILITY OR BREACH.  TO THE MAXIMUM
+ * EXTENT PERMITTED BY LAW, IN NO EVENT WILL RENESAS BE LIABLE TO YOU IN CONNECTION WITH THE SOFTWARE OR DOCUMENTATION
+ * (OR ANY PERSON OR ENTITY CLAIMING RIGHTS DERIVED FROM YOU) FOR ANY LOSS, DAMAGES, OR CLAIMS WHATSOEVER, INCLUDING,
+ * WITHOUT LIMITATION, ANY DIRECT, CONSEQUENTIAL, SPECIAL, INDIRECT, PUNITIVE, OR INCIDENTAL DAMAGES; ANY LOST PROFITS,
+ * OTHER ECONOMIC DAMAGE, PROPERTY DAMAGE, OR PERSONAL INJURY; AND EVEN IF RENESAS HAS BEEN ADVISED OF THE POSSIBILITY
+ * OF SUCH LOSS, DAMAGES, CLAIMS OR COSTS.
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Includes
+ **********************************************************************************************************************/
+#include <stdint.h>
+#include "rm_motor_telemetry.h"
+#include "bsp_api.h"
+#include "bsp_cfg.h"
+
+/***********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+
+#define MOTOR_TELEMETRY_OPEN    (0X4D544C4DL)
+
+#ifndef MOTOR_TELEMETRY_ERROR_RETURN
+ #define MOTOR_TELEMETRY_ERROR_RETURN(a, err)    FSP_ERROR_RETURN((a), (err))
+#endif
+
+/***********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Private function prototypes
+ **********************************************************************************************************************/
+static void rm_motor_telemetry_arm(motor_telemetry_instance_ctrl_t * p_ctrl);
+static void rm_motor_telemetry_trigger(motor_telemetry_instance_ctrl_t * p_ctrl, uint32_t u4_head);
+static void rm_motor_telemetry_tx_start(motor_telemetry_instance_ctrl_t * p_ctrl);
+
+/***********************************************************************************************************************
+ * Private global variables
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * @addtogroup MOTOR_TELEMETRY
+ * @{
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Functions
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * @brief Opens the telemetry recorder. In continuous mode recording starts immediately, in single shot modes the
+ * capture is armed.
+ *
+ * @retval FSP_SUCCESS              Telemetry recorder successfully configured.
+ * @retval FSP_ERR_ASSERTION        Null pointer.
+ * @retval FSP_ERR_ALREADY_OPEN     Module is already open.
+ * @retval FSP_ERR_INVALID_ARGUMENT Configuration parameter error.
+ **********************************************************************************************************************/
+fsp_err_t RM_MOTOR_TELEMETRY_Open (motor_telemetry_instance_ctrl_t * const p_ctrl,
+                                   motor_telemetry_cfg_t const * const     p_cfg)
+{
+#if MOTOR_TELEMETRY_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ASSERT(NULL != p_cfg);
+    FSP_ASSERT(NULL != p_cfg->p_buffer);
+    MOTOR_TELEMETRY_ERROR_RETURN(MOTOR_TELEMETRY_OPEN != p_ctrl->open, FSP_ERR_ALREADY_OPEN);
+    MOTOR_TELEMETRY_ERROR_RETURN((p_cfg->u1_channel_num > 0U) && (p_cfg->u1_channel_num <= MOTOR_TELEMETRY_CHANNEL_MAX),
+                                 FSP_ERR_INVALID_ARGUMENT);
+    for (uint32_t i = 0U; i < p_cfg->u1_channel_num; i++)
+    {
+        FSP_ASSERT(NULL != p_cfg->p_channel[i]);
+    }
+
+    MOTOR_TELEMETRY_ERROR_RETURN(p_cfg->u4_record_num > 0U, FSP_ERR_INVALID_ARGUMENT);
+    MOTOR_TELEMETRY_ERROR_RETURN(0U == (p_cfg->u4_record_num & (p_cfg->u4_record_num - 1U)), FSP_ERR_INVALID_ARGUMENT);
+    MOTOR_TELEMETRY_ERROR_RETURN(p_cfg->u2_decimation > 0U, FSP_ERR_INVALID_ARGUMENT);
+    MOTOR_TELEMETRY_ERROR_RETURN((NULL != p_cfg->p_uart) || (NULL != p_cfg->p_write), FSP_ERR_INVALID_ARGUMENT);
+    if (MOTOR_TELEMETRY_TRIGGER_NONE != p_cfg->trigger)
+    {
+        MOTOR_TELEMETRY_ERROR_RETURN(p_cfg->u1_trigger_channel < p_cfg->u1_channel_num, FSP_ERR_INVALID_ARGUMENT);
+        MOTOR_TELEMETRY_ERROR_RETURN((p_cfg->u4_posttrigger_num > 0U) &&
+                                     (p_cfg->u4_posttrigger_num <= p_cfg->u4_record_num),
+                                     FSP_ERR_INVALID_ARGUMENT);
+    }
+#endif
+
+    p_ctrl->p_cfg               = p_cfg;
+    p_ctrl->u4_record_words     = 1U + p_cfg->u1_channel_num;
+    p_ctrl->u4_mask             = p_cfg->u4_record_num - 1U;
+    p_ctrl->u4_head             = 0U;
+    p_ctrl->u4_tail             = 0U;
+    p_ctrl->u4_tx_records       = 0U;
+    p_ctrl->u4_index            = 0U;
+    p_ctrl->u4_decimation_count = 0U;
+    p_ctrl->u4_overrun          = 0U;
+    p_ctrl->f_trigger_prev      = 0.0F;
+
+    rm_motor_telemetry_arm(p_ctrl);
+
+    p_ctrl->open = MOTOR_TELEMETRY_OPEN;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @brief Stops recording. A write in progress is not aborted.
+ *
+ * @retval FSP_SUCCESS              Successfully closed.
+ * @retval FSP_ERR_ASSERTION        Null pointer.
+ * @retval FSP_ERR_NOT_OPEN         Module is not open.
+ **********************************************************************************************************************/
+fsp_err_t RM_MOTOR_TELEMETRY_Close (motor_telemetry_instance_ctrl_t * const p_ctrl)
+{
+#if MOTOR_TELEMETRY_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    MOTOR_TELEMETRY_ERROR_RETURN(MOTOR_TELEMETRY_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+
+    p_ctrl->u4_recording = 0U;
+    p_ctrl->open         = 0U;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @brief Records the configured variables. Call once per control period from the current control interrupt, e.g. from
+ * the MOTOR_SENSORLESS_CALLBACK_EVENT_CURRENT_BACKWARD callback.
+ *
+ * The record is always written (to the ring or, when it is not recorded, to a scratch record), and decimation,
+ * overrun and stop conditions are evaluated without branches so the cost is the same every period. There is no
+ * parameter checking.
+ **********************************************************************************************************************/
+void RM_MOTOR_TELEMETRY_Sample (motor_telemetry_instance_ctrl_t * const p_ctrl)
+{
+    motor_telemetry_cfg_t const * p_cfg = p_ctrl->p_cfg;
+    motor_telemetry_word_t      * p_record;
+    uint32_t u4_head  = p_ctrl->u4_head;
+    uint32_t u4_count = p_ctrl->u4_decimation_count + 1U;
+    uint32_t u4_take  = (uint32_t) (u4_count >= p_cfg->u2_decimation);
+    uint32_t u4_space;
+    uint32_t u4_write;
+    uint32_t u4_commit;
+    float    f_trigger = *(p_cfg->p_channel[p_cfg->u1_trigger_channel]);
+    float    f_level   = p_cfg->f_trigger_level;
+    uint32_t u4_hit;
+
+    /* Trigger detection, only active while a single shot capture records the pre-trigger history */
+    u4_hit = ((uint32_t) (MOTOR_TELEMETRY_TRIGGER_RISING == p_cfg->trigger) &
+              (uint32_t) (p_ctrl->f_trigger_prev < f_level) & (uint32_t) (f_trigger >= f_level)) |
+             ((uint32_t) (MOTOR_TELEMETRY_TRIGGER_FALLING == p_cfg->trigger) &
+              (uint32_t) (p_ctrl->f_trigger_prev > f_level) & (uint32_t) (f_trigger <= f_level));
+    p_ctrl->f_trigger_prev = f_trigger;
+    if (0U != (u4_hit & p_ctrl->u4_overwrite))
+    {
+        /* Once per capture */
+        rm_motor_telemetry_trigger(p_ctrl, u4_head);
+    }
+
+    /* Before the trigger the ring is overwritten freely, otherwise unexported records are never overwritten */
+    u4_space  = (uint32_t) ((u4_head - p_ctrl->u4_tail) < p_cfg->u4_record_num) | p_ctrl->u4_overwrite;
+    u4_write  = u4_take & p_ctrl->u4_recording;
+    u4_commit = u4_write & u4_space;
+
+    p_record = (0U != u4_commit) ?
+               &(p_cfg->p_buffer[(u4_head & p_ctrl->u4_mask) * p_ctrl->u4_record_words]) : &(p_ctrl->scratch[0]);
+
+    p_record[0].u4_index = p_ctrl->u4_index;
+    for (uint32_t i = 0U; i < p_cfg->u1_channel_num; i++)
+    {
+        p_record[i + 1U].f_value = *(p_cfg->p_channel[i]);
+    }
+
+    u4_head                    += u4_commit;
+    p_ctrl->u4_head             = u4_head;
+    p_ctrl->u4_index           += 1U;
+    p_ctrl->u4_decimation_count = u4_count - (u4_take * p_cfg->u2_decimation);
+    p_ctrl->u4_overrun         += u4_write & (u4_space ^ 1U);
+
+    /* A single shot capture stops after the post-trigger records */
+    p_ctrl->u4_recording &= (uint32_t) (u4_head != p_ctrl->u4_stop) | (p_ctrl->u4_stop_enable ^ 1U);
+}
+
+/*******************************************************************************************************************//**
+ * @brief Starts exporting recorded records if no write is in progress. Call periodically from a background task.
+ *
+ * @retval FSP_SUCCESS              Successful, or nothing to export.
+ * @retval FSP_ERR_ASSERTION        Null pointer.
+ * @retval FSP_ERR_NOT_OPEN         Module is not open.
+ **********************************************************************************************************************/
+fsp_err_t RM_MOTOR_TELEMETRY_Process (motor_telemetry_instance_ctrl_t * const p_ctrl)
+{
+#if MOTOR_TELEMETRY_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    MOTOR_TELEMETRY_ERROR_RETURN(MOTOR_TELEMETRY_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+    if (0U == p_ctrl->u4_tx_records)
+    {
+        rm_motor_telemetry_tx_start(p_ctrl);
+    }
+
+    FSP_CRITICAL_SECTION_EXIT;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @brief Notifies the end of a write started by the recorder and starts the next one. Call from the UART
+ * UART_EVENT_TX_COMPLETE callback or when the p_write transfer completed. There is no parameter checking.
+ **********************************************************************************************************************/
+void RM_MOTOR_TELEMETRY_TxComplete (motor_telemetry_instance_ctrl_t * const p_ctrl)
+{
+    p_ctrl->u4_tail      += p_ctrl->u4_tx_records;
+    p_ctrl->u4_tx_records = 0U;
+
+    if (MOTOR_TELEMETRY_OPEN == p_ctrl->open)
+    {
+        rm_motor_telemetry_tx_start(p_ctrl);
+    }
+}
+
+/*******************************************************************************************************************//**
+ * @brief Arms the next single shot capture. Records of the previous capture that are not exported yet are discarded.
+ *
+ * @retval FSP_SUCCESS              Successfully armed.
+ * @retval FSP_ERR_ASSERTION        Null pointer.
+ * @retval FSP_ERR_NOT_OPEN         Module is not open.
+ * @retval FSP_ERR_IN_USE           A write is in progress.
+ **********************************************************************************************************************/
+fsp_err_t RM_MOTOR_TELEMETRY_Arm (motor_telemetry_instance_ctrl_t * const p_ctrl)
+{
+    fsp_err_t err = FSP_SUCCESS;
+
+#if MOTOR_TELEMETRY_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    MOTOR_TELEMETRY_ERROR_RETURN(MOTOR_TELEMETRY_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+    if (0U == p_ctrl->u4_tx_records)
+    {
+        rm_motor_telemetry_arm(p_ctrl);
+    }
+    else
+    {
+        err = FSP_ERR_IN_USE;
+    }
+
+    FSP_CRITICAL_SECTION_EXIT;
+
+    return err;
+}
+
+/*******************************************************************************************************************//**
+ * @brief Gets the recorder status.
+ *
+ * @retval FSP_SUCCESS              Successful data get.
+ * @retval FSP_ERR_ASSERTION        Null pointer.
+ * @retval FSP_ERR_NOT_OPEN         Module is not open.
+ **********************************************************************************************************************/
+fsp_err_t RM_MOTOR_TELEMETRY_StatusGet (motor_telemetry_instance_ctrl_t * const p_ctrl,
+                                        motor_telemetry_status_t * const        p_status)
+{
+#if MOTOR_TELEMETRY_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ASSERT(NULL != p_status);
+    MOTOR_TELEMETRY_ERROR_RETURN(MOTOR_TELEMETRY_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+
+    p_status->u4_recorded = p_ctrl->u4_head;
+    p_status->u4_exported = p_ctrl->u4_tail;
+    p_status->u4_overrun  = p_ctrl->u4_overrun;
+    p_status->triggered   = (0U != p_ctrl->u4_stop_enable);
+    p_status->complete    = (0U != p_ctrl->u4_stop_enable) && (0U == p_ctrl->u4_recording) &&
+                            (p_ctrl->u4_tail == p_ctrl->u4_stop);
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @} (end addtogroup MOTOR_TELEMETRY)
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Private Functions
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Function Name : rm_motor_telemetry_arm
+ * Description   : Starts continuous recording, or arms a single shot capture
+ * Arguments     : p_ctrl - Pointer to the telemetry recorder control structure
+ * Return Value  : None
+ **********************************************************************************************************************/
+static void rm_motor_telemetry_arm (motor_telemetry_instance_ctrl_t * p_ctrl)
+{
+    uint32_t u4_single_shot = (uint32_t) (MOTOR_TELEMETRY_TRIGGER_NONE != p_ctrl->p_cfg->trigger);
+
+    p_ctrl->u4_tail        = p_ctrl->u4_head;
+    p_ctrl->u4_arm_head    = p_ctrl->u4_head;
+    p_ctrl->u4_stop        = p_ctrl->u4_head;
+    p_ctrl->u4_stop_enable = 0U;
+    p_ctrl->u4_overwrite   = u4_single_shot;
+    p_ctrl->u4_recording   = 1U;
+}                                      /* End of function rm_motor_telemetry_arm */
+
+/***********************************************************************************************************************
+ * Function Name : rm_motor_telemetry_trigger
+ * Description   : Selects the pre-trigger records to export and sets the end of the capture
+ * Arguments     : p_ctrl  - Pointer to the telemetry recorder control structure
+ *                 u4_head - Records written before the triggering sample
+ * Return Value  : None
+ **********************************************************************************************************************/
+static void rm_motor_telemetry_trigger (motor_telemetry_instance_ctrl_t * p_ctrl, uint32_t u4_head)
+{
+    motor_telemetry_cfg_t const * p_cfg = p_ctrl->p_cfg;
+    uint32_t u4_pre = p_cfg->u4_pretrigger_num;
+
+    /* Limited by the history recorded since arming and by the room left for the post-trigger records */
+    if (u4_pre > (u4_head - p_ctrl->u4_arm_head))
+    {
+        u4_pre = u4_head - p_ctrl->u4_arm_head;
+    }
+
+    if (u4_pre > (p_cfg->u4_record_num - p_cfg->u4_posttrigger_num))
+    {
+        u4_pre = p_cfg->u4_record_num - p_cfg->u4_posttrigger_num;
+    }
+
+    p_ctrl->u4_tail        = u4_head - u4_pre;
+    p_ctrl->u4_stop        = u4_head + p_cfg->u4_posttrigger_num;
+    p_ctrl->u4_overwrite   = 0U;
+    p_ctrl->u4_stop_enable = 1U;
+}                                      /* End of function rm_motor_telemetry_trigger */
+
+/***********************************************************************************************************************
+ * Function Name : rm_motor_telemetry_tx_start
+ * Description   : Starts writing the next contiguous block of recorded records (no write must be in progress)
+ * Arguments     : p_ctrl - Pointer to the telemetry recorder control structure
+ * Return Value  : None
+ **********************************************************************************************************************/
+static void rm_motor_telemetry_tx_start (motor_telemetry_instance_ctrl_t * p_ctrl)
+{
+    motor_telemetry_cfg_t const * p_cfg = p_ctrl->p_cfg;
+    uint32_t  u4_tail = p_ctrl->u4_tail;
+    uint32_t  u4_records;
+    uint32_t  u4_bytes;
+    uint8_t * p_data;
+    fsp_err_t err;
+
+    /* Nothing is exported before the trigger of a single shot capture */
+    if (0U != p_ctrl->u4_overwrite)
+    {
+        return;
+    }
+
+    u4_records = p_ctrl->u4_head - u4_tail;
+    if (0U == u4_records)
+    {
+        return;
+    }
+
+    /* Contiguous part up to the end of the ring */
+    if (u4_records > (p_cfg->u4_record_num - (u4_tail & p_ctrl->u4_mask)))
+    {
+        u4_records = p_cfg->u4_record_num - (u4_tail & p_ctrl->u4_mask);
+    }
+
+    p_data   = (uint8_t *) &(p_cfg->p_buffer[(u4_tail & p_ctrl->u4_mask) * p_ctrl->u4_record_words]);
+    u4_bytes = u4_records * p_ctrl->u4_record_words * sizeof(motor_telemetry_word_t);
+
+    /* Make the records written by the control interrupt visible to the DMA */
+    __DMB();
+
+    if (NULL != p_cfg->p_uart)
+    {
+        err = p_cfg->p_uart->p_api->write(p_cfg->p_uart->p_ctrl, p_data, u4_bytes);
+    }
+    else
+    {
+        err = p_cfg->p_write(p_cfg->p_context, p_data, u4_bytes);
+    }
+
+    if (FSP_SUCCESS == err)
+    {
+        p_ctrl->u4_tx_records = u4_records;
+    }
+}                                      /* End of function rm_motor_telemetry_tx_start */
@@ -0,0 +1,666 @@
+/***********************************************************************************************************************
+ * Copyright [2020] Renesas Electronics Corporation and/or its affiliates.  All Rights Reserved.
+ *
+ * This software and documentation are supplied by Renesas Electronics America Inc. and may only be used with products
+ * of Renesas Electronics Corp. and its affiliates ("Renesas").  No other uses are authorized.  Renesas products are
+ * sold pursuant to Renesas terms and conditions of sale.  Purchasers are solely responsible for the selection and use
+ * of Renesas products and Renesas assumes no liability.  No license, express or implied, to any intellectual property
+ * right is granted by Renesas. This software is protected under all applicable laws, including copyright laws. Renesas
+ * reserves the right to change or discontinue this software and/or this documentation. THE SOFTWARE AND DOCUMENTATION
+ * IS DELIVERED TO YOU "AS IS," AND RENESAS MAKES NO REPRESENTATIONS OR WARRANTIES, AND TO THE FULLEST EXTENT
+ * PERMISSIBLE UNDER APPLICABLE LAW, DISCLAIMS ALL WARRANTIES, WHETHER EXPLICITLY OR IMPLICITLY, INCLUDING WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, AND NONINFRINGEMENT, WITH RESPECT TO THE SOFTWARE OR
+ * DOCUMENTATION.  RENESAS SHALL HAVE NO LIABILITY ARISING OUT OF ANY SECURITY VULNERABILITY OR BREACH.  TO THE MAXIMUM
+ * EXTENT PERMITTED BY LAW, IN NO EVENT WILL RENESAS BE LIABLE TO YOU IN CONNECTION WITH THE SOFTWARE OR DOCUMENTATION
+ * (OR ANY PERSON OR ENTITY CLAIMING RIGHTS DERIVED FROM YOU) FOR ANY LOSS, DAMAGES, OR CLAIMS WHATSOEVER, INCLUDING,
+ * WITHOUT LIMITATION, ANY DIRECT, CONSEQUENTIAL, SPECIAL, INDIRECT, PUNITIVE, OR INCIDENTAL DAMAGES; ANY LOST PROFITS,
+ * OTHER ECONOMIC DAMAGE, PROPERTY DAMAGE, OR PERSONAL INJURY; AND EVEN IF RENESAS HAS BEEN ADVISED OF THE POSSIBILITY
+ * OF SUCH LOSS, DAMAGES, CLAIMS OR COSTS.
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Includes
+ **********************************************************************************************************************/
+#include <string.h>                    // memcpy(), memset()
+#include "rm_ota_stream.h"
+#include "rm_ota_stream_cfg.h"
+#include "mbedtls/platform_util.h"
+
+/***********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+
+/* "OTAS" in ASCII. */
+#define RM_OTA_STREAM_OPEN                  (0x4F544153U)
+
+#define RM_OTA_STREAM_PRV_AES_BLOCK_SIZE    (16U)
+#define RM_OTA_STREAM_PRV_CTR_IV_LENGTH     (16U)
+#define RM_OTA_STREAM_PRV_TAG_LENGTH_MAX    (16U)
+#define RM_OTA_STREAM_PRV_ALIGNMENT_4       (3U)
+#define RM_OTA_STREAM_PRV_ERASED_VALUE      (0xFFU)
+
+/***********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Private function prototypes
+ **********************************************************************************************************************/
+static uint8_t * rm_ota_stream_buffer_data(rm_ota_stream_instance_ctrl_t * p_ctrl, uint32_t index);
+static uint32_t  rm_ota_stream_block_size(uint32_t address);
+static bool      rm_ota_stream_request_busy(flash_hp_request_t const * p_request);
+static fsp_err_t rm_ota_stream_buffer_wait(rm_ota_stream_buffer_t * p_buffer);
+static fsp_err_t rm_ota_stream_decrypt(rm_ota_stream_instance_ctrl_t * p_ctrl, uint32_t index, uint32_t end);
+static fsp_err_t rm_ota_stream_program(rm_ota_stream_instance_ctrl_t * p_ctrl, uint32_t index);
+static void      rm_ota_stream_end(rm_ota_stream_instance_ctrl_t * p_ctrl);
+
+/***********************************************************************************************************************
+ * Private global variables
+ **********************************************************************************************************************/
+
+/** Version data structure. */
+static const fsp_version_t g_rm_ota_stream_version =
+{
+    .api_version_minor  = RM_OTA_STREAM_CODE_VERSION_MINOR,
+    .api_version_major  = RM_OTA_STREAM_CODE_VERSION_MAJOR,
+    .code_version_major = RM_OTA_STREAM_CODE_VERSION_MAJOR,
+    .code_version_minor = RM_OTA_STREAM_CODE_VERSION_MINOR
+};
+
+/*******************************************************************************************************************//**
+ * @addtogroup RM_OTA_STREAM
+ * @{
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Functions
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * Opens the OTA stream.
+ *
+ * The stream installs an encrypted image into the secondary slot while it is being received:
+ * - RM_OTA_STREAM_Write copies the received data into a staging buffer. Whole AES blocks are decrypted in place on
+ *   the SCE and added to the SHA-256 of the image as they arrive.
+ * - A full buffer is queued with R_FLASH_HP_RequestSubmit and programmed in the background, together with the erase of
+ *   the blocks it reaches first, while the other buffer is filled.
+ *
+ * Receiving, decrypting and programming therefore overlap, and RM_OTA_STREAM_Write only waits when a buffer is full
+ * before the flash has finished programming the other one.
+ *
+ * @retval     FSP_SUCCESS                    Stream is open.
+ * @retval     FSP_ERR_ASSERTION              An input parameter is invalid.
+ * @retval     FSP_ERR_ALREADY_OPEN           Module has already been opened with this instance of the control
+ *                                            structure.
+ * @retval     FSP_ERR_INVALID_SIZE           buffer_size is not a multiple of the code flash write size.
+ * @retval     FSP_ERR_INVALID_ADDRESS        The slot does not start and end on a block boundary.
+ * @retval     FSP_ERR_INVALID_ALIGNMENT      The staging buffers are not 4-byte aligned.
+ **********************************************************************************************************************/
+fsp_err_t RM_OTA_STREAM_Open (rm_ota_stream_instance_ctrl_t * const p_ctrl, rm_ota_stream_cfg_t const * const p_cfg)
+{
+#if RM_OTA_STREAM_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ASSERT(NULL != p_cfg);
+    FSP_ASSERT(NULL != p_cfg->p_flash);
+    FSP_ASSERT(NULL != p_cfg->p_buffers);
+    FSP_ERROR_RETURN(RM_OTA_STREAM_OPEN != p_ctrl->open, FSP_ERR_ALREADY_OPEN);
+    FSP_ERROR_RETURN((0U != p_cfg->buffer_size) && (0U == (p_cfg->buffer_size % BSP_FEATURE_FLASH_HP_CF_WRITE_SIZE)),
+                     FSP_ERR_INVALID_SIZE);
+    FSP_ERROR_RETURN((p_cfg->slot_address >= BSP_FEATURE_FLASH_HP_CF_DUAL_BANK_START) && (0U != p_cfg->slot_size),
+                     FSP_ERR_INVALID_ADDRESS);
+
+    uint32_t slot_end = p_cfg->slot_address + p_cfg->slot_size;
+    FSP_ERROR_RETURN(0U == (p_cfg->slot_address & (rm_ota_stream_block_size(p_cfg->slot_address) - 1U)),
+                     FSP_ERR_INVALID_ADDRESS);
+    FSP_ERROR_RETURN(0U == (slot_end & (rm_ota_stream_block_size(slot_end - 1U) - 1U)), FSP_ERR_INVALID_ADDRESS);
+    FSP_ERROR_RETURN(0U == ((uint32_t) p_cfg->p_buffers & RM_OTA_STREAM_PRV_ALIGNMENT_4), FSP_ERR_INVALID_ALIGNMENT);
+#endif
+
+    memset(p_ctrl->buffers, 0, sizeof(p_ctrl->buffers));
+
+    p_ctrl->p_cfg  = p_cfg;
+    p_ctrl->active = false;
+    p_ctrl->err    = FSP_SUCCESS;
+
+    p_ctrl->open = RM_OTA_STREAM_OPEN;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Starts receiving an image into the secondary slot. The blocks of the slot are erased as the image reaches them.
+ *
+ * @retval     FSP_SUCCESS                    Ready to receive the image.
+ * @retval     FSP_ERR_ASSERTION              An input parameter is invalid.
+ * @retval     FSP_ERR_NOT_OPEN               The instance control structure is not opened.
+ * @retval     FSP_ERR_IN_USE                 An image is already being received.
+ * @retval     FSP_ERR_INVALID_ARGUMENT       Unsupported key size or IV length.
+ * @retval     FSP_ERR_CRYPTO_UNKNOWN         The key could not be set up.
+ **********************************************************************************************************************/
+fsp_err_t RM_OTA_STREAM_Begin (rm_ota_stream_instance_ctrl_t * const p_ctrl,
+                               rm_ota_stream_image_t const * const   p_image)
+{
+#if RM_OTA_STREAM_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ASSERT(NULL != p_image);
+    FSP_ASSERT(NULL != p_image->p_key);
+    FSP_ASSERT(NULL != p_image->p_iv);
+    FSP_ASSERT((NULL != p_image->p_aad) || (0U == p_image->aad_length));
+    FSP_ERROR_RETURN(RM_OTA_STREAM_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+    FSP_ERROR_RETURN((128U == p_image->key_bits) || (256U == p_image->key_bits), FSP_ERR_INVALID_ARGUMENT);
+    FSP_ERROR_RETURN((RM_OTA_STREAM_CIPHER_AES_GCM == p_image->cipher) ?
+                     (0U != p_image->iv_length) : (RM_OTA_STREAM_PRV_CTR_IV_LENGTH == p_image->iv_length),
+                     FSP_ERR_INVALID_ARGUMENT);
+#endif
+    FSP_ERROR_RETURN(!p_ctrl->active, FSP_ERR_IN_USE);
+
+    /* Requests of an aborted image may still be queued on the staging buffers. */
+    rm_ota_stream_buffer_wait(&p_ctrl->buffers[0]);
+    rm_ota_stream_buffer_wait(&p_ctrl->buffers[1]);
+
+    int ret = 0;
+
+    mbedtls_sha256_init(&p_ctrl->sha);
+    ret = mbedtls_sha256_starts_ret(&p_ctrl->sha, 0);
+
+    if (RM_OTA_STREAM_CIPHER_AES_GCM == p_image->cipher)
+    {
+        mbedtls_gcm_init(&p_ctrl->cipher_ctx.gcm);
+
+        if (0 == ret)
+        {
+            ret = mbedtls_gcm_setkey(&p_ctrl->cipher_ctx.gcm, MBEDTLS_CIPHER_ID_AES, p_image->p_key,
+                                     (unsigned int) p_image->key_bits);
+        }
+
+        if (0 == ret)
+        {
+            ret = mbedtls_gcm_starts(&p_ctrl->cipher_ctx.gcm, MBEDTLS_GCM_DECRYPT, p_image->p_iv, p_image->iv_length,
+                                     p_image->p_aad, p_image->aad_length);
+        }
+    }
+    else
+    {
+        /* CTR mode only uses the encryption key schedule, for both directions. */
+        mbedtls_aes_init(&p_ctrl->cipher_ctx.aes);
+
+        if (0 == ret)
+        {
+            ret = mbedtls_aes_setkey_enc(&p_ctrl->cipher_ctx.aes, p_image->p_key, (unsigned int) p_image->key_bits);
+        }
+
+        memcpy(p_ctrl->nonce_counter, p_image->p_iv, RM_OTA_STREAM_PRV_CTR_IV_LENGTH);
+        p_ctrl->nc_off = 0U;
+    }
+
+    p_ctrl->cipher = p_image->cipher;
+
+    if (0 != ret)
+    {
+        rm_ota_stream_end(p_ctrl);
+
+        return FSP_ERR_CRYPTO_UNKNOWN;
+    }
+
+    p_ctrl->buffers[0].fill      = 0U;
+    p_ctrl->buffers[0].decrypted = 0U;
+    p_ctrl->buffers[1].fill      = 0U;
+    p_ctrl->buffers[1].decrypted = 0U;
+    p_ctrl->current              = 0U;
+    p_ctrl->received             = 0U;
+    p_ctrl->write_address        = p_ctrl->p_cfg->slot_address;
+    p_ctrl->erased_end           = p_ctrl->p_cfg->slot_address;
+    p_ctrl->err                  = FSP_SUCCESS;
+    p_ctrl->active               = true;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Adds received image data. The data can be split at any byte. Whole AES blocks are decrypted and hashed before this
+ * function returns, and each full staging buffer is queued for programming. This function only waits for the flash
+ * when the other staging buffer is still being programmed.
+ *
+ * After an error the image cannot be continued: the error is returned by every call until RM_OTA_STREAM_Finish or
+ * RM_OTA_STREAM_Abort.
+ *
+ * @retval     FSP_SUCCESS                    Data added.
+ * @retval     FSP_ERR_ASSERTION              An input parameter is invalid.
+ * @retval     FSP_ERR_NOT_OPEN               The instance control structure is not opened.
+ * @retval     FSP_ERR_INVALID_STATE          No image is being received.
+ * @retval     FSP_ERR_INVALID_SIZE           The image does not fit in the slot.
+ * @retval     FSP_ERR_ERASE_FAILED           Erasing the slot failed.
+ * @retval     FSP_ERR_WRITE_FAILED           Programming the slot failed.
+ * @retval     FSP_ERR_CRYPTO_UNKNOWN         Decrypting or hashing failed.
+ * @return                                    See @ref RENESAS_ERROR_CODES or functions called by this function for
+ *                                            other possible return codes. This function calls:
+ *                                            * R_FLASH_HP_RequestSubmit
+ **********************************************************************************************************************/
+fsp_err_t RM_OTA_STREAM_Write (rm_ota_stream_instance_ctrl_t * const p_ctrl,
+                               uint8_t const * const                 p_data,
+                               uint32_t const                        length)
+{
+#if RM_OTA_STREAM_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ASSERT((NULL != p_data) || (0U == length));
+    FSP_ERROR_RETURN(RM_OTA_STREAM_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+    FSP_ERROR_RETURN(p_ctrl->active, FSP_ERR_INVALID_STATE);
+    FSP_ERROR_RETURN(FSP_SUCCESS == p_ctrl->err, p_ctrl->err);
+    FSP_ERROR_RETURN(length <= (p_ctrl->p_cfg->slot_size - p_ctrl->received), FSP_ERR_INVALID_SIZE);
+
+    uint32_t        buffer_size = p_ctrl->p_cfg->buffer_size;
+    uint8_t const * p_src       = p_data;
+    uint32_t        remaining   = length;
+    fsp_err_t       err         = FSP_SUCCESS;
+
+    while ((remaining > 0U) && (FSP_SUCCESS == err))
+    {
+        rm_ota_stream_buffer_t * p_buffer = &p_ctrl->buffers[p_ctrl->current];
+
+        /* An empty buffer may still be programmed from its previous use. */
+        if (0U == p_buffer->fill)
+        {
+            err = rm_ota_stream_buffer_wait(p_buffer);
+            if (FSP_SUCCESS != err)
+            {
+                break;
+            }
+        }
+
+        uint32_t copy = buffer_size - p_buffer->fill;
+        if (copy > remaining)
+        {
+            copy = remaining;
+        }
+
+        memcpy(rm_ota_stream_buffer_data(p_ctrl, p_ctrl->current) + p_buffer->fill, p_src, copy);
+        p_buffer->fill   += copy;
+        p_ctrl->received += copy;
+        p_src            += copy;
+        remaining        -= copy;
+
+        /* Only the last update of an AES-GCM message may be a partial block. */
+        err = rm_ota_stream_decrypt(p_ctrl, p_ctrl->current,
+                                    p_buffer->fill & ~(RM_OTA_STREAM_PRV_AES_BLOCK_SIZE - 1U));
+
+        if ((FSP_SUCCESS == err) && (buffer_size == p_buffer->fill))
+        {
+            err             = rm_ota_stream_program(p_ctrl, p_ctrl->current);
+            p_ctrl->current = p_ctrl->current ^ 1U;
+        }
+    }
+
+    p_ctrl->err = err;
+
+    return err;
+}
+
+/*******************************************************************************************************************//**
+ * Programs the rest of the image and waits until the slot is written. The last flash write unit is padded with the
+ * erased value. For AES-GCM, the tag is checked after the last byte has been decrypted.
+ *
+ * The slot holds the whole image even if the tag check fails, so the image must not be marked for installation unless
+ * this function succeeds.
+ *
+ * @param[in]  p_ctrl                         Pointer to the control structure.
+ * @param[in]  p_tag                          Expected AES-GCM tag. Not used for AES-CTR.
+ * @param[in]  tag_length                     Size of the tag in bytes, 4 to 16.
+ * @param[out] p_digest                       Optional buffer of RM_OTA_STREAM_DIGEST_SIZE bytes for the SHA-256 of the
+ *                                            decrypted image, may be NULL.
+ *
+ * @retval     FSP_SUCCESS                         Image installed.
+ * @retval     FSP_ERR_ASSERTION                   An input parameter is invalid.
+ * @retval     FSP_ERR_NOT_OPEN                    The instance control structure is not opened.
+ * @retval     FSP_ERR_INVALID_STATE               No image is being received.
+ * @retval     FSP_ERR_CRYPTO_AUTHENTICATION_FAILED The AES-GCM tag does not match.
+ * @return                                         The first error of the image otherwise, see RM_OTA_STREAM_Write.
+ **********************************************************************************************************************/
+fsp_err_t RM_OTA_STREAM_Finish (rm_ota_stream_instance_ctrl_t * const p_ctrl,
+                                uint8_t const * const                 p_tag,
+                                uint32_t const                        tag_length,
+                                uint8_t * const                       p_digest)
+{
+#if RM_OTA_STREAM_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ERROR_RETURN(RM_OTA_STREAM_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+    FSP_ASSERT((RM_OTA_STREAM_CIPHER_AES_GCM != p_ctrl->cipher) ||
+               ((NULL != p_tag) && (tag_length >= 4U) && (tag_length <= RM_OTA_STREAM_PRV_TAG_LENGTH_MAX)));
+#endif
+    FSP_ERROR_RETURN(p_ctrl->active, FSP_ERR_INVALID_STATE);
+
+    fsp_err_t err = p_ctrl->err;
+
+    if ((FSP_SUCCESS == err) && (0U != p_ctrl->buffers[p_ctrl->current].fill))
+    {
+        err = rm_ota_stream_decrypt(p_ctrl, p_ctrl->current, p_ctrl->buffers[p_ctrl->current].fill);
+
+        if (FSP_SUCCESS == err)
+        {
+            err = rm_ota_stream_program(p_ctrl, p_ctrl->current);
+        }
+    }
+
+    /* Queued requests must complete before the staging buffers are released to the application. */
+    fsp_err_t wait_err = rm_ota_stream_buffer_wait(&p_ctrl->buffers[0]);
+    if (FSP_SUCCESS == err)
+    {
+        err = wait_err;
+    }
+
+    wait_err = rm_ota_stream_buffer_wait(&p_ctrl->buffers[1]);
+    if (FSP_SUCCESS == err)
+    {
+        err = wait_err;
+    }
+
+    if ((FSP_SUCCESS == err) && (NULL != p_digest) && (0 != mbedtls_sha256_finish_ret(&p_ctrl->sha, p_digest)))
+    {
+        err = FSP_ERR_CRYPTO_UNKNOWN;
+    }
+
+    if ((FSP_SUCCESS == err) && (RM_OTA_STREAM_CIPHER_AES_GCM == p_ctrl->cipher))
+    {
+        uint8_t tag[RM_OTA_STREAM_PRV_TAG_LENGTH_MAX];
+
+        if (0 != mbedtls_gcm_finish(&p_ctrl->cipher_ctx.gcm, tag, tag_length))
+        {
+            err = FSP_ERR_CRYPTO_UNKNOWN;
+        }
+        else
+        {
+            /* Compare in constant time. */
+            uint8_t diff = 0U;
+            for (uint32_t i = 0U; i < tag_length; i++)
+            {
+                diff |= (uint8_t) (tag[i] ^ p_tag[i]);
+            }
+
+            if (0U != diff)
+            {
+                err = FSP_ERR_CRYPTO_AUTHENTICATION_FAILED;
+            }
+        }
+
+        mbedtls_platform_zeroize(tag, sizeof(tag));
+    }
+
+    rm_ota_stream_end(p_ctrl);
+
+    return err;
+}
+
+/*******************************************************************************************************************//**
+ * Stops receiving the image. Flash requests already queued are completed, the slot is left partially written.
+ *
+ * @retval     FSP_SUCCESS                    Image abandoned.
+ * @retval     FSP_ERR_ASSERTION              An input parameter is invalid.
+ * @retval     FSP_ERR_NOT_OPEN               The instance control structure is not opened.
+ * @retval     FSP_ERR_INVALID_STATE          No image is being received.
+ **********************************************************************************************************************/
+fsp_err_t RM_OTA_STREAM_Abort (rm_ota_stream_instance_ctrl_t * const p_ctrl)
+{
+#if RM_OTA_STREAM_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ERROR_RETURN(RM_OTA_STREAM_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+    FSP_ERROR_RETURN(p_ctrl->active, FSP_ERR_INVALID_STATE);
+
+    rm_ota_stream_end(p_ctrl);
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Closes the OTA stream. An image being received is abandoned and the queued flash requests are waited for. The flash
+ * instance is not closed.
+ *
+ * @retval     FSP_SUCCESS                    Stream closed.
+ * @retval     FSP_ERR_ASSERTION              An input parameter is invalid.
+ * @retval     FSP_ERR_NOT_OPEN               The instance control structure is not opened.
+ **********************************************************************************************************************/
+fsp_err_t RM_OTA_STREAM_Close (rm_ota_stream_instance_ctrl_t * const p_ctrl)
+{
+#if RM_OTA_STREAM_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ERROR_RETURN(RM_OTA_STREAM_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+
+    if (p_ctrl->active)
+    {
+        rm_ota_stream_end(p_ctrl);
+    }
+
+    rm_ota_stream_buffer_wait(&p_ctrl->buffers[0]);
+    rm_ota_stream_buffer_wait(&p_ctrl->buffers[1]);
+
+    p_ctrl->open = 0U;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Gets the version of this module.
+ *
+ * @retval     FSP_SUCCESS                    Version information stored in provided p_version.
+ * @retval     FSP_ERR_ASSERTION              p_version is NULL.
+ **********************************************************************************************************************/
+fsp_err_t RM_OTA_STREAM_VersionGet (fsp_version_t * const p_version)
+{
+#if RM_OTA_STREAM_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_version);
+#endif
+
+    p_version->version_id = g_rm_ota_stream_version.version_id;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @} (end addtogroup RM_OTA_STREAM)
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * Private Functions
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * Returns the data of a staging buffer.
+ *
+ * @param[in]  p_ctrl                         Pointer to the control structure.
+ * @param[in]  index                          Staging buffer, 0 or 1.
+ **********************************************************************************************************************/
+static uint8_t * rm_ota_stream_buffer_data (rm_ota_stream_instance_ctrl_t * p_ctrl, uint32_t index)
+{
+    return p_ctrl->p_cfg->p_buffers + (index * p_ctrl->p_cfg->buffer_size);
+}
+
+/*******************************************************************************************************************//**
+ * Returns the size of the code flash block at an address of the bank not executed from.
+ *
+ * @param[in]  address                        Code flash address.
+ **********************************************************************************************************************/
+static uint32_t rm_ota_stream_block_size (uint32_t address)
+{
+    if ((address - BSP_FEATURE_FLASH_HP_CF_DUAL_BANK_START) < BSP_FEATURE_FLASH_HP_CF_REGION0_SIZE)
+    {
+        return BSP_FEATURE_FLASH_HP_CF_REGION0_BLOCK_SIZE;
+    }
+
+    return BSP_FEATURE_FLASH_HP_CF_REGION1_BLOCK_SIZE;
+}
+
+/*******************************************************************************************************************//**
+ * Checks if a flash request is queued or in progress.
+ *
+ * @param[in]  p_request                      Flash request.
+ **********************************************************************************************************************/
+static bool rm_ota_stream_request_busy (flash_hp_request_t const * p_request)
+{
+    flash_hp_request_status_t status = p_request->status;
+
+    return (FLASH_HP_REQUEST_STATUS_QUEUED == status) || (FLASH_HP_REQUEST_STATUS_ACTIVE == status);
+}
+
+/*******************************************************************************************************************//**
+ * Waits until the flash requests of a staging buffer are complete and returns their result.
+ *
+ * @param[in]  p_buffer                       Staging buffer.
+ *
+ * @retval     FSP_SUCCESS                    The buffer is free.
+ * @retval     FSP_ERR_ERASE_FAILED           The erase queued with the buffer failed.
+ * @retval     FSP_ERR_WRITE_FAILED           The write of the buffer failed.
+ **********************************************************************************************************************/
+static fsp_err_t rm_ota_stream_buffer_wait (rm_ota_stream_buffer_t * p_buffer)
+{
+    /* The status is updated from the flash interrupts. */
+    while (rm_ota_stream_request_busy(&p_buffer->erase) || rm_ota_stream_request_busy(&p_buffer->write))
+    {
+        /* Wait for the flash. */
+    }
+
+    FSP_ERROR_RETURN((FLASH_HP_REQUEST_STATUS_COMPLETE != p_buffer->erase.status) ||
+                     (FLASH_EVENT_ERASE_COMPLETE == p_buffer->erase.event),
+                     FSP_ERR_ERASE_FAILED);
+    FSP_ERROR_RETURN((FLASH_HP_REQUEST_STATUS_COMPLETE != p_buffer->write.status) ||
+                     (FLASH_EVENT_WRITE_COMPLETE == p_buffer->write.event),
+                     FSP_ERR_WRITE_FAILED);
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Decrypts the received bytes of a staging buffer in place up to an offset and adds them to the image hash.
+ *
+ * @param[in]  p_ctrl                         Pointer to the control structure.
+ * @param[in]  index                          Staging buffer.
+ * @param[in]  end                            Offset in the buffer to decrypt up to.
+ *
+ * @retval     FSP_SUCCESS                    Data decrypted.
+ * @retval     FSP_ERR_CRYPTO_UNKNOWN         Decrypting or hashing failed.
+ **********************************************************************************************************************/
+static fsp_err_t rm_ota_stream_decrypt (rm_ota_stream_instance_ctrl_t * p_ctrl, uint32_t index, uint32_t end)
+{
+    rm_ota_stream_buffer_t * p_buffer = &p_ctrl->buffers[index];
+
+    if (end <= p_buffer->decrypted)
+    {
+        return FSP_SUCCESS;
+    }
+
+    unsigned char * p_data = rm_ota_stream_buffer_data(p_ctrl, index) + p_buffer->decrypted;
+    size_t          length = end - p_buffer->decrypted;
+    int             ret;
+
+    if (RM_OTA_STREAM_CIPHER_AES_GCM == p_ctrl->cipher)
+    {
+        ret = mbedtls_gcm_update(&p_ctrl->cipher_ctx.gcm, length, p_data, p_data);
+    }
+    else
+    {
+        ret = mbedtls_aes_crypt_ctr(&p_ctrl->cipher_ctx.aes, length, &p_ctrl->nc_off, p_ctrl->nonce_counter,
+                                    p_ctrl->stream_block, p_data, p_data);
+    }
+
+    if (0 == ret)
+    {
+        ret = mbedtls_sha256_update_ret(&p_ctrl->sha, p_data, length);
+    }
+
+    FSP_ERROR_RETURN(0 == ret, FSP_ERR_CRYPTO_UNKNOWN);
+
+    p_buffer->decrypted = end;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Queues a decrypted staging buffer for programming. The blocks the buffer reaches first are erased by a request
+ * queued ahead of the write, so the slot is erased as it is written.
+ *
+ * @param[in]  p_ctrl                         Pointer to the control structure.
+ * @param[in]  index                          Staging buffer.
+ *
+ * @retval     FSP_SUCCESS                    Buffer queued.
+ * @return                                    See @ref RENESAS_ERROR_CODES or functions called by this function for
+ *                                            other possible return codes. This function calls:
+ *                                            * R_FLASH_HP_RequestSubmit
+ **********************************************************************************************************************/
+static fsp_err_t rm_ota_stream_program (rm_ota_stream_instance_ctrl_t * p_ctrl, uint32_t index)
+{
+    rm_ota_stream_cfg_t const * p_cfg    = p_ctrl->p_cfg;
+    rm_ota_stream_buffer_t    * p_buffer = &p_ctrl->buffers[index];
+    uint8_t                   * p_data   = rm_ota_stream_buffer_data(p_ctrl, index);
+    fsp_err_t                   err      = FSP_SUCCESS;
+
+    /* Pad the last write unit of the image. buffer_size is a multiple of the write size, so the padding fits. */
+    uint32_t length = (p_buffer->fill + (BSP_FEATURE_FLASH_HP_CF_WRITE_SIZE - 1U)) &
+                      ~(BSP_FEATURE_FLASH_HP_CF_WRITE_SIZE - 1U);
+    memset(p_data + p_buffer->fill, RM_OTA_STREAM_PRV_ERASED_VALUE, length - p_buffer->fill);
+
+    uint32_t end = p_ctrl->write_address + length;
+
+    if (end > p_ctrl->erased_end)
+    {
+        uint32_t num_blocks = 0U;
+        uint32_t address    = p_ctrl->erased_end;
+
+        while (address < end)
+        {
+            address += rm_ota_stream_block_size(address);
+            num_blocks++;
+        }
+
+        p_buffer->erase.op            = FLASH_HP_REQUEST_OP_ERASE;
+        p_buffer->erase.flash_address = p_ctrl->erased_end;
+        p_buffer->erase.num           = num_blocks;
+        p_buffer->erase.priority      = p_cfg->priority;
+        p_buffer->erase.p_callback    = NULL;
+        p_buffer->erase.p_context     = p_ctrl;
+
+        err = R_FLASH_HP_RequestSubmit(p_cfg->p_flash->p_ctrl, &p_buffer->erase);
+        FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+        p_ctrl->erased_end = address;
+    }
+
+    /* Requests of the same priority are dispatched in order, so the write follows the erase of its blocks. */
+    p_buffer->write.op            = FLASH_HP_REQUEST_OP_WRITE;
+    p_buffer->write.src_address   = (uint32_t) p_data;
+    p_buffer->write.flash_address = p_ctrl->write_address;
+    p_buffer->write.num           = length;
+    p_buffer->write.priority      = p_cfg->priority;
+    p_buffer->write.p_callback    = NULL;
+    p_buffer->write.p_context     = p_ctrl;
+
+    err = R_FLASH_HP_RequestSubmit(p_cfg->p_flash->p_ctrl, &p_buffer->write);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+    p_ctrl->write_address = end;
+    p_buffer->fill        = 0U;
+    p_buffer->decrypted   = 0U;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Ends the image: releases the cipher and hash contexts.
+ *
+ * @param[in]  p_ctrl                         Pointer to the control structure.
+ **********************************************************************************************************************/
+static void rm_ota_stream_end (rm_ota_stream_instance_ctrl_t * p_ctrl)
+{
+    if (RM_OTA_STREAM_CIPHER_AES_GCM == p_ctrl->cipher)
+    {
+        mbedtls_gcm_free(&p_ctrl->cipher_ctx.gcm);
+    }
+    else
+    {
+        mbedtls_aes_free(&p_ctrl->cipher_ctx.aes);
+        mbedtls_platform_zeroize(p_ctrl->stream_block, sizeof(p_ctrl->stream_block));
+    }
+
+    mbedtls_sha256_free(&p_ctrl->sha);
+
+    p_ctrl->active = false;
+}
@@ -0,0 +1,735 @@
+/***********************************************************************************************************************
+ * Copyright [2020] Renesas Electronics Corporation and/or its affiliates.  All Rights Reserved.
+ *
+ * This software and documentation are supplied by Renesas Electronics America Inc. and may only be used with products
+ * of Renesas Electronics Corp. and its affiliates ("Renesas").  No other uses are authorized.  Renesas products are
+ * sold pursuant to Renesas terms and conditions of sale.  Purchasers are solely responsible for the selection and use
+ * of Renesas products and Renesas assumes no liability.  No license, express or implied, to any intellectual property
+ * right is granted by Renesas. This software is protected under all applicable laws, including copyright laws. Renesas
+ * reserves the right to change or discontinue this software and/or this documentation. THE SOFTWARE AND DOCUMENTATION
+ * IS DELIVERED TO YOU "AS IS," AND RENESAS MAKES NO REPRESENTATIONS OR WARRANTIES, AND TO THE FULLEST EXTENT
+ * PERMISSIBLE UNDER APPLICABLE LAW, DISCLAIMS ALL WARRANTIES, WHETHER EXPLICITLY OR IMPLICITLY, INCLUDING WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, AND NONINFRINGEMENT, WITH RESPECT TO THE SOFTWARE OR
+ * DOCUMENTATION.  RENESAS SHALL HAVE NO LIABILITY ARISING OUT OF ANY SECURITY VULNERABILITY OR BREACH.  TO THE MAXIMUM
+ * EXTENT PERMITTED BY LAW, IN NO EVENT WILL RENESAS BE LIABLE TO YOU IN CONNECTION WITH THE SOFTWARE OR DOCUMENTATION
+ * (OR ANY PERSON OR ENTITY CLAIMING RIGHTS DERIVED FROM YOU) FOR ANY LOSS, DAMAGES, OR CLAIMS WHATSOEVER, INCLUDING,
+ * WITHOUT LIMITATION, ANY DIRECT, CONSEQUENTIAL, SPECIAL, INDIRECT, PUNITIVE, OR INCIDENTAL DAMAGES; ANY LOST PROFITS,
+ * OTHER ECONOMIC DAMAGE, PROPERTY DAMAGE, OR PERSONAL INJURY; AND EVEN IF RENESAS HAS BEEN ADVISED OF THE POSSIBILITY
+ * OF SUCH LOSS, DAMAGES, CLAIMS OR COSTS.
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Includes
+ **********************************************************************************************************************/
+#include "rm_pdc_jpeg.h"
+#include "rm_pdc_jpeg_cfg.h"
+
+/***********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+
+/* "PJPG" in ASCII. */
+#define RM_PDC_JPEG_OPEN                  (0x504A5047U)
+
+#define RM_PDC_JPEG_PRV_STRIPE_MIN        (2U)
+#define RM_PDC_JPEG_PRV_ALIGNMENT_8       (7U)
+#define RM_PDC_JPEG_PRV_BYTES_PER_PIXEL   (2U)
+#define RM_PDC_JPEG_PRV_BYTES_PER_BLOCK   (32U)
+
+/***********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Private function prototypes
+ **********************************************************************************************************************/
+static uint8_t * rm_pdc_jpeg_stripe(rm_pdc_jpeg_instance_ctrl_t * p_ctrl, uint32_t index);
+static uint8_t * rm_pdc_jpeg_frame_buffer(rm_pdc_jpeg_instance_ctrl_t * p_ctrl, uint32_t buffer);
+static fsp_err_t rm_pdc_jpeg_capture_start(rm_pdc_jpeg_instance_ctrl_t * p_ctrl);
+static void      rm_pdc_jpeg_overrun_check(rm_pdc_jpeg_instance_ctrl_t * p_ctrl, uint32_t index);
+static fsp_err_t rm_pdc_jpeg_encode_feed(rm_pdc_jpeg_instance_ctrl_t * p_ctrl);
+static void      rm_pdc_jpeg_encode_complete(rm_pdc_jpeg_instance_ctrl_t * p_ctrl, uint32_t image_size);
+static void      rm_pdc_jpeg_abort(rm_pdc_jpeg_instance_ctrl_t * p_ctrl);
+static void      rm_pdc_jpeg_dropped_skip(rm_pdc_jpeg_instance_ctrl_t * p_ctrl);
+static void      rm_pdc_jpeg_event(rm_pdc_jpeg_instance_ctrl_t * p_ctrl, rm_pdc_jpeg_event_t event);
+
+/***********************************************************************************************************************
+ * Private global variables
+ **********************************************************************************************************************/
+
+/** Version data structure. */
+static const fsp_version_t g_rm_pdc_jpeg_version =
+{
+    .api_version_minor  = RM_PDC_JPEG_CODE_VERSION_MINOR,
+    .api_version_major  = RM_PDC_JPEG_CODE_VERSION_MAJOR,
+    .code_version_major = RM_PDC_JPEG_CODE_VERSION_MAJOR,
+    .code_version_minor = RM_PDC_JPEG_CODE_VERSION_MINOR
+};
+
+/*******************************************************************************************************************//**
+ * @addtogroup RM_PDC_JPEG
+ * @{
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Functions
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * Opens the camera pipeline, the PDC and the JPEG codec.
+ *
+ * The pipeline encodes camera frames without a raw frame buffer:
+ * - Each frame is captured as a chain of DMAC transfers, one per stripe, into a small ring of stripes.
+ * - Each stripe is handed to the codec as soon as the PDC reports it, so the codec encodes while the rest of the frame
+ *   is captured. The next frame is captured while the codec finishes the previous one.
+ * - Encoded frames are written to a ring of JPEG frame buffers, which the application reads with
+ *   RM_PDC_JPEG_FrameGet and returns with RM_PDC_JPEG_FrameRelease.
+ *
+ * When the capture overtakes the codec in the stripe ring the frame is dropped and counted in
+ * rm_pdc_jpeg_statistics_t::frames_overrun. When no frame buffer is free the next capture waits for
+ * RM_PDC_JPEG_FrameRelease.
+ *
+ * @retval     FSP_SUCCESS                    Pipeline is open.
+ * @retval     FSP_ERR_ASSERTION              An input parameter is invalid.
+ * @retval     FSP_ERR_ALREADY_OPEN           Module has already been opened with this instance of the control
+ *                                            structure.
+ * @retval     FSP_ERR_INVALID_ARGUMENT       Unsupported stripe or frame buffer geometry, or the PDC and the codec are
+ *                                            configured for different images.
+ * @retval     FSP_ERR_INVALID_ALIGNMENT      The stripe ring or a frame buffer is not 8-byte aligned.
+ * @return                                    See @ref RENESAS_ERROR_CODES or functions called by this function for
+ *                                            other possible return codes. This function calls:
+ *                                            * pdc_api_t::open
+ *                                            * jpeg_api_t::open
+ **********************************************************************************************************************/
+fsp_err_t RM_PDC_JPEG_Open (rm_pdc_jpeg_instance_ctrl_t * const p_ctrl, rm_pdc_jpeg_cfg_t const * const p_cfg)
+{
+#if RM_PDC_JPEG_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ASSERT(NULL != p_cfg);
+    FSP_ASSERT(NULL != p_cfg->p_pdc);
+    FSP_ASSERT(NULL != p_cfg->p_jpeg);
+    FSP_ASSERT(NULL != p_cfg->p_stripes);
+    FSP_ASSERT(NULL != p_cfg->p_links);
+    FSP_ASSERT(NULL != p_cfg->p_frame_buffers);
+    FSP_ERROR_RETURN(RM_PDC_JPEG_OPEN != p_ctrl->open, FSP_ERR_ALREADY_OPEN);
+
+    pdc_cfg_t const  * p_pdc_cfg  = p_cfg->p_pdc->p_cfg;
+    jpeg_cfg_t const * p_jpeg_cfg = p_cfg->p_jpeg->p_cfg;
+
+#if JPEG_CFG_DECODE_ENABLE
+    FSP_ERROR_RETURN(JPEG_MODE_ENCODE == p_jpeg_cfg->default_mode, FSP_ERR_INVALID_ARGUMENT);
+#endif
+    FSP_ERROR_RETURN((RM_PDC_JPEG_PRV_BYTES_PER_PIXEL == p_pdc_cfg->bytes_per_pixel) &&
+                     (p_jpeg_cfg->horizontal_resolution == p_pdc_cfg->x_capture_pixels) &&
+                     (p_jpeg_cfg->horizontal_stride_pixels == p_pdc_cfg->x_capture_pixels) &&
+                     (p_jpeg_cfg->vertical_resolution == p_pdc_cfg->y_capture_pixels),
+                     FSP_ERR_INVALID_ARGUMENT);
+    FSP_ERROR_RETURN((0U != p_cfg->stripe_lines) && (0U == (p_cfg->stripe_lines & RM_PDC_JPEG_PRV_ALIGNMENT_8)) &&
+                     (0U == (p_pdc_cfg->y_capture_pixels % p_cfg->stripe_lines)) &&
+                     (p_cfg->stripe_count >= RM_PDC_JPEG_PRV_STRIPE_MIN),
+                     FSP_ERR_INVALID_ARGUMENT);
+    FSP_ERROR_RETURN((0U != p_cfg->num_frames) && (p_cfg->num_frames <= RM_PDC_JPEG_MAX_FRAMES) &&
+                     (0U != p_cfg->frame_buffer_size) &&
+                     (0U == (p_cfg->frame_buffer_size & RM_PDC_JPEG_PRV_ALIGNMENT_8)),
+                     FSP_ERR_INVALID_ARGUMENT);
+    FSP_ERROR_RETURN(0U == ((uint32_t) p_cfg->p_stripes & RM_PDC_JPEG_PRV_ALIGNMENT_8), FSP_ERR_INVALID_ALIGNMENT);
+    FSP_ERROR_RETURN(0U == ((uint32_t) p_cfg->p_frame_buffers & RM_PDC_JPEG_PRV_ALIGNMENT_8),
+                     FSP_ERR_INVALID_ALIGNMENT);
+#endif
+
+    pdc_instance_t const  * p_pdc  = p_cfg->p_pdc;
+    jpeg_instance_t const * p_jpeg = p_cfg->p_jpeg;
+
+    fsp_err_t err = p_pdc->p_api->open(p_pdc->p_ctrl, p_pdc->p_cfg);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+    err = p_jpeg->p_api->open(p_jpeg->p_ctrl, p_jpeg->p_cfg);
+    if (FSP_SUCCESS != err)
+    {
+        p_pdc->p_api->close(p_pdc->p_ctrl);
+
+        return err;
+    }
+
+    p_ctrl->p_cfg             = p_cfg;
+    p_ctrl->stripe_bytes      = (uint32_t) p_cfg->stripe_lines * p_pdc->p_cfg->x_capture_pixels *
+                                RM_PDC_JPEG_PRV_BYTES_PER_PIXEL;
+    p_ctrl->frame_stripes     = p_pdc->p_cfg->y_capture_pixels / p_cfg->stripe_lines;
+    p_ctrl->running           = false;
+    p_ctrl->capturing         = false;
+    p_ctrl->stalled           = false;
+    p_ctrl->frame_held        = false;
+    p_ctrl->capture_stripes   = 0U;
+    p_ctrl->stripe_base       = 0U;
+    p_ctrl->stripes_captured  = 0U;
+    p_ctrl->stripes_fed       = 0U;
+    p_ctrl->stripes_encoded   = 0U;
+    p_ctrl->frames[0].active  = false;
+    p_ctrl->frames[1].active  = false;
+    p_ctrl->sequence          = 0U;
+    p_ctrl->buffers_allocated = 0U;
+    p_ctrl->buffers_done      = 0U;
+    p_ctrl->buffers_released  = 0U;
+
+    p_ctrl->statistics.frames_encoded = 0U;
+    p_ctrl->statistics.frames_skipped = 0U;
+    p_ctrl->statistics.frames_overrun = 0U;
+    p_ctrl->statistics.frames_error   = 0U;
+
+    p_ctrl->open = RM_PDC_JPEG_OPEN;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Starts capturing and encoding frames.
+ *
+ * @retval     FSP_SUCCESS                    Capture started, or waiting for a frame buffer.
+ * @retval     FSP_ERR_ASSERTION              An input parameter is invalid.
+ * @retval     FSP_ERR_NOT_OPEN               The instance control structure is not opened.
+ * @retval     FSP_ERR_IN_USE                 The pipeline is already started.
+ * @return                                    See @ref RENESAS_ERROR_CODES or functions called by this function for
+ *                                            other possible return codes. This function calls:
+ *                                            * pdc_api_t::captureChainStart
+ **********************************************************************************************************************/
+fsp_err_t RM_PDC_JPEG_Start (rm_pdc_jpeg_instance_ctrl_t * const p_ctrl)
+{
+#if RM_PDC_JPEG_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ERROR_RETURN(RM_PDC_JPEG_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+    FSP_ERROR_RETURN(!p_ctrl->running, FSP_ERR_IN_USE);
+
+    /* The interrupts start the following captures. */
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+
+    p_ctrl->running = true;
+
+    fsp_err_t err = rm_pdc_jpeg_capture_start(p_ctrl);
+    if (FSP_SUCCESS != err)
+    {
+        p_ctrl->running = false;
+    }
+
+    FSP_CRITICAL_SECTION_EXIT;
+
+    return err;
+}
+
+/*******************************************************************************************************************//**
+ * Stops starting new captures. The frame being captured and the frame being encoded are completed and queued.
+ *
+ * @retval     FSP_SUCCESS                    Pipeline stopped.
+ * @retval     FSP_ERR_ASSERTION              An input parameter is invalid.
+ * @retval     FSP_ERR_NOT_OPEN               The instance control structure is not opened.
+ **********************************************************************************************************************/
+fsp_err_t RM_PDC_JPEG_Stop (rm_pdc_jpeg_instance_ctrl_t * const p_ctrl)
+{
+#if RM_PDC_JPEG_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ERROR_RETURN(RM_PDC_JPEG_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+
+    p_ctrl->running = false;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Returns the oldest encoded frame. The frame stays valid until it is released with RM_PDC_JPEG_FrameRelease.
+ *
+ * @retval     FSP_SUCCESS                    *p_frame is set.
+ * @retval     FSP_ERR_ASSERTION              An input parameter is invalid.
+ * @retval     FSP_ERR_NOT_OPEN               The instance control structure is not opened.
+ * @retval     FSP_ERR_IN_USE                 The frame returned before is not released yet.
+ * @retval     FSP_ERR_INSUFFICIENT_DATA      No frame is encoded yet. Retry after RM_PDC_JPEG_EVENT_FRAME_READY.
+ **********************************************************************************************************************/
+fsp_err_t RM_PDC_JPEG_FrameGet (rm_pdc_jpeg_instance_ctrl_t * const p_ctrl, rm_pdc_jpeg_frame_t * const p_frame)
+{
+#if RM_PDC_JPEG_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ASSERT(NULL != p_frame);
+    FSP_ERROR_RETURN(RM_PDC_JPEG_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+    FSP_ERROR_RETURN(!p_ctrl->frame_held, FSP_ERR_IN_USE);
+
+    fsp_err_t err = FSP_ERR_INSUFFICIENT_DATA;
+
+    /* The interrupts complete frames and start captures into released buffers. */
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+
+    rm_pdc_jpeg_dropped_skip(p_ctrl);
+
+    if (p_ctrl->buffers_done != p_ctrl->buffers_released)
+    {
+        uint32_t buffer = p_ctrl->buffers_released % p_ctrl->p_cfg->num_frames;
+
+        p_frame->p_data   = rm_pdc_jpeg_frame_buffer(p_ctrl, buffer);
+        p_frame->size     = p_ctrl->frame_size[buffer];
+        p_frame->sequence = p_ctrl->frame_sequence[buffer];
+
+        p_ctrl->frame_held = true;
+        err                = FSP_SUCCESS;
+    }
+
+    FSP_CRITICAL_SECTION_EXIT;
+
+    return err;
+}
+
+/*******************************************************************************************************************//**
+ * Releases the frame returned by RM_PDC_JPEG_FrameGet, so its buffer can be encoded into again. If the capture waited
+ * for a frame buffer it is started.
+ *
+ * @retval     FSP_SUCCESS                    Frame released.
+ * @retval     FSP_ERR_ASSERTION              An input parameter is invalid.
+ * @retval     FSP_ERR_NOT_OPEN               The instance control structure is not opened.
+ * @retval     FSP_ERR_INVALID_STATE          No frame is held.
+ * @return                                    See @ref RENESAS_ERROR_CODES or functions called by this function for
+ *                                            other possible return codes. This function calls:
+ *                                            * pdc_api_t::captureChainStart
+ **********************************************************************************************************************/
+fsp_err_t RM_PDC_JPEG_FrameRelease (rm_pdc_jpeg_instance_ctrl_t * const p_ctrl)
+{
+#if RM_PDC_JPEG_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ERROR_RETURN(RM_PDC_JPEG_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+    FSP_ERROR_RETURN(p_ctrl->frame_held, FSP_ERR_INVALID_STATE);
+
+    /* The interrupts complete frames and start captures into released buffers. */
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+
+    p_ctrl->frame_held = false;
+    p_ctrl->buffers_released++;
+
+    fsp_err_t err = rm_pdc_jpeg_capture_start(p_ctrl);
+
+    FSP_CRITICAL_SECTION_EXIT;
+
+    return err;
+}
+
+/*******************************************************************************************************************//**
+ * Reads the frame statistics.
+ *
+ * @retval     FSP_SUCCESS                    *p_statistics is set.
+ * @retval     FSP_ERR_ASSERTION              An input parameter is invalid.
+ * @retval     FSP_ERR_NOT_OPEN               The instance control structure is not opened.
+ **********************************************************************************************************************/
+fsp_err_t RM_PDC_JPEG_StatisticsGet (rm_pdc_jpeg_instance_ctrl_t * const p_ctrl,
+                                     rm_pdc_jpeg_statistics_t * const    p_statistics)
+{
+#if RM_PDC_JPEG_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ASSERT(NULL != p_statistics);
+    FSP_ERROR_RETURN(RM_PDC_JPEG_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+
+    *p_statistics = p_ctrl->statistics;
+
+    FSP_CRITICAL_SECTION_EXIT;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Stops the pipeline and closes the PDC and the JPEG codec. Frames not read yet are discarded.
+ *
+ * @retval     FSP_SUCCESS                    Pipeline closed.
+ * @retval     FSP_ERR_ASSERTION              An input parameter is invalid.
+ * @retval     FSP_ERR_NOT_OPEN               The instance control structure is not opened.
+ **********************************************************************************************************************/
+fsp_err_t RM_PDC_JPEG_Close (rm_pdc_jpeg_instance_ctrl_t * const p_ctrl)
+{
+#if RM_PDC_JPEG_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_ctrl);
+    FSP_ERROR_RETURN(RM_PDC_JPEG_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+#endif
+
+    pdc_instance_t const  * p_pdc  = p_ctrl->p_cfg->p_pdc;
+    jpeg_instance_t const * p_jpeg = p_ctrl->p_cfg->p_jpeg;
+
+    p_ctrl->running = false;
+
+    p_pdc->p_api->close(p_pdc->p_ctrl);
+    p_jpeg->p_api->close(p_jpeg->p_ctrl);
+
+    p_ctrl->open = 0U;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Gets the version of this module.
+ *
+ * @retval     FSP_SUCCESS                    Version information stored in provided p_version.
+ * @retval     FSP_ERR_ASSERTION              p_version is NULL.
+ **********************************************************************************************************************/
+fsp_err_t RM_PDC_JPEG_VersionGet (fsp_version_t * const p_version)
+{
+#if RM_PDC_JPEG_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(NULL != p_version);
+#endif
+
+    p_version->version_id = g_rm_pdc_jpeg_version.version_id;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @} (end addtogroup RM_PDC_JPEG)
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * PDC callback. Set as the callback of the PDC instance, with the control structure of this module as its context.
+ *
+ * Each completed stripe is handed to the codec if it is waiting for it. At the end of a frame the next capture is
+ * started. An error drops the frames in flight and restarts the pipeline.
+ *
+ * @param[in]  p_args                         Callback arguments.
+ **********************************************************************************************************************/
+void rm_pdc_jpeg_pdc_callback (pdc_callback_args_t * p_args)
+{
+    rm_pdc_jpeg_instance_ctrl_t * p_ctrl = (rm_pdc_jpeg_instance_ctrl_t *) p_args->p_context;
+    fsp_err_t err = FSP_SUCCESS;
+
+    if ((PDC_EVENT_STRIPE_COMPLETE == p_args->event) || (PDC_EVENT_TRANSFER_COMPLETE == p_args->event))
+    {
+        p_ctrl->stripes_captured++;
+        p_ctrl->capture_stripes++;
+
+        if (PDC_EVENT_STRIPE_COMPLETE == p_args->event)
+        {
+            /* The PDC is writing the next stripe now. */
+            rm_pdc_jpeg_overrun_check(p_ctrl, p_ctrl->stripes_captured);
+        }
+        else
+        {
+            p_ctrl->capturing = false;
+            err               = rm_pdc_jpeg_capture_start(p_ctrl);
+        }
+
+        if (FSP_SUCCESS == err)
+        {
+            err = rm_pdc_jpeg_encode_feed(p_ctrl);
+        }
+    }
+    else
+    {
+        err = FSP_ERR_ABORTED;
+    }
+
+    if (FSP_SUCCESS != err)
+    {
+        rm_pdc_jpeg_abort(p_ctrl);
+    }
+}
+
+/*******************************************************************************************************************//**
+ * JPEG encode callback. Set as the encode callback of the JPEG instance, with the control structure of this module
+ * as p_encode_context.
+ *
+ * The codec pauses after each stripe and is resumed with the next one if it is captured already, otherwise from the
+ * PDC callback. At the end of a frame the codec starts on the next frame if its first stripe is captured.
+ *
+ * @param[in]  p_args                         Callback arguments.
+ **********************************************************************************************************************/
+void rm_pdc_jpeg_jpeg_callback (jpeg_callback_args_t * p_args)
+{
+    rm_pdc_jpeg_instance_ctrl_t * p_ctrl = (rm_pdc_jpeg_instance_ctrl_t *) p_args->p_context;
+    fsp_err_t err = FSP_ERR_ABORTED;
+
+    if (0U == ((uint32_t) JPEG_STATUS_ERROR & (uint32_t) p_args->status))
+    {
+        p_ctrl->stripes_encoded++;
+
+        if ((uint32_t) JPEG_STATUS_OPERATION_COMPLETE & (uint32_t) p_args->status)
+        {
+            rm_pdc_jpeg_encode_complete(p_ctrl, p_args->image_size);
+
+            /* The frame record and the stripes of the frame are free now. */
+            err = rm_pdc_jpeg_capture_start(p_ctrl);
+        }
+        else
+        {
+            err = FSP_SUCCESS;
+        }
+
+        if (FSP_SUCCESS == err)
+        {
+            err = rm_pdc_jpeg_encode_feed(p_ctrl);
+        }
+    }
+
+    if (FSP_SUCCESS != err)
+    {
+        rm_pdc_jpeg_abort(p_ctrl);
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Private Functions
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * Returns a stripe of the ring.
+ *
+ * @param[in]  p_ctrl                         Pointer to the control structure.
+ * @param[in]  index                          Stripe, counted from the first stripe of frames[0].
+ **********************************************************************************************************************/
+static uint8_t * rm_pdc_jpeg_stripe (rm_pdc_jpeg_instance_ctrl_t * p_ctrl, uint32_t index)
+{
+    uint32_t slot = (p_ctrl->stripe_base + index) % p_ctrl->p_cfg->stripe_count;
+
+    return p_ctrl->p_cfg->p_stripes + (slot * p_ctrl->stripe_bytes);
+}
+
+/*******************************************************************************************************************//**
+ * Returns a JPEG frame buffer.
+ *
+ * @param[in]  p_ctrl                         Pointer to the control structure.
+ * @param[in]  buffer                         Index of the frame buffer.
+ **********************************************************************************************************************/
+static uint8_t * rm_pdc_jpeg_frame_buffer (rm_pdc_jpeg_instance_ctrl_t * p_ctrl, uint32_t buffer)
+{
+    return p_ctrl->p_cfg->p_frame_buffers + (buffer * p_ctrl->p_cfg->frame_buffer_size);
+}
+
+/*******************************************************************************************************************//**
+ * Starts capturing the next frame into the stripes following the frame in flight. The capture waits while the codec
+ * is one frame behind or no frame buffer is free. Called from the interrupts or with interrupts disabled.
+ *
+ * @param[in]  p_ctrl                         Pointer to the control structure.
+ *
+ * @retval     FSP_SUCCESS                    Capture started, or not needed now.
+ * @return                                    See @ref RENESAS_ERROR_CODES or functions called by this function for
+ *                                            other possible return codes. This function calls:
+ *                                            * pdc_api_t::captureChainStart
+ **********************************************************************************************************************/
+static fsp_err_t rm_pdc_jpeg_capture_start (rm_pdc_jpeg_instance_ctrl_t * p_ctrl)
+{
+    rm_pdc_jpeg_cfg_t const * p_cfg = p_ctrl->p_cfg;
+
+    rm_pdc_jpeg_dropped_skip(p_ctrl);
+
+    if (!p_ctrl->running || p_ctrl->capturing)
+    {
+        return FSP_SUCCESS;
+    }
+
+    uint32_t record = p_ctrl->frames[0].active ? 1U : 0U;
+
+    if (p_ctrl->frames[record].active ||
+        ((p_ctrl->buffers_allocated - p_ctrl->buffers_released) >= p_cfg->num_frames))
+    {
+        if (!p_ctrl->stalled)
+        {
+            p_ctrl->stalled = true;
+            p_ctrl->statistics.frames_skipped++;
+        }
+
+        return FSP_SUCCESS;
+    }
+
+    /* Stripe indexes count from the first stripe of frames[0], which is this frame when nothing is in flight. */
+    uint32_t first = record * p_ctrl->frame_stripes;
+
+    for (uint32_t i = 0U; i < p_ctrl->frame_stripes; i++)
+    {
+        p_cfg->p_links[i].p_dest     = rm_pdc_jpeg_stripe(p_ctrl, first + i);
+        p_cfg->p_links[i].num_blocks = (uint16_t) (p_ctrl->stripe_bytes / RM_PDC_JPEG_PRV_BYTES_PER_BLOCK);
+    }
+
+    fsp_err_t err = p_cfg->p_pdc->p_api->captureChainStart(p_cfg->p_pdc->p_ctrl, p_cfg->p_links,
+                                                           p_ctrl->frame_stripes);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+    rm_pdc_jpeg_frame_state_t * p_frame = &p_ctrl->frames[record];
+    p_frame->active   = true;
+    p_frame->corrupt  = false;
+    p_frame->buffer   = (uint8_t) (p_ctrl->buffers_allocated % p_cfg->num_frames);
+    p_frame->sequence = p_ctrl->sequence++;
+
+    p_ctrl->buffers_allocated++;
+    p_ctrl->stalled         = false;
+    p_ctrl->capturing       = true;
+    p_ctrl->capture_stripes = 0U;
+
+    rm_pdc_jpeg_overrun_check(p_ctrl, first);
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Drops a frame in flight when the PDC starts writing a stripe of the ring the codec has not encoded yet.
+ *
+ * @param[in]  p_ctrl                         Pointer to the control structure.
+ * @param[in]  index                          Stripe the PDC is writing, counted from the first stripe of frames[0].
+ **********************************************************************************************************************/
+static void rm_pdc_jpeg_overrun_check (rm_pdc_jpeg_instance_ctrl_t * p_ctrl, uint32_t index)
+{
+    uint32_t stripe_count = p_ctrl->p_cfg->stripe_count;
+
+    /* The stripe written now held stripe index - stripe_count. */
+    if ((index >= stripe_count) && (p_ctrl->stripes_encoded <= (index - stripe_count)))
+    {
+        uint32_t record = ((index - stripe_count) < p_ctrl->frame_stripes) ? 0U : 1U;
+
+        p_ctrl->frames[record].corrupt = true;
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Hands the next captured stripe of frames[0] to the codec if it is waiting for one. The first stripe of a frame
+ * starts a new image in the frame buffer of the frame.
+ *
+ * @param[in]  p_ctrl                         Pointer to the control structure.
+ *
+ * @retval     FSP_SUCCESS                    Stripe handed over, or not needed now.
+ * @return                                    See @ref RENESAS_ERROR_CODES or functions called by this function for
+ *                                            other possible return codes. This function calls:
+ *                                            * jpeg_api_t::outputBufferSet
+ *                                            * jpeg_api_t::inputBufferSet
+ **********************************************************************************************************************/
+static fsp_err_t rm_pdc_jpeg_encode_feed (rm_pdc_jpeg_instance_ctrl_t * p_ctrl)
+{
+    jpeg_instance_t const * p_jpeg = p_ctrl->p_cfg->p_jpeg;
+    fsp_err_t               err    = FSP_SUCCESS;
+
+    if (!p_ctrl->frames[0].active || (p_ctrl->stripes_fed != p_ctrl->stripes_encoded) ||
+        (p_ctrl->stripes_fed >= p_ctrl->stripes_captured) || (p_ctrl->stripes_fed >= p_ctrl->frame_stripes))
+    {
+        return FSP_SUCCESS;
+    }
+
+    if (0U == p_ctrl->stripes_fed)
+    {
+        err = p_jpeg->p_api->outputBufferSet(p_jpeg->p_ctrl,
+                                             rm_pdc_jpeg_frame_buffer(p_ctrl, p_ctrl->frames[0].buffer),
+                                             p_ctrl->p_cfg->frame_buffer_size);
+        FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+    }
+
+    err = p_jpeg->p_api->inputBufferSet(p_jpeg->p_ctrl,
+                                        rm_pdc_jpeg_stripe(p_ctrl, p_ctrl->stripes_fed),
+                                        p_ctrl->stripe_bytes);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+    p_ctrl->stripes_fed++;
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Queues the encoded frames[0] and moves the frame captured after it to frames[0].
+ *
+ * @param[in]  p_ctrl                         Pointer to the control structure.
+ * @param[in]  image_size                     Size of the JPEG image.
+ **********************************************************************************************************************/
+static void rm_pdc_jpeg_encode_complete (rm_pdc_jpeg_instance_ctrl_t * p_ctrl, uint32_t image_size)
+{
+    rm_pdc_jpeg_frame_state_t * p_frame = &p_ctrl->frames[0];
+    rm_pdc_jpeg_event_t         event   = RM_PDC_JPEG_EVENT_FRAME_READY;
+
+    if (p_frame->corrupt)
+    {
+        image_size = 0U;
+        event      = RM_PDC_JPEG_EVENT_FRAME_DROPPED;
+        p_ctrl->statistics.frames_overrun++;
+    }
+    else
+    {
+        p_ctrl->statistics.frames_encoded++;
+    }
+
+    p_ctrl->frame_size[p_frame->buffer]     = image_size;
+    p_ctrl->frame_sequence[p_frame->buffer] = p_frame->sequence;
+    p_ctrl->buffers_done++;
+
+    /* Stripe indexes count from the first stripe of the next frame now. */
+    p_ctrl->stripe_base       = (p_ctrl->stripe_base + p_ctrl->frame_stripes) % p_ctrl->p_cfg->stripe_count;
+    p_ctrl->stripes_captured -= p_ctrl->frame_stripes;
+    p_ctrl->stripes_fed       = 0U;
+    p_ctrl->stripes_encoded   = 0U;
+    p_ctrl->frames[0]         = p_ctrl->frames[1];
+    p_ctrl->frames[1].active  = false;
+
+    rm_pdc_jpeg_event(p_ctrl, event);
+}
+
+/*******************************************************************************************************************//**
+ * Drops the frames in flight after a PDC or codec error, resets the codec and restarts the capture.
+ *
+ * @param[in]  p_ctrl                         Pointer to the control structure.
+ **********************************************************************************************************************/
+static void rm_pdc_jpeg_abort (rm_pdc_jpeg_instance_ctrl_t * p_ctrl)
+{
+    jpeg_instance_t const * p_jpeg = p_ctrl->p_cfg->p_jpeg;
+
+    /* Frame buffers complete in the order they were taken, frames[0] first. */
+    for (uint32_t i = 0U; i < 2U; i++)
+    {
+        if (p_ctrl->frames[i].active)
+        {
+            p_ctrl->frames[i].active                     = false;
+            p_ctrl->frame_size[p_ctrl->frames[i].buffer] = 0U;
+            p_ctrl->buffers_done++;
+            p_ctrl->statistics.frames_error++;
+            rm_pdc_jpeg_event(p_ctrl, RM_PDC_JPEG_EVENT_FRAME_DROPPED);
+        }
+    }
+
+    /* The codec cannot be stopped in the middle of an image. */
+    p_jpeg->p_api->close(p_jpeg->p_ctrl);
+    fsp_err_t err = p_jpeg->p_api->open(p_jpeg->p_ctrl, p_jpeg->p_cfg);
+
+    p_ctrl->capturing        = false;
+    p_ctrl->stripes_captured = 0U;
+    p_ctrl->stripes_fed      = 0U;
+    p_ctrl->stripes_encoded  = 0U;
+
+    if ((FSP_SUCCESS != err) || (FSP_SUCCESS != rm_pdc_jpeg_capture_start(p_ctrl)))
+    {
+        /* The pipeline cannot recover, RM_PDC_JPEG_Start must be called again. */
+        p_ctrl->running = false;
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Releases the dropped frames at the head of the frame buffer ring, so RM_PDC_JPEG_FrameGet returns encoded frames
+ * only.
+ *
+ * @param[in]  p_ctrl                         Pointer to the control structure.
+ **********************************************************************************************************************/
+static void rm_pdc_jpeg_dropped_skip (rm_pdc_jpeg_instance_ctrl_t * p_ctrl)
+{
+    while ((p_ctrl->buffers_done != p_ctrl->buffers_released) &&
+           (0U == p_ctrl->frame_size[p_ctrl->buffers_released % p_ctrl->p_cfg->num_frames]))
+    {
+        p_ctrl->buffers_released++;
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Calls the user callback, if one is configured.
+ *
+ * @param[in]  p_ctrl                         Pointer to the control structure.
+ * @param[in]  event                          Event to report.
+ **********************************************************************************************************************/
+static void rm_pdc_jpeg_event (rm_pdc_jpeg_instance_ctrl_t * p_ctrl, rm_pdc_jpeg_event_t event)
+{
+    if (NULL != p_ctrl->p_cfg->p_callback)
+    {
+        rm_pdc_jpeg_callback_args_t args;
+        args.event     = event;
+        args.p_context = p_ctrl->p_cfg->p_context;
+        p_ctrl->p_cfg->p_callback(&args);
+    }
+}
@@ -1102,6 +1102,19 @@ int mbedtls_aes_crypt_cbc( mbedtls_aes_context *ctx,
     }
 #endif
 
+#if defined(MBEDTLS_AES_ENCRYPT_ALT) && defined(MBEDTLS_AES_DECRYPT_ALT)
+    /* Chain the whole buffer in one SCE operation. The block loop below is
+     * only used when the engine has no CBC procedure for this key. */
+    if( length > 0 )
+    {
+        int ret = mbedtls_internal_aes_crypt_cbc_blocks( ctx, mode, length / 16,
+                                                         iv, input, output );
+
+        if( ret != MBEDTLS_ERR_PLATFORM_FEATURE_UNSUPPORTED )
+            return( ret );
+    }
+#endif
+
     if( mode == MBEDTLS_AES_DECRYPT )
     {
         while( length > 0 )
@@ -1476,6 +1489,40 @@ int mbedtls_aes_crypt_ctr( mbedtls_aes_context *ctx,
     if ( n > 0x0F )
         return( MBEDTLS_ERR_AES_BAD_INPUT_DATA );
 
+#if defined(MBEDTLS_AES_ENCRYPT_ALT)
+    /* Use up the current key stream block, then pass every whole block to
+     * the SCE in one CTR operation. The byte loop below only handles the
+     * trailing partial block, or everything if the engine has no CTR
+     * procedure for this key. */
+    while( n != 0 && length > 0 )
+    {
+        c = *input++;
+        *output++ = (unsigned char)( c ^ stream_block[n] );
+
+        n = ( n + 1 ) & 0x0F;
+        length--;
+    }
+
+    if( length >= 16 )
+    {
+        size_t blocks = length / 16;
+        int ret = mbedtls_internal_aes_crypt_ctr_blocks( ctx, blocks, nonce_counter,
+                                                         input, output );
+
+        if( ret == 0 )
+        {
+            input  += blocks * 16;
+            output += blocks * 16;
+            length -= blocks * 16;
+        }
+        else if( ret != MBEDTLS_ERR_PLATFORM_FEATURE_UNSUPPORTED )
+        {
+            *nc_off = n;
+            return( ret );
+        }
+    }
+#endif
+
     while( length-- )
     {
         if( n == 0 ) {
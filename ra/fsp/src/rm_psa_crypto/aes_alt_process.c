@@ -39,6 +39,7 @@
  #endif
  #include "hw_sce_aes_private.h"
  #include "hw_sce_private.h"
+ #include "rm_psa_crypto.h"
 
 /*
  * 32-bit integer manipulation macros (little endian)
@@ -78,7 +79,7 @@
  * \return         #MBEDTLS_ERR_AES_INVALID_KEY_LENGTH on failure.
  */
  #if defined(MBEDTLS_AES_SETKEY_ENC_ALT) || defined(MBEDTLS_AES_SETKEY_DEC_ALT)
-int aes_setkey_generic (mbedtls_aes_context * ctx, const unsigned char * key, unsigned int keybits)
+static int aes_setkey_sce (mbedtls_aes_context * ctx, const unsigned char * key, unsigned int keybits)
 {
     FSP_ASSERT(ctx);
     FSP_ASSERT(key);
@@ -90,6 +91,18 @@ int aes_setkey_generic (mbedtls_aes_context * ctx, const unsigned char * key, un
     /* Create storage to hold the generated OEM key index. Size = Largest key size possible. */
     uint8_t encrypted_aes_key[SIZE_AES_192BIT_KEYLEN_BYTES_WRAPPED] = {0};
   #endif
+  #if PSA_CRYPTO_CFG_AES_SOFT_FALLBACK && !BSP_FEATURE_CRYPTO_HAS_SCE9
+
+    /* Only SCE9 has AES-192 procedures. Plain AES-192 keys use the software cipher on the other engines. */
+    if ((SIZE_AES_192BIT_KEYLEN_BITS == keybits) && (false == (bool) ctx->vendor_ctx))
+    {
+        return aes_alt_soft_setkey(ctx, key, keybits);
+    }
+  #endif
+
+    /* The context may have been keyed for the software cipher before. */
+    ctx->rk = NULL;
+
     switch (keybits)
     {
         case SIZE_AES_128BIT_KEYLEN_BITS:
@@ -206,6 +219,20 @@ int aes_setkey_generic (mbedtls_aes_context * ctx, const unsigned char * key, un
     return ret;
 }
 
+int aes_setkey_generic (mbedtls_aes_context * ctx, const unsigned char * key, unsigned int keybits)
+{
+    if (FSP_SUCCESS != RM_PSA_CRYPTO_SCE_ACQUIRE())
+    {
+        return MBEDTLS_ERR_PLATFORM_HW_ACCEL_FAILED;
+    }
+
+    int ret = aes_setkey_sce(ctx, key, keybits);
+
+    RM_PSA_CRYPTO_SCE_RELEASE();
+
+    return ret;
+}
+
  #endif                                // defined(MBEDTLS_AES_SETKEY_ENC_ALT) || defined(MBEDTLS_AES_SETKEY_DEC_ALT)
 
 /*
@@ -237,12 +264,21 @@ int mbedtls_aes_setkey_dec (mbedtls_aes_context * ctx, const unsigned char * key
  * NOTE: The return code from this function is not checked by the mbedCrypto implementation,
  * so a failure here wont show up in the calling layer.
  */
-int mbedtls_internal_aes_encrypt (mbedtls_aes_context * ctx, const unsigned char input[16], unsigned char output[16])
+static int aes_encrypt_sce (mbedtls_aes_context * ctx, const unsigned char input[16], unsigned char output[16])
 {
     (void) output;
     fsp_err_t err = FSP_ERR_CRYPTO_UNKNOWN;
     int       ret = 0;
 
+  #if PSA_CRYPTO_CFG_AES_SOFT_FALLBACK
+    if (AES_ALT_SOFT_CONTEXT(ctx))
+    {
+        aes_alt_soft_encrypt(ctx, input, output);
+
+        return 0;
+    }
+  #endif
+
     if (ctx->nr == 10)
     {
         if (true == (bool) ctx->vendor_ctx)
@@ -317,6 +353,20 @@ int mbedtls_internal_aes_encrypt (mbedtls_aes_context * ctx, const unsigned char
     return ret;
 }
 
+int mbedtls_internal_aes_encrypt (mbedtls_aes_context * ctx, const unsigned char input[16], unsigned char output[16])
+{
+    if (FSP_SUCCESS != RM_PSA_CRYPTO_SCE_ACQUIRE())
+    {
+        return MBEDTLS_ERR_PLATFORM_HW_ACCEL_FAILED;
+    }
+
+    int ret = aes_encrypt_sce(ctx, input, output);
+
+    RM_PSA_CRYPTO_SCE_RELEASE();
+
+    return ret;
+}
+
  #endif                                /* !MBEDTLS_AES_ENCRYPT_ALT */
 
 /*
@@ -325,11 +375,20 @@ int mbedtls_internal_aes_encrypt (mbedtls_aes_context * ctx, const unsigned char
  * so a failure here wont show up in the calling layer.
  */
  #if defined(MBEDTLS_AES_DECRYPT_ALT)
-int mbedtls_internal_aes_decrypt (mbedtls_aes_context * ctx, const unsigned char input[16], unsigned char output[16])
+static int aes_decrypt_sce (mbedtls_aes_context * ctx, const unsigned char input[16], unsigned char output[16])
 {
     fsp_err_t err = FSP_ERR_CRYPTO_UNKNOWN;
     int       ret = 0;
 
+  #if PSA_CRYPTO_CFG_AES_SOFT_FALLBACK
+    if (AES_ALT_SOFT_CONTEXT(ctx))
+    {
+        aes_alt_soft_decrypt(ctx, input, output);
+
+        return 0;
+    }
+  #endif
+
     if (ctx->nr == 10)
     {
         if (true == (bool) ctx->vendor_ctx)
@@ -404,6 +463,213 @@ int mbedtls_internal_aes_decrypt (mbedtls_aes_context * ctx, const unsigned char
     return ret;
 }
 
+int mbedtls_internal_aes_decrypt (mbedtls_aes_context * ctx, const unsigned char input[16], unsigned char output[16])
+{
+    if (FSP_SUCCESS != RM_PSA_CRYPTO_SCE_ACQUIRE())
+    {
+        return MBEDTLS_ERR_PLATFORM_HW_ACCEL_FAILED;
+    }
+
+    int ret = aes_decrypt_sce(ctx, input, output);
+
+    RM_PSA_CRYPTO_SCE_RELEASE();
+
+    return ret;
+}
+
  #endif                                /* !MBEDTLS_AES_DECRYPT_ALT */
 
+ #if (defined(MBEDTLS_CIPHER_MODE_CBC) && defined(MBEDTLS_AES_ENCRYPT_ALT) && defined(MBEDTLS_AES_DECRYPT_ALT)) || \
+    (defined(MBEDTLS_CIPHER_MODE_CTR) && defined(MBEDTLS_AES_ENCRYPT_ALT))
+
+/* Largest number of blocks whose word count fits in the num_words argument of the SCE procedures. */
+  #define AES_ALT_MAX_BLOCKS_PER_CALL    (UINT32_MAX / SIZE_AES_BLOCK_WORDS)
+
+typedef enum e_aes_alt_chained_op
+{
+    AES_ALT_CHAINED_CBC_ENCRYPT = 0,
+    AES_ALT_CHAINED_CBC_DECRYPT,
+    AES_ALT_CHAINED_CTR,
+} aes_alt_chained_op_t;
+
+typedef fsp_err_t (* aes_alt_chained_t)(const uint32_t * InData_Key, const uint32_t * InData_IV,
+                                        const uint32_t num_words, const uint32_t * InData_Text,
+                                        uint32_t * OutData_Text, uint32_t * OutData_IV);
+
+/* Multi-block SCE procedures indexed by [operation][128/192/256-bit key]. Only SCE9 provides AES-192. */
+static const aes_alt_chained_t g_aes_alt_chained[][3] =
+{
+    [AES_ALT_CHAINED_CBC_ENCRYPT] =
+    {
+        HW_SCE_AES_128CbcEncrypt,
+  #if BSP_FEATURE_CRYPTO_HAS_SCE9
+        HW_SCE_AES_192CbcEncrypt,
+  #else
+        NULL,
+  #endif
+        HW_SCE_AES_256CbcEncrypt
+    },
+    [AES_ALT_CHAINED_CBC_DECRYPT] =
+    {
+        HW_SCE_AES_128CbcDecrypt,
+  #if BSP_FEATURE_CRYPTO_HAS_SCE9
+        HW_SCE_AES_192CbcDecrypt,
+  #else
+        NULL,
+  #endif
+        HW_SCE_AES_256CbcDecrypt
+    },
+    [AES_ALT_CHAINED_CTR] =
+    {
+        HW_SCE_AES_128CtrEncrypt,
+  #if BSP_FEATURE_CRYPTO_HAS_SCE9
+        HW_SCE_AES_192CtrEncrypt,
+  #else
+        NULL,
+  #endif
+        HW_SCE_AES_256CtrEncrypt
+    },
+};
+
+static int aes_alt_chained_run_sce (mbedtls_aes_context * ctx,
+                                    aes_alt_chained_op_t  op,
+                                    size_t                num_blocks,
+                                    unsigned char         iv[16],
+                                    const unsigned char * input,
+                                    unsigned char       * output)
+{
+    aes_alt_chained_t p_procedure = NULL;
+
+    switch (ctx->nr)
+    {
+        case 10:
+        {
+            p_procedure = g_aes_alt_chained[op][0];
+            break;
+        }
+
+        case 12:
+        {
+            p_procedure = g_aes_alt_chained[op][1];
+            break;
+        }
+
+        case 14:
+        {
+            p_procedure = g_aes_alt_chained[op][2];
+            break;
+        }
+
+        default:
+        {
+            break;
+        }
+    }
+
+  #if PSA_CRYPTO_CFG_AES_SOFT_FALLBACK
+
+    /* Software contexts run the caller's block loop. */
+    if (AES_ALT_SOFT_CONTEXT(ctx))
+    {
+        p_procedure = NULL;
+    }
+  #endif
+
+  #if !BSP_FEATURE_CRYPTO_HAS_SCE9
+
+    /* The CBC/CTR procedures of the non-SCE9 engines only accept plain keys. */
+    if (true == (bool) ctx->vendor_ctx)
+    {
+        p_procedure = NULL;
+    }
+  #endif
+
+    if (NULL == p_procedure)
+    {
+        return MBEDTLS_ERR_PLATFORM_FEATURE_UNSUPPORTED;
+    }
+
+    while (num_blocks > 0U)
+    {
+        size_t    blocks = (num_blocks > AES_ALT_MAX_BLOCKS_PER_CALL) ? AES_ALT_MAX_BLOCKS_PER_CALL : num_blocks;
+        fsp_err_t err    = p_procedure(ctx->buf,
+                                       (uint32_t *) &iv[0],                       // NOLINT(rea-tp-casting)
+                                       (uint32_t) (blocks * SIZE_AES_BLOCK_WORDS),
+                                       (uint32_t *) &input[0],                    // NOLINT(rea-tp-casting)
+                                       (uint32_t *) &output[0],                   // NOLINT(rea-tp-casting)
+                                       (uint32_t *) &iv[0]);                      // NOLINT(rea-tp-casting)
+
+        if (FSP_SUCCESS != err)
+        {
+            return MBEDTLS_ERR_PLATFORM_HW_ACCEL_FAILED;
+        }
+
+        input      += blocks * SIZE_AES_BLOCK_BYTES;
+        output     += blocks * SIZE_AES_BLOCK_BYTES;
+        num_blocks -= blocks;
+    }
+
+    return 0;
+}
+
+static int aes_alt_chained_run (mbedtls_aes_context * ctx,
+                                aes_alt_chained_op_t  op,
+                                size_t                num_blocks,
+                                unsigned char         iv[16],
+                                const unsigned char * input,
+                                unsigned char       * output)
+{
+    if (FSP_SUCCESS != RM_PSA_CRYPTO_SCE_ACQUIRE())
+    {
+        return MBEDTLS_ERR_PLATFORM_HW_ACCEL_FAILED;
+    }
+
+    int ret = aes_alt_chained_run_sce(ctx, op, num_blocks, iv, input, output);
+
+    RM_PSA_CRYPTO_SCE_RELEASE();
+
+    return ret;
+}
+
+ #endif
+
+ #if defined(MBEDTLS_CIPHER_MODE_CBC) && defined(MBEDTLS_AES_ENCRYPT_ALT) && defined(MBEDTLS_AES_DECRYPT_ALT)
+
+/*
+ * AES-CBC encryption/decryption of whole blocks in a single SCE operation.
+ * The chaining value is returned in iv. MBEDTLS_ERR_PLATFORM_FEATURE_UNSUPPORTED is returned when
+ * the engine has no CBC procedure for this key, in which case the caller should use the block loop.
+ */
+int mbedtls_internal_aes_crypt_cbc_blocks (mbedtls_aes_context * ctx,
+                                           int                   mode,
+                                           size_t                num_blocks,
+                                           unsigned char         iv[16],
+                                           const unsigned char * input,
+                                           unsigned char       * output)
+{
+    aes_alt_chained_op_t op = (MBEDTLS_AES_ENCRYPT == mode) ? AES_ALT_CHAINED_CBC_ENCRYPT : AES_ALT_CHAINED_CBC_DECRYPT;
+
+    return aes_alt_chained_run(ctx, op, num_blocks, iv, input, output);
+}
+
+ #endif
+
+ #if defined(MBEDTLS_CIPHER_MODE_CTR) && defined(MBEDTLS_AES_ENCRYPT_ALT)
+
+/*
+ * AES-CTR encryption/decryption of whole blocks in a single SCE operation.
+ * nonce_counter is advanced by num_blocks. MBEDTLS_ERR_PLATFORM_FEATURE_UNSUPPORTED is returned when
+ * the engine has no CTR procedure for this key, in which case the caller should use the block loop.
+ */
+int mbedtls_internal_aes_crypt_ctr_blocks (mbedtls_aes_context * ctx,
+                                           size_t                num_blocks,
+                                           unsigned char         nonce_counter[16],
+                                           const unsigned char * input,
+                                           unsigned char       * output)
+{
+    return aes_alt_chained_run(ctx, AES_ALT_CHAINED_CTR, num_blocks, nonce_counter, input, output);
+}
+
+ #endif
+
 #endif                                 /* MBEDTLS_AES_C */
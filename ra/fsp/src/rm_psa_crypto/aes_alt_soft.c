@@ -0,0 +1,598 @@
+/***********************************************************************************************************************
+ * Copyright [2020] Renesas Electronics Corporation and/or its affiliates.  All Rights Reserved.
+ *
+ * This software and documentation are supplied by Renesas Electronics America Inc. and may only be used with products
+ * of Renesas Electronics Corp. and its affiliates ("Renesas").  No other uses are authorized.  Renesas products are
+ * sold pursuant to Renesas terms and conditions of sale.  Purchasers are solely responsible for the selection and use
+ * of Renesas products and Renesas assumes no liability.  No license, express or implied, to any intellectual property
+ * right is granted by Renesas. This software is protected under all applicable laws, including copyright laws. Renesas
+ * reserves the right to change or discontinue this software and/or this documentation. THE SOFTWARE AND DOCUMENTATION
+ * IS DELIVERED TO YOU "AS IS," AND RENESAS MAKES NO REPRESENTATIONS OR WARRANTIES, AND TO THE FULLEST EXTENT
+ * PERMISSIBLE UNDER APPLICABLE LAW, DISCLAIMS ALL WARRANTIES, WHETHER EXPLICITLY OR IMPLICITLY, INCLUDING WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, AND NONINFRINGEMENT, WITH RESPECT TO THE SOFTWARE OR
+ * DOCUMENTATION.  RENESAS SHALL HAVE NO LIABILITY ARISING OUT OF ANY SECURITY VULNERABILITY OR BREACH.  TO THE MAXIMUM
+ * EXTENT PERMITTED BY LAW, IN NO EVENT WILL RENESAS BE LIABLE TO YOU IN CONNECTION WITH THE SOFTWARE OR DOCUMENTATION
+ * (OR ANY PERSON OR ENTITY CLAIMING RIGHTS DERIVED FROM YOU) FOR ANY LOSS, DAMAGES, OR CLAIMS WHATSOEVER, INCLUDING,
+ * WITHOUT LIMITATION, ANY DIRECT, CONSEQUENTIAL, SPECIAL, INDIRECT, PUNITIVE, OR INCIDENTAL DAMAGES; ANY LOST PROFITS,
+ * OTHER ECONOMIC DAMAGE, PROPERTY DAMAGE, OR PERSONAL INJURY; AND EVEN IF RENESAS HAS BEEN ADVISED OF THE POSSIBILITY
+ * OF SUCH LOSS, DAMAGES, CLAIMS OR COSTS.
+ **********************************************************************************************************************/
+
+/*
+ * Constant-time software AES, used by the AES alternate when the SCE has no procedure for a key size.
+ *
+ * The cipher is bitsliced and uses no lookup tables: the 16 state bytes are held as 8 bit planes (bit 4 * column + row
+ * of plane k is bit k of that state byte), SubBytes is evaluated as the Boyar-Peralta Boolean circuit of the S-box on
+ * all 16 bytes at once, and ShiftRows/MixColumns are rotations and XORs of the planes. The sequence of operations does
+ * not depend on the key or the data, and no memory is addressed with secret values, so the execution time is fixed on
+ * cores without a data cache (Cortex-M23/M33/M4) and nothing is leaked through the cache where there is one.
+ *
+ * The round keys are stored in the packed plane format in mbedtls_aes_context::buf and rk points to them, which is how
+ * the AES alternate tells software contexts from SCE contexts.
+ */
+
+#if !defined(MBEDTLS_CONFIG_FILE)
+ #include "mbedtls/config.h"
+#else
+ #include MBEDTLS_CONFIG_FILE
+#endif
+
+#if defined(MBEDTLS_AES_C) && defined(MBEDTLS_AES_ALT)
+
+ #include <stdbool.h>
+ #include <string.h>
+
+ #include "mbedtls/aes.h"
+ #include "mbedtls/platform_util.h"
+
+ #if PSA_CRYPTO_CFG_AES_SOFT_FALLBACK
+
+/*
+ * 32-bit integer manipulation macros (little endian)
+ */
+  #ifndef GET_UINT32_LE
+   #define GET_UINT32_LE(n, b, i)                \
+    {                                            \
+        (n) = ((uint32_t) (b)[(i)])              \
+              | ((uint32_t) (b)[(i) + 1] << 8)   \
+              | ((uint32_t) (b)[(i) + 2] << 16)  \
+              | ((uint32_t) (b)[(i) + 3] << 24); \
+    }
+  #endif
+
+  #ifndef PUT_UINT32_LE
+   #define PUT_UINT32_LE(n, b, i)                            \
+    {                                                        \
+        (b)[(i)]     = (unsigned char) (((n)) & 0xFF);       \
+        (b)[(i) + 1] = (unsigned char) (((n) >> 8) & 0xFF);  \
+        (b)[(i) + 2] = (unsigned char) (((n) >> 16) & 0xFF); \
+        (b)[(i) + 3] = (unsigned char) (((n) >> 24) & 0xFF); \
+    }
+  #endif
+
+/* Rows of a bit plane. */
+  #define AES_SOFT_ROW_0      (0x1111U)
+  #define AES_SOFT_ROW_1      (0x2222U)
+  #define AES_SOFT_ROW_2      (0x4444U)
+  #define AES_SOFT_ROW_3      (0x8888U)
+  #define AES_SOFT_PLANE      (0xFFFFU)
+
+/* Round keys: 4 words per round, each holding two 16-bit planes. */
+  #define AES_SOFT_RK_WORDS   (4U)
+  #define AES_SOFT_MAX_ROUNDS (14U)
+
+static const uint8_t g_aes_soft_rcon[10] = {0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x1B, 0x36};
+
+/* Exchanges the bits of w_lo whose index has bit n set with the bits of w_hi whose index is n lower. */
+static inline void aes_soft_swap_move (uint32_t * p_lo, uint32_t * p_hi, uint32_t mask, uint32_t n)
+{
+    uint32_t t = ((*p_hi << n) ^ *p_lo) & mask;
+    *p_lo ^= t;
+    *p_hi ^= t >> n;
+}
+
+/*
+ * Bit transposition between the byte order of a block and the packed plane format.
+ *
+ * The 128 bits of the block are indexed by (word, bit) = (column, 8 * row + k), and in the packed format by
+ * (k / 2, 16 * (k % 2) + 4 * column + row). The conversion rotates the 7 bits of the index left by 3, which is done as
+ * 6 exchanges of index bits. Each exchange is its own inverse, so the same sequence in reverse order converts back.
+ */
+static void aes_soft_transpose (uint32_t w[4], bool inverse)
+{
+    static const uint8_t exchanges[6] = {2, 3, 0, 4, 0xFF, 1};
+    static const uint8_t word_bit[6]  = {0, 1, 1, 1, 0xFF, 0};
+    static const uint32_t masks[5]    = {0xAAAAAAAAU, 0xCCCCCCCCU, 0xF0F0F0F0U, 0xFF00FF00U, 0xFFFF0000U};
+
+    for (uint32_t i = 0U; i < 6U; i++)
+    {
+        uint32_t step = inverse ? (5U - i) : i;
+        uint32_t a    = exchanges[step];
+
+        if (0xFFU == a)
+        {
+            /* Exchange of the two word index bits. */
+            uint32_t t = w[1];
+            w[1] = w[2];
+            w[2] = t;
+        }
+        else
+        {
+            uint32_t c = word_bit[step];
+            aes_soft_swap_move(&w[0], &w[1U << c], masks[a], 1U << a);
+            aes_soft_swap_move(&w[3U - (1U << c)], &w[3], masks[a], 1U << a);
+        }
+    }
+}
+
+static void aes_soft_load (uint32_t q[8], const unsigned char input[16])
+{
+    uint32_t w[4];
+
+    GET_UINT32_LE(w[0], input, 0);
+    GET_UINT32_LE(w[1], input, 4);
+    GET_UINT32_LE(w[2], input, 8);
+    GET_UINT32_LE(w[3], input, 12);
+
+    aes_soft_transpose(w, false);
+
+    for (uint32_t m = 0U; m < 4U; m++)
+    {
+        q[2U * m]      = w[m] & AES_SOFT_PLANE;
+        q[2U * m + 1U] = w[m] >> 16;
+    }
+}
+
+static void aes_soft_store (unsigned char output[16], const uint32_t q[8])
+{
+    uint32_t w[4];
+
+    for (uint32_t m = 0U; m < 4U; m++)
+    {
+        w[m] = q[2U * m] | (q[2U * m + 1U] << 16);
+    }
+
+    aes_soft_transpose(w, true);
+
+    PUT_UINT32_LE(w[0], output, 0);
+    PUT_UINT32_LE(w[1], output, 4);
+    PUT_UINT32_LE(w[2], output, 8);
+    PUT_UINT32_LE(w[3], output, 12);
+}
+
+/* S-box of every byte: Boyar-Peralta circuit, 113 gates. q[0] holds the least significant bit. */
+static void aes_soft_sub_bytes (uint32_t q[8])
+{
+    uint32_t x0 = q[7];
+    uint32_t x1 = q[6];
+    uint32_t x2 = q[5];
+    uint32_t x3 = q[4];
+    uint32_t x4 = q[3];
+    uint32_t x5 = q[2];
+    uint32_t x6 = q[1];
+    uint32_t x7 = q[0];
+
+    /* Top linear transformation. */
+    uint32_t y14 = x3 ^ x5;
+    uint32_t y13 = x0 ^ x6;
+    uint32_t y9  = x0 ^ x3;
+    uint32_t y8  = x0 ^ x5;
+    uint32_t t0  = x1 ^ x2;
+    uint32_t y1  = t0 ^ x7;
+    uint32_t y4  = y1 ^ x3;
+    uint32_t y12 = y13 ^ y14;
+    uint32_t y2  = y1 ^ x0;
+    uint32_t y5  = y1 ^ x6;
+    uint32_t y3  = y5 ^ y8;
+    uint32_t t1  = x4 ^ y12;
+    uint32_t y15 = t1 ^ x5;
+    uint32_t y20 = t1 ^ x1;
+    uint32_t y6  = y15 ^ x7;
+    uint32_t y10 = y15 ^ t0;
+    uint32_t y11 = y20 ^ y9;
+    uint32_t y7  = x7 ^ y11;
+    uint32_t y17 = y10 ^ y11;
+    uint32_t y19 = y10 ^ y8;
+    uint32_t y16 = t0 ^ y11;
+    uint32_t y21 = y13 ^ y16;
+    uint32_t y18 = x0 ^ y16;
+
+    /* Non-linear section (inversion in GF(2^8)). */
+    uint32_t t2  = y12 & y15;
+    uint32_t t3  = y3 & y6;
+    uint32_t t4  = t3 ^ t2;
+    uint32_t t5  = y4 & x7;
+    uint32_t t6  = t5 ^ t2;
+    uint32_t t7  = y13 & y16;
+    uint32_t t8  = y5 & y1;
+    uint32_t t9  = t8 ^ t7;
+    uint32_t t10 = y2 & y7;
+    uint32_t t11 = t10 ^ t7;
+    uint32_t t12 = y9 & y11;
+    uint32_t t13 = y14 & y17;
+    uint32_t t14 = t13 ^ t12;
+    uint32_t t15 = y8 & y10;
+    uint32_t t16 = t15 ^ t12;
+    uint32_t t17 = t4 ^ t14;
+    uint32_t t18 = t6 ^ t16;
+    uint32_t t19 = t9 ^ t14;
+    uint32_t t20 = t11 ^ t16;
+    uint32_t t21 = t17 ^ y20;
+    uint32_t t22 = t18 ^ y19;
+    uint32_t t23 = t19 ^ y21;
+    uint32_t t24 = t20 ^ y18;
+
+    uint32_t t25 = t21 ^ t22;
+    uint32_t t26 = t21 & t23;
+    uint32_t t27 = t24 ^ t26;
+    uint32_t t28 = t25 & t27;
+    uint32_t t29 = t28 ^ t22;
+    uint32_t t30 = t23 ^ t24;
+    uint32_t t31 = t22 ^ t26;
+    uint32_t t32 = t31 & t30;
+    uint32_t t33 = t32 ^ t24;
+    uint32_t t34 = t23 ^ t33;
+    uint32_t t35 = t27 ^ t33;
+    uint32_t t36 = t24 & t35;
+    uint32_t t37 = t36 ^ t34;
+    uint32_t t38 = t27 ^ t36;
+    uint32_t t39 = t29 & t38;
+    uint32_t t40 = t25 ^ t39;
+
+    uint32_t t41 = t40 ^ t37;
+    uint32_t t42 = t29 ^ t33;
+    uint32_t t43 = t29 ^ t40;
+    uint32_t t44 = t33 ^ t37;
+    uint32_t t45 = t42 ^ t41;
+    uint32_t z0  = t44 & y15;
+    uint32_t z1  = t37 & y6;
+    uint32_t z2  = t33 & x7;
+    uint32_t z3  = t43 & y16;
+    uint32_t z4  = t40 & y1;
+    uint32_t z5  = t29 & y7;
+    uint32_t z6  = t42 & y11;
+    uint32_t z7  = t45 & y17;
+    uint32_t z8  = t41 & y10;
+    uint32_t z9  = t44 & y12;
+    uint32_t z10 = t37 & y3;
+    uint32_t z11 = t33 & y4;
+    uint32_t z12 = t43 & y13;
+    uint32_t z13 = t40 & y5;
+    uint32_t z14 = t29 & y2;
+    uint32_t z15 = t42 & y9;
+    uint32_t z16 = t45 & y14;
+    uint32_t z17 = t41 & y8;
+
+    /* Bottom linear transformation. */
+    uint32_t t46 = z15 ^ z16;
+    uint32_t t47 = z10 ^ z11;
+    uint32_t t48 = z5 ^ z13;
+    uint32_t t49 = z9 ^ z10;
+    uint32_t t50 = z2 ^ z12;
+    uint32_t t51 = z2 ^ z5;
+    uint32_t t52 = z7 ^ z8;
+    uint32_t t53 = z0 ^ z3;
+    uint32_t t54 = z6 ^ z7;
+    uint32_t t55 = z16 ^ z17;
+    uint32_t t56 = z12 ^ t48;
+    uint32_t t57 = t50 ^ t53;
+    uint32_t t58 = z4 ^ t46;
+    uint32_t t59 = z3 ^ t54;
+    uint32_t t60 = t46 ^ t57;
+    uint32_t t61 = z14 ^ t57;
+    uint32_t t62 = t52 ^ t58;
+    uint32_t t63 = t49 ^ t58;
+    uint32_t t64 = z4 ^ t59;
+    uint32_t t65 = t61 ^ t62;
+    uint32_t t66 = z1 ^ t63;
+    uint32_t s0  = t59 ^ t63;
+    uint32_t s6  = t56 ^ ~t62;
+    uint32_t s7  = t48 ^ ~t60;
+    uint32_t t67 = t64 ^ t65;
+    uint32_t s3  = t53 ^ t66;
+    uint32_t s4  = t51 ^ t66;
+    uint32_t s5  = t47 ^ t65;
+    uint32_t s1  = t64 ^ ~s3;
+    uint32_t s2  = t55 ^ ~t67;
+
+    q[7] = s0 & AES_SOFT_PLANE;
+    q[6] = s1 & AES_SOFT_PLANE;
+    q[5] = s2 & AES_SOFT_PLANE;
+    q[4] = s3 & AES_SOFT_PLANE;
+    q[3] = s4 & AES_SOFT_PLANE;
+    q[2] = s5 & AES_SOFT_PLANE;
+    q[1] = s6 & AES_SOFT_PLANE;
+    q[0] = s7 & AES_SOFT_PLANE;
+}
+
+/* Applies x -> L^-1(x ^ 0x63), where S(x) = L(x^-1) ^ 0x63. */
+static void aes_soft_inv_affine (uint32_t q[8])
+{
+    uint32_t q0 = ~q[0];
+    uint32_t q1 = ~q[1];
+    uint32_t q2 = q[2];
+    uint32_t q3 = q[3];
+    uint32_t q4 = q[4];
+    uint32_t q5 = ~q[5];
+    uint32_t q6 = ~q[6];
+    uint32_t q7 = q[7];
+
+    q[7] = (q1 ^ q4 ^ q6) & AES_SOFT_PLANE;
+    q[6] = (q0 ^ q3 ^ q5) & AES_SOFT_PLANE;
+    q[5] = (q7 ^ q2 ^ q4) & AES_SOFT_PLANE;
+    q[4] = (q6 ^ q1 ^ q3) & AES_SOFT_PLANE;
+    q[3] = (q5 ^ q0 ^ q2) & AES_SOFT_PLANE;
+    q[2] = (q4 ^ q7 ^ q1) & AES_SOFT_PLANE;
+    q[1] = (q3 ^ q6 ^ q0) & AES_SOFT_PLANE;
+    q[0] = (q2 ^ q5 ^ q7) & AES_SOFT_PLANE;
+}
+
+/* Inverse S-box of every byte: InvS(y) = M(S(M(y))) with M the map above. */
+static void aes_soft_inv_sub_bytes (uint32_t q[8])
+{
+    aes_soft_inv_affine(q);
+    aes_soft_sub_bytes(q);
+    aes_soft_inv_affine(q);
+}
+
+/* Rotates row r of every column by 4 * r positions: right for ShiftRows (n = 4), left for InvShiftRows (n = 12). */
+static inline uint32_t aes_soft_shift_plane (uint32_t x, uint32_t n)
+{
+    uint32_t r1 = x & AES_SOFT_ROW_1;
+    uint32_t r2 = x & AES_SOFT_ROW_2;
+    uint32_t r3 = x & AES_SOFT_ROW_3;
+
+    r1 = (r1 >> n) | (r1 << (16U - n));
+    r2 = (r2 >> 8U) | (r2 << 8U);
+    r3 = (r3 >> (16U - n)) | (r3 << n);
+
+    return ((x & AES_SOFT_ROW_0) | r1 | r2 | r3) & AES_SOFT_PLANE;
+}
+
+static void aes_soft_shift_rows (uint32_t q[8], uint32_t n)
+{
+    for (uint32_t k = 0U; k < 8U; k++)
+    {
+        q[k] = aes_soft_shift_plane(q[k], n);
+    }
+}
+
+/* Moves row r + 1 (or r + 2) of every column to row r. */
+static inline uint32_t aes_soft_rot_1 (uint32_t x)
+{
+    return ((x >> 1) & (AES_SOFT_ROW_0 | AES_SOFT_ROW_1 | AES_SOFT_ROW_2)) | ((x << 3) & AES_SOFT_ROW_3);
+}
+
+static inline uint32_t aes_soft_rot_2 (uint32_t x)
+{
+    return ((x >> 2) & (AES_SOFT_ROW_0 | AES_SOFT_ROW_1)) | ((x << 2) & (AES_SOFT_ROW_2 | AES_SOFT_ROW_3));
+}
+
+/* Multiplication of every byte by x in GF(2^8). */
+static void aes_soft_xtime (uint32_t out[8], const uint32_t in[8])
+{
+    uint32_t hi = in[7];
+
+    out[7] = in[6];
+    out[6] = in[5];
+    out[5] = in[4];
+    out[4] = in[3] ^ hi;
+    out[3] = in[2] ^ hi;
+    out[2] = in[1];
+    out[1] = in[0] ^ hi;
+    out[0] = hi;
+}
+
+/* out_r = 2 * a_r ^ 3 * a_(r+1) ^ a_(r+2) ^ a_(r+3) = 2 * t_r ^ t_r ^ t_(r+2) ^ a_r with t_r = a_r ^ a_(r+1). */
+static void aes_soft_mix_columns (uint32_t q[8])
+{
+    uint32_t t[8];
+    uint32_t t2[8];
+
+    for (uint32_t k = 0U; k < 8U; k++)
+    {
+        t[k] = q[k] ^ aes_soft_rot_1(q[k]);
+    }
+
+    aes_soft_xtime(t2, t);
+
+    for (uint32_t k = 0U; k < 8U; k++)
+    {
+        q[k] ^= t2[k] ^ t[k] ^ aes_soft_rot_2(t[k]);
+    }
+}
+
+/* InvMixColumns is MixColumns after a_r ^= 4 * (a_r ^ a_(r+2)). */
+static void aes_soft_inv_mix_columns (uint32_t q[8])
+{
+    uint32_t u[8];
+    uint32_t u2[8];
+
+    for (uint32_t k = 0U; k < 8U; k++)
+    {
+        u[k] = q[k] ^ aes_soft_rot_2(q[k]);
+    }
+
+    aes_soft_xtime(u2, u);
+    aes_soft_xtime(u, u2);
+
+    for (uint32_t k = 0U; k < 8U; k++)
+    {
+        q[k] ^= u[k];
+    }
+
+    aes_soft_mix_columns(q);
+}
+
+static void aes_soft_add_round_key (uint32_t q[8], const uint32_t * p_rk)
+{
+    for (uint32_t m = 0U; m < AES_SOFT_RK_WORDS; m++)
+    {
+        q[2U * m]      ^= p_rk[m] & AES_SOFT_PLANE;
+        q[2U * m + 1U] ^= p_rk[m] >> 16;
+    }
+}
+
+/* SubWord of the key schedule, on the low 4 bytes of the state. */
+static uint32_t aes_soft_sub_word (uint32_t word)
+{
+    unsigned char block[16] = {0};
+    uint32_t      q[8];
+
+    PUT_UINT32_LE(word, block, 0);
+    aes_soft_load(q, block);
+    aes_soft_sub_bytes(q);
+    aes_soft_store(block, q);
+    GET_UINT32_LE(word, block, 0);
+
+    mbedtls_platform_zeroize(q, sizeof(q));
+    mbedtls_platform_zeroize(block, sizeof(block));
+
+    return word;
+}
+
+/*
+ * AES key schedule for the software cipher. The same round keys are used for encryption and decryption.
+ */
+int aes_alt_soft_setkey (mbedtls_aes_context * ctx, const unsigned char * key, unsigned int keybits)
+{
+    uint32_t w[AES_SOFT_RK_WORDS * (AES_SOFT_MAX_ROUNDS + 1U)];
+    uint32_t nk;
+
+    switch (keybits)
+    {
+        case 128:
+        {
+            ctx->nr = 10;
+            break;
+        }
+
+        case 192:
+        {
+            ctx->nr = 12;
+            break;
+        }
+
+        case 256:
+        {
+            ctx->nr = 14;
+            break;
+        }
+
+        default:
+        {
+            return MBEDTLS_ERR_AES_INVALID_KEY_LENGTH;
+        }
+    }
+
+    nk = keybits / 32U;
+
+    uint32_t total = AES_SOFT_RK_WORDS * ((uint32_t) ctx->nr + 1U);
+
+    for (uint32_t i = 0U; i < nk; i++)
+    {
+        GET_UINT32_LE(w[i], key, i << 2);
+    }
+
+    for (uint32_t i = nk; i < total; i++)
+    {
+        uint32_t temp = w[i - 1U];
+
+        if (0U == (i % nk))
+        {
+            /* RotWord then SubWord, bytes are little endian in the word. */
+            temp  = aes_soft_sub_word((temp >> 8) | (temp << 24));
+            temp ^= g_aes_soft_rcon[(i / nk) - 1U];
+        }
+        else if ((nk > 6U) && (4U == (i % nk)))
+        {
+            temp = aes_soft_sub_word(temp);
+        }
+        else
+        {
+            /* Nothing to do for the other words. */
+        }
+
+        w[i] = w[i - nk] ^ temp;
+    }
+
+    /* Store each round key in the packed plane format. */
+    for (uint32_t r = 0U; r <= (uint32_t) ctx->nr; r++)
+    {
+        uint32_t * p_rk = &ctx->buf[r * AES_SOFT_RK_WORDS];
+
+        for (uint32_t m = 0U; m < AES_SOFT_RK_WORDS; m++)
+        {
+            p_rk[m] = w[r * AES_SOFT_RK_WORDS + m];
+        }
+
+        aes_soft_transpose(p_rk, false);
+    }
+
+    ctx->rk         = ctx->buf;
+    ctx->vendor_ctx = NULL;
+
+    mbedtls_platform_zeroize(w, sizeof(w));
+
+    return 0;
+}
+
+/*
+ * AES-ECB block encryption with the software cipher.
+ */
+void aes_alt_soft_encrypt (const mbedtls_aes_context * ctx, const unsigned char input[16], unsigned char output[16])
+{
+    const uint32_t * p_rk = ctx->rk;
+    uint32_t         q[8];
+
+    aes_soft_load(q, input);
+    aes_soft_add_round_key(q, p_rk);
+
+    for (int r = 1; r < ctx->nr; r++)
+    {
+        aes_soft_sub_bytes(q);
+        aes_soft_shift_rows(q, 4U);
+        aes_soft_mix_columns(q);
+        aes_soft_add_round_key(q, &p_rk[(uint32_t) r * AES_SOFT_RK_WORDS]);
+    }
+
+    aes_soft_sub_bytes(q);
+    aes_soft_shift_rows(q, 4U);
+    aes_soft_add_round_key(q, &p_rk[(uint32_t) ctx->nr * AES_SOFT_RK_WORDS]);
+
+    aes_soft_store(output, q);
+
+    mbedtls_platform_zeroize(q, sizeof(q));
+}
+
+/*
+ * AES-ECB block decryption with the software cipher.
+ */
+void aes_alt_soft_decrypt (const mbedtls_aes_context * ctx, const unsigned char input[16], unsigned char output[16])
+{
+    const uint32_t * p_rk = ctx->rk;
+    uint32_t         q[8];
+
+    aes_soft_load(q, input);
+    aes_soft_add_round_key(q, &p_rk[(uint32_t) ctx->nr * AES_SOFT_RK_WORDS]);
+
+    for (int r = ctx->nr - 1; r > 0; r--)
+    {
+        aes_soft_shift_rows(q, 12U);
+        aes_soft_inv_sub_bytes(q);
+        aes_soft_add_round_key(q, &p_rk[(uint32_t) r * AES_SOFT_RK_WORDS]);
+        aes_soft_inv_mix_columns(q);
+    }
+
+    aes_soft_shift_rows(q, 12U);
+    aes_soft_inv_sub_bytes(q);
+    aes_soft_add_round_key(q, p_rk);
+
+    aes_soft_store(output, q);
+
+    mbedtls_platform_zeroize(q, sizeof(q));
+}
+
+ #endif                                /* PSA_CRYPTO_CFG_AES_SOFT_FALLBACK */
+
+#endif                                 /* MBEDTLS_AES_C && MBEDTLS_AES_ALT */
@@ -27,6 +27,7 @@
 #if defined(MBEDTLS_PSA_CRYPTO_ACCEL_DRV_C)
 
  #include "aes_vendor.h"
+ #include "rm_psa_crypto.h"
 
 /** Determine standard key size in bits for a vendor type key bit size associated with an elliptic curve.
  *  THis function is invoked during key generation and the user specifies the bits which will be the
@@ -113,7 +114,7 @@ psa_status_t prepare_raw_data_slot_vendor (psa_key_type_t type, size_t bits, str
 
 /*************crypto_accel_driver.h implementations follow***************************/
 
-psa_status_t psa_generate_symmetric_vendor (psa_key_type_t type, size_t bits, uint8_t * output, size_t output_size)
+static psa_status_t psa_generate_symmetric_sce (psa_key_type_t type, size_t bits, uint8_t * output, size_t output_size)
 {
     fsp_err_t err = FSP_SUCCESS;
     int       ret = PSA_SUCCESS;
@@ -197,6 +198,20 @@ psa_status_t psa_generate_symmetric_vendor (psa_key_type_t type, size_t bits, ui
     return ret;
 }
 
+psa_status_t psa_generate_symmetric_vendor (psa_key_type_t type, size_t bits, uint8_t * output, size_t output_size)
+{
+    if (FSP_SUCCESS != RM_PSA_CRYPTO_SCE_ACQUIRE())
+    {
+        return PSA_ERROR_HARDWARE_FAILURE;
+    }
+
+    psa_status_t ret = psa_generate_symmetric_sce(type, bits, output, output_size);
+
+    RM_PSA_CRYPTO_SCE_RELEASE();
+
+    return ret;
+}
+
 psa_status_t psa_cipher_setup_vendor (psa_cipher_operation_t * operation,
                                       psa_key_handle_t         handle,
                                       psa_algorithm_t          alg,
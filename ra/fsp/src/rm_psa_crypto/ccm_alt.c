@@ -0,0 +1,460 @@
+/***********************************************************************************************************************
+ * Copyright [2020] Renesas Electronics Corporation and/or its affiliates.  All Rights Reserved.
+ *
+ * This software and documentation are supplied by Renesas Electronics America Inc. and may only be used with products
+ * of Renesas Electronics Corp. and its affiliates ("Renesas").  No other uses are authorized.  Renesas products are
+ * sold pursuant to Renesas terms and conditions of sale.  Purchasers are solely responsible for the selection and use
+ * of Renesas products and Renesas assumes no liability.  No license, express or implied, to any intellectual property
+ * right is granted by Renesas. This software is protected under all applicable laws, including copyright laws. Renesas
+ * reserves the right to change or discontinue this software and/or this documentation. THE SOFTWARE AND DOCUMENTATION
+ * IS DELIVERED TO YOU "AS IS," AND RENESAS MAKES NO REPRESENTATIONS OR WARRANTIES, AND TO THE FULLEST EXTENT
+ * PERMISSIBLE UNDER APPLICABLE LAW, DISCLAIMS ALL WARRANTIES, WHETHER EXPLICITLY OR IMPLICITLY, INCLUDING WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, AND NONINFRINGEMENT, WITH RESPECT TO THE SOFTWARE OR
+ * DOCUMENTATION.  RENESAS SHALL HAVE NO LIABILITY ARISING OUT OF ANY SECURITY VULNERABILITY OR BREACH.  TO THE MAXIMUM
+ * EXTENT PERMITTED BY LAW, IN NO EVENT WILL RENESAS BE LIABLE TO YOU IN CONNECTION WITH THE SOFTWARE OR DOCUMENTATION
+ * (OR ANY PERSON OR ENTITY CLAIMING RIGHTS DERIVED FROM YOU) FOR ANY LOSS, DAMAGES, OR CLAIMS WHATSOEVER, INCLUDING,
+ * WITHOUT LIMITATION, ANY DIRECT, CONSEQUENTIAL, SPECIAL, INDIRECT, PUNITIVE, OR INCIDENTAL DAMAGES; ANY LOST PROFITS,
+ * OTHER ECONOMIC DAMAGE, PROPERTY DAMAGE, OR PERSONAL INJURY; AND EVEN IF RENESAS HAS BEEN ADVISED OF THE POSSIBILITY
+ * OF SUCH LOSS, DAMAGES, CLAIMS OR COSTS.
+ **********************************************************************************************************************/
+
+#if !defined(MBEDTLS_CONFIG_FILE)
+ #include "mbedtls/config.h"
+#else
+ #include MBEDTLS_CONFIG_FILE
+#endif
+
+#if defined(MBEDTLS_CCM_C)
+
+ #include "mbedtls/ccm.h"
+ #include "mbedtls/platform_util.h"
+
+ #include <string.h>
+
+ #if defined(MBEDTLS_PLATFORM_C)
+  #include "mbedtls/platform.h"
+ #else
+  #include <stdlib.h>
+  #define mbedtls_calloc    calloc
+  #define mbedtls_free      free
+ #endif                                /* MBEDTLS_PLATFORM_C */
+
+ #if defined(MBEDTLS_CCM_ALT)
+  #include "hw_sce_aes_private.h"
+  #include "hw_sce_private.h"
+  #include "rm_psa_crypto.h"
+
+  #if !BSP_FEATURE_CRYPTO_HAS_SCE9
+   #error "MBEDTLS_CCM_ALT requires the SCE9 AES-CCM engine."
+  #endif
+
+  #define CCM_VALIDATE_RET(cond)    MBEDTLS_INTERNAL_VALIDATE_RET(cond, MBEDTLS_ERR_CCM_BAD_INPUT)
+  #define CCM_VALIDATE(cond)        MBEDTLS_INTERNAL_VALIDATE(cond)
+
+  #define CCM_ALT_ENCRYPT             (0U)
+  #define CCM_ALT_DECRYPT             (1U)
+
+/* B0 followed by the encoded AAD. Headers up to this size are built on the stack, larger ones on the heap. */
+  #define CCM_ALT_HEADER_STACK_BYTES    (64U)
+  #define CCM_ALT_AAD_MAX_BYTES         (0xFF00U)
+
+static uint32_t ccm_key_bits(const mbedtls_ccm_context * ctx);
+static int      ccm_auth_crypt(mbedtls_ccm_context * ctx,
+                               uint32_t              decrypt,
+                               size_t                length,
+                               const unsigned char * iv,
+                               size_t                iv_len,
+                               const unsigned char * add,
+                               size_t                add_len,
+                               const unsigned char * input,
+                               unsigned char       * output,
+                               unsigned char       * tag,
+                               size_t                tag_len);
+
+/*******************************************************************************************************************//**
+ * @addtogroup RM_PSA_CRYPTO
+ * @{
+ **********************************************************************************************************************/
+
+/*
+ * Initialize a context
+ */
+void mbedtls_ccm_init (mbedtls_ccm_context * ctx)
+{
+    CCM_VALIDATE(ctx != NULL);
+    memset(ctx, 0, sizeof(mbedtls_ccm_context));
+    mbedtls_aes_init(&ctx->aes);
+}
+
+/*******************************************************************************************************************//**
+ * Generates the SCE key index for the AES key.
+ *
+ * @retval 0                                       Key set successfully.
+ * @retval MBEDTLS_ERR_CCM_BAD_INPUT               Cipher is not AES or the key length is not supported.
+ * @retval MBEDTLS_ERR_PLATFORM_HW_ACCEL_FAILED    Key index generation failed.
+ **********************************************************************************************************************/
+int mbedtls_ccm_setkey (mbedtls_ccm_context * ctx,
+                        mbedtls_cipher_id_t   cipher,
+                        const unsigned char * key,
+                        unsigned int          keybits)
+{
+    CCM_VALIDATE_RET(ctx != NULL);
+    CCM_VALIDATE_RET(key != NULL);
+
+    if ((MBEDTLS_CIPHER_ID_AES != cipher) ||
+        ((128U != keybits) && (192U != keybits) && (256U != keybits)))
+    {
+        return MBEDTLS_ERR_CCM_BAD_INPUT;
+    }
+
+    mbedtls_aes_free(&ctx->aes);
+    mbedtls_aes_init(&ctx->aes);
+
+    if (0 != mbedtls_aes_setkey_enc(&ctx->aes, key, keybits))
+    {
+        return MBEDTLS_ERR_PLATFORM_HW_ACCEL_FAILED;
+    }
+
+    return 0;
+}
+
+void mbedtls_ccm_free (mbedtls_ccm_context * ctx)
+{
+    if (ctx == NULL)
+    {
+        return;
+    }
+
+    mbedtls_aes_free(&ctx->aes);
+    mbedtls_platform_zeroize(ctx, sizeof(mbedtls_ccm_context));
+}
+
+/*******************************************************************************************************************//**
+ * Encrypts the data and generates the tag on the SCE AES-CCM engine in a single pass. The SCE cannot produce CCM*
+ * output without a tag, so tag_len must be at least 4.
+ *
+ * @retval 0                                       Data encrypted.
+ * @retval MBEDTLS_ERR_CCM_BAD_INPUT               Invalid nonce, AAD, text or tag length.
+ * @retval MBEDTLS_ERR_PLATFORM_FEATURE_UNSUPPORTED tag_len is 0.
+ * @retval MBEDTLS_ERR_PLATFORM_HW_ACCEL_FAILED    The SCE operation failed.
+ **********************************************************************************************************************/
+int mbedtls_ccm_star_encrypt_and_tag (mbedtls_ccm_context * ctx,
+                                      size_t                length,
+                                      const unsigned char * iv,
+                                      size_t                iv_len,
+                                      const unsigned char * add,
+                                      size_t                add_len,
+                                      const unsigned char * input,
+                                      unsigned char       * output,
+                                      unsigned char       * tag,
+                                      size_t                tag_len)
+{
+    CCM_VALIDATE_RET(ctx != NULL);
+    CCM_VALIDATE_RET(iv != NULL);
+    CCM_VALIDATE_RET(add_len == 0 || add != NULL);
+    CCM_VALIDATE_RET(length == 0 || input != NULL);
+    CCM_VALIDATE_RET(length == 0 || output != NULL);
+    CCM_VALIDATE_RET(tag_len == 0 || tag != NULL);
+
+    return ccm_auth_crypt(ctx, CCM_ALT_ENCRYPT, length, iv, iv_len, add, add_len, input, output, tag, tag_len);
+}
+
+int mbedtls_ccm_encrypt_and_tag (mbedtls_ccm_context * ctx,
+                                 size_t                length,
+                                 const unsigned char * iv,
+                                 size_t                iv_len,
+                                 const unsigned char * add,
+                                 size_t                add_len,
+                                 const unsigned char * input,
+                                 unsigned char       * output,
+                                 unsigned char       * tag,
+                                 size_t                tag_len)
+{
+    CCM_VALIDATE_RET(ctx != NULL);
+    CCM_VALIDATE_RET(iv != NULL);
+    CCM_VALIDATE_RET(add_len == 0 || add != NULL);
+    CCM_VALIDATE_RET(length == 0 || input != NULL);
+    CCM_VALIDATE_RET(length == 0 || output != NULL);
+    CCM_VALIDATE_RET(tag != NULL);
+
+    if (0U == tag_len)
+    {
+        return MBEDTLS_ERR_CCM_BAD_INPUT;
+    }
+
+    return mbedtls_ccm_star_encrypt_and_tag(ctx, length, iv, iv_len, add, add_len, input, output, tag, tag_len);
+}
+
+/*******************************************************************************************************************//**
+ * Decrypts the data and verifies the tag on the SCE AES-CCM engine in a single pass.
+ *
+ * @retval 0                                       Data decrypted and tag verified.
+ * @retval MBEDTLS_ERR_CCM_AUTH_FAILED             Tag does not match. The output buffer is cleared.
+ * @retval MBEDTLS_ERR_CCM_BAD_INPUT               Invalid nonce, AAD, text or tag length.
+ * @retval MBEDTLS_ERR_PLATFORM_FEATURE_UNSUPPORTED tag_len is 0.
+ * @retval MBEDTLS_ERR_PLATFORM_HW_ACCEL_FAILED    The SCE operation failed.
+ **********************************************************************************************************************/
+int mbedtls_ccm_star_auth_decrypt (mbedtls_ccm_context * ctx,
+                                   size_t                length,
+                                   const unsigned char * iv,
+                                   size_t                iv_len,
+                                   const unsigned char * add,
+                                   size_t                add_len,
+                                   const unsigned char * input,
+                                   unsigned char       * output,
+                                   const unsigned char * tag,
+                                   size_t                tag_len)
+{
+    CCM_VALIDATE_RET(ctx != NULL);
+    CCM_VALIDATE_RET(iv != NULL);
+    CCM_VALIDATE_RET(add_len == 0 || add != NULL);
+    CCM_VALIDATE_RET(length == 0 || input != NULL);
+    CCM_VALIDATE_RET(length == 0 || output != NULL);
+    CCM_VALIDATE_RET(tag_len == 0 || tag != NULL);
+
+    return ccm_auth_crypt(ctx,
+                          CCM_ALT_DECRYPT,
+                          length,
+                          iv,
+                          iv_len,
+                          add,
+                          add_len,
+                          input,
+                          output,
+                          (unsigned char *) tag,
+                          tag_len);
+}
+
+int mbedtls_ccm_auth_decrypt (mbedtls_ccm_context * ctx,
+                              size_t                length,
+                              const unsigned char * iv,
+                              size_t                iv_len,
+                              const unsigned char * add,
+                              size_t                add_len,
+                              const unsigned char * input,
+                              unsigned char       * output,
+                              const unsigned char * tag,
+                              size_t                tag_len)
+{
+    CCM_VALIDATE_RET(ctx != NULL);
+    CCM_VALIDATE_RET(iv != NULL);
+    CCM_VALIDATE_RET(add_len == 0 || add != NULL);
+    CCM_VALIDATE_RET(length == 0 || input != NULL);
+    CCM_VALIDATE_RET(length == 0 || output != NULL);
+    CCM_VALIDATE_RET(tag != NULL);
+
+    if (0U == tag_len)
+    {
+        return MBEDTLS_ERR_CCM_BAD_INPUT;
+    }
+
+    return mbedtls_ccm_star_auth_decrypt(ctx, length, iv, iv_len, add, add_len, input, output, tag, tag_len);
+}
+
+/*******************************************************************************************************************//**
+ * @} (end addtogroup RM_PSA_CRYPTO)
+ **********************************************************************************************************************/
+
+static uint32_t ccm_key_bits (const mbedtls_ccm_context * ctx)
+{
+    if (10 == ctx->aes.nr)
+    {
+        return SIZE_AES_128BIT_KEYLEN_BITS;
+    }
+
+    if (12 == ctx->aes.nr)
+    {
+        return SIZE_AES_192BIT_KEYLEN_BITS;
+    }
+
+    if (14 == ctx->aes.nr)
+    {
+        return SIZE_AES_256BIT_KEYLEN_BITS;
+    }
+
+    /* No key set. The SCE adaptor rejects this size. */
+    return 0U;
+}
+
+/*
+ * Formats B0, the encoded AAD and the first counter block (NIST SP 800-38C appendix A) and runs the whole operation
+ * on the SCE. In decrypt mode tag holds the expected tag.
+ */
+static int ccm_auth_crypt_sce (mbedtls_ccm_context * ctx,
+                               uint32_t              decrypt,
+                               size_t                length,
+                               const unsigned char * iv,
+                               size_t                iv_len,
+                               const unsigned char * add,
+                               size_t                add_len,
+                               const unsigned char * input,
+                               unsigned char       * output,
+                               unsigned char       * tag,
+                               size_t                tag_len)
+{
+    int             ret         = 0;
+    fsp_err_t       err;
+    uint32_t        key_bits    = ccm_key_bits(ctx);
+    size_t          q           = 15U - iv_len;
+    size_t          aad_enc_len = (0U != add_len) ? (add_len + 2U) : 0U;
+    size_t          header_len  = SIZE_AES_BLOCK_BYTES +
+                                  ((aad_enc_len + (SIZE_AES_BLOCK_BYTES - 1U)) & ~((size_t) SIZE_AES_BLOCK_BYTES - 1U));
+    size_t          full_len    = length & ~((size_t) SIZE_AES_BLOCK_BYTES - 1U);
+    size_t          rest_len    = length - full_len;
+    uint32_t        header_stack[CCM_ALT_HEADER_STACK_BYTES / sizeof(uint32_t)] = {0};
+    uint32_t        counter[SIZE_AES_BLOCK_WORDS]  = {0};
+    uint32_t        last_in[SIZE_AES_BLOCK_WORDS]  = {0};
+    uint32_t        last_out[SIZE_AES_BLOCK_WORDS] = {0};
+    uint32_t        mac[SIZE_AES_BLOCK_WORDS]      = {0};
+    uint32_t        text_len_word;
+    uint32_t        tag_len_word;
+    uint32_t      * p_header = header_stack;
+    unsigned char * p_b;
+
+    if ((2U == tag_len) || (tag_len > SIZE_AES_BLOCK_BYTES) || (0U != (tag_len % 2U)))
+    {
+        return MBEDTLS_ERR_CCM_BAD_INPUT;
+    }
+
+    if ((iv_len < 7U) || (iv_len > 13U) || (add_len >= CCM_ALT_AAD_MAX_BYTES))
+    {
+        return MBEDTLS_ERR_CCM_BAD_INPUT;
+    }
+
+    if ((q < sizeof(length)) && (length >= (((size_t) 1U) << (q * 8U))))
+    {
+        return MBEDTLS_ERR_CCM_BAD_INPUT;
+    }
+
+    /* The SCE only supports authenticated CCM. */
+    if (0U == tag_len)
+    {
+        return MBEDTLS_ERR_PLATFORM_FEATURE_UNSUPPORTED;
+    }
+
+    if (header_len > sizeof(header_stack))
+    {
+        p_header = mbedtls_calloc(header_len / sizeof(uint32_t), sizeof(uint32_t));
+        if (NULL == p_header)
+        {
+            return MBEDTLS_ERR_PLATFORM_HW_ACCEL_FAILED;
+        }
+    }
+
+    /* B0: flags | nonce | message length */
+    p_b    = (unsigned char *) p_header;
+    p_b[0] = (unsigned char) (((0U != add_len) ? 0x40U : 0U) | (((tag_len - 2U) / 2U) << 3) | (q - 1U));
+    memcpy(&p_b[1], iv, iv_len);
+    for (size_t i = 0U, len_left = length; i < q; i++, len_left >>= 8)
+    {
+        p_b[15U - i] = (unsigned char) (len_left & 0xFFU);
+    }
+
+    /* Encoded AAD: 16-bit length followed by the data, zero padded to a whole block. */
+    if (0U != add_len)
+    {
+        p_b[SIZE_AES_BLOCK_BYTES]      = (unsigned char) ((add_len >> 8) & 0xFFU);
+        p_b[SIZE_AES_BLOCK_BYTES + 1U] = (unsigned char) (add_len & 0xFFU);
+        memcpy(&p_b[SIZE_AES_BLOCK_BYTES + 2U], add, add_len);
+    }
+
+    /* Ctr0: flags | nonce | 0 */
+    p_b    = (unsigned char *) counter;
+    p_b[0] = (unsigned char) (q - 1U);
+    memcpy(&p_b[1], iv, iv_len);
+
+    err = HW_SCE_AES_CcmInit(key_bits, decrypt, ctx->aes.buf, counter, p_header,
+                             (uint32_t) (header_len / sizeof(uint32_t)));
+    if (FSP_SUCCESS != err)
+    {
+        ret = MBEDTLS_ERR_PLATFORM_HW_ACCEL_FAILED;
+    }
+    else
+    {
+        if (0U != full_len)
+        {
+            HW_SCE_AES_CcmUpdate(key_bits, decrypt, (const uint32_t *) input, (uint32_t *) output,
+                                 (uint32_t) (full_len / sizeof(uint32_t))); // NOLINT(rea-tp-casting)
+        }
+
+        memcpy(last_in, &input[full_len], rest_len);
+        text_len_word = __REV((uint32_t) length);
+
+        if (CCM_ALT_ENCRYPT == decrypt)
+        {
+            err = HW_SCE_AES_CcmEncryptFinal(key_bits, &text_len_word, last_in, last_out, mac);
+            if (FSP_SUCCESS != err)
+            {
+                ret = MBEDTLS_ERR_PLATFORM_HW_ACCEL_FAILED;
+            }
+            else
+            {
+                memcpy(tag, mac, tag_len);
+            }
+        }
+        else
+        {
+            memcpy(mac, tag, tag_len);
+            tag_len_word = __REV((uint32_t) tag_len);
+
+            /* The SCE reports a tag mismatch as a failure of the final procedure. */
+            err = HW_SCE_AES_CcmDecryptFinal(key_bits, last_in, &text_len_word, mac, &tag_len_word, last_out);
+            if (FSP_SUCCESS != err)
+            {
+                ret = MBEDTLS_ERR_CCM_AUTH_FAILED;
+            }
+        }
+    }
+
+    if (0 == ret)
+    {
+        memcpy(&output[full_len], last_out, rest_len);
+    }
+    else if (CCM_ALT_DECRYPT == decrypt)
+    {
+        mbedtls_platform_zeroize(output, length);
+    }
+    else
+    {
+        /* Do nothing. */
+    }
+
+    mbedtls_platform_zeroize(last_in, sizeof(last_in));
+    mbedtls_platform_zeroize(last_out, sizeof(last_out));
+    mbedtls_platform_zeroize(mac, sizeof(mac));
+    mbedtls_platform_zeroize(p_header, header_len);
+
+    if (p_header != header_stack)
+    {
+        mbedtls_free(p_header);
+    }
+
+    return ret;
+}
+
+static int ccm_auth_crypt (mbedtls_ccm_context * ctx,
+                           uint32_t              decrypt,
+                           size_t                length,
+                           const unsigned char * iv,
+                           size_t                iv_len,
+                           const unsigned char * add,
+                           size_t                add_len,
+                           const unsigned char * input,
+                           unsigned char       * output,
+                           unsigned char       * tag,
+                           size_t                tag_len)
+{
+    if (FSP_SUCCESS != RM_PSA_CRYPTO_SCE_ACQUIRE())
+    {
+        return MBEDTLS_ERR_PLATFORM_HW_ACCEL_FAILED;
+    }
+
+    int ret = ccm_auth_crypt_sce(ctx, decrypt, length, iv, iv_len, add, add_len, input, output, tag, tag_len);
+
+    RM_PSA_CRYPTO_SCE_RELEASE();
+
+    return ret;
+}
+
+ #endif                                /* MBEDTLS_CCM_ALT */
+#endif                                 /* MBEDTLS_CCM_C */
@@ -621,6 +621,21 @@ int mbedtls_ctr_drbg_random( void *p_rng, unsigned char *output,
         return( ret );
 #endif
 
+#if defined(MBEDTLS_CTR_DRBG_POOL_SIZE)
+    /*
+     * Serve small requests from the pre-generated pool. Bytes are taken from
+     * the end of the pool and wiped so they are never handed out twice.
+     */
+    if( output_len <= MBEDTLS_CTR_DRBG_POOL_MAX_REQUEST &&
+        output_len <= ctx->pool_len && ! ctx->prediction_resistance )
+    {
+        ctx->pool_len -= output_len;
+        memcpy( output, &ctx->pool[ctx->pool_len], output_len );
+        mbedtls_platform_zeroize( &ctx->pool[ctx->pool_len], output_len );
+        ret = 0;
+    }
+    else
+#endif
     ret = mbedtls_ctr_drbg_random_with_add( ctx, output, output_len, NULL, 0 );
 
 #if defined(MBEDTLS_THREADING_C)
@@ -631,6 +646,39 @@ int mbedtls_ctr_drbg_random( void *p_rng, unsigned char *output,
     return( ret );
 }
 
+#if defined(MBEDTLS_CTR_DRBG_POOL_SIZE)
+int mbedtls_ctr_drbg_pool_fill( mbedtls_ctr_drbg_context *ctx )
+{
+    int ret = 0;
+    size_t use_len;
+
+#if defined(MBEDTLS_THREADING_C)
+    if( ( ret = mbedtls_mutex_lock( &ctx->mutex ) ) != 0 )
+        return( ret );
+#endif
+
+    while( ret == 0 && ctx->pool_len < MBEDTLS_CTR_DRBG_POOL_SIZE &&
+           ! ctx->prediction_resistance )
+    {
+        use_len = MBEDTLS_CTR_DRBG_POOL_SIZE - ctx->pool_len;
+        if( use_len > MBEDTLS_CTR_DRBG_MAX_REQUEST )
+            use_len = MBEDTLS_CTR_DRBG_MAX_REQUEST;
+
+        ret = mbedtls_ctr_drbg_random_with_add( ctx, &ctx->pool[ctx->pool_len],
+                                                use_len, NULL, 0 );
+        if( ret == 0 )
+            ctx->pool_len += use_len;
+    }
+
+#if defined(MBEDTLS_THREADING_C)
+    if( mbedtls_mutex_unlock( &ctx->mutex ) != 0 )
+        return( MBEDTLS_ERR_THREADING_MUTEX_ERROR );
+#endif
+
+    return( ret );
+}
+#endif /* MBEDTLS_CTR_DRBG_POOL_SIZE */
+
 #if defined(MBEDTLS_FS_IO)
 int mbedtls_ctr_drbg_write_seed_file( mbedtls_ctr_drbg_context *ctx,
                                       const char *path )
@@ -83,6 +83,13 @@ static int ecdh_gen_public_restartable( mbedtls_ecp_group *grp,
                     void *p_rng,
                     mbedtls_ecp_restart_ctx *rs_ctx )
 {
+#if defined(MBEDTLS_ECP_ALT)
+    /* The SCE operations are not restartable. Take a pregenerated key pair,
+     * or generate one without the separate multiplication by G. */
+    (void) rs_ctx;
+
+    return( mbedtls_ecp_gen_ephemeral( grp, d, Q, f_rng, p_rng ) );
+#else
     int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
 
     /* If multiplication is in progress, we already generated a privkey */
@@ -96,6 +103,7 @@ static int ecdh_gen_public_restartable( mbedtls_ecp_group *grp,
 
 cleanup:
     return( ret );
+#endif /* MBEDTLS_ECP_ALT */
 }
 
 /*
@@ -163,6 +171,38 @@ int mbedtls_ecdh_compute_shared( mbedtls_ecp_group *grp, mbedtls_mpi *z,
 }
 #endif /* !MBEDTLS_ECDH_COMPUTE_SHARED_ALT */
 
+#if defined(MBEDTLS_ECP_ALT)
+/*
+ * Generate an ephemeral key pair and compute the shared secret
+ */
+int mbedtls_ecdh_gen_compute_shared( mbedtls_ecp_group *grp,
+                         mbedtls_ecp_point *Q, mbedtls_mpi *z,
+                         const mbedtls_ecp_point *Qp,
+                         int (*f_rng)(void *, unsigned char *, size_t),
+                         void *p_rng )
+{
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+    mbedtls_mpi d;
+
+    ECDH_VALIDATE_RET( grp != NULL );
+    ECDH_VALIDATE_RET( Q != NULL );
+    ECDH_VALIDATE_RET( z != NULL );
+    ECDH_VALIDATE_RET( Qp != NULL );
+
+    mbedtls_mpi_init( &d );
+
+    MBEDTLS_MPI_CHK( mbedtls_ecp_gen_ephemeral( grp, &d, Q, f_rng, p_rng ) );
+    MBEDTLS_MPI_CHK( mbedtls_ecdh_compute_shared( grp, z, Qp, &d,
+                                                  f_rng, p_rng ) );
+
+cleanup:
+    /* mbedtls_mpi_free() wipes the private key */
+    mbedtls_mpi_free( &d );
+
+    return( ret );
+}
+#endif /* MBEDTLS_ECP_ALT */
+
 static void ecdh_init_internal( mbedtls_ecdh_context_mbed *ctx )
 {
     mbedtls_ecp_group_init( &ctx->grp );
@@ -58,6 +58,7 @@ uint32_t ecp_load_key_size(bool wrapped_mode_ctx, mbedtls_ecp_group * grp);
  #if (defined(MBEDTLS_ECDSA_SIGN_ALT) || defined(MBEDTLS_ECDSA_VERIFY_ALT) || defined(MBEDTLS_ECP_ALT))
 
   #include "hw_sce_ecc_private.h"
+  #include "rm_psa_crypto.h"
 
 static void ecp_mpi_load(mbedtls_mpi * X, const mbedtls_mpi_uint * p, size_t len) __attribute__((unused));
 int         ecp_load_parameters_sce(const mbedtls_ecp_group * grp, uint8_t * p_curve_params_buff);
@@ -392,14 +393,14 @@ int ecp_load_curve_attributes_sce (const mbedtls_ecp_group * grp, uint32_t * p_c
  * Compute ECDSA signature of a hashed message
  */
 
-int mbedtls_ecdsa_sign (mbedtls_ecp_group * grp,
-                        mbedtls_mpi * r,
-                        mbedtls_mpi * s,
-                        const mbedtls_mpi * d,
-                        const unsigned char * buf,
-                        size_t blen,
-                        int (* f_rng)(void *, unsigned char *, size_t),
-                        void * p_rng)
+static int ecdsa_sign_sce (mbedtls_ecp_group * grp,
+                           mbedtls_mpi * r,
+                           mbedtls_mpi * s,
+                           const mbedtls_mpi * d,
+                           const unsigned char * buf,
+                           size_t blen,
+                           int (* f_rng)(void *, unsigned char *, size_t),
+                           void * p_rng)
 {
     (void) blen;
     (void) f_rng;
@@ -568,34 +569,53 @@ int mbedtls_ecdsa_sign (mbedtls_ecp_group * grp,
     return ret;
 }
 
+int mbedtls_ecdsa_sign (mbedtls_ecp_group * grp,
+                        mbedtls_mpi * r,
+                        mbedtls_mpi * s,
+                        const mbedtls_mpi * d,
+                        const unsigned char * buf,
+                        size_t blen,
+                        int (* f_rng)(void *, unsigned char *, size_t),
+                        void * p_rng)
+{
+    if (FSP_SUCCESS != RM_PSA_CRYPTO_SCE_ACQUIRE())
+    {
+        return MBEDTLS_ERR_PLATFORM_HW_ACCEL_FAILED;
+    }
+
+    int ret = ecdsa_sign_sce(grp, r, s, d, buf, blen, f_rng, p_rng);
+
+    RM_PSA_CRYPTO_SCE_RELEASE();
+
+    return ret;
+}
+
  #endif                                /* MBEDTLS_ECDSA_SIGN_ALT */
 
  #if defined(MBEDTLS_ECDSA_VERIFY_ALT)
 
-/*
- * Verify ECDSA signature of hashed message
- */
-int mbedtls_ecdsa_verify (mbedtls_ecp_group       * grp,
-                          const unsigned char     * buf,
-                          size_t                    blen,
-                          const mbedtls_ecp_point * Q,
-                          const mbedtls_mpi       * r,
-                          const mbedtls_mpi       * s)
+/* Working state of a verification. The curve parameters and the most recently loaded public key are kept in the
+ * SCE input buffer, so verifying several signatures only converts what changes between them. */
+typedef struct st_ecdsa_verify_ctx
 {
-    (void) blen;
-
-    ECDSA_VALIDATE_RET(grp != NULL);
-    ECDSA_VALIDATE_RET(Q != NULL);
-    ECDSA_VALIDATE_RET(r != NULL);
-    ECDSA_VALIDATE_RET(s != NULL);
-    ECDSA_VALIDATE_RET(buf != NULL || blen == 0);
-
-    int        ret;
-    uint32_t * p_public_key_buff_32;
-    uint32_t * p_signature_buff_32;
-    uint32_t * p_common_buff_32;
-    uint8_t  * p_buf_8;
+    hw_sce_ecc_verifysign_t   p_hw_sce_ecc_verifysign;
+    size_t                    curve_bytes;
+    uint32_t                * p_common_buff_32;
+    uint32_t                * p_public_key_buff_32;
+    uint32_t                * p_signature_buff_32;
+    uint8_t                 * p_buf_8;
+    const mbedtls_ecp_point * p_loaded_q;
+#if BSP_FEATURE_CRYPTO_HAS_SCE9
+    uint32_t curve_type;
+    uint32_t cmd;
+#else
+    uint32_t * p_curve_params_buff_32;
+#endif
+} ecdsa_verify_ctx_t;
 
+static int ecdsa_verify_setup (mbedtls_ecp_group * grp, ecdsa_verify_ctx_t * p_ctx)
+{
+    int    ret         = 0;
     size_t curve_bytes = PSA_BITS_TO_BYTES(grp->pbits);
 
   #if defined(MBEDTLS_CHECK_PARAMS)
@@ -611,27 +631,67 @@ int mbedtls_ecdsa_verify (mbedtls_ecp_group       * grp,
         return MBEDTLS_ERR_ECP_FEATURE_UNAVAILABLE;
     }
 
-    hw_sce_ecc_verifysign_t p_hw_sce_ecc_verifysign =
-        g_ecdsa_verify_sign_lookup[RM_PSA_CRYPTO_ECP_LOOKUP_INDEX(grp->pbits)]
-    ;
-    if (NULL == p_hw_sce_ecc_verifysign)
+    p_ctx->p_hw_sce_ecc_verifysign = g_ecdsa_verify_sign_lookup[RM_PSA_CRYPTO_ECP_LOOKUP_INDEX(grp->pbits)];
+    if (NULL == p_ctx->p_hw_sce_ecc_verifysign)
     {
         return MBEDTLS_ERR_PLATFORM_FEATURE_UNSUPPORTED;
     }
+
+    p_ctx->curve_bytes = curve_bytes;
+    p_ctx->p_loaded_q  = NULL;
 #if BSP_FEATURE_CRYPTO_HAS_SCE9
     /* Obtain a 32-bit aligned block of memory. It will be used for all the following items in this order:
      * Public Key (Q) of size curve_bytes * 2
      * Signature (rs) of size curve_bytes * 2
      * Padded/truncated 32-bit aligned copy of input hash of size curve_bytes  */
-    p_common_buff_32 = mbedtls_calloc(((curve_bytes * 5) / 4), sizeof(uint32_t));
+    p_ctx->p_common_buff_32 = mbedtls_calloc(((curve_bytes * 5) / 4), sizeof(uint32_t));
 
-    if (NULL == p_common_buff_32)
+    if (NULL == p_ctx->p_common_buff_32)
     {
         return MBEDTLS_ERR_ECP_ALLOC_FAILED;
     }
 
-    p_public_key_buff_32   = p_common_buff_32;
-    p_signature_buff_32    = p_public_key_buff_32 + ((curve_bytes * 2) / 4);
+    p_ctx->p_public_key_buff_32 = p_ctx->p_common_buff_32;
+
+    ret = ecp_load_curve_attributes_sce(grp, &p_ctx->curve_type, &p_ctx->cmd, NULL);
+#else
+    /* Obtain a 32-bit aligned block of memory. It will be used for all the following items in this order:
+     * Curve parameters a, b, p, n, Gx, Gy. Each of the 6 fields are of size curve_bytes = PSA_BITS_TO_BYTES( ecp->grp.pbits )
+     * Public Key (Q) of size curve_bytes * 2
+     * Signature (rs) of size curve_bytes * 2
+     * Padded/truncated 32-bit aligned copy of input hash of size curve_bytes  */
+    p_ctx->p_common_buff_32 = mbedtls_calloc(((curve_bytes * 11) / 4), sizeof(uint32_t));
+
+    if (NULL == p_ctx->p_common_buff_32)
+    {
+        return MBEDTLS_ERR_ECP_ALLOC_FAILED;
+    }
+
+    p_ctx->p_curve_params_buff_32 = p_ctx->p_common_buff_32;
+    p_ctx->p_public_key_buff_32   = p_ctx->p_curve_params_buff_32 + ((curve_bytes * 6) / 4);
+
+    ret = ecp_load_parameters_sce(grp, (uint8_t *) p_ctx->p_curve_params_buff_32);
+#endif
+    p_ctx->p_signature_buff_32 = p_ctx->p_public_key_buff_32 + ((curve_bytes * 2) / 4);
+    p_ctx->p_buf_8             = (uint8_t *) (p_ctx->p_signature_buff_32 + ((curve_bytes * 2) / 4));
+
+    if (ret)
+    {
+        mbedtls_free(p_ctx->p_common_buff_32);
+    }
+
+    return ret;
+}
+
+static int ecdsa_verify_run_sce (ecdsa_verify_ctx_t      * p_ctx,
+                                 const unsigned char     * buf,
+                                 size_t                    blen,
+                                 const mbedtls_ecp_point * Q,
+                                 const mbedtls_mpi       * r,
+                                 const mbedtls_mpi       * s)
+{
+    int    ret         = 0;
+    size_t curve_bytes = p_ctx->curve_bytes;
 
     /* The hash input (buf) should have a length of at least the curve size:
      * nist.fips.186-4: " A hash function that provides a lower security strength than
@@ -645,107 +705,154 @@ int mbedtls_ecdsa_verify (mbedtls_ecp_group       * grp,
      * Even if the hash input is the same size as the curve, we will still do a copy because the user input
      * is an 8-bit pointer whereas the SCE HW expects a 32-bit pointer and there could possibly be
      * an alignment issue. */
-    p_buf_8 = (uint8_t *) (p_signature_buff_32 + ((curve_bytes * 2) / 4));
     uint32_t bytes_to_copy = blen > curve_bytes ? curve_bytes : blen;
-    memcpy(p_buf_8 + (curve_bytes - bytes_to_copy), buf, bytes_to_copy);
+    memset(p_ctx->p_buf_8, 0, curve_bytes);
+    memcpy(p_ctx->p_buf_8 + (curve_bytes - bytes_to_copy), buf, bytes_to_copy);
 
-    uint32_t curve_type;
-    uint32_t cmd;
-    ret = ecp_load_curve_attributes_sce(grp, &curve_type, &cmd, NULL);
-    if (ret)
-    {
-    }
-    else if (0 != mbedtls_mpi_write_binary(&Q->X, (uint8_t *) p_public_key_buff_32, curve_bytes))
+    /* Only convert the public key when it differs from the one already in the buffer. */
+    if (Q != p_ctx->p_loaded_q)
     {
-        ret = MBEDTLS_ERR_MPI_BUFFER_TOO_SMALL;
-    }
-    else if (0 != mbedtls_mpi_write_binary(&Q->Y, (uint8_t *) (p_public_key_buff_32 + (curve_bytes / 4)), curve_bytes))
-    {
-        ret = MBEDTLS_ERR_MPI_BUFFER_TOO_SMALL;
+        p_ctx->p_loaded_q = NULL;
+
+        if (0 != mbedtls_mpi_write_binary(&Q->X, (uint8_t *) p_ctx->p_public_key_buff_32, curve_bytes))
+        {
+            return MBEDTLS_ERR_MPI_BUFFER_TOO_SMALL;
+        }
+
+        if (0 !=
+            mbedtls_mpi_write_binary(&Q->Y, (uint8_t *) (p_ctx->p_public_key_buff_32 + (curve_bytes / 4)), curve_bytes))
+        {
+            return MBEDTLS_ERR_MPI_BUFFER_TOO_SMALL;
+        }
+
+        p_ctx->p_loaded_q = Q;
     }
-    else if (0 != mbedtls_mpi_write_binary(r, (uint8_t *) p_signature_buff_32, curve_bytes))
+
+    if (0 != mbedtls_mpi_write_binary(r, (uint8_t *) p_ctx->p_signature_buff_32, curve_bytes))
     {
         ret = MBEDTLS_ERR_MPI_BUFFER_TOO_SMALL;
     }
-    else if (0 != mbedtls_mpi_write_binary(s, (uint8_t *) (p_signature_buff_32 + (curve_bytes / 4)), curve_bytes))
+    else if (0 !=
+             mbedtls_mpi_write_binary(s, (uint8_t *) (p_ctx->p_signature_buff_32 + (curve_bytes / 4)), curve_bytes))
     {
         ret = MBEDTLS_ERR_MPI_BUFFER_TOO_SMALL;
     }
     else
     {
+#if BSP_FEATURE_CRYPTO_HAS_SCE9
+        if (FSP_SUCCESS !=
+            p_ctx->p_hw_sce_ecc_verifysign(&p_ctx->curve_type, &p_ctx->cmd,
+                                           p_ctx->p_public_key_buff_32, (uint32_t *) p_ctx->p_buf_8,
+                                           p_ctx->p_signature_buff_32,
+                                           p_ctx->p_signature_buff_32 + (curve_bytes / 4)))
+#else
         if (FSP_SUCCESS !=
-            p_hw_sce_ecc_verifysign(&curve_type, &cmd,
-                                    p_public_key_buff_32, (uint32_t *) p_buf_8, p_signature_buff_32,
-                                    p_signature_buff_32 + (curve_bytes / 4)))
+            p_ctx->p_hw_sce_ecc_verifysign(p_ctx->p_curve_params_buff_32,
+                                           p_ctx->p_curve_params_buff_32 + ((curve_bytes * 4) / 4),
+                                           p_ctx->p_public_key_buff_32, (uint32_t *) p_ctx->p_buf_8,
+                                           p_ctx->p_signature_buff_32,
+                                           p_ctx->p_signature_buff_32 + (curve_bytes / 4)))
+#endif
         {
             ret = MBEDTLS_ERR_ECP_VERIFY_FAILED;
         }
     }
-#else
-    /* Obtain a 32-bit aligned block of memory. It will be used for all the following items in this order:
-     * Curve parameters a, b, p, n, Gx, Gy. Each of the 6 fields are of size curve_bytes = PSA_BITS_TO_BYTES( ecp->grp.pbits )
-     * Public Key (Q) of size curve_bytes * 2
-     * Signature (rs) of size curve_bytes * 2
-     * Padded/truncated 32-bit aligned copy of input hash of size curve_bytes  */
-    p_common_buff_32 = mbedtls_calloc(((curve_bytes * 11) / 4), sizeof(uint32_t));
 
-    if (NULL == p_common_buff_32)
+    return ret;
+}
+
+static int ecdsa_verify_run (ecdsa_verify_ctx_t      * p_ctx,
+                             const unsigned char     * buf,
+                             size_t                    blen,
+                             const mbedtls_ecp_point * Q,
+                             const mbedtls_mpi       * r,
+                             const mbedtls_mpi       * s)
+{
+    if (FSP_SUCCESS != RM_PSA_CRYPTO_SCE_ACQUIRE())
     {
-        return MBEDTLS_ERR_ECP_ALLOC_FAILED;
+        return MBEDTLS_ERR_PLATFORM_HW_ACCEL_FAILED;
     }
 
-    uint32_t * p_curve_params_buff_32 = p_common_buff_32;
-    p_public_key_buff_32   = p_curve_params_buff_32 + ((curve_bytes * 6) / 4);
-    p_signature_buff_32    = p_public_key_buff_32 + ((curve_bytes * 2) / 4);
+    int ret = ecdsa_verify_run_sce(p_ctx, buf, blen, Q, r, s);
 
-    /* The hash input (buf) should have a length of at least the curve size:
-     * nist.fips.186-4: " A hash function that provides a lower security strength than
-     * the security strength associated with the bit length of 'n' ordinarily should not be used, since this
-     * would reduce the security strength of the digital signature process to a level no greater than that
-     * provided by the hash function."
-     * However, the SCE HW functions only parse hash of exactly curve_bytes length so
-     * *-Any larger hash data will be truncated.
-     * *-Any smaller data will be 0-padded to the LEFT.
-     *
-     * Even if the hash input is the same size as the curve, we will still do a copy because the user input
-     * is an 8-bit pointer whereas the SCE HW expects a 32-bit pointer and there could possibly be
-     * an alignment issue. */
-    p_buf_8 = (uint8_t *) (p_signature_buff_32 + ((curve_bytes * 2) / 4));
-    uint32_t bytes_to_copy = blen > curve_bytes ? curve_bytes : blen;
-    memcpy(p_buf_8 + (curve_bytes - bytes_to_copy), buf, bytes_to_copy);
+    RM_PSA_CRYPTO_SCE_RELEASE();
 
-    ret = ecp_load_parameters_sce(grp, (uint8_t *) p_curve_params_buff_32);
-    if (ret)
-    {
-    }
-    else if (0 != mbedtls_mpi_write_binary(&Q->X, (uint8_t *) p_public_key_buff_32, curve_bytes))
-    {
-        ret = MBEDTLS_ERR_MPI_BUFFER_TOO_SMALL;
-    }
-    else if (0 != mbedtls_mpi_write_binary(&Q->Y, (uint8_t *) (p_public_key_buff_32 + (curve_bytes / 4)), curve_bytes))
+    return ret;
+}
+
+/*
+ * Verify ECDSA signature of hashed message
+ */
+int mbedtls_ecdsa_verify (mbedtls_ecp_group       * grp,
+                          const unsigned char     * buf,
+                          size_t                    blen,
+                          const mbedtls_ecp_point * Q,
+                          const mbedtls_mpi       * r,
+                          const mbedtls_mpi       * s)
+{
+    ECDSA_VALIDATE_RET(grp != NULL);
+    ECDSA_VALIDATE_RET(Q != NULL);
+    ECDSA_VALIDATE_RET(r != NULL);
+    ECDSA_VALIDATE_RET(s != NULL);
+    ECDSA_VALIDATE_RET(buf != NULL || blen == 0);
+
+    ecdsa_verify_ctx_t ctx;
+    int                ret = ecdsa_verify_setup(grp, &ctx);
+
+    if (0 == ret)
     {
-        ret = MBEDTLS_ERR_MPI_BUFFER_TOO_SMALL;
+        ret = ecdsa_verify_run(&ctx, buf, blen, Q, r, s);
+        mbedtls_free(ctx.p_common_buff_32);
     }
-    else if (0 != mbedtls_mpi_write_binary(r, (uint8_t *) p_signature_buff_32, curve_bytes))
+
+    return ret;
+}
+
+/*
+ * Verify a batch of ECDSA signatures on the same curve. The curve parameters are loaded once and consecutive items
+ * that point to the same public key reuse its converted form. Each item's ret holds its own result; the return value
+ * is 0 when every signature is valid, otherwise the first failing item's result.
+ */
+int mbedtls_ecdsa_verify_batch (mbedtls_ecp_group * grp, mbedtls_ecdsa_verify_item * items, size_t count)
+{
+    ECDSA_VALIDATE_RET(grp != NULL);
+    ECDSA_VALIDATE_RET(items != NULL || count == 0);
+
+    ecdsa_verify_ctx_t ctx;
+    int                ret = 0;
+
+    if (0 == count)
     {
-        ret = MBEDTLS_ERR_MPI_BUFFER_TOO_SMALL;
+        return 0;
     }
-    else if (0 != mbedtls_mpi_write_binary(s, (uint8_t *) (p_signature_buff_32 + (curve_bytes / 4)), curve_bytes))
+
+    ret = ecdsa_verify_setup(grp, &ctx);
+    if (0 != ret)
     {
-        ret = MBEDTLS_ERR_MPI_BUFFER_TOO_SMALL;
+        return ret;
     }
-    else
+
+    for (size_t i = 0; i < count; i++)
     {
-        if (FSP_SUCCESS !=
-            p_hw_sce_ecc_verifysign(p_curve_params_buff_32, p_curve_params_buff_32 + ((curve_bytes * 4) / 4),
-                                    p_public_key_buff_32, (uint32_t *) p_buf_8, p_signature_buff_32,
-                                    p_signature_buff_32 + (curve_bytes / 4)))
+        mbedtls_ecdsa_verify_item * p_item = &items[i];
+
+        if ((NULL == p_item->Q) || (NULL == p_item->r) || (NULL == p_item->s) ||
+            ((NULL == p_item->buf) && (0 != p_item->blen)))
         {
-            ret = MBEDTLS_ERR_ECP_VERIFY_FAILED;
+            p_item->ret = MBEDTLS_ERR_ECP_BAD_INPUT_DATA;
+        }
+        else
+        {
+            p_item->ret = ecdsa_verify_run(&ctx, p_item->buf, p_item->blen, p_item->Q, p_item->r, p_item->s);
+        }
+
+        if (0 == ret)
+        {
+            ret = p_item->ret;
         }
     }
-#endif
-    mbedtls_free(p_common_buff_32);
+
+    mbedtls_free(ctx.p_common_buff_32);
 
     return ret;
 }
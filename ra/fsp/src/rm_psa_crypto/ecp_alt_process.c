@@ -82,6 +82,7 @@
   #include "mbedtls/ecp_internal.h"
   #include "psa/crypto.h"
   #include "hw_sce_private.h"
+  #include "rm_psa_crypto.h"
 
 static const hw_sce_ecc_generatekey_t g_ecp_keygen_lookup[][2] =
 {
@@ -212,19 +213,14 @@ uint32_t ecp_load_key_size (bool wrapped_mode_ctx, const mbedtls_ecp_group * grp
     return key_size_words;             // NOLINT(readability-misleading-indentation)
 }
 
-int mbedtls_ecp_gen_privkey (const mbedtls_ecp_group * grp,
-                             mbedtls_mpi * d,
-                             int (* f_rng)(void *, unsigned char *, size_t),
-                             void * p_rng)
+/*
+ * Generate a key pair with the SCE. Q is optional; it is only filled on engines whose key generation procedure
+ * returns the public key in plain (Qx|Qy) form, and is left untouched otherwise.
+ */
+static int ecp_gen_keypair_hw (const mbedtls_ecp_group * grp, mbedtls_mpi * d, mbedtls_ecp_point * Q)
 {
-    (void) f_rng;
-    (void) p_rng;
-
     int ret = MBEDTLS_ERR_ECP_BAD_INPUT_DATA;
 
-    ECP_VALIDATE_RET(grp != NULL);
-    ECP_VALIDATE_RET(d != NULL);
-
     uint32_t               * p_public_key_buff_32;
     uint32_t               * p_private_key_buff_32;
     uint32_t               * p_common_buff_32;
@@ -260,6 +256,8 @@ int mbedtls_ecp_gen_privkey (const mbedtls_ecp_group * grp,
 
     size_t curve_bytes = PSA_BITS_TO_BYTES(grp->pbits);
 #if BSP_FEATURE_CRYPTO_HAS_SCE9
+    (void) Q;
+
     /* Obtain a common 32-bit aligned buffer. It will be used for all the following items in this order:
      * Private Key (D) of size private_key_size_words
      * Public Key (Q) of size ECC_PUBLIC_KEY_SIZE_BYTES */
@@ -329,6 +327,18 @@ int mbedtls_ecp_gen_privkey (const mbedtls_ecp_group * grp,
     {
         ret = MBEDTLS_ERR_MPI_ALLOC_FAILED;
     }
+    else if (NULL == Q)
+    {
+        ret = 0;
+    }
+    /* The public key is returned as (Qx|Qy), so the caller does not need a scalar multiplication by G. */
+    else if ((0 != mbedtls_mpi_read_binary(&Q->X, (uint8_t *) p_public_key_buff_32, curve_bytes)) ||
+             (0 !=
+              mbedtls_mpi_read_binary(&Q->Y, (uint8_t *) (p_public_key_buff_32 + (curve_bytes / 4)), curve_bytes)) ||
+             (0 != mbedtls_mpi_lset(&Q->Z, 1)))
+    {
+        ret = MBEDTLS_ERR_MPI_ALLOC_FAILED;
+    }
     else
     {
         ret = 0;
@@ -342,13 +352,218 @@ int mbedtls_ecp_gen_privkey (const mbedtls_ecp_group * grp,
     return ret;
 }
 
-int mbedtls_ecp_mul_restartable (mbedtls_ecp_group * grp,
-                                 mbedtls_ecp_point * R,
-                                 const mbedtls_mpi * m,
-                                 const mbedtls_ecp_point * P,
-                                 int (* f_rng)(void *, unsigned char *, size_t),
-                                 void * p_rng,
-                                 mbedtls_ecp_restart_ctx * rs_ctx)
+static int ecp_gen_keypair_sce (const mbedtls_ecp_group * grp, mbedtls_mpi * d, mbedtls_ecp_point * Q)
+{
+    if (FSP_SUCCESS != RM_PSA_CRYPTO_SCE_ACQUIRE())
+    {
+        return MBEDTLS_ERR_PLATFORM_HW_ACCEL_FAILED;
+    }
+
+    int ret = ecp_gen_keypair_hw(grp, d, Q);
+
+    RM_PSA_CRYPTO_SCE_RELEASE();
+
+    return ret;
+}
+
+int mbedtls_ecp_gen_privkey (const mbedtls_ecp_group * grp,
+                             mbedtls_mpi * d,
+                             int (* f_rng)(void *, unsigned char *, size_t),
+                             void * p_rng)
+{
+    (void) f_rng;
+    (void) p_rng;
+
+    ECP_VALIDATE_RET(grp != NULL);
+    ECP_VALIDATE_RET(d != NULL);
+
+    return ecp_gen_keypair_sce(grp, d, NULL);
+}
+
+/*
+ * Generate a complete key pair: the SCE key generation, followed by Q = d.G where the procedure does not return Q.
+ */
+static int ecp_gen_keypair_full (mbedtls_ecp_group * grp, mbedtls_mpi * d, mbedtls_ecp_point * Q)
+{
+    int ret = ecp_gen_keypair_sce(grp, d, Q);
+
+  #if BSP_FEATURE_CRYPTO_HAS_SCE9
+    if (0 == ret)
+    {
+        ret = mbedtls_ecp_mul_restartable(grp, Q, d, &grp->G, NULL, NULL, NULL);
+    }
+  #endif
+
+    return ret;
+}
+
+  #if defined(MBEDTLS_ECP_EPHEMERAL_POOL_SIZE)
+
+   #define ECP_EPHEMERAL_MAX_CURVE_BYTES    (ECC_384_PRIVATE_KEY_LENGTH_BITS / 8U)
+   #define ECP_EPHEMERAL_MAX_D_BYTES        (ECC_384_PRIVATE_KEY_HRK_LENGTH_WORDS * 4U)
+
+/* One pregenerated key pair. An entry is free when id is MBEDTLS_ECP_DP_NONE. */
+typedef struct st_ecp_ephemeral_key
+{
+    mbedtls_ecp_group_id id;                            /* Curve of the key pair. */
+    bool                 wrapped;                       /* Key format (grp->vendor_ctx) the pair was made for. */
+    uint8_t              d[ECP_EPHEMERAL_MAX_D_BYTES];  /* Private key, as read by mbedtls_mpi_read_binary(). */
+    uint8_t              q[ECP_EPHEMERAL_MAX_CURVE_BYTES * 2U]; /* Public key (Qx|Qy), big endian. */
+} ecp_ephemeral_key_t;
+
+static ecp_ephemeral_key_t g_ecp_ephemeral_pool[MBEDTLS_ECP_EPHEMERAL_POOL_SIZE];
+
+/*
+ * Top up the empty pool entries with key pairs for grp
+ */
+int mbedtls_ecp_ephemeral_pool_fill (mbedtls_ecp_group * grp)
+{
+    ECP_VALIDATE_RET(grp != NULL);
+
+    int                 ret = 0;
+    mbedtls_mpi         d;
+    mbedtls_ecp_point   Q;
+    ecp_ephemeral_key_t key;
+
+    size_t   curve_bytes = PSA_BITS_TO_BYTES(grp->pbits);
+    uint32_t d_words     = ecp_load_key_size((bool) grp->vendor_ctx, grp);
+
+    if ((0 == d_words) || (curve_bytes > ECP_EPHEMERAL_MAX_CURVE_BYTES) || ((d_words * 4U) > sizeof(key.d)))
+    {
+        return MBEDTLS_ERR_ECP_FEATURE_UNAVAILABLE;
+    }
+
+    mbedtls_mpi_init(&d);
+    mbedtls_ecp_point_init(&Q);
+
+    for (uint32_t i = 0U; (0 == ret) && (i < MBEDTLS_ECP_EPHEMERAL_POOL_SIZE); i++)
+    {
+        /* Only this function fills entries, so a free entry stays free until it is written below. */
+        if (MBEDTLS_ECP_DP_NONE != g_ecp_ephemeral_pool[i].id)
+        {
+            continue;
+        }
+
+        ret = ecp_gen_keypair_full(grp, &d, &Q);
+        if (0 == ret)
+        {
+            ret = mbedtls_mpi_write_binary(&d, key.d, d_words * 4U);
+        }
+
+        if (0 == ret)
+        {
+            ret = mbedtls_mpi_write_binary(&Q.X, key.q, curve_bytes);
+        }
+
+        if (0 == ret)
+        {
+            ret = mbedtls_mpi_write_binary(&Q.Y, &key.q[curve_bytes], curve_bytes);
+        }
+
+        if (0 == ret)
+        {
+            key.id      = grp->id;
+            key.wrapped = (bool) grp->vendor_ctx;
+
+            FSP_CRITICAL_SECTION_DEFINE;
+            FSP_CRITICAL_SECTION_ENTER;
+            g_ecp_ephemeral_pool[i] = key;
+            FSP_CRITICAL_SECTION_EXIT;
+        }
+    }
+
+    mbedtls_platform_zeroize(&key, sizeof(key));
+    mbedtls_ecp_point_free(&Q);
+    mbedtls_mpi_free(&d);
+
+    return ret;
+}
+
+/*
+ * Discard all pregenerated key pairs
+ */
+void mbedtls_ecp_ephemeral_pool_flush (void)
+{
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+    mbedtls_platform_zeroize(g_ecp_ephemeral_pool, sizeof(g_ecp_ephemeral_pool));
+    FSP_CRITICAL_SECTION_EXIT;
+}
+
+/*
+ * Take a pregenerated key pair for grp out of the pool. Returns false if there is none.
+ */
+static bool ecp_ephemeral_pool_take (const mbedtls_ecp_group * grp, ecp_ephemeral_key_t * p_key)
+{
+    bool found = false;
+
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+    for (uint32_t i = 0U; (false == found) && (i < MBEDTLS_ECP_EPHEMERAL_POOL_SIZE); i++)
+    {
+        if ((grp->id == g_ecp_ephemeral_pool[i].id) && ((bool) grp->vendor_ctx == g_ecp_ephemeral_pool[i].wrapped))
+        {
+            *p_key = g_ecp_ephemeral_pool[i];
+            mbedtls_platform_zeroize(&g_ecp_ephemeral_pool[i], sizeof(g_ecp_ephemeral_pool[i]));
+            found = true;
+        }
+    }
+
+    FSP_CRITICAL_SECTION_EXIT;
+
+    return found;
+}
+
+  #endif                               /* MBEDTLS_ECP_EPHEMERAL_POOL_SIZE */
+
+/*
+ * Generate an ephemeral key pair, from the pool when one is available
+ */
+int mbedtls_ecp_gen_ephemeral (mbedtls_ecp_group * grp,
+                               mbedtls_mpi * d,
+                               mbedtls_ecp_point * Q,
+                               int (* f_rng)(void *, unsigned char *, size_t),
+                               void * p_rng)
+{
+    (void) f_rng;
+    (void) p_rng;
+
+    ECP_VALIDATE_RET(grp != NULL);
+    ECP_VALIDATE_RET(d != NULL);
+    ECP_VALIDATE_RET(Q != NULL);
+
+  #if defined(MBEDTLS_ECP_EPHEMERAL_POOL_SIZE)
+    ecp_ephemeral_key_t key;
+
+    if (ecp_ephemeral_pool_take(grp, &key))
+    {
+        size_t curve_bytes = PSA_BITS_TO_BYTES(grp->pbits);
+        int    ret         = MBEDTLS_ERR_MPI_ALLOC_FAILED;
+
+        if ((0 == mbedtls_mpi_read_binary(d, key.d, ecp_load_key_size(key.wrapped, grp) * 4U)) &&
+            (0 == mbedtls_mpi_read_binary(&Q->X, key.q, curve_bytes)) &&
+            (0 == mbedtls_mpi_read_binary(&Q->Y, &key.q[curve_bytes], curve_bytes)) &&
+            (0 == mbedtls_mpi_lset(&Q->Z, 1)))
+        {
+            ret = 0;
+        }
+
+        mbedtls_platform_zeroize(&key, sizeof(key));
+
+        return ret;
+    }
+  #endif
+
+    return ecp_gen_keypair_full(grp, d, Q);
+}
+
+static int ecp_mul_sce (mbedtls_ecp_group * grp,
+                        mbedtls_ecp_point * R,
+                        const mbedtls_mpi * m,
+                        const mbedtls_ecp_point * P,
+                        int (* f_rng)(void *, unsigned char *, size_t),
+                        void * p_rng,
+                        mbedtls_ecp_restart_ctx * rs_ctx)
 {
     (void) f_rng;
     (void) p_rng;
@@ -569,6 +784,26 @@ int mbedtls_ecp_mul_restartable (mbedtls_ecp_group * grp,
     return ret;
 }
 
+int mbedtls_ecp_mul_restartable (mbedtls_ecp_group * grp,
+                                 mbedtls_ecp_point * R,
+                                 const mbedtls_mpi * m,
+                                 const mbedtls_ecp_point * P,
+                                 int (* f_rng)(void *, unsigned char *, size_t),
+                                 void * p_rng,
+                                 mbedtls_ecp_restart_ctx * rs_ctx)
+{
+    if (FSP_SUCCESS != RM_PSA_CRYPTO_SCE_ACQUIRE())
+    {
+        return MBEDTLS_ERR_PLATFORM_HW_ACCEL_FAILED;
+    }
+
+    int ret = ecp_mul_sce(grp, R, m, P, f_rng, p_rng, rs_ctx);
+
+    RM_PSA_CRYPTO_SCE_RELEASE();
+
+    return ret;
+}
+
  #endif                                /* !MBEDTLS_ECP_ALT */
 
 #endif                                 /* MBEDTLS_ECP_C */
@@ -0,0 +1,729 @@
+/***********************************************************************************************************************
+ * Copyright [2020] Renesas Electronics Corporation and/or its affiliates.  All Rights Reserved.
+ *
+ * This software and documentation are supplied by Renesas Electronics America Inc. and may only be used with products
+ * of Renesas Electronics Corp. and its affiliates ("Renesas").  No other uses are authorized.  Renesas products are
+ * sold pursuant to Renesas terms and conditions of sale.  Purchasers are solely responsible for the selection and use
+ * of Renesas products and Renesas assumes no liability.  No license, express or implied, to any intellectual property
+ * right is granted by Renesas. This software is protected under all applicable laws, including copyright laws. Renesas
+ * reserves the right to change or discontinue this software and/or this documentation. THE SOFTWARE AND DOCUMENTATION
+ * IS DELIVERED TO YOU "AS IS," AND RENESAS MAKES NO REPRESENTATIONS OR WARRANTIES, AND TO THE FULLEST EXTENT
+ * PERMISSIBLE UNDER APPLICABLE LAW, DISCLAIMS ALL WARRANTIES, WHETHER EXPLICITLY OR IMPLICITLY, INCLUDING WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, AND NONINFRINGEMENT, WITH RESPECT TO THE SOFTWARE OR
+ * DOCUMENTATION.  RENESAS SHALL HAVE NO LIABILITY ARISING OUT OF ANY SECURITY VULNERABILITY OR BREACH.  TO THE MAXIMUM
+ * EXTENT PERMITTED BY LAW, IN NO EVENT WILL RENESAS BE LIABLE TO YOU IN CONNECTION WITH THE SOFTWARE OR DOCUMENTATION
+ * (OR ANY PERSON OR ENTITY CLAIMING RIGHTS DERIVED FROM YOU) FOR ANY LOSS, DAMAGES, OR CLAIMS WHATSOEVER, INCLUDING,
+ * WITHOUT LIMITATION, ANY DIRECT, CONSEQUENTIAL, SPECIAL, INDIRECT, PUNITIVE, OR INCIDENTAL DAMAGES; ANY LOST PROFITS,
+ * OTHER ECONOMIC DAMAGE, PROPERTY DAMAGE, OR PERSONAL INJURY; AND EVEN IF RENESAS HAS BEEN ADVISED OF THE POSSIBILITY
+ * OF SUCH LOSS, DAMAGES, CLAIMS OR COSTS.
+ **********************************************************************************************************************/
+
+#if !defined(MBEDTLS_CONFIG_FILE)
+ #include "mbedtls/config.h"
+#else
+ #include MBEDTLS_CONFIG_FILE
+#endif
+
+#if defined(MBEDTLS_GCM_C)
+
+ #include "mbedtls/gcm.h"
+ #include "mbedtls/platform_util.h"
+
+ #include <string.h>
+
+ #if defined(MBEDTLS_GCM_ALT)
+  #include "hw_sce_aes_private.h"
+  #include "hw_sce_private.h"
+  #include "rm_psa_crypto.h"
+
+  #if !BSP_FEATURE_CRYPTO_HAS_SCE9
+   #error "MBEDTLS_GCM_ALT requires the SCE9 AES-GCM engine."
+  #endif
+
+  #define GCM_VALIDATE_RET(cond)    MBEDTLS_INTERNAL_VALIDATE_RET(cond, MBEDTLS_ERR_GCM_BAD_INPUT)
+  #define GCM_VALIDATE(cond)        MBEDTLS_INTERNAL_VALIDATE(cond)
+
+/* Counter blocks encrypted per SCE call by the streaming functions. */
+  #define GCM_ALT_KEYSTREAM_BLOCKS    (16U)
+  #define GCM_ALT_MAX_TEXT_BYTES      (0xFFFFFFFE0ULL)
+  #define GCM_ALT_TAG_MIN_BYTES       (4U)
+
+static uint32_t gcm_key_bits(const mbedtls_gcm_context * ctx);
+static int      gcm_ecb_encrypt(mbedtls_gcm_context * ctx, const uint32_t * p_input, uint32_t * p_output,
+                                uint32_t num_words);
+static int      gcm_ghash(mbedtls_gcm_context * ctx, uint32_t y[4], const unsigned char * p_data, size_t length);
+static int      gcm_j0_compute(mbedtls_gcm_context * ctx, const unsigned char * iv, size_t iv_len, uint32_t j0[4]);
+static void     gcm_lengths_encode(uint64_t add_len, uint64_t len, uint32_t block[4]);
+static int      gcm_hw_start(mbedtls_gcm_context * ctx,
+                             uint32_t              decrypt,
+                             const unsigned char * iv,
+                             size_t                iv_len,
+                             const unsigned char * add,
+                             size_t                add_len);
+
+/*******************************************************************************************************************//**
+ * @addtogroup RM_PSA_CRYPTO
+ * @{
+ **********************************************************************************************************************/
+
+/*
+ * Initialize a context
+ */
+void mbedtls_gcm_init (mbedtls_gcm_context * ctx)
+{
+    GCM_VALIDATE(ctx != NULL);
+    memset(ctx, 0, sizeof(mbedtls_gcm_context));
+    mbedtls_aes_init(&ctx->aes);
+}
+
+/*******************************************************************************************************************//**
+ * Generates the SCE key index for the AES key and derives the GHASH subkey from it.
+ *
+ * @retval 0                                       Key set successfully.
+ * @retval MBEDTLS_ERR_GCM_BAD_INPUT               Cipher is not AES or the key length is not supported.
+ * @retval MBEDTLS_ERR_PLATFORM_HW_ACCEL_FAILED    Key index generation or the SCE operation failed.
+ **********************************************************************************************************************/
+int mbedtls_gcm_setkey (mbedtls_gcm_context * ctx,
+                        mbedtls_cipher_id_t   cipher,
+                        const unsigned char * key,
+                        unsigned int          keybits)
+{
+    GCM_VALIDATE_RET(ctx != NULL);
+    GCM_VALIDATE_RET(key != NULL);
+
+    if ((MBEDTLS_CIPHER_ID_AES != cipher) ||
+        ((128U != keybits) && (192U != keybits) && (256U != keybits)))
+    {
+        return MBEDTLS_ERR_GCM_BAD_INPUT;
+    }
+
+    mbedtls_aes_free(&ctx->aes);
+    mbedtls_aes_init(&ctx->aes);
+
+    if (0 != mbedtls_aes_setkey_enc(&ctx->aes, key, keybits))
+    {
+        return MBEDTLS_ERR_PLATFORM_HW_ACCEL_FAILED;
+    }
+
+    /* H = E(K, 0^128) */
+    memset(ctx->h, 0, sizeof(ctx->h));
+
+    return gcm_ecb_encrypt(ctx, ctx->h, ctx->h, SIZE_AES_BLOCK_WORDS);
+}
+
+/*******************************************************************************************************************//**
+ * Starts a streaming GCM operation. The AAD is hashed with the SCE GHASH engine. Data passed to
+ * mbedtls_gcm_update() is encrypted with multi-block AES-CTR and hashed with the GHASH engine, so the SCE is not held
+ * between calls.
+ *
+ * @retval 0                                       Operation started.
+ * @retval MBEDTLS_ERR_GCM_BAD_INPUT               Invalid IV or AAD length.
+ * @retval MBEDTLS_ERR_PLATFORM_HW_ACCEL_FAILED    The SCE operation failed.
+ **********************************************************************************************************************/
+int mbedtls_gcm_starts (mbedtls_gcm_context * ctx,
+                        int                   mode,
+                        const unsigned char * iv,
+                        size_t                iv_len,
+                        const unsigned char * add,
+                        size_t                add_len)
+{
+    int ret;
+
+    GCM_VALIDATE_RET(ctx != NULL);
+    GCM_VALIDATE_RET(iv != NULL);
+    GCM_VALIDATE_RET(add_len == 0 || add != NULL);
+
+    if ((0U == iv_len) || (0U != (((uint64_t) iv_len) >> 61)) || (0U != (((uint64_t) add_len) >> 61)))
+    {
+        return MBEDTLS_ERR_GCM_BAD_INPUT;
+    }
+
+    ctx->mode    = mode;
+    ctx->len     = 0U;
+    ctx->add_len = add_len;
+
+    ret = gcm_j0_compute(ctx, iv, iv_len, ctx->counter);
+    if (0 != ret)
+    {
+        return ret;
+    }
+
+    ret = gcm_ecb_encrypt(ctx, ctx->counter, ctx->base_ectr, SIZE_AES_BLOCK_WORDS);
+    if (0 != ret)
+    {
+        return ret;
+    }
+
+    memset(ctx->y, 0, sizeof(ctx->y));
+
+    return gcm_ghash(ctx, ctx->y, add, add_len);
+}
+
+/*******************************************************************************************************************//**
+ * Encrypts or decrypts the next part of the data. As with the mbedTLS implementation, every call except the last one
+ * must pass a multiple of 16 bytes.
+ *
+ * @retval 0                                       Data processed.
+ * @retval MBEDTLS_ERR_GCM_BAD_INPUT               Overlapping buffers or total length exceeded.
+ * @retval MBEDTLS_ERR_PLATFORM_HW_ACCEL_FAILED    The SCE operation failed.
+ **********************************************************************************************************************/
+int mbedtls_gcm_update (mbedtls_gcm_context * ctx, size_t length, const unsigned char * input, unsigned char * output)
+{
+    int      ret = 0;
+    uint32_t keystream[GCM_ALT_KEYSTREAM_BLOCKS * SIZE_AES_BLOCK_WORDS];
+
+    GCM_VALIDATE_RET(ctx != NULL);
+    GCM_VALIDATE_RET(length == 0 || input != NULL);
+    GCM_VALIDATE_RET(length == 0 || output != NULL);
+
+    if ((output > input) && ((size_t) (output - input) < length))
+    {
+        return MBEDTLS_ERR_GCM_BAD_INPUT;
+    }
+
+    if (((ctx->len + length) < ctx->len) || ((ctx->len + length) > GCM_ALT_MAX_TEXT_BYTES))
+    {
+        return MBEDTLS_ERR_GCM_BAD_INPUT;
+    }
+
+    ctx->len += length;
+
+    while ((length > 0U) && (0 == ret))
+    {
+        size_t   use_len = (length < sizeof(keystream)) ? length : sizeof(keystream);
+        uint32_t blocks  = (uint32_t) ((use_len + (SIZE_AES_BLOCK_BYTES - 1U)) / SIZE_AES_BLOCK_BYTES);
+
+        /* Build the counter blocks for this chunk and encrypt them in a single SCE call. */
+        for (uint32_t i = 0U; i < blocks; i++)
+        {
+            ctx->counter[3] = __REV(__REV(ctx->counter[3]) + 1U);
+            memcpy(&keystream[i * SIZE_AES_BLOCK_WORDS], ctx->counter, SIZE_AES_BLOCK_BYTES);
+        }
+
+        ret = gcm_ecb_encrypt(ctx, keystream, keystream, blocks * SIZE_AES_BLOCK_WORDS);
+
+        /* GHASH always runs over the ciphertext. */
+        if ((0 == ret) && (MBEDTLS_GCM_DECRYPT == ctx->mode))
+        {
+            ret = gcm_ghash(ctx, ctx->y, input, use_len);
+        }
+
+        if (0 == ret)
+        {
+            const unsigned char * p_keystream = (const unsigned char *) keystream;
+
+            for (size_t i = 0U; i < use_len; i++)
+            {
+                output[i] = (unsigned char) (input[i] ^ p_keystream[i]);
+            }
+
+            if (MBEDTLS_GCM_ENCRYPT == ctx->mode)
+            {
+                ret = gcm_ghash(ctx, ctx->y, output, use_len);
+            }
+        }
+
+        length -= use_len;
+        input  += use_len;
+        output += use_len;
+    }
+
+    mbedtls_platform_zeroize(keystream, sizeof(keystream));
+
+    return ret;
+}
+
+/*******************************************************************************************************************//**
+ * Hashes the length block and produces the authentication tag.
+ *
+ * @retval 0                                       Tag generated.
+ * @retval MBEDTLS_ERR_GCM_BAD_INPUT               Tag length is not supported.
+ * @retval MBEDTLS_ERR_PLATFORM_HW_ACCEL_FAILED    The SCE operation failed.
+ **********************************************************************************************************************/
+int mbedtls_gcm_finish (mbedtls_gcm_context * ctx, unsigned char * tag, size_t tag_len)
+{
+    int      ret;
+    uint32_t len_block[SIZE_AES_BLOCK_WORDS];
+
+    GCM_VALIDATE_RET(ctx != NULL);
+    GCM_VALIDATE_RET(tag != NULL);
+
+    if ((tag_len > SIZE_AES_BLOCK_BYTES) || (tag_len < GCM_ALT_TAG_MIN_BYTES))
+    {
+        return MBEDTLS_ERR_GCM_BAD_INPUT;
+    }
+
+    gcm_lengths_encode(ctx->add_len, ctx->len, len_block);
+
+    ret = gcm_ghash(ctx, ctx->y, (const unsigned char *) len_block, sizeof(len_block));
+    if (0 == ret)
+    {
+        for (uint32_t i = 0U; i < SIZE_AES_BLOCK_WORDS; i++)
+        {
+            len_block[i] = ctx->y[i] ^ ctx->base_ectr[i];
+        }
+
+        memcpy(tag, len_block, tag_len);
+    }
+
+    mbedtls_platform_zeroize(len_block, sizeof(len_block));
+
+    return ret;
+}
+
+/*******************************************************************************************************************//**
+ * Performs a complete GCM operation. Encryption runs on the SCE AES-GCM engine in a single pass. Decryption, which
+ * must output a tag instead of checking one, uses the streaming functions.
+ *
+ * @retval 0                                       Operation completed.
+ * @retval MBEDTLS_ERR_GCM_BAD_INPUT               Invalid length.
+ * @retval MBEDTLS_ERR_PLATFORM_HW_ACCEL_FAILED    The SCE operation failed.
+ **********************************************************************************************************************/
+static int gcm_crypt_and_tag_sce (mbedtls_gcm_context * ctx,
+                                  int                   mode,
+                                  size_t                length,
+                                  const unsigned char * iv,
+                                  size_t                iv_len,
+                                  const unsigned char * add,
+                                  size_t                add_len,
+                                  const unsigned char * input,
+                                  unsigned char       * output,
+                                  size_t                tag_len,
+                                  unsigned char       * tag)
+{
+    int      ret;
+    size_t   full_len = length & ~((size_t) SIZE_AES_BLOCK_BYTES - 1U);
+    size_t   rest_len = length - full_len;
+    uint32_t len_block[SIZE_AES_BLOCK_WORDS];
+    uint32_t last_in[SIZE_AES_BLOCK_WORDS]  = {0};
+    uint32_t last_out[SIZE_AES_BLOCK_WORDS] = {0};
+    uint32_t tag_out[SIZE_AES_BLOCK_WORDS]  = {0};
+
+    GCM_VALIDATE_RET(ctx != NULL);
+    GCM_VALIDATE_RET(iv != NULL);
+    GCM_VALIDATE_RET(add_len == 0 || add != NULL);
+    GCM_VALIDATE_RET(length == 0 || input != NULL);
+    GCM_VALIDATE_RET(length == 0 || output != NULL);
+    GCM_VALIDATE_RET(tag != NULL);
+
+    if (MBEDTLS_GCM_ENCRYPT != mode)
+    {
+        ret = mbedtls_gcm_starts(ctx, mode, iv, iv_len, add, add_len);
+        if (0 == ret)
+        {
+            ret = mbedtls_gcm_update(ctx, length, input, output);
+        }
+
+        if (0 == ret)
+        {
+            ret = mbedtls_gcm_finish(ctx, tag, tag_len);
+        }
+
+        return ret;
+    }
+
+    if ((tag_len > SIZE_AES_BLOCK_BYTES) || (tag_len < GCM_ALT_TAG_MIN_BYTES) ||
+        ((uint64_t) length > GCM_ALT_MAX_TEXT_BYTES))
+    {
+        return MBEDTLS_ERR_GCM_BAD_INPUT;
+    }
+
+    ret = gcm_hw_start(ctx, 0U, iv, iv_len, add, add_len);
+    if (0 != ret)
+    {
+        return ret;
+    }
+
+    uint32_t key_bits = gcm_key_bits(ctx);
+
+    if (0U != full_len)
+    {
+        if (FSP_SUCCESS !=
+            HW_SCE_AES_GcmUpdate(key_bits, 0U, (const uint32_t *) input, (uint32_t *) output,
+                                 (uint32_t) (full_len / sizeof(uint32_t)))) // NOLINT(rea-tp-casting)
+        {
+            mbedtls_platform_zeroize(output, full_len);
+
+            return MBEDTLS_ERR_PLATFORM_HW_ACCEL_FAILED;
+        }
+    }
+
+    memcpy(last_in, &input[full_len], rest_len);
+    gcm_lengths_encode(add_len, length, len_block);
+
+    if (FSP_SUCCESS != HW_SCE_AES_GcmEncryptFinal(key_bits, last_in, &len_block[0], &len_block[2], last_out, tag_out))
+    {
+        ret = MBEDTLS_ERR_PLATFORM_HW_ACCEL_FAILED;
+    }
+    else
+    {
+        memcpy(&output[full_len], last_out, rest_len);
+        memcpy(tag, tag_out, tag_len);
+    }
+
+    mbedtls_platform_zeroize(last_in, sizeof(last_in));
+    mbedtls_platform_zeroize(last_out, sizeof(last_out));
+    mbedtls_platform_zeroize(tag_out, sizeof(tag_out));
+
+    return ret;
+}
+
+int mbedtls_gcm_crypt_and_tag (mbedtls_gcm_context * ctx,
+                               int                   mode,
+                               size_t                length,
+                               const unsigned char * iv,
+                               size_t                iv_len,
+                               const unsigned char * add,
+                               size_t                add_len,
+                               const unsigned char * input,
+                               unsigned char       * output,
+                               size_t                tag_len,
+                               unsigned char       * tag)
+{
+    if (FSP_SUCCESS != RM_PSA_CRYPTO_SCE_ACQUIRE())
+    {
+        return MBEDTLS_ERR_PLATFORM_HW_ACCEL_FAILED;
+    }
+
+    int ret = gcm_crypt_and_tag_sce(ctx, mode, length, iv, iv_len, add, add_len, input, output, tag_len, tag);
+
+    RM_PSA_CRYPTO_SCE_RELEASE();
+
+    return ret;
+}
+
+/*******************************************************************************************************************//**
+ * Decrypts the data and verifies the tag on the SCE AES-GCM engine in a single pass.
+ *
+ * @retval 0                                       Data decrypted and tag verified.
+ * @retval MBEDTLS_ERR_GCM_AUTH_FAILED             Tag does not match. The output buffer is cleared.
+ * @retval MBEDTLS_ERR_GCM_BAD_INPUT               Invalid length.
+ * @retval MBEDTLS_ERR_PLATFORM_HW_ACCEL_FAILED    The SCE operation failed.
+ **********************************************************************************************************************/
+static int gcm_auth_decrypt_sce (mbedtls_gcm_context * ctx,
+                                 size_t                length,
+                                 const unsigned char * iv,
+                                 size_t                iv_len,
+                                 const unsigned char * add,
+                                 size_t                add_len,
+                                 const unsigned char * tag,
+                                 size_t                tag_len,
+                                 const unsigned char * input,
+                                 unsigned char       * output)
+{
+    int       ret      = 0;
+    fsp_err_t err      = FSP_SUCCESS;
+    size_t    full_len = length & ~((size_t) SIZE_AES_BLOCK_BYTES - 1U);
+    size_t    rest_len = length - full_len;
+    uint32_t  len_block[SIZE_AES_BLOCK_WORDS];
+    uint32_t  tag_len_word;
+    uint32_t  last_in[SIZE_AES_BLOCK_WORDS]  = {0};
+    uint32_t  last_out[SIZE_AES_BLOCK_WORDS] = {0};
+    uint32_t  tag_in[SIZE_AES_BLOCK_WORDS]   = {0};
+
+    GCM_VALIDATE_RET(ctx != NULL);
+    GCM_VALIDATE_RET(iv != NULL);
+    GCM_VALIDATE_RET(add_len == 0 || add != NULL);
+    GCM_VALIDATE_RET(tag != NULL);
+    GCM_VALIDATE_RET(length == 0 || input != NULL);
+    GCM_VALIDATE_RET(length == 0 || output != NULL);
+
+    if ((tag_len > SIZE_AES_BLOCK_BYTES) || (tag_len < GCM_ALT_TAG_MIN_BYTES) ||
+        ((uint64_t) length > GCM_ALT_MAX_TEXT_BYTES))
+    {
+        return MBEDTLS_ERR_GCM_BAD_INPUT;
+    }
+
+    ret = gcm_hw_start(ctx, 1U, iv, iv_len, add, add_len);
+    if (0 != ret)
+    {
+        return ret;
+    }
+
+    uint32_t key_bits = gcm_key_bits(ctx);
+
+    if (0U != full_len)
+    {
+        if (FSP_SUCCESS !=
+            HW_SCE_AES_GcmUpdate(key_bits, 1U, (const uint32_t *) input, (uint32_t *) output,
+                                 (uint32_t) (full_len / sizeof(uint32_t)))) // NOLINT(rea-tp-casting)
+        {
+            mbedtls_platform_zeroize(output, full_len);
+
+            return MBEDTLS_ERR_PLATFORM_HW_ACCEL_FAILED;
+        }
+    }
+
+    memcpy(last_in, &input[full_len], rest_len);
+    memcpy(tag_in, tag, tag_len);
+    gcm_lengths_encode(add_len, length, len_block);
+    tag_len_word = __REV((uint32_t) tag_len);
+
+    err = HW_SCE_AES_GcmDecryptFinal(key_bits, last_in, tag_in, &len_block[0], &len_block[2], &tag_len_word,
+                                     last_out);
+    if (FSP_ERR_CRYPTO_SCE_AUTHENTICATION == err)
+    {
+        mbedtls_platform_zeroize(output, length);
+        ret = MBEDTLS_ERR_GCM_AUTH_FAILED;
+    }
+    else if (FSP_SUCCESS != err)
+    {
+        mbedtls_platform_zeroize(output, length);
+        ret = MBEDTLS_ERR_PLATFORM_HW_ACCEL_FAILED;
+    }
+    else
+    {
+        memcpy(&output[full_len], last_out, rest_len);
+    }
+
+    mbedtls_platform_zeroize(last_in, sizeof(last_in));
+    mbedtls_platform_zeroize(last_out, sizeof(last_out));
+
+    return ret;
+}
+
+int mbedtls_gcm_auth_decrypt (mbedtls_gcm_context * ctx,
+                              size_t                length,
+                              const unsigned char * iv,
+                              size_t                iv_len,
+                              const unsigned char * add,
+                              size_t                add_len,
+                              const unsigned char * tag,
+                              size_t                tag_len,
+                              const unsigned char * input,
+                              unsigned char       * output)
+{
+    if (FSP_SUCCESS != RM_PSA_CRYPTO_SCE_ACQUIRE())
+    {
+        return MBEDTLS_ERR_PLATFORM_HW_ACCEL_FAILED;
+    }
+
+    int ret = gcm_auth_decrypt_sce(ctx, length, iv, iv_len, add, add_len, tag, tag_len, input, output);
+
+    RM_PSA_CRYPTO_SCE_RELEASE();
+
+    return ret;
+}
+
+void mbedtls_gcm_free (mbedtls_gcm_context * ctx)
+{
+    if (ctx == NULL)
+    {
+        return;
+    }
+
+    mbedtls_aes_free(&ctx->aes);
+    mbedtls_platform_zeroize(ctx, sizeof(mbedtls_gcm_context));
+}
+
+/*******************************************************************************************************************//**
+ * @} (end addtogroup RM_PSA_CRYPTO)
+ **********************************************************************************************************************/
+
+static uint32_t gcm_key_bits (const mbedtls_gcm_context * ctx)
+{
+    if (12 == ctx->aes.nr)
+    {
+        return SIZE_AES_192BIT_KEYLEN_BITS;
+    }
+
+    if (14 == ctx->aes.nr)
+    {
+        return SIZE_AES_256BIT_KEYLEN_BITS;
+    }
+
+    if (10 == ctx->aes.nr)
+    {
+        return SIZE_AES_128BIT_KEYLEN_BITS;
+    }
+
+    /* No key set. The SCE adaptor rejects this size. */
+    return 0U;
+}
+
+/* Encrypts num_words / 4 blocks in one SCE call. p_input and p_output may be the same buffer. */
+static int gcm_ecb_encrypt_sce (mbedtls_gcm_context * ctx, const uint32_t * p_input, uint32_t * p_output,
+                                uint32_t num_words)
+{
+    fsp_err_t err;
+
+    switch (ctx->aes.nr)
+    {
+        case 10:
+        {
+            err = HW_SCE_AES_128EcbEncrypt(ctx->aes.buf, num_words, p_input, p_output);
+            break;
+        }
+
+        case 12:
+        {
+            err = HW_SCE_AES_192EcbEncrypt(ctx->aes.buf, num_words, p_input, p_output);
+            break;
+        }
+
+        case 14:
+        {
+            err = HW_SCE_AES_256EcbEncrypt(ctx->aes.buf, num_words, p_input, p_output);
+            break;
+        }
+
+        default:
+        {
+            return MBEDTLS_ERR_GCM_BAD_INPUT;
+        }
+    }
+
+    return (FSP_SUCCESS == err) ? 0 : MBEDTLS_ERR_PLATFORM_HW_ACCEL_FAILED;
+}
+
+static int gcm_ecb_encrypt (mbedtls_gcm_context * ctx, const uint32_t * p_input, uint32_t * p_output,
+                            uint32_t num_words)
+{
+    if (FSP_SUCCESS != RM_PSA_CRYPTO_SCE_ACQUIRE())
+    {
+        return MBEDTLS_ERR_PLATFORM_HW_ACCEL_FAILED;
+    }
+
+    int ret = gcm_ecb_encrypt_sce(ctx, p_input, p_output, num_words);
+
+    RM_PSA_CRYPTO_SCE_RELEASE();
+
+    return ret;
+}
+
+/* Folds length bytes into the GHASH value y. A trailing partial block is zero padded. */
+static int gcm_ghash_sce (mbedtls_gcm_context * ctx, uint32_t y[4], const unsigned char * p_data, size_t length)
+{
+    size_t    full_len = length & ~((size_t) SIZE_AES_BLOCK_BYTES - 1U);
+    size_t    rest_len = length - full_len;
+    fsp_err_t err      = FSP_SUCCESS;
+
+    if (0U != full_len)
+    {
+        err = HW_SCE_AES_Ghash(ctx->h, y, (const uint32_t *) p_data, y,
+                               (uint32_t) (full_len / sizeof(uint32_t))); // NOLINT(rea-tp-casting)
+    }
+
+    if ((FSP_SUCCESS == err) && (0U != rest_len))
+    {
+        uint32_t block[SIZE_AES_BLOCK_WORDS] = {0};
+
+        memcpy(block, &p_data[full_len], rest_len);
+        err = HW_SCE_AES_Ghash(ctx->h, y, block, y, SIZE_AES_BLOCK_WORDS);
+        mbedtls_platform_zeroize(block, sizeof(block));
+    }
+
+    return (FSP_SUCCESS == err) ? 0 : MBEDTLS_ERR_PLATFORM_HW_ACCEL_FAILED;
+}
+
+static int gcm_ghash (mbedtls_gcm_context * ctx, uint32_t y[4], const unsigned char * p_data, size_t length)
+{
+    if (FSP_SUCCESS != RM_PSA_CRYPTO_SCE_ACQUIRE())
+    {
+        return MBEDTLS_ERR_PLATFORM_HW_ACCEL_FAILED;
+    }
+
+    int ret = gcm_ghash_sce(ctx, y, p_data, length);
+
+    RM_PSA_CRYPTO_SCE_RELEASE();
+
+    return ret;
+}
+
+/* Derives the pre-counter block J0 from the IV (NIST SP 800-38D section 7.1). */
+static int gcm_j0_compute (mbedtls_gcm_context * ctx, const unsigned char * iv, size_t iv_len, uint32_t j0[4])
+{
+    int      ret;
+    uint32_t len_block[SIZE_AES_BLOCK_WORDS];
+
+    if (12U == iv_len)
+    {
+        memcpy(j0, iv, iv_len);
+        j0[3] = __REV(1U);
+
+        return 0;
+    }
+
+    memset(j0, 0, SIZE_AES_BLOCK_BYTES);
+
+    ret = gcm_ghash(ctx, j0, iv, iv_len);
+    if (0 == ret)
+    {
+        gcm_lengths_encode(0U, iv_len, len_block);
+        ret = gcm_ghash(ctx, j0, (const unsigned char *) len_block, sizeof(len_block));
+    }
+
+    return ret;
+}
+
+/* Encodes the AAD and text lengths as the big-endian bit counts used by the GCM length block. */
+static void gcm_lengths_encode (uint64_t add_len, uint64_t len, uint32_t block[4])
+{
+    block[0] = __REV((uint32_t) (add_len >> 29));
+    block[1] = __REV((uint32_t) (add_len << 3));
+    block[2] = __REV((uint32_t) (len >> 29));
+    block[3] = __REV((uint32_t) (len << 3));
+}
+
+/* Loads the key and J0 into the SCE AES-GCM engine and feeds it the AAD. */
+static int gcm_hw_start (mbedtls_gcm_context * ctx,
+                         uint32_t              decrypt,
+                         const unsigned char * iv,
+                         size_t                iv_len,
+                         const unsigned char * add,
+                         size_t                add_len)
+{
+    int      ret;
+    uint32_t key_bits = gcm_key_bits(ctx);
+    size_t   full_len = add_len & ~((size_t) SIZE_AES_BLOCK_BYTES - 1U);
+    size_t   rest_len = add_len - full_len;
+    uint32_t j0[SIZE_AES_BLOCK_WORDS];
+
+    if ((0U == iv_len) || (0U != (((uint64_t) iv_len) >> 61)) || (0U != (((uint64_t) add_len) >> 61)))
+    {
+        return MBEDTLS_ERR_GCM_BAD_INPUT;
+    }
+
+    /* J0 needs the GHASH engine, so it must be derived before the GCM engine is started. */
+    ret = gcm_j0_compute(ctx, iv, iv_len, j0);
+    if (0 != ret)
+    {
+        return ret;
+    }
+
+    if (FSP_SUCCESS != HW_SCE_AES_GcmInit(key_bits, decrypt, ctx->aes.buf, j0))
+    {
+        return MBEDTLS_ERR_PLATFORM_HW_ACCEL_FAILED;
+    }
+
+    if (0U != full_len)
+    {
+        if (FSP_SUCCESS !=
+            HW_SCE_AES_GcmUpdateAad(key_bits, decrypt, (const uint32_t *) add,
+                                    (uint32_t) (full_len / sizeof(uint32_t)))) // NOLINT(rea-tp-casting)
+        {
+            return MBEDTLS_ERR_PLATFORM_HW_ACCEL_FAILED;
+        }
+    }
+
+    if (0U != rest_len)
+    {
+        uint32_t block[SIZE_AES_BLOCK_WORDS] = {0};
+
+        memcpy(block, &add[full_len], rest_len);
+        if (FSP_SUCCESS != HW_SCE_AES_GcmUpdateAad(key_bits, decrypt, block, SIZE_AES_BLOCK_WORDS))
+        {
+            return MBEDTLS_ERR_PLATFORM_HW_ACCEL_FAILED;
+        }
+    }
+
+    if (FSP_SUCCESS != HW_SCE_AES_GcmUpdateTransition(key_bits, decrypt))
+    {
+        return MBEDTLS_ERR_PLATFORM_HW_ACCEL_FAILED;
+    }
+
+    return 0;
+}
+
+ #endif                                /* MBEDTLS_GCM_ALT */
+#endif                                 /* MBEDTLS_GCM_C */
@@ -60,6 +60,36 @@ extern "C"
 
     int aes_setkey_generic(mbedtls_aes_context *ctx, const unsigned char *key, unsigned int keybits);
 
+/* Set to 1 to use a constant-time, table-free software cipher for the keys the SCE has no procedure for (AES-192
+ * except on SCE9). Without it, such keys are rejected with MBEDTLS_ERR_PLATFORM_FEATURE_UNSUPPORTED. */
+#ifndef PSA_CRYPTO_CFG_AES_SOFT_FALLBACK
+ #define PSA_CRYPTO_CFG_AES_SOFT_FALLBACK    (0)
+#endif
+
+#if PSA_CRYPTO_CFG_AES_SOFT_FALLBACK
+
+/* A context keyed with aes_alt_soft_setkey() points rk at its own round keys. */
+ #define AES_ALT_SOFT_CONTEXT(ctx)    ((ctx)->rk == (ctx)->buf)
+
+    int  aes_alt_soft_setkey(mbedtls_aes_context *ctx, const unsigned char *key, unsigned int keybits);
+    void aes_alt_soft_encrypt(const mbedtls_aes_context *ctx, const unsigned char input[16],
+                              unsigned char output[16]);
+    void aes_alt_soft_decrypt(const mbedtls_aes_context *ctx, const unsigned char input[16],
+                              unsigned char output[16]);
+#endif
+
+#if defined(MBEDTLS_CIPHER_MODE_CBC) && defined(MBEDTLS_AES_ENCRYPT_ALT) && defined(MBEDTLS_AES_DECRYPT_ALT)
+    int mbedtls_internal_aes_crypt_cbc_blocks(mbedtls_aes_context *ctx, int mode, size_t num_blocks,
+                                              unsigned char iv[16], const unsigned char *input,
+                                              unsigned char *output);
+#endif
+
+#if defined(MBEDTLS_CIPHER_MODE_CTR) && defined(MBEDTLS_AES_ENCRYPT_ALT)
+    int mbedtls_internal_aes_crypt_ctr_blocks(mbedtls_aes_context *ctx, size_t num_blocks,
+                                              unsigned char nonce_counter[16], const unsigned char *input,
+                                              unsigned char *output);
+#endif
+
 #endif /* MBEDTLS_AES_ALT */
 
 #ifdef __cplusplus
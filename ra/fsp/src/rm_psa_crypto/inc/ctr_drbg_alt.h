@@ -145,6 +145,23 @@
 /**< The maximum size of seed or reseed buffer in bytes. */
  #endif
 
+/** \def MBEDTLS_CTR_DRBG_POOL_SIZE
+ *
+ * \brief Size of the pre-generated random pool held in each context, in bytes.
+ *
+ * When defined, mbedtls_ctr_drbg_pool_fill() tops up the pool (from a low
+ * priority task or an idle hook) and small mbedtls_ctr_drbg_random() requests
+ * are copied from it instead of running the DRBG. Leave undefined to disable.
+ */
+
+ #if defined(MBEDTLS_CTR_DRBG_POOL_SIZE)
+  #if !defined(MBEDTLS_CTR_DRBG_POOL_MAX_REQUEST)
+   #define MBEDTLS_CTR_DRBG_POOL_MAX_REQUEST    32
+
+/**< The largest request, in bytes, served from the random pool. */
+  #endif
+ #endif
+
 /* \} name SECTION: Module settings */
 
  #define MBEDTLS_CTR_DRBG_PR_OFF    0
@@ -215,6 +232,11 @@ typedef struct mbedtls_ctr_drbg_context
 
     void * p_entropy;                  /*!< The context for the entropy function. */
 
+ #if defined(MBEDTLS_CTR_DRBG_POOL_SIZE)
+    unsigned char pool[MBEDTLS_CTR_DRBG_POOL_SIZE]; /*!< DRBG output not yet handed out. */
+    size_t        pool_len;                         /*!< Number of valid bytes in the pool. */
+ #endif
+
  #if defined(MBEDTLS_THREADING_C)
     mbedtls_threading_mutex_t mutex;
  #endif
@@ -493,6 +515,30 @@ int mbedtls_ctr_drbg_random_with_add(void                * p_rng,
  */
 int mbedtls_ctr_drbg_random(void * p_rng, unsigned char * output, size_t output_len);
 
+ #if defined(MBEDTLS_CTR_DRBG_POOL_SIZE)
+
+/**
+ * \brief   This function tops up the pre-generated random pool of a
+ *          CTR_DRBG context.
+ *
+ * Call it from a low-priority task or an idle hook so that DRBG updates and
+ * reseeds run outside the callers of mbedtls_ctr_drbg_random(). Requests of
+ * at most MBEDTLS_CTR_DRBG_POOL_MAX_REQUEST bytes are then served by copying
+ * from the pool while it holds enough data. The pool is not used when
+ * prediction resistance is enabled.
+ *
+ * \note    With MBEDTLS_THREADING_C this function takes the context mutex,
+ *          so it must not be called from a context that cannot block.
+ *
+ * \param ctx           The seeded CTR_DRBG context.
+ *
+ * \return              \c 0 on success.
+ * \return              MBEDTLS_ERR_CTR_DRBG_ENTROPY_SOURCE_FAILED on failure.
+ */
+int mbedtls_ctr_drbg_pool_fill(mbedtls_ctr_drbg_context * ctx);
+
+ #endif
+
  #if !defined(MBEDTLS_DEPRECATED_REMOVED)
   #if defined(MBEDTLS_DEPRECATED_WARNING)
    #define MBEDTLS_DEPRECATED    __attribute__((deprecated))
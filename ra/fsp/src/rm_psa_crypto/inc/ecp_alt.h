@@ -162,5 +162,117 @@ typedef struct mbedtls_ecp_group
 #define MBEDTLS_ECP_FIXED_POINT_OPTIM 1 /**< Enable fixed-point speed-up. */
 #endif                                  /* MBEDTLS_ECP_FIXED_POINT_OPTIM */
 
+#if defined(MBEDTLS_ECDSA_VERIFY_ALT)
+
+/**
+ * \brief           One signature of a batch passed to mbedtls_ecdsa_verify_batch().
+ */
+typedef struct mbedtls_ecdsa_verify_item
+{
+    const unsigned char *buf;           /*!< The hashed message. */
+    size_t blen;                        /*!< The length of \p buf in Bytes. */
+    const mbedtls_ecp_point *Q;         /*!< The public key. Consecutive items may share it. */
+    const mbedtls_mpi *r;               /*!< The first part of the signature. */
+    const mbedtls_mpi *s;               /*!< The second part of the signature. */
+    int ret;                            /*!< Set to the verification result of this item. */
+}
+mbedtls_ecdsa_verify_item;
+
+/**
+ * \brief           Verify several ECDSA signatures on the same curve.
+ *
+ * \param grp       The ECP group all signatures use.
+ * \param items     The signatures to verify. Each item's \c ret is set.
+ * \param count     The number of items.
+ *
+ * \return          \c 0 if every signature is valid.
+ * \return          The result of the first failing item otherwise, or an
+ *                  \c MBEDTLS_ERR_ECP_XXX error if the batch could not be set up.
+ */
+int mbedtls_ecdsa_verify_batch(mbedtls_ecp_group *grp, mbedtls_ecdsa_verify_item *items, size_t count);
+
+#endif /* MBEDTLS_ECDSA_VERIFY_ALT */
+
+/** \def MBEDTLS_ECP_EPHEMERAL_POOL_SIZE
+ *
+ * \brief Number of pregenerated ephemeral key pairs held for ECDH.
+ *
+ * When defined, mbedtls_ecp_ephemeral_pool_fill() generates key pairs ahead
+ * of time (from a low priority task or an idle hook) and
+ * mbedtls_ecp_gen_ephemeral() hands them out, so that an ECDH handshake only
+ * runs the shared-secret scalar multiplication. Leave undefined to disable.
+ */
+
+/**
+ * \brief           Generate an ephemeral key pair (d, Q) for ECDH.
+ *
+ * A matching pregenerated pair is taken from the pool when
+ * MBEDTLS_ECP_EPHEMERAL_POOL_SIZE is defined. Otherwise the pair is generated
+ * by the SCE; on engines whose key generation returns the public key, no
+ * separate Q = d.G multiplication is run.
+ *
+ * \param grp       The ECP group. \c vendor_ctx selects the key format.
+ * \param d         The destination MPI for the private key.
+ * \param Q         The destination point for the public key.
+ * \param f_rng     Unused. The SCE provides the randomness.
+ * \param p_rng     Unused.
+ *
+ * \return          \c 0 on success.
+ * \return          An \c MBEDTLS_ERR_ECP_XXX or \c MBEDTLS_MPI_XXX error code on failure.
+ */
+int mbedtls_ecp_gen_ephemeral(mbedtls_ecp_group *grp, mbedtls_mpi *d, mbedtls_ecp_point *Q,
+                              int (*f_rng)(void *, unsigned char *, size_t), void *p_rng);
+
+#if defined(MBEDTLS_ECP_EPHEMERAL_POOL_SIZE)
+
+/**
+ * \brief           Top up the ephemeral key pool with key pairs for a group.
+ *
+ * Every free pool entry receives a key pair for \p grp, in the key format
+ * selected by its \c vendor_ctx. Entries are only handed out to a group with
+ * the same curve and key format.
+ *
+ * \note            Call it from one task only. It uses the SCE, so it must be
+ *                  serialized with other crypto operations like any other
+ *                  mbedtls call.
+ *
+ * \param grp       The loaded ECP group to generate key pairs for.
+ *
+ * \return          \c 0 on success.
+ * \return          An \c MBEDTLS_ERR_ECP_XXX or \c MBEDTLS_MPI_XXX error code on failure.
+ */
+int mbedtls_ecp_ephemeral_pool_fill(mbedtls_ecp_group *grp);
+
+/**
+ * \brief           Wipe all pregenerated key pairs from the ephemeral key pool.
+ */
+void mbedtls_ecp_ephemeral_pool_flush(void);
+
+#endif /* MBEDTLS_ECP_EPHEMERAL_POOL_SIZE */
+
+#if defined(MBEDTLS_ECDH_ALT)
+
+/**
+ * \brief           Generate an ephemeral key pair and compute the shared
+ *                  secret with a peer public key in one call.
+ *
+ * The private key never leaves this function and is wiped before it returns.
+ *
+ * \param grp       The ECP group.
+ * \param Q         The destination point for our public key, to send to the peer.
+ * \param z         The destination MPI for the shared secret.
+ * \param Qp        The peer's public key.
+ * \param f_rng     The RNG function, passed to the ECP layer.
+ * \param p_rng     The RNG context.
+ *
+ * \return          \c 0 on success.
+ * \return          An \c MBEDTLS_ERR_ECP_XXX or \c MBEDTLS_MPI_XXX error code on failure.
+ */
+int mbedtls_ecdh_gen_compute_shared(mbedtls_ecp_group *grp, mbedtls_ecp_point *Q, mbedtls_mpi *z,
+                                    const mbedtls_ecp_point *Qp,
+                                    int (*f_rng)(void *, unsigned char *, size_t), void *p_rng);
+
+#endif /* MBEDTLS_ECDH_ALT */
+
 #endif /* MBEDTLS_ECP_ALT */
 #endif /* MBEDTLS_ECP_ALT_H */
@@ -40,6 +40,35 @@
  **********************************************************************************************************************/
 fsp_err_t RM_PSA_CRYPTO_TRNG_Read(uint8_t * const p_rngbuf, uint32_t num_req_bytes, uint32_t * p_num_gen_bytes);
 
+/* Idle time in milliseconds after which the SCE is powered down, see RM_PSA_CRYPTO_SCE_IdleProcess(). With 0 the SCE
+ * stays powered from mbedtls_platform_setup() on. */
+  #ifndef PSA_CRYPTO_CFG_SCE_IDLE_TIMEOUT_MS
+   #define PSA_CRYPTO_CFG_SCE_IDLE_TIMEOUT_MS    (0)
+  #endif
+
+  #define RM_PSA_CRYPTO_SCE_POWER_GATING         (PSA_CRYPTO_CFG_SCE_IDLE_TIMEOUT_MS > 0)
+
+  #if RM_PSA_CRYPTO_SCE_POWER_GATING
+
+/** SCE power statistics. The wake cost is measured with the DWT cycle counter and is 0 on MCUs without one. */
+typedef struct st_rm_psa_crypto_sce_power_stats
+{
+    uint32_t wake_count;               ///< Number of times an operation powered up and reinitialized the SCE
+    uint32_t wake_cycles_last;         ///< Core clock cycles spent in the last wake
+    uint32_t wake_cycles_max;          ///< Largest number of core clock cycles spent in a wake
+    uint32_t sleep_count;              ///< Number of times the SCE was powered down after the idle timeout
+    bool     powered;                  ///< The SCE is currently powered
+} rm_psa_crypto_sce_power_stats_t;
+
+fsp_err_t RM_PSA_CRYPTO_SCE_Acquire(void);
+void      RM_PSA_CRYPTO_SCE_Release(void);
+void      RM_PSA_CRYPTO_SCE_IdleProcess(uint32_t elapsed_ms);
+void      RM_PSA_CRYPTO_SCE_PowerStatsGet(rm_psa_crypto_sce_power_stats_t * const p_stats);
+
+   #define RM_PSA_CRYPTO_SCE_ACQUIRE()           RM_PSA_CRYPTO_SCE_Acquire()
+   #define RM_PSA_CRYPTO_SCE_RELEASE()           RM_PSA_CRYPTO_SCE_Release()
+  #endif
+
   #ifdef __cplusplus
 extern "C"
 {
@@ -50,6 +79,12 @@ extern "C"
   #endif
  #endif                                /* MBEDTLS_PLATFORM_SETUP_TEARDOWN_ALT */
 
+/* Bracket each SCE operation of the PSA crypto layer. They compile away when SCE power gating is disabled. */
+ #if !defined(RM_PSA_CRYPTO_SCE_ACQUIRE)
+  #define RM_PSA_CRYPTO_SCE_ACQUIRE()    (FSP_SUCCESS)
+  #define RM_PSA_CRYPTO_SCE_RELEASE()
+ #endif
+
 /*******************************************************************************************************************/ /**
  * @} (end addtogroup PSA_CRYPTO)
  **********************************************************************************************************************/
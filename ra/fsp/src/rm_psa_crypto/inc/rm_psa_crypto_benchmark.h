@@ -0,0 +1,102 @@
+/***********************************************************************************************************************
+ * Copyright [2020] Renesas Electronics Corporation and/or its affiliates.  All Rights Reserved.
+ *
+ * This software and documentation are supplied by Renesas Electronics America Inc. and may only be used with products
+ * of Renesas Electronics Corp. and its affiliates ("Renesas").  No other uses are authorized.  Renesas products are
+ * sold pursuant to Renesas terms and conditions of sale.  Purchasers are solely responsible for the selection and use
+ * of Renesas products and Renesas assumes no liability.  No license, express or implied, to any intellectual property
+ * right is granted by Renesas. This software is protected under all applicable laws, including copyright laws. Renesas
+ * reserves the right to change or discontinue this software and/or this documentation. THE SOFTWARE AND DOCUMENTATION
+ * IS DELIVERED TO YOU "AS IS," AND RENESAS MAKES NO REPRESENTATIONS OR WARRANTIES, AND TO THE FULLEST EXTENT
+ * PERMISSIBLE UNDER APPLICABLE LAW, DISCLAIMS ALL WARRANTIES, WHETHER EXPLICITLY OR IMPLICITLY, INCLUDING WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, AND NONINFRINGEMENT, WITH RESPECT TO THE SOFTWARE OR
+ * DOCUMENTATION.  RENESAS SHALL HAVE NO LIABILITY ARISING OUT OF ANY SECURITY VULNERABILITY OR BREACH.  TO THE MAXIMUM
+ * EXTENT PERMITTED BY LAW, IN NO EVENT WILL RENESAS BE LIABLE TO YOU IN CONNECTION WITH THE SOFTWARE OR DOCUMENTATION
+ * (OR ANY PERSON OR ENTITY CLAIMING RIGHTS DERIVED FROM YOU) FOR ANY LOSS, DAMAGES, OR CLAIMS WHATSOEVER, INCLUDING,
+ * WITHOUT LIMITATION, ANY DIRECT, CONSEQUENTIAL, SPECIAL, INDIRECT, PUNITIVE, OR INCIDENTAL DAMAGES; ANY LOST PROFITS,
+ * OTHER ECONOMIC DAMAGE, PROPERTY DAMAGE, OR PERSONAL INJURY; AND EVEN IF RENESAS HAS BEEN ADVISED OF THE POSSIBILITY
+ * OF SUCH LOSS, DAMAGES, CLAIMS OR COSTS.
+ **********************************************************************************************************************/
+
+#ifndef RM_PSA_CRYPTO_BENCHMARK_H
+ #define RM_PSA_CRYPTO_BENCHMARK_H
+
+ #include "bsp_api.h"
+
+/** Common macro for FSP header files. There is also a corresponding FSP_FOOTER macro at the end of this file. */
+FSP_HEADER
+
+/*******************************************************************************************************************//**
+ * @addtogroup RM_PSA_CRYPTO
+ * @{
+ **********************************************************************************************************************/
+
+/** Primitives measured by RM_PSA_CRYPTO_BenchmarkRun(). Bulk primitives and TRNG reads are run once per buffer
+ * size; public key primitives are run on a freshly generated key. */
+typedef enum e_rm_psa_crypto_benchmark
+{
+    RM_PSA_CRYPTO_BENCHMARK_AES_128_ECB,       ///< AES-128 ECB encryption
+    RM_PSA_CRYPTO_BENCHMARK_AES_128_CBC,       ///< AES-128 CBC encryption
+    RM_PSA_CRYPTO_BENCHMARK_AES_128_CTR,       ///< AES-128 CTR encryption
+    RM_PSA_CRYPTO_BENCHMARK_AES_256_ECB,       ///< AES-256 ECB encryption
+    RM_PSA_CRYPTO_BENCHMARK_AES_256_CBC,       ///< AES-256 CBC encryption
+    RM_PSA_CRYPTO_BENCHMARK_AES_256_CTR,       ///< AES-256 CTR encryption
+    RM_PSA_CRYPTO_BENCHMARK_AES_128_GCM,       ///< AES-128 GCM authenticated encryption
+    RM_PSA_CRYPTO_BENCHMARK_SHA256,            ///< SHA-256 hash
+    RM_PSA_CRYPTO_BENCHMARK_ECDSA_P256_SIGN,   ///< ECDSA P-256 signature of a SHA-256 digest
+    RM_PSA_CRYPTO_BENCHMARK_ECDSA_P256_VERIFY, ///< ECDSA P-256 verification of a SHA-256 digest
+    RM_PSA_CRYPTO_BENCHMARK_ECDSA_P384_SIGN,   ///< ECDSA P-384 signature of a SHA-256 digest
+    RM_PSA_CRYPTO_BENCHMARK_ECDSA_P384_VERIFY, ///< ECDSA P-384 verification of a SHA-256 digest
+    RM_PSA_CRYPTO_BENCHMARK_RSA_2048_PRIVATE,  ///< RSA-2048 private key operation
+    RM_PSA_CRYPTO_BENCHMARK_RSA_2048_PUBLIC,   ///< RSA-2048 public key operation
+    RM_PSA_CRYPTO_BENCHMARK_RSA_3072_PRIVATE,  ///< RSA-3072 private key operation
+    RM_PSA_CRYPTO_BENCHMARK_RSA_3072_PUBLIC,   ///< RSA-3072 public key operation
+    RM_PSA_CRYPTO_BENCHMARK_TRNG,              ///< TRNG read
+    RM_PSA_CRYPTO_BENCHMARK_AES_128_ECB_SOFT,  ///< AES-128 ECB encryption with the software fallback cipher
+    RM_PSA_CRYPTO_BENCHMARK_AES_128_CTR_SOFT,  ///< AES-128 CTR encryption with the software fallback cipher
+    RM_PSA_CRYPTO_BENCHMARK_COUNT,             ///< Number of primitives, not a valid selection
+} rm_psa_crypto_benchmark_t;
+
+/** Measurement reported for one primitive and buffer size. */
+typedef struct st_rm_psa_crypto_benchmark_result
+{
+    rm_psa_crypto_benchmark_t benchmark;       ///< Primitive measured
+    uint32_t                  size;            ///< Bytes processed per operation
+    uint32_t                  iterations;      ///< Number of operations timed
+    uint64_t                  cycles;          ///< Total CPU cycles spent in all operations
+    uint32_t                  cycles_per_op;   ///< Average CPU cycles per operation
+    uint32_t                  cycles_per_byte; ///< Average CPU cycles per byte, 0 for public key primitives
+    uint32_t                  ops_per_second;  ///< Operations per second at SystemCoreClock
+    int                       status;          ///< 0 on success, or the mbedTLS error that stopped the measurement
+    void const              * p_context;       ///< User defined context passed in the configuration
+} rm_psa_crypto_benchmark_result_t;
+
+/** Benchmark configuration. */
+typedef struct st_rm_psa_crypto_benchmark_cfg
+{
+    uint32_t const * p_sizes;          ///< Buffer sizes in bytes swept for bulk primitives, multiples of 16
+    uint32_t         num_sizes;        ///< Number of entries in p_sizes
+    uint8_t        * p_work;           ///< Work buffer of at least twice the largest size (and 1 KB), word aligned
+    uint32_t         work_size;        ///< Size of p_work in bytes
+    uint32_t         bulk_iterations;  ///< Operations timed per bulk primitive and size
+    uint32_t         pk_iterations;    ///< Operations timed per public key primitive
+    bsp_cycle_counter_get_t p_cycles_get; ///< Cycle counter, NULL to use the DWT cycle counter
+
+    /** Called with each measurement. */
+    void (* p_callback)(rm_psa_crypto_benchmark_result_t const * p_result);
+    void const * p_context;            ///< Placeholder for user data, passed back in each result
+} rm_psa_crypto_benchmark_cfg_t;
+
+/**********************************************************************************************************************
+ * Public Function Prototypes
+ **********************************************************************************************************************/
+fsp_err_t RM_PSA_CRYPTO_BenchmarkRun(rm_psa_crypto_benchmark_cfg_t const * const p_cfg);
+
+/*******************************************************************************************************************//**
+ * @} (end addtogroup RM_PSA_CRYPTO)
+ **********************************************************************************************************************/
+
+/** Common macro for FSP header files. There is also a corresponding FSP_HEADER macro at the top of this file. */
+FSP_FOOTER
+
+#endif                                 /* RM_PSA_CRYPTO_BENCHMARK_H */
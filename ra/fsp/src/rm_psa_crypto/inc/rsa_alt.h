@@ -147,10 +147,22 @@ typedef struct mbedtls_rsa_context
                                         *   mask generating function used in the
                                         *   EME-OAEP and EMSA-PSS encodings. */
     void * vendor_ctx;                 /*!< Vendor defined context. */
+    uint32_t * p_sce_key;              /*!< Cached SCE formatted N and D, built on the first
+                                        *   private key operation. */
  #if defined(MBEDTLS_THREADING_C)
     mbedtls_threading_mutex_t mutex;   /*!<  Thread-safety mutex. */
  #endif
 } mbedtls_rsa_context;
 
+/* Release the SCE formatted key cached by mbedtls_rsa_private(). */
+void mbedtls_internal_rsa_key_cache_free(mbedtls_rsa_context * ctx);
+
+/* Software CRT private key operation for keys the SCE procedures do not take. */
+int mbedtls_internal_rsa_private_crt(mbedtls_rsa_context * ctx,
+                                     int (* f_rng)(void *, unsigned char *, size_t),
+                                     void                * p_rng,
+                                     const unsigned char * input,
+                                     unsigned char       * output);
+
 #endif /* MBEDTLS_RSA_ALT */
 #endif                                 /* MBEDTLS_RSA_ALT_H */
@@ -52,6 +52,150 @@ typedef struct mbedtls_sha256_context
 }
 mbedtls_sha256_context;
 
+/**
+ * \brief          HMAC-SHA-256 context holding the hash state after the
+ *                 key pads.
+ *
+ *                 The inner and outer states are computed once by
+ *                 mbedtls_sha256_hmac_setup(). Each HMAC then starts from
+ *                 a copy of them instead of hashing the ipad and opad
+ *                 blocks again, which saves two compression function
+ *                 calls on the SCE per HMAC.
+ */
+typedef struct mbedtls_sha256_hmac_context
+{
+    mbedtls_sha256_context inner;   /*!< State after hashing key ^ ipad. */
+    mbedtls_sha256_context outer;   /*!< State after hashing key ^ opad. */
+    mbedtls_sha256_context work;    /*!< State of the HMAC in progress.  */
+}
+mbedtls_sha256_hmac_context;
+
+/**
+ * \brief          Initialize an HMAC-SHA-256 context.
+ *
+ * \param ctx      The context to initialize.
+ */
+void mbedtls_sha256_hmac_init( mbedtls_sha256_hmac_context *ctx );
+
+/**
+ * \brief          Clear an HMAC-SHA-256 context, including the key states.
+ *
+ * \param ctx      The context to clear. May be \c NULL.
+ */
+void mbedtls_sha256_hmac_free( mbedtls_sha256_hmac_context *ctx );
+
+/**
+ * \brief          Hash the key pads. The context can then compute any
+ *                 number of HMACs with this key.
+ *
+ * \param ctx      The initialized context.
+ * \param key      The HMAC key. Keys longer than 64 bytes are hashed first.
+ * \param keylen   The length of \p key in bytes.
+ *
+ * \return         \c 0 on success.
+ * \return         A negative error code on failure.
+ */
+int mbedtls_sha256_hmac_setup( mbedtls_sha256_hmac_context *ctx,
+                               const unsigned char *key,
+                               size_t keylen );
+
+/**
+ * \brief          Start a streaming HMAC from the cached inner state.
+ *
+ * \param ctx      The context, keyed with mbedtls_sha256_hmac_setup().
+ *
+ * \return         \c 0 on success.
+ */
+int mbedtls_sha256_hmac_starts( mbedtls_sha256_hmac_context *ctx );
+
+/**
+ * \brief          Feed message data into a streaming HMAC.
+ *
+ * \param ctx      The context.
+ * \param input    The buffer holding the data.
+ * \param ilen     The length of \p input in bytes.
+ *
+ * \return         \c 0 on success.
+ * \return         A negative error code on failure.
+ */
+int mbedtls_sha256_hmac_update( mbedtls_sha256_hmac_context *ctx,
+                                const unsigned char *input,
+                                size_t ilen );
+
+/**
+ * \brief          Finish a streaming HMAC. The key states are kept, so
+ *                 mbedtls_sha256_hmac_starts() may be called again.
+ *
+ * \param ctx      The context.
+ * \param output   The 32-byte HMAC.
+ *
+ * \return         \c 0 on success.
+ * \return         A negative error code on failure.
+ */
+int mbedtls_sha256_hmac_finish( mbedtls_sha256_hmac_context *ctx,
+                                unsigned char output[32] );
+
+/**
+ * \brief          Compute the HMAC of a buffer in one call.
+ *
+ * \param ctx      The context, keyed with mbedtls_sha256_hmac_setup().
+ * \param input    The buffer holding the data.
+ * \param ilen     The length of \p input in bytes.
+ * \param output   The 32-byte HMAC.
+ *
+ * \return         \c 0 on success.
+ * \return         A negative error code on failure.
+ */
+int mbedtls_sha256_hmac( mbedtls_sha256_hmac_context *ctx,
+                         const unsigned char *input,
+                         size_t ilen,
+                         unsigned char output[32] );
+
+/**
+ * \brief          HKDF-Expand (RFC 5869) with HMAC-SHA-256.
+ *
+ *                 All iterations start from the cached key states. While
+ *                 \p info is at most 22 bytes each iteration takes two
+ *                 compression function calls on the SCE.
+ *
+ * \param prk      The context keyed with the pseudorandom key, e.g. by
+ *                 mbedtls_sha256_hmac_setup() on the HKDF-Extract output.
+ * \param info     Optional context information. May be \c NULL if
+ *                 \p info_len is 0.
+ * \param info_len The length of \p info in bytes.
+ * \param okm      The output keying material.
+ * \param okm_len  The length of \p okm in bytes, at most 255 * 32.
+ *
+ * \return         \c 0 on success.
+ * \return         #MBEDTLS_ERR_SHA256_BAD_INPUT_DATA if \p okm_len is too
+ *                 large.
+ * \return         Another negative error code on failure.
+ */
+int mbedtls_sha256_hkdf_expand( const mbedtls_sha256_hmac_context *prk,
+                                const unsigned char *info,
+                                size_t info_len,
+                                unsigned char *okm,
+                                size_t okm_len );
+
+#if defined(MBEDTLS_SHA256_PROCESS_ALT)
+
+/**
+ * \brief          Process a run of whole 64-byte blocks with a single
+ *                 hardware call.
+ *
+ * \param ctx        The SHA-256 context. This must be initialized.
+ * \param data       The buffer holding \p num_blocks consecutive blocks.
+ * \param num_blocks The number of 64-byte blocks to process.
+ *
+ * \return         \c 0 on success.
+ * \return         A negative error code on failure.
+ */
+int mbedtls_internal_sha256_process_blocks( mbedtls_sha256_context *ctx,
+                                            const unsigned char *data,
+                                            size_t num_blocks );
+
+#endif /* MBEDTLS_SHA256_PROCESS_ALT */
+
 
 
 
@@ -27,6 +27,7 @@
 #if defined(MBEDTLS_PLATFORM_SETUP_TEARDOWN_ALT)
  #include "platform.h"
  #include "hw_sce_private.h"
+ #include "rm_psa_crypto.h"
 
  #if defined(CONFIG_MEDTLS_USE_AFR_MEMORY) && defined(MBEDTLS_PLATFORM_MEMORY) && \
     !(defined(MBEDTLS_PLATFORM_CALLOC_MACRO) && defined(MBEDTLS_PLATFORM_FREE_MACRO))
@@ -35,6 +36,25 @@ extern void   vPortFree(void * pv);
 
  #endif
 
+/***********************************************************************************************************************
+ * Private global variables
+ **********************************************************************************************************************/
+
+ #if RM_PSA_CRYPTO_SCE_POWER_GATING
+
+/* SCE power state. Guarded by critical sections, since RM_PSA_CRYPTO_SCE_IdleProcess() may run from an interrupt. */
+static struct
+{
+    uint32_t                        ref_count; // Operations currently using the SCE
+    uint32_t                        idle_ms;   // Time since the last operation ended
+    bool                            powered;   // The SCE is powered and initialized
+    rm_psa_crypto_sce_power_stats_t stats;
+} g_rm_psa_crypto_sce_power;
+
+static void rm_psa_crypto_sce_powered_set(void);
+
+ #endif
+
 /*******************************************************************************************************************//**
  * @addtogroup RM_PSA_CRYPTO
  * @{
@@ -59,6 +79,11 @@ int mbedtls_platform_setup (mbedtls_platform_context * ctx)
  #if defined(CONFIG_MEDTLS_USE_AFR_MEMORY) && defined(MBEDTLS_PLATFORM_MEMORY) && \
     !(defined(MBEDTLS_PLATFORM_CALLOC_MACRO) && defined(MBEDTLS_PLATFORM_FREE_MACRO))
     mbedtls_platform_set_calloc_free(pvCalloc, vPortFree);
+ #elif BSP_CFG_HEAP_TLSF_ENABLE && defined(MBEDTLS_PLATFORM_MEMORY) && \
+    !(defined(MBEDTLS_PLATFORM_CALLOC_MACRO) && defined(MBEDTLS_PLATFORM_FREE_MACRO))
+
+    /* Keep the crypto working buffers in the BSP TLSF heap, which has bounded allocation time. */
+    mbedtls_platform_set_calloc_free(R_BSP_HeapCalloc, R_BSP_HeapFree);
  #endif
 
     iret = HW_SCE_McuSpecificInit();
@@ -68,6 +93,10 @@ int mbedtls_platform_setup (mbedtls_platform_context * ctx)
         return MBEDTLS_ERR_PLATFORM_HW_ACCEL_FAILED;
     }
 
+ #if RM_PSA_CRYPTO_SCE_POWER_GATING
+    rm_psa_crypto_sce_powered_set();
+ #endif
+
     return 0;
 }
 
@@ -89,8 +118,145 @@ void mbedtls_platform_teardown (mbedtls_platform_context * ctx)
     // Nothing to do to close the TRNG
 }
 
+ #if RM_PSA_CRYPTO_SCE_POWER_GATING
+
+/*******************************************************************************************************************//**
+ * Marks the start of an operation that uses the SCE. If the SCE was powered down after being idle, it is powered up
+ * and reinitialized first, and the cost of the wake is recorded in the power statistics. Every successful call must
+ * be balanced by RM_PSA_CRYPTO_SCE_Release(). Calls may nest.
+ *
+ * The PSA crypto layer calls this function around each SCE operation, so applications only need it to keep the SCE
+ * powered across a sequence of operations.
+ *
+ * @retval FSP_SUCCESS                  The SCE is powered and ready.
+ * @return See @ref RENESAS_ERROR_CODES or functions called by this function for other possible return codes.
+ *         This function calls:
+ *             * HW_SCE_McuSpecificInit
+ **********************************************************************************************************************/
+fsp_err_t RM_PSA_CRYPTO_SCE_Acquire (void)
+{
+    bool wake;
+
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+    g_rm_psa_crypto_sce_power.ref_count++;
+    wake = !g_rm_psa_crypto_sce_power.powered;
+    FSP_CRITICAL_SECTION_EXIT;
+
+    if (wake)
+    {
+        /* The reference taken above keeps RM_PSA_CRYPTO_SCE_IdleProcess() from powering the SCE down again. */
+  #if BSP_FEATURE_DWT_CYCCNT
+        R_BSP_CycleCounterStart();
+        uint32_t start = DWT->CYCCNT;
+  #endif
+
+        fsp_err_t err = HW_SCE_McuSpecificInit();
+
+        if (FSP_SUCCESS != err)
+        {
+            HW_SCE_PowerOff();
+            RM_PSA_CRYPTO_SCE_Release();
+
+            return err;
+        }
+
+  #if BSP_FEATURE_DWT_CYCCNT
+        uint32_t cycles = DWT->CYCCNT - start;
+        g_rm_psa_crypto_sce_power.stats.wake_cycles_last = cycles;
+        if (cycles > g_rm_psa_crypto_sce_power.stats.wake_cycles_max)
+        {
+            g_rm_psa_crypto_sce_power.stats.wake_cycles_max = cycles;
+        }
+  #endif
+        g_rm_psa_crypto_sce_power.stats.wake_count++;
+
+        rm_psa_crypto_sce_powered_set();
+    }
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Marks the end of an operation started with RM_PSA_CRYPTO_SCE_Acquire(). When no operation is using the SCE any
+ * longer, the idle timeout starts.
+ **********************************************************************************************************************/
+void RM_PSA_CRYPTO_SCE_Release (void)
+{
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+    if (g_rm_psa_crypto_sce_power.ref_count > 0U)
+    {
+        g_rm_psa_crypto_sce_power.ref_count--;
+    }
+
+    g_rm_psa_crypto_sce_power.idle_ms = 0U;
+    FSP_CRITICAL_SECTION_EXIT;
+}
+
+/*******************************************************************************************************************//**
+ * Advances the SCE idle time and powers the SCE down once it has been unused for PSA_CRYPTO_CFG_SCE_IDLE_TIMEOUT_MS.
+ * The next operation powers it up again. Call this function periodically, for example from a periodic timer callback
+ * or an RTOS idle hook. It may be called from an interrupt.
+ *
+ * @param[in]  elapsed_ms              Time since the previous call, in milliseconds.
+ **********************************************************************************************************************/
+void RM_PSA_CRYPTO_SCE_IdleProcess (uint32_t elapsed_ms)
+{
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+    if (g_rm_psa_crypto_sce_power.powered && (0U == g_rm_psa_crypto_sce_power.ref_count))
+    {
+        uint32_t idle_ms = g_rm_psa_crypto_sce_power.idle_ms + elapsed_ms;
+
+        /* Saturate instead of wrapping */
+        g_rm_psa_crypto_sce_power.idle_ms = (idle_ms < elapsed_ms) ? UINT32_MAX : idle_ms;
+
+        if (g_rm_psa_crypto_sce_power.idle_ms >= (uint32_t) PSA_CRYPTO_CFG_SCE_IDLE_TIMEOUT_MS)
+        {
+            HW_SCE_PowerOff();
+            g_rm_psa_crypto_sce_power.powered = false;
+            g_rm_psa_crypto_sce_power.stats.sleep_count++;
+        }
+    }
+
+    FSP_CRITICAL_SECTION_EXIT;
+}
+
+/*******************************************************************************************************************//**
+ * Gets the SCE power statistics.
+ *
+ * @param[out] p_stats                 Copy of the statistics.
+ **********************************************************************************************************************/
+void RM_PSA_CRYPTO_SCE_PowerStatsGet (rm_psa_crypto_sce_power_stats_t * const p_stats)
+{
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+    *p_stats         = g_rm_psa_crypto_sce_power.stats;
+    p_stats->powered = g_rm_psa_crypto_sce_power.powered;
+    FSP_CRITICAL_SECTION_EXIT;
+}
+
+ #endif
+
 /*******************************************************************************************************************//**
  * @} (end addtogroup RM_PSA_CRYPTO)
  **********************************************************************************************************************/
 
+ #if RM_PSA_CRYPTO_SCE_POWER_GATING
+
+/*******************************************************************************************************************//**
+ * Records that the SCE has been powered up and initialized.
+ **********************************************************************************************************************/
+static void rm_psa_crypto_sce_powered_set (void)
+{
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+    g_rm_psa_crypto_sce_power.powered = true;
+    g_rm_psa_crypto_sce_power.idle_ms = 0U;
+    FSP_CRITICAL_SECTION_EXIT;
+}
+
+ #endif
+
 #endif                                 /* MBEDTLS_PLATFORM_SETUP_TEARDOWN_ALT */
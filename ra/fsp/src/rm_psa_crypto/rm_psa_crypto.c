@@ -35,20 +35,9 @@
  * Private function prototypes
  **********************************************************************************************************************/
 static fsp_err_t rm_generate_16byte_random_data(uint8_t * const prevbuff, uint8_t * const currbuff);
+static fsp_err_t rm_psa_crypto_trng_read(uint8_t * const p_rngbuf, uint32_t num_req_bytes, uint32_t * p_num_gen_bytes);
 
-/*******************************************************************************************************************//**
- * @brief Reads requested length of random data from the TRNG. Generate `nbytes` of random bytes
- * and store them in `p_rngbuf` buffer.
- *
- * @retval FSP_SUCCESS                          Random number generation successful
- * @retval FSP_ERR_ASSERTION                    NULL input parameter(s).
- * @retval FSP_ERR_CRYPTO_UNKNOWN               An unknown error occurred.
- * @return See @ref RENESAS_ERROR_CODES or functions called by this function for other possible return codes.
- *         This function calls:
- *         * s_generate_16byte_random_data
- *
- **********************************************************************************************************************/
-fsp_err_t RM_PSA_CRYPTO_TRNG_Read (uint8_t * const p_rngbuf, uint32_t num_req_bytes, uint32_t * p_num_gen_bytes)
+static fsp_err_t rm_psa_crypto_trng_read (uint8_t * const p_rngbuf, uint32_t num_req_bytes, uint32_t * p_num_gen_bytes)
 {
     fsp_err_t iret = FSP_ERR_CRYPTO_UNKNOWN;
     uint8_t   prevbuff[RM_PSA_CRYPTO_TRNG_REGISTER_SIZE_BYTES] = {0}; // local buffer for random data
@@ -85,6 +74,33 @@ fsp_err_t RM_PSA_CRYPTO_TRNG_Read (uint8_t * const p_rngbuf, uint32_t num_req_by
     return iret;
 }
 
+/*******************************************************************************************************************//**
+ * @brief Reads requested length of random data from the TRNG. Generate `nbytes` of random bytes
+ * and store them in `p_rngbuf` buffer.
+ *
+ * @retval FSP_SUCCESS                          Random number generation successful
+ * @retval FSP_ERR_ASSERTION                    NULL input parameter(s).
+ * @retval FSP_ERR_CRYPTO_UNKNOWN               An unknown error occurred.
+ * @return See @ref RENESAS_ERROR_CODES or functions called by this function for other possible return codes.
+ *         This function calls:
+ *         * s_generate_16byte_random_data
+ *         * RM_PSA_CRYPTO_SCE_Acquire
+ *
+ **********************************************************************************************************************/
+fsp_err_t RM_PSA_CRYPTO_TRNG_Read (uint8_t * const p_rngbuf, uint32_t num_req_bytes, uint32_t * p_num_gen_bytes)
+{
+    fsp_err_t iret = RM_PSA_CRYPTO_SCE_ACQUIRE();
+
+    if (FSP_SUCCESS == iret)
+    {
+        iret = rm_psa_crypto_trng_read(p_rngbuf, num_req_bytes, p_num_gen_bytes);
+
+        RM_PSA_CRYPTO_SCE_RELEASE();
+    }
+
+    return iret;
+}
+
 /***********************************************************************************************************************
  * Private Functions
  **********************************************************************************************************************/
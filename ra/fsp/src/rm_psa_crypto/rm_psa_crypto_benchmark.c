@@ -0,0 +1,610 @@
+/***********************************************************************************************************************
+ * Copyright [2020] Renesas Electronics Corporation and/or its affiliates.  All Rights Reserved.
+ *
+ * This software and documentation are supplied by Renesas Electronics America Inc. and may only be used with products
+ * of Renesas Electronics Corp. and its affiliates ("Renesas").  No other uses are authorized.  Renesas products are
+ * sold pursuant to Renesas terms and conditions of sale.  Purchasers are solely responsible for the selection and use
+ * of Renesas products and Renesas assumes no liability.  No license, express or implied, to any intellectual property
+ * right is granted by Renesas. This software is protected under all applicable laws, including copyright laws. Renesas
+ * reserves the right to change or discontinue this software and/or this documentation. THE SOFTWARE AND DOCUMENTATION
+ * IS DELIVERED TO YOU "AS IS," AND RENESAS MAKES NO REPRESENTATIONS OR WARRANTIES, AND TO THE FULLEST EXTENT
+ * PERMISSIBLE UNDER APPLICABLE LAW, DISCLAIMS ALL WARRANTIES, WHETHER EXPLICITLY OR IMPLICITLY, INCLUDING WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, AND NONINFRINGEMENT, WITH RESPECT TO THE SOFTWARE OR
+ * DOCUMENTATION.  RENESAS SHALL HAVE NO LIABILITY ARISING OUT OF ANY SECURITY VULNERABILITY OR BREACH.  TO THE MAXIMUM
+ * EXTENT PERMITTED BY LAW, IN NO EVENT WILL RENESAS BE LIABLE TO YOU IN CONNECTION WITH THE SOFTWARE OR DOCUMENTATION
+ * (OR ANY PERSON OR ENTITY CLAIMING RIGHTS DERIVED FROM YOU) FOR ANY LOSS, DAMAGES, OR CLAIMS WHATSOEVER, INCLUDING,
+ * WITHOUT LIMITATION, ANY DIRECT, CONSEQUENTIAL, SPECIAL, INDIRECT, PUNITIVE, OR INCIDENTAL DAMAGES; ANY LOST PROFITS,
+ * OTHER ECONOMIC DAMAGE, PROPERTY DAMAGE, OR PERSONAL INJURY; AND EVEN IF RENESAS HAS BEEN ADVISED OF THE POSSIBILITY
+ * OF SUCH LOSS, DAMAGES, CLAIMS OR COSTS.
+ **********************************************************************************************************************/
+
+#if !defined(MBEDTLS_CONFIG_FILE)
+ #include "mbedtls/config.h"
+#else
+ #include MBEDTLS_CONFIG_FILE
+#endif
+
+#if defined(MBEDTLS_PLATFORM_SETUP_TEARDOWN_ALT)
+ #include "platform.h"
+ #include "rm_psa_crypto.h"
+ #include "rm_psa_crypto_benchmark.h"
+
+ #if defined(MBEDTLS_AES_C)
+  #include "mbedtls/aes.h"
+ #endif
+ #if defined(MBEDTLS_GCM_C)
+  #include "mbedtls/gcm.h"
+ #endif
+ #if defined(MBEDTLS_SHA256_C)
+  #include "mbedtls/sha256.h"
+ #endif
+ #if defined(MBEDTLS_ECDSA_C)
+  #include "mbedtls/ecdsa.h"
+ #endif
+ #if defined(MBEDTLS_RSA_C)
+  #include "mbedtls/rsa.h"
+ #endif
+
+/***********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+
+/* Smallest work buffer: input and output of an RSA-3072 operation with room to spare. */
+ #define RM_PSA_CRYPTO_BENCHMARK_WORK_MIN        (1024U)
+
+ #define RM_PSA_CRYPTO_BENCHMARK_BLOCK_BYTES     (16U)
+ #define RM_PSA_CRYPTO_BENCHMARK_GCM_IV_BYTES    (12U)
+ #define RM_PSA_CRYPTO_BENCHMARK_DIGEST_BYTES    (32U)
+ #define RM_PSA_CRYPTO_BENCHMARK_RSA_EXPONENT    (65537)
+
+/***********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+
+/* State shared by the bulk primitives while one of them is measured. */
+typedef struct st_rm_psa_crypto_benchmark_bulk
+{
+ #if defined(MBEDTLS_AES_C)
+    mbedtls_aes_context aes;
+ #endif
+ #if defined(MBEDTLS_GCM_C)
+    mbedtls_gcm_context gcm;
+ #endif
+    unsigned char iv[RM_PSA_CRYPTO_BENCHMARK_BLOCK_BYTES];
+    unsigned char stream_block[RM_PSA_CRYPTO_BENCHMARK_BLOCK_BYTES];
+    unsigned char tag[RM_PSA_CRYPTO_BENCHMARK_BLOCK_BYTES];
+    size_t        nc_off;
+} rm_psa_crypto_benchmark_bulk_t;
+
+/***********************************************************************************************************************
+ * Private function prototypes
+ **********************************************************************************************************************/
+static int  rm_psa_crypto_benchmark_rng(void * p_rng, unsigned char * output, size_t len);
+static void rm_psa_crypto_benchmark_report(rm_psa_crypto_benchmark_cfg_t const * const p_cfg,
+                                           rm_psa_crypto_benchmark_t                   benchmark,
+                                           uint32_t                                    size,
+                                           uint32_t                                    iterations,
+                                           uint64_t                                    cycles,
+                                           int                                         status);
+static int rm_psa_crypto_benchmark_bulk_setup(rm_psa_crypto_benchmark_bulk_t * p_bulk,
+                                              rm_psa_crypto_benchmark_t        benchmark,
+                                              unsigned char const            * p_key);
+static int rm_psa_crypto_benchmark_bulk_run(rm_psa_crypto_benchmark_bulk_t * p_bulk,
+                                            rm_psa_crypto_benchmark_t        benchmark,
+                                            unsigned char const            * p_input,
+                                            unsigned char                  * p_output,
+                                            uint32_t                         size);
+static void rm_psa_crypto_benchmark_bulk(rm_psa_crypto_benchmark_cfg_t const * const p_cfg,
+                                         bsp_cycle_counter_get_t                     p_cycles_get);
+static void rm_psa_crypto_benchmark_ecdsa(rm_psa_crypto_benchmark_cfg_t const * const p_cfg,
+                                          bsp_cycle_counter_get_t                     p_cycles_get,
+                                          rm_psa_crypto_benchmark_t                   sign_benchmark);
+static void rm_psa_crypto_benchmark_rsa(rm_psa_crypto_benchmark_cfg_t const * const p_cfg,
+                                        bsp_cycle_counter_get_t                     p_cycles_get,
+                                        rm_psa_crypto_benchmark_t                   private_benchmark);
+
+/***********************************************************************************************************************
+ * Private global variables
+ **********************************************************************************************************************/
+static rm_psa_crypto_benchmark_bulk_t g_rm_psa_crypto_benchmark_bulk;
+
+/*******************************************************************************************************************//**
+ * @addtogroup RM_PSA_CRYPTO
+ * @{
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * @brief Measures the SCE accelerated (or mbedTLS software, depending on the mbedTLS configuration) primitives and
+ * reports the result of each primitive and buffer size through p_cfg->p_callback.
+ *
+ * AES modes, SHA-256 and TRNG reads are swept across p_cfg->p_sizes. ECDSA P-256/P-384 and RSA-2048/3072 operations
+ * are run on freshly generated keys. A primitive that is not enabled in the mbedTLS configuration, or that fails, is
+ * reported with a non-zero status. Building the same application with and without the *_ALT options gives the
+ * hardware and software figures for a given MCU. With PSA_CRYPTO_CFG_AES_SOFT_FALLBACK, the AES software fallback
+ * cipher is also measured on AES-128, next to the SCE figures.
+ *
+ * This function runs for a long time and must not be called from an interrupt.
+ *
+ * @retval FSP_SUCCESS                  All measurements were reported.
+ * @retval FSP_ERR_ASSERTION            A required pointer is NULL or no sizes or iterations were given.
+ * @retval FSP_ERR_INVALID_SIZE         The work buffer is too small or a size is not a multiple of 16.
+ * @retval FSP_ERR_UNSUPPORTED          No cycle counter, see R_BSP_CycleCounterSelect().
+ **********************************************************************************************************************/
+fsp_err_t RM_PSA_CRYPTO_BenchmarkRun (rm_psa_crypto_benchmark_cfg_t const * const p_cfg)
+{
+    bsp_cycle_counter_get_t p_cycles_get = NULL;
+    fsp_err_t               err;
+
+ #if SCE_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(p_cfg);
+    FSP_ASSERT(p_cfg->p_sizes);
+    FSP_ASSERT(p_cfg->num_sizes);
+    FSP_ASSERT(p_cfg->p_work);
+    FSP_ASSERT(p_cfg->p_callback);
+    FSP_ASSERT(p_cfg->bulk_iterations);
+    FSP_ASSERT(p_cfg->pk_iterations);
+ #endif
+
+    FSP_ERROR_RETURN(p_cfg->work_size >= RM_PSA_CRYPTO_BENCHMARK_WORK_MIN, FSP_ERR_INVALID_SIZE);
+    for (uint32_t i = 0U; i < p_cfg->num_sizes; i++)
+    {
+        FSP_ERROR_RETURN((p_cfg->p_sizes[i] % RM_PSA_CRYPTO_BENCHMARK_BLOCK_BYTES) == 0U, FSP_ERR_INVALID_SIZE);
+        FSP_ERROR_RETURN(p_cfg->p_sizes[i] <= (p_cfg->work_size / 2U), FSP_ERR_INVALID_SIZE);
+    }
+
+    err = R_BSP_CycleCounterSelect(p_cfg->p_cycles_get, &p_cycles_get);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+    rm_psa_crypto_benchmark_bulk(p_cfg, p_cycles_get);
+    rm_psa_crypto_benchmark_ecdsa(p_cfg, p_cycles_get, RM_PSA_CRYPTO_BENCHMARK_ECDSA_P256_SIGN);
+    rm_psa_crypto_benchmark_ecdsa(p_cfg, p_cycles_get, RM_PSA_CRYPTO_BENCHMARK_ECDSA_P384_SIGN);
+    rm_psa_crypto_benchmark_rsa(p_cfg, p_cycles_get, RM_PSA_CRYPTO_BENCHMARK_RSA_2048_PRIVATE);
+    rm_psa_crypto_benchmark_rsa(p_cfg, p_cycles_get, RM_PSA_CRYPTO_BENCHMARK_RSA_3072_PRIVATE);
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * @} (end addtogroup RM_PSA_CRYPTO)
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * Random number callback for key generation and signing, reads the TRNG directly.
+ **********************************************************************************************************************/
+static int rm_psa_crypto_benchmark_rng (void * p_rng, unsigned char * output, size_t len)
+{
+    uint32_t num_gen_bytes = 0U;
+
+    FSP_PARAMETER_NOT_USED(p_rng);
+
+    if (FSP_SUCCESS != RM_PSA_CRYPTO_TRNG_Read(output, (uint32_t) len, &num_gen_bytes))
+    {
+        return MBEDTLS_ERR_PLATFORM_HW_ACCEL_FAILED;
+    }
+
+    return 0;
+}
+
+/*******************************************************************************************************************//**
+ * Derives the per operation and per byte figures and passes them to the user callback.
+ **********************************************************************************************************************/
+static void rm_psa_crypto_benchmark_report (rm_psa_crypto_benchmark_cfg_t const * const p_cfg,
+                                            rm_psa_crypto_benchmark_t                   benchmark,
+                                            uint32_t                                    size,
+                                            uint32_t                                    iterations,
+                                            uint64_t                                    cycles,
+                                            int                                         status)
+{
+    rm_psa_crypto_benchmark_result_t result = {0};
+
+    result.benchmark  = benchmark;
+    result.size       = size;
+    result.iterations = iterations;
+    result.cycles     = cycles;
+    result.status     = status;
+    result.p_context  = p_cfg->p_context;
+
+    if ((0 == status) && (0U != iterations) && (0U != cycles))
+    {
+        result.cycles_per_op  = (uint32_t) (cycles / iterations);
+        result.ops_per_second = (uint32_t) (((uint64_t) SystemCoreClock * iterations) / cycles);
+
+        if (0U != size)
+        {
+            result.cycles_per_byte = (uint32_t) (cycles / ((uint64_t) iterations * size));
+        }
+    }
+
+    p_cfg->p_callback(&result);
+}
+
+/*******************************************************************************************************************//**
+ * Prepares the key schedule of a bulk primitive. Returns MBEDTLS_ERR_PLATFORM_FEATURE_UNSUPPORTED if the primitive is
+ * not enabled in the mbedTLS configuration.
+ **********************************************************************************************************************/
+static int rm_psa_crypto_benchmark_bulk_setup (rm_psa_crypto_benchmark_bulk_t * p_bulk,
+                                               rm_psa_crypto_benchmark_t        benchmark,
+                                               unsigned char const            * p_key)
+{
+    int ret = MBEDTLS_ERR_PLATFORM_FEATURE_UNSUPPORTED;
+
+    memset(p_bulk->iv, 0, sizeof(p_bulk->iv));
+    memset(p_bulk->stream_block, 0, sizeof(p_bulk->stream_block));
+    p_bulk->nc_off = 0U;
+
+    switch (benchmark)
+    {
+ #if defined(MBEDTLS_AES_C)
+        case RM_PSA_CRYPTO_BENCHMARK_AES_128_ECB:
+  #if defined(MBEDTLS_CIPHER_MODE_CBC)
+        case RM_PSA_CRYPTO_BENCHMARK_AES_128_CBC:
+  #endif
+  #if defined(MBEDTLS_CIPHER_MODE_CTR)
+        case RM_PSA_CRYPTO_BENCHMARK_AES_128_CTR:
+  #endif
+        {
+            ret = mbedtls_aes_setkey_enc(&p_bulk->aes, p_key, 128U);
+            break;
+        }
+
+        case RM_PSA_CRYPTO_BENCHMARK_AES_256_ECB:
+  #if defined(MBEDTLS_CIPHER_MODE_CBC)
+        case RM_PSA_CRYPTO_BENCHMARK_AES_256_CBC:
+  #endif
+  #if defined(MBEDTLS_CIPHER_MODE_CTR)
+        case RM_PSA_CRYPTO_BENCHMARK_AES_256_CTR:
+  #endif
+        {
+            ret = mbedtls_aes_setkey_enc(&p_bulk->aes, p_key, 256U);
+            break;
+        }
+
+  #if defined(MBEDTLS_AES_ALT) && PSA_CRYPTO_CFG_AES_SOFT_FALLBACK
+        case RM_PSA_CRYPTO_BENCHMARK_AES_128_ECB_SOFT:
+   #if defined(MBEDTLS_CIPHER_MODE_CTR)
+        case RM_PSA_CRYPTO_BENCHMARK_AES_128_CTR_SOFT:
+   #endif
+        {
+            /* Key size the SCE supports, so the two ciphers can be compared. */
+            ret = aes_alt_soft_setkey(&p_bulk->aes, p_key, 128U);
+            break;
+        }
+  #endif
+ #endif
+ #if defined(MBEDTLS_GCM_C)
+        case RM_PSA_CRYPTO_BENCHMARK_AES_128_GCM:
+        {
+            ret = mbedtls_gcm_setkey(&p_bulk->gcm, MBEDTLS_CIPHER_ID_AES, p_key, 128U);
+            break;
+        }
+ #endif
+ #if defined(MBEDTLS_SHA256_C)
+        case RM_PSA_CRYPTO_BENCHMARK_SHA256:
+ #endif
+        case RM_PSA_CRYPTO_BENCHMARK_TRNG:
+        {
+            ret = 0;
+            break;
+        }
+
+        default:
+        {
+            break;
+        }
+    }
+
+    return ret;
+}
+
+/*******************************************************************************************************************//**
+ * Runs one operation of a bulk primitive on size bytes.
+ **********************************************************************************************************************/
+static int rm_psa_crypto_benchmark_bulk_run (rm_psa_crypto_benchmark_bulk_t * p_bulk,
+                                             rm_psa_crypto_benchmark_t        benchmark,
+                                             unsigned char const            * p_input,
+                                             unsigned char                  * p_output,
+                                             uint32_t                         size)
+{
+    int      ret           = MBEDTLS_ERR_PLATFORM_FEATURE_UNSUPPORTED;
+    uint32_t num_gen_bytes = 0U;
+
+    FSP_PARAMETER_NOT_USED(p_bulk);
+    FSP_PARAMETER_NOT_USED(p_input);
+
+    switch (benchmark)
+    {
+ #if defined(MBEDTLS_AES_C)
+        case RM_PSA_CRYPTO_BENCHMARK_AES_128_ECB:
+        case RM_PSA_CRYPTO_BENCHMARK_AES_256_ECB:
+        case RM_PSA_CRYPTO_BENCHMARK_AES_128_ECB_SOFT:
+        {
+            ret = 0;
+            for (uint32_t offset = 0U; (0 == ret) && (offset < size); offset += RM_PSA_CRYPTO_BENCHMARK_BLOCK_BYTES)
+            {
+                ret = mbedtls_aes_crypt_ecb(&p_bulk->aes, MBEDTLS_AES_ENCRYPT, &p_input[offset], &p_output[offset]);
+            }
+
+            break;
+        }
+
+  #if defined(MBEDTLS_CIPHER_MODE_CBC)
+        case RM_PSA_CRYPTO_BENCHMARK_AES_128_CBC:
+        case RM_PSA_CRYPTO_BENCHMARK_AES_256_CBC:
+        {
+            ret = mbedtls_aes_crypt_cbc(&p_bulk->aes, MBEDTLS_AES_ENCRYPT, size, p_bulk->iv, p_input, p_output);
+            break;
+        }
+  #endif
+  #if defined(MBEDTLS_CIPHER_MODE_CTR)
+        case RM_PSA_CRYPTO_BENCHMARK_AES_128_CTR:
+        case RM_PSA_CRYPTO_BENCHMARK_AES_256_CTR:
+        case RM_PSA_CRYPTO_BENCHMARK_AES_128_CTR_SOFT:
+        {
+            ret = mbedtls_aes_crypt_ctr(&p_bulk->aes,
+                                        size,
+                                        &p_bulk->nc_off,
+                                        p_bulk->iv,
+                                        p_bulk->stream_block,
+                                        p_input,
+                                        p_output);
+            break;
+        }
+  #endif
+ #endif
+ #if defined(MBEDTLS_GCM_C)
+        case RM_PSA_CRYPTO_BENCHMARK_AES_128_GCM:
+        {
+            ret = mbedtls_gcm_crypt_and_tag(&p_bulk->gcm,
+                                            MBEDTLS_GCM_ENCRYPT,
+                                            size,
+                                            p_bulk->iv,
+                                            RM_PSA_CRYPTO_BENCHMARK_GCM_IV_BYTES,
+                                            NULL,
+                                            0U,
+                                            p_input,
+                                            p_output,
+                                            sizeof(p_bulk->tag),
+                                            p_bulk->tag);
+            break;
+        }
+ #endif
+ #if defined(MBEDTLS_SHA256_C)
+        case RM_PSA_CRYPTO_BENCHMARK_SHA256:
+        {
+            ret = mbedtls_sha256_ret(p_input, size, p_output, 0);
+            break;
+        }
+ #endif
+        case RM_PSA_CRYPTO_BENCHMARK_TRNG:
+        {
+            ret = (FSP_SUCCESS == RM_PSA_CRYPTO_TRNG_Read(p_output, size, &num_gen_bytes)) ?
+                  0 : MBEDTLS_ERR_PLATFORM_HW_ACCEL_FAILED;
+            break;
+        }
+
+        default:
+        {
+            break;
+        }
+    }
+
+    return ret;
+}
+
+/*******************************************************************************************************************//**
+ * Sweeps the AES modes, SHA-256 and the TRNG across the configured buffer sizes.
+ **********************************************************************************************************************/
+static void rm_psa_crypto_benchmark_bulk (rm_psa_crypto_benchmark_cfg_t const * const p_cfg,
+                                          bsp_cycle_counter_get_t                     p_cycles_get)
+{
+    static const rm_psa_crypto_benchmark_t bulk_benchmarks[] =
+    {
+        RM_PSA_CRYPTO_BENCHMARK_AES_128_ECB,
+        RM_PSA_CRYPTO_BENCHMARK_AES_128_CBC,
+        RM_PSA_CRYPTO_BENCHMARK_AES_128_CTR,
+        RM_PSA_CRYPTO_BENCHMARK_AES_256_ECB,
+        RM_PSA_CRYPTO_BENCHMARK_AES_256_CBC,
+        RM_PSA_CRYPTO_BENCHMARK_AES_256_CTR,
+        RM_PSA_CRYPTO_BENCHMARK_AES_128_GCM,
+        RM_PSA_CRYPTO_BENCHMARK_SHA256,
+        RM_PSA_CRYPTO_BENCHMARK_TRNG,
+        RM_PSA_CRYPTO_BENCHMARK_AES_128_ECB_SOFT,
+        RM_PSA_CRYPTO_BENCHMARK_AES_128_CTR_SOFT,
+    };
+    rm_psa_crypto_benchmark_bulk_t * p_bulk   = &g_rm_psa_crypto_benchmark_bulk;
+    unsigned char                  * p_input  = p_cfg->p_work;
+    unsigned char                  * p_output = p_cfg->p_work + (p_cfg->work_size / 2U);
+
+    /* Any key will do; use the first bytes of the work buffer */
+    memset(p_cfg->p_work, 0x5A, p_cfg->work_size);
+
+    for (uint32_t b = 0U; b < (sizeof(bulk_benchmarks) / sizeof(bulk_benchmarks[0])); b++)
+    {
+ #if defined(MBEDTLS_AES_C)
+        mbedtls_aes_init(&p_bulk->aes);
+ #endif
+ #if defined(MBEDTLS_GCM_C)
+        mbedtls_gcm_init(&p_bulk->gcm);
+ #endif
+
+        int ret = rm_psa_crypto_benchmark_bulk_setup(p_bulk, bulk_benchmarks[b], p_input);
+
+        for (uint32_t i = 0U; i < p_cfg->num_sizes; i++)
+        {
+            uint32_t size   = p_cfg->p_sizes[i];
+            uint64_t cycles = 0U;
+            uint32_t n      = 0U;
+
+            for ( ; (0 == ret) && (n < p_cfg->bulk_iterations); n++)
+            {
+                uint32_t start = p_cycles_get();
+                ret     = rm_psa_crypto_benchmark_bulk_run(p_bulk, bulk_benchmarks[b], p_input, p_output, size);
+                cycles += p_cycles_get() - start;
+            }
+
+            rm_psa_crypto_benchmark_report(p_cfg, bulk_benchmarks[b], size, n, cycles, ret);
+        }
+
+ #if defined(MBEDTLS_AES_C)
+        mbedtls_aes_free(&p_bulk->aes);
+ #endif
+ #if defined(MBEDTLS_GCM_C)
+        mbedtls_gcm_free(&p_bulk->gcm);
+ #endif
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Measures ECDSA signing and verification of a SHA-256 digest with a freshly generated key. sign_benchmark selects
+ * the curve; the matching verify result is reported right after it.
+ **********************************************************************************************************************/
+static void rm_psa_crypto_benchmark_ecdsa (rm_psa_crypto_benchmark_cfg_t const * const p_cfg,
+                                           bsp_cycle_counter_get_t                     p_cycles_get,
+                                           rm_psa_crypto_benchmark_t                   sign_benchmark)
+{
+    int      ret           = MBEDTLS_ERR_PLATFORM_FEATURE_UNSUPPORTED;
+    uint64_t sign_cycles   = 0U;
+    uint64_t verify_cycles = 0U;
+    uint32_t n_sign        = 0U;
+    uint32_t n_verify      = 0U;
+
+ #if defined(MBEDTLS_ECDSA_C)
+    mbedtls_ecp_group_id grp_id = MBEDTLS_ECP_DP_NONE;
+  #if defined(MBEDTLS_ECP_DP_SECP256R1_ENABLED)
+    if (RM_PSA_CRYPTO_BENCHMARK_ECDSA_P256_SIGN == sign_benchmark)
+    {
+        grp_id = MBEDTLS_ECP_DP_SECP256R1;
+    }
+  #endif
+  #if defined(MBEDTLS_ECP_DP_SECP384R1_ENABLED)
+    if (RM_PSA_CRYPTO_BENCHMARK_ECDSA_P384_SIGN == sign_benchmark)
+    {
+        grp_id = MBEDTLS_ECP_DP_SECP384R1;
+    }
+  #endif
+
+    if (MBEDTLS_ECP_DP_NONE != grp_id)
+    {
+        mbedtls_ecp_keypair key;
+        mbedtls_mpi         r;
+        mbedtls_mpi         s;
+        unsigned char     * p_hash = p_cfg->p_work;
+
+        mbedtls_ecp_keypair_init(&key);
+        mbedtls_mpi_init(&r);
+        mbedtls_mpi_init(&s);
+        memset(p_hash, 0xA5, RM_PSA_CRYPTO_BENCHMARK_DIGEST_BYTES);
+
+        ret = mbedtls_ecp_group_load(&key.grp, grp_id);
+        if (0 == ret)
+        {
+            ret = mbedtls_ecp_gen_keypair(&key.grp, &key.d, &key.Q, rm_psa_crypto_benchmark_rng, NULL);
+        }
+
+        for ( ; (0 == ret) && (n_sign < p_cfg->pk_iterations); n_sign++)
+        {
+            uint32_t start = p_cycles_get();
+            ret = mbedtls_ecdsa_sign(&key.grp,
+                                     &r,
+                                     &s,
+                                     &key.d,
+                                     p_hash,
+                                     RM_PSA_CRYPTO_BENCHMARK_DIGEST_BYTES,
+                                     rm_psa_crypto_benchmark_rng,
+                                     NULL);
+            sign_cycles += p_cycles_get() - start;
+        }
+
+        rm_psa_crypto_benchmark_report(p_cfg, sign_benchmark, 0U, n_sign, sign_cycles, ret);
+
+        for ( ; (0 == ret) && (n_verify < p_cfg->pk_iterations); n_verify++)
+        {
+            uint32_t start = p_cycles_get();
+            ret = mbedtls_ecdsa_verify(&key.grp,
+                                       p_hash,
+                                       RM_PSA_CRYPTO_BENCHMARK_DIGEST_BYTES,
+                                       &key.Q,
+                                       &r,
+                                       &s);
+            verify_cycles += p_cycles_get() - start;
+        }
+
+        mbedtls_mpi_free(&s);
+        mbedtls_mpi_free(&r);
+        mbedtls_ecp_keypair_free(&key);
+    }
+    else
+ #endif
+    {
+        rm_psa_crypto_benchmark_report(p_cfg, sign_benchmark, 0U, n_sign, sign_cycles, ret);
+    }
+
+    /* The verify primitive directly follows its sign primitive */
+    rm_psa_crypto_benchmark_report(p_cfg,
+                                   (rm_psa_crypto_benchmark_t) (sign_benchmark + 1),
+                                   0U,
+                                   n_verify,
+                                   verify_cycles,
+                                   ret);
+}
+
+/*******************************************************************************************************************//**
+ * Measures the RSA private and public key operations with a freshly generated key. private_benchmark selects the key
+ * size; the matching public key result is reported right after it.
+ **********************************************************************************************************************/
+static void rm_psa_crypto_benchmark_rsa (rm_psa_crypto_benchmark_cfg_t const * const p_cfg,
+                                         bsp_cycle_counter_get_t                     p_cycles_get,
+                                         rm_psa_crypto_benchmark_t                   private_benchmark)
+{
+    int      ret            = MBEDTLS_ERR_PLATFORM_FEATURE_UNSUPPORTED;
+    uint64_t private_cycles = 0U;
+    uint64_t public_cycles  = 0U;
+    uint32_t n_private      = 0U;
+    uint32_t n_public       = 0U;
+
+ #if defined(MBEDTLS_RSA_C) && defined(MBEDTLS_GENPRIME)
+    mbedtls_rsa_context rsa;
+    unsigned int        bits     = (RM_PSA_CRYPTO_BENCHMARK_RSA_2048_PRIVATE == private_benchmark) ?
+                                   RSA_2048_BITS : RSA_3072_BITS;
+    unsigned char     * p_input  = p_cfg->p_work;
+    unsigned char     * p_output = p_cfg->p_work + (p_cfg->work_size / 2U);
+
+    mbedtls_rsa_init(&rsa, MBEDTLS_RSA_PKCS_V15, 0);
+
+    /* Keep the input below the modulus */
+    memset(p_input, 0x5A, bits / 8U);
+    p_input[0] = 0U;
+
+    ret = mbedtls_rsa_gen_key(&rsa, rm_psa_crypto_benchmark_rng, NULL, bits, RM_PSA_CRYPTO_BENCHMARK_RSA_EXPONENT);
+
+    for ( ; (0 == ret) && (n_private < p_cfg->pk_iterations); n_private++)
+    {
+        uint32_t start = p_cycles_get();
+        ret             = mbedtls_rsa_private(&rsa, rm_psa_crypto_benchmark_rng, NULL, p_input, p_output);
+        private_cycles += p_cycles_get() - start;
+    }
+
+    rm_psa_crypto_benchmark_report(p_cfg, private_benchmark, 0U, n_private, private_cycles, ret);
+
+    for ( ; (0 == ret) && (n_public < p_cfg->pk_iterations); n_public++)
+    {
+        uint32_t start = p_cycles_get();
+        ret            = mbedtls_rsa_public(&rsa, p_input, p_output);
+        public_cycles += p_cycles_get() - start;
+    }
+
+    mbedtls_rsa_free(&rsa);
+ #else
+    rm_psa_crypto_benchmark_report(p_cfg, private_benchmark, 0U, n_private, private_cycles, ret);
+ #endif
+
+    /* The public key primitive directly follows its private key primitive */
+    rm_psa_crypto_benchmark_report(p_cfg,
+                                   (rm_psa_crypto_benchmark_t) (private_benchmark + 1),
+                                   0U,
+                                   n_public,
+                                   public_cycles,
+                                   ret);
+}
+
+#endif                                 /* MBEDTLS_PLATFORM_SETUP_TEARDOWN_ALT */
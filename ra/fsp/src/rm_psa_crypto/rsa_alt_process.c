@@ -52,6 +52,7 @@
 
  #if defined(MBEDTLS_RSA_ALT)
   #include "hw_sce_rsa_private.h"
+  #include "rm_psa_crypto.h"
 
   #define RM_PSA_CRYPTO_RSA_KEY_PLAINTEXT    (0U)
   #define RM_PSA_CRYPTO_RSA_KEY_WRAPPED      (1U)
@@ -91,11 +92,11 @@ static const hw_sce_rsa_private_decrypt_t g_rsa_private_decrypt_lookup[2] =
 /*
  * Generate an RSA keypair
  */
-int mbedtls_rsa_gen_key (mbedtls_rsa_context * ctx,
-                         int (* f_rng)(void *, unsigned char *, size_t),
-                         void * p_rng,
-                         unsigned int nbits,
-                         int exponent)
+static int rsa_gen_key_sce (mbedtls_rsa_context * ctx,
+                            int (* f_rng)(void *, unsigned char *, size_t),
+                            void * p_rng,
+                            unsigned int nbits,
+                            int exponent)
 {
     (void) nbits;
     (void) exponent;
@@ -233,6 +234,9 @@ int mbedtls_rsa_gen_key (mbedtls_rsa_context * ctx,
 
     ctx->len = mbedtls_mpi_size(&ctx->N);
 
+    /* Any SCE formatted key cached for a previous key is now stale */
+    mbedtls_internal_rsa_key_cache_free(ctx);
+
     if (ret != 0)
     {
         mbedtls_rsa_free(ctx);
@@ -241,13 +245,31 @@ int mbedtls_rsa_gen_key (mbedtls_rsa_context * ctx,
     return ret;
 }
 
+int mbedtls_rsa_gen_key (mbedtls_rsa_context * ctx,
+                         int (* f_rng)(void *, unsigned char *, size_t),
+                         void * p_rng,
+                         unsigned int nbits,
+                         int exponent)
+{
+    if (FSP_SUCCESS != RM_PSA_CRYPTO_SCE_ACQUIRE())
+    {
+        return MBEDTLS_ERR_PLATFORM_HW_ACCEL_FAILED;
+    }
+
+    int ret = rsa_gen_key_sce(ctx, f_rng, p_rng, nbits, exponent);
+
+    RM_PSA_CRYPTO_SCE_RELEASE();
+
+    return ret;
+}
+
   #endif                               /* MBEDTLS_GENPRIME */
 
 /*
  * Do an RSA public key operation
  */
 volatile mbedtls_rsa_context * rsa_temp_ctx;
-int mbedtls_rsa_public (mbedtls_rsa_context * ctx, const unsigned char * input, unsigned char * output)
+static int rsa_public_sce (mbedtls_rsa_context * ctx, const unsigned char * input, unsigned char * output)
 {
     uint32_t  temp_E = 0U;
     fsp_err_t iret;
@@ -325,37 +347,90 @@ int mbedtls_rsa_public (mbedtls_rsa_context * ctx, const unsigned char * input,
     return 0;
 }
 
+int mbedtls_rsa_public (mbedtls_rsa_context * ctx, const unsigned char * input, unsigned char * output)
+{
+    if (FSP_SUCCESS != RM_PSA_CRYPTO_SCE_ACQUIRE())
+    {
+        return MBEDTLS_ERR_PLATFORM_HW_ACCEL_FAILED;
+    }
+
+    int ret = rsa_public_sce(ctx, input, output);
+
+    RM_PSA_CRYPTO_SCE_RELEASE();
+
+    return ret;
+}
+
+/*
+ * Release the SCE formatted key cached by mbedtls_rsa_private()
+ */
+void mbedtls_internal_rsa_key_cache_free (mbedtls_rsa_context * ctx)
+{
+    uint32_t private_key_size_bytes = ctx->len;
+
+    if (NULL != ctx->p_sce_key)
+    {
+        if (true == (bool) ctx->vendor_ctx)
+        {
+            private_key_size_bytes = RSA_WRAPPED_PRIVATE_KEY_SIZE_BYTES(ctx->len * 8U);
+        }
+
+        /* Clear out the cached key before releasing it */
+        mbedtls_platform_zeroize(ctx->p_sce_key, ctx->len + private_key_size_bytes);
+        mbedtls_free(ctx->p_sce_key);
+        ctx->p_sce_key = NULL;
+    }
+}
+
 /*
  * Do an RSA private key operation
  */
 
-int mbedtls_rsa_private (mbedtls_rsa_context * ctx,
-                         int (* f_rng)(void *, unsigned char *, size_t),
-                         void * p_rng,
-                         const unsigned char * input,
-                         unsigned char * output)
+static int rsa_private_sce (mbedtls_rsa_context * ctx,
+                            int (* f_rng)(void *, unsigned char *, size_t),
+                            void * p_rng,
+                            const unsigned char * input,
+                            unsigned char * output)
 {
-    (void) f_rng;
-    (void) p_rng;
     fsp_err_t err;
     int       ret = 0;
     uint32_t  private_key_size_bytes = ctx->len;
     hw_sce_rsa_private_decrypt_t p_hw_sce_rsa_private_decrypt = NULL;
 
-    if (true == (bool) ctx->vendor_ctx)
-    {
-        private_key_size_bytes = RSA_WRAPPED_PRIVATE_KEY_SIZE_BYTES(ctx->len * 8U);
-    }
-
-    /* Calloc 32-bit pointer created to remove clang warnings */
-    uint32_t * p_calloc_temp_buff_N = NULL;
-    uint32_t * p_calloc_temp_buff_D = NULL;
-    uint32_t * p_common_buff_32     = NULL;
+    /* 32-bit pointers into the cached key created to remove clang warnings */
+    uint32_t * p_sce_key_N = NULL;
+    uint32_t * p_sce_key_D = NULL;
 
     RSA_VALIDATE_RET(ctx != NULL);
     RSA_VALIDATE_RET(input != NULL);
     RSA_VALIDATE_RET(output != NULL);
 
+    if (ctx->len == RSA_MODULUS_SIZE_BYTES(RSA_2048_BITS))
+    {
+        p_hw_sce_rsa_private_decrypt = g_rsa_private_decrypt_lookup[(bool) ctx->vendor_ctx];
+    }
+
+    if (NULL == p_hw_sce_rsa_private_decrypt)
+    {
+        /* Wrapped keys can only be used by the SCE procedures */
+        if (true == (bool) ctx->vendor_ctx)
+        {
+            return MBEDTLS_ERR_PLATFORM_FEATURE_UNSUPPORTED;
+        }
+
+        /* Other plaintext key sizes are handled in software using the CRT parameters */
+        return mbedtls_internal_rsa_private_crt(ctx, f_rng, p_rng, input, output);
+    }
+
+    /* The SCE procedures apply their own countermeasures */
+    (void) f_rng;
+    (void) p_rng;
+
+    if (true == (bool) ctx->vendor_ctx)
+    {
+        private_key_size_bytes = RSA_WRAPPED_PRIVATE_KEY_SIZE_BYTES(ctx->len * 8U);
+    }
+
     /* If the size of N is not equal to the modulus size, then that is because of the leading 00 (sign field) from the ASN1 import
      * Use openssl asn1parse -in private1.pem to see asn1 format of a .pem key */
     if (ctx->N.n != (ctx->len / (sizeof(mbedtls_mpi_uint))))
@@ -367,46 +442,60 @@ int mbedtls_rsa_private (mbedtls_rsa_context * ctx,
         }
     }
 
-    p_hw_sce_rsa_private_decrypt = g_rsa_private_decrypt_lookup[(bool) ctx->vendor_ctx];
-    if (NULL == p_hw_sce_rsa_private_decrypt)
+  #if defined(MBEDTLS_THREADING_C)
+    if ((ret = mbedtls_mutex_lock(&ctx->mutex)) != 0)
     {
-        return MBEDTLS_ERR_PLATFORM_FEATURE_UNSUPPORTED;
+        return ret;
     }
+  #endif
 
-    /* Obtain a common 32-bit aligned buffer. It will be used for all the following items in this order:
+    /* The key is converted to the SCE format on the first private key operation and kept in the context
+     * until the key changes or the context is freed. The cache holds these items in this order:
      * Public Key (N) of size RSA_MODULUS_SIZE_BYTES(x)
      * Private Key (D) of size private_key_size_bytes
      */
-    p_common_buff_32 = mbedtls_calloc(((ctx->len + private_key_size_bytes) / 4), sizeof(uint32_t));
-
-    if (NULL == p_common_buff_32)
+    if (NULL == ctx->p_sce_key)
     {
-        return MBEDTLS_ERR_MPI_ALLOC_FAILED;
-    }
+        /* Obtain a common 32-bit aligned buffer */
+        ctx->p_sce_key = mbedtls_calloc(((ctx->len + private_key_size_bytes) / 4), sizeof(uint32_t));
 
-    p_calloc_temp_buff_N = p_common_buff_32;
-    p_calloc_temp_buff_D = p_calloc_temp_buff_N + (ctx->len / 4);
+        if (NULL == ctx->p_sce_key)
+        {
+            ret = MBEDTLS_ERR_MPI_ALLOC_FAILED;
+        }
+        /* Write N into the buffer in reverse */
+        else if (0 != mbedtls_mpi_write_binary(&ctx->N, (uint8_t *) ctx->p_sce_key, ctx->len))
+        {
+            ret = MBEDTLS_ERR_ECP_ALLOC_FAILED;
+        }
+        /* Write D into the buffer in reverse */
+        else if (0 !=
+                 mbedtls_mpi_write_binary(&ctx->D, (uint8_t *) (ctx->p_sce_key + (ctx->len / 4)),
+                                          private_key_size_bytes))
+        {
+            ret = MBEDTLS_ERR_ECP_ALLOC_FAILED;
+        }
+        else
+        {
+            /* Key is ready for use */
+        }
 
-    /* Write N into the buffer in reverse */
-    if (0 != mbedtls_mpi_write_binary(&ctx->N, (uint8_t *) p_calloc_temp_buff_N, ctx->len))
-    {
-        ret = MBEDTLS_ERR_ECP_ALLOC_FAILED;
-    }
-    /* Write D into the buffer in reverse */
-    else if (0 != mbedtls_mpi_write_binary(&ctx->D, (uint8_t *) p_calloc_temp_buff_D, private_key_size_bytes))
-    {
-        ret = MBEDTLS_ERR_ECP_ALLOC_FAILED;
+        if (0 != ret)
+        {
+            mbedtls_internal_rsa_key_cache_free(ctx);
+        }
     }
-    else
+
+    if (0 == ret)
     {
+        p_sce_key_N = ctx->p_sce_key;
+        p_sce_key_D = p_sce_key_N + (ctx->len / 4);
+
         err = FSP_ERR_CRYPTO_CONTINUE;
         for ( ; FSP_ERR_CRYPTO_CONTINUE == err; )
         {
             err =
-                p_hw_sce_rsa_private_decrypt((uint32_t *) input,
-                                             p_calloc_temp_buff_D,
-                                             p_calloc_temp_buff_N,
-                                             (uint32_t *) output);
+                p_hw_sce_rsa_private_decrypt((uint32_t *) input, p_sce_key_D, p_sce_key_N, (uint32_t *) output);
         }
 
         if (err != 0)
@@ -415,9 +504,30 @@ int mbedtls_rsa_private (mbedtls_rsa_context * ctx,
         }
     }
 
-    /* Clear out the allocated buffer memory */
-    memset(p_common_buff_32, 0, ((RSA_MODULUS_SIZE_BYTES(2048) + private_key_size_bytes)));
-    mbedtls_free(p_common_buff_32);
+  #if defined(MBEDTLS_THREADING_C)
+    if (mbedtls_mutex_unlock(&ctx->mutex) != 0)
+    {
+        return MBEDTLS_ERR_THREADING_MUTEX_ERROR;
+    }
+  #endif
+
+    return ret;
+}
+
+int mbedtls_rsa_private (mbedtls_rsa_context * ctx,
+                         int (* f_rng)(void *, unsigned char *, size_t),
+                         void * p_rng,
+                         const unsigned char * input,
+                         unsigned char * output)
+{
+    if (FSP_SUCCESS != RM_PSA_CRYPTO_SCE_ACQUIRE())
+    {
+        return MBEDTLS_ERR_PLATFORM_HW_ACCEL_FAILED;
+    }
+
+    int ret = rsa_private_sce(ctx, f_rng, p_rng, input, output);
+
+    RM_PSA_CRYPTO_SCE_RELEASE();
 
     return ret;
 }
@@ -334,6 +334,19 @@ int mbedtls_sha256_update_ret( mbedtls_sha256_context *ctx,
         left = 0;
     }
 
+#if defined(MBEDTLS_SHA256_PROCESS_ALT)
+    /* Hand every whole block to the SCE at once so the state is only loaded and stored one time. */
+    if( ilen >= 64 )
+    {
+        size_t blocks = ilen / 64;
+
+        if( ( ret = mbedtls_internal_sha256_process_blocks( ctx, input, blocks ) ) != 0 )
+            return( ret );
+
+        input += blocks * 64;
+        ilen  -= blocks * 64;
+    }
+#else
     while( ilen >= 64 )
     {
         if( ( ret = mbedtls_internal_sha256_process( ctx, input ) ) != 0 )
@@ -342,6 +355,7 @@ int mbedtls_sha256_update_ret( mbedtls_sha256_context *ctx,
         input += 64;
         ilen  -= 64;
     }
+#endif
 
     if( ilen > 0 )
         memcpy( (void *) (ctx->buffer + left), input, ilen );
@@ -432,6 +446,184 @@ void mbedtls_sha256_finish( mbedtls_sha256_context *ctx,
 }
 #endif
 
+/*
+ * HMAC-SHA-256 with cached key pad states
+ */
+void mbedtls_sha256_hmac_init( mbedtls_sha256_hmac_context *ctx )
+{
+    SHA256_VALIDATE( ctx != NULL );
+
+    memset( ctx, 0, sizeof( mbedtls_sha256_hmac_context ) );
+}
+
+void mbedtls_sha256_hmac_free( mbedtls_sha256_hmac_context *ctx )
+{
+    if( ctx == NULL )
+        return;
+
+    mbedtls_platform_zeroize( ctx, sizeof( mbedtls_sha256_hmac_context ) );
+}
+
+int mbedtls_sha256_hmac_setup( mbedtls_sha256_hmac_context *ctx,
+                               const unsigned char *key,
+                               size_t keylen )
+{
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+    unsigned char sum[32];
+    unsigned char pad[64];
+    size_t i;
+
+    SHA256_VALIDATE_RET( ctx != NULL );
+    SHA256_VALIDATE_RET( keylen == 0 || key != NULL );
+
+    if( keylen > sizeof( pad ) )
+    {
+        if( ( ret = mbedtls_sha256_ret( key, keylen, sum, 0 ) ) != 0 )
+            goto exit;
+
+        key = sum;
+        keylen = sizeof( sum );
+    }
+
+    memset( pad, 0x36, sizeof( pad ) );
+    for( i = 0; i < keylen; i++ )
+        pad[i] ^= key[i];
+
+    if( ( ret = mbedtls_sha256_starts_ret( &ctx->inner, 0 ) ) != 0 ||
+        ( ret = mbedtls_internal_sha256_process( &ctx->inner, pad ) ) != 0 )
+        goto exit;
+
+    for( i = 0; i < sizeof( pad ); i++ )
+        pad[i] ^= 0x36 ^ 0x5C;
+
+    if( ( ret = mbedtls_sha256_starts_ret( &ctx->outer, 0 ) ) != 0 ||
+        ( ret = mbedtls_internal_sha256_process( &ctx->outer, pad ) ) != 0 )
+        goto exit;
+
+    /* The pad blocks were processed directly, so account for them here */
+    ctx->inner.total[0] = sizeof( pad );
+    ctx->outer.total[0] = sizeof( pad );
+
+    ctx->work = ctx->inner;
+
+exit:
+    mbedtls_platform_zeroize( sum, sizeof( sum ) );
+    mbedtls_platform_zeroize( pad, sizeof( pad ) );
+
+    return( ret );
+}
+
+int mbedtls_sha256_hmac_starts( mbedtls_sha256_hmac_context *ctx )
+{
+    SHA256_VALIDATE_RET( ctx != NULL );
+
+    ctx->work = ctx->inner;
+
+    return( 0 );
+}
+
+int mbedtls_sha256_hmac_update( mbedtls_sha256_hmac_context *ctx,
+                                const unsigned char *input,
+                                size_t ilen )
+{
+    SHA256_VALIDATE_RET( ctx != NULL );
+
+    return( mbedtls_sha256_update_ret( &ctx->work, input, ilen ) );
+}
+
+int mbedtls_sha256_hmac_finish( mbedtls_sha256_hmac_context *ctx,
+                                unsigned char output[32] )
+{
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+
+    SHA256_VALIDATE_RET( ctx != NULL );
+    SHA256_VALIDATE_RET( (unsigned char *)output != NULL );
+
+    if( ( ret = mbedtls_sha256_finish_ret( &ctx->work, output ) ) != 0 )
+        goto exit;
+
+    ctx->work = ctx->outer;
+
+    if( ( ret = mbedtls_sha256_update_ret( &ctx->work, output, 32 ) ) != 0 ||
+        ( ret = mbedtls_sha256_finish_ret( &ctx->work, output ) ) != 0 )
+        goto exit;
+
+exit:
+    ctx->work = ctx->inner;
+
+    return( ret );
+}
+
+int mbedtls_sha256_hmac( mbedtls_sha256_hmac_context *ctx,
+                         const unsigned char *input,
+                         size_t ilen,
+                         unsigned char output[32] )
+{
+    int ret = MBEDTLS_ERR_ERROR_CORRUPTION_DETECTED;
+
+    if( ( ret = mbedtls_sha256_hmac_starts( ctx ) ) != 0 ||
+        ( ret = mbedtls_sha256_hmac_update( ctx, input, ilen ) ) != 0 )
+        return( ret );
+
+    return( mbedtls_sha256_hmac_finish( ctx, output ) );
+}
+
+/*
+ * HKDF-Expand: T(i) = HMAC(PRK, T(i - 1) | info | i), OKM = T(1) | T(2) | ...
+ */
+int mbedtls_sha256_hkdf_expand( const mbedtls_sha256_hmac_context *prk,
+                                const unsigned char *info,
+                                size_t info_len,
+                                unsigned char *okm,
+                                size_t okm_len )
+{
+    int ret = 0;
+    mbedtls_sha256_context work;
+    unsigned char t[32];
+    size_t t_len = 0;
+    size_t where = 0;
+    unsigned char c;
+
+    SHA256_VALIDATE_RET( prk != NULL );
+    SHA256_VALIDATE_RET( info_len == 0 || info != NULL );
+    SHA256_VALIDATE_RET( okm_len == 0 || okm != NULL );
+
+    if( okm_len > 255 * sizeof( t ) )
+        return( MBEDTLS_ERR_SHA256_BAD_INPUT_DATA );
+
+    for( c = 1; where < okm_len; c++ )
+    {
+        size_t n = okm_len - where;
+
+        work = prk->inner;
+
+        if( ( ret = mbedtls_sha256_update_ret( &work, t, t_len ) ) != 0 ||
+            ( ret = mbedtls_sha256_update_ret( &work, info, info_len ) ) != 0 ||
+            ( ret = mbedtls_sha256_update_ret( &work, &c, 1 ) ) != 0 ||
+            ( ret = mbedtls_sha256_finish_ret( &work, t ) ) != 0 )
+            goto exit;
+
+        work = prk->outer;
+
+        if( ( ret = mbedtls_sha256_update_ret( &work, t, sizeof( t ) ) ) != 0 ||
+            ( ret = mbedtls_sha256_finish_ret( &work, t ) ) != 0 )
+            goto exit;
+
+        if( n > sizeof( t ) )
+            n = sizeof( t );
+
+        memcpy( okm + where, t, n );
+        where += n;
+        t_len = sizeof( t );
+    }
+
+exit:
+    mbedtls_platform_zeroize( &work, sizeof( work ) );
+    mbedtls_platform_zeroize( t, sizeof( t ) );
+
+    return( ret );
+}
+
 #endif /* !MBEDTLS_SHA256_ALT */
 
 #endif /* MBEDTLS_SHA256_C */
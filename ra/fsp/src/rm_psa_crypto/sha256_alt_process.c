@@ -47,6 +47,7 @@
 
  #if defined(MBEDTLS_SHA256_PROCESS_ALT)
   #include "hw_sce_hash_private.h"
+  #include "rm_psa_crypto.h"
 
 /*******************************************************************************************************************//**
  * @addtogroup RM_PSA_CRYPTO
@@ -60,8 +61,8 @@
  * @retval 0                                       Hash calculation was successful.
  * @retval MBEDTLS_ERR_PLATFORM_HW_ACCEL_FAILED    Hash calculation with the SCE failed
  **********************************************************************************************************************/
-int mbedtls_internal_sha256_process (mbedtls_sha256_context * ctx,
-                                     const unsigned char      data[SIZE_MBEDTLS_SHA256_PROCESS_BUFFER_BYTES])
+static int sha256_process_sce (mbedtls_sha256_context * ctx,
+                               const unsigned char      data[SIZE_MBEDTLS_SHA256_PROCESS_BUFFER_BYTES])
 {
     SHA256_VALIDATE_RET(ctx != NULL);
     SHA256_VALIDATE_RET((const unsigned char *) data != NULL);
@@ -76,6 +77,69 @@ int mbedtls_internal_sha256_process (mbedtls_sha256_context * ctx,
     return 0;
 }
 
+int mbedtls_internal_sha256_process (mbedtls_sha256_context * ctx,
+                                     const unsigned char      data[SIZE_MBEDTLS_SHA256_PROCESS_BUFFER_BYTES])
+{
+    if (FSP_SUCCESS != RM_PSA_CRYPTO_SCE_ACQUIRE())
+    {
+        return MBEDTLS_ERR_PLATFORM_HW_ACCEL_FAILED;
+    }
+
+    int ret = sha256_process_sce(ctx, data);
+
+    RM_PSA_CRYPTO_SCE_RELEASE();
+
+    return ret;
+}
+
+/*******************************************************************************************************************//**
+ * Uses the SCE to process a run of whole 64-byte blocks in a single call. The intermediate digest is loaded into the
+ * SCE once before the first block and read back once after the last block.
+ *
+ * @retval 0                                       Hash calculation was successful.
+ * @retval MBEDTLS_ERR_PLATFORM_HW_ACCEL_FAILED    Hash calculation with the SCE failed
+ **********************************************************************************************************************/
+static int sha256_process_blocks_sce (mbedtls_sha256_context * ctx, const unsigned char * data, size_t num_blocks)
+{
+    SHA256_VALIDATE_RET(ctx != NULL);
+    SHA256_VALIDATE_RET((num_blocks == 0U) || (data != NULL));
+
+    /* Limit each call so the word count always fits the 32-bit length argument of the SCE procedure. */
+    const size_t max_blocks = UINT32_MAX / BYTES_TO_WORDS(SIZE_MBEDTLS_SHA256_PROCESS_BUFFER_BYTES);
+
+    while (num_blocks > 0U)
+    {
+        size_t blocks = (num_blocks > max_blocks) ? max_blocks : num_blocks;
+
+        if (FSP_SUCCESS !=
+            HW_SCE_SHA256_UpdateHash((const uint32_t *) &data[0],
+                                     (uint32_t) (blocks * BYTES_TO_WORDS(SIZE_MBEDTLS_SHA256_PROCESS_BUFFER_BYTES)),
+                                     (uint32_t *) &ctx->state[0])) // NOLINT(rea-tp-casting)
+        {
+            return MBEDTLS_ERR_PLATFORM_HW_ACCEL_FAILED;
+        }
+
+        data       += blocks * SIZE_MBEDTLS_SHA256_PROCESS_BUFFER_BYTES;
+        num_blocks -= blocks;
+    }
+
+    return 0;
+}
+
+int mbedtls_internal_sha256_process_blocks (mbedtls_sha256_context * ctx, const unsigned char * data, size_t num_blocks)
+{
+    if (FSP_SUCCESS != RM_PSA_CRYPTO_SCE_ACQUIRE())
+    {
+        return MBEDTLS_ERR_PLATFORM_HW_ACCEL_FAILED;
+    }
+
+    int ret = sha256_process_blocks_sce(ctx, data, num_blocks);
+
+    RM_PSA_CRYPTO_SCE_RELEASE();
+
+    return ret;
+}
+
   #if !defined(MBEDTLS_DEPRECATED_REMOVED)
 void mbedtls_sha256_process (mbedtls_sha256_context * ctx,
                              const unsigned char      data[SIZE_MBEDTLS_SHA256_PROCESS_BUFFER_BYTES])
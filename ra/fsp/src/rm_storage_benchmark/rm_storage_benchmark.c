@@ -0,0 +1,718 @@
+/***********************************************************************************************************************
+ * Copyright [2020] Renesas Electronics Corporation and/or its affiliates.  All Rights Reserved.
+ *
+ * This software and documentation are supplied by Renesas Electronics America Inc. and may only be used with products
+ * of Renesas Electronics Corp. and its affiliates ("Renesas").  No other uses are authorized.  Renesas products are
+ * sold pursuant to Renesas terms and conditions of sale.  Purchasers are solely responsible for the selection and use
+ * of Renesas products and Renesas assumes no liability.  No license, express or implied, to any intellectual property
+ * right is granted by Renesas. This software is protected under all applicable laws, including copyright laws. Renesas
+ * reserves the right to change or discontinue this software and/or this documentation. THE SOFTWARE AND DOCUMENTATION
+ * IS DELIVERED TO YOU "AS IS," AND RENESAS MAKES NO REPRESENTATIONS OR WARRANTIES, AND TO THE FULLEST EXTENT
+ * PERMISSIBLE UNDER APPLICABLE LAW, DISCLAIMS ALL WARRANTIES, WHETHER EXPLICITLY OR IMPLICITLY, INCLUDING WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, AND NONINFRINGEMENT, WITH RESPECT TO THE SOFTWARE OR
+ * DOCUMENTATION.  RENESAS SHALL HAVE NO LIABILITY ARISING OUT OF ANY SECURITY VULNERABILITY OR BREACH.  TO THE MAXIMUM
+ * EXTENT PERMITTED BY LAW, IN NO EVENT WILL RENESAS BE LIABLE TO YOU IN CONNECTION WITH THE SOFTWARE OR DOCUMENTATION
+ * (OR ANY PERSON OR ENTITY CLAIMING RIGHTS DERIVED FROM YOU) FOR ANY LOSS, DAMAGES, OR CLAIMS WHATSOEVER, INCLUDING,
+ * WITHOUT LIMITATION, ANY DIRECT, CONSEQUENTIAL, SPECIAL, INDIRECT, PUNITIVE, OR INCIDENTAL DAMAGES; ANY LOST PROFITS,
+ * OTHER ECONOMIC DAMAGE, PROPERTY DAMAGE, OR PERSONAL INJURY; AND EVEN IF RENESAS HAS BEEN ADVISED OF THE POSSIBILITY
+ * OF SUCH LOSS, DAMAGES, CLAIMS OR COSTS.
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Includes
+ **********************************************************************************************************************/
+#include <string.h>
+#include "rm_storage_benchmark.h"
+
+#if RM_STORAGE_BENCHMARK_CFG_FREERTOS_PLUS_FAT_SUPPORT
+ #include "ff_stdio.h"
+#endif
+
+/***********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+#define RM_STORAGE_BENCHMARK_US_PER_S        (1000000U)
+#define RM_STORAGE_BENCHMARK_US_PER_MS       (1000U)
+#define RM_STORAGE_BENCHMARK_PERCENT         (100U)
+#define RM_STORAGE_BENCHMARK_PERMILLE        (1000U)
+#define RM_STORAGE_BENCHMARK_SEED_DEFAULT    (0x2545F491U)
+
+/***********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+
+/* State of one job on one target. */
+typedef struct st_rm_storage_benchmark_ctx
+{
+    rm_storage_benchmark_cfg_t const    * p_cfg;
+    rm_storage_benchmark_target_t const * p_target;
+    rm_storage_benchmark_job_t const    * p_job;
+    rm_storage_benchmark_result_t         result;
+    bsp_cycle_counter_get_t               p_cycles_get;
+    uint32_t cycles_per_us;
+    uint32_t sector_size;              // Block media sector size
+#if RM_STORAGE_BENCHMARK_CFG_FREERTOS_PLUS_FAT_SUPPORT
+    FF_FILE * p_file;
+#endif
+#if RM_STORAGE_BENCHMARK_CFG_LITTLEFS_SUPPORT
+    lfs_file_t file;
+#endif
+} rm_storage_benchmark_ctx_t;
+
+/***********************************************************************************************************************
+ * Private function prototypes
+ **********************************************************************************************************************/
+static void      rm_storage_benchmark_job_run(rm_storage_benchmark_ctx_t * p_ctx);
+static fsp_err_t rm_storage_benchmark_prepare(rm_storage_benchmark_ctx_t * p_ctx, bool writes);
+static fsp_err_t rm_storage_benchmark_io(rm_storage_benchmark_ctx_t * p_ctx, bool write, uint32_t offset);
+static fsp_err_t rm_storage_benchmark_finish(rm_storage_benchmark_ctx_t * p_ctx);
+static fsp_err_t rm_storage_benchmark_flash_wait(rm_storage_benchmark_target_t const * p_target);
+static fsp_err_t rm_storage_benchmark_spi_flash_wait(rm_storage_benchmark_target_t const * p_target);
+static uint32_t  rm_storage_benchmark_stride_get(uint32_t num_blocks);
+static void      rm_storage_benchmark_sift_down(uint32_t * p_samples, uint32_t root, uint32_t count);
+static void      rm_storage_benchmark_sort(uint32_t * p_samples, uint32_t count);
+static void      rm_storage_benchmark_latency_get(uint32_t * p_samples, uint32_t count, uint64_t sum_us,
+                                                  rm_storage_benchmark_latency_t * p_latency);
+
+#if RM_STORAGE_BENCHMARK_CFG_FREERTOS_PLUS_FAT_SUPPORT || RM_STORAGE_BENCHMARK_CFG_LITTLEFS_SUPPORT
+static fsp_err_t rm_storage_benchmark_file_create(rm_storage_benchmark_ctx_t * p_ctx);
+
+#endif
+
+/***********************************************************************************************************************
+ * Private global variables
+ **********************************************************************************************************************/
+static const char * const g_storage_benchmark_layer_names[] =
+{
+    [RM_STORAGE_BENCHMARK_LAYER_BLOCK_MEDIA]       = "block",
+    [RM_STORAGE_BENCHMARK_LAYER_FLASH]             = "flash",
+    [RM_STORAGE_BENCHMARK_LAYER_SPI_FLASH]         = "spiflash",
+    [RM_STORAGE_BENCHMARK_LAYER_FREERTOS_PLUS_FAT] = "fat",
+    [RM_STORAGE_BENCHMARK_LAYER_LITTLEFS]          = "littlefs",
+};
+
+/*******************************************************************************************************************//**
+ * @addtogroup RM_STORAGE_BENCHMARK
+ * @{
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Functions
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * Runs every job on every target and passes each measurement to p_cfg->p_callback. Placing the same medium in the
+ * target list once as a raw device and once per file system gives the cost of each layer; the rows printed with
+ * RM_STORAGE_BENCHMARK_Format() can be compared across media and across builds to catch regressions.
+ *
+ * Each job issues num_ops operations of block_size bytes, visiting the blocks of the target region in order or in a
+ * pseudo-random permutation, and picks reads or writes at random in the read_percent ratio. Operations are timed one
+ * by one, and the read and write latency distributions are reported separately. The drivers and file systems
+ * complete each operation before returning, so a job always keeps one operation in flight.
+ *
+ * Before a job that writes, flash regions are erased and files are created at full size, so that programming does
+ * not fail and file writes do not allocate clusters; this time is reported as prepare_us. For flash targets a job
+ * that writes may visit each block once only, so num_ops must not exceed the number of blocks in the region.
+ *
+ * A job that fails is reported with a non-zero status and the next job is run. The contents of each target region
+ * are destroyed. This function runs for a long time and must not be called from an interrupt.
+ *
+ * @retval FSP_SUCCESS                  All measurements were reported.
+ * @retval FSP_ERR_ASSERTION            A required pointer is NULL or no targets or jobs were given.
+ * @retval FSP_ERR_INVALID_SIZE         The data buffer is smaller than a block size, or the latency buffer is smaller
+ *                                      than the number of operations of a job.
+ * @retval FSP_ERR_UNSUPPORTED          No cycle counter, see R_BSP_CycleCounterSelect().
+ **********************************************************************************************************************/
+fsp_err_t RM_STORAGE_BENCHMARK_Run (rm_storage_benchmark_cfg_t const * const p_cfg)
+{
+    rm_storage_benchmark_ctx_t ctx;
+    fsp_err_t                  err;
+
+#if BSP_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(p_cfg);
+    FSP_ASSERT(p_cfg->p_targets);
+    FSP_ASSERT(p_cfg->num_targets);
+    FSP_ASSERT(p_cfg->p_jobs);
+    FSP_ASSERT(p_cfg->num_jobs);
+    FSP_ASSERT(p_cfg->p_buffer);
+    FSP_ASSERT(p_cfg->p_latencies);
+    FSP_ASSERT(p_cfg->p_callback);
+#endif
+
+    for (uint32_t i = 0U; i < p_cfg->num_jobs; i++)
+    {
+        FSP_ERROR_RETURN(0U != p_cfg->p_jobs[i].block_size, FSP_ERR_INVALID_SIZE);
+        FSP_ERROR_RETURN(p_cfg->p_jobs[i].block_size <= p_cfg->buffer_size, FSP_ERR_INVALID_SIZE);
+        FSP_ERROR_RETURN(p_cfg->p_jobs[i].num_ops <= p_cfg->num_latencies, FSP_ERR_INVALID_SIZE);
+    }
+
+    memset(&ctx, 0, sizeof(ctx));
+    err = R_BSP_CycleCounterSelect(p_cfg->p_cycles_get, &ctx.p_cycles_get);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+    ctx.p_cfg         = p_cfg;
+    ctx.cycles_per_us = SystemCoreClock / RM_STORAGE_BENCHMARK_US_PER_S;
+
+    for (uint32_t t = 0U; t < p_cfg->num_targets; t++)
+    {
+        for (uint32_t j = 0U; j < p_cfg->num_jobs; j++)
+        {
+            ctx.p_target = &p_cfg->p_targets[t];
+            ctx.p_job    = &p_cfg->p_jobs[j];
+            rm_storage_benchmark_job_run(&ctx);
+        }
+    }
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Formats a measurement as one report row, or the column headings if p_result is NULL. Print the headings once,
+ * then one row per result.
+ *
+ * @return Row length as returned by R_BSP_ReportRowFormat().
+ **********************************************************************************************************************/
+int32_t RM_STORAGE_BENCHMARK_Format (rm_storage_benchmark_result_t const * const p_result,
+                                     char * const                                p_line,
+                                     uint32_t                                    line_size)
+{
+    if (NULL == p_result)
+    {
+        return R_BSP_ReportRowFormat(p_line, line_size, 0,
+                                     "%-12s %-8s %-14s %3s %6s %3s %7s %7s %8s %7s %9s | %27s | %27s",
+                                     "target", "layer", "job", "err", "bs", "rd%", "reads", "writes", "kB/s", "iops",
+                                     "prep_us", "read us p50/p99/p99.9/max", "write us p50/p99/p99.9/max");
+    }
+
+    rm_storage_benchmark_latency_t const * p_read  = &p_result->read_latency;
+    rm_storage_benchmark_latency_t const * p_write = &p_result->write_latency;
+
+    return R_BSP_ReportRowFormat(p_line, line_size, 0,
+                                 "%-12s %-8s %-14s %3d %6u %3u %7u %7u %8u %7u %9u | %6u/%6u/%6u/%6u | %6u/%6u/%6u/%6u",
+                                 p_result->p_target->p_name,
+                                 g_storage_benchmark_layer_names[p_result->p_target->layer],
+                                 p_result->p_job->p_name, (int) p_result->status,
+                                 (unsigned) p_result->p_job->block_size, (unsigned) p_result->p_job->read_percent,
+                                 (unsigned) p_result->reads, (unsigned) p_result->writes,
+                                 (unsigned) p_result->throughput_kbytes_per_s, (unsigned) p_result->iops,
+                                 (unsigned) p_result->prepare_us, (unsigned) p_read->p50_us, (unsigned) p_read->p99_us,
+                                 (unsigned) p_read->p999_us, (unsigned) p_read->max_us, (unsigned) p_write->p50_us,
+                                 (unsigned) p_write->p99_us, (unsigned) p_write->p999_us, (unsigned) p_write->max_us);
+}
+
+/*******************************************************************************************************************//**
+ * @} (end addtogroup RM_STORAGE_BENCHMARK)
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Private Functions
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * Runs one job on one target and reports it. Read latencies are stored from the start of the latency buffer and
+ * write latencies from its end.
+ **********************************************************************************************************************/
+static void rm_storage_benchmark_job_run (rm_storage_benchmark_ctx_t * p_ctx)
+{
+    rm_storage_benchmark_cfg_t const    * p_cfg    = p_ctx->p_cfg;
+    rm_storage_benchmark_target_t const * p_target = p_ctx->p_target;
+    rm_storage_benchmark_job_t const    * p_job    = p_ctx->p_job;
+    rm_storage_benchmark_result_t       * p_result = &p_ctx->result;
+    uint32_t   num_blocks   = p_target->size / p_job->block_size;
+    uint32_t   random       = (0U != p_job->seed) ? p_job->seed : RM_STORAGE_BENCHMARK_SEED_DEFAULT;
+    uint32_t   stride       = 1U;
+    uint64_t   read_sum_us  = 0U;
+    uint64_t   write_sum_us = 0U;
+    bool       writes       = p_job->read_percent < RM_STORAGE_BENCHMARK_PERCENT;
+    bool       flash        = (RM_STORAGE_BENCHMARK_LAYER_FLASH == p_target->layer) ||
+                              (RM_STORAGE_BENCHMARK_LAYER_SPI_FLASH == p_target->layer);
+    fsp_err_t  err          = FSP_SUCCESS;
+
+    memset(p_result, 0, sizeof(*p_result));
+    p_result->p_target  = p_target;
+    p_result->p_job     = p_job;
+    p_result->p_context = p_cfg->p_context;
+
+    if ((0U == num_blocks) || (flash && writes && (p_job->num_ops > num_blocks)))
+    {
+        /* Flash blocks can only be programmed once per erase. */
+        err = FSP_ERR_INVALID_SIZE;
+    }
+    else
+    {
+        err = rm_storage_benchmark_prepare(p_ctx, writes);
+    }
+
+    if (FSP_SUCCESS == err)
+    {
+        if (RM_STORAGE_BENCHMARK_PATTERN_RANDOM == p_job->pattern)
+        {
+            stride = rm_storage_benchmark_stride_get(num_blocks);
+        }
+
+        for (uint32_t i = 0U; (i < p_job->num_ops) && (FSP_SUCCESS == err); i++)
+        {
+            /* xorshift32 decides between read and write. */
+            random ^= random << 13;
+            random ^= random >> 17;
+            random ^= random << 5;
+            bool write = (random % RM_STORAGE_BENCHMARK_PERCENT) >= p_job->read_percent;
+
+            /* A stride coprime with the block count visits every block once per pass. */
+            uint32_t block  = (uint32_t) (((uint64_t) i * stride + p_job->seed) % num_blocks);
+            uint32_t offset = p_target->offset + (block * p_job->block_size);
+
+            /* Mark the data so that each write differs from the previous contents. */
+            if (write)
+            {
+                memset(p_cfg->p_buffer, (int) (i & UINT8_MAX), p_job->block_size);
+            }
+
+            uint32_t start = p_ctx->p_cycles_get();
+            err = rm_storage_benchmark_io(p_ctx, write, offset);
+            uint32_t latency_us = (p_ctx->p_cycles_get() - start) / p_ctx->cycles_per_us;
+
+            if (FSP_SUCCESS == err)
+            {
+                if (write)
+                {
+                    p_result->writes++;
+                    p_cfg->p_latencies[p_job->num_ops - p_result->writes] = latency_us;
+                    write_sum_us += latency_us;
+                }
+                else
+                {
+                    p_cfg->p_latencies[p_result->reads] = latency_us;
+                    p_result->reads++;
+                    read_sum_us += latency_us;
+                }
+
+                p_result->bytes += p_job->block_size;
+            }
+        }
+
+        fsp_err_t finish_err = rm_storage_benchmark_finish(p_ctx);
+        err = (FSP_SUCCESS == err) ? finish_err : err;
+    }
+
+    p_result->status      = err;
+    p_result->duration_us = read_sum_us + write_sum_us;
+    if (0U != p_result->duration_us)
+    {
+        p_result->throughput_kbytes_per_s = (uint32_t) ((p_result->bytes * RM_STORAGE_BENCHMARK_US_PER_MS) /
+                                                        p_result->duration_us);
+        p_result->iops = (uint32_t) (((uint64_t) (p_result->reads + p_result->writes) * RM_STORAGE_BENCHMARK_US_PER_S) /
+                                     p_result->duration_us);
+    }
+
+    rm_storage_benchmark_latency_get(p_cfg->p_latencies, p_result->reads, read_sum_us, &p_result->read_latency);
+    rm_storage_benchmark_latency_get(&p_cfg->p_latencies[p_job->num_ops - p_result->writes], p_result->writes,
+                                     write_sum_us, &p_result->write_latency);
+
+    p_cfg->p_callback(p_result);
+}
+
+/*******************************************************************************************************************//**
+ * Gets a target ready for a job: erases flash regions that will be written, reads the block media geometry, or
+ * creates and opens the file.
+ **********************************************************************************************************************/
+static fsp_err_t rm_storage_benchmark_prepare (rm_storage_benchmark_ctx_t * p_ctx, bool writes)
+{
+    rm_storage_benchmark_target_t const * p_target = p_ctx->p_target;
+    fsp_err_t err   = FSP_SUCCESS;
+    uint32_t  start = p_ctx->p_cycles_get();
+
+    switch (p_target->layer)
+    {
+        case RM_STORAGE_BENCHMARK_LAYER_BLOCK_MEDIA:
+        {
+            rm_block_media_info_t info;
+            err = p_target->p_block_media->p_api->infoGet(p_target->p_block_media->p_ctrl, &info);
+            if (FSP_SUCCESS == err)
+            {
+                p_ctx->sector_size = info.sector_size_bytes;
+                err                = ((0U == (p_ctx->p_job->block_size % info.sector_size_bytes)) &&
+                                      (0U == (p_target->offset % info.sector_size_bytes))) ?
+                                     FSP_SUCCESS : FSP_ERR_INVALID_SIZE;
+            }
+
+            break;
+        }
+
+        case RM_STORAGE_BENCHMARK_LAYER_FLASH:
+        {
+            if (writes)
+            {
+                err = p_target->p_flash->p_api->erase(p_target->p_flash->p_ctrl,
+                                                      (uint32_t) &p_target->p_mapped[p_target->offset],
+                                                      p_target->size / p_target->erase_size);
+                err = (FSP_SUCCESS == err) ? rm_storage_benchmark_flash_wait(p_target) : err;
+            }
+
+            break;
+        }
+
+        case RM_STORAGE_BENCHMARK_LAYER_SPI_FLASH:
+        {
+            for (uint32_t erased = 0U; writes && (erased < p_target->size) && (FSP_SUCCESS == err);
+                 erased += p_target->erase_size)
+            {
+                err = p_target->p_spi_flash->p_api->erase(p_target->p_spi_flash->p_ctrl,
+                                                          &p_target->p_mapped[p_target->offset + erased],
+                                                          p_target->erase_size);
+                err = (FSP_SUCCESS == err) ? rm_storage_benchmark_spi_flash_wait(p_target) : err;
+            }
+
+            break;
+        }
+
+        default:
+        {
+#if RM_STORAGE_BENCHMARK_CFG_FREERTOS_PLUS_FAT_SUPPORT || RM_STORAGE_BENCHMARK_CFG_LITTLEFS_SUPPORT
+            err = rm_storage_benchmark_file_create(p_ctx);
+#else
+            err = FSP_ERR_UNSUPPORTED;
+#endif
+            break;
+        }
+    }
+
+    p_ctx->result.prepare_us = (p_ctx->p_cycles_get() - start) / p_ctx->cycles_per_us;
+
+    return err;
+}
+
+/*******************************************************************************************************************//**
+ * Reads or writes one block of the job through the layer of the target.
+ **********************************************************************************************************************/
+static fsp_err_t rm_storage_benchmark_io (rm_storage_benchmark_ctx_t * p_ctx, bool write, uint32_t offset)
+{
+    rm_storage_benchmark_target_t const * p_target = p_ctx->p_target;
+    uint8_t * p_buffer = p_ctx->p_cfg->p_buffer;
+    uint32_t  length   = p_ctx->p_job->block_size;
+    fsp_err_t err      = FSP_SUCCESS;
+
+    switch (p_target->layer)
+    {
+        case RM_STORAGE_BENCHMARK_LAYER_BLOCK_MEDIA:
+        {
+            rm_block_media_instance_t const * p_media = p_target->p_block_media;
+            if (write)
+            {
+                err = p_media->p_api->write(p_media->p_ctrl, p_buffer, offset / p_ctx->sector_size,
+                                            length / p_ctx->sector_size);
+            }
+            else
+            {
+                err = p_media->p_api->read(p_media->p_ctrl, p_buffer, offset / p_ctx->sector_size,
+                                           length / p_ctx->sector_size);
+            }
+
+            break;
+        }
+
+        case RM_STORAGE_BENCHMARK_LAYER_FLASH:
+        {
+            if (write)
+            {
+                err = p_target->p_flash->p_api->write(p_target->p_flash->p_ctrl, (uint32_t) p_buffer,
+                                                      (uint32_t) &p_target->p_mapped[offset], length);
+                err = (FSP_SUCCESS == err) ? rm_storage_benchmark_flash_wait(p_target) : err;
+            }
+            else
+            {
+                memcpy(p_buffer, &p_target->p_mapped[offset], length);
+            }
+
+            break;
+        }
+
+        case RM_STORAGE_BENCHMARK_LAYER_SPI_FLASH:
+        {
+            if (write)
+            {
+                /* Program page by page, without crossing page boundaries. */
+                for (uint32_t done = 0U; (done < length) && (FSP_SUCCESS == err); )
+                {
+                    uint32_t chunk = p_target->program_size - ((offset + done) % p_target->program_size);
+                    chunk = (chunk < (length - done)) ? chunk : (length - done);
+                    err   = p_target->p_spi_flash->p_api->write(p_target->p_spi_flash->p_ctrl, &p_buffer[done],
+                                                                &p_target->p_mapped[offset + done], chunk);
+                    err   = (FSP_SUCCESS == err) ? rm_storage_benchmark_spi_flash_wait(p_target) : err;
+                    done += chunk;
+                }
+            }
+            else
+            {
+                memcpy(p_buffer, &p_target->p_mapped[offset], length);
+            }
+
+            break;
+        }
+
+#if RM_STORAGE_BENCHMARK_CFG_FREERTOS_PLUS_FAT_SUPPORT
+        case RM_STORAGE_BENCHMARK_LAYER_FREERTOS_PLUS_FAT:
+        {
+            size_t done = 0U;
+            if (0 == ff_fseek(p_ctx->p_file, (long) (offset - p_target->offset), FF_SEEK_SET))
+            {
+                done = write ? ff_fwrite(p_buffer, 1U, length, p_ctx->p_file) :
+                       ff_fread(p_buffer, 1U, length, p_ctx->p_file);
+            }
+
+            err = (length == done) ? FSP_SUCCESS : (write ? FSP_ERR_WRITE_FAILED : FSP_ERR_ABORTED);
+            break;
+        }
+#endif
+
+#if RM_STORAGE_BENCHMARK_CFG_LITTLEFS_SUPPORT
+        case RM_STORAGE_BENCHMARK_LAYER_LITTLEFS:
+        {
+            lfs_ssize_t done = -1;
+            if (lfs_file_seek(p_target->p_lfs, &p_ctx->file, (lfs_soff_t) (offset - p_target->offset),
+                              LFS_SEEK_SET) >= 0)
+            {
+                done = write ? lfs_file_write(p_target->p_lfs, &p_ctx->file, p_buffer, length) :
+                       lfs_file_read(p_target->p_lfs, &p_ctx->file, p_buffer, length);
+            }
+
+            err = ((lfs_ssize_t) length == done) ? FSP_SUCCESS : (write ? FSP_ERR_WRITE_FAILED : FSP_ERR_ABORTED);
+            break;
+        }
+#endif
+
+        default:
+        {
+            err = FSP_ERR_UNSUPPORTED;
+            break;
+        }
+    }
+
+    return err;
+}
+
+/*******************************************************************************************************************//**
+ * Closes the file of a file system target. Closing flushes the cached data and metadata, so it is timed as sync_us.
+ **********************************************************************************************************************/
+static fsp_err_t rm_storage_benchmark_finish (rm_storage_benchmark_ctx_t * p_ctx)
+{
+    fsp_err_t err   = FSP_SUCCESS;
+    uint32_t  start = p_ctx->p_cycles_get();
+
+#if RM_STORAGE_BENCHMARK_CFG_FREERTOS_PLUS_FAT_SUPPORT
+    if (RM_STORAGE_BENCHMARK_LAYER_FREERTOS_PLUS_FAT == p_ctx->p_target->layer)
+    {
+        err = (0 == ff_fclose(p_ctx->p_file)) ? FSP_SUCCESS : FSP_ERR_WRITE_FAILED;
+    }
+#endif
+
+#if RM_STORAGE_BENCHMARK_CFG_LITTLEFS_SUPPORT
+    if (RM_STORAGE_BENCHMARK_LAYER_LITTLEFS == p_ctx->p_target->layer)
+    {
+        err = (lfs_file_close(p_ctx->p_target->p_lfs, &p_ctx->file) >= 0) ? FSP_SUCCESS : FSP_ERR_WRITE_FAILED;
+    }
+#endif
+
+    p_ctx->result.sync_us = (p_ctx->p_cycles_get() - start) / p_ctx->cycles_per_us;
+
+    return err;
+}
+
+#if RM_STORAGE_BENCHMARK_CFG_FREERTOS_PLUS_FAT_SUPPORT || RM_STORAGE_BENCHMARK_CFG_LITTLEFS_SUPPORT
+
+/*******************************************************************************************************************//**
+ * Creates the file of a file system target at the size of the region and leaves it open for the job.
+ **********************************************************************************************************************/
+static fsp_err_t rm_storage_benchmark_file_create (rm_storage_benchmark_ctx_t * p_ctx)
+{
+    rm_storage_benchmark_target_t const * p_target = p_ctx->p_target;
+    uint8_t * p_buffer = p_ctx->p_cfg->p_buffer;
+    uint32_t  chunk    = p_ctx->p_cfg->buffer_size;
+    bool      ok       = false;
+
+    memset(p_buffer, 0, chunk);
+
+ #if RM_STORAGE_BENCHMARK_CFG_FREERTOS_PLUS_FAT_SUPPORT
+    if (RM_STORAGE_BENCHMARK_LAYER_FREERTOS_PLUS_FAT == p_target->layer)
+    {
+        p_ctx->p_file = ff_fopen(p_target->p_path, "w+");
+        ok            = (NULL != p_ctx->p_file);
+        for (uint32_t done = 0U; ok && (done < p_target->size); done += chunk)
+        {
+            uint32_t length = ((p_target->size - done) < chunk) ? (p_target->size - done) : chunk;
+            ok = (length == ff_fwrite(p_buffer, 1U, length, p_ctx->p_file));
+        }
+
+        if (!ok && (NULL != p_ctx->p_file))
+        {
+            (void) ff_fclose(p_ctx->p_file);
+        }
+    }
+ #endif
+
+ #if RM_STORAGE_BENCHMARK_CFG_LITTLEFS_SUPPORT
+    if (RM_STORAGE_BENCHMARK_LAYER_LITTLEFS == p_target->layer)
+    {
+        ok = lfs_file_open(p_target->p_lfs, &p_ctx->file, p_target->p_path, LFS_O_RDWR | LFS_O_CREAT | LFS_O_TRUNC) >= 0;
+        if (ok)
+        {
+            for (uint32_t done = 0U; ok && (done < p_target->size); done += chunk)
+            {
+                uint32_t length = ((p_target->size - done) < chunk) ? (p_target->size - done) : chunk;
+                ok = ((lfs_ssize_t) length == lfs_file_write(p_target->p_lfs, &p_ctx->file, p_buffer, length));
+            }
+
+            /* Commit the allocation so the job measures overwrites, not appends. */
+            ok = ok && (lfs_file_sync(p_target->p_lfs, &p_ctx->file) >= 0);
+
+            if (!ok)
+            {
+                (void) lfs_file_close(p_target->p_lfs, &p_ctx->file);
+            }
+        }
+    }
+ #endif
+
+    return ok ? FSP_SUCCESS : FSP_ERR_WRITE_FAILED;
+}
+
+#endif
+
+/*******************************************************************************************************************//**
+ * Waits for a background data flash operation to complete.
+ **********************************************************************************************************************/
+static fsp_err_t rm_storage_benchmark_flash_wait (rm_storage_benchmark_target_t const * p_target)
+{
+    flash_status_t status = FLASH_STATUS_BUSY;
+    fsp_err_t      err    = FSP_SUCCESS;
+
+    while ((FSP_SUCCESS == err) && (FLASH_STATUS_BUSY == status))
+    {
+        err = p_target->p_flash->p_api->statusGet(p_target->p_flash->p_ctrl, &status);
+    }
+
+    return err;
+}
+
+/*******************************************************************************************************************//**
+ * Waits for an SPI flash program or erase to complete.
+ **********************************************************************************************************************/
+static fsp_err_t rm_storage_benchmark_spi_flash_wait (rm_storage_benchmark_target_t const * p_target)
+{
+    spi_flash_status_t status = {.write_in_progress = true};
+    fsp_err_t          err    = FSP_SUCCESS;
+
+    while ((FSP_SUCCESS == err) && status.write_in_progress)
+    {
+        err = p_target->p_spi_flash->p_api->statusGet(p_target->p_spi_flash->p_ctrl, &status);
+    }
+
+    return err;
+}
+
+/*******************************************************************************************************************//**
+ * Returns a stride near the golden ratio of the block count that is coprime with it, so that the blocks are visited
+ * in a scattered order that still covers each block once per pass.
+ **********************************************************************************************************************/
+static uint32_t rm_storage_benchmark_stride_get (uint32_t num_blocks)
+{
+    uint32_t stride = (uint32_t) (((uint64_t) num_blocks * 618U) / RM_STORAGE_BENCHMARK_PERMILLE) | 1U;
+
+    for ( ; ; stride++)
+    {
+        uint32_t a = num_blocks;
+        uint32_t b = stride;
+        while (0U != b)
+        {
+            uint32_t r = a % b;
+            a = b;
+            b = r;
+        }
+
+        if (1U == a)
+        {
+            return stride;
+        }
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Moves a sample down a max-heap of count samples until both children are smaller.
+ **********************************************************************************************************************/
+static void rm_storage_benchmark_sift_down (uint32_t * p_samples, uint32_t root, uint32_t count)
+{
+    for ( ; ; )
+    {
+        uint32_t child = (2U * root) + 1U;
+        if (child >= count)
+        {
+            break;
+        }
+
+        if (((child + 1U) < count) && (p_samples[child + 1U] > p_samples[child]))
+        {
+            child++;
+        }
+
+        if (p_samples[root] >= p_samples[child])
+        {
+            break;
+        }
+
+        uint32_t swap = p_samples[root];
+        p_samples[root]  = p_samples[child];
+        p_samples[child] = swap;
+        root             = child;
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Sorts latency samples in ascending order. Heapsort needs no recursion or extra memory.
+ **********************************************************************************************************************/
+static void rm_storage_benchmark_sort (uint32_t * p_samples, uint32_t count)
+{
+    for (uint32_t i = count / 2U; i > 0U; i--)
+    {
+        rm_storage_benchmark_sift_down(p_samples, i - 1U, count);
+    }
+
+    for (uint32_t end = count; end > 1U; end--)
+    {
+        uint32_t largest = p_samples[0];
+        p_samples[0]       = p_samples[end - 1U];
+        p_samples[end - 1U] = largest;
+        rm_storage_benchmark_sift_down(p_samples, 0U, end - 1U);
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Summarizes latency samples. Percentiles use the nearest rank.
+ **********************************************************************************************************************/
+static void rm_storage_benchmark_latency_get (uint32_t * p_samples, uint32_t count, uint64_t sum_us,
+                                              rm_storage_benchmark_latency_t * p_latency)
+{
+    static const uint16_t permille[] = {500U, 900U, 990U, 999U};
+    uint32_t              values[4];
+
+    if (0U == count)
+    {
+        return;
+    }
+
+    rm_storage_benchmark_sort(p_samples, count);
+
+    for (uint32_t i = 0U; i < (sizeof(permille) / sizeof(permille[0])); i++)
+    {
+        uint32_t rank = (uint32_t) ((((uint64_t) count * permille[i]) + (RM_STORAGE_BENCHMARK_PERMILLE - 1U)) /
+                                    RM_STORAGE_BENCHMARK_PERMILLE);
+        values[i] = p_samples[rank - 1U];
+    }
+
+    p_latency->min_us     = p_samples[0];
+    p_latency->average_us = (uint32_t) (sum_us / count);
+    p_latency->p50_us     = values[0];
+    p_latency->p90_us     = values[1];
+    p_latency->p99_us     = values[2];
+    p_latency->p999_us    = values[3];
+    p_latency->max_us     = p_samples[count - 1U];
+}
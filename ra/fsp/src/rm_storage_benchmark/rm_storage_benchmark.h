@@ -0,0 +1,174 @@
+/***********************************************************************************************************************
+ * Copyright [2020] Renesas Electronics Corporation and/or its affiliates.  All Rights Reserved.
+ *
+ * This software and documentation are supplied by Renesas Electronics America Inc. and may only be used with products
+ * of Renesas Electronics Corp. and its affiliates ("Renesas").  No other uses are authorized.  Renesas products are
+ * sold pursuant to Renesas terms and conditions of sale.  Purchasers are solely responsible for the selection and use
+ * of Renesas products and Renesas assumes no liability.  No license, express or implied, to any intellectual property
+ * right is granted by Renesas. This software is protected under all applicable laws, including copyright laws. Renesas
+ * reserves the right to change or discontinue this software and/or this documentation. THE SOFTWARE AND DOCUMENTATION
+ * IS DELIVERED TO YOU "AS IS," AND RENESAS MAKES NO REPRESENTATIONS OR WARRANTIES, AND TO THE FULLEST EXTENT
+ * PERMISSIBLE UNDER APPLICABLE LAW, DISCLAIMS ALL WARRANTIES, WHETHER EXPLICITLY OR IMPLICITLY, INCLUDING WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, AND NONINFRINGEMENT, WITH RESPECT TO THE SOFTWARE OR
+ * DOCUMENTATION.  RENESAS SHALL HAVE NO LIABILITY ARISING OUT OF ANY SECURITY VULNERABILITY OR BREACH.  TO THE MAXIMUM
+ * EXTENT PERMITTED BY LAW, IN NO EVENT WILL RENESAS BE LIABLE TO YOU IN CONNECTION WITH THE SOFTWARE OR DOCUMENTATION
+ * (OR ANY PERSON OR ENTITY CLAIMING RIGHTS DERIVED FROM YOU) FOR ANY LOSS, DAMAGES, OR CLAIMS WHATSOEVER, INCLUDING,
+ * WITHOUT LIMITATION, ANY DIRECT, CONSEQUENTIAL, SPECIAL, INDIRECT, PUNITIVE, OR INCIDENTAL DAMAGES; ANY LOST PROFITS,
+ * OTHER ECONOMIC DAMAGE, PROPERTY DAMAGE, OR PERSONAL INJURY; AND EVEN IF RENESAS HAS BEEN ADVISED OF THE POSSIBILITY
+ * OF SUCH LOSS, DAMAGES, CLAIMS OR COSTS.
+ **********************************************************************************************************************/
+
+#ifndef RM_STORAGE_BENCHMARK_H
+ #define RM_STORAGE_BENCHMARK_H
+
+/***********************************************************************************************************************
+ * Includes
+ **********************************************************************************************************************/
+ #include "bsp_api.h"
+ #include "rm_block_media_api.h"
+ #include "r_flash_api.h"
+ #include "r_spi_flash_api.h"
+
+/* File system layers are measured only when enabled, since the file systems are optional middleware. */
+ #ifndef RM_STORAGE_BENCHMARK_CFG_FREERTOS_PLUS_FAT_SUPPORT
+  #define RM_STORAGE_BENCHMARK_CFG_FREERTOS_PLUS_FAT_SUPPORT    (0)
+ #endif
+ #ifndef RM_STORAGE_BENCHMARK_CFG_LITTLEFS_SUPPORT
+  #define RM_STORAGE_BENCHMARK_CFG_LITTLEFS_SUPPORT             (0)
+ #endif
+
+ #if RM_STORAGE_BENCHMARK_CFG_LITTLEFS_SUPPORT
+  #include "lfs.h"
+ #endif
+
+/** Common macro for FSP header files. There is also a corresponding FSP_FOOTER macro at the end of this file. */
+FSP_HEADER
+
+/*******************************************************************************************************************//**
+ * @addtogroup RM_STORAGE_BENCHMARK
+ * @{
+ **********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+
+/** Storage layer a target is accessed through. */
+typedef enum e_rm_storage_benchmark_layer
+{
+    RM_STORAGE_BENCHMARK_LAYER_BLOCK_MEDIA,       ///< Block media driver, e.g. rm_block_media_sdmmc or rm_block_media_usb
+    RM_STORAGE_BENCHMARK_LAYER_FLASH,             ///< On-chip data flash through r_flash_hp or r_flash_lp
+    RM_STORAGE_BENCHMARK_LAYER_SPI_FLASH,         ///< External flash through r_qspi or r_ospi
+    RM_STORAGE_BENCHMARK_LAYER_FREERTOS_PLUS_FAT, ///< File on a mounted FreeRTOS+FAT volume
+    RM_STORAGE_BENCHMARK_LAYER_LITTLEFS,          ///< File on a mounted littlefs volume
+} rm_storage_benchmark_layer_t;
+
+/** Order in which a job visits the blocks of the target region. */
+typedef enum e_rm_storage_benchmark_pattern
+{
+    RM_STORAGE_BENCHMARK_PATTERN_SEQUENTIAL, ///< Consecutive blocks
+    RM_STORAGE_BENCHMARK_PATTERN_RANDOM,     ///< Pseudo-random permutation of the blocks
+} rm_storage_benchmark_pattern_t;
+
+/** Storage target. The underlying driver or file system must be opened (and mounted) by the application. Reads and
+ * writes stay inside the region of size bytes starting at offset, which is overwritten by jobs that write. */
+typedef struct st_rm_storage_benchmark_target
+{
+    char const                 * p_name; ///< Label printed in reports, e.g. "sdhi+fat"
+    rm_storage_benchmark_layer_t layer;  ///< Layer the target is accessed through
+    uint32_t offset;                     ///< Start of the region in bytes, a multiple of the block or erase size
+    uint32_t size;                       ///< Size of the region in bytes
+
+    rm_block_media_instance_t const * p_block_media; ///< Block media instance, media initialized (BLOCK_MEDIA)
+    flash_instance_t const          * p_flash;       ///< Flash instance (FLASH)
+    spi_flash_instance_t const      * p_spi_flash;   ///< SPI flash instance (SPI_FLASH)
+
+    /** Memory mapped address of offset 0, read directly: the data flash start address for FLASH, or the QSPI/OSPI
+     * device start address for SPI_FLASH. */
+    uint8_t * p_mapped;
+    uint32_t  erase_size;              ///< Erase unit in bytes (FLASH, SPI_FLASH)
+    uint32_t  program_size;            ///< Largest single program operation in bytes, e.g. the page size (SPI_FLASH)
+
+    char const * p_path;               ///< File path, created and filled before each job (FREERTOS_PLUS_FAT, LITTLEFS)
+ #if RM_STORAGE_BENCHMARK_CFG_LITTLEFS_SUPPORT
+    lfs_t * p_lfs;                     ///< Mounted littlefs volume (LITTLEFS)
+ #endif
+} rm_storage_benchmark_target_t;
+
+/** fio-style job definition. */
+typedef struct st_rm_storage_benchmark_job
+{
+    char const                   * p_name;       ///< Label printed in reports, e.g. "randread-4k"
+    rm_storage_benchmark_pattern_t pattern;      ///< Order of the blocks
+    uint32_t                       block_size;   ///< Bytes per operation
+    uint8_t                        read_percent; ///< Share of reads in percent: 100 reads only, 0 writes only
+    uint32_t                       num_ops;      ///< Number of operations
+    uint32_t                       seed;         ///< Seed of the random block order and read/write mix
+} rm_storage_benchmark_job_t;
+
+/** Latency distribution of one kind of operation, in microseconds. All fields are 0 if no such operation ran. */
+typedef struct st_rm_storage_benchmark_latency
+{
+    uint32_t min_us;
+    uint32_t average_us;
+    uint32_t p50_us;
+    uint32_t p90_us;
+    uint32_t p99_us;
+    uint32_t p999_us;
+    uint32_t max_us;
+} rm_storage_benchmark_latency_t;
+
+/** Measurement of one job on one target. */
+typedef struct st_rm_storage_benchmark_result
+{
+    rm_storage_benchmark_target_t const * p_target;     ///< Target measured
+    rm_storage_benchmark_job_t const    * p_job;        ///< Job run
+    fsp_err_t status;                                   ///< FSP_SUCCESS, or the error that stopped the job
+    uint32_t  reads;                                    ///< Read operations completed
+    uint32_t  writes;                                   ///< Write operations completed
+    uint64_t  bytes;                                    ///< Bytes transferred
+    uint64_t  duration_us;                              ///< Time spent in all operations
+    uint32_t  throughput_kbytes_per_s;                  ///< Bytes per millisecond over duration_us
+    uint32_t  iops;                                     ///< Operations per second over duration_us
+    uint32_t  prepare_us;                               ///< Time to erase the region or create the file, not in duration_us
+    uint32_t  sync_us;                                  ///< Time to close the file after the job, not in duration_us
+    rm_storage_benchmark_latency_t read_latency;        ///< Read latency distribution
+    rm_storage_benchmark_latency_t write_latency;       ///< Write latency distribution
+    void const * p_context;                             ///< User defined context passed in the configuration
+} rm_storage_benchmark_result_t;
+
+/** Benchmark configuration. Every job is run on every target, in order. */
+typedef struct st_rm_storage_benchmark_cfg
+{
+    rm_storage_benchmark_target_t const * p_targets; ///< Targets to measure
+    uint32_t num_targets;                            ///< Number of entries in p_targets
+    rm_storage_benchmark_job_t const * p_jobs;       ///< Jobs to run
+    uint32_t num_jobs;                               ///< Number of entries in p_jobs
+
+    uint8_t  * p_buffer;               ///< Data buffer of at least the largest block size, word aligned
+    uint32_t   buffer_size;            ///< Size of p_buffer in bytes
+    uint32_t * p_latencies;            ///< One latency sample per operation of the largest job
+    uint32_t   num_latencies;          ///< Number of entries in p_latencies
+    bsp_cycle_counter_get_t p_cycles_get; ///< Cycle counter, NULL to use the DWT cycle counter
+
+    /** Called with each measurement. */
+    void (* p_callback)(rm_storage_benchmark_result_t const * p_result);
+    void const * p_context;            ///< Placeholder for user data, passed back in each result
+} rm_storage_benchmark_cfg_t;
+
+/**********************************************************************************************************************
+ * Public Function Prototypes
+ **********************************************************************************************************************/
+fsp_err_t RM_STORAGE_BENCHMARK_Run(rm_storage_benchmark_cfg_t const * const p_cfg);
+int32_t   RM_STORAGE_BENCHMARK_Format(rm_storage_benchmark_result_t const * const p_result,
+                                      char * const                                p_line,
+                                      uint32_t                                    line_size);
+
+/*******************************************************************************************************************//**
+ * @} (end addtogroup RM_STORAGE_BENCHMARK)
+ **********************************************************************************************************************/
+
+/** Common macro for FSP header files. There is also a corresponding FSP_HEADER macro at the top of this file. */
+FSP_FOOTER
+
+#endif                                 /* RM_STORAGE_BENCHMARK_H */
@@ -0,0 +1,166 @@
+/***********************************************************************************************************************
+ * Copyright [2020] Renesas Electronics Corporation and/or its affiliates.  All Rights Reserved.
+ *
+ * This software and documentation are supplied by Renesas Electronics America Inc. and may only be used with products
+ * of Renesas Electronics Corp. and its affiliates ("Renesas").  No other uses are authorized.  Renesas products are
+ * sold pursuant to Renesas terms and conditions of sale.  Purchasers are solely responsible for the selection and use
+ * of Renesas products and Renesas assumes no liability.  No license, express or implied, to any intellectual property
+ * right is granted by Renesas. This software is protected under all applicable laws, including copyright laws. Renesas
+ * reserves the right to change or discontinue this software and/or this documentation. THE SOFTWARE AND DOCUMENTATION
+ * IS DELIVERED TO YOU "AS IS," AND RENESAS MAKES NO REPRESENTATIONS OR WARRANTIES, AND TO THE FULLEST EXTENT
+ * PERMISSIBLE UNDER APPLICABLE LAW, DISCLAIMS ALL WARRANTIES, WHETHER EXPLICITLY OR IMPLICITLY, INCLUDING WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, AND NONINFRINGEMENT, WITH RESPECT TO THE SOFTWARE OR
+ * DOCUMENTATION.  RENESAS SHALL HAVE NO LIABILITY ARISING OUT OF ANY SECURITY VULNERABILITY OR BREACH.  TO THE MAXIMUM
+ * EXTENT PERMITTED BY LAW, IN NO EVENT WILL RENESAS BE LIABLE TO YOU IN CONNECTION WITH THE SOFTWARE OR DOCUMENTATION
+ * (OR ANY PERSON OR ENTITY CLAIMING RIGHTS DERIVED FROM YOU) FOR ANY LOSS, DAMAGES, OR CLAIMS WHATSOEVER, INCLUDING,
+ * WITHOUT LIMITATION, ANY DIRECT, CONSEQUENTIAL, SPECIAL, INDIRECT, PUNITIVE, OR INCIDENTAL DAMAGES; ANY LOST PROFITS,
+ * OTHER ECONOMIC DAMAGE, PROPERTY DAMAGE, OR PERSONAL INJURY; AND EVEN IF RENESAS HAS BEEN ADVISED OF THE POSSIBILITY
+ * OF SUCH LOSS, DAMAGES, CLAIMS OR COSTS.
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Includes
+ **********************************************************************************************************************/
+#include "boot_crypto.h"
+#include "bsp_api.h"
+#include "Driver_Common.h"
+#include "flash_layout.h"
+
+#if !defined(MBEDTLS_CONFIG_FILE)
+ #include "mbedtls/config.h"
+#else
+ #include MBEDTLS_CONFIG_FILE
+#endif
+#include "mbedtls/sha256.h"
+#include "mbedtls/pk.h"
+#include "mbedtls/rsa.h"
+
+/***********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+
+/* MCUboot signs RSA-PSS images with a salt as long as the hash. */
+#define BOOT_CRYPTO_PRV_PSS_SALT_LEN    (BOOT_CRYPTO_HASH_SIZE)
+
+/***********************************************************************************************************************
+ * Functions
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * Hashes an image in code flash with SHA-256 for the MCUboot image hash TLV.
+ *
+ * The image is hashed where it is mapped in code flash instead of being read through the flash driver into a small
+ * buffer. With MBEDTLS_SHA256_PROCESS_ALT, every whole block of the image goes to the SCE in one call, so the SCE
+ * state is loaded and stored once and the CPU reads the image sequentially through the flash cache.
+ *
+ * @param[in]  p_seed          Optional seed hashed before the image (MCUBOOT_ENC_IMAGES nonce), NULL if not used.
+ * @param[in]  seed_len        Size of the seed in bytes.
+ * @param[in]  image_offset    Offset of the image header in code flash.
+ * @param[in]  image_len       Bytes hashed: header, image and protected TLV area.
+ * @param[out] hash            SHA-256 of the seed and the image.
+ *
+ * @retval     0                             Hash calculated.
+ * @retval     ARM_DRIVER_ERROR_PARAMETER    The image is outside the code flash.
+ * @return     mbedTLS error code of the SHA-256 functions otherwise.
+ **********************************************************************************************************************/
+int32_t boot_crypto_image_hash (uint8_t const * p_seed,
+                                size_t          seed_len,
+                                uint32_t        image_offset,
+                                uint32_t        image_len,
+                                uint8_t         hash[BOOT_CRYPTO_HASH_SIZE])
+{
+    if ((image_offset > FLASH_TOTAL_SIZE) || (image_len > (FLASH_TOTAL_SIZE - image_offset)))
+    {
+        return ARM_DRIVER_ERROR_PARAMETER;
+    }
+
+    /* The flash cache is enabled by the BSP on MCUs with code flash running at high speed. Enable it here as well so
+     * the sequential reads of the hash are served by cache line fills. */
+    if (0U == R_FCACHE->FCACHEE)
+    {
+        R_BSP_FlashCacheEnable();
+    }
+
+    mbedtls_sha256_context ctx;
+    mbedtls_sha256_init(&ctx);
+
+    int32_t result = mbedtls_sha256_starts_ret(&ctx, 0);
+
+    if ((0 == result) && (NULL != p_seed) && (0U != seed_len))
+    {
+        result = mbedtls_sha256_update_ret(&ctx, p_seed, seed_len);
+    }
+
+    if (0 == result)
+    {
+        result = mbedtls_sha256_update_ret(&ctx, (uint8_t const *) (FLASH_BASE_ADDRESS + image_offset), image_len);
+    }
+
+    if (0 == result)
+    {
+        result = mbedtls_sha256_finish_ret(&ctx, hash);
+    }
+
+    mbedtls_sha256_free(&ctx);
+
+    return result;
+}
+
+/*******************************************************************************************************************//**
+ * Verifies the signature TLV of an image against its hash.
+ *
+ * The public key is parsed from the DER SubjectPublicKeyInfo MCUboot embeds in BL2. The verification runs on the SCE
+ * through MBEDTLS_ECDSA_VERIFY_ALT and MBEDTLS_RSA_ALT when they are enabled in the BL2 mbedTLS configuration.
+ *
+ * @param[in]  sig_type        Signature scheme.
+ * @param[in]  p_key           DER encoded public key.
+ * @param[in]  key_len         Size of the key in bytes.
+ * @param[in]  hash            SHA-256 of the image, from boot_crypto_image_hash().
+ * @param[in]  p_sig           Signature TLV value.
+ * @param[in]  sig_len         Size of the signature in bytes.
+ *
+ * @retval     0                             Signature is valid.
+ * @retval     ARM_DRIVER_ERROR_PARAMETER    The key does not match sig_type.
+ * @return     mbedTLS error code of the PK functions otherwise, including MBEDTLS_ERR_ECP_VERIFY_FAILED and
+ *             MBEDTLS_ERR_RSA_VERIFY_FAILED for an invalid signature.
+ **********************************************************************************************************************/
+int32_t boot_crypto_signature_verify (boot_crypto_sig_t sig_type,
+                                      uint8_t const   * p_key,
+                                      size_t            key_len,
+                                      uint8_t const     hash[BOOT_CRYPTO_HASH_SIZE],
+                                      uint8_t const   * p_sig,
+                                      size_t            sig_len)
+{
+    mbedtls_pk_context pk;
+    mbedtls_pk_init(&pk);
+
+    int32_t result = mbedtls_pk_parse_public_key(&pk, p_key, key_len);
+
+    if (0 == result)
+    {
+        if ((BOOT_CRYPTO_SIG_ECDSA_P256 == sig_type) && mbedtls_pk_can_do(&pk, MBEDTLS_PK_ECDSA) &&
+            (MBEDTLS_ECP_DP_SECP256R1 == mbedtls_pk_ec(pk)->grp.id))
+        {
+            result = mbedtls_pk_verify(&pk, MBEDTLS_MD_SHA256, hash, BOOT_CRYPTO_HASH_SIZE, p_sig, sig_len);
+        }
+        else if ((BOOT_CRYPTO_SIG_RSA_PSS == sig_type) && mbedtls_pk_can_do(&pk, MBEDTLS_PK_RSA))
+        {
+            mbedtls_pk_rsassa_pss_options options =
+            {
+                .mgf1_hash_id      = MBEDTLS_MD_SHA256,
+                .expected_salt_len = BOOT_CRYPTO_PRV_PSS_SALT_LEN
+            };
+
+            result = mbedtls_pk_verify_ext(MBEDTLS_PK_RSASSA_PSS, &options, &pk, MBEDTLS_MD_SHA256, hash,
+                                           BOOT_CRYPTO_HASH_SIZE, p_sig, sig_len);
+        }
+        else
+        {
+            result = ARM_DRIVER_ERROR_PARAMETER;
+        }
+    }
+
+    mbedtls_pk_free(&pk);
+
+    return result;
+}
@@ -19,11 +19,24 @@
 #include "platform/include/tfm_plat_crypto_keys.h"
 #include "platform/include/tfm_attest_hal.h"
 #include <stddef.h>
+#include <string.h>
 #include "psa/crypto_types.h"
 #include "crypto_spe.h"
 #include "tfm_plat_defs.h"
 
-#define SHA256_LEN_BYTES    32
+#define SHA256_LEN_BYTES                  32
+
+/* Derived keys cached by label. Labels longer than the maximum are derived on every request. */
+#define DERIVED_KEY_CACHE_ENTRIES         4
+#define DERIVED_KEY_CACHE_LABEL_SIZE_MAX  32
+
+/* Cached derivation of one label. */
+typedef struct derived_key_cache_entry
+{
+    size_t  label_size;                              /* Size of label, 0 if the entry is unused */
+    uint8_t label[DERIVED_KEY_CACHE_LABEL_SIZE_MAX];
+    uint8_t hash[SHA256_LEN_BYTES];                  /* Derivation output, truncated to the requested key size */
+} derived_key_cache_entry_t;
 
 extern const psa_ecc_curve_t initial_attestation_curve_type;
 extern const uint8_t         initial_attestation_private_key[];
@@ -43,6 +56,13 @@ const uint8_t tfm_huk_key[] =
 TFM_LINK_SET_RO_IN_PARTITION_SECTION("TFM_SP_CRYPTO")
 const uint32_t tfm_huk_key_size = sizeof(tfm_huk_key);
 
+/* Derived keys are kept in the memory of the crypto partition only. Entries are replaced round robin. */
+TFM_LINK_SET_ZI_IN_PARTITION_SECTION("TFM_SP_CRYPTO")
+static derived_key_cache_entry_t derived_key_cache[DERIVED_KEY_CACHE_ENTRIES];
+
+TFM_LINK_SET_ZI_IN_PARTITION_SECTION("TFM_SP_CRYPTO")
+static uint32_t derived_key_cache_next;
+
 /**
  * \brief Copy the key to the destination buffer
  *
@@ -69,8 +89,6 @@ enum tfm_plat_err_t tfm_plat_get_huk_derived_key (const uint8_t * label,
                                                   uint8_t       * key,
                                                   size_t          key_size)
 {
-    (void) label;
-    (void) label_size;
     (void) context;
     (void) context_size;
     psa_algorithm_t      alg                    = PSA_ALG_SHA_256;
@@ -84,6 +102,23 @@ enum tfm_plat_err_t tfm_plat_get_huk_derived_key (const uint8_t * label,
         return TFM_PLAT_ERR_SYSTEM_ERR;
     }
 
+    /* The derivation only depends on the label, so a key derived before can be returned without hashing the HUK. */
+    if (label_size <= DERIVED_KEY_CACHE_LABEL_SIZE_MAX)
+    {
+        for (uint32_t i = 0; i < DERIVED_KEY_CACHE_ENTRIES; i++)
+        {
+            derived_key_cache_entry_t * p_entry = &derived_key_cache[i];
+
+            if ((0U != p_entry->label_size) && (label_size == p_entry->label_size) &&
+                (0 == memcmp(p_entry->label, label, label_size)))
+            {
+                copy_key(key, &p_entry->hash[0], key_size);
+
+                return TFM_PLAT_ERR_SUCCESS;
+            }
+        }
+    }
+
     if (PSA_SUCCESS != psa_hash_setup(&operation, alg))
     {
         return TFM_PLAT_ERR_SYSTEM_ERR;
@@ -113,6 +148,21 @@ enum tfm_plat_err_t tfm_plat_get_huk_derived_key (const uint8_t * label,
 
     copy_key(key, &hash[0], key_size);
 
+    /* An empty label cannot be told apart from an unused entry and is not cached. */
+    if ((0U != label_size) && (label_size <= DERIVED_KEY_CACHE_LABEL_SIZE_MAX))
+    {
+        derived_key_cache_entry_t * p_entry = &derived_key_cache[derived_key_cache_next];
+
+        copy_key(&p_entry->label[0], label, label_size);
+        copy_key(&p_entry->hash[0], &hash[0], sizeof(hash));
+        p_entry->label_size = label_size;
+
+        derived_key_cache_next = (derived_key_cache_next + 1U) % DERIVED_KEY_CACHE_ENTRIES;
+    }
+
+    /* Do not leave key material on the stack. */
+    memset(&hash[0], 0, sizeof(hash));
+
     return TFM_PLAT_ERR_SUCCESS;
 }
 
@@ -0,0 +1,50 @@
+/***********************************************************************************************************************
+ * Copyright [2020] Renesas Electronics Corporation and/or its affiliates.  All Rights Reserved.
+ *
+ * This software and documentation are supplied by Renesas Electronics America Inc. and may only be used with products
+ * of Renesas Electronics Corp. and its affiliates ("Renesas").  No other uses are authorized.  Renesas products are
+ * sold pursuant to Renesas terms and conditions of sale.  Purchasers are solely responsible for the selection and use
+ * of Renesas products and Renesas assumes no liability.  No license, express or implied, to any intellectual property
+ * right is granted by Renesas. This software is protected under all applicable laws, including copyright laws. Renesas
+ * reserves the right to change or discontinue this software and/or this documentation. THE SOFTWARE AND DOCUMENTATION
+ * IS DELIVERED TO YOU "AS IS," AND RENESAS MAKES NO REPRESENTATIONS OR WARRANTIES, AND TO THE FULLEST EXTENT
+ * PERMISSIBLE UNDER APPLICABLE LAW, DISCLAIMS ALL WARRANTIES, WHETHER EXPLICITLY OR IMPLICITLY, INCLUDING WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, AND NONINFRINGEMENT, WITH RESPECT TO THE SOFTWARE OR
+ * DOCUMENTATION.  RENESAS SHALL HAVE NO LIABILITY ARISING OUT OF ANY SECURITY VULNERABILITY OR BREACH.  TO THE MAXIMUM
+ * EXTENT PERMITTED BY LAW, IN NO EVENT WILL RENESAS BE LIABLE TO YOU IN CONNECTION WITH THE SOFTWARE OR DOCUMENTATION
+ * (OR ANY PERSON OR ENTITY CLAIMING RIGHTS DERIVED FROM YOU) FOR ANY LOSS, DAMAGES, OR CLAIMS WHATSOEVER, INCLUDING,
+ * WITHOUT LIMITATION, ANY DIRECT, CONSEQUENTIAL, SPECIAL, INDIRECT, PUNITIVE, OR INCIDENTAL DAMAGES; ANY LOST PROFITS,
+ * OTHER ECONOMIC DAMAGE, PROPERTY DAMAGE, OR PERSONAL INJURY; AND EVEN IF RENESAS HAS BEEN ADVISED OF THE POSSIBILITY
+ * OF SUCH LOSS, DAMAGES, CLAIMS OR COSTS.
+ **********************************************************************************************************************/
+
+#ifndef BOOT_CRYPTO_H
+#define BOOT_CRYPTO_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* Size of the SHA-256 image hash. */
+#define BOOT_CRYPTO_HASH_SIZE    (32U)
+
+/* Signature schemes of the MCUboot signature TLVs. */
+typedef enum e_boot_crypto_sig
+{
+    BOOT_CRYPTO_SIG_ECDSA_P256 = 0,    // IMAGE_TLV_ECDSA256: DER encoded ECDSA P-256 signature
+    BOOT_CRYPTO_SIG_RSA_PSS    = 1,    // IMAGE_TLV_RSA2048_PSS / IMAGE_TLV_RSA3072_PSS: RSASSA-PSS with SHA-256
+} boot_crypto_sig_t;
+
+int32_t boot_crypto_image_hash(uint8_t const * p_seed,
+                               size_t          seed_len,
+                               uint32_t        image_offset,
+                               uint32_t        image_len,
+                               uint8_t         hash[BOOT_CRYPTO_HASH_SIZE]);
+
+int32_t boot_crypto_signature_verify(boot_crypto_sig_t sig_type,
+                                     uint8_t const   * p_key,
+                                     size_t            key_len,
+                                     uint8_t const     hash[BOOT_CRYPTO_HASH_SIZE],
+                                     uint8_t const   * p_sig,
+                                     size_t            sig_len);
+
+#endif /* BOOT_CRYPTO_H */
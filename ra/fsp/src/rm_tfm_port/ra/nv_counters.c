@@ -23,6 +23,7 @@
 #include "platform/include/tfm_plat_nv_counters.h"
 
 #include <limits.h>
+#include <string.h>
 #include "Driver_Flash.h"
 #include "flash_layout.h"
 
@@ -62,42 +63,97 @@ struct nv_counters_t {
                           */
 };
 
+/**
+ * \brief RAM shadow of the NV counter area.
+ *
+ * Reads are served from the shadow, the flash is only accessed when a counter
+ * is set. Each shadow word is stored with its complement, and a shadow that
+ * does not verify is reloaded from flash.
+ */
+struct nv_counters_shadow_t {
+    struct nv_counters_t data;          /**< Copy of the NV counter area    */
+    uint32_t inv[NUM_NV_COUNTERS];      /**< Complement of data.counters    */
+    uint32_t valid;                     /**< NV_COUNTERS_INITIALIZED once
+                                         *   the shadow has been loaded
+                                         */
+};
+
 /* Import the CMSIS flash device driver */
 extern ARM_DRIVER_FLASH Driver_DFLASH;
 
-enum tfm_plat_err_t tfm_plat_init_nv_counter(void)
+static struct nv_counters_shadow_t nv_counters_shadow;
+
+static void nv_counters_shadow_update(const struct nv_counters_t *nv_counters)
+{
+    uint32_t i;
+
+    nv_counters_shadow.data = *nv_counters;
+
+    for (i = 0; i < NUM_NV_COUNTERS; i++) {
+        nv_counters_shadow.inv[i] = ~nv_counters->counters[i];
+    }
+
+    nv_counters_shadow.valid = NV_COUNTERS_INITIALIZED;
+}
+
+static void nv_counters_shadow_invalidate(void)
+{
+    nv_counters_shadow.valid = 0;
+}
+
+/**
+ * \brief Makes sure the shadow holds a verified copy of the NV counter area.
+ *
+ * \return TFM_PLAT_ERR_SUCCESS if the shadow can be used, an error otherwise.
+ */
+static enum tfm_plat_err_t nv_counters_shadow_load(void)
 {
     int32_t err;
     uint32_t i;
     struct nv_counters_t nv_counters = {{0}, 0};
 
-    err = Driver_DFLASH.Initialize(NULL);
-    if (err != ARM_DRIVER_OK) {
-        return TFM_PLAT_ERR_SYSTEM_ERR;
+    if (nv_counters_shadow.valid == NV_COUNTERS_INITIALIZED) {
+        for (i = 0; i < NUM_NV_COUNTERS; i++) {
+            if (nv_counters_shadow.data.counters[i] !=
+                ~nv_counters_shadow.inv[i]) {
+                break;
+            }
+        }
+
+        if (i == NUM_NV_COUNTERS) {
+            return TFM_PLAT_ERR_SUCCESS;
+        }
     }
 
-    /* Read the NV counter area to be able to erase the sector and write later
-     * in the flash.
-     */
     err = Driver_DFLASH.ReadData(TFM_NV_COUNTERS_AREA_ADDR, &nv_counters,
                                   TFM_NV_COUNTERS_AREA_SIZE);
     if (err != ARM_DRIVER_OK) {
+        nv_counters_shadow_invalidate();
         return TFM_PLAT_ERR_SYSTEM_ERR;
     }
 
-    if (nv_counters.init_value == NV_COUNTERS_INITIALIZED) {
-        return TFM_PLAT_ERR_SUCCESS;
-    }
+    nv_counters_shadow_update(&nv_counters);
 
-    /* Add watermark, at the end of the NV counters area, to indicate that NV
-     * counters have been initialized.
-     */
-    nv_counters.init_value = NV_COUNTERS_INITIALIZED;
+    return TFM_PLAT_ERR_SUCCESS;
+}
 
-    /* Initialize all counters to 0 */
-    for (i = 0; i < NUM_NV_COUNTERS; i++) {
-        nv_counters.counters[i] = 0;
-    }
+/**
+ * \brief Programs the NV counter area and updates the shadow once the flash
+ *        content has been read back and matches.
+ *
+ * \param[in] nv_counters  New content of the NV counter area
+ *
+ * \return TFM_PLAT_ERR_SUCCESS if the flash has been programmed, an error
+ *         otherwise.
+ */
+static enum tfm_plat_err_t nv_counters_program(
+                                      const struct nv_counters_t *nv_counters)
+{
+    int32_t err;
+    struct nv_counters_t read_back = {{0}, 0};
+
+    /* The flash content is unknown until it has been read back. */
+    nv_counters_shadow_invalidate();
 
     /* Erase sector before write in it */
     err = Driver_DFLASH.EraseSector(TFM_NV_COUNTERS_SECTOR_ADDR);
@@ -106,50 +162,104 @@ enum tfm_plat_err_t tfm_plat_init_nv_counter(void)
     }
 
     /* Write in flash the in-memory NV counter content after modification */
-    err = Driver_DFLASH.ProgramData(TFM_NV_COUNTERS_AREA_ADDR, &nv_counters,
+    err = Driver_DFLASH.ProgramData(TFM_NV_COUNTERS_AREA_ADDR, nv_counters,
                                      TFM_NV_COUNTERS_AREA_SIZE);
     if (err != ARM_DRIVER_OK) {
         return TFM_PLAT_ERR_SYSTEM_ERR;
     }
 
+    err = Driver_DFLASH.ReadData(TFM_NV_COUNTERS_AREA_ADDR, &read_back,
+                                  TFM_NV_COUNTERS_AREA_SIZE);
+    if (err != ARM_DRIVER_OK) {
+        return TFM_PLAT_ERR_SYSTEM_ERR;
+    }
+
+    if (memcmp(&read_back, nv_counters, TFM_NV_COUNTERS_AREA_SIZE) != 0) {
+        return TFM_PLAT_ERR_SYSTEM_ERR;
+    }
+
+    nv_counters_shadow_update(&read_back);
+
     return TFM_PLAT_ERR_SUCCESS;
 }
 
-enum tfm_plat_err_t tfm_plat_read_nv_counter(enum tfm_nv_counter_t counter_id,
-                                             uint32_t size, uint8_t *val)
+enum tfm_plat_err_t tfm_plat_init_nv_counter(void)
 {
-    int32_t  err;
-    uint32_t flash_addr;
+    int32_t err;
+    uint32_t i;
+    struct nv_counters_t nv_counters = {{0}, 0};
 
-    if (size != NV_COUNTER_SIZE) {
+    err = Driver_DFLASH.Initialize(NULL);
+    if (err != ARM_DRIVER_OK) {
         return TFM_PLAT_ERR_SYSTEM_ERR;
     }
 
-    flash_addr = TFM_NV_COUNTERS_AREA_ADDR + (counter_id * NV_COUNTER_SIZE);
+    /* Load the shadow from the NV counter area. It also provides the content
+     * to write back after the sector has been erased.
+     */
+    nv_counters_shadow_invalidate();
+    if (nv_counters_shadow_load() != TFM_PLAT_ERR_SUCCESS) {
+        return TFM_PLAT_ERR_SYSTEM_ERR;
+    }
 
-    err = Driver_DFLASH.ReadData(flash_addr, val, NV_COUNTER_SIZE);
-    if (err != ARM_DRIVER_OK) {
+    if (nv_counters_shadow.data.init_value == NV_COUNTERS_INITIALIZED) {
+        return TFM_PLAT_ERR_SUCCESS;
+    }
+
+    /* Add watermark, at the end of the NV counters area, to indicate that NV
+     * counters have been initialized.
+     */
+    nv_counters.init_value = NV_COUNTERS_INITIALIZED;
+
+    /* Initialize all counters to 0 */
+    for (i = 0; i < NUM_NV_COUNTERS; i++) {
+        nv_counters.counters[i] = 0;
+    }
+
+    return nv_counters_program(&nv_counters);
+}
+
+enum tfm_plat_err_t tfm_plat_read_nv_counter(enum tfm_nv_counter_t counter_id,
+                                             uint32_t size, uint8_t *val)
+{
+    enum tfm_plat_err_t err;
+
+    if ((size != NV_COUNTER_SIZE) ||
+        ((uint32_t)counter_id >= NUM_NV_COUNTERS)) {
         return TFM_PLAT_ERR_SYSTEM_ERR;
     }
 
+    err = nv_counters_shadow_load();
+    if (err != TFM_PLAT_ERR_SUCCESS) {
+        return err;
+    }
+
+    memcpy(val, &nv_counters_shadow.data.counters[counter_id],
+           NV_COUNTER_SIZE);
+
     return TFM_PLAT_ERR_SUCCESS;
 }
 
 enum tfm_plat_err_t tfm_plat_set_nv_counter(enum tfm_nv_counter_t counter_id,
                                             uint32_t value)
 {
-    int32_t err;
-    struct nv_counters_t nv_counters = {{0}, 0};
+    enum tfm_plat_err_t err;
+    struct nv_counters_t nv_counters;
 
-    /* Read the NV counter area to be able to erase the sector and write later
-     * in the flash.
-     */
-    err = Driver_DFLASH.ReadData(TFM_NV_COUNTERS_AREA_ADDR, &nv_counters,
-                                  TFM_NV_COUNTERS_AREA_SIZE);
-    if (err != ARM_DRIVER_OK) {
+    if ((uint32_t)counter_id >= NUM_NV_COUNTERS) {
         return TFM_PLAT_ERR_SYSTEM_ERR;
     }
 
+    /* The shadow provides the content to write back after the sector has been
+     * erased.
+     */
+    err = nv_counters_shadow_load();
+    if (err != TFM_PLAT_ERR_SUCCESS) {
+        return err;
+    }
+
+    nv_counters = nv_counters_shadow.data;
+
     if (value != nv_counters.counters[counter_id]) {
 
         if (value > nv_counters.counters[counter_id]) {
@@ -158,19 +268,7 @@ enum tfm_plat_err_t tfm_plat_set_nv_counter(enum tfm_nv_counter_t counter_id,
             return TFM_PLAT_ERR_INVALID_INPUT;
         }
 
-        /* Erase sector before write in it */
-        err = Driver_DFLASH.EraseSector(TFM_NV_COUNTERS_SECTOR_ADDR);
-        if (err != ARM_DRIVER_OK) {
-            return TFM_PLAT_ERR_SYSTEM_ERR;
-        }
-
-        /* Write in flash the in-memory NV counter content after modification */
-        err = Driver_DFLASH.ProgramData(TFM_NV_COUNTERS_AREA_ADDR,
-                                         &nv_counters,
-                                         TFM_NV_COUNTERS_AREA_SIZE);
-        if (err != ARM_DRIVER_OK) {
-            return TFM_PLAT_ERR_SYSTEM_ERR;
-        }
+        return nv_counters_program(&nv_counters);
     }
 
     return TFM_PLAT_ERR_SUCCESS;
@@ -48,6 +48,14 @@
 #define TOUCH_WHEEL_RESOLUTION                (360)
 #define TOUCH_DECIMAL_POINT_PRECISION         (100)
 
+/* Compile-time binding of the CTSU instance. Define TOUCH_CFG_CTSU_BINDING as R_CTSU_ to call the CTSU driver directly
+ * instead of through its p_api table on the scan and data paths. */
+#ifdef TOUCH_CFG_CTSU_BINDING
+ #define TOUCH_PRV_CTSU_API(p_instance, member, function)    FSP_API_DIRECT(TOUCH_CFG_CTSU_BINDING, function)
+#else
+ #define TOUCH_PRV_CTSU_API(p_instance, member, function)    ((p_instance)->p_api->member)
+#endif
+
 #if TOUCH_CFG_MONITOR_ENABLE
  #define TOUCH_MONITOR_BLOCK_MAX              (8)
  #define TOUCH_MONITOR_HEADER_SIZE            (4)
@@ -174,12 +182,16 @@
  * Private function prototypes
  **********************************************************************************************************************/
 #if (TOUCH_CFG_NUM_BUTTONS != 0)
- #if (CTSU_CFG_NUM_SELF_ELEMENTS != 0)
-static void touch_button_self_decode(touch_button_info_t * p_binfo, uint16_t value, uint8_t button_id);
+static void     touch_button_decode(touch_instance_ctrl_t * const p_instance_ctrl, uint16_t const * p_data);
+static uint32_t touch_button_judge_pair(uint32_t reference,
+                                        uint32_t threshold,
+                                        uint32_t hysteresis,
+                                        uint32_t value,
+                                        bool     mutual);
 
- #endif
- #if (CTSU_CFG_NUM_MUTUAL_ELEMENTS != 0)
-static void touch_button_mutual_decode(touch_button_info_t * p_binfo, uint16_t value, uint8_t button_id);
+ #if !(defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1))
+static uint32_t touch_button_judge(uint32_t reference, uint32_t threshold, uint32_t hysteresis, uint32_t value,
+                                   bool mutual);
 
  #endif
 static void touch_button_on(touch_button_info_t * p_binfo, uint16_t value, uint8_t button_id);
@@ -555,7 +567,8 @@ fsp_err_t RM_TOUCH_ScanStart (touch_ctrl_t * const p_ctrl)
     TOUCH_ERROR_RETURN(TOUCH_OPEN == p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
 #endif
 
-    err = p_instance_ctrl->p_ctsu_instance->p_api->scanStart(p_instance_ctrl->p_ctsu_instance->p_ctrl);
+    err = TOUCH_PRV_CTSU_API(p_instance_ctrl->p_ctsu_instance, scanStart, ScanStart) (
+        p_instance_ctrl->p_ctsu_instance->p_ctrl);
     FSP_ERROR_RETURN(FSP_ERR_CTSU_SCANNING != err, FSP_ERR_CTSU_SCANNING);
     FSP_ERROR_RETURN(FSP_ERR_CTSU_NOT_GET_DATA != err, FSP_ERR_CTSU_NOT_GET_DATA);
 
@@ -582,12 +595,9 @@ fsp_err_t RM_TOUCH_DataGet (touch_ctrl_t * const p_ctrl,
     fsp_err_t               err             = FSP_SUCCESS;
     touch_instance_ctrl_t * p_instance_ctrl = (touch_instance_ctrl_t *) p_ctrl;
     uint16_t                data[CTSU_CFG_NUM_SELF_ELEMENTS + (CTSU_CFG_NUM_MUTUAL_ELEMENTS * 2)];
-#if ((TOUCH_CFG_NUM_BUTTONS != 0) || (TOUCH_CFG_NUM_SLIDERS != 0) || (TOUCH_CFG_NUM_WHEELS != 0))
+#if ((TOUCH_CFG_NUM_SLIDERS != 0) || (TOUCH_CFG_NUM_WHEELS != 0))
     uint16_t sensor_val = 0;
 #endif
-#if (TOUCH_CFG_NUM_BUTTONS != 0)
-    uint8_t button_id;
-#endif
 #if (TOUCH_CFG_NUM_SLIDERS != 0)
     const touch_slider_cfg_t * p_slider;
     uint8_t  slider_id;
@@ -622,50 +632,14 @@ fsp_err_t RM_TOUCH_DataGet (touch_ctrl_t * const p_ctrl,
 #endif
 
     /* get results from previous scan */
-    err = p_instance_ctrl->p_ctsu_instance->p_api->dataGet(p_instance_ctrl->p_ctsu_instance->p_ctrl, data);
+    err = TOUCH_PRV_CTSU_API(p_instance_ctrl->p_ctsu_instance, dataGet, DataGet) (
+        p_instance_ctrl->p_ctsu_instance->p_ctrl,
+        data);
     FSP_ERROR_RETURN(FSP_ERR_CTSU_SCANNING != err, FSP_ERR_CTSU_SCANNING);
     FSP_ERROR_RETURN(FSP_ERR_CTSU_INCOMPLETE_TUNING != err, FSP_ERR_CTSU_INCOMPLETE_TUNING);
 
 #if (TOUCH_CFG_NUM_BUTTONS != 0)
-    for (button_id = 0; button_id < p_instance_ctrl->p_touch_cfg->num_buttons; button_id++)
-    {
- #if (CTSU_CFG_NUM_SELF_ELEMENTS != 0)
-        if (CTSU_MODE_SELF_MULTI_SCAN == p_instance_ctrl->p_ctsu_instance->p_cfg->md)
-        {
-            sensor_val = *(data + p_instance_ctrl->p_touch_cfg->p_buttons[button_id].elem_index);
-        }
- #endif
- #if (CTSU_CFG_NUM_MUTUAL_ELEMENTS != 0)
-        if (CTSU_MODE_MUTUAL_FULL_SCAN == (CTSU_MODE_MUTUAL_FULL_SCAN & p_instance_ctrl->p_ctsu_instance->p_cfg->md))
-        {
-            /* The value of Primary count minus secondary count */
-            sensor_val = (uint16_t) (*(data + (p_instance_ctrl->p_touch_cfg->p_buttons[button_id].elem_index * 2) + 1) -
-                                     *(data + (p_instance_ctrl->p_touch_cfg->p_buttons[button_id].elem_index * 2)));
-        }
- #endif
-        if (0 == *(p_instance_ctrl->binfo.p_reference + button_id))
-        {
-            *(p_instance_ctrl->binfo.p_reference + button_id) = sensor_val;
-        }
-        else
-        {
-            /* Create button status */
- #if (CTSU_CFG_NUM_SELF_ELEMENTS != 0)
-            if (CTSU_MODE_SELF_MULTI_SCAN == p_instance_ctrl->p_ctsu_instance->p_cfg->md)
-            {
-                touch_button_self_decode(&p_instance_ctrl->binfo, sensor_val, button_id);
-            }
- #endif
- #if (CTSU_CFG_NUM_MUTUAL_ELEMENTS != 0)
-            if (CTSU_MODE_MUTUAL_FULL_SCAN ==
-                (CTSU_MODE_MUTUAL_FULL_SCAN & p_instance_ctrl->p_ctsu_instance->p_cfg->md))
-            {
-                touch_button_mutual_decode(&p_instance_ctrl->binfo, sensor_val, button_id);
-            }
- #endif
-            touch_button_drift(&p_instance_ctrl->binfo, sensor_val, button_id);
-        }
-    }
+    touch_button_decode(p_instance_ctrl, data);
 
     /** status is 64-bitmap */
     *p_button_status = p_instance_ctrl->binfo.status;
@@ -909,7 +883,9 @@ fsp_err_t RM_TOUCH_PadDataGet (touch_ctrl_t * const p_ctrl,
     pitch_y = (uint16_t) (*(p_instance_ctrl->pinfo.p_tx_pixel) / num_y);
 
     /* Data get */
-    err = p_instance_ctrl->p_ctsu_instance->p_api->dataGet(p_instance_ctrl->p_ctsu_instance->p_ctrl, pad_buf);
+    err = TOUCH_PRV_CTSU_API(p_instance_ctrl->p_ctsu_instance, dataGet, DataGet) (
+        p_instance_ctrl->p_ctsu_instance->p_ctrl,
+        pad_buf);
     FSP_ERROR_RETURN(FSP_ERR_CTSU_SCANNING != err, FSP_ERR_CTSU_SCANNING);
 
     /* check for max touch */
@@ -1477,91 +1453,201 @@ fsp_err_t RM_TOUCH_VersionGet (fsp_version_t * const p_version)
  **********************************************************************************************************************/
 
 #if (TOUCH_CFG_NUM_BUTTONS != 0)
- #if (CTSU_CFG_NUM_SELF_ELEMENTS != 0)
 
 /***********************************************************************************************************************
- * Function Name: touch_button_self_decode
- * Description  : Self Touch Button decoding
- * Arguments    : touch_button_info_t  p_binfo : Pointer to Button Information structure
- *              : uint16_t value               : Sensor value from CTSU
- *              : uint8_t  button_id           : Button ID
+ * Function Name: touch_button_decode
+ * Description  : Touch Button decoding for all buttons of an instance. The sensor values are gathered into an array
+ *              : and judged two buttons at a time against the reference, threshold and hysteresis arrays, producing
+ *              : touch and non-touch bitmaps. The per-button counters are then updated from the bitmaps.
+ * Arguments    : touch_instance_ctrl_t p_instance_ctrl : Pointer to control structure
+ *              : uint16_t * p_data                     : Sensor data from CTSU
  * Return Value : None
  ***********************************************************************************************************************/
-void touch_button_self_decode (touch_button_info_t * p_binfo, uint16_t value, uint8_t button_id)
+void touch_button_decode (touch_instance_ctrl_t * const p_instance_ctrl, uint16_t const * p_data)
 {
-    uint32_t threshold;
-    uint16_t threshold_sub_hys;
+    touch_button_info_t * p_binfo     = &p_instance_ctrl->binfo;
+    uint8_t               num_buttons = p_instance_ctrl->p_touch_cfg->num_buttons;
+    uint16_t              value[TOUCH_CFG_NUM_BUTTONS + 1];
+    uint64_t              on_mask  = 0;
+    uint64_t              off_mask = 0;
+    bool                  mutual   = false;
+    uint8_t               button_id;
+    uint16_t              elem_index;
 
-    threshold = (uint32_t) (*(p_binfo->p_reference + button_id) + *(p_binfo->p_threshold + button_id));
-    if (TOUCH_COUNT_MAX < threshold)
+ #if (CTSU_CFG_NUM_MUTUAL_ELEMENTS != 0)
+    mutual = (CTSU_MODE_MUTUAL_FULL_SCAN == (CTSU_MODE_MUTUAL_FULL_SCAN & p_instance_ctrl->p_ctsu_instance->p_cfg->md));
+ #endif
+
+    /* Gather the sensor value of each button */
+    for (button_id = 0; button_id < num_buttons; button_id++)
     {
-        return;
+        elem_index = p_instance_ctrl->p_touch_cfg->p_buttons[button_id].elem_index;
+        if (mutual)
+        {
+            /* The value of secondary count minus primary count */
+            value[button_id] = (uint16_t) (p_data[(elem_index * 2) + 1] - p_data[elem_index * 2]);
+        }
+        else
+        {
+            value[button_id] = p_data[elem_index];
+        }
     }
 
-    threshold_sub_hys = (uint16_t) (threshold - (*(p_binfo->p_hysteresis + button_id)));
+    value[num_buttons] = 0;
 
-    /* threshold_sub_hys < scan value = Touch */
-    if (threshold < value)
+    /* Judge two buttons per step. The upper lane of an odd last pair is discarded by the mask below. */
+    for (button_id = 0; button_id < num_buttons; button_id = (uint8_t) (button_id + 2))
     {
-        touch_button_on(p_binfo, value, button_id);
+        uint8_t  next = (uint8_t) (button_id + 1);
+        uint32_t pair = (next < num_buttons) ? 1U : 0U;
+        uint32_t judge;
+
+        judge = touch_button_judge_pair(
+            (uint32_t) p_binfo->p_reference[button_id] | ((uint32_t) (p_binfo->p_reference[next * pair]) << 16),
+            (uint32_t) p_binfo->p_threshold[button_id] | ((uint32_t) (p_binfo->p_threshold[next * pair]) << 16),
+            (uint32_t) p_binfo->p_hysteresis[button_id] | ((uint32_t) (p_binfo->p_hysteresis[next * pair]) << 16),
+            (uint32_t) value[button_id] | ((uint32_t) value[next] << 16),
+            mutual);
+
+        on_mask  |= (uint64_t) (judge & 0x3U) << button_id;
+        off_mask |= (uint64_t) ((judge >> 2) & 0x3U) << button_id;
     }
-    else if (threshold_sub_hys > value)
+
+    for (button_id = 0; button_id < num_buttons; button_id++)
     {
-        touch_button_off(p_binfo, button_id);
+        if (0 == p_binfo->p_reference[button_id])
+        {
+            p_binfo->p_reference[button_id] = value[button_id];
+            continue;
+        }
+
+        /* Create button status */
+        if (on_mask & ((uint64_t) 1 << button_id))
+        {
+            touch_button_on(p_binfo, value[button_id], button_id);
+        }
+        else if (off_mask & ((uint64_t) 1 << button_id))
+        {
+            touch_button_off(p_binfo, button_id);
+        }
+        else
+        {
+            /* Do nothing during hysteresis */
+        }
+
+        touch_button_drift(p_binfo, value[button_id], button_id);
+    }
+}
+
+/***********************************************************************************************************************
+ * Function Name: touch_button_judge_pair
+ * Description  : Touch judgement of two buttons. Each argument holds the lower button in bits 0-15 and the upper
+ *              : button in bits 16-31.
+ *              : Self  : touch if value > reference + threshold,
+ *              :         non-touch if value < reference + threshold - hysteresis
+ *              : Mutual: touch if value < reference - threshold,
+ *              :         non-touch if value > reference - threshold + hysteresis
+ *              : Buttons whose thresholds do not fit in 16 bits are neither touched nor released.
+ * Arguments    : uint32_t reference  : Reference values
+ *              : uint32_t threshold  : Threshold values
+ *              : uint32_t hysteresis : Hysteresis values
+ *              : uint32_t value      : Sensor values
+ *              : bool     mutual     : Mutual button judgement
+ * Return Value : Bit 0-1 = touch of lower/upper button, bit 2-3 = non-touch of lower/upper button
+ ***********************************************************************************************************************/
+uint32_t touch_button_judge_pair (uint32_t reference,
+                                  uint32_t threshold,
+                                  uint32_t hysteresis,
+                                  uint32_t value,
+                                  bool     mutual)
+{
+ #if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+
+    /* __USUB16(a, b) sets the GE flags of each lane to (a >= b), __SEL turns them into a lane mask. */
+    uint32_t limit;
+    uint32_t valid;
+    uint32_t ge_on;
+    uint32_t ge_off;
+    uint32_t on;
+    uint32_t off;
+
+    if (mutual)
+    {
+        (void) __USUB16(threshold, reference);
+        valid = ~__SEL(0xFFFFFFFFU, 0U);                 /* reference > threshold */
+        limit = __USUB16(reference, threshold);
+        (void) __USUB16(~limit, hysteresis);
+        valid &= __SEL(0xFFFFFFFFU, 0U);                 /* limit + hysteresis <= TOUCH_COUNT_MAX */
+        (void) __USUB16(value, limit);
+        ge_on = __SEL(0xFFFFFFFFU, 0U);                  /* value >= limit: not touched */
+        (void) __USUB16(__UADD16(limit, hysteresis), value);
+        ge_off = __SEL(0xFFFFFFFFU, 0U);                 /* limit + hysteresis >= value: not released */
     }
     else
     {
-        /* Do nothing during hysteresis */
+        (void) __USUB16(~reference, threshold);
+        valid = __SEL(0xFFFFFFFFU, 0U);                  /* reference + threshold <= TOUCH_COUNT_MAX */
+        limit = __UADD16(reference, threshold);
+        (void) __USUB16(limit, value);
+        ge_on = __SEL(0xFFFFFFFFU, 0U);                  /* limit >= value: not touched */
+        (void) __USUB16(value, __USUB16(limit, hysteresis));
+        ge_off = __SEL(0xFFFFFFFFU, 0U);                 /* value >= limit - hysteresis: not released */
     }
-}
 
+    on  = valid & ~ge_on;
+    off = valid & ge_on & ~ge_off;
+
+    return (on & 1U) | ((on >> 15) & 2U) | ((off & 1U) << 2) | ((off >> 13) & 8U);
+ #else
+
+    return touch_button_judge(reference & TOUCH_COUNT_MAX,
+                              threshold & TOUCH_COUNT_MAX,
+                              hysteresis & TOUCH_COUNT_MAX,
+                              value & TOUCH_COUNT_MAX,
+                              mutual) |
+           (touch_button_judge(reference >> 16, threshold >> 16, hysteresis >> 16, value >> 16, mutual) << 1);
  #endif
+}
 
- #if (CTSU_CFG_NUM_MUTUAL_ELEMENTS != 0)
+ #if !(defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1))
 
 /***********************************************************************************************************************
- * Function Name: touch_button_mutual_decode
- * Description  : Mutual Touch Button decoding
- * Arguments    : touch_button_info_t  p_binfo : Pointer to Button Information structure
- *              : uint16_t value               : Sensor value from CTSU
- *              : uint8_t  button_id           : Button ID
- * Return Value : None
+ * Function Name: touch_button_judge
+ * Description  : Touch judgement of one button, see touch_button_judge_pair()
+ * Arguments    : uint32_t reference  : Reference value
+ *              : uint32_t threshold  : Threshold value
+ *              : uint32_t hysteresis : Hysteresis value
+ *              : uint32_t value      : Sensor value
+ *              : bool     mutual     : Mutual button judgement
+ * Return Value : Bit 0 = touch, bit 2 = non-touch
  ***********************************************************************************************************************/
-void touch_button_mutual_decode (touch_button_info_t * p_binfo, uint16_t value, uint8_t button_id)
+uint32_t touch_button_judge (uint32_t reference, uint32_t threshold, uint32_t hysteresis, uint32_t value, bool mutual)
 {
-    uint16_t threshold;
-    uint32_t threshold_add_hys;
+    uint32_t limit;
+    uint32_t valid;
+    uint32_t on;
+    uint32_t off;
 
-    if (*(p_binfo->p_reference + button_id) > *(p_binfo->p_threshold + button_id))
+    if (mutual)
     {
-        threshold = (uint16_t) (*(p_binfo->p_reference + button_id) - *(p_binfo->p_threshold + button_id));
+        limit = (reference - threshold) & TOUCH_COUNT_MAX;
+        valid = (reference > threshold) && ((limit + hysteresis) <= TOUCH_COUNT_MAX);
+        on    = (limit > value);
+        off   = ((limit + hysteresis) < value);
     }
     else
     {
-        return;
+        limit = reference + threshold;
+        valid = (limit <= TOUCH_COUNT_MAX);
+        on    = (limit < value);
+        off   = (((limit - hysteresis) & TOUCH_COUNT_MAX) > value);
     }
 
-    /* get current threshold_add_hys */
-    threshold_add_hys = (uint32_t) (threshold + (*(p_binfo->p_hysteresis + button_id)));
-    if (TOUCH_COUNT_MAX < threshold_add_hys) /* error process (touch_cnt is 16bit) */
-    {
-        return;
-    }
+    on  &= valid;
+    off &= valid & ~on;
 
-    /* threshold_add_hys > scan value = Touch */
-    if (threshold > value)
-    {
-        touch_button_on(p_binfo, value, button_id);
-    }
-    else if (threshold_add_hys < value)
-    {
-        touch_button_off(p_binfo, button_id);
-    }
-    else
-    {
-        /* Do nothing during hysteresis */
-    }
-}                                      /* End of function touch_button_decode() */
+    return on | (off << 2);
+}
 
  #endif
 
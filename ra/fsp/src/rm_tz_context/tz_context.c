@@ -40,10 +40,23 @@
 #define TZ_PROCESS_STACK_SIZE      256U
 #endif
 
+/// Set to 1 to assign process stacks on demand. A thread then only holds a stack slot while it is executing or
+/// preempted in secure code, so up to TZ_PROCESS_CONTEXT_SLOTS threads can share TZ_PROCESS_STACK_SLOTS stacks.
+#ifndef TZ_PROCESS_STACK_RECYCLE
+#define TZ_PROCESS_STACK_RECYCLE   0U
+#endif
+
+/// Number of threads that may call secure library code when TZ_PROCESS_STACK_RECYCLE is set
+#ifndef TZ_PROCESS_CONTEXT_SLOTS
+#define TZ_PROCESS_CONTEXT_SLOTS   (4U * TZ_PROCESS_STACK_SLOTS)
+#endif
+
 #define TZ_PROCESS_STACK_SEAL_SIZE     8U
 
 #define TZ_PROCESS_STACK_SEAL_VALUE    0xFEF5EDA5
 
+#define TZ_PROCESS_STACK_NONE          UINT32_MAX
+
 /// MPU is not yet supported
 #define RM_TZ_CONTEXT_CFG_MPU_ENABLE   0U
 
@@ -57,6 +70,56 @@ static stack_info_t ProcessStackInfo  [TZ_PROCESS_STACK_SLOTS];
 static uint32_t     ProcessStackMemory[TZ_PROCESS_STACK_SLOTS][(TZ_PROCESS_STACK_SIZE + TZ_PROCESS_STACK_SEAL_SIZE)/sizeof(uint32_t)] BSP_ALIGN_VARIABLE(8);
 static uint32_t     ProcessStackFreeSlot = UINT32_MAX;
 
+#if TZ_PROCESS_STACK_RECYCLE
+typedef struct {
+  uint32_t active;      // context allocated to a thread
+  uint32_t slot;        // stack slot in use, TZ_PROCESS_STACK_NONE while the thread is outside secure code
+} context_info_t;
+
+static context_info_t ProcessContextInfo[TZ_PROCESS_CONTEXT_SLOTS];
+#endif
+
+/// Take a stack slot from the free list
+/// \return stack slot, or TZ_PROCESS_STACK_NONE if none is free
+static uint32_t StackSlotAlloc (void) {
+  uint32_t slot = ProcessStackFreeSlot;
+
+  if (slot != TZ_PROCESS_STACK_NONE) {
+    ProcessStackFreeSlot = *((uint32_t *)ProcessStackMemory[slot]);
+    ProcessStackInfo[slot].sp = ProcessStackInfo[slot].sp_top;
+  }
+
+  return slot;
+}
+
+/// Return a stack slot to the free list
+/// \param[in]  slot  stack slot
+static void StackSlotFree (uint32_t slot) {
+  ProcessStackInfo[slot].sp = 0U;
+
+  *((uint32_t *)ProcessStackMemory[slot]) = ProcessStackFreeSlot;
+  ProcessStackFreeSlot = slot;
+}
+
+/// Get the stack slot of a context
+/// \param[in]  id  TrustZone memory slot identifier
+/// \return stack slot, or TZ_PROCESS_STACK_NONE if the identifier is invalid or no stack is assigned
+static uint32_t StackSlotGet (TZ_MemoryId_t id) {
+#if TZ_PROCESS_STACK_RECYCLE
+  if ((id == 0U) || (id > TZ_PROCESS_CONTEXT_SLOTS) || (ProcessContextInfo[id - 1U].active == 0U)) {
+    return TZ_PROCESS_STACK_NONE;
+  }
+
+  return ProcessContextInfo[id - 1U].slot;
+#else
+  if ((id == 0U) || (id > TZ_PROCESS_STACK_SLOTS) || (ProcessStackInfo[id - 1U].sp == 0U)) {
+    return TZ_PROCESS_STACK_NONE;
+  }
+
+  return id - 1U;
+#endif
+}
+
 /// Initialize secure context memory system
 /// \return execution status (1: success, 0: error)
 BSP_CMSE_NONSECURE_ENTRY
@@ -80,6 +143,20 @@ uint32_t TZ_InitContextSystem_S (void) {
 
   ProcessStackFreeSlot = 0U;
 
+#if TZ_PROCESS_STACK_RECYCLE
+  for (n = 0U; n < TZ_PROCESS_CONTEXT_SLOTS; n++) {
+    ProcessContextInfo[n].active = 0U;
+    ProcessContextInfo[n].slot   = TZ_PROCESS_STACK_NONE;
+  }
+#endif
+
+#if (defined(__FPU_USED) && (__FPU_USED == 1U))
+  /* Use lazy floating point state preservation in both security states and lock it from the non-secure side, so
+   * floating point registers are only stacked for contexts that use them. */
+  FPU->FPCCR    |= FPU_FPCCR_ASPEN_Msk | FPU_FPCCR_LSPEN_Msk | FPU_FPCCR_LSPENS_Msk;
+  FPU_NS->FPCCR |= FPU_FPCCR_ASPEN_Msk;
+#endif
+
   // Default process stack pointer and stack limit
   __set_PSPLIM((uint32_t)ProcessStackMemory);
   __set_PSP   ((uint32_t)ProcessStackMemory);
@@ -114,16 +191,26 @@ TZ_MemoryId_t TZ_AllocModuleContext_S (TZ_ModuleId_t module) {
     return 0U;  // Thread Mode
   }
 
-  if (ProcessStackFreeSlot == UINT32_MAX) {
-    return 0U;  // No slot available
-  }
+#if TZ_PROCESS_STACK_RECYCLE
+  // The stack slot is assigned when the context is first loaded
+  for (slot = 0U; slot < TZ_PROCESS_CONTEXT_SLOTS; slot++) {
+    if (ProcessContextInfo[slot].active == 0U) {
+      ProcessContextInfo[slot].active = 1U;
+      ProcessContextInfo[slot].slot   = TZ_PROCESS_STACK_NONE;
 
-  slot = ProcessStackFreeSlot;
-  ProcessStackFreeSlot = *((uint32_t *)ProcessStackMemory[slot]);
+      return (slot + 1U);
+    }
+  }
 
-  ProcessStackInfo[slot].sp = ProcessStackInfo[slot].sp_top;
+  return 0U;  // No context available
+#else
+  slot = StackSlotAlloc();
+  if (slot == TZ_PROCESS_STACK_NONE) {
+    return 0U;  // No slot available
+  }
 
   return (slot + 1U);
+#endif
 }
 
 
@@ -138,19 +225,25 @@ uint32_t TZ_FreeModuleContext_S (TZ_MemoryId_t id) {
     return 0U;  // Thread Mode
   }
 
-  if ((id == 0U) || (id > TZ_PROCESS_STACK_SLOTS)) {
-    return 0U;  // Invalid ID
+#if TZ_PROCESS_STACK_RECYCLE
+  if ((id == 0U) || (id > TZ_PROCESS_CONTEXT_SLOTS) || (ProcessContextInfo[id - 1U].active == 0U)) {
+    return 0U;  // Invalid ID or inactive context
   }
 
-  slot = id - 1U;
-
-  if (ProcessStackInfo[slot].sp == 0U) {
-    return 0U;  // Inactive slot
+  slot = ProcessContextInfo[id - 1U].slot;
+  if (slot != TZ_PROCESS_STACK_NONE) {
+    StackSlotFree(slot);
+  }
+  ProcessContextInfo[id - 1U].active = 0U;
+  ProcessContextInfo[id - 1U].slot   = TZ_PROCESS_STACK_NONE;
+#else
+  slot = StackSlotGet(id);
+  if (slot == TZ_PROCESS_STACK_NONE) {
+    return 0U;  // Invalid ID or inactive slot
   }
-  ProcessStackInfo[slot].sp = 0U;
 
-  *((uint32_t *)ProcessStackMemory[slot]) = ProcessStackFreeSlot;
-  ProcessStackFreeSlot = slot;
+  StackSlotFree(slot);
+#endif
 
   return 1U;    // Success
 }
@@ -167,14 +260,19 @@ uint32_t TZ_LoadContext_S (TZ_MemoryId_t id) {
     return 0U;  // Thread Mode or using Main Stack for threads
   }
 
-  if ((id == 0U) || (id > TZ_PROCESS_STACK_SLOTS)) {
-    return 0U;  // Invalid ID
-  }
+  slot = StackSlotGet(id);
 
-  slot = id - 1U;
+#if TZ_PROCESS_STACK_RECYCLE
+  if ((slot == TZ_PROCESS_STACK_NONE) && (id != 0U) && (id <= TZ_PROCESS_CONTEXT_SLOTS) &&
+      (ProcessContextInfo[id - 1U].active != 0U)) {
+    // The thread is entering secure code again, assign a stack from the pool
+    slot = StackSlotAlloc();
+    ProcessContextInfo[id - 1U].slot = slot;
+  }
+#endif
 
-  if (ProcessStackInfo[slot].sp == 0U) {
-    return 0U;  // Inactive slot
+  if (slot == TZ_PROCESS_STACK_NONE) {
+    return 0U;  // Invalid ID, inactive slot or no stack available
   }
 
   // Setup process stack pointer and stack limit
@@ -197,14 +295,9 @@ uint32_t TZ_StoreContext_S (TZ_MemoryId_t id) {
     return 0U;  // Thread Mode or using Main Stack for threads
   }
 
-  if ((id == 0U) || (id > TZ_PROCESS_STACK_SLOTS)) {
-    return 0U;  // Invalid ID
-  }
-
-  slot = id - 1U;
-
-  if (ProcessStackInfo[slot].sp == 0U) {
-    return 0U;  // Inactive slot
+  slot = StackSlotGet(id);
+  if (slot == TZ_PROCESS_STACK_NONE) {
+    return 0U;  // Invalid ID or inactive slot
   }
 
   sp = __get_PSP();
@@ -214,12 +307,26 @@ uint32_t TZ_StoreContext_S (TZ_MemoryId_t id) {
   }
   ProcessStackInfo[slot].sp = sp;
 
-  __asm volatile (
-    "MRS    R1, PSP                          \n" /* r1 = PSP. */
-    "VSTMDB R1!, {S0}                        \n" /* Trigger the deferred stacking of FPU registers. */
-    "VLDMIA R1!, {S0}                        \n" /* Nullify the effect of the pervious statement. */
-    ::: "r1", "memory"
-  );
+#if (defined(__FPU_USED) && (__FPU_USED == 1U))
+  /* Only a pending lazy floating point state has to be saved before the stack is switched. Using the FPU when no
+   * state is pending would create a floating point context and make later exceptions stack it. */
+  if (((FPU->FPCCR | FPU_NS->FPCCR) & FPU_FPCCR_LSPACT_Msk) != 0U) {
+    __asm volatile (
+      "MRS    R1, PSP                          \n" /* r1 = PSP. */
+      "VSTMDB R1!, {S0}                        \n" /* Trigger the deferred stacking of FPU registers. */
+      "VLDMIA R1!, {S0}                        \n" /* Nullify the effect of the pervious statement. */
+      ::: "r1", "memory"
+    );
+  }
+#endif
+
+#if TZ_PROCESS_STACK_RECYCLE
+  if (sp == ProcessStackInfo[slot].sp_top) {
+    // The thread is not in secure code, so its stack is empty and can be used by another thread
+    StackSlotFree(slot);
+    ProcessContextInfo[id - 1U].slot = TZ_PROCESS_STACK_NONE;
+  }
+#endif
 
   // Default process stack pointer and stack limit
   __set_PSPLIM((uint32_t)ProcessStackMemory);
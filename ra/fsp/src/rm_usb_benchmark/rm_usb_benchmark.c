@@ -0,0 +1,580 @@
+/***********************************************************************************************************************
+ * Copyright [2020] Renesas Electronics Corporation and/or its affiliates.  All Rights Reserved.
+ *
+ * This software and documentation are supplied by Renesas Electronics America Inc. and may only be used with products
+ * of Renesas Electronics Corp. and its affiliates ("Renesas").  No other uses are authorized.  Renesas products are
+ * sold pursuant to Renesas terms and conditions of sale.  Purchasers are solely responsible for the selection and use
+ * of Renesas products and Renesas assumes no liability.  No license, express or implied, to any intellectual property
+ * right is granted by Renesas. This software is protected under all applicable laws, including copyright laws. Renesas
+ * reserves the right to change or discontinue this software and/or this documentation. THE SOFTWARE AND DOCUMENTATION
+ * IS DELIVERED TO YOU "AS IS," AND RENESAS MAKES NO REPRESENTATIONS OR WARRANTIES, AND TO THE FULLEST EXTENT
+ * PERMISSIBLE UNDER APPLICABLE LAW, DISCLAIMS ALL WARRANTIES, WHETHER EXPLICITLY OR IMPLICITLY, INCLUDING WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, AND NONINFRINGEMENT, WITH RESPECT TO THE SOFTWARE OR
+ * DOCUMENTATION.  RENESAS SHALL HAVE NO LIABILITY ARISING OUT OF ANY SECURITY VULNERABILITY OR BREACH.  TO THE MAXIMUM
+ * EXTENT PERMITTED BY LAW, IN NO EVENT WILL RENESAS BE LIABLE TO YOU IN CONNECTION WITH THE SOFTWARE OR DOCUMENTATION
+ * (OR ANY PERSON OR ENTITY CLAIMING RIGHTS DERIVED FROM YOU) FOR ANY LOSS, DAMAGES, OR CLAIMS WHATSOEVER, INCLUDING,
+ * WITHOUT LIMITATION, ANY DIRECT, CONSEQUENTIAL, SPECIAL, INDIRECT, PUNITIVE, OR INCIDENTAL DAMAGES; ANY LOST PROFITS,
+ * OTHER ECONOMIC DAMAGE, PROPERTY DAMAGE, OR PERSONAL INJURY; AND EVEN IF RENESAS HAS BEEN ADVISED OF THE POSSIBILITY
+ * OF SUCH LOSS, DAMAGES, CLAIMS OR COSTS.
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Includes
+ **********************************************************************************************************************/
+#include <string.h>
+#include "rm_usb_benchmark.h"
+#include "r_usb_pcdc_api.h"
+
+/***********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+#define RM_USB_BENCHMARK_US_PER_S              (1000000U)
+#define RM_USB_BENCHMARK_US_PER_MS             (1000U)
+#define RM_USB_BENCHMARK_PERMILLE              (1000U)
+#define RM_USB_BENCHMARK_LINE_CODING_SIZE      (7U)
+
+/* A poll of the event source that takes longer than this multiple of the fastest poll was stretched by interrupts or
+ * driver work, and does not count as idle time. */
+#define RM_USB_BENCHMARK_IDLE_POLL_FACTOR      (2U)
+
+/* Word offsets of the command. */
+#define RM_USB_BENCHMARK_COMMAND_MAGIC         (0U)
+#define RM_USB_BENCHMARK_COMMAND_TEST          (1U)
+#define RM_USB_BENCHMARK_COMMAND_COUNT         (2U)
+#define RM_USB_BENCHMARK_COMMAND_SIZE_WORD     (3U)
+
+/***********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+
+/* State of a benchmark session. */
+typedef struct st_rm_usb_benchmark_ctx
+{
+    rm_usb_benchmark_cfg_t const * p_cfg;
+    rm_usb_benchmark_result_t      result;
+    bsp_cycle_counter_get_t        p_cycles_get;
+    uint32_t cycles_per_us;
+    uint32_t last_cycles;              // Cycle counter at the last time read
+    uint64_t cycles;                   // Cycle counter extended to 64 bits
+    uint64_t poll_cycles;              // Time of the last event poll
+    uint64_t poll_min;                 // Fastest event poll that found nothing
+    uint64_t idle_cycles;              // Time spent in polls that found nothing
+    uint64_t test_cycles;              // Time at the start of the test
+    uint64_t test_idle_cycles;         // Idle time at the start of the test
+    uint8_t  line_coding[8];           // CDC line coding, kept for GET_LINE_CODING
+} rm_usb_benchmark_ctx_t;
+
+/***********************************************************************************************************************
+ * Private function prototypes
+ **********************************************************************************************************************/
+static uint64_t     rm_usb_benchmark_cycles_get(rm_usb_benchmark_ctx_t * p_ctx);
+static usb_status_t rm_usb_benchmark_event_wait(rm_usb_benchmark_ctx_t * p_ctx, uint32_t * p_size);
+static void         rm_usb_benchmark_request_handle(rm_usb_benchmark_ctx_t * p_ctx, usb_event_info_t * p_info);
+static fsp_err_t    rm_usb_benchmark_transfer(rm_usb_benchmark_ctx_t * p_ctx,
+                                              bool                     write,
+                                              bool                     latency,
+                                              uint32_t                 size,
+                                              uint32_t               * p_done);
+static fsp_err_t rm_usb_benchmark_bulk(rm_usb_benchmark_ctx_t * p_ctx, bool write, uint32_t count);
+static fsp_err_t rm_usb_benchmark_latency(rm_usb_benchmark_ctx_t * p_ctx, uint32_t count);
+static void      rm_usb_benchmark_measure_start(rm_usb_benchmark_ctx_t * p_ctx);
+static void      rm_usb_benchmark_measure_stop(rm_usb_benchmark_ctx_t * p_ctx);
+static fsp_err_t rm_usb_benchmark_report_send(rm_usb_benchmark_ctx_t * p_ctx);
+
+/*******************************************************************************************************************//**
+ * @addtogroup RM_USB_BENCHMARK
+ * @{
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Functions
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * Serves benchmark tests requested by the host companion tool (rm_usb_benchmark_host.py) until it sends the stop
+ * command. The host sends each command on the bulk OUT endpoint; the device runs the test and answers with a report
+ * on the bulk IN endpoint, which is also passed to p_cfg->p_callback:
+ * - Bulk OUT and bulk IN tests move the requested number of bytes in requests of the requested transfer size.
+ * - The latency test echoes the requested number of packets on the interrupt pipes (or the bulk pipes), and reports
+ *   the device side turnaround. The host measures the round trip time.
+ *
+ * The report carries the enumerated speed and whether the USB instance uses DMAC or DTC transfers, so the FS and HS
+ * ports and the two transfer configurations are compared by building the application for each.
+ *
+ * The CPU load is the share of time the benchmark loop could not poll for USB events, that is, time taken by the USB
+ * interrupts, the driver and the rest of the system. Without an RTOS, R_USB_EventGet() is polled; with FreeRTOS,
+ * p_cfg->event_queue is polled, so run the benchmark in the lowest priority application task.
+ *
+ * The USB instance must be opened by the application. Class requests (CDC line coding and control line state) are
+ * answered by this function while it runs. This function blocks and must not be called from an interrupt.
+ *
+ * @retval FSP_SUCCESS                  The host sent the stop command.
+ * @retval FSP_ERR_ASSERTION            A required pointer is NULL or a vendor pipe is not set.
+ * @retval FSP_ERR_INVALID_SIZE         The transfer buffer is smaller than a report.
+ * @retval FSP_ERR_UNSUPPORTED          No cycle counter, see R_BSP_CycleCounterSelect().
+ * @retval FSP_ERR_USB_FAILED           The device was detached or suspended.
+ * @return See @ref RENESAS_ERROR_CODES or functions called by this function for other possible return codes.
+ *         This function calls:
+ *             * @ref usb_api_t::pipeRead
+ *             * @ref usb_api_t::pipeWrite
+ *             * @ref usb_api_t::read
+ *             * @ref usb_api_t::write
+ **********************************************************************************************************************/
+fsp_err_t RM_USB_BENCHMARK_Run (rm_usb_benchmark_cfg_t const * const p_cfg)
+{
+    rm_usb_benchmark_ctx_t ctx;
+    usb_info_t             info = {0};
+    uint32_t               command[RM_USB_BENCHMARK_COMMAND_SIZE / sizeof(uint32_t)];
+    uint32_t               received = 0U;
+    fsp_err_t              err      = FSP_SUCCESS;
+
+#if BSP_CFG_PARAM_CHECKING_ENABLE
+    FSP_ASSERT(p_cfg);
+    FSP_ASSERT(p_cfg->p_usb);
+    FSP_ASSERT(p_cfg->p_buffer);
+    FSP_ASSERT((RM_USB_BENCHMARK_TRANSPORT_VENDOR != p_cfg->transport) ||
+               ((0U != p_cfg->bulk_in_pipe) && (0U != p_cfg->bulk_out_pipe)));
+ #if (BSP_CFG_RTOS == 2)
+    FSP_ASSERT(p_cfg->event_queue);
+ #endif
+#endif
+
+    FSP_ERROR_RETURN(p_cfg->buffer_size >= RM_USB_BENCHMARK_REPORT_SIZE, FSP_ERR_INVALID_SIZE);
+
+    memset(&ctx, 0, sizeof(ctx));
+    err = R_BSP_CycleCounterSelect(p_cfg->p_cycles_get, &ctx.p_cycles_get);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+    ctx.p_cfg         = p_cfg;
+    ctx.cycles_per_us = SystemCoreClock / RM_USB_BENCHMARK_US_PER_S;
+    ctx.last_cycles   = ctx.p_cycles_get();
+    ctx.poll_min      = UINT64_MAX;
+
+    /* 115200 bps, 1 stop bit, no parity, 8 data bits */
+    ctx.line_coding[0] = 0x00U;
+    ctx.line_coding[1] = 0xC2U;
+    ctx.line_coding[2] = 0x01U;
+    ctx.line_coding[6] = 8U;
+
+    /* Wait for the host to configure the device. */
+    (void) p_cfg->p_usb->p_api->infoGet(p_cfg->p_usb->p_ctrl, &info, 0U);
+    while (USB_STATUS_CONFIGURED != info.device_status)
+    {
+        if (USB_STATUS_CONFIGURED == rm_usb_benchmark_event_wait(&ctx, &received))
+        {
+            (void) p_cfg->p_usb->p_api->infoGet(p_cfg->p_usb->p_ctrl, &info, 0U);
+            info.device_status = USB_STATUS_CONFIGURED;
+        }
+    }
+
+    for ( ; ; )
+    {
+        err = rm_usb_benchmark_transfer(&ctx, false, false, RM_USB_BENCHMARK_COMMAND_SIZE, &received);
+        FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+        memcpy(command, p_cfg->p_buffer, sizeof(command));
+        if ((received < RM_USB_BENCHMARK_COMMAND_SIZE) ||
+            (RM_USB_BENCHMARK_MAGIC != command[RM_USB_BENCHMARK_COMMAND_MAGIC]))
+        {
+            /* Not a command, e.g. data left over from an aborted host run. */
+            continue;
+        }
+
+        rm_usb_benchmark_test_t test = (rm_usb_benchmark_test_t) command[RM_USB_BENCHMARK_COMMAND_TEST];
+        uint32_t                size = command[RM_USB_BENCHMARK_COMMAND_SIZE_WORD];
+
+        memset(&ctx.result, 0, sizeof(ctx.result));
+        ctx.result.test          = test;
+        ctx.result.speed         = (usb_speed_t) info.speed;
+        ctx.result.dma           = (NULL != p_cfg->p_usb->p_cfg->p_transfer_tx) ||
+                                   (NULL != p_cfg->p_usb->p_cfg->p_transfer_rx);
+        ctx.result.transfer_size = (size < p_cfg->buffer_size) ? size : p_cfg->buffer_size;
+        ctx.result.p_context     = p_cfg->p_context;
+
+        switch (test)
+        {
+            case RM_USB_BENCHMARK_TEST_BULK_OUT:
+            case RM_USB_BENCHMARK_TEST_BULK_IN:
+            {
+                ctx.result.status = (0U != ctx.result.transfer_size) ?
+                                    rm_usb_benchmark_bulk(&ctx, RM_USB_BENCHMARK_TEST_BULK_IN == test,
+                                                          command[RM_USB_BENCHMARK_COMMAND_COUNT]) :
+                                    FSP_ERR_INVALID_SIZE;
+                break;
+            }
+
+            case RM_USB_BENCHMARK_TEST_LATENCY:
+            {
+                ctx.result.status = (0U != ctx.result.transfer_size) ?
+                                    rm_usb_benchmark_latency(&ctx, command[RM_USB_BENCHMARK_COMMAND_COUNT]) :
+                                    FSP_ERR_INVALID_SIZE;
+                break;
+            }
+
+            case RM_USB_BENCHMARK_TEST_INFO:
+            case RM_USB_BENCHMARK_TEST_STOP:
+            {
+                break;
+            }
+
+            default:
+            {
+                ctx.result.status = FSP_ERR_UNSUPPORTED;
+                break;
+            }
+        }
+
+        /* A detach ends the session; other errors are reported to the host. */
+        FSP_ERROR_RETURN(FSP_ERR_USB_FAILED != ctx.result.status, FSP_ERR_USB_FAILED);
+
+        err = rm_usb_benchmark_report_send(&ctx);
+        FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+        if (NULL != p_cfg->p_callback)
+        {
+            p_cfg->p_callback(&ctx.result);
+        }
+
+        if (RM_USB_BENCHMARK_TEST_STOP == test)
+        {
+            return FSP_SUCCESS;
+        }
+    }
+}
+
+/*******************************************************************************************************************//**
+ * @} (end addtogroup RM_USB_BENCHMARK)
+ **********************************************************************************************************************/
+
+/***********************************************************************************************************************
+ * Private Functions
+ **********************************************************************************************************************/
+
+/*******************************************************************************************************************//**
+ * Reads the cycle counter extended to 64 bits. The event loop reads it far more often than the counter wraps.
+ **********************************************************************************************************************/
+static uint64_t rm_usb_benchmark_cycles_get (rm_usb_benchmark_ctx_t * p_ctx)
+{
+    uint32_t cycles = p_ctx->p_cycles_get();
+
+    p_ctx->cycles     += cycles - p_ctx->last_cycles;
+    p_ctx->last_cycles = cycles;
+
+    return p_ctx->cycles;
+}
+
+/*******************************************************************************************************************//**
+ * Polls for the next USB event that concerns the benchmark, answering class requests on the way, and accounts
+ * the idle time of the polls.
+ *
+ * @param[in]  p_ctx                   Benchmark state.
+ * @param[out] p_size                  Bytes received, for USB_STATUS_READ_COMPLETE.
+ *
+ * @return USB_STATUS_READ_COMPLETE, USB_STATUS_WRITE_COMPLETE, USB_STATUS_CONFIGURED, USB_STATUS_DETACH or
+ *         USB_STATUS_SUSPEND.
+ **********************************************************************************************************************/
+static usb_status_t rm_usb_benchmark_event_wait (rm_usb_benchmark_ctx_t * p_ctx, uint32_t * p_size)
+{
+#if (BSP_CFG_RTOS != 2)
+    usb_instance_t const * p_usb = p_ctx->p_cfg->p_usb;
+#endif
+
+    for ( ; ; )
+    {
+        usb_event_info_t * p_info = NULL;
+        usb_status_t       event  = USB_STATUS_NONE;
+
+#if (BSP_CFG_RTOS == 2)
+        if (pdTRUE == xQueueReceive(p_ctx->p_cfg->event_queue, &p_info, 0U))
+        {
+            event = p_info->event;
+        }
+
+#else
+
+        /* Without an RTOS the event is copied into the control structure. */
+        (void) p_usb->p_api->eventGet(p_usb->p_ctrl, &event);
+        p_info = (usb_event_info_t *) p_usb->p_ctrl;
+#endif
+
+        uint64_t now   = rm_usb_benchmark_cycles_get(p_ctx);
+        uint64_t delta = now - p_ctx->poll_cycles;
+        p_ctx->poll_cycles = now;
+
+        switch (event)
+        {
+            case USB_STATUS_NONE:
+            {
+                p_ctx->poll_min = (delta < p_ctx->poll_min) ? delta : p_ctx->poll_min;
+                if (delta <= (p_ctx->poll_min * RM_USB_BENCHMARK_IDLE_POLL_FACTOR))
+                {
+                    p_ctx->idle_cycles += delta;
+                }
+
+                break;
+            }
+
+            case USB_STATUS_REQUEST:
+            {
+                rm_usb_benchmark_request_handle(p_ctx, p_info);
+                break;
+            }
+
+            case USB_STATUS_READ_COMPLETE:
+            case USB_STATUS_WRITE_COMPLETE:
+            {
+                *p_size = p_info->data_size;
+
+                return event;
+            }
+
+            case USB_STATUS_CONFIGURED:
+            case USB_STATUS_DETACH:
+            case USB_STATUS_SUSPEND:
+            {
+                return event;
+            }
+
+            default:
+            {
+                break;
+            }
+        }
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Answers a class or vendor request. The benchmark defines no vendor requests; CDC line coding is stored and
+ * echoed, and the control line state is acknowledged.
+ **********************************************************************************************************************/
+static void rm_usb_benchmark_request_handle (rm_usb_benchmark_ctx_t * p_ctx, usb_event_info_t * p_info)
+{
+    usb_instance_t const * p_usb   = p_ctx->p_cfg->p_usb;
+    uint16_t               request = p_info->setup.request_type & USB_BREQUEST;
+
+    if (RM_USB_BENCHMARK_TRANSPORT_CDC != p_ctx->p_cfg->transport)
+    {
+        (void) p_usb->p_api->periControlStatusSet(p_usb->p_ctrl, USB_SETUP_STATUS_STALL);
+    }
+    else if (USB_PCDC_SET_LINE_CODING == request)
+    {
+        (void) p_usb->p_api->periControlDataGet(p_usb->p_ctrl, p_ctx->line_coding, RM_USB_BENCHMARK_LINE_CODING_SIZE);
+    }
+    else if (USB_PCDC_GET_LINE_CODING == request)
+    {
+        (void) p_usb->p_api->periControlDataSet(p_usb->p_ctrl, p_ctx->line_coding, RM_USB_BENCHMARK_LINE_CODING_SIZE);
+    }
+    else if (USB_PCDC_SET_CONTROL_LINE_STATE == request)
+    {
+        (void) p_usb->p_api->periControlStatusSet(p_usb->p_ctrl, USB_SETUP_STATUS_ACK);
+    }
+    else
+    {
+        (void) p_usb->p_api->periControlStatusSet(p_usb->p_ctrl, USB_SETUP_STATUS_STALL);
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Runs one read or write request on the transfer buffer to completion.
+ *
+ * @param[in]  p_ctx                   Benchmark state.
+ * @param[in]  write                   True to send to the host, false to receive.
+ * @param[in]  latency                 True to use the latency pipes.
+ * @param[in]  size                    Bytes to send, or the largest number of bytes to receive.
+ * @param[out] p_done                  Bytes transferred.
+ *
+ * @retval FSP_SUCCESS                 The request completed.
+ * @retval FSP_ERR_USB_FAILED          The device was detached or suspended.
+ **********************************************************************************************************************/
+static fsp_err_t rm_usb_benchmark_transfer (rm_usb_benchmark_ctx_t * p_ctx,
+                                            bool                     write,
+                                            bool                     latency,
+                                            uint32_t                 size,
+                                            uint32_t               * p_done)
+{
+    rm_usb_benchmark_cfg_t const * p_cfg = p_ctx->p_cfg;
+    usb_instance_t const         * p_usb = p_cfg->p_usb;
+    fsp_err_t err = FSP_SUCCESS;
+
+    if (RM_USB_BENCHMARK_TRANSPORT_VENDOR == p_cfg->transport)
+    {
+        uint8_t pipe = write ? p_cfg->bulk_in_pipe : p_cfg->bulk_out_pipe;
+        if (latency && (0U != p_cfg->int_in_pipe) && (0U != p_cfg->int_out_pipe))
+        {
+            pipe = write ? p_cfg->int_in_pipe : p_cfg->int_out_pipe;
+        }
+
+        err = write ? p_usb->p_api->pipeWrite(p_usb->p_ctrl, p_cfg->p_buffer, size, pipe) :
+              p_usb->p_api->pipeRead(p_usb->p_ctrl, p_cfg->p_buffer, size, pipe);
+    }
+    else
+    {
+        err = write ? p_usb->p_api->write(p_usb->p_ctrl, p_cfg->p_buffer, size, USB_CLASS_PCDC) :
+              p_usb->p_api->read(p_usb->p_ctrl, p_cfg->p_buffer, size, USB_CLASS_PCDC);
+    }
+
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+    usb_status_t expected = write ? USB_STATUS_WRITE_COMPLETE : USB_STATUS_READ_COMPLETE;
+    for ( ; ; )
+    {
+        uint32_t     received = 0U;
+        usb_status_t event    = rm_usb_benchmark_event_wait(p_ctx, &received);
+
+        if (expected == event)
+        {
+            *p_done = write ? size : received;
+
+            return FSP_SUCCESS;
+        }
+
+        FSP_ERROR_RETURN((USB_STATUS_DETACH != event) && (USB_STATUS_SUSPEND != event), FSP_ERR_USB_FAILED);
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Moves count bytes in requests of the transfer size.
+ **********************************************************************************************************************/
+static fsp_err_t rm_usb_benchmark_bulk (rm_usb_benchmark_ctx_t * p_ctx, bool write, uint32_t count)
+{
+    rm_usb_benchmark_result_t * p_result = &p_ctx->result;
+    fsp_err_t err = FSP_SUCCESS;
+
+    rm_usb_benchmark_measure_start(p_ctx);
+
+    while ((p_result->bytes < count) && (FSP_SUCCESS == err))
+    {
+        uint32_t remaining = count - (uint32_t) p_result->bytes;
+        uint32_t done      = 0U;
+
+        err = rm_usb_benchmark_transfer(p_ctx, write, false,
+                                        (remaining < p_result->transfer_size) ? remaining : p_result->transfer_size,
+                                        &done);
+        if (FSP_SUCCESS == err)
+        {
+            p_result->bytes += done;
+            p_result->transfers++;
+        }
+    }
+
+    rm_usb_benchmark_measure_stop(p_ctx);
+
+    return err;
+}
+
+/*******************************************************************************************************************//**
+ * Echoes count packets on the latency pipes and records the time from each packet received to its echo sent.
+ **********************************************************************************************************************/
+static fsp_err_t rm_usb_benchmark_latency (rm_usb_benchmark_ctx_t * p_ctx, uint32_t count)
+{
+    rm_usb_benchmark_result_t * p_result = &p_ctx->result;
+    uint64_t  sum_us = 0U;
+    fsp_err_t err    = FSP_SUCCESS;
+
+    p_result->turnaround_min_us = UINT32_MAX;
+
+    rm_usb_benchmark_measure_start(p_ctx);
+
+    for (uint32_t i = 0U; (i < count) && (FSP_SUCCESS == err); i++)
+    {
+        uint32_t received = 0U;
+        uint32_t sent     = 0U;
+
+        err = rm_usb_benchmark_transfer(p_ctx, false, true, p_result->transfer_size, &received);
+        if (FSP_SUCCESS == err)
+        {
+            uint64_t start = rm_usb_benchmark_cycles_get(p_ctx);
+            err = rm_usb_benchmark_transfer(p_ctx, true, true, received, &sent);
+
+            uint32_t turnaround_us = (uint32_t) ((rm_usb_benchmark_cycles_get(p_ctx) - start) / p_ctx->cycles_per_us);
+            p_result->turnaround_min_us = (turnaround_us < p_result->turnaround_min_us) ?
+                                          turnaround_us : p_result->turnaround_min_us;
+            p_result->turnaround_max_us = (turnaround_us > p_result->turnaround_max_us) ?
+                                          turnaround_us : p_result->turnaround_max_us;
+            sum_us          += turnaround_us;
+            p_result->bytes += (uint64_t) received + sent;
+            p_result->transfers++;
+        }
+    }
+
+    rm_usb_benchmark_measure_stop(p_ctx);
+
+    if (0U == p_result->transfers)
+    {
+        p_result->turnaround_min_us = 0U;
+    }
+    else
+    {
+        p_result->turnaround_average_us = (uint32_t) (sum_us / p_result->transfers);
+    }
+
+    return err;
+}
+
+/*******************************************************************************************************************//**
+ * Starts the time and CPU load measurement of a test.
+ **********************************************************************************************************************/
+static void rm_usb_benchmark_measure_start (rm_usb_benchmark_ctx_t * p_ctx)
+{
+    p_ctx->test_cycles      = rm_usb_benchmark_cycles_get(p_ctx);
+    p_ctx->test_idle_cycles = p_ctx->idle_cycles;
+}
+
+/*******************************************************************************************************************//**
+ * Ends the time and CPU load measurement of a test and derives the throughput.
+ **********************************************************************************************************************/
+static void rm_usb_benchmark_measure_stop (rm_usb_benchmark_ctx_t * p_ctx)
+{
+    rm_usb_benchmark_result_t * p_result = &p_ctx->result;
+    uint64_t total = rm_usb_benchmark_cycles_get(p_ctx) - p_ctx->test_cycles;
+    uint64_t idle  = p_ctx->idle_cycles - p_ctx->test_idle_cycles;
+
+    p_result->duration_us = (uint32_t) (total / p_ctx->cycles_per_us);
+    if (0U != total)
+    {
+        idle = (idle < total) ? idle : total;
+        p_result->cpu_load_permille = RM_USB_BENCHMARK_PERMILLE -
+                                      (uint32_t) ((idle * RM_USB_BENCHMARK_PERMILLE) / total);
+    }
+
+    if (0U != p_result->duration_us)
+    {
+        p_result->throughput_kbytes_per_s = (uint32_t) ((p_result->bytes * RM_USB_BENCHMARK_US_PER_MS) /
+                                                        p_result->duration_us);
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Sends the result of a test to the host as RM_USB_BENCHMARK_REPORT_SIZE bytes of little endian words: magic, test,
+ * status, speed, DMA, transfer size, transfers, bytes (low, high), duration, throughput, CPU load, turnaround (min,
+ * average, max) and the core clock frequency.
+ **********************************************************************************************************************/
+static fsp_err_t rm_usb_benchmark_report_send (rm_usb_benchmark_ctx_t * p_ctx)
+{
+    rm_usb_benchmark_result_t const * p_result = &p_ctx->result;
+    uint32_t sent = 0U;
+
+    uint32_t report[RM_USB_BENCHMARK_REPORT_SIZE / sizeof(uint32_t)] =
+    {
+        RM_USB_BENCHMARK_MAGIC,
+        (uint32_t) p_result->test,
+        (uint32_t) p_result->status,
+        (uint32_t) p_result->speed,
+        (uint32_t) p_result->dma,
+        p_result->transfer_size,
+        p_result->transfers,
+        (uint32_t) p_result->bytes,
+        (uint32_t) (p_result->bytes >> 32),
+        p_result->duration_us,
+        p_result->throughput_kbytes_per_s,
+        p_result->cpu_load_permille,
+        p_result->turnaround_min_us,
+        p_result->turnaround_average_us,
+        p_result->turnaround_max_us,
+        SystemCoreClock,
+    };
+
+    memcpy(p_ctx->p_cfg->p_buffer, report, sizeof(report));
+
+    return rm_usb_benchmark_transfer(p_ctx, true, false, sizeof(report), &sent);
+}
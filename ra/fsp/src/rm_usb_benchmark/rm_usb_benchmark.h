@@ -0,0 +1,133 @@
+/***********************************************************************************************************************
+ * Copyright [2020] Renesas Electronics Corporation and/or its affiliates.  All Rights Reserved.
+ *
+ * This software and documentation are supplied by Renesas Electronics America Inc. and may only be used with products
+ * of Renesas Electronics Corp. and its affiliates ("Renesas").  No other uses are authorized.  Renesas products are
+ * sold pursuant to Renesas terms and conditions of sale.  Purchasers are solely responsible for the selection and use
+ * of Renesas products and Renesas assumes no liability.  No license, express or implied, to any intellectual property
+ * right is granted by Renesas. This software is protected under all applicable laws, including copyright laws. Renesas
+ * reserves the right to change or discontinue this software and/or this documentation. THE SOFTWARE AND DOCUMENTATION
+ * IS DELIVERED TO YOU "AS IS," AND RENESAS MAKES NO REPRESENTATIONS OR WARRANTIES, AND TO THE FULLEST EXTENT
+ * PERMISSIBLE UNDER APPLICABLE LAW, DISCLAIMS ALL WARRANTIES, WHETHER EXPLICITLY OR IMPLICITLY, INCLUDING WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, AND NONINFRINGEMENT, WITH RESPECT TO THE SOFTWARE OR
+ * DOCUMENTATION.  RENESAS SHALL HAVE NO LIABILITY ARISING OUT OF ANY SECURITY VULNERABILITY OR BREACH.  TO THE MAXIMUM
+ * EXTENT PERMITTED BY LAW, IN NO EVENT WILL RENESAS BE LIABLE TO YOU IN CONNECTION WITH THE SOFTWARE OR DOCUMENTATION
+ * (OR ANY PERSON OR ENTITY CLAIMING RIGHTS DERIVED FROM YOU) FOR ANY LOSS, DAMAGES, OR CLAIMS WHATSOEVER, INCLUDING,
+ * WITHOUT LIMITATION, ANY DIRECT, CONSEQUENTIAL, SPECIAL, INDIRECT, PUNITIVE, OR INCIDENTAL DAMAGES; ANY LOST PROFITS,
+ * OTHER ECONOMIC DAMAGE, PROPERTY DAMAGE, OR PERSONAL INJURY; AND EVEN IF RENESAS HAS BEEN ADVISED OF THE POSSIBILITY
+ * OF SUCH LOSS, DAMAGES, CLAIMS OR COSTS.
+ **********************************************************************************************************************/
+
+#ifndef RM_USB_BENCHMARK_H
+ #define RM_USB_BENCHMARK_H
+
+/***********************************************************************************************************************
+ * Includes
+ **********************************************************************************************************************/
+ #include "bsp_api.h"
+ #include "r_usb_basic.h"
+ #if (BSP_CFG_RTOS == 2)
+  #include "FreeRTOS.h"
+  #include "queue.h"
+ #endif
+
+/** Common macro for FSP header files. There is also a corresponding FSP_FOOTER macro at the end of this file. */
+FSP_HEADER
+
+/*******************************************************************************************************************//**
+ * @addtogroup RM_USB_BENCHMARK
+ * @{
+ **********************************************************************************************************************/
+
+/**********************************************************************************************************************
+ * Macro definitions
+ **********************************************************************************************************************/
+
+/** First word of each command and report, "RUBM" in little endian. */
+ #define RM_USB_BENCHMARK_MAGIC           (0x4D425552U)
+
+/** Size of a command sent by the host on the bulk OUT endpoint. */
+ #define RM_USB_BENCHMARK_COMMAND_SIZE    (16U)
+
+/** Size of the report sent to the host on the bulk IN endpoint after each test. */
+ #define RM_USB_BENCHMARK_REPORT_SIZE     (64U)
+
+/**********************************************************************************************************************
+ * Typedef definitions
+ **********************************************************************************************************************/
+
+/** Class the benchmark transfers data through. */
+typedef enum e_rm_usb_benchmark_transport
+{
+    RM_USB_BENCHMARK_TRANSPORT_VENDOR, ///< r_usb_pvnd pipes, with optional interrupt pipes for the latency test
+    RM_USB_BENCHMARK_TRANSPORT_CDC,    ///< r_usb_pcdc data interface
+} rm_usb_benchmark_transport_t;
+
+/** Tests requested by the host. The values are the test codes of the command. */
+typedef enum e_rm_usb_benchmark_test
+{
+    RM_USB_BENCHMARK_TEST_INFO     = 0, ///< Report the speed and DMA configuration only
+    RM_USB_BENCHMARK_TEST_BULK_OUT = 1, ///< Receive the given number of bytes
+    RM_USB_BENCHMARK_TEST_BULK_IN  = 2, ///< Send the given number of bytes
+    RM_USB_BENCHMARK_TEST_LATENCY  = 3, ///< Echo the given number of packets on the latency pipes
+    RM_USB_BENCHMARK_TEST_STOP     = 4, ///< Return from RM_USB_BENCHMARK_Run()
+} rm_usb_benchmark_test_t;
+
+/** Device side measurement of one test, also sent to the host as the report. */
+typedef struct st_rm_usb_benchmark_result
+{
+    rm_usb_benchmark_test_t test;      ///< Test run
+    fsp_err_t               status;    ///< FSP_SUCCESS, or the error that stopped the test
+    usb_speed_t             speed;     ///< Bus speed the device was enumerated at
+    bool     dma;                      ///< True if the USB instance moves FIFO data with DMAC or DTC
+    uint32_t transfer_size;            ///< Bytes per read or write request
+    uint32_t transfers;                ///< Read or write requests completed
+    uint64_t bytes;                    ///< Bytes transferred
+    uint32_t duration_us;              ///< Time from the first request to the last completion
+    uint32_t throughput_kbytes_per_s;  ///< Bytes per millisecond over duration_us
+    uint32_t cpu_load_permille;        ///< Share of the CPU not available to the application while the test ran
+    uint32_t turnaround_min_us;        ///< Latency test: shortest time from a packet received to its echo sent
+    uint32_t turnaround_average_us;    ///< Latency test: average turnaround
+    uint32_t turnaround_max_us;        ///< Latency test: longest turnaround
+    void const * p_context;            ///< User defined context passed in the configuration
+} rm_usb_benchmark_result_t;
+
+/** Benchmark configuration. */
+typedef struct st_rm_usb_benchmark_cfg
+{
+    usb_instance_t const * p_usb;           ///< Opened USB instance in peripheral mode
+    rm_usb_benchmark_transport_t transport; ///< Class of the USB instance
+    uint8_t bulk_in_pipe;                   ///< Bulk IN pipe (VENDOR)
+    uint8_t bulk_out_pipe;                  ///< Bulk OUT pipe (VENDOR)
+    uint8_t int_in_pipe;                    ///< Interrupt IN pipe for the latency test, 0 to use the bulk pipes (VENDOR)
+    uint8_t int_out_pipe;                   ///< Interrupt OUT pipe for the latency test, 0 to use the bulk pipes (VENDOR)
+
+    uint8_t * p_buffer;                     ///< Transfer buffer, word aligned, at least the largest transfer size
+    uint32_t  buffer_size;                  ///< Size of p_buffer in bytes, at least RM_USB_BENCHMARK_REPORT_SIZE
+
+ #if (BSP_CFG_RTOS == 2)
+
+    /** Queue of usb_event_info_t pointers, sent by the USB callback with xQueueSend(). */
+    QueueHandle_t event_queue;
+ #endif
+
+    bsp_cycle_counter_get_t p_cycles_get; ///< Cycle counter, NULL to use the DWT cycle counter
+
+    /** Called with each measurement, optional. */
+    void (* p_callback)(rm_usb_benchmark_result_t const * p_result);
+    void const * p_context;            ///< Placeholder for user data, passed back in each result
+} rm_usb_benchmark_cfg_t;
+
+/**********************************************************************************************************************
+ * Public Function Prototypes
+ **********************************************************************************************************************/
+fsp_err_t RM_USB_BENCHMARK_Run(rm_usb_benchmark_cfg_t const * const p_cfg);
+
+/*******************************************************************************************************************//**
+ * @} (end addtogroup RM_USB_BENCHMARK)
+ **********************************************************************************************************************/
+
+/** Common macro for FSP header files. There is also a corresponding FSP_HEADER macro at the top of this file. */
+FSP_FOOTER
+
+#endif                                 /* RM_USB_BENCHMARK_H */
@@ -0,0 +1,207 @@
+#!/usr/bin/env python3
+#
+# Copyright [2020] Renesas Electronics Corporation and/or its affiliates.  All Rights Reserved.
+#
+# This software and documentation are supplied by Renesas Electronics America Inc. and may only be used with products
+# of Renesas Electronics Corp. and its affiliates ("Renesas").  No other uses are authorized.  Renesas products are
+# sold pursuant to Renesas terms and conditions of sale.  Purchasers are solely responsible for the selection and use
+# of Renesas products and Renesas assumes no liability.  No license, express or implied, to any intellectual property
+# right is granted by Renesas. This software is protected under all applicable laws, including copyright laws. Renesas
+# reserves the right to change or discontinue this software and/or this documentation. THE SOFTWARE AND DOCUMENTATION
+# IS DELIVERED TO YOU "AS IS," AND RENESAS MAKES NO REPRESENTATIONS OR WARRANTIES, AND TO THE FULLEST EXTENT
+# PERMISSIBLE UNDER APPLICABLE LAW, DISCLAIMS ALL WARRANTIES, WHETHER EXPLICITLY OR IMPLICITLY, INCLUDING WARRANTIES
+# OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE, AND NONINFRINGEMENT, WITH RESPECT TO THE SOFTWARE OR
+# DOCUMENTATION.  RENESAS SHALL HAVE NO LIABILITY ARISING OUT OF ANY SECURITY VULNERABILITY OR BREACH.  TO THE MAXIMUM
+# EXTENT PERMITTED BY LAW, IN NO EVENT WILL RENESAS BE LIABLE TO YOU IN CONNECTION WITH THE SOFTWARE OR DOCUMENTATION
+# (OR ANY PERSON OR ENTITY CLAIMING RIGHTS DERIVED FROM IT) FOR ANY DAMAGES, INCLUDING WITHOUT LIMITATION, ANY DIRECT,
+# CONSEQUENTIAL, SPECIAL, INDIRECT, PUNITIVE, OR INCIDENTAL DAMAGES; ANY LOST PROFITS, OTHER ECONOMIC DAMAGE,
+# PROPERTY DAMAGE, OR PERSONAL INJURY; AND EVEN IF RENESAS HAS BEEN ADVISED OF THE POSSIBILITY OF SUCH DAMAGES.
+#
+"""Host companion of RM_USB_BENCHMARK_Run().
+
+Drives the device side benchmark over the vendor class (pyusb) or the CDC class (pyserial) and prints one row per
+test with the host and device measurements. The PMSC class is measured host side only, by timing file transfers on
+the mounted drive.
+
+Examples:
+    rm_usb_benchmark_host.py vendor --vid 0x045B --pid 0x0024
+    rm_usb_benchmark_host.py cdc --port /dev/ttyACM0 --sizes 512,4096,16384
+    rm_usb_benchmark_host.py msc --path /media/RA/bench.bin --bytes 8388608
+"""
+
+import argparse
+import os
+import struct
+import sys
+import time
+
+MAGIC = 0x4D425552
+TEST_INFO, TEST_BULK_OUT, TEST_BULK_IN, TEST_LATENCY, TEST_STOP = range(5)
+TEST_NAMES = {TEST_INFO: "info", TEST_BULK_OUT: "bulk-out", TEST_BULK_IN: "bulk-in", TEST_LATENCY: "latency",
+              TEST_STOP: "stop"}
+SPEED_NAMES = {0: "LS", 1: "FS", 2: "HS"}
+REPORT_FORMAT = "<IIiIIIIIIIIIIIII"
+REPORT_SIZE = struct.calcsize(REPORT_FORMAT)
+HEADER = ("test", "spd", "dma", "size", "host kB/s", "dev kB/s", "cpu%", "rtt min/avg/max us",
+          "turn min/avg/max us", "err")
+
+
+class VendorLink:
+    """Bulk (and optional interrupt) endpoints of the first interface of an r_usb_pvnd device."""
+
+    def __init__(self, vid, pid, timeout_ms):
+        import usb.core
+        import usb.util
+
+        self.device = usb.core.find(idVendor=vid, idProduct=pid)
+        if self.device is None:
+            sys.exit("device %04x:%04x not found" % (vid, pid))
+        self.device.set_configuration()
+        interface = self.device.get_active_configuration()[(0, 0)]
+        self.timeout = timeout_ms
+        self.endpoints = {}
+        for endpoint in interface:
+            kind = usb.util.endpoint_type(endpoint.bmAttributes)
+            direction = usb.util.endpoint_direction(endpoint.bEndpointAddress)
+            self.endpoints.setdefault((kind, direction), endpoint)
+        self.bulk_out = self.endpoints[(usb.util.ENDPOINT_TYPE_BULK, usb.util.ENDPOINT_OUT)]
+        self.bulk_in = self.endpoints[(usb.util.ENDPOINT_TYPE_BULK, usb.util.ENDPOINT_IN)]
+        self.int_out = self.endpoints.get((usb.util.ENDPOINT_TYPE_INTR, usb.util.ENDPOINT_OUT), self.bulk_out)
+        self.int_in = self.endpoints.get((usb.util.ENDPOINT_TYPE_INTR, usb.util.ENDPOINT_IN), self.bulk_in)
+
+    def write(self, data, latency=False):
+        (self.int_out if latency else self.bulk_out).write(data, self.timeout)
+
+    def read(self, size, latency=False):
+        return bytes((self.int_in if latency else self.bulk_in).read(size, self.timeout))
+
+
+class CdcLink:
+    """Data interface of an r_usb_pcdc device, opened as a serial port."""
+
+    def __init__(self, port, timeout_ms):
+        import serial
+
+        self.port = serial.Serial(port, timeout=timeout_ms / 1000.0)
+
+    def write(self, data, latency=False):
+        self.port.write(data)
+        self.port.flush()
+
+    def read(self, size, latency=False):
+        data = b""
+        while len(data) < size:
+            chunk = self.port.read(size - len(data))
+            if not chunk:
+                raise TimeoutError("no data from the device")
+            data += chunk
+        return data
+
+
+def run_test(link, test, count, size):
+    """Runs one test and returns the host side figures and the device report."""
+    link.write(struct.pack("<4I", MAGIC, test, count, size))
+    rtts = []
+    start = time.perf_counter()
+    if TEST_BULK_OUT == test:
+        payload = bytes(size)
+        for offset in range(0, count, size):
+            link.write(payload[:min(size, count - offset)])
+    elif TEST_BULK_IN == test:
+        received = 0
+        while received < count:
+            received += len(link.read(min(size, count - received)))
+    elif TEST_LATENCY == test:
+        payload = bytes(size)
+        for _ in range(count):
+            sent = time.perf_counter()
+            link.write(payload, latency=True)
+            link.read(size, latency=True)
+            rtts.append((time.perf_counter() - sent) * 1e6)
+    elapsed = time.perf_counter() - start
+    report = struct.unpack(REPORT_FORMAT, link.read(REPORT_SIZE))
+    if MAGIC != report[0]:
+        raise ValueError("bad report from the device")
+    return elapsed, rtts, report
+
+
+def format_row(test, count, elapsed, rtts, report):
+    (_, _, status, speed, dma, size, _, _, _, _, device_kbps, cpu, turn_min, turn_avg, turn_max, _) = report
+    host_kbps = int(count / elapsed / 1000) if test in (TEST_BULK_OUT, TEST_BULK_IN) and elapsed else 0
+    rtt = "%d/%d/%d" % (min(rtts), sum(rtts) / len(rtts), max(rtts)) if rtts else "-"
+    turn = "%d/%d/%d" % (turn_min, turn_avg, turn_max) if TEST_LATENCY == test else "-"
+    return (TEST_NAMES[test], SPEED_NAMES.get(speed, "?"), "on" if dma else "off", str(size), str(host_kbps),
+            str(device_kbps), "%d.%d" % (cpu // 10, cpu % 10), rtt, turn, str(status))
+
+
+def print_row(row):
+    print("%-9s %3s %3s %6s %10s %10s %5s %20s %20s %4s" % row)
+
+
+def run_matrix(link, args):
+    print_row(HEADER)
+    for size in args.sizes:
+        for test in (TEST_BULK_OUT, TEST_BULK_IN):
+            print_row(format_row(test, args.bytes, *run_test(link, test, args.bytes, size)))
+    for size in args.latency_sizes:
+        print_row(format_row(TEST_LATENCY, args.packets, *run_test(link, TEST_LATENCY, args.packets, size)))
+    if args.stop:
+        run_test(link, TEST_STOP, 0, 0)
+
+
+def run_msc(args):
+    """Times sequential file writes and reads on a drive exposed by r_usb_pmsc."""
+    block = bytes(args.sizes[0])
+    flags = os.O_RDWR | os.O_CREAT | getattr(os, "O_SYNC", 0) | getattr(os, "O_DIRECT", 0)
+    try:
+        fd = os.open(args.path, flags)
+    except OSError:
+        fd = os.open(args.path, os.O_RDWR | os.O_CREAT | getattr(os, "O_SYNC", 0))
+    try:
+        start = time.perf_counter()
+        for _ in range(0, args.bytes, len(block)):
+            os.write(fd, block)
+        os.fsync(fd)
+        write_s = time.perf_counter() - start
+        os.lseek(fd, 0, os.SEEK_SET)
+        start = time.perf_counter()
+        while os.read(fd, len(block)):
+            pass
+        read_s = time.perf_counter() - start
+    finally:
+        os.close(fd)
+    print("msc write %d kB/s, read %d kB/s (reads may be served by the host cache without O_DIRECT)"
+          % (args.bytes / write_s / 1000, args.bytes / read_s / 1000))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("transport", choices=("vendor", "cdc", "msc"))
+    parser.add_argument("--vid", type=lambda x: int(x, 0), default=0x045B, help="vendor class VID")
+    parser.add_argument("--pid", type=lambda x: int(x, 0), default=0x0024, help="vendor class PID")
+    parser.add_argument("--port", help="CDC serial port")
+    parser.add_argument("--path", help="file on the MSC drive")
+    parser.add_argument("--sizes", default="512,4096,16384", help="bulk transfer sizes in bytes")
+    parser.add_argument("--latency-sizes", default="8,64", help="latency packet sizes in bytes")
+    parser.add_argument("--bytes", type=int, default=4 * 1024 * 1024, help="bytes per bulk test")
+    parser.add_argument("--packets", type=int, default=1000, help="packets per latency test")
+    parser.add_argument("--timeout", type=int, default=5000, help="transfer timeout in ms")
+    parser.add_argument("--stop", action="store_true", help="make RM_USB_BENCHMARK_Run() return at the end")
+    args = parser.parse_args()
+    args.sizes = [int(x, 0) for x in args.sizes.split(",")]
+    args.latency_sizes = [int(x, 0) for x in args.latency_sizes.split(",")]
+
+    if "msc" == args.transport:
+        if not args.path:
+            parser.error("--path is required for msc")
+        run_msc(args)
+    elif "cdc" == args.transport:
+        if not args.port:
+            parser.error("--port is required for cdc")
+        run_matrix(CdcLink(args.port, args.timeout), args)
+    else:
+        run_matrix(VendorLink(args.vid, args.pid, args.timeout), args)
+
+
+if __name__ == "__main__":
+    main()
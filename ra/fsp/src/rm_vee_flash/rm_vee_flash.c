@@ -44,6 +44,7 @@
 #define RM_VEE_FLASH_PHYSICAL_END_ADDRESS    (BSP_FEATURE_FLASH_DATA_FLASH_START + BSP_DATA_FLASH_SIZE_BYTES)
 #define RM_VEE_FLASH_REC_OVERHEAD            (sizeof(rm_vee_rec_hdr_t) + sizeof(rm_vee_rec_end_t))
 #define RM_VEE_FLASH_REF_DATA_COUNT          (2)
+#define RM_VEE_FLASH_OFFSET_SRC_SEG          (0x8000U) // rec_offset[] flag: record is in the segment being refreshed
 #if RM_VEE_FLASH_CFG_REF_DATA_SUPPORT
  #define RM_VEE_FLASH_REF_DATA_AREA_SIZE     ((sizeof(rm_vee_ref_hdr_t) + \
                                                (p_ctrl->p_cfg->ref_data_size * RM_VEE_FLASH_REF_DATA_COUNT)))
@@ -100,11 +101,13 @@ typedef enum e_rm_vee_flash_prv_states
     RM_VEE_FLASH_PRV_STATES_WRITE_REFDATA,
     RM_VEE_FLASH_PRV_STATES_WRITE_SEG_HDR,
     RM_VEE_FLASH_PRV_STATES_ERASE_SEG,
+    RM_VEE_FLASH_PRV_STATES_CLAIMED,   // An API function is starting an operation
 } rm_vee_flash_prv_states_t;
 
 typedef enum e_rm_vee_flash_refresh_refresh
 {
     RM_VEE_FLASH_PRV_REFRESH_USER_REQ,
+    RM_VEE_FLASH_PRV_REFRESH_USER_STEP,
     RM_VEE_FLASH_PRV_REFRESH_REFDATA_OVFL,
     RM_VEE_FLASH_PRV_REFRESH_RECORD_OVFL
 } rm_vee_flash_refresh_refresh_t;
@@ -127,6 +130,7 @@ typedef BSP_CMSE_NONSECURE_CALL void (*volatile rm_vee_flash_prv_ns_callback)(rm
 static fsp_err_t rm_vee_internal_open(rm_vee_flash_instance_ctrl_t * const p_ctrl);
 static fsp_err_t rm_vee_inspect_segments(rm_vee_flash_instance_ctrl_t * const p_ctrl);
 static fsp_err_t rm_vee_refresh_next_data_source(rm_vee_flash_instance_ctrl_t * const p_ctrl);
+static fsp_err_t rm_vee_refresh_resume(rm_vee_flash_instance_ctrl_t * const p_ctrl, uint32_t step_records);
 static uint32_t  rm_vee_get_next_id(rm_vee_flash_instance_ctrl_t * const p_ctrl);
 static fsp_err_t rm_vee_restore_previous_seg(rm_vee_flash_instance_ctrl_t * const p_ctrl);
 static fsp_err_t rm_vee_write_seg_hdr(rm_vee_flash_instance_ctrl_t * const p_ctrl);
@@ -134,10 +138,15 @@ static fsp_err_t rm_vee_init_record_xfer(rm_vee_flash_instance_ctrl_t * const p_
 static fsp_err_t rm_vee_xfer_next_chunk(rm_vee_flash_instance_ctrl_t * const p_ctrl, rm_vee_flash_prv_states_t state);
 static void      rm_vee_flash_err_handle(rm_vee_flash_instance_ctrl_t * const p_ctrl, fsp_err_t err);
 static fsp_err_t rm_vee_state_get(rm_vee_flash_instance_ctrl_t * const p_ctrl, rm_vee_state_t * p_state);
+static fsp_err_t rm_vee_state_claim(rm_vee_flash_instance_ctrl_t * const p_ctrl);
+static fsp_err_t rm_vee_state_release(rm_vee_flash_instance_ctrl_t * const p_ctrl);
 static fsp_err_t rm_vee_blocking_erase_segment(rm_vee_flash_instance_ctrl_t * const p_ctrl,
                                                uint32_t                             seg_addr,
                                                bool                                 contains_refdata);
 static fsp_err_t rm_vee_load_record_table(rm_vee_flash_instance_ctrl_t * const p_ctrl, bool initial_load);
+static fsp_err_t rm_vee_find_record_end(rm_vee_flash_instance_ctrl_t * const p_ctrl,
+                                        uint32_t                             start_addr,
+                                        uint32_t                           * p_end_addr);
 static fsp_err_t rm_vee_blocking_blankcheck(rm_vee_flash_instance_ctrl_t * const p_ctrl,
                                             uint32_t                             addr,
                                             uint32_t                             num_bytes,
@@ -163,6 +172,14 @@ static void      rm_vee_init_refdata_xfer(rm_vee_flash_instance_ctrl_t * const p
 
 #endif
 
+#if RM_VEE_FLASH_CFG_CACHE_ENABLE
+static void                         rm_vee_cache_load(rm_vee_flash_instance_ctrl_t * const p_ctrl);
+static rm_vee_flash_cache_entry_t * rm_vee_cache_entry_get(rm_vee_flash_instance_ctrl_t * const p_ctrl,
+                                                           uint32_t                             rec_id);
+static fsp_err_t rm_vee_cache_flush_next(rm_vee_flash_instance_ctrl_t * const p_ctrl);
+
+#endif
+
 void rm_vee_flash_callback(flash_callback_args_t * p_args);
 
 const rm_vee_api_t g_rm_vee_on_flash =
@@ -231,6 +248,23 @@ fsp_err_t RM_VEE_FLASH_Open (rm_vee_ctrl_t * const p_api_ctrl, rm_vee_cfg_t cons
     FSP_ERROR_RETURN(0 == (p_cfg->total_size % p_cfg->num_segments), FSP_ERR_INVALID_ARGUMENT);
     FSP_ERROR_RETURN(0 == ((p_cfg->total_size / p_cfg->num_segments) % 4), FSP_ERR_INVALID_ARGUMENT);
     FSP_ERROR_RETURN(0 == (p_cfg->ref_data_size % RM_VEE_FLASH_DF_WRITE_SIZE), FSP_ERR_INVALID_ARGUMENT);
+
+    /* Record offsets must leave the top bit free to mark records that are still in the segment being refreshed */
+    FSP_ERROR_RETURN(RM_VEE_FLASH_OFFSET_SRC_SEG >= (p_cfg->total_size / p_cfg->num_segments),
+                     FSP_ERR_INVALID_ARGUMENT);
+
+ #if RM_VEE_FLASH_CFG_CACHE_ENABLE
+    rm_vee_flash_cfg_t const * p_extend = (rm_vee_flash_cfg_t const *) p_cfg->p_extend;
+    FSP_ASSERT((0U == p_extend->cache_entries) || (NULL != p_extend->p_cache));
+    for (i = 0; i < p_extend->cache_entries; i++)
+    {
+        /* Cached records must be valid record IDs and fit in a record write */
+        FSP_ASSERT(NULL != p_extend->p_cache[i].p_data);
+        FSP_ERROR_RETURN(p_extend->p_cache[i].rec_id <= p_cfg->record_max_id, FSP_ERR_INVALID_ARGUMENT);
+        FSP_ERROR_RETURN(0 != p_extend->p_cache[i].size, FSP_ERR_INVALID_ARGUMENT);
+        FSP_ERROR_RETURN(0 == (p_extend->p_cache[i].size % RM_VEE_FLASH_DF_WRITE_SIZE), FSP_ERR_INVALID_ARGUMENT);
+    }
+ #endif
 #endif
 
     p_ctrl->p_cfg        = p_cfg;
@@ -311,6 +345,12 @@ fsp_err_t RM_VEE_FLASH_Open (rm_vee_ctrl_t * const p_api_ctrl, rm_vee_cfg_t cons
         p_ctrl->mode = RM_VEE_FLASH_PRV_MODE_NORMAL;
 
         p_ctrl->open = RM_VEE_FLASH_OPEN;
+
+#if RM_VEE_FLASH_CFG_CACHE_ENABLE
+
+        /* Start the write-back cache with the records currently in data flash */
+        rm_vee_cache_load(p_ctrl);
+#endif
     }
 
     return err;
@@ -326,12 +366,19 @@ fsp_err_t RM_VEE_FLASH_Open (rm_vee_ctrl_t * const p_api_ctrl, rm_vee_cfg_t cons
  * includes exiting the calling function when the data buffer is a local variable (stack may be used by another function
  * and corrupt the data buffer contents).
  *
+ * While a stepped Refresh is paused, the record is written to the segment being refreshed. If that segment has no
+ * space left, the rest of the Refresh is started, FSP_ERR_IN_USE is returned and the record must be written again
+ * after the Refresh completes.
+ *
+ * Records in the write-back cache (RM_VEE_FLASH_CFG_CACHE_ENABLE) are only copied to RAM and marked dirty, so the data
+ * buffer may be reused as soon as this function returns. They reach data flash in RM_VEE_FLASH_CacheFlush().
+ *
  * @retval FSP_SUCCESS               Write started successfully.
  * @retval FSP_ERR_NOT_OPEN          The module has not been opened.
  * @retval FSP_ERR_ASSERTION         An input parameter is NULL.
  * @retval FSP_ERR_INVALID_ARGUMENT  An argument contains an illegal value.
  * @retval FSP_ERR_INVALID_MODE      The operation cannot be started in the current mode.
- * @retval FSP_ERR_IN_USE            Last API call still executing.
+ * @retval FSP_ERR_IN_USE            Last API call still executing, or a paused Refresh had to be completed.
  * @retval FSP_ERR_PE_FAILURE        This error indicates that a flash programming, erase, or blankcheck operation has failed
  *                                   in hardware.
  * @retval FSP_ERR_TIMEOUT           Flash write timed out (Should not be possible when flash bgo is used).
@@ -358,11 +405,52 @@ fsp_err_t RM_VEE_FLASH_RecordWrite (rm_vee_ctrl_t * const p_api_ctrl,
 
     FSP_ERROR_RETURN(RM_VEE_FLASH_PRV_MODE_OVERFLOW != p_ctrl->mode, FSP_ERR_INVALID_MODE);
     FSP_ERROR_RETURN(RM_VEE_FLASH_PRV_MODE_FLASH_PE_FAIL != p_ctrl->mode, FSP_ERR_INVALID_MODE);
-    FSP_ERROR_RETURN(RM_VEE_FLASH_PRV_STATES_READY == p_ctrl->state, FSP_ERR_IN_USE);
 #endif
 
-    fsp_err_t err = rm_vee_internal_write_rec(p_ctrl, rec_id, p_rec_data, num_bytes);
+#if RM_VEE_FLASH_CFG_CACHE_ENABLE
+    rm_vee_flash_cache_entry_t * p_entry = rm_vee_cache_entry_get(p_ctrl, rec_id);
+    if (NULL != p_entry)
+    {
+        FSP_ERROR_RETURN(num_bytes <= p_entry->size, FSP_ERR_INVALID_ARGUMENT);
+
+        /* The entry must not change while its flash write is reading it, which the flash interrupt may start. */
+        FSP_CRITICAL_SECTION_DEFINE;
+        FSP_CRITICAL_SECTION_ENTER;
+        bool flushing = (p_entry == p_ctrl->p_cache_flushing);
+        if (!flushing)
+        {
+            memcpy(p_entry->p_data, p_rec_data, num_bytes);
+            p_entry->length = num_bytes;
+            p_entry->dirty  = true;
+        }
+
+        FSP_CRITICAL_SECTION_EXIT;
+
+        FSP_ERROR_RETURN(!flushing, FSP_ERR_IN_USE);
+
+        return FSP_SUCCESS;
+    }
+#endif
+
+    /* A flush started from an interrupt must not start a second write at the same address. */
+    fsp_err_t err = rm_vee_state_claim(p_ctrl);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+    if (p_ctrl->refresh_paused &&
+        ((p_ctrl->next_write_addr + RM_VEE_FLASH_REC_OVERHEAD + num_bytes) > p_ctrl->ref_hdr_addr))
+    {
+        /* No space left in the segment being refreshed. Move the remaining records now. */
+        err = rm_vee_refresh_resume(p_ctrl, UINT32_MAX);
+        rm_vee_flash_err_handle(p_ctrl, err);
+        (void) rm_vee_state_release(p_ctrl);
+        FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+        return FSP_ERR_IN_USE;
+    }
+
+    err = rm_vee_internal_write_rec(p_ctrl, rec_id, p_rec_data, num_bytes);
     rm_vee_flash_err_handle(p_ctrl, err);
+    (void) rm_vee_state_release(p_ctrl);
 
     return err;
 }
@@ -378,7 +466,7 @@ fsp_err_t RM_VEE_FLASH_RecordWrite (rm_vee_ctrl_t * const p_api_ctrl,
  *
  * @retval FSP_SUCCESS               Write started successfully.
  * @retval FSP_ERR_NOT_OPEN          The module has not been opened.
- * @retval FSP_ERR_IN_USE            Last API call still executing.
+ * @retval FSP_ERR_IN_USE            Last API call still executing or a Refresh is in progress.
  * @retval FSP_ERR_ASSERTION         An input parameter is NULL.
  * @retval FSP_ERR_INVALID_MODE      The operation cannot be started in the current mode.
  * @retval FSP_ERR_PE_FAILURE        This error indicates that a flash programming, erase, or blankcheck operation has failed
@@ -399,11 +487,21 @@ fsp_err_t RM_VEE_FLASH_RefDataWrite (rm_vee_ctrl_t * const p_api_ctrl, uint8_t c
 
     FSP_ERROR_RETURN(RM_VEE_FLASH_PRV_MODE_OVERFLOW != p_ctrl->mode, FSP_ERR_INVALID_MODE);
     FSP_ERROR_RETURN(RM_VEE_FLASH_PRV_MODE_FLASH_PE_FAIL != p_ctrl->mode, FSP_ERR_INVALID_MODE);
-    FSP_ERROR_RETURN(RM_VEE_FLASH_PRV_STATES_READY == p_ctrl->state, FSP_ERR_IN_USE);
 
     FSP_ERROR_RETURN(0 < p_ctrl->p_cfg->ref_data_size, FSP_ERR_UNSUPPORTED);
  #endif
 
+    err = rm_vee_state_claim(p_ctrl);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+    /* Reference data cannot be updated while a stepped Refresh is paused */
+    if (RM_VEE_FLASH_PRV_MODE_REFRESH == p_ctrl->mode)
+    {
+        (void) rm_vee_state_release(p_ctrl);
+
+        return FSP_ERR_IN_USE;
+    }
+
     if (false == p_ctrl->new_refdata_valid)
     {
         /* Initiate refdata write */
@@ -424,6 +522,7 @@ fsp_err_t RM_VEE_FLASH_RefDataWrite (rm_vee_ctrl_t * const p_api_ctrl, uint8_t c
     }
 
     rm_vee_flash_err_handle(p_ctrl, err);
+    (void) rm_vee_state_release(p_ctrl);
 
     return err;
 #else
@@ -458,6 +557,7 @@ fsp_err_t RM_VEE_FLASH_RecordPtrGet (rm_vee_ctrl_t * const p_api_ctrl,
     rm_vee_rec_hdr_t * p_hdr;
     fsp_err_t          err;
     uint32_t           addr;
+    uint32_t           offset;
     rm_vee_flash_instance_ctrl_t * const p_ctrl = (rm_vee_flash_instance_ctrl_t *) p_api_ctrl;
 
 #if (RM_VEE_FLASH_CFG_PARAM_CHECKING_ENABLE)
@@ -466,16 +566,44 @@ fsp_err_t RM_VEE_FLASH_RecordPtrGet (rm_vee_ctrl_t * const p_api_ctrl,
     FSP_ASSERT(pp_rec_data);
     FSP_ASSERT(p_num_bytes);
     FSP_ERROR_RETURN(p_ctrl->p_cfg->record_max_id >= rec_id, FSP_ERR_INVALID_ARGUMENT);
+#endif
+
+#if RM_VEE_FLASH_CFG_CACHE_ENABLE
+
+    /* Cached records are read from RAM, which is not blocked by flash operations */
+    rm_vee_flash_cache_entry_t * p_entry = rm_vee_cache_entry_get(p_ctrl, rec_id);
+    if (NULL != p_entry)
+    {
+        FSP_ERROR_RETURN(0 != p_entry->length, FSP_ERR_NOT_FOUND);
+
+        *pp_rec_data = p_entry->p_data;
+        *p_num_bytes = p_entry->length;
+
+        return FSP_SUCCESS;
+    }
+#endif
+
+#if (RM_VEE_FLASH_CFG_PARAM_CHECKING_ENABLE)
     FSP_ERROR_RETURN(RM_VEE_FLASH_PRV_STATES_READY == p_ctrl->state, FSP_ERR_IN_USE);
 #endif
 
-    if (0 == p_ctrl->p_cfg->rec_offset[rec_id])
+    offset = p_ctrl->p_cfg->rec_offset[rec_id];
+
+    if (0 == offset)
     {
         err = FSP_ERR_NOT_FOUND;
     }
     else
     {
-        addr = p_ctrl->active_seg_addr + p_ctrl->p_cfg->rec_offset[rec_id];
+        /* Records not yet moved by a paused Refresh are still in the previous segment */
+        if (offset & RM_VEE_FLASH_OFFSET_SRC_SEG)
+        {
+            addr = p_ctrl->refresh_src_seg_addr + (offset & ~RM_VEE_FLASH_OFFSET_SRC_SEG);
+        }
+        else
+        {
+            addr = p_ctrl->active_seg_addr + offset;
+        }
 
         /* Load start of record data and its length */
         p_hdr        = (rm_vee_rec_hdr_t *) addr;
@@ -517,7 +645,12 @@ fsp_err_t RM_VEE_FLASH_RefDataPtrGet (rm_vee_ctrl_t * const p_api_ctrl, uint8_t
     FSP_ERROR_RETURN(0 < p_ctrl->p_cfg->ref_data_size, FSP_ERR_UNSUPPORTED);
  #endif
 
-    if (true == p_ctrl->new_refdata_valid)
+    if (RM_VEE_FLASH_PRV_MODE_REFRESH == p_ctrl->mode)
+    {
+        /* Reference data is copied last, so a paused Refresh still uses the previous reference data */
+        *pp_ref_data = (uint8_t *) p_ctrl->refresh_src_refdata_addr;
+    }
+    else if (true == p_ctrl->new_refdata_valid)
     {
         *pp_ref_data =
             (uint8_t *) (p_ctrl->active_seg_addr + (p_ctrl->segment_size - (2 * p_ctrl->p_cfg->ref_data_size)));
@@ -549,6 +682,11 @@ fsp_err_t RM_VEE_FLASH_RefDataPtrGet (rm_vee_ctrl_t * const p_api_ctrl, uint8_t
  * when no more record or reference data space is available and a Write is requested. However, the app may desire to
  * force a refresh when it knows it is running low on space and large amounts of data are about to be recorded.
  *
+ * If rm_vee_flash_cfg_t::refresh_step_records is not 0, each call moves at most that many records to the new segment
+ * and then pauses the Refresh. The callback is called with RM_VEE_STATE_REFRESH when the step completes. Records can be
+ * read and written while the Refresh is paused; call this function again to move the next records. Start the Refresh
+ * before the segment is full so that records written while it is paused fit in the previous segment.
+ *
  * @retval FSP_SUCCESS               Successful.
  * @retval FSP_ERR_NOT_OPEN          The module has not been opened.
  * @retval FSP_ERR_ASSERTION         An input parameter is NULL.
@@ -568,11 +706,28 @@ fsp_err_t RM_VEE_FLASH_Refresh (rm_vee_ctrl_t * const p_api_ctrl)
 
     FSP_ERROR_RETURN(RM_VEE_FLASH_PRV_MODE_OVERFLOW != p_ctrl->mode, FSP_ERR_INVALID_MODE);
     FSP_ERROR_RETURN(RM_VEE_FLASH_PRV_MODE_FLASH_PE_FAIL != p_ctrl->mode, FSP_ERR_INVALID_MODE);
-    FSP_ERROR_RETURN(RM_VEE_FLASH_PRV_STATES_READY == p_ctrl->state, FSP_ERR_IN_USE);
 #endif
 
-    fsp_err_t err = rm_vee_start_seg_refresh(p_ctrl, RM_VEE_FLASH_PRV_REFRESH_USER_REQ, 0, 0, 0);
+    uint32_t  step_records = ((rm_vee_flash_cfg_t *) p_ctrl->p_cfg->p_extend)->refresh_step_records;
+    fsp_err_t err          = rm_vee_state_claim(p_ctrl);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+
+    if (p_ctrl->refresh_paused)
+    {
+        /* Move the next records */
+        err = rm_vee_refresh_resume(p_ctrl, step_records);
+    }
+    else if (0 != step_records)
+    {
+        err = rm_vee_start_seg_refresh(p_ctrl, RM_VEE_FLASH_PRV_REFRESH_USER_STEP, 0, 0, 0);
+    }
+    else
+    {
+        err = rm_vee_start_seg_refresh(p_ctrl, RM_VEE_FLASH_PRV_REFRESH_USER_REQ, 0, 0, 0);
+    }
+
     rm_vee_flash_err_handle(p_ctrl, err);
+    (void) rm_vee_state_release(p_ctrl);
 
     return err;
 }
@@ -596,8 +751,15 @@ fsp_err_t RM_VEE_FLASH_Format (rm_vee_ctrl_t * const p_api_ctrl, uint8_t const *
 #if (RM_VEE_FLASH_CFG_PARAM_CHECKING_ENABLE)
     FSP_ASSERT(p_ctrl);
     FSP_ERROR_RETURN(RM_VEE_FLASH_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
-    FSP_ERROR_RETURN(RM_VEE_FLASH_PRV_STATES_READY == p_ctrl->state, FSP_ERR_IN_USE);
 #endif
+    FSP_ERROR_RETURN(FSP_SUCCESS == rm_vee_state_claim(p_ctrl), FSP_ERR_IN_USE);
+
+    /* A paused Refresh is abandoned because every segment is erased */
+    if (RM_VEE_FLASH_PRV_MODE_REFRESH == p_ctrl->mode)
+    {
+        p_ctrl->mode = RM_VEE_FLASH_PRV_MODE_NORMAL;
+    }
+
     p_ctrl->state = RM_VEE_FLASH_PRV_STATES_UNINITIALIZED;
     fsp_err_t err =
         rm_vee_blocking_erase(p_ctrl,
@@ -623,6 +785,14 @@ fsp_err_t RM_VEE_FLASH_Format (rm_vee_ctrl_t * const p_api_ctrl, uint8_t const *
         err = rm_vee_internal_open(p_ctrl);
     }
 
+#if RM_VEE_FLASH_CFG_CACHE_ENABLE
+    if (FSP_SUCCESS == err)
+    {
+        /* Cached records were erased too */
+        rm_vee_cache_load(p_ctrl);
+    }
+#endif
+
     rm_vee_flash_err_handle(p_ctrl, err);
 
     return err;
@@ -733,6 +903,10 @@ fsp_err_t RM_VEE_FLASH_Close (rm_vee_ctrl_t * const p_api_ctrl)
 
     p_ctrl->open = 0;
 
+#if RM_VEE_FLASH_CFG_CACHE_ENABLE
+    p_ctrl->cache_flush = false;
+#endif
+
     p_ctrl->p_flash->p_api->close(p_ctrl->p_flash->p_ctrl);
 
     p_ctrl->mode  = RM_VEE_FLASH_PRV_MODE_NORMAL;
@@ -760,6 +934,73 @@ fsp_err_t RM_VEE_FLASH_VersionGet (fsp_version_t * const p_version)
     return FSP_SUCCESS;
 }
 
+/*******************************************************************************************************************//**
+ * Writes the dirty records of the write-back cache to data flash.
+ *
+ * The records are written one after the other from the flash interrupt, after any operation in progress. The
+ * callback is called once all of them are written. This function may be called from an interrupt, e.g. periodically
+ * from a timer, before shutting down or from rm_vee_flash_lvd_callback() when the supply voltage drops.
+ *
+ * @retval FSP_SUCCESS               Flush started, or no record was dirty.
+ * @retval FSP_ERR_NOT_OPEN          The module has not been opened.
+ * @retval FSP_ERR_ASSERTION         An input parameter is NULL.
+ * @retval FSP_ERR_INVALID_MODE      The records cannot be written in the current mode.
+ * @retval FSP_ERR_UNSUPPORTED       RM_VEE_FLASH_CFG_CACHE_ENABLE is not set.
+ * @retval FSP_ERR_PE_FAILURE        This error indicates that a flash programming, erase, or blankcheck operation has failed
+ *                                   in hardware.
+ * @retval FSP_ERR_TIMEOUT           Flash write timed out (Should not be possible when flash bgo is used).
+ * @retval FSP_ERR_NOT_INITIALIZED   Corruption found. A refresh is required.
+ **********************************************************************************************************************/
+fsp_err_t RM_VEE_FLASH_CacheFlush (rm_vee_ctrl_t * const p_api_ctrl)
+{
+#if RM_VEE_FLASH_CFG_CACHE_ENABLE
+    rm_vee_flash_instance_ctrl_t * const p_ctrl = (rm_vee_flash_instance_ctrl_t *) p_api_ctrl;
+
+ #if (RM_VEE_FLASH_CFG_PARAM_CHECKING_ENABLE)
+    FSP_ASSERT(p_ctrl);
+    FSP_ERROR_RETURN(RM_VEE_FLASH_OPEN == p_ctrl->open, FSP_ERR_NOT_OPEN);
+ #endif
+    FSP_ERROR_RETURN(RM_VEE_FLASH_PRV_MODE_OVERFLOW != p_ctrl->mode, FSP_ERR_INVALID_MODE);
+    FSP_ERROR_RETURN(RM_VEE_FLASH_PRV_MODE_FLASH_PE_FAIL != p_ctrl->mode, FSP_ERR_INVALID_MODE);
+
+    fsp_err_t err = FSP_SUCCESS;
+
+    p_ctrl->cache_flush = true;
+
+    /* Otherwise the flush continues when the operation in progress completes, or when the API function that claimed
+     * the driver releases it. */
+    if (FSP_SUCCESS == rm_vee_state_claim(p_ctrl))
+    {
+        err = rm_vee_state_release(p_ctrl);
+    }
+
+    return err;
+#else
+    FSP_PARAMETER_NOT_USED(p_api_ctrl);
+
+    return FSP_ERR_UNSUPPORTED;
+#endif
+}
+
+#if RM_VEE_FLASH_CFG_CACHE_ENABLE
+
+/*******************************************************************************************************************//**
+ * Voltage monitor callback starting an emergency flush of the write-back cache. Set it as the r_lvd callback with the
+ * VEE control block as context, and set the voltage threshold high enough for the hold-up time to cover writing all
+ * cached records (and a Refresh, which may have to complete first).
+ *
+ * @param[in]  p_args                  Callback arguments, p_context points to the VEE control block.
+ **********************************************************************************************************************/
+void rm_vee_flash_lvd_callback (lvd_callback_args_t * p_args)
+{
+    if (LVD_CURRENT_STATE_BELOW_THRESHOLD == p_args->current_state)
+    {
+        (void) RM_VEE_FLASH_CacheFlush((rm_vee_ctrl_t *) p_args->p_context);
+    }
+}
+
+#endif
+
 /*******************************************************************************************************************//**
  * @} (end defgroup RM_VEE_FLASH)
  **********************************************************************************************************************/
@@ -784,8 +1025,9 @@ static fsp_err_t rm_vee_internal_open (rm_vee_flash_instance_ctrl_t * const p_ct
     memset((void *) &p_ctrl->p_cfg->rec_offset[0], 0,
            ((p_ctrl->p_cfg->record_max_id + 1) * sizeof(p_ctrl->p_cfg->rec_offset[0])));
 
-    p_ctrl->irq_flag = false;
-    p_ctrl->last_id  = (uint16_t) RM_VEE_FLASH_ID_INVALID;
+    p_ctrl->irq_flag       = false;
+    p_ctrl->last_id        = (uint16_t) RM_VEE_FLASH_ID_INVALID;
+    p_ctrl->refresh_paused = false;
 
     /* Determine active segment and erase incomplete segments if any (refresh or erase interrupted). */
     err = rm_vee_inspect_segments(p_ctrl);
@@ -986,7 +1228,8 @@ static fsp_err_t rm_vee_blocking_erase_segment (rm_vee_flash_instance_ctrl_t * c
 /*******************************************************************************************************************//**
  * This function walks through the active segment and loads the offset for the start of each record found
  * into p_ctrl->rec_offset[] using the record ID as the array index. When the last record is found,
- * p_ctrl->next_write_addr is loaded with the next available address to write a record to.
+ * p_ctrl->next_write_addr is loaded with the next available address to write a record to. The end of the
+ * record area is found before the walk, so no flash operation is needed for each record.
  *
  * @param  p_ctrl                   Pointer to the control block
  * @param  initial_load             true = Use blankcheck to determine end of record area.
@@ -1004,8 +1247,8 @@ static fsp_err_t rm_vee_load_record_table (rm_vee_flash_instance_ctrl_t * const
     rm_vee_rec_hdr_t * p_hdr;
     fsp_err_t          err = FSP_SUCCESS;
     uint32_t           addr;
+    uint32_t           end_addr;
     rm_vee_rec_end_t * p_end;
-    flash_event_t      event = FLASH_EVENT_BLANK;
 
     /* Get start of record area */
     addr = p_ctrl->active_seg_addr + sizeof(rm_vee_seg_hdr_t);;
@@ -1014,30 +1257,21 @@ static fsp_err_t rm_vee_load_record_table (rm_vee_flash_instance_ctrl_t * const
     p_ctrl->ref_hdr_addr  = p_ctrl->active_seg_addr + p_ctrl->segment_size;
     p_ctrl->ref_hdr_addr -= RM_VEE_FLASH_REF_DATA_AREA_SIZE;
 
-    /* Loop through every record until find empty space */
-    while (addr < p_ctrl->ref_hdr_addr)
+    if (initial_load == true)
     {
-        /* Exit loop when no more records found */
-        if (initial_load == true)
-        {
-            /* When this function is called by Open() or VEE_CMD_FORMAT, stop when find blank flash */
-            err = rm_vee_blocking_blankcheck(p_ctrl, addr, RM_VEE_FLASH_DF_WRITE_SIZE, &event);
-            FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
-
-            if (FLASH_EVENT_BLANK == event)
-            {
-                break;
-            }
-        }
-        else
-        {
-            /* When this function is called by failed Refresh, stop when at end address from original segment */
-            if (addr == p_ctrl->refresh_src_rec_end_addr)
-            {
-                break;
-            }
-        }
+        /* When this function is called by Open() or VEE_CMD_FORMAT, stop at the start of blank flash */
+        err = rm_vee_find_record_end(p_ctrl, addr, &end_addr);
+        FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
+    }
+    else
+    {
+        /* When this function is called by failed Refresh, stop when at end address from original segment */
+        end_addr = p_ctrl->refresh_src_rec_end_addr;
+    }
 
+    /* Loop through every record until find empty space */
+    while (addr < end_addr)
+    {
         /* Get trailer for current record */
         p_hdr = (rm_vee_rec_hdr_t *) addr;
 
@@ -1070,6 +1304,12 @@ static fsp_err_t rm_vee_load_record_table (rm_vee_flash_instance_ctrl_t * const
         addr = (uint32_t) p_end + sizeof(rm_vee_rec_end_t);
     }
 
+    /* The last record must end exactly where blank flash starts */
+    if ((FSP_SUCCESS == err) && (addr != end_addr))
+    {
+        err = FSP_ERR_NOT_INITIALIZED;
+    }
+
     /* NOTE: The Refresh process copies records from locations identified by p_ctrl->p_cfg->rec_offset[].
      * During the Refresh process, the array is updated for the new record locations in the new segment.
      * Should the Refresh process fail, the array will contain a mixture of offsets from both segments.
@@ -1088,6 +1328,52 @@ static fsp_err_t rm_vee_load_record_table (rm_vee_flash_instance_ctrl_t * const
     return err;
 }
 
+/*******************************************************************************************************************//**
+ * This function finds the end of the record data in the active segment. Records are written back to back from the
+ * start of the record area, so the record area is blank from the end of the last record onwards. The end is found by
+ * a binary search using blankchecks of the rest of the record area, which takes a number of flash operations that
+ * depends only on the segment size instead of one blankcheck per record.
+ *
+ * @param  p_ctrl                   Pointer to the control block
+ * @param  start_addr               Start of the record area
+ * @param  p_end_addr               Destination loaded with the address of the first byte after the last record
+ *
+ * @retval FSP_SUCCESS              Successful.
+ * @retval FSP_ERR_PE_FAILURE       This error indicates that a flash programming, erase, or blankcheck operation has failed
+ * @retval FSP_ERR_TIMEOUT          Flash write timed out (Should not be possible when flash bgo is used).
+ **********************************************************************************************************************/
+static fsp_err_t rm_vee_find_record_end (rm_vee_flash_instance_ctrl_t * const p_ctrl,
+                                         uint32_t                             start_addr,
+                                         uint32_t                           * p_end_addr)
+{
+    fsp_err_t     err  = FSP_SUCCESS;
+    uint32_t      low  = start_addr;
+    uint32_t      high = p_ctrl->ref_hdr_addr;
+    uint32_t      mid;
+    flash_event_t event = FLASH_EVENT_NOT_BLANK;
+
+    /* Everything from "high" to the end of the record area is known to be blank */
+    while ((low < high) && (FSP_SUCCESS == err))
+    {
+        mid = low + ((((high - low) / RM_VEE_FLASH_DF_WRITE_SIZE) / 2) * RM_VEE_FLASH_DF_WRITE_SIZE);
+
+        err = rm_vee_blocking_blankcheck(p_ctrl, mid, p_ctrl->ref_hdr_addr - mid, &event);
+
+        if (FLASH_EVENT_BLANK == event)
+        {
+            high = mid;
+        }
+        else
+        {
+            low = mid + RM_VEE_FLASH_DF_WRITE_SIZE;
+        }
+    }
+
+    *p_end_addr = high;
+
+    return err;
+}
+
 #if RM_VEE_FLASH_CFG_REF_DATA_SUPPORT
 
 /*******************************************************************************************************************//**
@@ -1352,7 +1638,15 @@ static fsp_err_t rm_vee_internal_write_rec (rm_vee_flash_instance_ctrl_t * const
          * It serves the purpose of "passing a value" to the callback function for efficiency in avoiding
          * a lengthy calculation later.
          */
-        p_ctrl->rec_hdr.offset = (uint16_t) (p_ctrl->next_write_addr - p_ctrl->active_seg_addr);
+        if (p_ctrl->refresh_paused)
+        {
+            /* Written to the segment being refreshed; the record is moved when the Refresh is resumed */
+            p_ctrl->rec_hdr.offset = (uint16_t) (p_ctrl->next_write_addr - p_ctrl->refresh_src_seg_addr);
+        }
+        else
+        {
+            p_ctrl->rec_hdr.offset = (uint16_t) (p_ctrl->next_write_addr - p_ctrl->active_seg_addr);
+        }
 
         /* Initiate record write */
         p_ctrl->state      = RM_VEE_FLASH_PRV_STATES_WRITE_REC_HDR;
@@ -1410,6 +1704,27 @@ static fsp_err_t rm_vee_start_seg_refresh (rm_vee_flash_instance_ctrl_t * const
     p_ctrl->mode         = RM_VEE_FLASH_PRV_MODE_REFRESH;
     p_ctrl->refresh_type = refresh_type;
 
+    /* Only a Refresh started by RM_VEE_FLASH_Refresh pauses. The first record is started below. */
+    if (RM_VEE_FLASH_PRV_REFRESH_USER_STEP == refresh_type)
+    {
+        p_ctrl->refresh_step_left = ((rm_vee_flash_cfg_t *) p_ctrl->p_cfg->p_extend)->refresh_step_records - 1U;
+    }
+    else
+    {
+        p_ctrl->refresh_step_left = UINT32_MAX;
+    }
+
+    /* Mark every record as still in the previous segment. The mark is cleared when the record is moved. */
+    p_ctrl->refresh_remaining = 0;
+    for (uint32_t i = 0; i <= p_ctrl->p_cfg->record_max_id; i++)
+    {
+        if (p_ctrl->p_cfg->rec_offset[i] != 0)
+        {
+            p_ctrl->p_cfg->rec_offset[i] |= RM_VEE_FLASH_OFFSET_SRC_SEG;
+            p_ctrl->refresh_remaining++;
+        }
+    }
+
     /* Determine first record ID to refresh if not passed in */
     if (RM_VEE_FLASH_PRV_REFRESH_RECORD_OVFL != refresh_type)
     {
@@ -1463,7 +1778,8 @@ static fsp_err_t rm_vee_start_seg_refresh (rm_vee_flash_instance_ctrl_t * const
 
         /* NOTE: "start_rec_id" is the ID (index of p_ctrl->p_cfg->rec_offset[]) of the first record copied.
          * Refresh walks through p_ctrl->p_cfg->rec_offset[] (including wrap around) using "cur_rec_id" as the index.
-         * When "cur_rec_id" matches "start_rec_id" again, record copying is complete.
+         * Record copying is complete when no record is marked with RM_VEE_FLASH_OFFSET_SRC_SEG
+         * (p_ctrl->refresh_remaining is 0). A record written while a stepped Refresh is paused is marked again.
          */
         p_ctrl->refresh_start_rec_id = (uint16_t) rec_id;
         p_ctrl->refresh_cur_rec_id   = (uint16_t) rec_id;
@@ -1648,6 +1964,25 @@ void rm_vee_flash_callback (flash_callback_args_t * p_args)
                 p_ctrl->last_id          = p_ctrl->rec_end.id;
                 p_ctrl->next_write_addr += sizeof(rm_vee_rec_end_t);
 
+                uint16_t previous_offset = p_ctrl->p_cfg->rec_offset[p_ctrl->rec_end.id];
+
+                if (p_ctrl->refresh_paused)
+                {
+                    /* Written to the segment being refreshed. Move it again if it was already moved. */
+                    p_ctrl->p_cfg->rec_offset[p_ctrl->rec_end.id] =
+                        (uint16_t) (p_ctrl->rec_hdr.offset | RM_VEE_FLASH_OFFSET_SRC_SEG);
+
+                    if (0 == (previous_offset & RM_VEE_FLASH_OFFSET_SRC_SEG))
+                    {
+                        p_ctrl->refresh_remaining++;
+                    }
+
+                    p_ctrl->refresh_src_rec_end_addr = p_ctrl->next_write_addr;
+                    p_ctrl->state = RM_VEE_FLASH_PRV_STATES_READY;
+
+                    break;
+                }
+
                 p_ctrl->p_cfg->rec_offset[p_ctrl->rec_end.id] = p_ctrl->rec_hdr.offset;
 
                 if (RM_VEE_FLASH_PRV_MODE_NORMAL == p_ctrl->mode)
@@ -1660,6 +1995,12 @@ void rm_vee_flash_callback (flash_callback_args_t * p_args)
                 }
                 else
                 {
+                    /* The record written at the start of the Refresh replaces the one in the previous segment */
+                    if (previous_offset & RM_VEE_FLASH_OFFSET_SRC_SEG)
+                    {
+                        p_ctrl->refresh_remaining--;
+                    }
+
                     /* Begin copying next rec, refdata; or write segment hdr */
                     err = rm_vee_refresh_next_data_source(p_ctrl);
                 }
@@ -1780,6 +2121,37 @@ void rm_vee_flash_callback (flash_callback_args_t * p_args)
 
     rm_vee_flash_err_handle(p_ctrl, err);
 
+#if RM_VEE_FLASH_CFG_CACHE_ENABLE
+
+    /* The voltage monitor interrupt may preempt this one to start a flush, so check the state with it masked. */
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+
+    if (RM_VEE_FLASH_PRV_STATES_READY == p_ctrl->state)
+    {
+        if ((NULL != p_ctrl->p_cache_flushing) && (RM_VEE_FLASH_PRV_MODE_FLASH_PE_FAIL == p_ctrl->mode))
+        {
+            /* The cached record did not reach data flash */
+            p_ctrl->p_cache_flushing->dirty = true;
+        }
+
+        p_ctrl->p_cache_flushing = NULL;
+
+        if (p_ctrl->cache_flush && (RM_VEE_FLASH_PRV_MODE_OVERFLOW != p_ctrl->mode) &&
+            (RM_VEE_FLASH_PRV_MODE_FLASH_PE_FAIL != p_ctrl->mode))
+        {
+            err = rm_vee_cache_flush_next(p_ctrl);
+            rm_vee_flash_err_handle(p_ctrl, err);
+        }
+        else
+        {
+            p_ctrl->cache_flush = false;
+        }
+    }
+
+    FSP_CRITICAL_SECTION_EXIT;
+#endif
+
     if ((RM_VEE_FLASH_PRV_STATES_READY == p_ctrl->state) && (NULL != p_ctrl->p_callback))
     {
         rm_vee_callback_args_t args;
@@ -1804,6 +2176,7 @@ static void rm_vee_flash_err_handle (rm_vee_flash_instance_ctrl_t * const p_ctrl
  * This function determines the next ID with a record in flash. If it has yet to be copied to the new
  * segment, the write process is started. If all records have been copied, a write is started for the most
  * recent reference data. If no reference data is present, a write is started for the segment header.
+ * If the number of records for this step of a stepped Refresh have been copied, the Refresh is paused.
  *
  * @param  p_ctrl                   Pointer to the control block
  *
@@ -1817,12 +2190,30 @@ static fsp_err_t rm_vee_refresh_next_data_source (rm_vee_flash_instance_ctrl_t *
     uint32_t  id;
     fsp_err_t err = FSP_SUCCESS;
 
-    /* Get next record ID */
-    id = rm_vee_get_next_id(p_ctrl);
-
     /* Write next record if more remain */
-    if (id != p_ctrl->refresh_start_rec_id)
+    if (0 != p_ctrl->refresh_remaining)
     {
+        if (0 == p_ctrl->refresh_step_left)
+        {
+            /* Step complete. Records are written to the previous segment until the Refresh is resumed. */
+            p_ctrl->refresh_dst_write_addr = p_ctrl->next_write_addr;
+            p_ctrl->next_write_addr        = p_ctrl->refresh_src_rec_end_addr;
+            p_ctrl->ref_hdr_addr           = p_ctrl->refresh_src_seg_addr +
+                                             (p_ctrl->segment_size - RM_VEE_FLASH_REF_DATA_AREA_SIZE);
+            p_ctrl->refresh_paused = true;
+            p_ctrl->state          = RM_VEE_FLASH_PRV_STATES_READY;
+
+            return FSP_SUCCESS;
+        }
+
+        if (UINT32_MAX != p_ctrl->refresh_step_left)
+        {
+            p_ctrl->refresh_step_left--;
+        }
+
+        /* Get next record ID */
+        id = rm_vee_get_next_id(p_ctrl);
+
         err = rm_vee_init_record_xfer(p_ctrl, id);
         FSP_ERROR_RETURN(FSP_SUCCESS == err, err);
 
@@ -1860,10 +2251,34 @@ static fsp_err_t rm_vee_refresh_next_data_source (rm_vee_flash_instance_ctrl_t *
 }
 
 /*******************************************************************************************************************//**
- * This function gets the next ID after p_ctrl->refresh_cur_rec_id in p_ctrl->rec_offset[]. If the end of the
- * array is reached, this function wraps around and begins searching again. The index of the array
- * corresponds to the ID value. An offset value of 0 (illegal value) indicates that no record is present
- * for that ID.
+ * This function resumes a paused Refresh. The write location is set back to the new segment and the next records
+ * are copied.
+ *
+ * @param  p_ctrl                   Pointer to the control block
+ * @param  step_records             Number of records to copy before pausing again (UINT32_MAX: all remaining records)
+ *
+ * @retval FSP_SUCCESS              Successful.
+ * @retval FSP_ERR_PE_FAILURE       This error indicates that a flash programming, erase, or blankcheck operation has failed
+ * @retval FSP_ERR_TIMEOUT          Flash write timed out (Should not be possible when flash bgo is used).
+ * @retval FSP_ERR_NOT_INITIALIZED  Corruption found. A refresh is required.
+ **********************************************************************************************************************/
+static fsp_err_t rm_vee_refresh_resume (rm_vee_flash_instance_ctrl_t * const p_ctrl, uint32_t step_records)
+{
+    p_ctrl->refresh_src_rec_end_addr = p_ctrl->next_write_addr;
+    p_ctrl->next_write_addr          = p_ctrl->refresh_dst_write_addr;
+    p_ctrl->ref_hdr_addr             = p_ctrl->active_seg_addr +
+                                       (p_ctrl->segment_size - RM_VEE_FLASH_REF_DATA_AREA_SIZE);
+    p_ctrl->refresh_paused    = false;
+    p_ctrl->refresh_step_left = step_records;
+
+    return rm_vee_refresh_next_data_source(p_ctrl);
+}
+
+/*******************************************************************************************************************//**
+ * This function gets the next ID after p_ctrl->refresh_cur_rec_id in p_ctrl->rec_offset[] that is still marked as
+ * being in the previous segment. If the end of the array is reached, this function wraps around and begins searching
+ * again. The index of the array corresponds to the ID value. An offset value of 0 (illegal value) indicates that no
+ * record is present for that ID.
  *
  * @param  p_ctrl                Pointer to the control block
  *
@@ -1871,9 +2286,8 @@ static fsp_err_t rm_vee_refresh_next_data_source (rm_vee_flash_instance_ctrl_t *
  **********************************************************************************************************************/
 static uint32_t rm_vee_get_next_id (rm_vee_flash_instance_ctrl_t * const p_ctrl)
 {
-    /* NOTE: This function is only called after a record has been written.
-     * Because at least one record does exist, this can never be an infinite loop.
-     * Worst case: The "next" ID is the one just written.
+    /* NOTE: This function is only called when p_ctrl->refresh_remaining is not 0.
+     * Because at least one marked record does exist, this can never be an infinite loop.
      */
     do
     {
@@ -1884,7 +2298,7 @@ static uint32_t rm_vee_get_next_id (rm_vee_flash_instance_ctrl_t * const p_ctrl)
         }
 
         /* Stop when valid offset found */
-    } while (p_ctrl->p_cfg->rec_offset[p_ctrl->refresh_cur_rec_id] == 0);
+    } while (0 == (p_ctrl->p_cfg->rec_offset[p_ctrl->refresh_cur_rec_id] & RM_VEE_FLASH_OFFSET_SRC_SEG));
 
     return p_ctrl->refresh_cur_rec_id;
 }
@@ -1907,7 +2321,8 @@ static fsp_err_t rm_vee_init_record_xfer (rm_vee_flash_instance_ctrl_t * const p
     fsp_err_t err = FSP_SUCCESS;
 
     /* Get record address to transfer */
-    p_ctrl->refresh_xfer_src_addr = p_ctrl->refresh_src_seg_addr + p_ctrl->p_cfg->rec_offset[id];
+    p_ctrl->refresh_xfer_src_addr = p_ctrl->refresh_src_seg_addr +
+                                    (p_ctrl->p_cfg->rec_offset[id] & ~RM_VEE_FLASH_OFFSET_SRC_SEG);
 
     /* Get complete record size (number of bytes to transfer) */
     rm_vee_rec_hdr_t * p_hdr = (rm_vee_rec_hdr_t *) p_ctrl->refresh_xfer_src_addr;
@@ -1916,6 +2331,7 @@ static fsp_err_t rm_vee_init_record_xfer (rm_vee_flash_instance_ctrl_t * const p
 
     /* Save offset of record's new location */
     p_ctrl->p_cfg->rec_offset[id] = (uint16_t) (p_ctrl->next_write_addr - p_ctrl->active_seg_addr);
+    p_ctrl->refresh_remaining--;
 
     /* If this record will not fit in remaining record area, then bad configuration exists. Go into error mode. */
     if ((p_ctrl->next_write_addr + p_ctrl->refresh_xfer_bytes_left) >
@@ -2020,6 +2436,7 @@ static fsp_err_t rm_vee_xfer_next_chunk (rm_vee_flash_instance_ctrl_t * const p_
 static fsp_err_t rm_vee_restore_previous_seg (rm_vee_flash_instance_ctrl_t * const p_ctrl)
 {
     p_ctrl->active_seg_addr = p_ctrl->refresh_src_seg_addr;
+    p_ctrl->refresh_paused  = false;
 
     /* In the case of a Refresh aborting due to discovering an Overflow condition, all but one entry in
      * p_ctrl->p_cfg->rec_offset[] will be overwritten, so erase entire array before reloading offsets.
@@ -2079,3 +2496,179 @@ static fsp_err_t rm_vee_state_get (rm_vee_flash_instance_ctrl_t * const p_ctrl,
 
     return FSP_SUCCESS;
 }
+
+/*******************************************************************************************************************//**
+ * Claims the driver for an API function starting an operation. The driver must be ready; the check and the claim are
+ * atomic so that a flush started from an interrupt cannot start an operation in between.
+ *
+ * @param  p_ctrl                   Pointer to the control block
+ *
+ * @retval FSP_SUCCESS              The driver is claimed. Release it with rm_vee_state_release().
+ * @retval FSP_ERR_IN_USE           An operation is in progress.
+ **********************************************************************************************************************/
+static fsp_err_t rm_vee_state_claim (rm_vee_flash_instance_ctrl_t * const p_ctrl)
+{
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+
+    bool ready = (RM_VEE_FLASH_PRV_STATES_READY == p_ctrl->state);
+    if (ready)
+    {
+        p_ctrl->state = RM_VEE_FLASH_PRV_STATES_CLAIMED;
+    }
+
+    FSP_CRITICAL_SECTION_EXIT;
+
+    FSP_ERROR_RETURN(ready, FSP_ERR_IN_USE);
+
+    return FSP_SUCCESS;
+}
+
+/*******************************************************************************************************************//**
+ * Releases the driver claimed by rm_vee_state_claim(). If no operation was started, the driver is ready again after
+ * starting a cache flush requested while it was claimed.
+ *
+ * @param  p_ctrl                   Pointer to the control block
+ *
+ * @retval FSP_SUCCESS              Successful.
+ * @retval FSP_ERR_PE_FAILURE       This error indicates that a flash programming, erase, or blankcheck operation has failed
+ * @retval FSP_ERR_TIMEOUT          Flash write timed out (Should not be possible when flash bgo is used).
+ * @retval FSP_ERR_NOT_INITIALIZED  Corruption found. A refresh is required.
+ **********************************************************************************************************************/
+static fsp_err_t rm_vee_state_release (rm_vee_flash_instance_ctrl_t * const p_ctrl)
+{
+    fsp_err_t err = FSP_SUCCESS;
+
+    FSP_CRITICAL_SECTION_DEFINE;
+    FSP_CRITICAL_SECTION_ENTER;
+
+#if RM_VEE_FLASH_CFG_CACHE_ENABLE
+    if ((RM_VEE_FLASH_PRV_STATES_CLAIMED == p_ctrl->state) && p_ctrl->cache_flush &&
+        (RM_VEE_FLASH_PRV_MODE_OVERFLOW != p_ctrl->mode) && (RM_VEE_FLASH_PRV_MODE_FLASH_PE_FAIL != p_ctrl->mode))
+    {
+        err = rm_vee_cache_flush_next(p_ctrl);
+        rm_vee_flash_err_handle(p_ctrl, err);
+    }
+#endif
+
+    if (RM_VEE_FLASH_PRV_STATES_CLAIMED == p_ctrl->state)
+    {
+        p_ctrl->state = RM_VEE_FLASH_PRV_STATES_READY;
+    }
+
+    FSP_CRITICAL_SECTION_EXIT;
+
+    return err;
+}
+
+#if RM_VEE_FLASH_CFG_CACHE_ENABLE
+
+/*******************************************************************************************************************//**
+ * Loads the write-back cache entries with the records in data flash and marks them clean.
+ *
+ * @param  p_ctrl                   Pointer to the control block
+ **********************************************************************************************************************/
+static void rm_vee_cache_load (rm_vee_flash_instance_ctrl_t * const p_ctrl)
+{
+    rm_vee_flash_cfg_t const * p_extend = (rm_vee_flash_cfg_t const *) p_ctrl->p_cfg->p_extend;
+
+    p_ctrl->p_cache_flushing = NULL;
+    p_ctrl->cache_flush      = false;
+
+    for (uint32_t i = 0; i < p_extend->cache_entries; i++)
+    {
+        rm_vee_flash_cache_entry_t * p_entry = &p_extend->p_cache[i];
+        uint16_t offset = p_ctrl->p_cfg->rec_offset[p_entry->rec_id];
+
+        p_entry->length = 0;
+        p_entry->dirty  = false;
+
+        if (0 != offset)
+        {
+            /* Records not yet moved by a paused Refresh are still in the previous segment */
+            uint32_t addr = (offset & RM_VEE_FLASH_OFFSET_SRC_SEG) ?
+                            (p_ctrl->refresh_src_seg_addr + (offset & ~RM_VEE_FLASH_OFFSET_SRC_SEG)) :
+                            (p_ctrl->active_seg_addr + offset);
+            rm_vee_rec_hdr_t * p_hdr  = (rm_vee_rec_hdr_t *) addr;
+            uint32_t           length = p_hdr->length;
+            if (length > p_entry->size)
+            {
+                length = p_entry->size;
+            }
+
+            memcpy(p_entry->p_data, (uint8_t *) p_hdr + sizeof(rm_vee_rec_hdr_t), length);
+            p_entry->length = length;
+        }
+    }
+}
+
+/*******************************************************************************************************************//**
+ * Finds the write-back cache entry of a record ID.
+ *
+ * @param  p_ctrl                   Pointer to the control block
+ * @param  rec_id                   ID of the record
+ *
+ * @return Cache entry of the record, or NULL if the record is not cached.
+ **********************************************************************************************************************/
+static rm_vee_flash_cache_entry_t * rm_vee_cache_entry_get (rm_vee_flash_instance_ctrl_t * const p_ctrl,
+                                                            uint32_t                             rec_id)
+{
+    rm_vee_flash_cfg_t const * p_extend = (rm_vee_flash_cfg_t const *) p_ctrl->p_cfg->p_extend;
+
+    for (uint32_t i = 0; i < p_extend->cache_entries; i++)
+    {
+        if (rec_id == p_extend->p_cache[i].rec_id)
+        {
+            return &p_extend->p_cache[i];
+        }
+    }
+
+    return NULL;
+}
+
+/*******************************************************************************************************************//**
+ * Starts writing the next dirty write-back cache entry, or ends the flush if none is left. The driver must be ready
+ * and interrupts must be disabled.
+ *
+ * @param  p_ctrl                   Pointer to the control block
+ *
+ * @retval FSP_SUCCESS              Successful.
+ * @retval FSP_ERR_PE_FAILURE       This error indicates that a flash programming, erase, or blankcheck operation has failed
+ * @retval FSP_ERR_TIMEOUT          Flash write timed out (Should not be possible when flash bgo is used).
+ * @retval FSP_ERR_NOT_INITIALIZED  Corruption found. A refresh is required.
+ **********************************************************************************************************************/
+static fsp_err_t rm_vee_cache_flush_next (rm_vee_flash_instance_ctrl_t * const p_ctrl)
+{
+    rm_vee_flash_cfg_t const   * p_extend = (rm_vee_flash_cfg_t const *) p_ctrl->p_cfg->p_extend;
+    rm_vee_flash_cache_entry_t * p_entry  = NULL;
+
+    for (uint32_t i = 0; i < p_extend->cache_entries; i++)
+    {
+        if (p_extend->p_cache[i].dirty)
+        {
+            p_entry = &p_extend->p_cache[i];
+            break;
+        }
+    }
+
+    if (NULL == p_entry)
+    {
+        p_ctrl->cache_flush = false;
+
+        return FSP_SUCCESS;
+    }
+
+    if (p_ctrl->refresh_paused &&
+        ((p_ctrl->next_write_addr + RM_VEE_FLASH_REC_OVERHEAD + p_entry->length) > p_ctrl->ref_hdr_addr))
+    {
+        /* No space left in the segment being refreshed. The flush continues once the Refresh completes. */
+        return rm_vee_refresh_resume(p_ctrl, UINT32_MAX);
+    }
+
+    p_entry->dirty           = false;
+    p_ctrl->p_cache_flushing = p_entry;
+
+    return rm_vee_internal_write_rec(p_ctrl, p_entry->rec_id, p_entry->p_data, p_entry->length);
+}
+
+#endif
@@ -151,6 +151,9 @@ typedef enum
 /* Max retry attempts for socket index change */
 #define WIFI_ONCHIP_SILEX_MAX_SOCKET_INDEX_RETRIES        (10)
 
+/* Longest time a call waits for the queued calls of the active socket before switching the socket index */
+#define WIFI_ONCHIP_SILEX_SOCKET_SWITCH_HOLDOFF           (WIFI_ONCHIP_SILEX_TIMEOUT_10MS)
+
 /* Flag definitions for TCP Timeout */
 #define WIFI_ONCHIP_SILEX_TCP_TIMEOUT_FLAG_SEND           (0)
 #define WIFI_ONCHIP_SILEX_TCP_TIMEOUT_FLAG_RECV           (1)
@@ -275,9 +278,27 @@ fsp_err_t rm_wifi_onchip_silex_send_basic_take_mutex(wifi_onchip_silex_instance_
 void rm_wifi_onchip_silex_send_basic_give_mutex(wifi_onchip_silex_instance_ctrl_t * const p_instance_ctrl,
                                                 uint32_t                                  mutex_flag);
 
+static fsp_err_t rm_wifi_onchip_silex_send_pipelined(wifi_onchip_silex_instance_ctrl_t * p_instance_ctrl,
+                                                     uint32_t                            serial_ch_id,
+                                                     const char * const                * p_commands,
+                                                     uint32_t                            num_commands,
+                                                     uint32_t                            timeout_ms);
+
 static fsp_err_t rm_wifi_onchip_silex_change_socket_index(wifi_onchip_silex_instance_ctrl_t * const p_instance_ctrl,
                                                           uint32_t                                  socket_no);
 
+static fsp_err_t rm_wifi_onchip_silex_socket_take_mutex(wifi_onchip_silex_instance_ctrl_t * p_instance_ctrl,
+                                                       uint32_t                            socket_no,
+                                                       uint32_t                            mutex_flag);
+
+static bool rm_wifi_onchip_silex_recv_direct_start(wifi_onchip_silex_instance_ctrl_t * p_instance_ctrl,
+                                                   uint32_t                            socket_no,
+                                                   uint8_t                           * p_data,
+                                                   uint32_t                            length);
+
+static int32_t rm_wifi_onchip_silex_recv_direct_wait(wifi_onchip_silex_instance_ctrl_t * p_instance_ctrl,
+                                                     uint32_t                            timeout_ms);
+
 static fsp_err_t rm_wifi_onchip_silex_uart_close(wifi_onchip_silex_instance_ctrl_t * const p_instance_ctrl,
                                                  uint32_t                                  uart_port);
 
@@ -645,55 +666,22 @@ fsp_err_t rm_wifi_onchip_silex_open (wifi_onchip_silex_cfg_t const * const p_cfg
 
     if (FSP_SUCCESS == err)
     {
-        err = rm_wifi_onchip_silex_send_basic(p_instance_ctrl,
-                                              p_instance_ctrl->curr_cmd_port,
-                                              "ATS12=1\r",
-                                              WIFI_ONCHIP_SILEX_TIMEOUT_200MS,
-                                              WIFI_ONCHIP_SILEX_TIMEOUT_8SEC,
-                                              WIFI_ONCHIP_SILEX_RETURN_OK);
-    }
-
-    if (FSP_SUCCESS == err)
-    {
-        /* Set buffer size for socket receive */
-        err = rm_wifi_onchip_silex_send_basic(p_instance_ctrl,
-                                              p_instance_ctrl->curr_cmd_port,
-                                              "ATBSIZE=1420\r",
-                                              WIFI_ONCHIP_SILEX_TIMEOUT_200MS,
-                                              WIFI_ONCHIP_SILEX_TIMEOUT_200MS,
-                                              WIFI_ONCHIP_SILEX_RETURN_OK);
-    }
-
-    if (FSP_SUCCESS == err)
-    {
-        /* Disconnect from currently connected Access Point, */
-        err = rm_wifi_onchip_silex_send_basic(p_instance_ctrl,
-                                              p_instance_ctrl->curr_cmd_port,
-                                              "ATWD\r",
-                                              WIFI_ONCHIP_SILEX_TIMEOUT_200MS,
-                                              WIFI_ONCHIP_SILEX_TIMEOUT_1SEC,
-                                              WIFI_ONCHIP_SILEX_RETURN_OK);
-    }
-
-    /* Enable DHCP */
-    if (FSP_SUCCESS == err)
-    {
-        err = rm_wifi_onchip_silex_send_basic(p_instance_ctrl,
-                                              p_instance_ctrl->curr_cmd_port,
-                                              "ATNDHCP=1\r",
-                                              WIFI_ONCHIP_SILEX_TIMEOUT_3MS,
-                                              WIFI_ONCHIP_SILEX_TIMEOUT_200MS,
-                                              WIFI_ONCHIP_SILEX_RETURN_OK);
-    }
+        /* Escape guard time, socket receive buffer size, disconnect from the current Access Point, enable DHCP and
+         * the socket timeout. None of these return information text, so they are sent back to back. */
+        static const char * const p_config_commands[] =
+        {
+            "ATS12=1\r",
+            "ATBSIZE=1420\r",
+            "ATWD\r",
+            "ATNDHCP=1\r",
+            "ATTO=1\r",
+        };
 
-    if (FSP_SUCCESS == err)
-    {
-        err = rm_wifi_onchip_silex_send_basic(p_instance_ctrl,
-                                              p_instance_ctrl->curr_cmd_port,
-                                              "ATTO=1\r",
-                                              WIFI_ONCHIP_SILEX_TIMEOUT_3MS,
-                                              WIFI_ONCHIP_SILEX_TIMEOUT_1SEC,
-                                              WIFI_ONCHIP_SILEX_RETURN_OK);
+        err = rm_wifi_onchip_silex_send_pipelined(p_instance_ctrl,
+                                                  p_instance_ctrl->curr_cmd_port,
+                                                  p_config_commands,
+                                                  sizeof(p_config_commands) / sizeof(p_config_commands[0]),
+                                                  WIFI_ONCHIP_SILEX_TIMEOUT_8SEC);
     }
 
     if (FSP_SUCCESS != err)
@@ -1079,6 +1067,14 @@ fsp_err_t rm_wifi_onchip_silex_mac_addr_get (uint8_t * p_macaddr)
     FSP_ERROR_RETURN(WIFI_OPEN == p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
 #endif
 
+    /* The MAC address does not change, so it is only read from the module once. */
+    if (0 != p_instance_ctrl->curr_macaddr_valid)
+    {
+        memcpy(p_macaddr, p_instance_ctrl->curr_macaddr, sizeof(p_instance_ctrl->curr_macaddr));
+
+        return FSP_SUCCESS;
+    }
+
     mutex_flag = (WIFI_ONCHIP_SILEX_MUTEX_TX | WIFI_ONCHIP_SILEX_MUTEX_RX);
 
     FSP_ERROR_RETURN(FSP_SUCCESS == rm_wifi_onchip_silex_send_basic_take_mutex(p_instance_ctrl, mutex_flag),
@@ -1124,7 +1120,10 @@ fsp_err_t rm_wifi_onchip_silex_mac_addr_get (uint8_t * p_macaddr)
             for (int i = 0; i < 6; i++)
             {
                 p_macaddr[i] = (uint8_t) macaddr[i];
+                p_instance_ctrl->curr_macaddr[i] = (uint8_t) macaddr[i];
             }
+
+            p_instance_ctrl->curr_macaddr_valid = 1;
         }
         else
         {
@@ -1515,6 +1514,14 @@ fsp_err_t rm_wifi_onchip_silex_ip_addr_get (uint8_t * p_ip_addr)
     FSP_ERROR_RETURN(WIFI_OPEN == p_instance_ctrl->open, FSP_ERR_NOT_OPEN);
 #endif
 
+    /* The address read on connection stays valid until the module disconnects from the Access Point. */
+    if (0 != *((uint32_t *) &p_instance_ctrl->curr_ipaddr[0]))
+    {
+        memcpy(p_ip_addr, p_instance_ctrl->curr_ipaddr, sizeof(p_instance_ctrl->curr_ipaddr));
+
+        return FSP_SUCCESS;
+    }
+
     char * buff = (char *) p_instance_ctrl->cmd_rx_buff;
 
     mutex_flag = (WIFI_ONCHIP_SILEX_MUTEX_TX | WIFI_ONCHIP_SILEX_MUTEX_RX);
@@ -1874,7 +1881,7 @@ int32_t rm_wifi_onchip_silex_tcp_send (uint32_t socket_no, const uint8_t * p_dat
     }
 
     mutex_flag = (WIFI_ONCHIP_SILEX_MUTEX_TX);
-    FSP_ERROR_RETURN(FSP_SUCCESS == rm_wifi_onchip_silex_send_basic_take_mutex(p_instance_ctrl, mutex_flag),
+    FSP_ERROR_RETURN(FSP_SUCCESS == rm_wifi_onchip_silex_socket_take_mutex(p_instance_ctrl, socket_no, mutex_flag),
                      WIFI_ONCHIP_SILEX_ERR_ERROR);
 
     if ((0 == p_instance_ctrl->sockets[socket_no].socket_create_flag) ||
@@ -1982,7 +1989,7 @@ int32_t rm_wifi_onchip_silex_tcp_recv (uint32_t socket_no, uint8_t * p_data, uin
 
     /* Take the receive mutex */
     mutex_flag = (WIFI_ONCHIP_SILEX_MUTEX_RX);
-    FSP_ERROR_RETURN(FSP_SUCCESS == rm_wifi_onchip_silex_send_basic_take_mutex(p_instance_ctrl, mutex_flag),
+    FSP_ERROR_RETURN(FSP_SUCCESS == rm_wifi_onchip_silex_socket_take_mutex(p_instance_ctrl, socket_no, mutex_flag),
                      WIFI_ONCHIP_SILEX_ERR_ERROR);
 
     /* Recv data if using 2 UARTS */
@@ -1997,8 +2004,9 @@ int32_t rm_wifi_onchip_silex_tcp_recv (uint32_t socket_no, uint8_t * p_data, uin
             return WIFI_ONCHIP_SILEX_ERR_ERROR;
         }
 
-        /* change socket index if needed */
-        if (socket_no != p_instance_ctrl->curr_socket_index)
+        /* Change socket index if needed. Data buffered while the socket was active is read without a switch. */
+        if ((socket_no != p_instance_ctrl->curr_socket_index) &&
+            (0U == xStreamBufferBytesAvailable(p_instance_ctrl->sockets[socket_no].socket_byteq_hdl)))
         {
             rm_wifi_onchip_silex_send_basic_give_mutex(p_instance_ctrl, mutex_flag);
             FSP_ERROR_RETURN(FSP_SUCCESS ==
@@ -2019,52 +2027,60 @@ int32_t rm_wifi_onchip_silex_tcp_recv (uint32_t socket_no, uint8_t * p_data, uin
             }
         }
 
-        /* Get first byte or timeout */
-        size_t xReceivedBytes =
-            xStreamBufferReceiveAlternate(p_instance_ctrl->sockets[socket_no].socket_byteq_hdl,
-                                          (p_data + recvcnt),
-                                          1,
-                                          pdMS_TO_TICKS(timeout_ms));
-
-        if (xReceivedBytes == 1)
+        /* With no buffered data, the UART callback writes the socket data straight into p_data. */
+        if (rm_wifi_onchip_silex_recv_direct_start(p_instance_ctrl, socket_no, p_data, length))
         {
-            recvcnt++;
+            ret = rm_wifi_onchip_silex_recv_direct_wait(p_instance_ctrl, timeout_ms);
+        }
+        else
+        {
+            /* Get first byte or timeout */
+            size_t xReceivedBytes =
+                xStreamBufferReceiveAlternate(p_instance_ctrl->sockets[socket_no].socket_byteq_hdl,
+                                              (p_data + recvcnt),
+                                              1,
+                                              pdMS_TO_TICKS(timeout_ms));
 
-            /* Get the rest of the transmitted data from the stream buffer */
-            for (uint32_t i = 0; i < length; i++)
+            if (xReceivedBytes == 1)
             {
-                uint32_t num_bytes_left = length - recvcnt;
+                recvcnt++;
 
-                if (0 == num_bytes_left)
+                /* Get the rest of the transmitted data from the stream buffer */
+                for (uint32_t i = 0; i < length; i++)
                 {
-                    ret = (int32_t) recvcnt;
-                    break;
-                }
+                    uint32_t num_bytes_left = length - recvcnt;
 
-                xStreamBufferSetTriggerLevel(p_instance_ctrl->sockets[socket_no].socket_byteq_hdl, num_bytes_left);
+                    if (0 == num_bytes_left)
+                    {
+                        ret = (int32_t) recvcnt;
+                        break;
+                    }
 
-                xReceivedBytes =
-                    xStreamBufferReceiveAlternate(p_instance_ctrl->sockets[socket_no].socket_byteq_hdl,
-                                                  (p_data + recvcnt), num_bytes_left,
-                                                  pdMS_TO_TICKS(WIFI_ONCHIP_SILEX_TIMEOUT_10MS));
-                if (xReceivedBytes > 0)
-                {
-                    recvcnt += xReceivedBytes;
-                }
-                else
-                {
-                    ret = (int32_t) recvcnt;
-                    break;
-                }
-            }                                  /* for */
-        }
-        else
-        {
-            ret = WIFI_ONCHIP_SILEX_ERR_ERROR; // timeout occurred
-        }
+                    xStreamBufferSetTriggerLevel(p_instance_ctrl->sockets[socket_no].socket_byteq_hdl, num_bytes_left);
 
-        /* Reset the trigger level for socket stream buffer */
-        xStreamBufferSetTriggerLevel(p_instance_ctrl->sockets[socket_no].socket_byteq_hdl, 1);
+                    xReceivedBytes =
+                        xStreamBufferReceiveAlternate(p_instance_ctrl->sockets[socket_no].socket_byteq_hdl,
+                                                      (p_data + recvcnt), num_bytes_left,
+                                                      pdMS_TO_TICKS(WIFI_ONCHIP_SILEX_TIMEOUT_10MS));
+                    if (xReceivedBytes > 0)
+                    {
+                        recvcnt += xReceivedBytes;
+                    }
+                    else
+                    {
+                        ret = (int32_t) recvcnt;
+                        break;
+                    }
+                }                                  /* for */
+            }
+            else
+            {
+                ret = WIFI_ONCHIP_SILEX_ERR_ERROR; // timeout occurred
+            }
+
+            /* Reset the trigger level for socket stream buffer */
+            xStreamBufferSetTriggerLevel(p_instance_ctrl->sockets[socket_no].socket_byteq_hdl, 1);
+        }
     }
     else                               /* num uarts = 1 */
     {
@@ -2675,6 +2691,100 @@ fsp_err_t rm_wifi_onchip_silex_send_basic (wifi_onchip_silex_instance_ctrl_t * p
     return FSP_SUCCESS;
 }
 
+/*******************************************************************************************************************//**
+ *  Send several AT commands in one UART write and then parse their result codes. The module queues commands received
+ *  while the previous one is being processed, so only the result codes are waited for instead of the inter-byte
+ *  timeout of each response. Only commands that return a bare result code may be pipelined. Text result mode, or a
+ *  batch that does not fit the command buffer, falls back to one rm_wifi_onchip_silex_send_basic() call per command.
+ *
+ * @param[in]  p_instance_ctrl      Pointer to control instance.
+ * @param[in]  serial_ch_id         UART channel ID.
+ * @param[in]  p_commands           AT commands, each terminated with a carriage return.
+ * @param[in]  num_commands         Number of AT commands.
+ * @param[in]  timeout_ms           Timeout value for each result code.
+ *
+ * @retval FSP_SUCCESS              All commands returned OK.
+ * @retval FSP_ERR_WIFI_FAILED      A command failed or a result code was not received.
+ **********************************************************************************************************************/
+static fsp_err_t rm_wifi_onchip_silex_send_pipelined (wifi_onchip_silex_instance_ctrl_t * p_instance_ctrl,
+                                                      uint32_t                            serial_ch_id,
+                                                      const char * const                * p_commands,
+                                                      uint32_t                            num_commands,
+                                                      uint32_t                            timeout_ms)
+{
+    fsp_err_t err = FSP_SUCCESS;
+    size_t    tx_length = 0;
+    uint32_t  i;
+
+    for (i = 0; i < num_commands; i++)
+    {
+        tx_length += strlen(p_commands[i]);
+    }
+
+    if ((1 != p_instance_ctrl->at_cmd_mode) || (tx_length >= sizeof(p_instance_ctrl->cmd_tx_buff)))
+    {
+        for (i = 0; (i < num_commands) && (FSP_SUCCESS == err); i++)
+        {
+            err = rm_wifi_onchip_silex_send_basic(p_instance_ctrl,
+                                                  serial_ch_id,
+                                                  p_commands[i],
+                                                  WIFI_ONCHIP_SILEX_TIMEOUT_200MS,
+                                                  timeout_ms,
+                                                  WIFI_ONCHIP_SILEX_RETURN_OK);
+        }
+
+        return err;
+    }
+
+    p_instance_ctrl->cmd_tx_buff[0] = '\0';
+    for (i = 0; i < num_commands; i++)
+    {
+        strncat((char *) p_instance_ctrl->cmd_tx_buff, p_commands[i], sizeof(p_instance_ctrl->cmd_tx_buff) - 1);
+    }
+
+    SemaphoreHandle_t tei_sem = p_instance_ctrl->uart_state_info[serial_ch_id].uart_tei_sem;
+    FSP_ERROR_RETURN(0 == uxQueueMessagesWaiting((QueueHandle_t) tei_sem), FSP_ERR_WIFI_FAILED);
+
+    err = p_instance_ctrl->uart_instance_objects[serial_ch_id]->p_api->write(
+        p_instance_ctrl->uart_instance_objects[serial_ch_id]->p_ctrl,
+        p_instance_ctrl->cmd_tx_buff,
+        (uint32_t) tx_length);
+    FSP_ERROR_RETURN(FSP_SUCCESS == err, FSP_ERR_WIFI_FAILED);
+
+    FSP_ERROR_RETURN(pdTRUE == xSemaphoreTake(tei_sem, (timeout_ms / portTICK_PERIOD_MS)), FSP_ERR_WIFI_FAILED);
+
+    /* A numeric result code is one digit followed by a carriage return. Every code is consumed, even after a failure,
+     * so the stream stays aligned with the next command. */
+    uint8_t previous = 0;
+    i = 0;
+    while (i < num_commands)
+    {
+        uint8_t receive_data;
+
+        if (1 != xStreamBufferReceiveAlternate(p_instance_ctrl->socket_byteq_hdl,
+                                               &receive_data,
+                                               1,
+                                               pdMS_TO_TICKS(timeout_ms)))
+        {
+            return FSP_ERR_WIFI_FAILED;
+        }
+
+        if ('\r' == receive_data)
+        {
+            if (g_wifi_onchip_silex_return_numeric_ok[0] != previous)
+            {
+                err = FSP_ERR_WIFI_FAILED;
+            }
+
+            i++;
+        }
+
+        previous = receive_data;
+    }
+
+    return err;
+}
+
 /*******************************************************************************************************************//**
  *  Send and receive wifi scan command.
  *
@@ -2869,6 +2979,126 @@ static fsp_err_t rm_wifi_onchip_silex_change_socket_index (wifi_onchip_silex_ins
     return ret;
 }
 
+/*******************************************************************************************************************//**
+ *  Take the mutexes for a socket send or receive. Calls for the active socket are grouped: while other calls for the
+ *  active socket are waiting, a call for another socket holds off for up to WIFI_ONCHIP_SILEX_SOCKET_SWITCH_HOLDOFF
+ *  so the waiting calls run before the socket index is switched.
+ *
+ * @param[in]  p_instance_ctrl      Pointer to control instance.
+ * @param[in]  socket_no            Socket ID number.
+ * @param[in]  mutex_flag           Flags for the mutex.
+ *
+ * @retval FSP_SUCCESS              Function completed successfully.
+ **********************************************************************************************************************/
+static fsp_err_t rm_wifi_onchip_silex_socket_take_mutex (wifi_onchip_silex_instance_ctrl_t * p_instance_ctrl,
+                                                         uint32_t                            socket_no,
+                                                         uint32_t                            mutex_flag)
+{
+    fsp_err_t  err;
+    TickType_t start = xTaskGetTickCount();
+
+    while ((2 == p_instance_ctrl->num_uarts) && (socket_no != p_instance_ctrl->curr_socket_index) &&
+           (0U != p_instance_ctrl->sockets[p_instance_ctrl->curr_socket_index].socket_waiting) &&
+           ((xTaskGetTickCount() - start) < pdMS_TO_TICKS(WIFI_ONCHIP_SILEX_SOCKET_SWITCH_HOLDOFF)))
+    {
+        vTaskDelay(1);
+    }
+
+    taskENTER_CRITICAL();
+    p_instance_ctrl->sockets[socket_no].socket_waiting++;
+    taskEXIT_CRITICAL();
+
+    err = rm_wifi_onchip_silex_send_basic_take_mutex(p_instance_ctrl, mutex_flag);
+
+    taskENTER_CRITICAL();
+    p_instance_ctrl->sockets[socket_no].socket_waiting--;
+    taskEXIT_CRITICAL();
+
+    return err;
+}
+
+/*******************************************************************************************************************//**
+ *  Hand a receive buffer to the UART callback if the socket stream buffer is empty. The check and the hand over are
+ *  made in a critical section so no byte can be stored in the stream buffer in between.
+ *
+ * @param[in]  p_instance_ctrl      Pointer to control instance.
+ * @param[in]  socket_no            Socket ID number.
+ * @param[out] p_data               Buffer for the received data.
+ * @param[in]  length               Size of p_data.
+ *
+ * @retval true                     The UART callback now fills p_data.
+ * @retval false                    The stream buffer holds data to be read first.
+ **********************************************************************************************************************/
+static bool rm_wifi_onchip_silex_recv_direct_start (wifi_onchip_silex_instance_ctrl_t * p_instance_ctrl,
+                                                    uint32_t                            socket_no,
+                                                    uint8_t                           * p_data,
+                                                    uint32_t                            length)
+{
+    bool started = false;
+
+    taskENTER_CRITICAL();
+    if ((0U != length) && (0U == xStreamBufferBytesAvailable(p_instance_ctrl->sockets[socket_no].socket_byteq_hdl)))
+    {
+        (void) xTaskNotifyStateClear(NULL);
+
+        p_instance_ctrl->recv_direct_task   = xTaskGetCurrentTaskHandle();
+        p_instance_ctrl->recv_direct_socket = socket_no;
+        p_instance_ctrl->recv_direct_size   = length;
+        p_instance_ctrl->recv_direct_count  = 0;
+        p_instance_ctrl->p_recv_direct      = p_data;
+        started = true;
+    }
+
+    taskEXIT_CRITICAL();
+
+    return started;
+}
+
+/*******************************************************************************************************************//**
+ *  Wait for the UART callback to fill the receive buffer handed over by rm_wifi_onchip_silex_recv_direct_start().
+ *  Waits timeout_ms for the first byte, then returns once the buffer is full or no byte arrived for 10 ms.
+ *
+ * @param[in]  p_instance_ctrl      Pointer to control instance.
+ * @param[in]  timeout_ms           Timeout to wait for the first byte.
+ *
+ * @return Number of bytes received, or WIFI_ONCHIP_SILEX_ERR_ERROR on timeout.
+ **********************************************************************************************************************/
+static int32_t rm_wifi_onchip_silex_recv_direct_wait (wifi_onchip_silex_instance_ctrl_t * p_instance_ctrl,
+                                                      uint32_t                            timeout_ms)
+{
+    uint32_t recvcnt;
+    uint32_t previous;
+
+    (void) xTaskNotifyWait(0, 0, NULL, pdMS_TO_TICKS(timeout_ms));
+
+    recvcnt = p_instance_ctrl->recv_direct_count;
+    while ((0U != recvcnt) && (NULL != p_instance_ctrl->p_recv_direct))
+    {
+        previous = recvcnt;
+        (void) xTaskNotifyStateClear(NULL);
+        if (NULL == p_instance_ctrl->p_recv_direct)
+        {
+            break;
+        }
+
+        (void) xTaskNotifyWait(0, 0, NULL, pdMS_TO_TICKS(WIFI_ONCHIP_SILEX_TIMEOUT_10MS));
+
+        recvcnt = p_instance_ctrl->recv_direct_count;
+        if (previous == recvcnt)
+        {
+            break;
+        }
+    }
+
+    /* Bytes arriving from now on are stored in the socket stream buffer. */
+    taskENTER_CRITICAL();
+    p_instance_ctrl->p_recv_direct = NULL;
+    recvcnt = p_instance_ctrl->recv_direct_count;
+    taskEXIT_CRITICAL();
+
+    return (0U != recvcnt) ? (int32_t) recvcnt : WIFI_ONCHIP_SILEX_ERR_ERROR;
+}
+
 /*******************************************************************************************************************//**
  *  Close the UART.
  *
@@ -2948,6 +3178,26 @@ void rm_wifi_onchip_silex_uart_callback (uart_callback_args_t * p_args)
                     xStreamBufferSendFromISR(p_instance_ctrl->socket_byteq_hdl, &data_byte, 1,
                                              &xHigherPriorityTaskWoken);
                 }
+                else if ((NULL != p_instance_ctrl->p_recv_direct) &&
+                         (p_instance_ctrl->curr_socket_index == p_instance_ctrl->recv_direct_socket))
+                {
+                    /* A receiver is waiting on an empty socket, store the byte in its buffer. */
+                    uint32_t count = p_instance_ctrl->recv_direct_count;
+
+                    p_instance_ctrl->p_recv_direct[count] = (uint8_t) p_args->data;
+                    count++;
+                    p_instance_ctrl->recv_direct_count = count;
+
+                    if (count == p_instance_ctrl->recv_direct_size)
+                    {
+                        p_instance_ctrl->p_recv_direct = NULL;
+                    }
+
+                    if ((1U == count) || (NULL == p_instance_ctrl->p_recv_direct))
+                    {
+                        xTaskNotifyFromISR(p_instance_ctrl->recv_direct_task, 0, eNoAction, &xHigherPriorityTaskWoken);
+                    }
+                }
                 else
                 {
                     uint8_t data_byte = (uint8_t) p_args->data;
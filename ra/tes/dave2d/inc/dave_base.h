@@ -1001,6 +1001,90 @@ extern void * d1_getirqdata( d1_device *handle, int irqtype );
 */
 extern int d1_queryirq( d1_device *handle, int irqmask, int timeout );
 
+/*---------------------------------------------------------------------------
+*   Section: Display list fences
+*
+*   Every display list started on the hardware is assigned a fence, a
+*   counter value that is signaled once the list and all lists started
+*   before it have completed. Compared to <d1_queryirq> a fence refers to a
+*   specific list, so a renderer can record the next frame and only wait
+*   when it has to reuse memory the hardware may still read.
+*/
+
+/*--------------------------------------------------------------------------
+*  Type: d1_fence
+*
+*  Display list fence. Fence 0 is always signaled.
+*/
+typedef unsigned int d1_fence;
+
+/*--------------------------------------------------------------------------
+*  Type: d1_fence_callback
+*
+*  Function called from the display list interrupt with the fence of the
+*  completed list (see <d1_setfencecallback>).
+*/
+typedef void ( D1_STDCALL *d1_fence_callback)( d1_fence fence, void *usrdata );
+
+/*--------------------------------------------------------------------------
+*  Function: d1_fencecurrent
+*
+*  Get the fence of the display list started last.
+*
+*  Parameters:
+*    handle - device handle (see: <d1_opendevice>)
+*
+*  Returns:
+*    fence of the last display list, or 0 if none has been started
+*/
+extern d1_fence d1_fencecurrent( d1_device *handle );
+
+/*--------------------------------------------------------------------------
+*  Function: d1_fencesignaled
+*
+*  Check without blocking whether a fence is signaled.
+*
+*  Parameters:
+*    handle - device handle (see: <d1_opendevice>)
+*    fence  - fence returned by <d1_fencecurrent>
+*
+*  Returns:
+*    1 if the display list has completed, 0 otherwise
+*/
+extern int d1_fencesignaled( d1_device *handle, d1_fence fence );
+
+/*--------------------------------------------------------------------------
+*  Function: d1_fencewait
+*
+*  Block until a fence is signaled. Under an RTOS the calling thread sleeps
+*  and is woken by the display list interrupt.
+*
+*  Parameters:
+*    handle  - device handle (see: <d1_opendevice>)
+*    fence   - fence returned by <d1_fencecurrent>
+*    timeout - same as for <d1_queryirq>
+*
+*  Returns:
+*    1 if the fence is signaled, 0 if the wait timed out
+*/
+extern int d1_fencewait( d1_device *handle, d1_fence fence, int timeout );
+
+/*--------------------------------------------------------------------------
+*  Function: d1_setfencecallback
+*
+*  Register a function that is called from the display list interrupt each
+*  time a display list completes.
+*
+*  Parameters:
+*    handle   - device handle (see: <d1_opendevice>)
+*    callback - function to call, or NULL to remove the callback
+*    usrdata  - user data passed to the callback
+*
+*  Returns:
+*    1 if successful
+*/
+extern int d1_setfencecallback( d1_device *handle, d1_fence_callback callback, void *usrdata );
+
 /*---------------------------------------------------------------------------
 *   Section: Timer interface
 *   Not required by the d2 driver at all: Only for better platform portability of applications.
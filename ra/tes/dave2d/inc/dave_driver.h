@@ -184,6 +184,33 @@ typedef d2_u32 d2_pattern;
 */
 typedef d2_u16 d2_blitpos;
 
+/*---------------------------------------------------------------------------
+  Type: d2_dirtyrect
+      Rectangle with inclusive integer borders, used by the dirty region utility functions.
+*/
+typedef struct _d2_dirtyrect
+{
+   d2_border xmin, ymin, xmax, ymax;
+} d2_dirtyrect;
+
+/*---------------------------------------------------------------------------
+  Type: d2_dirtyregion
+      Dirty region tracking state for a double buffered framebuffer (see <d2_utility_dirtyinit>).
+      Holds the rectangles changed in the frame being prepared and in the previous frame.
+      D2_DIRTYRECTS_MAX rectangles are kept per frame; further rectangles are merged.
+*/
+#ifndef D2_DIRTYRECTS_MAX
+#define D2_DIRTYRECTS_MAX  8
+#endif
+
+typedef struct _d2_dirtyregion
+{
+   d2_dirtyrect rect[2][D2_DIRTYRECTS_MAX];
+   d2_u32       count[2];
+   d2_u32       current;
+   d2_u16       width, height;
+} d2_dirtyregion;
+
 
 /*---------------------------------------------------------------------------
  * enums */
@@ -462,6 +489,110 @@ typedef d2_u32 d2_adddlistflags;
 #define d2_al_copy     0u  /* content will be copied             */
 #define d2_al_no_copy  1u  /* jump to the dlist will be added    */
 
+/*--------------------------------------------------------------------------- */
+
+typedef d2_u32 d2_loaddlistflags;
+
+#define d2_ld_default    0u  /* default behavior                              */
+#define d2_ld_copy       0u  /* dlist is copied from the image and patched    */
+#define d2_ld_patchonly  1u  /* only addresses of a loaded dlist are patched  */
+
+/*--------------------------------------------------------------------------- */
+
+typedef d2_u32 d2_rbbudgetflags;
+
+#define d2_rbb_default   0u  /* unused dlist pages are freed, see <d2_newrenderbuffer> */
+#define d2_rbb_noshrink  1u  /* render buffers keep their largest size across frames   */
+#define d2_rbb_pool      2u  /* freed dlist pages are kept for reuse by other buffers  */
+
+/*--------------------------------------------------------------------------- */
+
+typedef struct _d2_dlistbase
+{
+   const void *address;  /* start of the memory region (framebuffer or texture) */
+   d2_u32      size;     /* size of the memory region in bytes                  */
+} d2_dlistbase;
+
+#define D2_DLISTBASES_MAX  255u
+
+/*--------------------------------------------------------------------------- */
+
+typedef d2_u32 d2_texcacheflags;
+
+#define d2_tc_default  0u  /* textures are cached unchanged                           */
+#define d2_tc_clut     1u  /* textures with few colors are converted to i8 with CLUT   */
+#define d2_tc_rle      2u  /* blit sources are RLE compressed if this saves memory     */
+
+/*---------------------------------------------------------------------------
+  Type: d2_texcacheentry
+      Texture held by a texture cache (see <d2_texcacheinit>).
+*/
+#ifndef D2_TEXCACHE_ENTRIES
+#define D2_TEXCACHE_ENTRIES  32
+#endif
+
+typedef struct _d2_texcacheentry
+{
+   const void *source;                /* texture address in the source memory (key)         */
+   d2_s32      width, height, pitch;  /* source geometry (key)                                */
+   d2_u32      srcformat;             /* source format, d2_mode_rle marks blit sources (key)  */
+   d2_u8      *data;                  /* start of the entry in the arena                      */
+   d2_u32      size;                  /* bytes of the arena used by the entry                 */
+   d2_u32      texels;                /* offset of the texels in the entry (after the CLUT)   */
+   d2_u32      format;                /* format of the cached texels                          */
+   d2_s32      cpitch;                /* pitch of the cached texels                           */
+   d2_u32      lastuse;               /* use stamp for LRU eviction                           */
+   d2_u32      lastframe;             /* frame the entry was last used in                     */
+} d2_texcacheentry;
+
+/*---------------------------------------------------------------------------
+  Type: d2_texcache
+      Texture cache state (see <d2_texcacheinit>). Entries are kept sorted by their arena address.
+*/
+typedef struct _d2_texcache
+{
+   d2_u8           *arena;
+   d2_u32           arenasize;
+   d2_u32           flags;
+   d2_u32           count;
+   d2_u32           clock;
+   d2_u32           frame;
+   d2_u32           hits, misses, bypasses, evictions;
+   d2_texcacheentry entry[D2_TEXCACHE_ENTRIES];
+   d2_u32           palette[256];     /* scratch palette of the texture being loaded */
+} d2_texcache;
+
+/*---------------------------------------------------------------------------
+  Type: d2_texcachestats
+      Texture cache statistics (see <d2_texcachegetstats>).
+*/
+typedef struct _d2_texcachestats
+{
+   d2_u32 hits;       /* lookups served from the cache                           */
+   d2_u32 misses;     /* textures loaded into the cache                          */
+   d2_u32 bypasses;   /* lookups served from the source, the texture did not fit  */
+   d2_u32 evictions;  /* entries evicted to make room                            */
+   d2_u32 entries;    /* entries in the cache                                    */
+   d2_u32 used;       /* bytes of the arena in use                               */
+   d2_u32 hitrate;    /* hits per 1000 lookups                                   */
+} d2_texcachestats;
+
+/*---------------------------------------------------------------------------
+  Type: d2_rbstats
+      Render buffer memory statistics (see <d2_getrenderbufferstats>).
+*/
+typedef struct _d2_rbstats
+{
+   d2_u32 allocated;    /* bytes held by dlist pages and layers, including pooled pages */
+   d2_u32 peak;         /* largest value of allocated                                    */
+   d2_u32 pooled;       /* bytes held by pooled dlist pages                              */
+   d2_u32 budget;       /* limit for allocated in bytes, 0 = unlimited                   */
+   d2_u32 peakentries;  /* most dlist entries used by one executed render buffer         */
+   d2_u32 peaklayer;    /* most layer entries used by one render buffer                  */
+   d2_u32 grows;        /* dlist pages and layer resizes allocated while rendering       */
+   d2_u32 refused;      /* allocations refused because they would exceed the budget      */
+} d2_rbstats;
+
 /*---------------------------------------------------------------------------
  * basic functions */
 
@@ -499,6 +630,9 @@ D2_EXTERN d2_context * d2_getcontext( d2_device *handle, d2_s32 mode );
 D2_EXTERN d2_s32 d2_framebuffer( d2_device *handle, void *ptr, d2_s32 pitch, d2_u32 width, d2_u32 height, d2_s32 format );
 D2_EXTERN d2_s32 d2_cliprect( d2_device *handle, d2_border xmin, d2_border ymin, d2_border xmax, d2_border ymax );
 D2_EXTERN d2_s32 d2_flushframe( d2_device *handle );
+D2_EXTERN d2_u32 d2_getfence( d2_device *handle );
+D2_EXTERN d2_s32 d2_fencesignaled( d2_device *handle, d2_u32 fence );
+D2_EXTERN d2_s32 d2_waitfence( d2_device *handle, d2_u32 fence, d2_s32 timeout );
 D2_EXTERN d2_s32 d2_startframe( d2_device *handle );
 D2_EXTERN d2_s32 d2_endframe( d2_device *handle );
 D2_EXTERN d2_s32 d2_relocateframe( d2_device *handle, const void *ptr );
@@ -525,7 +659,13 @@ D2_EXTERN d2_s32            d2_executerenderbuffer( d2_device *handle, d2_render
 D2_EXTERN d2_renderbuffer * d2_getrenderbuffer( d2_device *handle, d2_s32 index );
 D2_EXTERN d2_s32            d2_dumprenderbuffer( d2_device *handle, d2_renderbuffer *buffer, void **rdata, d2_s32 *rsize );
 D2_EXTERN d2_u32            d2_getrenderbuffersize(d2_device *handle, d2_renderbuffer *rb);
+D2_EXTERN d2_s32            d2_setrenderbufferbudget( d2_device *handle, d2_u32 budget, d2_u32 flags );
+D2_EXTERN d2_s32            d2_getrenderbufferstats( d2_device *handle, d2_rbstats *stats, d2_u32 reset );
+D2_EXTERN d2_s32            d2_releaserenderbufferpool( d2_device *handle );
 D2_EXTERN d2_s32            d2_freedumpedbuffer( d2_device *handle, void *data );
+D2_EXTERN d2_s32            d2_serializedlist( d2_device *handle, const void *dlist, d2_s32 dlistsize, const d2_dlistbase *bases, d2_u32 basecount, void *rdata, d2_u32 *rsize );
+D2_EXTERN d2_u32            d2_getserializeddlistsize( const void *image );
+D2_EXTERN d2_s32            d2_loaddlist( d2_device *handle, const void *image, const void * const *bases, d2_u32 basecount, void *dlist, d2_u32 dlistsize, d2_u32 flags );
 
 /*---------------------------------------------------------------------------
  * context attribute writes */
@@ -602,8 +742,12 @@ D2_EXTERN d2_s32 d2_rendertri( d2_device *handle, d2_point x1, d2_point y1, d2_p
 D2_EXTERN d2_s32 d2_renderquad( d2_device *handle, d2_point x1, d2_point y1, d2_point x2, d2_point y2, d2_point x3, d2_point y3, d2_point x4, d2_point y4, d2_u32 flags );
 D2_EXTERN d2_s32 d2_rendercircle( d2_device *handle, d2_point x, d2_point y, d2_width r, d2_width w );
 D2_EXTERN d2_s32 d2_renderwedge( d2_device *handle, d2_point x, d2_point y, d2_width r, d2_width w, d2_s32 nx1, d2_s32 ny1, d2_s32 nx2, d2_s32 ny2, d2_u32 flags );
+D2_EXTERN d2_s32 d2_renderarc( d2_device *handle, d2_point x, d2_point y, d2_width r, d2_width w, d2_s32 startangle, d2_s32 endangle, d2_u32 flags );
 D2_EXTERN d2_s32 d2_renderline2(  d2_device *handle, d2_point x1, d2_point y1, d2_point x2, d2_point y2, d2_width w1, d2_width w2, d2_u32 flags );
 
+D2_EXTERN d2_s32 d2_renderboxes( d2_device *handle, const d2_point *data, d2_u32 count );
+D2_EXTERN d2_s32 d2_renderlines( d2_device *handle, const d2_point *data, d2_u32 count, d2_width w, d2_u32 flags );
+
 D2_EXTERN d2_s32 d2_renderpolyline( d2_device *handle, const d2_point *data, d2_u32 count, d2_width w, d2_u32 flags);
 D2_EXTERN d2_s32 d2_renderpolyline2( d2_device *handle, const d2_point *data, d2_u32 count, const d2_width *w, d2_u32 flags);
 D2_EXTERN d2_s32 d2_rendertrilist( d2_device *handle, const d2_point *data, const d2_u32 *flags, d2_u32 count);
@@ -621,6 +765,16 @@ D2_EXTERN d2_s32 d2_setblitsrc( d2_device *handle, void *ptr, d2_s32 pitch, d2_s
 
 D2_EXTERN d2_s32 d2_blitcopy( d2_device *handle, d2_s32 srcwidth, d2_s32 srcheight, d2_blitpos srcx, d2_blitpos srcy, d2_width dstwidth, d2_width dstheight, d2_point dstx, d2_point dsty, d2_u32 flags );
 
+/*---------------------------------------------------------------------------
+ * texture cache */
+
+D2_EXTERN d2_s32 d2_texcacheinit( d2_texcache *cache, void *arena, d2_u32 size, d2_u32 flags );
+D2_EXTERN d2_s32 d2_texcachesetblitsrc( d2_device *handle, d2_texcache *cache, const void *ptr, d2_s32 pitch, d2_s32 width, d2_s32 height, d2_u32 format );
+D2_EXTERN d2_s32 d2_texcachesettexture( d2_device *handle, d2_texcache *cache, const void *ptr, d2_s32 pitch, d2_s32 width, d2_s32 height, d2_u32 format );
+D2_EXTERN d2_s32 d2_texcacheframe( d2_texcache *cache );
+D2_EXTERN d2_s32 d2_texcacheflush( d2_texcache *cache );
+D2_EXTERN d2_s32 d2_texcachegetstats( const d2_texcache *cache, d2_texcachestats *stats );
+
 /*---------------------------------------------------------------------------
  * performance measurement */
 D2_EXTERN d2_s32 d2_setperfcountevent( d2_device *handle, d2_u32 counter, d2_u32 event );
@@ -633,6 +787,10 @@ D2_EXTERN d2_slong d2_getperfcountvalue( d2_device *handle, d2_u32 counter );
 d2_s32 d2_utility_maptriangle    ( d2_device *handle, const d2_f32 *points, const d2_f32 *uvs );
 d2_s32 d2_utility_perspectivewarp( d2_device *handle, d2_u16 srcwidth, d2_u16 srcheight, d2_s16 srcx, d2_s16 srcy, d2_s16 dstwidth, d2_s16 dstheight, d2_s16 dstx, d2_s16 dsty, d2_u16 wt );
 d2_s32 d2_utility_fbblitcopy     ( d2_device *handle, d2_u16 width, d2_u16 height, d2_blitpos srcx, d2_blitpos srcy, d2_blitpos dstx, d2_blitpos dsty, d2_u32 flags);
+d2_s32 d2_utility_dirtyinit      ( d2_dirtyregion *region, d2_u16 width, d2_u16 height );
+d2_s32 d2_utility_dirtyadd       ( d2_dirtyregion *region, d2_border xmin, d2_border ymin, d2_border xmax, d2_border ymax );
+d2_s32 d2_utility_dirtybegin     ( d2_device *handle, d2_dirtyregion *region, void *frontbuffer );
+d2_s32 d2_utility_dirtyend       ( d2_device *handle, d2_dirtyregion *region );
 void d2_rendercircle_no_hilimiterprecision( d2_device *handle, d2_u32 flag );
 
 
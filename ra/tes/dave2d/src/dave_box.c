@@ -176,6 +176,74 @@ d2_s32 d2_renderbox_inline( d2_devicedata *handle, d2_contextdata *ctx, d2_point
    return 1;
 }
 
+/*--------------------------------------------------------------------------
+ * render count boxes (x,y,w,h each) with a single context.
+ * boxes on whole pixels need no limiters. as long as the material does not
+ * depend on the bbox (no blur, gradients, pattern or texture) consecutive
+ * boxes of this kind share CONTROL, PITCH and the material of the first one
+ * and add only SIZE and ORIGIN to the dlist.
+ * */
+void d2_renderboxes_intern( d2_devicedata *handle, d2_contextdata *ctx, const d2_point *data, d2_u32 count )
+{
+   d2_u32 compact;
+   d2_u32 run = 0;
+   d2_u32 i;
+
+   compact = ( (0 == (ctx->features & d2_feat_blur)) && (0 == ctx->gradients) && (ctx->fillmode <= d2_fm_twocolor) ) ? 1u : 0u;
+
+   for(i=0; i<count; i++)
+   {
+      d2_point x1 = data[0];
+      d2_point y1 = data[1];
+      d2_width w  = (d2_width) data[2];
+      d2_width h  = (d2_width) data[3];
+      d2_u32 subpixel = 0;
+
+      data += 4;
+
+      if(0 != (ctx->features & d2_feat_aa))
+      {
+         subpixel = D2_FRAC4( (d2_u32)x1 | (d2_u32)y1 | (d2_u32)w | (d2_u32)h );
+      }
+
+      if((0 == compact) || (0 != subpixel))
+      {
+         /* needs limiters: render separately, registers of run are lost */
+         (void)d2_renderbox_inline( handle, ctx, x1, y1, w, h );
+         run = 0;
+      }
+      else if(((d2_u16)w >= D2_EPSILON) && (h >= D2_EPSILON))
+      {
+         d2_bbox bbox;
+
+         bbox.xmin = (d2_s16) D2_FLOOR4( x1 );
+         bbox.ymin = (d2_s16) D2_FLOOR4( y1 );
+         bbox.xmax = (d2_s16) D2_CEIL4( x1 + (w - D2_FIX4(1)) );
+         bbox.ymax = (d2_s16) D2_CEIL4( y1 + (h - D2_FIX4(1)) );
+
+         if(0 != d2_clipbbox_intern( handle, &bbox ))
+         {
+            if(0 == run)
+            {
+               d2_setupmaterial_intern( handle, ctx );
+
+               D2_DLISTWRITEU( D2_CONTROL, 0 );
+               d2_startrender_intern( handle, &bbox, 0 );
+               run = 1;
+            }
+            else
+            {
+               d2_continuerender_intern( handle, &bbox );
+            }
+         }
+      }
+      else
+      {
+         /* invisible */
+      }
+   }
+}
+
 /*--------------------------------------------------------------------------
  *
  * */
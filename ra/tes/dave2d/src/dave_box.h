@@ -19,6 +19,8 @@ D2_EXTERN d2_s32 d2_renderbox_intern(  d2_devicedata *handle, d2_contextdata *ct
 
 D2_EXTERN d2_s32 d2_renderbox_inline( d2_devicedata *handle, d2_contextdata *ctx, d2_point x1, d2_point y1, d2_width w, d2_width h );
 
+D2_EXTERN void d2_renderboxes_intern( d2_devicedata *handle, d2_contextdata *ctx, const d2_point *data, d2_u32 count );
+
 D2_EXTERN d2_s32 d2_renderbox_solid( d2_device *handle, d2_point x1, d2_point y1, d2_width w, d2_width h );
 
 D2_EXTERN d2_s32 d2_renderbox_shadow( d2_device *handle, d2_point x1, d2_point y1, d2_width w, d2_width h );
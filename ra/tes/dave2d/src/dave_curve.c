@@ -21,7 +21,13 @@
 #define TWEAK 3
 
 
-void d2_circlesetup_intern(d2_devicedata *handle, const d2_contextdata *ctx, d2_u32 index, d2_point x, d2_point y, d2_width r, d2_s32 band, d2_s32 invert, d2_s32 hiprec )
+static void d2_circlecalc_intern( const d2_devicedata *handle, const d2_contextdata *ctx, d2_point x, d2_point y, d2_width r, d2_s32 hiprec, d2_circlecacheentry *setup );
+
+/*--------------------------------------------------------------------------
+ * compute the limiter setup of a circle. contains the divisions and the
+ * (possibly emulated) 64bit math, results are cached by d2_circlesetup_intern
+ * */
+static void d2_circlecalc_intern( const d2_devicedata *handle, const d2_contextdata *ctx, d2_point x, d2_point y, d2_width r, d2_s32 hiprec, d2_circlecacheentry *setup )
 {
    d2_s32 a, b, f, ir;
    d2_u32 ib;
@@ -303,22 +309,67 @@ void d2_circlesetup_intern(d2_devicedata *handle, const d2_contextdata *ctx, d2_
       }
    }
 
+   setup->f  = f;
+   setup->a  = a;
+   setup->b  = b;
+   setup->ir = ir;
+}
+
+/*--------------------------------------------------------------------------
+ * write the limiter setup of a circle.
+ * gauges and other static content render the same circles every frame, so
+ * the setup of recent circles is kept in a small direct mapped cache
+ * */
+void d2_circlesetup_intern(d2_devicedata *handle, const d2_contextdata *ctx, d2_u32 index, d2_point x, d2_point y, d2_width r, d2_s32 band, d2_s32 invert, d2_s32 hiprec )
+{
+   d2_circlecacheentry *setup;
+#if D2_CIRCLECACHE_ENTRIES > 0
+   d2_width blur = 0;
+   d2_u32 slot;
+
+   if(0 != (ctx->features & d2_feat_blur))
+   {
+      blur = ctx->blurring;
+   }
+
+   /* the precision only selects a different path for blurred circles */
+   hiprec = ( (0 != blur) && (0 != hiprec) && (0 != (D2_DEV(handle)->hwrevision & D2FB_HILIMITERPRECISION)) ) ? 1 : 0;
+
+   slot  = (d2_u32)(d2_u16)x ^ ((d2_u32)(d2_u16)y << 3) ^ ((d2_u32)(d2_u16)r << 1);
+   slot ^= slot >> 7;
+   setup = &handle->circlecache[ slot & (D2_CIRCLECACHE_ENTRIES - 1u) ];
+
+   if( (setup->r != r) || (setup->x != x) || (setup->y != y) || (setup->blur != blur) || (setup->hiprec != hiprec) )
+   {
+      d2_circlecalc_intern( handle, ctx, x, y, r, hiprec, setup );
+      setup->x      = x;
+      setup->y      = y;
+      setup->r      = r;
+      setup->blur   = blur;
+      setup->hiprec = hiprec;
+   }
+#else
+   d2_circlecacheentry calc;
+
+   setup = &calc;
+   d2_circlecalc_intern( handle, ctx, x, y, r, hiprec, setup );
+#endif
 
    /* set register values (geometric parameters) */
    if(0 == invert)
    {
-      D2_DLISTWRITES( D2_L1START + index, f + band );
-      D2_DLISTWRITES( D2_L2START + index, a ); /* equal l1_xadd */
-      D2_DLISTWRITES( D2_L1YADD  + index, b );
-      D2_DLISTWRITES( D2_L2XADD  + index, ir * 2 );
-      D2_DLISTWRITES( D2_L2YADD  + index, ir * 2 );
+      D2_DLISTWRITES( D2_L1START + index, setup->f + band );
+      D2_DLISTWRITES( D2_L2START + index, setup->a ); /* equal l1_xadd */
+      D2_DLISTWRITES( D2_L1YADD  + index, setup->b );
+      D2_DLISTWRITES( D2_L2XADD  + index, setup->ir * 2 );
+      D2_DLISTWRITES( D2_L2YADD  + index, setup->ir * 2 );
    }
    else
    {
-      D2_DLISTWRITES( D2_L1START + index, -f - band );
-      D2_DLISTWRITES( D2_L2START + index, -a ); /* equal l1_xadd */
-      D2_DLISTWRITES( D2_L1YADD  + index, -b );
-      D2_DLISTWRITES( D2_L2XADD  + index, -ir * 2 );
-      D2_DLISTWRITES( D2_L2YADD  + index, -ir * 2 );
+      D2_DLISTWRITES( D2_L1START + index, -setup->f - band );
+      D2_DLISTWRITES( D2_L2START + index, -setup->a ); /* equal l1_xadd */
+      D2_DLISTWRITES( D2_L1YADD  + index, -setup->b );
+      D2_DLISTWRITES( D2_L2XADD  + index, -setup->ir * 2 );
+      D2_DLISTWRITES( D2_L2YADD  + index, -setup->ir * 2 );
    }
 }
@@ -54,6 +54,7 @@
 /*--------------------------------------------------------------------------*/
 
 static d2_s32 d2_dlist2dlist_intern( d2_device *handle, d2_dlist *dlist, void *address, d2_s32 size );
+static void d2_destroydlistblock_intern( const d2_device *handle, d2_dlist_block *data );
 
 /*--------------------------------------------------------------------------
  * create a display list block (displaylist memory can be fetched from a
@@ -63,13 +64,36 @@ static d2_s32 d2_dlist2dlist_intern( d2_device *handle, d2_dlist *dlist, void *a
 d2_dlist_block * d2_alloc_dlistblock_intern( const d2_device *handle, d2_u32 size )
 {
    d2_dlist_block *dlb;
+   d2_dlist_block **link;
    d1_device      *id = D2_DEV(handle)->hwid;
 
+   /* reuse the first pooled block that is large enough */
+   link = &D2_DEV(handle)->rbpool;
+   while(NULL != *link)
+   {
+      dlb = *link;
+      if(dlb->quantity >= size)
+      {
+         *link     = dlb->next;
+         dlb->next = NULL;
+         dlb->jump = NULL;
+         D2_DEV(handle)->rbstats.pooled -= D2_DLISTBLOCKBYTES(dlb->quantity);
+         return dlb;
+      }
+      link = &dlb->next;
+   }
+
+   if(0 == d2_rbreserve_intern( handle, D2_DLISTBLOCKBYTES(size) ))
+   {
+      return NULL;
+   }
+
    /* get controlling block structure */
    dlb = (d2_dlist_block*) d2_getmem_p( sizeof(d2_dlist_block) );
 
    if(NULL == dlb) 
    {
+      d2_rbrelease_intern( handle, D2_DLISTBLOCKBYTES(size) );
       return NULL;
    }
 
@@ -91,6 +115,7 @@ d2_dlist_block * d2_alloc_dlistblock_intern( const d2_device *handle, d2_u32 siz
    {
       /* failed to get display list memory */
       d2_freemem_p( dlb );
+      d2_rbrelease_intern( handle, D2_DLISTBLOCKBYTES(size) );
       return NULL;
    }
 
@@ -116,36 +141,72 @@ d2_dlist_block * d2_alloc_dlistblock_intern( const d2_device *handle, d2_u32 siz
    return dlb;
 }
 
+/*--------------------------------------------------------------------------
+ * return a single display list block to the heap
+ * */
+static void d2_destroydlistblock_intern( const d2_device *handle, d2_dlist_block *data )
+{
+   d1_device *id = D2_DEV(handle)->hwid;
+
+   if(0 == (D2_DEV(handle)->flags & d2_df_no_dlist)) 
+   {
+       d2_freemem_d( handle, data->block );
+   }
+   else
+   {
+       d2_freemem_p( data->block );
+   }
+   if( (NULL != data->vidmem) && (0 != ((D2_DEV(handle)->hwmemarchitecture) & d1_ma_separated)) )
+   {
+      d1_freevidmem( id, d1_mem_dlist, data->vidmem );
+   }
+   d2_rbrelease_intern( handle, D2_DLISTBLOCKBYTES(data->quantity) );
+   d2_freemem_p( data );
+}
+
 /*--------------------------------------------------------------------------
  * free display list block.
- * free the specified display list block and all childs in its chain
+ * free the specified display list block and all childs in its chain.
+ * with d2_rbb_pool the blocks are moved to the device pool instead
  * */
 void d2_free_dlistblock_intern( const d2_device *handle, d2_dlist_block *data )
 {
    d2_dlist_block *n;
-   d1_device      *id = D2_DEV(handle)->hwid;
 
    /* free chain */
    while(NULL != data)
    {
       n = data->next;
-      if(0 == (D2_DEV(handle)->flags & d2_df_no_dlist)) 
+      if(0 != (D2_DEV(handle)->rbflags & d2_rbb_pool))
       {
-          d2_freemem_d( handle, data->block );
+         data->next = D2_DEV(handle)->rbpool;
+         D2_DEV(handle)->rbpool = data;
+         D2_DEV(handle)->rbstats.pooled += D2_DLISTBLOCKBYTES(data->quantity);
       }
       else
       {
-          d2_freemem_p( data->block );
-      }
-      if( (NULL != data->vidmem) && (0 != ((D2_DEV(handle)->hwmemarchitecture) & d1_ma_separated)) )
-      {
-         d1_freevidmem( id, d1_mem_dlist, data->vidmem );
+         d2_destroydlistblock_intern( handle, data );
       }
-      d2_freemem_p( data );
       data = n;
    }
 }
 
+/*--------------------------------------------------------------------------
+ * free all display list blocks held by the device pool
+ * */
+void d2_freedlistpool_intern( const d2_device *handle )
+{
+   d2_dlist_block *n;
+
+   while(NULL != D2_DEV(handle)->rbpool)
+   {
+      n = D2_DEV(handle)->rbpool;
+      D2_DEV(handle)->rbpool = n->next;
+      D2_DEV(handle)->rbstats.pooled -= D2_DLISTBLOCKBYTES(n->quantity);
+      d2_destroydlistblock_intern( handle, n );
+   }
+}
+
 /*--------------------------------------------------------------------------
  * grow display list.
  * allocate a new display block and chain it into the list. new block becomes
@@ -165,6 +226,7 @@ void d2_growdlist_intern( d2_dlist *dlist )
          D2_DEV(dlist->device)->delayed_errorcode = D2_NOT_ENOUGH_DLISTBLOCKS;
          return;
       }
+      D2_DEV(dlist->device)->rbstats.grows++;
       /* chain blocks */
       dlist->currentblock->next = n;
    }
@@ -516,8 +578,27 @@ void* d2_preparedlist_read_intern( const d2_device *handle, d2_dlist *dlist, d2_
 
    if (D2_DEV(handle)->lowlocalmem_mode == NULL)
    {
+      /* track the longest list (used to tune initial sizes) */
+      d2_dlist_block *cblock = dlist->firstblock;
+      d2_u32 used = dlist->currentblock->quantity - dlist->blocksize;
+
+      while(cblock != dlist->currentblock)
+      {
+         used += cblock->quantity;
+         cblock = cblock->next;
+      }
+
+      if(used > D2_DEV(handle)->rbstats.peakentries)
+      {
+         D2_DEV(handle)->rbstats.peakentries = used;
+      }
+
       /* update shrinkcount */
-      if(NULL != dlist->currentblock->next)
+      if(0 != (D2_DEV(handle)->rbflags & d2_rbb_noshrink))
+      {
+         dlist->shrinkcount = 0; /* keep all blocks */
+      }
+      else if(NULL != dlist->currentblock->next)
       {
          ++dlist->shrinkcount;  /* list is too long */
       }
@@ -36,6 +36,8 @@
 #define D2_DLISTSHRINKDELAY 60  /* number of frames, for which the number of display list blocks needs too large, before */
                                 /*  the number of display list blocks is actually reduced */
 
+#define D2_DLISTBLOCKBYTES(q)  ((d2_u32)(sizeof(d2_dlist_block) + ((q) * sizeof(d2_dlist_entry))))  /* PRQA S 3453 */ /* $Misra: #MACRO_TYPE_SAFE_FXN_REPL $*/
+
 
 /*--------------------------------------------------------------------------- */
 
@@ -121,6 +123,8 @@ D2_EXTERN d2_dlist_block * d2_alloc_dlistblock_intern( const d2_device *handle,
 
 D2_EXTERN void d2_free_dlistblock_intern( const d2_device *handle, d2_dlist_block *data );
 
+D2_EXTERN void d2_freedlistpool_intern( const d2_device *handle );
+
 D2_EXTERN d2_s32 d2_initdlist_intern( d2_device *handle, d2_dlist *dlist, d2_u32 initialsize );
 
 D2_EXTERN void d2_deinitdlist_intern(const d2_dlist *dlist);
@@ -230,7 +230,7 @@ static d2_contextdata_backup * d2_newbackupcontext_intern( d2_device *handle, d2
  * */
 d2_device * d2_opendevice( d2_u32 flags )
 {
-#ifdef D2_USEREGCACHE
+#if defined(D2_USEREGCACHE) || (D2_CIRCLECACHE_ENTRIES > 0)
    d2_s32 i;
 #endif
 
@@ -280,6 +280,17 @@ d2_device * d2_opendevice( d2_u32 flags )
       handle->writelist        = NULL;
       handle->readlist         = NULL;
       handle->dlistblocksize   = D2_DLISTBLOCKSIZE;
+      handle->rbbudget         = 0;
+      handle->rbflags          = d2_rbb_default;
+      handle->rbpool           = NULL;
+      handle->rbstats.allocated   = 0;
+      handle->rbstats.peak        = 0;
+      handle->rbstats.pooled      = 0;
+      handle->rbstats.budget      = 0;
+      handle->rbstats.peakentries = 0;
+      handle->rbstats.peaklayer   = 0;
+      handle->rbstats.grows       = 0;
+      handle->rbstats.refused     = 0;
 
       /* 0x30 is for enabling burstmode of caches -> can be removed for later versions */
       handle->cachectlmask     = D2C_CACHECTL_ENABLE_FB | D2C_CACHECTL_ENABLE_TX;
@@ -306,6 +317,13 @@ d2_device * d2_opendevice( d2_u32 flags )
       }
 #endif
 
+#if D2_CIRCLECACHE_ENTRIES > 0
+      for(i=0; i<D2_CIRCLECACHE_ENTRIES; i++)
+      {
+         handle->circlecache[i].r = 0;
+      }
+#endif
+
       /* hw revision */
       handle->hwrevision                   = 0;
       handle->hilimiterprecision_supported = 0;
@@ -586,6 +604,9 @@ d2_s32 d2_deinithw( d2_device *handle )
       D2_DEV(handle)->dlscratch_base = NULL;
       D2_DEV(handle)->dlscratch_pos  = NULL;
 
+      /* free pooled display list blocks (may hold vidmem) */
+      d2_freedlistpool_intern(handle);
+
       err = d2hw_release( D2_DEV(handle)->hwid );
       D2_DEV(handle)->hwid = NULL;
       D2_RETERR(handle, err);
@@ -1154,6 +1175,93 @@ d2_s32 d2_flushframe( d2_device *handle )
    }
 }
 
+/*--------------------------------------------------------------------------
+ * function: d2_getfence
+ * Get a fence for the rendering started last.
+ *
+ * Call this right after <d2_executerenderbuffer>, <d2_endframe> or
+ * <d2_executedlist> to identify the display list just started. Pass the
+ * fence to <d2_waitfence> or <d2_fencesignaled> later, e.g. before reusing a
+ * renderbuffer, texture or framebuffer the hardware may still access. Unlike
+ * <d2_flushframe> the CPU can record further frames in the meantime.
+ *
+ * When display lists are emulated (d2_df_no_dlist) rendering is complete on
+ * return from the execute functions, and the returned fence is always
+ * signaled.
+ *
+ * parameters:
+ *   handle - device pointer (see: <d2_opendevice>)
+ *
+ * returns:
+ *   fence of the last display list, 0 if none was started
+ * */
+d2_u32 d2_getfence( d2_device *handle )
+{
+   if(NULL == handle)
+   {
+      return 0;
+   }
+
+   if(0 != (D2_DEV(handle)->flags & d2_df_no_dlist))
+   {
+      return 0;
+   }
+
+   return (d2_u32) d1_fencecurrent( D2_DEV(handle)->hwid );
+}
+
+/*--------------------------------------------------------------------------
+ * function: d2_fencesignaled
+ * Check without blocking whether rendering up to a fence has finished.
+ *
+ * parameters:
+ *   handle - device pointer (see: <d2_opendevice>)
+ *   fence  - fence returned by <d2_getfence>
+ *
+ * returns:
+ *   1 if the hardware has finished the display list, 0 otherwise
+ * */
+d2_s32 d2_fencesignaled( d2_device *handle, d2_u32 fence )
+{
+   if((NULL == handle) || (0 == fence))
+   {
+      return 1;
+   }
+
+   return (d2_s32) d1_fencesignaled( D2_DEV(handle)->hwid, (d1_fence) fence );
+}
+
+/*--------------------------------------------------------------------------
+ * function: d2_waitfence
+ * Wait until rendering up to a fence has finished.
+ *
+ * The calling thread sleeps until the display list interrupt signals the
+ * fence (see <d1_fencewait>), so other threads, including one recording the
+ * next frame, keep running.
+ *
+ * parameters:
+ *   handle  - device pointer (see: <d2_opendevice>)
+ *   fence   - fence returned by <d2_getfence>
+ *   timeout - d1_to_wait_forever, d1_to_no_wait or a timeout as for <d1_queryirq>
+ *
+ * returns:
+ *   D2_OK if the fence is signaled, D2_DEVICEBUSY if the wait timed out
+ * */
+d2_s32 d2_waitfence( d2_device *handle, d2_u32 fence, d2_s32 timeout )
+{
+   if(NULL == handle)
+   {
+      return D2_INVALIDDEVICE;
+   }
+
+   if((0 != fence) && (0 == d1_fencewait( D2_DEV(handle)->hwid, (d1_fence) fence, (int) timeout )))
+   {
+      D2_RETERR(handle, D2_DEVICEBUSY);
+   }
+
+   D2_RETOK(handle);
+}
+
 /*--------------------------------------------------------------------------
  * function: d2_setdlistblocksize
  * Set blocksize for default displaylists.
@@ -128,6 +128,21 @@ typedef void (*d2_fp_scratchfull)( void *handle );
 /* Create the D2_VERSION_STRING macro */
 #define D2_VERSION_STRING  D2_VERSION_BRANCH_STRING " V" D2_XSTR(D2_VERSION_MAJOR) "." D2_XSTR(D2_VERSION_MINOR)
 
+/*---------------------------------------------------------------------------
+ * Circle setup cache (see d2_circlesetup_intern). Size must be a power of two, 0 disables */
+#ifndef D2_CIRCLECACHE_ENTRIES
+#define D2_CIRCLECACHE_ENTRIES 8
+#endif
+
+typedef struct _d2_circlecacheentry
+{
+   d2_point x, y;                      /* bbox relative center (key) */
+   d2_width r;                         /* radius (key), 0 marks an empty entry */
+   d2_width blur;                      /* blurring, 0 if not blurred (key) */
+   d2_s32   hiprec;                    /* high precision limiters used (key) */
+   d2_s32   f, a, b, ir;               /* limiter setup */
+} d2_circlecacheentry;
+
 /*---------------------------------------------------------------------------
  * Internal device structure */
 
@@ -177,6 +192,10 @@ typedef struct _d2_devicedata
    d2_u32 hwmemarchitecture;
 
    d2_u32 dlistblocksize;              /* specify number of entries to grow when dlist is full */
+   d2_u32 rbbudget;                    /* render buffer memory limit in bytes (0 = unlimited) */
+   d2_u32 rbflags;                     /* see 'd2_rbbudgetflags' */
+   d2_rbstats rbstats;                 /* render buffer memory statistics */
+   d2_dlist_block *rbpool;             /* freed dlist blocks kept for reuse (d2_rbb_pool) */
 #ifdef D2_USEREGCACHE
    d2_cacheddata cache;                 /* register cache for this device */
 #endif
@@ -195,6 +214,10 @@ typedef struct _d2_devicedata
    d2_s8   dlist_indirect_supported;     /* is set to 1 when lists of dlist addresses are supported by d1 driver */
    d2_s32* dlist_list_single[2];         /* for d2_executedlist we need an extra dlist list with just one entry   */
 
+#if D2_CIRCLECACHE_ENTRIES > 0
+   d2_circlecacheentry circlecache[D2_CIRCLECACHE_ENTRIES];  /* setups of recently rendered circles */
+#endif
+
 } d2_devicedata;
 
 /*--------------------------------------------------------------------------- */
@@ -126,6 +126,15 @@
 /*--------------------------------------------------------------------------*/
 static d2_s32 d2_resizerblayer_intern( const d2_device *handle, d2_rb_layer *layer ); /* MISRA */
 static void d2_scratchgrowlayer_intern( d2_device *handle );
+static d2_u32 d2_dlistentry_intern( d2_u32 adrmask, d2_u32 *addrlanes, d2_u32 *terminate );
+static d2_u32 d2_scandlist_intern( const d2_u32 *words, d2_u32 count, const d2_dlistbase *bases, d2_u32 basecount,
+                                   d2_u32 *table, d2_u32 *patch );
+
+/*--------------------------------------------------------------------------*/
+#define D2_DLISTTERMINATOR     0x8f8f03ffu  /* end entry appended by d2_dumprenderbuffer */
+#define D2_DLISTIMAGE_MAGIC    0x4c443244u  /* 'D2DL' */
+#define D2_DLISTIMAGE_VERSION  1u
+#define D2_DLISTIMAGE_HEADER   5u           /* header size in words */
 
 
 /*--------------------------------------------------------------------------
@@ -289,6 +298,7 @@ d2_s32 d2_freerenderbuffer( d2_device *handle,  d2_renderbuffer *buffer )
    if(NULL != D2_DRB(buffer)->layer[0].scratch)
    {
       d2_freemem_p( D2_DRB(buffer)->layer[0].scratch );
+      d2_rbrelease_intern( handle, D2_DRB(buffer)->layer[0].fullsize * (d2_u32) sizeof(d2_dlist_scratch_entry) );
    }
 
    d2_freemem_p( buffer );
@@ -1062,7 +1072,7 @@ d2_s32 d2_dumprenderbuffer( d2_device *handle, d2_renderbuffer *buffer, void **r
    write = (d2_dlist_entry*) writePtr;
 
    /* add terminator */
-   write->address.mask = 0x8f8f03ffu;
+   write->address.mask = D2_DLISTTERMINATOR;
    write->value[0] = (d2_s32) D2_DEV(handle)->framebuffer;
    write->value[1] = (d2_s32) ( (D2_DEV(handle)->fbheight << 16) | D2_DEV(handle)->fbwidth );
    write->value[2] = 0;
@@ -1137,6 +1147,123 @@ d2_u32 d2_getrenderbuffersize(d2_device *handle, d2_renderbuffer *rb)
    return used + 1;  /* add one to consider display list end entry */
 }
 
+/*--------------------------------------------------------------------------
+ * function: d2_setrenderbufferbudget
+ * Limit and control the memory used by render buffers.
+ *
+ * The budget covers the display list pages and layer buffers of all render
+ * buffers of the device, including the two internal ones and pooled pages.
+ * Allocations that would exceed it fail like an out of memory condition:
+ * A full render buffer reports D2_NOT_ENOUGH_DLISTBLOCKS on execution and
+ * a full layer is merged early (see <d2_selectrendermode>).
+ *
+ * Together with d2_rbb_noshrink this makes the peak memory of an HMI fixed:
+ * Size the buffers once from the statistics (see <d2_getrenderbufferstats>)
+ * and they neither grow beyond the budget nor are freed and reallocated.
+ *
+ * parameters:
+ *   handle - device pointer (see: <d2_opendevice>)
+ *   budget - limit in bytes (0 = unlimited, default). Must not be
+ *            below the memory already allocated.
+ *   flags - budget flags
+ *
+ * budget flags:
+ *   d2_rbb_default  - unused pages are freed slowly (see <d2_newrenderbuffer>)
+ *   d2_rbb_noshrink - render buffers keep all pages they have grown to
+ *   d2_rbb_pool     - pages of shrunk or freed render buffers are kept in a
+ *                     device pool and reused when a buffer grows or a new one
+ *                     is created. Clearing the flag frees the pool.
+ *
+ * returns:
+ *   errorcode (D2_OK if successfull) see list of <Errorcodes> for details
+ *
+ * see also:
+ *   <d2_getrenderbufferstats>, <d2_releaserenderbufferpool>
+ * */
+d2_s32 d2_setrenderbufferbudget( d2_device *handle, d2_u32 budget, d2_u32 flags )
+{
+   D2_VALIDATE( handle, D2_INVALIDDEVICE );  /* PRQA S 3112 */ /* $Misra: #DEBUG_MACRO $*/
+
+   if( (0 != budget) && (budget < D2_DEV(handle)->rbstats.allocated) )
+   {
+      D2_RETERR( handle, D2_VALUETOOSMALL );
+   }
+
+   D2_DEV(handle)->rbbudget = budget;
+   D2_DEV(handle)->rbflags  = flags & (d2_rbb_noshrink | d2_rbb_pool);
+
+   if(0 == (flags & d2_rbb_pool))
+   {
+      d2_freedlistpool_intern( handle );
+   }
+
+   D2_RETOK(handle);
+}
+
+/*--------------------------------------------------------------------------
+ * function: d2_getrenderbufferstats
+ * Query render buffer memory statistics.
+ *
+ * 'peakentries' is the number of display list entries the largest frame
+ * needed; passing it as initialsize to <d2_newrenderbuffer> (or to
+ * <d2_setdlistblocksize> for the internal buffers) avoids any growth.
+ * 'peak' is the highest memory use seen and a good starting point for the
+ * budget (see <d2_setrenderbufferbudget>).
+ *
+ * parameters:
+ *   handle - device pointer (see: <d2_opendevice>)
+ *   stats - receives the statistics
+ *   reset - if not 0 the peak values and counters are reset after reading
+ *
+ * returns:
+ *   errorcode (D2_OK if successfull) see list of <Errorcodes> for details
+ * */
+d2_s32 d2_getrenderbufferstats( d2_device *handle, d2_rbstats *stats, d2_u32 reset )
+{
+   d2_rbstats *rbstats;
+
+   D2_VALIDATE( handle, D2_INVALIDDEVICE );  /* PRQA S 3112 */ /* $Misra: #DEBUG_MACRO $*/
+   D2_CHECKERR( stats, D2_NULLPOINTER );     /* PRQA S 3112 */ /* $Misra: #DEBUG_MACRO $*/
+
+   rbstats = &D2_DEV(handle)->rbstats;
+
+   *stats = *rbstats;
+   stats->budget = D2_DEV(handle)->rbbudget;
+
+   if(0 != reset)
+   {
+      rbstats->peak        = rbstats->allocated;
+      rbstats->peakentries = 0;
+      rbstats->peaklayer   = 0;
+      rbstats->grows       = 0;
+      rbstats->refused     = 0;
+   }
+
+   D2_RETOK(handle);
+}
+
+/*--------------------------------------------------------------------------
+ * function: d2_releaserenderbufferpool
+ * Free the display list pages held by the render buffer pool.
+ *
+ * Pooling stays enabled (see <d2_setrenderbufferbudget>); pages freed later
+ * are pooled again.
+ *
+ * parameters:
+ *   handle - device pointer (see: <d2_opendevice>)
+ *
+ * returns:
+ *   errorcode (D2_OK if successfull) see list of <Errorcodes> for details
+ * */
+d2_s32 d2_releaserenderbufferpool( d2_device *handle )
+{
+   D2_VALIDATE( handle, D2_INVALIDDEVICE );  /* PRQA S 3112 */ /* $Misra: #DEBUG_MACRO $*/
+
+   d2_freedlistpool_intern( handle );
+
+   D2_RETOK(handle);
+}
+
 
 /*--------------------------------------------------------------------------
  * function: d2_freedumpedbuffer
@@ -1167,18 +1294,421 @@ d2_s32 d2_freedumpedbuffer( d2_device *handle, void *data )
    D2_RETOK(handle);
 }
 
+/*--------------------------------------------------------------------------
+ * Group: Persistent Display Lists
+ *
+ * A dumped renderbuffer (see: <d2_dumprenderbuffer>) can be stored in non
+ * volatile memory (e.g. QSPI or OSPI flash) and replayed later without
+ * recording the scene again. The only values of a dumped list that depend on
+ * the memory layout at record time are the framebuffer and texture
+ * addresses.
+ *
+ * <d2_serializedlist> converts a dumped list into a position independent
+ * image: every address that points into one of the given base regions is
+ * replaced by its offset from that region and listed in a relocation table.
+ * Addresses outside all regions (e.g. textures placed at a fixed flash
+ * address) are stored unchanged.
+ *
+ * <d2_loaddlist> copies the image into GPU accessible memory and patches the
+ * relocated addresses with the current base addresses. Subsequent frames can
+ * use d2_ld_patchonly to retarget the loaded list (e.g. to the next
+ * framebuffer of a double buffered display) by rewriting only the relocated
+ * words. The result is executed by <d2_executedlist> or <d2_adddlist>.
+ *
+ * note:
+ *  The image itself is read only and may be placed in flash. It can only be
+ *  executed in place if all regions are used at the addresses they had when
+ *  the image was created.
+ * */
+
+/*--------------------------------------------------------------------------
+ * decode one display list entry:
+ * returns the number of data words following the address mask, sets a bit
+ * in addrlanes for every value written to an address register and sets
+ * terminate if the entry ends the list */
+static d2_u32 d2_dlistentry_intern( d2_u32 adrmask, d2_u32 *addrlanes, d2_u32 *terminate )
+{
+   d2_u32 values = 0;
+   d2_u32 lane;
+   d2_u32 argument;
+
+   *addrlanes = 0;
+   *terminate = 0;
+
+   if(D2_DLISTTERMINATOR == adrmask)
+   {
+      /* terminator added by d2_dumprenderbuffer: first value is the framebuffer */
+      values     = 4;
+      *addrlanes = 1u;
+      *terminate = 1u;
+   }
+   else if(0 == (adrmask & 0x80808080u))
+   {
+      /* contains simple indices only */
+      values = 4;
+   }
+   else if(0x80808080u == adrmask)
+   {
+      /* completely empty */
+      values = 0;
+   }
+   else if(0 != (adrmask & 0x00008000u))
+   {
+      /* index1 only (dumped lists contain no jumps) */
+      values = 1;
+   }
+   else if(0 != (adrmask & 0x00800000u))
+   {
+      /* index1&2 only */
+      values = 2;
+
+      if(0xffu == (adrmask & 0xffu))
+      {
+         /* end of list word, terminate unless it is just a flush */
+         values   = 0;
+         argument = (adrmask >> 8) & 0xffu;
+
+         if( (0 == (argument & 2u)) && (0 == (argument & 4u)) )
+         {
+            *terminate = 1u;
+         }
+      }
+   }
+   else if(0 != (adrmask & 0x80000000u))
+   {
+      /* index1,2,3 only */
+      values = 3;
+   }
+   else
+   {
+      /* end of list word or invalid case */
+      if(0xffu == (adrmask & 0xffu))
+      {
+         argument = (adrmask >> 8) & 0xffu;
+
+         if( (argument != 2u) && (argument != 4u) )
+         {
+            *terminate = 1u;
+         }
+      }
+   }
+
+   if(0 == *terminate)
+   {
+      for(lane = 0; lane < values; lane++)
+      {
+         d2_u32 reg = (adrmask >> (lane * 8u)) & 0xffu;
+
+         if((D2_ORIGIN == reg) || (D2_TEXORIGIN == reg))
+         {
+            *addrlanes |= 1u << lane;
+         }
+      }
+   }
+
+   return values;
+}
+
+/*--------------------------------------------------------------------------
+ * walk a flat display list and count the addresses inside the base regions.
+ * if table is not NULL, relocation entries are stored there and the region
+ * offsets are written to the matching words of patch */
+static d2_u32 d2_scandlist_intern( const d2_u32 *words, d2_u32 count, const d2_dlistbase *bases, d2_u32 basecount,
+                                   d2_u32 *table, d2_u32 *patch )
+{
+   d2_u32 pos       = 0;
+   d2_u32 relocs    = 0;
+   d2_u32 terminate = 0;
+
+   while((pos < count) && (0 == terminate))
+   {
+      d2_u32 addrlanes;
+      d2_u32 lane;
+      d2_u32 values = d2_dlistentry_intern( words[pos], &addrlanes, &terminate );
+
+      for(lane = 0; (lane < values) && ((pos + 1u + lane) < count); lane++)
+      {
+         if(0 != (addrlanes & (1u << lane)))
+         {
+            d2_u32 word = pos + 1u + lane;
+            d2_u32 slot = 0;
+
+            while(slot < basecount)
+            {
+               d2_u32 start = (d2_u32) bases[slot].address;
+
+               if((words[word] >= start) && ((words[word] - start) < bases[slot].size))
+               {
+                  if(NULL != table)
+                  {
+                     table[relocs] = (word << 8) | slot;
+                     patch[word]   = words[word] - start;
+                  }
+
+                  relocs++;
+                  slot = basecount; /*break;*/
+               }
+               else
+               {
+                  slot++;
+               }
+            }
+         }
+      }
+
+      pos += 1u + values;
+   }
+
+   return relocs;
+}
+
+/*--------------------------------------------------------------------------
+ * function: d2_serializedlist
+ * Convert a dumped display list into a relocatable image.
+ *
+ * The image consists of a small header, a relocation table and the display
+ * list itself where all framebuffer and texture addresses that fall into one
+ * of the given regions are replaced by offsets. It can be stored in flash and
+ * later be prepared for execution by <d2_loaddlist>, passing the current
+ * addresses of the same regions in the same order.
+ *
+ * Call the function with rdata set to NULL to query the required image size.
+ *
+ * parameters:
+ *   handle    - device pointer (see: <d2_opendevice>)
+ *   dlist     - flat display list (created by <d2_dumprenderbuffer>)
+ *   dlistsize - size of the display list in bytes
+ *   bases     - array of relocatable memory regions (e.g. framebuffer first, then textures)
+ *   basecount - number of entries in bases (at most D2_DLISTBASES_MAX)
+ *   rdata     - destination for the image or NULL
+ *   rsize     - size of rdata in bytes, set to the image size by the function
+ *
+ * returns:
+ *   errorcode (D2_OK if successful) see list of <Errorcodes> for details
+ * */
+d2_s32 d2_serializedlist( d2_device *handle, const void *dlist, d2_s32 dlistsize, const d2_dlistbase *bases, d2_u32 basecount, void *rdata, d2_u32 *rsize )
+{
+   const d2_u32 *words = (const d2_u32 *) dlist;
+   d2_u32       *image;
+   d2_u32        count;
+   d2_u32        relocs;
+   d2_u32        required;
+   d2_u32        i;
+
+   D2_VALIDATE( handle, D2_INVALIDDEVICE );  /* PRQA S 3112 */ /* $Misra: #DEBUG_MACRO $*/
+   D2_CHECKERR( dlist, D2_INVALIDBUFFER );   /* PRQA S 3112 */ /* $Misra: #DEBUG_MACRO $*/
+   D2_CHECKERR( rsize, D2_NULLPOINTER );     /* PRQA S 3112 */ /* $Misra: #DEBUG_MACRO $*/
+
+   if((dlistsize <= 0) || (0 != (dlistsize & 3)))
+   {
+      D2_RETERR( handle, D2_INVALIDBUFFER );
+   }
+
+   count = (d2_u32) dlistsize >> 2;
+
+   /* relocation entries hold a 24bit word offset and an 8bit region index */
+   if((count > 0x00ffffffu) || (basecount > D2_DLISTBASES_MAX))
+   {
+      D2_RETERR( handle, D2_VALUETOOBIG );
+   }
+
+   if((0 != basecount) && (NULL == bases))
+   {
+      D2_RETERR( handle, D2_NULLPOINTER );
+   }
+
+   relocs   = d2_scandlist_intern( words, count, bases, basecount, NULL, NULL );
+   required = (D2_DLISTIMAGE_HEADER + relocs + count) * (d2_u32) sizeof(d2_u32);
+
+   if(NULL == rdata)
+   {
+      /* size query */
+      *rsize = required;
+      D2_RETOK(handle);
+   }
+
+   if(*rsize < required)
+   {
+      *rsize = required;
+      D2_RETERR( handle, D2_VALUETOOSMALL );
+   }
+
+   image    = (d2_u32 *) rdata;
+   image[0] = D2_DLISTIMAGE_MAGIC;
+   image[1] = D2_DLISTIMAGE_VERSION;
+   image[2] = count;
+   image[3] = relocs;
+   image[4] = basecount;
+
+   for(i = 0; i < count; i++)
+   {
+      image[D2_DLISTIMAGE_HEADER + relocs + i] = words[i];
+   }
+
+   (void) d2_scandlist_intern( words, count, bases, basecount, &image[D2_DLISTIMAGE_HEADER], &image[D2_DLISTIMAGE_HEADER + relocs] );
+
+   *rsize = required;
+
+   D2_RETOK(handle);
+}
+
+/*--------------------------------------------------------------------------
+ * function: d2_getserializeddlistsize
+ * Query the memory required to load a display list image.
+ *
+ * parameters:
+ *   image - display list image (created by <d2_serializedlist>)
+ *
+ * returns:
+ *   size of the loaded display list in bytes, or 0 if image is not valid
+ * */
+d2_u32 d2_getserializeddlistsize( const void *image )
+{
+   const d2_u32 *header = (const d2_u32 *) image;
+   d2_u32 size = 0;
+
+   if((NULL != header) && (D2_DLISTIMAGE_MAGIC == header[0]) && (D2_DLISTIMAGE_VERSION == header[1]))
+   {
+      size = header[2] * (d2_u32) sizeof(d2_u32);
+   }
+
+   return size;
+}
+
+/*--------------------------------------------------------------------------
+ * function: d2_loaddlist
+ * Prepare a display list image for execution.
+ *
+ * The display list stored in the image is copied to 'dlist' and all
+ * relocated addresses are set relative to the given base addresses. With
+ * d2_ld_patchonly the copy is skipped and only the relocated words are
+ * rewritten, which retargets a list loaded earlier from the same image at
+ * very low cost.
+ *
+ * The loaded list can be executed using <d2_executedlist> or added to the
+ * current renderbuffer using <d2_adddlist>.
+ *
+ * parameters:
+ *   handle    - device pointer (see: <d2_opendevice>)
+ *   image     - display list image (created by <d2_serializedlist>)
+ *   bases     - current start addresses of the regions passed to <d2_serializedlist>
+ *   basecount - number of entries in bases
+ *   dlist     - destination memory (must be accessible by the GPU)
+ *   dlistsize - size of dlist in bytes (see: <d2_getserializeddlistsize>)
+ *   flags     - d2_ld_copy or d2_ld_patchonly
+ *
+ * returns:
+ *   errorcode (D2_OK if successful) see list of <Errorcodes> for details
+ * */
+d2_s32 d2_loaddlist( d2_device *handle, const void *image, const void * const *bases, d2_u32 basecount, void *dlist, d2_u32 dlistsize, d2_u32 flags )
+{
+   const d2_u32 *header = (const d2_u32 *) image;
+   const d2_u32 *table;
+   const d2_u32 *words;
+   d2_u32       *dst = (d2_u32 *) dlist;
+   d2_u32        count;
+   d2_u32        relocs;
+   d2_u32        i;
+
+   D2_VALIDATE( handle, D2_INVALIDDEVICE );  /* PRQA S 3112 */ /* $Misra: #DEBUG_MACRO $*/
+   D2_CHECKERR( image, D2_INVALIDBUFFER );   /* PRQA S 3112 */ /* $Misra: #DEBUG_MACRO $*/
+   D2_CHECKERR( dlist, D2_NULLPOINTER );     /* PRQA S 3112 */ /* $Misra: #DEBUG_MACRO $*/
+
+   if((D2_DLISTIMAGE_MAGIC != header[0]) || (D2_DLISTIMAGE_VERSION != header[1]))
+   {
+      D2_RETERR( handle, D2_INVALIDBUFFER );
+   }
+
+   count  = header[2];
+   relocs = header[3];
+
+   if(basecount < header[4])
+   {
+      D2_RETERR( handle, D2_INVALIDINDEX );
+   }
+
+   if((0 != header[4]) && (NULL == bases))
+   {
+      D2_RETERR( handle, D2_NULLPOINTER );
+   }
+
+   if(dlistsize < (count * (d2_u32) sizeof(d2_u32)))
+   {
+      D2_RETERR( handle, D2_VALUETOOSMALL );
+   }
+
+   table = &header[D2_DLISTIMAGE_HEADER];
+   words = &table[relocs];
+
+   if(0 == (flags & d2_ld_patchonly))
+   {
+      for(i = 0; i < count; i++)
+      {
+         dst[i] = words[i];
+      }
+   }
+
+   for(i = 0; i < relocs; i++)
+   {
+      d2_u32 word = table[i] >> 8;
+      d2_u32 slot = table[i] & 0xffu;
+
+      dst[word] = words[word] + (d2_u32) bases[slot];
+   }
+
+   (void) d1_cacheblockflush( D2_DEV(handle)->hwid, d1_mem_dlist, dlist, count * (d2_u32) sizeof(d2_u32) );
+
+   D2_RETOK(handle);
+}
+
+/*--------------------------------------------------------------------------
+ * account for render buffer memory about to be allocated.
+ * returns 0 if the allocation would exceed the budget
+ * */
+d2_s32 d2_rbreserve_intern( const d2_device *handle, d2_u32 bytes )
+{
+   d2_rbstats *rbstats = &D2_DEV(handle)->rbstats;
+
+   if( (0 != D2_DEV(handle)->rbbudget) && (bytes > (D2_DEV(handle)->rbbudget - rbstats->allocated)) )
+   {
+      rbstats->refused++;
+      return 0;
+   }
+
+   rbstats->allocated += bytes;
+
+   if(rbstats->allocated > rbstats->peak)
+   {
+      rbstats->peak = rbstats->allocated;
+   }
+
+   return 1;
+}
+
+/*--------------------------------------------------------------------------
+ * account for render buffer memory that was freed
+ * */
+void d2_rbrelease_intern( const d2_device *handle, d2_u32 bytes )
+{
+   D2_DEV(handle)->rbstats.allocated -= bytes;
+}
+
 /*--------------------------------------------------------------------------
  * */
 d2_s32 d2_initrblayer_intern( const d2_device *handle, d2_rb_layer *layer, d2_u32 size )
 {
-   /* unused parameter */
-   (void) handle;           /* PRQA S 3112 */ /* $Misra: #COMPILER_WARNING $*/
+   if(0 == d2_rbreserve_intern( handle, size * (d2_u32) sizeof(d2_dlist_scratch_entry) ))
+   {
+      layer->scratch = NULL;
+      return 0;
+   }
 
    /* alloc scratch space */
    layer->scratch = (d2_dlist_scratch_entry*) d2_getmem_p( size * sizeof(d2_dlist_scratch_entry) );
 
    if(NULL == layer->scratch)
    {
+      d2_rbrelease_intern( handle, size * (d2_u32) sizeof(d2_dlist_scratch_entry) );
       return 0;
    }
 
@@ -1196,18 +1726,24 @@ static d2_s32 d2_resizerblayer_intern( const d2_device *handle, d2_rb_layer *lay
    void *newadr;
    d2_u32 newsize, inc;
 
-   /* unused parameter */
-   (void) handle;           /* PRQA S 3112 */ /* $Misra: #COMPILER_WARNING $*/
-
    /* simple groth heuristic : double the size each time it reaches its limit */
    newsize = layer->fullsize << 1;
+
+   if(0 == d2_rbreserve_intern( handle, layer->fullsize * (d2_u32) sizeof(d2_dlist_scratch_entry) ))
+   {
+      return 0;
+   }
+
    newadr = d2_reallocmem_p( newsize * sizeof(d2_dlist_scratch_entry), layer->scratch, 1 );
 
    if(NULL == newadr)
    {
+      d2_rbrelease_intern( handle, layer->fullsize * (d2_u32) sizeof(d2_dlist_scratch_entry) );
       return 0;
    }
 
+   D2_DEV(handle)->rbstats.grows++;
+
    /* update layerinfo struct */
    inc = newsize - layer->fullsize;
    layer->freesize += inc;
@@ -1317,6 +1853,11 @@ void d2_layer2dlist_intern( d2_device *handle )
       return;
    }
 
+   if((rblayer->fullsize - rblayer->freesize) > d2_dev->rbstats.peaklayer)
+   {
+      d2_dev->rbstats.peaklayer = rblayer->fullsize - rblayer->freesize;
+   }
+
    targetlayer = (d2_dev->dlscratch_hook == &d2_scratchgrowlayer_intern) ? 1 : 0;
 
    /* flush base scratch first */
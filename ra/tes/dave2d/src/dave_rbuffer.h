@@ -44,6 +44,9 @@ typedef struct _d2_rbuffer
 
 D2_EXTERN d2_s32 d2_initrblayer_intern( const d2_device *handle, d2_rb_layer *layer, d2_u32 size );
 
+D2_EXTERN d2_s32 d2_rbreserve_intern( const d2_device *handle, d2_u32 bytes );
+D2_EXTERN void d2_rbrelease_intern( const d2_device *handle, d2_u32 bytes );
+
 D2_EXTERN void d2_rendertolayer_intern( d2_device *handle );
 D2_EXTERN void d2_rendertobase_intern( d2_device *handle );
 D2_EXTERN void d2_layer2dlist_intern( d2_device *handle );
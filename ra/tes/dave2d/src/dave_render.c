@@ -306,6 +306,18 @@ void d2_setupmaterial_intern( d2_devicedata *handle, d2_contextdata *ctx )
  *
  * */
 void d2_startrender_intern( d2_devicedata *handle, const d2_bbox *bbox, d2_u32 delay )
+{
+   /* set registers */
+   D2_DLISTWRITEU(  D2_PITCH, ( ((d2_u16)handle->pitch) + (((d2_u16)delay) * 65536u) ) ); /*note : and can be avoided if pitch forced to be >0 */
+
+   d2_continuerender_intern( handle, bbox );
+}
+
+/*--------------------------------------------------------------------------
+ * start rendering of a bbox that reuses CONTROL and PITCH of the previous
+ * primitive (only SIZE and ORIGIN are written)
+ * */
+void d2_continuerender_intern( d2_devicedata *handle, const d2_bbox *bbox )
 {
    d2_s32 w,h;
 
@@ -314,7 +326,6 @@ void d2_startrender_intern( d2_devicedata *handle, const d2_bbox *bbox, d2_u32 d
    h = D2_INT4( bbox->ymax - bbox->ymin ) + 1;    /* PRQA S 0502 */ /* $Misra: #PERF_ARITHMETIC_SHIFT_RIGHT $*/
 
    /* set registers */
-   D2_DLISTWRITEU(  D2_PITCH, ( ((d2_u16)handle->pitch) + (((d2_u16)delay) * 65536u) ) ); /*note : and can be avoided if pitch forced to be >0 */
    D2_DLISTWRITES(  D2_SIZE,  (h * 65536) + w );
 
    /* start rendering */
@@ -450,6 +461,70 @@ d2_s32 d2_renderbox( d2_device *handle, d2_point x1, d2_point y1, d2_width w, d2
    D2_RETERR(handle, err);
 }
 
+/*--------------------------------------------------------------------------
+ * function: d2_renderboxes
+ * Render a batch of boxes.
+ *
+ * Same as calling <d2_renderbox> for every box, but the rendermode is resolved
+ * and the material is set up only once for the whole batch. In solid mode,
+ * boxes on whole pixels with a solid or twocolor fill and no blur or gradient
+ * (e.g. the bars of a histogram or a dense trace) add only two display list
+ * entries each.
+ *
+ * parameters:
+ *   handle - device pointer (see: <d2_opendevice>)
+ *   data - pointer to an array of 4*count d2_point values (x,y,w,h of each box, fixedpoint)
+ *   count - number of boxes
+ *
+ * returns:
+ *   errorcode (D2_OK if successfull) see list of <Errorcodes> for details
+ *
+ * see also:
+ *  <d2_renderbox>, <d2_renderlines>
+ * */
+d2_s32 d2_renderboxes( d2_device *handle, const d2_point *data, d2_u32 count )
+{
+   d2_s32 (*render)( d2_device *handle, d2_point x1, d2_point y1, d2_width w, d2_width h ) = NULL;
+   d2_u32 i;
+
+   D2_VALIDATE( handle, D2_INVALIDDEVICE );     /* PRQA S 4130, 3112 */ /* $Misra: #DEBUG_MACRO $*/
+   D2_CHECKERR( count > 0, D2_VALUENEGATIVE );  /* PRQA S 4130, 3112 */ /* $Misra: #DEBUG_MACRO $*/
+   D2_CHECKERR( data, D2_NULLPOINTER );         /* PRQA S 4130, 3112 */ /* $Misra: #DEBUG_MACRO $*/
+
+   switch(D2_DEV(handle)->rendermode)
+   {
+      case d2_rm_solid :
+      case d2_rm_postprocess:
+         d2_renderboxes_intern( D2_DEV(handle), D2_DEV(handle)->ctxsolid, data, count );
+         D2_RETOK(handle);
+
+      case d2_rm_outline :        render = &d2_renderbox_outline;
+         break;
+      case d2_rm_solid_outlined : render = &d2_renderbox_solidoutline;
+         break;
+      case d2_rm_shadow :         render = &d2_renderbox_shadow;
+         break;
+      case d2_rm_solid_shadow :   render = &d2_renderbox_solidshadow;
+         break;
+
+      default:
+         break;
+   }
+
+   if(NULL == render)
+   {
+      D2_RETERR(handle, D2_ILLEGALMODE);
+   }
+
+   for(i=0; i<count; i++)
+   {
+      (void)render( handle, data[0], data[1], (d2_width)data[2], (d2_width)data[3] );
+      data += 4;
+   }
+
+   D2_RETOK(handle);
+}
+
 /*--------------------------------------------------------------------------
  * function: d2_renderline
  * Render a wide line.
@@ -506,6 +581,82 @@ d2_s32 d2_renderline( d2_device *handle, d2_point x1, d2_point y1, d2_point x2,
    D2_RETERR(handle, err);
 }
 
+/*--------------------------------------------------------------------------
+ * function: d2_renderlines
+ * Render a batch of unconnected wide lines.
+ *
+ * Same as calling <d2_renderline> for every line with the same width and
+ * flags, but the rendermode is resolved and the material is set up only once
+ * for the whole batch. Use it for line segments that do not join (e.g. grid
+ * lines or the vertical strokes of a min/max trace); connected lines should
+ * use <d2_renderpolyline> to get proper joins.
+ *
+ * parameters:
+ *   handle - device pointer (see: <d2_opendevice>)
+ *   data - pointer to an array of 4*count d2_point values (x1,y1,x2,y2 of each line, fixedpoint)
+ *   count - number of lines
+ *   w - width of lines in pixels (fixedpoint)
+ *   flags - lineend flags applied to every line (see <d2_renderline>)
+ *
+ * returns:
+ *   errorcode (D2_OK if successfull) see list of <Errorcodes> for details
+ *
+ * see also:
+ *  <d2_renderline>, <d2_renderboxes>
+ * */
+d2_s32 d2_renderlines( d2_device *handle, const d2_point *data, d2_u32 count, d2_width w, d2_u32 flags )
+{
+   d2_s32 (*render)( d2_device *handle, d2_point x1, d2_point y1, d2_point x2, d2_point y2, d2_width w, d2_u32 flags ) = NULL;
+   d2_u32 i;
+
+   D2_VALIDATE( handle, D2_INVALIDDEVICE );     /* PRQA S 4130, 3112 */ /* $Misra: #DEBUG_MACRO $*/
+   D2_CHECKERR( count > 0, D2_VALUENEGATIVE );  /* PRQA S 4130, 3112 */ /* $Misra: #DEBUG_MACRO $*/
+   D2_CHECKERR( data, D2_NULLPOINTER );         /* PRQA S 4130, 3112 */ /* $Misra: #DEBUG_MACRO $*/
+
+   switch(D2_DEV(handle)->rendermode)
+   {
+      case d2_rm_solid :
+      case d2_rm_postprocess:
+      {
+         d2_contextdata *ctx = D2_DEV(handle)->ctxsolid;
+         d2_limdata edge_buffer[2];
+         d2_bbox    edge_bbox;
+
+         for(i=0; i<count; i++)
+         {
+            (void)d2_renderline_intern_split( D2_DEV(handle), ctx, data[0], data[1], data[2], data[3], w, flags, edge_buffer, &edge_bbox, NULL );
+            data += 4;
+         }
+         D2_RETOK(handle);
+      }
+
+      case d2_rm_outline :        render = &d2_renderline_outline;
+         break;
+      case d2_rm_solid_outlined : render = &d2_renderline_solidoutline;
+         break;
+      case d2_rm_shadow :         render = &d2_renderline_shadow;
+         break;
+      case d2_rm_solid_shadow :   render = &d2_renderline_solidshadow;
+         break;
+
+      default:
+         break;
+   }
+
+   if(NULL == render)
+   {
+      D2_RETERR(handle, D2_ILLEGALMODE);
+   }
+
+   for(i=0; i<count; i++)
+   {
+      (void)render( handle, data[0], data[1], data[2], data[3], w, flags );
+      data += 4;
+   }
+
+   D2_RETOK(handle);
+}
+
 /*--------------------------------------------------------------------------
  * function: d2_renderline2
  * Render a wide line with 2 different widths.
@@ -808,6 +959,74 @@ d2_s32 d2_renderwedge( d2_device *handle, d2_point x, d2_point y, d2_width r, d2
    D2_RETERR(handle, err);
 }
 
+/*--------------------------------------------------------------------------
+ * function: d2_renderarc
+ * Render a circle arc or circle ring arc between two integer angles.
+ *
+ * Same as <d2_renderwedge> but the edges are given as angles in degrees,
+ * which suits gauges and dials. The normal vectors are taken from a table,
+ * so no trigonometry is needed on the CPU, and arcs larger than 180 deg are
+ * flagged concave automatically.
+ *
+ * Angles are measured from the positive x axis and increase clockwise (y
+ * points down). The arc covers the sweep from startangle clockwise to
+ * endangle, so 270,0 is the upper right quarter. If both angles are equal
+ * nothing is rendered, a sweep of 360 deg renders a full circle or ring.
+ *
+ * parameters:
+ *   handle - device pointer (see: <d2_opendevice>)
+ *   x,y - center (fixedpoint)
+ *   r - radius (fixedpoint)
+ *   w - width or 0 for a solid circle (fixedpoint)
+ *   startangle - angle of first edge in degrees
+ *   endangle - angle of second edge in degrees
+ *   flags - edge sharing flags (d2_edge0_shared, d2_edge1_shared)
+ *
+ * returns:
+ *   errorcode (D2_OK if successful) see list of <Errorcodes> for details
+ *
+ * note:
+ *   Like <d2_renderwedge> this function overwrites the clip gradient settings!
+ *
+ * see also:
+ *   <d2_renderwedge>, <d2_rendercircle>
+ * */
+d2_s32 d2_renderarc( d2_device *handle, d2_point x, d2_point y, d2_width r, d2_width w, d2_s32 startangle, d2_s32 endangle, d2_u32 flags )
+{
+   d2_s32 sweep;
+   d2_s32 s1, c1, s2, c2;
+
+   D2_VALIDATE( handle, D2_INVALIDDEVICE );  /* PRQA S 4130, 3112 */ /* $Misra: #DEBUG_MACRO $*/
+
+   if(startangle == endangle)
+   {
+      D2_RETOK(handle);
+   }
+
+   sweep = (endangle - startangle) % 360;
+   if(sweep < 0)
+   {
+      sweep += 360;
+   }
+
+   if(0 == sweep)
+   {
+      return d2_rendercircle( handle, x, y, r, w );
+   }
+
+   d2_sincosdeg_intern( startangle, &s1, &c1 );
+   d2_sincosdeg_intern( endangle, &s2, &c2 );
+
+   flags &= d2_edge0_shared | d2_edge1_shared;
+   if(sweep > 180)
+   {
+      flags |= d2_wf_concave;
+   }
+
+   /* normals point to the inside: clockwise of the first and counterclockwise of the second edge */
+   return d2_renderwedge( handle, x, y, r, w, -s1, c1, s2, -c2, flags );
+}
+
 /*--------------------------------------------------------------------------
  * Group: Buffer Rendering
  * */
@@ -952,6 +1171,7 @@ d2_s32 d2_renderpolyline2( d2_device *handle, const d2_point *data, d2_u32 count
  * */
 d2_s32 d2_rendertrilist( d2_device *handle, const d2_point *data, const d2_u32 *flags, d2_u32 count)
 {
+   d2_s32 (*render)( d2_device *handle, d2_point x1, d2_point y1, d2_point x2, d2_point y2, d2_point x3, d2_point y3, d2_u32 flags ) = NULL;
    d2_u32 share;
    d2_u32 i;
 
@@ -959,6 +1179,31 @@ d2_s32 d2_rendertrilist( d2_device *handle, const d2_point *data, const d2_u32 *
    D2_CHECKERR( count > 0, D2_VALUENEGATIVE );  /* PRQA S 4130, 3112 */ /* $Misra: #DEBUG_MACRO $*/
    D2_CHECKERR( data, D2_NULLPOINTER );         /* PRQA S 4130, 3112 */ /* $Misra: #DEBUG_MACRO $*/
 
+   /* resolve rendermode once for the whole list */
+   switch(D2_DEV(handle)->rendermode)
+   {
+      case d2_rm_solid :          render = &d2_rendertri_solid;
+         break;
+      case d2_rm_outline :        render = &d2_rendertri_outline;
+         break;
+      case d2_rm_solid_outlined : render = &d2_rendertri_solidoutline;
+         break;
+      case d2_rm_shadow :         render = &d2_rendertri_shadow;
+         break;
+      case d2_rm_solid_shadow :   render = &d2_rendertri_solidshadow;
+         break;
+      case d2_rm_postprocess:     render = &d2_rendertri_solid;
+         break;
+
+      default:
+         break;
+   }
+
+   if(NULL == render)
+   {
+      D2_RETERR(handle, D2_ILLEGALMODE);
+   }
+
    /* simple loop */
    share = 0;
 
@@ -978,10 +1223,10 @@ d2_s32 d2_rendertrilist( d2_device *handle, const d2_point *data, const d2_u32 *
          flags++;
       }
 
-      (void)d2_rendertri( handle, px1, py1, px2, py2, px3, py3, share );
+      (void)render( handle, px1, py1, px2, py2, px3, py3, share );
    }
 
-   return 0;
+   D2_RETOK(handle);
 }
 
 /* function: d2_rendertristrip
@@ -22,6 +22,8 @@ typedef d2_s32 (*d2_fp_triangle)( d2_device *handle, d2_point x1, d2_point y1, d
 
 D2_EXTERN void d2_startrender_intern( d2_devicedata *handle, const d2_bbox *bbox, d2_u32 delay );
 
+D2_EXTERN void d2_continuerender_intern( d2_devicedata *handle, const d2_bbox *bbox );
+
 D2_EXTERN void d2_startrender_bottom_intern( d2_devicedata *handle, const d2_bbox *bbox, d2_u32 delay );
 
 D2_EXTERN void d2_setupmaterial_intern( d2_devicedata *handle, d2_contextdata *ctx );
@@ -0,0 +1,883 @@
+/*--------------------------------------------------------------------------
+ * Project: D/AVE
+ * File:    dave_texcache.c
+ *
+ * Description:
+ *  Texture cache for textures located in slow memory (e.g. XIP flash)
+ */
+
+/*--------------------------------------------------------------------------
+ *
+ * Title: Texture Cache
+ * Promoting textures from slow memory into fast memory
+ *
+ * Textures and blit sources stored in memory mapped (XIP) flash are fetched
+ * by the texture unit through the flash interface, which is often slower
+ * than the pixel pipeline. A texture cache keeps copies of recently used
+ * textures in a caller supplied arena in internal SRAM or SDRAM.
+ *
+ * <d2_texcachesetblitsrc> and <d2_texcachesettexture> replace calls to
+ * <d2_setblitsrc> and <d2_settexture>. The texture is looked up by its
+ * source address, geometry and format. On a miss it is copied into the
+ * arena and, depending on the flags passed to <d2_texcacheinit>, converted
+ * on the way:
+ *
+ *   d2_tc_clut - 16 and 32 bit textures with at most 256 different texel
+ *                values are stored as d2_mode_i8 with a CLUT, if that is
+ *                smaller (requires D2FB_TEXCLUT256, see <d2_getrevisionhw>)
+ *   d2_tc_rle  - blit sources are stored RLE compressed, if that is smaller
+ *                (requires D2FB_RLEUNIT)
+ *
+ * When the arena is full the least recently used entry which was not used
+ * in the current or the previous frame is evicted. Entries used more
+ * recently may still be read by a display list being executed, so a
+ * texture that does not fit is used directly from its source instead
+ * (a bypass). <d2_texcacheframe> has to be called once per frame to mark
+ * the frame boundary.
+ *
+ * The cache only assumes that source textures never change. If they do,
+ * <d2_texcacheflush> has to be called after the hardware finished all
+ * display lists using cached textures.
+ *
+ *-------------------------------------------------------------------------- */
+
+#include "dave_driver.h"
+#include "dave_intern.h"
+#include "dave_texture.h"
+
+/*--------------------------------------------------------------------------
+ * arena alignment of cache entries */
+#define D2_TC_ALIGN(x)   ( ((x) + 7u) & ~7u )   /* PRQA S 3453 */ /* $Misra: #MACRO_TYPECAST_OVERKILL $*/
+
+/*--------------------------------------------------------------------------
+ * d2_tc_blit marks blit sources in the entry key. RLE sources are never
+ * cached, so the flag does not collide with a real source format. */
+#define d2_tc_blit       d2_mode_rle
+
+/*--------------------------------------------------------------------------
+ * local functions */
+static d2_u32 d2_tc_texelbits( d2_u32 format );
+static d2_u32 d2_tc_toargb( d2_u32 texel, d2_u32 format );
+static d2_u32 d2_tc_read( const d2_u8 *row, d2_s32 x, d2_u32 bytes );
+static void d2_tc_write( d2_u8 *dst, d2_u32 texel, d2_u32 bytes );
+static d2_s32 d2_tc_find( const d2_texcache *cache, d2_u32 texel, d2_u32 colors );
+static d2_u32 d2_tc_palette( d2_texcache *cache, const d2_u8 *src, d2_s32 pitch, d2_s32 width, d2_s32 height, d2_u32 bytes );
+static d2_u32 d2_tc_get( const d2_texcache *cache, const d2_u8 *row, d2_s32 x, d2_u32 bytes, d2_u32 colors );
+static d2_u32 d2_tc_rleencode( const d2_texcache *cache, d2_u8 *dst, const d2_u8 *src, d2_s32 pitch, d2_s32 width, d2_s32 height, d2_u32 bytes, d2_u32 outbytes, d2_u32 colors );
+static void d2_tc_remove( d2_texcache *cache, d2_u32 index );
+static d2_s32 d2_tc_evict( d2_texcache *cache );
+static d2_u8 * d2_tc_alloc( d2_texcache *cache, d2_u32 size, d2_u32 *pos );
+static d2_texcacheentry * d2_tc_load( d2_device *handle, d2_texcache *cache, const void *ptr, d2_s32 pitch, d2_s32 width, d2_s32 height, d2_u32 format, d2_u32 kind );
+static d2_texcacheentry * d2_tc_lookup( d2_device *handle, d2_texcache *cache, const void *ptr, d2_s32 pitch, d2_s32 width, d2_s32 height, d2_u32 format, d2_u32 kind );
+static d2_s32 d2_tc_setclut( d2_device *handle, d2_texcacheentry *entry, d2_s32 loaded );
+
+/*--------------------------------------------------------------------------
+ * Bits per texel of a source format, 0 if the format cannot be cached. */
+static d2_u32 d2_tc_texelbits( d2_u32 format )
+{
+   d2_u32 bits;
+
+   switch (format & ~d2_mode_clut)
+   {
+      case d2_mode_argb8888:
+      case d2_mode_rgba8888:
+         bits = 32;
+         break;
+
+      case d2_mode_rgb565:
+      case d2_mode_argb4444:
+      case d2_mode_rgba4444:
+      case d2_mode_argb1555:
+      case d2_mode_rgba5551:
+         bits = 16;
+         break;
+
+      case d2_mode_alpha8:
+      case d2_mode_ai44:
+      case d2_mode_i8:
+         bits = 8;
+         break;
+
+      case d2_mode_alpha4:
+      case d2_mode_i4:
+         bits = 4;
+         break;
+
+      case d2_mode_alpha2:
+      case d2_mode_i2:
+         bits = 2;
+         break;
+
+      case d2_mode_alpha1:
+      case d2_mode_i1:
+         bits = 1;
+         break;
+
+      default:
+         bits = 0;   /* RLE sources and driver internal formats */
+         break;
+   }
+
+   return bits;
+}
+
+/*--------------------------------------------------------------------------
+ * Expand a 16 or 32 bit texel to the argb8888 CLUT format. The expansion
+ * replicates the upper bits like the texture unit does, rgb565 uses blue
+ * as alpha (see <d2_settexture>). */
+static d2_u32 d2_tc_toargb( d2_u32 texel, d2_u32 format )
+{
+   d2_u32 a, r, g, b;
+
+   switch (format)
+   {
+      case d2_mode_argb8888:
+         return texel;
+
+      case d2_mode_rgba8888:
+         return (texel >> 8) | (texel << 24);
+
+      case d2_mode_rgb565:
+         r = (texel >> 11) & 0x1fu;
+         g = (texel >> 5) & 0x3fu;
+         b = texel & 0x1fu;
+         r = (r << 3) | (r >> 2);
+         g = (g << 2) | (g >> 4);
+         b = (b << 3) | (b >> 2);
+         a = b;
+         break;
+
+      case d2_mode_argb4444:
+      case d2_mode_rgba4444:
+         if(d2_mode_rgba4444 == format)
+         {
+            texel = (texel >> 4) | ((texel & 0xfu) << 12);
+         }
+         a = ((texel >> 12) & 0xfu) * 0x11u;
+         r = ((texel >> 8) & 0xfu) * 0x11u;
+         g = ((texel >> 4) & 0xfu) * 0x11u;
+         b = (texel & 0xfu) * 0x11u;
+         break;
+
+      case d2_mode_argb1555:
+      case d2_mode_rgba5551:
+         if(d2_mode_rgba5551 == format)
+         {
+            texel = (texel >> 1) | ((texel & 1u) << 15);
+         }
+         a = (0 != (texel & 0x8000u)) ? 0xffu : 0u;
+         r = (texel >> 10) & 0x1fu;
+         g = (texel >> 5) & 0x1fu;
+         b = texel & 0x1fu;
+         r = (r << 3) | (r >> 2);
+         g = (g << 3) | (g >> 2);
+         b = (b << 3) | (b >> 2);
+         break;
+
+      default:
+         return 0;
+   }
+
+   return (a << 24) | (r << 16) | (g << 8) | b;
+}
+
+/*--------------------------------------------------------------------------
+ * Read texel x of a row of 1, 2 or 4 byte texels. */
+static d2_u32 d2_tc_read( const d2_u8 *row, d2_s32 x, d2_u32 bytes )
+{
+   if(4 == bytes)
+   {
+      return ((const d2_u32 *) row)[x];   /* PRQA S 3305 */ /* $Misra: #POINTER_CAST_ALIGNMENT $*/
+   }
+   if(2 == bytes)
+   {
+      return ((const d2_u16 *) row)[x];   /* PRQA S 3305 */ /* $Misra: #POINTER_CAST_ALIGNMENT $*/
+   }
+   return row[x];
+}
+
+/*--------------------------------------------------------------------------
+ * Store a texel bytewise (little endian), RLE packets are not aligned. */
+static void d2_tc_write( d2_u8 *dst, d2_u32 texel, d2_u32 bytes )
+{
+   d2_u32 i;
+
+   for(i = 0; i < bytes; i++)
+   {
+      dst[i] = (d2_u8) (texel >> (i * 8u));
+   }
+}
+
+/*--------------------------------------------------------------------------
+ * Binary search of a texel value in the sorted scratch palette.
+ * Returns the index or -1 if not found. */
+static d2_s32 d2_tc_find( const d2_texcache *cache, d2_u32 texel, d2_u32 colors )
+{
+   d2_s32 lo = 0;
+   d2_s32 hi = (d2_s32) colors - 1;
+
+   while(lo <= hi)
+   {
+      d2_s32 mid = (lo + hi) / 2;
+
+      if(cache->palette[mid] == texel)
+      {
+         return mid;
+      }
+      if(cache->palette[mid] < texel)
+      {
+         lo = mid + 1;
+      }
+      else
+      {
+         hi = mid - 1;
+      }
+   }
+
+   return -1;
+}
+
+/*--------------------------------------------------------------------------
+ * Collect the distinct texel values of a texture into the sorted scratch
+ * palette. Returns the number of colors or 0 if there are more than 256. */
+static d2_u32 d2_tc_palette( d2_texcache *cache, const d2_u8 *src, d2_s32 pitch, d2_s32 width, d2_s32 height, d2_u32 bytes )
+{
+   d2_u32 colors = 0;
+   d2_s32 x, y;
+
+   for(y = 0; y < height; y++)
+   {
+      const d2_u8 *row = &src[(d2_u32) y * (d2_u32) pitch * bytes];
+      d2_u32 last = 0;
+
+      for(x = 0; x < width; x++)
+      {
+         d2_u32 texel = d2_tc_read(row, x, bytes);
+         d2_u32 pos;
+
+         if( ((x > 0) && (texel == last)) || (d2_tc_find(cache, texel, colors) >= 0) )
+         {
+            last = texel;
+            continue;
+         }
+         last = texel;
+
+         if(colors == 256u)
+         {
+            return 0;
+         }
+
+         /* insert sorted */
+         pos = colors;
+         while( (pos > 0) && (cache->palette[pos - 1u] > texel) )
+         {
+            cache->palette[pos] = cache->palette[pos - 1u];
+            pos--;
+         }
+         cache->palette[pos] = texel;
+         colors++;
+      }
+   }
+
+   return colors;
+}
+
+/*--------------------------------------------------------------------------
+ * Fetch texel x of a source row as it is stored in the cache: the raw value
+ * or, if a palette is in use, its index. */
+static d2_u32 d2_tc_get( const d2_texcache *cache, const d2_u8 *row, d2_s32 x, d2_u32 bytes, d2_u32 colors )
+{
+   d2_u32 texel = d2_tc_read(row, x, bytes);
+
+   if(0 != colors)
+   {
+      texel = (d2_u32) d2_tc_find(cache, texel, colors);
+   }
+
+   return texel;
+}
+
+/*--------------------------------------------------------------------------
+ * RLE encode a texture for the RLE unit. Every packet starts with a header
+ * byte: if bit 7 is set the following texel is repeated (header & 0x7f) + 1
+ * times, otherwise header + 1 literal texels follow. Packets do not cross
+ * scanlines. If dst is NULL only the encoded size is returned. */
+static d2_u32 d2_tc_rleencode( const d2_texcache *cache, d2_u8 *dst, const d2_u8 *src, d2_s32 pitch, d2_s32 width, d2_s32 height, d2_u32 bytes, d2_u32 outbytes, d2_u32 colors )
+{
+   d2_u32 size = 0;
+   d2_s32 x, y, n;
+
+   for(y = 0; y < height; y++)
+   {
+      const d2_u8 *row = &src[(d2_u32) y * (d2_u32) pitch * bytes];
+
+      x = 0;
+      while(x < width)
+      {
+         d2_u32 texel = d2_tc_get(cache, row, x, bytes, colors);
+
+         n = 1;
+         while( (n < 128) && ((x + n) < width) && (d2_tc_get(cache, row, x + n, bytes, colors) == texel) )
+         {
+            n++;
+         }
+
+         if(n > 1)
+         {
+            if(NULL != dst)
+            {
+               dst[size] = (d2_u8) (0x80u | (d2_u32) (n - 1));
+               d2_tc_write(&dst[size + 1u], texel, outbytes);
+            }
+            size += 1u + outbytes;
+         }
+         else
+         {
+            /* literal packet up to the next run of two equal texels */
+            while( (n < 128) && ((x + n) < width) )
+            {
+               if( ((x + n + 1) < width) &&
+                   (d2_tc_get(cache, row, x + n, bytes, colors) == d2_tc_get(cache, row, x + n + 1, bytes, colors)) )
+               {
+                  break;
+               }
+               n++;
+            }
+
+            if(NULL != dst)
+            {
+               d2_s32 i;
+
+               dst[size] = (d2_u8) (n - 1);
+               for(i = 0; i < n; i++)
+               {
+                  d2_tc_write(&dst[size + 1u + ((d2_u32) i * outbytes)], d2_tc_get(cache, row, x + i, bytes, colors), outbytes);
+               }
+            }
+            size += 1u + ((d2_u32) n * outbytes);
+         }
+
+         x += n;
+      }
+   }
+
+   return size;
+}
+
+/*--------------------------------------------------------------------------
+ * Remove an entry, keeping the remaining entries sorted. */
+static void d2_tc_remove( d2_texcache *cache, d2_u32 index )
+{
+   d2_u32 i;
+
+   for(i = index; (i + 1u) < cache->count; i++)
+   {
+      cache->entry[i] = cache->entry[i + 1u];
+   }
+   cache->count--;
+}
+
+/*--------------------------------------------------------------------------
+ * Evict the least recently used entry that is not referenced by the
+ * current or the previous frame. Returns 0 if no entry can be evicted. */
+static d2_s32 d2_tc_evict( d2_texcache *cache )
+{
+   d2_u32 i;
+   d2_u32 victim = cache->count;
+   d2_u32 oldest = 0;
+
+   for(i = 0; i < cache->count; i++)
+   {
+      const d2_texcacheentry *entry = &cache->entry[i];
+
+      if( ((cache->frame - entry->lastframe) >= 2u) &&
+          ((victim == cache->count) || ((cache->clock - entry->lastuse) > oldest)) )
+      {
+         victim = i;
+         oldest = cache->clock - entry->lastuse;
+      }
+   }
+
+   if(victim == cache->count)
+   {
+      return 0;
+   }
+
+   d2_tc_remove(cache, victim);
+   cache->evictions++;
+   return 1;
+}
+
+/*--------------------------------------------------------------------------
+ * First fit allocation in the gaps between the address sorted entries.
+ * Returns NULL if there is no gap large enough. */
+static d2_u8 * d2_tc_alloc( d2_texcache *cache, d2_u32 size, d2_u32 *pos )
+{
+   d2_u32 i;
+   d2_u32 start = 0;
+
+   for(i = 0; i <= cache->count; i++)
+   {
+      d2_u32 end = cache->arenasize;
+
+      if(i < cache->count)
+      {
+         end = (d2_u32) (cache->entry[i].data - cache->arena);
+      }
+
+      if((end - start) >= size)
+      {
+         *pos = i;
+         return &cache->arena[start];
+      }
+
+      if(i < cache->count)
+      {
+         start = D2_TC_ALIGN(end + cache->entry[i].size);
+      }
+   }
+
+   return NULL;
+}
+
+/*--------------------------------------------------------------------------
+ * Load and convert a texture into the cache.
+ * Returns the new entry or NULL if the texture has to be bypassed. */
+static d2_texcacheentry * d2_tc_load( d2_device *handle, d2_texcache *cache, const void *ptr, d2_s32 pitch, d2_s32 width, d2_s32 height, d2_u32 format, d2_u32 kind )
+{
+   const d2_u8 *src = (const d2_u8 *) ptr;
+   d2_texcacheentry *entry;
+   d2_u32 features = D2_DEV(handle)->hwrevision;
+   d2_u32 bits = d2_tc_texelbits(format);
+   d2_u32 bytes = bits / 8u;
+   d2_u32 texels = (d2_u32) width * (d2_u32) height;
+   d2_u32 outbytes = bytes;
+   d2_u32 colors = 0;
+   d2_u32 cformat = format;
+   d2_s32 cpitch = width;
+   d2_u32 clutsize = 0;
+   d2_u32 datasize, rlesize;
+   d2_u32 pos, i;
+   d2_s32 y;
+   d2_u8 *data;
+
+   if(bits < 8u)
+   {
+      /* subbyte formats are copied unchanged including the padding up to pitch */
+      cpitch = pitch;
+      datasize = (((d2_u32) pitch * (d2_u32) height * bits) + 7u) / 8u;
+   }
+   else
+   {
+      if( (bits >= 16u) && (0 != (cache->flags & d2_tc_clut)) && (0 != (features & D2FB_TEXCLUT256)) &&
+          ((texels + (MAX_CLUT256_ENTRIES * sizeof(d2_color))) < (texels * bytes)) )
+      {
+         colors = d2_tc_palette(cache, src, pitch, width, height, bytes);
+         if(0 != colors)
+         {
+            outbytes = 1;
+            cformat  = d2_mode_i8 | d2_mode_clut;
+            clutsize = MAX_CLUT256_ENTRIES * sizeof(d2_color);
+         }
+      }
+
+      datasize = texels * outbytes;
+
+      if( (d2_tc_blit == kind) && (0 != (cache->flags & d2_tc_rle)) && (0 != (features & D2FB_RLEUNIT)) )
+      {
+         rlesize = d2_tc_rleencode(cache, NULL, src, pitch, width, height, bytes, outbytes, colors);
+         if(rlesize < datasize)
+         {
+            datasize = rlesize;
+            cformat |= d2_mode_rle;
+         }
+      }
+   }
+
+   if((clutsize + datasize) > cache->arenasize)
+   {
+      return NULL;
+   }
+
+   /* make room: a free slot and a large enough gap */
+   if(cache->count == (d2_u32) D2_TEXCACHE_ENTRIES)
+   {
+      if(0 == d2_tc_evict(cache))
+      {
+         return NULL;
+      }
+   }
+   data = d2_tc_alloc(cache, clutsize + datasize, &pos);
+   while(NULL == data)
+   {
+      if(0 == d2_tc_evict(cache))
+      {
+         return NULL;
+      }
+      data = d2_tc_alloc(cache, clutsize + datasize, &pos);
+   }
+
+   /* convert */
+   if(0 != clutsize)
+   {
+      d2_color *clut = (d2_color *) data;   /* PRQA S 3305 */ /* $Misra: #POINTER_CAST_ALIGNMENT $*/
+
+      for(i = 0; i < MAX_CLUT256_ENTRIES; i++)
+      {
+         clut[i] = (i < colors) ? d2_tc_toargb(cache->palette[i], format & ~d2_mode_clut) : 0u;
+      }
+   }
+
+   if(bits < 8u)
+   {
+      for(i = 0; i < datasize; i++)
+      {
+         data[i] = src[i];
+      }
+   }
+   else if(0 != (cformat & d2_mode_rle))
+   {
+      (void) d2_tc_rleencode(cache, &data[clutsize], src, pitch, width, height, bytes, outbytes, colors);
+   }
+   else
+   {
+      d2_u8 *dst = &data[clutsize];
+
+      for(y = 0; y < height; y++)
+      {
+         const d2_u8 *row = &src[(d2_u32) y * (d2_u32) pitch * bytes];
+         d2_s32 x;
+
+         for(x = 0; x < width; x++)
+         {
+            d2_tc_write(dst, d2_tc_get(cache, row, x, bytes, colors), outbytes);
+            dst = &dst[outbytes];
+         }
+      }
+   }
+
+   (void) d1_cacheblockflush(D2_DEV(handle)->hwid, d1_mem_texture, data, clutsize + datasize);
+
+   /* insert at the allocated position, keeping entries sorted by address */
+   for(i = cache->count; i > pos; i--)
+   {
+      cache->entry[i] = cache->entry[i - 1u];
+   }
+   cache->count++;
+
+   entry = &cache->entry[pos];
+   entry->source    = ptr;
+   entry->width     = width;
+   entry->height    = height;
+   entry->pitch     = pitch;
+   entry->srcformat = format | kind;
+   entry->data      = data;
+   entry->size      = clutsize + datasize;
+   entry->texels    = clutsize;
+   entry->format    = cformat;
+   entry->cpitch    = cpitch;
+
+   return entry;
+}
+
+/*--------------------------------------------------------------------------
+ * Find a texture in the cache or load it.
+ * Returns the entry or NULL if the texture has to be used from its source. */
+static d2_texcacheentry * d2_tc_lookup( d2_device *handle, d2_texcache *cache, const void *ptr, d2_s32 pitch, d2_s32 width, d2_s32 height, d2_u32 format, d2_u32 kind )
+{
+   d2_texcacheentry *entry = NULL;
+   d2_u32 i;
+
+   for(i = 0; i < cache->count; i++)
+   {
+      d2_texcacheentry *e = &cache->entry[i];
+
+      if( (e->source == ptr) && (e->srcformat == (format | kind)) &&
+          (e->width == width) && (e->height == height) && (e->pitch == pitch) )
+      {
+         entry = e;
+         break;
+      }
+   }
+
+   if(NULL != entry)
+   {
+      cache->hits++;
+   }
+   else
+   {
+      entry = d2_tc_load(handle, cache, ptr, pitch, width, height, format, kind);
+      if(NULL == entry)
+      {
+         cache->bypasses++;
+         return NULL;
+      }
+      cache->misses++;
+   }
+
+   cache->clock++;
+   entry->lastuse   = cache->clock;
+   entry->lastframe = cache->frame;
+
+   return entry;
+}
+
+/*--------------------------------------------------------------------------
+ * Select the CLUT of a converted entry. The CLUT is only set again on a
+ * hit if another CLUT was selected meanwhile; a newly loaded entry may
+ * reuse the address of an evicted CLUT and always has to be uploaded. */
+static d2_s32 d2_tc_setclut( d2_device *handle, d2_texcacheentry *entry, d2_s32 loaded )
+{
+   d2_color *clut = (d2_color *) entry->data;   /* PRQA S 3305 */ /* $Misra: #POINTER_CAST_ALIGNMENT $*/
+
+   if( (0 == entry->texels) || ((0 == loaded) && (D2_DEV(handle)->ctxselected->texclut == clut)) )
+   {
+      return D2_OK;
+   }
+
+   return d2_settexclut(handle, clut);
+}
+
+/*--------------------------------------------------------------------------
+ * function: d2_texcacheinit
+ * Initialize a texture cache.
+ *
+ * The arena must be accessible by the D/AVE 2D hardware (e.g. internal SRAM
+ * or SDRAM) and must remain valid as long as the cache is in use. The cache
+ * structure itself can be located anywhere.
+ *
+ * parameters:
+ *   cache - texture cache
+ *   arena - memory used to store cached textures
+ *   size  - size of the arena in bytes
+ *   flags - conversions applied when loading textures:
+ *
+ *   d2_tc_default - textures are stored unchanged
+ *   d2_tc_clut    - textures with at most 256 colors are converted to d2_mode_i8 with a CLUT
+ *   d2_tc_rle     - blit sources are RLE compressed
+ *
+ * returns:
+ *   errorcode (D2_OK if successful) see list of <Errorcodes> for details
+ * */
+d2_s32 d2_texcacheinit( d2_texcache *cache, void *arena, d2_u32 size, d2_u32 flags )
+{
+   d2_u32 skew;
+
+   if( (NULL == cache) || (NULL == arena) )
+   {
+      return D2_NULLPOINTER;
+   }
+
+   skew = D2_TC_ALIGN((d2_u32) arena) - (d2_u32) arena;   /* PRQA S 0306 */ /* $Misra: #CAST_POINTER_TO_INTEGER $*/
+   if(size <= skew)
+   {
+      return D2_VALUETOOSMALL;
+   }
+
+   cache->arena     = &((d2_u8 *) arena)[skew];
+   cache->arenasize = (size - skew) & ~7u;
+   cache->flags     = flags;
+   cache->count     = 0;
+   cache->clock     = 0;
+   cache->frame     = 0;
+   cache->hits      = 0;
+   cache->misses    = 0;
+   cache->bypasses  = 0;
+   cache->evictions = 0;
+
+   return D2_OK;
+}
+
+/*--------------------------------------------------------------------------
+ * function: d2_texcachesetblitsrc
+ * Specify a blit source through a texture cache.
+ *
+ * Same as <d2_setblitsrc> but the source is taken from the cache, loading
+ * it on a miss. If the source does not fit into the cache it is used from
+ * its original location. Converted sources select their CLUT with
+ * <d2_settexclut>.
+ *
+ * parameters:
+ *   handle - device pointer (see: <d2_opendevice>)
+ *   cache  - texture cache (see: <d2_texcacheinit>)
+ *   ptr    - address of the top left texel in the source memory
+ *   pitch  - number of texels (*not bytes*) per scanline
+ *   width  - width of the source in texels
+ *   height - height of the source in texels
+ *   format - texel encoding type (see: <d2_setblitsrc>)
+ *
+ * returns:
+ *   errorcode (D2_OK if successful) see list of <Errorcodes> for details
+ * */
+d2_s32 d2_texcachesetblitsrc( d2_device *handle, d2_texcache *cache, const void *ptr, d2_s32 pitch, d2_s32 width, d2_s32 height, d2_u32 format )
+{
+   d2_texcacheentry *entry;
+   d2_u32 misses;
+   d2_s32 err;
+
+   D2_VALIDATE( handle, D2_INVALIDDEVICE );             /* PRQA S 4130, 3112 */ /* $Misra: #DEBUG_MACRO $*/
+   D2_VALIDATE( cache, D2_NULLPOINTER );                /* PRQA S 4130, 3112 */ /* $Misra: #DEBUG_MACRO $*/
+   D2_VALIDATE( ptr, D2_NULLPOINTER );                  /* PRQA S 4130, 3112 */ /* $Misra: #DEBUG_MACRO $*/
+   D2_VALIDATE( width > 0, D2_INVALIDWIDTH );           /* PRQA S 4130, 3112 */ /* $Misra: #DEBUG_MACRO $*/
+   D2_VALIDATE( pitch >= width, D2_INVALIDWIDTH );      /* PRQA S 4130, 3112 */ /* $Misra: #DEBUG_MACRO $*/
+   D2_VALIDATE( height > 0, D2_INVALIDHEIGHT );         /* PRQA S 4130, 3112 */ /* $Misra: #DEBUG_MACRO $*/
+
+   misses = cache->misses;
+   entry  = d2_tc_lookup(handle, cache, ptr, pitch, width, height, format, d2_tc_blit);
+   if(NULL == entry)
+   {
+      return d2_setblitsrc(handle, (void *) ptr, pitch, width, height, format); /* PRQA S 0311 */ /* $Misra: #CONST_CAST $*/
+   }
+
+   err = d2_tc_setclut(handle, entry, (d2_s32) (misses != cache->misses));
+   if(D2_OK != err)
+   {
+      return err;
+   }
+
+   return d2_setblitsrc(handle, &entry->data[entry->texels], entry->cpitch, width, height, entry->format);
+}
+
+/*--------------------------------------------------------------------------
+ * function: d2_texcachesettexture
+ * Specify a texture through a texture cache.
+ *
+ * Same as <d2_settexture> but the texture is taken from the cache, loading
+ * it on a miss. If the texture does not fit into the cache it is used from
+ * its original location. Textures are never RLE compressed.
+ *
+ * parameters:
+ *   handle - device pointer (see: <d2_opendevice>)
+ *   cache  - texture cache (see: <d2_texcacheinit>)
+ *   ptr    - address of the top left texel in the source memory
+ *   pitch  - number of texels (*not bytes*) per scanline
+ *   width  - width of texture in texels
+ *   height - height of texture in texels
+ *   format - texel encoding type (see: <d2_settexture>)
+ *
+ * returns:
+ *   errorcode (D2_OK if successful) see list of <Errorcodes> for details
+ * */
+d2_s32 d2_texcachesettexture( d2_device *handle, d2_texcache *cache, const void *ptr, d2_s32 pitch, d2_s32 width, d2_s32 height, d2_u32 format )
+{
+   d2_texcacheentry *entry;
+   d2_u32 misses;
+   d2_s32 err;
+
+   D2_VALIDATE( handle, D2_INVALIDDEVICE );             /* PRQA S 4130, 3112 */ /* $Misra: #DEBUG_MACRO $*/
+   D2_VALIDATE( cache, D2_NULLPOINTER );                /* PRQA S 4130, 3112 */ /* $Misra: #DEBUG_MACRO $*/
+   D2_VALIDATE( ptr, D2_NULLPOINTER );                  /* PRQA S 4130, 3112 */ /* $Misra: #DEBUG_MACRO $*/
+   D2_VALIDATE( width > 0, D2_INVALIDWIDTH );           /* PRQA S 4130, 3112 */ /* $Misra: #DEBUG_MACRO $*/
+   D2_VALIDATE( pitch >= width, D2_INVALIDWIDTH );      /* PRQA S 4130, 3112 */ /* $Misra: #DEBUG_MACRO $*/
+   D2_VALIDATE( height > 0, D2_INVALIDHEIGHT );         /* PRQA S 4130, 3112 */ /* $Misra: #DEBUG_MACRO $*/
+
+   misses = cache->misses;
+   entry  = d2_tc_lookup(handle, cache, ptr, pitch, width, height, format, 0);
+   if(NULL == entry)
+   {
+      return d2_settexture(handle, (void *) ptr, pitch, width, height, format); /* PRQA S 0311 */ /* $Misra: #CONST_CAST $*/
+   }
+
+   err = d2_tc_setclut(handle, entry, (d2_s32) (misses != cache->misses));
+   if(D2_OK != err)
+   {
+      return err;
+   }
+
+   return d2_settexture(handle, &entry->data[entry->texels], entry->cpitch, width, height, entry->format);
+}
+
+/*--------------------------------------------------------------------------
+ * function: d2_texcacheframe
+ * Mark the start of a new frame.
+ *
+ * Entries used in the current or the previous frame are never evicted,
+ * since a display list still being executed may read them. Call once per
+ * frame, e.g. after <d2_endframe>.
+ *
+ * parameters:
+ *   cache - texture cache (see: <d2_texcacheinit>)
+ *
+ * returns:
+ *   errorcode (D2_OK if successful) see list of <Errorcodes> for details
+ * */
+d2_s32 d2_texcacheframe( d2_texcache *cache )
+{
+   if(NULL == cache)
+   {
+      return D2_NULLPOINTER;
+   }
+
+   cache->frame++;
+   return D2_OK;
+}
+
+/*--------------------------------------------------------------------------
+ * function: d2_texcacheflush
+ * Remove all entries from a texture cache.
+ *
+ * The statistics are kept. The hardware must not execute display lists
+ * referencing cached textures anymore.
+ *
+ * parameters:
+ *   cache - texture cache (see: <d2_texcacheinit>)
+ *
+ * returns:
+ *   errorcode (D2_OK if successful) see list of <Errorcodes> for details
+ * */
+d2_s32 d2_texcacheflush( d2_texcache *cache )
+{
+   if(NULL == cache)
+   {
+      return D2_NULLPOINTER;
+   }
+
+   cache->count = 0;
+   return D2_OK;
+}
+
+/*--------------------------------------------------------------------------
+ * function: d2_texcachegetstats
+ * Query texture cache statistics.
+ *
+ * parameters:
+ *   cache - texture cache (see: <d2_texcacheinit>)
+ *   stats - filled with hit/miss counters, arena usage and the hit rate in
+ *           lookups per mille served from the cache
+ *
+ * returns:
+ *   errorcode (D2_OK if successful) see list of <Errorcodes> for details
+ * */
+d2_s32 d2_texcachegetstats( const d2_texcache *cache, d2_texcachestats *stats )
+{
+   d2_u32 i;
+   d2_u32 hits, total;
+
+   if( (NULL == cache) || (NULL == stats) )
+   {
+      return D2_NULLPOINTER;
+   }
+
+   stats->hits      = cache->hits;
+   stats->misses    = cache->misses;
+   stats->bypasses  = cache->bypasses;
+   stats->evictions = cache->evictions;
+   stats->entries   = cache->count;
+   stats->used      = 0;
+   for(i = 0; i < cache->count; i++)
+   {
+      stats->used += cache->entry[i].size;
+   }
+
+   /* scale down to avoid overflow of hits * 1000 */
+   hits  = cache->hits;
+   total = cache->hits + cache->misses + cache->bypasses;
+   while(total > 0x400000u)
+   {
+      hits  >>= 1;
+      total >>= 1;
+   }
+   stats->hitrate = (0 != total) ? ((hits * 1000u) / total) : 0u;
+
+   return D2_OK;
+}
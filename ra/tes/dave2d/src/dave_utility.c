@@ -468,3 +468,308 @@ void d2_rendercircle_no_hilimiterprecision( d2_device *handle, d2_u32 flag )
       D2_DEV(handle)->hwrevision &= ~D2FB_HILIMITERPRECISION;
    }
 }
+
+
+/*--------------------------------------------------------------------------
+ * Dirty region helpers */
+
+static d2_s32 d2_dirtyrect_area( const d2_dirtyrect *r )
+{
+   return ((d2_s32)r->xmax - (d2_s32)r->xmin + 1) * ((d2_s32)r->ymax - (d2_s32)r->ymin + 1);
+}
+
+static void d2_dirtyrect_union( d2_dirtyrect *dst, const d2_dirtyrect *src )
+{
+   if(src->xmin < dst->xmin) { dst->xmin = src->xmin; }
+   if(src->ymin < dst->ymin) { dst->ymin = src->ymin; }
+   if(src->xmax > dst->xmax) { dst->xmax = src->xmax; }
+   if(src->ymax > dst->ymax) { dst->ymax = src->ymax; }
+}
+
+/* returns 1 if the rectangles overlap or touch each other */
+static d2_s32 d2_dirtyrect_touch( const d2_dirtyrect *a, const d2_dirtyrect *b )
+{
+   return (((d2_s32)a->xmin <= ((d2_s32)b->xmax + 1)) && ((d2_s32)b->xmin <= ((d2_s32)a->xmax + 1)) &&
+           ((d2_s32)a->ymin <= ((d2_s32)b->ymax + 1)) && ((d2_s32)b->ymin <= ((d2_s32)a->ymax + 1))) ? 1 : 0;
+}
+
+/* returns 1 if a lies fully inside b */
+static d2_s32 d2_dirtyrect_inside( const d2_dirtyrect *a, const d2_dirtyrect *b )
+{
+   return ((a->xmin >= b->xmin) && (a->xmax <= b->xmax) && (a->ymin >= b->ymin) && (a->ymax <= b->ymax)) ? 1 : 0;
+}
+
+/* insert a rectangle in a list, merging it with every rectangle it touches */
+static void d2_dirtyrect_insert( d2_dirtyrect *list, d2_u32 *count, const d2_dirtyrect *r )
+{
+   d2_dirtyrect add = *r;
+   d2_u32 i = 0;
+   d2_u32 best;
+   d2_s32 bestgrowth;
+
+   for(;;)
+   {
+      while(i < *count)
+      {
+         if(0 != d2_dirtyrect_touch(&list[i], &add))
+         {
+            /* take the rectangle out of the list and retry with the merged one, as it may touch others now */
+            d2_dirtyrect_union(&add, &list[i]);
+            (*count)--;
+            list[i] = list[*count];
+            i = 0;
+         }
+         else
+         {
+            i++;
+         }
+      }
+
+      if(*count < D2_DIRTYRECTS_MAX)
+      {
+         list[*count] = add;
+         (*count)++;
+         return;
+      }
+
+      /* list is full: merge with the rectangle that grows least, then check for touching rectangles again */
+      best = 0;
+      bestgrowth = 0;
+      for(i = 0; i < *count; i++)
+      {
+         d2_dirtyrect merged = list[i];
+         d2_s32 growth;
+
+         d2_dirtyrect_union(&merged, &add);
+         growth = d2_dirtyrect_area(&merged) - d2_dirtyrect_area(&list[i]);
+         if((0 == i) || (growth < bestgrowth))
+         {
+            best = i;
+            bestgrowth = growth;
+         }
+      }
+
+      d2_dirtyrect_union(&add, &list[best]);
+      (*count)--;
+      list[best] = list[*count];
+      i = 0;
+   }
+}
+
+
+/*--------------------------------------------------------------------------
+ * function: d2_utility_dirtyinit
+ * Initialize dirty region tracking for a double buffered framebuffer.
+ *
+ * Dirty region tracking lets an application redraw only the parts of the screen that changed.
+ * Each frame, the application reports the changed areas with <d2_utility_dirtyadd> and then
+ * renders the frame between <d2_utility_dirtybegin> and <d2_utility_dirtyend>:
+ *
+ * - <d2_utility_dirtybegin> copies the areas changed in the previous frame from the front buffer
+ *   (the one on display) into the current framebuffer, so the back buffer is up to date outside the
+ *   areas changed in this frame, and restricts rendering to the union of those areas.
+ * - <d2_utility_dirtyend> restores the full cliprect and moves on to the next frame.
+ *
+ * Both framebuffers must have the size, pitch and format of the current framebuffer (see <d2_framebuffer>).
+ * The whole screen is marked dirty for the first two frames, so both buffers get fully drawn once.
+ *
+ * parameters:
+ *   region - pointer to the dirty region state
+ *   width, height - size of the framebuffers in pixels
+ *
+ * returns:
+ *   errorcode (D2_OK if successful) see list of <Errorcodes> for details
+ * */
+d2_s32 d2_utility_dirtyinit( d2_dirtyregion *region, d2_u16 width, d2_u16 height )
+{
+   if(NULL == region)
+   {
+      return D2_NULLPOINTER;
+   }
+
+   if((0 == width) || (0 == height))
+   {
+      return (0 == width) ? D2_INVALIDWIDTH : D2_INVALIDHEIGHT;
+   }
+
+   region->width   = width;
+   region->height  = height;
+   region->current = 0;
+
+   region->rect[0][0].xmin = 0;
+   region->rect[0][0].ymin = 0;
+   region->rect[0][0].xmax = (d2_border)(width - 1);
+   region->rect[0][0].ymax = (d2_border)(height - 1);
+   region->rect[1][0]      = region->rect[0][0];
+   region->count[0]        = 1;
+   region->count[1]        = 1;
+
+   return D2_OK;
+}
+
+
+/*--------------------------------------------------------------------------
+ * function: d2_utility_dirtyadd
+ * Mark a rectangle as changed in the frame being prepared.
+ *
+ * The rectangle is clipped to the framebuffer. Rectangles that touch each other are merged,
+ * and when more than D2_DIRTYRECTS_MAX rectangles are needed the ones that grow least are merged.
+ * Both the old and the new position of a moving object have to be added.
+ *
+ * parameters:
+ *   region - pointer to the dirty region state (see: <d2_utility_dirtyinit>)
+ *   xmin, ymin, xmax, ymax - inclusive borders of the changed rectangle (integer)
+ *
+ * returns:
+ *   errorcode (D2_OK if successful) see list of <Errorcodes> for details
+ * */
+d2_s32 d2_utility_dirtyadd( d2_dirtyregion *region, d2_border xmin, d2_border ymin, d2_border xmax, d2_border ymax )
+{
+   d2_dirtyrect r;
+
+   if(NULL == region)
+   {
+      return D2_NULLPOINTER;
+   }
+
+   /* clip to framebuffer */
+   r.xmin = (xmin < 0) ? 0 : xmin;
+   r.ymin = (ymin < 0) ? 0 : ymin;
+   r.xmax = (xmax >= (d2_border)region->width) ? (d2_border)(region->width - 1) : xmax;
+   r.ymax = (ymax >= (d2_border)region->height) ? (d2_border)(region->height - 1) : ymax;
+
+   if((r.xmax < r.xmin) || (r.ymax < r.ymin))
+   {
+      /* nothing visible changed */
+      return D2_OK;
+   }
+
+   d2_dirtyrect_insert(region->rect[region->current], &region->count[region->current], &r);
+
+   return D2_OK;
+}
+
+
+/*--------------------------------------------------------------------------
+ * function: d2_utility_dirtybegin
+ * Prepare the current framebuffer for rendering the changed areas of a frame.
+ *
+ * Must be called after <d2_framebuffer> selected the back buffer and before rendering.
+ * The areas changed in the previous frame, that are not changed again in this frame, are blitted from
+ * the front buffer into the current framebuffer. Then the cliprect is set to the bounding box of the
+ * areas changed in this frame, so all following d2_render* calls only touch those areas.
+ * When nothing changed, the cliprect is reduced to a single pixel; rendering may then be skipped.
+ *
+ * This function sets the blit source (see <d2_setblitsrc>).
+ *
+ * parameters:
+ *   handle - device pointer (see: <d2_opendevice>)
+ *   region - pointer to the dirty region state (see: <d2_utility_dirtyinit>)
+ *   frontbuffer - address of the framebuffer currently on display
+ *
+ * returns:
+ *   errorcode (D2_OK if successful) see list of <Errorcodes> for details
+ * */
+d2_s32 d2_utility_dirtybegin( d2_device *handle, d2_dirtyregion *region, void *frontbuffer )
+{
+   d2_s32 result;
+   d2_u32 i, j;
+   d2_u32 cur;
+   d2_u32 prev;
+   d2_dirtyrect bbox;
+
+   D2_VALIDATEP( handle, D2_INVALIDDEVICE );                                                     /* PRQA S 4130, 3112 */ /* $Misra: #DEBUG_MACRO $*/
+   D2_CHECKERR( NULL != region, D2_NULLPOINTER );                                                /* PRQA S 4130, 3112 */ /* $Misra: #DEBUG_MACRO $*/
+   D2_CHECKERR( NULL != frontbuffer, D2_NULLPOINTER );                                           /* PRQA S 4130, 3112 */ /* $Misra: #DEBUG_MACRO $*/
+   D2_CHECKERR( D2_DEV(handle)->pitch > 0, D2_INVALIDWIDTH );                                    /* PRQA S 4130, 3112 */ /* $Misra: #DEBUG_MACRO $*/
+
+   cur  = region->current;
+   prev = cur ^ 1u;
+
+   /* bring the back buffer up to date: copy the previous frame's changes from the front buffer */
+   if(0 != region->count[prev])
+   {
+      result = d2_setblitsrc(handle, frontbuffer, D2_DEV(handle)->pitch, (d2_s32)D2_DEV(handle)->fbwidth,
+                             (d2_s32)D2_DEV(handle)->fbheight, (d2_u32)D2_DEV(handle)->fbformat);
+      if(D2_OK != result)
+      {
+         return result;
+      }
+
+      result = d2_cliprect(handle, 0, 0, (d2_border)(region->width - 1), (d2_border)(region->height - 1));
+      if(D2_OK != result)
+      {
+         return result;
+      }
+
+      for(i = 0; i < region->count[prev]; i++)
+      {
+         const d2_dirtyrect *r = &region->rect[prev][i];
+         d2_s32 redrawn = 0;
+         d2_s32 w = (d2_s32)r->xmax - (d2_s32)r->xmin + 1;
+         d2_s32 h = (d2_s32)r->ymax - (d2_s32)r->ymin + 1;
+
+         /* skip the copy if the area gets fully rendered in this frame anyway */
+         for(j = 0; (j < region->count[cur]) && (0 == redrawn); j++)
+         {
+            redrawn = d2_dirtyrect_inside(r, &region->rect[cur][j]);
+         }
+
+         if(0 == redrawn)
+         {
+            result = d2_blitcopy(handle, w, h, (d2_blitpos)r->xmin, (d2_blitpos)r->ymin,
+                                 (d2_width)(w << 4), (d2_width)(h << 4),                 /* PRQA S 4131 */ /* $Misra: #PERF_ARITHMETIC_SHIFT_LEFT $*/
+                                 (d2_point)(r->xmin << 4), (d2_point)(r->ymin << 4), 0); /* PRQA S 4131 */ /* $Misra: #PERF_ARITHMETIC_SHIFT_LEFT $*/
+            if(D2_OK != result)
+            {
+               return result;
+            }
+         }
+      }
+   }
+
+   /* restrict rendering to the union of this frame's changes */
+   if(0 == region->count[cur])
+   {
+      bbox.xmin = 0;
+      bbox.ymin = 0;
+      bbox.xmax = 0;
+      bbox.ymax = 0;
+   }
+   else
+   {
+      bbox = region->rect[cur][0];
+      for(i = 1; i < region->count[cur]; i++)
+      {
+         d2_dirtyrect_union(&bbox, &region->rect[cur][i]);
+      }
+   }
+
+   return d2_cliprect(handle, bbox.xmin, bbox.ymin, bbox.xmax, bbox.ymax);
+}
+
+
+/*--------------------------------------------------------------------------
+ * function: d2_utility_dirtyend
+ * Finish rendering a frame started with <d2_utility_dirtybegin>.
+ *
+ * Restores the cliprect to the full framebuffer. The changes of this frame are kept to bring the
+ * next back buffer up to date, and tracking of the next frame starts empty.
+ *
+ * parameters:
+ *   handle - device pointer (see: <d2_opendevice>)
+ *   region - pointer to the dirty region state (see: <d2_utility_dirtyinit>)
+ *
+ * returns:
+ *   errorcode (D2_OK if successful) see list of <Errorcodes> for details
+ * */
+d2_s32 d2_utility_dirtyend( d2_device *handle, d2_dirtyregion *region )
+{
+   D2_VALIDATEP( handle, D2_INVALIDDEVICE );                                                     /* PRQA S 4130, 3112 */ /* $Misra: #DEBUG_MACRO $*/
+   D2_CHECKERR( NULL != region, D2_NULLPOINTER );                                                /* PRQA S 4130, 3112 */ /* $Misra: #DEBUG_MACRO $*/
+
+   region->current ^= 1u;
+   region->count[region->current] = 0;
+
+   return d2_cliprect(handle, 0, 0, (d2_border)(region->width - 1), (d2_border)(region->height - 1));
+}
@@ -27,6 +27,23 @@ static d2_u32 count_leading_zeroes16(d2_u16 v); /* MISRA */
 static d2_s32 is_same_direction(d2_s32 nx1, d2_s32 ny1, d2_s32 nx2, d2_s32 ny2); /* MISRA */
 static d2_s32 d2_renderwedge_intern( d2_devicedata *handle, d2_contextdata *ctx, d2_point x, d2_point y, d2_width r, d2_width w, d2_s32 nx1, d2_s32 ny1, d2_s32 nx2, d2_s32 ny2, d2_u32 flags ); /* MISRA */
 
+/* sin(0..90 deg) in 16.16 fixedpoint */
+static const d2_s32 g_d2_sintab[91] =
+{
+        0,   1144,   2287,   3430,   4572,   5712,   6850,   7987,
+     9121,  10252,  11380,  12505,  13626,  14742,  15855,  16962,
+    18064,  19161,  20252,  21336,  22415,  23486,  24550,  25607,
+    26656,  27697,  28729,  29753,  30767,  31772,  32768,  33754,
+    34729,  35693,  36647,  37590,  38521,  39441,  40348,  41243,
+    42126,  42995,  43852,  44695,  45525,  46341,  47143,  47930,
+    48703,  49461,  50203,  50931,  51643,  52339,  53020,  53684,
+    54332,  54963,  55578,  56175,  56756,  57319,  57865,  58393,
+    58903,  59396,  59870,  60326,  60764,  61183,  61584,  61966,
+    62328,  62672,  62997,  63303,  63589,  63856,  64104,  64332,
+    64540,  64729,  64898,  65048,  65177,  65287,  65376,  65446,
+    65496,  65526,  65536
+};
+
 
 /*--------------------------------------------------------------------------
  *
@@ -288,6 +305,40 @@ static d2_s32 d2_renderwedge_intern( d2_devicedata *handle, d2_contextdata *ctx,
    return 1;
 }
 
+/*--------------------------------------------------------------------------
+ * sine and cosine of an integer angle in degrees (16.16 fixedpoint)
+ * */
+void d2_sincosdeg_intern( d2_s32 angle, d2_s32 *s, d2_s32 *c )
+{
+   d2_s32 a = angle % 360;
+
+   if(a < 0)
+   {
+      a += 360;
+   }
+
+   if(a <= 90)
+   {
+      *s =  g_d2_sintab[a];
+      *c =  g_d2_sintab[90 - a];
+   }
+   else if(a <= 180)
+   {
+      *s =  g_d2_sintab[180 - a];
+      *c = -g_d2_sintab[a - 90];
+   }
+   else if(a <= 270)
+   {
+      *s = -g_d2_sintab[a - 180];
+      *c = -g_d2_sintab[270 - a];
+   }
+   else
+   {
+      *s = -g_d2_sintab[360 - a];
+      *c =  g_d2_sintab[a - 270];
+   }
+}
+
 /*--------------------------------------------------------------------------
  *
  * */
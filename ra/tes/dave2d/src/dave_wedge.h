@@ -21,5 +21,7 @@ D2_EXTERN d2_s32 d2_renderwedge_shadow( d2_device *handle, d2_point x, d2_point
 D2_EXTERN d2_s32 d2_renderwedge_solidoutline( d2_device *handle, d2_point x, d2_point y, d2_width r, d2_width w, d2_s32 nx1, d2_s32 ny1, d2_s32 nx2, d2_s32 ny2, d2_u32 flags );
 D2_EXTERN d2_s32 d2_renderwedge_solidshadow( d2_device *handle, d2_point x, d2_point y, d2_width r, d2_width w, d2_s32 nx1, d2_s32 ny1, d2_s32 nx2, d2_s32 ny2, d2_u32 flags );
 
+D2_EXTERN void d2_sincosdeg_intern( d2_s32 angle, d2_s32 *s, d2_s32 *c );
+
 /*--------------------------------------------------------------------------- */
 #endif